@@ -94,6 +94,21 @@ struct features {
      * i.e. they will stay maximum until sampled.
      */
     bool overflow_behavior_defined;
+
+    /**
+     * Number of samples that the kernel ring buffer holds, i.e. how many
+     * samples may be taken before they are read without dropping any.
+     *
+     * Zero if the kernel doesn't report it: kinstr_prfcnt sizes its ring
+     * buffer itself, and only reports its size in bytes.
+     */
+    uint32_t buffer_count;
+
+    /**
+     * Size in bytes of the kernel ring buffer mapped into the process, which
+     * counts against its memory although the kernel allocated it.
+     */
+    uint64_t mapped_size;
 };
 
 } // namespace hwcnt
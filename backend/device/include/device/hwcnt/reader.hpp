@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023 Arm Limited.
+ * Copyright (c) 2021-2025 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -36,6 +36,7 @@
 #include <device/hwcnt/features.hpp>
 
 #include <array>
+#include <cstdint>
 #include <system_error>
 
 namespace hwcpipe {
@@ -171,6 +172,38 @@ class HWCPIPE_DEVICE_API reader {
      */
     const block_extents &get_block_extents() const { return block_extents_; }
 
+    /**
+     * Check if a new hardware counters sample is ready.
+     *
+     * Poll the hardware counters file descriptor without waiting. If the function
+     * reports the sample as ready, the following @ref get_sample call will not block.
+     *
+     * @par Example
+     * @code
+     * bool ready{};
+     * std::error_code ec = reader.is_sample_ready(ready);
+     * if (!ec && ready)
+     *     reader.get_sample(metadata, hndl);
+     * @endcode
+     *
+     * @param[out] ready    Set to true if a sample is ready to be read, false otherwise.
+     * @return Error code.
+     */
+    std::error_code is_sample_ready(bool &ready) const;
+
+    /**
+     * Wait until a new hardware counters sample is ready, or until a timeout expires.
+     *
+     * Poll the hardware counters file descriptor for at most @p timeout_ns. If the function
+     * reports the sample as ready, the following @ref get_ready_sample call will succeed.
+     *
+     * @param[out] ready         Set to true if a sample is ready to be read, false if the
+     *                           timeout expired.
+     * @param[in]  timeout_ns    Timeout in nanoseconds, rounded up to milliseconds.
+     * @return Error code.
+     */
+    std::error_code is_sample_ready(bool &ready, uint64_t timeout_ns) const;
+
     /**
      * Wait and get a new hardware counters sample.
      *
@@ -197,6 +230,78 @@ class HWCPIPE_DEVICE_API reader {
      */
     virtual std::error_code get_sample(sample_metadata &sm, sample_handle &sample_hndl) = 0;
 
+    /**
+     * Get a hardware counters sample that is ready, without waiting for it.
+     *
+     * Same as @ref get_sample, except that the file descriptor is not polled: the
+     * sample is fetched from the ring buffer straight away. This saves a `poll()`
+     * call when the caller already knows that samples are waiting, e.g. after
+     * @ref get_sample returned a sample that is older than the sampling period.
+     * If no sample is ready, an error is returned.
+     *
+     * @note It is a low level function, it is more convenient to use @ref read_samples.
+     *
+     * @param[out] sm             Reference where decoded sample meta-data will be stored.
+     * @param[out] sample_hndl    Reference where opaque sample handle will be stored.
+     * @return Error code.
+     */
+    virtual std::error_code get_ready_sample(sample_metadata &sm, sample_handle &sample_hndl);
+
+    /**
+     * Wait for a new hardware counters sample with a timeout, and get it.
+     *
+     * Same as @ref get_sample, except that the wait is bounded so that a thread is not
+     * blocked forever if the GPU stalls or the kernel never delivers the sample.
+     *
+     * @par Example
+     * @code
+     * std::error_code ec = reader.get_sample_for(metadata, hndl, 100000000);
+     * if (ec == std::errc::timed_out)
+     *     puts("No sample in 100ms, skipping it.");
+     * @endcode
+     *
+     * @param[out] sm             Reference where decoded sample meta-data will be stored.
+     * @param[out] sample_hndl    Reference where opaque sample handle will be stored.
+     * @param[in]  timeout_ns     Time to wait for the sample in nanoseconds, rounded up to
+     *                            milliseconds.
+     * @return Error code, `std::errc::timed_out` if no sample was ready in time.
+     */
+    std::error_code get_sample_for(sample_metadata &sm, sample_handle &sample_hndl, uint64_t timeout_ns);
+
+    /** Callback of @ref read_samples. */
+    using sample_callback = void (*)(void *user_data, const sample_metadata &sm, sample_handle sample_hndl);
+
+    /**
+     * Read every hardware counters sample that is ready in one go.
+     *
+     * Wait for a sample like @ref get_sample, then read the samples that follow it
+     * with @ref get_ready_sample until none is left or @p max_count samples were
+     * read, so that a reader that wakes up late only polls once. Each sample is
+     * passed to @p callback, and put back to the kernel before the next one is
+     * got, because the kernel lends one sample at a time.
+     *
+     * @par Example
+     * @code
+     * size_t count{};
+     * std::error_code ec = reader.read_samples(32, count, [](void *user_data, const sample_metadata &sm,
+     *                                                        sample_handle hndl) {
+     *     auto &r = *static_cast<reader *>(user_data);
+     *     block_metadata bm;
+     *     for (block_handle bh{}; r.next(hndl, bm, bh);)
+     *         process_block(bm);
+     * }, &reader);
+     * @endcode
+     *
+     * @param[in]  max_count    Maximum number of samples to read.
+     * @param[out] count        Number of samples passed to @p callback.
+     * @param[in]  callback     Called with the meta-data and the handle of every sample.
+     * @param[in]  user_data    Passed to @p callback.
+     * @return Error code of the first sample, or of putting a sample back. Samples
+     *         after the first one that can't be got end the batch without an error,
+     *         the error is returned by the next read if it persists.
+     */
+    std::error_code read_samples(size_t max_count, size_t &count, sample_callback callback, void *user_data);
+
     /**
      * Iterate over sample's hardware counters blocks.
      *
@@ -230,6 +335,29 @@ class HWCPIPE_DEVICE_API reader {
      */
     virtual bool next(sample_handle sample_hndl, block_metadata &bm, block_handle &block_hndl) const = 0;
 
+    /**
+     * Decode all the hardware counters blocks of a sample in one call.
+     *
+     * Same as iterating with @ref next, but back-ends whose blocks are at fixed
+     * offsets of the sample decode them in a single pass over a precomputed
+     * table, without a virtual call per block.
+     *
+     * @par Example
+     * @code
+     * std::array<block_metadata, 64> blocks;
+     * const size_t count = reader.get_blocks(sample_hndl, blocks.data(), blocks.size());
+     * for (size_t i = 0; i != count; ++i)
+     *     process_block(blocks[i]);
+     * @endcode
+     *
+     * @param[in]  sample_hndl    Sample handle previously obtained from @ref get_sample.
+     * @param[out] blocks         Array where decoded blocks meta-data will be stored.
+     * @param[in]  capacity       Number of elements of @p blocks. Blocks that don't fit
+     *                            are not decoded.
+     * @return Number of blocks stored.
+     */
+    virtual size_t get_blocks(sample_handle sample_hndl, block_metadata *blocks, size_t capacity) const;
+
     /**
      * Put hardware counters sample back to the kernel.
      *
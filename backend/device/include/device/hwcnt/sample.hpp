@@ -98,6 +98,16 @@ struct sample_metadata {
      * The value is undefined if @ref features::has_gpu_cycle is false.
      */
     uint64_t sc_cycle;
+
+    /**
+     * Number of samples that were waiting in the ring buffer when this sample was read,
+     * including this one. It is estimated from the age of the sample and the sampling period,
+     * and capped to @ref features::buffer_count when known. A backlog close to the ring buffer
+     * size means that the reader is about to lose samples.
+     *
+     * Zero for manual samples.
+     */
+    uint32_t backlog;
 };
 
 /**
@@ -128,6 +138,22 @@ class sample {
         ec_ = reader_.get_sample(metadata_, sample_hndl_);
     }
 
+    /**
+     * Sample constructor with a timeout.
+     *
+     * Same as the constructor above, except that @ref reader::get_sample_for is called,
+     * so the construction fails with `std::errc::timed_out` if no sample is ready in time.
+     *
+     * @param[in]     reader        Reader to read this sample from.
+     * @param[in]     timeout_ns    Time to wait for the sample in nanoseconds.
+     * @param[in,out] ec            Reference where to store reader errors, if any.
+     */
+    sample(reader &reader, uint64_t timeout_ns, std::error_code &ec)
+        : reader_(reader)
+        , ec_(ec) {
+        ec_ = reader_.get_sample_for(metadata_, sample_hndl_, timeout_ns);
+    }
+
     /**
      * Sample destructor.
      *
@@ -174,6 +200,20 @@ class sample {
         return blocks_view(reader_, sample_hndl_);
     }
 
+    /**
+     * Decode all the hardware counters blocks of this sample in one call.
+     *
+     * @see reader::get_blocks
+     *
+     * @param[out] blocks      Array where decoded blocks meta-data will be stored.
+     * @param[in]  capacity    Number of elements of @p blocks.
+     * @return Number of blocks stored.
+     */
+    size_t get_blocks(block_metadata *blocks, size_t capacity) const {
+        assert(!ec_ && "reader::get_sample failed, but blocks were read.");
+        return reader_.get_blocks(sample_hndl_, blocks, capacity);
+    }
+
   private:
     /** Reader that was used to read this sample. */
     reader &reader_;
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+/**
+ * @file
+ *
+ * Wake-up coalescing hardware counters collector header.
+ */
+
+#pragma once
+
+#include <device/api.hpp>
+#include <device/hwcnt/reader.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <system_error>
+
+namespace hwcpipe {
+namespace device {
+namespace hwcnt {
+namespace sampler {
+
+/**
+ * Wake-up coalescing collector of a periodic sampler.
+ *
+ * A periodic sampler takes a sample every period, and a collector that waits for each of them
+ * wakes up as often. On battery devices, these wake-ups are a noticeable power cost. The
+ * coalescing collector lets the kernel keep sampling at the requested period while the
+ * collecting thread wakes up once per wake-up interval, e.g. every N sample periods, and
+ * reads all the samples that were taken in the meantime in one batch.
+ *
+ * The wake-ups follow a fixed schedule, starting one interval after the construction, so the
+ * time spent processing a batch doesn't shift the next wake-up. A collector that falls behind
+ * by a whole interval starts a new schedule from the current time.
+ *
+ * The kernel ring buffer must hold the samples of an interval, otherwise samples are dropped,
+ * see @ref features::buffer_count.
+ *
+ * @par Example
+ * @code
+ * // Sample every millisecond, wake up every 16 milliseconds.
+ * sampler::periodic p{inst, 1000000, config.data(), config.size()};
+ * sampler::coalescing_collector collector{p.get_reader(), 16 * 1000000};
+ * p.sampling_start(0);
+ * for (;;) {
+ *     size_t count{};
+ *     collector.collect(32, count, process_sample, &state);
+ * }
+ * @endcode
+ */
+class HWCPIPE_DEVICE_API coalescing_collector {
+  public:
+    /**
+     * Constructor.
+     *
+     * @param[in] rdr                 Reader of a periodic sampler.
+     * @param[in] wakeup_interval_ns  Interval between wake-ups in nanoseconds. The kernel
+     *                                doesn't wake the collector up before, the interval is
+     *                                rounded up to milliseconds. Zero to read samples as
+     *                                soon as they are ready.
+     */
+    coalescing_collector(reader &rdr, uint64_t wakeup_interval_ns);
+
+    /**
+     * Sleep until the next wake-up, then read every sample that is ready.
+     *
+     * The samples are read with @ref reader::read_samples, the file descriptor is polled
+     * once per batch. If no sample was taken at wake-up time, the call waits for the next
+     * one.
+     *
+     * @param[in]  max_count    Maximum number of samples to read.
+     * @param[out] count        Number of samples passed to @p callback.
+     * @param[in]  callback     Called with the meta-data and the handle of every sample.
+     * @param[in]  user_data    Passed to @p callback.
+     * @return Error code.
+     */
+    std::error_code collect(size_t max_count, size_t &count, reader::sample_callback callback, void *user_data);
+
+    /** @return Interval between wake-ups in nanoseconds. */
+    uint64_t get_wakeup_interval() const { return wakeup_interval_ns_; }
+
+  private:
+    /** Reader to collect samples from. */
+    reader &reader_;
+    /** Interval between wake-ups. */
+    uint64_t wakeup_interval_ns_;
+    /** Timestamp of the next wake-up. */
+    uint64_t next_wakeup_ns_;
+};
+
+} // namespace sampler
+} // namespace hwcnt
+} // namespace device
+} // namespace hwcpipe
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023 Arm Limited.
+ * Copyright (c) 2021-2025 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -108,6 +108,18 @@ class HWCPIPE_DEVICE_API backend {
      */
     virtual std::error_code request_sample(uint64_t user_data) = 0;
 
+    /**
+     * Request manual sample without waiting for the dump to complete.
+     *
+     * The backend must have been created as manual, otherwise this function fails.
+     * The sample completion can be detected by polling the reader file descriptor.
+     * Backends that do not support asynchronous requests fall back to @ref request_sample.
+     *
+     * @param[in] user_data    User data value to be stored in `sample_metadata::user_data`.
+     * @return Error code.
+     */
+    virtual std::error_code request_sample_async(uint64_t user_data);
+
     /**
      * Get hardware counters reader.
      *
@@ -122,10 +134,12 @@ class HWCPIPE_DEVICE_API backend {
      * @param[in] period_ns    Period in nanoseconds between samples taken. Zero for manual context.
      * @param[in] config       Which counters to enable on per-block basis.
      * @param[in] config_len   Len of @p config array.
+     * @param[in] buffer_count Number of samples that the kernel ring buffer should hold, zero for the most
+     *                         the back-end allows. Back-ends that can't choose use their kernel's size.
      * @return Backend instance, nullptr if failed.
      */
     static std::unique_ptr<backend> create(const instance &inst, uint64_t period_ns, const configuration *config,
-                                           size_t config_len);
+                                           size_t config_len, uint32_t buffer_count = 0);
 };
 
 } // namespace detail
@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+/**
+ * @file
+ *
+ * Hardware counters event loop header.
+ */
+
+#pragma once
+
+#include <device/api.hpp>
+#include <device/hwcnt/reader.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <system_error>
+#include <vector>
+
+namespace hwcpipe {
+namespace device {
+namespace hwcnt {
+namespace sampler {
+
+/**
+ * Event loop of several hardware counters sessions.
+ *
+ * Waiting for the samples of a reader with @ref reader::get_sample blocks the calling thread,
+ * so each session, e.g. each GPU of a multi-GPU system, needs its own thread. The event loop
+ * registers the file descriptors of many readers, and of other file descriptors of the
+ * application, with a single `epoll` instance. One thread then waits for all of them at once,
+ * and the ready samples are dispatched to the callback of their session. That thread can be
+ * pinned away from the workload with @ref apply_thread_config.
+ *
+ * The sources must not be added or removed from the callbacks, and a reader must outlive its
+ * registration.
+ *
+ * @par Example
+ * @code
+ * sampler::event_loop loop;
+ * if (!loop)
+ *     return;
+ *
+ * loop.add_reader(gpu0_sampler.get_reader(), process_gpu0_sample, &state, 32);
+ * loop.add_reader(gpu1_sampler.get_reader(), process_gpu1_sample, &state, 32);
+ * loop.add_fd(control_fd, process_control, &state);
+ *
+ * for (;;) {
+ *     size_t count{};
+ *     loop.run_once(sampler::event_loop::wait_forever, count);
+ * }
+ * @endcode
+ */
+class HWCPIPE_DEVICE_API event_loop {
+  public:
+    /**
+     * Callback of an application file descriptor.
+     *
+     * @param[in] user_data    User data passed to @ref add_fd.
+     * @param[in] fd           File descriptor that is ready.
+     */
+    using fd_callback = void (*)(void *user_data, int fd);
+
+    /** Timeout of @ref run_once to wait until a source is ready. */
+    static constexpr uint64_t wait_forever = UINT64_MAX;
+
+    /** Constructor, creates the `epoll` instance. */
+    event_loop();
+
+    /** Destructor. */
+    ~event_loop();
+
+    event_loop(const event_loop &) = delete;
+    event_loop &operator=(const event_loop &) = delete;
+
+    /** @return True if the `epoll` instance was created. */
+    explicit operator bool() const { return epoll_fd_ >= 0; }
+
+    /**
+     * Register a reader.
+     *
+     * When the reader file descriptor is ready, the ready samples are read with
+     * @ref reader::read_samples and passed to @p callback.
+     *
+     * @param[in] rdr          Reader to read samples from.
+     * @param[in] callback     Called with the meta-data and the handle of every sample.
+     * @param[in] user_data    Passed to @p callback.
+     * @param[in] max_count    Maximum number of samples read per wake-up.
+     * @return Error code.
+     */
+    std::error_code add_reader(reader &rdr, reader::sample_callback callback, void *user_data, size_t max_count = 1);
+
+    /**
+     * Register an application file descriptor.
+     *
+     * @p callback is called when @p fd is ready to be read. The callback must consume the
+     * event, otherwise it is called again on the next @ref run_once.
+     *
+     * @param[in] fd           File descriptor to wait for.
+     * @param[in] callback     Called when @p fd is ready.
+     * @param[in] user_data    Passed to @p callback.
+     * @return Error code.
+     */
+    std::error_code add_fd(int fd, fd_callback callback, void *user_data);
+
+    /**
+     * Unregister a reader or an application file descriptor.
+     *
+     * @param[in] fd    File descriptor of the source, see @ref reader::get_fd.
+     * @return Error code, `std::errc::invalid_argument` if @p fd is not registered.
+     */
+    std::error_code remove(int fd);
+
+    /**
+     * Wait until sources are ready, and dispatch them.
+     *
+     * Every ready source is dispatched, even if another one fails.
+     *
+     * @param[in]  timeout_ns    Time to wait for a source in nanoseconds, rounded up to
+     *                           milliseconds, or @ref wait_forever.
+     * @param[out] count         Number of sources dispatched, zero if the timeout expired.
+     * @return Error code, the first error of the sources dispatched if any.
+     */
+    std::error_code run_once(uint64_t timeout_ns, size_t &count);
+
+  private:
+    /** Source of events. */
+    struct source {
+        /** File descriptor, or -1 if the slot is free. */
+        int fd;
+        /** Reader, or nullptr for an application file descriptor. */
+        reader *rdr;
+        /** Callback of a reader. */
+        reader::sample_callback sample_cb;
+        /** Callback of an application file descriptor. */
+        fd_callback fd_cb;
+        /** Passed to the callback. */
+        void *user_data;
+        /** Maximum number of samples read per wake-up. */
+        size_t max_count;
+    };
+
+    /**
+     * Register a source.
+     *
+     * @param[in] src    Source to register.
+     * @return Error code.
+     */
+    std::error_code add(const source &src);
+
+    /** The `epoll` file descriptor. */
+    int epoll_fd_;
+    /** Registered sources, the `epoll` events hold their index. */
+    std::vector<source> sources_;
+};
+
+} // namespace sampler
+} // namespace hwcnt
+} // namespace device
+} // namespace hwcpipe
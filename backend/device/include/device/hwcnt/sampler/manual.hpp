@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023 Arm Limited.
+ * Copyright (c) 2021-2025 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -58,9 +58,11 @@ class manual {
      * @param[in] inst         Mali device instance.
      * @param[in] config       Which counters to enable on per-block basis.
      * @param[in] config_len   Len of @p config array.
+     * @param[in] buffer_count Number of samples that the kernel ring buffer should hold, zero for the most
+     *                         the back-end allows. See @ref features::buffer_count for the number achieved.
      */
-    manual(const instance &inst, const configuration *config, size_t config_len)
-        : backend_(detail::backend::create(inst, 0, config, config_len)) {}
+    manual(const instance &inst, const configuration *config, size_t config_len, uint32_t buffer_count = 0)
+        : backend_(detail::backend::create(inst, 0, config, config_len, buffer_count)) {}
 
     /**
      * Initializer list constructor.
@@ -156,6 +158,24 @@ class manual {
         return backend_->request_sample(user_data);
     }
 
+    /**
+     * Request sample counters asynchronously.
+     *
+     * Same as @ref request_sample, but the function returns as soon as the request
+     * has been issued, without waiting for the kernel to finish the dump. The sample
+     * completion can be detected with @ref reader::is_sample_ready or by polling
+     * @ref reader::get_fd. If the back-end does not support asynchronous requests,
+     * the sample is requested synchronously.
+     *
+     * @param[in] user_data    User data value to be stored in `sample_metadata::user_data`.
+     * @return Error code.
+     */
+    std::error_code request_sample_async(uint64_t user_data) {
+        assert(backend_ && "Backend initialization failed!");
+
+        return backend_->request_sample_async(user_data);
+    }
+
     /**
      * Get hardware counters reader.
      *
@@ -0,0 +1,281 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+/**
+ * @file
+ *
+ * Hardware counters multiplexer header.
+ */
+
+#pragma once
+
+#include <device/api.hpp>
+#include <device/hwcnt/block_extents.hpp>
+#include <device/hwcnt/block_metadata.hpp>
+#include <device/hwcnt/prfcnt_set.hpp>
+#include <device/hwcnt/sampler/configuration.hpp>
+#include <device/hwcnt/sampler/manual.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <system_error>
+#include <vector>
+
+namespace hwcpipe {
+namespace device {
+
+class instance;
+
+namespace hwcnt {
+namespace sampler {
+
+/**
+ * Hardware counters multiplexer.
+ *
+ * A session counts a single counters set, and at most a number of counters per block. A
+ * configuration that asks for more, e.g. the primary and the secondary counters of a block, is
+ * split into passes that each fit in one session. The multiplexer rotates the passes across
+ * consecutive sampling windows, each window is counted by one pass only.
+ *
+ * The counters are then estimated for the whole time measured: the value counted by a pass is
+ * scaled by the ratio of the time of all the windows to the time of the windows of that pass.
+ * The estimates assume the workload is steady across the windows, so the windows should be
+ * short compared to the phases of the workload.
+ *
+ * @par Example
+ * @code
+ * std::vector<sampler::configuration> config{
+ *     {block_type::core, prfcnt_set::primary, core_counters},
+ *     {block_type::core, prfcnt_set::secondary, core_secondary_counters},
+ * };
+ * sampler::multiplexer mux{inst, config.data(), config.size()};
+ * mux.start();
+ * for (int i = 0; i != 100; ++i) {
+ *     std::this_thread::sleep_for(std::chrono::milliseconds(10));
+ *     mux.rotate();
+ * }
+ * mux.stop();
+ * auto estimate = mux.get_estimate(block_type::core, prfcnt_set::secondary, 4);
+ * @endcode
+ */
+class HWCPIPE_DEVICE_API multiplexer {
+  public:
+    /** Counters configuration of a pass. */
+    using pass_type = std::vector<configuration>;
+
+    /**
+     * Factory of the sampler of a pass.
+     *
+     * @param[in]  user_data   User data given to the constructor.
+     * @param[in]  config      Configuration of the pass.
+     * @param[in]  config_len  Number of elements of @p config.
+     * @param[out] sampler     Sampler created.
+     * @return Error code.
+     */
+    using sampler_factory = std::error_code (*)(void *user_data, const configuration *config, size_t config_len,
+                                                manual &sampler);
+
+    /** Estimated value of a counter. */
+    struct estimate {
+        /** Value counted by the pass of the counter. */
+        uint64_t raw;
+        /** Value scaled to the whole time measured. */
+        double scaled;
+        /** Time counted by the pass of the counter in nanoseconds. */
+        uint64_t counted_ns;
+        /** Time of all the windows in nanoseconds. */
+        uint64_t enabled_ns;
+    };
+
+    /**
+     * Split a counters configuration into passes.
+     *
+     * The blocks of a pass use a single counters set, and enable at most @p max_counters counters
+     * each. The counters of a block type and set are spread over as few passes as possible, in
+     * order of counter number. Configurations of the same block type and set are merged.
+     *
+     * @param[in]  config        Counters configuration.
+     * @param[in]  config_len    Number of elements of @p config.
+     * @param[in]  max_counters  Maximum number of counters per block in a pass.
+     * @param[out] passes        Passes, none if nothing is enabled.
+     * @return Error code, `std::errc::invalid_argument` if @p max_counters is zero.
+     */
+    static std::error_code plan(const configuration *config, size_t config_len, size_t max_counters,
+                                std::vector<pass_type> &passes);
+
+    /**
+     * Constructor, samples the passes from a Mali device instance.
+     *
+     * @param[in] inst          Mali device instance.
+     * @param[in] config        Counters configuration.
+     * @param[in] config_len    Number of elements of @p config.
+     * @param[in] max_counters  Maximum number of counters per block in a pass.
+     */
+    multiplexer(const instance &inst, const configuration *config, size_t config_len,
+                size_t max_counters = configuration::max_counters_per_block);
+
+    /**
+     * Constructor, creates the samplers of the passes with a factory.
+     *
+     * @param[in] factory       Sampler factory.
+     * @param[in] user_data     Passed to @p factory.
+     * @param[in] config        Counters configuration.
+     * @param[in] config_len    Number of elements of @p config.
+     * @param[in] max_counters  Maximum number of counters per block in a pass.
+     */
+    multiplexer(sampler_factory factory, void *user_data, const configuration *config, size_t config_len,
+                size_t max_counters = configuration::max_counters_per_block);
+
+    multiplexer(const multiplexer &) = delete;
+    multiplexer &operator=(const multiplexer &) = delete;
+
+    /** @return True if the configuration was split into passes. */
+    explicit operator bool() const { return !passes_.empty(); }
+
+    /** @return Number of passes. */
+    size_t num_passes() const { return passes_.size(); }
+
+    /**
+     * Get the configuration of a pass.
+     *
+     * @param[in] index    Pass index.
+     * @return The pass configuration.
+     */
+    const pass_type &get_pass(size_t index) const { return passes_[index].config; }
+
+    /** @return Index of the pass counting the current window. */
+    size_t get_current_pass() const { return current_; }
+
+    /**
+     * Start counting, with the first pass.
+     *
+     * The values estimated so far are cleared.
+     *
+     * @return Error code.
+     */
+    std::error_code start();
+
+    /**
+     * End the current window, and start the next one with the next pass.
+     *
+     * The sample of the window is read, so the call blocks until the kernel has taken it. With a
+     * single pass, the session keeps counting.
+     *
+     * @return Error code.
+     */
+    std::error_code rotate();
+
+    /**
+     * End the current window, and stop counting.
+     *
+     * @return Error code.
+     */
+    std::error_code stop();
+
+    /**
+     * End the current window, and stop counting until resume(), e.g. while nobody reads the
+     * estimates.
+     *
+     * Unlike stop(), the session of the current pass and its mapped buffer are kept open, and the
+     * estimates are kept, so resume() only restarts the accumulation. The time paused is not
+     * counted in the estimates.
+     *
+     * @return Error code, `std::errc::invalid_argument` if not counting.
+     */
+    std::error_code pause();
+
+    /**
+     * Start counting again, with the pass that was paused.
+     *
+     * @return Error code, `std::errc::invalid_argument` if not paused.
+     */
+    std::error_code resume();
+
+    /** @return True if paused. */
+    bool is_paused() const { return paused_; }
+
+    /**
+     * Get the estimated value of a counter, summed over the blocks of its type.
+     *
+     * @param[in]  type     Block type.
+     * @param[in]  set      Counters set.
+     * @param[in]  counter  Counter number.
+     * @param[out] result   Estimated value.
+     * @return Error code, `std::errc::invalid_argument` if the counter is not enabled by any pass.
+     */
+    std::error_code get_estimate(block_type type, prfcnt_set set, size_t counter, estimate &result) const;
+
+  private:
+    /** Values of a block type, summed over its blocks. */
+    using values_type = std::array<uint64_t, configuration::max_counters_per_block>;
+
+    /** A pass and what it counted. */
+    struct pass_state {
+        /** Counters configuration. */
+        pass_type config;
+        /** Counter values, per block type. */
+        std::array<values_type, block_extents::num_block_types> values;
+        /** Time counted in nanoseconds. */
+        uint64_t counted_ns;
+    };
+
+    /**
+     * Open the sampler of a pass, and start its accumulation.
+     *
+     * @param[in] index    Pass index.
+     * @return Error code.
+     */
+    std::error_code open(size_t index);
+
+    /**
+     * Read the sample of the current window into the current pass.
+     *
+     * @return Error code.
+     */
+    std::error_code collect();
+
+    /** Sampler factory. */
+    sampler_factory factory_;
+    /** User data of the factory. */
+    void *user_data_;
+    /** Passes. */
+    std::vector<pass_state> passes_;
+    /** Sampler of the current pass. */
+    manual sampler_;
+    /** Index of the current pass. */
+    size_t current_{};
+    /** Number of windows sampled, stored in `sample_metadata::user_data`. */
+    uint64_t num_windows_{};
+    /** Time of all the windows in nanoseconds. */
+    uint64_t enabled_ns_{};
+    /** True if the session of the current pass is open, but not counting. */
+    bool paused_{};
+};
+
+} // namespace sampler
+} // namespace hwcnt
+} // namespace device
+} // namespace hwcpipe
@@ -61,12 +61,15 @@ class periodic {
      * @param[in] period_ns    Period in nanoseconds between samples taken.
      * @param[in] config       Which counters to enable on per-block basis.
      * @param[in] config_len   Len of @p config array.
+     * @param[in] buffer_count Number of samples that the kernel ring buffer should hold, zero for the most
+     *                         the back-end allows. See @ref features::buffer_count for the number achieved.
      */
-    periodic(const instance &inst, uint64_t period_ns, const configuration *config, size_t config_len) {
+    periodic(const instance &inst, uint64_t period_ns, const configuration *config, size_t config_len,
+             uint32_t buffer_count = 0) {
         if (period_ns == 0)
             return;
 
-        backend_ = detail::backend::create(inst, period_ns, config, config_len);
+        backend_ = detail::backend::create(inst, period_ns, config, config_len, buffer_count);
     }
 
     /**
@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+/**
+ * @file
+ *
+ * Userspace periodic driver of a manual sampler header.
+ */
+
+#pragma once
+
+#include <device/api.hpp>
+
+#include <cstdint>
+#include <system_error>
+
+namespace hwcpipe {
+namespace device {
+namespace hwcnt {
+namespace sampler {
+
+class manual;
+
+/**
+ * Userspace periodic driver of a manual sampler.
+ *
+ * Kernel periodic sampling, and the periodic sessions emulated by some back-ends, drift and
+ * jitter under CPU load. The driver requests the samples of a manual sampler from a timer
+ * with absolute `CLOCK_MONOTONIC` deadlines instead, so the schedule never drifts. Run it on
+ * a thread configured with @ref apply_thread_config, e.g. with a `SCHED_FIFO` priority and
+ * pinned to a CPU, to keep the jitter low.
+ *
+ * When the thread misses deadlines, one sample is requested for all of them, and the next
+ * deadline stays on the schedule. The number of missed deadlines, and how late the request
+ * was, are reported for every tick.
+ *
+ * @par Example
+ * @code
+ * sampler::manual m{inst, config.data(), config.size()};
+ * sampler::periodic_driver driver{m, 1000000};
+ * sampler::apply_thread_config({1U << 3, sampler::sched_class::fifo, 50});
+ * m.accumulation_start();
+ * driver.start();
+ * for (;;) {
+ *     sampler::periodic_driver::tick_info tick{};
+ *     driver.wait_and_request(tick);
+ * }
+ * @endcode
+ */
+class HWCPIPE_DEVICE_API periodic_driver {
+  public:
+    /** Information about a tick of the driver. */
+    struct tick_info {
+        /** Tick number, stored in `sample_metadata::user_data` of the sample requested. */
+        uint64_t tick;
+        /** Number of deadlines that were missed since the previous tick. */
+        uint64_t missed;
+        /** Time between the deadline of the tick and the sample request, in nanoseconds. */
+        uint64_t lateness_ns;
+    };
+
+    /**
+     * Constructor, creates the timer.
+     *
+     * @param[in] sampler      Manual sampler to request the samples of.
+     * @param[in] period_ns    Period between two samples in nanoseconds.
+     */
+    periodic_driver(manual &sampler, uint64_t period_ns);
+
+    /** Destructor. */
+    ~periodic_driver();
+
+    periodic_driver(const periodic_driver &) = delete;
+    periodic_driver &operator=(const periodic_driver &) = delete;
+
+    /** @return True if the timer was created. */
+    explicit operator bool() const { return timer_fd_ >= 0; }
+
+    /**
+     * Get the timer file descriptor.
+     *
+     * The descriptor is ready when a deadline has passed, so it can be waited for with the other
+     * descriptors of the application, e.g. with @ref event_loop::add_fd.
+     *
+     * @return The timer file descriptor.
+     */
+    int get_fd() const { return timer_fd_; }
+
+    /** @return Period between two samples in nanoseconds. */
+    uint64_t get_period() const { return period_ns_; }
+
+    /**
+     * Start the timer.
+     *
+     * The first deadline is one period after the call. The accumulation of the sampler must
+     * have been started with @ref manual::accumulation_start.
+     *
+     * @return Error code.
+     */
+    std::error_code start();
+
+    /**
+     * Stop the timer.
+     *
+     * @return Error code.
+     */
+    std::error_code stop();
+
+    /**
+     * Change the period between two samples.
+     *
+     * If the timer is started, the next deadline is one new period after the last deadline that
+     * passed, and the schedule continues from there. The tick numbers keep increasing.
+     *
+     * @param[in] period_ns    Period between two samples in nanoseconds, not zero.
+     * @return Error code.
+     */
+    std::error_code set_period(uint64_t period_ns);
+
+    /**
+     * Wait for the next deadline, and request a sample.
+     *
+     * The sample is requested asynchronously, it is read from the reader of the sampler.
+     *
+     * @param[out] tick    Information about the tick.
+     * @return Error code.
+     */
+    std::error_code wait_and_request(tick_info &tick);
+
+  private:
+    /** Manual sampler to request the samples of. */
+    manual &sampler_;
+    /** Period between two samples. */
+    uint64_t period_ns_;
+    /** Timer file descriptor. */
+    int timer_fd_;
+    /** Deadline of the first tick of the current period, on the monotonic clock, zero if stopped. */
+    uint64_t first_deadline_ns_;
+    /** Number of the first tick of the current period. */
+    uint64_t first_tick_;
+    /** Number of deadlines passed since the timer was started. */
+    uint64_t num_deadlines_;
+};
+
+} // namespace sampler
+} // namespace hwcnt
+} // namespace device
+} // namespace hwcpipe
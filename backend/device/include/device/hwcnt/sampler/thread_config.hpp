@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+/**
+ * @file
+ *
+ * Sampling thread configuration header.
+ */
+
+#pragma once
+
+#include <device/api.hpp>
+
+#include <cstdint>
+#include <system_error>
+
+namespace hwcpipe {
+namespace device {
+namespace hwcnt {
+namespace sampler {
+
+/** Scheduling class of a thread. */
+enum class sched_class : uint8_t {
+    /** Keep the scheduling class of the thread. */
+    inherit,
+    /** `SCHED_OTHER`, the default time-sharing class. */
+    other,
+    /** `SCHED_BATCH`, for threads that are not latency sensitive. */
+    batch,
+    /** `SCHED_IDLE`, only runs when the CPU is otherwise idle. */
+    idle,
+    /** `SCHED_FIFO` real-time class. */
+    fifo,
+    /** `SCHED_RR` real-time class. */
+    round_robin,
+};
+
+/**
+ * Configuration of a sampling thread.
+ *
+ * The sampling threads can be kept away from the workload being measured, e.g. pinned to the
+ * little cores of the CPU, away from the render thread. A default constructed configuration
+ * keeps the affinity and the scheduling class of the thread.
+ */
+struct thread_config {
+    /** CPUs the thread may run on, bit `n` for CPU `n`. Zero to keep the affinity of the thread. */
+    uint64_t cpu_mask;
+    /** Scheduling class of the thread. */
+    sched_class policy;
+    /**
+     * Priority of the `fifo` and `round_robin` classes. For the other classes, the nice value
+     * of the thread, zero to keep it.
+     */
+    int32_t priority;
+};
+
+/**
+ * Apply a configuration to the calling thread.
+ *
+ * The real-time classes and negative nice values usually require the `CAP_SYS_NICE` capability.
+ *
+ * @param[in] config    Configuration to apply.
+ * @return Error code.
+ */
+HWCPIPE_DEVICE_API std::error_code apply_thread_config(const thread_config &config);
+
+} // namespace sampler
+} // namespace hwcnt
+} // namespace device
+} // namespace hwcpipe
@@ -86,11 +86,28 @@ class HWCPIPE_DEVICE_API instance {
      */
     virtual hwcnt::clock_extents get_hwcnt_clock_extents() const = 0;
 
+    /**
+     * Get the name of the hardware counters back-end that the samplers of
+     * this instance use: "kinstr_prfcnt", "kinstr_prfcnt_wa", "vinstr", ...
+     *
+     * The back-end is selected from the kernel driver version and the GPU,
+     * and may be forced with the `HWCPIPE_BACKEND_INTERFACE` environment
+     * variable.
+     *
+     * @return The back-end name.
+     */
+    virtual const char *get_hwcnt_backend_name() const = 0;
+
     /**
      * Create device instance.
      *
      * The @p hndl object must outlive the instance created.
      *
+     * Probing the hardware counters back-end is costly, so its results can be
+     * cached in the file named by the `HWCPIPE_DEVICE_CACHE` environment variable.
+     * The cached results are only used if the kernel driver version and the GPU
+     * properties match the live driver.
+     *
      * @param[in] hndl    Device handle.
      * @return The device instance created, nullptr if failed.
      */
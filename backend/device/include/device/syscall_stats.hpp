@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file syscall_stats.hpp System call statistics header.
+ */
+
+#pragma once
+
+#include <device/api.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace hwcpipe {
+namespace device {
+
+/** Maximum number of distinct ioctl commands that are counted separately. */
+constexpr size_t max_syscall_ioctl_commands = 32;
+
+/** Statistics of a kind of system call. */
+struct syscall_call_stats {
+    /** Number of calls. */
+    uint64_t count;
+    /** Number of calls that failed. */
+    uint64_t errors;
+    /** Total time spent in the calls, in nanoseconds. */
+    uint64_t total_ns;
+    /** Longest call, in nanoseconds. */
+    uint64_t max_ns;
+};
+
+/** Statistics of an ioctl command. */
+struct syscall_ioctl_stats {
+    /** The ioctl command. */
+    uint64_t command;
+    /** Statistics of the calls with this command. */
+    syscall_call_stats stats;
+};
+
+/**
+ * System call statistics of the process.
+ *
+ * The statistics are only collected when the library is built with
+ * `HWCPIPE_SYSCALL_STATS`. Otherwise the system calls are not instrumented at
+ * all, and the statistics are empty.
+ */
+struct syscall_stats {
+    /** True if the library collects system call statistics. */
+    bool enabled;
+    /** Statistics of the ioctl commands, in the order they were first called. */
+    std::array<syscall_ioctl_stats, max_syscall_ioctl_commands> ioctls;
+    /** Number of valid entries in `ioctls`. */
+    size_t num_ioctls;
+    /** Statistics of the ioctl commands that didn't fit in `ioctls`. */
+    syscall_call_stats other_ioctls;
+    /** Statistics of the poll and epoll_wait calls, i.e. the time spent waiting for samples. */
+    syscall_call_stats poll;
+    /** Statistics of the mmap calls. */
+    syscall_call_stats mmap;
+    /** Statistics of the munmap calls. */
+    syscall_call_stats munmap;
+};
+
+/**
+ * Get the system call statistics of the process.
+ *
+ * The statistics cover the system calls of every handle, instance and sampler
+ * since the process started, or since reset_syscall_stats() was called.
+ *
+ * @return The system call statistics. If the library is built without
+ * `HWCPIPE_SYSCALL_STATS`, `enabled` is false and every statistic is zero.
+ */
+HWCPIPE_DEVICE_API syscall_stats get_syscall_stats();
+
+/** Reset the system call statistics of the process. */
+HWCPIPE_DEVICE_API void reset_syscall_stats();
+
+} // namespace device
+} // namespace hwcpipe
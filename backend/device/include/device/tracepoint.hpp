@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+/**
+ * @file tracepoint.hpp Static tracepoints header.
+ *
+ * When the library is built with `HWCPIPE_TRACEPOINTS`, the sampler and the
+ * backends are instrumented with static tracepoints of the `hwcpipe`
+ * provider, in the SystemTap SDT format that perf, bpftrace and SystemTap
+ * attach to. A tracepoint is a single `nop` instruction, and an ELF note
+ * that describes where its arguments are. Every tracepoint has three 64 bit
+ * arguments: the sample number, the user data of the sample, and a duration
+ * in nanoseconds. An argument that isn't known at a tracepoint is zero.
+ *
+ * Without the option the tracepoints, their arguments and their timers are
+ * compiled out.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#if defined(HWCPIPE_TRACEPOINTS)
+#include <time.h>
+
+#if !defined(__x86_64__) && !defined(__aarch64__)
+#error "HWCPIPE_TRACEPOINTS is only supported on x86_64 and aarch64."
+#endif
+
+/* The note of a tracepoint, version 3 of the SystemTap SDT notes. The
+ * semaphore address is zero: the arguments are always computed. */
+#define HWCPIPE_TRACEPOINT_NOTE(name)                                                                                  \
+    "990: nop\n"                                                                                                       \
+    ".pushsection .note.stapsdt,\"?\",\"note\"\n"                                                                      \
+    ".balign 4\n"                                                                                                      \
+    ".4byte 992f-991f, 994f-993f, 3\n"                                                                                 \
+    "991: .asciz \"stapsdt\"\n"                                                                                        \
+    "992: .balign 4\n"                                                                                                 \
+    "993: .8byte 990b\n"                                                                                               \
+    ".8byte _.stapsdt.base\n"                                                                                          \
+    ".8byte 0\n"                                                                                                       \
+    ".asciz \"hwcpipe\"\n"                                                                                             \
+    ".asciz \"" #name "\"\n"                                                                                           \
+    ".asciz \"8@%0 8@%1 8@%2\"\n"                                                                                      \
+    "994: .balign 4\n"                                                                                                 \
+    ".popsection\n"                                                                                                    \
+    ".ifndef _.stapsdt.base\n"                                                                                         \
+    ".pushsection .stapsdt.base,\"aG\",\"progbits\",.stapsdt.base,comdat\n"                                            \
+    ".weak _.stapsdt.base\n"                                                                                           \
+    ".hidden _.stapsdt.base\n"                                                                                         \
+    "_.stapsdt.base: .space 1\n"                                                                                       \
+    ".size _.stapsdt.base, 1\n"                                                                                        \
+    ".popsection\n"                                                                                                    \
+    ".endif\n"
+
+/** Fires the tracepoint hwcpipe:@p name with a sample number, a user data and a duration. */
+#define HWCPIPE_TRACEPOINT(name, sample_nr, user_data, duration_ns)                                                    \
+    __asm__ __volatile__(HWCPIPE_TRACEPOINT_NOTE(name)                                                                 \
+                         :                                                                                             \
+                         : "nor"(static_cast<uint64_t>(sample_nr)), "nor"(static_cast<uint64_t>(user_data)),           \
+                           "nor"(static_cast<uint64_t>(duration_ns)))
+#else
+#define HWCPIPE_TRACEPOINT(name, sample_nr, user_data, duration_ns)                                                    \
+    static_cast<void>(sizeof(sample_nr) + sizeof(user_data) + sizeof(duration_ns))
+#endif
+
+namespace hwcpipe {
+namespace device {
+
+/** True if the library is built with static tracepoints. */
+#if defined(HWCPIPE_TRACEPOINTS)
+constexpr bool tracepoints_enabled = true;
+#else
+constexpr bool tracepoints_enabled = false;
+#endif
+
+/**
+ * Measures the duration argument of a tracepoint from its construction. It
+ * is empty, and never reads the clock, without tracepoints.
+ */
+class tracepoint_timer {
+  public:
+#if defined(HWCPIPE_TRACEPOINTS)
+    tracepoint_timer()
+        : begin_(now()) {}
+
+    /** @return Nanoseconds elapsed since the timer was constructed. */
+    uint64_t elapsed_ns() const { return now() - begin_; }
+
+  private:
+    static uint64_t now() {
+        struct timespec ts {};
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return static_cast<uint64_t>(ts.tv_sec) * 1000000000ULL + static_cast<uint64_t>(ts.tv_nsec);
+    }
+
+    uint64_t begin_;
+#else
+    /** @return Zero. */
+    uint64_t elapsed_ns() const { return 0; }
+#endif
+};
+
+/**
+ * Keeps the sample number and the user data of the sample a backend handed
+ * out last, for the tracepoint of the sample being put back. It is empty
+ * without tracepoints.
+ */
+class tracepoint_sample {
+  public:
+#if defined(HWCPIPE_TRACEPOINTS)
+    /** Remembers the sample of @p sm. */
+    template <typename sample_metadata_t>
+    void assign(const sample_metadata_t &sm) {
+        sample_nr_ = sm.sample_nr;
+        user_data_ = sm.user_data;
+    }
+
+    /** @return Sample number of the last sample. */
+    uint64_t sample_nr() const { return sample_nr_; }
+
+    /** @return User data of the last sample. */
+    uint64_t user_data() const { return user_data_; }
+
+  private:
+    uint64_t sample_nr_{};
+    uint64_t user_data_{};
+#else
+    /** Does nothing. */
+    template <typename sample_metadata_t>
+    void assign(const sample_metadata_t &) {}
+
+    /** @return Zero. */
+    uint64_t sample_nr() const { return 0; }
+
+    /** @return Zero. */
+    uint64_t user_data() const { return 0; }
+#endif
+};
+
+} // namespace device
+} // namespace hwcpipe
@@ -80,6 +80,8 @@ static bool is_vinstr_available(const kbase_version &version, product_id pid) {
         return version < jm_max_version;
     case ioctl_iface_type::csf:
         return version < csf_max_version;
+    case ioctl_iface_type::panthor:
+        return false;
     }
 
     __builtin_unreachable();
@@ -129,10 +131,31 @@ std::pair<std::error_code, backend_type> backend_type_from_str(const char *str)
         return std::make_pair(std::error_code{}, backend_type::kinstr_prfcnt_wa);
     if (!strcmp(str, "kinstr_prfcnt_bad"))
         return std::make_pair(std::error_code{}, backend_type::kinstr_prfcnt_bad);
+    if (!strcmp(str, "panthor"))
+        return std::make_pair(std::error_code{}, backend_type::panthor);
 
     return std::make_pair(std::make_error_code(std::errc::invalid_argument), backend_type{});
 }
 
+const char *backend_type_to_str(backend_type type) {
+    switch (type) {
+    case backend_type::vinstr:
+        return "vinstr";
+    case backend_type::vinstr_pre_r21:
+        return "vinstr_pre_r21";
+    case backend_type::kinstr_prfcnt:
+        return "kinstr_prfcnt";
+    case backend_type::kinstr_prfcnt_wa:
+        return "kinstr_prfcnt_wa";
+    case backend_type::kinstr_prfcnt_bad:
+        return "kinstr_prfcnt_bad";
+    case backend_type::panthor:
+        return "panthor";
+    }
+
+    return "unknown";
+}
+
 backend_types_set backend_type_discover(const kbase_version &version, product_id pid) {
     backend_types_set result{};
 
@@ -141,6 +164,12 @@ backend_types_set backend_type_discover(const kbase_version &version, product_id
         return result;
     }
 
+    /* The panthor driver only has its own perf-counter interface. */
+    if (version.type() == ioctl_iface_type::panthor) {
+        result.set(static_cast<size_t>(backend_type::panthor));
+        return result;
+    }
+
     /* We disallow vinstr for gtux and later since vinstr does not
      * support 128 counters per block.
      */
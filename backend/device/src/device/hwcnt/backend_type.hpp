@@ -64,8 +64,10 @@ enum class backend_type : uint8_t {
     kinstr_prfcnt_wa,
     /** kinstr_prfcnt bad available. */
     kinstr_prfcnt_bad,
+    /** DRM panthor perf-counter interface available. */
+    panthor,
     /** Sentinel. */
-    last = kinstr_prfcnt_bad,
+    last = panthor,
 };
 
 /** Supported back-end types set. */
@@ -79,6 +81,14 @@ using backend_types_set = std::bitset<static_cast<size_t>(backend_type::last) +
  */
 std::pair<std::error_code, backend_type> backend_type_from_str(const char *str);
 
+/**
+ * Get the name of a back-end type, as accepted by backend_type_from_str().
+ *
+ * @param[in] type Back-end type.
+ * @return The back-end type name.
+ */
+const char *backend_type_to_str(backend_type type);
+
 /**
  * Discover which HWCNT back-ends are available for a given kernel version / GPU product id.
  *
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2023 Arm Limited.
+ * Copyright (c) 2022-2025 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -23,6 +23,11 @@
  */
 
 #include <device/hwcnt/reader.hpp>
+#include <device/hwcnt/sample.hpp>
+#include <device/hwcnt/sampler/poll.hpp>
+#include <device/syscall/iface.hpp>
+
+#include <tuple>
 
 namespace hwcpipe {
 namespace device {
@@ -30,6 +35,77 @@ namespace hwcnt {
 
 reader::~reader() = default;
 
+std::error_code reader::is_sample_ready(bool &ready) const {
+    std::error_code ec;
+    std::tie(ec, ready) = sampler::check_ready_read(fd_, syscall::iface{});
+    return ec;
+}
+
+std::error_code reader::is_sample_ready(bool &ready, uint64_t timeout_ns) const {
+    std::error_code ec;
+    std::tie(ec, ready) = sampler::wait_ready_read(fd_, timeout_ns, syscall::iface{});
+    return ec;
+}
+
+std::error_code reader::get_ready_sample(sample_metadata &sm, sample_handle &sample_hndl) {
+    bool ready{};
+    std::error_code ec = is_sample_ready(ready);
+
+    if (ec)
+        return ec;
+
+    if (!ready)
+        return std::make_error_code(std::errc::resource_unavailable_try_again);
+
+    return get_sample(sm, sample_hndl);
+}
+
+std::error_code reader::get_sample_for(sample_metadata &sm, sample_handle &sample_hndl, uint64_t timeout_ns) {
+    bool ready{};
+    std::error_code ec = is_sample_ready(ready, timeout_ns);
+
+    if (ec)
+        return ec;
+
+    if (!ready)
+        return std::make_error_code(std::errc::timed_out);
+
+    return get_ready_sample(sm, sample_hndl);
+}
+
+size_t reader::get_blocks(sample_handle sample_hndl, block_metadata *blocks, size_t capacity) const {
+    size_t count = 0;
+
+    for (block_handle block_hndl{}; count < capacity && next(sample_hndl, blocks[count], block_hndl);)
+        ++count;
+
+    return count;
+}
+
+std::error_code reader::read_samples(size_t max_count, size_t &count, sample_callback callback, void *user_data) {
+    count = 0;
+
+    while (count < max_count) {
+        sample_metadata sm{};
+        sample_handle sample_hndl{};
+
+        std::error_code ec = count == 0 ? get_sample(sm, sample_hndl) : get_ready_sample(sm, sample_hndl);
+
+        if (ec)
+            return count == 0 ? ec : std::error_code{};
+
+        callback(user_data, sm, sample_hndl);
+        ++count;
+
+        ec = put_sample(sample_hndl);
+
+        if (ec)
+            return ec;
+    }
+
+    return {};
+}
+
 } // namespace hwcnt
 } // namespace device
 } // namespace hwcpipe
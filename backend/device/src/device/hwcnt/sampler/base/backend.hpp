@@ -31,6 +31,9 @@
 #include <device/hwcnt/reader.hpp>
 #include <device/hwcnt/sampler/detail/backend.hpp>
 
+#include <algorithm>
+#include <cstdint>
+
 namespace hwcpipe {
 namespace device {
 namespace hwcnt {
@@ -57,7 +60,9 @@ class backend : public detail::backend, public reader, private syscall_iface_t {
         , reader(args.fd.release(), args.features_v, args.extents)
         , syscall_iface_t(syscall_iface)
         , period_ns_(args.period_ns)
-        , memory_(std::move(args.memory)) {}
+        , memory_(std::move(args.memory)) {
+        features_.mapped_size = memory_.size();
+    }
 
     ~backend() override { get_syscall_iface().close(fd_); }
 
@@ -75,6 +80,30 @@ class backend : public detail::backend, public reader, private syscall_iface_t {
     /** @return syscall iface reference. */
     syscall_iface_type &get_syscall_iface() { return *this; }
 
+    /**
+     * Estimate the number of samples waiting in the ring buffer when a periodic sample is read.
+     *
+     * The kernel takes a sample every period, so the age of the sample tells how many were
+     * taken after it. The estimate is capped to the ring buffer size, if known.
+     *
+     * @param[in] now_ns           Current timestamp, same clock as the sample timestamps.
+     * @param[in] timestamp_ns_end Latest timestamp of the sample read.
+     * @return Number of samples waiting, including the one read. 0 for manual samplers.
+     */
+    uint32_t estimate_backlog(uint64_t now_ns, uint64_t timestamp_ns_end) const {
+        if (sampler_type() != sampler_type::periodic)
+            return 0;
+
+        uint64_t result = 1;
+        if (now_ns > timestamp_ns_end)
+            result += (now_ns - timestamp_ns_end) / period_ns_;
+
+        if (features_.buffer_count && result > features_.buffer_count)
+            result = features_.buffer_count;
+
+        return static_cast<uint32_t>(std::min<uint64_t>(result, UINT32_MAX));
+    }
+
     /** Sampling period. 0 for manual sampling. */
     const uint64_t period_ns_{};
     /** Counters memory. */
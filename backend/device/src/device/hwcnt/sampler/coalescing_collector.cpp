@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include <device/hwcnt/sampler/coalescing_collector.hpp>
+#include <device/hwcnt/sampler/poll.hpp>
+#include <device/hwcnt/sampler/timestamp.hpp>
+#include <device/syscall/iface.hpp>
+
+#include <tuple>
+
+namespace hwcpipe {
+namespace device {
+namespace hwcnt {
+namespace sampler {
+
+namespace {
+
+/**
+ * Sleep for a duration, without any file descriptor to wake up on.
+ *
+ * @param[in] timeout_ns Duration in nanoseconds, rounded up to milliseconds.
+ * @return Error code.
+ */
+std::error_code sleep_for(uint64_t timeout_ns) {
+    std::error_code ec;
+    std::tie(ec, std::ignore) = syscall::iface{}.poll(nullptr, 0, detail::to_poll_timeout(timeout_ns));
+
+    if (ec == std::errc::interrupted)
+        return {};
+
+    return ec;
+}
+
+} // namespace
+
+coalescing_collector::coalescing_collector(reader &rdr, uint64_t wakeup_interval_ns)
+    : reader_(rdr)
+    , wakeup_interval_ns_(wakeup_interval_ns)
+    , next_wakeup_ns_(timestamp_iface::clock_gettime() + wakeup_interval_ns) {}
+
+std::error_code coalescing_collector::collect(size_t max_count, size_t &count, reader::sample_callback callback,
+                                              void *user_data) {
+    count = 0;
+
+    uint64_t now = timestamp_iface::clock_gettime();
+
+    for (; now < next_wakeup_ns_; now = timestamp_iface::clock_gettime()) {
+        const std::error_code ec = sleep_for(next_wakeup_ns_ - now);
+
+        if (ec)
+            return ec;
+    }
+
+    next_wakeup_ns_ += wakeup_interval_ns_;
+
+    if (next_wakeup_ns_ <= now)
+        next_wakeup_ns_ = now + wakeup_interval_ns_;
+
+    return reader_.read_samples(max_count, count, callback, user_data);
+}
+
+} // namespace sampler
+} // namespace hwcnt
+} // namespace device
+} // namespace hwcpipe
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2023 Arm Limited.
+ * Copyright (c) 2022-2025 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -31,6 +31,8 @@
 #include <device/detail/cast_to_impl.hpp>
 #include <device/hwcnt/sampler/kinstr_prfcnt/backend_wa.hpp>
 #include <device/hwcnt/sampler/kinstr_prfcnt/setup.hpp>
+#include <device/hwcnt/sampler/panthor/backend.hpp>
+#include <device/hwcnt/sampler/panthor/setup.hpp>
 #include <device/hwcnt/sampler/vinstr/backend.hpp>
 #include <device/hwcnt/sampler/vinstr/setup.hpp>
 #include <device/kbase_version.hpp>
@@ -55,6 +57,7 @@ using instance_impl_type = instance_impl<syscall::iface>;
 using kinstr_backend = kinstr_prfcnt::backend<syscall::iface>;
 using kinstr_backend_wa = kinstr_prfcnt::backend_wa<syscall::iface>;
 using vinstr_backend = vinstr::backend<syscall::iface>;
+using panthor_backend = panthor::backend<syscall::iface>;
 
 /** Create kinstr_prfcnt backend if possible.
  *
@@ -87,15 +90,17 @@ static std::unique_ptr<detail::backend> kinstr_prfcnt_backend_create(const insta
  * @param[in] period_ns    Period in nanoseconds between samples taken. Zero for manual context.
  * @param[in] config       Which counters to enable on per-block basis.
  * @param[in] config_len   Len of @p config array.
+ * @param[in] buffer_count Number of buffers requested, zero for the most vinstr allows.
  * @return backend pointer, if created.
  */
 static std::unique_ptr<detail::backend> vinstr_backend_create(const instance_impl_type &inst, uint64_t period_ns,
-                                                              const configuration *config, size_t config_len) {
+                                                              const configuration *config, size_t config_len,
+                                                              uint32_t buffer_count) {
     std::error_code ec;
     vinstr_backend::args_type args{};
 
     // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-    std::tie(ec, args) = vinstr::setup(inst, period_ns, config, config + config_len);
+    std::tie(ec, args) = vinstr::setup(inst, period_ns, config, config + config_len, buffer_count);
 
     if (ec)
         return nullptr;
@@ -103,20 +108,49 @@ static std::unique_ptr<detail::backend> vinstr_backend_create(const instance_imp
     return std::make_unique<vinstr_backend>(std::move(args), syscall::iface{});
 }
 
+/** Create panthor backend if possible.
+ *
+ * @param inst    Instance implementation reference.
+ * @param[in] period_ns    Period in nanoseconds between samples taken. Zero for manual context.
+ * @param[in] config       Which counters to enable on per-block basis.
+ * @param[in] config_len   Len of @p config array.
+ * @param[in] buffer_count Number of ring buffer slots requested, zero for the default.
+ * @return backend pointer, if created.
+ */
+static std::unique_ptr<detail::backend> panthor_backend_create(const instance_impl_type &inst, uint64_t period_ns,
+                                                               const configuration *config, size_t config_len,
+                                                               uint32_t buffer_count) {
+    std::error_code ec;
+    panthor_backend::args_type args{};
+
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    std::tie(ec, args) = panthor::setup(inst, period_ns, config, config + config_len, buffer_count);
+
+    if (ec)
+        return nullptr;
+
+    return std::make_unique<panthor_backend>(std::move(args), syscall::iface{});
+}
+
 backend::~backend() = default;
 
+std::error_code backend::request_sample_async(uint64_t user_data) { return request_sample(user_data); }
+
 std::unique_ptr<detail::backend> backend::create(const instance &inst, uint64_t period_ns, const configuration *config,
-                                                 size_t config_len) {
+                                                 size_t config_len, uint32_t buffer_count) {
     const auto &inst_impl = hwcpipe::device::detail::cast_to_impl(inst);
 
     switch (inst_impl.backend_type()) {
     case backend_type::vinstr:
     case backend_type::vinstr_pre_r21:
-        return vinstr_backend_create(inst_impl, period_ns, config, config_len);
+        return vinstr_backend_create(inst_impl, period_ns, config, config_len, buffer_count);
     case backend_type::kinstr_prfcnt:
     case backend_type::kinstr_prfcnt_wa:
     case backend_type::kinstr_prfcnt_bad:
+        // the kinstr_prfcnt ring buffer is sized by the kernel, which has no request for it
         return kinstr_prfcnt_backend_create(inst_impl, period_ns, config, config_len);
+    case backend_type::panthor:
+        return panthor_backend_create(inst_impl, period_ns, config, config_len, buffer_count);
     }
 
     return nullptr;
@@ -38,6 +38,11 @@ namespace sampler {
 /**
  * Default `reader::discard` implementation.
  *
+ * The file descriptor is polled once, then the ready samples are released with
+ * `backend.discard_ready_sample`, which takes and puts back the oldest one without
+ * decoding it. The ring buffer is found empty when that fails and the file descriptor
+ * is no longer readable, so draining it costs two polls rather than one per sample.
+ *
  * @param backend            Back-end instance.
  * @param syscall_iface      Syscall interface.
  * @param timestamp_iface    Timestam interface.
@@ -46,32 +51,32 @@ namespace sampler {
 template <typename backend_t, typename syscall_iface_t, typename timestamp_iface_t>
 std::error_code discard_impl(backend_t &backend, syscall_iface_t &&syscall_iface, timestamp_iface_t &&timestamp_iface) {
     const auto now = timestamp_iface.clock_gettime();
-    for (;;) {
-        std::error_code ec;
-        bool ready_read{false};
 
-        std::tie(ec, ready_read) = check_ready_read(backend.get_fd(), syscall_iface);
-        if (ec)
-            return ec;
+    std::error_code ec;
+    bool ready_read{false};
 
-        if (!ready_read)
-            break;
+    std::tie(ec, ready_read) = check_ready_read(backend.get_fd(), syscall_iface);
+    if (ec || !ready_read)
+        return ec;
 
-        sample_metadata sm{};
-        sample_handle sample_hndl{};
+    for (;;) {
+        uint64_t timestamp_ns_end{};
 
-        ec = backend.get_sample(sm, sample_hndl);
-        if (ec)
-            return ec;
+        ec = backend.discard_ready_sample(timestamp_ns_end);
+        if (ec) {
+            /* Not an error if the ring buffer ran out of samples. */
+            std::error_code poll_ec;
+            std::tie(poll_ec, ready_read) = check_ready_read(backend.get_fd(), syscall_iface);
+            if (poll_ec)
+                return poll_ec;
 
-        ec = backend.put_sample(sample_hndl);
-        if (ec)
-            return ec;
+            return ready_read ? ec : std::error_code{};
+        }
 
         /* If samples are produced faster than discarded, this condition
          * prevents from infinite looping.
          */
-        if (sm.timestamp_ns_end >= now)
+        if (timestamp_ns_end >= now)
             break;
     }
 
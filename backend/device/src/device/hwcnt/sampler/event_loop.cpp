@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#include <device/hwcnt/sampler/event_loop.hpp>
+#include <device/hwcnt/sampler/poll.hpp>
+#include <device/syscall/iface.hpp>
+
+#include <algorithm>
+#include <array>
+#include <tuple>
+
+#include <sys/epoll.h>
+
+namespace hwcpipe {
+namespace device {
+namespace hwcnt {
+namespace sampler {
+
+namespace {
+
+/** Maximum number of events returned by one epoll_wait call. */
+constexpr int max_events = 16;
+
+} // namespace
+
+constexpr uint64_t event_loop::wait_forever;
+
+event_loop::event_loop()
+    : epoll_fd_(-1) {
+    std::tie(std::ignore, epoll_fd_) = syscall::iface{}.epoll_create1(EPOLL_CLOEXEC);
+}
+
+event_loop::~event_loop() {
+    if (epoll_fd_ >= 0)
+        syscall::iface{}.close(epoll_fd_);
+}
+
+std::error_code event_loop::add_reader(reader &rdr, reader::sample_callback callback, void *user_data,
+                                       size_t max_count) {
+    return add({rdr.get_fd(), &rdr, callback, nullptr, user_data, max_count});
+}
+
+std::error_code event_loop::add_fd(int fd, fd_callback callback, void *user_data) {
+    return add({fd, nullptr, nullptr, callback, user_data, 0});
+}
+
+std::error_code event_loop::add(const source &src) {
+    if (src.fd < 0)
+        return std::make_error_code(std::errc::bad_file_descriptor);
+
+    auto it = std::find_if(sources_.begin(), sources_.end(), [](const source &s) { return s.fd < 0; });
+    const size_t index = static_cast<size_t>(it - sources_.begin());
+
+    struct epoll_event event {};
+    event.events = EPOLLIN;
+    event.data.u64 = index;
+
+    const std::error_code ec = syscall::iface{}.epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, src.fd, &event);
+
+    if (ec)
+        return ec;
+
+    if (it == sources_.end())
+        sources_.push_back(src);
+    else
+        *it = src;
+
+    return {};
+}
+
+std::error_code event_loop::remove(int fd) {
+    auto it = std::find_if(sources_.begin(), sources_.end(), [fd](const source &s) { return fd >= 0 && s.fd == fd; });
+
+    if (it == sources_.end())
+        return std::make_error_code(std::errc::invalid_argument);
+
+    it->fd = -1;
+
+    return syscall::iface{}.epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, fd, nullptr);
+}
+
+std::error_code event_loop::run_once(uint64_t timeout_ns, size_t &count) {
+    count = 0;
+
+    std::array<struct epoll_event, max_events> events{};
+    const int timeout = timeout_ns == wait_forever ? -1 : detail::to_poll_timeout(timeout_ns);
+
+    std::error_code ec;
+    int num_events{};
+    std::tie(ec, num_events) = syscall::iface{}.epoll_wait(epoll_fd_, events.data(), max_events, timeout);
+
+    if (ec == std::errc::interrupted)
+        return {};
+
+    if (ec)
+        return ec;
+
+    for (int i = 0; i < num_events; ++i) {
+        const source &src = sources_[static_cast<size_t>(events[static_cast<size_t>(i)].data.u64)];
+
+        if (src.rdr != nullptr) {
+            size_t num_samples{};
+            const std::error_code read_ec = src.rdr->read_samples(src.max_count, num_samples, src.sample_cb,
+                                                                  src.user_data);
+
+            if (read_ec && !ec)
+                ec = read_ec;
+        } else {
+            src.fd_cb(src.user_data, src.fd);
+        }
+
+        ++count;
+    }
+
+    return ec;
+}
+
+} // namespace sampler
+} // namespace hwcnt
+} // namespace device
+} // namespace hwcpipe
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2023 Arm Limited.
+ * Copyright (c) 2022-2025 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -32,6 +32,7 @@
 
 #include "backend_args.hpp"
 #include "block_index_remap.hpp"
+#include "block_layout_cache.hpp"
 #include "convert.hpp"
 #include "metadata_parser.hpp"
 
@@ -40,6 +41,7 @@
 #include <device/ioctl/kinstr_prfcnt/commands.hpp>
 #include <device/ioctl/kinstr_prfcnt/types.hpp>
 #include <device/ioctl/strided_array_iterator.hpp>
+#include <device/tracepoint.hpp>
 
 namespace hwcpipe {
 namespace device {
@@ -63,15 +65,34 @@ class backend : public base::backend<syscall_iface_t> {
     std::error_code stop(uint64_t user_data) override { return issue_command(cmd_code_type::stop, user_data); }
 
     std::error_code request_sample(uint64_t user_data) override {
-        return issue_command(ioctl::kinstr_prfcnt::control_cmd::control_cmd_code::sample_sync, user_data);
+        const tracepoint_timer timer{};
+        const auto ec = issue_command(cmd_code_type::sample_sync, user_data);
+        HWCPIPE_TRACEPOINT(request_sample, 0, user_data, timer.elapsed_ns());
+        return ec;
+    }
+
+    std::error_code request_sample_async(uint64_t user_data) override {
+        return issue_command(cmd_code_type::sample_async, user_data);
     }
 
     std::error_code get_sample(sample_metadata &sm, sample_handle &sample_hndl_raw) override {
+        const tracepoint_timer timer{};
+
         /* Wait until sample is ready. */
         std::error_code ec = wait_for_sample(fd_, get_syscall_iface());
         if (ec)
             return ec;
 
+        ec = get_ready_sample(sm, sample_hndl_raw);
+        if (!ec)
+            HWCPIPE_TRACEPOINT(get_sample, sm.sample_nr, sm.user_data, timer.elapsed_ns());
+
+        return ec;
+    }
+
+    std::error_code get_ready_sample(sample_metadata &sm, sample_handle &sample_hndl_raw) override {
+        const tracepoint_timer timer{};
+        std::error_code ec;
         auto &sample_hndl = sample_hndl_raw.get<sample_handle_type>();
 
         /* A sample is available. Obtain it and return it. */
@@ -84,13 +105,25 @@ class backend : public base::backend<syscall_iface_t> {
         const auto metadata_ptr{sample_hndl.sample_metadata_ptr.get(memory_.data())};
         ioctl::strided_array_iterator<const metadata_item_type> metadata_it{metadata_ptr, metadata_item_size_};
 
-        metadata_parser parser{sm, block_extents_, remap_};
-        auto metadata_it_end = parser.end(metadata_it);
+        /* Blocks laid out as in the last validated sample are not validated again. */
+        const auto metadata_it_end =
+            metadata_it + block_extents_.num_blocks() + metadata_parser::non_block_metadata_items;
+        const bool cached = layout_.matches(metadata_it, metadata_it_end);
+
+        metadata_parser parser{sm, block_extents_, remap_, cached};
         ec = parse_all(metadata_it, metadata_it_end, parser);
 
         /* Put sample back if its metadata is invalid. */
-        if (ec)
+        if (ec) {
             put_sample(sample_hndl_raw);
+            return ec;
+        }
+
+        if (!cached)
+            layout_.assign(metadata_it, metadata_it_end, remap_);
+
+        last_sample_.assign(sm);
+        HWCPIPE_TRACEPOINT(sample_ready, sm.sample_nr, sm.user_data, timer.elapsed_ns());
 
         return ec;
     };
@@ -110,7 +143,10 @@ class backend : public base::backend<syscall_iface_t> {
 
         const auto mapping = static_cast<const uint8_t *>(memory_.data());
 
-        done = parse_block_item(bm, it, mapping, remap_);
+        const auto position = static_cast<size_t>(reinterpret_cast<const uint8_t *>(block_hndl) -
+                                                  reinterpret_cast<const uint8_t *>(metadata_ptr)) /
+                              metadata_item_size_;
+        done = layout_.parse_block_item(bm, it, position, mapping, remap_);
 
         block_hndl = &*it;
 
@@ -118,11 +154,14 @@ class backend : public base::backend<syscall_iface_t> {
     }
 
     std::error_code put_sample(sample_handle sample_hndl_raw) override {
+        const tracepoint_timer timer{};
         std::error_code ec;
 
         std::tie(ec, std::ignore) =
             get_syscall_iface().ioctl(fd_, ioctl::kinstr_prfcnt::command::put_sample, &sample_hndl_raw);
 
+        HWCPIPE_TRACEPOINT(put_sample, last_sample_.sample_nr(), last_sample_.user_data(), timer.elapsed_ns());
+
         return ec;
     }
 
@@ -158,6 +197,10 @@ class backend : public base::backend<syscall_iface_t> {
     const size_t metadata_item_size_{};
     /** Block index remap instance, if any. */
     const block_index_remap *remap_;
+    /** Metadata items layout of the last validated sample. */
+    block_layout_cache layout_;
+    /** The last sample handed out, for the put_sample tracepoint. */
+    tracepoint_sample last_sample_;
 };
 
 } // namespace kinstr_prfcnt
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2023 Arm Limited.
+ * Copyright (c) 2022-2025 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -34,6 +34,7 @@
 #include <device/hwcnt/sampler/timestamp.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <mutex>
 
 namespace hwcpipe {
@@ -135,66 +136,97 @@ class backend_wa_impl : public backend_base_t, private timestamp_iface_t {
         return {};
     }
 
-    std::error_code request_sample(uint64_t user_data) override {
-        std::lock_guard<std::recursive_mutex> lock(access_);
+    std::error_code request_sample(uint64_t user_data) override { return request_sample_manual(user_data, false); }
 
-        if (sampler_type() != super::sampler_type::manual)
-            return std::make_error_code(std::errc::invalid_argument);
+    std::error_code request_sample_async(uint64_t user_data) override {
+        return request_sample_manual(user_data, true);
+    }
 
-        if (num_buffers_ <= 1)
-            return std::make_error_code(std::errc::operation_not_permitted);
+    std::error_code get_sample(sample_metadata &sm, sample_handle &sample_hndl_raw) override {
+        return get_sample_impl(sm, sample_hndl_raw, true);
+    }
 
-        auto ec = super::request_sample(user_data);
+    std::error_code get_ready_sample(sample_metadata &sm, sample_handle &sample_hndl_raw) override {
+        return get_sample_impl(sm, sample_hndl_raw, false);
+    }
 
-        if (ec)
-            return ec;
 
-        num_buffers_--;
+    bool next(sample_handle sample_hndl_raw, block_metadata &bm, block_handle &block_hndl_raw) const override {
+        if (empty_sample_)
+            return false;
 
-        return {};
+        return super::next(sample_hndl_raw, bm, block_hndl_raw);
     }
 
-    std::error_code get_sample(sample_metadata &sm, sample_handle &sample_hndl_raw) override {
+    std::error_code put_sample(sample_handle sample_hndl_raw) override {
+        if (sampler_type() == super::sampler_type::manual)
+            return put_sample_manual(sample_hndl_raw);
+
         std::lock_guard<std::recursive_mutex> lock(access_);
+        return put_sample_periodic(sample_hndl_raw);
+    }
 
+    std::error_code discard() override { return discard_impl(*this, get_syscall_iface(), get_ts_iface()); }
+
+    /**
+     * Take the oldest ready sample and put it back, without estimating its backlog.
+     *
+     * The sample goes through the session tracking, so that the stop samples of the
+     * discarded sessions are consumed.
+     *
+     * @param[out] timestamp_ns_end    End timestamp of the discarded sample.
+     * @return Error code.
+     */
+    std::error_code discard_ready_sample(uint64_t &timestamp_ns_end) {
+        sample_metadata sm{};
+        sample_handle sample_hndl_raw{};
         std::error_code ec;
 
         if (sampler_type() == super::sampler_type::manual)
-            ec = get_sample_manual(sm, sample_hndl_raw);
+            ec = get_sample_manual(sm, sample_hndl_raw, false);
         else
-            ec = get_sample_periodic(sm, sample_hndl_raw);
+            ec = get_sample_periodic(sm, sample_hndl_raw, false);
 
         if (ec)
             return ec;
 
-        sm.sample_nr = sample_nr_++;
+        ++sample_nr_;
+        timestamp_ns_end = sm.timestamp_ns_end;
 
-        return {};
+        return put_sample(sample_hndl_raw);
     }
 
-    bool next(sample_handle sample_hndl_raw, block_metadata &bm, block_handle &block_hndl_raw) const override {
-        std::lock_guard<std::recursive_mutex> lock(access_);
-
-        if (empty_sample_)
-            return false;
-
-        return super::next(sample_hndl_raw, bm, block_hndl_raw);
-    }
+  private:
+    /** @return Timestam iface reference. */
+    timestamp_iface_t &get_ts_iface() { return *this; }
 
-    std::error_code put_sample(sample_handle sample_hndl_raw) override {
-        std::lock_guard<std::recursive_mutex> lock(access_);
+    /**
+     * Get sample.
+     *
+     * The reader thread is the only one to get and put samples, so the sample number,
+     * the sample stash and the empty sample flag are not locked.
+     *
+     * @param[out] sm                 Sample metadata.
+     * @param[out] sample_hndl_raw    Sample handle.
+     * @param[in]  wait               True to wait for the sample, false to fail if none is ready.
+     * @return Error code.
+     */
+    std::error_code get_sample_impl(sample_metadata &sm, sample_handle &sample_hndl_raw, bool wait) {
+        std::error_code ec;
 
         if (sampler_type() == super::sampler_type::manual)
-            return put_sample_manual(sample_hndl_raw);
+            ec = get_sample_manual(sm, sample_hndl_raw, wait);
         else
-            return put_sample_periodic(sample_hndl_raw);
-    }
+            ec = get_sample_periodic(sm, sample_hndl_raw, wait);
 
-    std::error_code discard() override { return discard_impl(*this, get_syscall_iface(), get_ts_iface()); }
+        if (ec)
+            return ec;
 
-  private:
-    /** @return Timestam iface reference. */
-    timestamp_iface_t &get_ts_iface() { return *this; }
+        sm.sample_nr = sample_nr_++;
+        sm.backlog = super::estimate_backlog(this->clock_gettime(), sm.timestamp_ns_end);
+
+        return {};
+    }
 
     /** @return HWCNT buffer size. */
     uint64_t compute_num_buffers_max() {
@@ -213,13 +245,40 @@ class backend_wa_impl : public backend_base_t, private timestamp_iface_t {
         return result;
     }
 
+    /**
+     * Request manual sample.
+     *
+     * @param[in] user_data    User data.
+     * @param[in] async        True to request the sample asynchronously.
+     */
+    std::error_code request_sample_manual(uint64_t user_data, bool async) {
+        if (sampler_type() != super::sampler_type::manual)
+            return std::make_error_code(std::errc::invalid_argument);
+
+        /* Reserve a buffer, so that put_sample can run concurrently. */
+        auto num_buffers = num_buffers_.load(std::memory_order_relaxed);
+        do {
+            if (num_buffers <= 1)
+                return std::make_error_code(std::errc::operation_not_permitted);
+        } while (!num_buffers_.compare_exchange_weak(num_buffers, num_buffers - 1, std::memory_order_relaxed));
+
+        auto ec = async ? super::request_sample_async(user_data) : super::request_sample(user_data);
+
+        if (ec) {
+            num_buffers_.fetch_add(1, std::memory_order_relaxed);
+            return ec;
+        }
+
+        return {};
+    }
+
     /**
      * Start manual session.
      *
      * @param[in] user_data    User data.
      */
     std::error_code start_manual(uint64_t user_data) {
-        if (num_buffers_ == 0)
+        if (num_buffers_.load(std::memory_order_relaxed) == 0)
             return std::make_error_code(std::errc::operation_not_permitted);
 
         return super::start(user_data);
@@ -236,8 +295,9 @@ class backend_wa_impl : public backend_base_t, private timestamp_iface_t {
         if (ec)
             return ec;
 
-        assert(num_buffers_ >= 1);
-        num_buffers_--;
+        const auto num_buffers = num_buffers_.fetch_sub(1, std::memory_order_relaxed);
+        assert(num_buffers >= 1);
+        static_cast<void>(num_buffers);
 
         return {};
     }
@@ -247,10 +307,11 @@ class backend_wa_impl : public backend_base_t, private timestamp_iface_t {
      *
      * @param[out] sm                 Sample metadata.
      * @param[out] sample_hndl_raw    Sample handle.
+     * @param[in]  wait               True to wait for the sample.
      * @return Error code.
      */
-    std::error_code get_sample_manual(sample_metadata &sm, sample_handle &sample_hndl_raw) {
-        return super::get_sample(sm, sample_hndl_raw);
+    std::error_code get_sample_manual(sample_metadata &sm, sample_handle &sample_hndl_raw, bool wait) {
+        return wait ? super::get_sample(sm, sample_hndl_raw) : super::get_ready_sample(sm, sample_hndl_raw);
     }
 
     /**
@@ -265,8 +326,9 @@ class backend_wa_impl : public backend_base_t, private timestamp_iface_t {
         if (ec)
             return ec;
 
-        num_buffers_++;
-        assert(num_buffers_ <= num_buffers_max_);
+        const auto num_buffers = num_buffers_.fetch_add(1, std::memory_order_relaxed) + 1;
+        assert(num_buffers <= num_buffers_max_);
+        static_cast<void>(num_buffers);
 
         return {};
     }
@@ -320,21 +382,34 @@ class backend_wa_impl : public backend_base_t, private timestamp_iface_t {
     /**
      * Get sample (periodic back-end).
      *
+     * The session queue is shared with start() and stop(), so it is accessed with
+     * `access_` locked. The lock is not held while waiting for a sample.
+     *
      * @param[out] sm                 Sample metadata.
      * @param[out] sample_hndl_raw    Sample handle.
+     * @param[in]  wait               True to wait for the sample.
      * @return Error code.
      */
-    std::error_code get_sample_periodic(sample_metadata &sm, sample_handle &sample_hndl_raw) {
+    std::error_code get_sample_periodic(sample_metadata &sm, sample_handle &sample_hndl_raw, bool wait) {
         assert(!empty_sample_);
 
         for (;;) {
             std::error_code ec;
             sm = {};
 
+            if (!stash_.has_value() && wait) {
+                ec = wait_for_sample(fd_, get_syscall_iface());
+
+                if (ec)
+                    return ec;
+            }
+
+            std::lock_guard<std::recursive_mutex> lock(access_);
+
             if (stash_.has_value()) {
                 stash_.release(sm, sample_hndl_raw);
             } else {
-                ec = super::get_sample(sm, sample_hndl_raw);
+                ec = super::get_ready_sample(sm, sample_hndl_raw);
             }
 
             if (ec) {
@@ -713,7 +788,7 @@ class backend_wa_impl : public backend_base_t, private timestamp_iface_t {
         sample_handle handle_{};
     };
 
-    /** Mutex to protect access to this class. */
+    /** Mutex serializing start/stop transitions with the session bookkeeping (periodic back-end only). */
     mutable std::recursive_mutex access_;
 
     /** True if there is an active sampling session. */
@@ -724,7 +799,7 @@ class backend_wa_impl : public backend_base_t, private timestamp_iface_t {
     /** Maximum buffers in HWCNT ring buffer (manual back-end only). */
     uint64_t num_buffers_max_{0};
     /** Current number of buffers in HWCNT ring buffer (manual back-end only). */
-    uint64_t num_buffers_{0};
+    std::atomic<uint64_t> num_buffers_{0};
 
     /** Sample stash storage. */
     sample_stash stash_;
@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/** @file block_layout_cache.hpp */
+
+#pragma once
+
+#include "block_index_remap.hpp"
+#include "metadata_parser.hpp"
+
+#include <device/hwcnt/block_metadata.hpp>
+#include <device/ioctl/kinstr_prfcnt/types.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <vector>
+
+namespace hwcpipe {
+namespace device {
+namespace hwcnt {
+namespace sampler {
+namespace kinstr_prfcnt {
+
+/**
+ * Metadata items layout of the samples of a session.
+ *
+ * The kernel writes the metadata items of every sample in the same order,
+ * with the same block types, indices and sets. Once the items of a sample are
+ * validated by `metadata_parser`, their layout is kept along with the
+ * converted and remapped block fields. The items of the next samples are then
+ * validated by comparing their raw fields with the layout, and their blocks
+ * are decoded without converting or remapping them again.
+ */
+class block_layout_cache {
+    using metadata_item = ioctl::kinstr_prfcnt::metadata_item;
+
+  public:
+    /** @return True if no layout is cached. */
+    bool empty() const { return entries_.empty(); }
+
+    /** Forget the cached layout. */
+    void clear() { entries_.clear(); }
+
+    /**
+     * Check that metadata items have the cached layout.
+     *
+     * @param[in] begin  Metadata items begin iterator.
+     * @param[in] end    Metadata items end iterator.
+     * @return True if the items have the cached layout.
+     */
+    template <typename iterator_t>
+    bool matches(iterator_t begin, iterator_t end) const {
+        size_t position = 0;
+        for (auto it = begin; it != end; ++it, ++position) {
+            if (position == entries_.size() || !entries_[position].matches(*it))
+                return false;
+        }
+        return position != 0 && position == entries_.size();
+    }
+
+    /**
+     * Cache the layout of metadata items that were validated by `metadata_parser`.
+     *
+     * @param[in] begin  Metadata items begin iterator.
+     * @param[in] end    Metadata items end iterator.
+     * @param[in] remap  Block index remap.
+     */
+    template <typename iterator_t>
+    void assign(iterator_t begin, iterator_t end, const block_index_remap *remap) {
+        std::error_code ec;
+        entries_.clear();
+
+        for (auto it = begin; it != end; ++it) {
+            entry value{};
+            value.item_type = it->hdr.type;
+            if (value.item_type == metadata_item::item_type::block) {
+                const auto &metadata = it->u.block_md;
+                value.raw_type = metadata.type;
+                value.raw_index = metadata.block_idx;
+                value.raw_set = metadata.set;
+
+                std::tie(ec, value.type) = convert(metadata.type);
+                value.index = metadata.block_idx;
+                if (remap != nullptr)
+                    std::tie(ec, value.index) = remap->remap(value.type, metadata.block_idx);
+                value.set = convert(metadata.set);
+            }
+            entries_.push_back(value);
+        }
+    }
+
+    /**
+     * Parse block metadata from metadata items iterator, as `parse_block_item` does,
+     * using the cached block fields.
+     *
+     * If the items from @p position don't have the cached layout, e.g. because the
+     * layout was cached for a later sample, `parse_block_item` is used instead.
+     *
+     * @param[out]    result    Block metadata parsed.
+     * @param[in,out] it        Metadata items iterator.
+     * @param[in]     position  Position of @p it in the metadata items of the sample.
+     * @param[in]     mapping   Counters buffer mapping.
+     * @param[in]     remap     Block index remaper.
+     * @return False if there are no more blocks to parse.
+     */
+    template <typename iterator_t>
+    bool parse_block_item(block_metadata &result, iterator_t &it, size_t position, const uint8_t *mapping,
+                          const block_index_remap *remap) const {
+        for (; position < entries_.size(); ++position, ++it) {
+            const auto &value = entries_[position];
+            if (!value.matches(*it))
+                break;
+
+            switch (value.item_type) {
+            case metadata_item::item_type::block: {
+                const auto &metadata = it->u.block_md;
+                result.type = value.type;
+                result.index = value.index;
+                result.set = value.set;
+                result.state = convert(metadata.block_state);
+                result.values = mapping + metadata.values_offset;
+
+                ++it;
+                return true;
+            }
+            case metadata_item::item_type::none:
+                return false;
+            case metadata_item::item_type::sample:
+            case metadata_item::item_type::clock:
+            default:
+                continue;
+            }
+        }
+
+        return kinstr_prfcnt::parse_block_item(result, it, mapping, remap);
+    }
+
+  private:
+    /** Cached metadata item. */
+    struct entry {
+        /** Item type. */
+        metadata_item::item_type item_type;
+        /** Block type, as written by the kernel. */
+        ioctl::kinstr_prfcnt::block_type raw_type;
+        /** Block index, as written by the kernel. */
+        uint8_t raw_index;
+        /** Block set, as written by the kernel. */
+        ioctl::kinstr_prfcnt::prfcnt_set raw_set;
+        /** Converted block type. */
+        block_type type;
+        /** Remapped block index. */
+        uint8_t index;
+        /** Converted block set. */
+        prfcnt_set set;
+
+        /** @return True if @p item has the layout of this entry. */
+        bool matches(const metadata_item &item) const {
+            if (item.hdr.type != item_type)
+                return false;
+            if (item_type != metadata_item::item_type::block)
+                return true;
+            const auto &metadata = item.u.block_md;
+            return metadata.type == raw_type && metadata.block_idx == raw_index && metadata.set == raw_set;
+        }
+    };
+
+    /** One entry per metadata item. */
+    std::vector<entry> entries_;
+};
+
+} // namespace kinstr_prfcnt
+} // namespace sampler
+} // namespace hwcnt
+} // namespace device
+} // namespace hwcpipe
@@ -62,6 +62,8 @@ inline std::pair<std::error_code, block_type> convert(ioctl::kinstr_prfcnt::bloc
         return std::make_pair(std::error_code{}, block_type::firmware);
     case ioctl::kinstr_prfcnt::block_type::csg:
         return std::make_pair(std::error_code{}, block_type::csg);
+    default:
+        break;
     }
 
     return std::make_pair(std::make_error_code(std::errc::invalid_argument), block_type{});
@@ -87,6 +89,8 @@ inline ioctl::kinstr_prfcnt::block_type convert(block_type value) {
         return ioctl::kinstr_prfcnt::block_type::firmware;
     case block_type::csg:
         return ioctl::kinstr_prfcnt::block_type::csg;
+    default:
+        break;
     }
 
     assert(!&"Unexpected block_type value");
@@ -107,6 +111,8 @@ inline prfcnt_set convert(ioctl::kinstr_prfcnt::prfcnt_set value) {
         return prfcnt_set::secondary;
     case ioctl::kinstr_prfcnt::prfcnt_set::tertiary:
         return prfcnt_set::tertiary;
+    default:
+        break;
     }
 
     assert(!&"Unexpected ioctl::kinstr_prfcnt::prfcnt_set value");
@@ -127,6 +133,8 @@ inline ioctl::kinstr_prfcnt::prfcnt_set convert(prfcnt_set value) {
         return ioctl::kinstr_prfcnt::prfcnt_set::secondary;
     case prfcnt_set::tertiary:
         return ioctl::kinstr_prfcnt::prfcnt_set::tertiary;
+    default:
+        break;
     }
 
     assert(!&"Unexpected prfcnt_set value");
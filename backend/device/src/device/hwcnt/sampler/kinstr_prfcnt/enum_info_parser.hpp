@@ -145,6 +145,7 @@ class enum_info_parser {
         case request_type::mode:
         case request_type::enable:
             break;
+        case request_type::scope:
         default:
             return {};
         }
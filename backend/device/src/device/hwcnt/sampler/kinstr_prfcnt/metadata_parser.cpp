@@ -31,6 +31,7 @@ namespace sampler {
 namespace kinstr_prfcnt {
 
 constexpr metadata_parser::type2member_type metadata_parser::type2member;
+constexpr size_t metadata_parser::non_block_metadata_items;
 
 } // namespace kinstr_prfcnt
 } // namespace sampler
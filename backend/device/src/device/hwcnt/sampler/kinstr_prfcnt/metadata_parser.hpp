@@ -59,17 +59,24 @@ class metadata_parser {
 
     using type2member_type = decltype(type2member);
 
+    /** Number of sample, clock and sentinel metadata items of a sample. */
+    static constexpr size_t non_block_metadata_items = 3;
+
     /**
      * Constructor.
      *
      * @param[out] metadata Sample metadata being parsed.
      * @param[in]  extents  Block extents.
      * @param[in]  remap    Block index remap.
+     * @param[in]  blocks_validated  True if the block items are known to be valid, because
+     *                               they have the layout of a validated sample.
      */
-    metadata_parser(sample_metadata &metadata, const block_extents &extents, const block_index_remap *remap)
+    metadata_parser(sample_metadata &metadata, const block_extents &extents, const block_index_remap *remap,
+                    bool blocks_validated = false)
         : result_(metadata)
         , extents_(extents)
-        , remap_(remap) {}
+        , remap_(remap)
+        , blocks_validated_(blocks_validated) {}
 
     /**
      * Parse sample metadata item.
@@ -128,6 +135,11 @@ class metadata_parser {
     std::error_code on_item(const ioctl::kinstr_prfcnt::metadata_item::block_metadata &metadata) {
         using hwcpipe::device::detail::enum_operators::to_underlying;
 
+        if (blocks_validated_) {
+            ++num_blocks_;
+            return std::error_code{};
+        }
+
         std::error_code ec;
         block_type type{};
 
@@ -198,7 +210,6 @@ class metadata_parser {
      */
     template <typename iterator_t>
     iterator_t end(iterator_t begin) const {
-        static constexpr size_t non_block_metadata_items = 3;
         return begin + extents_.num_blocks() + non_block_metadata_items;
     }
 
@@ -209,6 +220,8 @@ class metadata_parser {
     const block_extents &extents_;
     /** Block index remap. */
     const block_index_remap *remap_;
+    /** True if the block items are known to be valid. */
+    bool blocks_validated_;
     /** Number of blocks parsed so far. */
     size_t num_blocks_{0};
     /** Number of blocks of given type parsed so far. */
@@ -265,6 +278,8 @@ inline bool parse_block_item(block_metadata &result, iterator_t &it, const uint8
         }
         case metadata_item::item_type::none:
             return false;
+        case metadata_item::item_type::sample:
+        case metadata_item::item_type::clock:
         default:
             continue;
         }
@@ -204,7 +204,8 @@ auto setup(const instance_t &instance, uint64_t period_ns, const configuration *
     filefd_guard<syscall_iface_type> guard_kinstr_prfcnt_fd(kinstr_prfcnt_fd, iface);
 
     using memory_type = typename args_type::memory_type;
-    memory_type memory{kinstr_prfcnt_fd, mmap_size, ec, iface};
+    // pre-fault the ring buffer, so that the first samples read don't take the page faults
+    memory_type memory{kinstr_prfcnt_fd, mmap_size, ec, iface, true};
     if (ec)
         return std::make_pair(ec, std::move(result));
 
@@ -33,6 +33,7 @@
 #include <utility>
 
 #include <sys/mman.h>
+#include <unistd.h>
 
 namespace hwcpipe {
 namespace device {
@@ -45,6 +46,10 @@ namespace sampler {
  * RAII class to map `size` bytes of read only memory in constructor,
  * and unmap it in destructor.
  *
+ * The mapping can be pre-faulted, so that the page faults of the first pass
+ * over the memory are taken when the mapping is set up rather than when the
+ * first samples are read.
+ *
  * @par Example
  * @code
  * std::error_code ec;
@@ -83,18 +88,48 @@ class mapped_memory : private syscall_iface_t {
     /**
      * Memory mapping constructor.
      *
-     * @param[in] fd     File descriptor to map.
-     * @param[in] size   Mapping size.
-     * @param[out] ec    Error code.
-     * @param[in] iface  Syscall iface (testing only).
+     * @param[in] fd        File descriptor to map.
+     * @param[in] size      Mapping size.
+     * @param[out] ec       Error code.
+     * @param[in] iface     Syscall iface (testing only).
+     * @param[in] prefault  True to pre-fault the mapping, see `prefault()`.
      */
-    explicit mapped_memory(int fd, size_t size, std::error_code &ec, const syscall_iface_t &iface)
+    explicit mapped_memory(int fd, size_t size, std::error_code &ec, const syscall_iface_t &iface,
+                           bool prefault = false)
         : syscall_iface_t(iface)
         , size_(size) {
         std::tie(ec, data_) = get_syscall_iface().mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
 
         if (ec)
             data_ = nullptr;
+        else if (prefault)
+            this->prefault();
+    }
+
+    /**
+     * Shared memory mapping constructor.
+     *
+     * Maps @p size bytes at @p offset of @p fd with `MAP_SHARED`, as needed
+     * for the buffer objects of DRM drivers, which can't be mapped privately.
+     *
+     * @param[in] fd        File descriptor to map.
+     * @param[in] offset    Offset of the mapping in @p fd.
+     * @param[in] size      Mapping size.
+     * @param[in] prot      Memory protection, e.g. `PROT_READ | PROT_WRITE`.
+     * @param[out] ec       Error code.
+     * @param[in] iface     Syscall iface (testing only).
+     * @param[in] prefault  True to pre-fault the mapping, see `prefault()`.
+     */
+    explicit mapped_memory(int fd, off_t offset, size_t size, int prot, std::error_code &ec,
+                           const syscall_iface_t &iface, bool prefault = false)
+        : syscall_iface_t(iface)
+        , size_(size) {
+        std::tie(ec, data_) = get_syscall_iface().mmap(nullptr, size_, prot, MAP_SHARED, fd, offset);
+
+        if (ec)
+            data_ = nullptr;
+        else if (prefault)
+            this->prefault();
     }
 
     explicit mapped_memory(void *data, size_t size, const syscall_iface_t &iface)
@@ -107,9 +142,31 @@ class mapped_memory : private syscall_iface_t {
 
     /** @return base address of mapped memory. */
     const void *data() const { return data_; }
+    /** @return base address of mapped memory, for writable mappings. */
+    void *data() { return data_; }
     /** @return size of the memory mapping. */
     size_t size() const { return size_; }
 
+    /**
+     * Pre-fault the mapping.
+     *
+     * Every page is read once, so that its page table entry is populated.
+     * `MAP_POPULATE` and `madvise` hints are not used, as they have no effect on
+     * the `VM_IO` mappings of the kernel driver, nor on the syscall wrappers that
+     * emulate them.
+     */
+    void prefault() const {
+        if (data_ == nullptr)
+            return;
+
+        const long page_size = ::sysconf(_SC_PAGESIZE);
+        const size_t stride = page_size > 0 ? static_cast<size_t>(page_size) : 4096;
+
+        const auto *bytes = static_cast<const volatile unsigned char *>(data_);
+        for (size_t offset = 0; offset < size_; offset += stride)
+            static_cast<void>(bytes[offset]);
+    }
+
     /** Destructor. */
     ~mapped_memory() {
         if (data_ == nullptr)
@@ -0,0 +1,306 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include <device/hwcnt/reader.hpp>
+#include <device/hwcnt/sample.hpp>
+#include <device/hwcnt/sampler/multiplexer.hpp>
+#include <device/instance.hpp>
+
+#include <algorithm>
+
+namespace hwcpipe {
+namespace device {
+namespace hwcnt {
+namespace sampler {
+
+namespace {
+
+/** Number of counters sets. */
+constexpr size_t num_sets = static_cast<size_t>(prfcnt_set::tertiary) + 1;
+
+/** Sampler factory that samples a Mali device instance. */
+std::error_code instance_factory(void *user_data, const configuration *config, size_t config_len,
+                                 manual &sampler) {
+    const auto &inst = *static_cast<const instance *>(user_data);
+
+    sampler = manual{inst, config, config_len};
+    if (!sampler)
+        return std::make_error_code(std::errc::invalid_argument);
+
+    return {};
+}
+
+/**
+ * Split an enable map into chunks of at most a number of counters.
+ *
+ * @param[in] enable_map    Enable map to split.
+ * @param[in] max_counters  Maximum number of counters per chunk.
+ * @return The chunks, in order of counter number.
+ */
+std::vector<configuration::enable_map_type> split(const configuration::enable_map_type &enable_map,
+                                                  size_t max_counters) {
+    std::vector<configuration::enable_map_type> result{};
+
+    size_t count = max_counters;
+    for (size_t i = 0; i != enable_map.size(); ++i) {
+        if (!enable_map[i])
+            continue;
+
+        if (count == max_counters) {
+            result.emplace_back();
+            count = 0;
+        }
+
+        result.back()[i] = true;
+        ++count;
+    }
+
+    return result;
+}
+
+} // namespace
+
+std::error_code multiplexer::plan(const configuration *config, size_t config_len, size_t max_counters,
+                                  std::vector<pass_type> &passes) {
+    passes.clear();
+
+    if (max_counters == 0)
+        return std::make_error_code(std::errc::invalid_argument);
+
+    std::array<std::array<configuration::enable_map_type, block_extents::num_block_types>, num_sets> merged{};
+    for (size_t i = 0; i != config_len; ++i) {
+        const auto set = static_cast<size_t>(config[i].set);
+        const auto type = static_cast<size_t>(config[i].type);
+
+        if (set >= num_sets || type >= block_extents::num_block_types)
+            return std::make_error_code(std::errc::invalid_argument);
+
+        merged[set][type] |= config[i].enable_map;
+    }
+
+    for (size_t set = 0; set != num_sets; ++set) {
+        std::array<std::vector<configuration::enable_map_type>, block_extents::num_block_types> chunks{};
+        size_t num_passes = 0;
+
+        for (size_t type = 0; type != block_extents::num_block_types; ++type) {
+            chunks[type] = split(merged[set][type], max_counters);
+            num_passes = std::max(num_passes, chunks[type].size());
+        }
+
+        for (size_t pass = 0; pass != num_passes; ++pass) {
+            pass_type result{};
+
+            for (size_t type = 0; type != block_extents::num_block_types; ++type) {
+                if (pass < chunks[type].size())
+                    result.push_back({static_cast<block_type>(type), static_cast<prfcnt_set>(set), chunks[type][pass]});
+            }
+
+            passes.push_back(std::move(result));
+        }
+    }
+
+    return {};
+}
+
+multiplexer::multiplexer(const instance &inst, const configuration *config, size_t config_len, size_t max_counters)
+    : multiplexer(instance_factory, const_cast<instance *>(&inst), config, config_len, max_counters) {}
+
+multiplexer::multiplexer(sampler_factory factory, void *user_data, const configuration *config, size_t config_len,
+                         size_t max_counters)
+    : factory_(factory)
+    , user_data_(user_data) {
+    std::vector<pass_type> passes{};
+    if (plan(config, config_len, max_counters, passes))
+        return;
+
+    passes_.resize(passes.size());
+    for (size_t i = 0; i != passes.size(); ++i)
+        passes_[i].config = std::move(passes[i]);
+}
+
+std::error_code multiplexer::start() {
+    if (passes_.empty())
+        return std::make_error_code(std::errc::invalid_argument);
+
+    for (auto &pass : passes_) {
+        pass.values = {};
+        pass.counted_ns = 0;
+    }
+    num_windows_ = 0;
+    enabled_ns_ = 0;
+    paused_ = false;
+
+    return open(0);
+}
+
+std::error_code multiplexer::rotate() {
+    if (!sampler_ || paused_)
+        return std::make_error_code(std::errc::invalid_argument);
+
+    /* A single pass keeps its session, and is sampled without stopping it. */
+    if (passes_.size() == 1) {
+        std::error_code ec = sampler_.request_sample(num_windows_);
+        if (ec)
+            return ec;
+
+        return collect();
+    }
+
+    std::error_code ec = sampler_.accumulation_stop(num_windows_);
+    if (ec)
+        return ec;
+
+    ec = collect();
+    if (ec)
+        return ec;
+
+    return open((current_ + 1) % passes_.size());
+}
+
+std::error_code multiplexer::stop() {
+    if (!sampler_)
+        return std::make_error_code(std::errc::invalid_argument);
+
+    /* A paused session already collected its last window. */
+    std::error_code ec{};
+    if (!paused_) {
+        ec = sampler_.accumulation_stop(num_windows_);
+        if (!ec)
+            ec = collect();
+    }
+
+    sampler_ = manual{};
+    paused_ = false;
+    return ec;
+}
+
+std::error_code multiplexer::pause() {
+    if (!sampler_ || paused_)
+        return std::make_error_code(std::errc::invalid_argument);
+
+    std::error_code ec = sampler_.accumulation_stop(num_windows_);
+    if (ec)
+        return ec;
+
+    ec = collect();
+    if (ec)
+        return ec;
+
+    paused_ = true;
+    return {};
+}
+
+std::error_code multiplexer::resume() {
+    if (!sampler_ || !paused_)
+        return std::make_error_code(std::errc::invalid_argument);
+
+    std::error_code ec = sampler_.accumulation_start();
+    if (ec)
+        return ec;
+
+    paused_ = false;
+    return {};
+}
+
+std::error_code multiplexer::get_estimate(block_type type, prfcnt_set set, size_t counter, estimate &result) const {
+    if (counter >= configuration::max_counters_per_block)
+        return std::make_error_code(std::errc::invalid_argument);
+
+    for (const auto &pass : passes_) {
+        for (const auto &config : pass.config) {
+            if (config.type != type || config.set != set || !config.enable_map[counter])
+                continue;
+
+            result.raw = pass.values[static_cast<size_t>(type)][counter];
+            result.counted_ns = pass.counted_ns;
+            result.enabled_ns = enabled_ns_;
+            result.scaled = pass.counted_ns == 0 ? 0.0
+                                                 : static_cast<double>(result.raw) * static_cast<double>(enabled_ns_) /
+                                                       static_cast<double>(pass.counted_ns);
+            return {};
+        }
+    }
+
+    return std::make_error_code(std::errc::invalid_argument);
+}
+
+std::error_code multiplexer::open(size_t index) {
+    /* The previous session is closed first, as a device may only have one. */
+    sampler_ = manual{};
+    current_ = index;
+
+    const auto &config = passes_[index].config;
+    std::error_code ec = factory_(user_data_, config.data(), config.size(), sampler_);
+    if (ec)
+        return ec;
+
+    return sampler_.accumulation_start();
+}
+
+std::error_code multiplexer::collect() {
+    auto &rdr = sampler_.get_reader();
+    auto &pass = passes_[current_];
+
+    sample_metadata sm{};
+    sample_handle sh{};
+    std::error_code ec = rdr.get_sample(sm, sh);
+    if (ec)
+        return ec;
+
+    const bool values_64bit = rdr.get_block_extents().values_type() == sample_values_type::uint64;
+    const size_t num_counters = std::min(static_cast<size_t>(rdr.get_block_extents().counters_per_block()),
+                                         size_t{configuration::max_counters_per_block});
+
+    block_metadata bm{};
+    block_handle bh{};
+    while (rdr.next(sh, bm, bh)) {
+        const auto it = std::find_if(pass.config.begin(), pass.config.end(), [&bm](const configuration &config) {
+            return config.type == bm.type && config.set == bm.set;
+        });
+        if (it == pass.config.end())
+            continue;
+
+        auto &values = pass.values[static_cast<size_t>(bm.type)];
+        for (size_t i = 0; i != num_counters; ++i) {
+            if (!it->enable_map[i])
+                continue;
+
+            values[i] += values_64bit ? static_cast<const uint64_t *>(bm.values)[i]
+                                      : static_cast<const uint32_t *>(bm.values)[i];
+        }
+    }
+
+    const uint64_t window_ns = sm.timestamp_ns_end - sm.timestamp_ns_begin;
+    pass.counted_ns += window_ns;
+    enabled_ns_ += window_ns;
+    ++num_windows_;
+
+    return rdr.put_sample(sh);
+}
+
+} // namespace sampler
+} // namespace hwcnt
+} // namespace device
+} // namespace hwcpipe
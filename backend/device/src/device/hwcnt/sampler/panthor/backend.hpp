@@ -0,0 +1,316 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file backend.hpp
+ *
+ * DRM panthor hardware counters sample back-end implementation.
+ */
+
+#pragma once
+
+#include "backend_args.hpp"
+#include "convert.hpp"
+#include "sample_layout.hpp"
+
+#include <device/hwcnt/block_metadata.hpp>
+#include <device/hwcnt/reader.hpp>
+#include <device/hwcnt/sample.hpp>
+#include <device/hwcnt/sampler/base/backend.hpp>
+#include <device/hwcnt/sampler/poll.hpp>
+#include <device/ioctl/panthor/commands.hpp>
+#include <device/ioctl/panthor/types.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <system_error>
+#include <tuple>
+
+namespace hwcpipe {
+namespace device {
+namespace hwcnt {
+namespace sampler {
+namespace panthor {
+
+/**
+ * HWC backend using the DRM panthor perf-counter ioctls.
+ *
+ * The samples are read in place from the ring buffer that the kernel writes
+ * them to. Reading a sample takes no system call, other than clearing the
+ * eventfd the kernel signals.
+ *
+ * The reader thread is the only consumer of the ring buffer, and the control
+ * functions only issue ioctls, so no lock is taken.
+ */
+template <typename syscall_iface_t>
+class backend : public base::backend<syscall_iface_t> {
+  public:
+    using args_type = backend_args<syscall_iface_t>;
+
+    explicit backend(args_type &&args, const syscall_iface_t &syscall_iface = {})
+        : base_type(std::move(args.base_args), syscall_iface)
+        , device_fd_(args.device_fd)
+        , session_(args.session)
+        , ringbuf_bo_(std::move(args.ringbuf_bo))
+        , control_bo_(std::move(args.control_bo))
+        , control_memory_(std::move(args.control))
+        , control_(static_cast<ioctl::panthor::perf_ringbuf_control *>(control_memory_.data()))
+        , sample_slots_(args.sample_slots)
+        , sample_layout_(args.sample_layout_v)
+        , set_(args.set)
+        , extract_idx_(control_->extract_idx) {
+        // the ring buffer control page is mapped too
+        this->features_.mapped_size += control_memory_.size();
+    }
+
+    ~backend() override { static_cast<void>(issue_command(command_type::teardown, nullptr, 0)); }
+
+    std::error_code start(uint64_t user_data) override {
+        ioctl::panthor::perf_cmd_start args{user_data};
+        return issue_command(command_type::start, &args, sizeof(args));
+    }
+
+    std::error_code stop(uint64_t user_data) override {
+        ioctl::panthor::perf_cmd_stop args{user_data};
+        return issue_command(command_type::stop, &args, sizeof(args));
+    }
+
+    std::error_code request_sample(uint64_t user_data) override {
+        ioctl::panthor::perf_cmd_sample args{user_data};
+        return issue_command(command_type::sample, &args, sizeof(args));
+    }
+
+    std::error_code get_sample(sample_metadata &sm, sample_handle &sample_hndl) override {
+        /* Samples left in the ring buffer are read without waiting. */
+        while (extract_idx_ == insert_idx()) {
+            std::error_code ec = wait_for_sample(fd_, get_syscall_iface());
+            if (ec)
+                return ec;
+
+            clear_event();
+        }
+
+        return get_ready_sample(sm, sample_hndl);
+    }
+
+    std::error_code get_ready_sample(sample_metadata &sm, sample_handle &sample_hndl) override {
+        if (taken_)
+            return std::make_error_code(std::errc::device_or_resource_busy);
+
+        clear_event();
+
+        if (extract_idx_ == insert_idx())
+            return std::make_error_code(std::errc::resource_unavailable_try_again);
+
+        const auto &header = *reinterpret_cast<const ioctl::panthor::perf_sample_header *>(sample_begin(extract_idx_));
+
+        sm.user_data = header.user_data;
+        sm.flags = convert_sample_flags(header.flags);
+        /* The sample header has no sequence number, the ring buffer index that the kernel wrote the sample at
+         * is used instead. The kernel never skips an index: when the ring buffer is full it folds the periods
+         * lost into the next sample and flags it, so the samples lost are reported as stretched samples, and
+         * never as gaps between the sample numbers. */
+        sm.sample_nr = extract_idx_;
+        sm.timestamp_ns_begin = header.timestamp_start_ns;
+        sm.timestamp_ns_end = header.timestamp_end_ns;
+        sm.gpu_cycle = header.toplevel_clock_cycles;
+        sm.sc_cycle = header.shader_clock_cycles;
+        /* Only manual samples are taken. */
+        sm.backlog = 0;
+
+        if (!sm.sc_cycle && sm.gpu_cycle)
+            sm.sc_cycle = sm.gpu_cycle;
+
+        sample_hndl.get<sample_handle_type>() = extract_idx_;
+        taken_ = true;
+
+        return {};
+    }
+
+    bool next(sample_handle sample_hndl_raw, block_metadata &bm, block_handle &block_hndl_raw) const override {
+        const auto &sample_hndl = sample_hndl_raw.get<sample_handle_type>();
+        auto &block_index = block_hndl_raw.get<size_t>();
+
+        if (block_index == sample_layout_.size())
+            return false;
+
+        decode_block(sample_begin(sample_hndl), sample_layout_[block_index], bm);
+        ++block_index;
+
+        return true;
+    }
+
+    size_t get_blocks(sample_handle sample_hndl_raw, block_metadata *blocks, size_t capacity) const override {
+        const auto &sample_hndl = sample_hndl_raw.get<sample_handle_type>();
+
+        /* Every block is at a fixed offset of the ring buffer slot. */
+        const auto *sample = sample_begin(sample_hndl);
+        const size_t count = std::min(capacity, sample_layout_.size());
+
+        for (size_t i = 0; i != count; ++i)
+            decode_block(sample, sample_layout_[i], blocks[i]);
+
+        return count;
+    }
+
+    std::error_code put_sample(sample_handle sample_hndl_raw) override {
+        const auto &sample_hndl = sample_hndl_raw.get<sample_handle_type>();
+
+        if (!taken_ || sample_hndl != extract_idx_)
+            return std::make_error_code(std::errc::invalid_argument);
+
+        taken_ = false;
+        release_slots(extract_idx_ + 1);
+
+        return {};
+    }
+
+    std::error_code discard() override {
+        if (taken_)
+            return std::make_error_code(std::errc::device_or_resource_busy);
+
+        clear_event();
+        release_slots(insert_idx());
+
+        return {};
+    }
+
+  private:
+    using base_type = base::backend<syscall_iface_t>;
+    using base_type::fd_;
+    using base_type::get_syscall_iface;
+    using base_type::memory_;
+
+    /** Sample handle, the ring buffer index of the sample. */
+    using sample_handle_type = uint64_t;
+    using command_type = ioctl::panthor::perf_control::command;
+
+    /** @return Index of the next sample the kernel writes. */
+    uint64_t insert_idx() const { return __atomic_load_n(&control_->insert_idx, __ATOMIC_ACQUIRE); }
+
+    /**
+     * Hand the ring buffer slots up to an index back to the kernel.
+     *
+     * If samples are still waiting, the eventfd is signaled again, so that
+     * polling the reader file descriptor keeps reporting them.
+     *
+     * @param[in] extract_idx    Index of the next sample to read.
+     */
+    void release_slots(uint64_t extract_idx) {
+        extract_idx_ = extract_idx;
+        __atomic_store_n(&control_->extract_idx, extract_idx_, __ATOMIC_RELEASE);
+
+        if (extract_idx_ != insert_idx()) {
+            const uint64_t value = 1;
+            static_cast<void>(get_syscall_iface().write(fd_, &value, sizeof(value)));
+        }
+    }
+
+    /** Clear the eventfd counter. It is non-blocking, so an unsignaled eventfd is not waited for. */
+    void clear_event() {
+        uint64_t value{};
+        static_cast<void>(get_syscall_iface().read(fd_, &value, sizeof(value)));
+    }
+
+    /**
+     * Get the ring buffer slot of a sample.
+     *
+     * @param[in] index    Ring buffer index of the sample.
+     * @return Sample start address.
+     */
+    const uint8_t *sample_begin(uint64_t index) const {
+        /* The number of slots is a power of two, so the indices wrapping around is harmless. */
+        const auto slot = static_cast<size_t>(index & (sample_slots_ - 1));
+        return static_cast<const uint8_t *>(memory_.data()) + slot * sample_layout_.sample_size();
+    }
+
+    /**
+     * Decode a block of a sample.
+     *
+     * @param[in]  sample   Sample start address.
+     * @param[in]  entry    Block layout entry.
+     * @param[out] bm       Block metadata decoded.
+     */
+    void decode_block(const uint8_t *sample, const sample_layout::entry &entry, block_metadata &bm) const {
+        const auto *block = sample + entry.offset;
+        const auto &header = *reinterpret_cast<const ioctl::panthor::perf_block_header *>(block);
+
+        bm.type = entry.type;
+        bm.index = entry.index;
+        bm.set = set_;
+        bm.state = convert_block_states(header.block_states);
+        bm.values = block + sample_layout_.block_header_size();
+    }
+
+    /**
+     * Issue a performance counters session command.
+     *
+     * @param[in] cmd   Command.
+     * @param[in] args  Command argument, if any.
+     * @param[in] size  Size of @p args.
+     * @return Error code.
+     */
+    std::error_code issue_command(command_type cmd, void *args, size_t size) {
+        ioctl::panthor::perf_control control{};
+        control.cmd = cmd;
+        control.handle = session_;
+        control.size = size;
+        control.pointer.reset(args);
+
+        std::error_code ec;
+        std::tie(ec, std::ignore) =
+            get_syscall_iface().ioctl(device_fd_, ioctl::panthor::command::perf_control, &control);
+
+        return ec;
+    }
+
+    /** Device file descriptor, not owned. */
+    const int device_fd_;
+    /** Performance counters session handle. */
+    const uint32_t session_;
+    /** Ring buffer buffer object. */
+    typename args_type::gem_handle_guard_type ringbuf_bo_;
+    /** Control buffer object. */
+    typename args_type::gem_handle_guard_type control_bo_;
+    /** Control buffer object mapping. */
+    typename args_type::memory_type control_memory_;
+    /** Ring buffer control structure, shared with the kernel. */
+    ioctl::panthor::perf_ringbuf_control *const control_;
+    /** Number of ring buffer slots, a power of two. */
+    const uint32_t sample_slots_;
+    /** Sample layout. */
+    const sample_layout sample_layout_;
+    /** Block set sampled. */
+    const prfcnt_set set_;
+    /** Index of the next sample to read. */
+    uint64_t extract_idx_{};
+    /** True if the sample at `extract_idx_` is being read. */
+    bool taken_{};
+};
+
+} // namespace panthor
+} // namespace sampler
+} // namespace hwcnt
+} // namespace device
+} // namespace hwcpipe
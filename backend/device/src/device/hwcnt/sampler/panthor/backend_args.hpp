@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/** @file backend_args.hpp panthor::backend constructor arguments. */
+
+#pragma once
+
+#include "gem_handle_guard.hpp"
+#include "sample_layout.hpp"
+
+#include <device/hwcnt/prfcnt_set.hpp>
+#include <device/hwcnt/sampler/base/backend_args.hpp>
+
+#include <cstdint>
+
+namespace hwcpipe {
+namespace device {
+namespace hwcnt {
+namespace sampler {
+namespace panthor {
+
+/** Arguments for `panthor::backend` constructor. */
+template <typename syscall_iface_t>
+struct backend_args {
+    /** Base args type. */
+    using base_args_type = base::backend_args<syscall_iface_t>;
+    /** Counters buffer memory type. */
+    using memory_type = typename base_args_type::memory_type;
+    /** Buffer object handle guard type. */
+    using gem_handle_guard_type = gem_handle_guard<syscall_iface_t>;
+    /** Default number of ring buffer slots. */
+    static constexpr uint32_t default_sample_slots = 32;
+    /** Maximum number of ring buffer slots. */
+    static constexpr uint32_t max_sample_slots = 256;
+
+    /**
+     * Arguments for `base::backend`.
+     *
+     * The file descriptor is the eventfd that the kernel signals, and the
+     * memory is the ring buffer mapping.
+     */
+    base_args_type base_args;
+
+    /** Device file descriptor, not owned. */
+    int device_fd{-1};
+    /** Performance counters session handle. */
+    uint32_t session{};
+    /** Ring buffer buffer object. */
+    gem_handle_guard_type ringbuf_bo{};
+    /** Control buffer object. */
+    gem_handle_guard_type control_bo{};
+    /** Control buffer object mapping, @ref ioctl::panthor::perf_ringbuf_control. */
+    memory_type control{};
+    /** Number of ring buffer slots, a power of two. */
+    uint32_t sample_slots{};
+    /** Block set sampled. */
+    prfcnt_set set{};
+    /** Sample layout. */
+    sample_layout sample_layout_v;
+};
+
+} // namespace panthor
+} // namespace sampler
+} // namespace hwcnt
+} // namespace device
+} // namespace hwcpipe
@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/** @file convert.hpp */
+
+#pragma once
+
+#include <device/hwcnt/block_metadata.hpp>
+#include <device/hwcnt/sample.hpp>
+#include <device/hwcnt/sampler/configuration.hpp>
+#include <device/ioctl/panthor/types.hpp>
+
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <limits>
+
+namespace hwcpipe {
+namespace device {
+namespace hwcnt {
+namespace sampler {
+namespace panthor {
+
+/**
+ * Convert from panthor block type to hwcpipe block_type.
+ *
+ * @param[in] value Value to convert.
+ * @return Converted value.
+ */
+inline block_type convert(ioctl::panthor::perf_block_type value) {
+    switch (value) {
+    case ioctl::panthor::perf_block_type::fw:
+        return block_type::firmware;
+    case ioctl::panthor::perf_block_type::cshw:
+        return block_type::fe;
+    case ioctl::panthor::perf_block_type::tiler:
+        return block_type::tiler;
+    case ioctl::panthor::perf_block_type::memsys:
+        return block_type::memory;
+    case ioctl::panthor::perf_block_type::shader:
+        return block_type::core;
+    default:
+        break;
+    }
+
+    assert(!&"Unexpected ioctl::panthor::perf_block_type value");
+    __builtin_unreachable();
+}
+
+/**
+ * Convert from hwcpipe prfcnt_set to panthor block set.
+ *
+ * @param[in] value Value to convert.
+ * @return Converted value.
+ */
+inline ioctl::panthor::perf_block_set convert(prfcnt_set value) {
+    switch (value) {
+    case prfcnt_set::primary:
+        return ioctl::panthor::perf_block_set::primary;
+    case prfcnt_set::secondary:
+        return ioctl::panthor::perf_block_set::secondary;
+    case prfcnt_set::tertiary:
+        return ioctl::panthor::perf_block_set::tertiary;
+    default:
+        break;
+    }
+
+    assert(!&"Unexpected prfcnt_set value");
+    __builtin_unreachable();
+}
+
+/**
+ * Convert from panthor block states to hwcpipe block state.
+ *
+ * @param[in] value Bitmask of `perf_block_header::block_state` values.
+ * @return Converted value.
+ */
+inline block_state convert_block_states(uint8_t value) {
+    using block_state_type = ioctl::panthor::perf_block_header::block_state;
+
+    const auto has = [value](block_state_type state) { return (value & static_cast<uint8_t>(state)) != 0; };
+
+    block_state result{};
+
+    result.on = has(block_state_type::on);
+    result.off = has(block_state_type::off);
+    result.available = has(block_state_type::available);
+    result.unavailable = has(block_state_type::unavailable);
+    result.normal = has(block_state_type::normal);
+    result.protected_mode = has(block_state_type::protected_mode);
+
+    return result;
+}
+
+/**
+ * Convert from panthor sample flags to hwcpipe sample flags.
+ *
+ * @param[in] value Bitmask of `perf_sample_header::sample_flag` values.
+ * @return Converted value.
+ */
+inline sample_flags convert_sample_flags(uint32_t value) {
+    using sample_flag = ioctl::panthor::perf_sample_header::sample_flag;
+
+    sample_flags result{};
+
+    result.error = (value & static_cast<uint32_t>(sample_flag::error)) != 0;
+    result.stretched = (value & static_cast<uint32_t>(sample_flag::overflow)) != 0;
+
+    return result;
+}
+
+/**
+ * Convert from hwcpipe enable map to panthor enable mask.
+ *
+ * @param[in] value Value to convert.
+ * @return Converted value.
+ */
+inline std::array<uint64_t, 2> convert(configuration::enable_map_type value) {
+    const configuration::enable_map_type mask_low64{std::numeric_limits<uint64_t>::max()};
+    constexpr uint64_t uint64_t_bits = 64;
+    return {
+        (value & mask_low64).to_ullong(),
+        ((value >> uint64_t_bits) & mask_low64).to_ullong(),
+    };
+}
+
+} // namespace panthor
+} // namespace sampler
+} // namespace hwcnt
+} // namespace device
+} // namespace hwcpipe
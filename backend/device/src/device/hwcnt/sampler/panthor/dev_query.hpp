@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/** @file dev_query.hpp DRM panthor device queries. */
+
+#pragma once
+
+#include <device/ioctl/panthor/commands.hpp>
+#include <device/ioctl/panthor/types.hpp>
+
+#include <system_error>
+#include <tuple>
+#include <utility>
+
+namespace hwcpipe {
+namespace device {
+namespace hwcnt {
+namespace sampler {
+namespace panthor {
+
+/**
+ * Query device information.
+ *
+ * @param[in] fd    Device file descriptor.
+ * @param[in] type  Query type, that returns a `value_t`.
+ * @param[in] iface Syscall iface (testing only).
+ * @return A pair of error code and the information queried.
+ */
+template <typename value_t, typename syscall_iface_t>
+inline std::pair<std::error_code, value_t> dev_query(int fd, ioctl::panthor::dev_query::query_type type,
+                                                     syscall_iface_t &&iface) {
+    value_t result{};
+
+    ioctl::panthor::dev_query query{};
+    query.type = type;
+    query.size = sizeof(result);
+    query.pointer.reset(&result);
+
+    std::error_code ec;
+    std::tie(ec, std::ignore) = iface.ioctl(fd, ioctl::panthor::command::dev_query, &query);
+
+    return std::make_pair(ec, result);
+}
+
+/**
+ * Query the GPU information.
+ *
+ * @param[in] fd    Device file descriptor.
+ * @param[in] iface Syscall iface (testing only).
+ * @return A pair of error code and the GPU information.
+ */
+template <typename syscall_iface_t>
+inline auto query_gpu_info(int fd, syscall_iface_t &&iface) {
+    return dev_query<ioctl::panthor::gpu_info>(fd, ioctl::panthor::dev_query::query_type::gpu_info,
+                                               std::forward<syscall_iface_t>(iface));
+}
+
+/**
+ * Query the performance counters information.
+ *
+ * Kernels without the performance counters interface fail the query.
+ *
+ * @param[in] fd    Device file descriptor.
+ * @param[in] iface Syscall iface (testing only).
+ * @return A pair of error code and the performance counters information.
+ */
+template <typename syscall_iface_t>
+inline auto query_perf_info(int fd, syscall_iface_t &&iface) {
+    return dev_query<ioctl::panthor::perf_info>(fd, ioctl::panthor::dev_query::query_type::perf_info,
+                                                std::forward<syscall_iface_t>(iface));
+}
+
+} // namespace panthor
+} // namespace sampler
+} // namespace hwcnt
+} // namespace device
+} // namespace hwcpipe
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/** @file gem_handle_guard.hpp */
+
+#pragma once
+
+#include <device/ioctl/panthor/commands.hpp>
+#include <device/ioctl/panthor/types.hpp>
+
+#include <cstdint>
+#include <utility>
+
+namespace hwcpipe {
+namespace device {
+namespace hwcnt {
+namespace sampler {
+namespace panthor {
+
+/** Helper to close a DRM buffer object handle on scope exit. */
+template <typename syscall_iface_t>
+class gem_handle_guard : private syscall_iface_t {
+  public:
+    /**
+     * Default construct handle guard.
+     *
+     * @param[in] iface     Syscall interface (testing only).
+     */
+    explicit gem_handle_guard(syscall_iface_t iface = {})
+        : syscall_iface_t(iface) {}
+
+    /**
+     * Construct handle guard.
+     *
+     * @param[in] fd        Device file descriptor that owns @p handle.
+     * @param[in] handle    Buffer object handle to manage.
+     * @param[in] iface     Syscall interface (testing only).
+     */
+    gem_handle_guard(int fd, uint32_t handle, syscall_iface_t iface = {})
+        : syscall_iface_t(iface)
+        , fd_(fd)
+        , handle_(handle) {}
+
+    ~gem_handle_guard() { reset(); }
+
+    gem_handle_guard(const gem_handle_guard &) = delete;
+    gem_handle_guard &operator=(const gem_handle_guard &) = delete;
+
+    gem_handle_guard(gem_handle_guard &&other)
+        : syscall_iface_t(other)
+        , fd_(other.fd_)
+        , handle_(std::exchange(other.handle_, 0)) {}
+
+    gem_handle_guard &operator=(gem_handle_guard &&other) {
+        static_cast<syscall_iface_t &>(*this) = other;
+
+        std::swap(fd_, other.fd_);
+        std::swap(handle_, other.handle_);
+
+        return *this;
+    }
+
+    /** @return managed handle, zero if none. */
+    uint32_t get() const { return handle_; }
+
+    /** Close the managed handle, if any. */
+    void reset() {
+        if (handle_ == 0)
+            return;
+
+        ioctl::panthor::gem_close args{};
+        args.handle = std::exchange(handle_, 0);
+        this->ioctl(fd_, ioctl::panthor::command::gem_close, &args);
+    }
+
+  private:
+    /** Device file descriptor. */
+    int fd_{-1};
+    /** Buffer object handle, zero if none. */
+    uint32_t handle_{};
+};
+
+} // namespace panthor
+} // namespace sampler
+} // namespace hwcnt
+} // namespace device
+} // namespace hwcpipe
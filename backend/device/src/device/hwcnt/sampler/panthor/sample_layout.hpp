@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/** @file sample_layout.hpp */
+
+#pragma once
+
+#include "convert.hpp"
+
+#include <device/hwcnt/block_extents.hpp>
+#include <device/hwcnt/block_metadata.hpp>
+#include <device/hwcnt/clock_extents.hpp>
+#include <device/ioctl/panthor/types.hpp>
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+
+namespace hwcpipe {
+namespace device {
+namespace hwcnt {
+namespace sampler {
+namespace panthor {
+
+/** Number of blocks of every `ioctl::panthor::perf_block_type`, in sample order. */
+inline std::array<uint32_t, 5> num_blocks_in_sample_order(const ioctl::panthor::perf_info &info) {
+    return {info.fw_blocks, info.cshw_blocks, info.tiler_blocks, info.memsys_blocks, info.shader_blocks};
+}
+
+/**
+ * Construct block extents from the performance counters information.
+ *
+ * @param[in] info Performance counters information.
+ * @return Block extents.
+ */
+inline block_extents construct_block_extents(const ioctl::panthor::perf_info &info) {
+    block_extents::num_blocks_of_type_type num_blocks_of_type{};
+
+    const auto num_blocks = num_blocks_in_sample_order(info);
+    for (size_t i = 0; i != num_blocks.size(); ++i) {
+        const auto type = convert(static_cast<ioctl::panthor::perf_block_type>(i));
+        num_blocks_of_type[static_cast<size_t>(type)] = static_cast<uint8_t>(num_blocks[i]);
+    }
+
+    return block_extents{num_blocks_of_type, static_cast<uint16_t>(info.counters_per_block),
+                         sample_values_type::uint64};
+}
+
+/**
+ * Construct clock extents from the performance counters information.
+ *
+ * @param[in] info Performance counters information.
+ * @return Clock extents.
+ */
+inline clock_extents construct_clock_extents(const ioctl::panthor::perf_info &info) {
+    using clock_type = ioctl::panthor::perf_info::clock_type;
+
+    return clock_extents{
+        (info.supported_clocks & static_cast<uint64_t>(clock_type::toplevel)) != 0,
+        (info.supported_clocks & static_cast<uint64_t>(clock_type::shader)) != 0,
+    };
+}
+
+/**
+ * Hardware counters sample memory layout.
+ *
+ * A ring buffer slot holds the sample header, followed by the blocks of every
+ * type, in `ioctl::panthor::perf_block_type` order. A block is a block header
+ * followed by the counter values. The header sizes are reported by the kernel,
+ * so that they can grow without breaking older user space.
+ */
+class sample_layout {
+  public:
+    /** Maximum number of blocks in a sample. */
+    static constexpr size_t max_blocks = 256;
+
+    sample_layout() = default;
+
+    /**
+     * Constructor.
+     *
+     * @param[in] info    Performance counters information.
+     * @param[in] extents Block extents of the blocks to decode. The other blocks are skipped.
+     */
+    sample_layout(const ioctl::panthor::perf_info &info, const block_extents &extents)
+        : block_header_size_(info.block_header_size) {
+        const size_t block_size = info.block_header_size + info.counters_per_block * sizeof(uint64_t);
+
+        size_t offset = info.sample_header_size;
+
+        const auto num_blocks = num_blocks_in_sample_order(info);
+        for (size_t i = 0; i != num_blocks.size(); ++i) {
+            const auto type = convert(static_cast<ioctl::panthor::perf_block_type>(i));
+            const bool enabled = extents.num_blocks_of_type(type) != 0;
+
+            for (uint32_t index = 0; index != num_blocks[i]; ++index, offset += block_size) {
+                if (enabled)
+                    push_back({type, static_cast<uint8_t>(index), offset});
+            }
+        }
+
+        sample_size_ = offset;
+    }
+
+    /** Sample layout entry. */
+    struct entry {
+        /** Block type. */
+        block_type type;
+        /** Block index. */
+        uint8_t index;
+        /** Block header offset from the sample start. */
+        size_t offset;
+    };
+
+    /**
+     * Look up block entry at a given index.
+     *
+     * @param[in] index    Block index.
+     * @return Block entry.
+     */
+    const entry &operator[](size_t index) const { return layout_[index]; }
+
+    /** @return Number of block entries. */
+    size_t size() const { return num_blocks_; }
+
+    /** @return Size of a ring buffer slot. */
+    size_t sample_size() const { return sample_size_; }
+
+    /** @return Size of the block header, that the counter values follow. */
+    size_t block_header_size() const { return block_header_size_; }
+
+  private:
+    void push_back(const entry &value) {
+        assert(num_blocks_ < max_blocks);
+        layout_[num_blocks_++] = value;
+    }
+
+    /** Block entries. */
+    std::array<entry, max_blocks> layout_{};
+    /** Number of block entries. */
+    size_t num_blocks_{};
+    /** Size of a ring buffer slot. */
+    size_t sample_size_{};
+    /** Size of the block header. */
+    size_t block_header_size_{};
+};
+
+} // namespace panthor
+} // namespace sampler
+} // namespace hwcnt
+} // namespace device
+} // namespace hwcpipe
@@ -0,0 +1,290 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/** @file setup.hpp @c panthor::backend setup routine. */
+
+#pragma once
+
+#include "backend_args.hpp"
+#include "convert.hpp"
+#include "dev_query.hpp"
+#include "sample_layout.hpp"
+
+#include <device/hwcnt/sampler/filefd_guard.hpp>
+#include <device/hwcnt/sampler/filter_block_extents.hpp>
+#include <device/hwcnt/sampler/mapped_memory.hpp>
+#include <device/ioctl/panthor/commands.hpp>
+#include <device/ioctl/panthor/types.hpp>
+#include <device/syscall/iface.hpp>
+
+#include <array>
+#include <cstdint>
+#include <system_error>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+
+namespace hwcpipe {
+namespace device {
+namespace hwcnt {
+namespace sampler {
+namespace panthor {
+namespace detail {
+
+/**
+ * Get the number of ring buffer slots.
+ *
+ * @param[in] buffer_count Number of buffers requested, zero for the default.
+ * @return The number of slots, rounded up to a power of two.
+ */
+inline uint32_t sample_slots(uint32_t buffer_count) {
+    using args_type = backend_args<syscall::iface>;
+
+    if (buffer_count == 0)
+        return args_type::default_sample_slots;
+
+    uint32_t result = 1;
+    while (result < buffer_count && result < args_type::max_sample_slots)
+        result <<= 1;
+
+    return result;
+}
+
+/**
+ * Fill the session setup argument from the counters configuration.
+ *
+ * A session samples a single block set, so all the blocks must use the same one.
+ *
+ * @param[in]  begin    Configuration begin.
+ * @param[in]  end      Configuration end.
+ * @param[out] setup    Session setup argument.
+ * @return Error code.
+ */
+inline std::error_code fill_setup(const configuration *begin, const configuration *end,
+                                  ioctl::panthor::perf_cmd_setup &setup) {
+    for (auto it = begin; it != end; ++it) {
+        if (it != begin && it->set != begin->set)
+            return std::make_error_code(std::errc::invalid_argument);
+
+        uint64_t *mask{};
+        switch (it->type) {
+        case block_type::fe:
+            mask = setup.cshw_enable_mask;
+            break;
+        case block_type::tiler:
+            mask = setup.tiler_enable_mask;
+            break;
+        case block_type::memory:
+            mask = setup.memsys_enable_mask;
+            break;
+        case block_type::core:
+            mask = setup.shader_enable_mask;
+            break;
+        case block_type::firmware:
+            mask = setup.fw_enable_mask;
+            break;
+        case block_type::csg:
+        default:
+            return std::make_error_code(std::errc::invalid_argument);
+        }
+
+        const auto enable_mask = convert(it->enable_map);
+        mask[0] = enable_mask[0];
+        mask[1] = enable_mask[1];
+    }
+
+    if (begin != end)
+        setup.block_set = convert(begin->set);
+
+    return {};
+}
+
+/**
+ * Create a buffer object and map it.
+ *
+ * @param[in]  fd       Device file descriptor.
+ * @param[in]  size     Buffer object size.
+ * @param[in]  prot     Memory protection of the mapping.
+ * @param[out] guard    Buffer object handle guard.
+ * @param[out] memory   Buffer object mapping.
+ * @param[in]  iface    Syscall iface (testing only).
+ * @return Error code.
+ */
+template <typename syscall_iface_t>
+inline std::error_code create_mapped_bo(int fd, size_t size, int prot, gem_handle_guard<syscall_iface_t> &guard,
+                                        mapped_memory<syscall_iface_t> &memory, syscall_iface_t &iface) {
+    ioctl::panthor::bo_create create{};
+    create.size = size;
+
+    std::error_code ec;
+    std::tie(ec, std::ignore) = iface.ioctl(fd, ioctl::panthor::command::bo_create, &create);
+    if (ec)
+        return ec;
+
+    guard = gem_handle_guard<syscall_iface_t>{fd, create.handle, iface};
+
+    ioctl::panthor::bo_mmap_offset mmap_offset{};
+    mmap_offset.handle = create.handle;
+    std::tie(ec, std::ignore) = iface.ioctl(fd, ioctl::panthor::command::bo_mmap_offset, &mmap_offset);
+    if (ec)
+        return ec;
+
+    // pre-fault the mapping, so that the first samples read don't take the page faults
+    memory = mapped_memory<syscall_iface_t>{fd, static_cast<off_t>(mmap_offset.offset), size, prot, ec, iface, true};
+
+    return ec;
+}
+
+/**
+ * Init features structure.
+ *
+ * @param[in] info          Performance counters information.
+ * @param[in] sample_slots  Number of ring buffer slots.
+ * @return features structure initialized.
+ */
+inline features init_features(const ioctl::panthor::perf_info &info, uint32_t sample_slots) {
+    const auto clocks = construct_clock_extents(info);
+
+    features result{};
+
+    result.has_gpu_cycle = clocks.has_gpu_cycle();
+    result.has_sc_cycle = clocks.has_sc_cycle();
+    result.has_power_states = true;
+    result.has_vm_states = false;
+    result.has_protection_states = true;
+    result.has_stretched_flag = true;
+    result.overflow_behavior_defined = true;
+    result.buffer_count = sample_slots;
+
+    return result;
+}
+
+} // namespace detail
+
+/**
+ * Setup panthor hardware counters.
+ *
+ * The kernel writes the samples straight into a ring buffer object that is
+ * mapped in user space, and signals an eventfd. The ring buffer is read
+ * without a system call per sample.
+ *
+ * The kernel has no periodic sampling: periodic samplers are not supported,
+ * a manual sampler can be driven with `periodic_driver` instead.
+ *
+ * @param[in]     instance      Mali device instance.
+ * @param[in]     period_ns     Period in nanoseconds between samples taken. Must be zero.
+ * @param[in]     begin         Counters configuration begin iterator.
+ * @param[in]     end           Counters configuration end iterator.
+ * @param[in]     buffer_count  Number of ring buffer slots requested, zero for the default.
+ * @param[in,out] iface         System calls interface to use (unit tests only).
+ *
+ * @return A pair of error code and `backend_args` structure.
+ */
+template <typename instance_t, typename syscall_iface_t = syscall::iface>
+auto setup(const instance_t &instance, uint64_t period_ns, const configuration *begin, const configuration *end,
+           uint32_t buffer_count, syscall_iface_t &&iface = {}) {
+    using syscall_iface_type = std::remove_reference_t<syscall_iface_t>;
+    using args_type = backend_args<syscall_iface_type>;
+    args_type result{};
+    std::error_code ec{};
+
+    if (period_ns != 0)
+        return std::make_pair(std::make_error_code(std::errc::not_supported), std::move(result));
+
+    block_extents extents{};
+    std::tie(ec, extents) = filter_block_extents(instance.get_hwcnt_block_extents(), begin, end);
+    if (ec)
+        return std::make_pair(ec, std::move(result));
+
+    ioctl::panthor::perf_info info{};
+    std::tie(ec, info) = query_perf_info(instance.fd(), iface);
+    if (ec)
+        return std::make_pair(ec, std::move(result));
+
+    ioctl::panthor::perf_cmd_setup setup_arg{};
+    ec = detail::fill_setup(begin, end, setup_arg);
+    if (ec)
+        return std::make_pair(ec, std::move(result));
+
+    int event_fd = -1;
+    std::tie(ec, event_fd) = iface.eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (ec)
+        return std::make_pair(ec, std::move(result));
+
+    filefd_guard<syscall_iface_type> guard_event_fd(event_fd, iface);
+
+    const sample_layout layout{info, extents};
+    const uint32_t sample_slots = detail::sample_slots(buffer_count);
+
+    typename args_type::memory_type ringbuf{};
+    ec = detail::create_mapped_bo(instance.fd(), layout.sample_size() * sample_slots, PROT_READ, result.ringbuf_bo,
+                                  ringbuf, iface);
+    if (ec)
+        return std::make_pair(ec, std::move(result));
+
+    ec = detail::create_mapped_bo(instance.fd(), sizeof(ioctl::panthor::perf_ringbuf_control), PROT_READ | PROT_WRITE,
+                                  result.control_bo, result.control, iface);
+    if (ec)
+        return std::make_pair(ec, std::move(result));
+
+    setup_arg.fd = static_cast<uint32_t>(event_fd);
+    setup_arg.ringbuf_handle = result.ringbuf_bo.get();
+    setup_arg.control_handle = result.control_bo.get();
+    setup_arg.sample_slots = sample_slots;
+    setup_arg.control_offset = 0;
+
+    ioctl::panthor::perf_control control{};
+    control.cmd = ioctl::panthor::perf_control::command::setup;
+    control.size = sizeof(setup_arg);
+    control.pointer.reset(&setup_arg);
+
+    int session = -1;
+    std::tie(ec, session) = iface.ioctl(instance.fd(), ioctl::panthor::command::perf_control, &control);
+    if (ec)
+        return std::make_pair(ec, std::move(result));
+
+    result.base_args.fd = std::move(guard_event_fd);
+    result.base_args.period_ns = period_ns;
+    result.base_args.features_v = detail::init_features(info, sample_slots);
+    result.base_args.extents = extents;
+    result.base_args.memory = std::move(ringbuf);
+
+    result.device_fd = instance.fd();
+    result.session = static_cast<uint32_t>(session);
+    result.sample_slots = sample_slots;
+    if (begin != end)
+        result.set = begin->set;
+    result.sample_layout_v = layout;
+
+    return std::make_pair(ec, std::move(result));
+}
+
+} // namespace panthor
+} // namespace sampler
+} // namespace hwcnt
+} // namespace device
+} // namespace hwcpipe
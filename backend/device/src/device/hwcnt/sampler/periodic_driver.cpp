@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#include <device/hwcnt/sampler/manual.hpp>
+#include <device/hwcnt/sampler/periodic_driver.hpp>
+#include <device/syscall/iface.hpp>
+
+#include <tuple>
+
+#include <sys/timerfd.h>
+#include <time.h>
+
+namespace hwcpipe {
+namespace device {
+namespace hwcnt {
+namespace sampler {
+
+namespace {
+
+constexpr uint64_t nsec_per_sec = 1000000000;
+
+/** @return The monotonic clock that the timer deadlines are measured with, in nanoseconds. */
+uint64_t monotonic_now() {
+    timespec now{};
+    ::clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return static_cast<uint64_t>(now.tv_sec) * nsec_per_sec + static_cast<uint64_t>(now.tv_nsec);
+}
+
+/**
+ * Convert nanoseconds to a timespec.
+ *
+ * @param[in] ns    Time in nanoseconds.
+ * @return The timespec.
+ */
+timespec to_timespec(uint64_t ns) {
+    timespec result{};
+    result.tv_sec = static_cast<time_t>(ns / nsec_per_sec);
+    result.tv_nsec = static_cast<long>(ns % nsec_per_sec);
+    return result;
+}
+
+} // namespace
+
+periodic_driver::periodic_driver(manual &sampler, uint64_t period_ns)
+    : sampler_(sampler)
+    , period_ns_(period_ns)
+    , timer_fd_(-1)
+    , first_deadline_ns_(0)
+    , first_tick_(0)
+    , num_deadlines_(0) {
+    if (period_ns == 0)
+        return;
+
+    std::tie(std::ignore, timer_fd_) = syscall::iface{}.timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC);
+}
+
+periodic_driver::~periodic_driver() {
+    if (timer_fd_ >= 0)
+        syscall::iface{}.close(timer_fd_);
+}
+
+std::error_code periodic_driver::start() {
+    first_deadline_ns_ = monotonic_now() + period_ns_;
+    first_tick_ = 0;
+    num_deadlines_ = 0;
+
+    struct itimerspec value {};
+    value.it_value = to_timespec(first_deadline_ns_);
+    value.it_interval = to_timespec(period_ns_);
+
+    return syscall::iface{}.timerfd_settime(timer_fd_, TFD_TIMER_ABSTIME, &value);
+}
+
+std::error_code periodic_driver::stop() {
+    struct itimerspec value {};
+    first_deadline_ns_ = 0;
+
+    return syscall::iface{}.timerfd_settime(timer_fd_, 0, &value);
+}
+
+std::error_code periodic_driver::set_period(uint64_t period_ns) {
+    if (period_ns == 0)
+        return std::make_error_code(std::errc::invalid_argument);
+
+    if (first_deadline_ns_ == 0) {
+        period_ns_ = period_ns;
+        return {};
+    }
+
+    // the last deadline that passed, or the start of the timer
+    const uint64_t last_deadline_ns = first_deadline_ns_ + (num_deadlines_ - first_tick_) * period_ns_ - period_ns_;
+
+    period_ns_ = period_ns;
+    first_deadline_ns_ = last_deadline_ns + period_ns_;
+    first_tick_ = num_deadlines_;
+
+    struct itimerspec value {};
+    value.it_value = to_timespec(first_deadline_ns_);
+    value.it_interval = to_timespec(period_ns_);
+
+    return syscall::iface{}.timerfd_settime(timer_fd_, TFD_TIMER_ABSTIME, &value);
+}
+
+std::error_code periodic_driver::wait_and_request(tick_info &tick) {
+    uint64_t expirations{};
+    std::error_code ec;
+
+    do {
+        std::tie(ec, std::ignore) = syscall::iface{}.read(timer_fd_, &expirations, sizeof(expirations));
+    } while (ec == std::errc::interrupted);
+
+    if (ec)
+        return ec;
+
+    num_deadlines_ += expirations;
+
+    tick.tick = num_deadlines_ - 1;
+    tick.missed = expirations - 1;
+
+    ec = sampler_.request_sample_async(tick.tick);
+
+    const uint64_t deadline_ns = first_deadline_ns_ + (tick.tick - first_tick_) * period_ns_;
+    const uint64_t now = monotonic_now();
+    tick.lateness_ns = now > deadline_ns ? now - deadline_ns : 0;
+
+    return ec;
+}
+
+} // namespace sampler
+} // namespace hwcnt
+} // namespace device
+} // namespace hwcpipe
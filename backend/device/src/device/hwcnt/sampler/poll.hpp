@@ -24,6 +24,9 @@
 
 #pragma once
 
+#include <algorithm>
+#include <climits>
+#include <cstdint>
 #include <system_error>
 #include <tuple>
 
@@ -60,6 +63,18 @@ inline auto poll_fd(int fd, int timeout, syscall_iface_t &&iface = {}) {
 
     return std::make_pair(ec, nelems == num_fds);
 }
+
+/**
+ * Convert a timeout to a poll() timeout.
+ *
+ * @param[in] timeout_ns Timeout in nanoseconds.
+ * @return The timeout in milliseconds, rounded up so that poll() doesn't return early.
+ */
+inline int to_poll_timeout(uint64_t timeout_ns) {
+    static constexpr uint64_t nsec_per_msec = 1000000;
+
+    return static_cast<int>(std::min<uint64_t>((timeout_ns + nsec_per_msec - 1) / nsec_per_msec, INT_MAX));
+}
 } // namespace detail
 
 /**
@@ -87,6 +102,19 @@ inline std::error_code wait_for_sample(int fd, syscall_iface_t &&iface = {}) {
     return {};
 }
 
+/**
+ * Wait for hardware counters sample, with a timeout.
+ *
+ * @param[in] fd         Hardware counters file descriptor.
+ * @param[in] timeout_ns Timeout in nanoseconds, rounded up to milliseconds.
+ * @param[in] iface      Syscall iface (testing only).
+ * @return A pair of error code and boolean. The boolean is `true` if @p fd is ready.
+ */
+template <typename syscall_iface_t>
+inline auto wait_ready_read(int fd, uint64_t timeout_ns, syscall_iface_t &&iface = {}) {
+    return detail::poll_fd(fd, detail::to_poll_timeout(timeout_ns), std::forward<syscall_iface_t>(iface));
+}
+
 /**
  * Check if a sample is ready to be read.
  *
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/**
+ * @file spsc_queue.hpp
+ *
+ * Fixed size single producer, single consumer ring buffer queue class.
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+
+namespace hwcpipe {
+namespace device {
+namespace hwcnt {
+namespace sampler {
+
+/**
+ * Fixed size ring buffer queue, that one producer thread and one consumer
+ * thread can use concurrently without locking.
+ *
+ * Unlike `queue`, the producer writes an element in place with `prepare()`,
+ * and only makes it visible to the consumer with `commit()`. This lets the
+ * producer publish an element only once the operation it describes succeeded.
+ *
+ * The producer functions are `full`, `prepare`, `commit`, `push`, `back`
+ * and `push_count`. The consumer functions are `empty`, `front`, `pop` and
+ * `pop_count`.
+ *
+ * @warning `size_v` must be a power of two.
+ */
+template <typename value_t, size_t size_v>
+class spsc_queue {
+  public:
+    /** Value type. */
+    using value_type = value_t;
+
+    /** Maximum size this queue can store. */
+    static constexpr size_t max_size_value = size_v;
+
+    /** @return true if queue is full, false otherwise (producer only). */
+    bool full() const {
+        return push_idx_.load(std::memory_order_relaxed) - pop_idx_.load(std::memory_order_acquire) ==
+               max_size_value;
+    }
+
+    /**
+     * Get the element that the next commit() publishes (producer only).
+     *
+     * @return Reference to the unpublished element.
+     */
+    value_type &prepare() {
+        assert(!full());
+
+        return elements_[push_idx_.load(std::memory_order_relaxed) % max_size_value];
+    }
+
+    /** Publish the element returned by prepare() (producer only). */
+    void commit() { push_idx_.store(push_idx_.load(std::memory_order_relaxed) + 1, std::memory_order_release); }
+
+    /**
+     * Push value to the queue (producer only).
+     *
+     * @param[in] value Value to push to the queue.
+     */
+    void push(const value_type &value) {
+        prepare() = value;
+        commit();
+    }
+
+    /** @return Last published element reference (producer only). */
+    value_type &back() {
+        const auto push_idx = push_idx_.load(std::memory_order_relaxed);
+        assert(push_idx != pop_idx_.load(std::memory_order_acquire));
+
+        return elements_[(push_idx - 1) % max_size_value];
+    }
+
+    /** @return Number of elements published (producer only). */
+    uint64_t push_count() const { return push_idx_.load(std::memory_order_relaxed); }
+
+    /** @return true if queue is empty, false otherwise (consumer only). */
+    bool empty() const {
+        return push_idx_.load(std::memory_order_acquire) == pop_idx_.load(std::memory_order_relaxed);
+    }
+
+    /** @return Front element reference (consumer only). */
+    value_type &front() {
+        assert(!empty());
+
+        return elements_[pop_idx_.load(std::memory_order_relaxed) % max_size_value];
+    }
+
+    /** @return element popped from the queue (consumer only). */
+    value_type pop() {
+        const auto result = front();
+
+        pop_idx_.store(pop_idx_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+
+        return result;
+    }
+
+    /** @return Number of times pop() was called (consumer only). */
+    uint64_t pop_count() const { return pop_idx_.load(std::memory_order_relaxed); }
+
+  private:
+    /** Push index, written by the producer. */
+    std::atomic<uint32_t> push_idx_{};
+    /** Pop index, written by the consumer. */
+    std::atomic<uint32_t> pop_idx_{};
+    /** Queue elements. */
+    std::array<value_t, max_size_value> elements_{};
+};
+
+} // namespace sampler
+} // namespace hwcnt
+} // namespace device
+} // namespace hwcpipe
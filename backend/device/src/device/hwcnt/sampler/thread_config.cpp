@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#include <device/hwcnt/sampler/thread_config.hpp>
+#include <device/syscall/iface.hpp>
+
+#include <cstddef>
+
+#include <sched.h>
+#include <sys/resource.h>
+
+namespace hwcpipe {
+namespace device {
+namespace hwcnt {
+namespace sampler {
+
+namespace {
+
+/**
+ * Get the policy of a scheduling class.
+ *
+ * @param[in] policy    Scheduling class, other than @ref sched_class::inherit.
+ * @return The `sched_setscheduler` policy.
+ */
+int to_sched_policy(sched_class policy) {
+    switch (policy) {
+    case sched_class::batch:
+        return SCHED_BATCH;
+    case sched_class::idle:
+        return SCHED_IDLE;
+    case sched_class::fifo:
+        return SCHED_FIFO;
+    case sched_class::round_robin:
+        return SCHED_RR;
+    case sched_class::inherit:
+    case sched_class::other:
+    default:
+        return SCHED_OTHER;
+    }
+}
+
+/** @return True if @p policy is a real-time class. */
+bool is_real_time(sched_class policy) { return policy == sched_class::fifo || policy == sched_class::round_robin; }
+
+} // namespace
+
+std::error_code apply_thread_config(const thread_config &config) {
+    if (config.policy != sched_class::inherit) {
+        struct sched_param param {};
+        param.sched_priority = is_real_time(config.policy) ? config.priority : 0;
+
+        const std::error_code ec = syscall::iface{}.sched_setscheduler(0, to_sched_policy(config.policy), &param);
+
+        if (ec)
+            return ec;
+    }
+
+    if (!is_real_time(config.policy) && config.priority != 0) {
+        const std::error_code ec = syscall::iface{}.setpriority(PRIO_PROCESS, 0, config.priority);
+
+        if (ec)
+            return ec;
+    }
+
+    if (config.cpu_mask != 0) {
+        cpu_set_t mask;
+        CPU_ZERO(&mask);
+
+        for (size_t cpu = 0; cpu < 64; ++cpu) {
+            if ((config.cpu_mask >> cpu) & 1U)
+                CPU_SET(cpu, &mask);
+        }
+
+        return syscall::iface{}.sched_setaffinity(0, sizeof(mask), &mask);
+    }
+
+    return {};
+}
+
+} // namespace sampler
+} // namespace hwcnt
+} // namespace device
+} // namespace hwcpipe
@@ -41,14 +41,17 @@
 #include <device/hwcnt/sampler/detail/backend.hpp>
 #include <device/hwcnt/sampler/discard_impl.hpp>
 #include <device/hwcnt/sampler/poll.hpp>
-#include <device/hwcnt/sampler/queue.hpp>
+#include <device/hwcnt/sampler/spsc_queue.hpp>
 #include <device/hwcnt/sampler/timestamp.hpp>
 #include <device/ioctl/offset_pointer.hpp>
 #include <device/ioctl/vinstr/commands.hpp>
 #include <device/ioctl/vinstr/types.hpp>
+#include <device/tracepoint.hpp>
 
+#include <algorithm>
 #include <cstring>
 #include <mutex>
+#include <thread>
 #include <tuple>
 
 namespace hwcpipe {
@@ -116,12 +119,17 @@ class backend : public base::backend<syscall_iface_t>, private timestamp_iface_t
             sampling_ = false;
         }
 
+        /* The stop is tracked before its sample is requested, as the reader
+         * thread may get the sample before request_sample_no_lock returns.
+         */
+        auto &session = sessions_.back();
+        session.stop(user_data_manual_.push_count() + 1);
+
         ec = request_sample_no_lock(user_data);
-        if (ec)
+        if (ec) {
+            session.cancel_stop();
             return ec;
-
-        const auto stop_sample_nr = user_data_manual_.push_count();
-        sessions_.back().stop(stop_sample_nr);
+        }
 
         active_ = false;
         return {};
@@ -131,57 +139,39 @@ class backend : public base::backend<syscall_iface_t>, private timestamp_iface_t
         if (sampler_type() != base_type::sampler_type::manual)
             return std::make_error_code(std::errc::invalid_argument);
 
+        const tracepoint_timer timer{};
         std::lock_guard<std::mutex> lock(access_);
 
-        return request_sample_no_lock(user_data);
+        const auto ec = request_sample_no_lock(user_data);
+        HWCPIPE_TRACEPOINT(request_sample, 0, user_data, timer.elapsed_ns());
+        return ec;
     }
 
     std::error_code get_sample(sample_metadata &sm, sample_handle &sample_hndl) override {
+        const tracepoint_timer timer{};
         std::error_code ec = wait_for_sample(fd_, get_syscall_iface());
 
         if (ec)
             return ec;
 
-        ioctl::vinstr::reader_metadata_with_cycles metadata{};
+        ec = get_ready_sample(sm, sample_hndl);
 
-        if (!!features_) {
-            std::tie(ec, std::ignore) =
-                get_syscall_iface().ioctl(fd_, ioctl::vinstr::command::get_buffer_with_cycles, &metadata);
-        } else {
-            std::tie(ec, std::ignore) =
-                get_syscall_iface().ioctl(fd_, ioctl::vinstr::command::get_buffer, &metadata.metadata);
-        }
-
-        if (ec)
-            return ec;
-
-        {
-            const auto is_manual_sample = metadata.metadata.event_id == ioctl::vinstr::reader_event::manual;
-
-            std::lock_guard<std::mutex> guard(access_);
+        if (!ec)
+            HWCPIPE_TRACEPOINT(get_sample, sm.sample_nr, sm.user_data, timer.elapsed_ns());
 
-            auto &session = sessions_.front();
-
-            if (is_manual_sample)
-                sm.user_data = user_data_manual_.pop();
-            else
-                sm.user_data = session.user_data_periodic();
-
-            sm.flags = sample_flags{};
-
-            sm.sample_nr = sample_nr_alloc_++;
+        return ec;
+    }
 
-            sm.timestamp_ns_begin = session.update_ts(metadata.metadata.timestamp);
+    std::error_code get_ready_sample(sample_metadata &sm, sample_handle &sample_hndl) override {
+        const tracepoint_timer timer{};
+        ioctl::vinstr::reader_metadata_with_cycles metadata{};
 
-            if (is_manual_sample) {
-                const auto manual_sample_nr = user_data_manual_.pop_count();
+        std::error_code ec = take_buffer(sm, metadata);
 
-                if (session.can_erase(manual_sample_nr))
-                    sessions_.pop();
-            }
-        }
+        if (ec)
+            return ec;
 
-        sm.timestamp_ns_end = metadata.metadata.timestamp;
+        sm.backlog = estimate_backlog(get_ts_iface().clock_gettime(), sm.timestamp_ns_end);
 
         if (!!(features_ & reader_features_type::cycles_top))
             sm.gpu_cycle = metadata.cycles.top;
@@ -194,9 +184,36 @@ class backend : public base::backend<syscall_iface_t>, private timestamp_iface_t
 
         sample_hndl.get<sample_handle_type>() = metadata.metadata;
 
+        last_sample_.assign(sm);
+        HWCPIPE_TRACEPOINT(sample_ready, sm.sample_nr, sm.user_data, timer.elapsed_ns());
+
         return {};
     }
 
+    /**
+     * Take the oldest ready sample and put it back, without estimating its backlog
+     * or decoding its cycles.
+     *
+     * @param[out] timestamp_ns_end    End timestamp of the discarded sample.
+     * @return Error code.
+     */
+    std::error_code discard_ready_sample(uint64_t &timestamp_ns_end) {
+        sample_metadata sm{};
+        ioctl::vinstr::reader_metadata_with_cycles metadata{};
+
+        std::error_code ec = take_buffer(sm, metadata);
+
+        if (ec)
+            return ec;
+
+        timestamp_ns_end = sm.timestamp_ns_end;
+
+        std::tie(ec, std::ignore) =
+            get_syscall_iface().ioctl(fd_, ioctl::vinstr::command::put_buffer, &metadata.metadata);
+
+        return ec;
+    }
+
     bool next(sample_handle sample_hndl_raw, block_metadata &bm, block_handle &block_hndl_raw) const override {
         auto &sample_hndl = sample_hndl_raw.get<sample_handle_type>();
         auto &block_index = block_hndl_raw.get<size_t>();
@@ -221,13 +238,36 @@ class backend : public base::backend<syscall_iface_t>, private timestamp_iface_t
         return true;
     }
 
+    size_t get_blocks(sample_handle sample_hndl_raw, block_metadata *blocks, size_t capacity) const override {
+        const auto &sample_hndl = sample_hndl_raw.get<sample_handle_type>();
+
+        /* Every block is at a fixed offset of the sample buffer. */
+        const auto *sample_begin = static_cast<const uint8_t *>(memory_.data()) + buffer_size_ * sample_hndl.buffer_idx;
+        const size_t count = std::min(capacity, sample_layout_.size());
+
+        for (size_t i = 0; i != count; ++i) {
+            const auto &layout_entry = sample_layout_[i];
+
+            blocks[i].type = layout_entry.type;
+            blocks[i].index = layout_entry.index;
+            blocks[i].set = prfcnt_set::primary;
+            blocks[i].state = {};
+            blocks[i].values = sample_begin + layout_entry.offset;
+        }
+
+        return count;
+    }
+
     std::error_code put_sample(sample_handle sample_hndl_raw) override {
+        const tracepoint_timer timer{};
         std::error_code ec;
 
         auto &sample_hndl = sample_hndl_raw.get<sample_handle_type>();
 
         std::tie(ec, std::ignore) = get_syscall_iface().ioctl(fd_, ioctl::vinstr::command::put_buffer, &sample_hndl);
 
+        HWCPIPE_TRACEPOINT(put_sample, last_sample_.sample_nr(), last_sample_.user_data(), timer.elapsed_ns());
+
         return ec;
     }
 
@@ -236,6 +276,7 @@ class backend : public base::backend<syscall_iface_t>, private timestamp_iface_t
   private:
     using base_type = base::backend<syscall_iface_t>;
     using base_type::block_extents_;
+    using base_type::estimate_backlog;
     using base_type::fd_;
     using base_type::get_syscall_iface;
     using base_type::memory_;
@@ -245,6 +286,8 @@ class backend : public base::backend<syscall_iface_t>, private timestamp_iface_t
     /**
      * Request manual sample dump.
      *
+     * The user data is committed to `user_data_manual_` once the dump is requested.
+     *
      * @pre `access_` must be locked.
      *
      * @param[in] user_data    User data.
@@ -254,17 +297,79 @@ class backend : public base::backend<syscall_iface_t>, private timestamp_iface_t
         if (!active_)
             return std::make_error_code(std::errc::invalid_argument);
 
+        if (user_data_manual_.full())
+            return std::make_error_code(std::errc::operation_not_permitted);
+
+        user_data_manual_.prepare() = user_data;
+
         std::error_code ec;
         std::tie(ec, std::ignore) = get_syscall_iface().ioctl(fd_, ioctl::vinstr::command::dump, 0);
 
         if (ec)
             return ec;
 
-        user_data_manual_.push(user_data);
+        user_data_manual_.commit();
 
         return ec;
     }
 
+    /**
+     * Take the oldest ready buffer and account for it in the sessions.
+     *
+     * Fills the user data, the sample number and the timestamps of @p sm.
+     *
+     * @param[out] sm          Sample metadata.
+     * @param[out] metadata    Buffer metadata, with the cycles if the reader has the features.
+     * @return Error code.
+     */
+    std::error_code take_buffer(sample_metadata &sm, ioctl::vinstr::reader_metadata_with_cycles &metadata) {
+        std::error_code ec;
+
+        if (!!features_) {
+            std::tie(ec, std::ignore) =
+                get_syscall_iface().ioctl(fd_, ioctl::vinstr::command::get_buffer_with_cycles, &metadata);
+        } else {
+            std::tie(ec, std::ignore) =
+                get_syscall_iface().ioctl(fd_, ioctl::vinstr::command::get_buffer, &metadata.metadata);
+        }
+
+        if (ec)
+            return ec;
+
+        const auto is_manual_sample = metadata.metadata.event_id == ioctl::vinstr::reader_event::manual;
+
+        /* The sessions and the manual samples user data are single producer,
+         * single consumer queues, so the reader thread does not lock `access_`.
+         */
+        auto &session = sessions_.front();
+
+        if (is_manual_sample) {
+            /* The sample can be ready before its user data is committed. */
+            while (user_data_manual_.empty())
+                std::this_thread::yield();
+
+            sm.user_data = user_data_manual_.pop();
+        } else {
+            sm.user_data = session.user_data_periodic();
+        }
+
+        sm.flags = sample_flags{};
+
+        sm.sample_nr = sample_nr_alloc_++;
+
+        sm.timestamp_ns_begin = session.update_ts(metadata.metadata.timestamp);
+        sm.timestamp_ns_end = metadata.metadata.timestamp;
+
+        if (is_manual_sample) {
+            const auto manual_sample_nr = user_data_manual_.pop_count();
+
+            if (session.can_erase(manual_sample_nr))
+                sessions_.pop();
+        }
+
+        return {};
+    }
+
     /**
      * Clear hardware counters values.
      *
@@ -288,14 +393,14 @@ class backend : public base::backend<syscall_iface_t>, private timestamp_iface_t
     const reader_features_type features_;
     /** Hardware counters buffer size. */
     const size_t buffer_size_;
-    /** Mutex protecting access to the active flag. */
+    /** Mutex serializing the start, stop and request calls. The reader thread does not lock it. */
     std::mutex access_;
     /** Sampler state. */
     bool active_{};
     /** True if sampling thread is running. */
     bool sampling_{};
     /** User data for manual samples. */
-    queue<uint64_t, args_type::max_buffer_count> user_data_manual_{};
+    spsc_queue<uint64_t, args_type::max_buffer_count> user_data_manual_{};
     /** Maximum profiling sessions being tracked at a time.
      *
      * Every session stop() results into a manual sample. There could be at most
@@ -306,11 +411,13 @@ class backend : public base::backend<syscall_iface_t>, private timestamp_iface_t
      */
     static constexpr size_t max_sessions = args_type::max_buffer_count * 2;
     /** Profiling session states. */
-    queue<session, max_sessions> sessions_;
+    spsc_queue<session, max_sessions> sessions_;
     /** Counter to allocate values for sample_metadata::sample_nr. */
     uint64_t sample_nr_alloc_{};
     /** Sample layout data structure. */
     sample_layout sample_layout_;
+    /** The last sample handed out, for the put_sample tracepoint. */
+    tracepoint_sample last_sample_;
 };
 
 } // namespace vinstr
@@ -30,8 +30,10 @@
 
 #pragma once
 
+#include <atomic>
 #include <cassert>
 #include <cstdint>
+#include <limits>
 #include <utility>
 
 namespace hwcpipe {
@@ -40,7 +42,14 @@ namespace hwcnt {
 namespace sampler {
 namespace vinstr {
 
-/** Vinstr profiling session state class. */
+/**
+ * Vinstr profiling session state class.
+ *
+ * The session is created and stopped by the thread that starts and stops the
+ * sampler, while the reader thread updates its timestamp and checks whether it
+ * can be erased. The stop state is atomic, so that these threads don't need to
+ * share a lock.
+ */
 class session {
   public:
     /** Default constructor. */
@@ -56,10 +65,19 @@ class session {
         : last_ts_ns_(start_ts_ns)
         , user_data_periodic_(user_data_periodic) {}
 
-    /** Default copy constructor. */
-    session(const session &) = default;
-    /** Default assignment operator. */
-    session &operator=(const session &) = default;
+    /** Copy constructor. */
+    session(const session &other)
+        : last_ts_ns_(other.last_ts_ns_)
+        , user_data_periodic_(other.user_data_periodic_)
+        , stop_sample_nr_(other.stop_sample_nr_.load(std::memory_order_relaxed)) {}
+
+    /** Assignment operator. */
+    session &operator=(const session &other) {
+        last_ts_ns_ = other.last_ts_ns_;
+        user_data_periodic_ = other.user_data_periodic_;
+        stop_sample_nr_.store(other.stop_sample_nr_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        return *this;
+    }
 
     /**
      * Update last timestamp.
@@ -79,13 +97,16 @@ class session {
     /**
      * Track session stop.
      *
+     * Must be called before the manual sample of the stop is requested, so that
+     * the reader thread sees the stop when it gets this sample.
+     *
      * @param[in] stop_sample_nr    Number of the manual sample that corresponds to
      *                              this session stop.
      */
-    void stop(uint64_t stop_sample_nr) {
-        pending_stop_ = true;
-        stop_sample_nr_ = stop_sample_nr;
-    }
+    void stop(uint64_t stop_sample_nr) { stop_sample_nr_.store(stop_sample_nr, std::memory_order_release); }
+
+    /** Cancel a session stop, when its manual sample could not be requested. */
+    void cancel_stop() { stop_sample_nr_.store(no_stop, std::memory_order_release); }
 
     /**
      * Check if this session state can be erased.
@@ -94,10 +115,11 @@ class session {
      * @return if this session can be removed.
      */
     bool can_erase(uint64_t manual_sample_nr) const {
-        if (!pending_stop_)
+        const auto stop_sample_nr = stop_sample_nr_.load(std::memory_order_acquire);
+        if (stop_sample_nr == no_stop)
             return false;
 
-        return manual_sample_nr == stop_sample_nr_;
+        return manual_sample_nr == stop_sample_nr;
     }
 
   private:
@@ -105,14 +127,12 @@ class session {
     uint64_t last_ts_ns_{};
     /** User data for periodic samples of this session. */
     uint64_t user_data_periodic_{};
-    /** True stop() was called for this session, but some samples
-     * might not have been parsed yet.
-     */
-    bool pending_stop_{};
-    /** Number of the manual sample that was taken when this
-     * session was stopped.
+    /** Value of `stop_sample_nr_` while the session is not stopped. */
+    static constexpr uint64_t no_stop = std::numeric_limits<uint64_t>::max();
+    /** Number of the manual sample that was taken when this session was stopped,
+     * or `no_stop`. Once set, some samples might not have been parsed yet.
      */
-    uint64_t stop_sample_nr_{};
+    std::atomic<uint64_t> stop_sample_nr_{no_stop};
 };
 
 } // namespace vinstr
@@ -63,6 +63,25 @@ inline auto init_features(ioctl::vinstr::reader_features reader_features) {
     return result;
 }
 
+/**
+ * Get the number of buffers to try first.
+ *
+ * @param[in] requested    Number of buffers requested, zero for @p max_count.
+ * @param[in] max_count    Most buffers that vinstr allows.
+ * @return The largest power of two, at least two, that is not above @p requested and @p max_count.
+ */
+inline uint32_t initial_buffer_count(uint32_t requested, size_t max_count) {
+    const auto limit = static_cast<uint32_t>(max_count);
+    if (requested == 0 || requested > limit)
+        requested = limit;
+
+    uint32_t result = 2;
+    while (result * 2 <= requested)
+        result *= 2;
+
+    return result;
+}
+
 /**
  * Setup hardware counters reader handle.
  *
@@ -112,13 +131,15 @@ inline auto reader_setup(const instance_t &instance, ioctl::kbase::hwcnt_reader_
  * @param[in]     period_ns    Period in nanoseconds between samples taken. Zero for manual context.
  * @param[in]     begin        Counters configuration begin iterator.
  * @param[in]     end          Counters configuration end iterator.
+ * @param[in]     buffer_count Number of buffers requested, zero for `backend_args::max_buffer_count`. It is
+ *                             rounded down to a power of two between 2 and `backend_args::max_buffer_count`.
  * @param[in,out] iface        System calls interface to use (unit tests only).
  *
  * @return A pair of error code and `backend_args` structure.
  */
 template <typename instance_t, typename syscall_iface_t = syscall::iface>
 auto setup(const instance_t &instance, uint64_t period_ns, const configuration *begin, const configuration *end,
-           syscall_iface_t &&iface = {}) {
+           uint32_t buffer_count = 0, syscall_iface_t &&iface = {}) {
     std::error_code ec;
 
     using syscall_iface_type = std::remove_reference_t<syscall_iface_t>;
@@ -137,11 +158,11 @@ auto setup(const instance_t &instance, uint64_t period_ns, const configuration *
     if (ec)
         return std::make_pair(ec, std::move(result));
 
-    setup_args.buffer_count = backend_args_type::max_buffer_count;
+    setup_args.buffer_count = detail::initial_buffer_count(buffer_count, backend_args_type::max_buffer_count);
 
     int vinstr_fd = -1;
 
-    /* Try to initialize vinstr reader with `max_buffer_count` buffers or fewer. */
+    /* Try to initialize vinstr reader with the requested number of buffers or fewer. */
     for (; setup_args.buffer_count > 1; setup_args.buffer_count >>= 1) {
         std::tie(ec, vinstr_fd) = detail::reader_setup(instance, setup_args, iface);
 
@@ -175,7 +196,8 @@ auto setup(const instance_t &instance, uint64_t period_ns, const configuration *
         return std::make_pair(ec, std::move(result));
 
     const size_t mapping_size = buffer_size * static_cast<size_t>(setup_args.buffer_count);
-    typename backend_args_type::memory_type memory{vinstr_fd, mapping_size, ec, iface};
+    // pre-fault the dump buffers, so that the first samples read don't take the page faults
+    typename backend_args_type::memory_type memory{vinstr_fd, mapping_size, ec, iface, true};
 
     if (ec)
         return std::make_pair(ec, std::move(result));
@@ -189,6 +211,7 @@ auto setup(const instance_t &instance, uint64_t period_ns, const configuration *
     result.base_args.fd = std::move(vinstr_fd_guard);
     result.base_args.period_ns = period_ns;
     result.base_args.features_v = detail::init_features(api_version.features);
+    result.base_args.features_v.buffer_count = setup_args.buffer_count;
     result.base_args.extents = extents;
     result.base_args.memory = std::move(memory);
 
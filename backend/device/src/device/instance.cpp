@@ -30,10 +30,12 @@
 
 #include "handle_impl.hpp"
 #include "instance_impl.hpp"
+#include "probe_cache.hpp"
 #include "syscall/iface.hpp"
 
 #include <device/detail/cast_to_impl.hpp>
 
+#include <cstdlib>
 #include <memory>
 
 #include <sys/stat.h>
@@ -49,7 +51,8 @@ instance::~instance() = default;
 instance::instance_ptr instance::create(handle &hndl) {
     const auto &hndl_impl = detail::cast_to_impl(hndl);
 
-    auto result = std::make_unique<instance_impl_type>(hndl_impl.fd());
+    auto result =
+        std::make_unique<instance_impl_type>(hndl_impl.fd(), syscall::iface{}, std::getenv(probe_cache_env_var));
     if (!result || !result->valid())
         return {};
 
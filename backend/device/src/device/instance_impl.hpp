@@ -26,6 +26,7 @@
 
 #include "ioctl/kbase_pre_r21/types.hpp"
 #include "kbase_version.hpp"
+#include "probe_cache.hpp"
 
 #include <device/constants.hpp>
 #include <device/hwcnt/backend_type.hpp>
@@ -35,21 +36,27 @@
 #include <device/hwcnt/sampler/kinstr_prfcnt/construct_clock_extents.hpp>
 #include <device/hwcnt/sampler/kinstr_prfcnt/enum_info_parser.hpp>
 #include <device/hwcnt/sampler/manual.hpp>
+#include <device/hwcnt/sampler/panthor/dev_query.hpp>
+#include <device/hwcnt/sampler/panthor/sample_layout.hpp>
 #include <device/hwcnt/sampler/vinstr/construct_block_extents.hpp>
 #include <device/instance.hpp>
 #include <device/ioctl/kbase/commands.hpp>
 #include <device/ioctl/kbase/types.hpp>
 #include <device/ioctl/kbase_pre_r21/commands.hpp>
 #include <device/ioctl/kbase_pre_r21/types.hpp>
+#include <device/ioctl/panthor/commands.hpp>
+#include <device/ioctl/panthor/types.hpp>
 #include <device/ioctl/pointer64.hpp>
 #include <device/kbase_version.hpp>
 #include <device/num_exec_engines.hpp>
 #include <device/product_id.hpp>
 
+#include <algorithm>
 #include <array>
 #include <cinttypes>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <system_error>
 #include <vector>
 
@@ -332,10 +339,17 @@ class instance_impl : public instance, private syscall_iface_t {
     using kbase_version_type = ::hwcpipe::device::kbase_version;
 
   public:
-    instance_impl(int fd, const syscall_iface_t &iface = {})
+    /**
+     * Constructor.
+     *
+     * @param[in] fd          Device file descriptor.
+     * @param[in] iface       Syscall iface.
+     * @param[in] cache_path  Probe cache file path, nullptr to always probe the device.
+     */
+    instance_impl(int fd, const syscall_iface_t &iface = {}, const char *cache_path = nullptr)
         : syscall_iface_t(iface)
         , fd_(fd) {
-        std::error_code ec = init(iface);
+        std::error_code ec = init(iface, probe_cache{cache_path});
         valid_ = !ec;
     }
 
@@ -358,6 +372,8 @@ class instance_impl : public instance, private syscall_iface_t {
         return clock_extents_;
     }
 
+    const char *get_hwcnt_backend_name() const override { return hwcnt::backend_type_to_str(backend_type_); }
+
     hwcnt::sampler::kinstr_prfcnt::enum_info get_enum_info() const {
         /* The enum info must have been initialized. */
         assert(ei_.num_values != 0);
@@ -429,6 +445,45 @@ class instance_impl : public instance, private syscall_iface_t {
         return {dev_consts, known_pid};
     }
 
+    /** Get device constants from the panthor GPU information query. */
+    std::tuple<constants, product_id> props_panthor(int fd, std::error_code &ec) {
+        constants dev_consts{};
+        product_id known_pid{};
+
+        ioctl::panthor::gpu_info info{};
+        std::tie(ec, info) = hwcnt::sampler::panthor::query_gpu_info(fd, get_syscall_iface());
+        if (ec)
+            return std::make_pair<constants, product_id>({}, product_id{});
+
+        dev_consts.gpu_id = info.gpu_id;
+        std::tie(ec, known_pid) = product_id_from_raw_gpu_id(dev_consts.gpu_id);
+        if (ec)
+            return std::make_pair<constants, product_id>({}, product_id{});
+        dev_consts.warp_width = detail::get_warp_width(known_pid, ec);
+        if (ec)
+            return std::make_pair<constants, product_id>({}, product_id{});
+
+        /* Same registers fields as the kbase L2 properties are decoded from. */
+        dev_consts.l2_slice_size = 1UL << ((info.l2_features & 0xFF0000) >> 16);
+        dev_consts.num_l2_slices = ((info.mem_features & 0xF00) >> 8) + 1;
+        dev_consts.axi_bus_width = 1UL << ((info.l2_features & 0xFF000000) >> 24);
+
+        dev_consts.shader_core_mask = info.shader_present;
+        dev_consts.num_shader_cores = static_cast<uint64_t>(__builtin_popcountll(dev_consts.shader_core_mask));
+
+        dev_consts.tile_size = 16;
+
+        get_num_exec_engines_args args{};
+        args.known_pid = known_pid;
+        args.core_count = dev_consts.num_shader_cores;
+        args.core_features = info.core_features;
+        args.thread_features = info.thread_features;
+
+        dev_consts.num_exec_engines = get_num_exec_engines(std::move(args), ec);
+
+        return {dev_consts, known_pid};
+    }
+
     /** Get the raw properties buffer as it's returned from the kernel. */
     properties props_post_r21(int fd, std::error_code &ec) {
         int ret = 0;
@@ -502,6 +557,30 @@ class instance_impl : public instance, private syscall_iface_t {
         return {};
     }
 
+    /** Detect the DRM panthor driver, that is versioned with the DRM driver version. */
+    std::error_code version_check_panthor() {
+        std::array<char, 16> name{};
+
+        ioctl::panthor::drm_version version{};
+        version.name_len = name.size();
+        version.name = name.data();
+
+        std::error_code ec;
+        std::tie(ec, std::ignore) = get_syscall_iface().ioctl(fd_, ioctl::panthor::command::drm_version, &version);
+        if (ec)
+            return ec;
+
+        const size_t name_len = std::min(version.name_len, name.size());
+        if (name_len != std::strlen(ioctl::panthor::driver_name) ||
+            std::strncmp(name.data(), ioctl::panthor::driver_name, name_len) != 0)
+            return std::make_error_code(std::errc::not_supported);
+
+        kbase_version_ = kbase_version_type(static_cast<uint16_t>(version.version_major),
+                                            static_cast<uint16_t>(version.version_minor), ioctl_iface_type::panthor);
+
+        return {};
+    }
+
     /** Detect kbase version and initialize kbase_version_ field. */
     std::error_code version_check() {
         if (!version_check_pre_r21())
@@ -510,7 +589,13 @@ class instance_impl : public instance, private syscall_iface_t {
         if (!version_check_post_r21(ioctl_iface_type::jm_post_r21))
             return {};
 
-        return version_check_post_r21(ioctl_iface_type::csf);
+        if (!version_check_post_r21(ioctl_iface_type::csf))
+            return {};
+
+        if (!version_check_panthor())
+            return {};
+
+        return std::make_error_code(std::errc::not_supported);
     }
 
     /** Detect backend interface type and initialize backend_type_ field. */
@@ -544,7 +629,7 @@ class instance_impl : public instance, private syscall_iface_t {
         }
         case hwcnt::backend_type::kinstr_prfcnt:
         case hwcnt::backend_type::kinstr_prfcnt_wa:
-        case hwcnt::backend_type::kinstr_prfcnt_bad:
+        case hwcnt::backend_type::kinstr_prfcnt_bad: {
             using namespace hwcnt::sampler::kinstr_prfcnt;
             std::tie(ec, ei_) = parse_enum_info(fd_, iface);
             if (ec)
@@ -554,6 +639,18 @@ class instance_impl : public instance, private syscall_iface_t {
             clock_extents_ = construct_clock_extents(ei_);
             break;
         }
+        case hwcnt::backend_type::panthor: {
+            /* Kernels without the perf-counter interface fail the query. */
+            ioctl::panthor::perf_info info{};
+            std::tie(ec, info) = hwcnt::sampler::panthor::query_perf_info(fd_, get_syscall_iface());
+            if (ec)
+                return ec;
+
+            block_extents_ = hwcnt::sampler::panthor::construct_block_extents(info);
+            clock_extents_ = hwcnt::sampler::panthor::construct_clock_extents(info);
+            break;
+        }
+        }
 
         return ec;
     }
@@ -610,6 +707,10 @@ class instance_impl : public instance, private syscall_iface_t {
 
         std::error_code ec;
 
+        /* The panthor driver has no context creation flags. */
+        if (kbase_version_.type() == ioctl_iface_type::panthor)
+            return ec;
+
         if (kbase_version_.type() == ioctl_iface_type::jm_pre_r21) {
             ioctl::kbase_pre_r21::set_flags_args flags{};
             flags.header.id = ioctl::kbase_pre_r21::header_id::set_flags;
@@ -647,6 +748,11 @@ class instance_impl : public instance, private syscall_iface_t {
             return ec;
         }
 
+        if (kbase_version_.type() == ioctl_iface_type::panthor) {
+            std::tie(constants_, pid_) = props_panthor(fd_, ec);
+            return ec;
+        }
+
         auto p = props_post_r21(fd_, ec);
         if (ec)
             return ec;
@@ -660,8 +766,59 @@ class instance_impl : public instance, private syscall_iface_t {
         return ec;
     }
 
-    /** Get a raw properties buffer into structured data. */
-    std::error_code init(const syscall_iface_t &iface) {
+    /**
+     * Restore the probe results from a cache entry.
+     *
+     * @param[in] cache  Probe cache.
+     * @return True if the cached entry was probed for the live driver, is valid and was restored.
+     */
+    bool restore_probe(const probe_cache &cache) {
+        probe_cache_entry entry{};
+        if (!cache.load(entry) || !entry.matches(kbase_version_, constants_, backend_type_) || !entry.valid())
+            return false;
+
+        backend_type_ = entry.backend_type;
+        block_extents_ = entry.block_extents;
+        clock_extents_ = entry.clock_extents;
+        ei_ = entry.enum_info;
+        return true;
+    }
+
+    /**
+     * Store the probe results in the cache.
+     *
+     * @param[in] cache                  Probe cache.
+     * @param[in] selected_backend_type  Back-end type selected before the workaround probe.
+     */
+    void store_probe(const probe_cache &cache, hwcnt::backend_type selected_backend_type) const {
+        if (!cache.enabled())
+            return;
+
+        probe_cache_entry entry{};
+        entry.version = kbase_version_;
+        entry.consts = constants_;
+        entry.selected_backend_type = selected_backend_type;
+        entry.backend_type = backend_type_;
+        entry.block_extents = block_extents_;
+        entry.clock_extents = clock_extents_;
+        entry.enum_info = ei_;
+
+        /* Failing to write the cache only costs the next instance a probe. */
+        static_cast<void>(cache.store(entry));
+    }
+
+    /**
+     * Get a raw properties buffer into structured data.
+     *
+     * The driver version and the GPU properties are always read, and validate
+     * the probe cache entry. When it matches, the extents and the back-end type
+     * are restored from it rather than probed.
+     *
+     * @param[in] iface Syscall iface.
+     * @param[in] cache Probe cache.
+     * @return Error code.
+     */
+    std::error_code init(const syscall_iface_t &iface, const probe_cache &cache) {
         std::error_code ec = version_check();
         if (ec)
             return ec;
@@ -678,6 +835,11 @@ class instance_impl : public instance, private syscall_iface_t {
         if (ec)
             return ec;
 
+        if (restore_probe(cache))
+            return {};
+
+        const auto selected_backend_type = backend_type_;
+
         ec = init_extents(iface);
         if (ec)
             return ec;
@@ -686,6 +848,8 @@ class instance_impl : public instance, private syscall_iface_t {
         if (ec)
             return ec;
 
+        store_probe(cache, selected_backend_type);
+
         return {};
     }
 
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/** @file commands.hpp DRM panthor ioctl commands. */
+
+#pragma once
+
+#include "types.hpp"
+
+#include <linux/ioctl.h>
+
+namespace hwcpipe {
+namespace device {
+namespace ioctl {
+namespace panthor {
+
+/** Interface DRM number. */
+constexpr auto iface_number = 'd';
+
+/** First driver specific DRM command number. */
+constexpr auto command_base = 0x40;
+
+namespace command {
+
+/** Commands describing DRM panthor ioctl interface. */
+enum command_type {
+    /** Get the DRM driver name and version. */
+    drm_version = _IOWR(iface_number, 0x0, ::hwcpipe::device::ioctl::panthor::drm_version),
+    /** Close a buffer object handle. */
+    gem_close = _IOW(iface_number, 0x9, ::hwcpipe::device::ioctl::panthor::gem_close),
+    /** Query device information. */
+    dev_query = _IOWR(iface_number, command_base + 0x0, ::hwcpipe::device::ioctl::panthor::dev_query),
+    /** Create a buffer object. */
+    bo_create = _IOWR(iface_number, command_base + 0x5, ::hwcpipe::device::ioctl::panthor::bo_create),
+    /** Get the mmap offset of a buffer object. */
+    bo_mmap_offset = _IOWR(iface_number, command_base + 0x6, ::hwcpipe::device::ioctl::panthor::bo_mmap_offset),
+    /** Control a performance counters session. */
+    perf_control = _IOWR(iface_number, command_base + 0x10, ::hwcpipe::device::ioctl::panthor::perf_control),
+};
+
+} // namespace command
+} // namespace panthor
+} // namespace ioctl
+} // namespace device
+} // namespace hwcpipe
@@ -0,0 +1,384 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file types.hpp
+ *
+ * DRM panthor ioctl argument types.
+ *
+ * The device query, buffer object and DRM core types follow the upstream
+ * `panthor_drm.h` and `drm.h` headers. The performance counters types follow
+ * the panthor perf-counter RFC series, which is not merged upstream yet. They
+ * are only used once the kernel reported the perf info device query.
+ */
+
+#pragma once
+
+#include <device/ioctl/pointer64.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace hwcpipe {
+namespace device {
+namespace ioctl {
+
+/** DRM panthor ioctl interface. */
+namespace panthor {
+
+/** Name reported by DRM_IOCTL_VERSION for the panthor driver. */
+constexpr const char *driver_name = "panthor";
+
+/** DRM_IOCTL_VERSION argument. */
+struct drm_version {
+    /** Driver major version. */
+    int version_major;
+    /** Driver minor version. */
+    int version_minor;
+    /** Driver patch level. */
+    int version_patchlevel;
+    /** Size of the @ref name buffer, set to the name length by the kernel. */
+    size_t name_len;
+    /** Driver name buffer. */
+    char *name;
+    /** Size of the @ref date buffer. */
+    size_t date_len;
+    /** Driver date buffer. */
+    char *date;
+    /** Size of the @ref desc buffer. */
+    size_t desc_len;
+    /** Driver description buffer. */
+    char *desc;
+};
+
+/** DRM_IOCTL_GEM_CLOSE argument. */
+struct gem_close {
+    /** Buffer object handle to close. */
+    uint32_t handle;
+    /** Padding. */
+    uint32_t pad;
+};
+
+/** DRM_IOCTL_PANTHOR_DEV_QUERY argument. */
+struct dev_query {
+    /** Device query type. */
+    enum class query_type : uint32_t {
+        /** GPU information, @ref gpu_info. */
+        gpu_info = 0,
+        /** Command stream interface information. */
+        csif_info = 1,
+        /** Timestamp information. */
+        timestamp_info = 2,
+        /** Group priorities information. */
+        group_priorities_info = 3,
+        /** Performance counters information, @ref perf_info. */
+        perf_info = 4,
+    };
+
+    /** Query type. */
+    query_type type;
+    /** Size of the @ref pointer buffer, set to the size needed when @ref pointer is null. */
+    uint32_t size;
+    /** Buffer where the query result is stored. */
+    pointer64<void> pointer;
+};
+
+/** GPU information, as returned by the gpu_info device query. */
+struct gpu_info {
+    /** GPU_ID register. */
+    uint32_t gpu_id;
+    /** GPU revision. */
+    uint32_t gpu_rev;
+    /** Command stream frontend ID. */
+    uint32_t csf_id;
+    /** L2_FEATURES register. */
+    uint32_t l2_features;
+    /** TILER_FEATURES register. */
+    uint32_t tiler_features;
+    /** MEM_FEATURES register. */
+    uint32_t mem_features;
+    /** MMU_FEATURES register. */
+    uint32_t mmu_features;
+    /** THREAD_FEATURES register. */
+    uint32_t thread_features;
+    /** THREAD_MAX_THREADS register. */
+    uint32_t max_threads;
+    /** THREAD_MAX_WORKGROUP_SIZE register. */
+    uint32_t thread_max_workgroup_size;
+    /** THREAD_MAX_BARRIER_SIZE register. */
+    uint32_t thread_max_barrier_size;
+    /** COHERENCY_FEATURES register. */
+    uint32_t coherency_features;
+    /** TEXTURE_FEATURES registers. */
+    uint32_t texture_features[4];
+    /** AS_PRESENT register. */
+    uint32_t as_present;
+    /** Padding. */
+    uint32_t pad0;
+    /** SHADER_PRESENT register. */
+    uint64_t shader_present;
+    /** L2_PRESENT register. */
+    uint64_t l2_present;
+    /** TILER_PRESENT register. */
+    uint64_t tiler_present;
+    /** CORE_FEATURES register. */
+    uint32_t core_features;
+    /** Padding. */
+    uint32_t pad;
+};
+
+/** Performance counters information, as returned by the perf_info device query. */
+struct perf_info {
+    /** Clocks that samples are annotated with. */
+    enum class clock_type : uint64_t {
+        /** Top level clock cycles. */
+        toplevel = 1 << 0,
+        /** Core group clock cycles. */
+        coregroup = 1 << 1,
+        /** Shader cores clock cycles. */
+        shader = 1 << 2,
+    };
+
+    /** Number of 64 bit counters per block. */
+    uint32_t counters_per_block;
+    /** Size of the sample header, @ref perf_sample_header. */
+    uint32_t sample_header_size;
+    /** Size of the block header, @ref perf_block_header. */
+    uint32_t block_header_size;
+    /** Flags, unused. */
+    uint32_t flags;
+    /** Bitmask of the clock_type values that samples are annotated with. */
+    uint64_t supported_clocks;
+    /** Number of firmware blocks. */
+    uint32_t fw_blocks;
+    /** Number of command stream hardware blocks. */
+    uint32_t cshw_blocks;
+    /** Number of tiler blocks. */
+    uint32_t tiler_blocks;
+    /** Number of memory system blocks. */
+    uint32_t memsys_blocks;
+    /** Number of shader core blocks. */
+    uint32_t shader_blocks;
+    /** Padding. */
+    uint32_t pad;
+};
+
+/** DRM_IOCTL_PANTHOR_BO_CREATE argument. */
+struct bo_create {
+    /** Buffer object size, rounded up to the page size by the kernel. */
+    uint64_t size;
+    /** Buffer object flags. */
+    uint32_t flags;
+    /** VM the buffer object is private to, zero for a shareable one. */
+    uint32_t exclusive_vm_id;
+    /** Buffer object handle, set by the kernel. */
+    uint32_t handle;
+    /** Padding. */
+    uint32_t pad;
+};
+
+/** DRM_IOCTL_PANTHOR_BO_MMAP_OFFSET argument. */
+struct bo_mmap_offset {
+    /** Buffer object handle. */
+    uint32_t handle;
+    /** Padding. */
+    uint32_t pad;
+    /** Offset to pass to mmap() on the device file descriptor, set by the kernel. */
+    uint64_t offset;
+};
+
+/** Performance counters block set. */
+enum class perf_block_set : uint8_t {
+    /** Primary. */
+    primary,
+    /** Secondary. */
+    secondary,
+    /** Tertiary. */
+    tertiary,
+};
+
+/** Performance counters block type, in the order the blocks are laid out in a sample. */
+enum class perf_block_type : uint8_t {
+    /** Firmware. */
+    fw,
+    /** Command stream hardware. */
+    cshw,
+    /** Tiler. */
+    tiler,
+    /** Memory system. */
+    memsys,
+    /** Shader core. */
+    shader,
+};
+
+/** DRM_IOCTL_PANTHOR_PERF_CONTROL argument. */
+struct perf_control {
+    /** Performance counters session command. */
+    enum class command : uint32_t {
+        /** Create a session, @ref perf_cmd_setup. */
+        setup,
+        /** Destroy a session. */
+        teardown,
+        /** Start counting, @ref perf_cmd_start. */
+        start,
+        /** Stop counting and take a sample, @ref perf_cmd_stop. */
+        stop,
+        /** Take a sample, @ref perf_cmd_sample. */
+        sample,
+    };
+
+    /** Command. */
+    command cmd;
+    /** Session handle, as returned by the setup command. */
+    uint32_t handle;
+    /** Size of the @ref pointer command argument. */
+    uint64_t size;
+    /** Command argument. */
+    pointer64<void> pointer;
+};
+
+/** Performance counters session setup argument. */
+struct perf_cmd_setup {
+    /** Block set to sample. */
+    perf_block_set block_set;
+    /** Padding. */
+    uint8_t pad[7];
+    /** eventfd signaled when a sample is inserted in the ring buffer. */
+    uint32_t fd;
+    /** Ring buffer buffer object handle. */
+    uint32_t ringbuf_handle;
+    /** Control buffer object handle, @ref perf_ringbuf_control. */
+    uint32_t control_handle;
+    /** Number of samples the ring buffer holds, a power of two. */
+    uint32_t sample_slots;
+    /** Offset of the control structure within the control buffer object. */
+    uint64_t control_offset;
+    /** Firmware counters enable mask. */
+    uint64_t fw_enable_mask[2];
+    /** Command stream hardware counters enable mask. */
+    uint64_t cshw_enable_mask[2];
+    /** Tiler counters enable mask. */
+    uint64_t tiler_enable_mask[2];
+    /** Memory system counters enable mask. */
+    uint64_t memsys_enable_mask[2];
+    /** Shader core counters enable mask. */
+    uint64_t shader_enable_mask[2];
+};
+
+/** Performance counters session start argument. */
+struct perf_cmd_start {
+    /** User data of the session. */
+    uint64_t user_data;
+};
+
+/** Performance counters session stop argument. */
+struct perf_cmd_stop {
+    /** User data of the sample taken at stop. */
+    uint64_t user_data;
+};
+
+/** Performance counters sample request argument. */
+struct perf_cmd_sample {
+    /** User data of the sample. */
+    uint64_t user_data;
+};
+
+/**
+ * Ring buffer control structure, shared with the kernel.
+ *
+ * The kernel writes samples at `insert_idx` and advances it. User space reads
+ * the samples at `extract_idx` and advances it once they are consumed. The
+ * indices grow monotonically, the slot is the index modulo the sample slots.
+ */
+struct perf_ringbuf_control {
+    /** Index of the next sample to consume, written by user space. */
+    uint64_t extract_idx;
+    /** Index of the next sample to write, written by the kernel. */
+    uint64_t insert_idx;
+};
+
+/** Sample header, at the start of every ring buffer slot. */
+struct perf_sample_header {
+    /** Sample flags. */
+    enum class sample_flag : uint32_t {
+        /** The ring buffer overflowed and this sample accumulates the counters of the samples lost. */
+        overflow = 1 << 0,
+        /** The sample had an error condition. */
+        error = 1 << 1,
+    };
+
+    /** Earliest timestamp that the values represent. */
+    uint64_t timestamp_start_ns;
+    /** Latest timestamp that the values represent. */
+    uint64_t timestamp_end_ns;
+    /** Block set. */
+    perf_block_set block_set;
+    /** Padding. */
+    uint8_t pad[3];
+    /** Bitmask of sample_flag values. */
+    uint32_t flags;
+    /** User data. */
+    uint64_t user_data;
+    /** Top level clock cycles. */
+    uint64_t toplevel_clock_cycles;
+    /** Core group clock cycles. */
+    uint64_t coregroup_clock_cycles;
+    /** Shader cores clock cycles. */
+    uint64_t shader_clock_cycles;
+};
+
+/** Block header, before the counters of every block. */
+struct perf_block_header {
+    /** Block states. */
+    enum class block_state : uint8_t {
+        /** Powered on for some of the sample. */
+        on = 1 << 0,
+        /** Powered off for some of the sample. */
+        off = 1 << 1,
+        /** Available to this VM for some of the sample. */
+        available = 1 << 2,
+        /** Unavailable to this VM for some of the sample. */
+        unavailable = 1 << 3,
+        /** In normal mode for some of the sample. */
+        normal = 1 << 4,
+        /** In protected mode for some of the sample. */
+        protected_mode = 1 << 5,
+    };
+
+    /** Counters enabled in this block. */
+    uint64_t enable_mask[2];
+    /** Block type. */
+    perf_block_type block_type;
+    /** Index of the block within the blocks of its type. */
+    uint8_t block_idx;
+    /** Bitmask of block_state values. */
+    uint8_t block_states;
+    /** Padding. */
+    uint8_t pad[5];
+};
+
+} // namespace panthor
+} // namespace ioctl
+} // namespace device
+} // namespace hwcpipe
@@ -52,7 +52,9 @@ enum class ioctl_iface_type {
     /** Post R21 release Job manager kernel. */
     jm_post_r21,
     /** CSF kernel. */
-    csf
+    csf,
+    /** Upstream DRM panthor kernel, versioned with the DRM driver version. */
+    panthor,
 };
 
 /** Check version compatibility between kernel and userspace. */
@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/**
+ * @file probe_cache.hpp
+ *
+ * Persistent cache of the device probe results.
+ */
+
+#pragma once
+
+#include "kbase_version.hpp"
+
+#include <device/constants.hpp>
+#include <device/hwcnt/backend_type.hpp>
+#include <device/hwcnt/block_extents.hpp>
+#include <device/hwcnt/clock_extents.hpp>
+#include <device/hwcnt/sampler/configuration.hpp>
+#include <device/hwcnt/sampler/kinstr_prfcnt/construct_block_extents.hpp>
+#include <device/hwcnt/sampler/kinstr_prfcnt/construct_clock_extents.hpp>
+#include <device/hwcnt/sampler/kinstr_prfcnt/enum_info_parser.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+#include <unistd.h>
+
+namespace hwcpipe {
+namespace device {
+
+/** Name of the environment variable that sets the probe cache file path. */
+constexpr const char *probe_cache_env_var = "HWCPIPE_DEVICE_CACHE";
+
+/**
+ * Results of the device probing done at instance creation time.
+ *
+ * The entry is keyed by the kernel driver version and the GPU constants, that
+ * include the raw GPU id. They are cheap to read from the driver, while the
+ * enum info query and the kinstr_prfcnt workaround probe, which creates and
+ * runs a sampler, are not.
+ */
+struct probe_cache_entry {
+    /** Kernel driver version. */
+    kbase_version version;
+    /** GPU constants. */
+    constants consts;
+    /** Back-end type selected for the driver version and GPU. */
+    hwcnt::backend_type selected_backend_type;
+    /** Back-end type used, after the workaround probe. */
+    hwcnt::backend_type backend_type;
+    /** Block extents. */
+    hwcnt::block_extents block_extents;
+    /** Clock extents. */
+    hwcnt::clock_extents clock_extents;
+    /** kinstr_prfcnt enum info. */
+    hwcnt::sampler::kinstr_prfcnt::enum_info enum_info;
+
+    /**
+     * Check that the entry was probed for the live driver.
+     *
+     * @param[in] live_version       Kernel driver version.
+     * @param[in] live_consts        GPU constants.
+     * @param[in] live_backend_type  Back-end type selected for the driver version and GPU.
+     * @return True if the entry can be used instead of probing the device.
+     */
+    bool matches(const kbase_version &live_version, const constants &live_consts,
+                 hwcnt::backend_type live_backend_type) const {
+        static_assert(sizeof(constants) % sizeof(uint64_t) == 0, "constants must not be padded");
+
+        return version == live_version && selected_backend_type == live_backend_type &&
+               std::memcmp(&consts, &live_consts, sizeof(constants)) == 0;
+    }
+
+    /**
+     * Check the probe results against the GPU constants of the entry.
+     *
+     * A corrupted entry body may hold enums or extents out of range, that the
+     * back-ends would index the kernel buffers with.
+     *
+     * @return True if the probe results can be restored.
+     */
+    bool valid() const {
+        static_assert(sizeof(hwcnt::clock_extents) == 3 * sizeof(bool), "clock extents only hold flags");
+        if (!are_flags(&clock_extents, sizeof(clock_extents)) ||
+            !are_flags(&enum_info.has_cycles_top, sizeof(bool)) || !are_flags(&enum_info.has_cycles_sc, sizeof(bool)))
+            return false;
+
+        /* Only the workaround probe changes the back-end type. */
+        if (backend_type > hwcnt::backend_type::last ||
+            (backend_type != selected_backend_type &&
+             (selected_backend_type != hwcnt::backend_type::kinstr_prfcnt ||
+              backend_type != hwcnt::backend_type::kinstr_prfcnt_wa)))
+            return false;
+
+        if (block_extents.counters_per_block() == 0 ||
+            block_extents.counters_per_block() > hwcnt::sampler::configuration::max_counters_per_block ||
+            block_extents.values_type() > hwcnt::sample_values_type::uint64)
+            return false;
+
+        /* The core blocks are numbered by the bits of the shader core mask. */
+        uint64_t num_core_slots = 0;
+        for (uint64_t mask = consts.shader_core_mask; mask != 0; mask >>= 1)
+            ++num_core_slots;
+
+        if (block_extents.num_blocks_of_type(hwcnt::block_type::core) > num_core_slots ||
+            block_extents.num_blocks_of_type(hwcnt::block_type::memory) > std::max<uint64_t>(consts.num_l2_slices, 1))
+            return false;
+
+        if (backend_type != hwcnt::backend_type::kinstr_prfcnt &&
+            backend_type != hwcnt::backend_type::kinstr_prfcnt_wa &&
+            backend_type != hwcnt::backend_type::kinstr_prfcnt_bad)
+            return true;
+
+        /* The kinstr_prfcnt extents are derived from the enum info. */
+        const auto expected_blocks = hwcnt::sampler::kinstr_prfcnt::construct_block_extents(enum_info);
+        const auto expected_clocks = hwcnt::sampler::kinstr_prfcnt::construct_clock_extents(enum_info);
+
+        for (size_t i = 0; i != hwcnt::block_extents::num_block_types; ++i) {
+            const auto type = static_cast<hwcnt::block_type>(i);
+            if (block_extents.num_blocks_of_type(type) != expected_blocks.num_blocks_of_type(type))
+                return false;
+        }
+
+        return enum_info.set <= hwcnt::prfcnt_set::tertiary &&
+               block_extents.counters_per_block() == expected_blocks.counters_per_block() &&
+               block_extents.values_type() == expected_blocks.values_type() &&
+               std::memcmp(&clock_extents, &expected_clocks, sizeof(clock_extents)) == 0;
+    }
+
+  private:
+    /** @return True if every byte of @p data is a bool value. */
+    static bool are_flags(const void *data, size_t size) {
+        const auto *bytes = static_cast<const uint8_t *>(data);
+        for (size_t i = 0; i != size; ++i) {
+            if (bytes[i] > 1)
+                return false;
+        }
+        return true;
+    }
+};
+
+/**
+ * Probe cache file.
+ *
+ * The file holds a single entry, overwritten when the device changes. It is
+ * written to a temporary file first and renamed, so that concurrent processes
+ * never read a partial entry.
+ */
+class probe_cache {
+  public:
+    /**
+     * Constructor.
+     *
+     * @param[in] path  Cache file path, nullptr or empty to disable the cache.
+     */
+    explicit probe_cache(const char *path)
+        : path_(path != nullptr ? path : "") {}
+
+    /** @return True if the cache is enabled. */
+    bool enabled() const { return !path_.empty(); }
+
+    /**
+     * Load the cached entry.
+     *
+     * @param[out] entry  Entry loaded.
+     * @return True if an entry of this format was loaded.
+     */
+    bool load(probe_cache_entry &entry) const {
+        if (!enabled())
+            return false;
+
+        std::FILE *file = std::fopen(path_.c_str(), "rb");
+        if (file == nullptr)
+            return false;
+
+        header file_header{};
+        const bool loaded = std::fread(&file_header, sizeof(file_header), 1, file) == 1 &&
+                            file_header == header::current() && std::fread(&entry, sizeof(entry), 1, file) == 1;
+        std::fclose(file);
+
+        return loaded;
+    }
+
+    /**
+     * Store an entry, replacing the cached one.
+     *
+     * @param[in] entry  Entry to store.
+     * @return True if the entry was stored.
+     */
+    bool store(const probe_cache_entry &entry) const {
+        if (!enabled())
+            return false;
+
+        const std::string temp_path = path_ + "." + std::to_string(::getpid());
+        std::FILE *file = std::fopen(temp_path.c_str(), "wb");
+        if (file == nullptr)
+            return false;
+
+        const header file_header = header::current();
+        bool stored = std::fwrite(&file_header, sizeof(file_header), 1, file) == 1 &&
+                      std::fwrite(&entry, sizeof(entry), 1, file) == 1;
+        stored = std::fclose(file) == 0 && stored;
+
+        if (stored)
+            stored = std::rename(temp_path.c_str(), path_.c_str()) == 0;
+
+        if (!stored)
+            std::remove(temp_path.c_str());
+
+        return stored;
+    }
+
+  private:
+    static_assert(std::is_trivially_copyable<probe_cache_entry>::value, "the entry is stored as raw bytes");
+
+    /** Cache file header. */
+    struct header {
+        /** File magic. */
+        uint32_t magic;
+        /** Format version, bumped when the entry layout changes. */
+        uint32_t version;
+        /** Entry size, which also guards against builds with another layout. */
+        uint32_t entry_size;
+
+        /** @return The header of the files written by this build. */
+        static header current() { return {0x44435748, 1, static_cast<uint32_t>(sizeof(probe_cache_entry))}; }
+
+        bool operator==(const header &other) const {
+            return magic == other.magic && version == other.version && entry_size == other.entry_size;
+        }
+    };
+
+    /** Cache file path. */
+    std::string path_;
+};
+
+} // namespace device
+} // namespace hwcpipe
@@ -0,0 +1,421 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file faulting_iface.hpp System calls latency and fault injection interface.
+ */
+
+#pragma once
+
+#include "iface.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <random>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <poll.h>
+#include <sys/mman.h>
+#include <sys/types.h>
+
+namespace hwcpipe {
+namespace device {
+namespace syscall {
+
+/** Distribution of the delays injected into a system call. */
+enum class delay_distribution {
+    /** No delay. */
+    none,
+    /** Always fault_profile::delay_ns. */
+    fixed,
+    /** Uniform between fault_profile::delay_ns and fault_profile::max_delay_ns. */
+    uniform,
+    /** Exponential of mean fault_profile::delay_ns, capped to fault_profile::max_delay_ns if not zero. */
+    exponential,
+};
+
+/** The faults injected into a kind of system call. */
+struct fault_profile {
+    /** Distribution of the delays added before the call. */
+    delay_distribution delay{delay_distribution::none};
+    /** Fixed delay, minimum uniform delay, or mean exponential delay, in nanoseconds. */
+    uint64_t delay_ns{};
+    /** Maximum delay, in nanoseconds. */
+    uint64_t max_delay_ns{};
+    /** Probability that the call fails with error instead of being made, after its delay. */
+    double error_rate{};
+    /** The errno of the failed calls. */
+    int error{EIO};
+    /** Only the ioctl calls of this command are faulty, or all of them if zero. */
+    uint64_t command{};
+    /** Poll only: every file descriptor is reported ready at once, without polling. */
+    bool ready{};
+};
+
+/** The faults injected during a number of calls. */
+struct fault_phase {
+    /** Number of ioctl, poll and mmap calls in the phase, or zero for the rest of the session. */
+    uint64_t num_calls{};
+    /** Faults of the ioctl calls. */
+    fault_profile ioctl{};
+    /** Faults of the poll calls. */
+    fault_profile poll{};
+    /** Faults of the mmap calls. */
+    fault_profile mmap{};
+};
+
+/** Counts of the faults injected. */
+struct fault_stats {
+    /** Number of ioctl, poll and mmap calls. */
+    uint64_t num_calls{};
+    /** Number of delayed calls. */
+    uint64_t num_delays{};
+    /** Sum of the delays, in nanoseconds. */
+    uint64_t total_delay_ns{};
+    /** Number of ioctl calls failed. */
+    uint64_t ioctl_errors{};
+    /** Number of poll calls failed. */
+    uint64_t poll_errors{};
+    /** Number of mmap calls failed. */
+    uint64_t mmap_errors{};
+    /** Number of poll calls reported ready without polling. */
+    uint64_t forced_ready{};
+};
+
+/**
+ * Decides the faults of the system calls of a faulting_iface, from a script
+ * of phases. Once the script is over, the calls are made without faults.
+ *
+ * The faults are drawn from a seeded generator, so that a run can be
+ * repeated. The calls of any thread may be faulted concurrently.
+ */
+class fault_injector {
+  public:
+    /** The fault of one call. */
+    struct fault {
+        /** Delay to wait before the call, in nanoseconds. */
+        uint64_t delay_ns{};
+        /** The error to fail the call with, or zero to make it. */
+        int error{};
+        /** Poll only: report the file descriptors ready without polling. */
+        bool ready{};
+    };
+
+    /** Kind of the faulty system calls. */
+    enum class call { ioctl, poll, mmap };
+
+    /**
+     * Constructor.
+     *
+     * @param[in] seed  Seed of the generator of the delays and errors.
+     */
+    explicit fault_injector(uint64_t seed = 1)
+        : engine_(seed) {}
+
+    /**
+     * Inject the same faults for the rest of the session.
+     *
+     * @param[in] ioctl  Faults of the ioctl calls.
+     * @param[in] poll   Faults of the poll calls.
+     * @param[in] mmap   Faults of the mmap calls.
+     */
+    void set_profiles(const fault_profile &ioctl, const fault_profile &poll, const fault_profile &mmap) {
+        fault_phase phase{};
+        phase.ioctl = ioctl;
+        phase.poll = poll;
+        phase.mmap = mmap;
+        set_script({phase});
+    }
+
+    /**
+     * Inject the faults of a script, from its first phase.
+     *
+     * @param[in] script  The phases, in order.
+     */
+    void set_script(std::vector<fault_phase> script) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        script_ = std::move(script);
+        phase_ = 0;
+        phase_calls_ = 0;
+    }
+
+    /**
+     * Make a script where the kernel ring buffer fills up: after @p normal_calls
+     * calls, the next @p full_calls polls report a sample ready at once, and
+     * the @p command ioctls fail with EBUSY, as the kernel does when no buffer is
+     * left for a new sample. Then the buffer is drained and the calls succeed.
+     *
+     * @param[in] normal_calls  Number of calls before the buffer is full.
+     * @param[in] full_calls    Number of calls while the buffer is full.
+     * @param[in] command       The ioctl command that requests or gets a sample.
+     * @return The script.
+     */
+    static std::vector<fault_phase> buffer_full_script(uint64_t normal_calls, uint64_t full_calls,
+                                                       uint64_t command) {
+        fault_phase normal{};
+        normal.num_calls = normal_calls;
+
+        fault_phase full{};
+        full.num_calls = full_calls;
+        full.ioctl.error_rate = 1.0;
+        full.ioctl.error = EBUSY;
+        full.ioctl.command = command;
+        full.poll.ready = true;
+
+        if (normal_calls == 0)
+            return {full, fault_phase{}};
+
+        return {normal, full, fault_phase{}};
+    }
+
+    /** @return The faults injected so far. */
+    fault_stats read() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return stats_;
+    }
+
+    /**
+     * Draw the fault of a call, and count it.
+     *
+     * @param[in] type     Kind of the call.
+     * @param[in] command  Command of an ioctl call.
+     * @return The fault of the call.
+     */
+    fault next(call type, uint64_t command = 0) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ++stats_.num_calls;
+
+        const fault_phase *phase = current_phase();
+        if (phase == nullptr)
+            return {};
+
+        const fault_profile &profile = get_profile(*phase, type);
+        if (type == call::ioctl && profile.command != 0 && profile.command != command)
+            return {};
+
+        fault result{};
+        result.delay_ns = draw_delay(profile);
+        if (result.delay_ns != 0) {
+            ++stats_.num_delays;
+            stats_.total_delay_ns += result.delay_ns;
+        }
+
+        if (profile.error_rate > 0 && std::generate_canonical<double, 32>(engine_) < profile.error_rate) {
+            result.error = profile.error;
+            ++get_errors(type);
+        } else if (type == call::poll && profile.ready) {
+            result.ready = true;
+            ++stats_.forced_ready;
+        }
+
+        return result;
+    }
+
+  private:
+    /** @return The phase of the call, or nullptr after the script, and move to the next phase. */
+    const fault_phase *current_phase() {
+        if (phase_ == script_.size())
+            return nullptr;
+
+        const fault_phase *phase = &script_[phase_];
+        if (phase->num_calls != 0 && ++phase_calls_ == phase->num_calls) {
+            ++phase_;
+            phase_calls_ = 0;
+        }
+
+        return phase;
+    }
+
+    static const fault_profile &get_profile(const fault_phase &phase, call type) {
+        switch (type) {
+        case call::ioctl:
+            return phase.ioctl;
+        case call::poll:
+            return phase.poll;
+        case call::mmap:
+        default:
+            return phase.mmap;
+        }
+    }
+
+    uint64_t &get_errors(call type) {
+        switch (type) {
+        case call::ioctl:
+            return stats_.ioctl_errors;
+        case call::poll:
+            return stats_.poll_errors;
+        case call::mmap:
+        default:
+            return stats_.mmap_errors;
+        }
+    }
+
+    uint64_t draw_delay(const fault_profile &profile) {
+        switch (profile.delay) {
+        case delay_distribution::fixed:
+            return profile.delay_ns;
+        case delay_distribution::uniform: {
+            const uint64_t max_ns = std::max(profile.delay_ns, profile.max_delay_ns);
+            return std::uniform_int_distribution<uint64_t>(profile.delay_ns, max_ns)(engine_);
+        }
+        case delay_distribution::exponential: {
+            if (profile.delay_ns == 0)
+                return 0;
+
+            std::exponential_distribution<double> distribution(1.0 / static_cast<double>(profile.delay_ns));
+            const auto delay_ns = static_cast<uint64_t>(std::llround(distribution(engine_)));
+            return profile.max_delay_ns != 0 ? std::min(delay_ns, profile.max_delay_ns) : delay_ns;
+        }
+        case delay_distribution::none:
+        default:
+            return 0;
+        }
+    }
+
+    mutable std::mutex mutex_;
+    std::mt19937_64 engine_;
+    std::vector<fault_phase> script_{};
+    size_t phase_{};
+    uint64_t phase_calls_{};
+    fault_stats stats_{};
+};
+
+/**
+ * System calls interface that forwards every call to another interface, and
+ * injects the delays and errors that a fault_injector decides into the ioctl,
+ * poll and mmap calls. It reproduces a slow or overloaded kernel driver, to
+ * check that the backends and the sampler keep their latency bounded, time
+ * out and account for the lost samples.
+ *
+ * A delay is waited before the call. A failed call is not forwarded. It is
+ * copyable like the other interfaces, and all the copies inject the faults
+ * of the same injector. A default constructed interface forwards without
+ * faults.
+ *
+ * @par Example
+ * @code
+ * syscall::fault_injector injector{seed};
+ * syscall::fault_profile slow_poll{};
+ * slow_poll.delay = syscall::delay_distribution::exponential;
+ * slow_poll.delay_ns = 2000000;
+ * injector.set_profiles({}, slow_poll, {});
+ * syscall::faulting_iface<> iface{injector};
+ * // ... create an instance and a backend with iface, take samples ...
+ * @endcode
+ *
+ * @tparam syscall_iface_t The interface to forward the calls to.
+ */
+template <typename syscall_iface_t = iface>
+class faulting_iface {
+  public:
+    /** Default constructor. */
+    faulting_iface() = default;
+
+    /**
+     * Constructor.
+     *
+     * @param[in] injector  Injector that decides the faults of the calls.
+     * @param[in] iface     Interface to forward the calls to.
+     */
+    explicit faulting_iface(fault_injector &injector, const syscall_iface_t &iface = {})
+        : iface_(iface)
+        , injector_(&injector) {}
+
+    /** @copydoc detail::iface::open */
+    std::pair<std::error_code, int> open(const char *name, int oflags) const {
+        return get_syscall_iface().open(name, oflags);
+    }
+
+    /** @copydoc detail::iface::is_char_device */
+    std::pair<std::error_code, bool> is_char_device(int fd) const { return get_syscall_iface().is_char_device(fd); }
+
+    /** @copydoc detail::iface::close */
+    std::error_code close(int fd) const { return get_syscall_iface().close(fd); }
+
+    /** @copydoc detail::iface::mmap */
+    std::pair<std::error_code, void *> mmap(void *addr, size_t len, int prot, int flags, int fd, off_t off) const {
+        const auto fault = inject(fault_injector::call::mmap, 0);
+        if (fault.error != 0)
+            return std::make_pair(std::error_code{fault.error, std::generic_category()}, MAP_FAILED);
+
+        return get_syscall_iface().mmap(addr, len, prot, flags, fd, off);
+    }
+
+    /** @copydoc detail::iface::munmap */
+    std::error_code munmap(void *addr, size_t len) const { return get_syscall_iface().munmap(addr, len); }
+
+    /** @copydoc detail::iface::ioctl */
+    template <typename command_t, typename... args_t>
+    std::pair<std::error_code, int> ioctl(int fd, command_t command, args_t &&...args) const {
+        const auto fault = inject(fault_injector::call::ioctl, static_cast<uint64_t>(command));
+        if (fault.error != 0)
+            return std::make_pair(std::error_code{fault.error, std::generic_category()}, -1);
+
+        return get_syscall_iface().ioctl(fd, command, std::forward<args_t>(args)...);
+    }
+
+    /** @copydoc detail::iface::poll */
+    std::pair<std::error_code, int> poll(struct pollfd *fds, nfds_t nfds, int timeout) const {
+        const auto fault = inject(fault_injector::call::poll, 0);
+        if (fault.error != 0)
+            return std::make_pair(std::error_code{fault.error, std::generic_category()}, -1);
+
+        if (fault.ready) {
+            for (nfds_t i = 0; i != nfds; ++i)
+                fds[i].revents = static_cast<short>(fds[i].events & POLLIN);
+            return std::make_pair(std::error_code{}, static_cast<int>(nfds));
+        }
+
+        return get_syscall_iface().poll(fds, nfds, timeout);
+    }
+
+  private:
+    syscall_iface_t &get_syscall_iface() const { return iface_; }
+
+    fault_injector::fault inject(fault_injector::call type, uint64_t command) const {
+        if (injector_ == nullptr)
+            return {};
+
+        const auto fault = injector_->next(type, command);
+        if (fault.delay_ns != 0)
+            std::this_thread::sleep_for(std::chrono::nanoseconds(fault.delay_ns));
+
+        return fault;
+    }
+
+    mutable syscall_iface_t iface_{};
+    fault_injector *injector_{};
+};
+
+} // namespace syscall
+} // namespace device
+} // namespace hwcpipe
@@ -30,6 +30,7 @@
 
 #include "funcs/libmali.hpp"
 #include "funcs/unix.hpp"
+#include "instrumenting_iface.hpp"
 
 #include <device/detail/is_empty_class.hpp>
 
@@ -37,7 +38,13 @@
 
 #include <errno.h>
 #include <poll.h>
+#include <sched.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/resource.h>
 #include <sys/stat.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
 
 namespace hwcpipe {
 namespace device {
@@ -222,6 +229,205 @@ class iface {
         return std::make_pair(ec, result);
     }
 
+    /**
+     * epoll_create1 wrapper function.
+     *
+     * @param[in] flags     Creation flags.
+     * @return A pair of std::error_code and the epoll file descriptor.
+     */
+    static std::pair<std::error_code, int> epoll_create1(int flags) {
+        const int result = ::epoll_create1(flags);
+
+        std::error_code ec;
+
+        if (result < 0)
+            ec = errno_error_code();
+
+        return std::make_pair(ec, result);
+    }
+
+    /**
+     * epoll_ctl wrapper function.
+     *
+     * @param[in] epfd      The epoll file descriptor.
+     * @param[in] op        Operation to perform on @p fd.
+     * @param[in] fd        Target file descriptor.
+     * @param[in] event     Events to monitor on @p fd, and the data returned when they occur.
+     * @return std::error_code instance.
+     */
+    static std::error_code epoll_ctl(int epfd, int op, int fd, struct epoll_event *event) {
+        const int result = ::epoll_ctl(epfd, op, fd, event);
+
+        if (result < 0)
+            return errno_error_code();
+
+        return {};
+    }
+
+    /**
+     * epoll_wait wrapper function.
+     *
+     * @param[in]  epfd         The epoll file descriptor.
+     * @param[out] events       Array where the ready events are stored.
+     * @param[in]  maxevents    Size of the @p events array.
+     * @param[in]  timeout      The timeout in milliseconds that epoll_wait() should block
+     *                          waiting for an event.
+     * @return A pair of std:error_code and `epoll_wait` return value.
+     */
+    static std::pair<std::error_code, int> epoll_wait(int epfd, struct epoll_event *events, int maxevents,
+                                                      int timeout) {
+        const int result = ::epoll_wait(epfd, events, maxevents, timeout);
+
+        std::error_code ec;
+
+        if (result < 0)
+            ec = errno_error_code();
+
+        return std::make_pair(ec, result);
+    }
+
+    /**
+     * read wrapper function.
+     *
+     * @param[in]  fd       File descriptor to read from.
+     * @param[out] buf      Buffer where the data read is stored.
+     * @param[in]  count    Size of @p buf.
+     * @return A pair of std::error_code and the number of bytes read.
+     */
+    static std::pair<std::error_code, ssize_t> read(int fd, void *buf, size_t count) {
+        const ssize_t result = ::read(fd, buf, count);
+
+        std::error_code ec;
+
+        if (result < 0)
+            ec = errno_error_code();
+
+        return std::make_pair(ec, result);
+    }
+
+    /**
+     * write wrapper function.
+     *
+     * @param[in] fd        File descriptor to write to.
+     * @param[in] buf       Data to write.
+     * @param[in] count     Size of @p buf.
+     * @return A pair of std::error_code and the number of bytes written.
+     */
+    static std::pair<std::error_code, ssize_t> write(int fd, const void *buf, size_t count) {
+        const ssize_t result = ::write(fd, buf, count);
+
+        std::error_code ec;
+
+        if (result < 0)
+            ec = errno_error_code();
+
+        return std::make_pair(ec, result);
+    }
+
+    /**
+     * eventfd wrapper function.
+     *
+     * @param[in] initval   Initial value of the event counter.
+     * @param[in] flags     Creation flags, e.g. `EFD_NONBLOCK`.
+     * @return A pair of std::error_code and the event file descriptor.
+     */
+    static std::pair<std::error_code, int> eventfd(unsigned int initval, int flags) {
+        const int result = ::eventfd(initval, flags);
+
+        std::error_code ec;
+
+        if (result < 0)
+            ec = errno_error_code();
+
+        return std::make_pair(ec, result);
+    }
+
+    /**
+     * timerfd_create wrapper function.
+     *
+     * @param[in] clockid   Clock that the timer is measured with.
+     * @param[in] flags     Creation flags.
+     * @return A pair of std::error_code and the timer file descriptor.
+     */
+    static std::pair<std::error_code, int> timerfd_create(int clockid, int flags) {
+        const int result = ::timerfd_create(clockid, flags);
+
+        std::error_code ec;
+
+        if (result < 0)
+            ec = errno_error_code();
+
+        return std::make_pair(ec, result);
+    }
+
+    /**
+     * timerfd_settime wrapper function.
+     *
+     * @param[in] fd        Timer file descriptor.
+     * @param[in] flags     Timer flags, e.g. `TFD_TIMER_ABSTIME`.
+     * @param[in] value     First expiration and interval of the timer.
+     * @return std::error_code instance.
+     */
+    static std::error_code timerfd_settime(int fd, int flags, const struct itimerspec *value) {
+        const int result = ::timerfd_settime(fd, flags, value, nullptr);
+
+        if (result < 0)
+            return errno_error_code();
+
+        return {};
+    }
+
+    /**
+     * sched_setscheduler wrapper function.
+     *
+     * @param[in] pid       Thread to configure, zero for the calling thread.
+     * @param[in] policy    Scheduling policy.
+     * @param[in] param     Scheduling parameters.
+     * @return std::error_code instance.
+     */
+    static std::error_code sched_setscheduler(pid_t pid, int policy, const struct sched_param *param) {
+        const int result = ::sched_setscheduler(pid, policy, param);
+
+        if (result < 0)
+            return errno_error_code();
+
+        return {};
+    }
+
+    /**
+     * sched_setaffinity wrapper function.
+     *
+     * @param[in] pid       Thread to configure, zero for the calling thread.
+     * @param[in] size      Size of @p mask.
+     * @param[in] mask      CPUs that the thread may run on.
+     * @return std::error_code instance.
+     */
+    static std::error_code sched_setaffinity(pid_t pid, size_t size, const cpu_set_t *mask) {
+        const int result = ::sched_setaffinity(pid, size, mask);
+
+        if (result < 0)
+            return errno_error_code();
+
+        return {};
+    }
+
+    /**
+     * setpriority wrapper function.
+     *
+     * @param[in] which     Kind of @p who, e.g. `PRIO_PROCESS`.
+     * @param[in] who       Thread to configure, zero for the calling thread.
+     * @param[in] prio      Nice value.
+     * @return std::error_code instance.
+     */
+    static std::error_code setpriority(int which, id_t who, int prio) {
+        const int result = ::setpriority(which, who, prio);
+
+        if (result < 0)
+            return errno_error_code();
+
+        return {};
+    }
+
   private:
     /** @return std::error_code created out of the errno value. */
     static std::error_code errno_error_code() { return {errno, std::generic_category()}; }
@@ -230,9 +436,15 @@ class iface {
 } // namespace detail
 
 #if defined(HWCPIPE_SYSCALL_LIBMALI)
-using iface = detail::iface<funcs::libmali>;
+using direct_iface = detail::iface<funcs::libmali>;
+#else
+using direct_iface = detail::iface<funcs::unix>;
+#endif
+
+#if defined(HWCPIPE_SYSCALL_STATS)
+using iface = instrumenting_iface<direct_iface>;
 #else
-using iface = detail::iface<funcs::unix>;
+using iface = direct_iface;
 #endif
 
 } // namespace syscall
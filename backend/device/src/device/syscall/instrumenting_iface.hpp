@@ -0,0 +1,336 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file instrumenting_iface.hpp System calls timing and counting interface.
+ */
+
+#pragma once
+
+#include <device/syscall_stats.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <system_error>
+#include <utility>
+
+#include <poll.h>
+#include <sched.h>
+#include <sys/epoll.h>
+#include <sys/resource.h>
+#include <sys/timerfd.h>
+#include <sys/types.h>
+
+namespace hwcpipe {
+namespace device {
+namespace syscall {
+
+/**
+ * Collects the counts and latencies of system calls.
+ *
+ * The counters are atomic, so the system calls of any thread may be recorded
+ * concurrently, and read while they are recorded.
+ */
+class stats_collector {
+  public:
+    /** Clock that the system calls are timed with. */
+    using clock = std::chrono::steady_clock;
+
+    /** @return The collector of the process, which get_syscall_stats() reads. */
+    static stats_collector &global();
+
+    /**
+     * Record an ioctl call.
+     *
+     * @param[in] command   The ioctl command.
+     * @param[in] ns        Duration of the call, in nanoseconds.
+     * @param[in] error     True if the call failed.
+     */
+    void add_ioctl(uint64_t command, uint64_t ns, bool error) {
+        for (size_t i = 0; i < ioctl_commands_.size(); ++i) {
+            uint64_t slot_command = ioctl_commands_[i].load(std::memory_order_acquire);
+
+            // An empty slot is claimed by the first command that reaches it
+            if (slot_command == empty_slot &&
+                ioctl_commands_[i].compare_exchange_strong(slot_command, command, std::memory_order_acq_rel))
+                slot_command = command;
+
+            if (slot_command == command) {
+                ioctls_[i].add(ns, error);
+                return;
+            }
+        }
+
+        other_ioctls_.add(ns, error);
+    }
+
+    /** Record a poll call. @copydetails add_mmap */
+    void add_poll(uint64_t ns, bool error) { poll_.add(ns, error); }
+
+    /**
+     * Record a mmap call.
+     *
+     * @param[in] ns        Duration of the call, in nanoseconds.
+     * @param[in] error     True if the call failed.
+     */
+    void add_mmap(uint64_t ns, bool error) { mmap_.add(ns, error); }
+
+    /** Record a munmap call. @copydetails add_mmap */
+    void add_munmap(uint64_t ns, bool error) { munmap_.add(ns, error); }
+
+    /** @return The statistics collected. */
+    syscall_stats read() const {
+        syscall_stats result{};
+
+        for (size_t i = 0; i < ioctl_commands_.size(); ++i) {
+            const uint64_t command = ioctl_commands_[i].load(std::memory_order_acquire);
+            if (command == empty_slot)
+                break;
+
+            auto &entry = result.ioctls[result.num_ioctls++];
+            entry.command = command;
+            entry.stats = ioctls_[i].read();
+        }
+
+        result.other_ioctls = other_ioctls_.read();
+        result.poll = poll_.read();
+        result.mmap = mmap_.read();
+        result.munmap = munmap_.read();
+        return result;
+    }
+
+    /**
+     * Reset the statistics.
+     *
+     * The calls recorded while the statistics are reset may be lost.
+     */
+    void reset() {
+        for (size_t i = 0; i < ioctl_commands_.size(); ++i) {
+            ioctls_[i].reset();
+            ioctl_commands_[i].store(empty_slot, std::memory_order_release);
+        }
+
+        other_ioctls_.reset();
+        poll_.reset();
+        mmap_.reset();
+        munmap_.reset();
+    }
+
+  private:
+    /** Command of the ioctl slots that are not used yet. */
+    static constexpr uint64_t empty_slot = 0;
+
+    /** Statistics of a kind of system call. */
+    struct counter {
+        std::atomic<uint64_t> count{};
+        std::atomic<uint64_t> errors{};
+        std::atomic<uint64_t> total_ns{};
+        std::atomic<uint64_t> max_ns{};
+
+        void add(uint64_t ns, bool error) {
+            count.fetch_add(1, std::memory_order_relaxed);
+            if (error)
+                errors.fetch_add(1, std::memory_order_relaxed);
+            total_ns.fetch_add(ns, std::memory_order_relaxed);
+
+            uint64_t max = max_ns.load(std::memory_order_relaxed);
+            while (ns > max && !max_ns.compare_exchange_weak(max, ns, std::memory_order_relaxed)) {
+            }
+        }
+
+        syscall_call_stats read() const {
+            return {count.load(std::memory_order_relaxed), errors.load(std::memory_order_relaxed),
+                    total_ns.load(std::memory_order_relaxed), max_ns.load(std::memory_order_relaxed)};
+        }
+
+        void reset() {
+            count.store(0, std::memory_order_relaxed);
+            errors.store(0, std::memory_order_relaxed);
+            total_ns.store(0, std::memory_order_relaxed);
+            max_ns.store(0, std::memory_order_relaxed);
+        }
+    };
+
+    std::array<std::atomic<uint64_t>, max_syscall_ioctl_commands> ioctl_commands_{};
+    std::array<counter, max_syscall_ioctl_commands> ioctls_{};
+    counter other_ioctls_{};
+    counter poll_{};
+    counter mmap_{};
+    counter munmap_{};
+};
+
+/**
+ * System calls interface that forwards every call to another interface, and
+ * counts and times the ioctl, poll, mmap and munmap calls in
+ * stats_collector::global().
+ *
+ * When the library is built with `HWCPIPE_SYSCALL_STATS`, `syscall::iface`
+ * is an instrumenting interface, and get_syscall_stats() returns what it
+ * collected. Like the interface it wraps, it is an empty class if that
+ * interface is empty.
+ *
+ * @tparam syscall_iface_t The interface to forward the calls to.
+ */
+template <typename syscall_iface_t>
+class instrumenting_iface : private syscall_iface_t {
+  public:
+    /** Default constructor. */
+    instrumenting_iface() = default;
+
+    /**
+     * Constructor.
+     *
+     * @param[in] iface     Interface to forward the calls to.
+     */
+    explicit instrumenting_iface(const syscall_iface_t &iface)
+        : syscall_iface_t(iface) {}
+
+    /** @copydoc detail::iface::open */
+    std::pair<std::error_code, int> open(const char *name, int oflags) const {
+        return get_syscall_iface().open(name, oflags);
+    }
+
+    /** @copydoc detail::iface::is_char_device */
+    std::pair<std::error_code, bool> is_char_device(int fd) const { return get_syscall_iface().is_char_device(fd); }
+
+    /** @copydoc detail::iface::close */
+    std::error_code close(int fd) const { return get_syscall_iface().close(fd); }
+
+    /** @copydoc detail::iface::mmap */
+    std::pair<std::error_code, void *> mmap(void *addr, size_t len, int prot, int flags, int fd, off_t off) const {
+        const auto begin = stats_collector::clock::now();
+        const auto result = get_syscall_iface().mmap(addr, len, prot, flags, fd, off);
+        stats_collector::global().add_mmap(elapsed_ns(begin), !!result.first);
+
+        return result;
+    }
+
+    /** @copydoc detail::iface::munmap */
+    std::error_code munmap(void *addr, size_t len) const {
+        const auto begin = stats_collector::clock::now();
+        const auto ec = get_syscall_iface().munmap(addr, len);
+        stats_collector::global().add_munmap(elapsed_ns(begin), !!ec);
+
+        return ec;
+    }
+
+    /** @copydoc detail::iface::ioctl */
+    template <typename command_t, typename... args_t>
+    std::pair<std::error_code, int> ioctl(int fd, command_t command, args_t &&...args) const {
+        const auto begin = stats_collector::clock::now();
+        const auto result = get_syscall_iface().ioctl(fd, command, std::forward<args_t>(args)...);
+        stats_collector::global().add_ioctl(static_cast<uint64_t>(command), elapsed_ns(begin), !!result.first);
+
+        return result;
+    }
+
+    /** @copydoc detail::iface::poll */
+    std::pair<std::error_code, int> poll(struct pollfd *fds, nfds_t nfds, int timeout) const {
+        const auto begin = stats_collector::clock::now();
+        const auto result = get_syscall_iface().poll(fds, nfds, timeout);
+        stats_collector::global().add_poll(elapsed_ns(begin), !!result.first);
+
+        return result;
+    }
+
+    /** @copydoc detail::iface::epoll_create1 */
+    std::pair<std::error_code, int> epoll_create1(int flags) const { return get_syscall_iface().epoll_create1(flags); }
+
+    /** @copydoc detail::iface::epoll_ctl */
+    std::error_code epoll_ctl(int epfd, int op, int fd, struct epoll_event *event) const {
+        return get_syscall_iface().epoll_ctl(epfd, op, fd, event);
+    }
+
+    /**
+     * @copydoc detail::iface::epoll_wait
+     *
+     * The call waits for samples like poll does, so it is recorded as a poll call.
+     */
+    std::pair<std::error_code, int> epoll_wait(int epfd, struct epoll_event *events, int maxevents,
+                                               int timeout) const {
+        const auto begin = stats_collector::clock::now();
+        const auto result = get_syscall_iface().epoll_wait(epfd, events, maxevents, timeout);
+        stats_collector::global().add_poll(elapsed_ns(begin), !!result.first);
+
+        return result;
+    }
+
+    /** @copydoc detail::iface::read */
+    std::pair<std::error_code, ssize_t> read(int fd, void *buf, size_t count) const {
+        return get_syscall_iface().read(fd, buf, count);
+    }
+
+    /** @copydoc detail::iface::write */
+    std::pair<std::error_code, ssize_t> write(int fd, const void *buf, size_t count) const {
+        return get_syscall_iface().write(fd, buf, count);
+    }
+
+    /** @copydoc detail::iface::eventfd */
+    std::pair<std::error_code, int> eventfd(unsigned int initval, int flags) const {
+        return get_syscall_iface().eventfd(initval, flags);
+    }
+
+    /** @copydoc detail::iface::timerfd_create */
+    std::pair<std::error_code, int> timerfd_create(int clockid, int flags) const {
+        return get_syscall_iface().timerfd_create(clockid, flags);
+    }
+
+    /** @copydoc detail::iface::timerfd_settime */
+    std::error_code timerfd_settime(int fd, int flags, const struct itimerspec *value) const {
+        return get_syscall_iface().timerfd_settime(fd, flags, value);
+    }
+
+    /** @copydoc detail::iface::sched_setscheduler */
+    std::error_code sched_setscheduler(pid_t pid, int policy, const struct sched_param *param) const {
+        return get_syscall_iface().sched_setscheduler(pid, policy, param);
+    }
+
+    /** @copydoc detail::iface::sched_setaffinity */
+    std::error_code sched_setaffinity(pid_t pid, size_t size, const cpu_set_t *mask) const {
+        return get_syscall_iface().sched_setaffinity(pid, size, mask);
+    }
+
+    /** @copydoc detail::iface::setpriority */
+    std::error_code setpriority(int which, id_t who, int prio) const {
+        return get_syscall_iface().setpriority(which, who, prio);
+    }
+
+  private:
+    syscall_iface_t &get_syscall_iface() const {
+        // The wrapped interfaces are not const correct, a stateful interface keeps its state elsewhere
+        return const_cast<instrumenting_iface &>(*this);
+    }
+
+    static uint64_t elapsed_ns(stats_collector::clock::time_point begin) {
+        const auto elapsed = stats_collector::clock::now() - begin;
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    }
+};
+
+} // namespace syscall
+} // namespace device
+} // namespace hwcpipe
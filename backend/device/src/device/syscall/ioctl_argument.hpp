@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file ioctl_argument.hpp Access to the memory an ioctl argument refers to.
+ */
+
+#pragma once
+
+#include <device/ioctl/kbase/types.hpp>
+
+#include <cstddef>
+#include <utility>
+
+namespace hwcpipe {
+namespace device {
+namespace syscall {
+namespace detail {
+
+/** Memory that an ioctl argument points to. */
+using buffer_type = std::pair<void *, size_t>;
+
+/**
+ * Get the buffer an ioctl argument points to, which the kernel writes.
+ *
+ * @param[in] arg   ioctl argument.
+ * @return The buffer, or an empty buffer if the argument has none.
+ */
+template <typename value_t>
+inline buffer_type indirect_buffer(const value_t * /* arg */) {
+    return {nullptr, 0};
+}
+
+/** @copydoc indirect_buffer */
+inline buffer_type indirect_buffer(const ioctl::kbase::get_gpuprops *arg) {
+    if (!arg->buffer)
+        return {nullptr, 0};
+
+    return {arg->buffer.get(), arg->size};
+}
+
+/** @copydoc indirect_buffer */
+inline buffer_type indirect_buffer(const ioctl::kbase::kinstr_prfcnt_enum_info *arg) {
+    if (!arg->info_list_ptr)
+        return {nullptr, 0};
+
+    return {arg->info_list_ptr.get(), static_cast<size_t>(arg->info_item_size) * arg->info_item_count};
+}
+
+/**
+ * Restore the pointers of an ioctl argument that was overwritten with a
+ * recorded one, since the recorded pointers refer to the recording process.
+ *
+ * @param[in,out] arg     Overwritten ioctl argument.
+ * @param[in]     before  The argument, as passed by the caller.
+ */
+template <typename value_t>
+inline void restore_pointers(value_t * /* arg */, const value_t & /* before */) {}
+
+/** @copydoc restore_pointers */
+inline void restore_pointers(ioctl::kbase::get_gpuprops *arg, const ioctl::kbase::get_gpuprops &before) {
+    arg->buffer = before.buffer;
+}
+
+/** @copydoc restore_pointers */
+inline void restore_pointers(ioctl::kbase::kinstr_prfcnt_enum_info *arg,
+                             const ioctl::kbase::kinstr_prfcnt_enum_info &before) {
+    arg->info_list_ptr = before.info_list_ptr;
+}
+
+} // namespace detail
+} // namespace syscall
+} // namespace device
+} // namespace hwcpipe
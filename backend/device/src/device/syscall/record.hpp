@@ -0,0 +1,330 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file record.hpp System calls recording interface.
+ */
+
+#pragma once
+
+#include "iface.hpp"
+#include "ioctl_argument.hpp"
+#include "transcript.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <linux/ioctl.h>
+#include <poll.h>
+
+namespace hwcpipe {
+namespace device {
+namespace syscall {
+
+namespace detail {
+/** Granularity of the comparison of mappings with their shadow copy. */
+constexpr size_t patch_granule = 64;
+} // namespace detail
+
+/**
+ * Recording state shared by the copies of a recording_iface.
+ *
+ * The recorder keeps a shadow copy of every mapping. After each system call
+ * that may let the kernel write a mapping, the mappings are compared with
+ * their shadow and the bytes that changed are added to the event as patches,
+ * so that a transcript reproduces the samples written to the mapped buffers.
+ */
+class recorder {
+  public:
+    /**
+     * Constructor.
+     *
+     * @param[out] transcript  Transcript to append the system calls to.
+     */
+    explicit recorder(transcript &transcript)
+        : transcript_(transcript) {}
+
+    /** @return The transcript recorded to. */
+    transcript &get_transcript() { return transcript_; }
+
+    /**
+     * Append an event, with the patches of the mappings that changed.
+     *
+     * @param[in] event The event to append.
+     */
+    void add(transcript_event &&event) {
+        for (auto &mapping : mappings_)
+            diff(mapping, event.patches);
+
+        transcript_.events.push_back(std::move(event));
+    }
+
+    /**
+     * Start tracking a mapping.
+     *
+     * @param[in] data  Mapped address.
+     * @param[in] size  Mapping size.
+     * @return Index of the mapping in the transcript.
+     */
+    uint32_t add_mapping(const void *data, size_t size) {
+        mappings_.push_back({next_mapping_, static_cast<const uint8_t *>(data), std::vector<uint8_t>(size)});
+        return next_mapping_++;
+    }
+
+    /**
+     * Stop tracking a mapping.
+     *
+     * @param[in] data  Mapped address.
+     * @return Index of the mapping in the transcript, or -1 if it is unknown.
+     */
+    int64_t remove_mapping(const void *data) {
+        const auto it = std::find_if(mappings_.begin(), mappings_.end(),
+                                     [data](const mapping &m) { return m.data == data; });
+        if (it == mappings_.end())
+            return -1;
+
+        const int64_t index = it->index;
+        mappings_.erase(it);
+        return index;
+    }
+
+  private:
+    struct mapping {
+        uint32_t index;
+        const uint8_t *data;
+        std::vector<uint8_t> shadow;
+    };
+
+    /** Add the ranges of a mapping that changed, and update its shadow. */
+    static void diff(mapping &mapping, std::vector<memory_patch> &patches) {
+        const size_t size = mapping.shadow.size();
+        size_t begin = 0;
+
+        while (begin < size) {
+            const size_t granule = std::min(detail::patch_granule, size - begin);
+            if (std::memcmp(mapping.data + begin, mapping.shadow.data() + begin, granule) == 0) {
+                begin += granule;
+                continue;
+            }
+
+            // coalesce consecutive granules that changed
+            size_t end = begin + granule;
+            while (end < size) {
+                const size_t next = std::min(detail::patch_granule, size - end);
+                if (std::memcmp(mapping.data + end, mapping.shadow.data() + end, next) == 0)
+                    break;
+                end += next;
+            }
+
+            memory_patch patch{};
+            patch.mapping = mapping.index;
+            patch.offset = begin;
+            patch.data.assign(mapping.data + begin, mapping.data + end);
+            std::copy(patch.data.begin(), patch.data.end(), mapping.shadow.begin() + static_cast<ptrdiff_t>(begin));
+            patches.push_back(std::move(patch));
+
+            begin = end;
+        }
+    }
+
+    transcript &transcript_;
+    std::vector<mapping> mappings_;
+    uint32_t next_mapping_{};
+};
+
+/**
+ * System calls interface that forwards every call to another interface and
+ * records it, with its results, into a syscall::recorder.
+ *
+ * It is copyable like the other interfaces, and all the copies record into the
+ * same recorder. A default constructed interface forwards without recording.
+ *
+ * @par Example
+ * @code
+ * syscall::transcript transcript;
+ * syscall::recorder recorder{transcript};
+ * syscall::recording_iface<> iface{recorder};
+ *
+ * auto fd = handle_impl<syscall::recording_iface<>>::open("/dev/mali0", iface);
+ * // ... create an instance and a backend with iface, take samples ...
+ * ec = transcript.save("session.hwcs");
+ * @endcode
+ *
+ * @tparam syscall_iface_t The interface to forward the calls to.
+ */
+template <typename syscall_iface_t = iface>
+class recording_iface {
+  public:
+    /** Default constructor. */
+    recording_iface() = default;
+
+    /**
+     * Constructor.
+     *
+     * @param[in] recorder  Recorder to record the calls into.
+     * @param[in] iface     Interface to forward the calls to.
+     */
+    explicit recording_iface(recorder &recorder, const syscall_iface_t &iface = {})
+        : iface_(iface)
+        , recorder_(&recorder) {}
+
+    /** @copydoc detail::iface::open */
+    std::pair<std::error_code, int> open(const char *name, int oflags) const {
+        const auto result = get_syscall_iface().open(name, oflags);
+
+        if (recorder_ != nullptr) {
+            // open has no file descriptor argument, the result is the file descriptor
+            auto event = make_event(transcript_event::kind::open, -1, result.first, result.second);
+            event.request = static_cast<uint64_t>(oflags);
+            event.argument.assign(name, name + std::strlen(name));
+            recorder_->add(std::move(event));
+        }
+
+        return result;
+    }
+
+    /** @copydoc detail::iface::is_char_device */
+    std::pair<std::error_code, bool> is_char_device(int fd) const {
+        const auto result = get_syscall_iface().is_char_device(fd);
+
+        if (recorder_ != nullptr)
+            recorder_->add(make_event(transcript_event::kind::is_char_device, fd, result.first, result.second));
+
+        return result;
+    }
+
+    /** @copydoc detail::iface::close */
+    std::error_code close(int fd) const {
+        const auto ec = get_syscall_iface().close(fd);
+
+        if (recorder_ != nullptr)
+            recorder_->add(make_event(transcript_event::kind::close, fd, ec, 0));
+
+        return ec;
+    }
+
+    /** @copydoc detail::iface::mmap */
+    std::pair<std::error_code, void *> mmap(void *addr, size_t len, int prot, int flags, int fd, off_t off) const {
+        const auto result = get_syscall_iface().mmap(addr, len, prot, flags, fd, off);
+
+        if (recorder_ != nullptr) {
+            const int64_t index = result.first ? -1 : recorder_->add_mapping(result.second, len);
+            auto event = make_event(transcript_event::kind::mmap, fd, result.first, index);
+            event.request = len;
+            event.value = static_cast<uint64_t>(off);
+            recorder_->add(std::move(event));
+        }
+
+        return result;
+    }
+
+    /** @copydoc detail::iface::munmap */
+    std::error_code munmap(void *addr, size_t len) const {
+        const int64_t index = recorder_ != nullptr ? recorder_->remove_mapping(addr) : -1;
+        const auto ec = get_syscall_iface().munmap(addr, len);
+
+        if (recorder_ != nullptr) {
+            auto event = make_event(transcript_event::kind::munmap, -1, ec, index);
+            event.request = len;
+            recorder_->add(std::move(event));
+        }
+
+        return ec;
+    }
+
+    /** @copydoc detail::iface::ioctl */
+    template <typename command_t, typename arg_t>
+    std::pair<std::error_code, int> ioctl(int fd, command_t command, arg_t &&arg) const {
+        const auto result = get_syscall_iface().ioctl(fd, command, arg);
+
+        if (recorder_ != nullptr) {
+            auto event = make_event(transcript_event::kind::ioctl, fd, result.first, result.second);
+            event.request = static_cast<uint64_t>(command);
+            capture(event, arg);
+            recorder_->add(std::move(event));
+        }
+
+        return result;
+    }
+
+    /** @copydoc detail::iface::poll */
+    std::pair<std::error_code, int> poll(struct pollfd *fds, nfds_t nfds, int timeout) const {
+        const auto result = get_syscall_iface().poll(fds, nfds, timeout);
+
+        if (recorder_ != nullptr) {
+            auto event = make_event(transcript_event::kind::poll, nfds != 0 ? fds[0].fd : -1, result.first,
+                                    result.second);
+            event.request = static_cast<uint64_t>(static_cast<int64_t>(timeout));
+            const auto *begin = reinterpret_cast<const uint8_t *>(fds);
+            event.argument.assign(begin, begin + nfds * sizeof(*fds));
+            recorder_->add(std::move(event));
+        }
+
+        return result;
+    }
+
+  private:
+    syscall_iface_t &get_syscall_iface() const { return iface_; }
+
+    static transcript_event make_event(transcript_event::kind type, int fd, std::error_code ec, int64_t result) {
+        transcript_event event{};
+        event.type = type;
+        event.fd = fd;
+        event.error = ec.value();
+        event.result = result;
+        return event;
+    }
+
+    /** Capture an argument that points to a structure. */
+    template <typename value_t>
+    static void capture(transcript_event &event, value_t *arg) {
+        const auto *begin = reinterpret_cast<const uint8_t *>(arg);
+        event.argument.assign(begin, begin + sizeof(value_t));
+
+        const auto buffer = detail::indirect_buffer(arg);
+        const auto *indirect = static_cast<const uint8_t *>(buffer.first);
+        if (indirect != nullptr)
+            event.indirect.assign(indirect, indirect + buffer.second);
+    }
+
+    /** Capture an argument passed by value. */
+    template <typename value_t, typename = std::enable_if_t<!std::is_pointer<value_t>::value>>
+    static void capture(transcript_event &event, value_t arg) {
+        event.value = static_cast<uint64_t>(arg);
+    }
+
+    // calls on a const interface are recorded too, as with the other interfaces
+    mutable syscall_iface_t iface_{};
+    recorder *recorder_{};
+};
+
+} // namespace syscall
+} // namespace device
+} // namespace hwcpipe
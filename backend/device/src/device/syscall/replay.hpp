@@ -0,0 +1,348 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file replay.hpp System calls replay interface.
+ */
+
+#pragma once
+
+#include "ioctl_argument.hpp"
+#include "transcript.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <linux/ioctl.h>
+#include <poll.h>
+#include <sys/mman.h>
+#include <sys/types.h>
+
+namespace hwcpipe {
+namespace device {
+namespace syscall {
+
+/**
+ * Replay state shared by the copies of a replaying_iface.
+ *
+ * The player returns the recorded system calls in order. Each call must match
+ * the next event of the transcript: same system call, file descriptor, and
+ * request. Otherwise the replay has diverged, and every call fails with
+ * std::errc::protocol_error from then on.
+ */
+class player {
+  public:
+    /**
+     * Constructor.
+     *
+     * @param[in] transcript  Transcript to replay. It must outlive the player.
+     */
+    explicit player(const transcript &transcript)
+        : transcript_(transcript) {}
+
+    /** @return True if the replay diverged from the transcript. */
+    bool diverged() const { return diverged_; }
+
+    /** @return Index of the next event to replay. */
+    size_t position() const { return position_; }
+
+    /** @return True if every event was replayed. */
+    bool at_end() const { return position_ == transcript_.events.size(); }
+
+    /**
+     * Take the next event, if it matches a call.
+     *
+     * @param[in] type    System call type.
+     * @param[in] fd      File descriptor argument.
+     * @param[in] request open flags, mmap length or ioctl command.
+     * @return The event, or nullptr if the call diverged.
+     */
+    const transcript_event *next(transcript_event::kind type, int fd, uint64_t request) {
+        if (diverged_ || at_end()) {
+            diverged_ = true;
+            return nullptr;
+        }
+
+        const auto &event = transcript_.events[position_];
+        if (event.type != type || event.fd != fd || event.request != request) {
+            diverged_ = true;
+            return nullptr;
+        }
+
+        ++position_;
+        return &event;
+    }
+
+    /**
+     * Take the next event, that does not have a request to match.
+     *
+     * @param[in] type    System call type.
+     * @param[in] fd      File descriptor argument.
+     * @return The event, or nullptr if the call diverged.
+     */
+    const transcript_event *next(transcript_event::kind type, int fd) {
+        if (!diverged_ && !at_end())
+            return next(type, fd, transcript_.events[position_].request);
+
+        diverged_ = true;
+        return nullptr;
+    }
+
+    /**
+     * Create the memory of a mapping.
+     *
+     * @param[in] index Index of the mapping in the transcript.
+     * @param[in] size  Mapping size.
+     * @return The mapped address.
+     */
+    void *add_mapping(uint32_t index, size_t size) {
+        mapping m{index, {}, size};
+        m.words.resize((size + sizeof(uint64_t) - 1) / sizeof(uint64_t));
+        mappings_.push_back(std::move(m));
+        return mappings_.back().words.data();
+    }
+
+    /**
+     * Release the memory of a mapping.
+     *
+     * @param[in] data  Mapped address.
+     * @return Index of the mapping, or -1 if it is unknown.
+     */
+    int64_t remove_mapping(const void *data) {
+        const auto it = std::find_if(mappings_.begin(), mappings_.end(),
+                                     [data](const mapping &m) { return m.words.data() == data; });
+        if (it == mappings_.end())
+            return -1;
+
+        const int64_t index = it->index;
+        mappings_.erase(it);
+        return index;
+    }
+
+    /**
+     * Write the patches of an event to the mappings.
+     *
+     * @param[in] event The event replayed.
+     */
+    void apply(const transcript_event &event) {
+        for (const auto &patch : event.patches) {
+            const auto it = std::find_if(mappings_.begin(), mappings_.end(),
+                                         [&patch](const mapping &m) { return m.index == patch.mapping; });
+            if (it == mappings_.end() || patch.offset > it->size || patch.data.size() > it->size - patch.offset) {
+                diverged_ = true;
+                continue;
+            }
+
+            std::memcpy(reinterpret_cast<uint8_t *>(it->words.data()) + patch.offset, patch.data.data(),
+                        patch.data.size());
+        }
+    }
+
+  private:
+    struct mapping {
+        uint32_t index;
+        std::vector<uint64_t> words;
+        size_t size;
+    };
+
+    const transcript &transcript_;
+    std::vector<mapping> mappings_;
+    size_t position_{};
+    bool diverged_{};
+};
+
+/**
+ * System calls interface that reproduces a recorded transcript, so that the
+ * hardware counters backends can run deterministically without a GPU. No
+ * system call is made: file descriptors are the recorded ones, and mappings
+ * are memory owned by the syscall::player, written with the recorded
+ * contents.
+ *
+ * It is copyable like the other interfaces, and all the copies replay from
+ * the same player. A default constructed interface fails every call.
+ */
+class replaying_iface {
+  public:
+    /** Default constructor. */
+    replaying_iface() = default;
+
+    /**
+     * Constructor.
+     *
+     * @param[in] player  Player to replay the calls from.
+     */
+    explicit replaying_iface(player &player)
+        : player_(&player) {}
+
+    /** @copydoc detail::iface::open */
+    std::pair<std::error_code, int> open(const char * /* name */, int oflags) const {
+        const auto *event = next(transcript_event::kind::open, -1, static_cast<uint64_t>(oflags));
+        if (event == nullptr)
+            return std::make_pair(diverged(), -1);
+
+        return std::make_pair(error(*event), static_cast<int>(event->result));
+    }
+
+    /** @copydoc detail::iface::is_char_device */
+    std::pair<std::error_code, bool> is_char_device(int fd) const {
+        const auto *event = next(transcript_event::kind::is_char_device, fd);
+        if (event == nullptr)
+            return std::make_pair(diverged(), false);
+
+        return std::make_pair(error(*event), event->result != 0);
+    }
+
+    /** @copydoc detail::iface::close */
+    std::error_code close(int fd) const {
+        const auto *event = next(transcript_event::kind::close, fd);
+        if (event == nullptr)
+            return diverged();
+
+        return error(*event);
+    }
+
+    /** @copydoc detail::iface::mmap */
+    std::pair<std::error_code, void *> mmap(void * /* addr */, size_t len, int /* prot */, int /* flags */, int fd,
+                                            off_t off) const {
+        const auto *event = next(transcript_event::kind::mmap, fd, len);
+        if (event == nullptr || event->value != static_cast<uint64_t>(off))
+            return std::make_pair(diverged(), MAP_FAILED);
+
+        if (event->error != 0)
+            return std::make_pair(error(*event), MAP_FAILED);
+
+        void *data = player_->add_mapping(static_cast<uint32_t>(event->result), len);
+        player_->apply(*event);
+        return std::make_pair(std::error_code{}, data);
+    }
+
+    /** @copydoc detail::iface::munmap */
+    std::error_code munmap(void *addr, size_t len) const {
+        const auto *event = next(transcript_event::kind::munmap, -1, len);
+        if (event == nullptr || player_->remove_mapping(addr) != event->result)
+            return diverged();
+
+        return error(*event);
+    }
+
+    /** @copydoc detail::iface::ioctl */
+    template <typename command_t, typename arg_t>
+    std::pair<std::error_code, int> ioctl(int fd, command_t command, arg_t &&arg) const {
+        const auto *event = next(transcript_event::kind::ioctl, fd, static_cast<uint64_t>(command));
+        if (event == nullptr || !restore(*event, static_cast<uint64_t>(command), arg))
+            return std::make_pair(diverged(), -1);
+
+        player_->apply(*event);
+        return std::make_pair(error(*event), static_cast<int>(event->result));
+    }
+
+    /** @copydoc detail::iface::poll */
+    std::pair<std::error_code, int> poll(struct pollfd *fds, nfds_t nfds, int /* timeout */) const {
+        const auto *event = next(transcript_event::kind::poll, nfds != 0 ? fds[0].fd : -1);
+        if (event == nullptr || event->argument.size() != nfds * sizeof(*fds))
+            return std::make_pair(diverged(), -1);
+
+        // only the returned events are taken from the recording
+        for (nfds_t i = 0; i != nfds; ++i) {
+            pollfd recorded{};
+            std::memcpy(&recorded, event->argument.data() + i * sizeof(recorded), sizeof(recorded));
+            fds[i].revents = recorded.revents;
+        }
+
+        player_->apply(*event);
+        return std::make_pair(error(*event), static_cast<int>(event->result));
+    }
+
+  private:
+    const transcript_event *next(transcript_event::kind type, int fd, uint64_t request) const {
+        if (player_ == nullptr)
+            return nullptr;
+
+        return player_->next(type, fd, request);
+    }
+
+    const transcript_event *next(transcript_event::kind type, int fd) const {
+        if (player_ == nullptr)
+            return nullptr;
+
+        return player_->next(type, fd);
+    }
+
+    static std::error_code diverged() { return std::make_error_code(std::errc::protocol_error); }
+
+    static std::error_code error(const transcript_event &event) {
+        if (event.error == 0)
+            return {};
+
+        return {event.error, std::generic_category()};
+    }
+
+    /** Restore an argument that points to a structure the kernel writes. */
+    template <typename value_t>
+    static bool restore(const transcript_event &event, uint64_t command, value_t *arg) {
+        if (event.argument.size() != sizeof(value_t))
+            return false;
+
+        const auto buffer = detail::indirect_buffer(arg);
+        if (buffer.first != nullptr)
+            std::memcpy(buffer.first, event.indirect.data(), std::min(buffer.second, event.indirect.size()));
+
+        restore_argument(event, command, arg);
+        return true;
+    }
+
+    template <typename value_t>
+    static std::enable_if_t<!std::is_const<value_t>::value> restore_argument(const transcript_event &event,
+                                                                            uint64_t command, value_t *arg) {
+        if ((_IOC_DIR(command) & _IOC_READ) == 0)
+            return;
+
+        const value_t before = *arg;
+        std::memcpy(arg, event.argument.data(), sizeof(value_t));
+        detail::restore_pointers(arg, before);
+    }
+
+    template <typename value_t>
+    static std::enable_if_t<std::is_const<value_t>::value> restore_argument(const transcript_event &, uint64_t,
+                                                                           value_t *) {}
+
+    /** Check an argument passed by value. */
+    template <typename value_t, typename = std::enable_if_t<!std::is_pointer<value_t>::value>>
+    static bool restore(const transcript_event &event, uint64_t /* command */, value_t arg) {
+        return event.value == static_cast<uint64_t>(arg);
+    }
+
+    player *player_{};
+};
+
+} // namespace syscall
+} // namespace device
+} // namespace hwcpipe
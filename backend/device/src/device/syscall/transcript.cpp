@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file transcript.cpp Recorded system call transcript.
+ */
+
+#include "transcript.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <memory>
+
+namespace hwcpipe {
+namespace device {
+namespace syscall {
+
+namespace {
+
+/** 'HWCS' in little endian. */
+constexpr uint32_t transcript_magic = 0x53435748;
+/** Incremented for layout changes. */
+constexpr uint32_t transcript_version = 1;
+
+using file_ptr = std::unique_ptr<FILE, int (*)(FILE *)>;
+
+/** Writes little endian scalars and byte arrays. */
+class writer {
+  public:
+    explicit writer(FILE *file)
+        : file_(file) {}
+
+    template <typename value_t>
+    void put(value_t value) {
+        put_bytes(&value, sizeof(value));
+    }
+
+    void put_vector(const std::vector<uint8_t> &bytes) {
+        put<uint64_t>(bytes.size());
+        put_bytes(bytes.data(), bytes.size());
+    }
+
+    bool ok() const { return ok_; }
+
+  private:
+    void put_bytes(const void *data, size_t size) {
+        if (ok_ && size != 0)
+            ok_ = std::fwrite(data, 1, size, file_) == size;
+    }
+
+    FILE *file_;
+    bool ok_{true};
+};
+
+/** Reads what writer wrote. */
+class reader {
+  public:
+    explicit reader(FILE *file)
+        : file_(file) {
+        ok_ = std::fseek(file_, 0, SEEK_END) == 0;
+        const long size = std::ftell(file_);
+        ok_ = ok_ && size >= 0 && std::fseek(file_, 0, SEEK_SET) == 0;
+        remaining_ = ok_ ? static_cast<uint64_t>(size) : 0;
+    }
+
+    template <typename value_t>
+    value_t get() {
+        value_t value{};
+        get_bytes(&value, sizeof(value));
+        return value;
+    }
+
+    std::vector<uint8_t> get_vector() {
+        const auto size = get<uint64_t>();
+        std::vector<uint8_t> bytes;
+        // sizes are checked against the bytes left before allocating
+        if (size > remaining_)
+            ok_ = false;
+        if (ok_) {
+            bytes.resize(size);
+            get_bytes(bytes.data(), bytes.size());
+        }
+        return bytes;
+    }
+
+    bool ok() const { return ok_; }
+
+  private:
+    void get_bytes(void *data, size_t size) {
+        if (!ok_ || size == 0)
+            return;
+        ok_ = size <= remaining_ && std::fread(data, 1, size, file_) == size;
+        remaining_ -= ok_ ? size : 0;
+    }
+
+    FILE *file_;
+    uint64_t remaining_{};
+    bool ok_{};
+};
+
+} // namespace
+
+std::error_code transcript::save(const std::string &path) const {
+    file_ptr file{std::fopen(path.c_str(), "wb"), &std::fclose};
+    if (!file)
+        return std::make_error_code(std::errc::io_error);
+
+    writer out{file.get()};
+    out.put<uint32_t>(transcript_magic);
+    out.put<uint32_t>(transcript_version);
+    out.put<uint64_t>(events.size());
+
+    for (const auto &event : events) {
+        out.put<uint8_t>(static_cast<uint8_t>(event.type));
+        out.put<int32_t>(event.fd);
+        out.put<int32_t>(event.error);
+        out.put<int64_t>(event.result);
+        out.put<uint64_t>(event.request);
+        out.put<uint64_t>(event.value);
+        out.put_vector(event.argument);
+        out.put_vector(event.indirect);
+        out.put<uint64_t>(event.patches.size());
+        for (const auto &patch : event.patches) {
+            out.put<uint32_t>(patch.mapping);
+            out.put<uint64_t>(patch.offset);
+            out.put_vector(patch.data);
+        }
+    }
+
+    if (!out.ok() || std::fflush(file.get()) != 0)
+        return std::make_error_code(std::errc::io_error);
+
+    return {};
+}
+
+std::pair<std::error_code, transcript> transcript::load(const std::string &path) {
+    file_ptr file{std::fopen(path.c_str(), "rb"), &std::fclose};
+    if (!file)
+        return std::make_pair(std::make_error_code(std::errc::io_error), transcript{});
+
+    reader in{file.get()};
+    transcript result{};
+    if (in.get<uint32_t>() != transcript_magic || in.get<uint32_t>() != transcript_version)
+        return std::make_pair(std::make_error_code(std::errc::invalid_argument), transcript{});
+
+    const auto num_events = in.get<uint64_t>();
+    for (uint64_t i = 0; i != num_events && in.ok(); ++i) {
+        transcript_event event{};
+        const auto type = in.get<uint8_t>();
+        if (type > static_cast<uint8_t>(transcript_event::kind::poll))
+            return std::make_pair(std::make_error_code(std::errc::invalid_argument), transcript{});
+
+        event.type = static_cast<transcript_event::kind>(type);
+        event.fd = in.get<int32_t>();
+        event.error = in.get<int32_t>();
+        event.result = in.get<int64_t>();
+        event.request = in.get<uint64_t>();
+        event.value = in.get<uint64_t>();
+        event.argument = in.get_vector();
+        event.indirect = in.get_vector();
+
+        const auto num_patches = in.get<uint64_t>();
+        for (uint64_t j = 0; j != num_patches && in.ok(); ++j) {
+            memory_patch patch{};
+            patch.mapping = in.get<uint32_t>();
+            patch.offset = in.get<uint64_t>();
+            patch.data = in.get_vector();
+            event.patches.push_back(std::move(patch));
+        }
+        result.events.push_back(std::move(event));
+    }
+
+    if (!in.ok())
+        return std::make_pair(std::make_error_code(std::errc::invalid_argument), transcript{});
+
+    return std::make_pair(std::error_code{}, std::move(result));
+}
+
+} // namespace syscall
+} // namespace device
+} // namespace hwcpipe
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file transcript.hpp Recorded system call transcript.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace hwcpipe {
+namespace device {
+namespace syscall {
+
+/** Bytes written to a mapping during a system call. */
+struct memory_patch {
+    /** Index of the mapping, in mmap order. */
+    uint32_t mapping{};
+    /** Offset of the bytes within the mapping. */
+    uint64_t offset{};
+    /** The bytes written. */
+    std::vector<uint8_t> data;
+};
+
+/** One recorded system call, with every result the caller could observe. */
+struct transcript_event {
+    /** System call type. */
+    enum class kind : uint8_t {
+        /** open wrapper call. */
+        open,
+        /** is_char_device wrapper call. */
+        is_char_device,
+        /** close wrapper call. */
+        close,
+        /** mmap wrapper call. */
+        mmap,
+        /** munmap wrapper call. */
+        munmap,
+        /** ioctl wrapper call. */
+        ioctl,
+        /** poll wrapper call. */
+        poll,
+    };
+
+    /** The system call. */
+    kind type{};
+    /** The file descriptor argument, the first polled one for poll, -1 for open and munmap. */
+    int32_t fd{};
+    /** errno value of the call, zero on success. */
+    int32_t error{};
+    /**
+     * The result: the file descriptor returned by open, the boolean of
+     * is_char_device, the mapping index of mmap, the return value of ioctl
+     * and poll.
+     */
+    int64_t result{};
+    /** open flags, mmap length, ioctl command or poll timeout. */
+    uint64_t request{};
+    /** mmap offset, or the ioctl argument when it is passed by value. */
+    uint64_t value{};
+    /**
+     * The path passed to open, the ioctl argument pointed to, or the pollfd
+     * array, as they were after the call.
+     */
+    std::vector<uint8_t> argument;
+    /** The buffer that an ioctl argument points to, after the call. */
+    std::vector<uint8_t> indirect;
+    /** The mapped memory that changed during the call. */
+    std::vector<memory_patch> patches;
+};
+
+/**
+ * A system call transcript. It is recorded by a syscall::recorder on a real
+ * device and reproduced by a syscall::player, e.g. to test and benchmark the
+ * hardware counters backends on hosts without a Mali GPU.
+ */
+class transcript {
+  public:
+    /** The recorded system calls, in call order. */
+    std::vector<transcript_event> events;
+
+    /**
+     * Save the transcript to a file.
+     *
+     * @param[in] path  File path.
+     * @return Error code.
+     */
+    std::error_code save(const std::string &path) const;
+
+    /**
+     * Load a transcript from a file.
+     *
+     * @param[in] path  File path.
+     * @return A pair of error code and the transcript loaded.
+     */
+    static std::pair<std::error_code, transcript> load(const std::string &path);
+};
+
+} // namespace syscall
+} // namespace device
+} // namespace hwcpipe
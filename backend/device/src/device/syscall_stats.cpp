@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file syscall_stats.cpp System call statistics.
+ */
+
+#include "syscall/instrumenting_iface.hpp"
+
+#include <device/syscall_stats.hpp>
+
+namespace hwcpipe {
+namespace device {
+namespace syscall {
+
+stats_collector &stats_collector::global() {
+    static stats_collector collector;
+    return collector;
+}
+
+} // namespace syscall
+
+syscall_stats get_syscall_stats() {
+#if defined(HWCPIPE_SYSCALL_STATS)
+    auto result = syscall::stats_collector::global().read();
+    result.enabled = true;
+    return result;
+#else
+    return {};
+#endif
+}
+
+void reset_syscall_stats() { syscall::stats_collector::global().reset(); }
+
+} // namespace device
+} // namespace hwcpipe
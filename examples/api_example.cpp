@@ -48,6 +48,9 @@ void print_sample_value(const hwcpipe::counter_sample &sample) {
 int main() {
     // Detect all GPUs & print some info
     for (const auto &gpu : hwcpipe::find_gpus()) {
+        if (!gpu) {
+            continue;
+        }
         std::cout << "------------------------------------------------------------\n"
                   << " GPU Device " << gpu.get_device_number() << ":\n"
                   << "------------------------------------------------------------\n";
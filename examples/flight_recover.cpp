@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*
+ * Recovers the samples of a flight recording, e.g. after the application
+ * crashed or the GPU hung, and prints them as CSV, oldest first.
+ *
+ * Usage: hwcpipe-flight-recover <recording>
+ */
+
+#include <hwcpipe/counter_database.hpp>
+#include <hwcpipe/flight_recorder.hpp>
+
+#include <iomanip>
+#include <iostream>
+#include <limits>
+
+int main(int argc, char **argv) {
+    if (argc != 2) {
+        std::cerr << "Usage: " << argv[0] << " <recording>" << std::endl;
+        return -1;
+    }
+
+    const hwcpipe::flight_record_file file(argv[1]);
+    if (!file) {
+        std::cerr << argv[1] << ": " << file.get_error().message() << std::endl;
+        return -1;
+    }
+
+    const auto &reader = file.get_reader();
+    std::cout << "sample,timestamp_ns";
+    for (size_t i = 0; i != reader.num_counters(); ++i) {
+        hwcpipe::counter_metadata metadata{};
+        if (hwcpipe::counter_database{}.describe_counter(reader.get_counter(i), metadata)) {
+            std::cout << ",counter " << reader.get_counter(i);
+        } else {
+            std::cout << "," << metadata.name << " (" << metadata.units << ")";
+        }
+    }
+    std::cout << "\n" << std::setprecision(std::numeric_limits<double>::max_digits10);
+
+    for (size_t i = 0; i != reader.num_records(); ++i) {
+        const auto record = reader.get_record(i);
+        std::cout << record.sequence << "," << record.timestamp;
+        for (size_t k = 0; k != reader.num_counters(); ++k) {
+            std::cout << "," << reader.get_value(i, k);
+        }
+        std::cout << "\n";
+    }
+
+    std::cerr << "Recovered " << reader.num_records() << " of " << reader.capacity() << " samples" << std::endl;
+    return 0;
+}
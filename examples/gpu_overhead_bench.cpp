@@ -0,0 +1,469 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*
+ * A GPU-side overhead benchmark: it runs a reference GLES compute workload
+ * and measures its throughput, in dispatches per second, with and without
+ * counter sampling, at a sweep of sample rates and counter set sizes, in
+ * manual and periodic mode. Each sampled run is paired with an unsampled run
+ * just before it, so that thermal throttling and DVFS drift cancel out, and
+ * the throughput lost to the counter dumps is reported as a percentage.
+ *
+ * EGL and GLES are loaded at run time, so the benchmark has no build time
+ * dependency on a graphics driver. The workload runs on the main thread and
+ * the sampler on its own thread.
+ *
+ * The results are printed as CSV, one run per line.
+ *
+ * Usage: hwcpipe-gpu-overhead-bench [run duration in ms] [device number] [work groups per dispatch]
+ */
+
+#include <device/handle.hpp>
+#include <device/instance.hpp>
+#include <hwcpipe/counter_database.hpp>
+#include <hwcpipe/error.hpp>
+#include <hwcpipe/gpu.hpp>
+#include <hwcpipe/sampler.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <initializer_list>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include <dlfcn.h>
+
+namespace {
+using clock_type = std::chrono::steady_clock;
+
+/** Sample rates of the sweep, in Hz. Zero samples as fast as possible. */
+constexpr uint64_t manual_rates[] = {10, 100, 1000, 0};
+constexpr uint64_t periodic_rates[] = {10, 100, 1000};
+
+/** Counter set sizes of the sweep. Zero selects every supported counter. */
+constexpr size_t counter_set_sizes[] = {1, 8, 32, 0};
+
+/** The few EGL and GLES 3.1 entry points and enumerants the workload uses. */
+namespace gl {
+using egl_display = void *;
+using egl_config = void *;
+using egl_context = void *;
+using egl_surface = void *;
+
+constexpr int32_t egl_none = 0x3038;
+constexpr int32_t egl_renderable_type = 0x3040;
+constexpr int32_t egl_surface_type = 0x3033;
+constexpr int32_t egl_pbuffer_bit = 0x0001;
+constexpr int32_t egl_opengl_es3_bit = 0x0040;
+constexpr int32_t egl_width = 0x3057;
+constexpr int32_t egl_height = 0x3056;
+constexpr int32_t egl_context_major_version = 0x3098;
+constexpr int32_t egl_context_minor_version = 0x30FB;
+constexpr uint32_t egl_opengl_es_api = 0x30A0;
+
+constexpr uint32_t compute_shader = 0x91B9;
+constexpr uint32_t shader_storage_buffer = 0x90D2;
+constexpr uint32_t dynamic_copy = 0x88EA;
+constexpr uint32_t compile_status = 0x8B81;
+constexpr uint32_t link_status = 0x8B82;
+
+struct api {
+    egl_display (*get_display)(void *);
+    uint32_t (*initialize)(egl_display, int32_t *, int32_t *);
+    uint32_t (*bind_api)(uint32_t);
+    uint32_t (*choose_config)(egl_display, const int32_t *, egl_config *, int32_t, int32_t *);
+    egl_context (*create_context)(egl_display, egl_config, egl_context, const int32_t *);
+    egl_surface (*create_pbuffer_surface)(egl_display, egl_config, const int32_t *);
+    uint32_t (*make_current)(egl_display, egl_surface, egl_surface, egl_context);
+    uint32_t (*destroy_context)(egl_display, egl_context);
+    uint32_t (*destroy_surface)(egl_display, egl_surface);
+    uint32_t (*terminate)(egl_display);
+
+    uint32_t (*create_shader)(uint32_t);
+    void (*shader_source)(uint32_t, int32_t, const char *const *, const int32_t *);
+    void (*compile_shader)(uint32_t);
+    void (*get_shaderiv)(uint32_t, uint32_t, int32_t *);
+    uint32_t (*create_program)();
+    void (*attach_shader)(uint32_t, uint32_t);
+    void (*link_program)(uint32_t);
+    void (*get_programiv)(uint32_t, uint32_t, int32_t *);
+    void (*use_program)(uint32_t);
+    void (*delete_shader)(uint32_t);
+    void (*delete_program)(uint32_t);
+    void (*gen_buffers)(int32_t, uint32_t *);
+    void (*bind_buffer)(uint32_t, uint32_t);
+    void (*buffer_data)(uint32_t, ptrdiff_t, const void *, uint32_t);
+    void (*bind_buffer_base)(uint32_t, uint32_t, uint32_t);
+    void (*delete_buffers)(int32_t, const uint32_t *);
+    void (*dispatch_compute)(uint32_t, uint32_t, uint32_t);
+    void (*finish)();
+};
+} // namespace gl
+
+/** Invocations of a work group of the shader. */
+constexpr uint32_t local_size = 64;
+
+/** An ALU and load/store bound compute shader, whose throughput the counter dumps slow down. */
+const char *const shader_source = R"(#version 310 es
+layout(local_size_x = 64) in;
+layout(std430, binding = 0) buffer values_buffer { highp float values[]; };
+void main() {
+    uint index = gl_GlobalInvocationID.x;
+    highp float value = values[index];
+    for (int i = 0; i < 256; ++i) {
+        value = value * 1.0001 + 0.0001;
+    }
+    values[index] = value;
+}
+)";
+
+/** Opens the first library of @p names that can be loaded, or returns nullptr. */
+void *open_library(std::initializer_list<const char *> names) {
+    for (const auto *name : names) {
+        if (void *library = ::dlopen(name, RTLD_NOW | RTLD_LOCAL)) {
+            return library;
+        }
+    }
+    return nullptr;
+}
+
+template <typename function_t>
+bool load(void *library, const char *name, function_t &function) {
+    function = reinterpret_cast<function_t>(::dlsym(library, name));
+    return function != nullptr;
+}
+
+/** The reference workload: a compute dispatch that is waited for, repeated. */
+class gles_workload {
+  public:
+    explicit gles_workload(uint32_t num_groups)
+        : num_groups_(num_groups) {
+        egl_library_ = open_library({"libEGL.so.1", "libEGL.so", "libmali.so"});
+        gles_library_ = open_library({"libGLESv2.so.2", "libGLESv2.so", "libmali.so"});
+        if (egl_library_ == nullptr || gles_library_ == nullptr || !load_api()) {
+            error_ = "EGL and GLES 3.1 libraries not found";
+            return;
+        }
+        error_ = init();
+    }
+
+    ~gles_workload() {
+        if (program_ != 0) {
+            api_.delete_program(program_);
+            api_.delete_buffers(1, &buffer_);
+        }
+        if (display_ != nullptr) {
+            api_.make_current(display_, nullptr, nullptr, nullptr);
+            if (context_ != nullptr) {
+                api_.destroy_context(display_, context_);
+            }
+            if (surface_ != nullptr) {
+                api_.destroy_surface(display_, surface_);
+            }
+            api_.terminate(display_);
+        }
+        if (gles_library_ != nullptr) {
+            ::dlclose(gles_library_);
+        }
+        if (egl_library_ != nullptr) {
+            ::dlclose(egl_library_);
+        }
+    }
+
+    gles_workload(const gles_workload &) = delete;
+    gles_workload &operator=(const gles_workload &) = delete;
+
+    /** @return Why the workload can't run, or an empty string. */
+    const std::string &get_error() const { return error_; }
+
+    /** Dispatches the shader for @p duration, and returns the dispatches completed per second. */
+    double run(clock_type::duration duration) {
+        const auto begin = clock_type::now();
+        const auto end = begin + duration;
+        uint64_t num_dispatches = 0;
+        auto now = begin;
+        for (; now < end; now = clock_type::now()) {
+            api_.dispatch_compute(num_groups_, 1, 1);
+            api_.finish();
+            ++num_dispatches;
+        }
+        return static_cast<double>(num_dispatches) / std::chrono::duration<double>(now - begin).count();
+    }
+
+  private:
+    bool load_api() {
+        void *egl = egl_library_;
+        void *gles = gles_library_;
+        return load(egl, "eglGetDisplay", api_.get_display) && load(egl, "eglInitialize", api_.initialize) &&
+               load(egl, "eglBindAPI", api_.bind_api) && load(egl, "eglChooseConfig", api_.choose_config) &&
+               load(egl, "eglCreateContext", api_.create_context) &&
+               load(egl, "eglCreatePbufferSurface", api_.create_pbuffer_surface) &&
+               load(egl, "eglMakeCurrent", api_.make_current) &&
+               load(egl, "eglDestroyContext", api_.destroy_context) &&
+               load(egl, "eglDestroySurface", api_.destroy_surface) && load(egl, "eglTerminate", api_.terminate) &&
+               load(gles, "glCreateShader", api_.create_shader) && load(gles, "glShaderSource", api_.shader_source) &&
+               load(gles, "glCompileShader", api_.compile_shader) && load(gles, "glGetShaderiv", api_.get_shaderiv) &&
+               load(gles, "glCreateProgram", api_.create_program) &&
+               load(gles, "glAttachShader", api_.attach_shader) && load(gles, "glLinkProgram", api_.link_program) &&
+               load(gles, "glGetProgramiv", api_.get_programiv) && load(gles, "glUseProgram", api_.use_program) &&
+               load(gles, "glDeleteShader", api_.delete_shader) &&
+               load(gles, "glDeleteProgram", api_.delete_program) && load(gles, "glGenBuffers", api_.gen_buffers) &&
+               load(gles, "glBindBuffer", api_.bind_buffer) && load(gles, "glBufferData", api_.buffer_data) &&
+               load(gles, "glBindBufferBase", api_.bind_buffer_base) &&
+               load(gles, "glDeleteBuffers", api_.delete_buffers) &&
+               load(gles, "glDispatchCompute", api_.dispatch_compute) && load(gles, "glFinish", api_.finish);
+    }
+
+    std::string init() {
+        display_ = api_.get_display(nullptr);
+        if (display_ == nullptr || api_.initialize(display_, nullptr, nullptr) == 0 ||
+            api_.bind_api(gl::egl_opengl_es_api) == 0) {
+            display_ = nullptr;
+            return "EGL display not available";
+        }
+
+        const int32_t config_attributes[] = {gl::egl_renderable_type, gl::egl_opengl_es3_bit, gl::egl_surface_type,
+                                             gl::egl_pbuffer_bit, gl::egl_none};
+        gl::egl_config config{};
+        int32_t num_configs{};
+        if (api_.choose_config(display_, config_attributes, &config, 1, &num_configs) == 0 || num_configs == 0) {
+            return "No GLES 3 EGL config";
+        }
+
+        const int32_t surface_attributes[] = {gl::egl_width, 1, gl::egl_height, 1, gl::egl_none};
+        const int32_t context_attributes[] = {gl::egl_context_major_version, 3, gl::egl_context_minor_version, 1,
+                                              gl::egl_none};
+        surface_ = api_.create_pbuffer_surface(display_, config, surface_attributes);
+        context_ = api_.create_context(display_, config, nullptr, context_attributes);
+        if (surface_ == nullptr || context_ == nullptr ||
+            api_.make_current(display_, surface_, surface_, context_) == 0) {
+            return "GLES 3.1 context not available";
+        }
+
+        const uint32_t shader = api_.create_shader(gl::compute_shader);
+        api_.shader_source(shader, 1, &shader_source, nullptr);
+        api_.compile_shader(shader);
+        int32_t compiled{};
+        api_.get_shaderiv(shader, gl::compile_status, &compiled);
+
+        program_ = api_.create_program();
+        api_.attach_shader(program_, shader);
+        api_.link_program(program_);
+        api_.delete_shader(shader);
+        int32_t linked{};
+        api_.get_programiv(program_, gl::link_status, &linked);
+        if (compiled == 0 || linked == 0) {
+            return "The compute shader failed to build";
+        }
+        api_.use_program(program_);
+
+        const std::vector<float> values(static_cast<size_t>(num_groups_) * local_size, 1.0F);
+        api_.gen_buffers(1, &buffer_);
+        api_.bind_buffer(gl::shader_storage_buffer, buffer_);
+        api_.buffer_data(gl::shader_storage_buffer, static_cast<ptrdiff_t>(values.size() * sizeof(float)),
+                         values.data(), gl::dynamic_copy);
+        api_.bind_buffer_base(gl::shader_storage_buffer, 0, buffer_);
+        return {};
+    }
+
+    uint32_t num_groups_;
+    std::string error_{};
+    void *egl_library_{};
+    void *gles_library_{};
+    gl::api api_{};
+    gl::egl_display display_{};
+    gl::egl_surface surface_{};
+    gl::egl_context context_{};
+    uint32_t program_{};
+    uint32_t buffer_{};
+};
+
+/** A sampler running on its own thread, at @p rate_hz, zero sampling as fast as possible. */
+class sampling_thread {
+  public:
+    sampling_thread(const hwcpipe::gpu &gpu, const std::vector<hwcpipe_counter> &counters, bool periodic,
+                    uint64_t rate_hz)
+        : thread_([this, &gpu, &counters, periodic, rate_hz]() { sample(gpu, counters, periodic, rate_hz); }) {
+        while (!started_) {
+            std::this_thread::yield();
+        }
+    }
+
+    ~sampling_thread() { stop(); }
+
+    sampling_thread(const sampling_thread &) = delete;
+    sampling_thread &operator=(const sampling_thread &) = delete;
+
+    /** Stops the sampling, and returns its error, if any. */
+    std::error_code stop() {
+        if (thread_.joinable()) {
+            stopping_ = true;
+            thread_.join();
+        }
+        return ec_;
+    }
+
+    /** @return The number of samples taken. */
+    uint64_t num_samples() const { return num_samples_; }
+
+  private:
+    void sample(const hwcpipe::gpu &gpu, const std::vector<hwcpipe_counter> &counters, bool periodic,
+                uint64_t rate_hz) {
+        ec_ = sample_until_stopped(gpu, counters, periodic, rate_hz);
+        started_ = true;
+    }
+
+    std::error_code sample_until_stopped(const hwcpipe::gpu &gpu, const std::vector<hwcpipe_counter> &counters,
+                                         bool periodic, uint64_t rate_hz) {
+        auto config = hwcpipe::sampler_config(gpu);
+        for (const auto counter : counters) {
+            auto ec = config.add_counter(counter);
+            if (ec) {
+                return ec;
+            }
+        }
+
+        const clock_type::duration interval =
+            rate_hz != 0 ? std::chrono::nanoseconds(1000000000 / rate_hz) : clock_type::duration::zero();
+        if (periodic) {
+            config.set_sampling_period(static_cast<uint64_t>(std::chrono::nanoseconds(interval).count()));
+        }
+
+        auto sampler = hwcpipe::sampler<>(config);
+        auto ec = sampler.start_sampling();
+        if (ec) {
+            return ec;
+        }
+        started_ = true;
+
+        auto next = clock_type::now();
+        while (!stopping_) {
+            if (!periodic && rate_hz != 0) {
+                next += interval;
+                std::this_thread::sleep_until(next);
+            }
+            ec = sampler.sample_now();
+            // stretched and erroneous samples were still dumped by the GPU
+            if (!ec || ec == hwcpipe::make_error_code(hwcpipe::errc::sample_collection_failure)) {
+                ++num_samples_;
+            } else {
+                return ec;
+            }
+        }
+
+        return sampler.stop_sampling();
+    }
+
+    std::atomic<bool> started_{false};
+    std::atomic<bool> stopping_{false};
+    uint64_t num_samples_{};
+    std::error_code ec_{};
+    std::thread thread_;
+};
+
+/** @return The name of the hardware counters back-end of @p device_number. */
+const char *backend_name(int device_number) {
+    auto handle = hwcpipe::device::handle::create(static_cast<uint32_t>(device_number));
+    if (!handle) {
+        return "unknown";
+    }
+    auto instance = hwcpipe::device::instance::create(*handle);
+    if (!instance) {
+        return "unknown";
+    }
+    return instance->get_hwcnt_backend_name();
+}
+} // namespace
+
+int main(int argc, char **argv) {
+    const uint64_t duration_ms = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 2000;
+    const int device_number = argc > 2 ? std::atoi(argv[2]) : 0;
+    const auto num_groups = static_cast<uint32_t>(argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 1024);
+
+    if (duration_ms == 0 || num_groups == 0) {
+        std::cerr << "The run duration and the work groups per dispatch must be at least 1." << std::endl;
+        return -1;
+    }
+
+    auto gpu = hwcpipe::gpu(device_number);
+    if (!gpu) {
+        std::cerr << "Mali GPU device " << device_number << " is missing" << std::endl;
+        return -1;
+    }
+
+    gles_workload workload(num_groups);
+    if (!workload.get_error().empty()) {
+        std::cerr << workload.get_error() << std::endl;
+        return -1;
+    }
+
+    // counters that can be sampled on their own, in database order
+    std::vector<hwcpipe_counter> supported{};
+    for (hwcpipe_counter counter : hwcpipe::counter_database{}.counters_for_gpu(gpu)) {
+        auto config = hwcpipe::sampler_config(gpu);
+        if (!config.add_counter(counter)) {
+            supported.push_back(counter);
+        }
+    }
+    if (supported.empty()) {
+        std::cerr << "No counters are supported by this GPU." << std::endl;
+        return -1;
+    }
+
+    const char *backend = backend_name(device_number);
+    std::cerr << "Device " << device_number << ": " << gpu.num_shader_cores() << " shader cores, " << backend
+              << " back-end, " << supported.size() << " counters, " << num_groups << " work groups per dispatch"
+              << std::endl;
+
+    // warm the GPU up to its steady state before the first measurement
+    const auto duration = std::chrono::milliseconds(duration_ms);
+    static_cast<void>(workload.run(duration));
+
+    std::cout << "backend,mode,requested_hz,counters,samples,baseline_dispatches_per_s,dispatches_per_s,"
+                 "throughput_lost_pct"
+              << std::endl;
+    std::cout << std::fixed << std::setprecision(2);
+
+    for (const bool periodic : {false, true}) {
+        const auto *rates = periodic ? periodic_rates : manual_rates;
+        const size_t num_rates = periodic ? sizeof(periodic_rates) / sizeof(*periodic_rates)
+                                          : sizeof(manual_rates) / sizeof(*manual_rates);
+
+        for (size_t r = 0; r != num_rates; ++r) {
+            for (const size_t size : counter_set_sizes) {
+                const size_t num_counters = size != 0 ? std::min(size, supported.size()) : supported.size();
+                const std::vector<hwcpipe_counter> counters(supported.begin(),
+                                                            supported.begin() + static_cast<ptrdiff_t>(num_counters));
+
+                const double baseline = workload.run(duration);
+
+                sampling_thread sampling(gpu, counters, periodic, rates[r]);
+                const double sampled = workload.run(duration);
+                const auto ec = sampling.stop();
+                if (ec) {
+                    std::cerr << (periodic ? "periodic" : "manual") << " at " << rates[r] << " Hz with "
+                              << num_counters << " counters failed: " << ec.message() << std::endl;
+                    continue;
+                }
+
+                const double lost = baseline > 0.0 ? (1.0 - sampled / baseline) * 100.0 : 0.0;
+                std::cout << backend << ',' << (periodic ? "periodic" : "manual") << ',' << rates[r] << ','
+                          << num_counters << ',' << sampling.num_samples() << ',' << baseline << ',' << sampled << ','
+                          << lost << std::endl;
+            }
+        }
+    }
+
+    return 0;
+}
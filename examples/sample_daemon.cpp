@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*
+ * A system-wide sample daemon: it opens the GPU once, samples every counter
+ * the GPU supports periodically, and publishes the samples to a shared memory
+ * segment that any number of tools read through hwcpipe::daemon_client. The
+ * sampling is paused while no client is connected.
+ *
+ * Usage: hwcpipe-daemon [socket path] [period in ms] [device number] [cpu mask]
+ *
+ * The cpu mask, in hexadecimal, pins the sampling thread, e.g. 0f for the
+ * first four CPUs.
+ */
+
+#include <hwcpipe/counter_database.hpp>
+#include <hwcpipe/gpu.hpp>
+#include <hwcpipe/on_demand_session.hpp>
+#include <hwcpipe/sample_daemon.hpp>
+#include <hwcpipe/sampler.hpp>
+#include <hwcpipe/shared_sample_segment.hpp>
+
+#include <csignal>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+volatile std::sig_atomic_t running = 1;
+
+void stop_running(int) { running = 0; }
+
+/** Samples kept for the clients that poll slower than the daemon samples. */
+constexpr size_t history = 256;
+
+/** How long a paused daemon waits for a client before checking whether it should exit. */
+constexpr int paused_wait_ms = 100;
+} // namespace
+
+int main(int argc, char **argv) {
+    const std::string socket_path = argc > 1 ? argv[1] : "/tmp/hwcpipe.sock";
+    const uint64_t period_ms = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 10;
+    const int device_number = argc > 3 ? std::atoi(argv[3]) : 0;
+    const uint64_t cpu_mask = argc > 4 ? std::strtoull(argv[4], nullptr, 16) : 0;
+
+    if (period_ms == 0) {
+        std::cerr << "The sample period must be at least 1 ms." << std::endl;
+        return -1;
+    }
+
+    auto gpu = hwcpipe::gpu(device_number);
+    if (!gpu) {
+        std::cerr << "Mali GPU device " << device_number << " is missing" << std::endl;
+        return -1;
+    }
+
+    auto config = hwcpipe::sampler_config(gpu);
+    std::vector<hwcpipe_counter> counters{};
+    for (hwcpipe_counter counter : hwcpipe::counter_database{}.counters_for_gpu(gpu)) {
+        if (!config.add_counter(counter)) {
+            counters.push_back(counter);
+        }
+    }
+    config.set_sampling_period(period_ms * 1000000);
+    config.set_thread_config({cpu_mask, hwcpipe::device::hwcnt::sampler::sched_class::inherit, 0});
+
+    auto sampler = hwcpipe::sampler<>(config);
+    std::error_code ec = sampler.start_sampling();
+    if (ec) {
+        std::cerr << ec.message() << std::endl;
+        return -1;
+    }
+
+    auto list = sampler.make_read_list(counters.data(), counters.size(), ec);
+    if (ec) {
+        std::cerr << ec.message() << std::endl;
+        return -1;
+    }
+
+    hwcpipe::shared_sample_exporter exporter(counters.data(), counters.size(), history);
+    if (!exporter) {
+        std::cerr << exporter.get_error().message() << std::endl;
+        return -1;
+    }
+
+    hwcpipe::segment_server server(socket_path, exporter.get_fd(), exporter.get_segment_size());
+    if (!server) {
+        std::cerr << server.get_error().message() << std::endl;
+        return -1;
+    }
+
+    std::signal(SIGINT, stop_running);
+    std::signal(SIGTERM, stop_running);
+
+    std::cout << "Sampling " << counters.size() << " counters every " << period_ms << " ms, serving "
+              << socket_path << std::endl;
+
+    hwcpipe::on_demand_session<hwcpipe::sampler<>> on_demand(sampler);
+    while (running) {
+        // the periodic sampler blocks in sample_now(), so new clients are
+        // served at least once per period, and a paused daemon waits for them
+        server.serve_pending(on_demand.is_running() ? 0 : paused_wait_ms);
+
+        ec = on_demand.update(server.num_subscribers());
+        if (ec) {
+            std::cerr << ec.message() << std::endl;
+            break;
+        }
+        if (!on_demand.is_running()) {
+            continue;
+        }
+
+        ec = sampler.sample_now();
+        if (ec) {
+            continue;
+        }
+        ec = exporter.publish(sampler, list);
+        if (ec) {
+            std::cerr << ec.message() << std::endl;
+        }
+    }
+
+    const auto &stats = on_demand.get_stats();
+    std::cout << "Paused " << stats.num_pauses << " times, slowest resume " << stats.max_resume_latency_ns / 1000
+              << " us" << std::endl;
+
+    if (on_demand.is_running()) {
+        ec = sampler.stop_sampling();
+        if (ec) {
+            std::cerr << ec.message() << std::endl;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,232 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*
+ * A sampling overhead benchmark: it samples the GPU at a sweep of sample
+ * rates and counter set sizes, in manual and periodic mode, and reports for
+ * each run the achieved sample rate, the samples that failed because they
+ * were stretched or erroneous, the periodic samples that were missed, the
+ * p50 and p99 latency of sample_now() and the CPU time spent per sample.
+ *
+ * The results are printed as CSV, one run per line.
+ *
+ * Usage: hwcpipe-sampling-bench [run duration in ms] [device number]
+ */
+
+#include <device/handle.hpp>
+#include <device/instance.hpp>
+#include <hwcpipe/counter_database.hpp>
+#include <hwcpipe/error.hpp>
+#include <hwcpipe/gpu.hpp>
+#include <hwcpipe/sampler.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include <time.h>
+
+namespace {
+using clock_type = std::chrono::steady_clock;
+
+/** Sample rates of the sweep, in Hz. Zero samples as fast as possible. */
+constexpr uint64_t manual_rates[] = {10, 100, 1000, 0};
+constexpr uint64_t periodic_rates[] = {10, 100, 1000};
+
+/** Counter set sizes of the sweep. Zero selects every supported counter. */
+constexpr size_t counter_set_sizes[] = {1, 8, 32, 0};
+
+/** @return The CPU time of the calling thread, in nanoseconds. */
+uint64_t thread_cpu_time_ns() {
+    struct timespec ts {};
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000000 + static_cast<uint64_t>(ts.tv_nsec);
+}
+
+/** @return The @p percentile of the sorted @p values, or zero if there are none. */
+uint64_t percentile(const std::vector<uint64_t> &values, size_t percentile) {
+    if (values.empty()) {
+        return 0;
+    }
+    return values[(values.size() - 1) * percentile / 100];
+}
+
+/** Results of a run. */
+struct run_result {
+    size_t samples{};
+    size_t failed{};
+    size_t missed{};
+    double achieved_hz{};
+    uint64_t p50_ns{};
+    uint64_t p99_ns{};
+    uint64_t cpu_ns_per_sample{};
+};
+
+/**
+ * Samples for @p duration at @p rate_hz, zero sampling as fast as possible.
+ * A periodic sampler is created when @p periodic is set.
+ */
+std::error_code run(const hwcpipe::gpu &gpu, const std::vector<hwcpipe_counter> &counters, bool periodic,
+                    uint64_t rate_hz, clock_type::duration duration, run_result &result) {
+    auto config = hwcpipe::sampler_config(gpu);
+    for (const auto counter : counters) {
+        auto ec = config.add_counter(counter);
+        if (ec) {
+            return ec;
+        }
+    }
+
+    const clock_type::duration interval =
+        rate_hz != 0 ? std::chrono::nanoseconds(1000000000 / rate_hz) : clock_type::duration::zero();
+    if (periodic) {
+        config.set_sampling_period(static_cast<uint64_t>(std::chrono::nanoseconds(interval).count()));
+    }
+
+    auto sampler = hwcpipe::sampler<>(config);
+    auto ec = sampler.start_sampling();
+    if (ec) {
+        return ec;
+    }
+
+    std::vector<uint64_t> latencies{};
+    latencies.reserve(rate_hz != 0 ? static_cast<size_t>(rate_hz * 2 * duration / std::chrono::seconds(1)) : 65536);
+
+    const auto begin = clock_type::now();
+    const auto end = begin + duration;
+    const auto cpu_begin = thread_cpu_time_ns();
+    auto next = begin;
+
+    for (auto now = begin; now < end; now = clock_type::now()) {
+        if (!periodic && rate_hz != 0) {
+            next += interval;
+            std::this_thread::sleep_until(next);
+        }
+
+        const auto sample_begin = clock_type::now();
+        ec = sampler.sample_now();
+        const auto sample_end = clock_type::now();
+
+        if (ec == hwcpipe::make_error_code(hwcpipe::errc::sample_collection_failure)) {
+            // the sample was stretched or erroneous
+            ++result.failed;
+            continue;
+        }
+        if (ec) {
+            return ec;
+        }
+
+        const auto latency = std::chrono::duration_cast<std::chrono::nanoseconds>(sample_end - sample_begin);
+        latencies.push_back(static_cast<uint64_t>(latency.count()));
+    }
+
+    const auto cpu_ns = thread_cpu_time_ns() - cpu_begin;
+    const auto elapsed = std::chrono::duration<double>(clock_type::now() - begin).count();
+
+    ec = sampler.stop_sampling();
+    if (ec) {
+        return ec;
+    }
+
+    std::sort(latencies.begin(), latencies.end());
+    result.samples = latencies.size();
+    result.achieved_hz = static_cast<double>(result.samples) / elapsed;
+    result.p50_ns = percentile(latencies, 50);
+    result.p99_ns = percentile(latencies, 99);
+
+    const size_t taken = result.samples + result.failed;
+    result.cpu_ns_per_sample = taken != 0 ? cpu_ns / taken : 0;
+
+    if (periodic) {
+        const auto expected = static_cast<size_t>(elapsed * static_cast<double>(rate_hz));
+        result.missed = expected > taken ? expected - taken : 0;
+    }
+
+    return {};
+}
+
+/** @return The name of the hardware counters back-end of @p device_number. */
+const char *backend_name(int device_number) {
+    auto handle = hwcpipe::device::handle::create(static_cast<uint32_t>(device_number));
+    if (!handle) {
+        return "unknown";
+    }
+    auto instance = hwcpipe::device::instance::create(*handle);
+    if (!instance) {
+        return "unknown";
+    }
+    return instance->get_hwcnt_backend_name();
+}
+} // namespace
+
+int main(int argc, char **argv) {
+    const uint64_t duration_ms = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 2000;
+    const int device_number = argc > 2 ? std::atoi(argv[2]) : 0;
+
+    auto gpu = hwcpipe::gpu(device_number);
+    if (!gpu) {
+        std::cerr << "Mali GPU device " << device_number << " is missing" << std::endl;
+        return -1;
+    }
+
+    // counters that can be sampled on their own, in database order
+    std::vector<hwcpipe_counter> supported{};
+    for (hwcpipe_counter counter : hwcpipe::counter_database{}.counters_for_gpu(gpu)) {
+        auto config = hwcpipe::sampler_config(gpu);
+        if (!config.add_counter(counter)) {
+            supported.push_back(counter);
+        }
+    }
+    if (supported.empty()) {
+        std::cerr << "No counters are supported by this GPU." << std::endl;
+        return -1;
+    }
+
+    const char *backend = backend_name(device_number);
+    std::cerr << "Device " << device_number << ": " << gpu.num_shader_cores() << " shader cores, " << backend
+              << " back-end, " << supported.size() << " counters" << std::endl;
+
+    std::cout << "backend,mode,requested_hz,counters,samples,failed,missed,achieved_hz,p50_us,p99_us,cpu_us_per_sample"
+              << std::endl;
+    std::cout << std::fixed << std::setprecision(2);
+
+    const auto duration = std::chrono::milliseconds(duration_ms);
+    for (const bool periodic : {false, true}) {
+        const auto *rates = periodic ? periodic_rates : manual_rates;
+        const size_t num_rates = periodic ? sizeof(periodic_rates) / sizeof(*periodic_rates)
+                                          : sizeof(manual_rates) / sizeof(*manual_rates);
+
+        for (size_t r = 0; r != num_rates; ++r) {
+            for (const size_t size : counter_set_sizes) {
+                const size_t num_counters = size != 0 ? std::min(size, supported.size()) : supported.size();
+                const std::vector<hwcpipe_counter> counters(supported.begin(),
+                                                            supported.begin() + static_cast<ptrdiff_t>(num_counters));
+
+                run_result result{};
+                const auto ec = run(gpu, counters, periodic, rates[r], duration, result);
+                if (ec) {
+                    std::cerr << (periodic ? "periodic" : "manual") << " at " << rates[r] << " Hz with "
+                              << num_counters << " counters failed: " << ec.message() << std::endl;
+                    continue;
+                }
+
+                std::cout << backend << ',' << (periodic ? "periodic" : "manual") << ',' << rates[r] << ','
+                          << num_counters << ',' << result.samples << ',' << result.failed << ',' << result.missed
+                          << ',' << result.achieved_hz << ',' << static_cast<double>(result.p50_ns) / 1000.0 << ','
+                          << static_cast<double>(result.p99_ns) / 1000.0 << ','
+                          << static_cast<double>(result.cpu_ns_per_sample) / 1000.0 << std::endl;
+            }
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/**
+ * @file
+ *
+ * The frame sampling session of the GLES interposer.
+ */
+
+#pragma once
+
+#include <hwcpipe/sample_daemon.hpp>
+#include <hwcpipe/sampler.hpp>
+#include <hwcpipe/shared_sample_segment.hpp>
+#include <hwcpipe/submit_sampler.hpp>
+#include <hwcpipe/trace_recorder.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace hwcpipe {
+namespace interposer {
+
+/** Time the collector waits for a sample before checking whether to stop, in nanoseconds. */
+constexpr uint64_t collect_timeout_ns = 10000000;
+
+/** Number of threads that can swap, each getting its own channel. The swaps of other threads aren't sampled. */
+constexpr size_t max_swap_threads = 8;
+
+/**
+ * Samples the frames of the process, and records or exports them on a
+ * collector thread.
+ *
+ * Each swap only queues a tagged request for a sample on a channel of the
+ * swapping thread, see hwcpipe::submit_sampler. The collector takes the
+ * samples, records them with their frame on a "timestamp_ns_end frame" line
+ * of a ".tags" file next to the trace, and publishes the latest one to the
+ * clients of a segment server.
+ *
+ * @tparam policy_t  The sampler policy.
+ */
+template <typename policy_t = detail::hwcpipe_backend_policy>
+class frame_session {
+  public:
+    /** The sampler of the session. */
+    using sampler_type = sampler<policy_t>;
+
+    /**
+     * Constructor.
+     *
+     * @param [in] config    The counters to sample.
+     * @param [in] counters  The counters of @p config, that the segment server exports.
+     */
+    frame_session(const sampler_config &config, std::vector<hwcpipe_counter> counters)
+        : config_(config)
+        , counters_(std::move(counters))
+        , sampler_(config_)
+        , submits_(sampler_, make_config()) {}
+
+    ~frame_session() { stop(); }
+
+    frame_session(const frame_session &) = delete;
+    frame_session &operator=(const frame_session &) = delete;
+
+    /**
+     * Opens the outputs, starts sampling and the collector.
+     *
+     * @param [in] trace_path   A trace file to record the samples to, or nullptr.
+     * @param [in] socket_path  A Unix socket path to export the latest sample on, or nullptr.
+     * @return False if the GPU can't be sampled or an output can't be opened.
+     */
+    bool start(const char *trace_path, const char *socket_path) {
+        if (!sampler_) {
+            return false;
+        }
+
+        if (trace_path != nullptr) {
+            recorder_.reset(new trace_recorder(trace_path, config_, sampler_.get_constants(),
+                                               sampler_.get_block_extents()));
+            tags_ = std::fopen((std::string(trace_path) + ".tags").c_str(), "w");
+            if (!*recorder_ || tags_ == nullptr) {
+                return false;
+            }
+            sampler_.set_trace_recorder(recorder_.get());
+        }
+        if (socket_path != nullptr) {
+            std::error_code ec;
+            list_ = sampler_.make_read_list(counters_.data(), counters_.size(), ec);
+            exporter_.reset(new shared_sample_exporter(counters_.data(), counters_.size()));
+            if (ec || !*exporter_) {
+                return false;
+            }
+            server_.reset(new segment_server(socket_path, exporter_->get_fd(), exporter_->get_segment_size()));
+            if (!*server_) {
+                return false;
+            }
+        }
+
+        if (sampler_.start_sampling()) {
+            return false;
+        }
+        collector_ = std::thread([this] { collect(); });
+        return true;
+    }
+
+    /** Queues the sample of a frame, without blocking the swapping thread. */
+    void on_swap() {
+        if (stop_.load(std::memory_order_relaxed)) {
+            return;
+        }
+        static std::atomic<size_t> next_channel{0};
+        thread_local const size_t channel = next_channel.fetch_add(1, std::memory_order_relaxed);
+        if (channel < max_swap_threads) {
+            submits_.on_present(channel);
+        }
+    }
+
+    /** Stops the collector and closes the outputs. The later swaps aren't sampled. */
+    void stop() {
+        stop_.store(true, std::memory_order_relaxed);
+        if (collector_.joinable()) {
+            collector_.join();
+            // the interposer has nowhere to report the errors
+            const auto stop_ec = sampler_.stop_sampling();
+            static_cast<void>(stop_ec);
+        }
+        sampler_.set_trace_recorder(static_cast<trace_recorder *>(nullptr));
+        if (recorder_) {
+            const auto close_ec = recorder_->close();
+            static_cast<void>(close_ec);
+            recorder_.reset();
+        }
+        if (tags_ != nullptr) {
+            std::fclose(tags_);
+            tags_ = nullptr;
+        }
+    }
+
+    /** @return The swaps queued and the samples collected so far. */
+    submit_sampler_stats get_stats() const { return submits_.get_stats(); }
+
+  private:
+    static submit_sampler_config make_config() {
+        submit_sampler_config config{};
+        config.num_channels = max_swap_threads;
+        return config;
+    }
+
+    void collect() {
+        while (!stop_.load(std::memory_order_relaxed)) {
+            if (server_) {
+                server_->serve_pending();
+            }
+            if (submits_.collect_for(collect_timeout_ns)) {
+                continue;
+            }
+            if (exporter_) {
+                const auto publish_ec = exporter_->publish(sampler_, list_);
+                static_cast<void>(publish_ec);
+            }
+            if (tags_ != nullptr) {
+                const auto tag = submit_tag::decode(sampler_.get_sample_user_data());
+                std::fprintf(tags_, "%llu %u\n", static_cast<unsigned long long>(sampler_.get_sample_timestamp_end()),
+                             tag.frame);
+            }
+        }
+    }
+
+    const sampler_config config_;
+    const std::vector<hwcpipe_counter> counters_;
+    sampler_type sampler_;
+    submit_sampler<sampler_type> submits_;
+    read_list list_{};
+    std::unique_ptr<trace_recorder> recorder_{};
+    std::FILE *tags_{};
+    std::unique_ptr<shared_sample_exporter> exporter_{};
+    std::unique_ptr<segment_server> server_{};
+    std::atomic<bool> stop_{false};
+    std::thread collector_{};
+};
+
+} // namespace interposer
+} // namespace hwcpipe
@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/**
+ * @file
+ *
+ * An interposer library that samples the Mali GPU counters at each frame of
+ * an unmodified EGL/GLES application. Preload it, with LD_PRELOAD or from
+ * the wrap.sh of an Android app, and it wraps eglSwapBuffers() and the
+ * eglSwapBuffersWithDamage extensions. Each swap only queues a tagged
+ * request for a sample, see hwcpipe::submit_sampler, on a channel of the
+ * swapping thread; a collector thread takes the samples. The device is
+ * opened through the registry shared by every sampler of the process, so an
+ * application that samples the GPU itself doesn't open it twice.
+ *
+ * Environment variables:
+ *  - HWCPIPE_INTERPOSER_TRACE: a trace file the samples are recorded to with
+ *    hwcpipe::trace_recorder, with their frame on one
+ *    "timestamp_ns_end frame" line of a ".tags" file next to it.
+ *  - HWCPIPE_INTERPOSER_SOCKET: a Unix socket path that hands out a shared
+ *    sample segment with the latest frame, as the sample daemon does, see
+ *    hwcpipe::daemon_client.
+ *  - HWCPIPE_INTERPOSER_DEVICE: the Mali device number, 0 by default.
+ *
+ * Without either output the samples are recorded to "hwcpipe_frames_<pid>.hwct".
+ * If the GPU can't be sampled, the swaps are only forwarded.
+ *
+ * The session is created on a thread started by the first swap, so that
+ * nothing runs while the library is loaded and the swaps never wait for the
+ * device; the frames swapped before it is ready aren't sampled. It is stopped
+ * at exit, but never destroyed: the threads that are still swapping may use
+ * it until the process ends.
+ */
+
+#include "frame_session.hpp"
+
+#include <hwcpipe/counter_database.hpp>
+#include <hwcpipe/gpu.hpp>
+#include <hwcpipe/sampler.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <dlfcn.h>
+#include <unistd.h>
+
+#define HWCPIPE_INTERPOSER_EXPORT extern "C" __attribute__((visibility("default")))
+
+namespace {
+
+// the EGL types, so that the EGL headers aren't needed
+using EGLBoolean = unsigned int;
+using EGLDisplay = void *;
+using EGLSurface = void *;
+using EGLint = int32_t;
+using egl_function = void (*)();
+
+using swap_buffers_function = EGLBoolean (*)(EGLDisplay, EGLSurface);
+using swap_buffers_with_damage_function = EGLBoolean (*)(EGLDisplay, EGLSurface, const EGLint *, EGLint);
+using get_proc_address_function = egl_function (*)(const char *);
+
+/** @return A session sampling the GPU, or nullptr if it can't be sampled. */
+hwcpipe::interposer::frame_session<> *create_session() {
+    const char *device = std::getenv("HWCPIPE_INTERPOSER_DEVICE");
+    const hwcpipe::gpu gpu(device != nullptr ? std::atoi(device) : 0);
+    if (!gpu) {
+        return nullptr;
+    }
+
+    hwcpipe::sampler_config config(gpu);
+    std::vector<hwcpipe_counter> counters{};
+    for (hwcpipe_counter counter : hwcpipe::counter_database{}.counters_for_gpu(gpu)) {
+        // counters the GPU doesn't have are skipped
+        if (!config.add_counter(counter)) {
+            counters.push_back(counter);
+        }
+    }
+    if (counters.empty()) {
+        return nullptr;
+    }
+
+    const char *trace = std::getenv("HWCPIPE_INTERPOSER_TRACE");
+    const char *socket = std::getenv("HWCPIPE_INTERPOSER_SOCKET");
+    std::string trace_path{};
+    if (trace != nullptr || socket == nullptr) {
+        // one trace per process, as several processes of an application may swap
+        trace_path = trace != nullptr ? trace : "hwcpipe_frames_" + std::to_string(::getpid()) + ".hwct";
+    }
+
+    std::unique_ptr<hwcpipe::interposer::frame_session<>> session(
+        new hwcpipe::interposer::frame_session<>(config, std::move(counters)));
+    if (!session->start(trace_path.empty() ? nullptr : trace_path.c_str(), socket)) {
+        return nullptr;
+    }
+    return session.release();
+}
+
+std::atomic<hwcpipe::interposer::frame_session<> *> the_session{nullptr};
+
+void stop_session() { the_session.load(std::memory_order_acquire)->stop(); }
+
+/**
+ * Creates the session of the process, on a thread started by the first swap.
+ *
+ * The session is leaked rather than destroyed with the other statics, so that a thread swapping during the exit
+ * doesn't use a destroyed object. Its outputs are closed by an atexit() handler.
+ */
+void start_session() {
+    static std::atomic<bool> started{false};
+    if (started.load(std::memory_order_relaxed) || started.exchange(true, std::memory_order_relaxed)) {
+        return;
+    }
+
+    // opening and probing the device, and starting the sampler, take too long for a swap
+    std::thread([] {
+        hwcpipe::interposer::frame_session<> *session = create_session();
+        if (session != nullptr) {
+            the_session.store(session, std::memory_order_release);
+            std::atexit(stop_session);
+        }
+    }).detach();
+}
+
+/** @return The next definition of an EGL function, after the interposer. */
+template <typename function_t>
+function_t next_function(const char *name) {
+    return reinterpret_cast<function_t>(dlsym(RTLD_NEXT, name));
+}
+
+/** Samples the frame, or drops it until the session is ready. */
+void on_swap() {
+    hwcpipe::interposer::frame_session<> *session = the_session.load(std::memory_order_acquire);
+    if (session != nullptr) {
+        session->on_swap();
+    } else {
+        start_session();
+    }
+}
+
+// the extensions returned by eglGetProcAddress(), set before the wrappers are handed out
+std::atomic<swap_buffers_with_damage_function> next_swap_with_damage_khr{nullptr};
+std::atomic<swap_buffers_with_damage_function> next_swap_with_damage_ext{nullptr};
+
+EGLBoolean swap_buffers_with_damage_khr(EGLDisplay display, EGLSurface surface, const EGLint *rects, EGLint count) {
+    const EGLBoolean result = next_swap_with_damage_khr.load(std::memory_order_acquire)(display, surface, rects, count);
+    if (result != 0) {
+        on_swap();
+    }
+    return result;
+}
+
+EGLBoolean swap_buffers_with_damage_ext(EGLDisplay display, EGLSurface surface, const EGLint *rects, EGLint count) {
+    const EGLBoolean result = next_swap_with_damage_ext.load(std::memory_order_acquire)(display, surface, rects, count);
+    if (result != 0) {
+        on_swap();
+    }
+    return result;
+}
+
+} // namespace
+
+HWCPIPE_INTERPOSER_EXPORT EGLBoolean eglSwapBuffers(EGLDisplay display, EGLSurface surface) {
+    static const auto next = next_function<swap_buffers_function>("eglSwapBuffers");
+    const EGLBoolean result = next != nullptr ? next(display, surface) : 0;
+    if (result != 0) {
+        on_swap();
+    }
+    return result;
+}
+
+HWCPIPE_INTERPOSER_EXPORT egl_function eglGetProcAddress(const char *name) {
+    static const auto next = next_function<get_proc_address_function>("eglGetProcAddress");
+    const egl_function function = next != nullptr ? next(name) : nullptr;
+    if (function == nullptr) {
+        return nullptr;
+    }
+
+    if (std::strcmp(name, "eglSwapBuffers") == 0) {
+        return reinterpret_cast<egl_function>(&eglSwapBuffers);
+    }
+    if (std::strcmp(name, "eglSwapBuffersWithDamageKHR") == 0) {
+        next_swap_with_damage_khr.store(reinterpret_cast<swap_buffers_with_damage_function>(function),
+                                        std::memory_order_release);
+        return reinterpret_cast<egl_function>(&swap_buffers_with_damage_khr);
+    }
+    if (std::strcmp(name, "eglSwapBuffersWithDamageEXT") == 0) {
+        next_swap_with_damage_ext.store(reinterpret_cast<swap_buffers_with_damage_function>(function),
+                                        std::memory_order_release);
+        return reinterpret_cast<egl_function>(&swap_buffers_with_damage_ext);
+    }
+    return function;
+}
@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include "hwcpipe/types.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <system_error>
+#include <vector>
+
+namespace hwcpipe {
+
+/** The bounds and sensitivity of an adaptive_period controller. */
+struct adaptive_period_config {
+    /** The period used during bursts, in nanoseconds. */
+    uint64_t min_period_ns;
+    /** The longest period, used when the GPU is idle or steady, in nanoseconds. */
+    uint64_t max_period_ns;
+    /** Factor by which the period grows after each idle or steady sample. */
+    double growth{2.0};
+    /**
+     * Relative change of a counter rate, from its moving average, that is a
+     * burst, e.g. 0.25 for 25%.
+     */
+    double burst_threshold{0.25};
+    /** Weight of the latest rate in the moving average of each counter. */
+    double smoothing{0.5};
+};
+
+/**
+ * @brief Chooses the sampling period from the activity of the GPU. Bursts are
+ * sampled at the shortest period, and the period grows up to the longest one
+ * while the GPU is idle or its counters are steady. The sampler is thus only
+ * woken often when the counters change.
+ *
+ * The controller tracks the rates of the GPU cycles of each sample, see
+ * sampler::get_sample_interval(), and of a few key counters, e.g.
+ * MaliGPUActiveCy or external bandwidth, against their moving averages. A
+ * counter whose rate deviates by more than the burst threshold resets the
+ * period to its minimum. Since each sample reports its own interval, rates
+ * stay exact across period changes.
+ *
+ * The period is applied with device::hwcnt::sampler::periodic_driver::set_period()
+ * for userspace timers, or by the loop that calls sampler::sample_now().
+ * Kernel periodic sessions have a fixed period, changing it takes a
+ * sampler::reconfigure().
+ *
+ * @par
+ * @code
+ * hwcpipe::adaptive_period controller({1000000, 100000000}, num_counters);
+ * while (running) {
+ *     std::this_thread::sleep_for(std::chrono::nanoseconds(controller.get_period()));
+ *     if (!sampler.sample_now()) {
+ *         ec = controller.update(sampler, list);
+ *     }
+ * }
+ * @endcode
+ */
+class adaptive_period {
+  public:
+    /**
+     * @brief Constructs a controller, starting at the shortest period.
+     *
+     * @param [in] config      The bounds and sensitivity of the controller.
+     * @param [in] num_values  Number of key counters given to update().
+     */
+    adaptive_period(const adaptive_period_config &config, size_t num_values)
+        : config_(config)
+        , period_ns_(config.min_period_ns)
+        , averages_(num_values + 1)
+        , values_(num_values) {}
+
+    /** @return The period to sample at, in nanoseconds. */
+    HWCP_NODISCARD uint64_t get_period() const { return period_ns_; }
+
+    /** @return True if the last sample was part of a burst. */
+    HWCP_NODISCARD bool in_burst() const { return burst_; }
+
+    /**
+     * @brief Updates the period with a sample.
+     *
+     * @param [in] duration_ns  The duration of the sample.
+     * @param [in] gpu_cycles   The GPU cycles of the sample, zero if unknown.
+     * @param [in] values       The values of the key counters in the sample.
+     * @return The period to sample at, in nanoseconds.
+     */
+    uint64_t update(uint64_t duration_ns, uint64_t gpu_cycles, const double *values) {
+        if (duration_ns == 0) {
+            return period_ns_;
+        }
+
+        const double scale = 1e9 / static_cast<double>(duration_ns);
+        bool active = gpu_cycles != 0;
+        burst_ = track(0, static_cast<double>(gpu_cycles) * scale);
+        for (size_t i = 0; i + 1 != averages_.size(); ++i) {
+            active = active || values[i] != 0;
+            burst_ = track(i + 1, values[i] * scale) || burst_;
+        }
+        primed_ = true;
+
+        if (burst_ && active) {
+            period_ns_ = config_.min_period_ns;
+        } else {
+            const double grown = std::ceil(static_cast<double>(period_ns_) * config_.growth);
+            period_ns_ = std::min(static_cast<uint64_t>(grown), config_.max_period_ns);
+        }
+        period_ns_ = std::max(period_ns_, config_.min_period_ns);
+        return period_ns_;
+    }
+
+    /**
+     * @brief Updates the period with the last sample of a sampler.
+     *
+     * @param [in] sampler  The sampler, after a successful sample.
+     * @param [in] list     A read list of the key counters of the sampler.
+     * @return The error of sampler::get_counter_values().
+     */
+    template <typename sampler_t, typename read_list_t>
+    HWCP_NODISCARD std::error_code update(const sampler_t &sampler, const read_list_t &list) {
+        auto ec = sampler.get_counter_values(list, values_.data(), values_.size());
+        if (ec) {
+            return ec;
+        }
+        const auto interval = sampler.get_sample_interval();
+        update(interval.duration_ns(), interval.gpu_cycles, values_.data());
+        return {};
+    }
+
+  private:
+    /** Adds a rate to its moving average, and returns whether it deviated from it. */
+    bool track(size_t index, double rate) {
+        double &average = averages_[index];
+        const double deviation = std::fabs(rate - average);
+        const bool changed = primed_ && deviation > average * config_.burst_threshold;
+        average = primed_ ? average + (rate - average) * config_.smoothing : rate;
+        return changed;
+    }
+
+    adaptive_period_config config_;
+    uint64_t period_ns_;
+    bool primed_{};
+    bool burst_{};
+    std::vector<double> averages_;
+    std::vector<double> values_;
+};
+
+} // namespace hwcpipe
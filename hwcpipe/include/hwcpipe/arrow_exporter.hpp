@@ -0,0 +1,395 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include "hwcpipe/counter_database.hpp"
+#include "hwcpipe/detail/arrow_c_abi.hpp"
+#include "hwcpipe/detail/heap_bytes.hpp"
+#include "hwcpipe/hwcpipe_counter.h"
+#include "hwcpipe/sampler.hpp"
+#include "hwcpipe/types.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace hwcpipe {
+
+/**
+ * @brief Builds Arrow record batches of counter samples, and exports them
+ * through the Arrow C data and C stream interfaces, without depending on the
+ * Arrow libraries.
+ *
+ * A batch has one row per sample, and these columns:
+ *  - timestamp_ns_begin, timestamp_ns_end, gpu_cycles, sc_cycles and
+ *    user_data, as uint64, see sampler::get_sample_interval() and
+ *    sampler::get_sample_user_data(),
+ *  - one uint64 column per hardware counter,
+ *  - one float64 column per derived counter.
+ *
+ * The samples are appended to one buffer per column, reserved for
+ * batch_rows() samples, and the buffers are moved into the exported batch,
+ * so Arrow reads the columns in place. The batch owns them until Arrow
+ * releases it.
+ *
+ * export_stream() exports an ArrowArrayStream that builds a batch each time
+ * Arrow asks for one, pulling the samples from a source, e.g. a sampler
+ * that replays a recorded trace. Writing the stream to an IPC file then
+ * keeps a single batch in memory, however long the capture.
+ *
+ * @par
+ * @code
+ * hwcpipe::arrow_exporter exporter(hardware, num_hardware, derived, num_derived, 65536);
+ * ArrowArrayStream stream{};
+ * exporter.export_stream(&next_sample, &replay_sampler, &stream);
+ * // with Arrow C++
+ * auto reader = arrow::ImportRecordBatchReader(&stream).ValueOrDie();
+ * auto writer = arrow::ipc::MakeFileWriter(file, reader->schema()).ValueOrDie();
+ * for (auto batch : *reader) {
+ *     writer->WriteRecordBatch(*batch.ValueOrDie());
+ * }
+ * @endcode
+ */
+class arrow_exporter {
+  public:
+    /**
+     * @brief Pushes the next samples of a stream to @p exporter, and sets
+     * @p end once there are none left.
+     */
+    using sample_source = std::error_code (*)(void *user_data, arrow_exporter &exporter, bool &end);
+
+    /** Number of columns before the counters. */
+    static constexpr size_t num_fixed_columns = 5;
+
+    /**
+     * @brief Constructs an exporter.
+     *
+     * @param [in] hardware      The hardware counters, in column order.
+     * @param [in] num_hardware  Number of hardware counters.
+     * @param [in] derived       The derived counters, in column order.
+     * @param [in] num_derived   Number of derived counters.
+     * @param [in] batch_rows    Number of samples of a batch, at least one.
+     */
+    arrow_exporter(const hwcpipe_counter *hardware, size_t num_hardware, const hwcpipe_counter *derived,
+                   size_t num_derived, size_t batch_rows)
+        : hardware_(hardware, hardware + num_hardware)
+        , derived_(derived, derived + num_derived)
+        , batch_rows_(std::max<size_t>(batch_rows, 1))
+        , staging_hardware_(num_hardware)
+        , staging_derived_(num_derived) {
+        reset_columns();
+    }
+
+    arrow_exporter(const arrow_exporter &) = delete;
+    arrow_exporter &operator=(const arrow_exporter &) = delete;
+
+    /** @return The number of columns of a batch. */
+    HWCP_NODISCARD size_t num_columns() const { return num_fixed_columns + hardware_.size() + derived_.size(); }
+
+    /** @return The number of samples of a full batch. */
+    HWCP_NODISCARD size_t batch_rows() const { return batch_rows_; }
+
+    /** @return The number of samples of the batch being built. */
+    HWCP_NODISCARD size_t rows() const { return uint_columns_[0].size(); }
+
+    /**
+     * @return The memory held by the exporter in bytes, including the columns
+     * of the batch being built. The columns of an exported batch belong to
+     * Arrow once it is exported.
+     */
+    HWCP_NODISCARD size_t get_memory_footprint() const {
+        return sizeof(*this) + detail::heap_bytes(hardware_) + detail::heap_bytes(derived_) +
+               detail::heap_bytes(staging_hardware_) + detail::heap_bytes(staging_derived_) +
+               detail::heap_bytes(uint_columns_) + detail::heap_bytes(double_columns_);
+    }
+
+    /** @return True if the batch being built is full. */
+    HWCP_NODISCARD bool full() const { return rows() >= batch_rows_; }
+
+    /**
+     * @brief Appends a sample to the batch being built.
+     *
+     * @param [in] interval         The interval and cycles of the sample.
+     * @param [in] user_data        The user data of the sample.
+     * @param [in] hardware_values  One value per hardware counter.
+     * @param [in] derived_values   One value per derived counter.
+     */
+    void push(const sample_interval &interval, uint64_t user_data, const uint64_t *hardware_values,
+              const double *derived_values) {
+        uint_columns_[0].push_back(interval.timestamp_ns_begin);
+        uint_columns_[1].push_back(interval.timestamp_ns_end);
+        uint_columns_[2].push_back(interval.gpu_cycles);
+        uint_columns_[3].push_back(interval.sc_cycles);
+        uint_columns_[4].push_back(user_data);
+        for (size_t i = 0; i != hardware_.size(); ++i) {
+            uint_columns_[num_fixed_columns + i].push_back(hardware_values[i]);
+        }
+        for (size_t i = 0; i != derived_.size(); ++i) {
+            double_columns_[i].push_back(derived_values[i]);
+        }
+    }
+
+    /**
+     * @brief Appends the last sample of a sampler to the batch being built.
+     *
+     * @param [in] sampler        The sampler, after a successful sample.
+     * @param [in] hardware_list  A read list of the hardware counters.
+     * @param [in] derived_list   A read list of the derived counters.
+     * @return The error of sampler::get_counter_values().
+     */
+    template <typename sampler_t, typename read_list_t>
+    HWCP_NODISCARD std::error_code push(const sampler_t &sampler, const read_list_t &hardware_list,
+                                        const read_list_t &derived_list) {
+        auto ec = sampler.get_counter_values(hardware_list, staging_hardware_.data(), staging_hardware_.size());
+        if (!ec) {
+            ec = sampler.get_counter_values(derived_list, staging_derived_.data(), staging_derived_.size());
+        }
+        if (ec) {
+            return ec;
+        }
+        push(sampler.get_sample_interval(), sampler.get_sample_user_data(), staging_hardware_.data(),
+             staging_derived_.data());
+        return {};
+    }
+
+    /**
+     * @brief Exports the schema of the batches, a struct with one field per
+     * column, named after the counters.
+     *
+     * @param [out] out  The schema, released by its consumer.
+     * @return hwcpipe::errc::unknown_counter if a counter has no metadata.
+     */
+    HWCP_NODISCARD std::error_code export_schema(ArrowSchema *out) const {
+        static const char *const uint64_format = "L";
+        static const char *const float64_format = "g";
+        static const char *const fixed_names[num_fixed_columns] = {"timestamp_ns_begin", "timestamp_ns_end",
+                                                                   "gpu_cycles", "sc_cycles", "user_data"};
+
+        counter_database database{};
+        std::unique_ptr<schema_data> data(new schema_data{});
+        data->fields.resize(num_columns());
+
+        size_t column = 0;
+        for (const char *name : fixed_names) {
+            make_field(data->fields[column++], name, uint64_format);
+        }
+        const auto add_fields = [&](const std::vector<hwcpipe_counter> &counters, const char *format) {
+            for (const auto counter : counters) {
+                counter_metadata metadata{};
+                auto ec = database.describe_counter(counter, metadata);
+                if (ec) {
+                    return ec;
+                }
+                make_field(data->fields[column++], metadata.name, format);
+            }
+            return std::error_code{};
+        };
+        auto ec = add_fields(hardware_, uint64_format);
+        if (!ec) {
+            ec = add_fields(derived_, float64_format);
+        }
+        if (ec) {
+            return ec;
+        }
+
+        for (auto &field : data->fields) {
+            data->children.push_back(&field);
+        }
+        const auto num_children = static_cast<int64_t>(data->children.size());
+        *out = ArrowSchema{"+s", "", nullptr, 0, num_children, data->children.data(), nullptr, &release_schema,
+                           data.release()};
+        return {};
+    }
+
+    /**
+     * @brief Exports the batch being built, which may be partial, and starts
+     * a new one. The column buffers are moved into the batch.
+     *
+     * @param [out] out  The batch, a struct array released by its consumer.
+     */
+    void export_batch(ArrowArray *out) {
+        const auto length = static_cast<int64_t>(rows());
+        std::unique_ptr<batch_data> data(new batch_data{});
+        data->columns.resize(num_columns());
+
+        size_t column = 0;
+        for (auto &values : uint_columns_) {
+            make_column(data->columns[column++], length, std::move(values));
+        }
+        for (auto &values : double_columns_) {
+            make_column(data->columns[column++], length, std::move(values));
+        }
+        reset_columns();
+
+        for (auto &child : data->columns) {
+            data->children.push_back(&child);
+        }
+        const auto num_children = static_cast<int64_t>(data->children.size());
+        *out = ArrowArray{length, 0, 0, 1, num_children, data->buffers, data->children.data(), nullptr, &release_batch,
+                          data.release()};
+    }
+
+    /**
+     * @brief Exports a stream of batches. Each batch is built when the
+     * consumer asks for it, by calling @p source until the batch is full or
+     * the source ends. The exporter must outlive the stream.
+     *
+     * @param [in]  source     Pushes the samples of the stream.
+     * @param [in]  user_data  Passed to @p source.
+     * @param [out] out        The stream, released by its consumer.
+     */
+    void export_stream(sample_source source, void *user_data, ArrowArrayStream *out) {
+        std::unique_ptr<stream_data> data(new stream_data{this, source, user_data, false, {}});
+        *out = ArrowArrayStream{&stream_get_schema, &stream_get_next, &stream_get_last_error, &release_stream,
+                                data.release()};
+    }
+
+  private:
+    // the fields of an exported schema
+    struct schema_data {
+        std::vector<ArrowSchema> fields;
+        std::vector<ArrowSchema *> children;
+    };
+
+    // the columns of an exported batch, and its absent validity bitmap
+    struct batch_data {
+        std::vector<ArrowArray> columns;
+        std::vector<ArrowArray *> children;
+        const void *buffers[1];
+    };
+
+    // the values of an exported column, owned by the column so that it can
+    // be moved out of its batch
+    template <typename value_t>
+    struct column_data {
+        std::vector<value_t> values;
+        const void *buffers[2];
+    };
+
+    // the state of an exported stream
+    struct stream_data {
+        arrow_exporter *exporter;
+        sample_source source;
+        void *user_data;
+        bool end;
+        std::string error;
+    };
+
+    /** Starts a new batch with empty columns, reserved for a full batch. */
+    void reset_columns() {
+        uint_columns_.resize(num_fixed_columns + hardware_.size());
+        double_columns_.resize(derived_.size());
+        for (auto &values : uint_columns_) {
+            values = std::vector<uint64_t>();
+            values.reserve(batch_rows_);
+        }
+        for (auto &values : double_columns_) {
+            values = std::vector<double>();
+            values.reserve(batch_rows_);
+        }
+    }
+
+    /** Fills a field of a schema. Names and formats are static strings. */
+    static void make_field(ArrowSchema &field, const char *name, const char *format) {
+        field = ArrowSchema{format, name, nullptr, 0, 0, nullptr, nullptr, &release_field, nullptr};
+    }
+
+    /** Fills a column of a batch, which takes @p values. */
+    template <typename value_t>
+    static void make_column(ArrowArray &column, int64_t length, std::vector<value_t> &&values) {
+        auto *data = new column_data<value_t>{std::move(values), {nullptr, nullptr}};
+        data->buffers[1] = data->values.data();
+        column = ArrowArray{length, 0, 0, 2, 0, data->buffers, nullptr, nullptr, &release_column<value_t>, data};
+    }
+
+    static void release_field(ArrowSchema *field) { field->release = nullptr; }
+
+    static void release_schema(ArrowSchema *schema) {
+        auto *data = static_cast<schema_data *>(schema->private_data);
+        for (auto *child : data->children) {
+            if (child->release != nullptr) {
+                child->release(child);
+            }
+        }
+        delete data;
+        schema->release = nullptr;
+    }
+
+    template <typename value_t>
+    static void release_column(ArrowArray *column) {
+        delete static_cast<column_data<value_t> *>(column->private_data);
+        column->release = nullptr;
+    }
+
+    static void release_batch(ArrowArray *batch) {
+        auto *data = static_cast<batch_data *>(batch->private_data);
+        for (auto *child : data->children) {
+            if (child->release != nullptr) {
+                child->release(child);
+            }
+        }
+        delete data;
+        batch->release = nullptr;
+    }
+
+    static int stream_get_schema(ArrowArrayStream *stream, ArrowSchema *out) {
+        auto *data = static_cast<stream_data *>(stream->private_data);
+        auto ec = data->exporter->export_schema(out);
+        if (ec) {
+            data->error = ec.message();
+            return EINVAL;
+        }
+        return 0;
+    }
+
+    /** Builds the next batch, or marks the end of the stream with a released batch. */
+    static int stream_get_next(ArrowArrayStream *stream, ArrowArray *out) {
+        auto *data = static_cast<stream_data *>(stream->private_data);
+        auto &exporter = *data->exporter;
+        while (!data->end && !exporter.full()) {
+            auto ec = data->source(data->user_data, exporter, data->end);
+            if (ec) {
+                data->error = ec.message();
+                return EIO;
+            }
+        }
+
+        if (exporter.rows() == 0) {
+            out->release = nullptr;
+            return 0;
+        }
+        exporter.export_batch(out);
+        return 0;
+    }
+
+    static const char *stream_get_last_error(ArrowArrayStream *stream) {
+        const auto *data = static_cast<stream_data *>(stream->private_data);
+        return data->error.empty() ? nullptr : data->error.c_str();
+    }
+
+    static void release_stream(ArrowArrayStream *stream) {
+        delete static_cast<stream_data *>(stream->private_data);
+        stream->release = nullptr;
+    }
+
+    const std::vector<hwcpipe_counter> hardware_;
+    const std::vector<hwcpipe_counter> derived_;
+    const size_t batch_rows_;
+    std::vector<uint64_t> staging_hardware_;
+    std::vector<double> staging_derived_;
+    // the columns of the batch being built
+    std::vector<std::vector<uint64_t>> uint_columns_{};
+    std::vector<std::vector<double>> double_columns_{};
+};
+
+} // namespace hwcpipe
@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include "hwcpipe/error.hpp"
+#include "hwcpipe/sampler.hpp"
+#include "hwcpipe/types.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <system_error>
+#include <utility>
+
+#if defined(__cpp_impl_coroutine) && defined(__has_include)
+#if __has_include(<coroutine>)
+#include <coroutine>
+#define HWCP_HAS_COROUTINES 1
+#endif
+#endif
+
+namespace hwcpipe {
+
+/**
+ * @brief Collects the samples of a sampler from an event loop, e.g. an
+ * asio-style executor, instead of a thread blocked in sampler::sample_now().
+ * Many samplers can then share one I/O thread.
+ *
+ * The event loop is given as a reactor: a callable that waits, once, for a
+ * file descriptor to be readable, and then calls a function on the thread of
+ * the loop, like asio's posix::stream_descriptor::async_wait(). async_sample()
+ * requests a sample, registers the reader of the sampler with the reactor,
+ * and collects the sample with sampler::try_collect() when it is ready. The
+ * completion handler is then called with the error of the collection, on the
+ * thread of the loop. In C++20, sample() returns an awaitable that resumes a
+ * coroutine instead.
+ *
+ * One operation can be pending at a time. The async_sampler, and its
+ * sampler, must outlive the pending operation, or cancel() it. It is not
+ * thread-safe: its operations must be started on the thread of the loop.
+ *
+ * @par
+ * @code
+ * asio::posix::stream_descriptor fd(io, dup(sampler.get_fd()));
+ * hwcpipe::async_sampler<> async(sampler, [&](int, std::function<void()> on_readable) {
+ *     fd.async_wait(asio::posix::descriptor_base::wait_read, [=](std::error_code) { on_readable(); });
+ * });
+ * ec = async.async_sample(0, [&](std::error_code ec) {
+ *     if (!ec) {
+ *         ec = sampler.get_counter_values(list, values, num_values);
+ *     }
+ * });
+ * io.run();
+ * @endcode
+ *
+ * @tparam sampler_t  The sampler type.
+ */
+template <typename sampler_t = sampler<>>
+class async_sampler {
+  public:
+    /** Called once a sample was collected, or with the error that ended the operation. */
+    using completion_handler = std::function<void(std::error_code)>;
+
+    /** Calls its second argument once when the file descriptor @p fd is readable. */
+    using reactor = std::function<void(int fd, std::function<void()> on_readable)>;
+
+    /**
+     * @param [in] sampler        The sampler, started before the operations.
+     * @param [in] wait_readable  The reactor of the event loop.
+     */
+    async_sampler(sampler_t &sampler, reactor wait_readable)
+        : sampler_(sampler)
+        , reactor_(std::move(wait_readable)) {}
+
+    async_sampler(const async_sampler &) = delete;
+    async_sampler &operator=(const async_sampler &) = delete;
+
+    /** @return True while an operation is pending. */
+    HWCP_NODISCARD bool pending() const { return static_cast<bool>(handler_); }
+
+    /**
+     * @brief Requests a sample, see sampler::request_sample_async(), and
+     * calls @p handler once it is collected. A periodic sampler waits for
+     * its next sample.
+     *
+     * @param [in] user_data  A tag stored with the manual sample, as for
+     *                        sampler::sample_now().
+     * @param [in] handler    The completion handler.
+     * @return std::errc::operation_in_progress if an operation is pending,
+     * the error of the request, in which case the handler is not called,
+     * otherwise an empty error_code.
+     */
+    HWCP_NODISCARD std::error_code async_sample(uint64_t user_data, completion_handler handler) {
+        if (pending()) {
+            return std::make_error_code(std::errc::operation_in_progress);
+        }
+        auto ec = sampler_.request_sample_async(user_data);
+        if (ec) {
+            return ec;
+        }
+        return async_collect(std::move(handler));
+    }
+
+    /**
+     * @brief Calls @p handler once the next sample is collected, without
+     * requesting one, e.g. for a periodic sampler or a manual sample
+     * requested earlier.
+     *
+     * @param [in] handler  The completion handler.
+     * @return std::errc::operation_in_progress if an operation is pending,
+     * otherwise an empty error_code.
+     */
+    HWCP_NODISCARD std::error_code async_collect(completion_handler handler) {
+        if (pending()) {
+            return std::make_error_code(std::errc::operation_in_progress);
+        }
+        handler_ = std::move(handler);
+        wait();
+        return {};
+    }
+
+    /**
+     * @brief Abandons the pending operation: its handler is called with
+     * std::errc::operation_canceled, and the reactor's callback does nothing
+     * when it comes. A sample that was requested stays in the kernel buffer,
+     * and is the next one collected.
+     */
+    void cancel() {
+        if (!pending()) {
+            return;
+        }
+        ++generation_;
+        complete(std::make_error_code(std::errc::operation_canceled));
+    }
+
+#ifdef HWCP_HAS_COROUTINES
+    /** The awaitable of sample(), which resumes the coroutine with the error of the sample. */
+    class sample_awaitable {
+      public:
+        sample_awaitable(async_sampler &owner, uint64_t user_data)
+            : owner_(owner)
+            , user_data_(user_data) {}
+
+        bool await_ready() const noexcept { return false; }
+
+        bool await_suspend(std::coroutine_handle<> handle) {
+            // the handler may resume the coroutine before the call returns,
+            // so the awaitable isn't used after it
+            auto ec = owner_.async_sample(user_data_, [this, handle](std::error_code result) {
+                ec_ = result;
+                handle.resume();
+            });
+            if (ec) {
+                ec_ = ec;
+                return false;
+            }
+            return true;
+        }
+
+        std::error_code await_resume() const noexcept { return ec_; }
+
+      private:
+        async_sampler &owner_;
+        uint64_t user_data_;
+        std::error_code ec_{};
+    };
+
+    /**
+     * @brief Same as async_sample(), for a C++20 coroutine.
+     *
+     * @par
+     * @code
+     * const std::error_code ec = co_await async.sample(frame_number);
+     * @endcode
+     */
+    HWCP_NODISCARD sample_awaitable sample(uint64_t user_data = 0) { return sample_awaitable(*this, user_data); }
+#endif
+
+  private:
+    /** Waits for the reader to be readable, ignoring the callbacks of cancelled operations. */
+    void wait() {
+        const uint64_t generation = generation_;
+        reactor_(sampler_.get_fd(), [this, generation] {
+            if (generation == generation_) {
+                on_readable();
+            }
+        });
+    }
+
+    void on_readable() {
+        auto ec = sampler_.try_collect();
+        // a spurious wake-up, or a sample that didn't complete a window of
+        // merged samples
+        if (ec == make_error_code(errc::sample_not_ready)) {
+            wait();
+            return;
+        }
+        complete(ec);
+    }
+
+    void complete(std::error_code ec) {
+        // the handler may start the next operation
+        auto handler = std::move(handler_);
+        handler_ = nullptr;
+        handler(ec);
+    }
+
+    sampler_t &sampler_;
+    reactor reactor_;
+    completion_handler handler_{};
+    uint64_t generation_{};
+};
+
+} // namespace hwcpipe
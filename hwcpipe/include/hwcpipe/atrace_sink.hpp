@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include "hwcpipe/detail/heap_bytes.hpp"
+#include "hwcpipe/error.hpp"
+#include "hwcpipe/hwcpipe_counter.h"
+#include "hwcpipe/types.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <system_error>
+#include <vector>
+
+namespace hwcpipe {
+
+/** The events written by an atrace_sink. */
+struct atrace_sink_config {
+    /**
+     * Process ID of the events, which selects the process track they are
+     * shown on, or zero for the calling process.
+     */
+    int pid{};
+    /** Prepended to the counter names, e.g. "GPU " to group them. */
+    const char *name_prefix{""};
+    /**
+     * Indices of the values that are written, or nullptr to write every
+     * value. The array is copied.
+     */
+    const size_t *columns{};
+    /** Number of indices in columns. */
+    size_t num_columns{};
+    /**
+     * Largest write() to the trace marker in bytes. The kernel truncates
+     * larger writes, so the events of a sample that don't fit are written
+     * with more calls.
+     */
+    size_t max_write_size{1024};
+};
+
+/** The events written by an atrace_sink. */
+struct atrace_sink_stats {
+    /** Samples written. */
+    uint64_t samples;
+    /** Counter events written. */
+    uint64_t events;
+    /** Calls to write(). */
+    uint64_t writes;
+    /** Bytes written. */
+    uint64_t bytes;
+};
+
+/**
+ * @brief An atrace_sink writes counter values to the ftrace trace marker as
+ * atrace counter events, `C|pid|name|value`, which systrace and Perfetto
+ * show as counter tracks. It needs no tracing SDK, only a trace marker,
+ * see open_trace_marker().
+ *
+ * The prefix of each event, up to the value, is formatted once at
+ * construction. Writing a sample then only formats the integer values
+ * behind the prefixes, two digits at a time, into a buffer allocated at
+ * construction, and writes all the events of the sample, one per line, with
+ * a single write() to the marker. Derived values are rounded to integers,
+ * as atrace counters are. The sink doesn't own the file descriptor.
+ *
+ * @par
+ * @code
+ * std::error_code ec;
+ * const int fd = hwcpipe::atrace_sink::open_trace_marker(ec);
+ * hwcpipe::atrace_sink_config sink_config{};
+ * sink_config.name_prefix = "GPU ";
+ * hwcpipe::atrace_sink sink(fd, counters, num_counters, sink_config);
+ * while (running) {
+ *     if (!sampler.sample_now()) {
+ *         ec = sink.push(sampler, list);
+ *     }
+ * }
+ * @endcode
+ */
+class atrace_sink {
+  public:
+    /**
+     * @brief Constructs a sink. Counters without metadata are named by their
+     * number.
+     *
+     * @param [in] fd            The trace marker, or any file to test with.
+     * @param [in] counters      The counters of the values of each sample.
+     * @param [in] num_counters  Number of values of each sample.
+     * @param [in] config        The events written.
+     */
+    atrace_sink(int fd, const hwcpipe_counter *counters, size_t num_counters, const atrace_sink_config &config);
+
+    atrace_sink(const atrace_sink &) = delete;
+    atrace_sink &operator=(const atrace_sink &) = delete;
+
+    /**
+     * @brief Opens the trace marker of the tracefs mount, or of the debugfs
+     * one on older kernels.
+     *
+     * @param [out] ec  Set to hwcpipe::errc::trace_marker_unavailable if
+     *                  neither could be opened for writing.
+     * @return The file descriptor, or -1.
+     */
+    HWCP_NODISCARD static int open_trace_marker(std::error_code &ec);
+
+    /** @return The number of values of each sample. */
+    HWCP_NODISCARD size_t values_per_sample() const { return staging_.size(); }
+
+    /** @return The number of counters written per sample. */
+    HWCP_NODISCARD size_t num_columns() const { return columns_.size(); }
+
+    /** @return The memory held by the sink in bytes, including the prefixes and the event buffer. */
+    HWCP_NODISCARD size_t get_memory_footprint() const {
+        return sizeof(*this) + detail::heap_bytes(columns_) + detail::heap_bytes(prefixes_) +
+               detail::heap_bytes(prefix_offsets_) + detail::heap_bytes(buffer_) + detail::heap_bytes(values_) +
+               detail::heap_bytes(staging_);
+    }
+
+    /** @return The events written so far. */
+    HWCP_NODISCARD const atrace_sink_stats &get_stats() const { return stats_; }
+
+    /**
+     * @brief Writes the events of a sample.
+     *
+     * @param [in] values  values_per_sample() counter values.
+     * @return hwcpipe::errc::trace_marker_unavailable if the marker couldn't
+     * be written.
+     */
+    template <typename value_t>
+    HWCP_NODISCARD std::error_code push(const value_t *values) {
+        for (size_t i = 0; i != columns_.size(); ++i) {
+            values_[i] = to_integer(values[columns_[i]]);
+        }
+        return write_events();
+    }
+
+    /**
+     * @brief Writes the events of the last sample of a sampler.
+     *
+     * @param [in] sampler  The sampler, after a successful sample.
+     * @param [in] list     A read list of the sampler with
+     *                      values_per_sample() counters.
+     * @return The error of sampler::get_counter_values(), otherwise the
+     * error of push().
+     */
+    template <typename sampler_t, typename read_list_t>
+    HWCP_NODISCARD std::error_code push(const sampler_t &sampler, const read_list_t &list) {
+        auto ec = sampler.get_counter_values(list, staging_.data(), staging_.size());
+        if (ec) {
+            return ec;
+        }
+        return push(staging_.data());
+    }
+
+  private:
+    static int64_t to_integer(uint64_t value) { return value > INT64_MAX ? INT64_MAX : static_cast<int64_t>(value); }
+
+    static int64_t to_integer(double value) {
+        if (std::isnan(value)) {
+            return 0;
+        }
+        if (value <= static_cast<double>(INT64_MIN)) {
+            return INT64_MIN;
+        }
+        return value < static_cast<double>(INT64_MAX) ? std::llround(value) : INT64_MAX;
+    }
+
+    /** Formats values_ behind the prefixes and writes the events. */
+    HWCP_NODISCARD std::error_code write_events();
+
+    /** Writes @p size bytes of the buffer, retrying interrupted writes. */
+    HWCP_NODISCARD std::error_code write(const char *data, size_t size);
+
+    const int fd_;
+    const size_t max_write_size_;
+    // the index of the value of each written counter
+    std::vector<size_t> columns_{};
+    // the "C|pid|name|" prefix of each written counter, back to back
+    std::vector<char> prefixes_{};
+    std::vector<size_t> prefix_offsets_{};
+    // room for every event of a sample with the longest values
+    std::vector<char> buffer_{};
+    std::vector<int64_t> values_{};
+    std::vector<double> staging_;
+    atrace_sink_stats stats_{};
+};
+
+} // namespace hwcpipe
@@ -0,0 +1,273 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include "hwcpipe/detail/heap_bytes.hpp"
+#include "hwcpipe/error.hpp"
+#include "hwcpipe/hwcpipe_counter.h"
+#include "hwcpipe/types.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <system_error>
+#include <vector>
+
+namespace hwcpipe {
+
+/** What limits the frame rate over a window of samples. */
+enum class bottleneck : uint8_t {
+    /** The GPU doesn't have the counters to tell. */
+    unknown,
+    /** Neither GPU queue is busy, so the GPU waits for the CPU. */
+    cpu,
+    /** The fragment queue is the busiest. */
+    fragment,
+    /** The non-fragment queue, which runs the vertex shading and the tiling, or the tiler are the busiest. */
+    vertex_tiler,
+    /** The GPU is busy, and its reads often stall on the external bus. */
+    memory,
+};
+
+/** Number of bottleneck values. */
+constexpr size_t num_bottlenecks = 5;
+
+/** @return The name of a bottleneck, e.g. "vertex_tiler". */
+HWCP_NODISCARD const char *get_bottleneck_name(bottleneck kind);
+
+/** The utilisations a bottleneck_classifier classifies windows from. */
+enum class bottleneck_input : uint8_t {
+    /** MaliFragQueueUtil, or MaliMainQueueUtil on GPUs without it. */
+    fragment_queue,
+    /** MaliNonFragQueueUtil, or MaliBinningQueueUtil on GPUs without it. */
+    non_fragment_queue,
+    /** MaliTilerUtil. */
+    tiler,
+    /** MaliExtBusRdStallRate. */
+    bus_read_stall,
+    /** MaliCoreUtil. */
+    core,
+};
+
+/** Number of bottleneck_input values. */
+constexpr size_t num_bottleneck_inputs = 5;
+
+/** The thresholds and the windows of a bottleneck_classifier. */
+struct bottleneck_classifier_config {
+    /** Utilisation, in percent, from which a GPU queue is busy. Below it on both queues, the window is CPU bound. */
+    double gpu_busy_threshold{80.0};
+    /** Read stall rate, in percent, from which a busy GPU is memory bound. */
+    double bus_stall_threshold{10.0};
+    /** Number of samples classified together, e.g. the samples of a frame. Zero is taken as one. */
+    size_t window_samples{1};
+    /** Number of finished runs kept until take_runs(). The oldest runs are dropped. */
+    size_t max_runs{256};
+};
+
+/** Consecutive windows with the same bottleneck. */
+struct bottleneck_run {
+    /** Start of the first window. */
+    uint64_t timestamp_ns_begin;
+    /** End of the last window. */
+    uint64_t timestamp_ns_end;
+    /** Number of windows. */
+    uint32_t windows;
+    bottleneck kind;
+};
+
+/** The windows classified with one bottleneck. */
+struct bottleneck_summary {
+    /** Number of windows. */
+    uint64_t windows;
+    /** Sum of the window durations. */
+    uint64_t time_ns;
+    /**
+     * Mean of each input over the windows, weighted by the sample durations
+     * and indexed by bottleneck_input, or NaN for the inputs the GPU doesn't
+     * have.
+     */
+    std::array<double, num_bottleneck_inputs> mean;
+};
+
+/**
+ * @brief A bottleneck_classifier classifies each window of samples as CPU,
+ * fragment, vertex/tiler or memory bound, from the GPU utilisation and
+ * external bus counters of the bottleneck counter preset. It keeps the runs
+ * of windows with the same bottleneck and a summary per bottleneck, so that
+ * they can be shipped instead of the counter values.
+ *
+ * A window is:
+ *  - CPU bound if neither GPU queue reaches gpu_busy_threshold,
+ *  - memory bound if the read stall rate reaches bus_stall_threshold,
+ *  - fragment bound if the fragment queue is at least as busy as the
+ *    non-fragment queue and the tiler,
+ *  - vertex/tiler bound otherwise.
+ *
+ * The inputs are resolved at construction from the counters the GPU has, so
+ * the same classifier works on every GPU: fifth generation GPUs report their
+ * binning and main queues instead of the non-fragment and fragment queues,
+ * and a missing stall rate or tiler utilisation only skips its rule. Each
+ * push() only adds the inputs of a sample to the window, weighted by the
+ * sample duration; the window is classified when it's full.
+ *
+ * @par
+ * @code
+ * hwcpipe::sampler_config config(gpu);
+ * config.add_preset(hwcpipe::counter_preset::bottleneck);
+ * hwcpipe::bottleneck_classifier classifier(config);
+ * hwcpipe::sampler<> sampler(config);
+ * auto list = sampler.make_read_list(classifier.get_counters(), classifier.num_counters(), ec);
+ * while (running) {
+ *     if (!sampler.sample_now()) {
+ *         ec = classifier.push(sampler, list);
+ *     }
+ * }
+ * @endcode
+ */
+class bottleneck_classifier {
+  public:
+    /**
+     * @brief Constructs a classifier from the counters a GPU has.
+     *
+     * @param [in] available      The counters the GPU has, e.g. the valid counters of a sampler_config.
+     * @param [in] num_available  Number of counters in @p available.
+     * @param [in] config         The thresholds and the windows.
+     */
+    bottleneck_classifier(const hwcpipe_counter *available, size_t num_available,
+                          const bottleneck_classifier_config &config = {});
+
+    /**
+     * @brief Constructs a classifier from the valid counters of a sampler configuration.
+     *
+     * @param [in] sampler_config  A sampler_config with the bottleneck preset.
+     * @param [in] config          The thresholds and the windows.
+     */
+    template <typename sampler_config_t>
+    explicit bottleneck_classifier(const sampler_config_t &sampler_config,
+                                   const bottleneck_classifier_config &config = {})
+        : bottleneck_classifier(valid_counters(sampler_config), config) {}
+
+    /** @return The counters of the values of each sample, in the order push() takes them. */
+    HWCP_NODISCARD const hwcpipe_counter *get_counters() const { return counters_.data(); }
+
+    /** @return The number of values of each sample. */
+    HWCP_NODISCARD size_t num_counters() const { return counters_.size(); }
+
+    /** @return Whether the GPU has a counter for an input. */
+    HWCP_NODISCARD bool has_input(bottleneck_input input) const {
+        return columns_[static_cast<size_t>(input)] != no_column;
+    }
+
+    /**
+     * @brief Adds a sample to the window, and classifies the window if it's full.
+     *
+     * @param [in] timestamp_ns_begin  Start of the sample.
+     * @param [in] timestamp_ns_end    End of the sample.
+     * @param [in] values              num_counters() values.
+     * @return Whether a window was classified.
+     */
+    bool push(uint64_t timestamp_ns_begin, uint64_t timestamp_ns_end, const double *values);
+
+    /**
+     * @brief Adds the last sample of a sampler to the window.
+     *
+     * @param [in] sampler  The sampler, after a successful sample.
+     * @param [in] list     A read list of the sampler with the counters of get_counters().
+     * @return The error of sampler::get_counter_values().
+     */
+    template <typename sampler_t, typename read_list_t>
+    HWCP_NODISCARD std::error_code push(const sampler_t &sampler, const read_list_t &list) {
+        auto ec = sampler.get_counter_values(list, staging_.data(), staging_.size());
+        if (ec) {
+            return ec;
+        }
+        push(sampler.get_sample_timestamp(), sampler.get_sample_timestamp_end(), staging_.data());
+        return {};
+    }
+
+    /** @return The bottleneck of the last window, or bottleneck::unknown before the first one. */
+    HWCP_NODISCARD bottleneck last() const { return last_; }
+
+    /** @return The summary of the windows classified with a bottleneck. */
+    HWCP_NODISCARD const bottleneck_summary &get_summary(bottleneck kind) const {
+        return summaries_[static_cast<size_t>(kind)];
+    }
+
+    /** @return The number of finished runs that take_runs() returns. */
+    HWCP_NODISCARD size_t num_runs() const { return num_runs_; }
+
+    /** @return The number of finished runs dropped because max_runs were kept. */
+    HWCP_NODISCARD uint64_t num_dropped_runs() const { return dropped_runs_; }
+
+    /**
+     * @brief Takes the oldest finished runs. The run of the last window goes
+     * on until a window with another bottleneck, see finish_run().
+     *
+     * @param [out] runs      Receives the runs.
+     * @param [in]  max_runs  Size of @p runs.
+     * @return The number of runs written.
+     */
+    size_t take_runs(bottleneck_run *runs, size_t max_runs);
+
+    /** @brief Finishes the run of the last window, e.g. at the end of a capture, so that take_runs() returns it. */
+    void finish_run();
+
+    /** @return The memory held by the classifier in bytes. */
+    HWCP_NODISCARD size_t get_memory_footprint() const {
+        return sizeof(*this) + detail::heap_bytes(counters_) + detail::heap_bytes(runs_) +
+               detail::heap_bytes(staging_);
+    }
+
+  private:
+    static constexpr size_t no_column = SIZE_MAX;
+
+    template <typename sampler_config_t>
+    static std::vector<hwcpipe_counter> valid_counters(const sampler_config_t &sampler_config) {
+        std::vector<hwcpipe_counter> counters{};
+        for (const auto &registered : sampler_config.get_valid_counters()) {
+            counters.push_back(registered.counter);
+        }
+        return counters;
+    }
+
+    bottleneck_classifier(const std::vector<hwcpipe_counter> &available, const bottleneck_classifier_config &config)
+        : bottleneck_classifier(available.data(), available.size(), config) {}
+
+    /** Classifies the window from its means, indexed by bottleneck_input. */
+    bottleneck classify(const std::array<double, num_bottleneck_inputs> &mean) const;
+
+    /** Adds the window to its summary and to the runs, and starts the next one. */
+    void end_window();
+
+    const bottleneck_classifier_config config_;
+    // the column of each input in counters_, or no_column
+    std::array<size_t, num_bottleneck_inputs> columns_{};
+    std::vector<hwcpipe_counter> counters_{};
+
+    // the window being filled
+    size_t window_size_{};
+    uint64_t window_begin_{};
+    uint64_t window_end_{};
+    std::array<double, num_bottleneck_inputs> weighted_sums_{};
+    std::array<double, num_bottleneck_inputs> weights_{};
+
+    std::array<bottleneck_summary, num_bottlenecks> summaries_{};
+    // the weight behind each mean of the summaries
+    std::array<std::array<double, num_bottleneck_inputs>, num_bottlenecks> summary_weights_{};
+    bottleneck last_{bottleneck::unknown};
+    // the run of the last window
+    bottleneck_run current_{};
+    // the finished runs, a ring from runs_head_
+    std::vector<bottleneck_run> runs_{};
+    size_t runs_head_{};
+    size_t num_runs_{};
+    uint64_t dropped_runs_{};
+
+    std::vector<double> staging_{};
+};
+
+} // namespace hwcpipe
@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include "hwcpipe/types.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <ctime>
+#include <limits>
+
+namespace hwcpipe {
+
+/** The clocks that sample timestamps can be expressed in. */
+enum class clock_domain : uint8_t {
+    /** The clock of the kernel samples, CLOCK_MONOTONIC_RAW. Nothing is converted. */
+    sample,
+    /** CLOCK_MONOTONIC, slewed by NTP. */
+    monotonic,
+    /** CLOCK_BOOTTIME, CLOCK_MONOTONIC plus the time spent suspended. Used by Perfetto and Android traces. */
+    boottime,
+    /** CLOCK_REALTIME, the wall clock. */
+    realtime,
+};
+
+/**
+ * @brief A clock_correlator converts the timestamps of the kernel samples,
+ * taken on CLOCK_MONOTONIC_RAW, to another system clock, so that the counter
+ * tracks line up with traces recorded on that clock.
+ *
+ * The two clocks are read back to back, keeping the tightest of a few
+ * readings, which gives a reference point of each clock. The drift of the
+ * target clock, e.g. while NTP slews CLOCK_MONOTONIC, is the rate between two
+ * reference points. The correlation is refreshed by update() once per
+ * calibration interval, so that converting a timestamp is one multiply-add
+ * and the clocks are only read a few times per interval, not per sample.
+ *
+ * @par
+ * @code
+ * hwcpipe::clock_correlator correlator(hwcpipe::clock_domain::boottime);
+ * correlator.update(sample_ns);
+ * const uint64_t boottime_ns = correlator.convert(sample_ns);
+ * @endcode
+ */
+class clock_correlator {
+  public:
+    /** Reads a clock in nanoseconds. */
+    using clock_reader = uint64_t (*)(clockid_t clock);
+
+    /** The default calibration interval, one second. */
+    static constexpr uint64_t default_interval_ns = 1000000000;
+
+    /** Number of back to back readings of a calibration, the tightest of which is kept. */
+    static constexpr int num_readings = 3;
+
+    /**
+     * @param [in] target       The clock that timestamps are converted to.
+     * @param [in] interval_ns  The calibration interval in nanoseconds.
+     * @param [in] reader       Reads the clocks, the system clocks by default.
+     */
+    explicit clock_correlator(clock_domain target = clock_domain::sample, uint64_t interval_ns = default_interval_ns,
+                              clock_reader reader = &read_clock)
+        : target_(target)
+        , interval_ns_(interval_ns)
+        , reader_(reader) {}
+
+    /** @return The clock that timestamps are converted to. */
+    HWCP_NODISCARD clock_domain target() const { return target_; }
+
+    /** @return The calibration interval in nanoseconds. */
+    HWCP_NODISCARD uint64_t interval_ns() const { return interval_ns_; }
+
+    /** @return True once the clocks were read. */
+    HWCP_NODISCARD bool calibrated() const { return calibrated_; }
+
+    /** @return The number of calibrations. */
+    HWCP_NODISCARD uint64_t num_calibrations() const { return num_calibrations_; }
+
+    /**
+     * @return The offset of the target clock at the last calibration, in
+     * nanoseconds: target - sample clock.
+     */
+    HWCP_NODISCARD int64_t offset_ns() const { return static_cast<int64_t>(target_ref_ns_ - sample_ref_ns_); }
+
+    /** @return The drift of the target clock relative to the sample clock, in parts per million. */
+    HWCP_NODISCARD double drift_ppm() const { return (rate_ - 1.0) * 1e6; }
+
+    /**
+     * @return The uncertainty of the last calibration in nanoseconds, half of
+     * the time the back to back readings took.
+     */
+    HWCP_NODISCARD uint64_t uncertainty_ns() const { return uncertainty_ns_; }
+
+    /** @brief Reads the clocks now and updates the correlation. */
+    void calibrate() {
+        if (target_ == clock_domain::sample) {
+            return;
+        }
+
+        const clockid_t target_clock = to_clockid(target_);
+        uint64_t best_span = std::numeric_limits<uint64_t>::max();
+        uint64_t sample_ns = 0;
+        uint64_t target_ns = 0;
+        for (int i = 0; i != num_readings; ++i) {
+            const uint64_t before = reader_(CLOCK_MONOTONIC_RAW);
+            const uint64_t target = reader_(target_clock);
+            const uint64_t after = reader_(CLOCK_MONOTONIC_RAW);
+            const uint64_t span = after - before;
+            if (span < best_span) {
+                best_span = span;
+                sample_ns = before + span / 2;
+                target_ns = target;
+            }
+        }
+
+        // the rate is only measured over a long enough span to be above the
+        // noise of the readings
+        if (calibrated_ && sample_ns > sample_ref_ns_ && sample_ns - sample_ref_ns_ >= interval_ns_ / 2) {
+            rate_ = static_cast<double>(static_cast<int64_t>(target_ns - target_ref_ns_)) /
+                    static_cast<double>(sample_ns - sample_ref_ns_);
+        }
+        sample_ref_ns_ = sample_ns;
+        target_ref_ns_ = target_ns;
+        uncertainty_ns_ = best_span / 2;
+        next_calibration_ns_ = sample_ns + interval_ns_;
+        calibrated_ = true;
+        ++num_calibrations_;
+    }
+
+    /**
+     * @brief Calibrates if it is due at @p sample_ns, a timestamp of the
+     * sample clock, which is the case the first time.
+     */
+    void update(uint64_t sample_ns) {
+        if (!calibrated_ || sample_ns >= next_calibration_ns_) {
+            calibrate();
+        }
+    }
+
+    /**
+     * @param [in] sample_ns  A timestamp of the sample clock.
+     * @return The timestamp on the target clock, or @p sample_ns before the
+     * first calibration.
+     */
+    HWCP_NODISCARD uint64_t convert(uint64_t sample_ns) const {
+        if (!calibrated_) {
+            return sample_ns;
+        }
+        const auto delta = static_cast<double>(static_cast<int64_t>(sample_ns - sample_ref_ns_));
+        return target_ref_ns_ + static_cast<uint64_t>(std::llround(delta * rate_));
+    }
+
+    /** @return The clock of @p domain. */
+    HWCP_NODISCARD static clockid_t to_clockid(clock_domain domain) {
+        switch (domain) {
+        case clock_domain::monotonic:
+            return CLOCK_MONOTONIC;
+        case clock_domain::boottime:
+            return CLOCK_BOOTTIME;
+        case clock_domain::realtime:
+            return CLOCK_REALTIME;
+        case clock_domain::sample:
+        default:
+            return CLOCK_MONOTONIC_RAW;
+        }
+    }
+
+    /** @return The time of @p clock in nanoseconds. */
+    static uint64_t read_clock(clockid_t clock) {
+        timespec now{};
+        clock_gettime(clock, &now);
+        return static_cast<uint64_t>(now.tv_sec) * 1000000000 + static_cast<uint64_t>(now.tv_nsec);
+    }
+
+  private:
+    clock_domain target_;
+    uint64_t interval_ns_;
+    clock_reader reader_;
+    bool calibrated_{};
+    uint64_t num_calibrations_{};
+    uint64_t sample_ref_ns_{};
+    uint64_t target_ref_ns_{};
+    double rate_{1.0};
+    uint64_t uncertainty_ns_{};
+    uint64_t next_calibration_ns_{};
+};
+
+} // namespace hwcpipe
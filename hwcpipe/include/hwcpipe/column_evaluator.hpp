@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include "device/constants.hpp"
+#include "device/product_id.hpp"
+#include "hwcpipe/detail/counter_database.hpp"
+#include "hwcpipe/detail/internal_types.hpp"
+#include "hwcpipe/error.hpp"
+#include "hwcpipe/gpu.hpp"
+#include "hwcpipe/hwcpipe_counter.h"
+#include "hwcpipe/types.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <system_error>
+#include <unordered_map>
+#include <vector>
+
+namespace hwcpipe {
+
+/**
+ * @brief A column_evaluator computes a counter over many recorded samples at
+ * once. The caller provides one structure-of-arrays column of values per
+ * hardware counter that the counter depends on, and the evaluator produces the
+ * column of results using the generated batch evaluators of the database.
+ *
+ * @par
+ * @code
+ * hwcpipe::column_evaluator evaluator(gpu, MaliFragOverdraw);
+ * if (evaluator) {
+ *     std::vector<const double *> columns;
+ *     for (auto input : evaluator.get_inputs()) {
+ *         columns.push_back(history.column(input));
+ *     }
+ *     std::vector<double> overdraw(history.size());
+ *     auto ec = evaluator.evaluate(columns.data(), columns.size(), history.size(), overdraw.data());
+ * }
+ * @endcode
+ */
+class column_evaluator {
+  public:
+    /**
+     * Constructs an evaluator for a counter of a GPU.
+     *
+     * @param [in] gpu      The GPU the samples were recorded on.
+     * @param [in] counter  The counter to evaluate.
+     */
+    column_evaluator(const gpu &gpu, hwcpipe_counter counter)
+        : column_evaluator(gpu.get_product_id(), gpu.get_constants(), counter) {}
+
+    /**
+     * Constructs an evaluator for a counter of a GPU product. The evaluator is
+     * invalid if the product is unknown or doesn't have the counter.
+     *
+     * @param [in] pid        The product the samples were recorded on.
+     * @param [in] constants  The constants of the GPU the samples were
+     *                        recorded on.
+     * @param [in] counter    The counter to evaluate.
+     */
+    column_evaluator(device::product_id pid, const device::constants &constants, hwcpipe_counter counter)
+        : constants_(detail::expression::make_device_constants(constants)) {
+        std::unordered_map<hwcpipe_counter, operand> operands{};
+        build_steps(pid, counter, operands);
+    }
+
+    /** @return True if the evaluator is valid. */
+    operator bool() const { return !ec_; }
+
+    /**
+     * @return The construction error, e.g. hwcpipe::errc::invalid_counter_for_device
+     * if the product doesn't have the counter, otherwise an empty error_code.
+     */
+    HWCP_NODISCARD std::error_code get_error() const { return ec_; }
+
+    /**
+     * @return The hardware counters whose columns are passed to evaluate(),
+     * in the order they must be passed.
+     */
+    HWCP_NODISCARD const std::vector<hwcpipe_counter> &get_inputs() const { return inputs_; }
+
+    /**
+     * @brief Evaluates the counter over @p count samples.
+     *
+     * @param [in]  columns      One column of @p count values per entry of
+     *                           get_inputs(), in the same order.
+     * @param [in]  num_columns  Number of entries in @p columns.
+     * @param [in]  count        Number of samples in each column.
+     * @param [out] results      Receives @p count values.
+     * @return Returns hwcpipe::errc::invalid_read_list if @p num_columns does
+     * not match get_inputs(), the construction error if the evaluator is
+     * invalid, otherwise an empty error_code.
+     */
+    HWCP_NODISCARD std::error_code evaluate(const double *const *columns, size_t num_columns, size_t count,
+                                            double *results) {
+        if (ec_) {
+            return ec_;
+        }
+        if (num_columns != inputs_.size()) {
+            return make_error_code(errc::invalid_read_list);
+        }
+
+        // a hardware counter is its own input column
+        if (steps_.empty()) {
+            std::copy(columns[0], columns[0] + count, results);
+            return {};
+        }
+
+        // the counter itself is the last step, intermediate expressions are
+        // written to scratch columns
+        scratch_.resize((steps_.size() - 1) * count);
+        step_outputs_.clear();
+        for (size_t i = 0; i + 1 < steps_.size(); ++i) {
+            step_outputs_.push_back(scratch_.data() + i * count);
+        }
+        step_outputs_.push_back(results);
+
+        for (size_t i = 0; i != steps_.size(); ++i) {
+            const auto &step = steps_[i];
+            operand_columns_.resize(step.num_operands);
+            for (size_t k = 0; k != step.num_operands; ++k) {
+                const auto &op = operands_[step.operands_offset + k];
+                operand_columns_[k] = op.is_step ? step_outputs_[op.index] : columns[op.index];
+            }
+            step.eval(operand_columns_.data(), count, constants_, step_outputs_[i]);
+        }
+        return {};
+    }
+
+  private:
+    // the column an operand is read from: an input column, or the output of
+    // an earlier step
+    struct operand {
+        bool is_step;
+        size_t index;
+    };
+
+    // one expression of the plan, evaluated after all its dependencies
+    struct step {
+        detail::expression::batch_evaluator eval;
+        size_t operands_offset;
+        size_t num_operands;
+    };
+
+    /**
+     * Depth first post-order walk over the dependencies of @p counter that
+     * assigns a column to every counter and appends one step per expression.
+     */
+    void build_steps(device::product_id pid, hwcpipe_counter counter,
+                     std::unordered_map<hwcpipe_counter, operand> &operands) {
+        if (operands.find(counter) != operands.end()) {
+            return;
+        }
+
+        auto definition = db_.get_counter_def(pid, counter, ec_);
+        if (ec_) {
+            return;
+        }
+
+        switch (definition.tag) {
+        case detail::counter_definition::type::hardware:
+            operands.emplace(counter, operand{false, inputs_.size()});
+            inputs_.push_back(counter);
+            return;
+        case detail::counter_definition::type::expression: {
+            const auto &expression = definition.get_expression();
+            if (expression.batch_eval == nullptr) {
+                // the expressions of a database blob have no batch evaluator
+                ec_ = make_error_code(errc::invalid_counter_for_device);
+                return;
+            }
+            for (auto dependency : expression.dependencies) {
+                build_steps(pid, dependency, operands);
+                if (ec_) {
+                    return;
+                }
+            }
+
+            steps_.push_back({expression.batch_eval, operands_.size(), expression.dependencies.size()});
+            for (auto dependency : expression.dependencies) {
+                operands_.push_back(operands[dependency]);
+            }
+            operands.emplace(counter, operand{true, steps_.size() - 1});
+            return;
+        }
+        case detail::counter_definition::type::invalid:
+        default:
+            ec_ = make_error_code(errc::invalid_counter_for_device);
+            return;
+        }
+    }
+
+    std::error_code ec_;
+    detail::counter_database db_{};
+    detail::expression::device_constants constants_;
+
+    std::vector<hwcpipe_counter> inputs_{};
+    std::vector<step> steps_{};
+    std::vector<operand> operands_{};
+
+    // per evaluation scratch
+    std::vector<double *> step_outputs_{};
+    std::vector<const double *> operand_columns_{};
+    std::vector<double> scratch_{};
+};
+
+} // namespace hwcpipe
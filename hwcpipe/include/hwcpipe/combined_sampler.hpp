@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include "hwcpipe/cpu_counters.hpp"
+#include "hwcpipe/detail/internal_types.hpp"
+#include "hwcpipe/error.hpp"
+#include "hwcpipe/sampler.hpp"
+#include "hwcpipe/types.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <system_error>
+#include <vector>
+
+namespace hwcpipe {
+
+/**
+ * @brief A basic_combined_sampler samples the GPU counters of a sampler and
+ * the CPU counters of a cpu_counters on the same tick, for CPU/GPU balance
+ * analysis. Each sample_now_for() requests the GPU sample, reads the CPU
+ * counters right away, while the GPU dumps its counters, then collects the
+ * GPU sample. The CPU values are the counts since the previous sample.
+ *
+ * The combined sampler reads like a sampler: get_counter_values() writes the
+ * values of a GPU read list followed by the CPU values, and the timestamps
+ * are those of the GPU sample. It can therefore be pushed as is to the
+ * sinks that take a sampler and a read list, e.g. a timeline_summary or a
+ * network_sink, with values_per_sample() values per sample.
+ *
+ * The sampler should be manual, i.e. its configuration has no sampling
+ * period, so that the application's tick drives both. Neither the sampler
+ * nor the CPU counters are owned.
+ *
+ * @par
+ * @code
+ * hwcpipe::sampler<> gpu(config);
+ * hwcpipe::cpu_counters cpu(events, num_events, hwcpipe::cpu_counter_scope::per_cluster);
+ * hwcpipe::combined_sampler combined(gpu, cpu);
+ * auto list = gpu.make_read_list(counters, num_counters, ec);
+ * hwcpipe::timeline_summary summary(combined.values_per_sample(list), 512, 4);
+ * ec = combined.start_sampling();
+ * while (running) {
+ *     if (!combined.sample_now_for(10000000)) {
+ *         summary.push(combined, list);
+ *     }
+ * }
+ * @endcode
+ */
+template <typename backend_policy_t = detail::hwcpipe_backend_policy>
+class basic_combined_sampler {
+  public:
+    /** The type of the GPU sampler. */
+    using sampler_type = sampler<backend_policy_t>;
+
+    /**
+     * @param [in] gpu  The sampler of the GPU counters.
+     * @param [in] cpu  The CPU counters.
+     */
+    basic_combined_sampler(sampler_type &gpu, cpu_counters &cpu)
+        : gpu_(gpu)
+        , cpu_(cpu)
+        , previous_(cpu.size())
+        , current_(cpu.size())
+        , cpu_values_(cpu.size()) {}
+
+    /** @return The GPU sampler. */
+    HWCP_NODISCARD const sampler_type &get_gpu_sampler() const { return gpu_; }
+
+    /** @return The CPU counters. */
+    HWCP_NODISCARD const cpu_counters &get_cpu_counters() const { return cpu_; }
+
+    /** @return The number of values that get_counter_values() writes for @p list. */
+    template <typename read_list_t>
+    HWCP_NODISCARD size_t values_per_sample(const read_list_t &list) const {
+        return list.size() + cpu_values_.size();
+    }
+
+    /**
+     * @brief Starts the GPU sampling, and takes the CPU counts it starts from.
+     *
+     * @return The error of the CPU counters, otherwise the error of
+     * sampler::start_sampling().
+     */
+    HWCP_NODISCARD std::error_code start_sampling() {
+        auto ec = cpu_.read(previous_.data());
+        if (ec) {
+            return ec;
+        }
+        ec = gpu_.start_sampling();
+        if (ec) {
+            return ec;
+        }
+        pending_ = false;
+        return {};
+    }
+
+    /** @return The error of sampler::stop_sampling(). */
+    HWCP_NODISCARD std::error_code stop_sampling() { return gpu_.stop_sampling(); }
+
+    /**
+     * @brief Requests a GPU sample, reads the CPU counters, then collects the
+     * GPU sample.
+     *
+     * A GPU sample that is not ready by the timeout is collected by the next
+     * call, which doesn't request a new one nor read the CPU counters again,
+     * so the CPU values stay those of the tick of the GPU sample.
+     *
+     * @param [in] timeout_ns  Time to wait for the GPU sample in nanoseconds.
+     * @return hwcpipe::errc::sample_not_ready if the GPU sample timed out, the
+     * error of the CPU counters, or the error of the sampler. The values are
+     * only consistent if no error is returned.
+     */
+    HWCP_NODISCARD std::error_code sample_now_for(uint64_t timeout_ns) {
+        if (!pending_) {
+            auto ec = gpu_.request_sample_async();
+            if (ec) {
+                return ec;
+            }
+            pending_ = true;
+
+            cpu_timestamp_ns_ = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                                          std::chrono::steady_clock::now().time_since_epoch())
+                                                          .count());
+            cpu_ec_ = cpu_.read(current_.data());
+        }
+
+        auto ec = gpu_.collect_for(timeout_ns);
+        if (ec == make_error_code(errc::sample_not_ready)) {
+            return ec;
+        }
+        pending_ = false;
+        if (cpu_ec_) {
+            return cpu_ec_;
+        }
+
+        for (size_t i = 0; i != cpu_values_.size(); ++i) {
+            cpu_values_[i] = current_[i] - previous_[i];
+        }
+        std::swap(previous_, current_);
+        return ec;
+    }
+
+    /** @return Start of the counter accumulation of the GPU sample, in nanoseconds. */
+    HWCP_NODISCARD uint64_t get_sample_timestamp() const { return gpu_.get_sample_timestamp(); }
+
+    /** @return End of the counter accumulation of the GPU sample, in nanoseconds. */
+    HWCP_NODISCARD uint64_t get_sample_timestamp_end() const { return gpu_.get_sample_timestamp_end(); }
+
+    /** @return When the CPU counters were read, in nanoseconds of std::chrono::steady_clock. */
+    HWCP_NODISCARD uint64_t get_cpu_timestamp() const { return cpu_timestamp_ns_; }
+
+    /**
+     * @return The CPU counts of the last sample, cluster by cluster, each
+     * cluster in event order, see cpu_counters::read().
+     */
+    HWCP_NODISCARD const std::vector<uint64_t> &get_cpu_values() const { return cpu_values_; }
+
+    /**
+     * @brief Fetches the GPU values of a read list, followed by the CPU
+     * values.
+     *
+     * @param [in]  list    A read list of the GPU sampler.
+     * @param [out] values  The output array.
+     * @param [in]  count   Number of entries in @p values.
+     * @return hwcpipe::errc::invalid_read_list if @p values is smaller than
+     * values_per_sample(), otherwise the error of
+     * sampler::get_counter_values().
+     */
+    template <typename read_list_t, typename value_t>
+    HWCP_NODISCARD std::error_code get_counter_values(const read_list_t &list, value_t *values, size_t count) const {
+        if (count < values_per_sample(list)) {
+            return make_error_code(errc::invalid_read_list);
+        }
+        auto ec = gpu_.get_counter_values(list, values, list.size());
+        if (ec) {
+            return ec;
+        }
+        std::transform(cpu_values_.begin(), cpu_values_.end(), values + list.size(),
+                       [](uint64_t value) { return static_cast<value_t>(value); });
+        return {};
+    }
+
+  private:
+    sampler_type &gpu_;
+    cpu_counters &cpu_;
+    // the CPU counts of the previous and the current sample
+    std::vector<uint64_t> previous_;
+    std::vector<uint64_t> current_;
+    std::vector<uint64_t> cpu_values_;
+    uint64_t cpu_timestamp_ns_{};
+    std::error_code cpu_ec_{};
+    // a GPU request that was not collected yet
+    bool pending_{};
+};
+
+/**
+ * @brief A combined sampler for the default hwcpipe backend.
+ */
+using combined_sampler = basic_combined_sampler<>;
+
+} // namespace hwcpipe
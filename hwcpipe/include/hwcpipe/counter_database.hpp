@@ -9,6 +9,8 @@
 #include "detail/counter_database.hpp"
 #include "hwcpipe/gpu.hpp"
 
+#include <cstring>
+
 namespace hwcpipe {
 
 /**
@@ -55,6 +57,18 @@ class counter_database : private detail::counter_database {
     HWCP_NODISCARD std::error_code describe_counter(hwcpipe_counter counter, counter_metadata &metadata) const {
         return detail::counter_database::describe_counter(counter, metadata);
     }
+
+    /**
+     * Finds a counter by its identifier, e.g. "MaliGPUActiveCy" for MaliGPUActiveCy.
+     *
+     * @param [in]  name     The null terminated identifier of the counter.
+     * @param [out] counter  If the identifier is known this will be set to the counter.
+     * @return If the identifier is not known hwcpipe::errc::unknown_counter will
+     *         be returned, otherwise an empty error_code is returned.
+     */
+    HWCP_NODISCARD std::error_code find_counter(const char *name, hwcpipe_counter &counter) const {
+        return detail::counter_database::find_counter(name, std::strlen(name), counter);
+    }
 };
 
 } // namespace hwcpipe
\ No newline at end of file
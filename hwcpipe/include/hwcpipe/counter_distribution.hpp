@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include "hwcpipe/detail/heap_bytes.hpp"
+#include "hwcpipe/error.hpp"
+#include "hwcpipe/hwcpipe_counter.h"
+#include "hwcpipe/types.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <system_error>
+#include <vector>
+
+namespace hwcpipe {
+
+/** The distributions a counter_distributions reconstructs from bucket counters. */
+enum class distribution_kind : uint8_t {
+    /** External read latency, in cycles, from MaliExtBusRdLat0 to MaliExtBusRdLat384. */
+    read_latency,
+    /** Outstanding external reads, in percent of the maximum, from MaliExtBusRdOTQ1 to MaliExtBusRdOTQ4. */
+    read_occupancy,
+    /** Outstanding external writes, in percent of the maximum, from MaliExtBusWrOTQ1 to MaliExtBusWrOTQ4. */
+    write_occupancy,
+};
+
+/** Number of distribution_kind values. */
+constexpr size_t num_distributions = 3;
+
+/** Largest number of buckets of a distribution. */
+constexpr size_t max_distribution_buckets = 6;
+
+/**
+ * @return The hardware counters of a distribution, its total then every
+ * bucket but the last, to add to a sampler_config.
+ */
+HWCP_NODISCARD std::vector<hwcpipe_counter> get_distribution_counters(distribution_kind kind);
+
+/** A histogram reconstructed from the bucket counters of a sample. */
+struct counter_distribution {
+    /** Number of buckets, zero if the GPU doesn't have the counters. */
+    size_t num_buckets;
+    /**
+     * The edges of the buckets, num_buckets + 1 of them, as in the counter
+     * descriptions of counter_database. The last latency bucket is open
+     * ended, and its upper edge is taken one bucket width past its lower one.
+     */
+    const double *edges;
+    /** Number of transactions counted in the buckets. */
+    uint64_t total;
+    /** The fraction of the transactions in each bucket, all zero if there were none. */
+    std::array<double, max_distribution_buckets> fractions;
+    /** Estimated median, interpolated within its bucket, or NaN if there were no transactions. */
+    double p50;
+    /** Estimated 90th percentile, or NaN. */
+    double p90;
+    /** Estimated 99th percentile, or NaN. */
+    double p99;
+};
+
+/**
+ * @brief A counter_distributions reconstructs the external bus latency and
+ * occupancy histograms of each sample from their bucket counters, with their
+ * estimated percentiles, so that a dashboard reads a histogram rather than a
+ * dozen counters.
+ *
+ * The last bucket of each histogram is a derived counter in the database,
+ * the total minus the other buckets. The distributions read the hardware
+ * counters only, e.g. MaliExtBusRdBt and MaliExtBusRdLat0 to
+ * MaliExtBusRdLat320, and derive the last bucket themselves, so each update()
+ * is a single pass over one array of values without any expression
+ * evaluation. A percentile is interpolated linearly within the bucket that
+ * holds it.
+ *
+ * The buckets are resolved at construction from the counters the GPU has,
+ * and a distribution whose counters are missing has no bucket.
+ *
+ * @par
+ * @code
+ * for (auto counter : hwcpipe::get_distribution_counters(hwcpipe::distribution_kind::read_latency)) {
+ *     ec = config.add_counter(counter);
+ * }
+ * hwcpipe::counter_distributions distributions(config);
+ * hwcpipe::sampler<> sampler(config);
+ * auto list = sampler.make_read_list(distributions.get_counters(), distributions.num_counters(), ec);
+ * while (running) {
+ *     if (!sampler.sample_now() && !distributions.update(sampler, list)) {
+ *         const auto &latency = distributions.get(hwcpipe::distribution_kind::read_latency);
+ *         // latency.fractions, latency.p90
+ *     }
+ * }
+ * @endcode
+ */
+class counter_distributions {
+  public:
+    /**
+     * @brief Constructs the distributions from the counters a GPU has.
+     *
+     * @param [in] available      The counters the GPU has, e.g. the valid counters of a sampler_config.
+     * @param [in] num_available  Number of counters in @p available.
+     */
+    counter_distributions(const hwcpipe_counter *available, size_t num_available);
+
+    /**
+     * @brief Constructs the distributions from the valid counters of a sampler configuration.
+     *
+     * @param [in] sampler_config  A sampler_config with the bucket counters.
+     */
+    template <typename sampler_config_t>
+    explicit counter_distributions(const sampler_config_t &sampler_config)
+        : counter_distributions(valid_counters(sampler_config)) {}
+
+    /** @return The counters of the values of each sample, in the order update() takes them. */
+    HWCP_NODISCARD const hwcpipe_counter *get_counters() const { return counters_.data(); }
+
+    /** @return The number of values of each sample. */
+    HWCP_NODISCARD size_t num_counters() const { return counters_.size(); }
+
+    /** @return Whether the GPU has the counters of a distribution. */
+    HWCP_NODISCARD bool has_distribution(distribution_kind kind) const {
+        return distributions_[static_cast<size_t>(kind)].num_buckets != 0;
+    }
+
+    /**
+     * @brief Reconstructs every distribution from the values of a sample.
+     *
+     * @param [in] values  num_counters() values.
+     */
+    void update(const uint64_t *values);
+
+    /**
+     * @brief Reconstructs every distribution from the last sample of a sampler.
+     *
+     * @param [in] sampler  The sampler, after a successful sample.
+     * @param [in] list     A read list of the sampler with the counters of get_counters().
+     * @return The error of sampler::get_counter_values().
+     */
+    template <typename sampler_t, typename read_list_t>
+    HWCP_NODISCARD std::error_code update(const sampler_t &sampler, const read_list_t &list) {
+        auto ec = sampler.get_counter_values(list, staging_.data(), staging_.size());
+        if (ec) {
+            return ec;
+        }
+        update(staging_.data());
+        return {};
+    }
+
+    /** @return A distribution of the last update(). */
+    HWCP_NODISCARD const counter_distribution &get(distribution_kind kind) const {
+        return distributions_[static_cast<size_t>(kind)];
+    }
+
+    /** @return The memory held by the distributions in bytes. */
+    HWCP_NODISCARD size_t get_memory_footprint() const {
+        return sizeof(*this) + detail::heap_bytes(counters_) + detail::heap_bytes(staging_);
+    }
+
+  private:
+    template <typename sampler_config_t>
+    static std::vector<hwcpipe_counter> valid_counters(const sampler_config_t &sampler_config) {
+        std::vector<hwcpipe_counter> counters{};
+        for (const auto &registered : sampler_config.get_valid_counters()) {
+            counters.push_back(registered.counter);
+        }
+        return counters;
+    }
+
+    explicit counter_distributions(const std::vector<hwcpipe_counter> &available)
+        : counter_distributions(available.data(), available.size()) {}
+
+    std::array<counter_distribution, num_distributions> distributions_{};
+    // the column of the total of each distribution in counters_, followed by
+    // all buckets but the last
+    std::array<size_t, num_distributions> columns_{};
+    std::vector<hwcpipe_counter> counters_{};
+    std::vector<uint64_t> staging_{};
+};
+
+} // namespace hwcpipe
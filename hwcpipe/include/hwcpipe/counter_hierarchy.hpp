@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include "hwcpipe/detail/heap_bytes.hpp"
+#include "hwcpipe/error.hpp"
+#include "hwcpipe/hwcpipe_counter.h"
+#include "hwcpipe/sampler.hpp"
+#include "hwcpipe/types.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <system_error>
+#include <vector>
+
+namespace hwcpipe {
+
+/** A section of the semantic counter hierarchy, e.g. "External Memory System". */
+struct counter_section {
+    /** The name of the section. */
+    const char *name;
+    /** Index of the first group of the section in counter_hierarchy::groups. */
+    uint32_t first_group;
+    /** Number of groups of the section. */
+    uint32_t num_groups;
+};
+
+/** A group of counters of the semantic counter hierarchy, e.g. "External Bus Bandwidth". */
+struct counter_group {
+    /** The name of the group. */
+    const char *name;
+    /** Index of the section of the group in counter_hierarchy::sections. */
+    uint32_t section;
+    /** Index of the first counter of the group in counter_hierarchy::counters. */
+    uint32_t first_counter;
+    /** Number of counters of the group. */
+    uint32_t num_counters;
+};
+
+/**
+ * The semantic counter hierarchy of the specification, sections of groups of
+ * counters, in the order of its semantic layout. Only the counters that
+ * hwcpipe_counter has are listed, for every GPU, and a counter may belong to
+ * several groups.
+ */
+struct counter_hierarchy {
+    const counter_section *sections;
+    size_t num_sections;
+    const counter_group *groups;
+    size_t num_groups;
+    const hwcpipe_counter *counters;
+    size_t num_counters;
+};
+
+/**
+ * @return The semantic counter hierarchy. The tables are generated from the
+ * semantic layout of the specification.
+ */
+HWCP_NODISCARD const counter_hierarchy &get_counter_hierarchy();
+
+/**
+ * @brief A counter_tree_view tracks which nodes of the counter hierarchy a
+ * user interface shows, and reads the values of the visible counters only.
+ *
+ * The counters of a group are visible when the group and its section are
+ * expanded. The view only holds the counters a GPU has, e.g. the valid
+ * counters of a sampler_config with every counter of the hierarchy, and the
+ * groups without any are empty. Every change of the visible counters bumps
+ * the version of the view and calls its change handler, so that the user
+ * interface only relayouts when needed.
+ *
+ * update() reads the visible counters from a sampler, and rebuilds its read
+ * list after a change. With the sampler's lazy expression evaluation, the
+ * default, the derived counters of the collapsed nodes are never evaluated,
+ * so a sampler configured with the whole hierarchy costs what is shown.
+ *
+ * @par
+ * @code
+ * hwcpipe::counter_tree_view view(config);
+ * hwcpipe::sampler<> sampler(config);
+ * view.set_section_expanded(1, true);
+ * view.set_group_expanded(view.get_hierarchy().sections[1].first_group, true);
+ * while (running) {
+ *     if (!sampler.sample_now() && !view.update(sampler)) {
+ *         // view.get_visible_counters()[i] has the value view.get_values()[i]
+ *     }
+ * }
+ * @endcode
+ */
+class counter_tree_view {
+  public:
+    /**
+     * @brief Called after the visible counters changed.
+     *
+     * @param [in] user_data  The user data given to set_change_handler().
+     * @param [in] version    The version of the view after the change.
+     */
+    using change_handler = void (*)(void *user_data, uint64_t version);
+
+    /**
+     * @brief Constructs a collapsed view of the counters a GPU has.
+     *
+     * @param [in] available      The counters the GPU has.
+     * @param [in] num_available  Number of counters in @p available.
+     */
+    counter_tree_view(const hwcpipe_counter *available, size_t num_available);
+
+    /**
+     * @brief Constructs a collapsed view of the valid counters of a sampler configuration.
+     *
+     * @param [in] sampler_config  A sampler_config, e.g. with every counter of the hierarchy.
+     */
+    template <typename sampler_config_t>
+    explicit counter_tree_view(const sampler_config_t &sampler_config)
+        : counter_tree_view(valid_counters(sampler_config)) {}
+
+    /** @return The hierarchy that the indices of the sections and groups refer to. */
+    HWCP_NODISCARD const counter_hierarchy &get_hierarchy() const { return hierarchy_; }
+
+    /** @return The number of counters of a group that the GPU has. */
+    HWCP_NODISCARD size_t num_available(size_t group) const {
+        return group_counters_[group + 1] - group_counters_[group];
+    }
+
+    /** @return Whether a section is expanded. */
+    HWCP_NODISCARD bool is_section_expanded(size_t section) const { return sections_expanded_[section] != 0; }
+
+    /** @return Whether a group is expanded. */
+    HWCP_NODISCARD bool is_group_expanded(size_t group) const { return groups_expanded_[group] != 0; }
+
+    /** @brief Expands or collapses a section, and keeps the state of its groups. */
+    void set_section_expanded(size_t section, bool expanded);
+
+    /** @brief Expands or collapses a group. */
+    void set_group_expanded(size_t group, bool expanded);
+
+    /** @brief Expands or collapses every section and group. */
+    void set_all_expanded(bool expanded);
+
+    /**
+     * @brief Sets the function called after the visible counters changed.
+     *
+     * @param [in] handler    The function, or nullptr to remove it.
+     * @param [in] user_data  Passed to @p handler.
+     */
+    void set_change_handler(change_handler handler, void *user_data) {
+        handler_ = handler;
+        handler_data_ = user_data;
+    }
+
+    /** @return The version of the visible counters, incremented by every change. */
+    HWCP_NODISCARD uint64_t version() const { return version_; }
+
+    /** @return The visible counters, in the order of the hierarchy. */
+    HWCP_NODISCARD const hwcpipe_counter *get_visible_counters() const { return visible_.data(); }
+
+    /** @return The number of visible counters. */
+    HWCP_NODISCARD size_t num_visible() const { return visible_.size(); }
+
+    /**
+     * @brief Reads the visible counters of the last sample of a sampler.
+     *
+     * @param [in] sampler  The sampler, after a successful sample, whose
+     *                      configuration has the counters of the view.
+     * @return The error of sampler::make_read_list() or
+     * sampler::get_counter_values().
+     */
+    template <typename sampler_t>
+    HWCP_NODISCARD std::error_code update(const sampler_t &sampler) {
+        std::error_code ec;
+        if (list_version_ != version_ || list_sampler_ != &sampler) {
+            list_ = sampler.make_read_list(visible_.data(), visible_.size(), ec);
+            if (ec) {
+                return ec;
+            }
+            list_version_ = version_;
+            list_sampler_ = &sampler;
+        }
+        return sampler.get_counter_values(list_, values_.data(), values_.size());
+    }
+
+    /** @return The values of the visible counters read by the last update(). */
+    HWCP_NODISCARD const double *get_values() const { return values_.data(); }
+
+    /** @return The memory held by the view in bytes. */
+    HWCP_NODISCARD size_t get_memory_footprint() const {
+        return sizeof(*this) + detail::heap_bytes(counters_) + detail::heap_bytes(group_counters_) +
+               detail::heap_bytes(sections_expanded_) + detail::heap_bytes(groups_expanded_) +
+               detail::heap_bytes(visible_) + detail::heap_bytes(next_) + detail::heap_bytes(values_);
+    }
+
+  private:
+    template <typename sampler_config_t>
+    static std::vector<hwcpipe_counter> valid_counters(const sampler_config_t &sampler_config) {
+        std::vector<hwcpipe_counter> counters{};
+        for (const auto &registered : sampler_config.get_valid_counters()) {
+            counters.push_back(registered.counter);
+        }
+        return counters;
+    }
+
+    explicit counter_tree_view(const std::vector<hwcpipe_counter> &available)
+        : counter_tree_view(available.data(), available.size()) {}
+
+    /** Rebuilds the visible counters, and notifies the change if they changed. */
+    void refresh();
+
+    const counter_hierarchy &hierarchy_;
+    // the available counters of each group, from group_counters_[group]
+    std::vector<hwcpipe_counter> counters_{};
+    std::vector<size_t> group_counters_{};
+    std::vector<uint8_t> sections_expanded_{};
+    std::vector<uint8_t> groups_expanded_{};
+    std::vector<hwcpipe_counter> visible_{};
+    // the visible counters being rebuilt
+    std::vector<hwcpipe_counter> next_{};
+    std::vector<double> values_{};
+    uint64_t version_{};
+    change_handler handler_{};
+    void *handler_data_{};
+    read_list list_{};
+    uint64_t list_version_{UINT64_MAX};
+    const void *list_sampler_{};
+};
+
+} // namespace hwcpipe
@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include "device/product_id.hpp"
+#include "hwcpipe/error.hpp"
+#include "hwcpipe/hwcpipe_counter.h"
+#include "hwcpipe/sampler.hpp"
+#include "hwcpipe/types.hpp"
+
+#include <device/hwcnt/block_extents.hpp>
+#include <device/hwcnt/sampler/configuration.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <set>
+#include <system_error>
+#include <vector>
+
+namespace hwcpipe {
+
+/**
+ * @brief Plans the captures of a list of counters for a GPU, without a device.
+ *
+ * The planner resolves the hardware counters that the requested counters read,
+ * i.e. the closure of the dependencies of the expressions, for a product ID.
+ * It then packs the requested counters into passes: the hardware counters that
+ * a pass enables fit in the limit of counters per block, and every requested
+ * counter is sampled by a single pass, together with all of its dependencies.
+ * Each pass is captured by its own sampler_config, e.g. in consecutive runs of
+ * the workload.
+ *
+ * @par
+ * @code
+ * counter_planner planner{device::product_id::g610};
+ * for (auto counter : {MaliGPUActiveCy, MaliFragQueueUtil, MaliALUUtil}) {
+ *     auto ec = planner.add_counter(counter);
+ * }
+ * printf("%zu hardware counters, %zu passes\n", planner.get_hardware_counters().size(), planner.get_num_passes());
+ * auto configs = planner.build_sampler_configs(0);
+ * @endcode
+ */
+class counter_planner {
+  public:
+    /**
+     * @brief Constructs a planner for a GPU.
+     *
+     * @param [in] pid           The product ID of the GPU.
+     * @param [in] max_counters  The maximum number of counters enabled per
+     *                           block in a pass.
+     */
+    explicit counter_planner(device::product_id pid,
+                             size_t max_counters = device::hwcnt::sampler::configuration::max_counters_per_block)
+        : pid_(pid)
+        , max_counters_(max_counters) {}
+
+    /**
+     * @brief Requests a counter, and assigns it to the first pass that has
+     * room for the hardware counters it reads, or to a new pass.
+     *
+     * @param [in] counter  The counter to plan.
+     * @return Returns hwcpipe::errc::invalid_counter_for_device if the counter
+     * is not supported by the GPU, hwcpipe::errc::counter_budget_exceeded if
+     * it reads more hardware counters of a block than a pass can enable.
+     */
+    HWCP_NODISCARD std::error_code add_counter(hwcpipe_counter counter) {
+        for (const auto &pass : passes_) {
+            if (pass.counters.count(counter) != 0) {
+                return {};
+            }
+        }
+
+        sampler_config config{pid_, 0};
+        auto ec = config.add_counter(counter);
+        if (ec) {
+            return ec;
+        }
+
+        enable_maps_type enable_maps{};
+        for (const auto &block : config.build_backend_config_list()) {
+            enable_maps[static_cast<size_t>(block.type)] = block.enable_map;
+        }
+
+        if (!fits(enable_maps_type{}, enable_maps)) {
+            return make_error_code(errc::counter_budget_exceeded);
+        }
+
+        for (const auto &registered : config.get_valid_counters()) {
+            if (registered.definition.tag == detail::counter_definition::type::hardware) {
+                hardware_counters_.insert(registered.counter);
+            }
+        }
+
+        auto pass = std::find_if(passes_.begin(), passes_.end(),
+                                 [&](const pass_state &state) { return fits(state.enable_maps, enable_maps); });
+        if (pass == passes_.end()) {
+            pass = passes_.emplace(passes_.end());
+        }
+
+        pass->counters.insert(counter);
+        for (size_t i = 0; i != enable_maps.size(); ++i) {
+            pass->enable_maps[i] |= enable_maps[i];
+        }
+
+        return {};
+    }
+
+    /**
+     * @brief Returns the hardware counters read by the requested counters, the
+     * minimal set of counters that the captures enable.
+     */
+    HWCP_NODISCARD const std::set<hwcpipe_counter> &get_hardware_counters() const { return hardware_counters_; }
+
+    /** @brief Returns the number of passes needed to sample the requested counters. */
+    HWCP_NODISCARD size_t get_num_passes() const { return passes_.size(); }
+
+    /**
+     * @brief Returns the requested counters sampled by a pass.
+     *
+     * @param [in] index  The index of the pass.
+     */
+    HWCP_NODISCARD const std::set<hwcpipe_counter> &get_pass_counters(size_t index) const {
+        return passes_[index].counters;
+    }
+
+    /**
+     * @brief Builds a sampler configuration per pass, with the requested
+     * counters of the pass.
+     *
+     * @param [in] device_number  The device instance number of the GPU to
+     *                            sample, e.g. 0 for /dev/mali0.
+     */
+    HWCP_NODISCARD std::vector<sampler_config> build_sampler_configs(int device_number) const {
+        std::vector<sampler_config> result{};
+        result.reserve(passes_.size());
+
+        for (const auto &pass : passes_) {
+            result.emplace_back(pid_, device_number);
+            for (auto counter : pass.counters) {
+                auto ec = result.back().add_counter(counter);
+                // the counters were validated when they were added
+                assert(!ec);
+                static_cast<void>(ec);
+            }
+        }
+
+        return result;
+    }
+
+  private:
+    using enable_maps_type = std::array<device::hwcnt::sampler::configuration::enable_map_type,
+                                        device::hwcnt::block_extents::num_block_types>;
+
+    struct pass_state {
+        std::set<hwcpipe_counter> counters{};
+        enable_maps_type enable_maps{};
+    };
+
+    /** @brief Returns whether the counters of @p added fit in a pass that enables @p enabled. */
+    bool fits(const enable_maps_type &enabled, const enable_maps_type &added) const {
+        for (size_t i = 0; i != enabled.size(); ++i) {
+            if ((enabled[i] | added[i]).count() > max_counters_) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    device::product_id pid_;
+    size_t max_counters_;
+    std::set<hwcpipe_counter> hardware_counters_{};
+    std::vector<pass_state> passes_{};
+};
+
+} // namespace hwcpipe
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include "device/product_id.hpp"
+#include "hwcpipe/detail/internal_types.hpp"
+#include "hwcpipe/hwcpipe_counter.h"
+
+#include <device/hwcnt/block_extents.hpp>
+#include <device/hwcnt/sampler/configuration.hpp>
+
+#include <array>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace hwcpipe {
+
+/**
+ * @brief Standard counter sets, made of the counters of some semantic groups
+ * of the counter specification.
+ */
+enum class counter_preset {
+    /** GPU and shader core activity, and external bandwidth. */
+    frame_overview,
+    /** External bus and L2 cache traffic. */
+    memory_bandwidth,
+    /** Shader core unit utilization and arithmetic instructions. */
+    shader_alu,
+    /** Queue, tiler and shader core utilization, and external bus stalls, see bottleneck_classifier. */
+    bottleneck,
+};
+
+namespace detail {
+
+/** A view of an array of counters. */
+struct counter_span {
+    const hwcpipe_counter *data;
+    size_t size;
+};
+
+/**
+ * @brief Returns the counters of a preset, for every GPU. The tables are
+ * generated from the semantic groups of the specification.
+ */
+counter_span get_preset_counters(counter_preset preset);
+
+/**
+ * @brief The configuration of a preset for a GPU: the counters of the preset
+ * that the GPU supports, the hardware counters that their expressions read, and
+ * the enable map of each block type.
+ */
+struct preset_config {
+    using enable_maps_type = std::array<device::hwcnt::sampler::configuration::enable_map_type,
+                                        device::hwcnt::block_extents::num_block_types>;
+
+    std::vector<std::pair<hwcpipe_counter, counter_definition>> counters;
+    enable_maps_type enable_maps;
+};
+
+/**
+ * @brief Returns the configuration of a preset for a GPU. It is resolved from
+ * the counter database the first time, and cached for the whole process.
+ */
+const preset_config &get_preset_config(counter_preset preset, device::product_id pid);
+
+} // namespace detail
+} // namespace hwcpipe
@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include "hwcpipe/types.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <system_error>
+#include <vector>
+
+namespace hwcpipe {
+
+/**
+ * @brief A counter_smoother keeps an exponential moving average of every
+ * value of a read list, e.g. for the utilization and bandwidth figures of a
+ * HUD. The averages are stored in a contiguous array parallel to the values,
+ * and each counter has its own time constant.
+ *
+ * Each sample is weighted by its duration: a sample of duration dt moves the
+ * average of a counter of time constant tau by 1 - exp(-dt / tau) of the way
+ * to its value, so that uneven sample intervals don't change how quickly the
+ * averages respond. The weights are only recomputed when the duration
+ * changes, so with periodic samples an update is one multiply-add per value,
+ * in a single pass. The first sample sets the averages. A time constant of
+ * zero disables the smoothing of its counter. All storage is allocated at
+ * construction. A counter_smoother is not thread-safe.
+ *
+ * @par
+ * @code
+ * // MaliFragUtil, MaliNonFragUtil and MaliExtBusRdBy, per second
+ * hwcpipe::counter_smoother smoother(3, 250000000);
+ * smoother.set_time_constant(2, 1000000000);
+ *
+ * // after each sample
+ * ec = smoother.update(sampler, list);
+ * draw_hud(smoother.values());
+ * @endcode
+ */
+class counter_smoother {
+  public:
+    /**
+     * @brief Constructs a smoother.
+     *
+     * @param [in] num_values       Number of values of each sample.
+     * @param [in] time_constant_ns Time constant of every value, in
+     *                              nanoseconds.
+     */
+    counter_smoother(size_t num_values, uint64_t time_constant_ns)
+        : time_constants_ns_(num_values, time_constant_ns)
+        , weights_(num_values)
+        , averages_(num_values)
+        , staging_(num_values) {}
+
+    /** @return The number of values of each sample. */
+    HWCP_NODISCARD size_t size() const { return averages_.size(); }
+
+    /** @return The averages, size() values in read list order. */
+    HWCP_NODISCARD const double *values() const { return averages_.data(); }
+
+    /** @return The average of the value at @p index. */
+    HWCP_NODISCARD double value(size_t index) const { return averages_[index]; }
+
+    /** @return True once a sample set the averages. */
+    HWCP_NODISCARD bool primed() const { return primed_; }
+
+    /**
+     * @brief Sets the time constant of a value.
+     *
+     * @param [in] index            Index of the value in the read list.
+     * @param [in] time_constant_ns Time constant in nanoseconds, zero to
+     *                              follow the samples without smoothing.
+     */
+    void set_time_constant(size_t index, uint64_t time_constant_ns) {
+        time_constants_ns_[index] = time_constant_ns;
+        weights_duration_ns_ = 0;
+    }
+
+    /** @return The time constant of the value at @p index, in nanoseconds. */
+    HWCP_NODISCARD uint64_t time_constant(size_t index) const { return time_constants_ns_[index]; }
+
+    /**
+     * @brief Adds a sample to the averages. Samples of zero duration are
+     * ignored once the averages are set.
+     *
+     * @param [in] timestamp_ns_begin  Start of the counter accumulation.
+     * @param [in] timestamp_ns_end    End of the counter accumulation.
+     * @param [in] values              size() values of the sample.
+     */
+    void update(uint64_t timestamp_ns_begin, uint64_t timestamp_ns_end, const double *values) {
+        const uint64_t duration_ns = timestamp_ns_end - timestamp_ns_begin;
+        const size_t count = averages_.size();
+        if (!primed_) {
+            std::copy(values, values + count, averages_.begin());
+            primed_ = true;
+            return;
+        }
+        if (duration_ns == 0) {
+            return;
+        }
+        if (duration_ns != weights_duration_ns_) {
+            compute_weights(duration_ns);
+        }
+
+        const double *weights = weights_.data();
+        double *averages = averages_.data();
+        for (size_t i = 0; i != count; ++i) {
+            averages[i] += weights[i] * (values[i] - averages[i]);
+        }
+    }
+
+    /**
+     * @brief Adds the last sample of a sampler.
+     *
+     * @param [in] sampler  The sampler, after a successful sample.
+     * @param [in] list     A read list of the sampler with size() values.
+     * @return The error of sampler::get_counter_values().
+     */
+    template <typename sampler_t, typename read_list_t>
+    HWCP_NODISCARD std::error_code update(const sampler_t &sampler, const read_list_t &list) {
+        auto ec = sampler.get_counter_values(list, staging_.data(), staging_.size());
+        if (ec) {
+            return ec;
+        }
+        const auto interval = sampler.get_sample_interval();
+        update(interval.timestamp_ns_begin, interval.timestamp_ns_end, staging_.data());
+        return {};
+    }
+
+    /** @brief Forgets the averages, the next sample sets them again. */
+    void reset() {
+        std::fill(averages_.begin(), averages_.end(), 0.0);
+        primed_ = false;
+    }
+
+  private:
+    /** Computes the weight of a sample of @p duration_ns for every value. */
+    void compute_weights(uint64_t duration_ns) {
+        const auto duration = static_cast<double>(duration_ns);
+        for (size_t i = 0; i != weights_.size(); ++i) {
+            const uint64_t tau = time_constants_ns_[i];
+            weights_[i] = tau == 0 ? 1.0 : -std::expm1(-duration / static_cast<double>(tau));
+        }
+        weights_duration_ns_ = duration_ns;
+    }
+
+    std::vector<uint64_t> time_constants_ns_;
+    std::vector<double> weights_;
+    std::vector<double> averages_;
+    std::vector<double> staging_;
+    // the duration that weights_ were computed for, zero if they are stale
+    uint64_t weights_duration_ns_{};
+    bool primed_{};
+};
+
+} // namespace hwcpipe
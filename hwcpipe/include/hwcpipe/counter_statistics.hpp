@@ -0,0 +1,342 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include "hwcpipe/error.hpp"
+#include "hwcpipe/hwcpipe_counter.h"
+#include "hwcpipe/types.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <system_error>
+#include <vector>
+
+namespace hwcpipe {
+
+/**
+ * The binary layout of a serialized counter_statistics summary. It is
+ * little endian, and made of:
+ *
+ *  - a summary_header,
+ *  - num_counters times: a counter_entry, then the positive and the negative
+ *    bucket stores of the counter's quantile_sketch, each a store_header
+ *    followed by encoded_size bytes holding the num_buckets bucket counts
+ *    from first_bucket as a detail::column_codec column. Only the range of
+ *    buckets that hold values is stored.
+ */
+namespace summary_layout {
+
+/** 'HWCS' in little endian. */
+constexpr uint32_t magic = 0x53435748;
+/** Incremented for changes that existing readers can't parse. */
+constexpr uint16_t version_major = 1;
+/** Incremented for compatible additions. */
+constexpr uint16_t version_minor = 0;
+
+/** The header at the start of a summary. */
+struct summary_header {
+    uint32_t magic;
+    uint16_t version_major;
+    uint16_t version_minor;
+    /** Number of counters of the summary. */
+    uint32_t num_counters;
+    uint32_t reserved;
+    /** The relative accuracy of the quantile sketches. */
+    double relative_accuracy;
+};
+
+/** The running statistics of one counter. */
+struct counter_entry {
+    /** The hwcpipe_counter value. */
+    uint32_t counter;
+    uint32_t reserved;
+    /** Number of values. */
+    uint64_t count;
+    /** Mean of the values. */
+    double mean;
+    /** Sum of the squared differences of the values from their mean. */
+    double m2;
+    /** Smallest value. */
+    double min;
+    /** Largest value. */
+    double max;
+    /** Number of values of the sketch counted as zero. */
+    uint64_t zero_count;
+};
+
+/** The header of the bucket counts of a sketch. */
+struct store_header {
+    /** Index of the first bucket stored. */
+    uint32_t first_bucket;
+    /** Number of buckets stored, zero if the store is empty. */
+    uint32_t num_buckets;
+    /** Size of the encoded bucket counts in bytes. */
+    uint32_t encoded_size;
+    uint32_t reserved;
+};
+
+static_assert(sizeof(summary_header) == 24, "The summary header layout is part of the summary ABI.");
+static_assert(sizeof(counter_entry) == 56, "The summary counter layout is part of the summary ABI.");
+static_assert(sizeof(store_header) == 16, "The summary store layout is part of the summary ABI.");
+
+} // namespace summary_layout
+
+/**
+ * @brief Running count, mean, variance, minimum and maximum of a series of
+ * values, updated with Welford's algorithm. Two series are merged exactly.
+ */
+struct running_stats {
+    /** Number of values. */
+    uint64_t count{};
+    /** Mean of the values. */
+    double mean{};
+    /** Sum of the squared differences of the values from their mean. */
+    double m2{};
+    /** Smallest value, +infinity if there are none. */
+    double min = std::numeric_limits<double>::infinity();
+    /** Largest value, -infinity if there are none. */
+    double max = -std::numeric_limits<double>::infinity();
+
+    /** @brief Adds a value. */
+    void add(double value) {
+        ++count;
+        const double delta = value - mean;
+        mean += delta / static_cast<double>(count);
+        m2 += delta * (value - mean);
+        min = std::min(min, value);
+        max = std::max(max, value);
+    }
+
+    /** @brief Adds the values of another series. */
+    void merge(const running_stats &other) {
+        if (other.count == 0) {
+            return;
+        }
+        const auto total = static_cast<double>(count + other.count);
+        const double delta = other.mean - mean;
+        m2 += other.m2 + delta * delta * static_cast<double>(count) * static_cast<double>(other.count) / total;
+        mean += delta * static_cast<double>(other.count) / total;
+        count += other.count;
+        min = std::min(min, other.min);
+        max = std::max(max, other.max);
+    }
+
+    /** @return The population variance of the values, zero if there are none. */
+    HWCP_NODISCARD double variance() const { return count == 0 ? 0 : m2 / static_cast<double>(count); }
+};
+
+/**
+ * @brief A quantile_sketch estimates the quantiles of a series of values with
+ * a bounded relative error, using the DDSketch algorithm: each value is
+ * counted in a bucket of logarithmically growing width, so that every value
+ * of a bucket is within the relative accuracy of the bucket's value. Sketches
+ * of the same accuracy are merged exactly by adding their buckets.
+ *
+ * The buckets cover magnitudes from min_value to max_value, and are
+ * allocated at construction, so adding a value is O(1) and doesn't allocate.
+ * Magnitudes below min_value are counted as zero, larger ones in the last
+ * bucket.
+ */
+class quantile_sketch {
+  public:
+    /** Smallest magnitude that isn't counted as zero. */
+    static constexpr double min_value = 1e-6;
+    /** Largest magnitude with a relative error bound. */
+    static constexpr double max_value = 1e19;
+
+    /**
+     * @brief Constructs an empty sketch.
+     *
+     * @param [in] relative_accuracy  The relative error of the quantiles,
+     *                                between 0 and 1 exclusive.
+     */
+    explicit quantile_sketch(double relative_accuracy);
+
+    /** @return The relative error of the quantiles. */
+    HWCP_NODISCARD double get_relative_accuracy() const { return relative_accuracy_; }
+
+    /** @return The number of values. */
+    HWCP_NODISCARD uint64_t count() const { return count_; }
+
+    /** @brief Adds a value. */
+    void add(double value) {
+        ++count_;
+        if (value > min_value) {
+            ++positive_[bucket(value)];
+        } else if (value < -min_value) {
+            ++negative_[bucket(-value)];
+        } else {
+            ++zero_count_;
+        }
+    }
+
+    /**
+     * @brief Estimates a quantile.
+     *
+     * @param [in] q  The quantile, between 0 and 1.
+     * @return The value at the quantile, or zero if the sketch is empty.
+     */
+    HWCP_NODISCARD double quantile(double q) const;
+
+    /**
+     * @brief Adds the values of another sketch.
+     *
+     * @return hwcpipe::errc::statistics_mismatch if the sketches don't have
+     * the same relative accuracy, otherwise an empty error_code.
+     */
+    HWCP_NODISCARD std::error_code merge(const quantile_sketch &other);
+
+    /** @brief Removes every value. */
+    void clear();
+
+  private:
+    friend class counter_statistics;
+
+    HWCP_NODISCARD size_t bucket(double magnitude) const {
+        const double key = std::ceil(std::log(std::min(magnitude, max_value)) * multiplier_);
+        return std::min(static_cast<size_t>(key - min_key_), positive_.size() - 1);
+    }
+
+    HWCP_NODISCARD double bucket_value(size_t index) const;
+
+    double relative_accuracy_;
+    double gamma_;
+    double multiplier_;
+    double min_key_;
+    uint64_t count_{};
+    uint64_t zero_count_{};
+    std::vector<uint64_t> positive_;
+    std::vector<uint64_t> negative_;
+};
+
+/**
+ * @brief A counter_statistics aggregates the samples of a set of counters,
+ * hardware or derived, into summary statistics: the running_stats and a
+ * quantile_sketch of every counter. Adding a sample is O(1) per counter and
+ * doesn't allocate.
+ *
+ * A summary serializes to a few bytes per populated sketch bucket, in the
+ * summary_layout format, so devices can send small summaries instead of
+ * their samples. The summaries of the same counters merge exactly where
+ * they are collected.
+ *
+ * @par
+ * @code
+ * hwcpipe::counter_statistics stats(counters, num_counters);
+ * while (running) {
+ *     if (!sampler.sample_now()) {
+ *         ec = stats.push(sampler, list);
+ *     }
+ * }
+ * std::vector<uint8_t> summary;
+ * stats.serialize(summary);
+ *
+ * // where the summaries are collected
+ * auto device_stats = hwcpipe::counter_statistics::deserialize(summary.data(), summary.size(), ec);
+ * ec = fleet_stats.merge(device_stats);
+ * @endcode
+ */
+class counter_statistics {
+  public:
+    /** The default relative accuracy of the quantile sketches. */
+    static constexpr double default_relative_accuracy = 0.02;
+
+    /**
+     * @brief Constructs empty statistics.
+     *
+     * @param [in] counters           The counters, in the order of the
+     *                                values given to add().
+     * @param [in] count              Number of counters.
+     * @param [in] relative_accuracy  The relative accuracy of the quantile
+     *                                sketches.
+     */
+    counter_statistics(const hwcpipe_counter *counters, size_t count,
+                       double relative_accuracy = default_relative_accuracy);
+
+    /** @return The number of counters. */
+    HWCP_NODISCARD size_t size() const { return counters_.size(); }
+
+    /** @return The counter at @p index. */
+    HWCP_NODISCARD hwcpipe_counter get_counter(size_t index) const { return counters_[index]; }
+
+    /** @return The running statistics of the counter at @p index. */
+    HWCP_NODISCARD const running_stats &get_stats(size_t index) const { return stats_[index]; }
+
+    /** @return The quantile sketch of the counter at @p index. */
+    HWCP_NODISCARD const quantile_sketch &get_sketch(size_t index) const { return sketches_[index]; }
+
+    /**
+     * @brief Adds a sample.
+     *
+     * @param [in] values  One value per counter.
+     */
+    void add(const double *values) {
+        for (size_t i = 0; i != counters_.size(); ++i) {
+            stats_[i].add(values[i]);
+            sketches_[i].add(values[i]);
+        }
+    }
+
+    /**
+     * @brief Adds the last sample of a sampler.
+     *
+     * @param [in] sampler  The sampler, after a successful sample.
+     * @param [in] list     A read list of the sampler with the counters of
+     *                      the statistics, in the same order.
+     * @return The error of sampler::get_counter_values().
+     */
+    template <typename sampler_t, typename read_list_t>
+    HWCP_NODISCARD std::error_code push(const sampler_t &sampler, const read_list_t &list) {
+        auto ec = sampler.get_counter_values(list, staging_.data(), staging_.size());
+        if (ec) {
+            return ec;
+        }
+        add(staging_.data());
+        return {};
+    }
+
+    /**
+     * @brief Adds the samples of other statistics.
+     *
+     * @return hwcpipe::errc::statistics_mismatch if the statistics don't have
+     * the same counters and accuracy, otherwise an empty error_code.
+     */
+    HWCP_NODISCARD std::error_code merge(const counter_statistics &other);
+
+    /** @brief Removes every sample. */
+    void clear();
+
+    /**
+     * @brief Serializes the statistics in the summary_layout format.
+     *
+     * @param [out] output  Receives the summary.
+     */
+    void serialize(std::vector<uint8_t> &output) const;
+
+    /**
+     * @brief Reads statistics serialized by serialize().
+     *
+     * @param [in]  data  The summary.
+     * @param [in]  size  Size of the summary in bytes.
+     * @param [out] ec    Set to hwcpipe::errc::invalid_statistics_layout if
+     *                    the summary is malformed.
+     * @return The statistics, empty on error.
+     */
+    HWCP_NODISCARD static counter_statistics deserialize(const void *data, size_t size, std::error_code &ec);
+
+  private:
+    double relative_accuracy_;
+    std::vector<hwcpipe_counter> counters_;
+    std::vector<running_stats> stats_;
+    std::vector<quantile_sketch> sketches_;
+    std::vector<double> staging_;
+};
+
+} // namespace hwcpipe
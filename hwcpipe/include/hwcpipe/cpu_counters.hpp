@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include "hwcpipe/error.hpp"
+#include "hwcpipe/types.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace hwcpipe {
+
+/** A CPU PMU event, counted with perf_event. */
+enum class cpu_event : uint8_t {
+    /** CPU cycles. */
+    cycles,
+    /** Retired instructions. */
+    instructions,
+    /** Last level cache accesses. */
+    cache_references,
+    /** Last level cache misses. */
+    cache_misses,
+    /** Retired branch instructions. */
+    branch_instructions,
+    /** Mispredicted branches. */
+    branch_misses,
+};
+
+/** What a cpu_counters counts. */
+enum class cpu_counter_scope : uint8_t {
+    /**
+     * The thread that creates the cpu_counters, on any CPU. That thread can
+     * read the counters in user space with rdpmc, without a syscall.
+     */
+    calling_thread,
+    /**
+     * Every thread of the system, summed per CPU cluster. Needs the
+     * permission to count system wide events, see perf_event_paranoid.
+     */
+    per_cluster,
+};
+
+/**
+ * @brief Finds the CPU clusters: the CPUs that share a frequency domain, or
+ * else the same capacity. If neither is reported, every CPU is in one
+ * cluster.
+ *
+ * @param [in] cpu_dir  The sysfs directory of the CPUs.
+ * @return The CPU mask of each cluster, by first CPU. Only the first 64 CPUs
+ * are considered.
+ */
+HWCP_NODISCARD std::vector<uint64_t> find_cpu_clusters(const std::string &cpu_dir = "/sys/devices/system/cpu");
+
+namespace detail {
+
+/**
+ * @brief Parses a sysfs CPU list, e.g. "0-3,6" or "0 1 2 3".
+ *
+ * @param [in] list  The list.
+ * @return The mask of the CPUs, only the first 64 CPUs are kept.
+ */
+HWCP_NODISCARD uint64_t parse_cpu_list(const std::string &list);
+
+} // namespace detail
+
+/**
+ * @brief A cpu_counters counts a set of CPU PMU events with perf_event, e.g.
+ * cycles, instructions and cache misses, to be read on the same tick as the
+ * GPU counters, see basic_combined_sampler.
+ *
+ * The events of each CPU are opened as one perf_event group, so that they are
+ * scheduled on the PMU together and read at once. With
+ * cpu_counter_scope::calling_thread the group is mapped, and the thread that
+ * created the counters reads them with rdpmc when the kernel allows it, which
+ * takes no syscall. Other threads, and kernels or CPUs without user space
+ * access to the PMU, read the group with a single read(). With
+ * cpu_counter_scope::per_cluster there is one group per CPU, and a read
+ * sums the CPUs of each cluster.
+ *
+ * Counts read with read() are scaled when the PMU was multiplexed between
+ * more events than it has counters; counts read with rdpmc are not.
+ *
+ * @par
+ * @code
+ * const hwcpipe::cpu_event events[] = {hwcpipe::cpu_event::cycles, hwcpipe::cpu_event::instructions};
+ * hwcpipe::cpu_counters cpu(events, 2, hwcpipe::cpu_counter_scope::per_cluster);
+ * std::vector<uint64_t> counts(cpu.size());
+ * ec = cpu.read(counts.data());
+ * // counts[cluster * cpu.num_events() + event]
+ * @endcode
+ */
+class cpu_counters {
+  public:
+    /**
+     * Opens and enables the events. If that fails the counters are invalid.
+     *
+     * @param [in] events  The events to count.
+     * @param [in] count   Number of entries in @p events.
+     * @param [in] scope   What is counted.
+     */
+    cpu_counters(const cpu_event *events, size_t count, cpu_counter_scope scope = cpu_counter_scope::calling_thread);
+
+    ~cpu_counters();
+
+    cpu_counters(const cpu_counters &) = delete;
+    cpu_counters &operator=(const cpu_counters &) = delete;
+
+    /** @return True if the counters can be read. */
+    operator bool() const { return !ec_; }
+
+    /** @return The error that made the counters invalid, if any. */
+    HWCP_NODISCARD std::error_code get_error() const { return ec_; }
+
+    /** @return The number of events. */
+    HWCP_NODISCARD size_t num_events() const { return events_.size(); }
+
+    /** @return The event @p index. */
+    HWCP_NODISCARD cpu_event get_event(size_t index) const { return events_[index]; }
+
+    /** @return The number of clusters, one for cpu_counter_scope::calling_thread. */
+    HWCP_NODISCARD size_t num_clusters() const { return clusters_.size(); }
+
+    /** @return The CPUs of cluster @p index, zero for cpu_counter_scope::calling_thread. */
+    HWCP_NODISCARD uint64_t get_cluster_cpu_mask(size_t index) const { return clusters_[index]; }
+
+    /** @return The number of values of a read(): num_clusters() * num_events(). */
+    HWCP_NODISCARD size_t size() const { return clusters_.size() * events_.size(); }
+
+    /** @return True if the calling thread can read the counters with rdpmc. */
+    HWCP_NODISCARD bool uses_rdpmc() const;
+
+    /**
+     * @brief Reads the counts of every event since the counters were created.
+     *
+     * @param [out] values  size() counts, cluster by cluster, each cluster in
+     *                      event order.
+     * @return hwcpipe::errc::cpu_counters_unavailable if a group could not be
+     * read, or if the counters are invalid.
+     */
+    HWCP_NODISCARD std::error_code read(uint64_t *values);
+
+  private:
+    // the events of one CPU, or of the calling thread
+    struct group {
+        size_t cluster;
+        // the leader first
+        std::vector<int> fds;
+        // the mapped pages of the events, for rdpmc
+        std::vector<void *> pages;
+    };
+
+    HWCP_NODISCARD std::error_code open_group(int cpu, size_t cluster, bool map);
+
+    HWCP_NODISCARD bool read_user(const group &events, uint64_t *values) const;
+
+    HWCP_NODISCARD bool read_group(const group &events, uint64_t *values);
+
+    std::error_code ec_;
+    std::vector<cpu_event> events_{};
+    std::vector<uint64_t> clusters_{};
+    std::vector<group> groups_{};
+    std::thread::id owner_{};
+    size_t page_size_{};
+    // the buffer of read_group()
+    std::vector<uint64_t> read_buffer_{};
+};
+
+} // namespace hwcpipe
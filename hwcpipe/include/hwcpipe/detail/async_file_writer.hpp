@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include "hwcpipe/types.hpp"
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace hwcpipe {
+namespace detail {
+
+/**
+ * Writes buffers to a file in the background, so that the thread producing
+ * them doesn't wait for the storage.
+ *
+ * The writer owns a pool of page aligned buffers. A buffer is acquired, filled
+ * and submitted with the offset it is written at, and only comes back to the
+ * pool once its write has completed. At most num_buffers() writes are in
+ * flight: acquire() waits for the oldest one when they all are, which is the
+ * only time the producer waits.
+ *
+ * Writes are submitted to an io_uring when the kernel allows it, with the
+ * buffers registered so that the kernel doesn't map them on every write.
+ * Otherwise, e.g. on kernels older than 5.1 or when io_uring is disabled by a
+ * seccomp filter, a thread of the writer pwrite()s them in turn. The writes
+ * complete in any order, so the file may have holes until drain() returns.
+ *
+ * If the io_uring fails, the writer fails, but the buffers of the writes the
+ * kernel didn't complete never return to the pool: they are not unmapped
+ * either, as the kernel may still be reading them.
+ *
+ * The writer is not thread safe: one thread acquires and submits the buffers.
+ */
+class async_file_writer {
+  public:
+    /** How the writes are issued. */
+    enum class backend : uint8_t {
+        /** Submitted to an io_uring. */
+        io_uring,
+        /** Written by a thread of the writer. */
+        thread,
+    };
+
+    /**
+     * Enters an io_uring, see io_uring_enter(2), returning -1 and setting
+     * errno on error. Replaced by the tests to inject faults.
+     */
+    using io_uring_enter_function = long (*)(int ring_fd, unsigned to_submit, unsigned min_complete, unsigned flags);
+
+    /**
+     * @param [in] fd              The file to write, which stays owned by the
+     *                             caller and must outlive the writer.
+     * @param [in] buffer_size     The size of each buffer.
+     * @param [in] num_buffers     Number of buffers, which bounds the writes
+     *                             in flight.
+     * @param [in] allow_io_uring  False to always use the writer thread.
+     * @param [in] enter           Enters the io_uring, or nullptr for the
+     *                             system call.
+     */
+    async_file_writer(int fd, size_t buffer_size, size_t num_buffers, bool allow_io_uring = true,
+                      io_uring_enter_function enter = nullptr);
+
+    /** Waits for the writes in flight, see drain(). */
+    ~async_file_writer();
+
+    async_file_writer(const async_file_writer &) = delete;
+    async_file_writer &operator=(const async_file_writer &) = delete;
+
+    /** @return True if buffers can be written. */
+    operator bool() const { return !ec_; }
+
+    /** @return The first error of the writer or of a write, if any. */
+    HWCP_NODISCARD std::error_code get_error() const { return ec_; }
+
+    /** @return How the writes are issued. */
+    HWCP_NODISCARD backend get_backend() const { return backend_; }
+
+    /** @return The size of each buffer. */
+    HWCP_NODISCARD size_t buffer_size() const { return buffer_size_; }
+
+    /** @return The number of buffers. */
+    HWCP_NODISCARD size_t num_buffers() const { return num_buffers_; }
+
+    /**
+     * @brief Takes a buffer from the pool, waiting for a write to complete if
+     * they are all in flight.
+     *
+     * @param [out] buffer  Receives a buffer of buffer_size() bytes.
+     * @return hwcpipe::errc::trace_write_failed if a write failed.
+     */
+    HWCP_NODISCARD std::error_code acquire(char *&buffer);
+
+    /**
+     * @brief Writes the first @p size bytes of an acquired buffer at
+     * @p offset, and returns the buffer to the pool once they are written.
+     *
+     * @param [in] buffer  A buffer returned by acquire().
+     * @param [in] size    Number of bytes to write, up to buffer_size().
+     * @param [in] offset  The offset in the file.
+     * @return hwcpipe::errc::trace_write_failed if a write failed.
+     */
+    HWCP_NODISCARD std::error_code submit(char *buffer, size_t size, uint64_t offset);
+
+    /**
+     * @brief Waits for all the writes in flight.
+     *
+     * @return hwcpipe::errc::trace_write_failed if a write failed.
+     */
+    HWCP_NODISCARD std::error_code drain();
+
+  private:
+    // a submitted write
+    struct pending_write {
+        size_t buffer;
+        size_t size;
+        uint64_t offset;
+    };
+
+    struct ring;
+
+    HWCP_NODISCARD bool start_io_uring(io_uring_enter_function enter);
+    void start_thread();
+    void run_thread();
+
+    /** Waits for at least one write to complete, and returns its buffer to the pool. */
+    void wait_for_completion();
+    void reap_ring();
+    /** Fails the writer when the io_uring can't be entered, leaving the writes in flight. */
+    void fail_ring();
+    void delete_ring();
+
+    /** Writes what an asynchronous write left over, and returns its buffer to the pool. */
+    void complete(const pending_write &write, int64_t result);
+
+    HWCP_NODISCARD char *buffer_data(size_t index) const { return pool_ + index * stride_; }
+
+    std::error_code ec_;
+    int fd_;
+    size_t buffer_size_;
+    size_t num_buffers_;
+    size_t stride_{};
+    backend backend_{backend::thread};
+
+    char *pool_{};
+    size_t pool_size_{};
+    std::vector<size_t> free_buffers_{};
+    std::vector<pending_write> writes_{};
+    size_t in_flight_{};
+
+    ring *ring_{};
+    // true once the io_uring failed, its writes in flight may never complete
+    bool ring_failed_{};
+
+    // the writer thread, fed under mutex_
+    std::thread thread_{};
+    std::mutex mutex_{};
+    std::condition_variable queued_{};
+    std::condition_variable completed_{};
+    std::deque<pending_write> queue_{};
+    std::vector<size_t> completed_buffers_{};
+    bool failed_{};
+    bool stop_{};
+};
+
+} // namespace detail
+} // namespace hwcpipe
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace hwcpipe {
+namespace detail {
+
+/**
+ * Encoder and decoder of a column of 64-bit counter values. A column is
+ * stored as the differences between consecutive values, zig-zag mapped so
+ * that small negative differences stay small, either as LEB128 varints or
+ * bit-packed at the width of the largest difference, whichever is smaller.
+ * Counters that don't change cost a few bytes per column, whatever the
+ * number of values.
+ *
+ * An encoded column is:
+ *  - a mode byte, column_codec::mode_varint or column_codec::mode_packed,
+ *  - the first value as a varint,
+ *  - in varint mode, the count - 1 zig-zag differences as varints,
+ *  - in packed mode, the bit width as a byte followed by the count - 1
+ *    zig-zag differences packed at that width, least significant bit first.
+ */
+namespace column_codec {
+
+/** The differences are varints. */
+constexpr uint8_t mode_varint = 0;
+/** The differences are bit-packed. */
+constexpr uint8_t mode_packed = 1;
+
+/** Maps a signed difference to an unsigned value, small differences first. */
+inline uint64_t zigzag_encode(uint64_t delta) { return (delta << 1U) ^ (0U - (delta >> 63U)); }
+
+/** Inverse of zigzag_encode(). */
+inline uint64_t zigzag_decode(uint64_t value) { return (value >> 1U) ^ (0U - (value & 1U)); }
+
+/** @return The largest encoded size of a column of @p count values. */
+constexpr size_t max_encoded_size(size_t count) { return 12 + count * 10; }
+
+/**
+ * @brief Encodes a column.
+ *
+ * @param [in]  values  The values of the column.
+ * @param [in]  count   Number of values, at least one.
+ * @param [out] output  Receives the column, max_encoded_size(count) bytes
+ *                      long.
+ * @return The number of bytes written.
+ */
+size_t encode(const uint64_t *values, size_t count, uint8_t *output);
+
+/**
+ * @brief Decodes a column.
+ *
+ * @param [in]  input   The encoded column.
+ * @param [in]  end     The end of the encoded data.
+ * @param [in]  count   Number of values of the column.
+ * @param [out] values  Receives @p count values.
+ * @return The end of the column, or nullptr if the column is malformed or
+ * extends past @p end.
+ */
+const uint8_t *decode(const uint8_t *input, const uint8_t *end, size_t count, uint64_t *values);
+
+} // namespace column_codec
+} // namespace detail
+} // namespace hwcpipe
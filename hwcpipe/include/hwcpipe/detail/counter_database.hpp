@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023-2024 Arm Limited.
+ * Copyright (c) 2023-2025 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  */
@@ -7,16 +7,17 @@
 #pragma once
 
 #include "device/product_id.hpp"
+#include "hwcpipe/detail/database_blob.hpp"
 #include "hwcpipe/detail/internal_types.hpp"
 #include "hwcpipe/hwcpipe_counter.h"
 
+#include <string>
 #include <system_error>
-#include <unordered_map>
 
 namespace hwcpipe {
 namespace detail {
 
-using backing_map_type = std::unordered_map<hwcpipe_counter, detail::counter_definition>;
+using blob_record = database_blob_layout::record_entry;
 
 /**
  * @brief An type that provides an enumerable view over the counters for a
@@ -24,11 +25,11 @@ using backing_map_type = std::unordered_map<hwcpipe_counter, detail::counter_def
  */
 template <typename counter_database_t>
 class gpu_counter_view {
-  public:
-    using backing_iterator = backing_map_type::const_iterator;
-
   private:
-    /** The actual iterator type that enumerates the counters for a GPU */
+    /**
+     * The actual iterator type that enumerates the counters for a GPU. It
+     * merges the shared records with the overrides of the product.
+     */
     class iterator {
       public:
         using value_type = hwcpipe_counter;
@@ -37,15 +38,17 @@ class gpu_counter_view {
         using difference_type = std::ptrdiff_t;
         using iterator_category = std::forward_iterator_tag;
 
-        iterator(const counter_database_t &db, backing_iterator begin, backing_iterator end)
+        iterator(const counter_database_t &db, const counter_table &table)
             : db_(db)
-            , it_(std::move(begin))
-            , end_(std::move(end)) {
-            if (it_ != end_) {
-                current_counter_ = it_->first;
-            } else {
-                current_counter_ = static_cast<hwcpipe_counter>(0);
-            }
+            , table_(table) {
+            settle();
+        }
+
+        iterator(const counter_database_t &db, const blob_record *blob_begin, const blob_record *blob_end)
+            : db_(db)
+            , blob_begin_(blob_begin)
+            , blob_end_(blob_end) {
+            settle();
         }
 
         /**
@@ -53,12 +56,12 @@ class gpu_counter_view {
          * for the current counter.
          */
         counter_metadata describe_counter() {
-            if (it_ == end_) {
+            if (current_ == nullptr && blob_begin_ == blob_end_) {
                 return {"", ""};
             }
 
             counter_metadata meta{};
-            auto ec = db_.describe_counter(it_->first, meta);
+            auto ec = db_.describe_counter(current_counter_, meta);
             if (ec) {
                 // should not happen - the counters for a gpu should always have
                 // metatada in the database.
@@ -68,16 +71,37 @@ class gpu_counter_view {
             return meta;
         }
 
+        /**
+         * @brief Returns whether the current counter is a hardware counter or an
+         * expression, read from the record without a database lookup.
+         */
+        counter_definition::type get_type() const {
+            if (blob_begin_ != blob_end_) {
+                return static_cast<counter_definition::type>(blob_begin_->tag);
+            }
+            return current_ != nullptr ? current_->tag : counter_definition::type::invalid;
+        }
+
         reference operator*() const { return current_counter_; }
         pointer operator->() const { return &current_counter_; }
 
         iterator &operator++() {
-            ++it_;
-            if (it_ != end_) {
-                current_counter_ = it_->first;
+            if (blob_begin_ != blob_end_) {
+                ++blob_begin_;
+                settle();
+                return *this;
+            }
+            if (current_ == table_.overrides_begin) {
+                // an override replaces the shared record of the same counter
+                if (table_.shared_begin != table_.shared_end &&
+                    table_.shared_begin->counter == table_.overrides_begin->counter) {
+                    ++table_.shared_begin;
+                }
+                ++table_.overrides_begin;
             } else {
-                current_counter_ = static_cast<hwcpipe_counter>(0);
+                ++table_.shared_begin;
             }
+            settle();
             return *this;
         }
 
@@ -87,33 +111,76 @@ class gpu_counter_view {
             return copy;
         }
 
-        friend bool operator==(const iterator &lhs, const iterator &rhs) { return lhs.it_ == rhs.it_; }
+        friend bool operator==(const iterator &lhs, const iterator &rhs) {
+            return lhs.table_.shared_begin == rhs.table_.shared_begin &&
+                   lhs.table_.overrides_begin == rhs.table_.overrides_begin && lhs.blob_begin_ == rhs.blob_begin_;
+        }
 
-        friend bool operator!=(const iterator &lhs, const iterator &rhs) { return lhs.it_ != rhs.it_; }
+        friend bool operator!=(const iterator &lhs, const iterator &rhs) { return !(lhs == rhs); }
 
       private:
+        /** Points current_ at the lowest counter left in either range. */
+        void settle() {
+            if (blob_begin_ != blob_end_) {
+                current_counter_ = static_cast<hwcpipe_counter>(blob_begin_->counter);
+                return;
+            }
+
+            const bool shared_left = table_.shared_begin != table_.shared_end;
+            const bool overrides_left = table_.overrides_begin != table_.overrides_end;
+
+            if (overrides_left &&
+                (!shared_left || table_.overrides_begin->counter <= table_.shared_begin->counter)) {
+                current_ = table_.overrides_begin;
+            } else if (shared_left) {
+                current_ = table_.shared_begin;
+            } else {
+                current_ = nullptr;
+            }
+
+            current_counter_ = current_ != nullptr ? current_->counter : static_cast<hwcpipe_counter>(0);
+        }
+
         const counter_database_t &db_;
-        backing_iterator it_;
-        backing_iterator end_;
+        /** The records left to enumerate. */
+        counter_table table_{};
+        const counter_record *current_{nullptr};
+        /** The records left to enumerate, for a product of a database blob. */
+        const blob_record *blob_begin_{nullptr};
+        const blob_record *blob_end_{nullptr};
 
         hwcpipe_counter current_counter_;
     };
 
   public:
-    gpu_counter_view(const counter_database_t &db, backing_map_type::const_iterator begin,
-                     backing_map_type::const_iterator end)
+    gpu_counter_view(const counter_database_t &db, const counter_table &table)
+        : db_(db)
+        , table_(table) {}
+
+    gpu_counter_view(const counter_database_t &db, const blob_record *blob_begin, const blob_record *blob_end)
         : db_(db)
-        , begin_(std::move(begin))
-        , end_(std::move(end)) {}
+        , blob_begin_(blob_begin)
+        , blob_end_(blob_end) {}
 
-    auto begin() const { return iterator(db_, begin_, end_); }
+    auto begin() const {
+        if (blob_begin_ != blob_end_) {
+            return iterator(db_, blob_begin_, blob_end_);
+        }
+        return iterator(db_, table_);
+    }
 
-    auto end() const { return iterator(db_, end_, end_); }
+    auto end() const {
+        if (blob_begin_ != blob_end_) {
+            return iterator(db_, blob_end_, blob_end_);
+        }
+        return iterator(db_, {table_.shared_end, table_.shared_end, table_.overrides_end, table_.overrides_end});
+    }
 
   private:
     const counter_database_t &db_;
-    backing_map_type::const_iterator begin_;
-    backing_map_type::const_iterator end_;
+    counter_table table_{};
+    const blob_record *blob_begin_{nullptr};
+    const blob_record *blob_end_{nullptr};
 };
 
 class counter_database {
@@ -135,12 +202,94 @@ class counter_database {
      */
     HWCP_NODISCARD std::error_code describe_counter(hwcpipe_counter counter, counter_metadata &metadata) const;
 
+    /**
+     * @brief Finds a counter by its identifier, as spelled in hwcpipe_counter.h,
+     * e.g. "MaliGPUActiveCy". The identifiers are binary searched in a sorted
+     * table, without any allocation.
+     *
+     * @param [in]  name     The identifier, which needs not be null terminated.
+     * @param [in]  length   The length of the identifier.
+     * @param [out] counter  Set to the counter if it is found.
+     * @return Returns hwcpipe::errc::unknown_counter if no counter has this
+     * identifier.
+     */
+    HWCP_NODISCARD std::error_code find_counter(const char *name, size_t length, hwcpipe_counter &counter) const;
+
+    /**
+     * @return The size in bytes of the read-only tables of the database that
+     * are compiled into the library, shared by all the databases.
+     */
+    HWCP_NODISCARD static size_t get_memory_footprint();
+
+    /**
+     * @brief Computes a checksum of the counters of a GPU: their types,
+     * block addresses and expression dependencies. It changes whenever the
+     * database of the GPU does, so it tells whether data derived from the
+     * database, e.g. a saved sampler plan, is still valid.
+     *
+     * @return The checksum, or zero if the GPU is unknown.
+     */
+    HWCP_NODISCARD uint64_t get_checksum(device::product_id id) const;
+
     /**
      * @brief Queries the database to find the block/offset address of a counter
      * for the specified GPU.
      */
     HWCP_NODISCARD counter_definition get_counter_def(device::product_id id, hwcpipe_counter counter,
                                                       std::error_code &ec);
+
+    /**
+     * @brief Makes every database of the process look the products of a
+     * database blob up in it, instead of in the compiled tables. The other
+     * products are still looked up in the compiled tables.
+     *
+     * @param [in] blob  A valid blob, which must outlive every database and
+     *                   every counter definition read from it, or nullptr
+     *                   to only use the compiled tables again.
+     */
+    static void use_blob(const database_blob *blob);
+
+    /**
+     * @brief Maps a database blob and uses it, see use_blob(). The mapping
+     * is kept until the process exits, as the counter definitions of the
+     * sampler configurations point into it.
+     *
+     * @param [in] path  The path of the blob.
+     * @return hwcpipe::errc::database_blob_unavailable if it can't be mapped,
+     * hwcpipe::errc::invalid_database_blob if it isn't a valid blob.
+     */
+    HWCP_NODISCARD static std::error_code load_blob(const std::string &path);
+
+  private:
+    /**
+     * @brief Resolves the counter records of a GPU. The table of the last
+     * product looked up is memoized, as a database is only ever queried for
+     * the one GPU that is being sampled.
+     *
+     * @return The counters of the GPU, or nullptr if the GPU is unknown or
+     * is described by the blob in use.
+     */
+    const counter_table *find_gpu(device::product_id id) const;
+
+    /**
+     * @brief Resolves the records of a GPU in the blob in use, if any. It is
+     * memoized with find_gpu().
+     *
+     * @return The blob that describes the GPU, or nullptr.
+     */
+    const database_blob *find_blob_gpu(device::product_id id) const;
+
+    /** Resolves a GPU in the blob in use, then in the compiled tables, unless it is memoized. */
+    void resolve(device::product_id id) const;
+
+    mutable bool cached_{false};
+    mutable device::product_id cached_id_{};
+    /** The blob in use when the GPU was resolved, the memo is dropped if it changes. */
+    mutable const database_blob *cached_source_{nullptr};
+    mutable const counter_table *cached_table_{nullptr};
+    mutable const database_blob *cached_blob_{nullptr};
+    mutable const blob_record *cached_blob_begin_{nullptr};
+    mutable const blob_record *cached_blob_end_{nullptr};
 };
 
 } // namespace detail
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include "hwcpipe/detail/heap_bytes.hpp"
+#include "hwcpipe/detail/internal_types.hpp"
+#include "hwcpipe/hwcpipe_counter.h"
+#include "hwcpipe/types.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <system_error>
+#include <vector>
+
+namespace hwcpipe {
+namespace detail {
+namespace expression {
+
+/**
+ * A custom expression compiled for a particular device: a postfix bytecode
+ * program over a small value stack. Operands are read from a flat array in
+ * the order of the expression's dependencies, like a flat_evaluator.
+ */
+class program {
+  public:
+    /** The maximum number of values on the evaluation stack. */
+    static constexpr size_t max_stack_depth = expression::max_stack_depth;
+
+    using opcode = expression::opcode;
+    using instruction = expression::instruction;
+
+    /**
+     * @return The value of the expression for the given operand values. The
+     * device constants were folded in when the program was emitted.
+     */
+    HWCP_NODISCARD double evaluate(const double *inputs) const {
+        return evaluate_postfix(code_.data(), code_.size(), literals_.data(), inputs, nullptr);
+    }
+
+    /** @return The bytecode of the program. */
+    HWCP_NODISCARD const std::vector<instruction> &get_code() const { return code_; }
+
+    /** @return The bytes allocated by the program. */
+    HWCP_NODISCARD size_t heap_bytes() const { return detail::heap_bytes(code_) + detail::heap_bytes(literals_); }
+
+  private:
+    friend class custom_expression;
+
+    std::vector<instruction> code_{};
+    std::vector<double> literals_{};
+};
+
+/**
+ * A user defined derived counter, parsed from an expression string that
+ * follows the grammar of the counter specification: numbers, counter
+ * identifiers (e.g. MaliGPUActiveCy), the MaliConfigExtBusByteSize,
+ * MaliConfigShaderCoreCount and MaliConfigL2CacheCount constants, the + - * /
+ * operators, unary minus, parentheses and variadic min() / max().
+ *
+ * Literal sub-expressions are folded when the expression is compiled, and
+ * the device constants are folded when the program for a device is emitted.
+ */
+class custom_expression {
+  public:
+    /**
+     * @brief Parses an expression.
+     *
+     * @param [in]  source      The expression string.
+     * @param [out] expression  The parsed expression.
+     * @return hwcpipe::errc::invalid_expression if the string is not a valid
+     * expression, hwcpipe::errc::unknown_counter if it names an unknown
+     * counter, otherwise an empty error_code.
+     */
+    HWCP_NODISCARD static std::error_code compile(const std::string &source, custom_expression &expression);
+
+    /**
+     * @return The counters the expression reads, in the order that program
+     * inputs are passed.
+     */
+    HWCP_NODISCARD const std::vector<hwcpipe_counter> &get_dependencies() const { return dependencies_; }
+
+    /** @return The bytes allocated by the expression tree. */
+    HWCP_NODISCARD size_t heap_bytes() const {
+        return detail::heap_bytes(nodes_) + detail::heap_bytes(children_) + detail::heap_bytes(dependencies_);
+    }
+
+    /**
+     * @brief Emits the program of the expression for a device, with the device
+     * constants folded in.
+     */
+    HWCP_NODISCARD program emit(const device_constants &constants) const;
+
+  private:
+    enum class kind : uint8_t { literal, input, config, add, sub, mul, div, neg, min, max };
+
+    // one node of the expression tree. The children of a node are stored
+    // before it, and listed in children_ from first_child.
+    struct node {
+        kind type;
+        double value;
+        uint32_t index;
+        uint32_t first_child;
+        uint32_t num_children;
+    };
+
+    friend class expression_parser;
+
+    /** Applies an operation to the values of its operands. */
+    static double apply(kind type, const double *values, size_t count);
+
+    void emit_node(uint32_t index, const std::vector<bool> &constant, const std::vector<double> &values,
+                   program &result) const;
+
+    std::vector<node> nodes_{};
+    std::vector<uint32_t> children_{};
+    std::vector<hwcpipe_counter> dependencies_{};
+};
+
+} // namespace expression
+} // namespace detail
+} // namespace hwcpipe
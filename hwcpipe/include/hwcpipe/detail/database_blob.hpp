@@ -0,0 +1,221 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include "device/product_id.hpp"
+#include "hwcpipe/detail/internal_types.hpp"
+#include "hwcpipe/hwcpipe_counter.h"
+#include "hwcpipe/types.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <system_error>
+
+namespace hwcpipe {
+namespace detail {
+
+/**
+ * The binary layout of a counter database blob, as written by
+ * specification/lgcpy_export_hwcpipe_database_blob.py. It is little endian,
+ * and made of:
+ *
+ *  - a header,
+ *  - num_literals doubles, the literals of the expressions,
+ *  - num_products product_entry, sorted by product_key,
+ *  - num_records record_entry, the records of each product sorted by counter,
+ *  - num_instructions expression::instruction, the expression bytecode,
+ *  - num_dependencies int32 hwcpipe_counter values.
+ *
+ * The sections follow each other without padding. Every section but the last
+ * is a multiple of 8 bytes, so the sections are aligned when the blob is.
+ */
+namespace database_blob_layout {
+
+/** 'HWCD' in little endian. */
+constexpr uint32_t magic = 0x44435748;
+/** Incremented for changes that existing readers can't parse. */
+constexpr uint16_t version_major = 1;
+/** Incremented for compatible additions. */
+constexpr uint16_t version_minor = 0;
+
+/** The header at the start of a blob. */
+struct header {
+    uint32_t magic;
+    uint16_t version_major;
+    uint16_t version_minor;
+    /** Size of the blob in bytes. */
+    uint32_t size;
+    uint32_t num_products;
+    uint32_t num_records;
+    uint32_t num_instructions;
+    uint32_t num_literals;
+    uint32_t num_dependencies;
+};
+
+/** The counters of one product. */
+struct product_entry {
+    /** The product key of the GPU, see get_product_key(). */
+    uint32_t product_key;
+    /** Index of the first record of the product. */
+    uint32_t first_record;
+    /** Number of records of the product. */
+    uint32_t num_records;
+    uint32_t reserved;
+};
+
+/** One counter of a product. */
+struct record_entry {
+    /** The hwcpipe_counter value. */
+    uint32_t counter;
+    /** A counter_definition::type, hardware or expression. */
+    uint8_t tag;
+    /** The shift of a hardware counter. */
+    uint8_t shift;
+    /** The offset of a hardware counter in its block. */
+    uint16_t offset;
+    /** The device::hwcnt::block_type of a hardware counter. */
+    uint8_t block_type;
+    /** Number of dependencies of an expression. */
+    uint8_t num_dependencies;
+    /** Number of instructions of an expression. */
+    uint16_t num_instructions;
+    /** Index of the first dependency of an expression. */
+    uint32_t first_dependency;
+    /** Index of the first instruction of an expression. */
+    uint32_t first_instruction;
+    uint32_t reserved;
+};
+
+static_assert(sizeof(header) == 32, "Unexpected header size");
+static_assert(sizeof(product_entry) == 16, "Unexpected product_entry size");
+static_assert(sizeof(record_entry) == 24, "Unexpected record_entry size");
+static_assert(sizeof(hwcpipe_counter) == 4, "Dependencies are stored as 32 bit counters");
+
+} // namespace database_blob_layout
+
+/**
+ * @return The key of a product in a database blob: the architecture major
+ * version of the GPU ID in bits 12 to 15, and its product major version in
+ * bits 0 to 11, as the Id of Mali-ProductInfo.xml, e.g. 0x9002 for
+ * Mali-G78. Zero for the products that have no counters.
+ */
+HWCP_NODISCARD uint32_t get_product_key(device::product_id id);
+
+/**
+ * @brief A database_blob reads a counter database blob in place. The blob is
+ * validated once at construction: the header, every range and every
+ * instruction. The queries then only binary search the sorted tables and
+ * return pointers into the blob, with no parsing and no allocations.
+ *
+ * The data isn't owned, and must outlive the blob and the counter
+ * definitions returned by get_counter_def().
+ */
+class database_blob {
+  public:
+    using record_entry = database_blob_layout::record_entry;
+
+    /**
+     * @brief Reads a blob. If it can't be validated, the blob is invalid and
+     * has no products.
+     *
+     * @param [in] data  The blob, aligned to 8 bytes.
+     * @param [in] size  Size of the blob in bytes.
+     */
+    database_blob(const void *data, size_t size);
+
+    /** @return True if the blob was validated. */
+    operator bool() const { return !ec_; }
+
+    /** @return hwcpipe::errc::invalid_database_blob if the blob could not be validated. */
+    HWCP_NODISCARD std::error_code get_error() const { return ec_; }
+
+    /** @return The number of products of the blob. */
+    HWCP_NODISCARD size_t num_products() const { return num_products_; }
+
+    /**
+     * @brief Finds the records of a product.
+     *
+     * @param [in]  id     The product.
+     * @param [out] begin  Set to the first record of the product.
+     * @param [out] end    Set past the last record of the product.
+     * @return False if the blob has no counters for the product.
+     */
+    bool find_product(device::product_id id, const record_entry *&begin, const record_entry *&end) const;
+
+    /**
+     * @return The record of a counter in the records of a product, or
+     * nullptr if the product doesn't have it.
+     */
+    HWCP_NODISCARD static const record_entry *find_record(const record_entry *begin, const record_entry *end,
+                                                          hwcpipe_counter counter);
+
+    /** @return The counter definition of a record, pointing into the blob. */
+    HWCP_NODISCARD counter_definition get_counter_def(const record_entry &record) const;
+
+    /** @return The dependencies of an expression record. */
+    HWCP_NODISCARD expression::dependency_list get_dependencies(const record_entry &record) const {
+        return {dependencies_ + record.first_dependency,
+                dependencies_ + record.first_dependency + record.num_dependencies};
+    }
+
+    /** @return The size of the blob in bytes. */
+    HWCP_NODISCARD size_t size() const { return size_; }
+
+  private:
+    /** Validates the bytecode of an expression record, whose literals index @p num_literals literals. */
+    bool validate_expression(const record_entry &record, uint32_t num_literals) const;
+
+    std::error_code ec_;
+    size_t size_{};
+    size_t num_products_{};
+    const database_blob_layout::product_entry *products_{};
+    const record_entry *records_{};
+    const expression::instruction *instructions_{};
+    const double *literals_{};
+    const hwcpipe_counter *dependencies_{};
+};
+
+/**
+ * @brief A database_blob_file maps a counter database blob read-only, and
+ * reads it with a database_blob.
+ */
+class database_blob_file {
+  public:
+    /**
+     * Maps a blob. If it can't be mapped, the file is invalid.
+     *
+     * @param [in] path  The path of the blob.
+     */
+    explicit database_blob_file(const std::string &path);
+
+    ~database_blob_file();
+
+    database_blob_file(const database_blob_file &) = delete;
+    database_blob_file &operator=(const database_blob_file &) = delete;
+
+    /** @return True if the file was mapped and validated. */
+    operator bool() const { return !get_error(); }
+
+    /**
+     * @return hwcpipe::errc::database_blob_unavailable if the file could not
+     * be mapped, otherwise the error of the blob.
+     */
+    HWCP_NODISCARD std::error_code get_error() const { return ec_ ? ec_ : blob_.get_error(); }
+
+    /** @return The blob of the mapped file. */
+    HWCP_NODISCARD const database_blob &get_blob() const { return blob_; }
+
+  private:
+    std::error_code ec_;
+    void *data_{};
+    size_t size_{};
+    database_blob blob_{nullptr, 0};
+};
+
+} // namespace detail
+} // namespace hwcpipe
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+namespace hwcpipe {
+namespace detail {
+
+/** The longest integer formatted by format_unsigned() or format_integer(), INT64_MIN. */
+constexpr size_t max_integer_size = 20;
+
+/**
+ * The longest value formatted by format_double(), e.g.
+ * -1.2345678901234567e-308.
+ */
+constexpr size_t max_double_size = 24;
+
+/** The decimal digits of 0 to 99, two by two. */
+constexpr char digit_pairs[] = "00010203040506070809"
+                               "10111213141516171819"
+                               "20212223242526272829"
+                               "30313233343536373839"
+                               "40414243444546474849"
+                               "50515253545556575859"
+                               "60616263646566676869"
+                               "70717273747576777879"
+                               "80818283848586878889"
+                               "90919293949596979899";
+
+/** Formats @p value in decimal at @p out, two digits at a time, and returns the end of the digits. */
+inline char *format_unsigned(uint64_t value, char *out) {
+    char digits[max_integer_size];
+    char *end = digits + sizeof(digits);
+    char *begin = end;
+    while (value >= 100) {
+        const auto pair = static_cast<size_t>(value % 100) * 2;
+        value /= 100;
+        *--begin = digit_pairs[pair + 1];
+        *--begin = digit_pairs[pair];
+    }
+    if (value >= 10) {
+        const auto pair = static_cast<size_t>(value) * 2;
+        *--begin = digit_pairs[pair + 1];
+        *--begin = digit_pairs[pair];
+    } else {
+        *--begin = static_cast<char>('0' + value);
+    }
+    return std::copy(begin, end, out);
+}
+
+/** Same as format_unsigned(), for a signed value. */
+inline char *format_integer(int64_t value, char *out) {
+    uint64_t magnitude = static_cast<uint64_t>(value);
+    if (value < 0) {
+        *out++ = '-';
+        magnitude = 0 - magnitude;
+    }
+    return format_unsigned(magnitude, out);
+}
+
+/**
+ * Formats a finite @p value in decimal at @p out, and returns the end of the
+ * digits. Integral values below 2^53 are formatted as integers.
+ *
+ * @param [in]  value     The value.
+ * @param [in]  decimals  The number of digits after the point, formatted with
+ *                        integer arithmetic, or a negative number for the
+ *                        shortest text that parses back to @p value.
+ * @param [out] out       Room for max_double_size characters.
+ */
+char *format_double(double value, int decimals, char *out);
+
+} // namespace detail
+} // namespace hwcpipe
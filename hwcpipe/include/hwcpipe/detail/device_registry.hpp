@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace hwcpipe {
+namespace detail {
+
+/**
+ * A device opened once and shared by the samplers and gpus of a process: its
+ * handle and the instance probed from it. The instance is destroyed before
+ * the handle. The handle is unset when the application owns it.
+ */
+template <typename handle_t, typename instance_t>
+class shared_device {
+  public:
+    using handle_ptr = typename handle_t::handle_ptr;
+    using instance_ptr = typename instance_t::instance_ptr;
+
+    shared_device(handle_ptr handle, instance_ptr instance)
+        : handle_(std::move(handle))
+        , instance_(std::move(instance)) {}
+
+    shared_device(const shared_device &) = delete;
+    shared_device &operator=(const shared_device &) = delete;
+
+    /** @return The instance of the device. */
+    instance_t &get_instance() const { return *instance_; }
+
+  private:
+    handle_ptr handle_;
+    instance_ptr instance_;
+};
+
+/**
+ * Process-wide registry of the open devices, by device number. The first
+ * acquire() of a device number opens the device and probes its instance, the
+ * next ones share them for as long as one of the owners holds the device.
+ * The device is closed when the last owner releases it, so the registry
+ * doesn't keep the device open on its own.
+ */
+template <typename handle_t, typename instance_t>
+class device_registry {
+  public:
+    using device_type = shared_device<handle_t, instance_t>;
+    using device_ptr = std::shared_ptr<device_type>;
+
+    /** @return The registry of this process. */
+    static device_registry &get() {
+        static device_registry registry;
+        return registry;
+    }
+
+    /**
+     * Get the device of a device number, opening it if no owner holds it.
+     *
+     * @param [in] device_number  The device number.
+     * @return The device, or nullptr if it could not be opened or probed.
+     */
+    device_ptr acquire(int device_number) {
+        std::lock_guard<std::mutex> guard(lock_);
+
+        auto &slot = devices_[device_number];
+        if (auto device = slot.lock()) {
+            return device;
+        }
+
+        auto handle = handle_t::create(device_number);
+        if (!handle) {
+            return nullptr;
+        }
+        auto instance = instance_t::create(*handle);
+        if (!instance) {
+            return nullptr;
+        }
+
+        auto device = std::make_shared<device_type>(std::move(handle), std::move(instance));
+        slot = device;
+        return device;
+    }
+
+  private:
+    std::mutex lock_{};
+    std::map<int, std::weak_ptr<device_type>> devices_{};
+};
+
+} // namespace detail
+} // namespace hwcpipe
@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace hwcpipe {
+namespace detail {
+
+/**
+ * A set of trivially copyable values, kept sorted in a contiguous array. The
+ * first @p inline_capacity values are stored in the set itself, so small sets
+ * don't allocate, and larger ones allocate a single array.
+ *
+ * The values are ordered with operator<, and insertions shift the values that
+ * follow, which is cheaper than a node based set for the few hundred values
+ * that it's meant for.
+ */
+template <typename value_t, size_t inline_capacity>
+class flat_set {
+    static_assert(std::is_trivially_copyable<value_t>::value, "The values are copied with memcpy");
+    static_assert(inline_capacity != 0, "The inline storage can't be empty");
+
+  public:
+    using value_type = value_t;
+    using const_iterator = const value_t *;
+    using iterator = const_iterator;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    flat_set() = default;
+
+    flat_set(const flat_set &other) { assign(other); }
+
+    flat_set(flat_set &&other) noexcept { steal(other); }
+
+    flat_set &operator=(const flat_set &other) {
+        if (this != &other) {
+            size_ = 0;
+            assign(other);
+        }
+        return *this;
+    }
+
+    flat_set &operator=(flat_set &&other) noexcept {
+        if (this != &other) {
+            heap_.reset();
+            capacity_ = inline_capacity;
+            steal(other);
+        }
+        return *this;
+    }
+
+    ~flat_set() = default;
+
+    const_iterator begin() const { return data(); }
+    const_iterator end() const { return data() + size_; }
+    const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+    const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+    /** @return The bytes allocated once the values outgrew the inline storage. */
+    size_t heap_bytes() const { return heap_ ? capacity_ * sizeof(storage_type) : 0; }
+
+    /** @return The value equivalent to @p key, or end() if there is none. */
+    const_iterator find(const value_t &key) const {
+        const auto it = std::lower_bound(begin(), end(), key);
+        return it != end() && !(key < *it) ? it : end();
+    }
+
+    size_t count(const value_t &key) const { return find(key) != end() ? 1 : 0; }
+
+    /**
+     * @brief Inserts a value, unless an equivalent value is in the set.
+     *
+     * @return The position of the value in the set, and whether it was
+     * inserted.
+     */
+    std::pair<const_iterator, bool> insert(const value_t &value) {
+        const auto index = static_cast<size_t>(std::lower_bound(begin(), end(), value) - begin());
+        if (index != size_ && !(value < data()[index])) {
+            return {data() + index, false};
+        }
+
+        reserve(size_ + 1);
+        value_t *values = data();
+        std::memmove(static_cast<void *>(values + index + 1), values + index, (size_ - index) * sizeof(value_t));
+        std::memcpy(static_cast<void *>(values + index), &value, sizeof(value_t));
+        ++size_;
+
+        return {values + index, true};
+    }
+
+    template <typename... args_t>
+    std::pair<const_iterator, bool> emplace(args_t &&...args) {
+        return insert(value_t(std::forward<args_t>(args)...));
+    }
+
+    /** @brief Grows the storage to hold at least @p capacity values. */
+    void reserve(size_t capacity) {
+        if (capacity <= capacity_) {
+            return;
+        }
+
+        const size_t new_capacity = std::max(capacity, capacity_ * 2);
+        std::unique_ptr<storage_type[]> storage(new storage_type[new_capacity]);
+        std::memcpy(static_cast<void *>(storage.get()), data(), size_ * sizeof(value_t));
+
+        heap_ = std::move(storage);
+        capacity_ = new_capacity;
+    }
+
+    friend bool operator==(const flat_set &lhs, const flat_set &rhs) {
+        return lhs.size_ == rhs.size_ && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
+
+    friend bool operator!=(const flat_set &lhs, const flat_set &rhs) { return !(lhs == rhs); }
+
+  private:
+    using storage_type = typename std::aligned_storage<sizeof(value_t), alignof(value_t)>::type;
+
+    const value_t *data() const {
+        return reinterpret_cast<const value_t *>(heap_ ? heap_.get() : inline_storage_);
+    }
+
+    value_t *data() { return reinterpret_cast<value_t *>(heap_ ? heap_.get() : inline_storage_); }
+
+    void assign(const flat_set &other) {
+        reserve(other.size_);
+        std::memcpy(static_cast<void *>(data()), other.data(), other.size_ * sizeof(value_t));
+        size_ = other.size_;
+    }
+
+    void steal(flat_set &other) {
+        if (other.heap_) {
+            heap_ = std::move(other.heap_);
+            capacity_ = other.capacity_;
+        } else {
+            std::memcpy(static_cast<void *>(inline_storage_), other.inline_storage_, other.size_ * sizeof(value_t));
+        }
+        size_ = other.size_;
+
+        other.capacity_ = inline_capacity;
+        other.size_ = 0;
+    }
+
+    storage_type inline_storage_[inline_capacity];
+    std::unique_ptr<storage_type[]> heap_{};
+    size_t capacity_{inline_capacity};
+    size_t size_{};
+};
+
+} // namespace detail
+} // namespace hwcpipe
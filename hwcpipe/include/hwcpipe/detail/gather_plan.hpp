@@ -0,0 +1,446 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include "hwcpipe/detail/heap_bytes.hpp"
+#include "hwcpipe/detail/internal_types.hpp"
+
+#include <device/hwcnt/block_extents.hpp>
+#include <device/hwcnt/block_metadata.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#if defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define HWCPIPE_GATHER_NEON 1
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define HWCPIPE_GATHER_SSE2 1
+#endif
+
+namespace hwcpipe {
+namespace detail {
+
+/**
+ * Gathers @p count counter values from a block, shifts them by @p shift and
+ * accumulates them into the contiguous destination array @p dst. The shifted
+ * value keeps the width of the block values type, as the scalar decoder did.
+ *
+ * @param [in]     src      The block values.
+ * @param [in]     offsets  The offsets of the counters within the block.
+ * @param [in]     count    Number of entries in @p offsets.
+ * @param [in]     shift    Shift applied to every gathered value.
+ * @param [in,out] dst      Accumulation destination, @p count entries long.
+ */
+template <typename values_type_t>
+inline void gather_accumulate(const values_type_t *src, const uint32_t *offsets, size_t count, uint32_t shift,
+                              uint64_t *dst) {
+    size_t i = 0;
+#if defined(HWCPIPE_GATHER_NEON)
+    const int64x2_t shift_v = vdupq_n_s64(static_cast<int64_t>(shift));
+    const uint64x2_t mask_v = vdupq_n_u64(std::numeric_limits<values_type_t>::max());
+    for (; i + 2 <= count; i += 2) {
+        const uint64x2_t values = vcombine_u64(vcreate_u64(static_cast<uint64_t>(src[offsets[i]])),
+                                               vcreate_u64(static_cast<uint64_t>(src[offsets[i + 1]])));
+        const uint64x2_t acc = vld1q_u64(dst + i);
+        vst1q_u64(dst + i, vaddq_u64(acc, vandq_u64(vshlq_u64(values, shift_v), mask_v)));
+    }
+#elif defined(HWCPIPE_GATHER_SSE2)
+    const __m128i shift_v = _mm_cvtsi32_si128(static_cast<int>(shift));
+    const __m128i mask_v = _mm_set1_epi64x(static_cast<int64_t>(std::numeric_limits<values_type_t>::max()));
+    for (; i + 2 <= count; i += 2) {
+        const __m128i values = _mm_set_epi64x(static_cast<int64_t>(src[offsets[i + 1]]), //
+                                              static_cast<int64_t>(src[offsets[i]]));
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        auto *acc_ptr = reinterpret_cast<__m128i *>(dst + i);
+        const __m128i acc = _mm_loadu_si128(acc_ptr);
+        _mm_storeu_si128(acc_ptr, _mm_add_epi64(acc, _mm_and_si128(_mm_sll_epi64(values, shift_v), mask_v)));
+    }
+#endif
+    for (; i < count; ++i) {
+        dst[i] += static_cast<values_type_t>(src[offsets[i]] << shift);
+    }
+}
+
+/**
+ * Adds every value of a block into a block sized array of 64-bit totals.
+ *
+ * @param [in]     src     The block values.
+ * @param [in]     count   Number of values in the block.
+ * @param [in,out] totals  The totals, @p count entries long.
+ */
+inline void reduce_block(const uint32_t *src, size_t count, uint64_t *totals) {
+    size_t i = 0;
+#if defined(HWCPIPE_GATHER_NEON)
+    for (; i + 4 <= count; i += 4) {
+        const uint32x4_t values = vld1q_u32(src + i);
+        vst1q_u64(totals + i, vaddw_u32(vld1q_u64(totals + i), vget_low_u32(values)));
+        vst1q_u64(totals + i + 2, vaddw_u32(vld1q_u64(totals + i + 2), vget_high_u32(values)));
+    }
+#elif defined(HWCPIPE_GATHER_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 4 <= count; i += 4) {
+        // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+        const __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+        auto *lo_ptr = reinterpret_cast<__m128i *>(totals + i);
+        auto *hi_ptr = reinterpret_cast<__m128i *>(totals + i + 2);
+        // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+        _mm_storeu_si128(lo_ptr, _mm_add_epi64(_mm_loadu_si128(lo_ptr), _mm_unpacklo_epi32(values, zero)));
+        _mm_storeu_si128(hi_ptr, _mm_add_epi64(_mm_loadu_si128(hi_ptr), _mm_unpackhi_epi32(values, zero)));
+    }
+#endif
+    for (; i < count; ++i) {
+        totals[i] += src[i];
+    }
+}
+
+/** @copydoc reduce_block(const uint32_t *, size_t, uint64_t *) */
+inline void reduce_block(const uint64_t *src, size_t count, uint64_t *totals) {
+    size_t i = 0;
+#if defined(HWCPIPE_GATHER_NEON)
+    for (; i + 2 <= count; i += 2) {
+        vst1q_u64(totals + i, vaddq_u64(vld1q_u64(totals + i), vld1q_u64(src + i)));
+    }
+#elif defined(HWCPIPE_GATHER_SSE2)
+    for (; i + 2 <= count; i += 2) {
+        // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+        const __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+        auto *acc_ptr = reinterpret_cast<__m128i *>(totals + i);
+        // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+        _mm_storeu_si128(acc_ptr, _mm_add_epi64(_mm_loadu_si128(acc_ptr), values));
+    }
+#endif
+    for (; i < count; ++i) {
+        totals[i] += src[i];
+    }
+}
+
+/**
+ * Gathers @p count counter values from a block, shifts them by @p shift and
+ * stores them to @p dst with a stride of @p stride elements. Used to write a
+ * single block instance into a structure of arrays layout.
+ *
+ * @param [in]  src      The block values.
+ * @param [in]  offsets  The offsets of the counters within the block.
+ * @param [in]  count    Number of entries in @p offsets.
+ * @param [in]  shift    Shift applied to every gathered value.
+ * @param [out] dst      Store destination.
+ * @param [in]  stride   Distance between consecutive destinations.
+ */
+template <typename values_type_t>
+inline void gather_store_strided(const values_type_t *src, const uint32_t *offsets, size_t count, uint32_t shift,
+                                 uint64_t *dst, size_t stride) {
+    for (size_t i = 0; i < count; ++i) {
+        dst[i * stride] = static_cast<values_type_t>(src[offsets[i]] << shift);
+    }
+}
+
+/** Assumed size of a cache line, for prefetching. */
+constexpr size_t cache_line_size = 64;
+
+/**
+ * Hints the CPU to fetch the cache line holding @p address for reading. It
+ * does not fault, so @p address does not need to be valid.
+ */
+inline void prefetch_read(const void *address) {
+#if defined(__GNUC__)
+    __builtin_prefetch(address, 0, 3);
+#else
+    static_cast<void>(address);
+#endif
+}
+
+/** Selects which counters of a block gather plan are accumulated. */
+enum class run_filter : uint8_t {
+    /** All counters. */
+    all,
+    /** Only the counters without a shift. */
+    unshifted,
+    /** Only the counters with a shift. */
+    shifted,
+};
+
+/**
+ * The gather plan for a single block type. The counters are stored as a
+ * contiguous array of block offsets, grouped into runs that share the same
+ * shift. The destinations of a block type are contiguous in the sample buffer
+ * so only the position of the first one is stored.
+ */
+class block_gather_plan {
+  public:
+    /** @return The number of counters gathered from this block type. */
+    HWCP_NODISCARD size_t size() const { return offsets_.size(); }
+
+    /** @return True if no counters are gathered from this block type. */
+    HWCP_NODISCARD bool empty() const { return offsets_.empty(); }
+
+    /** @return The bytes allocated by the plan. */
+    HWCP_NODISCARD size_t heap_bytes() const {
+        return detail::heap_bytes(offsets_) + detail::heap_bytes(runs_) + detail::heap_bytes(lines_32bit_) +
+               detail::heap_bytes(lines_64bit_);
+    }
+
+    /** @return The sample buffer position of the first counter of this block type. */
+    HWCP_NODISCARD size_t buffer_base() const { return buffer_base_; }
+
+    /** @return The block offsets, in sample buffer order. */
+    HWCP_NODISCARD const std::vector<uint32_t> &offsets() const { return offsets_; }
+
+    /** @return The number of counters that are not shifted. */
+    HWCP_NODISCARD size_t num_unshifted() const {
+        // runs are ordered by shift, so only the first one can be unshifted
+        return (runs_.empty() || runs_.front().shift != 0) ? 0 : runs_.front().end - runs_.front().begin;
+    }
+
+    /**
+     * Appends a counter to the plan.
+     *
+     * @param [in] buffer_pos  The sample buffer position of the counter. This
+     *                         must directly follow the previous counter.
+     * @param [in] offset      The counter offset within the block.
+     * @param [in] shift       The shift to apply to the counter value.
+     */
+    void push_back(size_t buffer_pos, uint32_t offset, uint32_t shift) {
+        if (offsets_.empty()) {
+            buffer_base_ = buffer_pos;
+        }
+        assert(buffer_pos == buffer_base_ + offsets_.size());
+
+        if (runs_.empty() || runs_.back().shift != shift) {
+            runs_.push_back({shift, offsets_.size(), offsets_.size()});
+        }
+        offsets_.push_back(offset);
+        ++runs_.back().end;
+
+        add_line(lines_32bit_, offset * sizeof(uint32_t) / cache_line_size);
+        add_line(lines_64bit_, offset * sizeof(uint64_t) / cache_line_size);
+    }
+
+    /**
+     * Prefetches the cache lines of a block that hold its gathered counters.
+     *
+     * @param [in] values  The block values.
+     */
+    template <typename values_type_t>
+    void prefetch(const values_type_t *values) const {
+        const auto &lines = sizeof(values_type_t) == sizeof(uint64_t) ? lines_64bit_ : lines_32bit_;
+        const auto *bytes = reinterpret_cast<const uint8_t *>(values);
+        for (const auto line : lines) {
+            prefetch_read(bytes + line * cache_line_size);
+        }
+    }
+
+    /**
+     * Accumulates the counters of a single block into the sample buffer.
+     *
+     * @param [in]     values         The block values.
+     * @param [in,out] sample_buffer  The sample buffer.
+     * @param [in]     filter         Selects the counters to accumulate.
+     */
+    template <typename values_type_t>
+    void accumulate(const values_type_t *values, uint64_t *sample_buffer, run_filter filter = run_filter::all) const {
+        uint64_t *dst = sample_buffer + buffer_base_;
+        for (const auto &run : runs_) {
+            if ((filter == run_filter::unshifted && run.shift != 0) ||
+                (filter == run_filter::shifted && run.shift == 0)) {
+                continue;
+            }
+            gather_accumulate(values, offsets_.data() + run.begin, run.end - run.begin, run.shift, dst + run.begin);
+        }
+    }
+
+    /**
+     * Returns the largest value of the gathered counters of a block, before
+     * they are shifted.
+     *
+     * @param [in] values  The block values.
+     */
+    template <typename values_type_t>
+    values_type_t max_value(const values_type_t *values) const {
+        values_type_t result = 0;
+        for (const auto offset : offsets_) {
+            result = std::max(result, values[offset]);
+        }
+        return result;
+    }
+
+    /**
+     * Stores the counters of a single block instance into a structure of
+     * arrays buffer, where each counter owns a row of @p stride instances.
+     *
+     * @param [in]  values  The block values.
+     * @param [out] dst     The element of the first counter's row for this
+     *                      block instance.
+     * @param [in]  stride  The row length.
+     */
+    template <typename values_type_t>
+    void store_strided(const values_type_t *values, uint64_t *dst, size_t stride) const {
+        for (const auto &run : runs_) {
+            gather_store_strided(values, offsets_.data() + run.begin, run.end - run.begin, run.shift,
+                                 dst + run.begin * stride, stride);
+        }
+    }
+
+  private:
+    /* a range of counters in the plan that share the same shift */
+    struct run {
+        uint32_t shift;
+        size_t begin;
+        size_t end;
+    };
+
+    static void add_line(std::vector<size_t> &lines, size_t line) {
+        if (std::find(lines.begin(), lines.end(), line) == lines.end()) {
+            lines.push_back(line);
+        }
+    }
+
+    size_t buffer_base_{};
+    std::vector<uint32_t> offsets_{};
+    std::vector<run> runs_{};
+    /* the cache lines holding the offsets, for 32 and 64 bit values */
+    std::vector<size_t> lines_32bit_{};
+    std::vector<size_t> lines_64bit_{};
+};
+
+/**
+ * The gather plan for a counter set, indexed by block type. It is compiled
+ * once when the sampler is constructed and then used to decode every block of
+ * every sample.
+ */
+class gather_plan {
+  public:
+    using block_type = device::hwcnt::block_type;
+
+    gather_plan() = default;
+
+    /**
+     * @param [in] first_buffer_pos  The sample buffer position of the first
+     *                               counter, for a plan that fills the buffer
+     *                               after another one.
+     */
+    explicit gather_plan(size_t first_buffer_pos)
+        : first_buffer_pos_(first_buffer_pos) {}
+
+    /**
+     * Orders counter addresses so that the counters of a block type are
+     * contiguous, and counters that share a shift are adjacent to each other.
+     * Counters must be appended to the plan in this order.
+     */
+    static bool address_order(const block_offset &lhs, const block_offset &rhs) {
+        if (lhs.block_type != rhs.block_type) {
+            return lhs.block_type < rhs.block_type;
+        }
+        if (lhs.shift != rhs.shift) {
+            return lhs.shift < rhs.shift;
+        }
+        return lhs.offset < rhs.offset;
+    }
+
+    /**
+     * Appends a counter to the plan.
+     *
+     * @param [in] address  The counter address.
+     * @return The sample buffer position assigned to the counter.
+     */
+    size_t push_back(const block_offset &address) {
+        const auto buffer_pos = first_buffer_pos_ + num_counters_++;
+        plans_[static_cast<size_t>(address.block_type)].push_back(buffer_pos, address.offset, address.shift);
+        return buffer_pos;
+    }
+
+    /** @return The total number of counters in the plan. */
+    HWCP_NODISCARD size_t size() const { return num_counters_; }
+
+    /** @return The bytes allocated by the plans of the block types. */
+    HWCP_NODISCARD size_t heap_bytes() const {
+        size_t result = 0;
+        for (const auto &plan : plans_) {
+            result += plan.heap_bytes();
+        }
+        return result;
+    }
+
+    /** @return The plan for a block type. */
+    HWCP_NODISCARD const block_gather_plan &operator[](block_type type) const {
+        return plans_[static_cast<size_t>(type)];
+    }
+
+    /**
+     * Accumulates the counters of a single block into the sample buffer.
+     *
+     * @param [in]     type           The block type.
+     * @param [in]     values         The block values.
+     * @param [in,out] sample_buffer  The sample buffer.
+     * @param [in]     filter         Selects the counters to accumulate.
+     */
+    template <typename values_type_t>
+    void accumulate(block_type type, const void *values, uint64_t *sample_buffer,
+                    run_filter filter = run_filter::all) const {
+        const auto &plan = plans_[static_cast<size_t>(type)];
+        if (plan.empty()) {
+            return;
+        }
+        plan.accumulate(static_cast<const values_type_t *>(values), sample_buffer, filter);
+    }
+
+    /**
+     * Stores the counters of a single block instance into a structure of
+     * arrays buffer.
+     *
+     * @param [in]  type    The block type.
+     * @param [in]  values  The block values.
+     * @param [out] dst     The element of the first counter's row for this
+     *                      block instance.
+     * @param [in]  stride  The row length.
+     */
+    template <typename values_type_t>
+    void store_strided(block_type type, const void *values, uint64_t *dst, size_t stride) const {
+        const auto &plan = plans_[static_cast<size_t>(type)];
+        if (plan.empty()) {
+            return;
+        }
+        plan.store_strided(static_cast<const values_type_t *>(values), dst, stride);
+    }
+
+    /**
+     * Returns the largest value of the gathered counters of a block, before
+     * they are shifted, or zero if no counter is gathered from the block type.
+     *
+     * @param [in] type    The block type.
+     * @param [in] values  The block values.
+     */
+    template <typename values_type_t>
+    values_type_t max_value(block_type type, const void *values) const {
+        return plans_[static_cast<size_t>(type)].max_value(static_cast<const values_type_t *>(values));
+    }
+
+    /**
+     * Prefetches the cache lines of a block that hold its gathered counters.
+     *
+     * @param [in] type    The block type.
+     * @param [in] values  The block values.
+     */
+    template <typename values_type_t>
+    void prefetch(block_type type, const void *values) const {
+        plans_[static_cast<size_t>(type)].prefetch(static_cast<const values_type_t *>(values));
+    }
+
+  private:
+    std::array<block_gather_plan, device::hwcnt::block_extents::num_block_types> plans_{};
+    size_t first_buffer_pos_{};
+    size_t num_counters_{};
+};
+
+} // namespace detail
+} // namespace hwcpipe
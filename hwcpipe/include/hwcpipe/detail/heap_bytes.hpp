@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace hwcpipe {
+namespace detail {
+
+/** @return The bytes that @p vector allocated, including its unused capacity. */
+template <typename value_t, typename allocator_t>
+size_t heap_bytes(const std::vector<value_t, allocator_t> &vector) {
+    return vector.capacity() * sizeof(value_t);
+}
+
+/** @return The bytes that @p vector and each of its vectors allocated. */
+template <typename value_t, typename allocator_t, typename inner_allocator_t>
+size_t heap_bytes(const std::vector<std::vector<value_t, inner_allocator_t>, allocator_t> &vector) {
+    size_t result = vector.capacity() * sizeof(std::vector<value_t, inner_allocator_t>);
+    for (const auto &inner : vector) {
+        result += heap_bytes(inner);
+    }
+    return result;
+}
+
+} // namespace detail
+} // namespace hwcpipe
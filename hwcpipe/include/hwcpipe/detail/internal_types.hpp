@@ -9,23 +9,23 @@
 #include "hwcpipe/hwcpipe_counter.h"
 #include "hwcpipe/types.hpp"
 
+#include <device/constants.hpp>
 #include <device/handle.hpp>
 #include <device/hwcnt/block_metadata.hpp>
 #include <device/hwcnt/sample.hpp>
 #include <device/hwcnt/sampler/manual.hpp>
+#include <device/hwcnt/sampler/periodic.hpp>
 #include <device/instance.hpp>
 
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
 #include <cstdint>
-#include <initializer_list>
 #include <system_error>
-#include <vector>
+#include <type_traits>
 namespace hwcpipe {
 namespace detail {
 
-struct counter_data {
-    virtual ~counter_data() noexcept = default;
-};
-
 namespace expression {
 /**
  * The expression evaluation context provides an abstraction over some block of
@@ -67,11 +67,228 @@ class context {
 
 // Signature for generated evaluation functions.
 using evaluator = double (*)(const context &);
+
+/**
+ * The device constants that expressions read, converted to double once when
+ * the sampler is created. Expressions of the form (a / constant / b) * 100
+ * read the folded percentage factors instead, so they are evaluated with
+ * one multiply and no division by the constant.
+ */
+struct device_constants {
+    /** The AXI bus width in bytes. */
+    double ext_bus_byte_size;
+    /** The number of shader cores. */
+    double shader_core_count;
+    /** The total L2 cache size in bytes. */
+    double l2_cache_count;
+    /** 100 / shader_core_count. */
+    double percent_per_shader_core;
+    /** 100 / l2_cache_count. */
+    double percent_per_l2_cache;
+};
+
+/**
+ * Signature for generated evaluation functions that read their operands from a
+ * flat array, ordered as the expression's dependencies, instead of through a
+ * context. They let the sampler gather the operands once and evaluate without
+ * any virtual calls.
+ */
+using flat_evaluator = double (*)(const double *inputs, const device_constants &constants);
+
+/**
+ * Signature for generated evaluation functions that compute an expression for
+ * @p count independent sets of operands, e.g. a time series or the values of
+ * each shader core. inputs[k] points to the @p count values of the k-th
+ * dependency, and results receives @p count values. The loop is branch free
+ * so the compiler can vectorize it.
+ */
+using batch_evaluator = void (*)(const double *const *inputs, size_t count, const device_constants &constants,
+                                 double *results);
+
+/**
+ * Converts the device constants used by the expressions, and folds the
+ * constant factors of the expressions that divide by a constant.
+ */
+inline device_constants make_device_constants(const device::constants &constants) {
+    device_constants result{};
+    result.ext_bus_byte_size = static_cast<double>(constants.axi_bus_width) / 8.0;
+    result.shader_core_count = static_cast<double>(constants.num_shader_cores);
+    result.l2_cache_count =
+        static_cast<double>(constants.l2_slice_size) * static_cast<double>(constants.num_l2_slices);
+    result.percent_per_shader_core = 100.0 / result.shader_core_count;
+    result.percent_per_l2_cache = 100.0 / result.l2_cache_count;
+    return result;
+}
+
+/** The maximum number of values on the stack of a bytecode program. */
+constexpr size_t max_stack_depth = 32;
+
+/** The operations of a postfix bytecode program over a small value stack. */
+enum class opcode : uint8_t {
+    /** Pushes inputs[operand]. */
+    input,
+    /** Pushes literals[operand]. */
+    literal,
+    add,
+    sub,
+    mul,
+    div,
+    neg,
+    /** Replaces the top operand values by their minimum. */
+    min,
+    /** Replaces the top operand values by their maximum. */
+    max,
+    /** Pushes the device constant selected by operand, a device_constant. */
+    constant,
+};
+
+/** The device constants that an opcode::constant instruction reads. */
+enum class device_constant : uint32_t {
+    ext_bus_byte_size,
+    shader_core_count,
+    l2_cache_count,
+};
+
+/** Number of device_constant values. */
+constexpr uint32_t num_device_constants = 3;
+
+/**
+ * One bytecode instruction. Its layout is part of the database blob format,
+ * so it must not change.
+ */
+struct instruction {
+    opcode op;
+    uint32_t operand;
+};
+
+static_assert(sizeof(instruction) == 8, "instruction must match the database blob layout");
+
+/**
+ * The bytecode of an expression that lives elsewhere, e.g. in a mapped
+ * database blob. Its operands are read from a flat array in the order of the
+ * expression's dependencies, like a flat_evaluator.
+ */
+struct bytecode {
+    const instruction *code;
+    uint32_t size;
+    const double *literals;
+
+    HWCP_NODISCARD bool empty() const { return size == 0; }
+};
+
+/**
+ * Divides with the 0 / 0 = 0 rule of the derived expressions, without a
+ * branch: the quotient is always computed and the result is selected, so
+ * loops over many samples or cores can be vectorized.
+ */
+inline double divide(double numerator, double denominator) {
+    const double quotient = numerator / denominator;
+    const bool zero_over_zero = (numerator == 0.0) & (denominator == 0.0);
+    return zero_over_zero ? 0.0 : quotient;
+}
+
+/**
+ * Evaluates a postfix program, which must have been validated: its stack
+ * stays within max_stack_depth and ends with one value.
+ *
+ * @param [in] code       The instructions.
+ * @param [in] size       Number of instructions.
+ * @param [in] literals   The values of the literal instructions.
+ * @param [in] inputs     The operand values, in dependency order.
+ * @param [in] constants  The values of the constant instructions, or nullptr
+ *                        if the program has none.
+ * @return The value of the program.
+ */
+inline double evaluate_postfix(const instruction *code, size_t size, const double *literals, const double *inputs,
+                               const device_constants *constants) {
+    double stack[max_stack_depth];
+    size_t top = 0;
+
+    for (const auto *it = code; it != code + size; ++it) {
+        switch (it->op) {
+        case opcode::input:
+            stack[top++] = inputs[it->operand];
+            break;
+        case opcode::literal:
+            stack[top++] = literals[it->operand];
+            break;
+        case opcode::add:
+            --top;
+            stack[top - 1] = stack[top - 1] + stack[top];
+            break;
+        case opcode::sub:
+            --top;
+            stack[top - 1] = stack[top - 1] - stack[top];
+            break;
+        case opcode::mul:
+            --top;
+            stack[top - 1] = stack[top - 1] * stack[top];
+            break;
+        case opcode::div:
+            --top;
+            stack[top - 1] = divide(stack[top - 1], stack[top]);
+            break;
+        case opcode::neg:
+            stack[top - 1] = -stack[top - 1];
+            break;
+        case opcode::min:
+            top -= it->operand - 1;
+            stack[top - 1] = *std::min_element(stack + top - 1, stack + top - 1 + it->operand);
+            break;
+        case opcode::max:
+            top -= it->operand - 1;
+            stack[top - 1] = *std::max_element(stack + top - 1, stack + top - 1 + it->operand);
+            break;
+        case opcode::constant:
+            assert(constants != nullptr);
+            switch (static_cast<device_constant>(it->operand)) {
+            case device_constant::ext_bus_byte_size:
+                stack[top++] = constants->ext_bus_byte_size;
+                break;
+            case device_constant::shader_core_count:
+                stack[top++] = constants->shader_core_count;
+                break;
+            case device_constant::l2_cache_count:
+            default:
+                stack[top++] = constants->l2_cache_count;
+                break;
+            }
+            break;
+        default:
+            assert(false && "Invalid opcode");
+            break;
+        }
+    }
+
+    assert(top == 1);
+    return stack[0];
+}
+
+/** @return The value of a bytecode expression for the given operand values. */
+inline double evaluate(const bytecode &program, const double *inputs, const device_constants &constants) {
+    return evaluate_postfix(program.code, program.size, program.literals, inputs, &constants);
+}
+
+/**
+ * A view of the counters that an expression depends on. The dependencies live
+ * in the constant tables of the database, or in a mapped database blob, so
+ * the view is never dangling.
+ */
+struct dependency_list {
+    const hwcpipe_counter *first;
+    const hwcpipe_counter *last;
+
+    HWCP_NODISCARD const hwcpipe_counter *begin() const { return first; }
+    HWCP_NODISCARD const hwcpipe_counter *end() const { return last; }
+    HWCP_NODISCARD size_t size() const { return static_cast<size_t>(last - first); }
+    HWCP_NODISCARD bool empty() const { return first == last; }
+};
+
 /**
  * Holds information about the expression that the sampler will need when
  * registering the counters and evaluating.
  */
-struct expression_definition : public counter_data {
+struct expression_definition {
     /**
      * Pointer to the function that will evaluate the expression and return the
      * calculated result.
@@ -82,11 +299,22 @@ struct expression_definition : public counter_data {
      * be implicitly registered with the sampler so that they can be collected
      * when it is polled.
      */
-    const std::vector<hwcpipe_counter> dependencies;
-
-    expression_definition(evaluator eval, const std::initializer_list<hwcpipe_counter> dependencies)
-        : eval(eval)
-        , dependencies(std::move(dependencies)) {}
+    dependency_list dependencies;
+    /**
+     * Pointer to the function that evaluates the expression from the values
+     * of its dependencies, in dependency order. May be null.
+     */
+    flat_evaluator flat_eval;
+    /**
+     * Pointer to the function that evaluates the expression over arrays of
+     * operands. May be null.
+     */
+    batch_evaluator batch_eval;
+    /**
+     * The bytecode of an expression read from a database blob, which has no
+     * evaluator functions. Empty for the compiled expressions.
+     */
+    bytecode code;
 };
 
 } // namespace expression
@@ -94,17 +322,12 @@ struct expression_definition : public counter_data {
  * Structure representing the block type/offset address and shift
  * scaling of a counter within a particular GPU's PMU data.
  */
-struct block_offset : public counter_data {
+struct block_offset {
     using block_t = hwcpipe::device::hwcnt::block_type;
 
     uint32_t offset;
     uint32_t shift;
     block_t block_type;
-
-    block_offset(uint32_t offset, uint32_t shift, block_t block_type)
-        : offset(offset)
-        , shift(shift)
-        , block_type(block_type) {}
 };
 
 /**
@@ -114,39 +337,142 @@ struct block_offset : public counter_data {
  * For hardware counters, we need to know their block/offset addresses so that
  * we can read them as we iterate over the block types. For expression counters
  * we need to call the function that will evaluate the formula.
+ *
+ * The definition is a trivially copyable tagged union, so copying it doesn't
+ * allocate or touch a reference count.
  */
 struct counter_definition {
     enum class type { invalid, hardware, expression };
     type tag;
-    const std::shared_ptr<counter_data> data;
 
     HWCP_NODISCARD const expression::expression_definition &get_expression() const {
         assert(tag == type::expression);
-        auto const ptr = std::static_pointer_cast<const expression::expression_definition>(data);
-        return *ptr;
+        return data_.expression;
     }
 
     HWCP_NODISCARD const block_offset &get_address() const {
         assert(tag == type::hardware);
-        auto const ptr = std::static_pointer_cast<const block_offset>(data);
-        return *ptr;
+        return data_.address;
     }
 
     counter_definition()
         : tag(type::invalid)
-        , data(std::make_shared<block_offset>(0, 0, device::hwcnt::block_type::fe)) {}
+        , data_(block_offset{0, 0, device::hwcnt::block_type::fe}) {}
     explicit counter_definition(expression::expression_definition expression)
         : tag(type::expression)
-        , data(std::make_shared<expression::expression_definition>(expression)) {}
+        , data_(expression) {}
     explicit counter_definition(block_offset address)
         : tag(type::hardware)
-        , data(std::make_shared<block_offset>(address)) {}
+        , data_(address) {}
+
+  private:
+    union payload {
+        block_offset address;
+        expression::expression_definition expression;
+
+        explicit payload(block_offset address)
+            : address(address) {}
+        explicit payload(expression::expression_definition expression)
+            : expression(expression) {}
+    } data_;
+};
+
+static_assert(std::is_trivially_copyable<counter_definition>::value, "counter_definition must be cheap to copy");
+
+/**
+ * A constant-initialized database entry for one counter of a particular GPU.
+ *
+ * The generated database is made of plain arrays of these records, sorted by
+ * counter, so it is laid out at compile time and needs no heap allocations or
+ * static constructors. A counter_definition is only materialized from a
+ * record when a counter is registered with a sampler.
+ */
+struct counter_record {
+    using block_t = hwcpipe::device::hwcnt::block_type;
+
+    hwcpipe_counter counter;
+    counter_definition::type tag;
+    uint16_t offset;
+    uint8_t shift;
+    block_t block_type;
+    expression::evaluator eval;
+    expression::flat_evaluator flat_eval;
+    expression::batch_evaluator batch_eval;
+    const hwcpipe_counter *dependencies;
+    uint8_t num_dependencies;
+
+    /** Constructs a hardware counter record. */
+    constexpr counter_record(hwcpipe_counter counter, uint16_t offset, uint8_t shift, block_t block_type)
+        : counter(counter)
+        , tag(counter_definition::type::hardware)
+        , offset(offset)
+        , shift(shift)
+        , block_type(block_type)
+        , eval(nullptr)
+        , flat_eval(nullptr)
+        , batch_eval(nullptr)
+        , dependencies(nullptr)
+        , num_dependencies(0) {}
+
+    /** Constructs an expression counter record. */
+    constexpr counter_record(hwcpipe_counter counter, expression::evaluator eval,
+                             expression::flat_evaluator flat_eval, expression::batch_evaluator batch_eval,
+                             const hwcpipe_counter *dependencies, uint8_t num_dependencies)
+        : counter(counter)
+        , tag(counter_definition::type::expression)
+        , offset(0)
+        , shift(0)
+        , block_type(block_t::fe)
+        , eval(eval)
+        , flat_eval(flat_eval)
+        , batch_eval(batch_eval)
+        , dependencies(dependencies)
+        , num_dependencies(num_dependencies) {}
+
+    /** @return The counter definition described by this record. */
+    HWCP_NODISCARD counter_definition to_definition() const {
+        if (tag == counter_definition::type::expression) {
+            return counter_definition(expression::expression_definition{
+                eval, {dependencies, dependencies + num_dependencies}, flat_eval, batch_eval, {}});
+        }
+        return counter_definition(block_offset{offset, shift, block_type});
+    }
+};
+
+/**
+ * The counters of a particular GPU. Products with identical counters share one
+ * table of records, and a product that only differs slightly from another
+ * has a short list of overrides that add to, or replace, the records of the
+ * shared table. Both ranges are sorted by counter.
+ */
+struct counter_table {
+    const counter_record *shared_begin{nullptr};
+    const counter_record *shared_end{nullptr};
+    const counter_record *overrides_begin{nullptr};
+    const counter_record *overrides_end{nullptr};
+
+    /** @return The record of a counter, or nullptr if the GPU doesn't have it. */
+    HWCP_NODISCARD const counter_record *find(hwcpipe_counter counter) const {
+        if (const auto *record = find(overrides_begin, overrides_end, counter)) {
+            return record;
+        }
+        return find(shared_begin, shared_end, counter);
+    }
+
+  private:
+    static const counter_record *find(const counter_record *begin, const counter_record *end,
+                                      hwcpipe_counter counter) {
+        const auto *record = std::lower_bound(
+            begin, end, counter, [](const counter_record &lhs, hwcpipe_counter rhs) { return lhs.counter < rhs; });
+        return record != end && record->counter == counter ? record : nullptr;
+    }
 };
 
 struct hwcpipe_backend_policy {
     using handle_type = device::handle;
     using instance_type = device::instance;
     using sampler_type = device::hwcnt::sampler::manual;
+    using periodic_sampler_type = device::hwcnt::sampler::periodic;
     using sample_type = device::hwcnt::sample;
 };
 
@@ -169,12 +495,7 @@ class hwcpipe_double {
 
     hwcpipe_double operator*(const hwcpipe_double &other) const { return hwcpipe_double(value * other.value); }
 
-    hwcpipe_double operator/(const hwcpipe_double &other) const {
-        if (value == 0.0 && other.value == 0.0) {
-            return hwcpipe_double(0.0);
-        }
-        return hwcpipe_double(value / other.value);
-    }
+    hwcpipe_double operator/(const hwcpipe_double &other) const { return hwcpipe_double(divide(value, other.value)); }
 
     hwcpipe_double operator+(const int &other) const { return hwcpipe_double(value + other); }
 
@@ -183,10 +504,7 @@ class hwcpipe_double {
     hwcpipe_double operator*(const int &other) const { return hwcpipe_double(value * other); }
 
     hwcpipe_double operator/(const int &other) const {
-        if (value == 0.0 && other == 0) {
-            return hwcpipe_double(0.0);
-        }
-        return hwcpipe_double(value / other);
+        return hwcpipe_double(divide(value, static_cast<double>(other)));
     }
 
     hwcpipe_double operator+(const double &other) const { return hwcpipe_double(value + other); }
@@ -195,12 +513,7 @@ class hwcpipe_double {
 
     hwcpipe_double operator*(const double &other) const { return hwcpipe_double(value * other); }
 
-    hwcpipe_double operator/(const double &other) const {
-        if (value == 0.0 && other == 0.0) {
-            return hwcpipe_double(0.0);
-        }
-        return hwcpipe_double(value / other);
-    }
+    hwcpipe_double operator/(const double &other) const { return hwcpipe_double(divide(value, other)); }
 
     bool operator<(const hwcpipe_double &other) const { return value < other.value; }
 
@@ -213,6 +526,10 @@ class hwcpipe_double {
     bool operator==(const hwcpipe_double &other) const { return value == other.value; }
 
     operator double() const { return value; }
+
+  private:
+    /** Divides with the 0 / 0 = 0 rule, see expression::divide(). */
+    static double divide(double numerator, double denominator) { return expression::divide(numerator, denominator); }
 };
 
 } // namespace detail
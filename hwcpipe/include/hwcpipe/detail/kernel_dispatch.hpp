@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include "hwcpipe/types.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace hwcpipe {
+namespace detail {
+
+/** The instruction sets the decode kernels are built for. */
+enum class kernel_isa : uint8_t {
+    /** Plain C++, available everywhere. */
+    scalar,
+    /** Armv8 Advanced SIMD. */
+    neon,
+    /** x86 SSE2. */
+    sse2,
+    /** x86 AVX2. */
+    avx2,
+};
+
+/** Number of kernel_isa values. */
+constexpr size_t num_kernel_isas = 4;
+
+/** The features of the CPU the process runs on, as reported by the kernel or cpuid. */
+struct cpu_features {
+    /** Armv8 Advanced SIMD. */
+    bool neon;
+    /** Armv8.2 dot product instructions. */
+    bool dotprod;
+    /** Armv9 SVE2. */
+    bool sve2;
+    /** x86 SSE2. */
+    bool sse2;
+    /** x86 AVX2. */
+    bool avx2;
+};
+
+/** @return The features of the CPU, detected on the first call. */
+HWCP_NODISCARD const cpu_features &get_cpu_features();
+
+/**
+ * A set of decode kernels built for one instruction set. The sampler calls
+ * them through the set selected when it is constructed, so the library picks
+ * the best kernels of the CPU it runs on rather than those of the -march
+ * flags it was built with.
+ */
+struct decode_kernels {
+    /** The instruction set of the kernels. */
+    kernel_isa isa;
+    /** The name of the instruction set, for reports. */
+    const char *name;
+    /** Adds every 32-bit value of a block into a block sized array of 64-bit totals. */
+    void (*reduce_32)(const uint32_t *src, size_t count, uint64_t *totals);
+    /** Adds every 64-bit value of a block into a block sized array of 64-bit totals. */
+    void (*reduce_64)(const uint64_t *src, size_t count, uint64_t *totals);
+
+    /** Calls reduce_32. */
+    void reduce(const uint32_t *src, size_t count, uint64_t *totals) const { reduce_32(src, count, totals); }
+
+    /** Calls reduce_64. */
+    void reduce(const uint64_t *src, size_t count, uint64_t *totals) const { reduce_64(src, count, totals); }
+};
+
+/**
+ * @param [in] isa  An instruction set.
+ * @return The kernels built for @p isa, or nullptr if they were not built for
+ * this target or the CPU doesn't support them.
+ */
+HWCP_NODISCARD const decode_kernels *find_decode_kernels(kernel_isa isa);
+
+/** @return The fastest kernels the CPU supports, selected on the first call. */
+HWCP_NODISCARD const decode_kernels &select_decode_kernels();
+
+} // namespace detail
+} // namespace hwcpipe
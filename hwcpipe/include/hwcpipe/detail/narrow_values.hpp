@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace hwcpipe {
+namespace detail {
+
+/** The 32-bit value that marks a delta too large for 32 bits. */
+constexpr uint32_t delta_escape = UINT32_MAX;
+
+/**
+ * Narrows counter deltas to 32 bits. A delta that doesn't fit below
+ * delta_escape is stored as delta_escape, and must be kept elsewhere by the
+ * caller. The loop has no branch, so that the compiler vectorizes it.
+ *
+ * @param [in]  src    The deltas.
+ * @param [in]  count  Number of deltas.
+ * @param [out] dst    The narrowed deltas, @p count entries long.
+ * @return True if every delta fit, false if at least one was escaped.
+ */
+inline bool narrow_deltas(const uint64_t *src, size_t count, uint32_t *dst) {
+    uint64_t escaped = 0;
+    for (size_t i = 0; i != count; ++i) {
+        const uint64_t value = src[i];
+        const uint64_t overflow = static_cast<uint64_t>(value >= delta_escape);
+        escaped |= overflow;
+        dst[i] = static_cast<uint32_t>(overflow != 0 ? delta_escape : value);
+    }
+    return escaped == 0;
+}
+
+/**
+ * Adds narrowed deltas to 64-bit sums, escaped deltas being added as
+ * delta_escape.
+ *
+ * @param [in]     src    The narrowed deltas.
+ * @param [in]     count  Number of deltas.
+ * @param [in,out] sums   The sums, @p count entries long.
+ */
+inline void add_narrow_deltas(const uint32_t *src, size_t count, uint64_t *sums) {
+    for (size_t i = 0; i != count; ++i) {
+        sums[i] += src[i];
+    }
+}
+
+/** Subtracts narrowed deltas from 64-bit sums, as add_narrow_deltas() adds them. */
+inline void subtract_narrow_deltas(const uint32_t *src, size_t count, uint64_t *sums) {
+    for (size_t i = 0; i != count; ++i) {
+        sums[i] -= src[i];
+    }
+}
+
+/**
+ * Narrows values to single precision, in a loop the compiler vectorizes.
+ *
+ * @param [in]  src    The values.
+ * @param [in]  count  Number of values.
+ * @param [out] dst    The narrowed values, @p count entries long.
+ */
+inline void narrow_values(const double *src, size_t count, float *dst) {
+    for (size_t i = 0; i != count; ++i) {
+        dst[i] = static_cast<float>(src[i]);
+    }
+}
+
+} // namespace detail
+} // namespace hwcpipe
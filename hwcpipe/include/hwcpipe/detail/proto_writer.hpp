@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace hwcpipe {
+namespace detail {
+
+/**
+ * Writes protobuf fields into a caller provided buffer. Only the wire types
+ * needed by the trace exporters are supported. Each function returns the
+ * number of bytes written, and the buffer must be large enough: a varint
+ * takes at most max_varint_size bytes, a tag at most max_tag_size bytes.
+ */
+namespace proto_writer {
+
+/** Size of the longest 64-bit varint. */
+constexpr size_t max_varint_size = 10;
+/** Size of the longest tag of a field number below 2^18. */
+constexpr size_t max_tag_size = 3;
+
+/** Protobuf wire types. */
+enum class wire_type : uint8_t {
+    varint = 0,
+    fixed64 = 1,
+    length_delimited = 2,
+};
+
+/** Writes @p value as a LEB128 varint. */
+inline size_t put_varint(uint8_t *output, uint64_t value) {
+    size_t size = 0;
+    while (value >= 0x80U) {
+        output[size++] = static_cast<uint8_t>(value | 0x80U);
+        value >>= 7U;
+    }
+    output[size++] = static_cast<uint8_t>(value);
+    return size;
+}
+
+/** Writes the tag of a field. */
+inline size_t put_tag(uint8_t *output, uint32_t field, wire_type type) {
+    return put_varint(output, (static_cast<uint64_t>(field) << 3U) | static_cast<uint64_t>(type));
+}
+
+/** Writes a varint field. */
+inline size_t put_varint_field(uint8_t *output, uint32_t field, uint64_t value) {
+    const size_t size = put_tag(output, field, wire_type::varint);
+    return size + put_varint(output + size, value);
+}
+
+/** Writes a double field, little endian. */
+inline size_t put_double_field(uint8_t *output, uint32_t field, double value) {
+    const size_t size = put_tag(output, field, wire_type::fixed64);
+    uint64_t bits{};
+    std::memcpy(&bits, &value, sizeof(bits));
+    for (size_t i = 0; i != sizeof(bits); ++i) {
+        output[size + i] = static_cast<uint8_t>(bits >> (i * 8U));
+    }
+    return size + sizeof(bits);
+}
+
+/** Writes the tag and length of a length delimited field, whose bytes follow. */
+inline size_t put_length_header(uint8_t *output, uint32_t field, size_t length) {
+    const size_t size = put_tag(output, field, wire_type::length_delimited);
+    return size + put_varint(output + size, length);
+}
+
+/** Writes a string field. */
+inline size_t put_string_field(uint8_t *output, uint32_t field, const char *value, size_t length) {
+    const size_t size = put_length_header(output, field, length);
+    std::memcpy(output + size, value, length);
+    return size + length;
+}
+
+} // namespace proto_writer
+} // namespace detail
+} // namespace hwcpipe
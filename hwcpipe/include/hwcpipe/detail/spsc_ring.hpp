@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+namespace hwcpipe {
+namespace detail {
+
+/**
+ * A lock-free single-producer single-consumer ring of slots that are
+ * allocated at construction and reused, as sample_ring is for decoded
+ * samples. Either side may also wait for the other, e.g. a worker thread for
+ * its input: it then sleeps on a condition variable, which the other side
+ * only signals when someone is waiting, so that the lock-free path takes no
+ * lock. Closing the ring wakes the waiters for good.
+ */
+template <typename slot_t>
+class spsc_ring {
+  public:
+    /**
+     * @param [in] capacity   Number of slots, must be a power of two.
+     * @param [in] prototype  The value every slot is initialized with.
+     */
+    spsc_ring(size_t capacity, const slot_t &prototype)
+        : capacity_(capacity)
+        , slots_(capacity, prototype) {
+        assert(capacity != 0 && (capacity & (capacity - 1)) == 0);
+    }
+
+    spsc_ring(const spsc_ring &) = delete;
+    spsc_ring &operator=(const spsc_ring &) = delete;
+
+    /** @return The number of slots in the ring. */
+    size_t capacity() const { return capacity_; }
+
+    /** @return The slots, for the memory footprint of their contents. */
+    const std::vector<slot_t> &slots() const { return slots_; }
+
+    /** Producer: returns the next free slot, or nullptr if the ring is full. */
+    slot_t *acquire_write() {
+        const auto head = head_.load(std::memory_order_relaxed);
+        if (head - cached_tail_ == capacity_) {
+            cached_tail_ = tail_.load(std::memory_order_acquire);
+            if (head - cached_tail_ == capacity_) {
+                return nullptr;
+            }
+        }
+        return &slots_[head & (capacity_ - 1)];
+    }
+
+    /** Producer: publishes the slot returned by the last call to acquire_write(). */
+    void publish() {
+        head_.store(head_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+        notify();
+    }
+
+    /** Consumer: returns the oldest published slot, or nullptr if the ring is empty. */
+    slot_t *acquire_read() {
+        const auto tail = tail_.load(std::memory_order_relaxed);
+        if (tail == cached_head_) {
+            cached_head_ = head_.load(std::memory_order_acquire);
+            if (tail == cached_head_) {
+                return nullptr;
+            }
+        }
+        return &slots_[tail & (capacity_ - 1)];
+    }
+
+    /** Consumer: hands the slot returned by the last call to acquire_read() back to the producer. */
+    void release() {
+        tail_.store(tail_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+        notify();
+    }
+
+    /** Consumer: @return True if a slot was published and not released yet. */
+    bool readable() const { return head_.load(std::memory_order_acquire) != tail_.load(std::memory_order_relaxed); }
+
+    /** Producer: @return True if a slot is free. */
+    bool writable() const {
+        return head_.load(std::memory_order_relaxed) - tail_.load(std::memory_order_acquire) != capacity_;
+    }
+
+    /** Consumer: waits for at most @p timeout for a published slot, @return readable(). */
+    bool wait_readable(std::chrono::nanoseconds timeout) {
+        return wait([this] { return readable(); }, timeout);
+    }
+
+    /** Producer: waits for at most @p timeout for a free slot, @return writable(). */
+    bool wait_writable(std::chrono::nanoseconds timeout) {
+        return wait([this] { return writable(); }, timeout);
+    }
+
+    /** Closes the ring, waking both sides. The slots published so far can still be read. */
+    void close() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            closed_.store(true, std::memory_order_release);
+        }
+        changed_.notify_all();
+    }
+
+    /** @return True once close() was called. */
+    bool closed() const { return closed_.load(std::memory_order_acquire); }
+
+  private:
+    template <typename pred_t>
+    bool wait(pred_t ready, std::chrono::nanoseconds timeout) {
+        if (ready()) {
+            return true;
+        }
+        std::unique_lock<std::mutex> lock(mutex_);
+        // announce the waiter before checking again, the other side checks
+        // for waiters after its update, so one of them sees the other
+        waiters_.fetch_add(1, std::memory_order_seq_cst);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        changed_.wait_for(lock, timeout, [&] { return ready() || closed(); });
+        waiters_.fetch_sub(1, std::memory_order_relaxed);
+        return ready();
+    }
+
+    void notify() {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (waiters_.load(std::memory_order_seq_cst) != 0) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            changed_.notify_all();
+        }
+    }
+
+    static constexpr size_t cache_line_size = 64;
+
+    const size_t capacity_;
+    std::vector<slot_t> slots_;
+
+    // the indices are kept on separate cache lines, as in sample_ring
+    char head_padding_[cache_line_size]{};
+    // written by the producer
+    std::atomic<size_t> head_{0};
+    size_t cached_tail_{};
+    char producer_padding_[cache_line_size - sizeof(size_t)]{};
+
+    // written by the consumer
+    std::atomic<size_t> tail_{0};
+    size_t cached_head_{};
+    char consumer_padding_[cache_line_size - sizeof(size_t)]{};
+
+    std::atomic<size_t> waiters_{0};
+    std::atomic<bool> closed_{false};
+    std::mutex mutex_{};
+    std::condition_variable changed_{};
+};
+
+} // namespace detail
+} // namespace hwcpipe
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace hwcpipe {
+namespace detail {
+
+/**
+ * A pool of threads that run the numbered tasks of a batch. A thread that
+ * finishes a task takes the next one that no thread has taken, so the load
+ * balances itself when tasks take uneven time. The thread that runs the
+ * batch takes tasks too, as worker zero, so a pool of one thread has no
+ * thread of its own. One batch runs at a time.
+ */
+class task_pool {
+  public:
+    /** Runs task @p task on worker @p worker, which is below num_threads(). */
+    using task_fn = std::function<void(size_t worker, size_t task)>;
+
+    /**
+     * @param [in] num_threads  Number of threads running the tasks, including
+     *                          the calling thread, or zero for one per
+     *                          hardware thread.
+     */
+    explicit task_pool(size_t num_threads) {
+        if (num_threads == 0) {
+            num_threads = std::max(std::thread::hardware_concurrency(), 1U);
+        }
+        num_threads_ = num_threads;
+        for (size_t i = 1; i < num_threads; ++i) {
+            threads_.emplace_back([this, i] { run_worker(i); });
+        }
+    }
+
+    ~task_pool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        work_ready_.notify_all();
+        for (auto &thread : threads_) {
+            thread.join();
+        }
+    }
+
+    task_pool(const task_pool &) = delete;
+    task_pool &operator=(const task_pool &) = delete;
+
+    /** @return The number of threads running the tasks, including the calling thread. */
+    size_t num_threads() const { return num_threads_; }
+
+    /** Runs @p task for tasks 0 to @p num_tasks - 1, on all the threads, and waits for them. */
+    void run(size_t num_tasks, const task_fn &task) {
+        if (num_tasks == 0) {
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            task_ = &task;
+            num_tasks_ = num_tasks;
+            next_task_.store(0);
+            busy_ = threads_.size();
+            ++generation_;
+        }
+        work_ready_.notify_all();
+
+        run_tasks(0);
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        work_done_.wait(lock, [this] { return busy_ == 0; });
+        task_ = nullptr;
+    }
+
+  private:
+    /** Takes the tasks that no thread has taken yet, until there are none left. */
+    void run_tasks(size_t worker) {
+        for (size_t task = next_task_.fetch_add(1); task < num_tasks_; task = next_task_.fetch_add(1)) {
+            (*task_)(worker, task);
+        }
+    }
+
+    void run_worker(size_t worker) {
+        uint64_t generation = 0;
+        for (;;) {
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                work_ready_.wait(lock, [&] { return stop_ || generation_ != generation; });
+                if (stop_) {
+                    return;
+                }
+                generation = generation_;
+            }
+
+            run_tasks(worker);
+
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (--busy_ == 0) {
+                work_done_.notify_one();
+            }
+        }
+    }
+
+    size_t num_threads_{};
+    std::vector<std::thread> threads_{};
+
+    // the current batch, published to the threads under mutex_
+    std::mutex mutex_{};
+    std::condition_variable work_ready_{};
+    std::condition_variable work_done_{};
+    const task_fn *task_{};
+    size_t num_tasks_{};
+    std::atomic<size_t> next_task_{};
+    size_t busy_{};
+    uint64_t generation_{};
+    bool stop_{};
+};
+
+} // namespace detail
+} // namespace hwcpipe
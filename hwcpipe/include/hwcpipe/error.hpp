@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Arm Limited.
+ * Copyright (c) 2023-2025 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  */
@@ -23,7 +23,50 @@ enum class errc {
     sampling_not_started,
     sample_collection_failure,
     accumulation_start_failed,
-    accumulation_stop_failed
+    accumulation_stop_failed,
+    invalid_read_list,
+    sample_not_ready,
+    instance_values_unavailable,
+    // Custom counters
+    invalid_expression,
+    // Shared sample segments
+    segment_creation_failed,
+    invalid_segment_layout,
+    daemon_connection_failed,
+    // Trace files
+    trace_write_failed,
+    trace_read_failed,
+    invalid_trace_layout,
+    trace_replay_in_use,
+    // Threads
+    thread_config_failed,
+    // Sample streams
+    stream_closed,
+    // Counter statistics
+    statistics_mismatch,
+    invalid_statistics_layout,
+    // Capture planning
+    counter_budget_exceeded,
+    // Network streaming
+    network_send_failed,
+    // Core sub-sampling
+    error_estimate_unavailable,
+    // CPU counters
+    cpu_counters_unavailable,
+    // GPU frequency
+    frequency_unavailable,
+    // Sampler plans
+    invalid_sampler_plan,
+    // Atrace
+    trace_marker_unavailable,
+    // Metrics endpoint
+    metrics_listen_failed,
+    metrics_accept_failed,
+    // Counter database blobs
+    database_blob_unavailable,
+    invalid_database_blob,
+    // Runtime power management
+    runtime_pm_unavailable
 };
 
 /**
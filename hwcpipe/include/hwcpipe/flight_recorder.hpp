@@ -0,0 +1,322 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include "hwcpipe/error.hpp"
+#include "hwcpipe/hwcpipe_counter.h"
+#include "hwcpipe/sampler.hpp"
+#include "hwcpipe/types.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <system_error>
+#include <vector>
+
+namespace hwcpipe {
+
+/**
+ * The binary layout of a flight recording. The file has a fixed size and is
+ * laid out as:
+ *
+ *  - a file_header at offset 0,
+ *  - num_counters 32-bit hwcpipe_counter values at counters_offset,
+ *  - capacity slots of record_size bytes from records_offset. Each slot holds
+ *    a record_header followed by num_counters 64-bit words, each the bit
+ *    pattern of an IEEE-754 double.
+ *
+ * Sample number n, starting at 1, is written to slot (n - 1) % capacity, so
+ * the slots hold the last capacity samples. A slot is valid if its sequence is
+ * not zero, it is the slot of its sequence, and its checksum is the
+ * checksum() of the sequence, the timestamp and the values. A slot that was
+ * being written when the process died fails the checksum.
+ */
+namespace flight_layout {
+
+/** 'HWFR' in little endian. */
+constexpr uint32_t magic = 0x52465748;
+/** Incremented for changes that existing readers can't parse. */
+constexpr uint16_t version_major = 1;
+/** Incremented for compatible additions. */
+constexpr uint16_t version_minor = 0;
+
+/** The header at the start of a recording. */
+struct file_header {
+    uint32_t magic;
+    uint16_t version_major;
+    uint16_t version_minor;
+    /** Size of this header in bytes. */
+    uint32_t header_size;
+    /** Number of counters of each record. */
+    uint32_t num_counters;
+    /** Offset of the counters from the start of the file. */
+    uint32_t counters_offset;
+    /** Offset of the first slot from the start of the file. */
+    uint32_t records_offset;
+    /** Size of a slot in bytes. */
+    uint32_t record_size;
+    /** Number of slots. */
+    uint32_t capacity;
+    /** Total size of the file in bytes. */
+    uint64_t file_size;
+};
+
+/** The header of a slot, followed by the values of the sample. */
+struct record_header {
+    /** The sample number, zero if the slot was never written. */
+    uint64_t sequence;
+    /** Timestamp of the sample, in nanoseconds. */
+    uint64_t timestamp;
+    /** The checksum of the record. */
+    uint64_t checksum;
+};
+
+static_assert(sizeof(file_header) == 40, "The file header layout is part of the recording format.");
+static_assert(sizeof(record_header) == 24, "The record header layout is part of the recording format.");
+
+/**
+ * @brief The checksum of a record: a multiply and xor-shift hash of the
+ * sequence, the timestamp, then the value words, in that order.
+ *
+ * @param [in] sequence   The sequence of the record.
+ * @param [in] timestamp  The timestamp of the record.
+ * @param [in] values     The value words of the record.
+ * @param [in] count      Number of words in @p values.
+ * @return The checksum.
+ */
+inline uint64_t checksum(uint64_t sequence, uint64_t timestamp, const uint64_t *values, size_t count) {
+    constexpr uint64_t multiplier = 0x9E3779B97F4A7C15ULL;
+    const auto mix = [](uint64_t hash, uint64_t word) {
+        hash = (hash ^ word) * multiplier;
+        return hash ^ (hash >> 32U);
+    };
+
+    uint64_t hash = mix(mix(count * multiplier, sequence), timestamp);
+    for (size_t i = 0; i != count; ++i) {
+        hash = mix(hash, values[i]);
+    }
+    return hash;
+}
+
+} // namespace flight_layout
+
+/**
+ * @brief A flight_recorder keeps the last samples of a set of counters in a
+ * circular file, so that they can be read after the process crashed or the
+ * GPU hung, e.g. to see what the GPU was doing in the seconds before.
+ *
+ * The file is created at its final size and mapped shared, so every record is
+ * in the page cache as soon as it is written: it survives the process without
+ * being flushed. Surviving a kernel crash as well needs sync(). Each record
+ * has a sequence number and a checksum, and a flight_record_reader keeps the
+ * longest run of consecutive valid records that ends at the newest one.
+ *
+ * Recording a sample copies the values and hashes them, with no syscall and
+ * no allocation, so the recorder can stay enabled in production. It is not
+ * thread safe. The file is truncated when the recorder is created, so it must
+ * be recovered before the application restarts, or each run given its own
+ * path.
+ *
+ * @par
+ * @code
+ * hwcpipe::flight_recorder recorder("/data/local/tmp/gpu.hwfr", counters, num_counters, 5000);
+ * auto list = sampler.make_read_list(counters, num_counters, ec);
+ * while (running) {
+ *     if (!sampler.sample_now()) {
+ *         ec = recorder.record(sampler, list);
+ *     }
+ * }
+ * @endcode
+ */
+class flight_recorder {
+  public:
+    /**
+     * Creates, sizes and maps the recording, truncating any existing file.
+     * If that fails the recorder is invalid.
+     *
+     * @param [in] path      The path of the recording.
+     * @param [in] counters  The counters to record, in record order.
+     * @param [in] count     Number of entries in @p counters.
+     * @param [in] capacity  Number of samples kept, e.g. five seconds worth.
+     */
+    flight_recorder(const std::string &path, const hwcpipe_counter *counters, size_t count, size_t capacity);
+
+    ~flight_recorder();
+
+    flight_recorder(const flight_recorder &) = delete;
+    flight_recorder &operator=(const flight_recorder &) = delete;
+
+    /** @return True if samples can be recorded. */
+    operator bool() const { return !ec_; }
+
+    /** @return The error that made the recorder invalid, if any. */
+    HWCP_NODISCARD std::error_code get_error() const { return ec_; }
+
+    /** @return The number of recorded counters. */
+    HWCP_NODISCARD size_t size() const { return staging_.size(); }
+
+    /** @return The number of samples kept. */
+    HWCP_NODISCARD size_t capacity() const { return capacity_; }
+
+    /** @return The number of samples recorded so far, including the overwritten ones. */
+    HWCP_NODISCARD uint64_t num_records() const { return sequence_; }
+
+    /**
+     * @brief Records a sample, overwriting the oldest one once the file is
+     * full.
+     *
+     * @param [in] timestamp  The timestamp of the sample.
+     * @param [in] values     One value per recorded counter, in record order.
+     */
+    void record(uint64_t timestamp, const double *values);
+
+    /**
+     * @brief Records the last sample of a sampler.
+     *
+     * @param [in] sampler  The sampler that collected the sample.
+     * @param [in] list     A read list of the recorded counters, in record
+     *                      order.
+     * @return The error returned by sampler::get_counter_values(), or the
+     * creation error if the recorder is invalid.
+     */
+    template <typename backend_policy_t>
+    HWCP_NODISCARD std::error_code record(const sampler<backend_policy_t> &sampler, const read_list &list) {
+        if (ec_) {
+            return ec_;
+        }
+        auto ec = sampler.get_counter_values(list, staging_.data(), staging_.size());
+        if (ec) {
+            return ec;
+        }
+        record(sampler.get_sample_timestamp(), staging_.data());
+        return {};
+    }
+
+    /**
+     * @brief Writes the recorded samples to the storage, so that they also
+     * survive a kernel crash or a power loss. Not needed for process crashes.
+     *
+     * @return hwcpipe::errc::trace_write_failed if the writeback failed.
+     */
+    HWCP_NODISCARD std::error_code sync();
+
+  private:
+    std::error_code ec_;
+    void *mapping_{};
+    size_t size_{};
+    char *records_{};
+    size_t record_size_{};
+    size_t capacity_{};
+    uint64_t sequence_{};
+    std::vector<double> staging_{};
+};
+
+/**
+ * @brief A flight_record_reader recovers the samples of a mapped flight
+ * recording: the longest run of consecutive valid records that ends at the
+ * newest one. Records that are torn, stale or out of place end the run.
+ */
+class flight_record_reader {
+  public:
+    /**
+     * Validates a recording and finds its valid tail. If the recording doesn't
+     * have a supported layout the reader is invalid.
+     *
+     * @param [in] data  The mapped recording.
+     * @param [in] size  The size of the mapping in bytes.
+     */
+    flight_record_reader(const void *data, size_t size);
+
+    /** @return True if the recording has a supported layout. */
+    operator bool() const { return !ec_; }
+
+    /** @return hwcpipe::errc::invalid_trace_layout if the reader is invalid. */
+    HWCP_NODISCARD std::error_code get_error() const { return ec_; }
+
+    /** @return The number of counters of each record. */
+    HWCP_NODISCARD size_t num_counters() const { return num_counters_; }
+
+    /** @return The counter at position @p index of the records. */
+    HWCP_NODISCARD hwcpipe_counter get_counter(size_t index) const {
+        uint32_t counter{};
+        std::memcpy(&counter, counters_ + index * sizeof(counter), sizeof(counter));
+        return static_cast<hwcpipe_counter>(counter);
+    }
+
+    /** @return The number of samples the recording could hold. */
+    HWCP_NODISCARD size_t capacity() const { return capacity_; }
+
+    /** @return The number of recovered samples, oldest first. */
+    HWCP_NODISCARD size_t num_records() const { return slots_.size(); }
+
+    /** @return The header of recovered sample @p index. */
+    HWCP_NODISCARD flight_layout::record_header get_record(size_t index) const {
+        flight_layout::record_header header{};
+        std::memcpy(&header, slot(index), sizeof(header));
+        return header;
+    }
+
+    /** @return The value of counter @p counter in recovered sample @p index. */
+    HWCP_NODISCARD double get_value(size_t index, size_t counter) const {
+        double value{};
+        std::memcpy(&value, slot(index) + sizeof(flight_layout::record_header) + counter * sizeof(value),
+                    sizeof(value));
+        return value;
+    }
+
+  private:
+    HWCP_NODISCARD const char *slot(size_t index) const { return records_ + slots_[index] * record_size_; }
+
+    std::error_code ec_;
+    const char *counters_{};
+    size_t num_counters_{};
+    const char *records_{};
+    size_t record_size_{};
+    size_t capacity_{};
+    // the slots of the recovered samples, oldest first
+    std::vector<size_t> slots_{};
+};
+
+/**
+ * @brief A flight_record_file maps a flight recording read-only, e.g. after a
+ * crash, and reads it with a flight_record_reader.
+ */
+class flight_record_file {
+  public:
+    /**
+     * Maps a recording. If it can't be mapped the file is invalid.
+     *
+     * @param [in] path  The path of the recording.
+     */
+    explicit flight_record_file(const std::string &path);
+
+    ~flight_record_file();
+
+    flight_record_file(const flight_record_file &) = delete;
+    flight_record_file &operator=(const flight_record_file &) = delete;
+
+    /** @return True if the file was mapped and has a supported layout. */
+    operator bool() const { return !get_error(); }
+
+    /**
+     * @return hwcpipe::errc::trace_read_failed if the file could not be
+     * mapped, otherwise the error of the reader.
+     */
+    HWCP_NODISCARD std::error_code get_error() const { return ec_ ? ec_ : reader_.get_error(); }
+
+    /** @return The reader of the mapped recording. */
+    HWCP_NODISCARD const flight_record_reader &get_reader() const { return reader_; }
+
+  private:
+    std::error_code ec_;
+    void *data_{};
+    size_t size_{};
+    flight_record_reader reader_{nullptr, 0};
+};
+
+} // namespace hwcpipe
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include "hwcpipe/detail/device_registry.hpp"
 #include "hwcpipe/error.hpp"
 #include "hwcpipe/types.hpp"
 
@@ -13,8 +14,12 @@
 #include <device/instance.hpp>
 #include <device/product_id.hpp>
 
+#include <array>
+#include <functional>
 #include <iostream>
 #include <iterator>
+#include <memory>
+#include <mutex>
 #include <system_error>
 
 namespace hwcpipe {
@@ -32,7 +37,8 @@ class gpu {
 
     /**
      * Construct a GPU instance for a device number. Probes the device to
-     * fetch its hardware features. If the requested device was not found then
+     * fetch its hardware features, unless a sampler of the process already
+     * holds the device open. If the requested device was not found then
      * the gpu instance will be invalid. Callers should use the valid() method,
      * or cast to bool, to check that the GPU is valid for use.
      *
@@ -40,12 +46,12 @@ class gpu {
      */
     gpu(int device_number)
         : device_number_(device_number) {
-        auto handle = device::handle::create(device_number);
-        if (!handle) {
+        auto device = detail::device_registry<device::handle, device::instance>::get().acquire(device_number);
+        if (!device) {
             valid_ = false;
         } else {
             valid_ = true;
-            fetch_device_info(*handle);
+            constants_ = device->get_instance().get_constants();
         }
 
         auto result = device::product_id_from_raw_gpu_id(constants_.gpu_id);
@@ -57,6 +63,28 @@ class gpu {
         id_ = result.second;
     }
 
+    /**
+     * Construct a GPU instance for a device that the application already
+     * opened, e.g. with `device::handle::from_external_fd()` on the file
+     * descriptor of its graphics driver. The device is not opened again.
+     *
+     * @param [in] handle         The device handle. It is only used by the constructor.
+     * @param [in] device_number  The device instance number, if known.
+     */
+    explicit gpu(device::handle &handle, int device_number = -1)
+        : device_number_(device_number)
+        , valid_(true) {
+        fetch_device_info(handle);
+
+        auto result = device::product_id_from_raw_gpu_id(constants_.gpu_id);
+
+        if (result.first) {
+            valid_ = false;
+        }
+
+        id_ = result.second;
+    }
+
     HWCP_NODISCARD int get_device_number() const { return device_number_; }
 
     HWCP_NODISCARD uint64_t num_shader_cores() const { return constants_.num_shader_cores; }
@@ -92,27 +120,105 @@ class gpu {
     }
 };
 
+namespace detail {
+
+/**
+ * Process-wide cache of the GPU devices enumerated by find_gpus.
+ *
+ * Finding the candidate device numbers only checks that their device node
+ * exists. A candidate is opened and probed the first time its gpu is asked
+ * for, and the gpu is then reused until refresh() is called.
+ */
+class gpu_registry {
+  public:
+    /** Device numbers are searched below this value. */
+    static constexpr int max_device_number = 32;
+
+    /** Checks if a device number is worth probing. */
+    using candidate_function = std::function<bool(int)>;
+    /** Probes a device number. */
+    using probe_function = std::function<gpu(int)>;
+
+    /**
+     * Constructor.
+     *
+     * @param [in] probe         Probes a device number.
+     * @param [in] is_candidate  Checks if a device number is worth probing. When empty,
+     *                           every device number is probed to find the candidates.
+     */
+    explicit gpu_registry(probe_function probe, candidate_function is_candidate = {})
+        : probe_(std::move(probe))
+        , is_candidate_(std::move(is_candidate)) {}
+
+    /** @return The registry of this process. */
+    static gpu_registry &get();
+
+    /**
+     * Find the next candidate device number.
+     *
+     * @param [in] device_number  The first device number to check.
+     * @return The candidate device number, or max_device_number if there is none.
+     */
+    int next_candidate(int device_number);
+
+    /**
+     * Get the gpu of a device number, probing it the first time.
+     *
+     * @param [in] device_number  The device number.
+     * @return The gpu, which is invalid if the device could not be probed.
+     */
+    std::shared_ptr<const gpu> get_gpu(int device_number);
+
+    /** Forget the candidates and the gpus found, so that they are searched and probed again. */
+    void refresh();
+
+  private:
+    struct entry {
+        /** True if the device number was checked. */
+        bool checked;
+        /** True if the device number is a candidate. */
+        bool candidate;
+        /** The gpu, once probed. */
+        std::shared_ptr<const gpu> probed;
+    };
+
+    std::shared_ptr<const gpu> get_gpu_locked(int device_number);
+
+    std::mutex lock_{};
+    probe_function probe_;
+    candidate_function is_candidate_;
+    std::array<entry, max_device_number> entries_{};
+};
+
+} // namespace detail
+
 /**
  * @brief A class which provdides an enumerable view of the GPU devices attached
  * to the system.
  *
+ * The enumeration is lazy: iterating only looks for the device nodes, and a
+ * device is opened and probed when its gpu is dereferenced. The gpus are cached
+ * for the whole process, call refresh() to enumerate the devices again. A device
+ * node that can not be probed yields an invalid gpu.
+ *
  * @par
  * @code
  * for (const auto & gpu : find_gpus()) {
- *     std::cout << "Found device " << gpu.get_device_number() << std::endl;
+ *     if (gpu)
+ *         std::cout << "Found device " << gpu.get_device_number() << std::endl;
  * }
  * @endcode
  */
 class find_gpus {
   private:
     /**
-     * @brief An iterator which probes for GPUs.
+     * @brief An iterator over the candidate device numbers.
      */
     class iterator {
       public:
         using value_type = gpu;
-        using reference = gpu &;
-        using pointer = gpu *;
+        using reference = const gpu &;
+        using pointer = const gpu *;
         using difference_type = ptrdiff_t;
         using iterator_category = std::forward_iterator_tag;
 
@@ -120,23 +226,22 @@ class find_gpus {
          * @brief Default constructor that represents the end of iteration.
          */
         iterator()
-            : device_number_(max_device_number)
-            , gpu_{} {}
+            : device_number_(detail::gpu_registry::max_device_number) {}
 
         /**
-         * @brief Constructs an iterator which starts probing from the specified
+         * @brief Constructs an iterator which starts searching from the specified
          * device number.
          */
-        iterator(int start_from_device)
-            : device_number_(start_from_device) {
-            find_next_device();
-        }
+        iterator(detail::gpu_registry &registry, int start_from_device)
+            : registry_(&registry)
+            , device_number_(registry.next_candidate(start_from_device)) {}
 
-        reference operator*() { return gpu_; }
-        pointer operator->() { return &gpu_; }
+        reference operator*() { return *load(); }
+        pointer operator->() { return load(); }
 
         iterator &operator++() {
-            find_next_device();
+            gpu_.reset();
+            device_number_ = registry_->next_candidate(device_number_ + 1);
             return *this;
         }
 
@@ -155,33 +260,40 @@ class find_gpus {
         }
 
       private:
-        constexpr static int max_device_number = 32;
-
+        detail::gpu_registry *registry_{};
         int device_number_;
-        gpu gpu_;
+        std::shared_ptr<const gpu> gpu_{};
 
-        /**
-         * @brief Scan for the next valid device number by attempting to create
-         * a hwcpipe instance.
-         */
-        void find_next_device() {
-            while (device_number_ < max_device_number) {
-                gpu_ = gpu(device_number_);
-                device_number_++;
-
-                if (gpu_.valid()) {
-                    break;
-                }
+        /** @return The gpu of the current device number, probed on first use. */
+        pointer load() {
+            if (!gpu_) {
+                gpu_ = registry_->get_gpu(device_number_);
             }
+            return gpu_.get();
         }
     };
 
   public:
-    find_gpus() = default;
+    find_gpus()
+        : registry_(&detail::gpu_registry::get()) {}
 
-    auto begin() const { return iterator{0}; }
+    /**
+     * Enumerate the GPUs of a registry.
+     *
+     * @param [in] registry  The registry, which must outlive this object.
+     */
+    explicit find_gpus(detail::gpu_registry &registry)
+        : registry_(&registry) {}
+
+    auto begin() const { return iterator{*registry_, 0}; }
 
     auto end() const { return iterator{}; }
+
+    /** Forget the GPUs found by this process, so that they are enumerated again. */
+    static void refresh() { detail::gpu_registry::get().refresh(); }
+
+  private:
+    detail::gpu_registry *registry_;
 };
 
 } // namespace hwcpipe
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include "hwcpipe/error.hpp"
+#include "hwcpipe/sampler.hpp"
+#include "hwcpipe/types.hpp"
+
+#include <cstdint>
+#include <string>
+#include <system_error>
+
+namespace hwcpipe {
+
+/** Where a gpu_frequency reads the GPU clock, and when. */
+struct gpu_frequency_config {
+    /**
+     * The devfreq directory of the GPU, e.g. "/sys/class/devfreq/13000000.mali",
+     * or empty to look for it with find_gpu_devfreq().
+     */
+    std::string devfreq_path{};
+    /** A file holding the power of the GPU, e.g. of a power monitor, or empty. */
+    std::string power_path{};
+    /** A thermal zone temperature file, e.g. "/sys/class/thermal/thermal_zone3/temp", or empty. */
+    std::string thermal_path{};
+    /** Relative difference between the estimate and devfreq that makes devfreq be read again. */
+    double tolerance{0.05};
+};
+
+/** The GPU frequency of a sample. */
+struct gpu_frequency_reading {
+    /** Start of the sample, in nanoseconds. */
+    uint64_t timestamp_ns_begin;
+    /** End of the sample, in nanoseconds. */
+    uint64_t timestamp_ns_end;
+    /**
+     * The frequency of the sample, in Hz: the estimate if it agrees with
+     * devfreq, otherwise the devfreq frequency.
+     */
+    double frequency_hz;
+    /** The average frequency estimated from the GPU cycles, zero if unavailable. */
+    double estimated_hz;
+    /** The last frequency read from devfreq, in Hz. */
+    uint64_t devfreq_hz;
+    /** True if devfreq was read for this sample. */
+    bool devfreq_read;
+    /** The value of the power file, in its own units, zero if there is none. */
+    int64_t power;
+    /** The value of the thermal file, usually in millidegrees Celsius, zero if there is none. */
+    int64_t temperature;
+};
+
+/**
+ * @brief Finds the devfreq directory of a Mali GPU.
+ *
+ * @param [in] devfreq_dir  The devfreq class directory.
+ * @return The path of the first device whose name mentions "mali" or
+ * "gpu", or an empty string.
+ */
+HWCP_NODISCARD std::string find_gpu_devfreq(const std::string &devfreq_dir = "/sys/class/devfreq");
+
+/**
+ * @brief A gpu_frequency attaches the GPU clock frequency to each sample.
+ *
+ * The frequency is estimated from the GPU cycles of the sample, see
+ * sample_interval::gpu_frequency(), which costs nothing. devfreq's cur_freq
+ * is only read when the estimate is unavailable, i.e. the backend doesn't
+ * report the GPU cycles or the GPU was off for the whole sample, or when it
+ * disagrees with the last devfreq frequency by more than the tolerance, e.g.
+ * after a frequency change. The files are opened once and read with pread(),
+ * so a read is a single syscall. The power and thermal files, if any, are
+ * read for every sample.
+ *
+ * @par
+ * @code
+ * hwcpipe::gpu_frequency frequency(hwcpipe::gpu_frequency_config{});
+ * while (running) {
+ *     if (!sampler.sample_now()) {
+ *         ec = frequency.update(sampler);
+ *         plot(frequency.get_reading().frequency_hz);
+ *     }
+ * }
+ * @endcode
+ */
+class gpu_frequency {
+  public:
+    /**
+     * Opens the files. If cur_freq can't be opened the reader is invalid.
+     *
+     * @param [in] config  The files and the tolerance.
+     */
+    explicit gpu_frequency(const gpu_frequency_config &config);
+
+    ~gpu_frequency();
+
+    gpu_frequency(const gpu_frequency &) = delete;
+    gpu_frequency &operator=(const gpu_frequency &) = delete;
+
+    /** @return True if the frequency can be read. */
+    operator bool() const { return !ec_; }
+
+    /** @return The error that made the reader invalid, if any. */
+    HWCP_NODISCARD std::error_code get_error() const { return ec_; }
+
+    /** @return The reading of the last sample. */
+    HWCP_NODISCARD const gpu_frequency_reading &get_reading() const { return reading_; }
+
+    /** @return The number of times cur_freq was read. */
+    HWCP_NODISCARD uint64_t num_devfreq_reads() const { return num_devfreq_reads_; }
+
+    /**
+     * @brief Computes the frequency of a sample.
+     *
+     * @param [in] interval       The interval of the sample.
+     * @param [in] has_gpu_cycle  True if the backend reports the GPU cycles,
+     *                            see device::hwcnt::features.
+     * @return hwcpipe::errc::frequency_unavailable if a file could not be
+     * read, or if the reader is invalid.
+     */
+    HWCP_NODISCARD std::error_code update(const sample_interval &interval, bool has_gpu_cycle);
+
+    /**
+     * @brief Computes the frequency of the last sample of a sampler.
+     *
+     * @param [in] sampler  The sampler, after a successful sample.
+     * @return The error of update().
+     */
+    template <typename sampler_t>
+    HWCP_NODISCARD std::error_code update(const sampler_t &sampler) {
+        return update(sampler.get_sample_interval(), sampler.get_features().has_gpu_cycle);
+    }
+
+  private:
+    /** Reads the integer of an open file. */
+    HWCP_NODISCARD static bool read_value(int fd, int64_t &value);
+
+    std::error_code ec_;
+    int freq_fd_{-1};
+    int power_fd_{-1};
+    int thermal_fd_{-1};
+    double tolerance_;
+    gpu_frequency_reading reading_{};
+    uint64_t num_devfreq_reads_{};
+};
+
+} // namespace hwcpipe
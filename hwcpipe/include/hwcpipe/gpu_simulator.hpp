@@ -0,0 +1,332 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include "device/constants.hpp"
+#include "hwcpipe/error.hpp"
+#include "hwcpipe/types.hpp"
+
+#include <device/hwcnt/block_extents.hpp>
+#include <device/hwcnt/block_metadata.hpp>
+#include <device/hwcnt/reader.hpp>
+#include <device/hwcnt/sample.hpp>
+#include <device/hwcnt/sampler/configuration.hpp>
+#include <device/product_id.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <system_error>
+#include <vector>
+
+namespace hwcpipe {
+
+/** The GPU simulated by a gpu_simulator, and the samples it produces. */
+struct gpu_simulator_config {
+    /** Raw GPU ID, see device::constants::gpu_id. A Mali-G78 by default. */
+    uint64_t gpu_id{0x92000000};
+    /** Number of shader core blocks. */
+    uint8_t num_shader_cores{4};
+    /** Number of memory system blocks, one per L2 slice. */
+    uint8_t num_l2_slices{2};
+    /** Number of counters of each block. */
+    uint16_t counters_per_block{64};
+    /** True for 64-bit counter values, false for 32-bit ones. */
+    bool values_64bit{false};
+    /** Sampling rate of periodic samplers, also the time span of each sample. */
+    uint64_t sample_rate_hz{1000};
+    /**
+     * If true, periodic samples are only ready at the sampling rate, in real
+     * time. Otherwise every sample is ready at once and the time stamps are
+     * simulated, so the samples are produced as fast as they are read.
+     */
+    bool paced{false};
+    /** Every drop_interval-th sample is lost, as on ring buffer overflow, or zero. */
+    uint32_t drop_interval{0};
+    /** Every stretch_interval-th sample spans two periods and is flagged stretched, or zero. */
+    uint32_t stretch_interval{0};
+    /** Frequency of the GPU and shader core cycle counts of the samples. */
+    uint64_t gpu_frequency_hz{800000000};
+};
+
+/**
+ * @brief A gpu_simulator makes a synthetic GPU available, so that a
+ * hwcpipe::sampler<gpu_simulator_policy> reads kernel-like samples through
+ * the real device::hwcnt::reader interface and device::hwcnt::sample class,
+ * decodes them, evaluates its expressions and feeds its exporters as it
+ * would on the device. It is meant to benchmark how the sampling and export
+ * paths scale with the number of blocks and the sampling rate on machines
+ * without a Mali GPU.
+ *
+ * The simulator is registered under a device number, which samplers select
+ * with their sampler_config, made for the product of get_product_id(). Every
+ * counter of every block counts, with values that depend on the block, the
+ * counter and the length of the sample. Manual samples are ready as soon as
+ * they are requested, periodic ones are paced or produced on demand, see
+ * gpu_simulator_config::paced. The simulator must outlive the samplers
+ * created on it, and a simulator is not thread-safe.
+ *
+ * @par
+ * @code
+ * hwcpipe::gpu_simulator_config sim_config{};
+ * sim_config.num_shader_cores = 16;
+ * sim_config.sample_rate_hz = 10000;
+ * hwcpipe::gpu_simulator simulator(sim_config);
+ * device::product_id pid{};
+ * ec = simulator.get_product_id(pid);
+ * hwcpipe::sampler_config config(pid, simulator.get_device_number());
+ * config.set_sampling_period(simulator.get_period_ns());
+ * ec = config.add_counter(MaliGPUActiveCy);
+ * hwcpipe::sampler<hwcpipe::gpu_simulator_policy> sampler(config);
+ * ec = sampler.start_sampling();
+ * ec = sampler.sample_now();
+ * @endcode
+ */
+class gpu_simulator {
+  public:
+    /**
+     * Registers a simulated GPU. If the device number already has a
+     * simulator, or the configuration has no blocks, the simulator is invalid
+     * and samplers can't be created on it.
+     *
+     * @param [in] config         The simulated GPU.
+     * @param [in] device_number  The device number that samplers select.
+     */
+    explicit gpu_simulator(const gpu_simulator_config &config, int device_number = 0);
+
+    /** Unregisters the GPU. */
+    ~gpu_simulator();
+
+    gpu_simulator(const gpu_simulator &) = delete;
+    gpu_simulator &operator=(const gpu_simulator &) = delete;
+
+    /** @return True if the GPU is registered. */
+    operator bool() const { return !ec_; }
+
+    /**
+     * @return hwcpipe::errc::invalid_device if the device number already had
+     * a simulator or the configuration is invalid, otherwise an empty
+     * error_code.
+     */
+    HWCP_NODISCARD std::error_code get_error() const { return ec_; }
+
+    /** @return The simulated GPU. */
+    HWCP_NODISCARD const gpu_simulator_config &get_config() const { return config_; }
+
+    /** @return The device number of the simulator. */
+    HWCP_NODISCARD int get_device_number() const { return device_number_; }
+
+    /** @return The time span of each sample in nanoseconds, from the sampling rate. */
+    HWCP_NODISCARD uint64_t get_period_ns() const { return period_ns_; }
+
+    /**
+     * @brief Identifies the simulated GPU.
+     *
+     * @param [out] pid  Set to the product of gpu_simulator_config::gpu_id.
+     * @return An error if the simulator is invalid or the GPU ID is not
+     * known, otherwise an empty error_code.
+     */
+    HWCP_NODISCARD std::error_code get_product_id(device::product_id &pid) const;
+
+    /** @return The constants of the simulated GPU. */
+    HWCP_NODISCARD const device::constants &get_constants() const { return constants_; }
+
+    /** @return The block layout of the simulated GPU. */
+    HWCP_NODISCARD const device::hwcnt::block_extents &get_block_extents() const { return block_extents_; }
+
+    /** @return The number of samples produced, including the lost ones. */
+    HWCP_NODISCARD uint64_t num_samples() const { return num_samples_; }
+
+    /**
+     * @brief Produces the next sample: its metadata, and its counter values
+     * into @p values, one block after the other. Lost samples are skipped.
+     *
+     * @param [out] metadata  The sample metadata.
+     * @param [out] values    Receives the values of every block, each
+     *                        padded to whole 64-bit words.
+     * @param [in]  periods   The number of sampling periods the sample
+     *                        spans, more than one if it is stretched.
+     * @param [in]  now_ns    The end of a paced sample, or zero to simulate
+     *                        the time stamps.
+     */
+    void produce(device::hwcnt::sample_metadata &metadata, uint64_t *values, uint64_t periods, uint64_t now_ns);
+
+    /**
+     * @return The simulator registered under @p device_number when it is
+     * valid, otherwise nullptr.
+     */
+    HWCP_NODISCARD static gpu_simulator *find(int device_number);
+
+  private:
+    std::error_code ec_;
+    gpu_simulator_config config_;
+    int device_number_;
+    uint64_t period_ns_{};
+    device::constants constants_{};
+    device::hwcnt::block_extents block_extents_{};
+    uint64_t num_samples_{};
+    uint64_t sample_nr_{};
+    uint64_t timestamp_ns_{};
+};
+
+namespace detail {
+namespace simulator {
+
+/** Backend handle of a gpu_simulator. */
+class handle {
+  public:
+    using handle_ptr = std::unique_ptr<handle>;
+
+    explicit handle(gpu_simulator &simulator)
+        : simulator_(simulator) {}
+
+    /** @return A handle of the simulator of @p device_number, or nullptr. */
+    static handle_ptr create(int device_number) {
+        auto *simulator = gpu_simulator::find(device_number);
+        if (simulator == nullptr) {
+            return nullptr;
+        }
+        return std::make_unique<handle>(*simulator);
+    }
+
+    gpu_simulator &get_simulator() const { return simulator_; }
+
+  private:
+    gpu_simulator &simulator_;
+};
+
+/** Backend instance of a gpu_simulator. */
+class instance {
+  public:
+    using instance_ptr = std::unique_ptr<instance>;
+
+    explicit instance(gpu_simulator &simulator)
+        : simulator_(simulator) {}
+
+    static instance_ptr create(handle &hndl) { return std::make_unique<instance>(hndl.get_simulator()); }
+
+    const device::constants &get_constants() const { return simulator_.get_constants(); }
+
+    const device::hwcnt::block_extents &get_hwcnt_block_extents() const { return simulator_.get_block_extents(); }
+
+    gpu_simulator &get_simulator() const { return simulator_; }
+
+  private:
+    gpu_simulator &simulator_;
+};
+
+/**
+ * Reader of a gpu_simulator, an implementation of the device reader
+ * interface. Its file descriptor is an eventfd that counts the requested
+ * samples, or a timerfd that expires at the sampling rate for paced
+ * periodic samplers, so that it can be polled like the kernel's. It owns the
+ * block values, so that taking a sample doesn't allocate.
+ */
+class reader : public device::hwcnt::reader {
+  public:
+    /**
+     * @param [in] simulator     The simulated GPU.
+     * @param [in] periodic      True for a periodic sampler.
+     * @param [in] buffer_count  Reported ring buffer size, zero for a default.
+     */
+    reader(gpu_simulator &simulator, bool periodic, uint32_t buffer_count);
+
+    ~reader() override;
+
+    reader(const reader &) = delete;
+    reader &operator=(const reader &) = delete;
+
+    /** @return True if the file descriptor was created. */
+    bool valid() const { return fd_ >= 0; }
+
+    /** Makes one manual sample ready. */
+    std::error_code request(uint64_t user_data);
+
+    /** Starts producing periodic samples. */
+    std::error_code start();
+
+    /** Stops producing periodic samples, and discards the ready ones. */
+    std::error_code stop();
+
+    std::error_code get_sample(device::hwcnt::sample_metadata &sm, device::hwcnt::sample_handle &sample_hndl) override;
+
+    bool next(device::hwcnt::sample_handle sample_hndl, device::hwcnt::block_metadata &bm,
+              device::hwcnt::block_handle &block_hndl) const override;
+
+    size_t get_blocks(device::hwcnt::sample_handle sample_hndl, device::hwcnt::block_metadata *blocks,
+                      size_t capacity) const override;
+
+    std::error_code put_sample(device::hwcnt::sample_handle sample_hndl) override;
+
+    std::error_code discard() override;
+
+  private:
+    gpu_simulator &simulator_;
+    std::vector<uint64_t> values_{};
+    std::vector<device::hwcnt::block_metadata> blocks_{};
+    bool periodic_;
+    bool paced_;
+    uint64_t user_data_{};
+    bool running_{};
+    bool taken_{};
+};
+
+/** Backend manual sampler of a gpu_simulator. */
+class manual_sampler {
+  public:
+    manual_sampler(const instance &inst, const device::hwcnt::sampler::configuration *, size_t,
+                   uint32_t buffer_count = 0)
+        : reader_(inst.get_simulator(), false, buffer_count) {}
+
+    operator bool() const { return reader_.valid(); }
+
+    std::error_code accumulation_start() { return {}; }
+
+    std::error_code accumulation_stop(uint64_t) { return reader_.discard(); }
+
+    std::error_code request_sample(uint64_t user_data) { return reader_.request(user_data); }
+
+    std::error_code request_sample_async(uint64_t user_data) { return request_sample(user_data); }
+
+    reader &get_reader() { return reader_; }
+
+  private:
+    reader reader_;
+};
+
+/** Backend periodic sampler of a gpu_simulator. The sampling rate of the simulator is used. */
+class periodic_sampler {
+  public:
+    periodic_sampler(const instance &inst, uint64_t, const device::hwcnt::sampler::configuration *, size_t,
+                     uint32_t buffer_count = 0)
+        : reader_(inst.get_simulator(), true, buffer_count) {}
+
+    operator bool() const { return reader_.valid(); }
+
+    std::error_code sampling_start(uint64_t) { return reader_.start(); }
+
+    std::error_code sampling_stop(uint64_t) { return reader_.stop(); }
+
+    reader &get_reader() { return reader_; }
+
+  private:
+    reader reader_;
+};
+
+} // namespace simulator
+} // namespace detail
+
+/** The backend policy of a hwcpipe::sampler that samples a gpu_simulator. */
+struct gpu_simulator_policy {
+    using handle_type = detail::simulator::handle;
+    using instance_type = detail::simulator::instance;
+    using sampler_type = detail::simulator::manual_sampler;
+    using periodic_sampler_type = detail::simulator::periodic_sampler;
+    using sample_type = device::hwcnt::sample;
+};
+
+} // namespace hwcpipe
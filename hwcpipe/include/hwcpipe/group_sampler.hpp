@@ -0,0 +1,259 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include "hwcpipe/detail/internal_types.hpp"
+#include "hwcpipe/error.hpp"
+#include "hwcpipe/sampler.hpp"
+#include "hwcpipe/types.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <system_error>
+#include <vector>
+
+namespace hwcpipe {
+
+/**
+ * @brief The timestamps of one device in a group_record.
+ */
+struct group_device_timestamps {
+    /** The device number of the GPU. */
+    int device_number;
+    /** Start of the counter accumulation of the device's sample, in nanoseconds. */
+    uint64_t timestamp_ns_begin;
+    /** End of the counter accumulation of the device's sample, in nanoseconds. */
+    uint64_t timestamp_ns_end;
+};
+
+/**
+ * @brief One combined sample of every device of a group.
+ */
+struct group_record {
+    /** The timestamps of each device, in the order the devices were added. */
+    std::vector<group_device_timestamps> devices;
+    /** The largest difference between the end timestamps of two devices, in nanoseconds. */
+    uint64_t skew_ns;
+};
+
+/**
+ * @brief A basic_group_sampler samples several GPUs as close together as
+ * possible. On each sample_now_for() the manual samples of all the devices are
+ * requested back to back, without waiting for any of them, and then collected
+ * with a shared deadline. The result is a group_record with the begin and end
+ * timestamps of every device, so cross-device analysis doesn't need to
+ * resample the values.
+ *
+ * The devices are added before sampling starts. The group owns their
+ * samplers, which are read as usual once a sample was taken. The samplers
+ * should be manual, i.e. their configuration has no sampling period: calling
+ * sample_now_for() from one periodic tick of the application then samples all
+ * the devices on that tick. Periodic samplers run on their own kernel timers,
+ * which can't be aligned.
+ *
+ * @par
+ * @code
+ * hwcpipe::group_sampler group;
+ * std::error_code ec;
+ * for (const auto &gpu : hwcpipe::find_gpus()) {
+ *     hwcpipe::sampler_config config(gpu);
+ *     ec = config.add_counter(MaliGPUActiveCy);
+ *     group.add_device(config, ec);
+ * }
+ * ec = group.start_sampling();
+ * while (running) {
+ *     if (!group.sample_now_for(10000000)) {
+ *         consume(group.get_record(), group.get_sampler(0), group.get_sampler(1));
+ *     }
+ * }
+ * @endcode
+ */
+template <typename backend_policy_t = detail::hwcpipe_backend_policy>
+class basic_group_sampler {
+  public:
+    /** The type of the samplers of the devices. */
+    using sampler_type = sampler<backend_policy_t>;
+
+    /**
+     * @brief Adds a device to the group.
+     *
+     * @param [in]  config  The counters to sample on the device.
+     * @param [out] ec      Set to hwcpipe::errc::sampling_already_started if
+     *                      the group was started,
+     *                      hwcpipe::errc::invalid_device if the device is
+     *                      already in the group, or the error of the sampler
+     *                      creation.
+     * @return The sampler of the device, or nullptr on error.
+     */
+    HWCP_NODISCARD sampler_type *add_device(const sampler_config &config, std::error_code &ec) {
+        ec = {};
+        if (sampling_in_progress_) {
+            ec = make_error_code(errc::sampling_already_started);
+            return nullptr;
+        }
+        const auto found = std::find_if(record_.devices.begin(), record_.devices.end(),
+                                        [&config](const group_device_timestamps &device) {
+                                            return device.device_number == config.get_device_number();
+                                        });
+        if (found != record_.devices.end()) {
+            ec = make_error_code(errc::invalid_device);
+            return nullptr;
+        }
+
+        auto sampler = std::make_unique<sampler_type>(config);
+        if (!*sampler) {
+            // the sampler reports its construction error from start_sampling()
+            ec = sampler->start_sampling();
+            return nullptr;
+        }
+
+        samplers_.push_back(std::move(sampler));
+        pending_.push_back(false);
+        record_.devices.push_back({config.get_device_number(), 0, 0});
+        return samplers_.back().get();
+    }
+
+    /** @return The number of devices. */
+    HWCP_NODISCARD size_t num_devices() const { return samplers_.size(); }
+
+    /** @return The sampler of device @p index, in the order the devices were added. */
+    HWCP_NODISCARD const sampler_type &get_sampler(size_t index) const { return *samplers_[index]; }
+
+    /**
+     * @brief Starts sampling on every device. If a device fails to start, the
+     * devices that were started are stopped.
+     *
+     * @return hwcpipe::errc::sampler_config_invalid if no device was added,
+     * otherwise the error of sampler::start_sampling().
+     */
+    HWCP_NODISCARD std::error_code start_sampling() {
+        if (samplers_.empty()) {
+            return make_error_code(errc::sampler_config_invalid);
+        }
+        for (size_t i = 0; i != samplers_.size(); ++i) {
+            auto ec = samplers_[i]->start_sampling();
+            if (ec) {
+                // the start error is the one reported
+                while (i-- != 0) {
+                    const auto stop_ec = samplers_[i]->stop_sampling();
+                    static_cast<void>(stop_ec);
+                }
+                return ec;
+            }
+        }
+        std::fill(pending_.begin(), pending_.end(), false);
+        sampling_in_progress_ = true;
+        return {};
+    }
+
+    /**
+     * @brief Stops sampling on every device.
+     *
+     * @return The first error of sampler::stop_sampling(), otherwise an empty
+     * error_code.
+     */
+    HWCP_NODISCARD std::error_code stop_sampling() {
+        if (!sampling_in_progress_) {
+            return make_error_code(errc::sampling_not_started);
+        }
+        std::error_code result;
+        for (auto &sampler : samplers_) {
+            auto ec = sampler->stop_sampling();
+            if (ec && !result) {
+                result = ec;
+            }
+        }
+        sampling_in_progress_ = false;
+        return result;
+    }
+
+    /**
+     * @brief Requests a sample on every device back to back, then collects
+     * them with a shared deadline.
+     *
+     * A device whose sample is not ready by the deadline keeps its request
+     * pending. The next call collects that late sample instead of requesting
+     * a new one, so its timestamps tell how late it was.
+     *
+     * @param [in] timeout_ns  Time to wait for all the samples in
+     *                         nanoseconds.
+     * @return hwcpipe::errc::sample_not_ready if a device timed out, or the
+     * first error of the devices. The record and the samplers are only
+     * consistent if no error is returned.
+     */
+    HWCP_NODISCARD std::error_code sample_now_for(uint64_t timeout_ns) {
+        if (!sampling_in_progress_) {
+            return make_error_code(errc::sampling_not_started);
+        }
+
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::nanoseconds(timeout_ns);
+
+        for (size_t i = 0; i != samplers_.size(); ++i) {
+            if (!pending_[i]) {
+                auto ec = samplers_[i]->request_sample_async();
+                if (ec) {
+                    return ec;
+                }
+                pending_[i] = true;
+            }
+        }
+
+        std::error_code result;
+        for (size_t i = 0; i != samplers_.size(); ++i) {
+            const auto now = std::chrono::steady_clock::now();
+            const auto timeout =
+                deadline > now ? std::chrono::duration_cast<std::chrono::nanoseconds>(deadline - now).count() : 0;
+
+            auto ec = samplers_[i]->collect_for(static_cast<uint64_t>(timeout));
+            if (ec == make_error_code(errc::sample_not_ready)) {
+                if (!result) {
+                    result = ec;
+                }
+                continue;
+            }
+
+            pending_[i] = false;
+            if (ec) {
+                if (!result) {
+                    result = ec;
+                }
+                continue;
+            }
+
+            record_.devices[i].timestamp_ns_begin = samplers_[i]->get_sample_timestamp();
+            record_.devices[i].timestamp_ns_end = samplers_[i]->get_sample_timestamp_end();
+        }
+
+        const auto bounds = std::minmax_element(record_.devices.begin(), record_.devices.end(),
+                                                [](const group_device_timestamps &lhs,
+                                                   const group_device_timestamps &rhs) {
+                                                    return lhs.timestamp_ns_end < rhs.timestamp_ns_end;
+                                                });
+        record_.skew_ns = bounds.second->timestamp_ns_end - bounds.first->timestamp_ns_end;
+        return result;
+    }
+
+    /** @return The record of the last sample. */
+    HWCP_NODISCARD const group_record &get_record() const { return record_; }
+
+  private:
+    std::vector<std::unique_ptr<sampler_type>> samplers_{};
+    // a request of the device that was not collected yet
+    std::vector<bool> pending_{};
+    group_record record_{};
+    bool sampling_in_progress_{};
+};
+
+/**
+ * @brief A group sampler for the default hwcpipe backend.
+ */
+using group_sampler = basic_group_sampler<>;
+
+} // namespace hwcpipe
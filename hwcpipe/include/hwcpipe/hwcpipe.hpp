@@ -1,10 +1,47 @@
 /*
- * Copyright (c) 2023 Arm Limited.
+ * Copyright (c) 2023-2025 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  */
 
 #pragma once
 
+#include <hwcpipe/adaptive_period.hpp>
+#include <hwcpipe/arrow_exporter.hpp>
+#include <hwcpipe/async_sampler.hpp>
+#include <hwcpipe/atrace_sink.hpp>
+#include <hwcpipe/bottleneck_classifier.hpp>
+#include <hwcpipe/clock_correlator.hpp>
+#include <hwcpipe/column_evaluator.hpp>
+#include <hwcpipe/combined_sampler.hpp>
+#include <hwcpipe/counter_planner.hpp>
+#include <hwcpipe/counter_preset.hpp>
+#include <hwcpipe/counter_smoother.hpp>
+#include <hwcpipe/counter_statistics.hpp>
+#include <hwcpipe/cpu_counters.hpp>
+#include <hwcpipe/flight_recorder.hpp>
 #include <hwcpipe/gpu.hpp>
+#include <hwcpipe/gpu_frequency.hpp>
+#include <hwcpipe/gpu_simulator.hpp>
+#include <hwcpipe/metrics_endpoint.hpp>
+#include <hwcpipe/network_sink.hpp>
+#include <hwcpipe/on_demand_session.hpp>
+#include <hwcpipe/parallel_evaluator.hpp>
+#include <hwcpipe/perfetto_writer.hpp>
+#include <hwcpipe/region_profiler.hpp>
+#include <hwcpipe/group_sampler.hpp>
+#include <hwcpipe/sample_daemon.hpp>
+#include <hwcpipe/sample_history.hpp>
+#include <hwcpipe/sample_pipeline.hpp>
+#include <hwcpipe/sample_ring.hpp>
+#include <hwcpipe/sample_stream.hpp>
 #include <hwcpipe/sampler.hpp>
+#include <hwcpipe/shared_sample_segment.hpp>
+#include <hwcpipe/shared_session.hpp>
+#include <hwcpipe/snapshot_buffer.hpp>
+#include <hwcpipe/static_sampler.hpp>
+#include <hwcpipe/submit_sampler.hpp>
+#include <hwcpipe/timeline_summary.hpp>
+#include <hwcpipe/trace_ingest.hpp>
+#include <hwcpipe/trace_recorder.hpp>
+#include <hwcpipe/triggered_capture.hpp>
@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/**
+ * @file
+ *
+ * A C interface to the sampler, for foreign function interfaces (Rust, C#,
+ * Python ctypes...). A sampler is configured with an array of counters, and
+ * each sample is taken and read in a single call, so a binding crosses the
+ * language boundary once per sample rather than once per counter.
+ *
+ * The functions return HWCPIPE_SAMPLER_SUCCESS, which is zero, on success,
+ * and another hwcpipe_sampler_status value otherwise. The message of the
+ * last error of a sampler, with its details, is returned by
+ * hwcpipe_sampler_error_message(). A sampler is not thread-safe.
+ *
+ * hwcpipe_sampler_create_simulated() samples a simulated GPU instead, so that
+ * a binding can be tested on a machine without a Mali GPU.
+ *
+ * @par
+ * @code
+ * const hwcpipe_counter counters[] = {MaliGPUActiveCy, MaliFragActiveCy};
+ * double values[2];
+ * hwcpipe_sampler *sampler = hwcpipe_sampler_create(0);
+ * if (hwcpipe_sampler_add_counters(sampler, counters, 2) || hwcpipe_sampler_start(sampler, 0)) {
+ *     fprintf(stderr, "%s\n", hwcpipe_sampler_error_message(sampler));
+ * }
+ * while (running) {
+ *     if (!hwcpipe_sampler_sample(sampler, 0, values, 2, NULL)) {
+ *         // ... use the values ...
+ *     }
+ * }
+ * hwcpipe_sampler_destroy(sampler);
+ * @endcode
+ */
+
+#ifndef HWCPIPE_SAMPLER_H
+#define HWCPIPE_SAMPLER_H
+
+#include "hwcpipe/hwcpipe_counter.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+/** Export a symbol of the C interface. */
+#define HWCPIPE_C_API __attribute__((visibility("default")))
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// NOLINTBEGIN(modernize-use-using)
+
+/** An opaque sampler of one GPU. */
+typedef struct hwcpipe_sampler hwcpipe_sampler;
+
+/** The values returned by the functions of a sampler. */
+typedef enum hwcpipe_sampler_status {
+    /** The call succeeded. */
+    HWCPIPE_SAMPLER_SUCCESS = 0,
+    /** The GPU wasn't found, or isn't supported. */
+    HWCPIPE_SAMPLER_ERROR_DEVICE = 1,
+    /** A counter is unknown, or the GPU doesn't have it. */
+    HWCPIPE_SAMPLER_ERROR_COUNTER = 2,
+    /** The counters and the period can't be sampled together. */
+    HWCPIPE_SAMPLER_ERROR_CONFIG = 3,
+    /** The sampling is already started. */
+    HWCPIPE_SAMPLER_ERROR_STARTED = 4,
+    /** The sampling isn't started. */
+    HWCPIPE_SAMPLER_ERROR_NOT_STARTED = 5,
+    /** The values array is smaller than hwcpipe_sampler_num_counters(). */
+    HWCPIPE_SAMPLER_ERROR_BUFFER = 6,
+    /** The sample couldn't be taken or read, or no sample was taken yet. */
+    HWCPIPE_SAMPLER_ERROR_SAMPLE = 7,
+    /** A system call failed, or memory couldn't be allocated. */
+    HWCPIPE_SAMPLER_ERROR_SYSTEM = 8,
+    /** Any other error. */
+    HWCPIPE_SAMPLER_ERROR_OTHER = 9
+} hwcpipe_sampler_status;
+
+/** The interval and user data of a sample, see hwcpipe::sample_interval. */
+typedef struct hwcpipe_sample_info {
+    /** Start of the sample, in nanoseconds. */
+    uint64_t timestamp_ns_begin;
+    /** End of the sample, in nanoseconds. */
+    uint64_t timestamp_ns_end;
+    /** GPU cycles counted during the sample, or zero if unknown. */
+    uint64_t gpu_cycles;
+    /** Shader core cycles counted during the sample, or zero if unknown. */
+    uint64_t sc_cycles;
+    /** The user data given when the sample was requested. */
+    uint64_t user_data;
+} hwcpipe_sample_info;
+
+/**
+ * @brief Creates a sampler of a GPU. The device is opened when the sampling
+ * starts.
+ *
+ * @param [in] device_number  The device number, e.g. 0 for /dev/mali0.
+ * @return The sampler, or NULL if it couldn't be allocated. If the GPU wasn't
+ * found, the sampler is returned and its functions fail.
+ */
+HWCPIPE_C_API hwcpipe_sampler *hwcpipe_sampler_create(int device_number);
+
+/**
+ * @brief Creates a sampler of a simulated Mali-G78, see
+ * hwcpipe::gpu_simulator. Its manual samples are ready at once, and every
+ * counter counts. The simulated GPU is owned by the sampler.
+ *
+ * @param [in] num_shader_cores  The number of shader cores, 1 to 255.
+ * @return The sampler, or NULL if it couldn't be allocated. If the GPU can't
+ * be simulated, the sampler is returned and its functions fail.
+ */
+HWCPIPE_C_API hwcpipe_sampler *hwcpipe_sampler_create_simulated(uint32_t num_shader_cores);
+
+/**
+ * @brief Stops the sampling, if started, and destroys a sampler.
+ *
+ * @param [in] sampler  The sampler, or NULL.
+ */
+HWCPIPE_C_API void hwcpipe_sampler_destroy(hwcpipe_sampler *sampler);
+
+/**
+ * @brief Adds counters to the sampler. Their values are read in the order
+ * they were added. Counters can't be added while sampling.
+ *
+ * @param [in] sampler   The sampler.
+ * @param [in] counters  The counters to add.
+ * @param [in] count     Number of counters.
+ * @return Zero, or a hwcpipe_sampler_status if a counter isn't supported by
+ * the GPU, in which case none of the counters are added.
+ */
+HWCPIPE_C_API int hwcpipe_sampler_add_counters(hwcpipe_sampler *sampler, const hwcpipe_counter *counters,
+                                               size_t count);
+
+/**
+ * @brief Selects periodic sampling with a non-zero period, or manual
+ * sampling, which is the default. Applies from the next start.
+ *
+ * @param [in] sampler    The sampler.
+ * @param [in] period_ns  The sampling period in nanoseconds.
+ * @return Zero.
+ */
+HWCPIPE_C_API int hwcpipe_sampler_set_period(hwcpipe_sampler *sampler, uint64_t period_ns);
+
+/** @return The number of counters added to the sampler. */
+HWCPIPE_C_API size_t hwcpipe_sampler_num_counters(const hwcpipe_sampler *sampler);
+
+/**
+ * @brief Starts sampling. The device session is set up on the first start
+ * after the counters changed.
+ *
+ * @param [in] sampler    The sampler.
+ * @param [in] user_data  The user data of the first sample.
+ * @return Zero, or a hwcpipe_sampler_status.
+ */
+HWCPIPE_C_API int hwcpipe_sampler_start(hwcpipe_sampler *sampler, uint64_t user_data);
+
+/**
+ * @brief Stops sampling.
+ *
+ * @param [in] sampler    The sampler.
+ * @param [in] user_data  The user data of the last sample.
+ * @return Zero, or a hwcpipe_sampler_status.
+ */
+HWCPIPE_C_API int hwcpipe_sampler_stop(hwcpipe_sampler *sampler, uint64_t user_data);
+
+/**
+ * @brief Takes a sample, see hwcpipe::sampler::sample_now(), and reads the
+ * values of every counter.
+ *
+ * @param [in]  sampler    The sampler, started.
+ * @param [in]  user_data  The user data of the sample.
+ * @param [out] values     Receives the value of each counter, in the order
+ *                         they were added.
+ * @param [in]  count      Size of @p values, hwcpipe_sampler_num_counters().
+ * @param [out] info       Receives the interval of the sample, or NULL.
+ * @return Zero, or a hwcpipe_sampler_status.
+ */
+HWCPIPE_C_API int hwcpipe_sampler_sample(hwcpipe_sampler *sampler, uint64_t user_data, double *values, size_t count,
+                                         hwcpipe_sample_info *info);
+
+/**
+ * @brief Reads the values of the last sample again.
+ *
+ * @param [in]  sampler  The sampler, after a successful sample.
+ * @param [out] values   Receives the value of each counter.
+ * @param [in]  count    Size of @p values, hwcpipe_sampler_num_counters().
+ * @param [out] info     Receives the interval of the sample, or NULL.
+ * @return Zero, or a hwcpipe_sampler_status.
+ */
+HWCPIPE_C_API int hwcpipe_sampler_read(hwcpipe_sampler *sampler, double *values, size_t count,
+                                       hwcpipe_sample_info *info);
+
+/**
+ * @return The message of the last error of the sampler, or an empty string.
+ * It is valid until the next call on the sampler.
+ */
+HWCPIPE_C_API const char *hwcpipe_sampler_error_message(hwcpipe_sampler *sampler);
+
+// NOLINTEND(modernize-use-using)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HWCPIPE_SAMPLER_H */
@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <cstddef>
+
+namespace hwcpipe {
+
+/**
+ * @brief The memory held by a hwcpipe::sampler, in bytes, as returned by
+ * sampler::get_memory_footprint(). Heap allocations are counted by their
+ * capacity, so the numbers include the headroom of the vectors.
+ *
+ * The read-only tables of the counter database are shared by all the
+ * samplers, and are reported by detail::counter_database::get_memory_footprint().
+ * The sampler_config reports its own, see sampler_config::get_memory_footprint().
+ */
+struct sampler_memory_footprint {
+    /** The sampler object itself. */
+    size_t object;
+    /**
+     * The buffers that samples are decoded to: the sample buffer, the buffers
+     * of merged samples, per instance values, raw block counters and derived
+     * counter values.
+     */
+    size_t sample_buffers;
+    /**
+     * The tables that map counters to their place in the buffers: the counter
+     * lookup table, the gather plan and the expression plans.
+     */
+    size_t index_maps;
+    /**
+     * The kernel ring buffer mapped into the process, see
+     * device::hwcnt::features::mapped_size. Zero if the backend doesn't
+     * report it.
+     */
+    size_t kernel_mapping;
+
+    /** @return The sum of the parts. */
+    size_t total() const { return object + sample_buffers + index_maps + kernel_mapping; }
+};
+
+} // namespace hwcpipe
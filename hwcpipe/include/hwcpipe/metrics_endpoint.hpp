@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include "hwcpipe/detail/heap_bytes.hpp"
+#include "hwcpipe/error.hpp"
+#include "hwcpipe/hwcpipe_counter.h"
+#include "hwcpipe/types.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <system_error>
+#include <vector>
+
+namespace hwcpipe {
+
+/** The metrics exposed by a metrics_endpoint. */
+struct metrics_endpoint_config {
+    /** Prepended to the metric names, which are the counter names in snake case. */
+    const char *metric_prefix{"hwcpipe_"};
+    /**
+     * Labels of every metric, without the braces, e.g. `gpu="0"`, or an
+     * empty string for none.
+     */
+    const char *labels{""};
+    /**
+     * Indices of the values that are exposed, or nullptr to expose every
+     * value. The array is copied.
+     */
+    const size_t *columns{};
+    /** Number of indices in columns. */
+    size_t num_columns{};
+    /** Longest wait for the request of a client of accept_and_serve() in milliseconds, or zero to wait forever. */
+    uint32_t receive_timeout_ms{1000};
+};
+
+/** The scrapes served by a metrics_endpoint. */
+struct metrics_endpoint_stats {
+    /** Samples pushed. */
+    uint64_t samples;
+    /** Scrapes answered with the metrics. */
+    uint64_t scrapes;
+    /** Requests rejected, or whose response couldn't be sent. */
+    uint64_t failed;
+    /** Bytes sent, including the HTTP headers. */
+    uint64_t bytes;
+};
+
+/**
+ * @brief A metrics_endpoint exposes the latest counter values over HTTP in
+ * the Prometheus text format, one gauge per counter, for a scraper such as
+ * Prometheus to pull.
+ *
+ * The whole response, HTTP header, HELP and TYPE lines included, is
+ * rendered once at construction, with a fixed-width slot for each value,
+ * so that its size and the Content-Length header never change. A push only
+ * copies the values of the sample, under a lock. A scrape copies the latest
+ * values, patches the slots whose value changed in place, and sends the
+ * response with a single send(), without formatting any metadata.
+ *
+ * The sampling thread pushes the samples and another thread serves the
+ * scrapes, either with accept_and_serve() on a listening socket of
+ * open_listener(), or with serve() on connections the application accepted
+ * itself. Only one thread serves at a time. The endpoint owns no socket.
+ *
+ * @par
+ * @code
+ * std::error_code ec;
+ * const int listen_fd = hwcpipe::metrics_endpoint::open_listener(9100, ec);
+ * hwcpipe::metrics_endpoint endpoint(counters, num_counters, hwcpipe::metrics_endpoint_config{});
+ * std::thread server([&] {
+ *     while (running) {
+ *         ec = endpoint.accept_and_serve(listen_fd);
+ *     }
+ * });
+ * while (running) {
+ *     if (!sampler.sample_now()) {
+ *         ec = endpoint.push(sampler, list);
+ *     }
+ * }
+ * @endcode
+ */
+class metrics_endpoint {
+  public:
+    /**
+     * @brief Constructs an endpoint. Counters without metadata are named by
+     * their number. Until the first push, every value is NaN.
+     *
+     * A counter listed twice is exposed once. Counters whose names give the
+     * same metric name are exposed as one metric family, each with a
+     * `counter="<number>"` label.
+     *
+     * @param [in] counters      The counters of the values of each sample.
+     * @param [in] num_counters  Number of values of each sample.
+     * @param [in] config        The metrics exposed.
+     */
+    metrics_endpoint(const hwcpipe_counter *counters, size_t num_counters, const metrics_endpoint_config &config);
+
+    metrics_endpoint(const metrics_endpoint &) = delete;
+    metrics_endpoint &operator=(const metrics_endpoint &) = delete;
+
+    /**
+     * @brief Opens a TCP socket listening on an IPv4 address.
+     *
+     * The endpoint has no authentication, so it only listens on the loopback
+     * interface by default. Pass "0.0.0.0" to let other hosts scrape it.
+     *
+     * @param [in]  port     The port, e.g. 9100.
+     * @param [out] ec       Set to hwcpipe::errc::metrics_listen_failed if the
+     *                       address is invalid, or the socket couldn't be
+     *                       bound or listened on.
+     * @param [in]  address  The IPv4 address bound, in dotted decimal.
+     * @return The file descriptor, or -1.
+     */
+    HWCP_NODISCARD static int open_listener(uint16_t port, std::error_code &ec, const char *address = "127.0.0.1");
+
+    /** @return The number of values of each sample. */
+    HWCP_NODISCARD size_t values_per_sample() const { return staging_.size(); }
+
+    /** @return The number of metrics exposed. */
+    HWCP_NODISCARD size_t num_columns() const { return columns_.size(); }
+
+    /** @return The size of every response to a scrape in bytes, headers included. */
+    HWCP_NODISCARD size_t response_size() const { return response_.size(); }
+
+    /** @return The memory held by the endpoint in bytes, including the rendered response. */
+    HWCP_NODISCARD size_t get_memory_footprint() const {
+        return sizeof(*this) + detail::heap_bytes(columns_) + detail::heap_bytes(slots_) +
+               detail::heap_bytes(response_) + detail::heap_bytes(latest_) + detail::heap_bytes(exposed_) +
+               detail::heap_bytes(scrape_values_) + detail::heap_bytes(staging_) + detail::heap_bytes(request_);
+    }
+
+    /** @return The samples and scrapes so far. */
+    HWCP_NODISCARD metrics_endpoint_stats get_stats() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return stats_;
+    }
+
+    /**
+     * @brief Makes a sample the latest one.
+     *
+     * @param [in] values  values_per_sample() counter values.
+     */
+    template <typename value_t>
+    void push(const value_t *values) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (size_t i = 0; i != columns_.size(); ++i) {
+            latest_[i] = static_cast<double>(values[columns_[i]]);
+        }
+        ++stats_.samples;
+    }
+
+    /**
+     * @brief Makes the last sample of a sampler the latest one.
+     *
+     * @param [in] sampler  The sampler, after a successful sample.
+     * @param [in] list     A read list of the sampler with
+     *                      values_per_sample() counters.
+     * @return The error of sampler::get_counter_values().
+     */
+    template <typename sampler_t, typename read_list_t>
+    HWCP_NODISCARD std::error_code push(const sampler_t &sampler, const read_list_t &list) {
+        auto ec = sampler.get_counter_values(list, staging_.data(), staging_.size());
+        if (!ec) {
+            push(staging_.data());
+        }
+        return ec;
+    }
+
+    /**
+     * @brief Answers the HTTP request of a connected client with the latest
+     * values, or with 405 Method Not Allowed if it isn't a GET. The path
+     * isn't checked. The connection is left open.
+     *
+     * @param [in] client_fd  The connected stream socket.
+     * @return hwcpipe::errc::network_send_failed if the request couldn't be
+     * read or the response couldn't be sent.
+     */
+    HWCP_NODISCARD std::error_code serve(int client_fd);
+
+    /**
+     * @brief Accepts a connection, serves its request and closes it.
+     *
+     * @param [in] listen_fd  A listening socket, e.g. of open_listener().
+     * @return hwcpipe::errc::metrics_accept_failed if no connection could be
+     * accepted, otherwise the error of serve().
+     */
+    HWCP_NODISCARD std::error_code accept_and_serve(int listen_fd);
+
+  private:
+    /** Copies the latest values and patches the slots of those that changed. */
+    void update_response();
+
+    /** Sends @p size bytes, retrying partial sends. */
+    HWCP_NODISCARD std::error_code send(int client_fd, const char *data, size_t size);
+
+    const uint32_t receive_timeout_ms_;
+    // the index of the value of each metric
+    std::vector<size_t> columns_{};
+    // the offset of the value slot of each metric in response_
+    std::vector<size_t> slots_{};
+    // the HTTP response, patched in place by the serving thread
+    std::vector<char> response_{};
+    // the latest values, written by push() under mutex_
+    std::vector<double> latest_;
+    // the values in response_, and their copy taken at each scrape
+    std::vector<double> exposed_;
+    std::vector<double> scrape_values_;
+    std::vector<double> staging_;
+    std::vector<char> request_;
+    mutable std::mutex mutex_{};
+    metrics_endpoint_stats stats_{};
+};
+
+} // namespace hwcpipe
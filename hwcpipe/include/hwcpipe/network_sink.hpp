@@ -0,0 +1,303 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include "hwcpipe/detail/heap_bytes.hpp"
+#include "hwcpipe/error.hpp"
+#include "hwcpipe/hwcpipe_counter.h"
+#include "hwcpipe/types.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <system_error>
+#include <vector>
+
+#include <sys/uio.h>
+
+namespace hwcpipe {
+
+/**
+ * The frames sent by a network_sink on a stream socket. Each frame is a
+ * frame_header followed by payload_size bytes:
+ *
+ *  - the first frame is a frame_schema, whose payload is the hwcpipe_counter
+ *    of each of the num_columns counter columns, as uint32_t,
+ *  - the following ones are frame_samples, whose payload holds the
+ *    timestamp_ns_begin and timestamp_ns_end columns, then the counter
+ *    columns, each a detail::column_codec column of num_records values,
+ *  - or, when only changes are sent, frame_changes between the
+ *    frame_samples keyframes. The payload holds the two timestamp columns,
+ *    then a presence bitmap of (num_columns + 7) / 8 bytes per sample, in
+ *    which bit i % 8 of byte i / 8 is set if counter column i changed. Then
+ *    follows, for each counter column with any bit set, a column_codec
+ *    column of the changed values only. A value whose bit is clear is that
+ *    of the previous sample. A receiver that joins late drops frames until
+ *    the next keyframe.
+ *
+ * All fields are little endian.
+ */
+namespace stream_protocol {
+
+/** 'HWCS' in little endian. */
+constexpr uint32_t magic = 0x53435748;
+
+/** The frame lists the counters of the columns. */
+constexpr uint16_t frame_schema = 0;
+/** The frame holds delta encoded samples. */
+constexpr uint16_t frame_samples = 1;
+/** The frame holds the values that changed since the previous sample. */
+constexpr uint16_t frame_changes = 2;
+
+/** The header of a frame. */
+struct frame_header {
+    uint32_t magic;
+    /** frame_schema or frame_samples. */
+    uint16_t kind;
+    /** Number of counter columns. */
+    uint16_t num_columns;
+    /** Number of samples of a frame_samples frame. */
+    uint32_t num_records;
+    /** Size of the payload in bytes. */
+    uint32_t payload_size;
+};
+
+static_assert(sizeof(frame_header) == 16, "The frame header layout is part of the stream protocol.");
+
+} // namespace stream_protocol
+
+/** When a network_sink sends its samples, and which ones. */
+struct network_sink_config {
+    /** Largest number of samples of a frame. */
+    size_t batch_size{64};
+    /**
+     * Longest time span of the samples of a frame, in nanoseconds of sample
+     * time, or zero to only send full frames.
+     */
+    uint64_t flush_interval_ns{100000000};
+    /**
+     * Indices of the values that are sent, or nullptr to send every value.
+     * The array is copied.
+     */
+    const size_t *columns{};
+    /** Number of indices in columns. */
+    size_t num_columns{};
+    /**
+     * Send only the values that changed, in stream_protocol::frame_changes
+     * frames between keyframes.
+     */
+    bool changes_only{};
+    /**
+     * Every keyframe_interval-th frame sends every value, so that receivers
+     * can resync. Zero only sends the first frame as a keyframe.
+     */
+    uint32_t keyframe_interval{16};
+    /**
+     * A value is sent if it differs from the last value sent for its column
+     * by more than its threshold. Zero sends every change.
+     */
+    uint64_t change_threshold{};
+    /**
+     * The threshold of each sent column, in the order of columns or of the
+     * values if columns is nullptr, or nullptr to use change_threshold for
+     * all of them. The array is copied.
+     */
+    const uint64_t *change_thresholds{};
+};
+
+/** The frames sent by a network_sink. */
+struct network_sink_stats {
+    /** Frames of samples sent. */
+    uint64_t frames;
+    /** Samples sent. */
+    uint64_t samples;
+    /** Bytes sent, including the headers and the schema. */
+    uint64_t bytes;
+    /** Frames that sent every value, the first frame included. */
+    uint64_t keyframes;
+    /** Values left out of frame_changes frames because they didn't change. */
+    uint64_t values_skipped;
+};
+
+/**
+ * @brief A network_sink sends hardware counter samples to a connected
+ * stream socket, e.g. of a remote dashboard, in the stream_protocol format.
+ *
+ * Samples are staged column by column and sent in frames, when the frame is
+ * full or spans the flush interval. Each column is delta encoded like the
+ * chunks of a trace file into its own slot of a preallocated buffer, and
+ * the header and columns are sent with one scatter-gather sendmsg(), so
+ * the encoded columns are never copied together. Only a subset of the
+ * values can be sent, to save bandwidth. All storage is allocated at
+ * construction, and the sink doesn't own the socket.
+ *
+ * When network_sink_config::changes_only is set, most counters that stay
+ * at zero or barely move between samples aren't sent at all: a sample only
+ * carries the values that moved beyond the threshold of their column since
+ * they were last sent, and a presence bitmap. Comparing with the last sent
+ * value rather than the previous one keeps the error of the receiver within
+ * the threshold however slowly a counter drifts.
+ *
+ * The values are sent as unsigned 64-bit integers, so only hardware
+ * counters should be sent. The sink can be given to the callback of a
+ * sample_stream, so that the sends don't block the sampling thread.
+ *
+ * @par
+ * @code
+ * hwcpipe::network_sink_config sink_config{};
+ * sink_config.flush_interval_ns = 50000000;
+ * hwcpipe::network_sink sink(socket_fd, counters, num_counters, sink_config);
+ * while (running) {
+ *     if (!sampler.sample_now()) {
+ *         ec = sink.push(sampler, list);
+ *     }
+ * }
+ * ec = sink.flush();
+ * @endcode
+ */
+class network_sink {
+  public:
+    /**
+     * @brief Constructs a sink.
+     *
+     * @param [in] socket_fd     A connected stream socket.
+     * @param [in] counters      The counters of the values of each sample.
+     * @param [in] num_counters  Number of values of each sample.
+     * @param [in] config        When the samples are sent, and which ones.
+     */
+    network_sink(int socket_fd, const hwcpipe_counter *counters, size_t num_counters,
+                 const network_sink_config &config);
+
+    network_sink(const network_sink &) = delete;
+    network_sink &operator=(const network_sink &) = delete;
+
+    /** @return The number of values of each sample. */
+    HWCP_NODISCARD size_t values_per_sample() const { return staging_.size(); }
+
+    /** @return The number of counter columns sent. */
+    HWCP_NODISCARD size_t num_columns() const { return columns_.size(); }
+
+    /** @return The number of samples waiting to be sent. */
+    HWCP_NODISCARD size_t num_buffered() const { return num_buffered_; }
+
+    /** @return The memory held by the sink in bytes, including the staged columns and the encoded frame. */
+    HWCP_NODISCARD size_t get_memory_footprint() const {
+        return sizeof(*this) + detail::heap_bytes(columns_) + detail::heap_bytes(schema_) +
+               detail::heap_bytes(values_) + detail::heap_bytes(encoded_) + detail::heap_bytes(buffers_) +
+               detail::heap_bytes(staging_) + detail::heap_bytes(thresholds_) + detail::heap_bytes(last_sent_) +
+               detail::heap_bytes(presence_) + detail::heap_bytes(changed_);
+    }
+
+    /** @return The frames sent so far. */
+    HWCP_NODISCARD const network_sink_stats &get_stats() const { return stats_; }
+
+    /**
+     * @brief Adds a sample, and sends the frame if it is full or spans the
+     * flush interval.
+     *
+     * @param [in] timestamp_ns_begin  Start of the counter accumulation.
+     * @param [in] timestamp_ns_end    End of the counter accumulation.
+     * @param [in] values              values_per_sample() counter values.
+     * @return hwcpipe::errc::network_send_failed if the frame couldn't be
+     * sent.
+     */
+    template <typename value_t>
+    HWCP_NODISCARD std::error_code push(uint64_t timestamp_ns_begin, uint64_t timestamp_ns_end,
+                                        const value_t *values) {
+        const size_t row = num_buffered_;
+        if (row == 0) {
+            keyframe_ = !changes_only_ || !schema_sent_ ||
+                        (keyframe_interval_ != 0 && frames_since_keyframe_ + 1 >= keyframe_interval_);
+        }
+        column(0)[row] = timestamp_ns_begin;
+        column(1)[row] = timestamp_ns_end;
+        for (size_t i = 0; i != columns_.size(); ++i) {
+            column(num_time_columns + i)[row] = static_cast<uint64_t>(values[columns_[i]]);
+        }
+        if (changes_only_) {
+            mark_changes(row);
+        }
+        ++num_buffered_;
+
+        const bool full = num_buffered_ == batch_size_;
+        const bool expired = flush_interval_ns_ != 0 && timestamp_ns_end - column(0)[0] >= flush_interval_ns_;
+        return full || expired ? flush() : std::error_code{};
+    }
+
+    /**
+     * @brief Adds the last sample of a sampler.
+     *
+     * @param [in] sampler  The sampler, after a successful sample.
+     * @param [in] list     A read list of the sampler with
+     *                      values_per_sample() hardware counters.
+     * @return The error of sampler::get_counter_values(), otherwise the
+     * error of push().
+     */
+    template <typename sampler_t, typename read_list_t>
+    HWCP_NODISCARD std::error_code push(const sampler_t &sampler, const read_list_t &list) {
+        auto ec = sampler.get_counter_values(list, staging_.data(), staging_.size());
+        if (ec) {
+            return ec;
+        }
+        return push(sampler.get_sample_timestamp(), sampler.get_sample_timestamp_end(), staging_.data());
+    }
+
+    /**
+     * @brief Sends the buffered samples, if any. The schema is sent before
+     * the first frame.
+     *
+     * @return hwcpipe::errc::network_send_failed if the frame couldn't be
+     * sent. The buffered samples are dropped either way.
+     */
+    HWCP_NODISCARD std::error_code flush();
+
+  private:
+    /** The timestamp columns before the counter columns. */
+    static constexpr size_t num_time_columns = 2;
+
+    HWCP_NODISCARD uint64_t *column(size_t index) { return values_.data() + index * batch_size_; }
+
+    /** The size of the presence bitmap of a sample. */
+    HWCP_NODISCARD size_t bitmap_size() const { return (columns_.size() + 7) / 8; }
+
+    /** Sets the presence bits of the values of @p row that are sent, and records them as sent. */
+    void mark_changes(size_t row);
+
+    /** Encodes the staged samples as a frame_changes payload, and returns the number of buffers. */
+    HWCP_NODISCARD size_t encode_changes(size_t count, size_t &payload_size);
+
+    /** Sends @p count buffers, retrying partial sends. */
+    HWCP_NODISCARD std::error_code send(iovec *buffers, size_t count);
+
+    const int socket_fd_;
+    const size_t batch_size_;
+    const uint64_t flush_interval_ns_;
+    // the index of the value of each counter column, and its counter
+    std::vector<size_t> columns_{};
+    std::vector<uint32_t> schema_{};
+    // the staged samples, column after column
+    std::vector<uint64_t> values_;
+    // one slot of column_codec::max_encoded_size(batch_size) bytes per column
+    std::vector<uint8_t> encoded_;
+    std::vector<iovec> buffers_;
+    std::vector<uint64_t> staging_;
+    // the change threshold and the last value sent of each counter column
+    std::vector<uint64_t> thresholds_{};
+    std::vector<uint64_t> last_sent_{};
+    // the presence bitmap of each staged sample, and the changed values of a column
+    std::vector<uint8_t> presence_{};
+    std::vector<uint64_t> changed_{};
+    const bool changes_only_;
+    const uint32_t keyframe_interval_;
+    uint32_t frames_since_keyframe_{};
+    bool keyframe_{true};
+    stream_protocol::frame_header header_{};
+    size_t num_buffered_{};
+    bool schema_sent_{};
+    network_sink_stats stats_{};
+};
+
+} // namespace hwcpipe
@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include "hwcpipe/types.hpp"
+
+#include <device/hwcnt/sampler/multiplexer.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <system_error>
+
+namespace hwcpipe {
+
+/** When an on_demand_session pauses and resumes its session. */
+struct on_demand_config {
+    /**
+     * Time the session keeps running after the last consumer left, in
+     * nanoseconds, so that a consumer that reconnects right away doesn't
+     * restart it.
+     */
+    uint64_t linger_ns{1000000000};
+    /**
+     * Longest resume accepted, in nanoseconds. A resume that takes longer
+     * disables the pauses, and the session then keeps running.
+     */
+    uint64_t max_resume_latency_ns{50000000};
+};
+
+/** What an on_demand_session did. */
+struct on_demand_stats {
+    /** Number of times the session was paused. */
+    uint64_t num_pauses;
+    /** Number of times the session was resumed. */
+    uint64_t num_resumes;
+    /** Duration of the last resume, in nanoseconds. */
+    uint64_t last_resume_latency_ns;
+    /** Duration of the slowest resume, in nanoseconds. */
+    uint64_t max_resume_latency_ns;
+};
+
+/**
+ * @brief How an on_demand_session pauses and resumes a session. A sampler is
+ * stopped and started again, which keeps its backend session and mapped
+ * buffer.
+ */
+template <typename session_t>
+struct on_demand_traits {
+    static std::error_code pause(session_t &session) { return session.stop_sampling(); }
+    static std::error_code resume(session_t &session) { return session.start_sampling(); }
+};
+
+/**
+ * @brief A multiplexer is paused, which keeps the session of its current pass
+ * and its estimates.
+ */
+template <>
+struct on_demand_traits<device::hwcnt::sampler::multiplexer> {
+    static std::error_code pause(device::hwcnt::sampler::multiplexer &session) { return session.pause(); }
+    static std::error_code resume(device::hwcnt::sampler::multiplexer &session) { return session.resume(); }
+};
+
+/**
+ * @brief An on_demand_session pauses a counter session while nobody consumes
+ * its samples, e.g. while no client is subscribed to a sample daemon, so the
+ * GPU doesn't dump counters and the CPU doesn't collect them for nobody.
+ *
+ * The session is paused once it had no consumer for the linger time, and
+ * resumed by the first update() with a consumer. Pausing keeps the backend
+ * session and its mapped buffer, so a resume only restarts the counter
+ * accumulation. Every resume is timed, see get_stats(). A resume slower than
+ * on_demand_config::max_resume_latency_ns disables the pauses, so a driver
+ * that restarts slowly makes consumers wait once at most.
+ *
+ * The session, e.g. a sampler or a device::hwcnt::sampler::multiplexer, is
+ * started by the caller and not owned. While it is paused, is_running() is
+ * false and it must not be sampled.
+ *
+ * @par
+ * @code
+ * hwcpipe::on_demand_session<hwcpipe::sampler<>> on_demand(sampler);
+ * while (running) {
+ *     server.serve_pending(on_demand.is_running() ? 0 : 100);
+ *     ec = on_demand.update(server.num_subscribers());
+ *     if (on_demand.is_running() && !sampler.sample_now()) {
+ *         ec = exporter.publish(sampler, list);
+ *     }
+ * }
+ * @endcode
+ */
+template <typename session_t, typename traits_t = on_demand_traits<session_t>>
+class on_demand_session {
+  public:
+    /**
+     * @param [in] session  The started session.
+     * @param [in] config   When to pause and resume it.
+     */
+    explicit on_demand_session(session_t &session, const on_demand_config &config = on_demand_config{})
+        : session_(session)
+        , config_(config) {}
+
+    /** @return True if the session is running, false while it is paused. */
+    HWCP_NODISCARD bool is_running() const { return running_; }
+
+    /** @return False once a resume was slower than the bound, after which the session is never paused again. */
+    HWCP_NODISCARD bool can_pause() const { return can_pause_; }
+
+    /** @return The pauses and resumes so far. */
+    HWCP_NODISCARD const on_demand_stats &get_stats() const { return stats_; }
+
+    /**
+     * @brief Pauses or resumes the session for the number of consumers.
+     *
+     * @param [in] num_consumers  The number of consumers of the samples.
+     * @return The error of the pause or resume, in which case the session
+     * keeps its state.
+     */
+    HWCP_NODISCARD std::error_code update(size_t num_consumers) { return update(num_consumers, now_ns()); }
+
+    /**
+     * @brief Pauses or resumes the session for the number of consumers, at a
+     * given time.
+     *
+     * @param [in] num_consumers  The number of consumers of the samples.
+     * @param [in] time_ns        The time of the update, in nanoseconds of
+     *                            std::chrono::steady_clock.
+     * @return The error of the pause or resume.
+     */
+    HWCP_NODISCARD std::error_code update(size_t num_consumers, uint64_t time_ns) {
+        if (num_consumers != 0) {
+            lingering_ = false;
+            return running_ ? std::error_code{} : resume();
+        }
+
+        if (!running_ || !can_pause_) {
+            return {};
+        }
+        if (!lingering_) {
+            lingering_ = true;
+            idle_since_ns_ = time_ns;
+        }
+        if (time_ns - idle_since_ns_ < config_.linger_ns) {
+            return {};
+        }
+
+        auto ec = traits_t::pause(session_);
+        if (ec) {
+            return ec;
+        }
+        running_ = false;
+        lingering_ = false;
+        ++stats_.num_pauses;
+        return {};
+    }
+
+  private:
+    static uint64_t now_ns() {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                         std::chrono::steady_clock::now().time_since_epoch())
+                                         .count());
+    }
+
+    std::error_code resume() {
+        const uint64_t begin_ns = now_ns();
+        auto ec = traits_t::resume(session_);
+        if (ec) {
+            return ec;
+        }
+        const uint64_t latency_ns = now_ns() - begin_ns;
+
+        running_ = true;
+        ++stats_.num_resumes;
+        stats_.last_resume_latency_ns = latency_ns;
+        stats_.max_resume_latency_ns = std::max(stats_.max_resume_latency_ns, latency_ns);
+        can_pause_ = can_pause_ && latency_ns <= config_.max_resume_latency_ns;
+        return {};
+    }
+
+    session_t &session_;
+    on_demand_config config_;
+    on_demand_stats stats_{};
+    bool running_{true};
+    bool can_pause_{true};
+    // no consumer since idle_since_ns_
+    bool lingering_{};
+    uint64_t idle_since_ns_{};
+};
+
+} // namespace hwcpipe
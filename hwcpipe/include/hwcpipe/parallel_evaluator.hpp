@@ -0,0 +1,259 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include "hwcpipe/column_evaluator.hpp"
+#include "hwcpipe/detail/task_pool.hpp"
+#include "hwcpipe/error.hpp"
+#include "hwcpipe/hwcpipe_counter.h"
+#include "hwcpipe/types.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <system_error>
+#include <vector>
+
+namespace hwcpipe {
+
+/**
+ * @brief A parallel_column_evaluator evaluates a counter over a long recorded
+ * trace on many cores, e.g. to post-process captures on a server.
+ *
+ * The samples are split into chunks of a fixed number of samples, which the
+ * threads of a pool take in turn: a thread that finishes a chunk takes the
+ * next one that no thread has taken, so the load balances itself when chunks
+ * take uneven time. Each thread evaluates its chunks with its own copy of the
+ * column_evaluator, and writes the results in place, so the results are in
+ * sample order whatever thread evaluated them. The calling thread works too.
+ *
+ * evaluate_windows() merges the samples of each window before evaluating the
+ * counter, as sampler_config::set_coalesced_samples() does on the device. The
+ * windows that straddle two chunks are summed in parts by each chunk, and the
+ * parts are added in chunk order once all the chunks are done, so the results
+ * don't depend on the number of threads.
+ *
+ * The evaluator is not thread-safe: one evaluation runs at a time.
+ *
+ * @par
+ * @code
+ * hwcpipe::column_evaluator counter(gpu, MaliFragOverdraw);
+ * hwcpipe::parallel_column_evaluator evaluator(counter);
+ * std::vector<double> overdraw(num_samples);
+ * auto ec = evaluator.evaluate(columns.data(), columns.size(), num_samples, overdraw.data());
+ * @endcode
+ */
+class parallel_column_evaluator {
+  public:
+    /** The default number of samples of a chunk. */
+    static constexpr size_t default_chunk_size = 16384;
+
+    /**
+     * @param [in] evaluator    The evaluator of the counter, copied for each
+     *                          thread.
+     * @param [in] num_threads  Number of threads evaluating the chunks,
+     *                          including the calling thread, or zero for one
+     *                          per hardware thread.
+     * @param [in] chunk_size   Number of samples of a chunk.
+     */
+    explicit parallel_column_evaluator(const column_evaluator &evaluator, size_t num_threads = 0,
+                                       size_t chunk_size = default_chunk_size)
+        : ec_(evaluator.get_error())
+        , chunk_size_(std::max<size_t>(chunk_size, 1))
+        , pool_(num_threads) {
+        workers_.assign(pool_.num_threads(), worker_state{evaluator, {}, {}});
+    }
+
+    parallel_column_evaluator(const parallel_column_evaluator &) = delete;
+    parallel_column_evaluator &operator=(const parallel_column_evaluator &) = delete;
+
+    /** @return True if the counter evaluator is valid. */
+    operator bool() const { return !ec_; }
+
+    /** @return The hardware counters whose columns are passed to evaluate(), in that order. */
+    HWCP_NODISCARD const std::vector<hwcpipe_counter> &get_inputs() const { return workers_[0].evaluator.get_inputs(); }
+
+    /** @return The number of threads evaluating the chunks, including the calling thread. */
+    HWCP_NODISCARD size_t num_threads() const { return workers_.size(); }
+
+    /** @return The number of samples of a chunk. */
+    HWCP_NODISCARD size_t chunk_size() const { return chunk_size_; }
+
+    /**
+     * @brief Evaluates the counter over @p count samples, see
+     * column_evaluator::evaluate().
+     *
+     * @param [in]  columns      One column of @p count values per entry of
+     *                           get_inputs(), in the same order.
+     * @param [in]  num_columns  Number of entries in @p columns.
+     * @param [in]  count        Number of samples in each column.
+     * @param [out] results      Receives @p count values.
+     * @return The same errors as column_evaluator::evaluate().
+     */
+    HWCP_NODISCARD std::error_code evaluate(const double *const *columns, size_t num_columns, size_t count,
+                                            double *results) {
+        if (ec_) {
+            return ec_;
+        }
+        if (num_columns != get_inputs().size()) {
+            return make_error_code(errc::invalid_read_list);
+        }
+
+        run((count + chunk_size_ - 1) / chunk_size_, [&](worker_state &worker, size_t chunk) {
+            const size_t begin = chunk * chunk_size_;
+            const size_t size = std::min(chunk_size_, count - begin);
+            worker.columns.resize(num_columns);
+            for (size_t k = 0; k != num_columns; ++k) {
+                worker.columns[k] = columns[k] + begin;
+            }
+            auto ec = worker.evaluator.evaluate(worker.columns.data(), num_columns, size, results + begin);
+            if (ec && !worker.ec) {
+                worker.ec = ec;
+            }
+        });
+        return first_error();
+    }
+
+    /**
+     * @brief Sums the input columns over consecutive windows of @p window
+     * samples, and evaluates the counter once per window. The input columns
+     * must hold deltas, e.g. hardware counter values, so that the sum of a
+     * window is its value. The last window may hold fewer samples.
+     *
+     * @param [in]  columns      One column of @p count values per entry of
+     *                           get_inputs(), in the same order.
+     * @param [in]  num_columns  Number of entries in @p columns.
+     * @param [in]  count        Number of samples in each column.
+     * @param [in]  window       Number of samples of a window, not zero.
+     * @param [out] results      Receives one value per window, i.e.
+     *                           (count + window - 1) / window values.
+     * @return hwcpipe::errc::invalid_read_list if @p window is zero, otherwise
+     * the same errors as evaluate().
+     */
+    HWCP_NODISCARD std::error_code evaluate_windows(const double *const *columns, size_t num_columns, size_t count,
+                                                    size_t window, double *results) {
+        if (ec_) {
+            return ec_;
+        }
+        if (num_columns != get_inputs().size() || window == 0) {
+            return make_error_code(errc::invalid_read_list);
+        }
+
+        const size_t num_windows = (count + window - 1) / window;
+        const size_t num_chunks = (count + chunk_size_ - 1) / chunk_size_;
+        sums_.resize(num_columns * num_windows);
+        // the first and last window of each chunk, summed in part
+        edges_.resize(num_chunks * 2 * num_columns);
+
+        run(num_chunks, [&](worker_state &, size_t chunk) {
+            const size_t begin = chunk * chunk_size_;
+            const size_t end = std::min(begin + chunk_size_, count);
+            for (size_t k = 0; k != num_columns; ++k) {
+                const double *column = columns[k];
+                double *head = &edges_[(chunk * 2) * num_columns + k];
+                double *tail = &edges_[(chunk * 2 + 1) * num_columns + k];
+                *head = 0;
+                *tail = 0;
+                for (size_t w = begin / window; w * window < end; ++w) {
+                    const size_t window_begin = w * window;
+                    const size_t window_end = std::min(window_begin + window, count);
+                    const size_t first = std::max(window_begin, begin);
+                    const size_t last = std::min(window_end, end);
+                    double sum = 0;
+                    for (size_t i = first; i != last; ++i) {
+                        sum += column[i];
+                    }
+                    if (first == window_begin && last == window_end) {
+                        sums_[k * num_windows + w] = sum;
+                    } else if (first == begin) {
+                        *head = sum;
+                    } else {
+                        *tail = sum;
+                    }
+                }
+            }
+        });
+
+        stitch_windows(num_columns, count, window, num_chunks, num_windows);
+
+        window_columns_.resize(num_columns);
+        for (size_t k = 0; k != num_columns; ++k) {
+            window_columns_[k] = sums_.data() + k * num_windows;
+        }
+        return evaluate(window_columns_.data(), num_columns, num_windows, results);
+    }
+
+  private:
+    // the evaluator and scratch of one thread
+    struct worker_state {
+        column_evaluator evaluator;
+        std::vector<const double *> columns;
+        std::error_code ec;
+    };
+
+    /** Runs @p task for every chunk, on all the threads, and waits for them. */
+    template <typename task_t>
+    void run(size_t num_chunks, task_t &&task) {
+        for (auto &worker : workers_) {
+            worker.ec.clear();
+        }
+        pool_.run(num_chunks, [&](size_t worker, size_t chunk) { task(workers_[worker], chunk); });
+    }
+
+    /**
+     * Adds the parts of the windows that straddle chunks, in chunk order. The
+     * first part of a window is assigned, as the window has no complete sum.
+     */
+    void stitch_windows(size_t num_columns, size_t count, size_t window, size_t num_chunks, size_t num_windows) {
+        size_t last_window = num_windows;
+        const auto add = [&](size_t w, size_t chunk, size_t edge) {
+            for (size_t k = 0; k != num_columns; ++k) {
+                const double part = edges_[(chunk * 2 + edge) * num_columns + k];
+                double &sum = sums_[k * num_windows + w];
+                sum = w == last_window ? sum + part : part;
+            }
+            last_window = w;
+        };
+
+        for (size_t chunk = 0; chunk != num_chunks; ++chunk) {
+            const size_t begin = chunk * chunk_size_;
+            const size_t end = std::min(begin + chunk_size_, count);
+            const size_t first_window = begin / window;
+            const size_t last = (end - 1) / window;
+            const bool head_partial =
+                first_window * window < begin || std::min((first_window + 1) * window, count) > end;
+            if (head_partial) {
+                add(first_window, chunk, 0);
+            }
+            const bool tail_partial = last != first_window && std::min((last + 1) * window, count) > end;
+            if (tail_partial) {
+                add(last, chunk, 1);
+            }
+        }
+    }
+
+    /** Returns the first error of the threads. */
+    HWCP_NODISCARD std::error_code first_error() const {
+        for (const auto &worker : workers_) {
+            if (worker.ec) {
+                return worker.ec;
+            }
+        }
+        return {};
+    }
+
+    std::error_code ec_;
+    size_t chunk_size_;
+    detail::task_pool pool_;
+    std::vector<worker_state> workers_{};
+
+    // window sums, one column per input, and the parts of the straddling windows
+    std::vector<double> sums_{};
+    std::vector<double> edges_{};
+    std::vector<const double *> window_columns_{};
+};
+
+} // namespace hwcpipe
@@ -0,0 +1,315 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include "hwcpipe/counter_database.hpp"
+#include "hwcpipe/detail/heap_bytes.hpp"
+#include "hwcpipe/detail/proto_writer.hpp"
+#include "hwcpipe/hwcpipe_counter.h"
+#include "hwcpipe/sample_stream.hpp"
+#include "hwcpipe/types.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <system_error>
+#include <vector>
+
+namespace hwcpipe {
+
+/** The builtin clocks of Perfetto, see BuiltinClock in perfetto's clock_snapshot.proto. */
+namespace perfetto_clock {
+constexpr uint32_t realtime = 1;
+constexpr uint32_t monotonic = 3;
+constexpr uint32_t monotonic_raw = 5;
+constexpr uint32_t boottime = 6;
+} // namespace perfetto_clock
+
+/** How the counter values of a sample are split into trace packets. */
+enum class perfetto_batching : uint8_t {
+    /** One packet per counter value, as written by the SDK's TRACE_COUNTER. */
+    packet_per_value,
+    /**
+     * One packet per sample, the values of the other counters being extra
+     * counter values of the first one. The timestamp and packet overhead is
+     * paid once per sample.
+     */
+    packet_per_sample,
+};
+
+/** The tracks and clock of a perfetto_writer. */
+struct perfetto_writer_config {
+    /**
+     * UUID of the parent track. The counter tracks use the following UUIDs,
+     * so the range must not collide with other tracks of the trace.
+     */
+    uint64_t uuid_base{0x6877637069706500};
+    /** Name of the parent track. */
+    const char *track_name{"Mali GPU"};
+    /** The Perfetto clock of the sample timestamps, see perfetto_clock. */
+    uint32_t clock_id{perfetto_clock::monotonic};
+    /** Added to the sample timestamps, e.g. to map a device clock to clock_id. */
+    int64_t clock_offset_ns{};
+    /** How the values of a sample are split into packets. */
+    perfetto_batching batching{perfetto_batching::packet_per_sample};
+    /**
+     * If true, each packet is prefixed with the tag and length of a
+     * Trace.packet field and carries sequence_id, so the bytes are a valid
+     * trace file. Otherwise the bytes are the fields of a TracePacket, as
+     * appended to the packets of an SDK data source.
+     */
+    bool framed{};
+    /** The trusted packet sequence ID of framed packets. */
+    uint32_t sequence_id{1};
+};
+
+/**
+ * @brief Encodes counter samples as Perfetto counter tracks, without
+ * depending on the Perfetto SDK.
+ *
+ * write_descriptors() defines a parent track and one counter track per
+ * counter, named and labelled with the units from the counter_database. The
+ * names are only written there: sample packets refer to the tracks by UUID.
+ * The descriptors must be written again whenever the incremental state of
+ * the data source is cleared.
+ *
+ * Each sample is written at its begin timestamp, since a counter value holds
+ * until the next one, tagged with the clock of the sampler so that
+ * trace_processor maps it to the trace clock with the clock snapshots of the
+ * trace. Packets are written to a sink, any callable taking
+ * `(const uint8_t *data, size_t size)`. The sample packets are encoded in a
+ * buffer allocated at construction, so writing a sample doesn't allocate.
+ *
+ * @par
+ * @code
+ * hwcpipe::perfetto_writer writer(counters, num_counters, {});
+ * // in the Trace() callback of a perfetto::DataSource
+ * auto sink = [&](const uint8_t *data, size_t size) { ctx.NewTracePacket()->AppendRawProtoBytes(data, size); };
+ * if (first_packet) {
+ *     ec = writer.write_descriptors(sink);
+ * }
+ * ec = writer.write_sample(sampler, list, sink);
+ * @endcode
+ */
+class perfetto_writer {
+  public:
+    /**
+     * @brief Constructs a writer.
+     *
+     * @param [in] counters      The counters of the samples, in the order of
+     *                           their values.
+     * @param [in] num_counters  Number of counters.
+     * @param [in] config        The tracks and clock of the writer.
+     */
+    perfetto_writer(const hwcpipe_counter *counters, size_t num_counters, const perfetto_writer_config &config)
+        : config_(config)
+        , counters_(counters, counters + num_counters)
+        , values_(num_counters)
+        , buffer_(headroom + event_overhead + num_counters * extra_value_size) {}
+
+    perfetto_writer(const perfetto_writer &) = delete;
+    perfetto_writer &operator=(const perfetto_writer &) = delete;
+
+    /** @return The number of counter values of each sample. */
+    HWCP_NODISCARD size_t num_counters() const { return counters_.size(); }
+
+    /** @return The memory held by the writer in bytes, including the buffer that packets are encoded to. */
+    HWCP_NODISCARD size_t get_memory_footprint() const {
+        return sizeof(*this) + detail::heap_bytes(counters_) + detail::heap_bytes(values_) +
+               detail::heap_bytes(buffer_);
+    }
+
+    /** @return The UUID of the track of a counter, by index in the counter list. */
+    HWCP_NODISCARD uint64_t track_uuid(size_t index) const { return config_.uuid_base + 1 + index; }
+
+    /**
+     * @brief Writes the parent track and the counter tracks.
+     *
+     * @param [in] sink  Receives one packet per track.
+     * @return hwcpipe::errc::unknown_counter if a counter has no metadata.
+     */
+    template <typename sink_t>
+    HWCP_NODISCARD std::error_code write_descriptors(sink_t &&sink) {
+        counter_database database{};
+        std::vector<counter_metadata> metadata(counters_.size());
+        for (size_t i = 0; i != counters_.size(); ++i) {
+            auto ec = database.describe_counter(counters_[i], metadata[i]);
+            if (ec) {
+                return ec;
+            }
+        }
+
+        write_descriptor(config_.uuid_base, false, config_.track_name, nullptr, sink);
+        for (size_t i = 0; i != counters_.size(); ++i) {
+            write_descriptor(track_uuid(i), true, metadata[i].name, metadata[i].units, sink);
+        }
+        return {};
+    }
+
+    /**
+     * @brief Writes the values of a sample.
+     *
+     * @param [in] timestamp_ns  Start of the counter accumulation.
+     * @param [in] values        num_counters() counter values.
+     * @param [in] sink          Receives the packets.
+     */
+    template <typename sink_t>
+    void write_values(uint64_t timestamp_ns, const double *values, sink_t &&sink) {
+        using namespace detail::proto_writer;
+
+        if (counters_.empty()) {
+            return;
+        }
+
+        if (config_.batching == perfetto_batching::packet_per_value) {
+            for (size_t i = 0; i != counters_.size(); ++i) {
+                uint8_t *body = buffer_.data() + headroom;
+                size_t size = put_varint_field(body, event_type, event_type_counter);
+                size += put_varint_field(body + size, event_track_uuid, track_uuid(i));
+                size += put_double_field(body + size, event_double_counter_value, values[i]);
+                emit(timestamp_ns, packet_track_event, size, sink);
+            }
+            return;
+        }
+
+        uint8_t *body = buffer_.data() + headroom;
+        size_t size = put_varint_field(body, event_type, event_type_counter);
+        size += put_varint_field(body + size, event_track_uuid, track_uuid(0));
+        size += put_double_field(body + size, event_double_counter_value, values[0]);
+        for (size_t i = 1; i != counters_.size(); ++i) {
+            size += put_varint_field(body + size, event_extra_double_counter_track_uuids, track_uuid(i));
+        }
+        for (size_t i = 1; i != counters_.size(); ++i) {
+            size += put_double_field(body + size, event_extra_double_counter_values, values[i]);
+        }
+        emit(timestamp_ns, packet_track_event, size, sink);
+    }
+
+    /**
+     * @brief Writes a sample delivered by a sample_stream.
+     *
+     * @param [in] sample  The sample, with num_counters() values.
+     * @param [in] sink    Receives the packets.
+     */
+    template <typename sink_t>
+    void write_sample(const stream_sample &sample, sink_t &&sink) {
+        write_values(sample.timestamp_ns_begin, sample.values, sink);
+    }
+
+    /**
+     * @brief Writes the last sample of a sampler.
+     *
+     * @param [in] sampler  The sampler, after a successful sample.
+     * @param [in] list     A read list of the sampler with num_counters()
+     *                      counters.
+     * @param [in] sink     Receives the packets.
+     * @return The error of sampler::get_counter_values().
+     */
+    template <typename sampler_t, typename read_list_t, typename sink_t>
+    HWCP_NODISCARD std::error_code write_sample(const sampler_t &sampler, const read_list_t &list, sink_t &&sink) {
+        auto ec = sampler.get_counter_values(list, values_.data(), values_.size());
+        if (ec) {
+            return ec;
+        }
+        write_values(sampler.get_sample_timestamp(), values_.data(), sink);
+        return {};
+    }
+
+  private:
+    // field numbers of perfetto's trace_packet.proto, track_event.proto,
+    // track_descriptor.proto and counter_descriptor.proto
+    static constexpr uint32_t trace_packet = 1;
+    static constexpr uint32_t packet_timestamp = 8;
+    static constexpr uint32_t packet_trusted_sequence_id = 10;
+    static constexpr uint32_t packet_track_event = 11;
+    static constexpr uint32_t packet_timestamp_clock_id = 58;
+    static constexpr uint32_t packet_track_descriptor = 60;
+    static constexpr uint32_t event_type = 9;
+    static constexpr uint32_t event_track_uuid = 11;
+    static constexpr uint32_t event_double_counter_value = 44;
+    static constexpr uint32_t event_extra_double_counter_track_uuids = 45;
+    static constexpr uint32_t event_extra_double_counter_values = 46;
+    static constexpr uint32_t descriptor_uuid = 1;
+    static constexpr uint32_t descriptor_name = 2;
+    static constexpr uint32_t descriptor_parent_uuid = 5;
+    static constexpr uint32_t descriptor_counter = 8;
+    static constexpr uint32_t counter_unit_name = 6;
+    static constexpr uint64_t event_type_counter = 4;
+
+    // room before a packet body for its framing and timestamp fields
+    static constexpr size_t headroom = 64;
+    // type, track UUID and value of a counter event
+    static constexpr size_t event_overhead = 2 + 11 + 10;
+    // track UUID and value of an extra counter value
+    static constexpr size_t extra_value_size = 12 + 10;
+
+    /** Writes a track descriptor. */
+    template <typename sink_t>
+    void write_descriptor(uint64_t uuid, bool is_counter, const char *name, const char *units, sink_t &&sink) {
+        using namespace detail::proto_writer;
+
+        const size_t name_length = std::strlen(name);
+        const size_t units_length = units != nullptr ? std::strlen(units) : 0;
+        const size_t max_size = headroom + 3 * (max_tag_size + max_varint_size) + name_length + units_length;
+        if (buffer_.size() < max_size) {
+            buffer_.resize(max_size);
+        }
+
+        uint8_t *body = buffer_.data() + headroom;
+        size_t size = put_varint_field(body, descriptor_uuid, uuid);
+        size += put_string_field(body + size, descriptor_name, name, name_length);
+        if (is_counter) {
+            size += put_varint_field(body + size, descriptor_parent_uuid, config_.uuid_base);
+            uint8_t units_header[max_tag_size + max_varint_size];
+            const size_t units_header_size =
+                units_length != 0 ? put_length_header(units_header, counter_unit_name, units_length) : 0;
+            size += put_length_header(body + size, descriptor_counter, units_header_size + units_length);
+            std::memcpy(body + size, units_header, units_header_size);
+            std::memcpy(body + size + units_header_size, units, units_length);
+            size += units_header_size + units_length;
+        }
+
+        emit(0, packet_track_descriptor, size, sink);
+    }
+
+    /**
+     * Writes the packet fields before a body encoded at headroom, and passes
+     * the packet to the sink. Descriptors have no timestamp.
+     */
+    template <typename sink_t>
+    void emit(uint64_t timestamp_ns, uint32_t body_field, size_t body_size, sink_t &&sink) {
+        using namespace detail::proto_writer;
+
+        uint8_t prefix[headroom];
+        size_t prefix_size = 0;
+        if (body_field == packet_track_event) {
+            const uint64_t timestamp = timestamp_ns + static_cast<uint64_t>(config_.clock_offset_ns);
+            prefix_size += put_varint_field(prefix + prefix_size, packet_timestamp, timestamp);
+            prefix_size += put_varint_field(prefix + prefix_size, packet_timestamp_clock_id, config_.clock_id);
+        }
+        if (config_.framed) {
+            prefix_size += put_varint_field(prefix + prefix_size, packet_trusted_sequence_id, config_.sequence_id);
+        }
+        prefix_size += put_length_header(prefix + prefix_size, body_field, body_size);
+
+        uint8_t frame[max_tag_size + max_varint_size];
+        const size_t frame_size =
+            config_.framed ? put_length_header(frame, trace_packet, prefix_size + body_size) : 0;
+
+        uint8_t *packet = buffer_.data() + headroom - prefix_size - frame_size;
+        std::memcpy(packet, frame, frame_size);
+        std::memcpy(packet + frame_size, prefix, prefix_size);
+        sink(static_cast<const uint8_t *>(packet), frame_size + prefix_size + body_size);
+    }
+
+    const perfetto_writer_config config_;
+    const std::vector<hwcpipe_counter> counters_;
+    std::vector<double> values_;
+    std::vector<uint8_t> buffer_;
+};
+
+} // namespace hwcpipe
@@ -0,0 +1,285 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include "hwcpipe/error.hpp"
+#include "hwcpipe/sampler.hpp"
+#include "hwcpipe/types.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <system_error>
+#include <vector>
+
+namespace hwcpipe {
+
+/** Identifies a region of a region_profiler. */
+using region_id = uint32_t;
+
+/** The counter totals of a region, as returned by region_profiler::get_region(). */
+struct region_totals {
+    /** The name given to region_profiler::add_region(). */
+    const char *name;
+    /** Number of completed scopes of the region. */
+    uint64_t calls;
+    /** Number of counter values. */
+    size_t num_values;
+    /** The counters of the region, including its child regions. */
+    const double *inclusive;
+    /** The counters of the region, excluding its child regions. */
+    const double *exclusive;
+};
+
+/**
+ * @brief Attributes the counters of a sampler to named code regions, e.g.
+ * render passes or compute dispatches.
+ *
+ * The boundaries of the regions, see scope, only request a sample
+ * asynchronously, tagged with the region and whether it is entered or exited.
+ * The samples are decoded later by a collector, which calls collect_for() on
+ * its own thread: each sample holds the counters of the time between two
+ * boundaries, which are attributed to the innermost region then open. The
+ * inclusive totals of a region include those of its children, its exclusive
+ * totals don't. The read list must only hold hardware counters, as the
+ * values are summed.
+ *
+ * The scopes must be nested, i.e. opened and closed on a single thread. The
+ * requests and the collection of the samples are serialized, so a boundary
+ * may wait for the decode of one sample.
+ *
+ * @par
+ * @code
+ * auto list = sampler.make_read_list(counters, num_counters, ec);
+ * hwcpipe::region_profiler<> profiler(sampler, list, num_counters);
+ * const auto frame = profiler.add_region("frame");
+ * const auto shadows = profiler.add_region("shadows");
+ * std::thread collector([&] { while (running) { ec = profiler.collect_for(1000000); } });
+ *
+ * {
+ *     hwcpipe::region_profiler<>::scope frame_scope(profiler, frame);
+ *     {
+ *         hwcpipe::region_profiler<>::scope shadows_scope(profiler, shadows);
+ *         // ... shadow pass ...
+ *     }
+ *     // ... other passes ...
+ * }
+ * @endcode
+ *
+ * @tparam sampler_t    The sampler type.
+ * @tparam read_list_t  The read list type of the sampler.
+ */
+template <typename sampler_t = sampler<>, typename read_list_t = read_list>
+class region_profiler {
+  public:
+    /** Opens a region when constructed, and closes it when destroyed. */
+    class scope {
+      public:
+        scope(region_profiler &profiler, region_id region)
+            : profiler_(profiler)
+            , region_(region) {
+            profiler_.boundary(region_, false);
+        }
+
+        ~scope() { profiler_.boundary(region_, true); }
+
+        scope(const scope &) = delete;
+        scope &operator=(const scope &) = delete;
+
+      private:
+        region_profiler &profiler_;
+        region_id region_;
+    };
+
+    /**
+     * @brief Constructs a profiler.
+     *
+     * @param [in] sampler     The sampler, which must be sampling manually.
+     * @param [in] list        A read list of hardware counters of the sampler.
+     * @param [in] num_values  Number of counters in @p list.
+     */
+    region_profiler(sampler_t &sampler, const read_list_t &list, size_t num_values)
+        : sampler_(sampler)
+        , list_(list)
+        , num_values_(num_values)
+        , values_(num_values) {}
+
+    region_profiler(const region_profiler &) = delete;
+    region_profiler &operator=(const region_profiler &) = delete;
+
+    /**
+     * @brief Adds a region. Regions must be added before the collection
+     * starts.
+     *
+     * @param [in] name  The name of the region, which must outlive the
+     *                   profiler.
+     * @return The ID of the region.
+     */
+    region_id add_region(const char *name) {
+        regions_.push_back({name, 0, 0});
+        totals_.resize(regions_.size() * num_values_ * 2);
+        return static_cast<region_id>(regions_.size() - 1);
+    }
+
+    /** @return The number of regions. */
+    HWCP_NODISCARD size_t num_regions() const { return regions_.size(); }
+
+    /**
+     * @brief Collector: waits for the next sample for at most @p timeout_ns,
+     * and attributes its counters to the regions that were open.
+     *
+     * @param [in] timeout_ns  Time to wait for the sample in nanoseconds.
+     * @return hwcpipe::errc::sample_not_ready if no sample was ready in time,
+     * otherwise the error of the sampler.
+     */
+    HWCP_NODISCARD std::error_code collect_for(uint64_t timeout_ns) {
+        uint64_t tag{};
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto ec = sampler_.collect_for(timeout_ns);
+            if (!ec) {
+                ec = sampler_.get_counter_values(list_, values_.data(), values_.size());
+            }
+            if (ec) {
+                return ec;
+            }
+            tag = sampler_.get_sample_user_data();
+        }
+
+        attribute(values_.data());
+        apply(static_cast<region_id>(tag >> 1U), (tag & 1U) != 0);
+        return {};
+    }
+
+    /**
+     * @brief Returns the totals of a region. They are updated by the
+     * collector, so they must be read on its thread, or once it stopped.
+     *
+     * @param [in] region  The ID of the region.
+     */
+    HWCP_NODISCARD region_totals get_region(region_id region) const {
+        const auto &state = regions_[region];
+        const double *totals = totals_.data() + region * num_values_ * 2;
+        return {state.name, state.calls, num_values_, totals, totals + num_values_};
+    }
+
+    /** @return The first error of a sample request made by a scope, if any. */
+    HWCP_NODISCARD std::error_code get_error() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return error_;
+    }
+
+  private:
+    // a region, and the number of its scopes open on the collector's stack
+    struct region_state {
+        const char *name;
+        uint64_t calls;
+        uint32_t open;
+    };
+
+    // an open scope, as replayed by the collector
+    struct frame {
+        region_id region;
+        size_t values_offset;
+    };
+
+    /** Requests the sample that ends at a boundary, tagged with the boundary. */
+    void boundary(region_id region, bool exit) {
+        const uint64_t tag = (static_cast<uint64_t>(region) << 1U) | (exit ? 1U : 0U);
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto ec = sampler_.request_sample_async(tag);
+        if (ec && !error_) {
+            error_ = ec;
+        }
+    }
+
+    /**
+     * Adds the counters of the time before a boundary to the innermost open
+     * scope. They are unattributed if no scope was open.
+     */
+    void attribute(const double *values) {
+        if (stack_.empty()) {
+            return;
+        }
+        double *inclusive = frame_values_.data() + stack_.back().values_offset;
+        double *exclusive = inclusive + num_values_;
+        for (size_t i = 0; i != num_values_; ++i) {
+            inclusive[i] += values[i];
+            exclusive[i] += values[i];
+        }
+    }
+
+    /**
+     * Replays a boundary. A closed scope adds its totals to its region and
+     * its inclusive totals to its parent. A region that is nested in itself
+     * only adds the inclusive totals of its outermost scope.
+     */
+    void apply(region_id region, bool exit) {
+        if (region >= regions_.size()) {
+            return;
+        }
+
+        if (!exit) {
+            const size_t offset = stack_.size() * num_values_ * 2;
+            if (frame_values_.size() < offset + num_values_ * 2) {
+                frame_values_.resize(offset + num_values_ * 2);
+            }
+            std::fill(frame_values_.begin() + static_cast<std::ptrdiff_t>(offset),
+                      frame_values_.begin() + static_cast<std::ptrdiff_t>(offset + num_values_ * 2), 0.0);
+            stack_.push_back({region, offset});
+            ++regions_[region].open;
+            return;
+        }
+
+        if (stack_.empty() || stack_.back().region != region) {
+            return;
+        }
+
+        const frame closed = stack_.back();
+        stack_.pop_back();
+
+        auto &state = regions_[closed.region];
+        ++state.calls;
+        --state.open;
+
+        const double *inclusive = frame_values_.data() + closed.values_offset;
+        const double *exclusive = inclusive + num_values_;
+        double *region_inclusive = totals_.data() + closed.region * num_values_ * 2;
+        double *region_exclusive = region_inclusive + num_values_;
+        for (size_t i = 0; i != num_values_; ++i) {
+            if (state.open == 0) {
+                region_inclusive[i] += inclusive[i];
+            }
+            region_exclusive[i] += exclusive[i];
+        }
+
+        if (!stack_.empty()) {
+            double *parent = frame_values_.data() + stack_.back().values_offset;
+            for (size_t i = 0; i != num_values_; ++i) {
+                parent[i] += inclusive[i];
+            }
+        }
+    }
+
+    sampler_t &sampler_;
+    const read_list_t &list_;
+    const size_t num_values_;
+
+    // guards the sampler and error_
+    mutable std::mutex mutex_{};
+    std::error_code error_{};
+
+    // owned by the collector
+    std::vector<double> values_;
+    std::vector<region_state> regions_{};
+    std::vector<double> totals_{};
+    std::vector<frame> stack_{};
+    std::vector<double> frame_values_{};
+};
+
+} // namespace hwcpipe
@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include "hwcpipe/counter_statistics.hpp"
+#include "hwcpipe/detail/heap_bytes.hpp"
+#include "hwcpipe/error.hpp"
+#include "hwcpipe/hwcpipe_counter.h"
+#include "hwcpipe/types.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <system_error>
+#include <vector>
+
+namespace hwcpipe {
+
+/** Which changes of a counter are regressions. */
+enum class regression_direction : uint8_t {
+    /** The counter got larger, e.g. cycles or stalls. */
+    increase,
+    /** The counter got smaller, e.g. a throughput. */
+    decrease,
+    /** Any change. */
+    both,
+};
+
+/** The sequential test that flagged a regression. */
+enum class regression_test : uint8_t {
+    /** Welch's t-test of the mean of the run against the mean of the baseline. */
+    welch,
+    /** The CUSUM of the values of the run, standardized by the baseline. */
+    cusum,
+};
+
+/** The thresholds of a regression_detector. */
+struct regression_detector_config {
+    /**
+     * Smallest relative change of the mean that is a regression, e.g. 0.05
+     * for 5%. It also floors the standard deviation of the baseline for the
+     * CUSUM, so that a constant baseline doesn't flag tiny changes.
+     */
+    double min_effect{0.05};
+    /**
+     * The Welch t statistic from which the means differ. The test is
+     * repeated after every sample, so it is much larger than the one of a
+     * single test.
+     */
+    double t_threshold{5.0};
+    /** Number of samples of a counter before the Welch test runs. */
+    uint64_t min_samples{30};
+    /** The slack of the CUSUM, in standard deviations of the baseline. */
+    double cusum_slack{0.5};
+    /** The CUSUM from which a counter regressed, in standard deviations of the baseline. Zero disables the CUSUM. */
+    double cusum_threshold{10.0};
+    /** Which changes are regressions, unless set per counter. */
+    regression_direction direction{regression_direction::increase};
+};
+
+/** A counter of a tag that regressed. */
+struct regression_finding {
+    /** The tag of the samples, see sampler::get_sample_user_data(). */
+    uint64_t tag;
+    /** The counter. */
+    hwcpipe_counter counter;
+    /** The test that flagged it. */
+    regression_test test;
+    /** Number of samples of the run when it was flagged. */
+    uint64_t samples;
+    /** Mean of the baseline. */
+    double baseline_mean;
+    /** Mean of the run when it was flagged. */
+    double mean;
+    /** The t statistic or the CUSUM when it was flagged. */
+    double statistic;
+};
+
+/**
+ * @brief A regression_detector compares the samples of a run, live or
+ * replayed, with the summary of a baseline run of the same workload, and
+ * flags the counters whose values regressed while the run goes on, so that a
+ * performance test can stop early.
+ *
+ * The baselines are counter_statistics, e.g. deserialized from the summary
+ * of a previous run, one per tag of the samples or a single one for every
+ * tag. Every sample updates the running_stats of its tag, and two sequential
+ * tests run on each counter:
+ *  - Welch's t-test of the mean of the run against the mean of the
+ *    baseline, once the run has min_samples samples, which catches a
+ *    shift of the whole run,
+ *  - a one-sided CUSUM of the values standardized by the baseline, which
+ *    catches a shift that starts part way through the run.
+ *
+ * Only changes in the regressing direction of a counter count. The t-test
+ * only flags a change of the mean of at least min_effect, and the CUSUM
+ * only accumulates shifts of more than cusum_slack times the standard
+ * deviation of the baseline, which is at least min_effect of its mean. A
+ * counter of a tag is flagged once, by the first test that trips. All
+ * storage is allocated by add_baseline(), so push() doesn't allocate.
+ *
+ * @par
+ * @code
+ * auto baseline = hwcpipe::counter_statistics::deserialize(summary.data(), summary.size(), ec);
+ * hwcpipe::regression_detector detector(counters, num_counters);
+ * ec = detector.add_baseline(baseline);
+ * while (running) {
+ *     if (!sampler.sample_now() && !detector.push(sampler, list) && detector.regressed()) {
+ *         break; // detector.get_finding(0) says what regressed
+ *     }
+ * }
+ * @endcode
+ */
+class regression_detector {
+  public:
+    /**
+     * @brief Constructs a detector without baselines.
+     *
+     * @param [in] counters  The counters of the values of each sample.
+     * @param [in] count     Number of counters.
+     * @param [in] config    The thresholds.
+     */
+    regression_detector(const hwcpipe_counter *counters, size_t count, const regression_detector_config &config = {});
+
+    /** @return The number of values of each sample. */
+    HWCP_NODISCARD size_t size() const { return counters_.size(); }
+
+    /** @brief Sets which changes of the counter at @p index are regressions. */
+    void set_direction(size_t index, regression_direction direction) { directions_[index] = direction; }
+
+    /**
+     * @brief Adds the baseline of the samples of a tag, and clears the run.
+     *
+     * @param [in] baseline  The statistics of the baseline run. Counters it
+     *                       doesn't have aren't tested.
+     * @param [in] tag       The tag of the samples it applies to.
+     * @param [in] any_tag   Whether it also applies to the samples of the
+     *                       tags without a baseline of their own.
+     * @return hwcpipe::errc::statistics_mismatch if the baseline has none
+     * of the counters.
+     */
+    HWCP_NODISCARD std::error_code add_baseline(const counter_statistics &baseline, uint64_t tag = 0,
+                                                bool any_tag = true);
+
+    /**
+     * @brief Adds a sample to the run of its tag and tests its counters.
+     *
+     * @param [in] tag     The tag of the sample.
+     * @param [in] values  size() values.
+     * @return Whether a counter was flagged by this sample.
+     */
+    bool push(uint64_t tag, const double *values);
+
+    /**
+     * @brief Adds the last sample of a sampler, tagged with its user data.
+     *
+     * @param [in] sampler  The sampler, after a successful sample.
+     * @param [in] list     A read list of the sampler with the counters of
+     *                      the detector, in the same order.
+     * @return The error of sampler::get_counter_values().
+     */
+    template <typename sampler_t, typename read_list_t>
+    HWCP_NODISCARD std::error_code push(const sampler_t &sampler, const read_list_t &list) {
+        auto ec = sampler.get_counter_values(list, staging_.data(), staging_.size());
+        if (ec) {
+            return ec;
+        }
+        push(sampler.get_sample_user_data(), staging_.data());
+        return {};
+    }
+
+    /** @return Whether any counter was flagged. */
+    HWCP_NODISCARD bool regressed() const { return !findings_.empty(); }
+
+    /** @return The number of counters flagged, in the order they were. */
+    HWCP_NODISCARD size_t num_findings() const { return findings_.size(); }
+
+    /** @return A flagged counter. */
+    HWCP_NODISCARD const regression_finding &get_finding(size_t index) const { return findings_[index]; }
+
+    /** @return The samples that no baseline applies to. */
+    HWCP_NODISCARD uint64_t num_unmatched() const { return unmatched_; }
+
+    /**
+     * @return The running statistics of the run of a tag for the counter at
+     * @p index, or nullptr if the tag has no baseline.
+     */
+    HWCP_NODISCARD const running_stats *get_run_stats(uint64_t tag, size_t index) const;
+
+    /** @brief Clears the runs and the findings, and keeps the baselines. */
+    void reset();
+
+    /** @return The memory held by the detector in bytes. */
+    HWCP_NODISCARD size_t get_memory_footprint() const {
+        size_t size = sizeof(*this) + detail::heap_bytes(counters_) + detail::heap_bytes(directions_) +
+                      detail::heap_bytes(tags_) + detail::heap_bytes(findings_) + detail::heap_bytes(staging_);
+        for (const auto &tag : tags_) {
+            size += detail::heap_bytes(tag.counters);
+        }
+        return size;
+    }
+
+  private:
+    // the baseline and the run of a counter of a tag
+    struct counter_state {
+        bool tested;
+        bool flagged;
+        double baseline_mean;
+        // the sample variance of the baseline over its count
+        double baseline_error;
+        // the standard deviation of the baseline, floored for the CUSUM
+        double baseline_scale;
+        running_stats run;
+        double cusum_increase;
+        double cusum_decrease;
+    };
+
+    struct tag_state {
+        uint64_t tag;
+        std::vector<counter_state> counters;
+    };
+
+    /** Tests a counter after a sample, and returns whether it was flagged. */
+    bool test(uint64_t tag, size_t index, counter_state &state, double value);
+
+    const regression_detector_config config_;
+    std::vector<hwcpipe_counter> counters_;
+    std::vector<regression_direction> directions_;
+    std::vector<tag_state> tags_{};
+    // the tag whose baseline applies to the tags without one, or none
+    size_t any_tag_;
+    std::vector<regression_finding> findings_{};
+    uint64_t unmatched_{};
+    std::vector<double> staging_;
+};
+
+} // namespace hwcpipe
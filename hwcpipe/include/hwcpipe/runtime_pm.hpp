@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include "hwcpipe/error.hpp"
+#include "hwcpipe/types.hpp"
+
+#include <string>
+#include <system_error>
+
+namespace hwcpipe {
+
+/**
+ * @brief The runtime_status sysfs file of a Mali GPU.
+ *
+ * @param [in] device_number  The number of the GPU, as in /dev/mali0.
+ * @return "/sys/class/misc/mali<N>/device/power/runtime_status".
+ */
+HWCP_NODISCARD std::string runtime_pm_status_path(int device_number = 0);
+
+/**
+ * @brief A runtime_pm_probe reads the runtime power management state of the
+ * GPU, which the driver suspends when it is idle, so that the power-aware
+ * mode of a sampler doesn't wake it for a counter dump, see
+ * sampler_config::set_power_aware().
+ *
+ * The file is opened once and read with pread(), so a probe is a single
+ * syscall.
+ *
+ * @par
+ * @code
+ * hwcpipe::runtime_pm_probe probe{};
+ * if (probe) {
+ *     config.set_power_aware(true);
+ *     config.set_power_probe(&hwcpipe::runtime_pm_probe::probe, &probe);
+ * }
+ * @endcode
+ */
+class runtime_pm_probe {
+  public:
+    /**
+     * Opens the runtime_status file of a GPU.
+     *
+     * @param [in] path  The file, see runtime_pm_status_path().
+     */
+    explicit runtime_pm_probe(const std::string &path = runtime_pm_status_path());
+
+    ~runtime_pm_probe();
+
+    runtime_pm_probe(const runtime_pm_probe &) = delete;
+    runtime_pm_probe &operator=(const runtime_pm_probe &) = delete;
+
+    /** @return True if the state can be read. */
+    operator bool() const { return !ec_; }
+
+    /** @return hwcpipe::errc::runtime_pm_unavailable if the file could not be opened. */
+    HWCP_NODISCARD std::error_code get_error() const { return ec_; }
+
+    /**
+     * @return True if the GPU is suspended or being suspended. False if it is
+     * active, or if the state could not be read.
+     */
+    HWCP_NODISCARD bool is_suspended() const;
+
+    /** @brief A sampler_config::power_probe, whose user data is a runtime_pm_probe. */
+    static bool probe(void *user_data) { return static_cast<const runtime_pm_probe *>(user_data)->is_suspended(); }
+
+  private:
+    std::error_code ec_;
+    int fd_{-1};
+};
+
+} // namespace hwcpipe
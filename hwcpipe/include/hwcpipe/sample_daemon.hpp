@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include "hwcpipe/error.hpp"
+#include "hwcpipe/hwcpipe_counter.h"
+#include "hwcpipe/sampler.hpp"
+#include "hwcpipe/shared_sample_segment.hpp"
+#include "hwcpipe/types.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <system_error>
+#include <vector>
+
+namespace hwcpipe {
+
+/**
+ * The hand-shake between a sample daemon and its clients. A client connects
+ * to the daemon's Unix domain stream socket, and the daemon replies with one
+ * segment_message carrying the descriptor of its shared sample segment as
+ * SCM_RIGHTS ancillary data. From then on the client reads the segment
+ * directly and never talks to the daemon again, but keeps the connection open
+ * for as long as it reads: the daemon counts the open connections as its
+ * subscribers, and closing the connection unsubscribes.
+ */
+namespace daemon_protocol {
+
+/** 'HWCD' in little endian. */
+constexpr uint32_t magic = 0x44435748;
+
+/** The message sent with the segment descriptor. */
+struct segment_message {
+    uint32_t magic;
+    /** Size of the shared sample segment in bytes. */
+    uint32_t segment_size;
+};
+
+static_assert(sizeof(segment_message) == 8, "The segment message layout is part of the daemon protocol.");
+
+} // namespace daemon_protocol
+
+/**
+ * @brief A segment_server hands the descriptor of a shared sample segment to
+ * the clients connecting to a Unix domain socket. The listening socket is
+ * non-blocking, so the daemon can serve new clients between two samples. The
+ * connections of the clients are kept, and dropped when the clients close
+ * them, so num_subscribers() tells whether anybody reads the samples, e.g. to
+ * pause the sampling with an on_demand_session.
+ *
+ * @par
+ * @code
+ * hwcpipe::shared_sample_exporter exporter(counters, num_counters, history);
+ * hwcpipe::segment_server server(path, exporter.get_fd(), exporter.get_segment_size());
+ * while (running) {
+ *     server.serve_pending();
+ *     if (!sampler.sample_now()) {
+ *         ec = exporter.publish(sampler, list);
+ *     }
+ * }
+ * @endcode
+ */
+class segment_server {
+  public:
+    /**
+     * Binds and listens to a socket. A stale socket file at @p socket_path
+     * is replaced, but any other kind of file is left alone and makes the
+     * server invalid, with hwcpipe::errc::daemon_connection_failed. If the
+     * socket can't be created the server is invalid.
+     *
+     * @param [in] socket_path   The file system path of the socket.
+     * @param [in] segment_fd    The descriptor of the segment to hand out.
+     * @param [in] segment_size  The size of the segment in bytes.
+     */
+    segment_server(const std::string &socket_path, int segment_fd, size_t segment_size);
+
+    ~segment_server();
+
+    segment_server(const segment_server &) = delete;
+    segment_server &operator=(const segment_server &) = delete;
+
+    /** @return True if the server is listening. */
+    operator bool() const { return !ec_; }
+
+    /** @return The error that made the server invalid, if any. */
+    HWCP_NODISCARD std::error_code get_error() const { return ec_; }
+
+    /** @return The listening socket, e.g. to poll() it. Negative if the server is invalid. */
+    HWCP_NODISCARD int get_fd() const { return socket_; }
+
+    /**
+     * @brief Sends the segment to every client waiting to be accepted, and
+     * drops the connections that their clients closed.
+     *
+     * @param [in] timeout_ms  Time to wait for a client to connect or
+     *                         disconnect, e.g. while the sampling is paused.
+     *                         Zero, the default, doesn't block.
+     * @return The number of clients served.
+     */
+    size_t serve_pending(int timeout_ms = 0);
+
+    /** @return The number of clients connected. */
+    HWCP_NODISCARD size_t num_subscribers() const { return connections_.size(); }
+
+  private:
+    std::error_code ec_;
+    std::string path_;
+    int socket_{-1};
+    int segment_fd_;
+    size_t segment_size_;
+    std::vector<int> connections_{};
+};
+
+/**
+ * @brief A daemon_client reads the samples of a sample daemon with an API
+ * close to the sampler's one. It gets the daemon's shared sample segment once
+ * at construction; sample_now() and get_counter_value() are plain memory reads
+ * and never block the daemon.
+ *
+ * All the values are exported as doubles, so every counter_sample returned by
+ * a daemon_client has the float64 type.
+ *
+ * @par
+ * @code
+ * hwcpipe::daemon_client client("/tmp/hwcpipe.sock");
+ * while (client) {
+ *     if (!client.sample_now()) {
+ *         ec = client.get_counter_value(MaliGPUActiveCy, sample);
+ *     }
+ * }
+ * @endcode
+ */
+class daemon_client {
+  public:
+    /**
+     * Connects to a daemon and maps its segment. If that fails the client is
+     * invalid. The client is subscribed to the daemon until it is destroyed.
+     *
+     * @param [in] socket_path  The file system path of the daemon's socket.
+     */
+    explicit daemon_client(const std::string &socket_path);
+
+    ~daemon_client();
+
+    daemon_client(const daemon_client &) = delete;
+    daemon_client &operator=(const daemon_client &) = delete;
+
+    /** @return True if the daemon's segment is mapped. */
+    operator bool() const { return !ec_; }
+
+    /**
+     * @return hwcpipe::errc::daemon_connection_failed if the daemon could not be
+     * reached, hwcpipe::errc::invalid_segment_layout if its segment is not
+     * supported, otherwise an empty error_code.
+     */
+    HWCP_NODISCARD std::error_code get_error() const { return ec_; }
+
+    /** @return The number of counters exported by the daemon. */
+    HWCP_NODISCARD size_t size() const { return reader_.size(); }
+
+    /** @return Counter @p index of the daemon, in segment order. */
+    HWCP_NODISCARD hwcpipe_counter get_counter(size_t index) const {
+        return static_cast<hwcpipe_counter>(reader_.entry(index).counter);
+    }
+
+    /**
+     * @brief Copies the latest sample published by the daemon.
+     *
+     * @return hwcpipe::errc::sample_not_ready if the daemon published nothing
+     * since the previous call, or was publishing during the read,
+     * hwcpipe::errc::sample_collection_failure if the client is invalid.
+     */
+    HWCP_NODISCARD std::error_code sample_now();
+
+    /**
+     * @brief Fetches the value of a counter in the last read sample.
+     *
+     * @param [in]  counter  The counter to read.
+     * @param [out] sample   Populated with data from the counter.
+     * @return hwcpipe::errc::sample_collection_failure if nothing was read
+     * yet, hwcpipe::errc::unknown_counter if the daemon doesn't export the
+     * counter, otherwise an empty error_code.
+     */
+    HWCP_NODISCARD std::error_code get_counter_value(hwcpipe_counter counter, counter_sample &sample) const;
+
+    /** @return The timestamp of the last read sample, in nanoseconds. */
+    HWCP_NODISCARD uint64_t get_sample_timestamp() const { return timestamp_; }
+
+    /** @return The daemon's sample number of the last read sample. */
+    HWCP_NODISCARD uint64_t get_sample_number() const { return sample_number_; }
+
+    /**
+     * @return The segment reader, e.g. to walk the history ring with
+     * shared_sample_reader::try_read_sample().
+     */
+    HWCP_NODISCARD const shared_sample_reader &get_reader() const { return reader_; }
+
+  private:
+    std::error_code ec_;
+    int connection_{-1};
+    void *segment_{};
+    size_t segment_size_{};
+    shared_sample_reader reader_{nullptr, 0};
+    std::vector<double> values_{};
+    std::vector<double> scratch_{};
+    uint64_t timestamp_{};
+    uint64_t sample_number_{};
+};
+
+} // namespace hwcpipe
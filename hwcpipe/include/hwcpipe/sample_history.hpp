@@ -0,0 +1,380 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include "hwcpipe/detail/heap_bytes.hpp"
+#include "hwcpipe/detail/narrow_values.hpp"
+#include "hwcpipe/types.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <system_error>
+#include <vector>
+
+namespace hwcpipe {
+
+/** How a sample_history or a timeline_summary stores its values. */
+enum class history_storage : uint8_t {
+    /** 64-bit values: unsigned integers for hardware counters, doubles for derived ones. */
+    wide,
+    /**
+     * 32-bit values, which halves the memory and the bandwidth of a long
+     * history: hardware counter deltas as unsigned integers, with the rare
+     * deltas that don't fit kept aside, and derived values as floats.
+     */
+    compact,
+};
+
+/** The samples summed by a sample_history window query. */
+struct history_window {
+    /** Number of samples in the window. */
+    size_t num_samples;
+    /** Start of the first sample of the window, in nanoseconds. */
+    uint64_t timestamp_ns_begin;
+    /** End of the last sample of the window, in nanoseconds. */
+    uint64_t timestamp_ns_end;
+};
+
+/**
+ * @brief A sample_history keeps the last samples of a set of hardware counters
+ * as running per counter prefix sums, in a ring of fixed capacity. The sum of
+ * every counter over any window of the history is then the difference of two
+ * prefix sums, found by a binary search on the timestamps, however many
+ * samples the window spans. Derived metrics over the window, e.g. a ratio of
+ * two counters, are computed from the sums.
+ *
+ * The values are summed as unsigned 64-bit integers, so the prefix sums may
+ * wrap without making the differences wrong. Samples must be pushed in time
+ * order. When the ring is full the oldest sample is discarded. All storage is
+ * allocated at construction. A sample_history is not thread-safe.
+ *
+ * With history_storage::compact the history keeps the deltas of each sample
+ * as 32-bit values, narrowed by a vectorized pass when the sample is pushed,
+ * and the prefix sums only every checkpoint_interval samples. A window sum
+ * then also subtracts the deltas between each end of the window and the next
+ * checkpoint, at most checkpoint_interval samples per end. A delta that
+ * doesn't fit in 32 bits is kept aside, the only storage that is allocated
+ * after construction.
+ *
+ * @par
+ * @code
+ * hwcpipe::sample_history history(4096, num_counters);
+ *
+ * // after each sample
+ * ec = history.push(sampler, list);
+ *
+ * // the totals of the last 16 ms
+ * std::vector<uint64_t> sums(num_counters);
+ * const uint64_t end = history.newest_timestamp();
+ * const auto window = history.window_sums(end - 16000000, end, sums.data());
+ * @endcode
+ */
+class sample_history {
+  public:
+    /** Number of samples between two prefix sums of a compact history. */
+    static constexpr size_t checkpoint_interval = 64;
+
+    /**
+     * @brief Constructs a history.
+     *
+     * @param [in] capacity           Number of samples kept, at least one.
+     * @param [in] values_per_sample  Number of counter values per sample.
+     * @param [in] storage            How the samples are stored.
+     */
+    sample_history(size_t capacity, size_t values_per_sample, history_storage storage = history_storage::wide)
+        : capacity_(std::max<size_t>(capacity, 1))
+        , values_per_sample_(values_per_sample)
+        , storage_(storage)
+        , timestamps_begin_(capacity_)
+        , timestamps_end_(capacity_)
+        , prefix_sums_(storage == history_storage::wide ? capacity_ * values_per_sample : 0)
+        , deltas_(storage == history_storage::compact ? capacity_ * values_per_sample : 0)
+        , num_checkpoints_(storage == history_storage::compact
+                               ? (capacity_ + checkpoint_interval - 1) / checkpoint_interval + 1
+                               : 0)
+        , checkpoints_(num_checkpoints_ * values_per_sample)
+        , totals_(values_per_sample)
+        , staging_(values_per_sample) {}
+
+    /** @return The number of samples the history keeps. */
+    HWCP_NODISCARD size_t capacity() const { return capacity_; }
+
+    /** @return The number of counter values of each sample. */
+    HWCP_NODISCARD size_t values_per_sample() const { return values_per_sample_; }
+
+    /** @return The number of samples in the history. */
+    HWCP_NODISCARD size_t size() const { return size_; }
+
+    /** @return How the samples are stored. */
+    HWCP_NODISCARD history_storage storage() const { return storage_; }
+
+    /**
+     * @return The memory held by the history in bytes, allocated once when it
+     * is constructed, except for the escaped deltas of a compact history.
+     */
+    HWCP_NODISCARD size_t get_memory_footprint() const {
+        return sizeof(*this) + detail::heap_bytes(timestamps_begin_) + detail::heap_bytes(timestamps_end_) +
+               detail::heap_bytes(prefix_sums_) + detail::heap_bytes(deltas_) + detail::heap_bytes(checkpoints_) +
+               detail::heap_bytes(escapes_) + detail::heap_bytes(totals_) + detail::heap_bytes(staging_);
+    }
+
+    /** @return The start of the oldest sample, or zero if the history is empty. */
+    HWCP_NODISCARD uint64_t oldest_timestamp() const { return size_ == 0 ? 0 : timestamps_begin_[slot(0)]; }
+
+    /** @return The end of the newest sample, or zero if the history is empty. */
+    HWCP_NODISCARD uint64_t newest_timestamp() const { return size_ == 0 ? 0 : timestamps_end_[slot(size_ - 1)]; }
+
+    /**
+     * @brief Adds a sample, discarding the oldest one if the history is full.
+     *
+     * @param [in] timestamp_ns_begin  Start of the counter accumulation.
+     * @param [in] timestamp_ns_end    End of the counter accumulation.
+     * @param [in] values              values_per_sample() counter values.
+     */
+    void push(uint64_t timestamp_ns_begin, uint64_t timestamp_ns_end, const uint64_t *values) {
+        if (size_ == capacity_) {
+            head_ = head_ + 1 == capacity_ ? 0 : head_ + 1;
+            --size_;
+        }
+
+        const size_t index = slot(size_);
+        if (storage_ == history_storage::compact) {
+            push_compact(index, values);
+            ++pushed_;
+        } else {
+            // each slot holds the sums of the samples before it, so that the
+            // sums of a window ending at the newest sample need no extra slot
+            std::copy(totals_.begin(), totals_.end(), prefix_sums_.begin() + index * values_per_sample_);
+        }
+        for (size_t i = 0; i != values_per_sample_; ++i) {
+            totals_[i] += values[i];
+        }
+        timestamps_begin_[index] = timestamp_ns_begin;
+        timestamps_end_[index] = timestamp_ns_end;
+        ++size_;
+    }
+
+    /**
+     * @brief Adds the last sample of a sampler.
+     *
+     * @param [in] sampler  The sampler, after a successful sample.
+     * @param [in] list     A read list of the sampler with
+     *                      values_per_sample() hardware counters.
+     * @return The error of sampler::get_counter_values().
+     */
+    template <typename sampler_t, typename read_list_t>
+    HWCP_NODISCARD std::error_code push(const sampler_t &sampler, const read_list_t &list) {
+        auto ec = sampler.get_counter_values(list, staging_.data(), staging_.size());
+        if (ec) {
+            return ec;
+        }
+        push(sampler.get_sample_timestamp(), sampler.get_sample_timestamp_end(), staging_.data());
+        return {};
+    }
+
+    /**
+     * @brief Sums every counter over the samples that lie within a window,
+     * i.e. that start at or after @p begin_ns and end at or before
+     * @p end_ns.
+     *
+     * @param [in]  begin_ns  Start of the window, in nanoseconds.
+     * @param [in]  end_ns    End of the window, in nanoseconds.
+     * @param [out] sums      values_per_sample() sums, set to zero if no
+     *                        sample lies within the window.
+     * @return The samples that were summed.
+     */
+    HWCP_NODISCARD history_window window_sums(uint64_t begin_ns, uint64_t end_ns, uint64_t *sums) const {
+        // timestamps are increasing, so both bounds are binary searches
+        const size_t first = partition_point(timestamps_begin_, [begin_ns](uint64_t ts) { return ts < begin_ns; });
+        const size_t last = partition_point(timestamps_end_, [end_ns](uint64_t ts) { return ts <= end_ns; });
+        if (first >= last) {
+            std::fill(sums, sums + values_per_sample_, 0);
+            return {0, 0, 0};
+        }
+
+        if (storage_ == history_storage::compact) {
+            compact_prefix_sums(last, sums, false);
+            compact_prefix_sums(first, sums, true);
+            return {last - first, timestamps_begin_[slot(first)], timestamps_end_[slot(last - 1)]};
+        }
+        const uint64_t *from = prefix_sums_.data() + slot(first) * values_per_sample_;
+        const uint64_t *to = last == size_ ? totals_.data() : prefix_sums_.data() + slot(last) * values_per_sample_;
+        for (size_t i = 0; i != values_per_sample_; ++i) {
+            sums[i] = to[i] - from[i];
+        }
+        return {last - first, timestamps_begin_[slot(first)], timestamps_end_[slot(last - 1)]};
+    }
+
+    /**
+     * @brief Reads one sample of the history.
+     *
+     * @param [in]  index   Index of the sample, zero for the oldest.
+     * @param [out] values  values_per_sample() counter values.
+     * @return The sample.
+     */
+    HWCP_NODISCARD history_window get_sample(size_t index, uint64_t *values) const {
+        if (storage_ == history_storage::compact) {
+            const size_t index_slot = slot(index);
+            std::fill(values, values + values_per_sample_, 0);
+            add_deltas(index_slot, index_slot + 1, values, false);
+            return {1, timestamps_begin_[index_slot], timestamps_end_[index_slot]};
+        }
+        const size_t from = slot(index) * values_per_sample_;
+        const uint64_t *to =
+            index + 1 == size_ ? totals_.data() : prefix_sums_.data() + slot(index + 1) * values_per_sample_;
+        for (size_t i = 0; i != values_per_sample_; ++i) {
+            values[i] = to[i] - prefix_sums_[from + i];
+        }
+        return {1, timestamps_begin_[slot(index)], timestamps_end_[slot(index)]};
+    }
+
+    /**
+     * @brief Sums every counter over the samples of the last @p duration_ns
+     * nanoseconds of the history.
+     *
+     * @param [in]  duration_ns  Length of the window, in nanoseconds.
+     * @param [out] sums         values_per_sample() sums.
+     * @return The samples that were summed.
+     */
+    HWCP_NODISCARD history_window last_sums(uint64_t duration_ns, uint64_t *sums) const {
+        const uint64_t end = newest_timestamp();
+        return window_sums(end > duration_ns ? end - duration_ns : 0, end, sums);
+    }
+
+    /** @brief Removes every sample. */
+    void clear() {
+        head_ = 0;
+        size_ = 0;
+        pushed_ = 0;
+        std::fill(totals_.begin(), totals_.end(), 0);
+        escapes_.clear();
+    }
+
+  private:
+    // a delta of a compact history that doesn't fit in 32 bits
+    struct escape {
+        size_t slot;
+        size_t counter;
+        uint64_t value;
+    };
+
+    /** Stores a sample of a compact history in @p index, before it is added to the totals. */
+    void push_compact(size_t index, const uint64_t *values) {
+        if (pushed_ % checkpoint_interval == 0) {
+            const auto checkpoint = static_cast<size_t>(pushed_ / checkpoint_interval % num_checkpoints_);
+            std::copy(totals_.begin(), totals_.end(), checkpoints_.begin() + checkpoint * values_per_sample_);
+        }
+        if (!escapes_.empty()) {
+            escapes_.erase(std::remove_if(escapes_.begin(), escapes_.end(),
+                                          [index](const escape &entry) { return entry.slot == index; }),
+                           escapes_.end());
+        }
+        if (!detail::narrow_deltas(values, values_per_sample_, deltas_.data() + index * values_per_sample_)) {
+            for (size_t i = 0; i != values_per_sample_; ++i) {
+                if (values[i] >= detail::delta_escape) {
+                    escapes_.push_back({index, i, values[i]});
+                }
+            }
+        }
+    }
+
+    /**
+     * Adds to @p sums, or subtracts from them, the deltas of the slots
+     * [@p begin, @p end), which must not wrap around the ring.
+     */
+    void add_deltas(size_t begin, size_t end, uint64_t *sums, bool subtract) const {
+        for (size_t index = begin; index != end; ++index) {
+            const uint32_t *deltas = deltas_.data() + index * values_per_sample_;
+            if (subtract) {
+                detail::subtract_narrow_deltas(deltas, values_per_sample_, sums);
+            } else {
+                detail::add_narrow_deltas(deltas, values_per_sample_, sums);
+            }
+        }
+        for (const auto &entry : escapes_) {
+            if (entry.slot >= begin && entry.slot < end) {
+                const uint64_t rest = entry.value - detail::delta_escape;
+                sums[entry.counter] = subtract ? sums[entry.counter] - rest : sums[entry.counter] + rest;
+            }
+        }
+    }
+
+    /**
+     * Sets @p sums to the sums of a compact history before its @p index th
+     * oldest sample, or subtracts these from them. The sums are those of the
+     * next checkpoint, or the totals, minus the deltas of the samples from
+     * @p index to there, which are all still in the ring, unlike those before
+     * the previous checkpoint.
+     */
+    void compact_prefix_sums(size_t index, uint64_t *sums, bool subtract) const {
+        const uint64_t sample = pushed_ - size_ + index;
+        const uint64_t next = (sample + checkpoint_interval - 1) / checkpoint_interval;
+        const uint64_t end = std::min<uint64_t>(next * checkpoint_interval, pushed_);
+        const uint64_t *base = end == pushed_ ? totals_.data()
+                                              : checkpoints_.data() + next % num_checkpoints_ * values_per_sample_;
+        for (size_t i = 0; i != values_per_sample_; ++i) {
+            sums[i] = subtract ? sums[i] - base[i] : base[i];
+        }
+
+        // the slots of [sample, end) wrap around the ring at most once
+        const size_t first_slot = slot(index);
+        const auto count = static_cast<size_t>(end - sample);
+        const size_t contiguous = std::min(count, capacity_ - first_slot);
+        add_deltas(first_slot, first_slot + contiguous, sums, !subtract);
+        add_deltas(0, count - contiguous, sums, !subtract);
+    }
+
+    /** Returns the slot of the @p index th oldest sample. */
+    HWCP_NODISCARD size_t slot(size_t index) const {
+        const size_t pos = head_ + index;
+        return pos >= capacity_ ? pos - capacity_ : pos;
+    }
+
+    /**
+     * Returns the index of the oldest sample whose timestamp doesn't satisfy
+     * @p pred, or size() if they all do.
+     */
+    template <typename pred_t>
+    HWCP_NODISCARD size_t partition_point(const std::vector<uint64_t> &timestamps, pred_t pred) const {
+        size_t low = 0;
+        size_t high = size_;
+        while (low != high) {
+            const size_t mid = low + (high - low) / 2;
+            if (pred(timestamps[slot(mid)])) {
+                low = mid + 1;
+            } else {
+                high = mid;
+            }
+        }
+        return low;
+    }
+
+    const size_t capacity_;
+    const size_t values_per_sample_;
+    const history_storage storage_;
+    std::vector<uint64_t> timestamps_begin_;
+    std::vector<uint64_t> timestamps_end_;
+    // wide storage: the sums of the samples before each slot
+    std::vector<uint64_t> prefix_sums_;
+    // compact storage: the deltas of each slot, a ring of the sums before
+    // every checkpoint_interval th sample, and the deltas that don't fit
+    std::vector<uint32_t> deltas_;
+    const size_t num_checkpoints_;
+    std::vector<uint64_t> checkpoints_;
+    std::vector<escape> escapes_;
+    // the sums of every sample pushed, i.e. the prefix sums after the newest
+    std::vector<uint64_t> totals_;
+    std::vector<uint64_t> staging_;
+    size_t head_{};
+    size_t size_{};
+    // compact storage: the samples pushed since the history was cleared, the
+    // next one starting a checkpoint interval when it is a multiple of it
+    uint64_t pushed_{};
+};
+
+} // namespace hwcpipe
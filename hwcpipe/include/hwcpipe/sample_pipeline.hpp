@@ -0,0 +1,646 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include "hwcpipe/detail/spsc_ring.hpp"
+#include "hwcpipe/error.hpp"
+#include "hwcpipe/sample_stream.hpp"
+#include "hwcpipe/sampler.hpp"
+#include "hwcpipe/sampler_stats.hpp"
+#include "hwcpipe/types.hpp"
+
+#include <device/constants.hpp>
+#include <device/hwcnt/block_extents.hpp>
+#include <device/hwcnt/block_metadata.hpp>
+#include <device/hwcnt/features.hpp>
+#include <device/hwcnt/sample.hpp>
+#include <device/hwcnt/sampler/configuration.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace hwcpipe {
+
+namespace detail {
+namespace staged {
+
+/** A kernel sample copied out of the mapped ring buffer by the collector. */
+struct raw_sample {
+    device::hwcnt::sample_metadata metadata;
+    std::vector<device::hwcnt::block_metadata> blocks;
+    // the values of the blocks, which blocks[i].values point into
+    std::vector<uint64_t> values;
+    size_t num_blocks;
+};
+
+/**
+ * The raw samples staged for one decode worker, with the GPU they were
+ * read from, which the worker's sampler decodes them as.
+ */
+class channel {
+  public:
+    channel(const device::constants &constants, const device::hwcnt::block_extents &extents,
+            const device::hwcnt::features &features, size_t depth)
+        : constants_(constants)
+        , extents_(extents)
+        , features_(features)
+        , block_size_(extents.counters_per_block() *
+                      (extents.values_type() == device::hwcnt::sample_values_type::uint64 ? 8U : 4U))
+        , ring_(depth, raw_sample{{},
+                                  std::vector<device::hwcnt::block_metadata>(extents.num_blocks()),
+                                  std::vector<uint64_t>((extents.num_blocks() * block_size_ + 7) / 8),
+                                  0}) {}
+
+    const device::constants &get_constants() const { return constants_; }
+    const device::hwcnt::block_extents &get_block_extents() const { return extents_; }
+    const device::hwcnt::features &get_features() const { return features_; }
+
+    /** @return The size of the values of a block in bytes. */
+    size_t block_size() const { return block_size_; }
+
+    spsc_ring<raw_sample> &ring() { return ring_; }
+    const spsc_ring<raw_sample> &ring() const { return ring_; }
+
+  private:
+    device::constants constants_;
+    device::hwcnt::block_extents extents_;
+    device::hwcnt::features features_;
+    size_t block_size_;
+    spsc_ring<raw_sample> ring_;
+};
+
+/** Backend handle of a channel. */
+class handle {
+  public:
+    using handle_ptr = std::unique_ptr<handle>;
+
+    explicit handle(channel &source)
+        : channel_(source) {}
+
+    /** Channels are not registered under a device number, samplers are given their handle. */
+    static handle_ptr create(int) { return nullptr; }
+
+    channel &get_channel() const { return channel_; }
+
+  private:
+    channel &channel_;
+};
+
+/** Backend instance of a channel: the GPU its samples were read from. */
+class instance {
+  public:
+    using instance_ptr = std::unique_ptr<instance>;
+
+    explicit instance(channel &source)
+        : channel_(source) {}
+
+    static instance_ptr create(handle &hndl) { return std::make_unique<instance>(hndl.get_channel()); }
+
+    const device::constants &get_constants() const { return channel_.get_constants(); }
+
+    const device::hwcnt::block_extents &get_hwcnt_block_extents() const { return channel_.get_block_extents(); }
+
+    channel &get_channel() const { return channel_; }
+
+  private:
+    channel &channel_;
+};
+
+/** A view over the blocks of a raw sample. */
+class block_view {
+  public:
+    using iterator = const device::hwcnt::block_metadata *;
+
+    block_view(iterator begin, iterator end)
+        : begin_(begin)
+        , end_(end) {}
+
+    iterator begin() const { return begin_; }
+    iterator end() const { return end_; }
+
+  private:
+    iterator begin_;
+    iterator end_;
+};
+
+/**
+ * Backend reader of a channel. Samples are ready when the collector staged
+ * them, and are numbered in the order the worker reads them: the collector's
+ * sampler already counted the samples that the kernel dropped.
+ */
+class reader {
+  public:
+    explicit reader(channel &source)
+        : channel_(source) {}
+
+    std::error_code is_sample_ready(bool &ready) const {
+        ready = channel_.ring().readable();
+        return {};
+    }
+
+    std::error_code is_sample_ready(bool &ready, uint64_t timeout_ns) {
+        ready = channel_.ring().wait_readable(std::chrono::nanoseconds(timeout_ns));
+        return {};
+    }
+
+    const device::hwcnt::features &get_features() const { return channel_.get_features(); }
+
+    HWCP_NODISCARD std::error_code get_sample(device::hwcnt::sample_metadata &metadata) {
+        sample_ = channel_.ring().acquire_read();
+        if (sample_ == nullptr) {
+            return std::make_error_code(std::errc::no_message_available);
+        }
+        metadata = sample_->metadata;
+        metadata.sample_nr = ++sample_nr_;
+        return {};
+    }
+
+    void put_sample() {
+        channel_.ring().release();
+        sample_ = nullptr;
+    }
+
+    block_view blocks() const {
+        const auto *blocks = sample_->blocks.data();
+        return {blocks, blocks + sample_->num_blocks};
+    }
+
+  private:
+    channel &channel_;
+    const raw_sample *sample_{};
+    uint64_t sample_nr_{};
+};
+
+/** A sample of a channel: the oldest staged raw sample. */
+class sample {
+  public:
+    sample(reader &reader, std::error_code &ec)
+        : reader_(reader)
+        , ec_(ec) {
+        ec_ = reader_.get_sample(metadata_);
+    }
+
+    ~sample() {
+        if (!ec_) {
+            reader_.put_sample();
+        }
+    }
+
+    const device::hwcnt::sample_metadata &get_metadata() const { return metadata_; }
+
+    block_view blocks() const { return reader_.blocks(); }
+
+  private:
+    reader &reader_;
+    std::error_code &ec_;
+    device::hwcnt::sample_metadata metadata_{};
+};
+
+/** Backend manual sampler of a channel. Requests are for the samples the collector staged. */
+class manual_sampler {
+  public:
+    manual_sampler(const instance &inst, const device::hwcnt::sampler::configuration *, size_t, uint32_t = 0)
+        : reader_(inst.get_channel()) {}
+
+    operator bool() const { return true; }
+
+    std::error_code accumulation_start() { return {}; }
+    std::error_code accumulation_stop(uint64_t) { return {}; }
+    std::error_code request_sample(uint64_t) { return {}; }
+    std::error_code request_sample_async(uint64_t) { return {}; }
+
+    reader &get_reader() { return reader_; }
+
+  private:
+    reader reader_;
+};
+
+/** Backend periodic sampler of a channel. The period and the buffer count are the collector's. */
+class periodic_sampler {
+  public:
+    periodic_sampler(const instance &inst, uint64_t, const device::hwcnt::sampler::configuration *, size_t,
+                     uint32_t = 0)
+        : reader_(inst.get_channel()) {}
+
+    operator bool() const { return true; }
+
+    std::error_code sampling_start(uint64_t) { return {}; }
+    std::error_code sampling_stop(uint64_t) { return {}; }
+
+    reader &get_reader() { return reader_; }
+
+  private:
+    reader reader_;
+};
+
+/** Accumulates the pipeline_stage_stats of a stage, written by its thread. */
+struct stage_counters {
+    void add_sample() { samples.store(samples.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed); }
+    void add_stall() { stalls.store(stalls.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed); }
+
+    std::atomic<uint64_t> samples{};
+    std::atomic<uint64_t> stalls{};
+    sampler_stats_counters::timing busy{};
+};
+
+} // namespace staged
+} // namespace detail
+
+/** The backend policy of the hwcpipe::sampler of a decode worker of a sample_pipeline. */
+struct staged_sample_policy {
+    using handle_type = detail::staged::handle;
+    using instance_type = detail::staged::instance;
+    using sampler_type = detail::staged::manual_sampler;
+    using periodic_sampler_type = detail::staged::periodic_sampler;
+    using sample_type = detail::staged::sample;
+};
+
+/** The stages and rings of a sample_pipeline. */
+struct sample_pipeline_config {
+    /**
+     * Number of decode workers, or zero for one per hardware thread left by
+     * the collector and delivery threads.
+     */
+    size_t num_decode_workers{0};
+    /** Raw samples staged for each decode worker, a power of two. */
+    size_t staging_depth{16};
+    /** Decoded samples queued by each decode worker for delivery, a power of two. */
+    size_t output_depth{64};
+};
+
+/** What went through a stage of a sample_pipeline. */
+struct pipeline_stage_stats {
+    /** Samples that the stage passed on. */
+    uint64_t samples;
+    /** Times the stage found the ring to the next stage full. */
+    uint64_t stalls;
+    /** Time spent on the samples, without the waits for the other stages. */
+    sampler_timing busy;
+};
+
+/** The statistics of each stage of a sample_pipeline, as returned by sample_pipeline::get_stats(). */
+struct sample_pipeline_stats {
+    /** The collector: samples copied out of the kernel buffer. */
+    pipeline_stage_stats collect;
+    /** The decode workers, summed: samples decoded and evaluated. */
+    pipeline_stage_stats decode;
+    /** The delivery thread: samples given to the callback. */
+    pipeline_stage_stats deliver;
+    /** Staged samples that a decode worker failed to decode. */
+    uint64_t rejected;
+};
+
+/**
+ * @brief A sample_pipeline splits the sampling into stages on their own
+ * threads, so that the sampling rate isn't bound by one thread doing the
+ * system calls, the decoding, the evaluation and the export of each sample.
+ *
+ * - The collector, a thread of the application, calls collect(). It reads a
+ *   sample of the source sampler with sampler::sample_raw(), copies its
+ *   blocks out of the mapped kernel buffer into a staging ring and gives the
+ *   kernel buffer back at once.
+ * - Decode workers each own a hwcpipe::sampler<staged_sample_policy>, made
+ *   from the sampler_config of the source, which decodes the staged samples
+ *   and evaluates their expressions. The read list of the pipeline's
+ *   counters is then queued for delivery. The collector hands the samples
+ *   to the workers in turn.
+ * - The delivery thread calls the callback with the decoded samples, in the
+ *   order they were collected, e.g. to export them.
+ *
+ * The stages are connected by lock-free single-producer single-consumer
+ * rings, allocated at construction. When a worker falls behind, its staging
+ * ring fills up and collect() leaves the sample in the kernel buffer; when
+ * the callback falls behind, the workers wait for it. get_stats() reports
+ * the samples, stalls and busy time of each stage, to tell which one limits
+ * the rate.
+ *
+ * Merged samples and multi-rate plans carry state from a sample to the
+ * next, so a pipeline whose config enables them has one decode worker.
+ *
+ * @par
+ * @code
+ * void upload(void *connection, const hwcpipe::stream_sample &sample);
+ *
+ * hwcpipe::sampler<> source(config);
+ * hwcpipe::sample_pipeline<> pipeline(source, config, counters, num_counters, {}, upload, &connection);
+ * ec = source.start_sampling();
+ * while (running) {
+ *     ec = pipeline.collect(source);
+ * }
+ * ec = source.stop_sampling();
+ * pipeline.close();
+ * @endcode
+ *
+ * @tparam source_sampler_t  The type of the sampler that collect() reads.
+ */
+template <typename source_sampler_t = sampler<>>
+class sample_pipeline {
+  public:
+    /** Callback receiving the decoded samples, on the delivery thread. */
+    using sample_callback = sample_stream::sample_callback;
+
+    /**
+     * @brief Constructs a pipeline and starts its threads.
+     *
+     * @param [in] source           The sampler that collect() reads, whose
+     *                              GPU the workers decode the samples of.
+     * @param [in] config           The config of @p source.
+     * @param [in] counters         The counters delivered, in output order.
+     * @param [in] num_counters     Number of entries in @p counters.
+     * @param [in] pipeline_config  The stages and rings.
+     * @param [in] callback         The callback receiving the samples.
+     * @param [in] user_data        Passed to the callback.
+     */
+    sample_pipeline(const source_sampler_t &source, const sampler_config &config, const hwcpipe_counter *counters,
+                    size_t num_counters, const sample_pipeline_config &pipeline_config, sample_callback callback,
+                    void *user_data)
+        : num_values_(num_counters)
+        , callback_(callback)
+        , user_data_(user_data) {
+        size_t num_workers = pipeline_config.num_decode_workers;
+        if (num_workers == 0) {
+            const size_t threads = std::thread::hardware_concurrency();
+            num_workers = threads > 3 ? threads - 2 : 1;
+        }
+        if (config.get_coalesced_samples() > 1 || config.get_slow_period() > 1) {
+            num_workers = 1;
+        }
+
+        const auto extents = to_block_extents(source.get_block_extents());
+        for (size_t i = 0; i != num_workers; ++i) {
+            workers_.push_back(std::make_unique<worker>(source, extents, config, pipeline_config, num_counters));
+            auto &added = *workers_.back();
+            if (!added.decoder) {
+                ec_ = make_error_code(errc::backend_creation_failed);
+                return;
+            }
+            added.list = added.decoder.make_read_list(counters, num_counters, ec_);
+            if (!ec_) {
+                ec_ = added.decoder.start_sampling();
+            }
+            if (ec_) {
+                return;
+            }
+        }
+
+        for (auto &decode : workers_) {
+            worker *target = decode.get();
+            decode->thread = std::thread([this, target] { run_decoder(*target); });
+        }
+        delivery_ = std::thread([this] { run_delivery(); });
+    }
+
+    /** Closes the pipeline, see close(). */
+    ~sample_pipeline() { close(); }
+
+    sample_pipeline(const sample_pipeline &) = delete;
+    sample_pipeline &operator=(const sample_pipeline &) = delete;
+
+    /** @return True if the pipeline was set up. */
+    operator bool() const { return !ec_; }
+
+    /** @return The error that set up failed with, otherwise an empty error_code. */
+    HWCP_NODISCARD std::error_code get_error() const { return ec_; }
+
+    /** @return The number of decode workers. */
+    HWCP_NODISCARD size_t num_decode_workers() const { return workers_.size(); }
+
+    /**
+     * @brief Collector: reads the next sample of @p source, see
+     * sampler::sample_raw(), and stages it for the next decode worker.
+     *
+     * @param [in] source     The sampler the pipeline was constructed with.
+     * @param [in] user_data  A tag stored with a manual sample.
+     * @return hwcpipe::errc::stream_closed if the pipeline is closed or
+     * invalid, hwcpipe::errc::sample_not_ready if the worker's staging ring
+     * is full, in which case no sample was read, otherwise the error of
+     * sampler::sample_raw().
+     */
+    HWCP_NODISCARD std::error_code collect(source_sampler_t &source, uint64_t user_data = 0) {
+        if (ec_ || closed_) {
+            return make_error_code(errc::stream_closed);
+        }
+
+        auto &staging = workers_[next_worker_]->staging;
+        auto *slot = staging.ring().acquire_write();
+        if (slot == nullptr) {
+            collect_.add_stall();
+            return make_error_code(errc::sample_not_ready);
+        }
+
+        const auto begin = detail::sampler_stats_counters::clock::now();
+        auto ec = source.sample_raw(
+            [&](const auto &metadata, const auto &blocks) {
+                slot->metadata = metadata;
+                size_t count = 0;
+                auto *values = reinterpret_cast<uint8_t *>(slot->values.data());
+                for (const auto &block : blocks) {
+                    if (count == slot->blocks.size()) {
+                        break;
+                    }
+                    auto &staged = slot->blocks[count];
+                    staged = block;
+                    staged.values = values + count * staging.block_size();
+                    std::memcpy(values + count * staging.block_size(), block.values, staging.block_size());
+                    ++count;
+                }
+                slot->num_blocks = count;
+            },
+            user_data);
+        if (ec) {
+            return ec;
+        }
+        staging.ring().publish();
+        collect_.busy.add(begin);
+        collect_.add_sample();
+        next_worker_ = next_worker_ + 1 == workers_.size() ? 0 : next_worker_ + 1;
+        return {};
+    }
+
+    /**
+     * @brief Closes the pipeline: the staged samples are decoded and
+     * delivered, and the threads are joined. Must be called by the collector,
+     * or once it stopped. Further collects fail.
+     */
+    void close() {
+        if (closed_) {
+            return;
+        }
+        closed_ = true;
+        for (auto &decode : workers_) {
+            decode->staging.ring().close();
+        }
+        for (auto &decode : workers_) {
+            if (decode->thread.joinable()) {
+                decode->thread.join();
+            }
+        }
+        if (delivery_.joinable()) {
+            delivery_.join();
+        }
+    }
+
+    /** @return The statistics of each stage, which may be read from any thread. */
+    HWCP_NODISCARD sample_pipeline_stats get_stats() const {
+        sample_pipeline_stats stats{};
+        stats.collect = get(collect_);
+        stats.deliver = get(deliver_);
+        for (const auto &decode : workers_) {
+            const auto worker_stats = get(decode->counters);
+            stats.decode.samples += worker_stats.samples;
+            stats.decode.stalls += worker_stats.stalls;
+            stats.decode.busy.count += worker_stats.busy.count;
+            stats.decode.busy.total_ns += worker_stats.busy.total_ns;
+            stats.decode.busy.max_ns = std::max(stats.decode.busy.max_ns, worker_stats.busy.max_ns);
+            stats.rejected += decode->rejected.load(std::memory_order_relaxed);
+        }
+        return stats;
+    }
+
+  private:
+    // how long the threads sleep before they check whether they were closed
+    static constexpr std::chrono::milliseconds wait_timeout{10};
+
+    // a sample decoded by a worker; a rejected one is delivered as invalid so
+    // that the delivery keeps the order of the workers
+    struct decoded_sample {
+        uint64_t timestamp_ns_begin;
+        uint64_t timestamp_ns_end;
+        std::vector<double> values;
+        bool valid;
+    };
+
+    struct worker {
+        worker(const source_sampler_t &source, const device::hwcnt::block_extents &extents,
+               const sampler_config &config, const sample_pipeline_config &pipeline_config, size_t num_values)
+            : staging(source.get_constants(), extents, source.get_features(), pipeline_config.staging_depth)
+            , handle(staging)
+            , decoder(config, handle)
+            , output(pipeline_config.output_depth, decoded_sample{0, 0, std::vector<double>(num_values), false}) {}
+
+        detail::staged::channel staging;
+        detail::staged::handle handle;
+        sampler<staged_sample_policy> decoder;
+        read_list list{};
+        detail::spsc_ring<decoded_sample> output;
+        detail::staged::stage_counters counters{};
+        std::atomic<uint64_t> rejected{};
+        std::thread thread{};
+    };
+
+    /** @return The extents of a sampler as a device::hwcnt::block_extents. */
+    template <typename extents_t>
+    static device::hwcnt::block_extents to_block_extents(const extents_t &extents) {
+        device::hwcnt::block_extents::num_blocks_of_type_type num_blocks{};
+        for (size_t i = 0; i != num_blocks.size(); ++i) {
+            num_blocks[i] = extents.num_blocks_of_type(static_cast<device::hwcnt::block_type>(i));
+        }
+        return {num_blocks, extents.counters_per_block(), extents.values_type()};
+    }
+
+    static pipeline_stage_stats get(const detail::staged::stage_counters &counters) {
+        return {counters.samples.load(std::memory_order_relaxed), counters.stalls.load(std::memory_order_relaxed),
+                counters.busy.get()};
+    }
+
+    void run_decoder(worker &decode) {
+        auto &input = decode.staging.ring();
+        for (;;) {
+            if (!input.wait_readable(wait_timeout)) {
+                if (input.closed() && !input.readable()) {
+                    break;
+                }
+                continue;
+            }
+
+            decoded_sample *out = decode.output.acquire_write();
+            if (out == nullptr) {
+                decode.counters.add_stall();
+                while ((out = decode.output.acquire_write()) == nullptr) {
+                    decode.output.wait_writable(wait_timeout);
+                }
+            }
+
+            const auto begin = detail::sampler_stats_counters::clock::now();
+            auto ec = decode.decoder.sample_now_for(0);
+            // a sample that didn't complete a window of merged samples
+            if (ec == make_error_code(errc::sample_not_ready)) {
+                continue;
+            }
+            if (!ec) {
+                ec = decode.decoder.get_counter_values(decode.list, out->values.data(), out->values.size());
+            }
+            out->valid = !ec;
+            out->timestamp_ns_begin = decode.decoder.get_sample_timestamp();
+            out->timestamp_ns_end = decode.decoder.get_sample_timestamp_end();
+            decode.output.publish();
+            decode.counters.busy.add(begin);
+            if (ec) {
+                decode.rejected.store(decode.rejected.load(std::memory_order_relaxed) + 1,
+                                      std::memory_order_relaxed);
+            } else {
+                decode.counters.add_sample();
+            }
+        }
+        decode.output.close();
+    }
+
+    void run_delivery() {
+        size_t next = 0;
+        for (;;) {
+            auto &output = workers_[next]->output;
+            const decoded_sample *sample = output.acquire_read();
+            if (sample == nullptr) {
+                // the sample due next was never staged, so neither was any
+                // sample after it
+                if (output.closed() && !output.readable()) {
+                    break;
+                }
+                output.wait_readable(wait_timeout);
+                continue;
+            }
+
+            const auto begin = detail::sampler_stats_counters::clock::now();
+            if (sample->valid) {
+                callback_(user_data_, stream_sample{sample->timestamp_ns_begin, sample->timestamp_ns_end,
+                                                    sample->values.data(), num_values_, 1});
+                deliver_.add_sample();
+            }
+            output.release();
+            deliver_.busy.add(begin);
+            next = next + 1 == workers_.size() ? 0 : next + 1;
+        }
+    }
+
+    const size_t num_values_;
+    const sample_callback callback_;
+    void *const user_data_;
+    std::error_code ec_{};
+    std::vector<std::unique_ptr<worker>> workers_{};
+    std::thread delivery_{};
+
+    // owned by the collector
+    size_t next_worker_{};
+    bool closed_{};
+    detail::staged::stage_counters collect_{};
+
+    // owned by the delivery thread
+    detail::staged::stage_counters deliver_{};
+};
+
+template <typename source_sampler_t>
+constexpr std::chrono::milliseconds sample_pipeline<source_sampler_t>::wait_timeout;
+
+} // namespace hwcpipe
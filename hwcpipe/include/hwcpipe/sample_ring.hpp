@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include "hwcpipe/detail/heap_bytes.hpp"
+#include "hwcpipe/types.hpp"
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace hwcpipe {
+
+/**
+ * @brief A sample_ring is a lock-free single-producer single-consumer ring of
+ * decoded samples. Each slot holds a timestamp and a fixed number of counter
+ * values, typically filled by sampler::get_counter_values() from a read_list.
+ * All storage is allocated at construction so neither side allocates or takes
+ * a lock while sampling.
+ *
+ * Exactly one thread may call the producer functions (acquire_write() and
+ * publish()) and exactly one thread may call the consumer functions
+ * (acquire_read() and release()).
+ *
+ * @par
+ * @code
+ * // collector thread
+ * if (double *values = ring.acquire_write()) {
+ *     if (!sampler.sample_now() && !sampler.get_counter_values(list, values, ring.values_per_sample())) {
+ *         ring.publish(sampler.get_sample_timestamp());
+ *     }
+ * }
+ *
+ * // consumer thread
+ * uint64_t timestamp{};
+ * if (const double *values = ring.acquire_read(timestamp)) {
+ *     process(timestamp, values);
+ *     ring.release();
+ * }
+ * @endcode
+ */
+class sample_ring {
+  public:
+    /**
+     * @brief Constructs a ring.
+     *
+     * @param [in] capacity           Number of slots, must be a power of two.
+     * @param [in] values_per_sample  Number of counter values per slot.
+     */
+    sample_ring(size_t capacity, size_t values_per_sample)
+        : capacity_(capacity)
+        , values_per_sample_(values_per_sample)
+        , values_(capacity * values_per_sample)
+        , timestamps_(capacity) {
+        assert(capacity != 0 && (capacity & (capacity - 1)) == 0);
+    }
+
+    sample_ring(const sample_ring &) = delete;
+    sample_ring &operator=(const sample_ring &) = delete;
+
+    /** @return The number of slots in the ring. */
+    HWCP_NODISCARD size_t capacity() const { return capacity_; }
+
+    /** @return The number of counter values held by each slot. */
+    HWCP_NODISCARD size_t values_per_sample() const { return values_per_sample_; }
+
+    /** @return The memory held by the ring in bytes, allocated once when it is constructed. */
+    HWCP_NODISCARD size_t get_memory_footprint() const {
+        return sizeof(*this) + detail::heap_bytes(values_) + detail::heap_bytes(timestamps_);
+    }
+
+    /**
+     * @brief Producer: returns the values of the next free slot, or nullptr if
+     * the ring is full. The slot becomes visible to the consumer once
+     * publish() is called.
+     */
+    HWCP_NODISCARD double *acquire_write() {
+        const auto head = head_.value.load(std::memory_order_relaxed);
+        if (head - cached_tail_ == capacity_) {
+            cached_tail_ = tail_.value.load(std::memory_order_acquire);
+            if (head - cached_tail_ == capacity_) {
+                return nullptr;
+            }
+        }
+        return slot_values(head);
+    }
+
+    /**
+     * @brief Producer: publishes the slot returned by the last call to
+     * acquire_write().
+     *
+     * @param [in] timestamp  The timestamp of the sample.
+     */
+    void publish(uint64_t timestamp) {
+        const auto head = head_.value.load(std::memory_order_relaxed);
+        assert(head - tail_.value.load(std::memory_order_relaxed) < capacity_);
+        timestamps_[head & (capacity_ - 1)] = timestamp;
+        head_.value.store(head + 1, std::memory_order_release);
+    }
+
+    /**
+     * @brief Consumer: returns the values of the oldest published slot, or
+     * nullptr if the ring is empty. The slot stays valid until release() is
+     * called.
+     *
+     * @param [out] timestamp  Set to the timestamp of the sample.
+     */
+    HWCP_NODISCARD const double *acquire_read(uint64_t &timestamp) {
+        const auto tail = tail_.value.load(std::memory_order_relaxed);
+        if (tail == cached_head_) {
+            cached_head_ = head_.value.load(std::memory_order_acquire);
+            if (tail == cached_head_) {
+                return nullptr;
+            }
+        }
+        timestamp = timestamps_[tail & (capacity_ - 1)];
+        return slot_values(tail);
+    }
+
+    /**
+     * @brief Consumer: hands the slot returned by the last call to
+     * acquire_read() back to the producer.
+     */
+    void release() {
+        const auto tail = tail_.value.load(std::memory_order_relaxed);
+        assert(tail != head_.value.load(std::memory_order_relaxed));
+        tail_.value.store(tail + 1, std::memory_order_release);
+    }
+
+  private:
+    static constexpr size_t cache_line_size = 64;
+
+    // an index padded to a full cache line so that the producer and consumer
+    // indices never share a line
+    struct padded_index {
+        std::atomic<size_t> value{0};
+        char padding[cache_line_size - sizeof(std::atomic<size_t>)];
+    };
+
+    HWCP_NODISCARD double *slot_values(size_t index) {
+        return values_.data() + (index & (capacity_ - 1)) * values_per_sample_;
+    }
+
+    const size_t capacity_;
+    const size_t values_per_sample_;
+    std::vector<double> values_;
+    std::vector<uint64_t> timestamps_;
+
+    // written by the producer
+    padded_index head_{};
+    size_t cached_tail_{};
+    char producer_padding_[cache_line_size - sizeof(size_t)]{};
+
+    // written by the consumer
+    padded_index tail_{};
+    size_t cached_head_{};
+};
+
+} // namespace hwcpipe
@@ -0,0 +1,319 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include "hwcpipe/error.hpp"
+#include "hwcpipe/types.hpp"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <system_error>
+#include <vector>
+
+namespace hwcpipe {
+
+/** What a sample_stream does with a new sample when its queue is full. */
+enum class backpressure_policy : uint8_t {
+    /** The oldest queued sample is dropped to make room. */
+    drop_oldest,
+    /** The new sample is dropped. */
+    drop_newest,
+    /** The producer waits until the consumer has made room. */
+    block,
+    /**
+     * The values of the new sample are added to the newest queued sample,
+     * whose end timestamp is moved to the new sample's. This is only
+     * meaningful for values that are deltas, i.e. hardware counters, not
+     * ratios or other derived counters.
+     */
+    coalesce,
+};
+
+/** A sample delivered by a sample_stream. */
+struct stream_sample {
+    /** Start of the counter accumulation, in nanoseconds. */
+    uint64_t timestamp_ns_begin;
+    /** End of the counter accumulation, in nanoseconds. */
+    uint64_t timestamp_ns_end;
+    /** The counter values, valid until the callback returns. */
+    const double *values;
+    /** Number of counter values. */
+    size_t num_values;
+    /** Number of samples summed into this one, 1 unless they were coalesced. */
+    uint32_t num_samples;
+};
+
+/** The samples that went through a sample_stream. */
+struct sample_stream_stats {
+    /** Samples pushed by the producer. */
+    uint64_t pushed;
+    /** Samples delivered to the callback, counting coalesced ones once. */
+    uint64_t delivered;
+    /** Samples dropped by backpressure_policy::drop_oldest or drop_newest. */
+    uint64_t dropped;
+    /** Samples added to a queued sample by backpressure_policy::coalesce. */
+    uint64_t coalesced;
+};
+
+/**
+ * @brief A sample_stream pushes decoded samples from the collector thread to a
+ * callback. The samples are queued in a bounded queue, and the backpressure
+ * policy chosen at construction tells what happens when the consumer falls
+ * behind and the queue is full. The memory used and the latency of the
+ * samples are then bounded however slow the consumer is, e.g. a network
+ * upload or a disk write. All storage is allocated at construction.
+ *
+ * One collector thread calls push(). The callback runs on the thread that
+ * calls run() or dispatch(), only one thread may do so at a time. With
+ * backpressure_policy::block, a consumer that stalls stalls the collector,
+ * and a periodic sampler then drops samples in the kernel instead.
+ *
+ * @par
+ * @code
+ * void upload(void *connection, const hwcpipe::stream_sample &sample);
+ *
+ * auto list = sampler.make_read_list(counters, num_counters, ec);
+ * hwcpipe::sample_stream stream(64, num_counters, hwcpipe::backpressure_policy::coalesce, upload, &connection);
+ * std::thread consumer([&stream] { stream.run(); });
+ *
+ * // collector thread
+ * while (running) {
+ *     if (!sampler.sample_now()) {
+ *         ec = stream.push(sampler, list);
+ *     }
+ * }
+ * stream.close();
+ * consumer.join();
+ * @endcode
+ */
+class sample_stream {
+  public:
+    /** Callback receiving the samples of a stream. */
+    using sample_callback = void (*)(void *user_data, const stream_sample &sample);
+
+    /**
+     * @brief Constructs a stream.
+     *
+     * @param [in] depth              Number of samples the queue holds, at
+     *                                least one.
+     * @param [in] values_per_sample  Number of counter values per sample.
+     * @param [in] policy             What to do when the queue is full.
+     * @param [in] callback           The callback receiving the samples.
+     * @param [in] user_data          Passed to the callback.
+     */
+    sample_stream(size_t depth, size_t values_per_sample, backpressure_policy policy, sample_callback callback,
+                  void *user_data)
+        : depth_(std::max<size_t>(depth, 1))
+        , values_per_sample_(values_per_sample)
+        , policy_(policy)
+        , callback_(callback)
+        , user_data_(user_data)
+        , slots_(depth_)
+        , values_(depth_ * values_per_sample)
+        , staging_(values_per_sample)
+        , delivery_(values_per_sample) {}
+
+    sample_stream(const sample_stream &) = delete;
+    sample_stream &operator=(const sample_stream &) = delete;
+
+    /** @return The number of samples the queue holds. */
+    HWCP_NODISCARD size_t depth() const { return depth_; }
+
+    /** @return The number of counter values of each sample. */
+    HWCP_NODISCARD size_t values_per_sample() const { return values_per_sample_; }
+
+    /** @return The policy applied when the queue is full. */
+    HWCP_NODISCARD backpressure_policy get_policy() const { return policy_; }
+
+    /**
+     * @brief Producer: queues a sample.
+     *
+     * @param [in] timestamp_ns_begin  Start of the counter accumulation.
+     * @param [in] timestamp_ns_end    End of the counter accumulation.
+     * @param [in] values              values_per_sample() counter values.
+     * @return hwcpipe::errc::stream_closed if the stream was closed,
+     * otherwise an empty error_code, also when the policy dropped a sample.
+     */
+    HWCP_NODISCARD std::error_code push(uint64_t timestamp_ns_begin, uint64_t timestamp_ns_end,
+                                        const double *values) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (policy_ == backpressure_policy::block) {
+            not_full_.wait(lock, [this] { return closed_ || size_ != depth_; });
+        }
+        if (closed_) {
+            return make_error_code(errc::stream_closed);
+        }
+        ++stats_.pushed;
+
+        if (size_ == depth_) {
+            switch (policy_) {
+            case backpressure_policy::drop_oldest:
+                ++stats_.dropped;
+                head_ = next(head_);
+                --size_;
+                break;
+            case backpressure_policy::drop_newest:
+                ++stats_.dropped;
+                return {};
+            case backpressure_policy::block:
+            case backpressure_policy::coalesce:
+            default: {
+                // a blocked producer only gets here once there is room
+                ++stats_.coalesced;
+                const size_t newest = (head_ + size_ - 1) % depth_;
+                double *dst = slot_values(newest);
+                for (size_t i = 0; i != values_per_sample_; ++i) {
+                    dst[i] += values[i];
+                }
+                slots_[newest].timestamp_ns_end = timestamp_ns_end;
+                ++slots_[newest].num_samples;
+                return {};
+            }
+            }
+        }
+
+        const size_t tail = (head_ + size_) % depth_;
+        std::copy(values, values + values_per_sample_, slot_values(tail));
+        slots_[tail] = {timestamp_ns_begin, timestamp_ns_end, 1};
+        ++size_;
+        lock.unlock();
+        not_empty_.notify_one();
+        return {};
+    }
+
+    /**
+     * @brief Producer: queues the last sample of a sampler.
+     *
+     * @param [in] sampler  The sampler, after a successful sample.
+     * @param [in] list     A read list of the sampler with
+     *                      values_per_sample() counters.
+     * @return The error of sampler::get_counter_values(), otherwise the error
+     * of push().
+     */
+    template <typename sampler_t, typename read_list_t>
+    HWCP_NODISCARD std::error_code push(const sampler_t &sampler, const read_list_t &list) {
+        // staging_ is only used by the producer, so it is filled unlocked
+        auto ec = sampler.get_counter_values(list, staging_.data(), staging_.size());
+        if (ec) {
+            return ec;
+        }
+        return push(sampler.get_sample_timestamp(), sampler.get_sample_timestamp_end(), staging_.data());
+    }
+
+    /**
+     * @brief Consumer: delivers the queued samples to the callback, on the
+     * calling thread, until the stream is closed and its queue is empty.
+     */
+    void run() {
+        while (deliver_one(true)) {
+        }
+    }
+
+    /**
+     * @brief Consumer: delivers the samples that are queued to the callback,
+     * on the calling thread, without waiting for more.
+     *
+     * @return The number of samples delivered.
+     */
+    size_t dispatch() {
+        size_t count{};
+        while (deliver_one(false)) {
+            ++count;
+        }
+        return count;
+    }
+
+    /**
+     * @brief Closes the stream. Further pushes fail, a blocked producer
+     * returns, and run() returns once the queued samples are delivered.
+     */
+    void close() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            closed_ = true;
+        }
+        not_full_.notify_all();
+        not_empty_.notify_all();
+    }
+
+    /** @return The number of samples queued. */
+    HWCP_NODISCARD size_t size() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return size_;
+    }
+
+    /** @return The counts of the samples that went through the stream. */
+    HWCP_NODISCARD sample_stream_stats get_stats() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return stats_;
+    }
+
+  private:
+    // the metadata of a queued sample
+    struct slot {
+        uint64_t timestamp_ns_begin;
+        uint64_t timestamp_ns_end;
+        uint32_t num_samples;
+    };
+
+    HWCP_NODISCARD size_t next(size_t index) const { return index + 1 == depth_ ? 0 : index + 1; }
+
+    HWCP_NODISCARD double *slot_values(size_t index) { return values_.data() + index * values_per_sample_; }
+
+    // the oldest sample is copied out of the queue, so that the producer can
+    // reuse its slot while the callback runs
+    bool deliver_one(bool wait) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (wait) {
+            not_empty_.wait(lock, [this] { return closed_ || size_ != 0; });
+        }
+        if (size_ == 0) {
+            return false;
+        }
+
+        const slot sample_slot = slots_[head_];
+        const double *values = slot_values(head_);
+        std::copy(values, values + values_per_sample_, delivery_.data());
+        head_ = next(head_);
+        --size_;
+        ++stats_.delivered;
+        lock.unlock();
+        not_full_.notify_one();
+
+        const stream_sample sample{sample_slot.timestamp_ns_begin, sample_slot.timestamp_ns_end, delivery_.data(),
+                                   values_per_sample_, sample_slot.num_samples};
+        callback_(user_data_, sample);
+        return true;
+    }
+
+    const size_t depth_;
+    const size_t values_per_sample_;
+    const backpressure_policy policy_;
+    const sample_callback callback_;
+    void *const user_data_;
+
+    mutable std::mutex mutex_{};
+    std::condition_variable not_empty_{};
+    std::condition_variable not_full_{};
+
+    // guarded by mutex_
+    std::vector<slot> slots_;
+    std::vector<double> values_;
+    size_t head_{};
+    size_t size_{};
+    bool closed_{};
+    sample_stream_stats stats_{};
+
+    // owned by the producer and the consumer thread respectively
+    std::vector<double> staging_;
+    std::vector<double> delivery_;
+};
+
+} // namespace hwcpipe
@@ -9,25 +9,50 @@
 #include "device/constants.hpp"
 #include "device/hwcnt/prfcnt_set.hpp"
 #include "device/product_id.hpp"
+#include "hwcpipe/clock_correlator.hpp"
+#include "hwcpipe/counter_preset.hpp"
 #include "hwcpipe/detail/counter_database.hpp"
+#include "hwcpipe/detail/custom_expression.hpp"
+#include "hwcpipe/detail/device_registry.hpp"
+#include "hwcpipe/detail/flat_set.hpp"
+#include "hwcpipe/detail/gather_plan.hpp"
+#include "hwcpipe/detail/heap_bytes.hpp"
 #include "hwcpipe/detail/internal_types.hpp"
+#include "hwcpipe/detail/kernel_dispatch.hpp"
 #include "hwcpipe/error.hpp"
 #include "hwcpipe/gpu.hpp"
 #include "hwcpipe/hwcpipe_counter.h"
+#include "hwcpipe/memory_footprint.hpp"
+#include "hwcpipe/sampler_stats.hpp"
 #include "hwcpipe/types.hpp"
 
 #include <device/handle.hpp>
 #include <device/hwcnt/block_extents.hpp>
 #include <device/hwcnt/block_metadata.hpp>
+#include <device/hwcnt/features.hpp>
+#include <device/hwcnt/sample.hpp>
 #include <device/hwcnt/sampler/configuration.hpp>
 #include <device/hwcnt/sampler/manual.hpp>
+#include <device/hwcnt/sampler/thread_config.hpp>
+#include <device/tracepoint.hpp>
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <cassert>
+#include <chrono>
+#include <cmath>
 #include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
 #include <memory>
-#include <set>
+#include <numeric>
+#include <string>
 #include <system_error>
-#include <unordered_map>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace hwcpipe {
@@ -78,6 +103,27 @@ struct counter_sample {
         : counter_sample(hwcpipe_counter(), 0, static_cast<uint64_t>(0UL)) {}
 };
 
+/** @brief When a sample_trigger fires. */
+enum class trigger_condition : uint8_t {
+    /** The value of the counter is above the threshold. */
+    above,
+    /** The value of the counter is below the threshold. */
+    below,
+};
+
+/**
+ * @brief A threshold on a hardware or derived counter, checked on every
+ * sample, see sampler_config::set_trigger().
+ */
+struct sample_trigger {
+    /** The counter to check. */
+    hwcpipe_counter counter;
+    /** When the trigger fires. */
+    trigger_condition condition;
+    /** The threshold of the counter value. */
+    double threshold;
+};
+
 /**
  * @brief A sampler_config object holds the list of counters that were selected
  * by the user and builds the state that is needed by the sampler to set up the
@@ -87,6 +133,47 @@ class sampler_config {
   public:
     using backend_cfg_type = device::hwcnt::sampler::configuration;
 
+    /** @brief Controls when the sampler evaluates expression counters. */
+    enum class expression_evaluation {
+        /** Expressions are evaluated every time their value is read. */
+        lazy,
+        /**
+         * Expressions are evaluated once per sample, in dependency order,
+         * and reads return the cached result.
+         */
+        eager,
+    };
+
+    /** @brief Controls how the sampler handles stretched samples. */
+    enum class drop_policy {
+        /** Stretched samples are rejected, and their counter values lost. */
+        reject,
+        /**
+         * Stretched samples are accepted when the backend defines the
+         * overflow behavior, i.e. its counters kept accumulating while the
+         * kernel buffer was full. The next delta is then widened to cover the
+         * samples that could not be taken, so no counted event is lost.
+         */
+        widen,
+        /**
+         * Stretched samples are always accepted, and flagged, see
+         * sampler::get_sample_flags(). Their values cover the whole interval
+         * from their begin to their end timestamp, so rates stay exact.
+         * Erroneous samples are accepted when the backend reports the block
+         * states, see device::hwcnt::features: only the blocks that were
+         * powered, available and in normal mode for the whole sample are
+         * decoded, and sampler::get_active_instances() counts them. Without
+         * block states erroneous samples are rejected.
+         */
+        salvage,
+    };
+
+    /**
+     * @brief Callback notified of the samples that were dropped or stretched,
+     * e.g. to log them.
+     */
+    using drop_handler = void (*)(void *user_data, const drop_event &event);
+
     // structure to tie together the counter ID and its block address or
     // evaluator function, once they've been retrieved from the database
     struct registered_counter {
@@ -113,6 +200,12 @@ class sampler_config {
         }
     };
 
+    /**
+     * The registered counters, sorted by counter. The counters that a UI
+     * typically selects, with their dependencies, fit in the inline storage.
+     */
+    using registered_counter_set = detail::flat_set<registered_counter, 64>;
+
     /**
      * @brief Construct a sampler configuration for a GPU.
      */
@@ -128,10 +221,9 @@ class sampler_config {
         , device_number_(device_number) {
         constexpr auto prfcnt_set = device::hwcnt::prfcnt_set::primary;
 
-        // preallocate the backend enable maps for each possible block type
-        for (size_t i = 0; i != static_cast<size_t>(device::hwcnt::block_extents::num_block_types); ++i) {
-            const auto type = static_cast<block_type>(i);
-            backend_config_.emplace(type, backend_cfg_type{type, prfcnt_set, {}});
+        // one backend enable map for each possible block type
+        for (size_t i = 0; i != backend_config_.size(); ++i) {
+            backend_config_[i] = backend_cfg_type{static_cast<block_type>(i), prfcnt_set, {}};
         }
     }
 
@@ -160,7 +252,7 @@ class sampler_config {
             const auto &address = definition.get_address();
             counters_.emplace(counter, definition);
 
-            backend_config_[address.block_type].enable_map[address.offset] = 1;
+            backend_config_[static_cast<size_t>(address.block_type)].enable_map[address.offset] = 1;
             break;
         }
         case detail::counter_definition::type::expression: {
@@ -179,11 +271,114 @@ class sampler_config {
         return {};
     }
 
+    /**
+     * @brief Requests that a user defined counter is collected by the sampler.
+     * The expression is compiled and the counters it reads are added to the
+     * config. Custom counters are evaluated once per sample, after the built-in
+     * expressions, and are read with sampler::get_custom_counter_value().
+     *
+     * @par
+     * @code
+     * size_t fragment_share{};
+     * auto ec = config.add_custom_counter("MaliFragActiveCy / max(MaliGPUActiveCy, 1) * 100", fragment_share);
+     * @endcode
+     *
+     * @param [in]  expression  The expression, in the syntax of the counter
+     *                          specification.
+     * @param [out] id          Set to the identifier of the custom counter.
+     * @return Returns hwcpipe::errc::invalid_expression if the expression is
+     * malformed, hwcpipe::errc::unknown_counter if it names an unknown counter,
+     * hwcpipe::errc::invalid_counter_for_device if it reads a counter that is
+     * not supported by the current GPU.
+     */
+    HWCP_NODISCARD std::error_code add_custom_counter(const std::string &expression, size_t &id) {
+        detail::expression::custom_expression custom{};
+        auto ec = detail::expression::custom_expression::compile(expression, custom);
+        if (ec) {
+            return ec;
+        }
+
+        for (auto dependency : custom.get_dependencies()) {
+            ec = add_counter(dependency);
+            if (ec) {
+                return ec;
+            }
+        }
+
+        id = custom_counters_.size();
+        custom_counters_.push_back(std::move(custom));
+        return {};
+    }
+
+    /**
+     * @brief Requests counters by their identifiers, e.g. the counters listed
+     * in a configuration file. The identifiers are resolved with a binary
+     * search of the counter database, without any allocation.
+     *
+     * @param [in] names  The null terminated identifiers of the counters, as
+     *                    spelled in hwcpipe_counter.h, e.g. "MaliGPUActiveCy".
+     * @param [in] count  The number of identifiers.
+     * @return Returns hwcpipe::errc::unknown_counter if an identifier is not
+     *                 known, hwcpipe::errc::invalid_counter_for_device if a
+     *                 counter is not supported by the current GPU. The counters
+     *                 that precede the failing one are added.
+     */
+    HWCP_NODISCARD std::error_code add_counters(const char *const *names, size_t count) {
+        for (size_t i = 0; i != count; ++i) {
+            hwcpipe_counter counter{};
+            auto ec = db_.find_counter(names[i], std::strlen(names[i]), counter);
+            if (!ec) {
+                ec = add_counter(counter);
+            }
+            if (ec) {
+                return ec;
+            }
+        }
+
+        return {};
+    }
+
+    /**
+     * @brief Requests counters by their identifiers.
+     *
+     * @param [in] names  The identifiers of the counters.
+     * @return See add_counters(const char *const *, size_t).
+     */
+    HWCP_NODISCARD std::error_code add_counters(std::initializer_list<const char *> names) {
+        return add_counters(names.begin(), names.size());
+    }
+
+    /**
+     * @brief Requests the counters of a preset. The counters of the preset that
+     * the GPU doesn't support are left out. The configuration of a preset is
+     * resolved from the counter database once per GPU and process, so adding
+     * a preset again, e.g. for every capture, only merges the cached counters
+     * and enable maps.
+     *
+     * @param [in] preset  The preset to sample.
+     */
+    void add_preset(counter_preset preset) {
+        const auto &config = detail::get_preset_config(preset, pid_);
+
+        for (const auto &counter : config.counters) {
+            counters_.emplace(counter.first, counter.second);
+        }
+
+        for (size_t i = 0; i != config.enable_maps.size(); ++i) {
+            backend_config_[i].enable_map |= config.enable_maps[i];
+        }
+    }
+
     /**
      * @brief Fetches the list of counters that have been validated and added
      * to this config.
      */
-    HWCP_NODISCARD const std::set<registered_counter> &get_valid_counters() const { return counters_; }
+    HWCP_NODISCARD const registered_counter_set &get_valid_counters() const { return counters_; }
+
+    /** @brief Fetches the custom counters, indexed by identifier. */
+    HWCP_NODISCARD const std::vector<detail::expression::custom_expression> &get_custom_counters() const {
+        return custom_counters_;
+    }
 
     /**
      * @brief Constructs a list of enable maps, specific to the selected GPU,
@@ -192,9 +387,9 @@ class sampler_config {
      */
     HWCP_NODISCARD std::vector<backend_cfg_type> build_backend_config_list() const {
         std::vector<backend_cfg_type> config_list{};
-        for (const auto &it : backend_config_) {
-            if (it.second.enable_map.any()) {
-                config_list.push_back(it.second);
+        for (const auto &block : backend_config_) {
+            if (block.enable_map.any()) {
+                config_list.push_back(block);
             }
         }
         return config_list;
@@ -206,436 +401,3495 @@ class sampler_config {
      */
     HWCP_NODISCARD int get_device_number() const { return device_number_; }
 
-  private:
-    using block_type = device::hwcnt::block_type;
-
-    device::product_id pid_;
-    int device_number_;
-
-    detail::counter_database db_{};
-    std::set<registered_counter> counters_{};
-    std::unordered_map<block_type, backend_cfg_type> backend_config_{};
+    /** @brief Returns the product ID of the selected GPU. */
+    HWCP_NODISCARD device::product_id get_product_id() const { return pid_; }
 
-    HWCP_NODISCARD std::error_code
-    add_expression_depedencies(const detail::expression::expression_definition &expression) {
-        std::error_code ec;
-        for (auto dependency : expression.dependencies) {
-            ec = add_counter(dependency);
-            if (ec) {
-                return ec;
-            }
-        }
-        return {};
-    }
-};
+    /**
+     * @brief Selects when expression counters are evaluated. The default is
+     * expression_evaluation::lazy.
+     */
+    void set_expression_evaluation(expression_evaluation mode) { expression_evaluation_ = mode; }
 
-/**
- * @brief A sampler is responsible for collecting counter samples from the GPU
- * and presenting them in a more user-friendly manner.
- */
-template <typename backend_policy_t = hwcpipe::detail::hwcpipe_backend_policy>
-class sampler : private detail::expression::context {
-    using handle_type = typename backend_policy_t::handle_type;
-    using instance_type = typename backend_policy_t::instance_type;
-    using sampler_type = typename backend_policy_t::sampler_type;
-    using sample_type = typename backend_policy_t::sample_type;
-    using block_type = device::hwcnt::block_type;
+    /** @brief Returns when expression counters are evaluated. */
+    HWCP_NODISCARD expression_evaluation get_expression_evaluation() const { return expression_evaluation_; }
 
-    template <typename iterator_t>
-    class sample_iterator {
-      public:
-        using value_type = counter_sample;
-        using reference = const counter_sample &;
-        using pointer = const counter_sample *;
-        using difference_type = std::ptrdiff_t;
-        using iterator_category = std::forward_iterator_tag;
+    /**
+     * @brief Selects periodic sampling. When the period is non-zero the
+     * kernel takes a sample every @p period_ns nanoseconds and
+     * sampler::sample_now() collects the oldest sample that has not been read
+     * yet, instead of requesting one. A period of zero selects manual
+     * sampling, which is the default.
+     *
+     * @param [in] period_ns  The sample period in nanoseconds.
+     */
+    void set_sampling_period(uint64_t period_ns) { sampling_period_ns_ = period_ns; }
 
-        sample_iterator(sampler &sampler, iterator_t begin, iterator_t end)
-            : sampler_(sampler)
-            , it_(std::move(begin))
-            , end_(std::move(end))
-            , sample_() {
-            if (it_ != end_) {
-                set_sample_value();
-            }
-        }
+    /** @brief Returns the sample period in nanoseconds, or zero for manual sampling. */
+    HWCP_NODISCARD uint64_t get_sampling_period() const { return sampling_period_ns_; }
 
-        reference operator*() { return sample_; }
-        pointer operator->() { return &sample_; }
+    /**
+     * @brief Enables per block instance values. When enabled the sampler keeps
+     * the value of every hardware counter for each instance of its block type
+     * (e.g. per shader core or per L2 slice), which can be read with
+     * sampler::get_counter_instance_values(). The summed values returned by
+     * sampler::get_counter_value() are unchanged. Disabled by default.
+     */
+    void set_per_instance_values(bool enable) { per_instance_values_ = enable; }
 
-        auto &operator++() {
-            ++it_;
-            if (it_ != end_) {
-                set_sample_value();
-            }
-            return *this;
-        }
+    /** @brief Returns whether per block instance values are enabled. */
+    HWCP_NODISCARD bool get_per_instance_values() const { return per_instance_values_; }
 
-        auto operator++(int) {
-            auto copy = *this;
-            ++(*this);
-            return copy;
-        }
+    /** @brief A raw counter of a block type, see add_block_counter(). */
+    struct block_counter {
+        /** The block type. */
+        device::hwcnt::block_type type;
+        /** The offset of the counter in the blocks of the type. */
+        uint32_t offset;
+    };
 
-        friend bool operator==(const sample_iterator<iterator_t> &lhs, const sample_iterator<iterator_t> &rhs) {
-            return lhs.it_ == rhs.it_;
+    /**
+     * @brief Requests a raw counter of every instance of a block type, by its
+     * offset in the block, e.g. the counters of the CSF firmware and command
+     * stream group (CSG) blocks that the counter database doesn't describe.
+     * The blocks of a type are only decoded when a counter of the type is
+     * requested, so the captures that don't request any don't pay for them.
+     * The values of each block instance, e.g. of each CSG, are read with
+     * sampler::get_block_counter_values().
+     *
+     * @param [in] type    The block type.
+     * @param [in] offset  The offset of the counter in the block.
+     * @return Returns hwcpipe::errc::invalid_counter_for_device if the offset
+     * is out of the largest block.
+     */
+    HWCP_NODISCARD std::error_code add_block_counter(device::hwcnt::block_type type, uint32_t offset) {
+        if (static_cast<size_t>(type) >= backend_config_.size() ||
+            offset >= backend_cfg_type::max_counters_per_block) {
+            return make_error_code(errc::invalid_counter_for_device);
         }
 
-        friend bool operator!=(const sample_iterator<iterator_t> &lhs, const sample_iterator<iterator_t> &rhs) {
-            return lhs.it_ != rhs.it_;
+        const auto found = std::find_if(block_counters_.begin(), block_counters_.end(), [&](const block_counter &c) {
+            return c.type == type && c.offset == offset;
+        });
+        if (found == block_counters_.end()) {
+            block_counters_.push_back({type, offset});
+            backend_config_[static_cast<size_t>(type)].enable_map[offset] = 1;
         }
+        return {};
+    }
 
-      private:
-        sampler &sampler_;
-        iterator_t it_;
-        iterator_t end_;
-
-        counter_sample sample_;
-
-        void set_sample_value() { auto ec = sampler_.get_counter_value(it_->first, sample_); }
-    };
+    /** @brief Returns the raw block counters, in the order they were requested. */
+    HWCP_NODISCARD const std::vector<block_counter> &get_block_counters() const { return block_counters_; }
 
-    template <typename iterator_t>
-    class sample_iterable {
-      public:
-        sample_iterable(sampler &sampler, iterator_t begin, iterator_t end)
-            : sampler_(sampler)
-            , begin_(std::move(begin))
-            , end_(std::move(end)) {}
+    /**
+     * @brief Sets the number of consecutive samples merged into one. The
+     * hardware counters of a sample are deltas, so the samples of a window
+     * are merged exactly by summing their values, before the expressions are
+     * evaluated once for the whole window. This samples at a high rate, e.g.
+     * for a trace_recorder, and reads the values at a low rate without
+     * evaluating the expressions of every sample. The timestamps of a merged
+     * sample span its window. Zero or one, the default, merges nothing.
+     *
+     * Merged samples can't be combined with per instance values.
+     *
+     * @param [in] count  Number of samples per merged sample.
+     */
+    void set_coalesced_samples(uint32_t count) { coalesced_samples_ = count == 0 ? 1 : count; }
 
-        auto begin() { return sample_iterator<iterator_t>(sampler_, begin_, end_); }
+    /** @brief Returns the number of consecutive samples merged into one. */
+    HWCP_NODISCARD uint32_t get_coalesced_samples() const { return coalesced_samples_; }
 
-        auto end() { return sample_iterator<iterator_t>(sampler_, end_, end_); }
+    /**
+     * @brief Sets the number of shader cores decoded per sample. The sampler
+     * then decodes a window of @p cores of the active shader cores, which
+     * rotates by as many cores every sample so that each core is read in
+     * turn, and extrapolates the shader core counters to all the active
+     * cores. The other core blocks are neither read nor prefetched, which
+     * cuts the decode cost and the memory traffic of GPUs with many cores
+     * at high sampling rates. The extrapolated values are estimates, whose
+     * standard errors are read with sampler::get_counter_error(). Zero, the
+     * default, decodes every core.
+     *
+     * Sub-sampling can't be combined with per instance values or merged
+     * samples.
+     *
+     * @param [in] cores  Number of shader cores decoded per sample.
+     */
+    void set_core_subsampling(uint32_t cores) { core_subsampling_ = cores; }
 
-      private:
-        sampler &sampler_{};
-        iterator_t begin_;
-        iterator_t end_;
-    };
+    /** @brief Returns the number of shader cores decoded per sample, zero for all of them. */
+    HWCP_NODISCARD uint32_t get_core_subsampling() const { return core_subsampling_; }
 
-  public:
     /**
-     * Constructs a sampler from the specified config object. This will attempt
-     * to create the relevant resources in the kernel driver. If this fails then
-     * the resulting sampler instance will be invalid and any attempts to start
-     * sampling will fail with an error_code.
+     * @brief Sets a multi-rate plan, which reads a few key counters at the
+     * sampling rate and the whole counter set at a fraction of it, from the
+     * same session. The fast counters, and the counters their expressions
+     * read, are decoded and evaluated on every sample. The blocks read by the
+     * other counters are only summed on every sample, and their counters are
+     * extracted and their expressions evaluated once every @p slow_period
+     * samples, from the deltas summed over that window. Between two windows
+     * they keep the values of the last complete one, see
+     * sampler::is_full_sample(). The expressions are evaluated eagerly.
      *
-     * The caller must check that the resulting instance is valid before trying
-     * to use it.
      * @par
      * @code
-     * auto sampler = hwcpipe::sampler(config);
-     * if (!sampler) {
-     *    // sampler creation failed
-     * }
+     * config.add_preset(hwcpipe::counter_preset::shader_alu);
+     * // 1 kHz sampling: the shader core counters are read at 10 Hz
+     * config.set_sampling_period(1000000);
+     * auto ec = config.set_multi_rate({MaliGPUActiveCy, MaliExtBusRdBt}, 100);
      * @endcode
+     *
+     * A multi-rate plan can't be combined with per instance values, merged
+     * samples, core sub-sampling or custom counters.
+     *
+     * @param [in] fast_counters  The counters read on every sample, which are
+     *                            added to the config.
+     * @param [in] slow_period    Number of samples per window of the other
+     *                            counters. Zero or one, the default, disables
+     *                            the plan.
+     * @return Returns the error of add_counter() for a fast counter that the
+     * GPU doesn't support, in which case the plan is unchanged.
      */
-    sampler(const sampler_config &config) {
-        // try to open the backend instance
-        handle_ = handle_type::create(config.get_device_number());
-        if (!handle_) {
-            ec_ = make_error_code(errc::backend_creation_failed);
-            return;
-        }
-
-        instance_ = instance_type::create(*handle_);
-        if (!instance_) {
-            ec_ = make_error_code(errc::backend_creation_failed);
-            return;
+    HWCP_NODISCARD std::error_code set_multi_rate(std::initializer_list<hwcpipe_counter> fast_counters,
+                                                  uint32_t slow_period) {
+        for (auto counter : fast_counters) {
+            auto ec = add_counter(counter);
+            if (ec) {
+                return ec;
+            }
         }
+        fast_counters_.assign(fast_counters.begin(), fast_counters.end());
+        slow_period_ = slow_period == 0 ? 1 : slow_period;
+        return {};
+    }
 
-        constants_ = instance_->get_constants();
+    /** @brief Returns the counters read on every sample by the multi-rate plan. */
+    HWCP_NODISCARD const std::vector<hwcpipe_counter> &get_fast_counters() const { return fast_counters_; }
 
-        // if we're dealing with a GPU >= G715/G615 then counters are 64bit
-        values_are_64bit_ =
-            instance_->get_hwcnt_block_extents().values_type() == device::hwcnt::sample_values_type::uint64;
+    /** @brief Returns the number of samples per window of the multi-rate plan, one when it is disabled. */
+    HWCP_NODISCARD uint32_t get_slow_period() const { return slow_period_; }
 
-        // reserve the sample list buffer and map counters to posisions within
-        // the buffer
-        const auto &valid_counters = config.get_valid_counters();
-        if (valid_counters.empty()) {
-            ec_ = make_error_code(errc::sampler_config_invalid);
-            return;
+    /**
+     * @brief Enables the idle fast path. Samples in which the GPU was idle,
+     * i.e. counted no GPU cycle, then skip the decode of their blocks and the
+     * evaluation of the expressions: every hardware counter reads zero, and
+     * the expressions keep the values evaluated for the first idle sample.
+     * Consecutive idle samples are reported as a single idle_span by
+     * sampler::get_idle_span(). Disabled by default.
+     *
+     * Activity is read from sample_metadata::gpu_cycle where the backend
+     * reports it, see features::has_gpu_cycle, otherwise from
+     * MaliGPUActiveCy, which is added to the config.
+     *
+     * @param [in] enable  True to skip the idle samples.
+     * @return The error of add_counter() for MaliGPUActiveCy, in which case
+     * the idle fast path stays disabled.
+     */
+    HWCP_NODISCARD std::error_code set_idle_skip(bool enable) {
+        if (enable) {
+            auto ec = add_counter(MaliGPUActiveCy);
+            if (ec) {
+                return ec;
+            }
         }
-        build_sample_buffer_mappings(valid_counters);
+        idle_skip_ = enable;
+        return {};
+    }
 
-        // finally, try to create the backend sampler using the config array
-        auto config_array = config.build_backend_config_list();
-        auto sampler = std::make_unique<sampler_type>(*instance_, config_array.data(), config_array.size());
+    /** @brief Returns whether idle samples skip their decode. */
+    HWCP_NODISCARD bool get_idle_skip() const { return idle_skip_; }
 
-        if (!sampler || !(*sampler)) {
-            ec_ = hwcpipe::make_error_code(hwcpipe::errc::backend_sampler_failure);
-            return;
-        }
+    /**
+     * @brief Keeps the backend session of a manual sampler armed between
+     * measurements. The first sampler::start_sampling() starts the counter
+     * accumulation, which then runs until the sampler is destroyed or
+     * reconfigured. The next calls take a baseline sample instead and drop it
+     * without decoding it, and sampler::stop_sampling() leaves the kernel
+     * session as is, so back-to-back short measurements don't start and stop
+     * the session every time. Disabled by default.
+     *
+     * The GPU is profiled, and its counters accumulated, between the
+     * measurements too. Periodic samplers can't be armed.
+     *
+     * @param [in] enable  True to keep the session armed.
+     */
+    void set_armed_sessions(bool enable) { armed_sessions_ = enable; }
 
-        sampler_ = std::move(sampler);
-    }
+    /** @brief Returns whether the backend session is kept armed between measurements. */
+    HWCP_NODISCARD bool get_armed_sessions() const { return armed_sessions_; }
 
-    operator bool() const { return !ec_; }
+    /**
+     * @brief Enables the detection of saturated counters, on GPUs whose
+     * counters are 32-bit, see block_extents::values_type(). The kernel
+     * accumulates each counter into a 32-bit value between two samples, and a
+     * value that reaches its maximum saturates rather than wraps, so the
+     * events counted past it are lost. The sampler then reports the samples
+     * that have a saturated counter, and the longest sampling period that
+     * keeps the observed counter rates below the maximum, see
+     * sampler::is_saturated() and sampler::get_max_sampling_period().
+     * Disabled by default. GPUs with 64-bit counters don't saturate.
+     *
+     * @param [in] enable  True to check the counter values for saturation.
+     */
+    void set_saturation_check(bool enable) { saturation_check_ = enable; }
+
+    /** @brief Returns whether the counter values are checked for saturation. */
+    HWCP_NODISCARD bool get_saturation_check() const { return saturation_check_; }
 
     /**
-     * @brief Starts counter accumulation.
+     * @brief Enables the lazy decode of the samples. sampler::sample_now()
+     * then copies the active blocks of the sampled types out of the kernel
+     * sample, and the counters of a block type are only gathered from the
+     * copies when a counter of the type is first read from the sample, e.g.
+     * by sampler::get_counter_value(), sampler::get_counter_values() or an
+     * expression. The decode then costs what is read rather than what is
+     * configured, which suits the interactive tools that configure many
+     * counters and show a few of them. Disabled by default.
      *
-     * @return Returns an error if the sampler backend could not be started or
-     * if sampling was already in progress, otherwise returns a default
-     * constructed error_code.
+     * The reads of a sample are then no longer safe from several threads.
+     * The lazy decode can't be combined with per instance values, merged
+     * samples, core sub-sampling or a multi-rate plan, for which the sampler
+     * is created with hwcpipe::errc::sampler_config_invalid.
+     *
+     * @param [in] enable  True to decode the block types on their first read.
      */
-    HWCP_NODISCARD std::error_code start_sampling() {
-        if (ec_) {
-            return ec_;
-        }
-        if (sampling_in_progress_) {
-            return make_error_code(errc::sampling_already_started);
-        }
-        auto ec = sampler_->accumulation_start();
-        if (ec) {
-            return make_error_code(errc::accumulation_start_failed);
-        }
-        sampling_in_progress_ = true;
-        return {};
-    }
+    void set_lazy_decode(bool enable) { lazy_decode_ = enable; }
+
+    /** @brief Returns whether the block types are decoded on their first read. */
+    HWCP_NODISCARD bool get_lazy_decode() const { return lazy_decode_; }
 
     /**
-     * @brief Requests that counter accumulation is stopped. If the request
-     * fails an error is returned, the sampler should be considered to be in an
-     * undefined state and should not be used further.
+     * @brief Sets a trigger, checked on every sample against the value of its
+     * counter, which is added to the config. The counter is resolved once,
+     * and derived counters are read from the eager expression plan when the
+     * expressions are evaluated eagerly, so the check costs a comparison per
+     * sample. See sampler::is_triggered() and triggered_capture.
      *
-     * @return A default constructed error_code on success, or an error if the
-     * request failed.
+     * @param [in] trigger  The trigger.
+     * @return The error of add_counter() for the counter of the trigger, in
+     * which case the trigger is not set.
      */
-    HWCP_NODISCARD std::error_code stop_sampling() {
-        if (ec_) {
-            return ec_;
-        }
-        if (!sampling_in_progress_) {
-            return make_error_code(errc::sampling_not_started);
-        }
-        auto ec = sampler_->accumulation_stop(0);
+    HWCP_NODISCARD std::error_code set_trigger(const sample_trigger &trigger) {
+        auto ec = add_counter(trigger.counter);
         if (ec) {
-            return make_error_code(errc::accumulation_stop_failed);
+            return ec;
         }
-        sampling_in_progress_ = false;
+        trigger_ = trigger;
+        has_trigger_ = true;
         return {};
     }
 
+    /** @brief Returns the trigger, or nullptr if none was set. */
+    HWCP_NODISCARD const sample_trigger *get_trigger() const { return has_trigger_ ? &trigger_ : nullptr; }
+
     /**
-     * @brief Updates the sample buffer with the most recent counter values.
-     * The buffer can then be queried via get_counter_value(). If an error
-     * occurs while trying to read the counters then the contents of the sample
-     * buffer are unchanged and further queries will return the old values.
-     *
-     * @return An error if sampling has not been started, or if an error
-     * occurred while reading counters from the GPU.
+     * @brief Selects how stretched samples are handled. The default is
+     * drop_policy::reject, for which sampler::sample_now() fails with
+     * hwcpipe::errc::sample_collection_failure on a stretched sample.
+     * Erroneous samples are only accepted by drop_policy::salvage.
      */
-    HWCP_NODISCARD std::error_code sample_now() {
-        if (!sampling_in_progress_) {
-            return make_error_code(errc::sampling_not_started);
-        }
+    void set_drop_policy(drop_policy policy) { drop_policy_ = policy; }
 
-        auto ec = sampler_->request_sample(0);
-        if (ec) {
-            return make_error_code(errc::sample_collection_failure);
-        }
-
-        auto &reader = sampler_->get_reader();
-        auto backend_sample = sample_type(reader, ec);
-        if (ec) {
-            return make_error_code(errc::sample_collection_failure);
-        }
+    /** @brief Returns how stretched samples are handled. */
+    HWCP_NODISCARD drop_policy get_drop_policy() const { return drop_policy_; }
 
-        // if there was an error fetching the samples then there's no point
-        // trying to read the block data. Leave the last captured values in the
-        // buffer.
-        const auto &metadata = backend_sample.get_metadata();
-        if (metadata.flags.error || metadata.flags.stretched) {
-            valid_sample_buffer_ = false;
-            return make_error_code(errc::sample_collection_failure);
-        }
+    /**
+     * @brief Sets a callback that the sampler calls, from the thread that
+     * samples, whenever samples were dropped before the sample it reads, the
+     * sample was stretched or the backend session was recovered before it.
+     * The callback must not use the sampler.
+     *
+     * @param [in] handler    The callback, or nullptr to remove it.
+     * @param [in] user_data  Passed to the callback.
+     */
+    void set_drop_handler(drop_handler handler, void *user_data) {
+        drop_handler_ = handler;
+        drop_handler_data_ = user_data;
+    }
 
-        last_collection_timestamp_ = metadata.timestamp_ns_begin;
+    /** @brief Returns the drop callback, or nullptr. */
+    HWCP_NODISCARD drop_handler get_drop_handler() const { return drop_handler_; }
 
-        // clear out any samples from the previous poll
-        for (auto &sample : sample_buffer_) {
-            sample = 0;
-        }
+    /** @brief Returns the user data of the drop callback. */
+    HWCP_NODISCARD void *get_drop_handler_data() const { return drop_handler_data_; }
 
-        // loop over the counter blocks returned by the reader and fetch any
-        // samples that were requested
-        if (values_are_64bit_) {
-            fill_sample_buffer<uint64_t>(backend_sample);
-        } else {
-            fill_sample_buffer<uint32_t>(backend_sample);
-        }
+    /**
+     * @brief Sets how many times the sampler sets its backend session up
+     * again, when the kernel reports an error, before it returns the error.
+     * The session is set up with the same backend configuration, on the
+     * device handle and instance that are already open, and sampling goes on
+     * where it was, see sampler::recover_session(). Zero, the default,
+     * disables the recovery.
+     *
+     * @param [in] max_attempts  The number of attempts per call of
+     *                           sampler::sample_now() or of the other
+     *                           collection calls.
+     */
+    void set_session_recovery(uint32_t max_attempts) { session_recovery_ = max_attempts; }
 
-        valid_sample_buffer_ = true;
-        return {};
-    }
+    /** @brief Returns the number of session recovery attempts. */
+    HWCP_NODISCARD uint32_t get_session_recovery() const { return session_recovery_; }
 
     /**
-     * @brief Fetches the last sampled value for a counter.
+     * @brief Returns true if the GPU is known to be powered down, e.g.
+     * runtime suspended, so that a counter dump would power it up only to
+     * read zeros. See sampler_config::set_power_probe() and
+     * hwcpipe::runtime_pm_probe.
      *
-     * @param [in]  counter  The counter to read.
+     * @param [in] user_data  The user data of set_power_probe().
+     */
+    using power_probe = bool (*)(void *user_data);
+
+    /**
+     * @brief Enables the power-aware mode of manual samplers: sampler::sample_now()
+     * and sampler::sample_now_for() don't request a counter dump from a GPU
+     * that is powered down, and take a sample in which nothing was counted
+     * instead, from the end of the last sample to now. Disabled by default.
+     *
+     * With a power probe, see set_power_probe(), dumps are skipped while the
+     * probe reports the GPU as powered down. Otherwise, where the backend
+     * reports the power states of the blocks, see features::has_power_states,
+     * they are skipped after a sample in which every block was powered off,
+     * at most @p max_skipped_dumps times in a row, so that a GPU that woke up
+     * is sampled again. Counts of a wrong guess are not lost: the next dump
+     * reads them, and its sample starts at the end of the skipped ones.
+     *
+     * Samplers that merge samples, see set_coalesced_samples(), or that read
+     * a multi-rate plan, see set_multi_rate(), always dump the counters.
+     *
+     * @param [in] enable             True to skip the dumps.
+     * @param [in] max_skipped_dumps  Number of dumps skipped in a row on the
+     *                                power states of the last sample.
+     */
+    void set_power_aware(bool enable, uint32_t max_skipped_dumps = 8) {
+        power_aware_ = enable;
+        max_skipped_dumps_ = max_skipped_dumps;
+    }
+
+    /** @brief Returns whether manual samplers skip the dumps of a powered down GPU. */
+    HWCP_NODISCARD bool get_power_aware() const { return power_aware_; }
+
+    /** @brief Returns the number of dumps skipped in a row on the power states of the last sample. */
+    HWCP_NODISCARD uint32_t get_max_skipped_dumps() const { return max_skipped_dumps_; }
+
+    /**
+     * @brief Sets a callback that tells the power-aware mode whether the GPU
+     * is powered down, see set_power_aware(). It is called before every
+     * manual dump, so it must be cheap, e.g. runtime_pm_probe::probe().
+     *
+     * @param [in] probe      The callback, or nullptr to use the power states
+     *                        of the blocks.
+     * @param [in] user_data  Passed to the callback.
+     */
+    void set_power_probe(power_probe probe, void *user_data) {
+        power_probe_ = probe;
+        power_probe_data_ = user_data;
+    }
+
+    /** @brief Returns the power probe, or nullptr. */
+    HWCP_NODISCARD power_probe get_power_probe() const { return power_probe_; }
+
+    /** @brief Returns the user data of the power probe. */
+    HWCP_NODISCARD void *get_power_probe_data() const { return power_probe_data_; }
+
+    /**
+     * @brief Sets the number of samples that the kernel ring buffer should
+     * hold. A deeper buffer uses more memory, and lets a periodic sampler be
+     * read later before samples are dropped. Zero, the default, requests the
+     * largest buffer that the backend allows.
+     *
+     * vinstr holds up to 32 samples, and rounds the count down to a power of
+     * two. kinstr_prfcnt sizes its ring buffer itself and ignores the count.
+     * sampler::get_features() reports the number of samples achieved, and
+     * sampler::recommend_buffering() the count that kept up with a session.
+     *
+     * @param [in] count  The number of samples.
+     */
+    void set_buffer_count(uint32_t count) { buffer_count_ = count; }
+
+    /** @brief Returns the number of samples requested for the kernel ring buffer. */
+    HWCP_NODISCARD uint32_t get_buffer_count() const { return buffer_count_; }
+
+    /**
+     * @brief Selects the clock of the sample timestamps. The kernel stamps the
+     * samples with CLOCK_MONOTONIC_RAW, which other traces, e.g. Perfetto's
+     * on CLOCK_BOOTTIME, don't use. With another domain the sampler converts
+     * the timestamps with a clock_correlator, that it calibrates once per
+     * @p calibration_interval_ns, so that the counters line up with those
+     * traces without converting them afterwards. clock_domain::sample, the
+     * default, keeps the kernel timestamps.
+     *
+     * @param [in] domain                   The clock of the timestamps.
+     * @param [in] calibration_interval_ns  How often the clocks are correlated.
+     */
+    void set_clock_domain(clock_domain domain,
+                          uint64_t calibration_interval_ns = clock_correlator::default_interval_ns) {
+        clock_domain_ = domain;
+        clock_calibration_interval_ns_ = calibration_interval_ns;
+    }
+
+    /** @brief Returns the clock of the sample timestamps. */
+    HWCP_NODISCARD clock_domain get_clock_domain() const { return clock_domain_; }
+
+    /** @brief Returns how often the clocks are correlated, in nanoseconds. */
+    HWCP_NODISCARD uint64_t get_clock_calibration_interval() const { return clock_calibration_interval_ns_; }
+
+    /**
+     * @brief Sets the CPU affinity and the scheduling class of the thread
+     * that collects the samples of a periodic sampler, e.g. to keep it on the
+     * little cores, away from the workload being measured.
+     * sampler::start_sampling() applies the configuration to the calling
+     * thread, which is expected to be the one that calls sample_now(). Manual
+     * samplers are sampled from the application's threads, so they ignore
+     * it. The default keeps the thread as it is.
+     *
+     * @param [in] config  The thread configuration.
+     */
+    void set_thread_config(const device::hwcnt::sampler::thread_config &config) { thread_config_ = config; }
+
+    /** @brief Returns the configuration of the collecting thread. */
+    HWCP_NODISCARD const device::hwcnt::sampler::thread_config &get_thread_config() const { return thread_config_; }
+
+    /**
+     * @brief Saves the resolved configuration as a compact plan: the
+     * counters with their block addresses, including the dependencies of the
+     * expressions, the enable maps, the block counters and the settings. A
+     * tool that starts often with the same counters saves the plan once and
+     * loads it with load_plan() instead of resolving every counter against
+     * the database again. The drop handler is not saved.
+     *
+     * @param [out] plan  The plan.
+     * @return Returns hwcpipe::errc::sampler_config_invalid if the
+     * configuration has custom counters, whose expressions are not kept once
+     * compiled.
+     */
+    HWCP_NODISCARD std::error_code save_plan(std::vector<uint8_t> &plan) const;
+
+    /**
+     * @brief Loads a plan saved by save_plan(), replacing the counters and
+     * the settings of this configuration. The plan is checked against the
+     * product ID of the configuration and against a checksum of the counter
+     * database of the GPU, so a plan saved for another GPU or by a library
+     * with another database is rejected rather than misread.
+     *
+     * @param [in] data  The plan.
+     * @param [in] size  Size of the plan in bytes.
+     * @return Returns hwcpipe::errc::invalid_sampler_plan if the plan is
+     * corrupted, or was saved for another GPU or database, in which case the
+     * configuration is unchanged.
+     */
+    HWCP_NODISCARD std::error_code load_plan(const void *data, size_t size);
+
+    /**
+     * @brief Returns the memory held by the configuration in bytes: the
+     * object, and the allocations of its counter set and custom counters.
+     */
+    HWCP_NODISCARD size_t get_memory_footprint() const {
+        size_t result = sizeof(*this) + counters_.heap_bytes() + detail::heap_bytes(custom_counters_) +
+                        detail::heap_bytes(block_counters_) + detail::heap_bytes(fast_counters_);
+        for (const auto &custom : custom_counters_) {
+            result += custom.heap_bytes();
+        }
+        return result;
+    }
+
+  private:
+    using block_type = device::hwcnt::block_type;
+
+    device::product_id pid_;
+    int device_number_;
+
+    detail::counter_database db_{};
+    registered_counter_set counters_{};
+    std::vector<detail::expression::custom_expression> custom_counters_{};
+    std::vector<block_counter> block_counters_{};
+    std::array<backend_cfg_type, device::hwcnt::block_extents::num_block_types> backend_config_{};
+    expression_evaluation expression_evaluation_{expression_evaluation::lazy};
+    uint64_t sampling_period_ns_{};
+    bool per_instance_values_{};
+    uint32_t coalesced_samples_{1};
+    uint32_t core_subsampling_{};
+    std::vector<hwcpipe_counter> fast_counters_{};
+    uint32_t slow_period_{1};
+    bool idle_skip_{};
+    bool armed_sessions_{};
+    bool saturation_check_{};
+    bool lazy_decode_{};
+    bool has_trigger_{};
+    sample_trigger trigger_{};
+    drop_policy drop_policy_{drop_policy::reject};
+    drop_handler drop_handler_{};
+    void *drop_handler_data_{};
+    uint32_t session_recovery_{};
+    bool power_aware_{};
+    uint32_t max_skipped_dumps_{8};
+    power_probe power_probe_{};
+    void *power_probe_data_{};
+    uint32_t buffer_count_{};
+    clock_domain clock_domain_{clock_domain::sample};
+    uint64_t clock_calibration_interval_ns_{clock_correlator::default_interval_ns};
+    device::hwcnt::sampler::thread_config thread_config_{};
+
+    HWCP_NODISCARD std::error_code
+    add_expression_depedencies(const detail::expression::expression_definition &expression) {
+        std::error_code ec;
+        for (auto dependency : expression.dependencies) {
+            ec = add_counter(dependency);
+            if (ec) {
+                return ec;
+            }
+        }
+        return {};
+    }
+};
+
+namespace detail {
+/**
+ * Resolved location of a counter's value. Hardware counters are read from the
+ * sample buffer, expressions are either evaluated on demand or read from the
+ * derived value buffer when they are evaluated eagerly.
+ */
+struct counter_lookup_entry {
+    enum class type : uint8_t { unused, hardware, expression, cached_expression };
+
+    type tag{type::unused};
+    size_t buffer_pos{};
+    expression::evaluator eval{};
+};
+} // namespace detail
+
+/**
+ * @brief Consecutive samples in which the GPU was idle, as returned by
+ * sampler::get_idle_span().
+ */
+struct idle_span {
+    /** Number of idle samples. */
+    uint64_t num_samples;
+    /** Start of the first idle sample, in nanoseconds. */
+    uint64_t timestamp_ns_begin;
+    /** End of the last idle sample, in nanoseconds. */
+    uint64_t timestamp_ns_end;
+};
+
+/**
+ * @brief The interval that the last sample read covers, and the cycles that the
+ * GPU counted during it, as returned by sampler::get_sample_interval(). The
+ * cycles are reported by the kernel with each sample, so they are available
+ * without enabling the cycle counters.
+ */
+struct sample_interval {
+    /** Start of the sample, in nanoseconds. */
+    uint64_t timestamp_ns_begin;
+    /** End of the sample, in nanoseconds. */
+    uint64_t timestamp_ns_end;
+    /** GPU cycles counted during the sample, zero if features::has_gpu_cycle is false. */
+    uint64_t gpu_cycles;
+    /** Shader core cycles counted during the sample, zero if features::has_sc_cycle is false. */
+    uint64_t sc_cycles;
+
+    /** @return The duration of the sample, in nanoseconds. */
+    HWCP_NODISCARD uint64_t duration_ns() const { return timestamp_ns_end - timestamp_ns_begin; }
+
+    /**
+     * @return The average GPU frequency during the sample, in Hz, or zero if
+     * the GPU cycles or the duration are unknown.
+     */
+    HWCP_NODISCARD double gpu_frequency() const {
+        return duration_ns() == 0 ? 0.0 : static_cast<double>(gpu_cycles) * 1e9 / static_cast<double>(duration_ns());
+    }
+};
+
+/** @brief How a read_list normalizes the value of a counter. */
+enum class counter_normalization : uint8_t {
+    /** The value of the sample, as counted. */
+    none,
+    /** The value divided by the duration of the sample, per second. */
+    per_second,
+    /** The value divided by the GPU cycles of the sample. */
+    per_cycle,
+};
+
+/**
+ * @brief A counter to read with a read_list, and how to normalize it. A
+ * counter can be requested several times, e.g. to read its value and its rate
+ * side by side.
+ */
+struct read_request {
+    /** The counter to read. */
+    hwcpipe_counter counter;
+    /** How to normalize its value. */
+    counter_normalization normalization;
+};
+
+namespace detail {
+/** @return @p value as a counter value of type @p value_t. */
+template <typename value_t>
+value_t to_counter_value(double value);
+
+template <>
+inline double to_counter_value<double>(double value) {
+    return value;
+}
+
+/**
+ * @return @p value as an integer counter value, truncated towards zero. NaN
+ * and negative values are clamped to zero, and the values that don't fit to
+ * UINT64_MAX, as their conversion is undefined.
+ */
+template <>
+inline uint64_t to_counter_value<uint64_t>(double value) {
+    // 2^64, the first value that doesn't fit
+    constexpr double limit = 18446744073709551616.0;
+    if (!(value > 0.0)) {
+        return 0;
+    }
+    return value >= limit ? std::numeric_limits<uint64_t>::max() : static_cast<uint64_t>(value);
+}
+
+/** @return A new identifier of the counter layout of a sampler, never zero. */
+inline uint64_t next_counter_layout() {
+    static std::atomic<uint64_t> last{};
+    return last.fetch_add(1, std::memory_order_relaxed) + 1;
+}
+} // namespace detail
+
+/**
+ * @brief A read_list is a precompiled list of counters that can be read from
+ * a sampler in a single call to sampler::get_counter_values(). It is built by
+ * sampler::make_read_list() and can only be used with the sampler that
+ * created it, until the sampler is reconfigured.
+ */
+class read_list {
+  public:
+    /** Default constructor, creates an empty list. */
+    read_list() = default;
+
+    /** @return The number of counters in the list. */
+    HWCP_NODISCARD size_t size() const { return entries_.size(); }
+
+    /** @return True if the list has no counters. */
+    HWCP_NODISCARD bool empty() const { return entries_.empty(); }
+
+  private:
+    template <typename backend_policy_t>
+    friend class sampler;
+
+    std::vector<detail::counter_lookup_entry> entries_{};
+    // output positions of the normalized values, per normalization
+    std::vector<uint32_t> per_second_{};
+    std::vector<uint32_t> per_cycle_{};
+    // the GPU cycles counter, read when the backend doesn't report the cycles
+    detail::counter_lookup_entry cycles_entry_{};
+    // the counter layout of the sampler that built the list
+    uint64_t layout_{};
+};
+
+/**
+ * @brief A sampler is responsible for collecting counter samples from the GPU
+ * and presenting them in a more user-friendly manner.
+ */
+template <typename backend_policy_t = hwcpipe::detail::hwcpipe_backend_policy>
+class sampler : private detail::expression::context {
+    using handle_type = typename backend_policy_t::handle_type;
+    using instance_type = typename backend_policy_t::instance_type;
+    using sampler_type = typename backend_policy_t::sampler_type;
+    using periodic_sampler_type = typename backend_policy_t::periodic_sampler_type;
+    using sample_type = typename backend_policy_t::sample_type;
+    using block_type = device::hwcnt::block_type;
+    using block_extents_type = std::decay_t<decltype(std::declval<instance_type &>().get_hwcnt_block_extents())>;
+
+    // view over the precomputed sample records
+    class sample_range {
+      public:
+        using iterator = const counter_sample *;
+
+        sample_range(iterator begin, iterator end)
+            : begin_(begin)
+            , end_(end) {}
+
+        iterator begin() const { return begin_; }
+        iterator end() const { return end_; }
+        size_t size() const { return static_cast<size_t>(end_ - begin_); }
+
+      private:
+        iterator begin_;
+        iterator end_;
+    };
+
+  public:
+    /**
+     * @brief View over the blocks of a kernel sample: their type, index,
+     * state and mapped values, as given to the callback of sample_raw().
+     */
+    class block_range {
+      public:
+        using iterator = const device::hwcnt::block_metadata *;
+
+        block_range(iterator begin, iterator end)
+            : begin_(begin)
+            , end_(end) {}
+
+        iterator begin() const { return begin_; }
+        iterator end() const { return end_; }
+        size_t size() const { return static_cast<size_t>(end_ - begin_); }
+
+      private:
+        iterator begin_;
+        iterator end_;
+    };
+
+    /**
+     * Constructs a sampler from the specified config object. This will attempt
+     * to create the relevant resources in the kernel driver. If this fails then
+     * the resulting sampler instance will be invalid and any attempts to start
+     * sampling will fail with an error_code.
+     *
+     * The caller must check that the resulting instance is valid before trying
+     * to use it.
+     * @par
+     * @code
+     * auto sampler = hwcpipe::sampler(config);
+     * if (!sampler) {
+     *    // sampler creation failed
+     * }
+     * @endcode
+     */
+    sampler(const sampler_config &config) {
+        // the device is shared with the other samplers and gpus of the device number
+        device_ = device_registry_type::get().acquire(config.get_device_number());
+        if (!device_) {
+            ec_ = make_error_code(errc::backend_creation_failed);
+            return;
+        }
+
+        configure(config);
+    }
+
+    /**
+     * Constructs a sampler for a device that the application already opened,
+     * e.g. with `device::handle::from_external_fd()` on the file descriptor of
+     * its graphics driver, rather than opening the device number of @p config
+     * again. This saves the kernel a second driver context.
+     *
+     * @param [in] config  The sampler configuration.
+     * @param [in] handle  The device handle, which must outlive the sampler.
+     */
+    sampler(const sampler_config &config, handle_type &handle) { init(config, handle); }
+
+    operator bool() const { return !ec_; }
+
+    /**
+     * @brief Switches the sampler to another counter configuration, e.g. when
+     * the counters shown by a profiler change, without closing the device.
+     *
+     * The device handle and instance are kept. When the backend configuration
+     * (enable maps, sampling period and buffer count) doesn't change, the
+     * backend session and its mapped ring buffer are kept too, and only the
+     * counter mappings are rebuilt. Otherwise only the backend session is
+     * set up again. The trace recorder and statistics are kept.
+     *
+     * The read lists built by make_read_list() before are invalid, and must
+     * be built again. An armed session, see
+     * sampler_config::set_armed_sessions(), is stopped first.
+     *
+     * @param [in] config  The new configuration. Its device number is ignored,
+     *                     the sampled device is unchanged.
+     * @return Returns hwcpipe::errc::sampling_already_started if sampling is
+     * in progress, hwcpipe::errc::accumulation_stop_failed if an armed session
+     * could not be stopped, the error of the sampler if it's invalid. If the new
+     * configuration can't be applied, the error is returned and the sampler
+     * is invalid, as if its construction had failed.
+     */
+    HWCP_NODISCARD std::error_code reconfigure(const sampler_config &config) {
+        if (!device_) {
+            return ec_;
+        }
+        if (sampling_in_progress_) {
+            return make_error_code(errc::sampling_already_started);
+        }
+        if (armed_) {
+            // the next start_sampling() starts the session again
+            if (sampler_->accumulation_stop(0)) {
+                return make_error_code(errc::accumulation_stop_failed);
+            }
+            armed_ = false;
+        }
+
+        sampler next{};
+        next.device_ = std::move(device_);
+        next.trace_recorder_ = trace_recorder_;
+        next.record_sample_ = record_sample_;
+        next.stats_ = stats_;
+
+        if (!ec_ && !backend_failed_ && is_same_backend_config(config)) {
+            next.sampler_ = std::move(sampler_);
+            next.periodic_sampler_ = std::move(periodic_sampler_);
+        } else {
+            // release the current session before setting up the new one
+            sampler_.reset();
+            periodic_sampler_.reset();
+        }
+
+        next.configure(config);
+        *this = std::move(next);
+        return ec_;
+    }
+
+    /** @brief Returns the constants of the sampled GPU. */
+    HWCP_NODISCARD const device::constants &get_constants() const { return constants_; }
+
+    /** @brief Returns the hardware counter block layout of the sampled GPU. */
+    HWCP_NODISCARD const block_extents_type &get_block_extents() const { return block_extents_; }
+
+    /**
+     * @brief Returns the features of the backend reader, e.g. the number of
+     * samples its kernel ring buffer holds. Backends that don't report their
+     * features are assumed to saturate their counters on overflow.
+     */
+    HWCP_NODISCARD const device::hwcnt::features &get_features() const { return features_; }
+
+    /**
+     * @brief Returns the memory held by the sampler, by part. The buffers are
+     * sized when the sampler is constructed, so the footprint only changes
+     * when it is reconfigured.
+     */
+    HWCP_NODISCARD sampler_memory_footprint get_memory_footprint() const {
+        sampler_memory_footprint result{};
+        result.object = sizeof(*this);
+        result.sample_buffers = detail::heap_bytes(sample_buffer_) + detail::heap_bytes(decoded_blocks_) +
+                                detail::heap_bytes(raw_buffer_) + detail::heap_bytes(window_buffer_) +
+                                detail::heap_bytes(instance_buffer_) + detail::heap_bytes(block_counter_buffer_) +
+                                detail::heap_bytes(block_totals_) + detail::heap_bytes(expression_inputs_) +
+                                detail::heap_bytes(derived_buffer_) + detail::heap_bytes(custom_inputs_) +
+                                detail::heap_bytes(custom_values_) + detail::heap_bytes(sample_records_) +
+                                detail::heap_bytes(core_values_) + detail::heap_bytes(core_sum_sq_) +
+                                detail::heap_bytes(core_errors_) + detail::heap_bytes(slow_totals_) +
+                                detail::heap_bytes(slow_window_buffer_) + detail::heap_bytes(lazy_values32_) +
+                                detail::heap_bytes(lazy_values64_);
+        result.index_maps = detail::heap_bytes(counter_lookup_) + gather_plan_.heap_bytes() +
+                            slow_gather_plan_.heap_bytes() + detail::heap_bytes(slow_expression_plan_) +
+                            detail::heap_bytes(instance_rows_) + detail::heap_bytes(block_counter_rows_) +
+                            detail::heap_bytes(expression_plan_) + detail::heap_bytes(expression_operands_) +
+                            detail::heap_bytes(custom_plan_) + detail::heap_bytes(custom_operands_) +
+                            detail::heap_bytes(sample_record_entries_) + detail::heap_bytes(backend_config_list_) +
+                            detail::heap_bytes(lazy_blocks_) + detail::heap_bytes(buffer_block_types_);
+        for (const auto &step : custom_plan_) {
+            result.index_maps += step.program.heap_bytes();
+        }
+        result.kernel_mapping = static_cast<size_t>(features_.mapped_size);
+        return result;
+    }
+
+    /**
+     * @brief Attaches a recorder that is given every raw backend sample before
+     * it is decoded, e.g. a hwcpipe::trace_recorder. Samples flagged as
+     * stretched or erroneous are recorded too. If the recorder fails, the
+     * sample is dropped and its error is returned by sample_now() or
+     * try_collect().
+     *
+     * @param [in] recorder  An object with a
+     *                       `std::error_code record(const sample_type &)`
+     *                       member, which must outlive the sampler, or
+     *                       nullptr to detach the current recorder.
+     */
+    template <typename recorder_t>
+    void set_trace_recorder(recorder_t *recorder) {
+        trace_recorder_ = recorder;
+        record_sample_ = nullptr;
+        if (recorder != nullptr) {
+            record_sample_ = [](void *target, const sample_type &sample) {
+                return static_cast<recorder_t *>(target)->record(sample);
+            };
+        }
+    }
+
+    /**
+     * @brief Starts counter accumulation. For a periodic sampler this also
+     * starts the periodic sampling, and applies the thread configuration of
+     * sampler_config::set_thread_config() to the calling thread.
+     *
+     * @param [in] user_data  A tag stored by the kernel with the first
+     *                        periodic sample, e.g. a frame number, see
+     *                        get_sample_user_data(). Manual samplers don't
+     *                        take a sample when they start, so they ignore it.
+     * @return Returns hwcpipe::errc::thread_config_failed if the thread
+     * configuration could not be applied, an error if the sampler backend
+     * could not be started or if sampling was already in progress,
+     * hwcpipe::errc::sample_collection_failure if the baseline sample of an
+     * armed session could not be taken, otherwise returns a default
+     * constructed error_code.
+     */
+    HWCP_NODISCARD std::error_code start_sampling(uint64_t user_data = 0) {
+        if (ec_) {
+            return ec_;
+        }
+        if (sampling_in_progress_) {
+            return make_error_code(errc::sampling_already_started);
+        }
+        if (periodic_sampler_ && device::hwcnt::sampler::apply_thread_config(thread_config_)) {
+            return make_error_code(errc::thread_config_failed);
+        }
+        if (armed_) {
+            auto ec = take_baseline_sample();
+            if (ec) {
+                return ec;
+            }
+        } else {
+            auto ec =
+                periodic_sampler_ ? periodic_sampler_->sampling_start(user_data) : sampler_->accumulation_start();
+            if (ec) {
+                return make_error_code(errc::accumulation_start_failed);
+            }
+            armed_ = armed_sessions_;
+        }
+        sampling_in_progress_ = true;
+        request_pending_ = false;
+        window_samples_ = 0;
+        reset_slow_window();
+        idle_ = false;
+        has_last_sample_nr_ = false;
+        recovered_ = false;
+        skipped_dumps_ = 0;
+        powered_off_ = false;
+        has_sample_end_ = false;
+        session_dropped_ = 0;
+        session_max_backlog_ = 0;
+        saturated_ = false;
+        triggered_ = false;
+        max_sampling_period_ns_ = 0;
+        return {};
+    }
+
+    /**
+     * @brief Requests that counter accumulation is stopped. If the request
+     * fails an error is returned, the sampler should be considered to be in an
+     * undefined state and should not be used further.
+     *
+     * An armed session, see sampler_config::set_armed_sessions(), keeps
+     * accumulating and no sample is taken.
+     *
+     * @param [in] user_data  A tag stored by the kernel with the last sample,
+     *                        which is taken when sampling stops.
+     * @return A default constructed error_code on success, or an error if the
+     * request failed.
+     */
+    HWCP_NODISCARD std::error_code stop_sampling(uint64_t user_data = 0) {
+        if (ec_) {
+            return ec_;
+        }
+        if (!sampling_in_progress_) {
+            return make_error_code(errc::sampling_not_started);
+        }
+        if (!armed_) {
+            auto ec = periodic_sampler_ ? periodic_sampler_->sampling_stop(user_data)
+                                        : sampler_->accumulation_stop(user_data);
+            if (ec) {
+                return make_error_code(errc::accumulation_stop_failed);
+            }
+        }
+        sampling_in_progress_ = false;
+        request_pending_ = false;
+        return {};
+    }
+
+    /**
+     * @brief Sets the backend session up again after the kernel reported an
+     * error, without the cost of a new sampler: the device handle and
+     * instance, the counter plan and the sample buffer are kept. The session
+     * is created with the same backend configuration and, if sampling was in
+     * progress or the session armed, started again.
+     *
+     * The counts between the error and the recovery are lost. The next
+     * sample accepted is marked by is_after_recovery() and by the
+     * drop_event::recovered of the drop handler, and only counts from the
+     * recovery. The time taken is added to sampler_stats::recovery.
+     *
+     * sample_now() and the other collection calls recover the session by
+     * themselves when sampler_config::set_session_recovery() is set.
+     *
+     * @param [in] user_data  A tag stored by the kernel with the first
+     *                        periodic sample of the new session.
+     * @return hwcpipe::errc::backend_sampler_failure if the session could
+     * not be created, in which case the sampler is invalid until a recovery
+     * succeeds, hwcpipe::errc::accumulation_start_failed if it could not be
+     * started, in which case sampling is stopped. The error of the sampler if
+     * it never had a backend session.
+     */
+    HWCP_NODISCARD std::error_code recover_session(uint64_t user_data = 0) {
+        if (!device_ || backend_config_list_.empty()) {
+            return ec_;
+        }
+
+        const auto begin = detail::sampler_stats_counters::clock::now();
+        const bool sampling = sampling_in_progress_;
+        const bool armed = armed_;
+        backend_failed_ = true;
+        sampling_in_progress_ = false;
+        armed_ = false;
+        request_pending_ = false;
+
+        // the failed session is released before the new one is set up
+        sampler_.reset();
+        periodic_sampler_.reset();
+        if (!create_backend_sampler(backend_config_list_, backend_period_ns_, backend_buffer_count_)) {
+            ec_ = make_error_code(errc::backend_sampler_failure);
+            stats_.recovery().add(begin);
+            return ec_;
+        }
+        ec_ = {};
+
+        if (sampling || armed) {
+            auto ec =
+                periodic_sampler_ ? periodic_sampler_->sampling_start(user_data) : sampler_->accumulation_start();
+            if (ec) {
+                stats_.recovery().add(begin);
+                return make_error_code(errc::accumulation_start_failed);
+            }
+        }
+
+        // the new session numbers its samples from scratch, and the windows
+        // and spans of the failed one can't be completed
+        backend_failed_ = false;
+        sampling_in_progress_ = sampling;
+        armed_ = armed;
+        recovered_ = sampling;
+        window_samples_ = 0;
+        reset_slow_window();
+        idle_ = false;
+        has_last_sample_nr_ = false;
+        skipped_dumps_ = 0;
+        powered_off_ = false;
+        has_sample_end_ = false;
+        stats_.recovery().add(begin);
+        return {};
+    }
+
+    /**
+     * @brief Updates the sample buffer with the most recent counter values.
+     * The buffer can then be queried via get_counter_value(). If an error
+     * occurs while trying to read the counters then the contents of the sample
+     * buffer are unchanged and further queries will return the old values.
+     *
+     * For a periodic sampler no sample is requested. Instead the oldest
+     * kernel-timed sample that has not been read yet is collected, waiting
+     * for the next one if none are available. When samples are merged, see
+     * sampler_config::set_coalesced_samples(), the samples of a whole window
+     * are taken.
+     *
+     * When sampler_config::set_session_recovery() is set, a backend error
+     * sets the backend session up again, see recover_session(), and the
+     * sample is taken from the new session.
+     *
+     * @param [in] user_data  A tag stored by the kernel with the manual
+     *                        sample, e.g. a frame number or a draw batch ID,
+     *                        see get_sample_user_data().
+     * @return An error if sampling has not been started, or if an error
+     * occurred while reading counters from the GPU.
+     */
+    HWCP_NODISCARD std::error_code sample_now(uint64_t user_data = 0) {
+        if (skip_dump()) {
+            return take_powered_down_sample(user_data);
+        }
+        std::error_code ec;
+        uint32_t attempts = 0;
+        do {
+            ec = request_sample(false, user_data);
+            if (!ec) {
+                ec = collect_sample();
+            }
+            ec = recover_after(ec, attempts);
+        } while (ec == make_error_code(errc::sample_not_ready));
+        return ec;
+    }
+
+    /**
+     * @brief Same as sample_now(), except that the wait for the sample is
+     * bounded, so that a collector can skip a late sample and keep its
+     * schedule if the GPU stalls or the kernel never delivers the sample.
+     * A manual sample is requested asynchronously so that the request doesn't
+     * block either.
+     *
+     * @param [in] timeout_ns  Time to wait for the sample in nanoseconds,
+     *                         rounded up to milliseconds by the kernel
+     *                         backends.
+     * @param [in] user_data   A tag stored with the manual sample, as for
+     *                         sample_now().
+     * @return hwcpipe::errc::sample_not_ready if no sample was ready in time,
+     * or if the sample didn't complete a window of merged samples.
+     * In that case the sample buffer is unchanged, and a manual request stays
+     * pending: the next sample_now_for(), sample_now_until() or try_collect()
+     * collects the late sample rather than requesting another one. It is
+     * also returned once the backend session was recovered after an error,
+     * see sampler_config::set_session_recovery(), and the next call requests
+     * a sample from the new session. Otherwise the same errors as
+     * sample_now().
+     */
+    HWCP_NODISCARD std::error_code sample_now_for(uint64_t timeout_ns, uint64_t user_data = 0) {
+        if (skip_dump()) {
+            return take_powered_down_sample(user_data);
+        }
+        uint32_t attempts = 0;
+        if (!request_pending_) {
+            auto ec = request_sample(true, user_data);
+            if (ec) {
+                return recover_after(ec, attempts);
+            }
+        }
+        request_pending_ = !periodic_sampler_;
+        return recover_after(wait_and_collect(timeout_ns), attempts);
+    }
+
+    /**
+     * @brief Same as sample_now_for(), with the wait bounded by a deadline.
+     * If the deadline has passed, the sample is only collected if it is
+     * ready.
+     *
+     * @param [in] deadline   Time by which the sample must be ready.
+     * @param [in] user_data  A tag stored with the manual sample, as for
+     *                        sample_now().
+     * @return The same errors as sample_now_for().
+     */
+    HWCP_NODISCARD std::error_code sample_now_until(std::chrono::steady_clock::time_point deadline,
+                                                    uint64_t user_data = 0) {
+        const auto now = std::chrono::steady_clock::now();
+        const auto timeout =
+            deadline > now ? std::chrono::duration_cast<std::chrono::nanoseconds>(deadline - now).count() : 0;
+        return sample_now_for(static_cast<uint64_t>(timeout), user_data);
+    }
+
+    /**
+     * @brief Requests a sample without waiting for it to be taken. The sample
+     * can then be collected with try_collect(), which lets the caller overlap
+     * the dump latency with other work. Where the kernel supports it the dump
+     * is requested asynchronously, so the call does not wait for the dump to
+     * complete either. For a periodic sampler this is a no-op because samples
+     * are taken by the kernel.
+     *
+     * @param [in] user_data  A tag stored with the manual sample, as for
+     *                        sample_now().
+     * @return An error if sampling has not been started, or if the request was
+     * rejected by the GPU.
+     */
+    HWCP_NODISCARD std::error_code request_sample_async(uint64_t user_data = 0) {
+        return request_sample(true, user_data);
+    }
+
+    /**
+     * @brief Returns the file descriptor of the backend reader, which is
+     * readable when a sample can be collected, or -1 if the sampler is
+     * invalid. It can be registered with an event loop or a reactor, see
+     * hwcpipe::async_sampler, which then calls try_collect() instead of
+     * blocking a thread in sample_now().
+     */
+    HWCP_NODISCARD int get_fd() const {
+        if (periodic_sampler_) {
+            return periodic_sampler_->get_reader().get_fd();
+        }
+        return sampler_ ? sampler_->get_reader().get_fd() : -1;
+    }
+
+    /**
+     * @brief Updates the sample buffer if a sample is ready, without blocking.
+     * On success the buffer can be queried via get_counter_value() exactly as
+     * after sample_now().
+     *
+     * @return hwcpipe::errc::sample_not_ready if no sample is available yet,
+     * or if the sample didn't complete a window of merged samples, or once
+     * the backend session was recovered after an error, see
+     * sampler_config::set_session_recovery(). In that case the sample buffer
+     * is unchanged and the call can be retried. Otherwise the same errors as
+     * sample_now().
+     */
+    HWCP_NODISCARD std::error_code try_collect() {
+        if (!sampling_in_progress_) {
+            return make_error_code(errc::sampling_not_started);
+        }
+
+        uint32_t attempts = 0;
+        bool ready{};
+        auto ec = get_reader().is_sample_ready(ready);
+        if (ec) {
+            backend_failed_ = true;
+            return recover_after(make_error_code(errc::sample_collection_failure), attempts);
+        }
+        if (!ready) {
+            return make_error_code(errc::sample_not_ready);
+        }
+        return recover_after(collect_sample(), attempts);
+    }
+
+    /**
+     * @brief Takes a sample like sample_now(), and passes the blocks of the
+     * kernel sample to a callback instead of decoding them. The block values
+     * are the memory mapped from the kernel, so whole blocks can be captured
+     * without a copy. They are only valid during the callback: the sample is
+     * given back to the kernel once it returns.
+     *
+     * The sample buffer is unchanged, and a window of merged samples is
+     * restarted as the raw sample isn't part of it. Stretched and erroneous
+     * samples are rejected as by sample_now() and not passed to the
+     * callback.
+     *
+     * @par
+     * @code
+     * ec = sampler.sample_raw([&](const auto &metadata, const auto &blocks) {
+     *     for (const auto &block : blocks) {
+     *         writer.write_block(metadata.sample_nr, block.type, block.index, block.values);
+     *     }
+     * });
+     * @endcode
+     *
+     * @param [in] callback   Called with the device::hwcnt::sample_metadata
+     *                        and the block_range of the sample.
+     * @param [in] user_data  A tag stored in the sample_metadata of the manual
+     *                        sample, as for sample_now().
+     * @return The same errors as sample_now().
+     */
+    template <typename callback_t>
+    HWCP_NODISCARD std::error_code sample_raw(callback_t &&callback, uint64_t user_data = 0) {
+        auto ec = request_sample(false, user_data);
+        if (ec) {
+            return ec;
+        }
+
+        const auto begin = detail::sampler_stats_counters::clock::now();
+        request_pending_ = false;
+        window_samples_ = 0;
+        reset_slow_window();
+        idle_ = false;
+        auto backend_sample = sample_type(get_reader(), ec);
+        if (ec) {
+            stats_.collect().add(begin);
+            backend_failed_ = true;
+            return make_error_code(errc::sample_collection_failure);
+        }
+        if (record_sample_ != nullptr) {
+            const auto record_ec = record_sample_(trace_recorder_, backend_sample);
+            if (record_ec) {
+                return record_ec;
+            }
+        }
+
+        const auto &metadata = backend_sample.get_metadata();
+        if (!accept_sample(metadata)) {
+            stats_.collect().add(begin);
+            return make_error_code(errc::sample_collection_failure);
+        }
+
+        auto blocks = read_blocks(backend_sample, 0);
+        callback(metadata, blocks);
+        stats_.collect().add(begin);
+        return {};
+    }
+
+    /**
+     * @brief Same as try_collect(), except that the call waits for the sample
+     * to be ready for a bounded time. This collects a sample requested with
+     * request_sample_async(), or the next sample of a periodic sampler.
+     *
+     * @param [in] timeout_ns  Time to wait for the sample in nanoseconds,
+     *                         rounded up to milliseconds by the kernel
+     *                         backends.
+     * @return The same errors as try_collect().
+     */
+    HWCP_NODISCARD std::error_code collect_for(uint64_t timeout_ns) {
+        if (!sampling_in_progress_) {
+            return make_error_code(errc::sampling_not_started);
+        }
+        uint32_t attempts = 0;
+        return recover_after(wait_and_collect(timeout_ns), attempts);
+    }
+
+    /**
+     * @brief Fetches the last sampled value for a counter.
+     *
+     * @param [in]  counter  The counter to read.
      * @param [out] sample   Populated with data from the counter.
      * @return Returns hwcpipe::errc::unknown_counter if the counter was not
      * configured for sampling, otherwise an empty error_code.
      */
-    HWCP_NODISCARD std::error_code get_counter_value(hwcpipe_counter counter, counter_sample &sample) const {
-        // if the data wasn't captured during the last poll flag an error for
-        // the caller
-        if (!valid_sample_buffer_) {
-            return make_error_code(errc::sample_collection_failure);
+    HWCP_NODISCARD std::error_code get_counter_value(hwcpipe_counter counter, counter_sample &sample) const {
+        // if the data wasn't captured during the last poll flag an error for
+        // the caller
+        if (!valid_sample_buffer_) {
+            return make_error_code(errc::sample_collection_failure);
+        }
+
+        const auto *entry = find_counter(counter);
+        if (entry == nullptr) {
+            return make_error_code(errc::unknown_counter);
+        }
+
+        switch (entry->tag) {
+        case lookup_entry::type::expression:
+            return get_expression_counter_value(counter, sample, entry->eval);
+        case lookup_entry::type::cached_expression:
+            sample = counter_sample(counter, last_collection_timestamp_, derived_buffer_[entry->buffer_pos]);
+            return {};
+        case lookup_entry::type::hardware:
+        case lookup_entry::type::unused:
+        default:
+            sample = counter_sample(counter, last_collection_timestamp_, read_hardware(entry->buffer_pos));
+            return {};
+        }
+    }
+
+    /**
+     * @brief Returns the timestamp of the last collected sample, in
+     * nanoseconds. This is the timestamp of every counter_sample read from it.
+     */
+    HWCP_NODISCARD uint64_t get_sample_timestamp() const { return last_collection_timestamp_; }
+
+    /**
+     * @brief Returns the end timestamp of the last collected sample, in
+     * nanoseconds. The counters were accumulated between
+     * get_sample_timestamp() and this timestamp.
+     */
+    HWCP_NODISCARD uint64_t get_sample_timestamp_end() const { return last_collection_timestamp_end_; }
+
+    /**
+     * @brief Returns the correlation of the kernel sample clock with the clock
+     * of sampler_config::set_clock_domain(), e.g. its offset and drift.
+     */
+    HWCP_NODISCARD const clock_correlator &get_clock_correlator() const { return clock_correlator_; }
+
+    /**
+     * @brief Returns the interval of the last collected sample, with the GPU
+     * and shader core cycles that the kernel reported for it, see
+     * get_features(). The cycles of merged samples are summed over the window.
+     */
+    HWCP_NODISCARD sample_interval get_sample_interval() const {
+        return {last_collection_timestamp_, last_collection_timestamp_end_, last_gpu_cycles_, last_sc_cycles_};
+    }
+
+    /**
+     * @brief Returns the tag of the last collected sample, as given to the
+     * call that took it, e.g. sample_now() or stop_sampling(). Periodic samples
+     * are tagged with zero, except for the first and last ones. Merged samples
+     * have the tag of the last sample of their window.
+     */
+    HWCP_NODISCARD uint64_t get_sample_user_data() const { return last_user_data_; }
+
+    /**
+     * @brief Returns the flags of the last collected sample. A sample is only
+     * read while stretched or erroneous with sampler_config::drop_policy::widen
+     * or sampler_config::drop_policy::salvage. Merged samples have the flags of
+     * the last sample of their window.
+     */
+    HWCP_NODISCARD device::hwcnt::sample_flags get_sample_flags() const { return last_flags_; }
+
+    /**
+     * @brief Returns whether the backend session is accumulating between
+     * measurements, see sampler_config::set_armed_sessions().
+     */
+    HWCP_NODISCARD bool is_armed() const { return armed_; }
+
+    /**
+     * @brief Returns whether the GPU was idle during the last sample read,
+     * when sampler_config::set_idle_skip() is enabled. An exporter can then
+     * extend its idle span rather than write the sample.
+     */
+    HWCP_NODISCARD bool is_idle() const { return idle_; }
+
+    /**
+     * @brief Returns whether the last sample read is the first one since the
+     * backend session was recovered after an error, see recover_session().
+     * The counts between the sample before it and the recovery are lost.
+     */
+    HWCP_NODISCARD bool is_after_recovery() const { return after_recovery_; }
+
+    /**
+     * @brief Returns the current idle span if the last sample read was idle,
+     * otherwise the last one of the session. The span is empty if no sample
+     * was idle.
+     */
+    HWCP_NODISCARD const idle_span &get_idle_span() const { return idle_span_; }
+
+    /**
+     * @brief Returns whether a 32-bit counter of the last sample read reached
+     * its maximum value, when sampler_config::set_saturation_check() is
+     * enabled. The values of the saturated counters, and of the expressions
+     * that read them, are then too low.
+     */
+    HWCP_NODISCARD bool is_saturated() const { return saturated_; }
+
+    /**
+     * @brief Returns the number of blocks of a type that counted during the
+     * last sample read, e.g. the shader cores that were powered, to average
+     * a counter over the active instances. When the backend reports the
+     * block states, see device::hwcnt::features, the blocks that were powered
+     * off, unavailable or in protected mode for the whole sample hold no
+     * data: they are not decoded nor counted. Otherwise every block is
+     * counted. Zero for idle samples, which aren't decoded, and for merged
+     * samples the count of the last sample of the window.
+     *
+     * @param [in] type  The block type.
+     */
+    HWCP_NODISCARD uint32_t get_active_instances(device::hwcnt::block_type type) const {
+        return active_instances_[static_cast<size_t>(type)];
+    }
+
+    /**
+     * @brief Returns the longest sampling period, in nanoseconds, for which
+     * the fastest counter rate observed since sampling was last started stays
+     * below the 32-bit maximum, when sampler_config::set_saturation_check() is
+     * enabled. A longer period risks saturated samples, a shorter one is
+     * safe. Zero if no counter was counted yet, or if the counters are 64-bit.
+     */
+    HWCP_NODISCARD uint64_t get_max_sampling_period() const { return max_sampling_period_ns_; }
+
+    /**
+     * @brief Returns whether the last sample read fired the trigger set by
+     * sampler_config::set_trigger(). False if no trigger was set.
+     */
+    HWCP_NODISCARD bool is_triggered() const { return triggered_; }
+
+    /**
+     * @brief Returns whether the last sample read completed a window of the
+     * multi-rate plan set by sampler_config::set_multi_rate(), i.e. whether
+     * the counters out of the fast set were updated with the deltas summed
+     * over the window. Always true without a multi-rate plan.
+     */
+    HWCP_NODISCARD bool is_full_sample() const { return slow_period_ == 0 || slow_updated_; }
+
+    /**
+     * @brief Returns the statistics of the sampler about its own cost: the
+     * samples taken, rejected and dropped, and the time spent requesting,
+     * collecting and evaluating samples since the sampler was created or the
+     * statistics were reset. The statistics are always collected, and may be
+     * read from any thread while another thread samples.
+     */
+    HWCP_NODISCARD sampler_stats get_stats() const { return stats_.get(); }
+
+    /** @brief Resets the statistics returned by get_stats(). */
+    void reset_stats() { stats_.set({}); }
+
+    /**
+     * @brief Returns the number of samples dropped since sampling was last
+     * started, detected as gaps between the numbers of the samples read. A
+     * periodic sampler drops samples when they are not read as fast as the
+     * kernel takes them and its buffers are full.
+     */
+    HWCP_NODISCARD uint64_t get_dropped_samples() const { return session_dropped_; }
+
+    /**
+     * @brief Returns the largest number of samples that were waiting in the
+     * kernel buffer when a sample was read since sampling was last started,
+     * see device::hwcnt::sample_metadata::backlog. Zero for manual samplers
+     * and backends that don't estimate the backlog.
+     */
+    HWCP_NODISCARD uint32_t get_max_backlog() const { return session_max_backlog_; }
+
+    /**
+     * @brief Recommends the kernel buffer depth and the number of samples to
+     * read per wake-up that would have kept up with the backlog and drops of
+     * the current or last session, with the least memory. The buffer depth
+     * can't change while the sampler exists, so it is meant for the config
+     * of the next sampler.
+     * @par
+     * @code
+     * const auto buffering = sampler.recommend_buffering();
+     * config.set_buffer_count(buffering.buffer_count);
+     * @endcode
+     */
+    HWCP_NODISCARD buffering_recommendation recommend_buffering() const {
+        return detail::recommend_buffering(session_max_backlog_, session_dropped_, features_.buffer_count);
+    }
+
+    /**
+     * @brief Fetches the last sampled value of a custom counter.
+     *
+     * @param [in]  id     The identifier returned by
+     *                     sampler_config::add_custom_counter().
+     * @param [out] value  Set to the value of the counter.
+     * @return Returns hwcpipe::errc::unknown_counter if no custom counter has
+     * the identifier, otherwise an empty error_code.
+     */
+    HWCP_NODISCARD std::error_code get_custom_counter_value(size_t id, double &value) const {
+        if (!valid_sample_buffer_) {
+            return make_error_code(errc::sample_collection_failure);
+        }
+        if (id >= custom_values_.size()) {
+            return make_error_code(errc::unknown_counter);
+        }
+        value = custom_values_[id];
+        return {};
+    }
+
+    /**
+     * @brief Fetches the last sampled per block instance values of a hardware
+     * counter. The values are indexed by block instance (e.g. shader core
+     * index) and remain valid until the next sample is taken.
+     *
+     * @param [in]  counter        The counter to read.
+     * @param [out] values         Set to the first instance value.
+     * @param [out] num_instances  Set to the number of instances.
+     * @return Returns hwcpipe::errc::unknown_counter if the counter was not
+     * configured for sampling, hwcpipe::errc::instance_values_unavailable if
+     * per instance values were not enabled or the counter is an expression,
+     * otherwise an empty error_code.
+     */
+    HWCP_NODISCARD std::error_code get_counter_instance_values(hwcpipe_counter counter, const uint64_t *&values,
+                                                               size_t &num_instances) const {
+        if (!valid_sample_buffer_) {
+            return make_error_code(errc::sample_collection_failure);
+        }
+
+        const auto *entry = find_counter(counter);
+        if (entry == nullptr) {
+            return make_error_code(errc::unknown_counter);
+        }
+        if (instance_rows_.empty() || entry->tag != lookup_entry::type::hardware) {
+            return make_error_code(errc::instance_values_unavailable);
+        }
+
+        const auto &row = instance_rows_[entry->buffer_pos];
+        values = instance_buffer_.data() + row.offset;
+        num_instances = row.count;
+        return {};
+    }
+
+    /**
+     * @brief Fetches the standard error of the last sampled value of a
+     * hardware counter. The shader core counters are extrapolated when
+     * sampler_config::set_core_subsampling() decodes a subset of the cores,
+     * and their error is estimated from the spread of the decoded cores. The
+     * error is zero for the other counters, and for every counter when all
+     * the active cores were decoded. It is NaN when a single core of several
+     * was decoded, as one core has no spread.
+     *
+     * @param [in]  counter  The counter to read.
+     * @param [out] error    Set to the standard error of the value.
+     * @return Returns hwcpipe::errc::unknown_counter if the counter was not
+     * configured for sampling, hwcpipe::errc::error_estimate_unavailable if
+     * the counter is an expression, otherwise an empty error_code.
+     */
+    HWCP_NODISCARD std::error_code get_counter_error(hwcpipe_counter counter, double &error) const {
+        if (!valid_sample_buffer_) {
+            return make_error_code(errc::sample_collection_failure);
+        }
+
+        const auto *entry = find_counter(counter);
+        if (entry == nullptr) {
+            return make_error_code(errc::unknown_counter);
+        }
+        if (entry->tag != lookup_entry::type::hardware) {
+            return make_error_code(errc::error_estimate_unavailable);
+        }
+
+        const auto &core_plan = gather_plan_[block_type::core];
+        const bool is_core = entry->buffer_pos >= core_plan.buffer_base() &&
+                             entry->buffer_pos < core_plan.buffer_base() + core_plan.size();
+        error = core_errors_.empty() || !is_core ? 0.0 : core_errors_[entry->buffer_pos - core_plan.buffer_base()];
+        return {};
+    }
+
+    /**
+     * @brief Fetches the last sampled values of a raw block counter, see
+     * sampler_config::add_block_counter(), indexed by block instance (e.g.
+     * by CSG). The values are unscaled, and remain valid until the next sample
+     * is taken. Merged samples have the values of the last sample of their
+     * window.
+     *
+     * @param [in]  type           The block type.
+     * @param [in]  offset         The offset of the counter in the block.
+     * @param [out] values         Set to the first instance value.
+     * @param [out] num_instances  Set to the number of instances.
+     * @return Returns hwcpipe::errc::unknown_counter if the counter was not
+     * configured for sampling, otherwise an empty error_code.
+     */
+    HWCP_NODISCARD std::error_code get_block_counter_values(device::hwcnt::block_type type, uint32_t offset,
+                                                            const uint64_t *&values, size_t &num_instances) const {
+        if (!valid_sample_buffer_) {
+            return make_error_code(errc::sample_collection_failure);
+        }
+
+        for (const auto &row : block_counter_rows_) {
+            if (row.type == type && row.offset == offset) {
+                values = block_counter_buffer_.data() + row.buffer_offset;
+                num_instances = row.count;
+                return {};
+            }
+        }
+        return make_error_code(errc::unknown_counter);
+    }
+
+    /**
+     * @brief Resolves a list of counters into a read_list that can be passed
+     * to get_counter_values(). The list only needs to be built once and can
+     * then be used for every sample.
+     *
+     * @param [in]  counters  The counters to read, in output order.
+     * @param [in]  count     Number of entries in @p counters.
+     * @param [out] ec        Set to hwcpipe::errc::unknown_counter if any of
+     *                        the counters were not configured for sampling.
+     * @return The resolved read list, or an empty list on error.
+     */
+    HWCP_NODISCARD read_list make_read_list(const hwcpipe_counter *counters, size_t count,
+                                            std::error_code &ec) const {
+        read_list list{};
+        list.layout_ = layout_;
+        list.entries_.reserve(count);
+
+        for (size_t i = 0; i != count; ++i) {
+            const auto *entry = find_counter(counters[i]);
+            if (entry == nullptr) {
+                ec = make_error_code(errc::unknown_counter);
+                return {};
+            }
+            list.entries_.push_back(*entry);
+        }
+
+        ec = {};
+        return list;
+    }
+
+    /**
+     * @brief Resolves a list of counters into a read_list, with the values of
+     * some of them normalized to rates. The normalized values are written to
+     * the same output as the others, at the position of their request, so the
+     * values of a counter and its rate can be read side by side.
+     *
+     * The rates are computed from the interval of the sample, see
+     * get_sample_interval(). The cycles are read from MaliGPUActiveCy when the
+     * backend doesn't report them, in which case it must be configured. The
+     * normalized values of an empty interval are zero.
+     *
+     * @param [in]  requests  The counters to read, in output order.
+     * @param [in]  count     Number of entries in @p requests.
+     * @param [out] ec        Set to hwcpipe::errc::unknown_counter if any of
+     *                        the counters, or the cycles counter needed for a
+     *                        per cycle value, were not configured for sampling.
+     * @return The resolved read list, or an empty list on error.
+     */
+    HWCP_NODISCARD read_list make_read_list(const read_request *requests, size_t count, std::error_code &ec) const {
+        read_list list{};
+        list.layout_ = layout_;
+        list.entries_.reserve(count);
+
+        for (size_t i = 0; i != count; ++i) {
+            const auto *entry = find_counter(requests[i].counter);
+            if (entry == nullptr) {
+                ec = make_error_code(errc::unknown_counter);
+                return {};
+            }
+            list.entries_.push_back(*entry);
+
+            switch (requests[i].normalization) {
+            case counter_normalization::per_second:
+                list.per_second_.push_back(static_cast<uint32_t>(i));
+                break;
+            case counter_normalization::per_cycle:
+                list.per_cycle_.push_back(static_cast<uint32_t>(i));
+                break;
+            case counter_normalization::none:
+            default:
+                break;
+            }
+        }
+
+        if (!list.per_cycle_.empty() && !features_.has_gpu_cycle) {
+            const auto *entry = find_counter(MaliGPUActiveCy);
+            if (entry == nullptr) {
+                ec = make_error_code(errc::unknown_counter);
+                return {};
+            }
+            list.cycles_entry_ = *entry;
+        }
+
+        ec = {};
+        return list;
+    }
+
+    /**
+     * @brief Fetches the last sampled values for every counter in a read
+     * list. The values are written to @p values in read list order as
+     * doubles.
+     *
+     * @param [in]  list    The read list built by make_read_list().
+     * @param [out] values  The output array.
+     * @param [in]  count   Number of entries in @p values.
+     * @return Returns hwcpipe::errc::sample_collection_failure if the last
+     * sample is invalid, hwcpipe::errc::invalid_read_list if @p values is too
+     * small for the list, or if the list was built by another sampler or
+     * before reconfigure(), otherwise an empty error_code.
+     */
+    HWCP_NODISCARD std::error_code get_counter_values(const read_list &list, double *values, size_t count) const {
+        return read_counter_values(list, values, count);
+    }
+
+    /**
+     * @brief Fetches the last sampled values for every counter in a read
+     * list. The values are written to @p values in read list order as
+     * integers. Expression and normalized values are truncated towards
+     * zero, NaN and negative ones are clamped to zero, and those of 2^64 or
+     * more to UINT64_MAX.
+     *
+     * @param [in]  list    The read list built by make_read_list().
+     * @param [out] values  The output array.
+     * @param [in]  count   Number of entries in @p values.
+     * @return Returns hwcpipe::errc::sample_collection_failure if the last
+     * sample is invalid, hwcpipe::errc::invalid_read_list if @p values is too
+     * small for the list, or if the list was built by another sampler or
+     * before reconfigure(), otherwise an empty error_code.
+     */
+    HWCP_NODISCARD std::error_code get_counter_values(const read_list &list, uint64_t *values, size_t count) const {
+        return read_counter_values(list, values, count);
+    }
+
+    /**
+     * @brief Returns an iterable view of the last sample of every configured
+     * counter, hardware and derived, in hwcpipe_counter order. The view is a
+     * contiguous array of counter_sample records that is laid out when the
+     * sampler is created. Its values are refreshed at most once per sample,
+     * the first time the view is requested, and stay valid until the next
+     * sample is taken. The view is empty if the last sample is invalid.
+     * @par
+     * @code
+     * hwcpipe::sampler sampler(config);
+     * auto ec = sampler.start_sampling();
+     * while (running) {
+     *     // ... workload goes here ...
+     *     ec = sampler.sample_now();
+     *     if (!ec) {
+     *         for (const counter_sample &sample : sampler.sample_view()) {
+     *             std::cout << '[' << sample.counter << "] - " << sample.value.float64 << std::endl
+     *         }
+     *     }
+     * }
+     * @endcode
+     *
+     * @return An iterable object (provides begin()/end()) of counter_samples.
+     */
+    HWCP_NODISCARD sample_range sample_view() {
+        if (!valid_sample_buffer_) {
+            return {nullptr, nullptr};
+        }
+        if (sample_records_stale_) {
+            refresh_sample_records();
+        }
+        return {sample_records_.data(), sample_records_.data() + sample_records_.size()};
+    }
+
+  private:
+    // backend type aliases
+    using device_registry_type = detail::device_registry<handle_type, instance_type>;
+    using device_ptr_type = typename device_registry_type::device_ptr;
+    using sampler_ptr_type = std::unique_ptr<sampler_type>;
+    using periodic_sampler_ptr_type = std::unique_ptr<periodic_sampler_type>;
+
+    // dense lookup table entry. The table is indexed by the hwcpipe_counter
+    // value so that a counter can be resolved without hashing.
+    using lookup_entry = detail::counter_lookup_entry;
+
+    // mapping types for counters & buffer positions
+    using counter_lookup_type = std::vector<lookup_entry>;
+
+    // row of a counter in the per instance buffer
+    struct instance_row {
+        size_t offset;
+        size_t count;
+    };
+
+    // per instance layout of a block type
+    struct instance_block {
+        size_t offset;
+        size_t count;
+    };
+
+    // row of a raw block counter in block_counter_buffer_, one element per instance
+    struct block_counter_row {
+        block_type type;
+        uint32_t offset;
+        size_t buffer_offset;
+        size_t count;
+    };
+
+    // one step of the eager expression plan. Steps with a flat evaluator or
+    // bytecode read their operands from expression_inputs_, starting at
+    // inputs_offset.
+    struct expression_step {
+        detail::expression::evaluator eval;
+        detail::expression::flat_evaluator flat_eval;
+        detail::expression::bytecode code;
+        size_t buffer_pos;
+        size_t inputs_offset;
+        size_t num_inputs;
+    };
+
+    // where an expression operand is gathered from: the sample buffer for
+    // hardware counters, the derived buffer for expressions
+    struct expression_operand {
+        bool derived;
+        size_t buffer_pos;
+    };
+
+    // a custom counter, compiled for the device. Its operands are read through
+    // custom_operands_, starting at inputs_offset.
+    struct custom_step {
+        detail::expression::program program;
+        size_t inputs_offset;
+        size_t num_inputs;
+    };
+
+    std::error_code ec_;
+
+    // handles to the hwcpipe backend. The device is shared through the device
+    // registry, unless the sampler was given the handle of the application.
+    device_ptr_type device_;
+    sampler_ptr_type sampler_;
+    periodic_sampler_ptr_type periodic_sampler_;
+    device::constants constants_;
+    block_extents_type block_extents_{};
+    detail::expression::device_constants expression_constants_{};
+
+    // optional recorder of the raw backend samples
+    void *trace_recorder_{};
+    std::error_code (*record_sample_)(void *, const sample_type &){};
+
+    // sample buffer and index mappings
+    counter_lookup_type counter_lookup_{};
+    // identifies the counter mappings of configure() in the read lists
+    uint64_t layout_{};
+    detail::gather_plan gather_plan_{};
+    // mutable as the lazy decode gathers the counters on their first read
+    mutable std::vector<uint64_t> sample_buffer_{};
+    std::vector<device::hwcnt::block_metadata> decoded_blocks_{};
+    // lazy decode: the active blocks of the types with gathered counters are
+    // copied from the kernel sample, one block every counters_per_block_
+    // values, and the counters of a pending type are gathered from its copies
+    // on their first read
+    bool lazy_decode_{};
+    std::vector<uint32_t> lazy_values32_{};
+    std::vector<uint64_t> lazy_values64_{};
+    std::vector<block_type> lazy_blocks_{};
+    size_t num_lazy_blocks_{};
+    mutable std::array<bool, device::hwcnt::block_extents::num_block_types> lazy_pending_{};
+    // the block type of each hardware counter of the sample buffer
+    std::vector<uint8_t> buffer_block_types_{};
+    // merged samples: the last sample is decoded to raw_buffer_ and summed
+    // into window_buffer_, which becomes the sample buffer once complete
+    uint32_t coalesced_samples_{1};
+    uint32_t window_samples_{};
+    uint64_t window_timestamp_begin_{};
+    uint64_t window_gpu_cycles_{};
+    uint64_t window_sc_cycles_{};
+    std::vector<uint64_t> raw_buffer_{};
+    std::vector<uint64_t> window_buffer_{};
+    // core sub-sampling: the active cores at positions [core_first_,
+    // core_first_ + core_subsampling_) modulo core_active_ are decoded, and
+    // the window starts core_rotation_ cores further every sample
+    uint32_t core_subsampling_{};
+    uint32_t core_rotation_{};
+    uint32_t core_active_{};
+    uint32_t core_first_{};
+    uint32_t core_position_{};
+    std::vector<uint64_t> core_values_{};
+    std::vector<double> core_sum_sq_{};
+    std::vector<double> core_errors_{};
+    // multi-rate plan: gather_plan_ and expression_plan_ only hold the fast
+    // counters. The blocks of the full set are summed into slow_totals_, and
+    // slow_gather_plan_ extracts all the hardware counters after the fast
+    // ones in the sample buffer once every slow_period_ samples, before
+    // slow_expression_plan_ evaluates all the expressions
+    uint32_t slow_period_{};
+    uint32_t slow_samples_{};
+    bool slow_updated_{};
+    detail::gather_plan slow_gather_plan_{};
+    std::array<bool, device::hwcnt::block_extents::num_block_types> slow_block_type_{};
+    std::vector<uint64_t> slow_totals_{};
+    std::vector<uint64_t> slow_window_buffer_{};
+    std::vector<expression_step> slow_expression_plan_{};
+    // idle fast path: a sample whose gating counter is zero isn't decoded,
+    // and consecutive ones extend idle_span_
+    bool idle_skip_{};
+    block_type idle_gate_type_{};
+    uint32_t idle_gate_offset_{};
+    bool idle_{};
+    idle_span idle_span_{};
+    // saturation check of the 32-bit counters, and the longest safe period
+    bool saturation_check_{};
+    bool saturated_{};
+    uint64_t max_sampling_period_ns_{};
+    // blocks of each type decoded from the last sample, see is_active_block()
+    std::array<uint32_t, device::hwcnt::block_extents::num_block_types> active_instances_{};
+    // trigger, checked once per sample against its resolved counter
+    bool has_trigger_{};
+    sample_trigger trigger_{};
+    lookup_entry trigger_entry_{};
+    bool triggered_{};
+    std::vector<instance_row> instance_rows_{};
+    std::array<instance_block, device::hwcnt::block_extents::num_block_types> instance_blocks_{};
+    std::vector<uint64_t> instance_buffer_{};
+    std::array<bool, device::hwcnt::block_extents::num_block_types> reduce_block_type_{};
+    // the block types that are decoded, and those that hold raw block counters
+    std::array<bool, device::hwcnt::block_extents::num_block_types> decode_block_type_{};
+    std::array<bool, device::hwcnt::block_extents::num_block_types> block_counter_type_{};
+    std::vector<block_counter_row> block_counter_rows_{};
+    std::vector<uint64_t> block_counter_buffer_{};
+    size_t counters_per_block_{};
+    std::vector<uint64_t> block_totals_{};
+    // the reduction kernels of the CPU, selected when the sampler is constructed
+    const detail::decode_kernels *kernels_{&detail::select_decode_kernels()};
+    std::vector<expression_step> expression_plan_{};
+    std::vector<expression_operand> expression_operands_{};
+    std::vector<double> expression_inputs_{};
+    std::vector<double> derived_buffer_{};
+    std::vector<custom_step> custom_plan_{};
+    std::vector<lookup_entry> custom_operands_{};
+    std::vector<double> custom_inputs_{};
+    std::vector<double> custom_values_{};
+    std::vector<counter_sample> sample_records_{};
+    std::vector<lookup_entry> sample_record_entries_{};
+    bool sample_records_stale_{};
+    bool valid_sample_buffer_ = false;
+
+    // sampler state
+    bool values_are_64bit_{};
+    uint64_t last_collection_timestamp_{};
+    uint64_t last_collection_timestamp_end_{};
+    // converts the kernel timestamps to the clock of the sampler_config
+    clock_correlator clock_correlator_{};
+    uint64_t last_gpu_cycles_{};
+    uint64_t last_sc_cycles_{};
+    uint64_t last_user_data_{};
+    device::hwcnt::sample_flags last_flags_{};
+    bool sampling_in_progress_{};
+    // the backend session is kept accumulating between the measurements, and
+    // is currently accumulating
+    bool armed_sessions_{};
+    bool armed_{};
+    // a manual sample requested by sample_now_for() that timed out
+    bool request_pending_{};
+
+    // self-profiling statistics, and the number of the last sample read to
+    // detect the samples that were dropped
+    // mutable as the lazy decode of a read counts its decodes
+    mutable detail::sampler_stats_counters stats_{};
+    uint64_t last_sample_nr_{};
+    bool has_last_sample_nr_{};
+
+    // features of the backend reader
+    device::hwcnt::features features_{};
+
+    // configuration of the thread collecting the periodic samples
+    device::hwcnt::sampler::thread_config thread_config_{};
+
+    // drops and backlog of the current session, and how drops are handled
+    uint64_t session_dropped_{};
+    uint32_t session_max_backlog_{};
+    bool widen_stretched_{};
+    // salvage policy, and whether only the blocks valid for the whole sample
+    // are decoded, for an erroneous sample
+    bool salvage_{};
+    bool salvage_can_check_blocks_{};
+    bool strict_blocks_{};
+    sampler_config::drop_handler drop_handler_{};
+    void *drop_handler_data_{};
+
+    // the configuration of the backend session, to reuse it when reconfiguring
+    // or recovering
+    std::vector<sampler_config::backend_cfg_type> backend_config_list_{};
+    uint64_t backend_period_ns_{};
+    uint32_t backend_buffer_count_{};
+
+    // recovery attempts, whether the backend session failed, whether it was
+    // recovered since the last sample accepted, and whether the last sample
+    // accepted is the first one since
+    uint32_t session_recovery_{};
+    bool backend_failed_{};
+    bool recovered_{};
+    bool after_recovery_{};
+
+    // power-aware mode: the probe, the dumps skipped in a row, whether every
+    // block of the last sample was powered off, and the end of the last
+    // sample or skipped dump in the sample clock
+    bool power_aware_{};
+    uint32_t max_skipped_dumps_{};
+    sampler_config::power_probe power_probe_{};
+    void *power_probe_data_{};
+    uint32_t skipped_dumps_{};
+    bool powered_off_{};
+    bool has_sample_end_{};
+    uint64_t sample_end_ns_{};
+
+    /**
+     * Requests a manual sample from the backend, either synchronously or
+     * asynchronously. Periodic samplers don't need a request.
+     */
+    HWCP_NODISCARD std::error_code request_sample(bool async, uint64_t user_data) {
+        if (!sampling_in_progress_) {
+            return make_error_code(errc::sampling_not_started);
+        }
+        if (periodic_sampler_) {
+            return {};
+        }
+
+        const auto begin = detail::sampler_stats_counters::clock::now();
+        auto ec = async ? sampler_->request_sample_async(user_data) : sampler_->request_sample(user_data);
+        stats_.request().add(begin);
+        if (ec) {
+            backend_failed_ = true;
+            return make_error_code(errc::sample_collection_failure);
+        }
+        return {};
+    }
+
+    /**
+     * Sets the backend session up again after a backend error, when
+     * sampler_config::set_session_recovery() allows @p attempts more
+     * attempts. Returns hwcpipe::errc::sample_not_ready if the session was
+     * recovered, so that the sample is taken again, otherwise @p ec.
+     */
+    HWCP_NODISCARD std::error_code recover_after(std::error_code ec, uint32_t &attempts) {
+        while (backend_failed_ && attempts != session_recovery_) {
+            ++attempts;
+            if (!recover_session()) {
+                return make_error_code(errc::sample_not_ready);
+            }
+        }
+        return ec;
+    }
+
+    /**
+     * Creates the backend sampler for a backend configuration, unless one
+     * exists already. Returns false if it could not be created.
+     */
+    HWCP_NODISCARD bool create_backend_sampler(const std::vector<sampler_config::backend_cfg_type> &config_list,
+                                               uint64_t period_ns, uint32_t buffer_count) {
+        if (period_ns != 0) {
+            if (!periodic_sampler_) {
+                auto sampler = std::make_unique<periodic_sampler_type>(device_->get_instance(), period_ns,
+                                                                       config_list.data(), config_list.size(),
+                                                                       buffer_count);
+
+                if (!sampler || !(*sampler)) {
+                    return false;
+                }
+
+                periodic_sampler_ = std::move(sampler);
+            }
+
+            features_ = get_reader_features(periodic_sampler_->get_reader(), 0);
+        } else {
+            if (!sampler_) {
+                auto sampler = std::make_unique<sampler_type>(device_->get_instance(), config_list.data(),
+                                                              config_list.size(), buffer_count);
+
+                if (!sampler || !(*sampler)) {
+                    return false;
+                }
+
+                sampler_ = std::move(sampler);
+            }
+
+            features_ = get_reader_features(sampler_->get_reader(), 0);
+        }
+        return true;
+    }
+
+    /**
+     * Takes a sample of an armed session and puts it back without decoding
+     * it, so that the next sample only counts from now.
+     */
+    HWCP_NODISCARD std::error_code take_baseline_sample() {
+        if (sampler_->request_sample(0)) {
+            return make_error_code(errc::sample_collection_failure);
+        }
+        std::error_code ec;
+        {
+            const sample_type baseline(get_reader(), ec);
+        }
+        if (ec) {
+            return make_error_code(errc::sample_collection_failure);
+        }
+        return {};
+    }
+
+    /** Returns the reader of whichever backend sampler was created. */
+    auto &get_reader() { return periodic_sampler_ ? periodic_sampler_->get_reader() : sampler_->get_reader(); }
+
+    /**
+     * Waits for a sample to be ready for at most @p timeout_ns, and collects
+     * it.
+     */
+    HWCP_NODISCARD std::error_code wait_and_collect(uint64_t timeout_ns) {
+        bool ready{};
+        auto ec = get_reader().is_sample_ready(ready, timeout_ns);
+        if (ec) {
+            backend_failed_ = true;
+            return make_error_code(errc::sample_collection_failure);
+        }
+        if (!ready) {
+            return make_error_code(errc::sample_not_ready);
+        }
+        return collect_sample();
+    }
+
+    /**
+     * Reads the next sample from the backend reader, waiting for one if
+     * needed, and decodes it into the sample buffer.
+     */
+    HWCP_NODISCARD std::error_code collect_sample() {
+        const auto begin = detail::sampler_stats_counters::clock::now();
+        request_pending_ = false;
+        std::error_code ec;
+        auto backend_sample = sample_type(get_reader(), ec);
+        if (ec) {
+            stats_.collect().add(begin);
+            backend_failed_ = true;
+            return make_error_code(errc::sample_collection_failure);
+        }
+
+        // ec is owned by the backend sample until it is destroyed, so the
+        // recorder error is kept apart
+        if (record_sample_ != nullptr) {
+            const auto record_ec = record_sample_(trace_recorder_, backend_sample);
+            if (record_ec) {
+                valid_sample_buffer_ = false;
+                window_samples_ = 0;
+                reset_slow_window();
+                idle_ = false;
+                return record_ec;
+            }
+        }
+
+        // if there was an error fetching the samples then there's no point
+        // trying to read the block data. Leave the last captured values in the
+        // buffer.
+        const auto &metadata = backend_sample.get_metadata();
+        if (!accept_sample(metadata)) {
+            stats_.collect().add(begin);
+            valid_sample_buffer_ = false;
+            // a window missing a sample can't be merged exactly, nor can an
+            // idle span
+            window_samples_ = 0;
+            reset_slow_window();
+            idle_ = false;
+            return make_error_code(errc::sample_collection_failure);
+        }
+
+        HWCPIPE_TRACEPOINT(decode_begin, metadata.sample_nr, metadata.user_data, 0);
+        const device::tracepoint_timer decode_timer{};
+        const bool merged = coalesced_samples_ > 1;
+        uint64_t *buffer = merged ? raw_buffer_.data() : sample_buffer_.data();
+        auto blocks = read_blocks(backend_sample, 0);
+        const bool idle = idle_skip_ && is_idle_sample(blocks, metadata.gpu_cycle);
+        if (power_aware_ && features_.has_power_states) {
+            powered_off_ = is_powered_off(blocks);
+        }
+        // after an idle sample the buffers already hold the values of the
+        // next one, and the expressions their results
+        const bool unchanged = idle && idle_ && valid_sample_buffer_ && !merged;
+        update_idle_span(idle, metadata.timestamp_ns_begin, metadata.timestamp_ns_end);
+
+        if (!unchanged) {
+            // clear out any samples from the previous poll. The counters of a
+            // multi-rate plan's full set keep the values of their last window.
+            std::fill(buffer, buffer + gather_plan_.size(), 0);
+            lazy_pending_.fill(false);
+            if (idle) {
+                std::fill(instance_buffer_.begin(), instance_buffer_.end(), 0);
+                std::fill(block_counter_buffer_.begin(), block_counter_buffer_.end(), 0);
+                active_instances_.fill(0);
+            } else if (values_are_64bit_) {
+                // loop over the counter blocks returned by the reader and
+                // fetch any samples that were requested
+                fill_sample_buffer<uint64_t>(blocks, buffer);
+            } else {
+                fill_sample_buffer<uint32_t>(blocks, buffer);
+                if (saturation_check_) {
+                    check_saturation(blocks, metadata.timestamp_ns_end - metadata.timestamp_ns_begin);
+                }
+            }
+        }
+        if (idle) {
+            saturated_ = false;
+        }
+        HWCPIPE_TRACEPOINT(decode_end, metadata.sample_nr, metadata.user_data, decode_timer.elapsed_ns());
+        stats_.collect().add(begin);
+        stats_.add_taken();
+        if (idle) {
+            stats_.add_idle();
+        }
+
+        uint64_t timestamp_ns_begin = metadata.timestamp_ns_begin;
+        // the dump after skipped ones counted since the last dump, but the
+        // skipped ones already cover the time until their end
+        if (skipped_dumps_ != 0 && sample_end_ns_ > timestamp_ns_begin &&
+            sample_end_ns_ <= metadata.timestamp_ns_end) {
+            timestamp_ns_begin = sample_end_ns_;
+        }
+        skipped_dumps_ = 0;
+        has_sample_end_ = true;
+        sample_end_ns_ = metadata.timestamp_ns_end;
+        uint64_t gpu_cycles = features_.has_gpu_cycle ? metadata.gpu_cycle : 0;
+        uint64_t sc_cycles = features_.has_sc_cycle ? metadata.sc_cycle : 0;
+        if (merged) {
+            if (window_samples_ == 0) {
+                window_timestamp_begin_ = metadata.timestamp_ns_begin;
+                window_gpu_cycles_ = 0;
+                window_sc_cycles_ = 0;
+                std::fill(window_buffer_.begin(), window_buffer_.end(), 0);
+            }
+            window_gpu_cycles_ += gpu_cycles;
+            window_sc_cycles_ += sc_cycles;
+            if (!idle) {
+                kernels_->reduce(raw_buffer_.data(), raw_buffer_.size(), window_buffer_.data());
+            }
+            if (++window_samples_ != coalesced_samples_) {
+                return make_error_code(errc::sample_not_ready);
+            }
+            window_samples_ = 0;
+            sample_buffer_.swap(window_buffer_);
+            timestamp_ns_begin = window_timestamp_begin_;
+            gpu_cycles = window_gpu_cycles_;
+            sc_cycles = window_sc_cycles_;
+        }
+        if (slow_period_ != 0) {
+            advance_slow_window();
+        }
+        uint64_t timestamp_ns_end = metadata.timestamp_ns_end;
+        if (clock_correlator_.target() != clock_domain::sample) {
+            clock_correlator_.update(timestamp_ns_end);
+            timestamp_ns_begin = clock_correlator_.convert(timestamp_ns_begin);
+            timestamp_ns_end = clock_correlator_.convert(timestamp_ns_end);
+        }
+        last_collection_timestamp_ = timestamp_ns_begin;
+        last_collection_timestamp_end_ = timestamp_ns_end;
+        last_gpu_cycles_ = gpu_cycles;
+        last_sc_cycles_ = sc_cycles;
+        last_user_data_ = metadata.user_data;
+
+        if (!unchanged || slow_updated_) {
+            const auto evaluation_begin = detail::sampler_stats_counters::clock::now();
+            const device::tracepoint_timer evaluation_timer{};
+            evaluate_expressions();
+            stats_.evaluation().add(evaluation_begin);
+            HWCPIPE_TRACEPOINT(evaluate_end, metadata.sample_nr, metadata.user_data, evaluation_timer.elapsed_ns());
+        }
+        check_trigger();
+
+        sample_records_stale_ = true;
+        valid_sample_buffer_ = true;
+        return {};
+    }
+
+    /** Checks the trigger against the value of its counter in the last sample. */
+    void check_trigger() {
+        if (has_trigger_) {
+            const double value = read_entry(trigger_entry_);
+            triggered_ = trigger_.condition == trigger_condition::above ? value > trigger_.threshold
+                                                                        : value < trigger_.threshold;
+        }
+    }
+
+    /**
+     * Returns whether the power-aware mode skips the next manual dump: the
+     * power probe reports the GPU as powered down or, without a probe, every
+     * block of the last sample was powered off, for at most
+     * max_skipped_dumps_ dumps in a row. The first sample of a session is
+     * always dumped.
+     */
+    HWCP_NODISCARD bool skip_dump() const {
+        if (!power_aware_ || !sampling_in_progress_ || periodic_sampler_ || request_pending_ || !has_sample_end_ ||
+            coalesced_samples_ > 1 || slow_period_ != 0 || record_sample_ != nullptr) {
+            return false;
+        }
+        if (power_probe_ != nullptr) {
+            return power_probe_(power_probe_data_);
+        }
+        return features_.has_power_states && powered_off_ && skipped_dumps_ < max_skipped_dumps_;
+    }
+
+    /**
+     * Takes a sample in which nothing was counted, from the end of the last
+     * sample to now, instead of dumping the counters of a powered down GPU.
+     * Like the idle samples, see sampler_config::set_idle_skip(), every
+     * hardware counter reads zero and consecutive ones extend the idle span.
+     */
+    HWCP_NODISCARD std::error_code take_powered_down_sample(uint64_t user_data) {
+        const uint64_t begin_ns = sample_end_ns_;
+        const uint64_t end_ns = std::max(begin_ns, clock_correlator::read_clock(CLOCK_MONOTONIC_RAW));
+        ++skipped_dumps_;
+        sample_end_ns_ = end_ns;
+        stats_.add_avoided();
+
+        // after an idle sample the buffers and the expressions already hold
+        // those of a sample that counted nothing
+        const bool unchanged = idle_ && valid_sample_buffer_;
+        if (!unchanged) {
+            std::fill(sample_buffer_.data(), sample_buffer_.data() + gather_plan_.size(), 0);
+            lazy_pending_.fill(false);
+            std::fill(instance_buffer_.begin(), instance_buffer_.end(), 0);
+            std::fill(block_counter_buffer_.begin(), block_counter_buffer_.end(), 0);
+            active_instances_.fill(0);
+        }
+        update_idle_span(true, begin_ns, end_ns);
+        saturated_ = false;
+        after_recovery_ = false;
+        last_flags_ = {};
+
+        uint64_t timestamp_ns_begin = begin_ns;
+        uint64_t timestamp_ns_end = end_ns;
+        if (clock_correlator_.target() != clock_domain::sample) {
+            clock_correlator_.update(timestamp_ns_end);
+            timestamp_ns_begin = clock_correlator_.convert(timestamp_ns_begin);
+            timestamp_ns_end = clock_correlator_.convert(timestamp_ns_end);
+        }
+        last_collection_timestamp_ = timestamp_ns_begin;
+        last_collection_timestamp_end_ = timestamp_ns_end;
+        last_gpu_cycles_ = 0;
+        last_sc_cycles_ = 0;
+        last_user_data_ = user_data;
+
+        if (!unchanged) {
+            const auto evaluation_begin = detail::sampler_stats_counters::clock::now();
+            evaluate_expressions();
+            stats_.evaluation().add(evaluation_begin);
+        }
+        check_trigger();
+
+        sample_records_stale_ = true;
+        valid_sample_buffer_ = true;
+        return {};
+    }
+
+    /** Returns whether every block of a sample was powered off for the whole sample. */
+    template <typename blocks_t>
+    HWCP_NODISCARD static bool is_powered_off(blocks_t &blocks) {
+        bool any = false;
+        for (auto &block : blocks) {
+            if (block.state.on != 0) {
+                return false;
+            }
+            any = true;
+        }
+        return any;
+    }
+
+    /**
+     * Counts the drops, backlog and flags of a sample, and returns whether
+     * it can be read: erroneous samples and stretched samples that aren't
+     * widened or salvaged are rejected.
+     */
+    template <typename metadata_t>
+    HWCP_NODISCARD bool accept_sample(const metadata_t &metadata) {
+        const bool salvaged = metadata.flags.error ? salvage_ && salvage_can_check_blocks_ : salvage_;
+        const bool widened = metadata.flags.stretched && (salvaged || (!metadata.flags.error && widen_stretched_));
+        count_dropped_samples(metadata.sample_nr, metadata.flags.stretched, widened);
+        if (metadata.backlog > session_max_backlog_) {
+            session_max_backlog_ = metadata.backlog;
+        }
+        stats_.add_backlog(metadata.backlog);
+        if (metadata.flags.stretched) {
+            stats_.add_stretched();
+        }
+        if (metadata.flags.error) {
+            stats_.add_errored();
+        }
+        if ((metadata.flags.error && !salvaged) || (metadata.flags.stretched && !widened)) {
+            return false;
+        }
+        after_recovery_ = recovered_;
+        recovered_ = false;
+        strict_blocks_ = metadata.flags.error != 0;
+        last_flags_ = {};
+        last_flags_.stretched = metadata.flags.stretched;
+        last_flags_.error = metadata.flags.error;
+        return true;
+    }
+
+    /**
+     * Returns whether the GPU was idle during a sample: it counted no GPU
+     * cycle or, if the backend doesn't report the cycles, the gating counter
+     * is zero in the first block of its type.
+     */
+    template <typename blocks_t>
+    HWCP_NODISCARD bool is_idle_sample(blocks_t &blocks, uint64_t gpu_cycle) const {
+        if (features_.has_gpu_cycle) {
+            return gpu_cycle == 0;
+        }
+        for (auto &block : blocks) {
+            if (block.type != idle_gate_type_) {
+                continue;
+            }
+            if (values_are_64bit_) {
+                return static_cast<const uint64_t *>(block.values)[idle_gate_offset_] == 0;
+            }
+            return static_cast<const uint32_t *>(block.values)[idle_gate_offset_] == 0;
+        }
+        return false;
+    }
+
+    /**
+     * Checks whether a gathered 32-bit counter of a sample saturated, and
+     * lowers the longest safe sampling period with the fastest counter of the
+     * sample, which counted its largest value in @p duration_ns.
+     */
+    template <typename blocks_t>
+    void check_saturation(blocks_t &blocks, uint64_t duration_ns) {
+        uint32_t max_value = 0;
+        for (auto &block : blocks) {
+            if (is_active_block(block)) {
+                max_value = std::max(max_value, gather_plan_.max_value<uint32_t>(block.type, block.values));
+            }
+        }
+
+        saturated_ = max_value == std::numeric_limits<uint32_t>::max();
+        if (saturated_) {
+            stats_.add_saturated();
+        }
+
+        if (max_value != 0 && duration_ns != 0) {
+            const double scale = static_cast<double>(std::numeric_limits<uint32_t>::max()) / max_value;
+            const auto period_ns = static_cast<uint64_t>(static_cast<double>(duration_ns) * scale);
+            if (max_sampling_period_ns_ == 0 || period_ns < max_sampling_period_ns_) {
+                max_sampling_period_ns_ = period_ns;
+            }
+        }
+    }
+
+    /** Starts or extends the idle span with an idle sample, or ends it. */
+    void update_idle_span(bool idle, uint64_t timestamp_ns_begin, uint64_t timestamp_ns_end) {
+        if (idle && idle_) {
+            ++idle_span_.num_samples;
+            idle_span_.timestamp_ns_end = timestamp_ns_end;
+        } else if (idle) {
+            idle_span_ = {1, timestamp_ns_begin, timestamp_ns_end};
+        }
+        idle_ = idle;
+    }
+
+    /**
+     * Counts the samples that are missing between the last sample read and
+     * the sample numbered @p sample_nr, and notifies the drop handler of them,
+     * of a stretched sample or of a recovered session.
+     */
+    void count_dropped_samples(uint64_t sample_nr, bool stretched, bool widened) {
+        uint64_t dropped = 0;
+        if (has_last_sample_nr_ && sample_nr > last_sample_nr_ + 1) {
+            dropped = sample_nr - last_sample_nr_ - 1;
+            stats_.add_dropped(dropped);
+            session_dropped_ += dropped;
+        }
+        last_sample_nr_ = sample_nr;
+        has_last_sample_nr_ = true;
+
+        if (drop_handler_ != nullptr && (dropped != 0 || stretched || recovered_)) {
+            drop_handler_(drop_handler_data_, drop_event{sample_nr, dropped, stretched, widened, recovered_});
+        }
+    }
+
+    /**
+     * Returns the blocks of a sample. The backend samples that decode their
+     * blocks in one call, e.g. from the fixed offsets of the vinstr layout,
+     * store them in decoded_blocks_, the others are iterated block by block.
+     */
+    template <typename backend_sample_t>
+    auto read_blocks(backend_sample_t &backend_sample, int)
+        -> decltype(backend_sample.get_blocks(nullptr, 0), block_range(nullptr, nullptr)) {
+        const size_t count = backend_sample.get_blocks(decoded_blocks_.data(), decoded_blocks_.size());
+        return {decoded_blocks_.data(), decoded_blocks_.data() + count};
+    }
+
+    template <typename backend_sample_t>
+    static auto read_blocks(backend_sample_t &backend_sample, long) {
+        return backend_sample.blocks();
+    }
+
+    /**
+     * Returns the features of a backend reader. The readers that don't report
+     * their features are assumed to saturate their counters on overflow.
+     */
+    template <typename reader_t>
+    static auto get_reader_features(reader_t &reader, int) -> decltype(device::hwcnt::features(reader.get_features())) {
+        return reader.get_features();
+    }
+
+    template <typename reader_t>
+    static device::hwcnt::features get_reader_features(reader_t &, long) {
+        device::hwcnt::features result{};
+        result.overflow_behavior_defined = true;
+        return result;
+    }
+
+    /**
+     * Returns the lookup table entry for a counter, or nullptr if the counter
+     * was not configured for sampling.
+     */
+    HWCP_NODISCARD const lookup_entry *find_counter(hwcpipe_counter counter) const {
+        const auto index = static_cast<size_t>(counter);
+        if (index >= counter_lookup_.size() || counter_lookup_[index].tag == lookup_entry::type::unused) {
+            return nullptr;
+        }
+        return &counter_lookup_[index];
+    }
+
+    HWCP_NODISCARD std::error_code get_expression_counter_value(hwcpipe_counter counter, counter_sample &sample,
+                                                                detail::expression::evaluator eval) const {
+        sample = counter_sample(counter, last_collection_timestamp_, eval(*this));
+        return {};
+    }
+
+    template <typename value_t>
+    HWCP_NODISCARD std::error_code read_counter_values(const read_list &list, value_t *values, size_t count) const {
+        if (!valid_sample_buffer_) {
+            return make_error_code(errc::sample_collection_failure);
+        }
+        if (count < list.entries_.size()) {
+            return make_error_code(errc::invalid_read_list);
+        }
+        // the entries of another layout are out of the buffers of this one
+        if (list.layout_ != layout_ && !list.entries_.empty()) {
+            return make_error_code(errc::invalid_read_list);
+        }
+
+        for (const auto &entry : list.entries_) {
+            switch (entry.tag) {
+            case lookup_entry::type::expression:
+                *values++ = detail::to_counter_value<value_t>(entry.eval(*this));
+                break;
+            case lookup_entry::type::cached_expression:
+                *values++ = detail::to_counter_value<value_t>(derived_buffer_[entry.buffer_pos]);
+                break;
+            case lookup_entry::type::hardware:
+            case lookup_entry::type::unused:
+            default:
+                *values++ = static_cast<value_t>(read_hardware(entry.buffer_pos));
+                break;
+            }
+        }
+
+        if (!list.per_second_.empty() || !list.per_cycle_.empty()) {
+            values -= list.entries_.size();
+            normalize_values(list, values);
+        }
+        return {};
+    }
+
+    /**
+     * Normalizes the values of a read list that were read as counted. The
+     * scale of each normalization is computed once per sample, and each value
+     * is rescaled by a multiplication.
+     */
+    template <typename value_t>
+    void normalize_values(const read_list &list, value_t *values) const {
+        const uint64_t duration_ns = last_collection_timestamp_end_ - last_collection_timestamp_;
+        const double cycles = list.cycles_entry_.tag == lookup_entry::type::unused ? static_cast<double>(last_gpu_cycles_)
+                                                                                  : read_entry(list.cycles_entry_);
+
+        const double per_second_scale = duration_ns == 0 ? 0.0 : 1e9 / static_cast<double>(duration_ns);
+        for (auto pos : list.per_second_) {
+            values[pos] = detail::to_counter_value<value_t>(read_entry(list.entries_[pos]) * per_second_scale);
+        }
+
+        const double per_cycle_scale = cycles == 0 ? 0.0 : 1.0 / cycles;
+        for (auto pos : list.per_cycle_) {
+            values[pos] = detail::to_counter_value<value_t>(read_entry(list.entries_[pos]) * per_cycle_scale);
+        }
+    }
+
+    /** Returns the value of a resolved counter as a double. */
+    HWCP_NODISCARD double read_entry(const lookup_entry &entry) const {
+        switch (entry.tag) {
+        case lookup_entry::type::expression:
+            return entry.eval(*this);
+        case lookup_entry::type::cached_expression:
+            return derived_buffer_[entry.buffer_pos];
+        case lookup_entry::type::hardware:
+        case lookup_entry::type::unused:
+        default:
+            return static_cast<double>(read_hardware(entry.buffer_pos));
+        }
+    }
+
+    /**
+     * Returns the value of a hardware counter of the last sample. With the
+     * lazy decode, the counters of its block type are gathered first if they
+     * weren't read yet.
+     */
+    HWCP_NODISCARD uint64_t read_hardware(size_t buffer_pos) const {
+        if (lazy_decode_) {
+            const auto type_index = buffer_block_types_[buffer_pos];
+            if (lazy_pending_[type_index]) {
+                decode_lazy_blocks(type_index);
+            }
+        }
+        return sample_buffer_[buffer_pos];
+    }
+
+    HWCP_NODISCARD double get_counter_value(hwcpipe_counter counter) const override {
+        const auto *entry = find_counter(counter);
+        assert(entry != nullptr && entry->tag != lookup_entry::type::expression);
+        if (entry->tag == lookup_entry::type::cached_expression) {
+            return derived_buffer_[entry->buffer_pos];
+        }
+        return static_cast<double>(read_hardware(entry->buffer_pos));
+    }
+
+    HWCP_NODISCARD double get_mali_config_ext_bus_byte_size() const override {
+        return expression_constants_.ext_bus_byte_size;
+    }
+
+    HWCP_NODISCARD double get_mali_config_shader_core_count() const override {
+        return expression_constants_.shader_core_count;
+    }
+
+    HWCP_NODISCARD double get_mali_config_l2_cache_count() const override {
+        return expression_constants_.l2_cache_count;
+    }
+
+    // used by reconfigure(), which moves the resources to keep into a new sampler
+    sampler() = default;
+
+    /** Creates the instance of @p handle and the backend sampler for @p config. */
+    void init(const sampler_config &config, handle_type &handle) {
+        auto instance = instance_type::create(handle);
+        if (!instance) {
+            ec_ = make_error_code(errc::backend_creation_failed);
+            return;
+        }
+        device_ = std::make_shared<typename device_registry_type::device_type>(nullptr, std::move(instance));
+
+        configure(config);
+    }
+
+    /** @return Whether @p config enables the same backend session as the current one. */
+    bool is_same_backend_config(const sampler_config &config) const {
+        if (config.get_sampling_period() != backend_period_ns_ ||
+            config.get_buffer_count() != backend_buffer_count_) {
+            return false;
+        }
+
+        const auto config_list = config.build_backend_config_list();
+        return std::equal(config_list.begin(), config_list.end(), backend_config_list_.begin(),
+                          backend_config_list_.end(), [](const auto &lhs, const auto &rhs) {
+                              return lhs.type == rhs.type && lhs.set == rhs.set && lhs.enable_map == rhs.enable_map;
+                          });
+    }
+
+    /**
+     * Builds the counter mappings of @p config for the instance, and creates
+     * the backend sampler unless one was kept by reconfigure().
+     */
+    void configure(const sampler_config &config) {
+        layout_ = detail::next_counter_layout();
+        constants_ = device_->get_instance().get_constants();
+        expression_constants_ = detail::expression::make_device_constants(constants_);
+
+        // if we're dealing with a GPU >= G715/G615 then counters are 64bit
+        block_extents_ = device_->get_instance().get_hwcnt_block_extents();
+        const auto &block_extents = block_extents_;
+        values_are_64bit_ = block_extents.values_type() == device::hwcnt::sample_values_type::uint64;
+
+        size_t num_blocks = 0;
+        for (size_t i = 0; i != device::hwcnt::block_extents::num_block_types; ++i) {
+            num_blocks += block_extents.num_blocks_of_type(static_cast<block_type>(i));
+        }
+        decoded_blocks_.resize(num_blocks);
+
+        // reserve the sample list buffer and map counters to posisions within
+        // the buffer
+        const auto &valid_counters = config.get_valid_counters();
+        if (valid_counters.empty()) {
+            ec_ = make_error_code(errc::sampler_config_invalid);
+            return;
+        }
+        if (config.get_slow_period() > 1 && !config.get_fast_counters().empty()) {
+            if (config.get_per_instance_values() || config.get_coalesced_samples() > 1 ||
+                config.get_core_subsampling() != 0 || !config.get_custom_counters().empty() ||
+                !build_multi_rate_plan(valid_counters, config.get_fast_counters(), config.get_slow_period(),
+                                       block_extents)) {
+                ec_ = make_error_code(errc::sampler_config_invalid);
+                return;
+            }
+        } else {
+            build_sample_buffer_mappings(valid_counters, gather_plan_);
+        }
+        coalesced_samples_ = config.get_coalesced_samples();
+        if (coalesced_samples_ > 1) {
+            if (config.get_per_instance_values()) {
+                ec_ = make_error_code(errc::sampler_config_invalid);
+                return;
+            }
+            raw_buffer_.resize(sample_buffer_.size());
+            window_buffer_.resize(sample_buffer_.size());
+        }
+        core_subsampling_ = config.get_core_subsampling();
+        if (core_subsampling_ != 0) {
+            if (config.get_per_instance_values() || coalesced_samples_ > 1) {
+                ec_ = make_error_code(errc::sampler_config_invalid);
+                return;
+            }
+            const size_t num_core_counters = gather_plan_[block_type::core].size();
+            core_values_.resize(num_core_counters);
+            core_sum_sq_.resize(num_core_counters);
+            core_errors_.resize(num_core_counters);
+        }
+        armed_sessions_ = config.get_armed_sessions();
+        if (armed_sessions_ && config.get_sampling_period() != 0) {
+            ec_ = make_error_code(errc::sampler_config_invalid);
+            return;
+        }
+        if (config.get_idle_skip()) {
+            const auto gate = std::find_if(valid_counters.begin(), valid_counters.end(),
+                                           [](const auto &counter) { return counter.counter == MaliGPUActiveCy; });
+            if (gate != valid_counters.end() && gate->definition.tag == detail::counter_definition::type::hardware) {
+                idle_skip_ = true;
+                idle_gate_type_ = gate->definition.get_address().block_type;
+                idle_gate_offset_ = gate->definition.get_address().offset;
+            }
+        }
+        saturation_check_ = config.get_saturation_check() && !values_are_64bit_;
+        if (config.get_trigger() != nullptr) {
+            has_trigger_ = true;
+            trigger_ = *config.get_trigger();
+        }
+        if (config.get_per_instance_values()) {
+            build_instance_layout(block_extents);
+        } else {
+            build_reduction_plan(block_extents);
+        }
+        if (!build_block_counter_layout(config.get_block_counters(), block_extents)) {
+            ec_ = make_error_code(errc::sampler_config_invalid);
+            return;
+        }
+        if (config.get_lazy_decode()) {
+            if (config.get_per_instance_values() || coalesced_samples_ > 1 || core_subsampling_ != 0 ||
+                slow_period_ != 0) {
+                ec_ = make_error_code(errc::sampler_config_invalid);
+                return;
+            }
+            build_lazy_layout(block_extents);
+        }
+        // the expressions of a database blob only have bytecode, which the eager plan runs
+        if ((config.get_expression_evaluation() == sampler_config::expression_evaluation::eager ||
+             has_bytecode_expressions(valid_counters)) &&
+            slow_period_ == 0) {
+            build_expression_plan(valid_counters, expression_plan_);
+        }
+        build_custom_plan(config.get_custom_counters());
+        build_sample_records(valid_counters);
+        if (has_trigger_) {
+            const auto *entry = find_counter(trigger_.counter);
+            assert(entry != nullptr);
+            trigger_entry_ = *entry;
+        }
+
+        clock_correlator_ = clock_correlator(config.get_clock_domain(), config.get_clock_calibration_interval());
+        drop_handler_ = config.get_drop_handler();
+        drop_handler_data_ = config.get_drop_handler_data();
+
+        // finally, try to create the backend sampler using the config array
+        auto config_array = config.build_backend_config_list();
+        const auto period_ns = config.get_sampling_period();
+        if (!create_backend_sampler(config_array, period_ns, config.get_buffer_count())) {
+            ec_ = hwcpipe::make_error_code(hwcpipe::errc::backend_sampler_failure);
+            return;
+        }
+        if (period_ns != 0) {
+            thread_config_ = config.get_thread_config();
+        }
+        session_recovery_ = config.get_session_recovery();
+        power_aware_ = config.get_power_aware();
+        max_skipped_dumps_ = config.get_max_skipped_dumps();
+        power_probe_ = config.get_power_probe();
+        power_probe_data_ = config.get_power_probe_data();
+
+        widen_stretched_ =
+            config.get_drop_policy() == sampler_config::drop_policy::widen && features_.overflow_behavior_defined;
+        salvage_ = config.get_drop_policy() == sampler_config::drop_policy::salvage;
+        salvage_can_check_blocks_ =
+            features_.has_power_states || features_.has_vm_states || features_.has_protection_states;
+        backend_config_list_ = std::move(config_array);
+        backend_period_ns_ = period_ns;
+        backend_buffer_count_ = config.get_buffer_count();
+    }
+
+    /**
+     * Reserves memory for the samples and sets up the various mappings that are
+     * needed to convert between counter names & positions in the buffer. The
+     * hardware counters are appended to @p plan, whose range of the sample
+     * buffer follows the ranges already reserved.
+     */
+    void build_sample_buffer_mappings(const sampler_config::registered_counter_set &counters,
+                                      detail::gather_plan &plan) {
+        // reserve space
+        const auto num_counters = counters.size();
+
+        // the counter set is ordered, so the last entry has the largest enum
+        // value and determines the size of the dense lookup table
+        counter_lookup_.resize(std::max(counter_lookup_.size(), static_cast<size_t>(counters.rbegin()->counter) + 1));
+
+        std::vector<const sampler_config::registered_counter *> hardware_by_address{};
+        hardware_by_address.reserve(num_counters);
+
+        for (const auto &counter : counters) {
+            auto &entry = counter_lookup_[static_cast<size_t>(counter.counter)];
+
+            switch (counter.definition.tag) {
+            case detail::counter_definition::type::hardware: {
+                // the buffer position is assigned by the gather plan below
+                entry.tag = lookup_entry::type::hardware;
+                hardware_by_address.push_back(&counter);
+                break;
+            }
+            case detail::counter_definition::type::expression: {
+                // store the function pointer to run this expression in get_counter_value()
+                entry.tag = lookup_entry::type::expression;
+                entry.eval = counter.definition.get_expression().eval;
+                break;
+            }
+            case detail::counter_definition::type::invalid:
+            default:
+                // ignore (unreachable)
+                break;
+            }
         }
 
-        auto expression_eval = counter_to_evaluator_.find(counter);
-        if (expression_eval != counter_to_evaluator_.end()) {
-            return get_expression_counter_value(counter, sample, expression_eval->second);
+        // compile the gather plan used by the sample writer to convert from
+        // block/offset to sample buffer position. The sample buffer is laid
+        // out in plan order so that each block type maps to a contiguous range.
+        std::sort(hardware_by_address.begin(), hardware_by_address.end(), [](const auto *lhs, const auto *rhs) {
+            return detail::gather_plan::address_order(lhs->definition.get_address(), rhs->definition.get_address());
+        });
+
+        for (const auto *counter : hardware_by_address) {
+            auto &entry = counter_lookup_[static_cast<size_t>(counter->counter)];
+            entry.buffer_pos = plan.push_back(counter->definition.get_address());
         }
 
-        auto it = counter_to_buffer_pos_.find(counter);
-        if (it == counter_to_buffer_pos_.end()) {
-            return make_error_code(errc::unknown_counter);
+        sample_buffer_.resize(sample_buffer_.size() + plan.size());
+    }
+
+    /**
+     * Lays out the per instance buffer as one row per hardware counter, with
+     * one element per instance of the counter's block type. Rows follow the
+     * sample buffer order so each block type maps to a contiguous range.
+     */
+    template <typename block_extents_t>
+    void build_instance_layout(const block_extents_t &block_extents) {
+        instance_rows_.resize(gather_plan_.size());
+
+        size_t offset = 0;
+        for (size_t i = 0; i != instance_blocks_.size(); ++i) {
+            const auto type = static_cast<block_type>(i);
+            const auto &plan = gather_plan_[type];
+            const size_t count = block_extents.num_blocks_of_type(type);
+
+            instance_blocks_[i] = {offset, count};
+            for (size_t c = 0; c != plan.size(); ++c) {
+                instance_rows_[plan.buffer_base() + c] = {offset + c * count, count};
+            }
+            offset += plan.size() * count;
         }
 
-        sample = counter_sample(counter, last_collection_timestamp_, get_hardware_counter_value(it));
-        return {};
+        instance_buffer_.resize(offset);
     }
 
     /**
-     * @brief Returns an iterable view of the counter_sample data collected in
-     * the sample buffer.
-     * @par
-     * @code
-     * hwcpipe::sampler sampler(config);
-     * auto ec = sampler.start_sampling();
-     * while (running) {
-     *     // ... workload goes here ...
-     *     ec = sampler.sample_now();
-     *     if (!ec) {
-     *         for (const counter_sample &sample : sampler.sample_view()) {
-     *             std::cout << '[' << sample.counter_name << "] - " << sample.value << std::endl
-     *         }
-     *     }
-     * }
-     * @endcode
+     * Lays out the raw block counters, one row per counter with one element
+     * per instance of its block type, and selects the block types to decode:
+     * those with a gathered or a raw block counter. The other blocks, e.g. of
+     * the CSF firmware or the CSGs, are skipped.
      *
-     * @return An iterable object (provides begin()/end()) of counter_samples.
+     * @return False if a counter is out of the blocks of the GPU.
      */
-    HWCP_NODISCARD auto sample_view() {
-        using type = counter_to_buffer_pos_map_type::iterator;
-        return sample_iterable<type>(*this, counter_to_buffer_pos_.begin(), counter_to_buffer_pos_.end());
+    template <typename block_extents_t>
+    bool build_block_counter_layout(const std::vector<sampler_config::block_counter> &counters,
+                                    const block_extents_t &block_extents) {
+        size_t offset = 0;
+        for (const auto &counter : counters) {
+            if (counter.offset >= block_extents.counters_per_block()) {
+                return false;
+            }
+            const size_t count = block_extents.num_blocks_of_type(counter.type);
+            block_counter_rows_.push_back({counter.type, counter.offset, offset, count});
+            block_counter_type_[static_cast<size_t>(counter.type)] = true;
+            offset += count;
+        }
+        block_counter_buffer_.resize(offset);
+
+        for (size_t i = 0; i != decode_block_type_.size(); ++i) {
+            decode_block_type_[i] =
+                !gather_plan_[static_cast<block_type>(i)].empty() || block_counter_type_[i] || slow_block_type_[i];
+        }
+        return true;
     }
 
-  private:
-    /* holds the mapping from a block offset to a position in the sample buffer */
-    struct offset_to_buffer_pos {
-        size_t block_offset;
-        size_t buffer_pos;
-        size_t shift;
+    /**
+     * Reserves the copies of the blocks of the lazy decode, one per instance
+     * of the block types with gathered counters, and maps the hardware
+     * counters of the sample buffer to their block type.
+     */
+    template <typename block_extents_t>
+    void build_lazy_layout(const block_extents_t &block_extents) {
+        lazy_decode_ = true;
+        buffer_block_types_.resize(gather_plan_.size());
 
-        offset_to_buffer_pos(size_t block_offset, size_t buffer_pos, size_t shift)
-            : block_offset(block_offset)
-            , buffer_pos(buffer_pos)
-            , shift(shift) {}
-    };
+        size_t num_blocks = 0;
+        for (size_t i = 0; i != device::hwcnt::block_extents::num_block_types; ++i) {
+            const auto type = static_cast<block_type>(i);
+            const auto &plan = gather_plan_[type];
+            if (plan.empty()) {
+                continue;
+            }
+            num_blocks += block_extents.num_blocks_of_type(type);
+            auto *types = buffer_block_types_.data() + plan.buffer_base();
+            std::fill(types, types + plan.size(), static_cast<uint8_t>(i));
+        }
 
-    // backend type aliases
-    using handle_ptr_type = typename handle_type::handle_ptr;
-    using instance_ptr_type = typename instance_type::instance_ptr;
-    using sampler_ptr_type = std::unique_ptr<typename backend_policy_t::sampler_type>;
+        lazy_blocks_.resize(num_blocks);
+        if (values_are_64bit_) {
+            lazy_values64_.resize(num_blocks * counters_per_block_);
+        } else {
+            lazy_values32_.resize(num_blocks * counters_per_block_);
+        }
+    }
 
-    // mapping types for counters & buffer positions
-    using counter_to_buffer_pos_map_type = std::unordered_map<hwcpipe_counter, size_t>;
-    using counters_by_block_map_type = std::unordered_map<block_type, std::vector<offset_to_buffer_pos>>;
-    using counter_to_evaluator_type = std::unordered_map<hwcpipe_counter, detail::expression::evaluator>;
+    /**
+     * Selects the block types whose instances are summed into a totals block
+     * before the counters are extracted. Summing whole blocks is a contiguous
+     * vectorizable loop that is worth it once a block type has more than one
+     * instance and enough unshifted counters are read from it. Shifted
+     * counters are still extracted from each instance, because the shift is
+     * applied at the width of the block values.
+     */
+    template <typename block_extents_t>
+    void build_reduction_plan(const block_extents_t &block_extents) {
+        // minimum share of the block, as 1 / reduction_ratio, that must be
+        // read before the whole block is summed
+        static constexpr size_t reduction_ratio = 4;
 
-    std::error_code ec_;
+        counters_per_block_ = block_extents.counters_per_block();
 
-    // handles to the hwcpipe backend
-    handle_ptr_type handle_;
-    instance_ptr_type instance_;
-    sampler_ptr_type sampler_;
-    device::constants constants_;
+        bool any_reduced = false;
+        for (size_t i = 0; i != reduce_block_type_.size(); ++i) {
+            const auto type = static_cast<block_type>(i);
+            const auto num_unshifted = gather_plan_[type].num_unshifted();
 
-    // sample buffer and index mappings
-    counter_to_buffer_pos_map_type counter_to_buffer_pos_{};
-    counters_by_block_map_type counters_by_block_map_{};
-    std::vector<uint64_t> sample_buffer_{};
-    bool valid_sample_buffer_ = false;
-    counter_to_evaluator_type counter_to_evaluator_{};
+            // the sub-sampled cores are summed with their squares instead
+            const bool subsampled = core_subsampling_ != 0 && type == block_type::core;
+            reduce_block_type_[i] = block_extents.num_blocks_of_type(type) > 1 && num_unshifted != 0 &&
+                                    num_unshifted * reduction_ratio >= counters_per_block_ && !subsampled;
+            any_reduced = any_reduced || reduce_block_type_[i];
+        }
 
-    // sampler state
-    bool values_are_64bit_{};
-    uint64_t last_collection_timestamp_{};
-    bool sampling_in_progress_{};
+        if (any_reduced) {
+            block_totals_.resize(reduce_block_type_.size() * counters_per_block_);
+        }
+    }
+
+    /**
+     * Orders the expression counters so that every expression is evaluated
+     * after the expressions it depends on, and assigns each one a slot in the
+     * derived value buffer. Expressions that have a flat evaluator also get
+     * the list of places their operands are gathered from. The steps are
+     * appended to @p plan.
+     */
+    void build_expression_plan(const sampler_config::registered_counter_set &counters,
+                               std::vector<expression_step> &plan) {
+        enum class mark : uint8_t { none, visiting, done };
+        std::vector<mark> marks(counter_lookup_.size(), mark::none);
+
+        // depth first post-order walk over the expression dependencies.
+        // The config registers every dependency, so all lookups succeed.
+        const auto visit = [&](const sampler_config::registered_counter &counter, const auto &self) -> void {
+            auto &state = marks[static_cast<size_t>(counter.counter)];
+            if (state != mark::none || counter.definition.tag != detail::counter_definition::type::expression) {
+                assert(state != mark::visiting);
+                return;
+            }
+
+            state = mark::visiting;
+            const auto &expression = counter.definition.get_expression();
+            for (auto dependency : expression.dependencies) {
+                auto it = counters.find(dependency);
+                assert(it != counters.end());
+                self(*it, self);
+            }
+            state = mark::done;
+
+            expression_step step{expression.eval, expression.flat_eval, expression.code, derived_buffer_.size(),
+                                 expression_operands_.size(), 0};
+            if (step.flat_eval != nullptr || !step.code.empty()) {
+                // dependencies were visited first, so expressions already
+                // have their derived buffer slot
+                for (auto dependency : expression.dependencies) {
+                    const auto &operand = counter_lookup_[static_cast<size_t>(dependency)];
+                    assert(operand.tag == lookup_entry::type::hardware ||
+                           operand.tag == lookup_entry::type::cached_expression);
+                    expression_operands_.push_back(
+                        {operand.tag == lookup_entry::type::cached_expression, operand.buffer_pos});
+                }
+                step.num_inputs = expression.dependencies.size();
+            }
+
+            auto &entry = counter_lookup_[static_cast<size_t>(counter.counter)];
+            entry.tag = lookup_entry::type::cached_expression;
+            entry.buffer_pos = step.buffer_pos;
+            plan.push_back(step);
+            derived_buffer_.push_back(0.0);
+        };
+
+        for (const auto &counter : counters) {
+            visit(counter, visit);
+        }
 
-    HWCP_NODISCARD uint64_t get_hardware_counter_value(counter_to_buffer_pos_map_type::const_iterator it) const {
-        return static_cast<double>(sample_buffer_[it->second]);
+        expression_inputs_.resize(expression_operands_.size());
     }
 
-    HWCP_NODISCARD std::error_code get_expression_counter_value(hwcpipe_counter counter, counter_sample &sample,
-                                                                detail::expression::evaluator eval) const {
-        sample = counter_sample(counter, last_collection_timestamp_, eval(*this));
-        return {};
+    /**
+     * Sets up a multi-rate plan. The full set is laid out first: its hardware
+     * counters get the sample buffer range after the fast ones, and all the
+     * expressions are planned against it. The fast counters, with the
+     * counters their expressions read, then get their own buffer range and
+     * derived slots, which the lookup table points to.
+     *
+     * @return False if an expression of the full set has no flat evaluator
+     * or bytecode, which would read the fast values instead of the window.
+     */
+    template <typename block_extents_t>
+    bool build_multi_rate_plan(const sampler_config::registered_counter_set &counters,
+                               const std::vector<hwcpipe_counter> &fast_counters, uint32_t slow_period,
+                               const block_extents_t &block_extents) {
+        sampler_config::registered_counter_set fast_set{};
+        const auto visit = [&](hwcpipe_counter counter, const auto &self) -> void {
+            const auto it = counters.find(counter);
+            assert(it != counters.end());
+            if (!fast_set.insert(*it).second || it->definition.tag != detail::counter_definition::type::expression) {
+                return;
+            }
+            for (auto dependency : it->definition.get_expression().dependencies) {
+                self(dependency, self);
+            }
+        };
+        for (auto counter : fast_counters) {
+            visit(counter, visit);
+        }
+
+        build_sample_buffer_mappings(fast_set, gather_plan_);
+        std::vector<std::pair<hwcpipe_counter, lookup_entry>> fast_entries{};
+        for (const auto &counter : fast_set) {
+            fast_entries.emplace_back(counter.counter, counter_lookup_[static_cast<size_t>(counter.counter)]);
+        }
+
+        slow_gather_plan_ = detail::gather_plan(gather_plan_.size());
+        build_sample_buffer_mappings(counters, slow_gather_plan_);
+        build_expression_plan(counters, slow_expression_plan_);
+        for (const auto &step : slow_expression_plan_) {
+            if (step.flat_eval == nullptr && step.code.empty()) {
+                return false;
+            }
+        }
+
+        for (const auto &fast_entry : fast_entries) {
+            counter_lookup_[static_cast<size_t>(fast_entry.first)] = fast_entry.second;
+        }
+        build_expression_plan(fast_set, expression_plan_);
+
+        const size_t counters_per_block = block_extents.counters_per_block();
+        for (size_t i = 0; i != slow_block_type_.size(); ++i) {
+            slow_block_type_[i] = !slow_gather_plan_[static_cast<block_type>(i)].empty();
+        }
+        slow_totals_.resize(slow_block_type_.size() * counters_per_block);
+        slow_window_buffer_.resize(sample_buffer_.size());
+        slow_period_ = slow_period;
+        return true;
     }
 
-    HWCP_NODISCARD double get_counter_value(hwcpipe_counter counter) const override {
-        auto it = counter_to_buffer_pos_.find(counter);
-        assert(it != counter_to_buffer_pos_.end());
-        return static_cast<double>(get_hardware_counter_value(it));
+    /**
+     * Emits the programs of the custom counters for this device and resolves
+     * their operands. Must run after the eager expression plan is built, so
+     * that cached expressions already have their derived buffer slot.
+     */
+    void build_custom_plan(const std::vector<detail::expression::custom_expression> &customs) {
+        custom_plan_.reserve(customs.size());
+        for (const auto &custom : customs) {
+            const auto &dependencies = custom.get_dependencies();
+            custom_plan_.push_back({custom.emit(expression_constants_), custom_operands_.size(), dependencies.size()});
+            for (auto dependency : dependencies) {
+                const auto *entry = find_counter(dependency);
+                assert(entry != nullptr);
+                custom_operands_.push_back(*entry);
+            }
+        }
+
+        custom_inputs_.resize(custom_operands_.size());
+        custom_values_.resize(custom_plan_.size());
     }
 
-    HWCP_NODISCARD double get_mali_config_ext_bus_byte_size() const override {
-        return static_cast<double>(constants_.axi_bus_width) / 8.0;
+    /**
+     * Lays out one sample_view() record per configured counter, in counter
+     * order, and keeps the resolved lookup entry of each record so that the
+     * records are refreshed without any lookups.
+     */
+    void build_sample_records(const sampler_config::registered_counter_set &counters) {
+        sample_records_.reserve(counters.size());
+        sample_record_entries_.reserve(counters.size());
+        for (const auto &counter : counters) {
+            const auto *entry = find_counter(counter.counter);
+            assert(entry != nullptr);
+            sample_records_.emplace_back(counter.counter, 0, static_cast<uint64_t>(0));
+            sample_record_entries_.push_back(*entry);
+        }
     }
 
-    HWCP_NODISCARD double get_mali_config_shader_core_count() const override {
-        return static_cast<double>(constants_.num_shader_cores);
+    /** Copies the values of the last sample into the sample_view() records. */
+    void refresh_sample_records() {
+        for (size_t i = 0; i != sample_records_.size(); ++i) {
+            auto &record = sample_records_[i];
+            const auto &entry = sample_record_entries_[i];
+            if (entry.tag == lookup_entry::type::hardware) {
+                record = counter_sample(record.counter, last_collection_timestamp_, read_hardware(entry.buffer_pos));
+            } else {
+                record = counter_sample(record.counter, last_collection_timestamp_, read_entry(entry));
+            }
+        }
+        sample_records_stale_ = false;
     }
 
-    HWCP_NODISCARD double get_mali_config_l2_cache_count() const override {
-        return static_cast<double>(constants_.l2_slice_size) * static_cast<double>(constants_.num_l2_slices);
+    /**
+     * Runs the eager expression plan over the freshly filled sample buffer,
+     * after the plan of the full set when a multi-rate window was completed.
+     */
+    void evaluate_expressions() {
+        if (slow_updated_) {
+            run_expression_plan(slow_expression_plan_);
+        }
+        run_expression_plan(expression_plan_);
+
+        for (size_t i = 0; i != custom_plan_.size(); ++i) {
+            const auto &step = custom_plan_[i];
+            auto *inputs = custom_inputs_.data() + step.inputs_offset;
+            for (size_t k = 0; k != step.num_inputs; ++k) {
+                inputs[k] = read_entry(custom_operands_[step.inputs_offset + k]);
+            }
+            custom_values_[i] = step.program.evaluate(inputs);
+        }
     }
 
     /**
-     * Reserves memory for the samples and sets up the various mappings that are
-     * needed to convert between counter names & positions in the buffer.
+     * Runs an expression plan. Operands are gathered into a flat array and
+     * the evaluators are called directly, without going through the virtual
+     * context.
      */
-    void build_sample_buffer_mappings(const std::set<sampler_config::registered_counter> &counters) {
-        // reserve space
-        const auto num_counters = counters.size();
-        counter_to_buffer_pos_.reserve(num_counters);
-        sample_buffer_.reserve(num_counters);
+    void run_expression_plan(const std::vector<expression_step> &plan) {
+        for (const auto &step : plan) {
+            if (step.flat_eval == nullptr && step.code.empty()) {
+                derived_buffer_[step.buffer_pos] = step.eval(*this);
+                continue;
+            }
 
-        // set up the index needed by the sample writer to convert from
-        // block/offset to sample buffer position
-        for (size_t i = 0; i != static_cast<size_t>(device::hwcnt::block_extents::num_block_types); ++i) {
-            counters_by_block_map_[static_cast<block_type>(i)] = {};
+            const auto *operands = expression_operands_.data() + step.inputs_offset;
+            auto *inputs = expression_inputs_.data() + step.inputs_offset;
+            for (size_t i = 0; i != step.num_inputs; ++i) {
+                inputs[i] = operands[i].derived ? derived_buffer_[operands[i].buffer_pos]
+                                                : static_cast<double>(read_hardware(operands[i].buffer_pos));
+            }
+            auto &value = derived_buffer_[step.buffer_pos];
+            if (step.flat_eval != nullptr) {
+                value = step.flat_eval(inputs, expression_constants_);
+            } else {
+                value = detail::expression::evaluate(step.code, inputs, expression_constants_);
+            }
         }
+    }
 
-        for (const auto &counter : counters) {
-            auto buffer_pos = sample_buffer_.size();
+    /** @return Whether an expression only has bytecode, from a database blob. */
+    static bool has_bytecode_expressions(const sampler_config::registered_counter_set &counters) {
+        return std::any_of(counters.begin(), counters.end(), [](const sampler_config::registered_counter &counter) {
+            return counter.definition.tag == detail::counter_definition::type::expression &&
+                   counter.definition.get_expression().eval == nullptr;
+        });
+    }
 
-            switch (counter.definition.tag) {
-            case detail::counter_definition::type::hardware: {
-                // build the index needed when the caller reads a counter by name
-                counter_to_buffer_pos_[counter.counter] = buffer_pos;
-                sample_buffer_.push_back({});
+    /** The block metadata type of a blocks range. */
+    template <typename blocks_t>
+    using block_metadata_t = typename std::decay<decltype(*std::begin(std::declval<blocks_t &>()))>::type;
 
-                auto &address = counter.definition.get_address();
-                auto &block_pos_list = counters_by_block_map_[address.block_type];
-                block_pos_list.emplace_back(address.offset, buffer_pos, address.shift);
-                break;
+    /**
+     * Returns false if a block holds no data: it was powered off, unavailable
+     * to the VM or in protected mode for the whole sample, when the backend
+     * reports these states. In a salvaged erroneous sample a block must have
+     * been in the valid states for the whole sample.
+     */
+    template <typename block_t>
+    HWCP_NODISCARD bool is_active_block(const block_t &block) const {
+        if (strict_blocks_ && ((features_.has_power_states && block.state.off != 0) ||
+                               (features_.has_vm_states && block.state.unavailable != 0) ||
+                               (features_.has_protection_states && block.state.protected_mode != 0))) {
+            return false;
+        }
+        return !(features_.has_power_states && block.state.on == 0) &&
+               !(features_.has_vm_states && block.state.available == 0) &&
+               !(features_.has_protection_states && block.state.normal == 0);
+    }
+
+    /** Stores the raw block counters of a block instance. */
+    template <typename values_type_t, typename block_t>
+    void store_block_counters(const block_t &block) {
+        const auto *values = static_cast<const values_type_t *>(block.values);
+        for (const auto &row : block_counter_rows_) {
+            if (row.type == block.type && block.index < row.count) {
+                block_counter_buffer_[row.buffer_offset + block.index] = values[row.offset];
             }
-            case detail::counter_definition::type::expression: {
-                // store the function pointer to run this expression in get_counter_value()
-                counter_to_evaluator_.emplace(counter.counter, counter.definition.get_expression().eval);
-                break;
+        }
+    }
+
+    /**
+     * Calls @p fn for every active block of @p blocks whose type is decoded,
+     * and counts the active blocks per type. The raw block counters are
+     * stored on the way. The counters of each block are prefetched while the
+     * previous block is gathered, as the blocks were just written by the GPU
+     * and are cold in the CPU caches. When the cores are sub-sampled, the
+     * cores out of the window are neither prefetched nor gathered.
+     */
+    template <typename values_type_t, typename blocks_t, typename fn_t>
+    void for_each_block(blocks_t &blocks, fn_t &&fn) {
+        block_metadata_t<blocks_t> current{};
+        bool has_current = false;
+        active_instances_.fill(0);
+        std::fill(block_counter_buffer_.begin(), block_counter_buffer_.end(), 0);
+        core_position_ = 0;
+
+        for (auto &block : blocks) {
+            // the values of inactive blocks are zero or stale, skip them
+            if (!is_active_block(block)) {
+                continue;
             }
-            case detail::counter_definition::type::invalid:
-            default:
-                // ignore (unreachable)
-                break;
+            const auto type_index = static_cast<size_t>(block.type);
+            ++active_instances_[type_index];
+            if (!decode_block_type_[type_index]) {
+                continue;
+            }
+            if (block_counter_type_[type_index]) {
+                store_block_counters<values_type_t>(block);
+            }
+            if (core_subsampling_ != 0 && block.type == block_type::core && !is_sampled_core()) {
+                continue;
+            }
+            gather_plan_.prefetch<values_type_t>(block.type, block.values);
+            if (has_current) {
+                fn(current);
+            }
+            current = block;
+            has_current = true;
+        }
+
+        if (has_current) {
+            fn(current);
+        }
+    }
+
+    /**
+     * Variant of fill_sample_buffer() that sums the instances of the selected
+     * block types into totals blocks and extracts their unshifted counters
+     * once.
+     */
+    template <typename values_type_t, typename blocks_t>
+    void fill_reduced_sample_buffer(blocks_t &blocks, uint64_t *buffer) {
+        std::fill(block_totals_.begin(), block_totals_.end(), 0);
+
+        for_each_block<values_type_t>(blocks, [&](const block_metadata_t<blocks_t> &block) {
+            const auto type_index = static_cast<size_t>(block.type);
+            if (!reduce_block_type_[type_index]) {
+                gather_plan_.accumulate<values_type_t>(block.type, block.values, buffer);
+                return;
+            }
+
+            kernels_->reduce(static_cast<const values_type_t *>(block.values), counters_per_block_,
+                             block_totals_.data() + type_index * counters_per_block_);
+            gather_plan_.accumulate<values_type_t>(block.type, block.values, buffer, detail::run_filter::shifted);
+        });
+
+        for (size_t i = 0; i != reduce_block_type_.size(); ++i) {
+            if (reduce_block_type_[i]) {
+                gather_plan_.accumulate<uint64_t>(static_cast<block_type>(i),
+                                                  block_totals_.data() + i * counters_per_block_, buffer,
+                                                  detail::run_filter::unshifted);
+            }
+        }
+    }
+
+    /**
+     * Variant of fill_sample_buffer() for a multi-rate plan: the fast
+     * counters are gathered, while the blocks of the full set are summed into
+     * totals blocks. Only its shifted counters are gathered from every
+     * instance, as in fill_reduced_sample_buffer().
+     */
+    template <typename values_type_t, typename blocks_t>
+    void fill_multi_rate_sample_buffer(blocks_t &blocks, uint64_t *buffer) {
+        for_each_block<values_type_t>(blocks, [&](const block_metadata_t<blocks_t> &block) {
+            gather_plan_.accumulate<values_type_t>(block.type, block.values, buffer);
+
+            const auto type_index = static_cast<size_t>(block.type);
+            if (slow_block_type_[type_index]) {
+                kernels_->reduce(static_cast<const values_type_t *>(block.values), counters_per_block_,
+                                 slow_totals_.data() + type_index * counters_per_block_);
+                slow_gather_plan_.accumulate<values_type_t>(block.type, block.values, slow_window_buffer_.data(),
+                                                            detail::run_filter::shifted);
+            }
+        });
+    }
+
+    /**
+     * Ends a window of the multi-rate plan once it has slow_period_ samples:
+     * the counters of the full set are extracted from the totals into the
+     * sample buffer, and the next window starts from zero.
+     */
+    void advance_slow_window() {
+        slow_updated_ = false;
+        if (++slow_samples_ != slow_period_) {
+            return;
+        }
+        for (size_t i = 0; i != slow_block_type_.size(); ++i) {
+            if (slow_block_type_[i]) {
+                slow_gather_plan_.accumulate<uint64_t>(static_cast<block_type>(i),
+                                                       slow_totals_.data() + i * counters_per_block_,
+                                                       slow_window_buffer_.data(), detail::run_filter::unshifted);
+            }
+        }
+        const auto first = static_cast<std::ptrdiff_t>(gather_plan_.size());
+        std::copy(slow_window_buffer_.begin() + first, slow_window_buffer_.end(), sample_buffer_.begin() + first);
+        reset_slow_window();
+        slow_updated_ = true;
+    }
+
+    /** Drops the samples summed in the current window of the multi-rate plan. */
+    void reset_slow_window() {
+        slow_samples_ = 0;
+        slow_updated_ = false;
+        std::fill(slow_totals_.begin(), slow_totals_.end(), 0);
+        std::fill(slow_window_buffer_.begin(), slow_window_buffer_.end(), 0);
+    }
+
+    /** Returns the copies of the blocks of the lazy decode for their values type. */
+    std::vector<uint32_t> &lazy_values(uint32_t) { return lazy_values32_; }
+    std::vector<uint64_t> &lazy_values(uint64_t) { return lazy_values64_; }
+
+    /**
+     * Variant of fill_sample_buffer() for the lazy decode: the active blocks
+     * of the types with gathered counters are copied, and their types marked
+     * pending, so that the kernel sample is released without gathering them.
+     */
+    template <typename values_type_t, typename blocks_t>
+    void copy_lazy_blocks(blocks_t &blocks) {
+        auto &copies = lazy_values(values_type_t{});
+        num_lazy_blocks_ = 0;
+        for_each_block<values_type_t>(blocks, [&](const block_metadata_t<blocks_t> &block) {
+            if (gather_plan_[block.type].empty() || num_lazy_blocks_ == lazy_blocks_.size()) {
+                return;
+            }
+            const auto *values = static_cast<const values_type_t *>(block.values);
+            std::copy(values, values + counters_per_block_, copies.data() + num_lazy_blocks_ * counters_per_block_);
+            lazy_blocks_[num_lazy_blocks_++] = block.type;
+            lazy_pending_[static_cast<size_t>(block.type)] = true;
+        });
+    }
+
+    /** Gathers the counters of a pending block type from the copies of its blocks. */
+    void decode_lazy_blocks(size_t type_index) const {
+        lazy_pending_[type_index] = false;
+        if (values_are_64bit_) {
+            gather_lazy_blocks(static_cast<block_type>(type_index), lazy_values64_);
+        } else {
+            gather_lazy_blocks(static_cast<block_type>(type_index), lazy_values32_);
+        }
+        stats_.add_lazy_decode();
+    }
+
+    template <typename values_type_t>
+    void gather_lazy_blocks(block_type type, const std::vector<values_type_t> &copies) const {
+        for (size_t i = 0; i != num_lazy_blocks_; ++i) {
+            if (lazy_blocks_[i] == type) {
+                gather_plan_.accumulate<values_type_t>(type, copies.data() + i * counters_per_block_,
+                                                       sample_buffer_.data());
+            }
+        }
+    }
+
+    /** Returns whether the next active core is in the window, and moves to the one after. */
+    HWCP_NODISCARD bool is_sampled_core() {
+        const uint32_t position = core_position_++;
+        return (position + core_active_ - core_first_) % core_active_ < core_subsampling_;
+    }
+
+    /**
+     * Variant of fill_sample_buffer() that decodes a window of the active
+     * cores, and extrapolates the core counters to all of them. The total of
+     * a counter is estimated as N times the mean of the n decoded cores, with
+     * the standard error of a sample drawn without replacement:
+     * N * sqrt((1 - n / N) * s^2 / n), s^2 being the variance of the decoded
+     * cores.
+     */
+    template <typename values_type_t, typename blocks_t>
+    void fill_subsampled_sample_buffer(blocks_t &blocks, uint64_t *buffer) {
+        core_active_ = 0;
+        for (auto &block : blocks) {
+            if (block.type == block_type::core && is_active_block(block)) {
+                ++core_active_;
+            }
+        }
+        const uint32_t num_sampled = std::min(core_subsampling_, core_active_);
+        core_first_ = core_active_ == 0 ? 0 : core_rotation_ % core_active_;
+        core_rotation_ = core_active_ == 0 ? 0 : (core_first_ + num_sampled) % core_active_;
+
+        const auto &core_plan = gather_plan_[block_type::core];
+        uint64_t *core_totals = buffer + core_plan.buffer_base();
+        std::fill(core_sum_sq_.begin(), core_sum_sq_.end(), 0.0);
+
+        const auto gather = [&](const block_metadata_t<blocks_t> &block) {
+            if (block.type != block_type::core) {
+                const auto type_index = static_cast<size_t>(block.type);
+                if (!reduce_block_type_[type_index]) {
+                    gather_plan_.accumulate<values_type_t>(block.type, block.values, buffer);
+                    return;
+                }
+                kernels_->reduce(static_cast<const values_type_t *>(block.values), counters_per_block_,
+                                 block_totals_.data() + type_index * counters_per_block_);
+                gather_plan_.accumulate<values_type_t>(block.type, block.values, buffer,
+                                                       detail::run_filter::shifted);
+                return;
+            }
+
+            gather_plan_.store_strided<values_type_t>(block.type, block.values, core_values_.data(), 1);
+            for (size_t c = 0; c != core_values_.size(); ++c) {
+                const auto value = static_cast<double>(core_values_[c]);
+                core_totals[c] += core_values_[c];
+                core_sum_sq_[c] += value * value;
             }
+        };
+        std::fill(block_totals_.begin(), block_totals_.end(), 0);
+        for_each_block<values_type_t>(blocks, gather);
+        for (size_t i = 0; i != reduce_block_type_.size(); ++i) {
+            if (reduce_block_type_[i]) {
+                gather_plan_.accumulate<uint64_t>(static_cast<block_type>(i),
+                                                  block_totals_.data() + i * counters_per_block_, buffer,
+                                                  detail::run_filter::unshifted);
+            }
+        }
+
+        const uint64_t n = num_sampled;
+        const uint64_t total = core_active_;
+        for (size_t c = 0; c != core_errors_.size(); ++c) {
+            if (n == total) {
+                core_errors_[c] = 0.0;
+                continue;
+            }
+            const uint64_t sum = core_totals[c];
+            // N * sum / n, rounded, without overflowing the product
+            core_totals[c] = sum / n * total + ((sum % n) * total + n / 2) / n;
+            if (n < 2) {
+                core_errors_[c] = std::numeric_limits<double>::quiet_NaN();
+                continue;
+            }
+            const double mean = static_cast<double>(sum) / static_cast<double>(n);
+            const double variance =
+                std::max(0.0, (core_sum_sq_[c] - mean * static_cast<double>(sum)) / static_cast<double>(n - 1));
+            const double fraction = static_cast<double>(n) / static_cast<double>(total);
+            core_errors_[c] =
+                static_cast<double>(total) * std::sqrt((1.0 - fraction) * variance / static_cast<double>(n));
         }
     }
 
@@ -644,20 +3898,51 @@ class sampler : private detail::expression::context {
      * sample buffer. Templated because the void* we get from the reader is
      * either uint32_t* or uint64_t*, depending on the GPU.
      */
-    template <typename values_type_t>
-    void fill_sample_buffer(sample_type &backend_sample) {
+    template <typename values_type_t, typename blocks_t>
+    void fill_sample_buffer(blocks_t &blocks, uint64_t *buffer) {
         // loop over the counter blocks returned by the reader and fetch any
         // samples that were requested
-        for (auto &block : backend_sample.blocks()) {
-            const auto &counters_in_block = counters_by_block_map_[block.type];
-            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
-            const auto *block_buffer = reinterpret_cast<const values_type_t *>(block.values);
+        if (lazy_decode_) {
+            copy_lazy_blocks<values_type_t>(blocks);
+            return;
+        }
+        if (core_subsampling_ != 0) {
+            fill_subsampled_sample_buffer<values_type_t>(blocks, buffer);
+            return;
+        }
+        if (slow_period_ != 0) {
+            fill_multi_rate_sample_buffer<values_type_t>(blocks, buffer);
+            return;
+        }
+        if (instance_rows_.empty()) {
+            if (block_totals_.empty()) {
+                for_each_block<values_type_t>(blocks, [&](const block_metadata_t<blocks_t> &block) {
+                    gather_plan_.accumulate<values_type_t>(block.type, block.values, buffer);
+                });
+                return;
+            }
+
+            fill_reduced_sample_buffer<values_type_t>(blocks, buffer);
+            return;
+        }
 
-            // collect any counters that the user requested from this block
-            for (const auto &mapping : counters_in_block) {
-                auto &sample = sample_buffer_[mapping.buffer_pos];
-                sample += block_buffer[mapping.block_offset] << mapping.shift;
+        // per instance mode: store each block instance into its column, then
+        // reduce the rows into the summed sample buffer
+        std::fill(instance_buffer_.begin(), instance_buffer_.end(), 0);
+        for_each_block<values_type_t>(blocks, [&](const block_metadata_t<blocks_t> &block) {
+            const auto &layout = instance_blocks_[static_cast<size_t>(block.type)];
+            if (block.index >= layout.count) {
+                return;
             }
+            gather_plan_.store_strided<values_type_t>(block.type, block.values,
+                                                      instance_buffer_.data() + layout.offset + block.index,
+                                                      layout.count);
+        });
+
+        for (size_t pos = 0; pos != instance_rows_.size(); ++pos) {
+            const auto &row = instance_rows_[pos];
+            const auto *begin = instance_buffer_.data() + row.offset;
+            buffer[pos] = std::accumulate(begin, begin + row.count, uint64_t{0});
         }
     }
 };
@@ -0,0 +1,304 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace hwcpipe {
+
+/**
+ * @brief Time spent in a step of the sampling, in nanoseconds.
+ */
+struct sampler_timing {
+    /** Number of times the step was run. */
+    uint64_t count;
+    /** Cumulative time spent in the step. */
+    uint64_t total_ns;
+    /** Longest time spent in the step. */
+    uint64_t max_ns;
+};
+
+/**
+ * @brief Statistics of a hwcpipe::sampler about its own cost, as returned by
+ * sampler::get_stats().
+ */
+struct sampler_stats {
+    /** Samples decoded into the sample buffer. */
+    uint64_t samples_taken;
+    /**
+     * Samples that the kernel flagged as erroneous. They are rejected unless
+     * sampler_config::drop_policy::salvage accepts them.
+     */
+    uint64_t samples_errored;
+    /**
+     * Samples that the kernel flagged as stretched. They are rejected unless
+     * sampler_config::drop_policy::widen or salvage accepts them.
+     */
+    uint64_t samples_stretched;
+    /**
+     * Samples that the kernel numbered but that were never read, detected
+     * as gaps between the sample numbers of consecutive samples.
+     */
+    uint64_t samples_dropped;
+    /**
+     * Largest number of samples that were waiting in the kernel buffer when
+     * a periodic sample was read, see sample_metadata::backlog. Zero if the
+     * backend doesn't estimate it.
+     */
+    uint32_t max_backlog;
+    /**
+     * Samples taken without decoding their blocks because the GPU was idle,
+     * see sampler_config::set_idle_skip().
+     */
+    uint64_t samples_idle;
+    /**
+     * Samples in which a 32-bit counter reached its maximum value, see
+     * sampler_config::set_saturation_check().
+     */
+    uint64_t samples_saturated;
+    /**
+     * Manual dumps that were not requested because the GPU was powered
+     * down, see sampler_config::set_power_aware(). Their samples are not
+     * counted by samples_taken.
+     */
+    uint64_t dumps_avoided;
+    /**
+     * Block types gathered from the copies of a sample on their first read,
+     * see sampler_config::set_lazy_decode().
+     */
+    uint64_t lazy_decodes;
+    /** Time spent requesting manual samples. */
+    sampler_timing request;
+    /**
+     * Time spent reading samples from the backend, i.e. waiting for the
+     * sample and decoding its blocks.
+     */
+    sampler_timing collect;
+    /** Time spent evaluating the eager expressions and custom counters. */
+    sampler_timing evaluation;
+    /**
+     * Time spent setting the backend session up again after an error, see
+     * sampler::recover_session(). Its count is the number of attempts.
+     */
+    sampler_timing recovery;
+};
+
+/**
+ * @brief Samples that a hwcpipe::sampler found missing or stretched, as given
+ * to the sampler_config::drop_handler.
+ */
+struct drop_event {
+    /** Number of the sample that was read after the drop. */
+    uint64_t sample_nr;
+    /** Number of samples missing before it, detected as a sample_nr gap. */
+    uint64_t dropped;
+    /**
+     * True if the kernel flagged the sample as stretched: its period was
+     * extended because the kernel buffer overflowed.
+     */
+    bool stretched;
+    /**
+     * True if the sample was accepted, because sampler_config::drop_policy::widen
+     * is selected and the backend saturates its counters on overflow, or
+     * because sampler_config::drop_policy::salvage is selected.
+     */
+    bool widened;
+    /**
+     * True if the backend session was set up again after an error since the
+     * last sample accepted, see sampler::recover_session(). The counts
+     * between the error and the recovery are lost.
+     */
+    bool recovered;
+};
+
+/**
+ * @brief Kernel buffering of a periodic sampler, as recommended by
+ * sampler::recommend_buffering() for the next sampler.
+ */
+struct buffering_recommendation {
+    /**
+     * Number of samples for sampler_config::set_buffer_count(), or zero to
+     * keep the backend default if no backlog was observed.
+     */
+    uint32_t buffer_count;
+    /**
+     * Number of samples to read each time the collector wakes up, so that
+     * it catches up with the kernel.
+     */
+    uint32_t batch_size;
+};
+
+namespace detail {
+
+/**
+ * Recommends the kernel buffering that keeps up with the backlog observed in
+ * a session. The buffer keeps a free sample on top of the largest backlog so
+ * that the kernel never has to stretch a sample, and is at least doubled if
+ * samples were dropped as the backlog was then capped by the buffer size. The
+ * count is a power of two, which vinstr requires.
+ *
+ * @param [in] max_backlog   Largest backlog observed, zero if unknown.
+ * @param [in] dropped       Samples dropped in the session.
+ * @param [in] buffer_count  Samples that the kernel buffer held, zero if
+ *                           unknown.
+ * @return The recommended buffering.
+ */
+inline buffering_recommendation recommend_buffering(uint32_t max_backlog, uint64_t dropped, uint32_t buffer_count) {
+    if (max_backlog == 0) {
+        return {0, 1};
+    }
+
+    constexpr uint64_t max_count = uint64_t{1} << 31U;
+    uint64_t needed = uint64_t{max_backlog} + 1;
+    if (dropped != 0) {
+        const uint64_t held = buffer_count > max_backlog ? buffer_count : max_backlog;
+        needed = needed > 2 * held ? needed : 2 * held;
+    }
+
+    uint64_t count = 2;
+    while (count < needed && count < max_count) {
+        count <<= 1U;
+    }
+    return {static_cast<uint32_t>(count), max_backlog};
+}
+
+/**
+ * Accumulates the sampler_stats of a sampler. It is written by the thread
+ * that samples and may be read by any thread, so the counters are relaxed
+ * atomics. As there is a single writer they are updated with plain loads and
+ * stores rather than read-modify-write operations.
+ */
+class sampler_stats_counters {
+  public:
+    using clock = std::chrono::steady_clock;
+
+    /** Accumulated time of a step. */
+    class timing {
+      public:
+        /** Adds a run of the step that started at @p begin. */
+        void add(clock::time_point begin) {
+            const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - begin);
+            const auto ns = static_cast<uint64_t>(elapsed.count());
+            count_.store(count_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            total_ns_.store(total_ns_.load(std::memory_order_relaxed) + ns, std::memory_order_relaxed);
+            if (ns > max_ns_.load(std::memory_order_relaxed)) {
+                max_ns_.store(ns, std::memory_order_relaxed);
+            }
+        }
+
+        sampler_timing get() const {
+            return {count_.load(std::memory_order_relaxed), total_ns_.load(std::memory_order_relaxed),
+                    max_ns_.load(std::memory_order_relaxed)};
+        }
+
+        void set(const sampler_timing &value) {
+            count_.store(value.count, std::memory_order_relaxed);
+            total_ns_.store(value.total_ns, std::memory_order_relaxed);
+            max_ns_.store(value.max_ns, std::memory_order_relaxed);
+        }
+
+      private:
+        std::atomic<uint64_t> count_{};
+        std::atomic<uint64_t> total_ns_{};
+        std::atomic<uint64_t> max_ns_{};
+    };
+
+    sampler_stats_counters() = default;
+
+    // the sampler is movable, so are its statistics
+    sampler_stats_counters(const sampler_stats_counters &other) { set(other.get()); }
+    sampler_stats_counters &operator=(const sampler_stats_counters &other) {
+        set(other.get());
+        return *this;
+    }
+
+    /** Counts a sample decoded into the sample buffer. */
+    void add_taken() { increment(samples_taken_); }
+    /** Counts a sample flagged as erroneous. */
+    void add_errored() { increment(samples_errored_); }
+    /** Counts a sample flagged as stretched. */
+    void add_stretched() { increment(samples_stretched_); }
+    /** Counts a sample taken while the GPU was idle. */
+    void add_idle() { increment(samples_idle_); }
+    /** Counts a sample with a saturated counter. */
+    void add_saturated() { increment(samples_saturated_); }
+    /** Counts a manual dump skipped because the GPU was powered down. */
+    void add_avoided() { increment(dumps_avoided_); }
+    /** Counts a block type decoded on its first read. */
+    void add_lazy_decode() { increment(lazy_decodes_); }
+    /** Keeps the largest backlog of the samples read. */
+    void add_backlog(uint32_t backlog) {
+        if (backlog > max_backlog_.load(std::memory_order_relaxed)) {
+            max_backlog_.store(backlog, std::memory_order_relaxed);
+        }
+    }
+    /** Counts the samples missing before a sample number. */
+    void add_dropped(uint64_t count) {
+        samples_dropped_.store(samples_dropped_.load(std::memory_order_relaxed) + count, std::memory_order_relaxed);
+    }
+
+    timing &request() { return request_; }
+    timing &collect() { return collect_; }
+    timing &evaluation() { return evaluation_; }
+    timing &recovery() { return recovery_; }
+
+    sampler_stats get() const {
+        return {samples_taken_.load(std::memory_order_relaxed),
+                samples_errored_.load(std::memory_order_relaxed),
+                samples_stretched_.load(std::memory_order_relaxed),
+                samples_dropped_.load(std::memory_order_relaxed),
+                max_backlog_.load(std::memory_order_relaxed),
+                samples_idle_.load(std::memory_order_relaxed),
+                samples_saturated_.load(std::memory_order_relaxed),
+                dumps_avoided_.load(std::memory_order_relaxed),
+                lazy_decodes_.load(std::memory_order_relaxed),
+                request_.get(),
+                collect_.get(),
+                evaluation_.get(),
+                recovery_.get()};
+    }
+
+    void set(const sampler_stats &value) {
+        samples_taken_.store(value.samples_taken, std::memory_order_relaxed);
+        samples_errored_.store(value.samples_errored, std::memory_order_relaxed);
+        samples_stretched_.store(value.samples_stretched, std::memory_order_relaxed);
+        samples_dropped_.store(value.samples_dropped, std::memory_order_relaxed);
+        max_backlog_.store(value.max_backlog, std::memory_order_relaxed);
+        samples_idle_.store(value.samples_idle, std::memory_order_relaxed);
+        samples_saturated_.store(value.samples_saturated, std::memory_order_relaxed);
+        dumps_avoided_.store(value.dumps_avoided, std::memory_order_relaxed);
+        lazy_decodes_.store(value.lazy_decodes, std::memory_order_relaxed);
+        request_.set(value.request);
+        collect_.set(value.collect);
+        evaluation_.set(value.evaluation);
+        recovery_.set(value.recovery);
+    }
+
+  private:
+    static void increment(std::atomic<uint64_t> &counter) {
+        counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    std::atomic<uint64_t> samples_taken_{};
+    std::atomic<uint64_t> samples_errored_{};
+    std::atomic<uint64_t> samples_stretched_{};
+    std::atomic<uint64_t> samples_dropped_{};
+    std::atomic<uint32_t> max_backlog_{};
+    std::atomic<uint64_t> samples_idle_{};
+    std::atomic<uint64_t> samples_saturated_{};
+    std::atomic<uint64_t> dumps_avoided_{};
+    std::atomic<uint64_t> lazy_decodes_{};
+    timing request_{};
+    timing collect_{};
+    timing evaluation_{};
+    timing recovery_{};
+};
+
+} // namespace detail
+} // namespace hwcpipe
@@ -0,0 +1,291 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include "hwcpipe/error.hpp"
+#include "hwcpipe/hwcpipe_counter.h"
+#include "hwcpipe/sampler.hpp"
+#include "hwcpipe/types.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <system_error>
+#include <vector>
+
+namespace hwcpipe {
+
+static_assert(ATOMIC_LLONG_LOCK_FREE == 2, "Shared sample segments need address-free 64-bit atomics.");
+
+/**
+ * The binary layout of a shared sample segment. The layout is fixed so that
+ * readers built against any hwcpipe version, or without hwcpipe, can parse
+ * it. A segment is laid out as:
+ *
+ *  - a segment_header at offset 0,
+ *  - num_counters counter_entry records at entries_offset,
+ *  - num_counters 64-bit words at values_offset, each holding the bit pattern
+ *    of an IEEE-754 double, in the same order as the entries,
+ *  - since version 1.1, an optional history ring of ring_capacity slots of
+ *    ring_slot_size bytes at ring_offset. Each slot is a ring_slot_header
+ *    followed by num_counters values. Sample number n (the sample_count after
+ *    it was published, starting at 1) is in slot (n - 1) % ring_capacity.
+ *
+ * The sequence, timestamp, sample count and values are published with a
+ * seqlock: the sequence is odd while a sample is being written and is
+ * incremented again once it is complete. Every ring slot has its own seqlock.
+ *
+ * Version 1.0 headers are base_header_size bytes long and have no ring.
+ */
+namespace shared_layout {
+
+/** 'HWCP' in little endian. */
+constexpr uint32_t magic = 0x50435748;
+/** Incremented for changes that existing readers can't parse. */
+constexpr uint16_t version_major = 1;
+/** Incremented for compatible additions. */
+constexpr uint16_t version_minor = 1;
+/** Size of a version 1.0 header, which has no history ring. */
+constexpr uint32_t base_header_size = 56;
+
+/** The header at the start of a segment. */
+struct segment_header {
+    uint32_t magic;
+    uint16_t version_major;
+    uint16_t version_minor;
+    /** Size of this header in bytes. */
+    uint32_t header_size;
+    /** Size of a counter_entry in bytes. */
+    uint32_t entry_size;
+    /** Number of counters in the segment. */
+    uint32_t num_counters;
+    /** Offset of the first counter_entry from the start of the segment. */
+    uint32_t entries_offset;
+    /** Offset of the first value from the start of the segment. */
+    uint32_t values_offset;
+    /** Total size of the segment in bytes. */
+    uint32_t segment_size;
+    /** Seqlock sequence, odd while a sample is being written. */
+    std::atomic<uint64_t> sequence;
+    /** Timestamp of the published sample, in nanoseconds. */
+    std::atomic<uint64_t> timestamp;
+    /** Number of samples published so far. */
+    std::atomic<uint64_t> sample_count;
+    /** Offset of the first ring slot from the start of the segment. */
+    uint32_t ring_offset;
+    /** Number of slots in the history ring, zero if there is no ring. */
+    uint32_t ring_capacity;
+    /** Size of a ring slot in bytes. */
+    uint32_t ring_slot_size;
+    uint32_t reserved;
+};
+
+/** The header of a history ring slot, followed by the values of the sample. */
+struct ring_slot_header {
+    /** Seqlock sequence of the slot, odd while the slot is being written. */
+    std::atomic<uint64_t> sequence;
+    /** Timestamp of the sample, in nanoseconds. */
+    std::atomic<uint64_t> timestamp;
+    /** The sample number held by the slot, zero if it was never written. */
+    std::atomic<uint64_t> sample_number;
+};
+
+/** Describes one counter of the segment. Strings are NUL terminated. */
+struct counter_entry {
+    /** The hwcpipe_counter value. */
+    uint32_t counter;
+    uint32_t reserved;
+    /** The counter identifier, e.g. MaliGPUActiveCy. */
+    char identifier[48];
+    /** The human readable counter name. */
+    char name[80];
+    /** The units of the counter. */
+    char units[16];
+};
+
+static_assert(sizeof(segment_header) == 72, "The segment header layout is part of the segment ABI.");
+static_assert(sizeof(ring_slot_header) == 24, "The ring slot layout is part of the segment ABI.");
+static_assert(sizeof(counter_entry) == 152, "The counter entry layout is part of the segment ABI.");
+
+} // namespace shared_layout
+
+/**
+ * @brief A shared_sample_exporter publishes the latest value of a set of
+ * counters to a shared memory segment (a Linux memfd) that other processes can
+ * map and poll without any syscalls or locks. A single process owns the
+ * counter session and exports its samples; any number of readers use a
+ * shared_sample_reader, or their own implementation of shared_layout, to read
+ * them.
+ *
+ * The segment file descriptor can be handed to the readers over a Unix
+ * domain socket, or opened by them through /proc/<pid>/fd/<fd>.
+ *
+ * @par
+ * @code
+ * hwcpipe::shared_sample_exporter exporter(counters, num_counters);
+ * auto list = sampler.make_read_list(counters, num_counters, ec);
+ * while (running) {
+ *     if (!sampler.sample_now()) {
+ *         auto ec = exporter.publish(sampler, list);
+ *     }
+ * }
+ * @endcode
+ */
+class shared_sample_exporter {
+  public:
+    /**
+     * Creates and maps a segment for a list of counters. If the segment can't
+     * be created the exporter is invalid.
+     *
+     * @param [in] counters  The counters to export, in segment order.
+     * @param [in] count     Number of entries in @p counters.
+     * @param [in] history   Number of samples kept in the history ring, so
+     *                       that readers polling slower than the sample rate
+     *                       don't miss any. Zero exports the latest sample
+     *                       only.
+     */
+    shared_sample_exporter(const hwcpipe_counter *counters, size_t count, size_t history = 0);
+
+    ~shared_sample_exporter();
+
+    shared_sample_exporter(const shared_sample_exporter &) = delete;
+    shared_sample_exporter &operator=(const shared_sample_exporter &) = delete;
+
+    /** @return True if the segment was created. */
+    operator bool() const { return !ec_; }
+
+    /** @return The error that made the exporter invalid, if any. */
+    HWCP_NODISCARD std::error_code get_error() const { return ec_; }
+
+    /** @return The file descriptor of the segment, or -1 if it is invalid. */
+    HWCP_NODISCARD int get_fd() const { return fd_; }
+
+    /** @return The size of the segment in bytes. */
+    HWCP_NODISCARD size_t get_segment_size() const { return size_; }
+
+    /** @return The mapped segment, or nullptr if it is invalid. */
+    HWCP_NODISCARD const void *get_segment() const { return segment_; }
+
+    /** @return The number of exported counters. */
+    HWCP_NODISCARD size_t size() const { return staging_.size(); }
+
+    /**
+     * @brief Publishes a sample.
+     *
+     * @param [in] timestamp  The timestamp of the sample.
+     * @param [in] values     One value per exported counter, in segment order.
+     */
+    void publish(uint64_t timestamp, const double *values);
+
+    /**
+     * @brief Publishes the last sample of a sampler.
+     *
+     * @param [in] sampler  The sampler that collected the sample.
+     * @param [in] list     A read list of the exported counters, in segment
+     *                      order.
+     * @return The error returned by sampler::get_counter_values(), or the
+     * creation error if the exporter is invalid.
+     */
+    template <typename backend_policy_t>
+    HWCP_NODISCARD std::error_code publish(const sampler<backend_policy_t> &sampler, const read_list &list) {
+        if (ec_) {
+            return ec_;
+        }
+        auto ec = sampler.get_counter_values(list, staging_.data(), staging_.size());
+        if (ec) {
+            return ec;
+        }
+        publish(sampler.get_sample_timestamp(), staging_.data());
+        return {};
+    }
+
+  private:
+    std::error_code ec_;
+    int fd_{-1};
+    void *segment_{};
+    size_t size_{};
+    shared_layout::segment_header *header_{};
+    std::atomic<uint64_t> *values_{};
+    char *ring_{};
+    size_t ring_capacity_{};
+    size_t ring_slot_size_{};
+    std::vector<double> staging_{};
+};
+
+/**
+ * @brief A shared_sample_reader reads the latest sample from a mapped shared
+ * sample segment. Reads never block the exporter; a read that overlaps a
+ * publish is detected and fails.
+ */
+class shared_sample_reader {
+  public:
+    /**
+     * Validates a mapped segment. If the segment doesn't have a supported
+     * layout the reader is invalid.
+     *
+     * @param [in] segment  The mapped segment.
+     * @param [in] size     The size of the mapping in bytes.
+     */
+    shared_sample_reader(const void *segment, size_t size);
+
+    /** @return True if the segment has a supported layout. */
+    operator bool() const { return !ec_; }
+
+    /** @return hwcpipe::errc::invalid_segment_layout if the reader is invalid. */
+    HWCP_NODISCARD std::error_code get_error() const { return ec_; }
+
+    /** @return The number of counters in the segment. */
+    HWCP_NODISCARD size_t size() const { return num_counters_; }
+
+    /** @return The descriptor of counter @p index. */
+    HWCP_NODISCARD const shared_layout::counter_entry &entry(size_t index) const {
+        return *reinterpret_cast<const shared_layout::counter_entry *>(entries_ + index * entry_size_);
+    }
+
+    /**
+     * @brief Tries to copy the latest sample.
+     *
+     * @param [out] values        Receives size() values.
+     * @param [out] timestamp     Set to the timestamp of the sample.
+     * @param [out] sample_count  Set to the number of samples published so far.
+     * @return False if nothing was published yet, or if a sample was being
+     * published during the read, in which case the read can be retried.
+     */
+    HWCP_NODISCARD bool try_read(double *values, uint64_t &timestamp, uint64_t &sample_count) const;
+
+    /** @return The number of samples published so far. */
+    HWCP_NODISCARD uint64_t sample_count() const {
+        return ec_ ? 0 : header_->sample_count.load(std::memory_order_acquire);
+    }
+
+    /** @return The number of samples kept in the history ring, zero if the segment has none. */
+    HWCP_NODISCARD size_t ring_capacity() const { return ring_capacity_; }
+
+    /**
+     * @brief Tries to copy a sample from the history ring.
+     *
+     * @param [in]  sample_number  The sample to read, from 1 to sample_count().
+     * @param [out] values         Receives size() values.
+     * @param [out] timestamp      Set to the timestamp of the sample.
+     * @return False if the sample was not published yet, was already
+     * overwritten, or was being overwritten during the read.
+     */
+    HWCP_NODISCARD bool try_read_sample(uint64_t sample_number, double *values, uint64_t &timestamp) const;
+
+  private:
+    std::error_code ec_;
+    const shared_layout::segment_header *header_{};
+    const char *entries_{};
+    size_t entry_size_{};
+    const std::atomic<uint64_t> *values_{};
+    size_t num_counters_{};
+    const char *ring_{};
+    size_t ring_capacity_{};
+    size_t ring_slot_size_{};
+};
+
+} // namespace hwcpipe
@@ -0,0 +1,503 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include "device/constants.hpp"
+#include "device/product_id.hpp"
+#include "hwcpipe/detail/internal_types.hpp"
+#include "hwcpipe/error.hpp"
+#include "hwcpipe/gpu.hpp"
+#include "hwcpipe/hwcpipe_counter.h"
+#include "hwcpipe/sampler.hpp"
+#include "hwcpipe/types.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <system_error>
+#include <vector>
+
+namespace hwcpipe {
+
+template <typename backend_policy_t>
+class basic_shared_session;
+
+/** How a shared session serves the manual sample requests of its clients. */
+struct shared_session_config {
+    /**
+     * Time after a dump during which the sample requests are served by that
+     * dump, in nanoseconds. Zero dumps for every request.
+     */
+    uint64_t coalesce_window_ns{50000};
+};
+
+/** What a shared session did. */
+struct shared_session_stats {
+    /** Number of sample requests of the clients. */
+    uint64_t num_requests;
+    /** Number of requests served by an earlier dump. */
+    uint64_t num_coalesced;
+    /** Number of dumps, of the requests and of sample_now(). */
+    uint64_t num_dumps;
+};
+
+/**
+ * @brief A session_client is one consumer of a shared session. It has its own
+ * counter set and its own sample period: hardware counter values accumulate
+ * between two calls to collect(), however many samples the session took in
+ * between.
+ */
+class session_client : private detail::expression::context {
+  public:
+    /**
+     * @brief Makes the counter values accumulated since the previous call
+     * readable, and starts a new accumulation period.
+     *
+     * A client whose request was coalesced with a dump it already collected
+     * collects an empty period, in which every hardware counter is zero,
+     * ending at that dump, so that the values of the dump are only counted
+     * once.
+     *
+     * @return hwcpipe::errc::sample_not_ready if the session took no sample
+     * since the previous call, otherwise an empty error_code.
+     */
+    HWCP_NODISCARD std::error_code collect() {
+        if (num_pending_ == 0 && !recollect_) {
+            return make_error_code(errc::sample_not_ready);
+        }
+        user_data_ = pending_user_data_;
+        pending_user_data_ = 0;
+        recollect_ = false;
+
+        values_.swap(accumulated_);
+        std::fill(accumulated_.begin(), accumulated_.end(), 0);
+        timestamp_ = pending_timestamp_;
+        num_pending_ = 0;
+
+        for (auto i : expression_order_) {
+            const auto &expression = expressions_[i];
+            if (expression.eval != nullptr) {
+                expression_values_[i] = expression.eval(*this);
+                continue;
+            }
+
+            // the expressions of a database blob run their bytecode on the values of their dependencies
+            auto *input = expression_inputs_.data();
+            for (auto dependency : expression.dependencies) {
+                const auto &operand = slots_[static_cast<size_t>(dependency)];
+                *input++ = operand.expression ? expression_values_[operand.index]
+                                              : static_cast<double>(values_[operand.index]);
+            }
+            expression_values_[i] =
+                detail::expression::evaluate(expression.code, expression_inputs_.data(), constants_);
+        }
+
+        valid_ = true;
+        return {};
+    }
+
+    /**
+     * @brief Fetches the value of a counter over the last collected period.
+     *
+     * @param [in]  counter  The counter to read.
+     * @param [out] sample   Populated with data from the counter.
+     * @return Returns hwcpipe::errc::sample_collection_failure if nothing was
+     * collected yet, hwcpipe::errc::unknown_counter if the counter is not in
+     * the client's configuration, otherwise an empty error_code.
+     */
+    HWCP_NODISCARD std::error_code get_counter_value(hwcpipe_counter counter, counter_sample &sample) const {
+        if (!valid_) {
+            return make_error_code(errc::sample_collection_failure);
+        }
+
+        const auto *slot = find_slot(counter);
+        if (slot == nullptr) {
+            return make_error_code(errc::unknown_counter);
+        }
+
+        if (slot->expression) {
+            sample = counter_sample(counter, timestamp_, expression_values_[slot->index]);
+        } else {
+            sample = counter_sample(counter, timestamp_, values_[slot->index]);
+        }
+        return {};
+    }
+
+    /** @return The number of session samples accumulated since the last collect(). */
+    HWCP_NODISCARD size_t num_pending_samples() const { return num_pending_; }
+
+    /**
+     * @return The user data of the last request of the client served by the
+     * collected sample, see basic_shared_session::request_sample(), or zero.
+     */
+    HWCP_NODISCARD uint64_t get_sample_user_data() const { return user_data_; }
+
+  private:
+    template <typename backend_policy_t>
+    friend class basic_shared_session;
+
+    // where the value of a counter of the client is kept
+    struct slot {
+        bool used;
+        bool expression;
+        size_t index;
+    };
+
+    explicit session_client(const sampler_config &config) {
+        const auto &counters = config.get_valid_counters();
+        slots_.resize(static_cast<size_t>(counters.rbegin()->counter) + 1);
+
+        for (const auto &counter : counters) {
+            auto &slot = slots_[static_cast<size_t>(counter.counter)];
+            switch (counter.definition.tag) {
+            case detail::counter_definition::type::hardware:
+                slot = {true, false, hardware_.size()};
+                hardware_.push_back(counter.counter);
+                break;
+            case detail::counter_definition::type::expression:
+                slot = {true, true, expressions_.size()};
+                expressions_.push_back(counter.definition.get_expression());
+                expression_inputs_.resize(
+                    std::max(expression_inputs_.size(), counter.definition.get_expression().dependencies.size()));
+                break;
+            case detail::counter_definition::type::invalid:
+            default:
+                break;
+            }
+        }
+
+        accumulated_.resize(hardware_.size());
+        values_.resize(hardware_.size());
+        scratch_.resize(hardware_.size());
+        expression_values_.resize(expressions_.size());
+
+        // expressions run after the expressions they depend on. The config
+        // registers every dependency, so all the slots are used.
+        std::vector<bool> ordered(expressions_.size(), false);
+        const auto visit = [&](size_t index, const auto &self) -> void {
+            if (ordered[index]) {
+                return;
+            }
+            ordered[index] = true;
+            for (auto dependency : expressions_[index].dependencies) {
+                const auto &operand = slots_[static_cast<size_t>(dependency)];
+                assert(operand.used);
+                if (operand.expression) {
+                    self(operand.index, self);
+                }
+            }
+            expression_order_.push_back(index);
+        };
+        for (size_t i = 0; i != expressions_.size(); ++i) {
+            visit(i, visit);
+        }
+    }
+
+    HWCP_NODISCARD const slot *find_slot(hwcpipe_counter counter) const {
+        const auto index = static_cast<size_t>(counter);
+        if (index >= slots_.size() || !slots_[index].used) {
+            return nullptr;
+        }
+        return &slots_[index];
+    }
+
+    /** Adds the hardware counters of the session's last sample to the accumulation. */
+    template <typename sampler_t>
+    HWCP_NODISCARD std::error_code accumulate(const sampler_t &sampler) {
+        auto ec = sampler.get_counter_values(list_, scratch_.data(), scratch_.size());
+        if (ec) {
+            return ec;
+        }
+        for (size_t i = 0; i != scratch_.size(); ++i) {
+            accumulated_[i] += scratch_[i];
+        }
+        pending_timestamp_ = sampler.get_sample_timestamp();
+        ++num_pending_;
+        return {};
+    }
+
+    HWCP_NODISCARD double get_counter_value(hwcpipe_counter counter) const override {
+        const auto *slot = find_slot(counter);
+        assert(slot != nullptr && !slot->expression);
+        return static_cast<double>(values_[slot->index]);
+    }
+
+    HWCP_NODISCARD double get_mali_config_ext_bus_byte_size() const override { return constants_.ext_bus_byte_size; }
+
+    HWCP_NODISCARD double get_mali_config_shader_core_count() const override { return constants_.shader_core_count; }
+
+    HWCP_NODISCARD double get_mali_config_l2_cache_count() const override { return constants_.l2_cache_count; }
+
+    std::vector<slot> slots_{};
+    std::vector<hwcpipe_counter> hardware_{};
+    std::vector<detail::expression::expression_definition> expressions_{};
+    std::vector<size_t> expression_order_{};
+    std::vector<double> expression_inputs_{};
+    detail::expression::device_constants constants_{};
+    read_list list_{};
+
+    std::vector<uint64_t> scratch_{};
+    std::vector<uint64_t> accumulated_{};
+    std::vector<uint64_t> values_{};
+    std::vector<double> expression_values_{};
+    uint64_t pending_timestamp_{};
+    uint64_t timestamp_{};
+    uint64_t pending_user_data_{};
+    uint64_t user_data_{};
+    size_t num_pending_{};
+    bool valid_{};
+    // a coalesced request of a client that already collected the last dump
+    // is served by an empty period
+    bool recollect_{};
+};
+
+/**
+ * @brief A basic_shared_session lets several clients, each with their own
+ * sampler_config, share one backend counter session. The enable maps of all
+ * the clients are merged into a single backend configuration, every sample
+ * is taken and decoded once, and each client accumulates its own counters
+ * from it until it calls session_client::collect(). N clients therefore cost
+ * one counter session and one dump per sample.
+ *
+ * Clients are added before sampling starts. The session owns them, and the
+ * returned pointers stay valid for the lifetime of the session.
+ *
+ * Instrumented code often requests manual samples from several clients
+ * within a few microseconds, e.g. the scopes and the frame tags of one
+ * frame. request_sample() serves the requests that arrive within
+ * shared_session_config::coalesce_window_ns of the last dump with that dump,
+ * so that they cost one kernel dump, and the period that each requester
+ * collects ends at that dump, with its own user data. A requester that
+ * already collected the dump collects an empty period, so the counts of
+ * every client add up to what the GPU counted. The session is not thread
+ * safe, and the requests of several threads are serialized by the caller.
+ *
+ * @par
+ * @code
+ * hwcpipe::shared_session session(gpu);
+ * std::error_code ec;
+ * auto *frame_stats = session.add_client(frame_config, ec);
+ * auto *memory_stats = session.add_client(memory_config, ec);
+ * ec = session.start_sampling();
+ * while (running) {
+ *     ec = session.sample_now();
+ *     if (!frame_stats->collect()) {
+ *         ec = frame_stats->get_counter_value(MaliFragActiveCy, sample);
+ *     }
+ * }
+ * @endcode
+ */
+template <typename backend_policy_t = detail::hwcpipe_backend_policy>
+class basic_shared_session {
+  public:
+    /** The type of the underlying sampler. */
+    using sampler_type = sampler<backend_policy_t>;
+
+    /** Constructs a session for a GPU. */
+    explicit basic_shared_session(const gpu &gpu, const shared_session_config &session_config = {})
+        : basic_shared_session(gpu.get_product_id(), gpu.get_device_number(), session_config) {}
+
+    /** Constructs a session from the provided GPU ID and device number. */
+    basic_shared_session(device::product_id pid, int device_number, const shared_session_config &session_config = {})
+        : config_(pid, device_number)
+        , session_config_(session_config) {}
+
+    /**
+     * @brief Adds a client with its own counter set.
+     *
+     * @param [in]  config  The counters of the client. It must have been
+     *                      created for the session's GPU.
+     * @param [out] ec      Set to hwcpipe::errc::sampling_already_started if
+     *                      the session was started,
+     *                      hwcpipe::errc::invalid_device if @p config is for
+     *                      another GPU, hwcpipe::errc::sampler_config_invalid
+     *                      if it has no counters.
+     * @return The client, or nullptr on error.
+     */
+    HWCP_NODISCARD session_client *add_client(const sampler_config &config, std::error_code &ec) {
+        ec = {};
+        if (sampler_) {
+            ec = make_error_code(errc::sampling_already_started);
+            return nullptr;
+        }
+        if (config.get_product_id() != config_.get_product_id() ||
+            config.get_device_number() != config_.get_device_number()) {
+            ec = make_error_code(errc::invalid_device);
+            return nullptr;
+        }
+        if (config.get_valid_counters().empty()) {
+            ec = make_error_code(errc::sampler_config_invalid);
+            return nullptr;
+        }
+
+        for (const auto &counter : config.get_valid_counters()) {
+            ec = config_.add_counter(counter.counter);
+            if (ec) {
+                return nullptr;
+            }
+        }
+
+        clients_.push_back(std::unique_ptr<session_client>(new session_client(config)));
+        return clients_.back().get();
+    }
+
+    /** @return The number of clients. */
+    HWCP_NODISCARD size_t num_clients() const { return clients_.size(); }
+
+    /**
+     * @brief Creates the shared backend session and starts counter
+     * accumulation.
+     *
+     * @return hwcpipe::errc::sampler_config_invalid if no client was added, the
+     * sampler creation error, or the error of sampler::start_sampling().
+     */
+    HWCP_NODISCARD std::error_code start_sampling() {
+        if (!sampler_) {
+            if (clients_.empty()) {
+                return make_error_code(errc::sampler_config_invalid);
+            }
+            auto ec = create_sampler();
+            if (ec) {
+                return ec;
+            }
+        }
+        return sampler_->start_sampling();
+    }
+
+    /** @copydoc sampler::stop_sampling() */
+    HWCP_NODISCARD std::error_code stop_sampling() {
+        return sampler_ ? sampler_->stop_sampling() : make_error_code(errc::sampling_not_started);
+    }
+
+    /**
+     * @brief Takes one sample for all the clients and adds it to their
+     * accumulated values.
+     *
+     * @return The error of sampler::sample_now(), otherwise an empty
+     * error_code.
+     */
+    HWCP_NODISCARD std::error_code sample_now() { return dump(now_ns()); }
+
+    /**
+     * @brief Requests a sample for a client, tagged with its user data.
+     *
+     * The request is served by the last dump if it was taken less than
+     * shared_session_config::coalesce_window_ns ago, and by a new dump of
+     * sample_now() otherwise. The client then collects the period ending at
+     * that dump, empty if it already collected it, and
+     * session_client::get_sample_user_data() returns @p user_data.
+     *
+     * @param [in] client     A client of the session.
+     * @param [in] user_data  The tag of the sample for this client.
+     * @return The error of sample_now(), otherwise an empty error_code.
+     */
+    HWCP_NODISCARD std::error_code request_sample(session_client *client, uint64_t user_data) {
+        return request_sample(client, user_data, now_ns());
+    }
+
+    /**
+     * @brief Requests a sample for a client at a given time.
+     *
+     * @param [in] client     A client of the session.
+     * @param [in] user_data  The tag of the sample for this client.
+     * @param [in] time_ns    The time of the request, in nanoseconds of
+     *                        std::chrono::steady_clock.
+     * @return The error of sample_now(), otherwise an empty error_code.
+     */
+    HWCP_NODISCARD std::error_code request_sample(session_client *client, uint64_t user_data, uint64_t time_ns) {
+        assert(client != nullptr);
+        if (!sampler_) {
+            return make_error_code(errc::sampling_not_started);
+        }
+        ++stats_.num_requests;
+
+        if (stats_.num_dumps != 0 && time_ns - last_dump_ns_ < session_config_.coalesce_window_ns) {
+            ++stats_.num_coalesced;
+            client->recollect_ = client->num_pending_ == 0;
+        } else {
+            auto ec = dump(time_ns);
+            if (ec) {
+                return ec;
+            }
+        }
+        client->pending_user_data_ = user_data;
+        return {};
+    }
+
+    /** @return The requests and dumps so far. */
+    HWCP_NODISCARD const shared_session_stats &get_stats() const { return stats_; }
+
+    /** @return The shared sampler, or nullptr before sampling was started. */
+    HWCP_NODISCARD const sampler_type *get_sampler() const { return sampler_.get(); }
+
+  private:
+    static uint64_t now_ns() {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                         std::chrono::steady_clock::now().time_since_epoch())
+                                         .count());
+    }
+
+    /** Takes one sample, and adds it to the accumulated values of every client. */
+    HWCP_NODISCARD std::error_code dump(uint64_t time_ns) {
+        if (!sampler_) {
+            return make_error_code(errc::sampling_not_started);
+        }
+        auto ec = sampler_->sample_now();
+        if (ec) {
+            return ec;
+        }
+        ++stats_.num_dumps;
+        last_dump_ns_ = time_ns;
+        for (auto &client : clients_) {
+            client->recollect_ = false;
+            ec = client->accumulate(*sampler_);
+            if (ec) {
+                return ec;
+            }
+        }
+        return {};
+    }
+
+    HWCP_NODISCARD std::error_code create_sampler() {
+        auto sampler = std::make_unique<sampler_type>(config_);
+        if (!*sampler) {
+            // the sampler reports its construction error from start_sampling()
+            return sampler->start_sampling();
+        }
+
+        const auto constants = detail::expression::make_device_constants(sampler->get_constants());
+        for (auto &client : clients_) {
+            std::error_code ec;
+            client->list_ = sampler->make_read_list(client->hardware_.data(), client->hardware_.size(), ec);
+            if (ec) {
+                return ec;
+            }
+            client->constants_ = constants;
+        }
+
+        sampler_ = std::move(sampler);
+        return {};
+    }
+
+    sampler_config config_;
+    shared_session_config session_config_;
+    std::unique_ptr<sampler_type> sampler_{};
+    std::vector<std::unique_ptr<session_client>> clients_{};
+    shared_session_stats stats_{};
+    // the time of the last dump, in nanoseconds of std::chrono::steady_clock
+    uint64_t last_dump_ns_{};
+};
+
+/**
+ * @brief A shared session for the default hwcpipe backend.
+ */
+using shared_session = basic_shared_session<>;
+
+} // namespace hwcpipe
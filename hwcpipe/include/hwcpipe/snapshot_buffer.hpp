@@ -0,0 +1,239 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include "hwcpipe/types.hpp"
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace hwcpipe {
+
+class snapshot_buffer;
+
+/**
+ * @brief A sample_snapshot is a handle to an immutable sample published to a
+ * snapshot_buffer. The values stay valid for as long as any handle to them
+ * exists, even after newer samples are published. Copying a handle only
+ * increments a reference count.
+ *
+ * A snapshot must not outlive the buffer it was taken from.
+ */
+class sample_snapshot {
+  public:
+    /** Default constructor, creates an empty snapshot. */
+    sample_snapshot() = default;
+
+    sample_snapshot(const sample_snapshot &other)
+        : slot_(other.slot_)
+        , size_(other.size_) {
+        retain();
+    }
+
+    sample_snapshot(sample_snapshot &&other) noexcept
+        : slot_(other.slot_)
+        , size_(other.size_) {
+        other.slot_ = nullptr;
+    }
+
+    sample_snapshot &operator=(sample_snapshot other) noexcept {
+        std::swap(slot_, other.slot_);
+        std::swap(size_, other.size_);
+        return *this;
+    }
+
+    ~sample_snapshot() { release(); }
+
+    /** @return True if the snapshot holds a sample. */
+    explicit operator bool() const { return slot_ != nullptr; }
+
+    /** @return The timestamp of the sample. */
+    HWCP_NODISCARD uint64_t timestamp() const { return slot_->timestamp; }
+
+    /**
+     * @return The publication number of the sample. Numbers start at 1 and
+     * increase by one for every sample published to the buffer.
+     */
+    HWCP_NODISCARD uint64_t sequence() const { return slot_->sequence; }
+
+    /** @return The counter values of the sample. */
+    HWCP_NODISCARD const double *values() const { return slot_->values; }
+
+    /** @return The number of counter values in the sample. */
+    HWCP_NODISCARD size_t size() const { return size_; }
+
+  private:
+    friend class snapshot_buffer;
+
+    static constexpr size_t cache_line_size = 64;
+
+    // one buffer of the snapshot_buffer. The reference count is padded to a
+    // cache line so that readers of one slot don't contend with another.
+    struct slot {
+        std::atomic<uint32_t> refs{0};
+        char padding[cache_line_size - sizeof(std::atomic<uint32_t>)];
+        uint64_t timestamp{};
+        uint64_t sequence{};
+        double *values{};
+    };
+
+    // adopts a reference that the caller already holds
+    sample_snapshot(slot *slot, size_t size)
+        : slot_(slot)
+        , size_(size) {}
+
+    void retain() {
+        if (slot_ != nullptr) {
+            slot_->refs.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    void release() {
+        if (slot_ != nullptr) {
+            slot_->refs.fetch_sub(1, std::memory_order_release);
+            slot_ = nullptr;
+        }
+    }
+
+    slot *slot_{};
+    size_t size_{};
+};
+
+/**
+ * @brief A snapshot_buffer publishes decoded samples to any number of reader
+ * threads without locks. One collector thread fills a free buffer, typically
+ * with sampler::get_counter_values() and a read_list, and publishes it as the
+ * latest sample. Readers take a sample_snapshot of the latest sample, which
+ * stays immutable while the collector moves on to other buffers.
+ *
+ * With three buffers one reader can hold a snapshot while the collector keeps
+ * sampling. Every additional snapshot held at the same time needs one more
+ * buffer, otherwise acquire_write() fails until a snapshot is released. All
+ * storage is allocated at construction.
+ *
+ * Exactly one thread may call the producer functions (acquire_write() and
+ * publish()). Any thread may call latest().
+ *
+ * @par
+ * @code
+ * // collector thread
+ * if (double *values = snapshots.acquire_write()) {
+ *     if (!sampler.sample_now() && !sampler.get_counter_values(list, values, snapshots.values_per_sample())) {
+ *         snapshots.publish(sampler.get_sample_timestamp());
+ *     }
+ * }
+ *
+ * // UI thread
+ * if (auto snapshot = snapshots.latest()) {
+ *     draw(snapshot.timestamp(), snapshot.values(), snapshot.size());
+ * }
+ * @endcode
+ */
+class snapshot_buffer {
+  public:
+    /**
+     * @brief Constructs a snapshot buffer.
+     *
+     * @param [in] num_buffers        Number of buffers, at least two.
+     * @param [in] values_per_sample  Number of counter values per sample.
+     */
+    snapshot_buffer(size_t num_buffers, size_t values_per_sample)
+        : values_per_sample_(values_per_sample)
+        , slots_(num_buffers)
+        , values_(num_buffers * values_per_sample) {
+        assert(num_buffers >= 2);
+        for (size_t i = 0; i != num_buffers; ++i) {
+            slots_[i].values = values_.data() + i * values_per_sample;
+        }
+    }
+
+    snapshot_buffer(const snapshot_buffer &) = delete;
+    snapshot_buffer &operator=(const snapshot_buffer &) = delete;
+
+    /** @return The number of buffers. */
+    HWCP_NODISCARD size_t num_buffers() const { return slots_.size(); }
+
+    /** @return The number of counter values held by each sample. */
+    HWCP_NODISCARD size_t values_per_sample() const { return values_per_sample_; }
+
+    /**
+     * @brief Producer: returns the values of a buffer that is neither the
+     * latest sample nor held by a snapshot, or nullptr if there is none. The
+     * buffer becomes the latest sample once publish() is called.
+     */
+    HWCP_NODISCARD double *acquire_write() {
+        const auto latest = latest_.load(std::memory_order_relaxed);
+        for (size_t i = 0; i != slots_.size(); ++i) {
+            // seq_cst pairs with the reader's validation in latest(): a reader
+            // that takes a reference after this check sees a newer latest_
+            if (i != latest && slots_[i].refs.load(std::memory_order_seq_cst) == 0) {
+                writing_ = i;
+                return slots_[i].values;
+            }
+        }
+        writing_ = no_slot;
+        return nullptr;
+    }
+
+    /**
+     * @brief Producer: publishes the buffer returned by the last call to
+     * acquire_write() as the latest sample.
+     *
+     * @param [in] timestamp  The timestamp of the sample.
+     */
+    void publish(uint64_t timestamp) {
+        assert(writing_ != no_slot);
+        auto &slot = slots_[writing_];
+        slot.timestamp = timestamp;
+        slot.sequence = ++sequence_;
+        latest_.store(writing_, std::memory_order_seq_cst);
+        writing_ = no_slot;
+    }
+
+    /**
+     * @brief Consumer: returns a snapshot of the latest published sample, or an
+     * empty snapshot if nothing has been published yet.
+     */
+    HWCP_NODISCARD sample_snapshot latest() const {
+        auto index = latest_.load(std::memory_order_seq_cst);
+        while (index != no_slot) {
+            auto &slot = slots_[index];
+            slot.refs.fetch_add(1, std::memory_order_seq_cst);
+
+            // the slot is only safe to read if it was still the latest sample
+            // once the reference was taken
+            const auto current = latest_.load(std::memory_order_seq_cst);
+            if (current == index) {
+                return sample_snapshot(&slot, values_per_sample_);
+            }
+            slot.refs.fetch_sub(1, std::memory_order_relaxed);
+            index = current;
+        }
+        return {};
+    }
+
+  private:
+    using slot = sample_snapshot::slot;
+
+    static constexpr size_t no_slot = ~size_t{0};
+
+    const size_t values_per_sample_;
+    mutable std::vector<slot> slots_;
+    std::vector<double> values_;
+
+    std::atomic<size_t> latest_{no_slot};
+
+    // producer state
+    size_t writing_{no_slot};
+    uint64_t sequence_{};
+};
+
+} // namespace hwcpipe
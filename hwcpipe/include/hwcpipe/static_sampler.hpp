@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include "hwcpipe/detail/internal_types.hpp"
+#include "hwcpipe/error.hpp"
+#include "hwcpipe/hwcpipe_counter.h"
+#include "hwcpipe/sampler.hpp"
+#include "hwcpipe/types.hpp"
+
+#include <array>
+#include <cstddef>
+#include <system_error>
+
+namespace hwcpipe {
+namespace detail {
+/** Returns the position of @p counter in @p counters, or @p count if absent. */
+constexpr size_t counter_index(const hwcpipe_counter *counters, size_t count, hwcpipe_counter counter) {
+    return count == 0 ? 0 : counters[0] == counter ? 0 : 1 + counter_index(counters + 1, count - 1, counter);
+}
+} // namespace detail
+
+/**
+ * @brief A basic_static_sampler samples a counter set that is fixed at compile
+ * time. The counters are registered and resolved once, when the sampler is
+ * constructed, and every sample is read into a std::array whose layout is
+ * known at compile time, so reading a sample involves no per-counter lookups.
+ *
+ * The expressions are evaluated eagerly, see
+ * sampler_config::expression_evaluation::eager: the sampler resolves their
+ * chains into a flat plan at construction, that runs once per sample, and
+ * the values are then read from the derived value buffer rather than
+ * evaluated through the expression context at each read.
+ *
+ * Counters are resolved against the database of the detected GPU, so the same
+ * counter list works on every product that supports it. The underlying
+ * sampler is available through get_sampler() for anything that needs a
+ * runtime lookup.
+ *
+ * @par
+ * @code
+ * using telemetry = hwcpipe::static_sampler<MaliGPUActiveCy, MaliFragActiveCy>;
+ *
+ * telemetry sampler(hwcpipe::sampler_config(gpu));
+ * telemetry::values_type values{};
+ * if (sampler && !sampler.start_sampling() && !sampler.sample_now() && !sampler.get_values(values)) {
+ *     auto gpu_active = values[telemetry::index_of<MaliGPUActiveCy>()];
+ * }
+ * @endcode
+ */
+template <typename backend_policy_t, hwcpipe_counter... counters>
+class basic_static_sampler {
+  public:
+    /** The type of the underlying runtime sampler. */
+    using sampler_type = sampler<backend_policy_t>;
+
+    /** The type that holds the values of one sample, in counter list order. */
+    using values_type = std::array<double, sizeof...(counters)>;
+
+    static_assert(sizeof...(counters) != 0, "A static sampler needs at least one counter.");
+
+    /** @return The number of counters in the list. */
+    static constexpr size_t size() { return sizeof...(counters); }
+
+    /** @return The position of @p counter in values_type. */
+    template <hwcpipe_counter counter>
+    static constexpr size_t index_of() {
+        static_assert(detail::counter_index(counter_list, size(), counter) != size(),
+                      "The counter is not sampled by this static sampler.");
+        return detail::counter_index(counter_list, size(), counter);
+    }
+
+    /**
+     * Constructs a static sampler. The counters are added to @p config, and
+     * its expressions set to be evaluated eagerly, before the underlying
+     * sampler is created. If any of them is not supported by the GPU, or the
+     * underlying sampler could not be created, the sampler is invalid.
+     *
+     * @param [in] config  Configuration of the GPU to sample.
+     */
+    explicit basic_static_sampler(sampler_config config)
+        : ec_(add_counters(config))
+        , sampler_(config) {
+        if (!ec_ && sampler_) {
+            read_list_ = sampler_.make_read_list(counter_list, size(), ec_);
+        }
+    }
+
+    /** @return True if the sampler is valid. */
+    operator bool() const { return !ec_ && sampler_; }
+
+    /** @copydoc sampler::start_sampling() */
+    HWCP_NODISCARD std::error_code start_sampling() { return ec_ ? ec_ : sampler_.start_sampling(); }
+
+    /** @copydoc sampler::stop_sampling() */
+    HWCP_NODISCARD std::error_code stop_sampling() { return ec_ ? ec_ : sampler_.stop_sampling(); }
+
+    /** @copydoc sampler::sample_now() */
+    HWCP_NODISCARD std::error_code sample_now() { return ec_ ? ec_ : sampler_.sample_now(); }
+
+    /** @copydoc sampler::request_sample_async() */
+    HWCP_NODISCARD std::error_code request_sample_async() { return ec_ ? ec_ : sampler_.request_sample_async(); }
+
+    /** @copydoc sampler::try_collect() */
+    HWCP_NODISCARD std::error_code try_collect() { return ec_ ? ec_ : sampler_.try_collect(); }
+
+    /**
+     * @brief Fetches the last sampled values of every counter, in counter list
+     * order.
+     *
+     * @param [out] values  The values of the sample.
+     * @return Returns hwcpipe::errc::sample_collection_failure if the last
+     * sample is invalid, otherwise an empty error_code.
+     */
+    HWCP_NODISCARD std::error_code get_values(values_type &values) const {
+        return ec_ ? ec_ : sampler_.get_counter_values(read_list_, values.data(), values.size());
+    }
+
+    /** @return The underlying runtime sampler. */
+    HWCP_NODISCARD sampler_type &get_sampler() { return sampler_; }
+
+    /** @return The underlying runtime sampler. */
+    HWCP_NODISCARD const sampler_type &get_sampler() const { return sampler_; }
+
+  private:
+    static constexpr hwcpipe_counter counter_list[] = {counters...};
+
+    static std::error_code add_counters(sampler_config &config) {
+        config.set_expression_evaluation(sampler_config::expression_evaluation::eager);
+        for (auto counter : counter_list) {
+            auto ec = config.add_counter(counter);
+            if (ec) {
+                return ec;
+            }
+        }
+        return {};
+    }
+
+    std::error_code ec_;
+    sampler_type sampler_;
+    read_list read_list_{};
+};
+
+template <typename backend_policy_t, hwcpipe_counter... counters>
+constexpr hwcpipe_counter basic_static_sampler<backend_policy_t, counters...>::counter_list[];
+
+/**
+ * @brief A static sampler for the default hwcpipe backend.
+ */
+template <hwcpipe_counter... counters>
+using static_sampler = basic_static_sampler<detail::hwcpipe_backend_policy, counters...>;
+
+} // namespace hwcpipe
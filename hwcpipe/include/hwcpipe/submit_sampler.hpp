@@ -0,0 +1,258 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include "hwcpipe/detail/spsc_ring.hpp"
+#include "hwcpipe/error.hpp"
+#include "hwcpipe/sampler.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace hwcpipe {
+
+/** The submit of a submit_tag of a sample taken at a present. */
+constexpr uint32_t present_submit = UINT32_MAX;
+
+/**
+ * The frame and submit of a sample of a submit_sampler, packed in its
+ * sampler user_data: the frame in the upper 32 bits and the submit in the
+ * lower ones.
+ */
+struct submit_tag {
+    /** Number of presents before the sample. */
+    uint32_t frame;
+    /** Number of submits before this one, over every queue, or present_submit. */
+    uint32_t submit;
+
+    /** @return The tag as sampler user_data. */
+    HWCP_NODISCARD uint64_t encode() const { return (static_cast<uint64_t>(frame) << 32U) | submit; }
+
+    /** @return The tag of a sampler user_data. */
+    HWCP_NODISCARD static submit_tag decode(uint64_t user_data) {
+        return {static_cast<uint32_t>(user_data >> 32U), static_cast<uint32_t>(user_data)};
+    }
+};
+
+/** The queues and pacing of a submit_sampler. */
+struct submit_sampler_config {
+    /**
+     * Number of submitting threads, e.g. one per Vulkan queue. Each channel
+     * must only be used by one thread at a time.
+     */
+    size_t num_channels{1};
+    /** Number of submits each channel queues for the collector, rounded up to a power of two. */
+    size_t queue_depth{64};
+    /** Time the collector sleeps between checks for submits, in nanoseconds. */
+    uint64_t poll_interval_ns{100000};
+};
+
+/** The submits and samples of a submit_sampler. */
+struct submit_sampler_stats {
+    /** Submits queued. */
+    uint64_t submits;
+    /** Presents queued. */
+    uint64_t presents;
+    /** Submits and presents dropped as their channel was full. */
+    uint64_t dropped;
+    /** Samples collected. */
+    uint64_t samples;
+};
+
+/**
+ * @brief Samples the counters of a manual sampler at each submit and present
+ * of a graphics API, e.g. from a Vulkan layer, without ever blocking the
+ * submitting threads.
+ *
+ * on_submit() and on_present() only push a submit_tag into a lock-free
+ * single-producer ring of their channel, and never take a lock or make a
+ * syscall: a tag that doesn't fit is dropped and counted. The sampler is
+ * only used by a collector, which calls collect_for() on its own thread. It
+ * requests a sample tagged with the next queued tag, see
+ * sampler::request_sample_async(), and collects it, so that each sample
+ * holds the counters since the previous submit or present and
+ * sampler::get_sample_user_data() says which one. A trace_recorder set on
+ * the sampler records every collected sample.
+ *
+ * Samples are requested one at a time, so the collector falls behind when
+ * submits come faster than the sample latency, and the channels then drop
+ * the newest tags.
+ *
+ * @par
+ * @code
+ * hwcpipe::submit_sampler<> submits(sampler, sampler_config);
+ * std::thread collector([&] {
+ *     while (running) {
+ *         if (!submits.collect_for(10000000)) {
+ *             const auto tag = hwcpipe::submit_tag::decode(sampler.get_sample_user_data());
+ *             // ... read the counters of tag.frame, tag.submit ...
+ *         }
+ *     }
+ * });
+ * // on the submitting thread of queue 0
+ * submits.on_submit(0);
+ * @endcode
+ *
+ * @tparam sampler_t  The sampler type.
+ */
+template <typename sampler_t = sampler<>>
+class submit_sampler {
+  public:
+    /**
+     * @brief Constructs a submit sampler.
+     *
+     * @param [in] sampler  A manual sampler, whose sampling is started by
+     *                      the caller.
+     * @param [in] config   The queues and pacing.
+     */
+    submit_sampler(sampler_t &sampler, const submit_sampler_config &config)
+        : sampler_(sampler)
+        , poll_interval_(static_cast<std::chrono::nanoseconds::rep>(std::max<uint64_t>(config.poll_interval_ns, 1))) {
+        size_t depth = 1;
+        while (depth < config.queue_depth) {
+            depth *= 2;
+        }
+        for (size_t i = 0; i != std::max<size_t>(config.num_channels, 1); ++i) {
+            channels_.emplace_back(new detail::spsc_ring<uint64_t>(depth, 0));
+        }
+    }
+
+    submit_sampler(const submit_sampler &) = delete;
+    submit_sampler &operator=(const submit_sampler &) = delete;
+
+    /** @return The number of channels. */
+    HWCP_NODISCARD size_t num_channels() const { return channels_.size(); }
+
+    /**
+     * @brief Producer: queues a sample for a submit, tagged with the current
+     * frame and the number of submits before it.
+     *
+     * @param [in] channel  The channel of the submitting thread.
+     * @return False if the channel was full and the submit dropped.
+     */
+    bool on_submit(size_t channel) {
+        submits_.fetch_add(1, std::memory_order_relaxed);
+        const auto submit = static_cast<uint32_t>(next_submit_.fetch_add(1, std::memory_order_relaxed));
+        return enqueue(channel, {frame_.load(std::memory_order_relaxed), submit});
+    }
+
+    /**
+     * @brief Producer: queues a sample for a present, tagged with the frame
+     * it ends and present_submit, and starts the next frame.
+     *
+     * @param [in] channel  The channel of the presenting thread.
+     * @return False if the channel was full and the present dropped.
+     */
+    bool on_present(size_t channel) {
+        presents_.fetch_add(1, std::memory_order_relaxed);
+        const auto frame = frame_.fetch_add(1, std::memory_order_relaxed);
+        return enqueue(channel, {frame, present_submit});
+    }
+
+    /**
+     * @brief Collector: requests the sample of the next queued submit or
+     * present, waiting for one for at most @p timeout_ns, and collects it.
+     * On success the sample can be read from the sampler, and its
+     * user_data is the submit_tag.
+     *
+     * @param [in] timeout_ns  Time to wait in nanoseconds.
+     * @return hwcpipe::errc::sample_not_ready if nothing was queued or the
+     * sample wasn't taken in time, in which case it is collected by the next
+     * call. Otherwise the error of the sampler.
+     */
+    HWCP_NODISCARD std::error_code collect_for(uint64_t timeout_ns) {
+        const auto deadline = std::chrono::steady_clock::now() +
+                              std::chrono::nanoseconds(static_cast<std::chrono::nanoseconds::rep>(timeout_ns));
+        if (!pending_) {
+            uint64_t tag{};
+            while (!dequeue(tag)) {
+                const auto now = std::chrono::steady_clock::now();
+                if (now >= deadline) {
+                    return make_error_code(errc::sample_not_ready);
+                }
+                std::this_thread::sleep_for(std::min<std::chrono::nanoseconds>(poll_interval_, deadline - now));
+            }
+
+            auto ec = sampler_.request_sample_async(tag);
+            if (ec) {
+                return ec;
+            }
+            pending_ = true;
+        }
+
+        const auto remaining =
+            std::max<std::chrono::nanoseconds>(deadline - std::chrono::steady_clock::now(), std::chrono::nanoseconds{});
+        auto ec = sampler_.collect_for(static_cast<uint64_t>(remaining.count()));
+        if (ec == make_error_code(errc::sample_not_ready)) {
+            return ec;
+        }
+        pending_ = false;
+        if (!ec) {
+            samples_.fetch_add(1, std::memory_order_relaxed);
+        }
+        return ec;
+    }
+
+    /** @return The submits and samples so far. */
+    HWCP_NODISCARD submit_sampler_stats get_stats() const {
+        return {submits_.load(std::memory_order_relaxed), presents_.load(std::memory_order_relaxed),
+                dropped_.load(std::memory_order_relaxed), samples_.load(std::memory_order_relaxed)};
+    }
+
+  private:
+    bool enqueue(size_t channel, submit_tag tag) {
+        auto &ring = *channels_[channel];
+        uint64_t *slot = ring.acquire_write();
+        if (slot == nullptr) {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        *slot = tag.encode();
+        // the collector never waits on the ring, so this takes no lock
+        ring.publish();
+        return true;
+    }
+
+    /** Takes the next tag, visiting the channels round-robin. */
+    bool dequeue(uint64_t &tag) {
+        for (size_t i = 0; i != channels_.size(); ++i) {
+            auto &ring = *channels_[next_channel_];
+            next_channel_ = (next_channel_ + 1) % channels_.size();
+            if (const uint64_t *slot = ring.acquire_read()) {
+                tag = *slot;
+                ring.release();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    sampler_t &sampler_;
+    const std::chrono::nanoseconds poll_interval_;
+    std::vector<std::unique_ptr<detail::spsc_ring<uint64_t>>> channels_{};
+
+    // updated by the producers
+    std::atomic<uint32_t> frame_{0};
+    std::atomic<uint64_t> next_submit_{0};
+    std::atomic<uint64_t> submits_{0};
+    std::atomic<uint64_t> presents_{0};
+    std::atomic<uint64_t> dropped_{0};
+
+    // owned by the collector
+    std::atomic<uint64_t> samples_{0};
+    size_t next_channel_{};
+    bool pending_{};
+};
+
+} // namespace hwcpipe
@@ -0,0 +1,291 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include "hwcpipe/types.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <system_error>
+#include <vector>
+
+namespace hwcpipe {
+
+/** How a tag_aggregator combines the values of the samples of a tag. */
+enum class tag_aggregation {
+    /** The sum of the values, for the hardware counters. */
+    sum,
+    /** The average of the values weighted by the sample durations, for the derived counters. */
+    average,
+};
+
+/** The samples of a tag, see tag_aggregator::get_summary(). */
+struct tag_summary {
+    /** The tag. */
+    uint64_t tag;
+    /** Number of samples of the tag. */
+    uint64_t num_samples;
+    /** Start of the first sample of the tag, in nanoseconds. */
+    uint64_t timestamp_ns_begin;
+    /** End of the last sample of the tag, in nanoseconds. */
+    uint64_t timestamp_ns_end;
+    /** Sum of the sample durations, in nanoseconds. */
+    uint64_t duration_ns;
+};
+
+/** Counts of tag_aggregator::get_stats(). */
+struct tag_aggregator_stats {
+    /** Samples added. */
+    uint64_t samples;
+    /** Tags evicted by newer tags, or by flush(). */
+    uint64_t evictions;
+    /** Samples dropped because their tag was older than the tag in its slot. */
+    uint64_t late_samples;
+};
+
+/**
+ * @brief A tag_aggregator sums the samples of each tag, e.g. the
+ * user_data frame number or render pass ID of sampler::sample_now(), into
+ * per-tag tables.
+ *
+ * The tables hold the last capacity() tags, in a ring of slots: the slot of
+ * a tag is the tag modulo the capacity, so consecutive frame numbers use
+ * consecutive slots and a sample is added without a lookup. A sample of a
+ * newer tag evicts the tag in its slot, and a sample of an older one is
+ * dropped. The values are stored as structure of arrays, one array of
+ * capacity() aggregates per value, next to the arrays of the sample counts
+ * and times of each slot.
+ *
+ * The eviction handler is called before a tag is evicted, and can read its
+ * summary, e.g. to log each frame once it is complete. All storage is
+ * allocated at construction, and an update is O(1) in the number of tags. A
+ * tag_aggregator is not thread-safe.
+ *
+ * @par
+ * @code
+ * // MaliGPUActiveCy and MaliFragUtil, for the last 8 frames
+ * hwcpipe::tag_aggregator frames(2, 8);
+ * frames.set_aggregation(1, hwcpipe::tag_aggregation::average);
+ *
+ * ec = sampler.sample_now(frame_number);
+ * ec = frames.update(sampler, list);
+ *
+ * hwcpipe::tag_summary summary{};
+ * double values[2];
+ * if (frames.get_summary(frame_number - 1, summary, values, 2)) {
+ *     draw_hud(summary, values);
+ * }
+ * @endcode
+ */
+class tag_aggregator {
+  public:
+    /**
+     * @brief Called before a tag is evicted, while its summary can be read.
+     *
+     * @param [in] user_data   The user data of set_eviction_handler().
+     * @param [in] aggregator  The aggregator.
+     * @param [in] tag         The evicted tag.
+     */
+    using eviction_handler = void (*)(void *user_data, const tag_aggregator &aggregator, uint64_t tag);
+
+    /**
+     * @brief Constructs an aggregator. All the values are summed.
+     *
+     * @param [in] num_values  Number of values of each sample.
+     * @param [in] capacity    Number of tags kept, at least one.
+     */
+    tag_aggregator(size_t num_values, size_t capacity)
+        : capacity_(std::max<size_t>(capacity, 1))
+        , aggregations_(num_values, tag_aggregation::sum)
+        , tags_(capacity_)
+        , num_samples_(capacity_)
+        , begins_ns_(capacity_)
+        , ends_ns_(capacity_)
+        , durations_ns_(capacity_)
+        , values_(num_values * capacity_)
+        , staging_(num_values) {}
+
+    /** @return The number of values of each sample. */
+    HWCP_NODISCARD size_t size() const { return aggregations_.size(); }
+
+    /** @return The number of tags kept. */
+    HWCP_NODISCARD size_t capacity() const { return capacity_; }
+
+    /** @return The counts of the samples and of the evicted tags. */
+    HWCP_NODISCARD const tag_aggregator_stats &get_stats() const { return stats_; }
+
+    /**
+     * @brief Sets how the samples of a tag are combined for a value, before
+     * the first sample is added.
+     *
+     * @param [in] index        Index of the value in the read list.
+     * @param [in] aggregation  The combination.
+     */
+    void set_aggregation(size_t index, tag_aggregation aggregation) { aggregations_[index] = aggregation; }
+
+    /** @return How the value at @p index is combined. */
+    HWCP_NODISCARD tag_aggregation aggregation(size_t index) const { return aggregations_[index]; }
+
+    /**
+     * @brief Sets the function called before a tag is evicted.
+     *
+     * @param [in] handler    The function, or nullptr for none.
+     * @param [in] user_data  Passed to the function.
+     */
+    void set_eviction_handler(eviction_handler handler, void *user_data) {
+        handler_ = handler;
+        handler_data_ = user_data;
+    }
+
+    /**
+     * @brief Adds a sample to the aggregates of its tag.
+     *
+     * @param [in] tag                 The tag of the sample.
+     * @param [in] timestamp_ns_begin  Start of the counter accumulation.
+     * @param [in] timestamp_ns_end    End of the counter accumulation.
+     * @param [in] values              size() values of the sample.
+     */
+    void update(uint64_t tag, uint64_t timestamp_ns_begin, uint64_t timestamp_ns_end, const double *values) {
+        const size_t slot = static_cast<size_t>(tag % capacity_);
+        if (num_samples_[slot] != 0 && tags_[slot] != tag) {
+            if (tags_[slot] > tag) {
+                ++stats_.late_samples;
+                return;
+            }
+            evict(slot);
+        }
+
+        const uint64_t duration_ns = timestamp_ns_end - timestamp_ns_begin;
+        if (num_samples_[slot] == 0) {
+            tags_[slot] = tag;
+            begins_ns_[slot] = timestamp_ns_begin;
+        }
+        ++num_samples_[slot];
+        ends_ns_[slot] = timestamp_ns_end;
+        durations_ns_[slot] += duration_ns;
+
+        const auto duration = static_cast<double>(duration_ns);
+        double *column = values_.data() + slot;
+        for (size_t i = 0; i != aggregations_.size(); ++i, column += capacity_) {
+            *column += aggregations_[i] == tag_aggregation::sum ? values[i] : values[i] * duration;
+        }
+        ++stats_.samples;
+    }
+
+    /**
+     * @brief Adds the last sample of a sampler, with its user_data tag.
+     *
+     * @param [in] sampler  The sampler, after a successful sample.
+     * @param [in] list     A read list of the sampler with size() values.
+     * @return The error of sampler::get_counter_values().
+     */
+    template <typename sampler_t, typename read_list_t>
+    HWCP_NODISCARD std::error_code update(const sampler_t &sampler, const read_list_t &list) {
+        auto ec = sampler.get_counter_values(list, staging_.data(), staging_.size());
+        if (ec) {
+            return ec;
+        }
+        const auto interval = sampler.get_sample_interval();
+        update(sampler.get_sample_user_data(), interval.timestamp_ns_begin, interval.timestamp_ns_end,
+               staging_.data());
+        return {};
+    }
+
+    /** @return True if the tables hold samples of @p tag. */
+    HWCP_NODISCARD bool contains(uint64_t tag) const {
+        const size_t slot = static_cast<size_t>(tag % capacity_);
+        return num_samples_[slot] != 0 && tags_[slot] == tag;
+    }
+
+    /**
+     * @brief Reads the aggregates of a tag: the sums, and the averages
+     * weighted by the sample durations. The averages of a tag of zero
+     * duration are zero.
+     *
+     * @param [in]  tag      The tag.
+     * @param [out] summary  The samples of the tag.
+     * @param [out] values   The aggregates, in read list order.
+     * @param [in]  count    Number of elements in @p values, the first ones
+     *                       are written.
+     * @return False if the tables don't hold the tag.
+     */
+    HWCP_NODISCARD bool get_summary(uint64_t tag, tag_summary &summary, double *values, size_t count) const {
+        if (!contains(tag)) {
+            return false;
+        }
+        const size_t slot = static_cast<size_t>(tag % capacity_);
+        summary = tag_summary{tag, num_samples_[slot], begins_ns_[slot], ends_ns_[slot], durations_ns_[slot]};
+
+        const auto duration = static_cast<double>(durations_ns_[slot]);
+        const double *column = values_.data() + slot;
+        count = std::min(count, aggregations_.size());
+        for (size_t i = 0; i != count; ++i, column += capacity_) {
+            if (aggregations_[i] == tag_aggregation::sum) {
+                values[i] = *column;
+            } else {
+                values[i] = duration != 0 ? *column / duration : 0.0;
+            }
+        }
+        return true;
+    }
+
+    /** @brief Evicts every tag, oldest first, e.g. at the end of a capture. */
+    void flush() {
+        for (;;) {
+            size_t oldest = capacity_;
+            for (size_t slot = 0; slot != capacity_; ++slot) {
+                if (num_samples_[slot] != 0 && (oldest == capacity_ || tags_[slot] < tags_[oldest])) {
+                    oldest = slot;
+                }
+            }
+            if (oldest == capacity_) {
+                return;
+            }
+            evict(oldest);
+        }
+    }
+
+    /** @brief Forgets every tag, without calling the eviction handler. */
+    void reset() {
+        std::fill(num_samples_.begin(), num_samples_.end(), 0);
+        std::fill(durations_ns_.begin(), durations_ns_.end(), 0);
+        std::fill(values_.begin(), values_.end(), 0.0);
+    }
+
+  private:
+    /** Hands the tag of @p slot to the eviction handler, and empties the slot. */
+    void evict(size_t slot) {
+        if (handler_ != nullptr) {
+            handler_(handler_data_, *this, tags_[slot]);
+        }
+        num_samples_[slot] = 0;
+        durations_ns_[slot] = 0;
+        double *column = values_.data() + slot;
+        for (size_t i = 0; i != aggregations_.size(); ++i, column += capacity_) {
+            *column = 0.0;
+        }
+        ++stats_.evictions;
+    }
+
+    const size_t capacity_;
+    std::vector<tag_aggregation> aggregations_;
+    // the samples of each slot
+    std::vector<uint64_t> tags_;
+    std::vector<uint64_t> num_samples_;
+    std::vector<uint64_t> begins_ns_;
+    std::vector<uint64_t> ends_ns_;
+    std::vector<uint64_t> durations_ns_;
+    // capacity_ aggregates of the first value, then of the second one, ...
+    std::vector<double> values_;
+    std::vector<double> staging_;
+    eviction_handler handler_{};
+    void *handler_data_{};
+    tag_aggregator_stats stats_{};
+};
+
+} // namespace hwcpipe
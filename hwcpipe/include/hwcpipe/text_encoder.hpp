@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include "hwcpipe/detail/heap_bytes.hpp"
+#include "hwcpipe/error.hpp"
+#include "hwcpipe/hwcpipe_counter.h"
+#include "hwcpipe/types.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <system_error>
+#include <vector>
+
+namespace hwcpipe {
+
+/** The text formats of a text_encoder. */
+enum class text_format {
+    /** Comma separated values, with a header line. */
+    csv,
+    /** One JSON object per line, keyed by the counter names. */
+    json_lines,
+};
+
+/** The lines written by a text_encoder. */
+struct text_encoder_config {
+    /** The format of the lines. */
+    text_format format{text_format::csv};
+    /**
+     * Indices of the values that are written, or nullptr to write every
+     * value. The array is copied.
+     */
+    const size_t *columns{};
+    /** Number of indices in columns. */
+    size_t num_columns{};
+    /** Writes the timestamp of the sample, in nanoseconds, before the values. */
+    bool timestamp{true};
+    /**
+     * Number of digits after the point of the values that aren't integers,
+     * or a negative number for the shortest text that parses back to the
+     * same double.
+     */
+    int decimals{-1};
+};
+
+/**
+ * @brief A text_encoder formats counter samples as CSV or JSON lines, into a
+ * buffer that is reused from one batch of lines to the next.
+ *
+ * The header line and the key of each value, e.g. `,"MaliGPUActiveCy":`,
+ * are formatted once at construction from the counter metadata. Encoding a
+ * sample then only copies the keys and formats the values behind them:
+ * integers two digits at a time, and other values with the fewest digits
+ * that round trip, or with a fixed number of decimals in integer
+ * arithmetic. Values that aren't finite are left empty in CSV, and are null
+ * in JSON.
+ *
+ * @par
+ * @code
+ * hwcpipe::text_encoder encoder(counters, num_counters, {});
+ * write(fd, encoder.header().data(), encoder.header().size());
+ * while (running) {
+ *     if (!sampler.sample_now()) {
+ *         ec = encoder.encode_sample(sampler, list);
+ *     }
+ *     if (encoder.size() > 64 * 1024) {
+ *         write(fd, encoder.data(), encoder.size());
+ *         encoder.clear();
+ *     }
+ * }
+ * @endcode
+ */
+class text_encoder {
+  public:
+    /**
+     * @brief Constructs an encoder. Counters without metadata are named by
+     * their number.
+     *
+     * @param [in] counters      The counters of the values of each sample.
+     * @param [in] num_counters  Number of values of each sample.
+     * @param [in] config        The lines written.
+     */
+    text_encoder(const hwcpipe_counter *counters, size_t num_counters, const text_encoder_config &config);
+
+    /** @return The number of values of each sample. */
+    HWCP_NODISCARD size_t values_per_sample() const { return staging_.size(); }
+
+    /** @return The number of counters written per sample. */
+    HWCP_NODISCARD size_t num_columns() const { return columns_.size(); }
+
+    /** @return The CSV header line, with its line feed, or an empty string for JSON lines. */
+    HWCP_NODISCARD const std::string &header() const { return header_; }
+
+    /** @return The lines encoded since the last clear(). */
+    HWCP_NODISCARD const char *data() const { return buffer_.data(); }
+
+    /** @return The size of the lines encoded since the last clear(), in bytes. */
+    HWCP_NODISCARD size_t size() const { return size_; }
+
+    /** @brief Empties the buffer, and keeps its memory for the next lines. */
+    void clear() { size_ = 0; }
+
+    /** @return The memory held by the encoder in bytes, including the keys and the buffer. */
+    HWCP_NODISCARD size_t get_memory_footprint() const {
+        return sizeof(*this) + header_.capacity() + detail::heap_bytes(columns_) + detail::heap_bytes(keys_) +
+               detail::heap_bytes(key_offsets_) + detail::heap_bytes(buffer_) + detail::heap_bytes(staging_);
+    }
+
+    /**
+     * @brief Appends the line of a sample to the buffer.
+     *
+     * @param [in] timestamp_ns  The timestamp of the sample.
+     * @param [in] values        values_per_sample() counter values.
+     */
+    template <typename value_t>
+    void encode(uint64_t timestamp_ns, const value_t *values) {
+        char *out = begin_line(timestamp_ns);
+        for (size_t i = 0; i != columns_.size(); ++i) {
+            out = append_key(i, out);
+            out = append_value(values[columns_[i]], out);
+        }
+        end_line(out);
+    }
+
+    /**
+     * @brief Appends the line of the last sample of a sampler, with the
+     * start of the sample as its timestamp.
+     *
+     * @param [in] sampler  The sampler, after a successful sample.
+     * @param [in] list     A read list of the sampler with
+     *                      values_per_sample() counters.
+     * @return The error of sampler::get_counter_values().
+     */
+    template <typename sampler_t, typename read_list_t>
+    HWCP_NODISCARD std::error_code encode_sample(const sampler_t &sampler, const read_list_t &list) {
+        auto ec = sampler.get_counter_values(list, staging_.data(), staging_.size());
+        if (ec) {
+            return ec;
+        }
+        encode(sampler.get_sample_interval().timestamp_ns_begin, staging_.data());
+        return {};
+    }
+
+  private:
+    /** Makes room for a line with the longest values, writes its start and returns the end. */
+    char *begin_line(uint64_t timestamp_ns);
+
+    /** Writes the separator and key of the value of a column. */
+    char *append_key(size_t column, char *out) const {
+        const size_t begin = key_offsets_[column];
+        const size_t end = key_offsets_[column + 1];
+        for (size_t i = begin; i != end; ++i) {
+            *out++ = keys_[i];
+        }
+        return out;
+    }
+
+    /** Writes a value. */
+    char *append_value(uint64_t value, char *out) const;
+    char *append_value(double value, char *out) const;
+
+    /** Writes the end of the line, and adds it to the buffer. */
+    void end_line(char *out);
+
+    const text_format format_;
+    const bool timestamp_;
+    const int decimals_;
+    std::string header_{};
+    // the index of the value of each written counter
+    std::vector<size_t> columns_{};
+    // the separator and key in front of each written value, back to back
+    std::vector<char> keys_{};
+    std::vector<size_t> key_offsets_{};
+    // the longest line, with the longest values
+    size_t max_line_size_{};
+    // the lines, of which size_ bytes are used
+    std::vector<char> buffer_{};
+    size_t size_{};
+    std::vector<double> staging_;
+};
+
+} // namespace hwcpipe
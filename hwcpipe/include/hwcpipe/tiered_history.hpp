@@ -0,0 +1,288 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include "hwcpipe/sample_history.hpp"
+#include "hwcpipe/types.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <system_error>
+#include <vector>
+
+namespace hwcpipe {
+
+/** A downsampled tier of a tiered_history. */
+struct history_tier {
+    /** Length of the buckets of the tier, in nanoseconds. */
+    uint64_t resolution_ns;
+    /** Number of buckets kept, at least one. */
+    size_t capacity;
+};
+
+/**
+ * @brief A tiered_history keeps the last samples of a set of hardware
+ * counters at full resolution, and a longer history downsampled into buckets
+ * of increasing length, e.g. the last few seconds of samples, then the last
+ * minutes in 10 ms and 100 ms buckets and the last hours in 1 s buckets.
+ *
+ * Each tier is a sample_history of fixed capacity, so the memory is bounded
+ * however long the history runs. A sample is added to the full resolution
+ * tier and to the open bucket of the first downsampled tier, the bucket of
+ * its start time. When a sample starts in a later bucket, the open bucket is
+ * closed: it is pushed to its tier and added to the open bucket of the next
+ * tier. The buckets are sums of the 64-bit deltas, so every tier has the
+ * exact totals of the samples it spans. Tiers whose resolutions are multiples
+ * of each other have nested buckets.
+ *
+ * A window query is answered by the finest tier that reaches back to the
+ * start of the window, which sums the samples or buckets that lie within the
+ * window. The time after the last closed bucket of that tier is then summed
+ * from the finer tiers, down to the full resolution one. A tiered_history is
+ * not thread-safe.
+ *
+ * @par
+ * @code
+ * // 4 s of samples at 1 ms, then 1 min at 10 ms, 10 min at 100 ms and 4 h at 1 s
+ * const hwcpipe::history_tier tiers[] = {{10000000, 6000}, {100000000, 6000}, {1000000000, 14400}};
+ * hwcpipe::tiered_history history(num_counters, 4000, tiers, 3);
+ *
+ * // after each sample
+ * ec = history.push(sampler, list);
+ *
+ * // the totals of the last hour, from the 1 s tier and the finer ones
+ * const auto window = history.last_sums(3600000000000, sums.data());
+ * @endcode
+ */
+class tiered_history {
+  public:
+    /**
+     * @brief Constructs a history.
+     *
+     * @param [in] values_per_sample  Number of counter values per sample.
+     * @param [in] capacity           Number of full resolution samples kept,
+     *                                at least one.
+     * @param [in] tiers              The downsampled tiers, from the finest
+     *                                to the coarsest. Resolutions of zero are
+     *                                ignored.
+     * @param [in] num_tiers          Number of elements in @p tiers.
+     * @param [in] storage            How the samples and buckets are stored.
+     */
+    tiered_history(size_t values_per_sample, size_t capacity, const history_tier *tiers, size_t num_tiers,
+                   history_storage storage = history_storage::wide)
+        : values_per_sample_(values_per_sample)
+        , staging_(values_per_sample)
+        , window_sums_(values_per_sample) {
+        tiers_.reserve(num_tiers + 1);
+        tiers_.emplace_back(capacity, values_per_sample, storage);
+        resolutions_ns_.push_back(0);
+        for (size_t i = 0; i != num_tiers; ++i) {
+            if (tiers[i].resolution_ns != 0) {
+                tiers_.emplace_back(tiers[i].capacity, values_per_sample, storage);
+                resolutions_ns_.push_back(tiers[i].resolution_ns);
+            }
+        }
+        open_.resize(tiers_.size());
+        open_sums_.resize(tiers_.size() * values_per_sample);
+    }
+
+    /** @return The number of counter values of each sample. */
+    HWCP_NODISCARD size_t values_per_sample() const { return values_per_sample_; }
+
+    /** @return The number of tiers, including the full resolution one. */
+    HWCP_NODISCARD size_t num_tiers() const { return tiers_.size(); }
+
+    /** @return A tier, zero for the full resolution samples. */
+    HWCP_NODISCARD const sample_history &tier(size_t index) const { return tiers_[index]; }
+
+    /** @return The bucket length of a tier in nanoseconds, zero for the full resolution one. */
+    HWCP_NODISCARD uint64_t resolution_ns(size_t index) const { return resolutions_ns_[index]; }
+
+    /** @return The memory held by the history in bytes, which doesn't grow with its length. */
+    HWCP_NODISCARD size_t get_memory_footprint() const {
+        size_t size = sizeof(*this) + detail::heap_bytes(resolutions_ns_) + detail::heap_bytes(open_) +
+                      detail::heap_bytes(open_sums_) + detail::heap_bytes(staging_) + detail::heap_bytes(window_sums_) +
+                      (tiers_.capacity() - tiers_.size()) * sizeof(sample_history);
+        for (const auto &tier : tiers_) {
+            size += tier.get_memory_footprint();
+        }
+        return size;
+    }
+
+    /** @return The start of the oldest sample or bucket, or zero if the history is empty. */
+    HWCP_NODISCARD uint64_t oldest_timestamp() const {
+        uint64_t oldest = 0;
+        for (const auto &tier : tiers_) {
+            if (tier.size() != 0 && (oldest == 0 || tier.oldest_timestamp() < oldest)) {
+                oldest = tier.oldest_timestamp();
+            }
+        }
+        return oldest;
+    }
+
+    /** @return The end of the newest sample, or zero if the history is empty. */
+    HWCP_NODISCARD uint64_t newest_timestamp() const { return tiers_[0].newest_timestamp(); }
+
+    /**
+     * @brief Adds a sample, and rolls the buckets that it closes up into the
+     * downsampled tiers.
+     *
+     * @param [in] timestamp_ns_begin  Start of the counter accumulation.
+     * @param [in] timestamp_ns_end    End of the counter accumulation.
+     * @param [in] values              values_per_sample() counter values.
+     */
+    void push(uint64_t timestamp_ns_begin, uint64_t timestamp_ns_end, const uint64_t *values) {
+        tiers_[0].push(timestamp_ns_begin, timestamp_ns_end, values);
+        if (tiers_.size() > 1) {
+            add_to_bucket(1, timestamp_ns_begin, timestamp_ns_end, values);
+        }
+    }
+
+    /**
+     * @brief Adds the last sample of a sampler.
+     *
+     * @param [in] sampler  The sampler, after a successful sample.
+     * @param [in] list     A read list of the sampler with
+     *                      values_per_sample() hardware counters.
+     * @return The error of sampler::get_counter_values().
+     */
+    template <typename sampler_t, typename read_list_t>
+    HWCP_NODISCARD std::error_code push(const sampler_t &sampler, const read_list_t &list) {
+        auto ec = sampler.get_counter_values(list, staging_.data(), staging_.size());
+        if (ec) {
+            return ec;
+        }
+        push(sampler.get_sample_timestamp(), sampler.get_sample_timestamp_end(), staging_.data());
+        return {};
+    }
+
+    /**
+     * @brief Sums every counter over the samples and buckets that lie within a
+     * window, from the finest tier that reaches back to @p begin_ns.
+     *
+     * @param [in]  begin_ns  Start of the window, in nanoseconds.
+     * @param [in]  end_ns    End of the window, in nanoseconds.
+     * @param [out] sums      values_per_sample() sums, set to zero if nothing
+     *                        lies within the window.
+     * @return The number of samples and buckets that were summed, and their
+     * times.
+     */
+    HWCP_NODISCARD history_window window_sums(uint64_t begin_ns, uint64_t end_ns, uint64_t *sums) const {
+        // the finest tier that reaches back to the start, else the one that
+        // reaches back the furthest
+        size_t first = tiers_.size();
+        for (size_t i = 0; i != tiers_.size(); ++i) {
+            if (tiers_[i].size() != 0 &&
+                (first == tiers_.size() || tiers_[i].oldest_timestamp() < tiers_[first].oldest_timestamp())) {
+                first = i;
+            }
+            if (tiers_[i].size() != 0 && tiers_[i].oldest_timestamp() <= begin_ns) {
+                first = i;
+                break;
+            }
+        }
+        if (first == tiers_.size()) {
+            std::fill(sums, sums + values_per_sample_, 0);
+            return {0, 0, 0};
+        }
+
+        auto window = tiers_[first].window_sums(begin_ns, end_ns, sums);
+        uint64_t covered_ns = tiers_[first].newest_timestamp();
+        for (size_t i = first; i-- != 0;) {
+            if (covered_ns >= end_ns || tiers_[i].newest_timestamp() <= covered_ns) {
+                continue;
+            }
+            const auto rest = tiers_[i].window_sums(std::max(begin_ns, covered_ns), end_ns, window_sums_.data());
+            covered_ns = tiers_[i].newest_timestamp();
+            if (rest.num_samples == 0) {
+                continue;
+            }
+            for (size_t j = 0; j != values_per_sample_; ++j) {
+                sums[j] += window_sums_[j];
+            }
+            if (window.num_samples == 0) {
+                window.timestamp_ns_begin = rest.timestamp_ns_begin;
+            }
+            window.num_samples += rest.num_samples;
+            window.timestamp_ns_end = rest.timestamp_ns_end;
+        }
+        return window;
+    }
+
+    /**
+     * @brief Sums every counter over the last @p duration_ns nanoseconds of
+     * the history.
+     *
+     * @param [in]  duration_ns  Length of the window, in nanoseconds.
+     * @param [out] sums         values_per_sample() sums.
+     * @return The samples and buckets that were summed.
+     */
+    HWCP_NODISCARD history_window last_sums(uint64_t duration_ns, uint64_t *sums) const {
+        const uint64_t end = newest_timestamp();
+        return window_sums(end > duration_ns ? end - duration_ns : 0, end, sums);
+    }
+
+    /** @brief Removes every sample and bucket. */
+    void clear() {
+        for (auto &tier : tiers_) {
+            tier.clear();
+        }
+        std::fill(open_.begin(), open_.end(), bucket{});
+        std::fill(open_sums_.begin(), open_sums_.end(), 0);
+    }
+
+  private:
+    // the bucket of a tier that samples are added to
+    struct bucket {
+        uint64_t index;
+        uint64_t timestamp_ns_begin;
+        uint64_t timestamp_ns_end;
+        bool used;
+    };
+
+    /**
+     * Adds a sample, or a closed bucket of the previous tier, to the open
+     * bucket of @p tier, first closing the open bucket if it is an earlier
+     * one.
+     */
+    void add_to_bucket(size_t tier, uint64_t timestamp_ns_begin, uint64_t timestamp_ns_end, const uint64_t *values) {
+        auto &open = open_[tier];
+        uint64_t *open_sums = open_sums_.data() + tier * values_per_sample_;
+        const uint64_t index = timestamp_ns_begin / resolutions_ns_[tier];
+        if (open.used && open.index != index) {
+            tiers_[tier].push(open.timestamp_ns_begin, open.timestamp_ns_end, open_sums);
+            if (tier + 1 != tiers_.size()) {
+                add_to_bucket(tier + 1, open.timestamp_ns_begin, open.timestamp_ns_end, open_sums);
+            }
+            open.used = false;
+        }
+
+        if (!open.used) {
+            open = bucket{index, timestamp_ns_begin, timestamp_ns_end, true};
+            std::copy(values, values + values_per_sample_, open_sums);
+            return;
+        }
+        open.timestamp_ns_end = timestamp_ns_end;
+        for (size_t i = 0; i != values_per_sample_; ++i) {
+            open_sums[i] += values[i];
+        }
+    }
+
+    const size_t values_per_sample_;
+    // the full resolution samples, then the downsampled tiers
+    std::vector<sample_history> tiers_{};
+    std::vector<uint64_t> resolutions_ns_{};
+    // the open bucket of each tier, and its sums
+    std::vector<bucket> open_{};
+    std::vector<uint64_t> open_sums_{};
+    std::vector<uint64_t> staging_;
+    // the sums of the finer tiers of a window query
+    mutable std::vector<uint64_t> window_sums_;
+};
+
+} // namespace hwcpipe
@@ -0,0 +1,390 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include "hwcpipe/detail/heap_bytes.hpp"
+#include "hwcpipe/detail/narrow_values.hpp"
+#include "hwcpipe/sample_history.hpp"
+#include "hwcpipe/types.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <system_error>
+#include <vector>
+
+namespace hwcpipe {
+
+/** The samples of a counter that fall into one bucket of a timeline_summary query, e.g. one pixel. */
+struct timeline_bucket {
+    /** Number of samples in the bucket, zero if the bucket is empty. */
+    uint64_t num_samples;
+    /** Smallest value of the samples. */
+    double min;
+    /** Largest value of the samples. */
+    double max;
+    /** Mean value of the samples. */
+    double mean;
+    /** Value of the newest sample. */
+    double last;
+};
+
+/**
+ * @brief A timeline_summary decimates the samples of a set of counters for a
+ * timeline view, which draws the minimum, maximum, mean and last value of
+ * each pixel rather than every sample.
+ *
+ * The summary is kept at several resolutions, built incrementally as the
+ * samples are pushed: level 0 keeps single samples, and every level merges
+ * fanout buckets of the level below into one. Each level is a ring of the
+ * same number of buckets, so the coarser levels reach further back. A query
+ * reads the finest level that covers the requested range in at most two
+ * buckets per pixel, so drawing a zoom level costs O(pixels) however many
+ * samples it spans. Samples are placed in the pixel where their bucket
+ * starts, so a pixel may include a few samples of its neighbour when the
+ * level is coarser than the samples.
+ *
+ * Samples must be pushed in time order. All storage is allocated at
+ * construction. A timeline_summary is not thread-safe.
+ *
+ * With history_storage::compact the buckets keep their values as floats,
+ * converted in one pass when a sample is pushed, which halves their memory.
+ * The sums of the newest bucket of each level are accumulated in double
+ * precision before they are narrowed, so the means of the coarse levels
+ * don't drift.
+ *
+ * @par
+ * @code
+ * hwcpipe::timeline_summary summary(num_counters, 4096, 8);
+ *
+ * // after each sample
+ * ec = summary.push(sampler, list);
+ *
+ * // one bucket per pixel of the view
+ * std::vector<hwcpipe::timeline_bucket> pixels(width);
+ * summary.decimate(view_begin, view_end, counter_index, pixels.data(), pixels.size());
+ * @endcode
+ */
+class timeline_summary {
+  public:
+    /**
+     * @brief Constructs a summary.
+     *
+     * @param [in] values_per_sample  Number of counter values per sample.
+     * @param [in] buckets_per_level  Number of buckets each level keeps, at
+     *                                least one.
+     * @param [in] num_levels         Number of resolutions, at least one.
+     * @param [in] fanout             Number of buckets of a level merged into
+     *                                one of the next level, at least two.
+     * @param [in] storage            How the bucket values are stored.
+     */
+    timeline_summary(size_t values_per_sample, size_t buckets_per_level, size_t num_levels, size_t fanout = 8,
+                     history_storage storage = history_storage::wide)
+        : values_per_sample_(values_per_sample)
+        , capacity_(std::max<size_t>(buckets_per_level, 1))
+        , num_levels_(std::max<size_t>(num_levels, 1))
+        , storage_(storage)
+        , spans_(num_levels_)
+        , heads_(num_levels_)
+        , sizes_(num_levels_)
+        , timestamps_begin_(num_levels_ * capacity_)
+        , timestamps_end_(num_levels_ * capacity_)
+        , counts_(num_levels_ * capacity_)
+        , wide_values_(storage == history_storage::wide ? num_levels_ * capacity_ * values_per_sample : 0)
+        , compact_values_(storage == history_storage::compact ? num_levels_ * capacity_ * values_per_sample : 0)
+        , open_sums_(num_levels_ * values_per_sample)
+        , staging_(values_per_sample)
+        , narrow_staging_(storage == history_storage::compact ? values_per_sample : 0)
+        , history_staging_(values_per_sample) {
+        const uint64_t factor = std::max<size_t>(fanout, 2);
+        uint64_t span = 1;
+        for (auto &level_span : spans_) {
+            level_span = span;
+            span = span > UINT64_MAX / factor ? UINT64_MAX : span * factor;
+        }
+    }
+
+    /** @return The number of counter values of each sample. */
+    HWCP_NODISCARD size_t values_per_sample() const { return values_per_sample_; }
+
+    /** @return The number of resolutions. */
+    HWCP_NODISCARD size_t num_levels() const { return num_levels_; }
+
+    /** @return The number of buckets of level @p level. */
+    HWCP_NODISCARD size_t num_buckets(size_t level) const { return sizes_[level]; }
+
+    /** @return How the bucket values are stored. */
+    HWCP_NODISCARD history_storage storage() const { return storage_; }
+
+    /** @return The number of samples merged into a bucket of level @p level. */
+    HWCP_NODISCARD uint64_t samples_per_bucket(size_t level) const { return spans_[level]; }
+
+    /** @return The memory held by the summary in bytes, allocated once when it is constructed. */
+    HWCP_NODISCARD size_t get_memory_footprint() const {
+        return sizeof(*this) + detail::heap_bytes(spans_) + detail::heap_bytes(heads_) + detail::heap_bytes(sizes_) +
+               detail::heap_bytes(timestamps_begin_) + detail::heap_bytes(timestamps_end_) +
+               detail::heap_bytes(counts_) + wide_values_.heap_bytes() + compact_values_.heap_bytes() +
+               detail::heap_bytes(open_sums_) + detail::heap_bytes(staging_) + detail::heap_bytes(narrow_staging_) +
+               detail::heap_bytes(history_staging_);
+    }
+
+    /**
+     * @brief Adds a sample to every level, opening a new bucket in the levels
+     * whose newest one is full and discarding their oldest bucket if they are
+     * full.
+     *
+     * @param [in] timestamp_ns_begin  Start of the sample.
+     * @param [in] timestamp_ns_end    End of the sample.
+     * @param [in] values              values_per_sample() counter values.
+     */
+    void push(uint64_t timestamp_ns_begin, uint64_t timestamp_ns_end, const double *values) {
+        if (sizes_[0] == 0) {
+            first_timestamp_ = timestamp_ns_begin;
+        }
+        if (storage_ == history_storage::compact) {
+            detail::narrow_values(values, values_per_sample_, narrow_staging_.data());
+            push_values(compact_values_, timestamp_ns_begin, timestamp_ns_end, narrow_staging_.data(), values);
+        } else {
+            push_values(wide_values_, timestamp_ns_begin, timestamp_ns_end, values, values);
+        }
+    }
+
+    /**
+     * @brief Adds the last sample of a sampler.
+     *
+     * @param [in] sampler  The sampler, after a successful sample.
+     * @param [in] list     A read list of the sampler with
+     *                      values_per_sample() counters.
+     * @return The error of sampler::get_counter_values().
+     */
+    template <typename sampler_t, typename read_list_t>
+    HWCP_NODISCARD std::error_code push(const sampler_t &sampler, const read_list_t &list) {
+        auto ec = sampler.get_counter_values(list, staging_.data(), staging_.size());
+        if (ec) {
+            return ec;
+        }
+        push(sampler.get_sample_timestamp(), sampler.get_sample_timestamp_end(), staging_.data());
+        return {};
+    }
+
+    /**
+     * @brief Adds the samples of a sample_history, oldest first, e.g. to
+     * summarize the history once when a timeline view is opened.
+     *
+     * @param [in] history  A history with values_per_sample() counters.
+     */
+    void push(const sample_history &history) {
+        for (size_t i = 0; i != history.size(); ++i) {
+            const auto window = history.get_sample(i, history_staging_.data());
+            std::copy(history_staging_.begin(), history_staging_.end(), staging_.begin());
+            push(window.timestamp_ns_begin, window.timestamp_ns_end, staging_.data());
+        }
+    }
+
+    /**
+     * @brief Decimates one counter over a time range into equal buckets, e.g.
+     * one per pixel of a timeline view.
+     *
+     * @param [in]  begin_ns     Start of the range, in nanoseconds.
+     * @param [in]  end_ns       End of the range, in nanoseconds.
+     * @param [in]  counter      Index of the counter in the pushed values.
+     * @param [out] buckets      @p num_buckets buckets, the first one
+     *                           starting at @p begin_ns.
+     * @param [in]  num_buckets  Number of buckets.
+     * @return The level that was read.
+     */
+    size_t decimate(uint64_t begin_ns, uint64_t end_ns, size_t counter, timeline_bucket *buckets,
+                    size_t num_buckets) const {
+        if (storage_ == history_storage::compact) {
+            return decimate_values(compact_values_, begin_ns, end_ns, counter, buckets, num_buckets);
+        }
+        return decimate_values(wide_values_, begin_ns, end_ns, counter, buckets, num_buckets);
+    }
+
+    /** @brief Removes every sample. */
+    void clear() {
+        std::fill(heads_.begin(), heads_.end(), 0);
+        std::fill(sizes_.begin(), sizes_.end(), 0);
+    }
+
+  private:
+    /** The values of the buckets, as doubles or as floats. */
+    template <typename value_t>
+    struct bucket_values {
+        explicit bucket_values(size_t size)
+            : mins(size)
+            , maxs(size)
+            , sums(size)
+            , lasts(size) {}
+
+        HWCP_NODISCARD size_t heap_bytes() const {
+            return detail::heap_bytes(mins) + detail::heap_bytes(maxs) + detail::heap_bytes(sums) +
+                   detail::heap_bytes(lasts);
+        }
+
+        std::vector<value_t> mins;
+        std::vector<value_t> maxs;
+        std::vector<value_t> sums;
+        std::vector<value_t> lasts;
+    };
+
+    /**
+     * Adds a sample to every level. @p values are the values as they are
+     * stored, and @p exact the values as they were pushed, which the sums are
+     * accumulated from.
+     */
+    template <typename value_t>
+    void push_values(bucket_values<value_t> &storage, uint64_t timestamp_ns_begin, uint64_t timestamp_ns_end,
+                     const value_t *values, const double *exact) {
+        for (size_t level = 0; level != num_levels_; ++level) {
+            size_t &size = sizes_[level];
+            double *open_sums = open_sums_.data() + level * values_per_sample_;
+            const size_t newest = size == 0 ? 0 : bucket(level, size - 1);
+            if (size != 0 && counts_[newest] < spans_[level]) {
+                merge(storage, newest, timestamp_ns_end, values, exact, open_sums);
+                continue;
+            }
+
+            if (size == capacity_) {
+                heads_[level] = heads_[level] + 1 == capacity_ ? 0 : heads_[level] + 1;
+                --size;
+            }
+            const size_t index = bucket(level, size++);
+            timestamps_begin_[index] = timestamp_ns_begin;
+            timestamps_end_[index] = timestamp_ns_end;
+            counts_[index] = 1;
+            const size_t offset = index * values_per_sample_;
+            std::copy(values, values + values_per_sample_, storage.mins.begin() + offset);
+            std::copy(values, values + values_per_sample_, storage.maxs.begin() + offset);
+            std::copy(values, values + values_per_sample_, storage.sums.begin() + offset);
+            std::copy(values, values + values_per_sample_, storage.lasts.begin() + offset);
+            std::copy(exact, exact + values_per_sample_, open_sums);
+        }
+    }
+
+    /** Decimates the buckets of @p storage, see decimate(). */
+    template <typename value_t>
+    size_t decimate_values(const bucket_values<value_t> &storage, uint64_t begin_ns, uint64_t end_ns, size_t counter,
+                           timeline_bucket *buckets, size_t num_buckets) const {
+        std::fill(buckets, buckets + num_buckets, timeline_bucket{});
+        if (num_buckets == 0 || end_ns <= begin_ns) {
+            return 0;
+        }
+
+        // the finest level that holds the start of the range in few enough
+        // buckets, or the coarsest one
+        const uint64_t oldest_ns = std::max(begin_ns, first_timestamp_);
+        size_t level = 0;
+        size_t first = 0;
+        size_t last = 0;
+        for (;; ++level) {
+            first = partition_point(level, timestamps_end_, [begin_ns](uint64_t ts) { return ts <= begin_ns; });
+            last = partition_point(level, timestamps_begin_, [end_ns](uint64_t ts) { return ts < end_ns; });
+            const bool covered = sizes_[level] != 0 && timestamps_begin_[bucket(level, 0)] <= oldest_ns;
+            if (level + 1 == num_levels_ || (covered && last - first <= 2 * num_buckets)) {
+                break;
+            }
+        }
+
+        const double scale = static_cast<double>(num_buckets) / static_cast<double>(end_ns - begin_ns);
+        for (size_t i = first; i < last; ++i) {
+            const size_t index = bucket(level, i);
+            const uint64_t start = std::max(timestamps_begin_[index], begin_ns);
+            const auto position = static_cast<size_t>(static_cast<double>(start - begin_ns) * scale);
+            auto &out = buckets[std::min(position, num_buckets - 1)];
+
+            const size_t value = index * values_per_sample_ + counter;
+            const auto min = static_cast<double>(storage.mins[value]);
+            const auto max = static_cast<double>(storage.maxs[value]);
+            if (out.num_samples == 0) {
+                out.min = min;
+                out.max = max;
+                out.mean = 0;
+            } else {
+                out.min = std::min(out.min, min);
+                out.max = std::max(out.max, max);
+            }
+            // the mean holds the sum until the end
+            out.mean += static_cast<double>(storage.sums[value]);
+            out.last = static_cast<double>(storage.lasts[value]);
+            out.num_samples += counts_[index];
+        }
+        for (size_t i = 0; i != num_buckets; ++i) {
+            if (buckets[i].num_samples != 0) {
+                buckets[i].mean /= static_cast<double>(buckets[i].num_samples);
+            }
+        }
+        return level;
+    }
+
+    /** Returns the storage index of the @p index th oldest bucket of @p level. */
+    HWCP_NODISCARD size_t bucket(size_t level, size_t index) const {
+        const size_t pos = heads_[level] + index;
+        return level * capacity_ + (pos >= capacity_ ? pos - capacity_ : pos);
+    }
+
+    /** Merges a sample into the bucket at @p index, the newest of its level, whose exact sums are @p open_sums. */
+    template <typename value_t>
+    void merge(bucket_values<value_t> &storage, size_t index, uint64_t timestamp_ns_end, const value_t *values,
+               const double *exact, double *open_sums) {
+        timestamps_end_[index] = timestamp_ns_end;
+        ++counts_[index];
+        const size_t offset = index * values_per_sample_;
+        for (size_t i = 0; i != values_per_sample_; ++i) {
+            storage.mins[offset + i] = std::min(storage.mins[offset + i], values[i]);
+            storage.maxs[offset + i] = std::max(storage.maxs[offset + i], values[i]);
+            open_sums[i] += exact[i];
+            storage.sums[offset + i] = static_cast<value_t>(open_sums[i]);
+            storage.lasts[offset + i] = values[i];
+        }
+    }
+
+    /**
+     * Returns the index of the oldest bucket of @p level whose timestamp
+     * doesn't satisfy @p pred, or its number of buckets if they all do.
+     */
+    template <typename pred_t>
+    HWCP_NODISCARD size_t partition_point(size_t level, const std::vector<uint64_t> &timestamps, pred_t pred) const {
+        size_t low = 0;
+        size_t high = sizes_[level];
+        while (low != high) {
+            const size_t mid = low + (high - low) / 2;
+            if (pred(timestamps[bucket(level, mid)])) {
+                low = mid + 1;
+            } else {
+                high = mid;
+            }
+        }
+        return low;
+    }
+
+    const size_t values_per_sample_;
+    const size_t capacity_;
+    const size_t num_levels_;
+    const history_storage storage_;
+    // the number of samples of a full bucket, per level
+    std::vector<uint64_t> spans_;
+    std::vector<size_t> heads_;
+    std::vector<size_t> sizes_;
+    // the buckets of level l are at [l * capacity_, (l + 1) * capacity_), and
+    // their values at values_per_sample_ times these indices
+    std::vector<uint64_t> timestamps_begin_;
+    std::vector<uint64_t> timestamps_end_;
+    std::vector<uint64_t> counts_;
+    // only the values of the storage in use are allocated
+    bucket_values<double> wide_values_;
+    bucket_values<float> compact_values_;
+    // the sums of the newest bucket of each level, in double precision
+    std::vector<double> open_sums_;
+    std::vector<double> staging_;
+    std::vector<float> narrow_staging_;
+    std::vector<uint64_t> history_staging_;
+    // the start of the first sample pushed, before which no level has data
+    uint64_t first_timestamp_{};
+};
+
+} // namespace hwcpipe
@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include "hwcpipe/detail/task_pool.hpp"
+#include "hwcpipe/hwcpipe_counter.h"
+#include "hwcpipe/types.hpp"
+
+#include <device/product_id.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <system_error>
+#include <vector>
+
+namespace hwcpipe {
+
+/** How the records of different traces are lined up in time. */
+enum class trace_alignment : uint8_t {
+    /** Each trace starts at time zero, e.g. for runs of the same workload on many devices. */
+    trace_start,
+    /** The timestamps of the records are used as they are, e.g. for traces on a common clock. */
+    absolute,
+};
+
+/** The configuration of a trace_ingest. */
+struct trace_ingest_config {
+    /** The duration of a time bucket in nanoseconds. */
+    uint64_t bucket_ns{1000000000};
+    /** How the traces are lined up in time. */
+    trace_alignment alignment{trace_alignment::trace_start};
+    /** Number of threads reading the traces, including the calling thread, or zero for one per hardware thread. */
+    size_t num_threads{0};
+    /** Number of records decoded and evaluated at a time, which bounds the memory of each thread. */
+    size_t chunk_records{16384};
+};
+
+/** The aggregate of a counter over the samples of a time bucket. */
+struct trace_aggregate {
+    /** The sum of the values. */
+    double sum{0};
+    /** The smallest value. */
+    double min{std::numeric_limits<double>::infinity()};
+    /** The largest value. */
+    double max{-std::numeric_limits<double>::infinity()};
+    /** Number of samples that have the counter. */
+    uint64_t count{0};
+
+    /** @return The mean of the values, or zero if there are none. */
+    HWCP_NODISCARD double mean() const { return count == 0 ? 0 : sum / static_cast<double>(count); }
+
+    /** Adds a value. */
+    void add(double value) {
+        sum += value;
+        min = value < min ? value : min;
+        max = value > max ? value : max;
+        ++count;
+    }
+
+    /** Adds the values of another aggregate. */
+    void merge(const trace_aggregate &other) {
+        sum += other.sum;
+        min = other.min < min ? other.min : min;
+        max = other.max > max ? other.max : max;
+        count += other.count;
+    }
+};
+
+/** What was read from one trace file. */
+struct trace_ingest_result {
+    /** The error that stopped reading the file, if any. */
+    std::error_code ec{};
+    /** The product the trace was recorded on. */
+    device::product_id pid{};
+    /** Number of records aggregated, excluding the erroneous ones. */
+    size_t num_records{0};
+    /** Number of counters of the schema that the trace has. */
+    size_t num_counters{0};
+};
+
+/**
+ * @brief A trace_ingest merges the traces recorded on many devices into time
+ * buckets, e.g. to compare a fleet of devices running the same workload.
+ *
+ * The traces may come from different GPUs, each recording a different set of
+ * hardware counters. They are normalized to a common schema of counters: for
+ * each trace, the counter database gives the hardware counters that each
+ * counter of the schema is computed from on the GPU of the trace, and the
+ * counter is evaluated with a column_evaluator if the trace recorded them.
+ * Counters that a trace can't provide are left out of its aggregates, so the
+ * count of a bucket tells how many samples had the counter. The values of a
+ * hardware counter are summed over its block instances, as a sampler does.
+ *
+ * The files are mapped read-only and read by a pool of threads, a file at a
+ * time. Each thread decodes and evaluates the records of a file one chunk at a
+ * time, and adds them to its own buckets, so memory is bounded by the chunk
+ * size and the number of buckets, not by the size of the traces. The buckets
+ * of the threads are merged once all the files are read. Records flagged as
+ * erroneous are skipped.
+ *
+ * @par
+ * @code
+ * hwcpipe::trace_ingest ingest({MaliGPUActiveCy, MaliFragOverdraw});
+ * auto ec = ingest.ingest(paths);
+ * for (size_t i = 0; i != ingest.num_buckets(); ++i) {
+ *     const hwcpipe::trace_aggregate *aggregates = ingest.get_bucket(i);
+ *     printf("%llu %f\n", ingest.bucket_timestamp(i), aggregates[1].mean());
+ * }
+ * @endcode
+ */
+class trace_ingest {
+  public:
+    /**
+     * @param [in] schema  The counters to aggregate, in the order of the
+     *                     aggregates of a bucket.
+     * @param [in] config  The configuration.
+     */
+    explicit trace_ingest(std::vector<hwcpipe_counter> schema, const trace_ingest_config &config = {});
+
+    trace_ingest(const trace_ingest &) = delete;
+    trace_ingest &operator=(const trace_ingest &) = delete;
+
+    /**
+     * @brief Reads trace files and adds their records to the buckets. The
+     * files may be ingested in several calls.
+     *
+     * @param [in] paths  The paths of the trace files.
+     * @return The first error of the files, e.g. hwcpipe::errc::trace_read_failed
+     * if a file could not be mapped, otherwise an empty error_code. The other
+     * files are still read, and get_results() has the error of each file.
+     */
+    HWCP_NODISCARD std::error_code ingest(const std::vector<std::string> &paths);
+
+    /** @return The counters of the schema. */
+    HWCP_NODISCARD const std::vector<hwcpipe_counter> &get_schema() const { return schema_; }
+
+    /** @return What was read from each file, in the order of the paths of all ingest() calls. */
+    HWCP_NODISCARD const std::vector<trace_ingest_result> &get_results() const { return results_; }
+
+    /** @return The number of buckets that have at least one record, in time order. */
+    HWCP_NODISCARD size_t num_buckets() const { return bucket_keys_.size(); }
+
+    /**
+     * @return The start of bucket @p index in nanoseconds, since the start
+     * of the traces if they are aligned by their start.
+     */
+    HWCP_NODISCARD uint64_t bucket_timestamp(size_t index) const { return bucket_keys_[index] * config_.bucket_ns; }
+
+    /** @return The aggregates of bucket @p index, one per counter of the schema. */
+    HWCP_NODISCARD const trace_aggregate *get_bucket(size_t index) const {
+        return aggregates_.data() + index * schema_.size();
+    }
+
+    /** @brief Drops the buckets and results. */
+    void clear();
+
+  private:
+    struct worker_state;
+
+    /** Reads one file into the buckets of @p worker. */
+    void ingest_file(const std::string &path, worker_state &worker, trace_ingest_result &result) const;
+
+    std::vector<hwcpipe_counter> schema_;
+    trace_ingest_config config_;
+    detail::task_pool pool_;
+    std::vector<trace_ingest_result> results_{};
+
+    // the buckets, in time order, and their aggregates
+    std::vector<uint64_t> bucket_keys_{};
+    std::vector<trace_aggregate> aggregates_{};
+};
+
+} // namespace hwcpipe
@@ -0,0 +1,601 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include "device/constants.hpp"
+#include "hwcpipe/error.hpp"
+#include "hwcpipe/sampler.hpp"
+#include "hwcpipe/types.hpp"
+
+#include <device/hwcnt/block_extents.hpp>
+#include <device/hwcnt/block_metadata.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <vector>
+
+namespace hwcpipe {
+
+/**
+ * The binary layout of a raw counter trace file. The file is append-only and
+ * made of fixed size sections, so that it can be memory mapped and read with
+ * random access while it is still being written:
+ *
+ *  - a file_header at offset 0,
+ *  - num_columns column records at columns_offset,
+ *  - one record of record_size bytes per sample from records_offset to the
+ *    end of the file. A record is a record_header followed by one value of
+ *    value_size bytes per column.
+ *
+ * A column is one hardware counter in one instance of its block. Values are
+ * stored as read from the block, before the counter shift is applied.
+ * Columns are grouped by block type, then block index, then counter offset.
+ * The number of records is derived from the file size; a partial record at
+ * the end of the file is ignored.
+ *
+ * Files with trace_encoding::delta records are version 2.0, since version 1
+ * readers can't parse them. Their records section is a sequence of chunks,
+ * each a chunk_header followed by payload_size bytes. The payload holds the
+ * record header fields, in declaration order, then the columns, each as a
+ * detail::column_codec column of num_records values. A partial chunk at the
+ * end of the file is ignored. A general purpose compressor can be applied
+ * on top of the whole file once the capture is over.
+ *
+ * Since version 2.1, a recorder that is closed appends a sparse time index:
+ * a chunk_header with no records, whose payload is one index_entry per
+ * chunk, followed by an index_trailer at the very end of the file. Version
+ * 2.0 readers stop at the empty chunk. Files without a trailer, e.g. of a
+ * capture that was interrupted, are still read by walking the chunks.
+ */
+namespace trace_layout {
+
+/** 'HWCT' in little endian. */
+constexpr uint32_t magic = 0x54435748;
+/** Incremented for changes that existing readers can't parse. */
+constexpr uint16_t version_major = 1;
+/** Incremented for compatible additions. */
+constexpr uint16_t version_minor = 1;
+/** The major version of files with delta encoded chunks. */
+constexpr uint16_t chunked_version_major = 2;
+/** The minor version of files with delta encoded chunks. */
+constexpr uint16_t chunked_version_minor = 2;
+/** Size of the file_header before version 1.1 and 2.2. */
+constexpr uint32_t base_header_size = 128;
+/** 'HWCI' in little endian. */
+constexpr uint32_t index_magic = 0x49435748;
+
+/** Number of record_header fields stored as columns in a chunk. */
+constexpr size_t num_header_fields = 6;
+
+/** The sample was stretched, see device::hwcnt::sample_flags. */
+constexpr uint32_t flag_stretched = 1U << 0U;
+/** The sample had an error condition, see device::hwcnt::sample_flags. */
+constexpr uint32_t flag_error = 1U << 1U;
+
+/** The header at the start of a trace file. */
+struct file_header {
+    uint32_t magic;
+    uint16_t version_major;
+    uint16_t version_minor;
+    /** Size of this header in bytes. */
+    uint32_t header_size;
+    /** Size of a column in bytes. */
+    uint32_t column_size;
+    /** Number of columns of each record. */
+    uint32_t num_columns;
+    /** Offset of the first column from the start of the file. */
+    uint32_t columns_offset;
+    /** Offset of the first record from the start of the file. */
+    uint32_t records_offset;
+    /** Size of a record in bytes. */
+    uint32_t record_size;
+    /** Size of a value in bytes, 4 or 8. */
+    uint32_t value_size;
+    /** Number of counters per block, see device::hwcnt::block_extents. */
+    uint16_t counters_per_block;
+    /** Number of blocks of each device::hwcnt::block_type. */
+    uint8_t num_blocks_of_type[device::hwcnt::block_extents::num_block_types];
+    /** The trace_encoding of the records, zero before version 2. */
+    uint32_t encoding;
+    /** The constants of the sampled GPU. */
+    device::constants constants;
+    /** The CPUs the sampling thread was pinned to, zero if it was not pinned. */
+    uint64_t cpu_mask;
+    /** The device::hwcnt::sampler::sched_class of the sampling thread. */
+    uint32_t sched_class;
+    /** The priority of the sampling thread, see device::hwcnt::sampler::thread_config. */
+    int32_t sched_priority;
+};
+
+/** Describes one column of the records. */
+struct column {
+    /** The hwcpipe_counter value. */
+    uint32_t counter;
+    /** The device::hwcnt::block_type of the counter. */
+    uint8_t block_type;
+    /** Index of the block within the blocks of its type. */
+    uint8_t block_index;
+    /** Offset of the counter within the block. */
+    uint16_t offset;
+    /** Left shift to apply to the stored value. */
+    uint32_t shift;
+    uint32_t reserved;
+};
+
+/** The header of a record, followed by the values of the sample. */
+struct record_header {
+    /** Sample number, see device::hwcnt::sample_metadata. */
+    uint64_t sample_nr;
+    /** Earliest timestamp that values in this sample represent. */
+    uint64_t timestamp_ns_begin;
+    /** Latest timestamp that values in this sample represent. */
+    uint64_t timestamp_ns_end;
+    /** GPU cycles elapsed since the last sample. */
+    uint64_t gpu_cycle;
+    /** Shader cores cycles elapsed since the last sample. */
+    uint64_t sc_cycle;
+    /** A combination of flag_stretched and flag_error. */
+    uint32_t flags;
+    uint32_t reserved;
+};
+
+/** The header of a chunk of delta encoded records. */
+struct chunk_header {
+    /** Number of records in the chunk. */
+    uint32_t num_records;
+    /** Size of the encoded records in bytes. */
+    uint32_t payload_size;
+};
+
+/** One entry of the time index, for one chunk. */
+struct index_entry {
+    /** The timestamp_ns_begin of the first record of the chunk. */
+    uint64_t timestamp_ns_begin;
+    /** The sample_nr of the first record of the chunk. */
+    uint64_t sample_nr;
+    /** The index of the first record of the chunk in the file. */
+    uint64_t first_record;
+    /** Offset of the chunk_header from the start of the file. */
+    uint64_t offset;
+};
+
+/** The last bytes of an indexed file. */
+struct index_trailer {
+    uint32_t magic;
+    /** Number of index entries. */
+    uint32_t num_entries;
+    /** Offset of the chunk_header of the index from the start of the file. */
+    uint64_t index_offset;
+};
+
+static_assert(sizeof(device::constants) == 80, "The GPU constants are part of the trace file ABI.");
+static_assert(sizeof(file_header) == 144, "The trace file header layout is part of the trace file ABI.");
+static_assert(sizeof(column) == 16, "The trace column layout is part of the trace file ABI.");
+static_assert(sizeof(record_header) == 48, "The trace record layout is part of the trace file ABI.");
+static_assert(sizeof(chunk_header) == 8, "The trace chunk layout is part of the trace file ABI.");
+static_assert(sizeof(index_entry) == 32, "The trace index layout is part of the trace file ABI.");
+static_assert(sizeof(index_trailer) == 16, "The trace index layout is part of the trace file ABI.");
+
+} // namespace trace_layout
+
+/** How a trace_recorder stores its records. */
+enum class trace_encoding : uint32_t {
+    /** Fixed size records, that can be read at random once mapped. */
+    raw,
+    /**
+     * Chunks of one batch of records, with every column delta encoded.
+     * Counters that are idle or change slowly take a fraction of their raw
+     * size, and the trace is decoded one chunk at a time.
+     */
+    delta,
+};
+
+/** How a trace_recorder writes its batches. */
+enum class trace_write_mode : uint8_t {
+    /** The thread that records a sample writes the batch it completes. */
+    blocking,
+    /**
+     * Batches are handed to a detail::async_file_writer, which writes them
+     * in the background with io_uring, or a thread where io_uring is not
+     * available.
+     */
+    async,
+};
+
+namespace detail {
+class async_file_writer;
+} // namespace detail
+
+/**
+ * @brief A trace_recorder writes the raw block values of the hardware
+ * counters of a sampler_config, and the sample metadata, to a trace file in
+ * the trace_layout format. It is far more compact than keeping
+ * counter_sample objects, and suited to long captures at high sample rates.
+ *
+ * Records are staged in a preallocated buffer and written with one write()
+ * per batch, so record() doesn't allocate and only makes a syscall once per
+ * batch. Expression counters are not recorded; they can be derived offline
+ * from the recorded hardware counters.
+ *
+ * With trace_write_mode::async, the recording thread doesn't wait for the
+ * storage either: raw records are staged straight into the buffers of a pool,
+ * and delta chunks are encoded into them, and each buffer is queued for
+ * writing once its batch is complete. The buffers are recycled once written,
+ * and record() only waits when all async_write_depth of them are in flight,
+ * i.e. when the storage can't keep up. Errors of a background write are
+ * returned by a later record(), flush() or close(). Readers of a file that is
+ * still being written may see the records of a batch in flight as zeros.
+ *
+ * @par
+ * @code
+ * hwcpipe::sampler<> sampler(config);
+ * hwcpipe::trace_recorder recorder("capture.hwct", config, sampler.get_constants(), sampler.get_block_extents());
+ * sampler.set_trace_recorder(&recorder);
+ * ec = sampler.start_sampling();
+ * while (capturing) {
+ *     ec = sampler.sample_now();
+ * }
+ * ec = recorder.flush();
+ * @endcode
+ */
+class trace_recorder {
+  public:
+    /** The default number of records written at once. */
+    static constexpr size_t default_batch_size = 64;
+
+    /** Number of batches that trace_write_mode::async writes at once. */
+    static constexpr size_t async_write_depth = 8;
+
+    /**
+     * Creates a trace file, truncating any existing file, and writes its
+     * header. If that fails the recorder is invalid.
+     *
+     * @param [in] path           The path of the trace file.
+     * @param [in] config         The counters to record. Only the hardware
+     *                            counters are recorded.
+     * @param [in] constants      The constants of the sampled GPU.
+     * @param [in] block_extents  The block layout of the sampled GPU.
+     * @param [in] batch_size     Number of records written at once. Delta
+     *                            encoded batches are one chunk each, so larger
+     *                            batches compress better.
+     * @param [in] encoding       How the records are stored.
+     * @param [in] write_mode     Whether the batches are written by the
+     *                            recording thread or in the background.
+     */
+    template <typename block_extents_t>
+    trace_recorder(const std::string &path, const sampler_config &config, const device::constants &constants,
+                   const block_extents_t &block_extents, size_t batch_size = default_batch_size,
+                   trace_encoding encoding = trace_encoding::raw,
+                   trace_write_mode write_mode = trace_write_mode::blocking)
+        : trace_recorder(path, config, constants, num_blocks_of_type(block_extents),
+                         block_extents.counters_per_block(),
+                         block_extents.values_type() == device::hwcnt::sample_values_type::uint64 ? 8U : 4U,
+                         batch_size, encoding, write_mode) {}
+
+    /** Closes the file, see close(). */
+    ~trace_recorder();
+
+    trace_recorder(const trace_recorder &) = delete;
+    trace_recorder &operator=(const trace_recorder &) = delete;
+
+    /** @return True if the trace can be written. */
+    operator bool() const { return !ec_; }
+
+    /** @return The error that made the recorder invalid, if any. */
+    HWCP_NODISCARD std::error_code get_error() const { return ec_; }
+
+    /** @return The number of columns of each record. */
+    HWCP_NODISCARD size_t num_columns() const { return columns_.size(); }
+
+    /** @return The descriptor of column @p index. */
+    HWCP_NODISCARD const trace_layout::column &get_column(size_t index) const { return columns_[index]; }
+
+    /** @return The number of samples recorded, including the buffered ones. */
+    HWCP_NODISCARD uint64_t num_records() const { return num_records_; }
+
+    /**
+     * @brief Appends a sample to the trace.
+     *
+     * @param [in] sample  A backend sample, e.g. a device::hwcnt::sample.
+     * @return hwcpipe::errc::trace_write_failed if the batch this sample
+     * completed could not be written, or if the recorder is invalid or
+     * closed.
+     */
+    template <typename sample_t>
+    HWCP_NODISCARD std::error_code record(const sample_t &sample) {
+        if (ec_) {
+            return ec_;
+        }
+        if (fd_ < 0) {
+            return make_error_code(errc::trace_write_failed);
+        }
+
+        char *record = staging_ + num_buffered_ * record_size_;
+        std::memset(record, 0, record_size_);
+
+        const auto &metadata = sample.get_metadata();
+        trace_layout::record_header header{};
+        header.sample_nr = metadata.sample_nr;
+        header.timestamp_ns_begin = metadata.timestamp_ns_begin;
+        header.timestamp_ns_end = metadata.timestamp_ns_end;
+        header.gpu_cycle = metadata.gpu_cycle;
+        header.sc_cycle = metadata.sc_cycle;
+        header.flags = (metadata.flags.stretched ? trace_layout::flag_stretched : 0U) |
+                       (metadata.flags.error ? trace_layout::flag_error : 0U);
+        std::memcpy(record, &header, sizeof(header));
+
+        char *values = record + sizeof(trace_layout::record_header);
+        for (const auto &block : sample.blocks()) {
+            const auto &columns = block_columns_[static_cast<size_t>(block.type)];
+            if (block.index >= columns.num_blocks) {
+                continue;
+            }
+
+            char *destination = values + (columns.first_column + block.index * columns.num_offsets) * value_size_;
+            const auto *source = static_cast<const char *>(block.values);
+            for (size_t i = 0; i != columns.num_offsets; ++i) {
+                std::memcpy(destination + i * value_size_, source + offsets_[columns.first_offset + i] * value_size_,
+                            value_size_);
+            }
+        }
+
+        ++num_records_;
+        if (++num_buffered_ == batch_size_) {
+            return flush();
+        }
+        return {};
+    }
+
+    /**
+     * @brief Writes the buffered records to the file, or queues them for
+     * writing with trace_write_mode::async.
+     *
+     * @return hwcpipe::errc::trace_write_failed if the write, or an earlier
+     * background write, failed, in which case the recorder becomes invalid.
+     */
+    HWCP_NODISCARD std::error_code flush();
+
+    /**
+     * @brief Writes the buffered records and, for delta encoded traces, the
+     * time index, then closes the file. Nothing can be recorded afterwards.
+     * Background writes are waited for.
+     *
+     * @return hwcpipe::errc::trace_write_failed if a write failed.
+     */
+    HWCP_NODISCARD std::error_code close();
+
+  private:
+    using num_blocks_of_type_type = std::array<uint8_t, device::hwcnt::block_extents::num_block_types>;
+
+    // the columns of a block type
+    struct block_columns {
+        size_t first_column;
+        size_t first_offset;
+        size_t num_offsets;
+        size_t num_blocks;
+    };
+
+    trace_recorder(const std::string &path, const sampler_config &config, const device::constants &constants,
+                   const num_blocks_of_type_type &num_blocks_of_type, uint16_t counters_per_block, uint32_t value_size,
+                   size_t batch_size, trace_encoding encoding, trace_write_mode write_mode);
+
+    template <typename block_extents_t>
+    static num_blocks_of_type_type num_blocks_of_type(const block_extents_t &block_extents) {
+        num_blocks_of_type_type result{};
+        for (size_t i = 0; i != result.size(); ++i) {
+            result[i] = block_extents.num_blocks_of_type(static_cast<device::hwcnt::block_type>(i));
+        }
+        return result;
+    }
+
+    HWCP_NODISCARD std::error_code write_all(const char *data, size_t size);
+
+    HWCP_NODISCARD std::error_code write_index();
+
+    /** Queues the buffered records, or the chunk encoding them, for a background write. */
+    HWCP_NODISCARD std::error_code submit_batch();
+
+    /** Encodes the buffered records as a chunk in @p chunk, and returns its size. */
+    HWCP_NODISCARD size_t encode_chunk(uint8_t *chunk);
+
+    std::error_code ec_;
+    int fd_{-1};
+    std::vector<trace_layout::column> columns_{};
+    std::array<block_columns, device::hwcnt::block_extents::num_block_types> block_columns_{};
+    std::vector<size_t> offsets_{};
+    size_t value_size_{};
+    size_t record_size_{};
+    size_t batch_size_{};
+    trace_encoding encoding_;
+    std::vector<char> buffer_{};
+    // where record() writes, buffer_ or a buffer of writer_ for async raw records
+    char *staging_{};
+    std::unique_ptr<detail::async_file_writer> writer_;
+    std::vector<uint64_t> column_{};
+    std::vector<uint8_t> encoded_{};
+    std::vector<trace_layout::index_entry> index_{};
+    uint64_t file_size_{};
+    size_t num_buffered_{};
+    uint64_t num_records_{};
+};
+
+/**
+ * @brief A trace_reader reads a mapped trace file. The file may still be
+ * written to; records appended after the reader was created are not seen.
+ *
+ * Raw records are read in place. Delta encoded records are decoded one chunk
+ * at a time into a cache, so they are best read in order. The reader is
+ * therefore not thread safe: each thread needs its own.
+ *
+ * find_record() seeks to a point in time. It binary searches the time index
+ * of a delta encoded file, if it has one, and only decodes the chunks it lands
+ * on.
+ */
+class trace_reader {
+  public:
+    /**
+     * Validates a mapped trace file. If the file doesn't have a supported
+     * layout the reader is invalid.
+     *
+     * @param [in] data  The mapped file.
+     * @param [in] size  The size of the mapping in bytes.
+     */
+    trace_reader(const void *data, size_t size);
+
+    /** @return True if the file has a supported layout. */
+    operator bool() const { return !ec_; }
+
+    /** @return hwcpipe::errc::invalid_trace_layout if the reader is invalid. */
+    HWCP_NODISCARD std::error_code get_error() const { return ec_; }
+
+    /** @return The file header. */
+    HWCP_NODISCARD const trace_layout::file_header &header() const { return header_; }
+
+    /** @return How the records are stored. */
+    HWCP_NODISCARD trace_encoding get_encoding() const { return encoding_; }
+
+    /** @return The number of columns of each record. */
+    HWCP_NODISCARD size_t num_columns() const { return header_.num_columns; }
+
+    /** @return The descriptor of column @p index. */
+    HWCP_NODISCARD const trace_layout::column &get_column(size_t index) const {
+        return *reinterpret_cast<const trace_layout::column *>(columns_ + index * header_.column_size);
+    }
+
+    /** @return The number of complete records. */
+    HWCP_NODISCARD size_t num_records() const { return num_records_; }
+
+    /** @return True if the file has a time index. */
+    HWCP_NODISCARD bool has_index() const { return index_ != nullptr; }
+
+    /**
+     * @brief Finds the first record of a point in time. Records are expected
+     * in timestamp order, as a sampler produces them.
+     *
+     * @param [in] timestamp_ns  The point in time, in nanoseconds.
+     * @return The index of the first record whose timestamp_ns_begin is not
+     * before @p timestamp_ns, or num_records() if there is none.
+     */
+    HWCP_NODISCARD size_t find_record(uint64_t timestamp_ns) const;
+
+    /**
+     * @return The header of record @p index. Records of a malformed chunk
+     * read as zero.
+     */
+    HWCP_NODISCARD trace_layout::record_header get_record(size_t index) const;
+
+    /**
+     * @return The value of column @p column in record @p index, with the
+     * counter shift applied. Records of a malformed chunk read as zero.
+     */
+    HWCP_NODISCARD uint64_t get_value(size_t index, size_t column) const;
+
+    /**
+     * @return The value of column @p column in record @p index as it was read
+     * from the block, before the counter shift is applied.
+     */
+    HWCP_NODISCARD uint64_t get_raw_value(size_t index, size_t column) const;
+
+    /**
+     * @return The records of a raw trace, read in place: record @p i is the
+     * header().record_size bytes at offset i * header().record_size, laid out
+     * as described by trace_layout. Nullptr if the records are delta encoded,
+     * in which case they are only read by decoding their chunk.
+     */
+    HWCP_NODISCARD const char *get_raw_records() const {
+        return encoding_ == trace_encoding::raw ? records_ : nullptr;
+    }
+
+  private:
+    // a chunk of delta encoded records
+    struct chunk {
+        size_t first_record;
+        size_t offset;
+    };
+
+    /** Returns the number of records of the largest chunk. */
+    HWCP_NODISCARD size_t max_chunk_records() const;
+
+    /** Walks the chunks of a file without a valid index. */
+    void find_chunks(size_t size);
+
+    /** Uses the index of the file, if it has a valid one. */
+    HWCP_NODISCARD bool read_index(size_t size);
+
+    /**
+     * Decodes the chunk of record @p index into the cache, and returns the
+     * position of the record within the chunk.
+     */
+    size_t load_chunk(size_t index) const;
+
+    /** Returns the first record in [first, last) not before @p timestamp_ns. */
+    HWCP_NODISCARD size_t lower_bound(size_t first, size_t last, uint64_t timestamp_ns) const;
+
+    std::error_code ec_;
+    const char *base_{};
+    size_t size_{};
+    trace_layout::file_header header_{};
+    trace_encoding encoding_{trace_encoding::raw};
+    const char *columns_{};
+    const char *records_{};
+    size_t num_records_{};
+    const char *index_{};
+    size_t num_index_entries_{};
+    std::vector<chunk> chunks_{};
+
+    // decoded columns of the cached chunk, header fields first
+    mutable std::vector<uint64_t> decoded_{};
+    mutable size_t cached_chunk_{};
+    mutable size_t cached_records_{};
+    mutable bool cache_valid_{};
+};
+
+/**
+ * @brief A trace_file maps a trace file read-only and reads it with a
+ * trace_reader. Only the pages that are read are loaded.
+ */
+class trace_file {
+  public:
+    /**
+     * Maps a trace file. If the file can't be mapped, or doesn't have a
+     * supported layout, the trace_file is invalid.
+     *
+     * @param [in] path  The path of the trace file.
+     */
+    explicit trace_file(const std::string &path);
+
+    ~trace_file();
+
+    trace_file(const trace_file &) = delete;
+    trace_file &operator=(const trace_file &) = delete;
+
+    /** @return True if the file is mapped and has a supported layout. */
+    operator bool() const { return reader_; }
+
+    /**
+     * @return hwcpipe::errc::trace_read_failed if the file could not be
+     * mapped, hwcpipe::errc::invalid_trace_layout if its layout is not
+     * supported, otherwise an empty error_code.
+     */
+    HWCP_NODISCARD std::error_code get_error() const { return ec_ ? ec_ : reader_.get_error(); }
+
+    /** @return The reader of the mapped file. */
+    HWCP_NODISCARD const trace_reader &get_reader() const { return reader_; }
+
+  private:
+    std::error_code ec_;
+    void *data_{};
+    size_t size_{};
+    trace_reader reader_{nullptr, 0};
+};
+
+} // namespace hwcpipe
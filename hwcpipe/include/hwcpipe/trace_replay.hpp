@@ -0,0 +1,369 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include "device/constants.hpp"
+#include "hwcpipe/error.hpp"
+#include "hwcpipe/trace_recorder.hpp"
+#include "hwcpipe/types.hpp"
+
+#include <device/hwcnt/block_extents.hpp>
+#include <device/hwcnt/block_metadata.hpp>
+#include <device/hwcnt/sample.hpp>
+#include <device/hwcnt/sampler/configuration.hpp>
+#include <device/product_id.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <system_error>
+#include <vector>
+
+namespace hwcpipe {
+
+/**
+ * @brief A trace_replay makes a recorded trace available as a GPU, so that a
+ * hwcpipe::sampler<trace_replay_policy> decodes it, evaluates its expression
+ * and custom counters and feeds its exporters exactly as it would on the
+ * device. Nothing is read from a GPU, so traces can be analysed on any host,
+ * and as fast as the records can be decoded.
+ *
+ * The replay is registered under a device number, which samplers select with
+ * their sampler_config. The config must be made for the product of the trace,
+ * see get_product_id(), and may only enable hardware counters that were
+ * recorded. Each sample taken by a sampler reads the next record; manual and
+ * periodic samplers both get one record per sample, without waiting for the
+ * recorded sampling period. Samples that were recorded as stretched or
+ * erroneous fail to collect as they did on the device. Once every record was
+ * read, requesting a sample fails and at_end() returns true.
+ *
+ * The reader and the replay must outlive every sampler created on the replay,
+ * and the samplers share its position. A replay is not thread-safe.
+ * @par
+ * @code
+ * hwcpipe::trace_file file("capture.hwct");
+ * hwcpipe::trace_replay replay(file.get_reader());
+ * device::product_id pid{};
+ * ec = replay.get_product_id(pid);
+ *
+ * hwcpipe::sampler_config config(pid, replay.get_device_number());
+ * ec = config.add_counter(MaliGPUActiveCy);
+ * hwcpipe::sampler<hwcpipe::trace_replay_policy> sampler(config);
+ * ec = sampler.start_sampling();
+ * while (!replay.at_end()) {
+ *     if (!sampler.sample_now()) {
+ *         // ... read the counters ...
+ *     }
+ * }
+ * @endcode
+ */
+class trace_replay {
+  public:
+    /**
+     * Registers a trace for replay. If the reader is invalid, or the device
+     * number already has a replay, the replay is invalid and samplers can't
+     * be created on it.
+     *
+     * @param [in] reader         The recorded trace.
+     * @param [in] device_number  The device number that samplers select.
+     */
+    explicit trace_replay(const trace_reader &reader, int device_number = 0);
+
+    /** Unregisters the trace. */
+    ~trace_replay();
+
+    trace_replay(const trace_replay &) = delete;
+    trace_replay &operator=(const trace_replay &) = delete;
+
+    /** @return True if the trace is registered. */
+    operator bool() const { return !ec_; }
+
+    /**
+     * @return The error of the reader, hwcpipe::errc::trace_replay_in_use if
+     * the device number already had a replay, otherwise an empty error_code.
+     */
+    HWCP_NODISCARD std::error_code get_error() const { return ec_; }
+
+    /** @return The recorded trace. */
+    HWCP_NODISCARD const trace_reader &get_reader() const { return reader_; }
+
+    /** @return The device number of the replay. */
+    HWCP_NODISCARD int get_device_number() const { return device_number_; }
+
+    /**
+     * @brief Identifies the recorded GPU.
+     *
+     * @param [out] pid  Set to the product of the recorded GPU.
+     * @return An error if the replay is invalid or the recorded GPU is not
+     * known, otherwise an empty error_code.
+     */
+    HWCP_NODISCARD std::error_code get_product_id(device::product_id &pid) const;
+
+    /** @return The constants of the recorded GPU. */
+    HWCP_NODISCARD const device::constants &get_constants() const { return reader_.header().constants; }
+
+    /** @return The block layout of the recorded GPU. */
+    HWCP_NODISCARD const device::hwcnt::block_extents &get_block_extents() const { return block_extents_; }
+
+    /**
+     * @return The recorded offsets of each block type, as a configuration
+     * enable map.
+     */
+    HWCP_NODISCARD const device::hwcnt::sampler::configuration::enable_map_type &
+    get_recorded_counters(device::hwcnt::block_type type) const {
+        return recorded_[static_cast<size_t>(type)];
+    }
+
+    /** @return The index of the next record to replay. */
+    HWCP_NODISCARD size_t position() const { return position_; }
+
+    /** @return True if every record was replayed. */
+    HWCP_NODISCARD bool at_end() const { return position_ >= reader_.num_records(); }
+
+    /**
+     * @brief Moves the replay to record @p index, or to the end of the trace
+     * if there are fewer records.
+     */
+    void seek_record(size_t index) { position_ = index < reader_.num_records() ? index : reader_.num_records(); }
+
+    /**
+     * @brief Moves the replay to the first record that is not before
+     * @p timestamp_ns, see trace_reader::find_record().
+     */
+    void seek(uint64_t timestamp_ns) { position_ = reader_.find_record(timestamp_ns); }
+
+    /** Moves the replay past the record it last returned. */
+    void advance() { seek_record(position_ + 1); }
+
+    /**
+     * @return The replay registered under @p device_number when it is valid,
+     * otherwise nullptr.
+     */
+    HWCP_NODISCARD static trace_replay *find(int device_number);
+
+  private:
+    using enable_map_type = device::hwcnt::sampler::configuration::enable_map_type;
+
+    std::error_code ec_;
+    const trace_reader &reader_;
+    int device_number_;
+    device::hwcnt::block_extents block_extents_{};
+    std::array<enable_map_type, device::hwcnt::block_extents::num_block_types> recorded_{};
+    size_t position_{};
+};
+
+namespace detail {
+namespace replay {
+
+/** Backend handle of a trace_replay. */
+class handle {
+  public:
+    using handle_ptr = std::unique_ptr<handle>;
+
+    explicit handle(trace_replay &replay)
+        : replay_(replay) {}
+
+    /** @return A handle of the replay of @p device_number, or nullptr. */
+    static handle_ptr create(int device_number) {
+        auto *replay = trace_replay::find(device_number);
+        if (replay == nullptr) {
+            return nullptr;
+        }
+        return std::make_unique<handle>(*replay);
+    }
+
+    trace_replay &get_replay() const { return replay_; }
+
+  private:
+    trace_replay &replay_;
+};
+
+/** Backend instance of a trace_replay. */
+class instance {
+  public:
+    using instance_ptr = std::unique_ptr<instance>;
+
+    explicit instance(trace_replay &replay)
+        : replay_(replay) {}
+
+    static instance_ptr create(handle &hndl) { return std::make_unique<instance>(hndl.get_replay()); }
+
+    const device::constants &get_constants() const { return replay_.get_constants(); }
+
+    const device::hwcnt::block_extents &get_hwcnt_block_extents() const { return replay_.get_block_extents(); }
+
+    trace_replay &get_replay() const { return replay_; }
+
+  private:
+    trace_replay &replay_;
+};
+
+/**
+ * Backend reader of a trace_replay. It owns the blocks that samples are
+ * decoded into, so that taking a sample doesn't allocate.
+ */
+class reader {
+  public:
+    /**
+     * @param [in] replay    The replay to read.
+     * @param [in] periodic  True if every sampled record stays pending, false
+     *                       if each manual request makes one record pending.
+     */
+    reader(trace_replay &replay, bool periodic);
+
+    /** Makes records available to samples, or stops them. */
+    void set_pending(bool pending) { pending_ = pending; }
+
+    /** @return True if a sample was requested and the trace has records left. */
+    std::error_code is_sample_ready(bool &ready) const {
+        ready = pending_ && !replay_.at_end();
+        return {};
+    }
+
+    /** Same as above, records are ready at once or never. */
+    std::error_code is_sample_ready(bool &ready, uint64_t) const { return is_sample_ready(ready); }
+
+    /** Decodes the next record into the blocks. */
+    HWCP_NODISCARD std::error_code get_sample(device::hwcnt::sample_metadata &metadata);
+
+    /**
+     * Moves past the record that was decoded. A manual sampler needs a new
+     * request for the next one.
+     */
+    void put_sample();
+
+    const std::vector<device::hwcnt::block_metadata> &blocks() const { return blocks_; }
+
+  private:
+    // where a column is stored in the block values
+    struct destination {
+        size_t column;
+        size_t offset;
+    };
+
+    trace_replay &replay_;
+    std::vector<uint64_t> values_{};
+    std::vector<device::hwcnt::block_metadata> blocks_{};
+    std::vector<destination> destinations_{};
+    size_t value_size_{};
+    bool periodic_;
+    bool pending_{};
+};
+
+/** A sample of a trace_replay: the next record of the trace. */
+class sample {
+  public:
+    sample(reader &reader, std::error_code &ec)
+        : reader_(reader)
+        , ec_(ec) {
+        ec_ = reader_.get_sample(metadata_);
+    }
+
+    ~sample() {
+        if (!ec_) {
+            reader_.put_sample();
+        }
+    }
+
+    const device::hwcnt::sample_metadata &get_metadata() const { return metadata_; }
+
+    const std::vector<device::hwcnt::block_metadata> &blocks() const { return reader_.blocks(); }
+
+  private:
+    reader &reader_;
+    std::error_code &ec_;
+    device::hwcnt::sample_metadata metadata_{};
+};
+
+/**
+ * Checks that a sampler configuration only enables recorded counters, on
+ * block types that the trace has.
+ */
+bool is_recorded(const trace_replay &replay, const device::hwcnt::sampler::configuration *config,
+                 size_t config_len);
+
+/** Backend manual sampler of a trace_replay. The buffer count is ignored. */
+class manual_sampler {
+  public:
+    manual_sampler(const instance &inst, const device::hwcnt::sampler::configuration *config, size_t config_len,
+                   uint32_t = 0)
+        : reader_(inst.get_replay(), false)
+        , valid_(is_recorded(inst.get_replay(), config, config_len))
+        , replay_(inst.get_replay()) {}
+
+    operator bool() const { return valid_; }
+
+    std::error_code accumulation_start() { return {}; }
+
+    std::error_code accumulation_stop(uint64_t) {
+        reader_.set_pending(false);
+        return {};
+    }
+
+    /** @return An error if every record was replayed. */
+    std::error_code request_sample(uint64_t) {
+        if (replay_.at_end()) {
+            return make_error_code(std::errc::no_message_available);
+        }
+        reader_.set_pending(true);
+        return {};
+    }
+
+    std::error_code request_sample_async(uint64_t user_data) { return request_sample(user_data); }
+
+    reader &get_reader() { return reader_; }
+
+  private:
+    reader reader_;
+    bool valid_;
+    trace_replay &replay_;
+};
+
+/**
+ * Backend periodic sampler of a trace_replay. The period and the buffer count
+ * are ignored, every sample reads the next record.
+ */
+class periodic_sampler {
+  public:
+    periodic_sampler(const instance &inst, uint64_t, const device::hwcnt::sampler::configuration *config,
+                     size_t config_len, uint32_t = 0)
+        : reader_(inst.get_replay(), true)
+        , valid_(is_recorded(inst.get_replay(), config, config_len)) {}
+
+    operator bool() const { return valid_; }
+
+    std::error_code sampling_start(uint64_t) {
+        reader_.set_pending(true);
+        return {};
+    }
+
+    std::error_code sampling_stop(uint64_t) {
+        reader_.set_pending(false);
+        return {};
+    }
+
+    reader &get_reader() { return reader_; }
+
+  private:
+    reader reader_;
+    bool valid_;
+};
+
+} // namespace replay
+} // namespace detail
+
+/** The backend policy of a hwcpipe::sampler that replays a trace_replay. */
+struct trace_replay_policy {
+    using handle_type = detail::replay::handle;
+    using instance_type = detail::replay::instance;
+    using sampler_type = detail::replay::manual_sampler;
+    using periodic_sampler_type = detail::replay::periodic_sampler;
+    using sample_type = detail::replay::sample;
+};
+
+} // namespace hwcpipe
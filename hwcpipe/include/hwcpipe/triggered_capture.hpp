@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include "hwcpipe/types.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <system_error>
+#include <vector>
+
+namespace hwcpipe {
+
+/** The samples that went through a triggered_capture. */
+struct triggered_capture_stats {
+    /** Samples pushed to the capture. */
+    uint64_t pushed;
+    /** Captures started by a trigger. */
+    uint64_t triggers;
+    /** Samples written to the sink. */
+    uint64_t flushed;
+};
+
+/**
+ * @brief A triggered_capture keeps the last decoded samples in a fixed ring,
+ * and only writes them to a sink when a sample fires a trigger, e.g. a
+ * bandwidth spike. The samples before the trigger, the one that fired it and
+ * the samples after it are then written, so rare events are captured without
+ * storing a full-rate trace. All storage is allocated at construction.
+ *
+ * The trigger is usually checked by the sampler, see
+ * sampler_config::set_trigger(). A trigger that fires while the samples after
+ * a previous one are written extends the capture.
+ *
+ * The sink is any object with a
+ * `std::error_code push(uint64_t timestamp_ns_begin, uint64_t timestamp_ns_end, const double *values)`
+ * member, e.g. a sample_stream that writes the samples from another thread.
+ *
+ * @par
+ * @code
+ * ec = config.set_trigger({MaliExtBusRdBy, hwcpipe::trigger_condition::above, 1e9});
+ * hwcpipe::sampler<> sampler(config);
+ * auto list = sampler.make_read_list(counters, num_counters, ec);
+ * hwcpipe::triggered_capture capture(64, 16, num_counters);
+ * while (running) {
+ *     if (!sampler.sample_now()) {
+ *         ec = capture.push(sampler, list, stream);
+ *     }
+ * }
+ * @endcode
+ */
+class triggered_capture {
+  public:
+    /**
+     * @brief Constructs a capture.
+     *
+     * @param [in] pre_trigger        Number of samples written before the
+     *                                one that fires the trigger.
+     * @param [in] post_trigger       Number of samples written after it.
+     * @param [in] values_per_sample  Number of counter values per sample.
+     */
+    triggered_capture(size_t pre_trigger, size_t post_trigger, size_t values_per_sample)
+        : capacity_(pre_trigger + 1)
+        , post_trigger_(post_trigger)
+        , values_per_sample_(values_per_sample)
+        , slots_(capacity_)
+        , values_(capacity_ * values_per_sample) {}
+
+    triggered_capture(const triggered_capture &) = delete;
+    triggered_capture &operator=(const triggered_capture &) = delete;
+
+    /** @return The number of counter values of each sample. */
+    HWCP_NODISCARD size_t values_per_sample() const { return values_per_sample_; }
+
+    /** @return True if the samples after a trigger are being written. */
+    HWCP_NODISCARD bool is_capturing() const { return post_remaining_ != 0; }
+
+    /** @return The counts of the samples that went through the capture. */
+    HWCP_NODISCARD const triggered_capture_stats &get_stats() const { return stats_; }
+
+    /**
+     * @brief Adds a sample, and writes the capture to @p sink if the sample
+     * fires the trigger or follows one.
+     *
+     * @param [in] timestamp_ns_begin  Start of the counter accumulation.
+     * @param [in] timestamp_ns_end    End of the counter accumulation.
+     * @param [in] values              values_per_sample() counter values.
+     * @param [in] triggered           True if the sample fires the trigger.
+     * @param [in] sink                Receives the captured samples.
+     * @return The first error of the sink, otherwise an empty error_code.
+     */
+    template <typename sink_t>
+    HWCP_NODISCARD std::error_code push(uint64_t timestamp_ns_begin, uint64_t timestamp_ns_end, const double *values,
+                                        bool triggered, sink_t &sink) {
+        std::copy(values, values + values_per_sample_, slot_values(head_));
+        return commit(timestamp_ns_begin, timestamp_ns_end, triggered, sink);
+    }
+
+    /**
+     * @brief Adds the last sample of a sampler, which fires the trigger if
+     * sampler::is_triggered() is true. The values are read straight into the
+     * ring.
+     *
+     * @param [in] sampler  The sampler, after a successful sample.
+     * @param [in] list     A read list of the sampler with
+     *                      values_per_sample() counters.
+     * @param [in] sink     Receives the captured samples.
+     * @return The error of sampler::get_counter_values(), otherwise the first
+     * error of the sink.
+     */
+    template <typename sampler_t, typename read_list_t, typename sink_t>
+    HWCP_NODISCARD std::error_code push(const sampler_t &sampler, const read_list_t &list, sink_t &sink) {
+        auto ec = sampler.get_counter_values(list, slot_values(head_), values_per_sample_);
+        if (ec) {
+            return ec;
+        }
+        return commit(sampler.get_sample_timestamp(), sampler.get_sample_timestamp_end(), sampler.is_triggered(),
+                      sink);
+    }
+
+  private:
+    // the timestamps of a sample of the ring
+    struct slot {
+        uint64_t timestamp_ns_begin;
+        uint64_t timestamp_ns_end;
+    };
+
+    HWCP_NODISCARD double *slot_values(size_t index) { return values_.data() + index * values_per_sample_; }
+
+    /** Adds the sample written to the head of the ring. */
+    template <typename sink_t>
+    HWCP_NODISCARD std::error_code commit(uint64_t timestamp_ns_begin, uint64_t timestamp_ns_end, bool triggered,
+                                          sink_t &sink) {
+        ++stats_.pushed;
+        slots_[head_] = {timestamp_ns_begin, timestamp_ns_end};
+        head_ = head_ + 1 == capacity_ ? 0 : head_ + 1;
+        size_ = std::min(size_ + 1, capacity_);
+
+        if (!triggered && post_remaining_ == 0) {
+            return {};
+        }
+        if (triggered && post_remaining_ == 0) {
+            ++stats_.triggers;
+        }
+        post_remaining_ = triggered ? post_trigger_ : post_remaining_ - 1;
+        return flush(sink);
+    }
+
+    /** Writes the samples of the ring to the sink, oldest first, and empties it. */
+    template <typename sink_t>
+    HWCP_NODISCARD std::error_code flush(sink_t &sink) {
+        std::error_code result{};
+        for (size_t i = 0; i != size_; ++i) {
+            const size_t index = (head_ + capacity_ - size_ + i) % capacity_;
+            auto ec = sink.push(slots_[index].timestamp_ns_begin, slots_[index].timestamp_ns_end, slot_values(index));
+            if (ec && !result) {
+                result = ec;
+            }
+            ++stats_.flushed;
+        }
+        size_ = 0;
+        return result;
+    }
+
+    const size_t capacity_;
+    const size_t post_trigger_;
+    const size_t values_per_sample_;
+    std::vector<slot> slots_;
+    std::vector<double> values_;
+    size_t head_{};
+    size_t size_{};
+    size_t post_remaining_{};
+    triggered_capture_stats stats_{};
+};
+
+} // namespace hwcpipe
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Arm Limited.
+ * Copyright (c) 2023-2025 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  */
@@ -38,6 +38,60 @@ class hwcpipe_error_category : public std::error_category {
             return "Failed to start accumulation";
         case errc::accumulation_stop_failed:
             return "Failed to stop accumulation";
+        case errc::invalid_read_list:
+            return "Read list does not fit the output buffer";
+        case errc::sample_not_ready:
+            return "Sample not ready";
+        case errc::instance_values_unavailable:
+            return "Per instance values not available for counter";
+        case errc::invalid_expression:
+            return "Invalid custom counter expression";
+        case errc::segment_creation_failed:
+            return "Failed to create the shared sample segment";
+        case errc::invalid_segment_layout:
+            return "Unsupported shared sample segment layout";
+        case errc::daemon_connection_failed:
+            return "Failed to connect to the sample daemon";
+        case errc::trace_write_failed:
+            return "Failed to write the trace file";
+        case errc::trace_read_failed:
+            return "Failed to read the trace file";
+        case errc::invalid_trace_layout:
+            return "Unsupported trace file layout";
+        case errc::trace_replay_in_use:
+            return "A trace is already replayed as this device number";
+        case errc::thread_config_failed:
+            return "Failed to configure the sampling thread";
+        case errc::stream_closed:
+            return "The sample stream is closed";
+        case errc::statistics_mismatch:
+            return "The statistics have different counters or accuracy";
+        case errc::invalid_statistics_layout:
+            return "Unsupported statistics summary layout";
+        case errc::counter_budget_exceeded:
+            return "The counter reads more hardware counters than a pass can enable";
+        case errc::network_send_failed:
+            return "Failed to send the samples to the network";
+        case errc::error_estimate_unavailable:
+            return "Error estimate not available for counter";
+        case errc::cpu_counters_unavailable:
+            return "CPU performance counters not available";
+        case errc::frequency_unavailable:
+            return "GPU frequency not available";
+        case errc::invalid_sampler_plan:
+            return "Sampler plan is invalid or doesn't match the GPU";
+        case errc::trace_marker_unavailable:
+            return "Trace marker can't be opened or written";
+        case errc::metrics_listen_failed:
+            return "Metrics endpoint can't listen on the port";
+        case errc::metrics_accept_failed:
+            return "Metrics endpoint can't accept a connection";
+        case errc::database_blob_unavailable:
+            return "Counter database blob can't be opened or mapped";
+        case errc::invalid_database_blob:
+            return "Counter database blob is invalid or has an unsupported version";
+        case errc::runtime_pm_unavailable:
+            return "GPU runtime power management state not available";
 
         default:
             return "Unknown error";
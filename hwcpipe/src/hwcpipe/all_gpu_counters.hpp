@@ -10,18 +10,49 @@
 #include "hwcpipe/hwcpipe_counter.h"
 #include "hwcpipe/detail/internal_types.hpp"
 
-#include <unordered_map>
+#include <array>
+#include <cstddef>
 
 namespace hwcpipe {
 namespace database {
 
 /**
- * A type that maps from counter identifier to the block/offset address for a
- * particular GPU.
+ * The counters of a particular GPU product.
  */
-using gpu_counters_map = std::unordered_map<hwcpipe_counter, detail::counter_definition>;
+struct gpu_counter_table {
+    device::product_id id;
+    detail::counter_table counters;
 
-extern const std::unordered_map<device::product_id, gpu_counters_map> all_gpu_counters;
+    template <size_t num_shared>
+    constexpr gpu_counter_table(device::product_id id, const detail::counter_record (&shared)[num_shared])
+        : id(id)
+        , counters{shared, shared + num_shared, nullptr, nullptr} {}
+
+    template <size_t num_shared, size_t num_overrides>
+    constexpr gpu_counter_table(device::product_id id, const detail::counter_record (&shared)[num_shared],
+                                const detail::counter_record (&overrides)[num_overrides])
+        : id(id)
+        , counters{shared, shared + num_shared, overrides, overrides + num_overrides} {}
+};
+
+/**
+ * The counter tables of the GPU products of one family. Each family is built
+ * as a separate shard, and only the families listed in HWCPIPE_GPU_FAMILIES
+ * are compiled into the library.
+ */
+struct gpu_family_counters {
+    const gpu_counter_table *begin;
+    const gpu_counter_table *end;
+
+    template <size_t num_products>
+    constexpr gpu_family_counters(const std::array<gpu_counter_table, num_products> &tables)
+        : begin(&tables[0])
+        , end(&tables[0] + num_products) {}
+};
+
+extern const std::array<gpu_counter_table, 6> bifrost_gpu_counters;
+extern const std::array<gpu_counter_table, 12> valhall_gpu_counters;
+extern const std::array<gpu_counter_table, 7> fifthgen_gpu_counters;
 
 } // namespace database
 } // namespace hwcpipe
\ No newline at end of file
@@ -0,0 +1,729 @@
+/*
+ * Copyright (c) 2023-2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hwcpipe/all_gpu_counters.hpp"
+#include "hwcpipe/derived_functions.hpp"
+
+namespace hwcpipe {
+namespace database {
+
+    using hwcpipe::detail::counter_record;
+    using hwcpipe::device::hwcnt::block_type;
+
+namespace {
+
+    // Counter tables shared by all of the products with identical counters.
+
+    constexpr hwcpipe_counter g31_counters_dependencies[] {
+        hwcpipe_counter::MaliEngInstr,
+        hwcpipe_counter::MaliEngInstr, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliCoreActiveCy, hwcpipe_counter::MaliGPUActiveCy,
+        hwcpipe_counter::MaliEngDivergedInstr, hwcpipe_counter::MaliEngInstr,
+        hwcpipe_counter::MaliExtBusRdBt,
+        hwcpipe_counter::MaliExtBusRdBt, hwcpipe_counter::MaliExtBusRdLat0, hwcpipe_counter::MaliExtBusRdLat128, hwcpipe_counter::MaliExtBusRdLat192, hwcpipe_counter::MaliExtBusRdLat256, hwcpipe_counter::MaliExtBusRdLat320,
+        hwcpipe_counter::MaliExtBusRd, hwcpipe_counter::MaliExtBusRdOTQ1, hwcpipe_counter::MaliExtBusRdOTQ2, hwcpipe_counter::MaliExtBusRdOTQ3,
+        hwcpipe_counter::MaliExtBusRdStallCy, hwcpipe_counter::MaliGPUActiveCy,
+        hwcpipe_counter::MaliExtBusWrBt,
+        hwcpipe_counter::MaliExtBusWr, hwcpipe_counter::MaliExtBusWrOTQ1, hwcpipe_counter::MaliExtBusWrOTQ2, hwcpipe_counter::MaliExtBusWrOTQ3,
+        hwcpipe_counter::MaliExtBusWrStallCy, hwcpipe_counter::MaliGPUActiveCy,
+        hwcpipe_counter::MaliFragEZSKillQd, hwcpipe_counter::MaliFragRastQd,
+        hwcpipe_counter::MaliFragEZSTestQd, hwcpipe_counter::MaliFragRastQd,
+        hwcpipe_counter::MaliFragEZSUpdateQd, hwcpipe_counter::MaliFragRastQd,
+        hwcpipe_counter::MaliFragFPKActiveCy, hwcpipe_counter::MaliFragActiveCy,
+        hwcpipe_counter::MaliFragRastQd, hwcpipe_counter::MaliFragEZSKillQd, hwcpipe_counter::MaliFragWarp,
+        hwcpipe_counter::MaliFragRastQd, hwcpipe_counter::MaliFragEZSKillQd, hwcpipe_counter::MaliFragWarp,
+        hwcpipe_counter::MaliFragLZSKillQd, hwcpipe_counter::MaliFragRastQd,
+        hwcpipe_counter::MaliFragLZSTestQd, hwcpipe_counter::MaliFragRastQd,
+        hwcpipe_counter::MaliFragOpaqueQd, hwcpipe_counter::MaliFragRastQd, hwcpipe_counter::MaliFragEZSKillQd,
+        hwcpipe_counter::MaliFragWarp, hwcpipe_counter::MaliFragQueueTask,
+        hwcpipe_counter::MaliFragPartWarp, hwcpipe_counter::MaliFragWarp,
+        hwcpipe_counter::MaliFragQueueActiveCy, hwcpipe_counter::MaliGPUActiveCy,
+        hwcpipe_counter::MaliFragWarp,
+        hwcpipe_counter::MaliFragWarp,
+        hwcpipe_counter::MaliFragActiveCy, hwcpipe_counter::MaliFragWarp,
+        hwcpipe_counter::MaliFragTileKill, hwcpipe_counter::MaliFragTile,
+        hwcpipe_counter::MaliFragRastQd, hwcpipe_counter::MaliFragEZSKillQd, hwcpipe_counter::MaliFragOpaqueQd,
+        hwcpipe_counter::MaliFragActiveCy, hwcpipe_counter::MaliGPUActiveCy,
+        hwcpipe_counter::MaliGPUActiveCy, hwcpipe_counter::MaliFragQueueTask,
+        hwcpipe_counter::MaliGPUIRQActiveCy, hwcpipe_counter::MaliGPUActiveCy,
+        hwcpipe_counter::MaliFragQueueTask,
+        hwcpipe_counter::MaliGeomFaceXYPlaneCullPrim, hwcpipe_counter::MaliGeomZPlaneCullPrim, hwcpipe_counter::MaliGeomSampleCullPrim, hwcpipe_counter::MaliGeomVisiblePrim,
+        hwcpipe_counter::MaliGeomPosShadTask,
+        hwcpipe_counter::MaliGeomPosShadTask, hwcpipe_counter::MaliGeomFaceXYPlaneCullPrim, hwcpipe_counter::MaliGeomZPlaneCullPrim, hwcpipe_counter::MaliGeomSampleCullPrim, hwcpipe_counter::MaliGeomVisiblePrim,
+        hwcpipe_counter::MaliGeomSampleCullPrim, hwcpipe_counter::MaliGeomFaceXYPlaneCullPrim, hwcpipe_counter::MaliGeomZPlaneCullPrim, hwcpipe_counter::MaliGeomVisiblePrim,
+        hwcpipe_counter::MaliGeomFaceXYPlaneCullPrim, hwcpipe_counter::MaliGeomZPlaneCullPrim, hwcpipe_counter::MaliGeomSampleCullPrim,
+        hwcpipe_counter::MaliGeomFaceXYPlaneCullPrim, hwcpipe_counter::MaliGeomZPlaneCullPrim, hwcpipe_counter::MaliGeomSampleCullPrim, hwcpipe_counter::MaliGeomVisiblePrim,
+        hwcpipe_counter::MaliGeomVarShadTask,
+        hwcpipe_counter::MaliGeomVarShadTask, hwcpipe_counter::MaliGeomVisiblePrim,
+        hwcpipe_counter::MaliGeomVisiblePrim, hwcpipe_counter::MaliGeomFaceXYPlaneCullPrim, hwcpipe_counter::MaliGeomZPlaneCullPrim, hwcpipe_counter::MaliGeomSampleCullPrim,
+        hwcpipe_counter::MaliGeomZPlaneCullPrim, hwcpipe_counter::MaliGeomFaceXYPlaneCullPrim, hwcpipe_counter::MaliGeomSampleCullPrim, hwcpipe_counter::MaliGeomVisiblePrim,
+        hwcpipe_counter::MaliExtBusRd, hwcpipe_counter::MaliL2CacheRdLookup,
+        hwcpipe_counter::MaliExtBusWr, hwcpipe_counter::MaliL2CacheWrLookup,
+        hwcpipe_counter::MaliLSFullRd, hwcpipe_counter::MaliLSPartRd, hwcpipe_counter::MaliLSFullWr, hwcpipe_counter::MaliLSPartWr, hwcpipe_counter::MaliLSAtomic,
+        hwcpipe_counter::MaliLSFullRd, hwcpipe_counter::MaliLSPartRd,
+        hwcpipe_counter::MaliLSFullRd, hwcpipe_counter::MaliLSPartRd, hwcpipe_counter::MaliLSFullWr, hwcpipe_counter::MaliLSPartWr, hwcpipe_counter::MaliLSAtomic, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliLSFullWr, hwcpipe_counter::MaliLSPartWr,
+        hwcpipe_counter::MaliNonFragQueueActiveCy, hwcpipe_counter::MaliGPUActiveCy,
+        hwcpipe_counter::MaliNonFragWarp,
+        hwcpipe_counter::MaliNonFragActiveCy, hwcpipe_counter::MaliNonFragWarp,
+        hwcpipe_counter::MaliNonFragActiveCy, hwcpipe_counter::MaliGPUActiveCy,
+        hwcpipe_counter::MaliSCBusFFEExtRdBt,
+        hwcpipe_counter::MaliSCBusFFEL2RdBt,
+        hwcpipe_counter::MaliSCBusLSExtRdBt,
+        hwcpipe_counter::MaliSCBusLSExtRdBt, hwcpipe_counter::MaliLSFullRd, hwcpipe_counter::MaliLSPartRd,
+        hwcpipe_counter::MaliSCBusLSL2RdBt,
+        hwcpipe_counter::MaliSCBusLSL2RdBt, hwcpipe_counter::MaliLSFullRd, hwcpipe_counter::MaliLSPartRd,
+        hwcpipe_counter::MaliSCBusLSWBWrBt, hwcpipe_counter::MaliSCBusLSOtherWrBt,
+        hwcpipe_counter::MaliSCBusLSWBWrBt, hwcpipe_counter::MaliSCBusLSOtherWrBt,
+        hwcpipe_counter::MaliSCBusLSWBWrBt, hwcpipe_counter::MaliSCBusLSOtherWrBt, hwcpipe_counter::MaliLSFullWr, hwcpipe_counter::MaliLSPartWr,
+        hwcpipe_counter::MaliSCBusTexExtRdBt,
+        hwcpipe_counter::MaliSCBusTexExtRdBt, hwcpipe_counter::MaliTexFiltIssueCy,
+        hwcpipe_counter::MaliSCBusTexL2RdBt,
+        hwcpipe_counter::MaliSCBusTexL2RdBt, hwcpipe_counter::MaliTexFiltIssueCy,
+        hwcpipe_counter::MaliSCBusTileWrBt, hwcpipe_counter::MaliFragQueueTask,
+        hwcpipe_counter::MaliSCBusTileWrBt,
+        hwcpipe_counter::MaliTexFiltIssueCy, hwcpipe_counter::MaliTexQuads,
+        hwcpipe_counter::MaliTexCacheCompressFetch, hwcpipe_counter::MaliTexCacheFetch,
+        hwcpipe_counter::MaliTexCacheLookup, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliTexFiltIssueCy,
+        hwcpipe_counter::MaliTexQuadPassMip, hwcpipe_counter::MaliTexQuadPass,
+        hwcpipe_counter::MaliTexQuads,
+        hwcpipe_counter::MaliTexQuadPassTri, hwcpipe_counter::MaliTexQuads,
+        hwcpipe_counter::MaliTexFiltIssueCy, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliTilerPosCacheHit, hwcpipe_counter::MaliTilerPosCacheMiss,
+        hwcpipe_counter::MaliTilerActiveCy, hwcpipe_counter::MaliGPUActiveCy,
+        hwcpipe_counter::MaliTilerVarCacheHit, hwcpipe_counter::MaliTilerVarCacheMiss,
+        hwcpipe_counter::MaliVar16IssueSlot,
+        hwcpipe_counter::MaliVar32IssueSlot,
+        hwcpipe_counter::MaliVar32IssueSlot, hwcpipe_counter::MaliVar16IssueSlot,
+        hwcpipe_counter::MaliVar32IssueSlot, hwcpipe_counter::MaliVar16IssueSlot, hwcpipe_counter::MaliCoreActiveCy,
+    };
+
+    constexpr counter_record g31_counters[] {
+        {hwcpipe_counter::MaliALUIssueCy, MaliALUIssueCy_v0, formula_0_flat, formula_0_batch, g31_counters_dependencies + 0, 1},
+        {hwcpipe_counter::MaliALUUtil, MaliALUUtil_v0, formula_5_flat, formula_5_batch, g31_counters_dependencies + 1, 2},
+        {hwcpipe_counter::MaliAttrInstr, 52, 0, block_type::core},
+        {hwcpipe_counter::MaliCoreActiveCy, 26, 0, block_type::core},
+        {hwcpipe_counter::MaliCoreUtil, MaliCoreUtil_v0, formula_10_flat, formula_10_batch, g31_counters_dependencies + 3, 2},
+        {hwcpipe_counter::MaliEngDivergedInstr, 29, 0, block_type::core},
+        {hwcpipe_counter::MaliEngDivergedInstrRate, MaliEngDivergedInstrRate_v0, formula_5_flat, formula_5_batch, g31_counters_dependencies + 5, 2},
+        {hwcpipe_counter::MaliEngInstr, 28, 0, block_type::core},
+        {hwcpipe_counter::MaliEngStarveCy, 30, 0, block_type::core},
+        {hwcpipe_counter::MaliExtBusRd, 29, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdBt, 32, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdBy, MaliExtBusRdBy_v0, formula_21_flat, formula_21_batch, g31_counters_dependencies + 7, 1},
+        {hwcpipe_counter::MaliExtBusRdLat0, 37, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdLat128, 38, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdLat192, 39, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdLat256, 40, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdLat320, 41, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdLat384, MaliExtBusRdLat384_v0, formula_22_flat, formula_22_batch, g31_counters_dependencies + 8, 6},
+        {hwcpipe_counter::MaliExtBusRdNoSnoop, 30, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdOTQ1, 34, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdOTQ2, 35, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdOTQ3, 36, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdOTQ4, MaliExtBusRdOTQ4_v0, formula_23_flat, formula_23_batch, g31_counters_dependencies + 14, 4},
+        {hwcpipe_counter::MaliExtBusRdStallCy, 33, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdStallRate, MaliExtBusRdStallRate_v0, formula_24_flat, formula_24_batch, g31_counters_dependencies + 18, 2},
+        {hwcpipe_counter::MaliExtBusRdUnique, 31, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWr, 42, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrBt, 47, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrBy, MaliExtBusWrBy_v0, formula_21_flat, formula_21_batch, g31_counters_dependencies + 20, 1},
+        {hwcpipe_counter::MaliExtBusWrNoSnoopFull, 43, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrNoSnoopPart, 44, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrOTQ1, 49, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrOTQ2, 50, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrOTQ3, 51, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrOTQ4, MaliExtBusWrOTQ4_v0, formula_23_flat, formula_23_batch, g31_counters_dependencies + 21, 4},
+        {hwcpipe_counter::MaliExtBusWrSnoopFull, 45, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrSnoopPart, 46, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrStallCy, 48, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrStallRate, MaliExtBusWrStallRate_v0, formula_24_flat, formula_24_batch, g31_counters_dependencies + 25, 2},
+        {hwcpipe_counter::MaliFragActiveCy, 4, 0, block_type::core},
+        {hwcpipe_counter::MaliFragEZSKillQd, 14, 0, block_type::core},
+        {hwcpipe_counter::MaliFragEZSKillRate, MaliFragEZSKillRate_v0, formula_5_flat, formula_5_batch, g31_counters_dependencies + 27, 2},
+        {hwcpipe_counter::MaliFragEZSTestQd, 12, 0, block_type::core},
+        {hwcpipe_counter::MaliFragEZSTestRate, MaliFragEZSTestRate_v0, formula_5_flat, formula_5_batch, g31_counters_dependencies + 29, 2},
+        {hwcpipe_counter::MaliFragEZSUpdateQd, 13, 0, block_type::core},
+        {hwcpipe_counter::MaliFragEZSUpdateRate, MaliFragEZSUpdateRate_v0, formula_5_flat, formula_5_batch, g31_counters_dependencies + 31, 2},
+        {hwcpipe_counter::MaliFragFPKActiveCy, 7, 0, block_type::core},
+        {hwcpipe_counter::MaliFragFPKBUtil, MaliFragFPKBUtil_v0, formula_5_flat, formula_5_batch, g31_counters_dependencies + 33, 2},
+        {hwcpipe_counter::MaliFragFPKKillQd, MaliFragFPKKillQd_v0, formula_25_flat, formula_25_batch, g31_counters_dependencies + 35, 3},
+        {hwcpipe_counter::MaliFragFPKKillRate, MaliFragFPKKillRate_v0, formula_28_flat, formula_28_batch, g31_counters_dependencies + 38, 3},
+        {hwcpipe_counter::MaliFragLZSKillQd, 16, 0, block_type::core},
+        {hwcpipe_counter::MaliFragLZSKillRate, MaliFragLZSKillRate_v0, formula_5_flat, formula_5_batch, g31_counters_dependencies + 41, 2},
+        {hwcpipe_counter::MaliFragLZSTestQd, 15, 0, block_type::core},
+        {hwcpipe_counter::MaliFragLZSTestRate, MaliFragLZSTestRate_v0, formula_5_flat, formula_5_batch, g31_counters_dependencies + 43, 2},
+        {hwcpipe_counter::MaliFragOpaqueQd, 20, 0, block_type::core},
+        {hwcpipe_counter::MaliFragOpaqueQdRate, MaliFragOpaqueQdRate_v0, formula_34_flat, formula_34_batch, g31_counters_dependencies + 45, 3},
+        {hwcpipe_counter::MaliFragOverdraw, MaliFragOverdraw_v0, formula_35_flat, formula_35_batch, g31_counters_dependencies + 48, 2},
+        {hwcpipe_counter::MaliFragPartWarp, 10, 0, block_type::core},
+        {hwcpipe_counter::MaliFragPartWarpRate, MaliFragPartWarpRate_v0, formula_5_flat, formula_5_batch, g31_counters_dependencies + 50, 2},
+        {hwcpipe_counter::MaliFragQueueActiveCy, 10, 0, block_type::fe},
+        {hwcpipe_counter::MaliFragQueueJob, 8, 0, block_type::fe},
+        {hwcpipe_counter::MaliFragQueueTask, 9, 0, block_type::fe},
+        {hwcpipe_counter::MaliFragQueueUtil, MaliFragQueueUtil_v0, formula_5_flat, formula_5_batch, g31_counters_dependencies + 52, 2},
+        {hwcpipe_counter::MaliFragQueueWaitDepCy, 14, 0, block_type::fe},
+        {hwcpipe_counter::MaliFragQueueWaitFinishCy, 15, 0, block_type::fe},
+        {hwcpipe_counter::MaliFragQueueWaitFlushCy, 11, 0, block_type::fe},
+        {hwcpipe_counter::MaliFragQueueWaitIssueCy, 13, 0, block_type::fe},
+        {hwcpipe_counter::MaliFragQueueWaitRdCy, 12, 0, block_type::fe},
+        {hwcpipe_counter::MaliFragRastPrim, 6, 0, block_type::core},
+        {hwcpipe_counter::MaliFragRastQd, 11, 0, block_type::core},
+        {hwcpipe_counter::MaliFragRdPrim, 5, 0, block_type::core},
+        {hwcpipe_counter::MaliFragShadedQd, MaliFragShadedQd_v0, formula_0_flat, formula_0_batch, g31_counters_dependencies + 54, 1},
+        {hwcpipe_counter::MaliFragThread, MaliFragThread_v0, formula_47_flat, formula_47_batch, g31_counters_dependencies + 55, 1},
+        {hwcpipe_counter::MaliFragThroughputCy, MaliFragThroughputCy_v0, formula_49_flat, formula_49_batch, g31_counters_dependencies + 56, 2},
+        {hwcpipe_counter::MaliFragTile, 18, 0, block_type::core},
+        {hwcpipe_counter::MaliFragTileKill, 19, 0, block_type::core},
+        {hwcpipe_counter::MaliFragTileKillRate, MaliFragTileKillRate_v0, formula_5_flat, formula_5_batch, g31_counters_dependencies + 58, 2},
+        {hwcpipe_counter::MaliFragTransparentQd, MaliFragTransparentQd_v0, formula_25_flat, formula_25_batch, g31_counters_dependencies + 60, 3},
+        {hwcpipe_counter::MaliFragUtil, MaliFragUtil_v0, formula_10_flat, formula_10_batch, g31_counters_dependencies + 63, 2},
+        {hwcpipe_counter::MaliFragWarp, 9, 0, block_type::core},
+        {hwcpipe_counter::MaliGPUActiveCy, 6, 0, block_type::fe},
+        {hwcpipe_counter::MaliGPUCyPerPix, MaliGPUCyPerPix_v0, formula_38_flat, formula_38_batch, g31_counters_dependencies + 65, 2},
+        {hwcpipe_counter::MaliGPUIRQActiveCy, 7, 0, block_type::fe},
+        {hwcpipe_counter::MaliGPUIRQUtil, MaliGPUIRQUtil_v0, formula_5_flat, formula_5_batch, g31_counters_dependencies + 67, 2},
+        {hwcpipe_counter::MaliGPUPix, MaliGPUPix_v0, formula_54_flat, formula_54_batch, g31_counters_dependencies + 69, 1},
+        {hwcpipe_counter::MaliGeomBackFacePrim, 10, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomFaceXYPlaneCullPrim, 12, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomFaceXYPlaneCullRate, MaliGeomFaceXYPlaneCullRate_v0, formula_56_flat, formula_56_batch, g31_counters_dependencies + 70, 4},
+        {hwcpipe_counter::MaliGeomFrontFacePrim, 9, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomLinePrim, 7, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomPointPrim, 8, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomPosShadTask, 21, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomPosShadThread, MaliGeomPosShadThread_v0, formula_47_flat, formula_47_batch, g31_counters_dependencies + 74, 1},
+        {hwcpipe_counter::MaliGeomPosShadThreadPerPrim, MaliGeomPosShadThreadPerPrim_v0, formula_60_flat, formula_60_batch, g31_counters_dependencies + 75, 5},
+        {hwcpipe_counter::MaliGeomSampleCullPrim, 14, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomSampleCullRate, MaliGeomSampleCullRate_v0, formula_63_flat, formula_63_batch, g31_counters_dependencies + 80, 4},
+        {hwcpipe_counter::MaliGeomTotalCullPrim, MaliGeomTotalCullPrim_v0, formula_15_flat, formula_15_batch, g31_counters_dependencies + 84, 3},
+        {hwcpipe_counter::MaliGeomTotalPrim, MaliGeomTotalPrim_v0, formula_66_flat, formula_66_batch, g31_counters_dependencies + 87, 4},
+        {hwcpipe_counter::MaliGeomTrianglePrim, 6, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomVarShadTask, 37, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomVarShadThread, MaliGeomVarShadThread_v0, formula_47_flat, formula_47_batch, g31_counters_dependencies + 91, 1},
+        {hwcpipe_counter::MaliGeomVarShadThreadPerPrim, MaliGeomVarShadThreadPerPrim_v0, formula_68_flat, formula_68_batch, g31_counters_dependencies + 92, 2},
+        {hwcpipe_counter::MaliGeomVisiblePrim, 11, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomVisibleRate, MaliGeomVisibleRate_v0, formula_69_flat, formula_69_batch, g31_counters_dependencies + 94, 4},
+        {hwcpipe_counter::MaliGeomZPlaneCullPrim, 13, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomZPlaneCullRate, MaliGeomZPlaneCullRate_v0, formula_58_flat, formula_58_batch, g31_counters_dependencies + 98, 4},
+        {hwcpipe_counter::MaliL2CacheFlush, 63, 0, block_type::fe},
+        {hwcpipe_counter::MaliL2CacheIncSnp, 52, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheIncSnpStallCy, 53, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheL1Rd, 22, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheL1RdStallCy, 23, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheL1Wr, 24, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheLookup, 25, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheRd, 16, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheRdLookup, 26, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheRdMissRate, MaliL2CacheRdMissRate_v0, formula_5_flat, formula_5_batch, g31_counters_dependencies + 102, 2},
+        {hwcpipe_counter::MaliL2CacheRdStallCy, 17, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheSnp, 20, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheSnpLookup, 28, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheSnpStallCy, 21, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheWr, 18, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheWrLookup, 27, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheWrMissRate, MaliL2CacheWrMissRate_v0, formula_5_flat, formula_5_batch, g31_counters_dependencies + 104, 2},
+        {hwcpipe_counter::MaliL2CacheWrStallCy, 19, 0, block_type::memory},
+        {hwcpipe_counter::MaliLSAtomic, 48, 0, block_type::core},
+        {hwcpipe_counter::MaliLSFullRd, 44, 0, block_type::core},
+        {hwcpipe_counter::MaliLSFullWr, 46, 0, block_type::core},
+        {hwcpipe_counter::MaliLSIssueCy, MaliLSIssueCy_v0, formula_67_flat, formula_67_batch, g31_counters_dependencies + 106, 5},
+        {hwcpipe_counter::MaliLSPartRd, 45, 0, block_type::core},
+        {hwcpipe_counter::MaliLSPartWr, 47, 0, block_type::core},
+        {hwcpipe_counter::MaliLSRdCy, MaliLSRdCy_v0, formula_71_flat, formula_71_batch, g31_counters_dependencies + 111, 2},
+        {hwcpipe_counter::MaliLSUtil, MaliLSUtil_v0, formula_72_flat, formula_72_batch, g31_counters_dependencies + 113, 6},
+        {hwcpipe_counter::MaliLSWrCy, MaliLSWrCy_v0, formula_71_flat, formula_71_batch, g31_counters_dependencies + 119, 2},
+        {hwcpipe_counter::MaliMMUL2Hit, 8, 0, block_type::memory},
+        {hwcpipe_counter::MaliMMUL2Rd, 6, 0, block_type::memory},
+        {hwcpipe_counter::MaliMMUL3Hit, 7, 0, block_type::memory},
+        {hwcpipe_counter::MaliMMUL3Rd, 5, 0, block_type::memory},
+        {hwcpipe_counter::MaliMMULookup, 4, 0, block_type::memory},
+        {hwcpipe_counter::MaliMMUS2L2Hit, 13, 0, block_type::memory},
+        {hwcpipe_counter::MaliMMUS2L2Rd, 11, 0, block_type::memory},
+        {hwcpipe_counter::MaliMMUS2L3Hit, 12, 0, block_type::memory},
+        {hwcpipe_counter::MaliMMUS2L3Rd, 10, 0, block_type::memory},
+        {hwcpipe_counter::MaliMMUS2Lookup, 9, 0, block_type::memory},
+        {hwcpipe_counter::MaliNonFragActiveCy, 22, 0, block_type::core},
+        {hwcpipe_counter::MaliNonFragQueueActiveCy, 18, 0, block_type::fe},
+        {hwcpipe_counter::MaliNonFragQueueJob, 16, 0, block_type::fe},
+        {hwcpipe_counter::MaliNonFragQueueTask, 17, 0, block_type::fe},
+        {hwcpipe_counter::MaliNonFragQueueUtil, MaliNonFragQueueUtil_v0, formula_5_flat, formula_5_batch, g31_counters_dependencies + 121, 2},
+        {hwcpipe_counter::MaliNonFragQueueWaitDepCy, 22, 0, block_type::fe},
+        {hwcpipe_counter::MaliNonFragQueueWaitFinishCy, 23, 0, block_type::fe},
+        {hwcpipe_counter::MaliNonFragQueueWaitFlushCy, 19, 0, block_type::fe},
+        {hwcpipe_counter::MaliNonFragQueueWaitIssueCy, 21, 0, block_type::fe},
+        {hwcpipe_counter::MaliNonFragQueueWaitRdCy, 20, 0, block_type::fe},
+        {hwcpipe_counter::MaliNonFragTask, 23, 0, block_type::core},
+        {hwcpipe_counter::MaliNonFragThread, MaliNonFragThread_v0, formula_47_flat, formula_47_batch, g31_counters_dependencies + 123, 1},
+        {hwcpipe_counter::MaliNonFragThroughputCy, MaliNonFragThroughputCy_v0, formula_49_flat, formula_49_batch, g31_counters_dependencies + 124, 2},
+        {hwcpipe_counter::MaliNonFragUtil, MaliNonFragUtil_v0, formula_10_flat, formula_10_batch, g31_counters_dependencies + 126, 2},
+        {hwcpipe_counter::MaliNonFragWarp, 24, 0, block_type::core},
+        {hwcpipe_counter::MaliResQueueActiveCy, 26, 0, block_type::fe},
+        {hwcpipe_counter::MaliResQueueJob, 24, 0, block_type::fe},
+        {hwcpipe_counter::MaliResQueueTask, 25, 0, block_type::fe},
+        {hwcpipe_counter::MaliResQueueWaitDepCy, 30, 0, block_type::fe},
+        {hwcpipe_counter::MaliResQueueWaitFinishCy, 31, 0, block_type::fe},
+        {hwcpipe_counter::MaliResQueueWaitFlushCy, 27, 0, block_type::fe},
+        {hwcpipe_counter::MaliResQueueWaitIssueCy, 29, 0, block_type::fe},
+        {hwcpipe_counter::MaliResQueueWaitRdCy, 28, 0, block_type::fe},
+        {hwcpipe_counter::MaliSCBusFFEExtRdBt, 55, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusFFEExtRdBy, MaliSCBusFFEExtRdBy_v0, formula_43_flat, formula_43_batch, g31_counters_dependencies + 128, 1},
+        {hwcpipe_counter::MaliSCBusFFEL2RdBt, 54, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusFFEL2RdBy, MaliSCBusFFEL2RdBy_v0, formula_43_flat, formula_43_batch, g31_counters_dependencies + 129, 1},
+        {hwcpipe_counter::MaliSCBusLSExtRdBt, 57, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusLSExtRdBy, MaliSCBusLSExtRdBy_v0, formula_43_flat, formula_43_batch, g31_counters_dependencies + 130, 1},
+        {hwcpipe_counter::MaliSCBusLSExtRdByPerRd, MaliSCBusLSExtRdByPerRd_v0, formula_75_flat, formula_75_batch, g31_counters_dependencies + 131, 3},
+        {hwcpipe_counter::MaliSCBusLSL2RdBt, 56, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusLSL2RdBy, MaliSCBusLSL2RdBy_v0, formula_43_flat, formula_43_batch, g31_counters_dependencies + 134, 1},
+        {hwcpipe_counter::MaliSCBusLSL2RdByPerRd, MaliSCBusLSL2RdByPerRd_v0, formula_75_flat, formula_75_batch, g31_counters_dependencies + 135, 3},
+        {hwcpipe_counter::MaliSCBusLSOtherWrBt, 63, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusLSWBWrBt, 61, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusLSWrBt, MaliSCBusLSWrBt_v0, formula_71_flat, formula_71_batch, g31_counters_dependencies + 138, 2},
+        {hwcpipe_counter::MaliSCBusLSWrBy, MaliSCBusLSWrBy_v0, formula_77_flat, formula_77_batch, g31_counters_dependencies + 140, 2},
+        {hwcpipe_counter::MaliSCBusLSWrByPerWr, MaliSCBusLSWrByPerWr_v0, formula_76_flat, formula_76_batch, g31_counters_dependencies + 142, 4},
+        {hwcpipe_counter::MaliSCBusOtherL2RdBt, 60, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusTexExtRdBt, 59, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusTexExtRdBy, MaliSCBusTexExtRdBy_v0, formula_43_flat, formula_43_batch, g31_counters_dependencies + 146, 1},
+        {hwcpipe_counter::MaliSCBusTexExtRdByPerRd, MaliSCBusTexExtRdByPerRd_v0, formula_78_flat, formula_78_batch, g31_counters_dependencies + 147, 2},
+        {hwcpipe_counter::MaliSCBusTexL2RdBt, 58, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusTexL2RdBy, MaliSCBusTexL2RdBy_v0, formula_43_flat, formula_43_batch, g31_counters_dependencies + 149, 1},
+        {hwcpipe_counter::MaliSCBusTexL2RdByPerRd, MaliSCBusTexL2RdByPerRd_v0, formula_78_flat, formula_78_batch, g31_counters_dependencies + 150, 2},
+        {hwcpipe_counter::MaliSCBusTileWrBPerPx, MaliSCBusTileWrBPerPx_v0, formula_37_flat, formula_37_batch, g31_counters_dependencies + 152, 2},
+        {hwcpipe_counter::MaliSCBusTileWrBt, 62, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusTileWrBy, MaliSCBusTileWrBy_v0, formula_43_flat, formula_43_batch, g31_counters_dependencies + 154, 1},
+        {hwcpipe_counter::MaliTexCPI, MaliTexCPI_v0, formula_49_flat, formula_49_batch, g31_counters_dependencies + 155, 2},
+        {hwcpipe_counter::MaliTexCacheCompressFetch, 41, 0, block_type::core},
+        {hwcpipe_counter::MaliTexCacheCompressFetchRate, MaliTexCacheCompressFetchRate_v0, formula_5_flat, formula_5_batch, g31_counters_dependencies + 157, 2},
+        {hwcpipe_counter::MaliTexCacheFetch, 40, 0, block_type::core},
+        {hwcpipe_counter::MaliTexCacheLookup, 42, 0, block_type::core},
+        {hwcpipe_counter::MaliTexCacheUtil, MaliTexCacheUtil_v0, formula_5_flat, formula_5_batch, g31_counters_dependencies + 159, 2},
+        {hwcpipe_counter::MaliTexFiltIssueCy, 43, 0, block_type::core},
+        {hwcpipe_counter::MaliTexIssueCy, MaliTexIssueCy_v0, formula_0_flat, formula_0_batch, g31_counters_dependencies + 161, 1},
+        {hwcpipe_counter::MaliTexMipInstrRate, MaliTexMipInstrRate_v0, formula_5_flat, formula_5_batch, g31_counters_dependencies + 162, 2},
+        {hwcpipe_counter::MaliTexQuadPass, 36, 0, block_type::core},
+        {hwcpipe_counter::MaliTexQuadPassDescMiss, 37, 0, block_type::core},
+        {hwcpipe_counter::MaliTexQuadPassMip, 38, 0, block_type::core},
+        {hwcpipe_counter::MaliTexQuadPassTri, 39, 0, block_type::core},
+        {hwcpipe_counter::MaliTexQuads, 35, 0, block_type::core},
+        {hwcpipe_counter::MaliTexSample, MaliTexSample_v0, formula_47_flat, formula_47_batch, g31_counters_dependencies + 164, 1},
+        {hwcpipe_counter::MaliTexTriInstrRate, MaliTexTriInstrRate_v0, formula_5_flat, formula_5_batch, g31_counters_dependencies + 165, 2},
+        {hwcpipe_counter::MaliTexUtil, MaliTexUtil_v0, formula_5_flat, formula_5_batch, g31_counters_dependencies + 167, 2},
+        {hwcpipe_counter::MaliTilerActiveCy, 4, 0, block_type::tiler},
+        {hwcpipe_counter::MaliTilerPosCacheHit, 26, 0, block_type::tiler},
+        {hwcpipe_counter::MaliTilerPosCacheHitRate, MaliTilerPosCacheHitRate_v0, formula_89_flat, formula_89_batch, g31_counters_dependencies + 169, 2},
+        {hwcpipe_counter::MaliTilerPosCacheMiss, 27, 0, block_type::tiler},
+        {hwcpipe_counter::MaliTilerPosShadFIFOFullCy, 24, 0, block_type::tiler},
+        {hwcpipe_counter::MaliTilerPosShadStallCy, 23, 0, block_type::tiler},
+        {hwcpipe_counter::MaliTilerRdBt, 17, 0, block_type::tiler},
+        {hwcpipe_counter::MaliTilerUtil, MaliTilerUtil_v0, formula_5_flat, formula_5_batch, g31_counters_dependencies + 171, 2},
+        {hwcpipe_counter::MaliTilerVarCacheHit, 34, 0, block_type::tiler},
+        {hwcpipe_counter::MaliTilerVarCacheHitRate, MaliTilerVarCacheHitRate_v0, formula_89_flat, formula_89_batch, g31_counters_dependencies + 173, 2},
+        {hwcpipe_counter::MaliTilerVarCacheMiss, 35, 0, block_type::tiler},
+        {hwcpipe_counter::MaliTilerVarShadStallCy, 38, 0, block_type::tiler},
+        {hwcpipe_counter::MaliTilerWrBt, 19, 0, block_type::tiler},
+        {hwcpipe_counter::MaliVar16IssueCy, MaliVar16IssueCy_v0, formula_0_flat, formula_0_batch, g31_counters_dependencies + 175, 1},
+        {hwcpipe_counter::MaliVar16IssueSlot, 51, 0, block_type::core},
+        {hwcpipe_counter::MaliVar32IssueCy, MaliVar32IssueCy_v0, formula_0_flat, formula_0_batch, g31_counters_dependencies + 176, 1},
+        {hwcpipe_counter::MaliVar32IssueSlot, 50, 0, block_type::core},
+        {hwcpipe_counter::MaliVarInstr, 49, 0, block_type::core},
+        {hwcpipe_counter::MaliVarIssueCy, MaliVarIssueCy_v0, formula_71_flat, formula_71_batch, g31_counters_dependencies + 177, 2},
+        {hwcpipe_counter::MaliVarUtil, MaliVarUtil_v0, formula_82_flat, formula_82_batch, g31_counters_dependencies + 179, 3},
+    };
+
+    constexpr hwcpipe_counter g71_counters_dependencies[] {
+        hwcpipe_counter::MaliEngInstr,
+        hwcpipe_counter::MaliEngInstr, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliCoreActiveCy, hwcpipe_counter::MaliGPUActiveCy,
+        hwcpipe_counter::MaliEngDivergedInstr, hwcpipe_counter::MaliEngInstr,
+        hwcpipe_counter::MaliExtBusRdBt,
+        hwcpipe_counter::MaliExtBusRdBt, hwcpipe_counter::MaliExtBusRdLat0, hwcpipe_counter::MaliExtBusRdLat128, hwcpipe_counter::MaliExtBusRdLat192, hwcpipe_counter::MaliExtBusRdLat256, hwcpipe_counter::MaliExtBusRdLat320,
+        hwcpipe_counter::MaliExtBusRd, hwcpipe_counter::MaliExtBusRdOTQ1, hwcpipe_counter::MaliExtBusRdOTQ2, hwcpipe_counter::MaliExtBusRdOTQ3,
+        hwcpipe_counter::MaliExtBusRdStallCy, hwcpipe_counter::MaliGPUActiveCy,
+        hwcpipe_counter::MaliExtBusWrBt,
+        hwcpipe_counter::MaliExtBusWr, hwcpipe_counter::MaliExtBusWrOTQ1, hwcpipe_counter::MaliExtBusWrOTQ2, hwcpipe_counter::MaliExtBusWrOTQ3,
+        hwcpipe_counter::MaliExtBusWrStallCy, hwcpipe_counter::MaliGPUActiveCy,
+        hwcpipe_counter::MaliFragEZSKillQd, hwcpipe_counter::MaliFragRastQd,
+        hwcpipe_counter::MaliFragEZSTestQd, hwcpipe_counter::MaliFragRastQd,
+        hwcpipe_counter::MaliFragEZSUpdateQd, hwcpipe_counter::MaliFragRastQd,
+        hwcpipe_counter::MaliFragFPKActiveCy, hwcpipe_counter::MaliFragActiveCy,
+        hwcpipe_counter::MaliFragRastQd, hwcpipe_counter::MaliFragEZSKillQd, hwcpipe_counter::MaliFragWarp,
+        hwcpipe_counter::MaliFragRastQd, hwcpipe_counter::MaliFragEZSKillQd, hwcpipe_counter::MaliFragWarp,
+        hwcpipe_counter::MaliFragLZSKillQd, hwcpipe_counter::MaliFragRastQd,
+        hwcpipe_counter::MaliFragLZSTestQd, hwcpipe_counter::MaliFragRastQd,
+        hwcpipe_counter::MaliFragOpaqueQd, hwcpipe_counter::MaliFragRastQd, hwcpipe_counter::MaliFragEZSKillQd,
+        hwcpipe_counter::MaliFragWarp, hwcpipe_counter::MaliFragQueueTask,
+        hwcpipe_counter::MaliFragPartWarp, hwcpipe_counter::MaliFragWarp,
+        hwcpipe_counter::MaliFragQueueActiveCy, hwcpipe_counter::MaliGPUActiveCy,
+        hwcpipe_counter::MaliFragWarp,
+        hwcpipe_counter::MaliFragWarp,
+        hwcpipe_counter::MaliFragActiveCy, hwcpipe_counter::MaliFragWarp,
+        hwcpipe_counter::MaliFragTileKill, hwcpipe_counter::MaliFragTile,
+        hwcpipe_counter::MaliFragRastQd, hwcpipe_counter::MaliFragEZSKillQd, hwcpipe_counter::MaliFragOpaqueQd,
+        hwcpipe_counter::MaliFragActiveCy, hwcpipe_counter::MaliGPUActiveCy,
+        hwcpipe_counter::MaliGPUActiveCy, hwcpipe_counter::MaliFragQueueTask,
+        hwcpipe_counter::MaliGPUIRQActiveCy, hwcpipe_counter::MaliGPUActiveCy,
+        hwcpipe_counter::MaliFragQueueTask,
+        hwcpipe_counter::MaliGeomFaceXYPlaneCullPrim, hwcpipe_counter::MaliGeomZPlaneCullPrim, hwcpipe_counter::MaliGeomSampleCullPrim, hwcpipe_counter::MaliGeomVisiblePrim,
+        hwcpipe_counter::MaliGeomPosShadTask,
+        hwcpipe_counter::MaliGeomPosShadTask, hwcpipe_counter::MaliGeomFaceXYPlaneCullPrim, hwcpipe_counter::MaliGeomZPlaneCullPrim, hwcpipe_counter::MaliGeomSampleCullPrim, hwcpipe_counter::MaliGeomVisiblePrim,
+        hwcpipe_counter::MaliGeomSampleCullPrim, hwcpipe_counter::MaliGeomFaceXYPlaneCullPrim, hwcpipe_counter::MaliGeomZPlaneCullPrim, hwcpipe_counter::MaliGeomVisiblePrim,
+        hwcpipe_counter::MaliGeomFaceXYPlaneCullPrim, hwcpipe_counter::MaliGeomZPlaneCullPrim, hwcpipe_counter::MaliGeomSampleCullPrim,
+        hwcpipe_counter::MaliGeomFaceXYPlaneCullPrim, hwcpipe_counter::MaliGeomZPlaneCullPrim, hwcpipe_counter::MaliGeomSampleCullPrim, hwcpipe_counter::MaliGeomVisiblePrim,
+        hwcpipe_counter::MaliGeomVarShadTask,
+        hwcpipe_counter::MaliGeomVarShadTask, hwcpipe_counter::MaliGeomVisiblePrim,
+        hwcpipe_counter::MaliGeomVisiblePrim, hwcpipe_counter::MaliGeomFaceXYPlaneCullPrim, hwcpipe_counter::MaliGeomZPlaneCullPrim, hwcpipe_counter::MaliGeomSampleCullPrim,
+        hwcpipe_counter::MaliGeomZPlaneCullPrim, hwcpipe_counter::MaliGeomFaceXYPlaneCullPrim, hwcpipe_counter::MaliGeomSampleCullPrim, hwcpipe_counter::MaliGeomVisiblePrim,
+        hwcpipe_counter::MaliExtBusRd, hwcpipe_counter::MaliL2CacheRdLookup,
+        hwcpipe_counter::MaliExtBusWr, hwcpipe_counter::MaliL2CacheWrLookup,
+        hwcpipe_counter::MaliLSFullRd, hwcpipe_counter::MaliLSPartRd, hwcpipe_counter::MaliLSFullWr, hwcpipe_counter::MaliLSPartWr, hwcpipe_counter::MaliLSAtomic,
+        hwcpipe_counter::MaliLSFullRd, hwcpipe_counter::MaliLSPartRd,
+        hwcpipe_counter::MaliLSFullRd, hwcpipe_counter::MaliLSPartRd, hwcpipe_counter::MaliLSFullWr, hwcpipe_counter::MaliLSPartWr, hwcpipe_counter::MaliLSAtomic, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliLSFullWr, hwcpipe_counter::MaliLSPartWr,
+        hwcpipe_counter::MaliNonFragQueueActiveCy, hwcpipe_counter::MaliGPUActiveCy,
+        hwcpipe_counter::MaliNonFragWarp,
+        hwcpipe_counter::MaliNonFragActiveCy, hwcpipe_counter::MaliNonFragWarp,
+        hwcpipe_counter::MaliNonFragActiveCy, hwcpipe_counter::MaliGPUActiveCy,
+        hwcpipe_counter::MaliSCBusFFEExtRdBt,
+        hwcpipe_counter::MaliSCBusFFEL2RdBt,
+        hwcpipe_counter::MaliSCBusLSExtRdBt,
+        hwcpipe_counter::MaliSCBusLSExtRdBt, hwcpipe_counter::MaliLSFullRd, hwcpipe_counter::MaliLSPartRd,
+        hwcpipe_counter::MaliSCBusLSL2RdBt,
+        hwcpipe_counter::MaliSCBusLSL2RdBt, hwcpipe_counter::MaliLSFullRd, hwcpipe_counter::MaliLSPartRd,
+        hwcpipe_counter::MaliSCBusLSWrBt,
+        hwcpipe_counter::MaliSCBusLSWrBt, hwcpipe_counter::MaliLSFullWr, hwcpipe_counter::MaliLSPartWr,
+        hwcpipe_counter::MaliSCBusTexExtRdBt,
+        hwcpipe_counter::MaliSCBusTexExtRdBt, hwcpipe_counter::MaliTexFiltIssueCy,
+        hwcpipe_counter::MaliSCBusTexL2RdBt,
+        hwcpipe_counter::MaliSCBusTexL2RdBt, hwcpipe_counter::MaliTexFiltIssueCy,
+        hwcpipe_counter::MaliSCBusTileWrBt, hwcpipe_counter::MaliFragQueueTask,
+        hwcpipe_counter::MaliSCBusTileWrBt,
+        hwcpipe_counter::MaliTexFiltIssueCy, hwcpipe_counter::MaliTexInstr,
+        hwcpipe_counter::MaliTexFiltIssueCy,
+        hwcpipe_counter::MaliTexMipInstr, hwcpipe_counter::MaliTexInstr,
+        hwcpipe_counter::MaliTexInstr,
+        hwcpipe_counter::MaliTexTriInstr, hwcpipe_counter::MaliTexInstr,
+        hwcpipe_counter::MaliTexFiltIssueCy, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliTilerPosCacheHit, hwcpipe_counter::MaliTilerPosCacheMiss,
+        hwcpipe_counter::MaliTilerActiveCy, hwcpipe_counter::MaliGPUActiveCy,
+        hwcpipe_counter::MaliTilerVarCacheHit, hwcpipe_counter::MaliTilerVarCacheMiss,
+        hwcpipe_counter::MaliVar16IssueSlot,
+        hwcpipe_counter::MaliVar32IssueSlot,
+        hwcpipe_counter::MaliVar32IssueSlot, hwcpipe_counter::MaliVar16IssueSlot,
+        hwcpipe_counter::MaliVar32IssueSlot, hwcpipe_counter::MaliVar16IssueSlot, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliSCBusOtherWrBt,
+        hwcpipe_counter::MaliTex3DInstr, hwcpipe_counter::MaliTexInstr,
+        hwcpipe_counter::MaliTexCompressInstr, hwcpipe_counter::MaliTexInstr,
+    };
+
+    constexpr counter_record g71_counters[] {
+        {hwcpipe_counter::MaliALUIssueCy, MaliALUIssueCy_v0, formula_0_flat, formula_0_batch, g71_counters_dependencies + 0, 1},
+        {hwcpipe_counter::MaliALUUtil, MaliALUUtil_v0, formula_5_flat, formula_5_batch, g71_counters_dependencies + 1, 2},
+        {hwcpipe_counter::MaliAttrInstr, 52, 0, block_type::core},
+        {hwcpipe_counter::MaliCoreActiveCy, 26, 0, block_type::core},
+        {hwcpipe_counter::MaliCoreUtil, MaliCoreUtil_v0, formula_10_flat, formula_10_batch, g71_counters_dependencies + 3, 2},
+        {hwcpipe_counter::MaliEngDivergedInstr, 29, 0, block_type::core},
+        {hwcpipe_counter::MaliEngDivergedInstrRate, MaliEngDivergedInstrRate_v0, formula_5_flat, formula_5_batch, g71_counters_dependencies + 5, 2},
+        {hwcpipe_counter::MaliEngInstr, 28, 0, block_type::core},
+        {hwcpipe_counter::MaliEngStarveCy, 30, 0, block_type::core},
+        {hwcpipe_counter::MaliExtBusRd, 29, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdBt, 32, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdBy, MaliExtBusRdBy_v0, formula_21_flat, formula_21_batch, g71_counters_dependencies + 7, 1},
+        {hwcpipe_counter::MaliExtBusRdLat0, 37, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdLat128, 38, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdLat192, 39, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdLat256, 40, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdLat320, 41, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdLat384, MaliExtBusRdLat384_v0, formula_22_flat, formula_22_batch, g71_counters_dependencies + 8, 6},
+        {hwcpipe_counter::MaliExtBusRdNoSnoop, 30, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdOTQ1, 34, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdOTQ2, 35, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdOTQ3, 36, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdOTQ4, MaliExtBusRdOTQ4_v0, formula_23_flat, formula_23_batch, g71_counters_dependencies + 14, 4},
+        {hwcpipe_counter::MaliExtBusRdStallCy, 33, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdStallRate, MaliExtBusRdStallRate_v0, formula_24_flat, formula_24_batch, g71_counters_dependencies + 18, 2},
+        {hwcpipe_counter::MaliExtBusRdUnique, 31, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWr, 42, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrBt, 47, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrBy, MaliExtBusWrBy_v0, formula_21_flat, formula_21_batch, g71_counters_dependencies + 20, 1},
+        {hwcpipe_counter::MaliExtBusWrNoSnoopFull, 43, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrNoSnoopPart, 44, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrOTQ1, 49, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrOTQ2, 50, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrOTQ3, 51, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrOTQ4, MaliExtBusWrOTQ4_v0, formula_23_flat, formula_23_batch, g71_counters_dependencies + 21, 4},
+        {hwcpipe_counter::MaliExtBusWrSnoopFull, 45, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrSnoopPart, 46, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrStallCy, 48, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrStallRate, MaliExtBusWrStallRate_v0, formula_24_flat, formula_24_batch, g71_counters_dependencies + 25, 2},
+        {hwcpipe_counter::MaliFragActiveCy, 4, 0, block_type::core},
+        {hwcpipe_counter::MaliFragEZSKillQd, 14, 0, block_type::core},
+        {hwcpipe_counter::MaliFragEZSKillRate, MaliFragEZSKillRate_v0, formula_5_flat, formula_5_batch, g71_counters_dependencies + 27, 2},
+        {hwcpipe_counter::MaliFragEZSTestQd, 12, 0, block_type::core},
+        {hwcpipe_counter::MaliFragEZSTestRate, MaliFragEZSTestRate_v0, formula_5_flat, formula_5_batch, g71_counters_dependencies + 29, 2},
+        {hwcpipe_counter::MaliFragEZSUpdateQd, 13, 0, block_type::core},
+        {hwcpipe_counter::MaliFragEZSUpdateRate, MaliFragEZSUpdateRate_v0, formula_5_flat, formula_5_batch, g71_counters_dependencies + 31, 2},
+        {hwcpipe_counter::MaliFragFPKActiveCy, 7, 0, block_type::core},
+        {hwcpipe_counter::MaliFragFPKBUtil, MaliFragFPKBUtil_v0, formula_5_flat, formula_5_batch, g71_counters_dependencies + 33, 2},
+        {hwcpipe_counter::MaliFragFPKKillQd, MaliFragFPKKillQd_v0, formula_25_flat, formula_25_batch, g71_counters_dependencies + 35, 3},
+        {hwcpipe_counter::MaliFragFPKKillRate, MaliFragFPKKillRate_v0, formula_28_flat, formula_28_batch, g71_counters_dependencies + 38, 3},
+        {hwcpipe_counter::MaliFragLZSKillQd, 16, 0, block_type::core},
+        {hwcpipe_counter::MaliFragLZSKillRate, MaliFragLZSKillRate_v0, formula_5_flat, formula_5_batch, g71_counters_dependencies + 41, 2},
+        {hwcpipe_counter::MaliFragLZSTestQd, 15, 0, block_type::core},
+        {hwcpipe_counter::MaliFragLZSTestRate, MaliFragLZSTestRate_v0, formula_5_flat, formula_5_batch, g71_counters_dependencies + 43, 2},
+        {hwcpipe_counter::MaliFragOpaqueQd, 20, 0, block_type::core},
+        {hwcpipe_counter::MaliFragOpaqueQdRate, MaliFragOpaqueQdRate_v0, formula_34_flat, formula_34_batch, g71_counters_dependencies + 45, 3},
+        {hwcpipe_counter::MaliFragOverdraw, MaliFragOverdraw_v0, formula_35_flat, formula_35_batch, g71_counters_dependencies + 48, 2},
+        {hwcpipe_counter::MaliFragPartWarp, 10, 0, block_type::core},
+        {hwcpipe_counter::MaliFragPartWarpRate, MaliFragPartWarpRate_v0, formula_5_flat, formula_5_batch, g71_counters_dependencies + 50, 2},
+        {hwcpipe_counter::MaliFragQueueActiveCy, 10, 0, block_type::fe},
+        {hwcpipe_counter::MaliFragQueueJob, 8, 0, block_type::fe},
+        {hwcpipe_counter::MaliFragQueueTask, 9, 0, block_type::fe},
+        {hwcpipe_counter::MaliFragQueueUtil, MaliFragQueueUtil_v0, formula_5_flat, formula_5_batch, g71_counters_dependencies + 52, 2},
+        {hwcpipe_counter::MaliFragQueueWaitDepCy, 14, 0, block_type::fe},
+        {hwcpipe_counter::MaliFragQueueWaitFinishCy, 15, 0, block_type::fe},
+        {hwcpipe_counter::MaliFragQueueWaitFlushCy, 11, 0, block_type::fe},
+        {hwcpipe_counter::MaliFragQueueWaitIssueCy, 13, 0, block_type::fe},
+        {hwcpipe_counter::MaliFragQueueWaitRdCy, 12, 0, block_type::fe},
+        {hwcpipe_counter::MaliFragRastPrim, 6, 0, block_type::core},
+        {hwcpipe_counter::MaliFragRastQd, 11, 0, block_type::core},
+        {hwcpipe_counter::MaliFragRdPrim, 5, 0, block_type::core},
+        {hwcpipe_counter::MaliFragShadedQd, MaliFragShadedQd_v0, formula_0_flat, formula_0_batch, g71_counters_dependencies + 54, 1},
+        {hwcpipe_counter::MaliFragThread, MaliFragThread_v0, formula_47_flat, formula_47_batch, g71_counters_dependencies + 55, 1},
+        {hwcpipe_counter::MaliFragThroughputCy, MaliFragThroughputCy_v0, formula_49_flat, formula_49_batch, g71_counters_dependencies + 56, 2},
+        {hwcpipe_counter::MaliFragTile, 18, 0, block_type::core},
+        {hwcpipe_counter::MaliFragTileKill, 19, 0, block_type::core},
+        {hwcpipe_counter::MaliFragTileKillRate, MaliFragTileKillRate_v0, formula_5_flat, formula_5_batch, g71_counters_dependencies + 58, 2},
+        {hwcpipe_counter::MaliFragTransparentQd, MaliFragTransparentQd_v0, formula_25_flat, formula_25_batch, g71_counters_dependencies + 60, 3},
+        {hwcpipe_counter::MaliFragUtil, MaliFragUtil_v0, formula_10_flat, formula_10_batch, g71_counters_dependencies + 63, 2},
+        {hwcpipe_counter::MaliFragWarp, 9, 0, block_type::core},
+        {hwcpipe_counter::MaliGPUActiveCy, 6, 0, block_type::fe},
+        {hwcpipe_counter::MaliGPUCyPerPix, MaliGPUCyPerPix_v0, formula_38_flat, formula_38_batch, g71_counters_dependencies + 65, 2},
+        {hwcpipe_counter::MaliGPUIRQActiveCy, 7, 0, block_type::fe},
+        {hwcpipe_counter::MaliGPUIRQUtil, MaliGPUIRQUtil_v0, formula_5_flat, formula_5_batch, g71_counters_dependencies + 67, 2},
+        {hwcpipe_counter::MaliGPUPix, MaliGPUPix_v0, formula_54_flat, formula_54_batch, g71_counters_dependencies + 69, 1},
+        {hwcpipe_counter::MaliGeomBackFacePrim, 10, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomFaceXYPlaneCullPrim, 12, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomFaceXYPlaneCullRate, MaliGeomFaceXYPlaneCullRate_v0, formula_56_flat, formula_56_batch, g71_counters_dependencies + 70, 4},
+        {hwcpipe_counter::MaliGeomFrontFacePrim, 9, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomLinePrim, 7, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomPointPrim, 8, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomPosShadTask, 21, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomPosShadThread, MaliGeomPosShadThread_v0, formula_47_flat, formula_47_batch, g71_counters_dependencies + 74, 1},
+        {hwcpipe_counter::MaliGeomPosShadThreadPerPrim, MaliGeomPosShadThreadPerPrim_v0, formula_60_flat, formula_60_batch, g71_counters_dependencies + 75, 5},
+        {hwcpipe_counter::MaliGeomSampleCullPrim, 14, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomSampleCullRate, MaliGeomSampleCullRate_v0, formula_63_flat, formula_63_batch, g71_counters_dependencies + 80, 4},
+        {hwcpipe_counter::MaliGeomTotalCullPrim, MaliGeomTotalCullPrim_v0, formula_15_flat, formula_15_batch, g71_counters_dependencies + 84, 3},
+        {hwcpipe_counter::MaliGeomTotalPrim, MaliGeomTotalPrim_v0, formula_66_flat, formula_66_batch, g71_counters_dependencies + 87, 4},
+        {hwcpipe_counter::MaliGeomTrianglePrim, 6, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomVarShadTask, 37, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomVarShadThread, MaliGeomVarShadThread_v0, formula_47_flat, formula_47_batch, g71_counters_dependencies + 91, 1},
+        {hwcpipe_counter::MaliGeomVarShadThreadPerPrim, MaliGeomVarShadThreadPerPrim_v0, formula_68_flat, formula_68_batch, g71_counters_dependencies + 92, 2},
+        {hwcpipe_counter::MaliGeomVisiblePrim, 11, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomVisibleRate, MaliGeomVisibleRate_v0, formula_69_flat, formula_69_batch, g71_counters_dependencies + 94, 4},
+        {hwcpipe_counter::MaliGeomZPlaneCullPrim, 13, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomZPlaneCullRate, MaliGeomZPlaneCullRate_v0, formula_58_flat, formula_58_batch, g71_counters_dependencies + 98, 4},
+        {hwcpipe_counter::MaliL2CacheFlush, 63, 0, block_type::fe},
+        {hwcpipe_counter::MaliL2CacheIncSnp, 52, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheIncSnpStallCy, 53, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheL1Rd, 22, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheL1RdStallCy, 23, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheL1Wr, 24, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheLookup, 25, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheRd, 16, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheRdLookup, 26, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheRdMissRate, MaliL2CacheRdMissRate_v0, formula_5_flat, formula_5_batch, g71_counters_dependencies + 102, 2},
+        {hwcpipe_counter::MaliL2CacheRdStallCy, 17, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheSnp, 20, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheSnpLookup, 28, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheSnpStallCy, 21, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheWr, 18, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheWrLookup, 27, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheWrMissRate, MaliL2CacheWrMissRate_v0, formula_5_flat, formula_5_batch, g71_counters_dependencies + 104, 2},
+        {hwcpipe_counter::MaliL2CacheWrStallCy, 19, 0, block_type::memory},
+        {hwcpipe_counter::MaliLSAtomic, 48, 0, block_type::core},
+        {hwcpipe_counter::MaliLSFullRd, 44, 0, block_type::core},
+        {hwcpipe_counter::MaliLSFullWr, 46, 0, block_type::core},
+        {hwcpipe_counter::MaliLSIssueCy, MaliLSIssueCy_v0, formula_67_flat, formula_67_batch, g71_counters_dependencies + 106, 5},
+        {hwcpipe_counter::MaliLSPartRd, 45, 0, block_type::core},
+        {hwcpipe_counter::MaliLSPartWr, 47, 0, block_type::core},
+        {hwcpipe_counter::MaliLSRdCy, MaliLSRdCy_v0, formula_71_flat, formula_71_batch, g71_counters_dependencies + 111, 2},
+        {hwcpipe_counter::MaliLSUtil, MaliLSUtil_v0, formula_72_flat, formula_72_batch, g71_counters_dependencies + 113, 6},
+        {hwcpipe_counter::MaliLSWrCy, MaliLSWrCy_v0, formula_71_flat, formula_71_batch, g71_counters_dependencies + 119, 2},
+        {hwcpipe_counter::MaliMMUL2Hit, 8, 0, block_type::memory},
+        {hwcpipe_counter::MaliMMUL2Rd, 6, 0, block_type::memory},
+        {hwcpipe_counter::MaliMMUL3Hit, 7, 0, block_type::memory},
+        {hwcpipe_counter::MaliMMUL3Rd, 5, 0, block_type::memory},
+        {hwcpipe_counter::MaliMMULookup, 4, 0, block_type::memory},
+        {hwcpipe_counter::MaliMMUS2L2Hit, 13, 0, block_type::memory},
+        {hwcpipe_counter::MaliMMUS2L2Rd, 11, 0, block_type::memory},
+        {hwcpipe_counter::MaliMMUS2L3Hit, 12, 0, block_type::memory},
+        {hwcpipe_counter::MaliMMUS2L3Rd, 10, 0, block_type::memory},
+        {hwcpipe_counter::MaliMMUS2Lookup, 9, 0, block_type::memory},
+        {hwcpipe_counter::MaliNonFragActiveCy, 22, 0, block_type::core},
+        {hwcpipe_counter::MaliNonFragQueueActiveCy, 18, 0, block_type::fe},
+        {hwcpipe_counter::MaliNonFragQueueJob, 16, 0, block_type::fe},
+        {hwcpipe_counter::MaliNonFragQueueTask, 17, 0, block_type::fe},
+        {hwcpipe_counter::MaliNonFragQueueUtil, MaliNonFragQueueUtil_v0, formula_5_flat, formula_5_batch, g71_counters_dependencies + 121, 2},
+        {hwcpipe_counter::MaliNonFragQueueWaitDepCy, 22, 0, block_type::fe},
+        {hwcpipe_counter::MaliNonFragQueueWaitFinishCy, 23, 0, block_type::fe},
+        {hwcpipe_counter::MaliNonFragQueueWaitFlushCy, 19, 0, block_type::fe},
+        {hwcpipe_counter::MaliNonFragQueueWaitIssueCy, 21, 0, block_type::fe},
+        {hwcpipe_counter::MaliNonFragQueueWaitRdCy, 20, 0, block_type::fe},
+        {hwcpipe_counter::MaliNonFragTask, 23, 0, block_type::core},
+        {hwcpipe_counter::MaliNonFragThread, MaliNonFragThread_v0, formula_47_flat, formula_47_batch, g71_counters_dependencies + 123, 1},
+        {hwcpipe_counter::MaliNonFragThroughputCy, MaliNonFragThroughputCy_v0, formula_49_flat, formula_49_batch, g71_counters_dependencies + 124, 2},
+        {hwcpipe_counter::MaliNonFragUtil, MaliNonFragUtil_v0, formula_10_flat, formula_10_batch, g71_counters_dependencies + 126, 2},
+        {hwcpipe_counter::MaliNonFragWarp, 24, 0, block_type::core},
+        {hwcpipe_counter::MaliResQueueActiveCy, 26, 0, block_type::fe},
+        {hwcpipe_counter::MaliResQueueJob, 24, 0, block_type::fe},
+        {hwcpipe_counter::MaliResQueueTask, 25, 0, block_type::fe},
+        {hwcpipe_counter::MaliResQueueWaitDepCy, 30, 0, block_type::fe},
+        {hwcpipe_counter::MaliResQueueWaitFinishCy, 31, 0, block_type::fe},
+        {hwcpipe_counter::MaliResQueueWaitFlushCy, 27, 0, block_type::fe},
+        {hwcpipe_counter::MaliResQueueWaitIssueCy, 29, 0, block_type::fe},
+        {hwcpipe_counter::MaliResQueueWaitRdCy, 28, 0, block_type::fe},
+        {hwcpipe_counter::MaliSCBusFFEExtRdBt, 55, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusFFEExtRdBy, MaliSCBusFFEExtRdBy_v0, formula_43_flat, formula_43_batch, g71_counters_dependencies + 128, 1},
+        {hwcpipe_counter::MaliSCBusFFEL2RdBt, 54, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusFFEL2RdBy, MaliSCBusFFEL2RdBy_v0, formula_43_flat, formula_43_batch, g71_counters_dependencies + 129, 1},
+        {hwcpipe_counter::MaliSCBusLSExtRdBt, 57, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusLSExtRdBy, MaliSCBusLSExtRdBy_v0, formula_43_flat, formula_43_batch, g71_counters_dependencies + 130, 1},
+        {hwcpipe_counter::MaliSCBusLSExtRdByPerRd, MaliSCBusLSExtRdByPerRd_v0, formula_75_flat, formula_75_batch, g71_counters_dependencies + 131, 3},
+        {hwcpipe_counter::MaliSCBusLSL2RdBt, 56, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusLSL2RdBy, MaliSCBusLSL2RdBy_v0, formula_43_flat, formula_43_batch, g71_counters_dependencies + 134, 1},
+        {hwcpipe_counter::MaliSCBusLSL2RdByPerRd, MaliSCBusLSL2RdByPerRd_v0, formula_75_flat, formula_75_batch, g71_counters_dependencies + 135, 3},
+        {hwcpipe_counter::MaliSCBusLSWrBt, 61, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusLSWrBy, MaliSCBusLSWrBy_v1, formula_43_flat, formula_43_batch, g71_counters_dependencies + 138, 1},
+        {hwcpipe_counter::MaliSCBusLSWrByPerWr, MaliSCBusLSWrByPerWr_v1, formula_75_flat, formula_75_batch, g71_counters_dependencies + 139, 3},
+        {hwcpipe_counter::MaliSCBusOtherL2RdBt, 60, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusTexExtRdBt, 59, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusTexExtRdBy, MaliSCBusTexExtRdBy_v0, formula_43_flat, formula_43_batch, g71_counters_dependencies + 142, 1},
+        {hwcpipe_counter::MaliSCBusTexExtRdByPerRd, MaliSCBusTexExtRdByPerRd_v0, formula_78_flat, formula_78_batch, g71_counters_dependencies + 143, 2},
+        {hwcpipe_counter::MaliSCBusTexL2RdBt, 58, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusTexL2RdBy, MaliSCBusTexL2RdBy_v0, formula_43_flat, formula_43_batch, g71_counters_dependencies + 145, 1},
+        {hwcpipe_counter::MaliSCBusTexL2RdByPerRd, MaliSCBusTexL2RdByPerRd_v0, formula_78_flat, formula_78_batch, g71_counters_dependencies + 146, 2},
+        {hwcpipe_counter::MaliSCBusTileWrBPerPx, MaliSCBusTileWrBPerPx_v0, formula_37_flat, formula_37_batch, g71_counters_dependencies + 148, 2},
+        {hwcpipe_counter::MaliSCBusTileWrBt, 62, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusTileWrBy, MaliSCBusTileWrBy_v0, formula_43_flat, formula_43_batch, g71_counters_dependencies + 150, 1},
+        {hwcpipe_counter::MaliTexCPI, MaliTexCPI_v1, formula_52_flat, formula_52_batch, g71_counters_dependencies + 151, 2},
+        {hwcpipe_counter::MaliTexFiltIssueCy, 40, 0, block_type::core},
+        {hwcpipe_counter::MaliTexIssueCy, MaliTexIssueCy_v0, formula_0_flat, formula_0_batch, g71_counters_dependencies + 153, 1},
+        {hwcpipe_counter::MaliTexMipInstrRate, MaliTexMipInstrRate_v1, formula_5_flat, formula_5_batch, g71_counters_dependencies + 154, 2},
+        {hwcpipe_counter::MaliTexSample, MaliTexSample_v1, formula_0_flat, formula_0_batch, g71_counters_dependencies + 156, 1},
+        {hwcpipe_counter::MaliTexTriInstrRate, MaliTexTriInstrRate_v1, formula_5_flat, formula_5_batch, g71_counters_dependencies + 157, 2},
+        {hwcpipe_counter::MaliTexUtil, MaliTexUtil_v0, formula_5_flat, formula_5_batch, g71_counters_dependencies + 159, 2},
+        {hwcpipe_counter::MaliTilerActiveCy, 4, 0, block_type::tiler},
+        {hwcpipe_counter::MaliTilerPosCacheHit, 26, 0, block_type::tiler},
+        {hwcpipe_counter::MaliTilerPosCacheHitRate, MaliTilerPosCacheHitRate_v0, formula_89_flat, formula_89_batch, g71_counters_dependencies + 161, 2},
+        {hwcpipe_counter::MaliTilerPosCacheMiss, 27, 0, block_type::tiler},
+        {hwcpipe_counter::MaliTilerPosShadFIFOFullCy, 24, 0, block_type::tiler},
+        {hwcpipe_counter::MaliTilerPosShadStallCy, 23, 0, block_type::tiler},
+        {hwcpipe_counter::MaliTilerRdBt, 17, 0, block_type::tiler},
+        {hwcpipe_counter::MaliTilerUtil, MaliTilerUtil_v0, formula_5_flat, formula_5_batch, g71_counters_dependencies + 163, 2},
+        {hwcpipe_counter::MaliTilerVarCacheHit, 34, 0, block_type::tiler},
+        {hwcpipe_counter::MaliTilerVarCacheHitRate, MaliTilerVarCacheHitRate_v0, formula_89_flat, formula_89_batch, g71_counters_dependencies + 165, 2},
+        {hwcpipe_counter::MaliTilerVarCacheMiss, 35, 0, block_type::tiler},
+        {hwcpipe_counter::MaliTilerVarShadStallCy, 38, 0, block_type::tiler},
+        {hwcpipe_counter::MaliTilerWrBt, 19, 0, block_type::tiler},
+        {hwcpipe_counter::MaliVar16IssueCy, MaliVar16IssueCy_v0, formula_0_flat, formula_0_batch, g71_counters_dependencies + 167, 1},
+        {hwcpipe_counter::MaliVar16IssueSlot, 51, 0, block_type::core},
+        {hwcpipe_counter::MaliVar32IssueCy, MaliVar32IssueCy_v0, formula_0_flat, formula_0_batch, g71_counters_dependencies + 168, 1},
+        {hwcpipe_counter::MaliVar32IssueSlot, 50, 0, block_type::core},
+        {hwcpipe_counter::MaliVarInstr, 49, 0, block_type::core},
+        {hwcpipe_counter::MaliVarIssueCy, MaliVarIssueCy_v0, formula_71_flat, formula_71_batch, g71_counters_dependencies + 169, 2},
+        {hwcpipe_counter::MaliVarUtil, MaliVarUtil_v0, formula_82_flat, formula_82_batch, g71_counters_dependencies + 171, 3},
+        {hwcpipe_counter::MaliSCBusOtherWrBt, 63, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusOtherWrBy, MaliSCBusOtherWrBy_v0, formula_43_flat, formula_43_batch, g71_counters_dependencies + 174, 1},
+        {hwcpipe_counter::MaliTex3DInstr, 38, 0, block_type::core},
+        {hwcpipe_counter::MaliTex3DInstrRate, MaliTex3DInstrRate_v0, formula_5_flat, formula_5_batch, g71_counters_dependencies + 175, 2},
+        {hwcpipe_counter::MaliTexCompressInstr, 37, 0, block_type::core},
+        {hwcpipe_counter::MaliTexCompressInstrRate, MaliTexCompressInstrRate_v0, formula_5_flat, formula_5_batch, g71_counters_dependencies + 177, 2},
+        {hwcpipe_counter::MaliTexCoordStallCy, 41, 0, block_type::core},
+        {hwcpipe_counter::MaliTexDataStallCy, 42, 0, block_type::core},
+        {hwcpipe_counter::MaliTexInstr, 35, 0, block_type::core},
+        {hwcpipe_counter::MaliTexMipInstr, 36, 0, block_type::core},
+        {hwcpipe_counter::MaliTexPartDataStallCy, 43, 0, block_type::core},
+        {hwcpipe_counter::MaliTexTriInstr, 39, 0, block_type::core},
+    };
+
+    // Per-product counters that are added to, or replace, those of a shared table.
+
+    constexpr counter_record g51_overrides[] {
+        {hwcpipe_counter::MaliSCBusLSOtherWrBt, 61, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusLSWBWrBt, 63, 0, block_type::core},
+    };
+
+    constexpr hwcpipe_counter g52_overrides_dependencies[] {
+        hwcpipe_counter::MaliFragRastQd, hwcpipe_counter::MaliFragEZSKillQd, hwcpipe_counter::MaliFragWarp,
+        hwcpipe_counter::MaliFragRastQd, hwcpipe_counter::MaliFragEZSKillQd, hwcpipe_counter::MaliFragWarp,
+        hwcpipe_counter::MaliFragWarp, hwcpipe_counter::MaliFragQueueTask,
+        hwcpipe_counter::MaliFragWarp,
+        hwcpipe_counter::MaliFragWarp,
+        hwcpipe_counter::MaliFragActiveCy, hwcpipe_counter::MaliFragWarp,
+        hwcpipe_counter::MaliNonFragWarp,
+        hwcpipe_counter::MaliNonFragActiveCy, hwcpipe_counter::MaliNonFragWarp,
+        hwcpipe_counter::MaliCoreAllRegsWarp, hwcpipe_counter::MaliNonFragWarp, hwcpipe_counter::MaliFragWarp,
+        hwcpipe_counter::MaliCoreFullWarp, hwcpipe_counter::MaliNonFragWarp, hwcpipe_counter::MaliFragWarp,
+    };
+
+    constexpr counter_record g52_overrides[] {
+        {hwcpipe_counter::MaliFragFPKKillQd, MaliFragFPKKillQd_v1, formula_26_flat, formula_26_batch, g52_overrides_dependencies + 0, 3},
+        {hwcpipe_counter::MaliFragFPKKillRate, MaliFragFPKKillRate_v1, formula_29_flat, formula_29_batch, g52_overrides_dependencies + 3, 3},
+        {hwcpipe_counter::MaliFragOverdraw, MaliFragOverdraw_v1, formula_36_flat, formula_36_batch, g52_overrides_dependencies + 6, 2},
+        {hwcpipe_counter::MaliFragShadedQd, MaliFragShadedQd_v1, formula_45_flat, formula_45_batch, g52_overrides_dependencies + 8, 1},
+        {hwcpipe_counter::MaliFragThread, MaliFragThread_v1, formula_48_flat, formula_48_batch, g52_overrides_dependencies + 9, 1},
+        {hwcpipe_counter::MaliFragThroughputCy, MaliFragThroughputCy_v1, formula_50_flat, formula_50_batch, g52_overrides_dependencies + 10, 2},
+        {hwcpipe_counter::MaliNonFragThread, MaliNonFragThread_v1, formula_48_flat, formula_48_batch, g52_overrides_dependencies + 12, 1},
+        {hwcpipe_counter::MaliNonFragThroughputCy, MaliNonFragThroughputCy_v1, formula_50_flat, formula_50_batch, g52_overrides_dependencies + 13, 2},
+        {hwcpipe_counter::MaliCoreAllRegsWarp, 17, 0, block_type::core},
+        {hwcpipe_counter::MaliCoreAllRegsWarpRate, MaliCoreAllRegsWarpRate_v0, formula_13_flat, formula_13_batch, g52_overrides_dependencies + 15, 3},
+        {hwcpipe_counter::MaliCoreFullWarp, 21, 0, block_type::core},
+        {hwcpipe_counter::MaliCoreFullWarpRate, MaliCoreFullWarpRate_v0, formula_13_flat, formula_13_batch, g52_overrides_dependencies + 18, 3},
+    };
+
+    constexpr hwcpipe_counter g76_overrides_dependencies[] {
+        hwcpipe_counter::MaliFragRastQd, hwcpipe_counter::MaliFragEZSKillQd, hwcpipe_counter::MaliFragWarp,
+        hwcpipe_counter::MaliFragRastQd, hwcpipe_counter::MaliFragEZSKillQd, hwcpipe_counter::MaliFragWarp,
+        hwcpipe_counter::MaliFragWarp, hwcpipe_counter::MaliFragQueueTask,
+        hwcpipe_counter::MaliFragWarp,
+        hwcpipe_counter::MaliFragWarp,
+        hwcpipe_counter::MaliFragActiveCy, hwcpipe_counter::MaliFragWarp,
+        hwcpipe_counter::MaliNonFragWarp,
+        hwcpipe_counter::MaliNonFragActiveCy, hwcpipe_counter::MaliNonFragWarp,
+        hwcpipe_counter::MaliCoreAllRegsWarp, hwcpipe_counter::MaliNonFragWarp, hwcpipe_counter::MaliFragWarp,
+        hwcpipe_counter::MaliCoreFullWarp, hwcpipe_counter::MaliNonFragWarp, hwcpipe_counter::MaliFragWarp,
+    };
+
+    constexpr counter_record g76_overrides[] {
+        {hwcpipe_counter::MaliFragFPKKillQd, MaliFragFPKKillQd_v1, formula_26_flat, formula_26_batch, g76_overrides_dependencies + 0, 3},
+        {hwcpipe_counter::MaliFragFPKKillRate, MaliFragFPKKillRate_v1, formula_29_flat, formula_29_batch, g76_overrides_dependencies + 3, 3},
+        {hwcpipe_counter::MaliFragOverdraw, MaliFragOverdraw_v1, formula_36_flat, formula_36_batch, g76_overrides_dependencies + 6, 2},
+        {hwcpipe_counter::MaliFragShadedQd, MaliFragShadedQd_v1, formula_45_flat, formula_45_batch, g76_overrides_dependencies + 8, 1},
+        {hwcpipe_counter::MaliFragThread, MaliFragThread_v1, formula_48_flat, formula_48_batch, g76_overrides_dependencies + 9, 1},
+        {hwcpipe_counter::MaliFragThroughputCy, MaliFragThroughputCy_v1, formula_50_flat, formula_50_batch, g76_overrides_dependencies + 10, 2},
+        {hwcpipe_counter::MaliNonFragThread, MaliNonFragThread_v1, formula_48_flat, formula_48_batch, g76_overrides_dependencies + 12, 1},
+        {hwcpipe_counter::MaliNonFragThroughputCy, MaliNonFragThroughputCy_v1, formula_50_flat, formula_50_batch, g76_overrides_dependencies + 13, 2},
+        {hwcpipe_counter::MaliSCBusLSOtherWrBt, 61, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusLSWBWrBt, 63, 0, block_type::core},
+        {hwcpipe_counter::MaliCoreAllRegsWarp, 17, 0, block_type::core},
+        {hwcpipe_counter::MaliCoreAllRegsWarpRate, MaliCoreAllRegsWarpRate_v0, formula_13_flat, formula_13_batch, g76_overrides_dependencies + 15, 3},
+        {hwcpipe_counter::MaliCoreFullWarp, 21, 0, block_type::core},
+        {hwcpipe_counter::MaliCoreFullWarpRate, MaliCoreFullWarpRate_v0, formula_13_flat, formula_13_batch, g76_overrides_dependencies + 18, 3},
+    };
+
+} // namespace
+
+    constexpr std::array<gpu_counter_table, 6> bifrost_gpu_counters {
+        gpu_counter_table {device::product_id::g31, g31_counters},
+        gpu_counter_table {device::product_id::g51, g31_counters, g51_overrides},
+        gpu_counter_table {device::product_id::g52, g31_counters, g52_overrides},
+        gpu_counter_table {device::product_id::g71, g71_counters},
+        gpu_counter_table {device::product_id::g72, g71_counters},
+        gpu_counter_table {device::product_id::g76, g31_counters, g76_overrides},
+    };
+
+} // namespace database
+} // namespace hwcpipe
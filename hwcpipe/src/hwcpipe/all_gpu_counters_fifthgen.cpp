@@ -0,0 +1,1295 @@
+/*
+ * Copyright (c) 2023-2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hwcpipe/all_gpu_counters.hpp"
+#include "hwcpipe/derived_functions.hpp"
+
+namespace hwcpipe {
+namespace database {
+
+    using hwcpipe::detail::counter_record;
+    using hwcpipe::device::hwcnt::block_type;
+
+namespace {
+
+    // Counter tables shared by all of the products with identical counters.
+
+    constexpr hwcpipe_counter g620_counters_dependencies[] {
+        hwcpipe_counter::MaliEngCVTInstr, hwcpipe_counter::MaliEngSFUInstr, hwcpipe_counter::MaliEngFMAInstr,
+        hwcpipe_counter::MaliEngCVTInstr, hwcpipe_counter::MaliEngSFUInstr, hwcpipe_counter::MaliEngFMAInstr, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliCoreActiveCy, hwcpipe_counter::MaliAnyActiveCy,
+        hwcpipe_counter::MaliEngDivergedInstr, hwcpipe_counter::MaliEngFMAInstr, hwcpipe_counter::MaliEngCVTInstr, hwcpipe_counter::MaliEngSFUInstr,
+        hwcpipe_counter::MaliExtBusRdBt,
+        hwcpipe_counter::MaliExtBusRdBt, hwcpipe_counter::MaliExtBusRdLat0, hwcpipe_counter::MaliExtBusRdLat128, hwcpipe_counter::MaliExtBusRdLat192, hwcpipe_counter::MaliExtBusRdLat256, hwcpipe_counter::MaliExtBusRdLat320,
+        hwcpipe_counter::MaliExtBusRd, hwcpipe_counter::MaliExtBusRdOTQ1, hwcpipe_counter::MaliExtBusRdOTQ2, hwcpipe_counter::MaliExtBusRdOTQ3,
+        hwcpipe_counter::MaliExtBusRdStallCy, hwcpipe_counter::MaliGPUActiveCy,
+        hwcpipe_counter::MaliExtBusWrBt,
+        hwcpipe_counter::MaliExtBusWr, hwcpipe_counter::MaliExtBusWrOTQ1, hwcpipe_counter::MaliExtBusWrOTQ2, hwcpipe_counter::MaliExtBusWrOTQ3,
+        hwcpipe_counter::MaliExtBusWrStallCy, hwcpipe_counter::MaliGPUActiveCy,
+        hwcpipe_counter::MaliFragEZSKillQd, hwcpipe_counter::MaliFragRastQd,
+        hwcpipe_counter::MaliFragEZSTestQd, hwcpipe_counter::MaliFragRastQd,
+        hwcpipe_counter::MaliFragEZSUpdateQd, hwcpipe_counter::MaliFragRastQd,
+        hwcpipe_counter::MaliFragFPKActiveCy, hwcpipe_counter::MaliMainActiveCy,
+        hwcpipe_counter::MaliFragRastQd, hwcpipe_counter::MaliFragEZSKillQd, hwcpipe_counter::MaliFragWarp,
+        hwcpipe_counter::MaliFragRastQd, hwcpipe_counter::MaliFragEZSKillQd, hwcpipe_counter::MaliFragWarp,
+        hwcpipe_counter::MaliFragLZSKillQd, hwcpipe_counter::MaliFragRastQd,
+        hwcpipe_counter::MaliFragLZSTestQd, hwcpipe_counter::MaliFragRastQd,
+        hwcpipe_counter::MaliFragOpaqueQd, hwcpipe_counter::MaliFragRastQd, hwcpipe_counter::MaliFragEZSKillQd,
+        hwcpipe_counter::MaliFragThread, hwcpipe_counter::MaliMainQueueTask,
+        hwcpipe_counter::MaliFragWarp,
+        hwcpipe_counter::MaliMainActiveCy, hwcpipe_counter::MaliFragThread,
+        hwcpipe_counter::MaliFragTileKill, hwcpipe_counter::MaliFragTile,
+        hwcpipe_counter::MaliFragRastQd, hwcpipe_counter::MaliFragEZSKillQd, hwcpipe_counter::MaliFragOpaqueQd,
+        hwcpipe_counter::MaliGPUActiveCy, hwcpipe_counter::MaliMainQueueTask,
+        hwcpipe_counter::MaliGPUIRQActiveCy, hwcpipe_counter::MaliGPUActiveCy,
+        hwcpipe_counter::MaliMainQueueTask,
+        hwcpipe_counter::MaliGeomPosShadTask,
+        hwcpipe_counter::MaliGeomPosShadTask, hwcpipe_counter::MaliGeomFaceCullPrim, hwcpipe_counter::MaliGeomPlaneCullPrim, hwcpipe_counter::MaliGeomSampleCullPrim, hwcpipe_counter::MaliGeomScissorCullPrim, hwcpipe_counter::MaliGeomVisiblePrim,
+        hwcpipe_counter::MaliGeomSampleCullPrim, hwcpipe_counter::MaliGeomFaceCullPrim, hwcpipe_counter::MaliGeomPlaneCullPrim, hwcpipe_counter::MaliGeomScissorCullPrim, hwcpipe_counter::MaliGeomVisiblePrim,
+        hwcpipe_counter::MaliGeomFaceCullPrim, hwcpipe_counter::MaliGeomPlaneCullPrim, hwcpipe_counter::MaliGeomSampleCullPrim, hwcpipe_counter::MaliGeomScissorCullPrim,
+        hwcpipe_counter::MaliGeomFaceCullPrim, hwcpipe_counter::MaliGeomPlaneCullPrim, hwcpipe_counter::MaliGeomSampleCullPrim, hwcpipe_counter::MaliGeomScissorCullPrim, hwcpipe_counter::MaliGeomVisiblePrim,
+        hwcpipe_counter::MaliGeomVarShadTask,
+        hwcpipe_counter::MaliGeomVisiblePrim, hwcpipe_counter::MaliGeomFaceCullPrim, hwcpipe_counter::MaliGeomPlaneCullPrim, hwcpipe_counter::MaliGeomSampleCullPrim, hwcpipe_counter::MaliGeomScissorCullPrim,
+        hwcpipe_counter::MaliExtBusRd, hwcpipe_counter::MaliL2CacheRdLookup,
+        hwcpipe_counter::MaliExtBusWr, hwcpipe_counter::MaliL2CacheWrLookup,
+        hwcpipe_counter::MaliLSFullRd, hwcpipe_counter::MaliLSPartRd, hwcpipe_counter::MaliLSFullWr, hwcpipe_counter::MaliLSPartWr, hwcpipe_counter::MaliLSAtomic,
+        hwcpipe_counter::MaliLSFullRd, hwcpipe_counter::MaliLSPartRd,
+        hwcpipe_counter::MaliLSFullRd, hwcpipe_counter::MaliLSPartRd, hwcpipe_counter::MaliLSFullWr, hwcpipe_counter::MaliLSPartWr, hwcpipe_counter::MaliLSAtomic, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliLSFullWr, hwcpipe_counter::MaliLSPartWr,
+        hwcpipe_counter::MaliNonFragWarp,
+        hwcpipe_counter::MaliCompOrBinningActiveCy, hwcpipe_counter::MaliNonFragWarp,
+        hwcpipe_counter::MaliSCBusFFEExtRdBt,
+        hwcpipe_counter::MaliSCBusFFEL2RdBt,
+        hwcpipe_counter::MaliSCBusLSExtRdBt,
+        hwcpipe_counter::MaliSCBusLSExtRdBt, hwcpipe_counter::MaliLSFullRd, hwcpipe_counter::MaliLSPartRd,
+        hwcpipe_counter::MaliSCBusLSL2RdBt,
+        hwcpipe_counter::MaliSCBusLSL2RdBt, hwcpipe_counter::MaliLSFullRd, hwcpipe_counter::MaliLSPartRd,
+        hwcpipe_counter::MaliSCBusLSWBWrBt, hwcpipe_counter::MaliSCBusLSOtherWrBt,
+        hwcpipe_counter::MaliSCBusLSWBWrBt, hwcpipe_counter::MaliSCBusLSOtherWrBt,
+        hwcpipe_counter::MaliSCBusLSWBWrBt, hwcpipe_counter::MaliSCBusLSOtherWrBt, hwcpipe_counter::MaliLSFullWr, hwcpipe_counter::MaliLSPartWr,
+        hwcpipe_counter::MaliSCBusTexExtRdBt,
+        hwcpipe_counter::MaliSCBusTexExtRdBt, hwcpipe_counter::MaliTexFiltIssueCy,
+        hwcpipe_counter::MaliSCBusTexL2RdBt,
+        hwcpipe_counter::MaliSCBusTexL2RdBt, hwcpipe_counter::MaliTexFiltIssueCy,
+        hwcpipe_counter::MaliSCBusTileWrBt, hwcpipe_counter::MaliMainQueueTask,
+        hwcpipe_counter::MaliSCBusTileWrBt,
+        hwcpipe_counter::MaliTexFiltIssueCy, hwcpipe_counter::MaliTexCacheLookupCy, hwcpipe_counter::MaliTexCacheSimpleLoadCy, hwcpipe_counter::MaliTexCacheComplexLoadCy, hwcpipe_counter::MaliTexInBt, hwcpipe_counter::MaliTexOutBt, hwcpipe_counter::MaliTexL1CacheOutputCy, hwcpipe_counter::MaliTexL1CacheLookupCy, hwcpipe_counter::MaliTexIndexCy, hwcpipe_counter::MaliTexOutMsg, hwcpipe_counter::MaliTexOutSingleMsg,
+        hwcpipe_counter::MaliTexFiltIssueCy, hwcpipe_counter::MaliTexCacheLookupCy, hwcpipe_counter::MaliTexCacheSimpleLoadCy, hwcpipe_counter::MaliTexCacheComplexLoadCy, hwcpipe_counter::MaliTexInBt, hwcpipe_counter::MaliTexOutBt, hwcpipe_counter::MaliTexL1CacheOutputCy, hwcpipe_counter::MaliTexL1CacheLookupCy, hwcpipe_counter::MaliTexIndexCy,
+        hwcpipe_counter::MaliTexOutMsg, hwcpipe_counter::MaliTexOutSingleMsg,
+        hwcpipe_counter::MaliTexOutMsg, hwcpipe_counter::MaliTexOutSingleMsg,
+        hwcpipe_counter::MaliTexFiltIssueCy, hwcpipe_counter::MaliTexCacheLookupCy, hwcpipe_counter::MaliTexCacheSimpleLoadCy, hwcpipe_counter::MaliTexCacheComplexLoadCy, hwcpipe_counter::MaliTexInBt, hwcpipe_counter::MaliTexOutBt, hwcpipe_counter::MaliTexL1CacheOutputCy, hwcpipe_counter::MaliTexL1CacheLookupCy, hwcpipe_counter::MaliTexIndexCy, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliTilerActiveCy, hwcpipe_counter::MaliGPUActiveCy,
+        hwcpipe_counter::MaliTilerVarCacheHit, hwcpipe_counter::MaliTilerVarCacheMiss,
+        hwcpipe_counter::MaliVar16IssueSlot,
+        hwcpipe_counter::MaliVar32IssueSlot,
+        hwcpipe_counter::MaliVar32IssueSlot, hwcpipe_counter::MaliVar16IssueSlot,
+        hwcpipe_counter::MaliVar32IssueSlot, hwcpipe_counter::MaliVar16IssueSlot, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliCoreAllRegsWarp, hwcpipe_counter::MaliNonFragWarp, hwcpipe_counter::MaliFragWarp,
+        hwcpipe_counter::MaliCoreFullWarp, hwcpipe_counter::MaliNonFragWarp, hwcpipe_counter::MaliFragWarp,
+        hwcpipe_counter::MaliEngFMAInstr, hwcpipe_counter::MaliEngCVTInstr, hwcpipe_counter::MaliEngSFUInstr,
+        hwcpipe_counter::MaliEngCVTInstr, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliEngFMAInstr, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliEngSFUInstr, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliEngSWBlendInstr, hwcpipe_counter::MaliFragWarp,
+        hwcpipe_counter::MaliFragRastPartQd, hwcpipe_counter::MaliFragRastQd,
+        hwcpipe_counter::MaliTexInBt, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliTexOutBt, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliAnyActiveCy, hwcpipe_counter::MaliGPUActiveCy,
+        hwcpipe_counter::MaliCSFCEUActiveCy, hwcpipe_counter::MaliGPUActiveCy,
+        hwcpipe_counter::MaliCSFLSUActiveCy, hwcpipe_counter::MaliGPUActiveCy,
+        hwcpipe_counter::MaliCSFMCUActiveCy, hwcpipe_counter::MaliGPUActiveCy,
+        hwcpipe_counter::MaliCompQueuedCy, hwcpipe_counter::MaliCompQueueAssignStallCy,
+        hwcpipe_counter::MaliCompQueuedCy, hwcpipe_counter::MaliCompQueueAssignStallCy, hwcpipe_counter::MaliGPUActiveCy,
+        hwcpipe_counter::MaliFragThread, hwcpipe_counter::MaliFragWarp,
+        hwcpipe_counter::MaliEngNarrowInstr, hwcpipe_counter::MaliEngFMAInstr, hwcpipe_counter::MaliEngCVTInstr, hwcpipe_counter::MaliEngSFUInstr,
+        hwcpipe_counter::MaliFragRastCoarseQd, hwcpipe_counter::MaliFragRastQd,
+        hwcpipe_counter::MaliGeomFaceCullPrim, hwcpipe_counter::MaliGeomPlaneCullPrim, hwcpipe_counter::MaliGeomSampleCullPrim, hwcpipe_counter::MaliGeomScissorCullPrim, hwcpipe_counter::MaliGeomVisiblePrim,
+        hwcpipe_counter::MaliGeomPlaneCullPrim, hwcpipe_counter::MaliGeomFaceCullPrim, hwcpipe_counter::MaliGeomSampleCullPrim, hwcpipe_counter::MaliGeomScissorCullPrim, hwcpipe_counter::MaliGeomVisiblePrim,
+        hwcpipe_counter::MaliRTUBoxIssueCy, hwcpipe_counter::MaliRTUTriIssueCy,
+        hwcpipe_counter::MaliRTUBoxIssueCy, hwcpipe_counter::MaliRTUTriIssueCy, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliBinningQueuedCy, hwcpipe_counter::MaliBinningQueueAssignStallCy,
+        hwcpipe_counter::MaliBinningQueuedCy, hwcpipe_counter::MaliBinningQueueAssignStallCy, hwcpipe_counter::MaliGPUActiveCy,
+        hwcpipe_counter::MaliCompOrBinningActiveCy, hwcpipe_counter::MaliAnyActiveCy,
+        hwcpipe_counter::MaliGeomScissorCullPrim, hwcpipe_counter::MaliGeomFaceCullPrim, hwcpipe_counter::MaliGeomPlaneCullPrim, hwcpipe_counter::MaliGeomSampleCullPrim, hwcpipe_counter::MaliGeomVisiblePrim,
+        hwcpipe_counter::MaliMainQueuedCy, hwcpipe_counter::MaliMainQueueAssignStallCy,
+        hwcpipe_counter::MaliMainQueuedCy, hwcpipe_counter::MaliMainQueueAssignStallCy, hwcpipe_counter::MaliGPUActiveCy,
+        hwcpipe_counter::MaliMainActiveCy, hwcpipe_counter::MaliAnyActiveCy,
+    };
+
+    constexpr counter_record g620_counters[] {
+        {hwcpipe_counter::MaliALUIssueCy, MaliALUIssueCy_v3, formula_3_flat, formula_3_batch, g620_counters_dependencies + 0, 3},
+        {hwcpipe_counter::MaliALUUtil, MaliALUUtil_v3, formula_8_flat, formula_8_batch, g620_counters_dependencies + 3, 4},
+        {hwcpipe_counter::MaliAttrInstr, 52, 0, block_type::core},
+        {hwcpipe_counter::MaliCoreActiveCy, 26, 0, block_type::core},
+        {hwcpipe_counter::MaliCoreUtil, MaliCoreUtil_v1, formula_5_flat, formula_5_batch, g620_counters_dependencies + 7, 2},
+        {hwcpipe_counter::MaliEngDivergedInstr, 31, 0, block_type::core},
+        {hwcpipe_counter::MaliEngDivergedInstrRate, MaliEngDivergedInstrRate_v1, formula_17_flat, formula_17_batch, g620_counters_dependencies + 9, 4},
+        {hwcpipe_counter::MaliEngStarveCy, 33, 0, block_type::core},
+        {hwcpipe_counter::MaliExtBusRd, 29, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdBt, 32, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdBy, MaliExtBusRdBy_v0, formula_21_flat, formula_21_batch, g620_counters_dependencies + 13, 1},
+        {hwcpipe_counter::MaliExtBusRdLat0, 37, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdLat128, 38, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdLat192, 39, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdLat256, 40, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdLat320, 41, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdLat384, MaliExtBusRdLat384_v0, formula_22_flat, formula_22_batch, g620_counters_dependencies + 14, 6},
+        {hwcpipe_counter::MaliExtBusRdNoSnoop, 30, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdOTQ1, 34, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdOTQ2, 35, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdOTQ3, 36, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdOTQ4, MaliExtBusRdOTQ4_v0, formula_23_flat, formula_23_batch, g620_counters_dependencies + 20, 4},
+        {hwcpipe_counter::MaliExtBusRdStallCy, 33, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdStallRate, MaliExtBusRdStallRate_v0, formula_24_flat, formula_24_batch, g620_counters_dependencies + 24, 2},
+        {hwcpipe_counter::MaliExtBusRdUnique, 31, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWr, 42, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrBt, 47, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrBy, MaliExtBusWrBy_v0, formula_21_flat, formula_21_batch, g620_counters_dependencies + 26, 1},
+        {hwcpipe_counter::MaliExtBusWrNoSnoopFull, 43, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrNoSnoopPart, 44, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrOTQ1, 49, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrOTQ2, 50, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrOTQ3, 51, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrOTQ4, MaliExtBusWrOTQ4_v0, formula_23_flat, formula_23_batch, g620_counters_dependencies + 27, 4},
+        {hwcpipe_counter::MaliExtBusWrSnoopFull, 45, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrSnoopPart, 46, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrStallCy, 48, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrStallRate, MaliExtBusWrStallRate_v0, formula_24_flat, formula_24_batch, g620_counters_dependencies + 31, 2},
+        {hwcpipe_counter::MaliFragEZSKillQd, 14, 0, block_type::core},
+        {hwcpipe_counter::MaliFragEZSKillRate, MaliFragEZSKillRate_v0, formula_5_flat, formula_5_batch, g620_counters_dependencies + 33, 2},
+        {hwcpipe_counter::MaliFragEZSTestQd, 12, 0, block_type::core},
+        {hwcpipe_counter::MaliFragEZSTestRate, MaliFragEZSTestRate_v0, formula_5_flat, formula_5_batch, g620_counters_dependencies + 35, 2},
+        {hwcpipe_counter::MaliFragEZSUpdateQd, 13, 0, block_type::core},
+        {hwcpipe_counter::MaliFragEZSUpdateRate, MaliFragEZSUpdateRate_v0, formula_5_flat, formula_5_batch, g620_counters_dependencies + 37, 2},
+        {hwcpipe_counter::MaliFragFPKActiveCy, 7, 0, block_type::core},
+        {hwcpipe_counter::MaliFragFPKBUtil, MaliFragFPKBUtil_v1, formula_5_flat, formula_5_batch, g620_counters_dependencies + 39, 2},
+        {hwcpipe_counter::MaliFragFPKKillQd, MaliFragFPKKillQd_v2, formula_27_flat, formula_27_batch, g620_counters_dependencies + 41, 3},
+        {hwcpipe_counter::MaliFragFPKKillRate, MaliFragFPKKillRate_v2, formula_30_flat, formula_30_batch, g620_counters_dependencies + 44, 3},
+        {hwcpipe_counter::MaliFragLZSKillQd, 16, 0, block_type::core},
+        {hwcpipe_counter::MaliFragLZSKillRate, MaliFragLZSKillRate_v0, formula_5_flat, formula_5_batch, g620_counters_dependencies + 47, 2},
+        {hwcpipe_counter::MaliFragLZSTestQd, 15, 0, block_type::core},
+        {hwcpipe_counter::MaliFragLZSTestRate, MaliFragLZSTestRate_v0, formula_5_flat, formula_5_batch, g620_counters_dependencies + 49, 2},
+        {hwcpipe_counter::MaliFragOpaqueQd, 20, 0, block_type::core},
+        {hwcpipe_counter::MaliFragOpaqueQdRate, MaliFragOpaqueQdRate_v0, formula_34_flat, formula_34_batch, g620_counters_dependencies + 51, 3},
+        {hwcpipe_counter::MaliFragOverdraw, MaliFragOverdraw_v4, formula_39_flat, formula_39_batch, g620_counters_dependencies + 54, 2},
+        {hwcpipe_counter::MaliFragRastPrim, 6, 0, block_type::core},
+        {hwcpipe_counter::MaliFragRastQd, 11, 0, block_type::core},
+        {hwcpipe_counter::MaliFragShadedQd, MaliFragShadedQd_v2, formula_46_flat, formula_46_batch, g620_counters_dependencies + 56, 1},
+        {hwcpipe_counter::MaliFragThread, 69, 2, block_type::core},
+        {hwcpipe_counter::MaliFragThroughputCy, MaliFragThroughputCy_v4, formula_52_flat, formula_52_batch, g620_counters_dependencies + 57, 2},
+        {hwcpipe_counter::MaliFragTile, 18, 0, block_type::core},
+        {hwcpipe_counter::MaliFragTileKill, 19, 0, block_type::core},
+        {hwcpipe_counter::MaliFragTileKillRate, MaliFragTileKillRate_v1, formula_32_flat, formula_32_batch, g620_counters_dependencies + 59, 2},
+        {hwcpipe_counter::MaliFragTransparentQd, MaliFragTransparentQd_v0, formula_25_flat, formula_25_batch, g620_counters_dependencies + 61, 3},
+        {hwcpipe_counter::MaliFragWarp, 9, 0, block_type::core},
+        {hwcpipe_counter::MaliGPUActiveCy, 4, 0, block_type::fe},
+        {hwcpipe_counter::MaliGPUCyPerPix, MaliGPUCyPerPix_v2, formula_39_flat, formula_39_batch, g620_counters_dependencies + 64, 2},
+        {hwcpipe_counter::MaliGPUIRQActiveCy, 10, 0, block_type::fe},
+        {hwcpipe_counter::MaliGPUIRQUtil, MaliGPUIRQUtil_v0, formula_5_flat, formula_5_batch, g620_counters_dependencies + 66, 2},
+        {hwcpipe_counter::MaliGPUPix, MaliGPUPix_v1, formula_55_flat, formula_55_batch, g620_counters_dependencies + 68, 1},
+        {hwcpipe_counter::MaliGeomBackFacePrim, 10, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomFrontFacePrim, 9, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomLinePrim, 7, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomPointPrim, 8, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomPosShadTask, 21, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomPosShadThread, MaliGeomPosShadThread_v0, formula_47_flat, formula_47_batch, g620_counters_dependencies + 69, 1},
+        {hwcpipe_counter::MaliGeomPosShadThreadPerPrim, MaliGeomPosShadThreadPerPrim_v2, formula_61_flat, formula_61_batch, g620_counters_dependencies + 70, 6},
+        {hwcpipe_counter::MaliGeomSampleCullPrim, 14, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomSampleCullRate, MaliGeomSampleCullRate_v2, formula_64_flat, formula_64_batch, g620_counters_dependencies + 76, 5},
+        {hwcpipe_counter::MaliGeomTotalCullPrim, MaliGeomTotalCullPrim_v2, formula_66_flat, formula_66_batch, g620_counters_dependencies + 81, 4},
+        {hwcpipe_counter::MaliGeomTotalPrim, MaliGeomTotalPrim_v2, formula_67_flat, formula_67_batch, g620_counters_dependencies + 85, 5},
+        {hwcpipe_counter::MaliGeomTrianglePrim, 6, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomVarShadTask, 37, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomVarShadThread, MaliGeomVarShadThread_v0, formula_47_flat, formula_47_batch, g620_counters_dependencies + 90, 1},
+        {hwcpipe_counter::MaliGeomVisiblePrim, 11, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomVisibleRate, MaliGeomVisibleRate_v2, formula_70_flat, formula_70_batch, g620_counters_dependencies + 91, 5},
+        {hwcpipe_counter::MaliL2CacheFlush, 13, 0, block_type::fe},
+        {hwcpipe_counter::MaliL2CacheIncSnp, 52, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheIncSnpStallCy, 53, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheL1Rd, 22, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheL1RdStallCy, 23, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheL1Wr, 24, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheLookup, 25, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheRd, 16, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheRdLookup, 26, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheRdMissRate, MaliL2CacheRdMissRate_v0, formula_5_flat, formula_5_batch, g620_counters_dependencies + 96, 2},
+        {hwcpipe_counter::MaliL2CacheRdStallCy, 17, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheSnp, 20, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheSnpLookup, 28, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheSnpStallCy, 21, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheWr, 18, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheWrLookup, 27, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheWrMissRate, MaliL2CacheWrMissRate_v0, formula_5_flat, formula_5_batch, g620_counters_dependencies + 98, 2},
+        {hwcpipe_counter::MaliL2CacheWrStallCy, 19, 0, block_type::memory},
+        {hwcpipe_counter::MaliLSAtomic, 48, 0, block_type::core},
+        {hwcpipe_counter::MaliLSFullRd, 44, 0, block_type::core},
+        {hwcpipe_counter::MaliLSFullWr, 46, 0, block_type::core},
+        {hwcpipe_counter::MaliLSIssueCy, MaliLSIssueCy_v0, formula_67_flat, formula_67_batch, g620_counters_dependencies + 100, 5},
+        {hwcpipe_counter::MaliLSPartRd, 45, 0, block_type::core},
+        {hwcpipe_counter::MaliLSPartWr, 47, 0, block_type::core},
+        {hwcpipe_counter::MaliLSRdCy, MaliLSRdCy_v0, formula_71_flat, formula_71_batch, g620_counters_dependencies + 105, 2},
+        {hwcpipe_counter::MaliLSUtil, MaliLSUtil_v0, formula_72_flat, formula_72_batch, g620_counters_dependencies + 107, 6},
+        {hwcpipe_counter::MaliLSWrCy, MaliLSWrCy_v0, formula_71_flat, formula_71_batch, g620_counters_dependencies + 113, 2},
+        {hwcpipe_counter::MaliMMUL2Hit, 8, 0, block_type::memory},
+        {hwcpipe_counter::MaliMMUL2Rd, 6, 0, block_type::memory},
+        {hwcpipe_counter::MaliMMUL3Hit, 7, 0, block_type::memory},
+        {hwcpipe_counter::MaliMMUL3Rd, 5, 0, block_type::memory},
+        {hwcpipe_counter::MaliMMULookup, 4, 0, block_type::memory},
+        {hwcpipe_counter::MaliNonFragTask, 23, 0, block_type::core},
+        {hwcpipe_counter::MaliNonFragThread, MaliNonFragThread_v2, formula_43_flat, formula_43_batch, g620_counters_dependencies + 115, 1},
+        {hwcpipe_counter::MaliNonFragThroughputCy, MaliNonFragThroughputCy_v3, formula_51_flat, formula_51_batch, g620_counters_dependencies + 116, 2},
+        {hwcpipe_counter::MaliNonFragWarp, 24, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusFFEExtRdBt, 55, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusFFEExtRdBy, MaliSCBusFFEExtRdBy_v0, formula_43_flat, formula_43_batch, g620_counters_dependencies + 118, 1},
+        {hwcpipe_counter::MaliSCBusFFEL2RdBt, 54, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusFFEL2RdBy, MaliSCBusFFEL2RdBy_v0, formula_43_flat, formula_43_batch, g620_counters_dependencies + 119, 1},
+        {hwcpipe_counter::MaliSCBusLSExtRdBt, 57, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusLSExtRdBy, MaliSCBusLSExtRdBy_v0, formula_43_flat, formula_43_batch, g620_counters_dependencies + 120, 1},
+        {hwcpipe_counter::MaliSCBusLSExtRdByPerRd, MaliSCBusLSExtRdByPerRd_v0, formula_75_flat, formula_75_batch, g620_counters_dependencies + 121, 3},
+        {hwcpipe_counter::MaliSCBusLSL2RdBt, 56, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusLSL2RdBy, MaliSCBusLSL2RdBy_v0, formula_43_flat, formula_43_batch, g620_counters_dependencies + 124, 1},
+        {hwcpipe_counter::MaliSCBusLSL2RdByPerRd, MaliSCBusLSL2RdByPerRd_v0, formula_75_flat, formula_75_batch, g620_counters_dependencies + 125, 3},
+        {hwcpipe_counter::MaliSCBusLSOtherWrBt, 61, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusLSWBWrBt, 63, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusLSWrBt, MaliSCBusLSWrBt_v0, formula_71_flat, formula_71_batch, g620_counters_dependencies + 128, 2},
+        {hwcpipe_counter::MaliSCBusLSWrBy, MaliSCBusLSWrBy_v0, formula_77_flat, formula_77_batch, g620_counters_dependencies + 130, 2},
+        {hwcpipe_counter::MaliSCBusLSWrByPerWr, MaliSCBusLSWrByPerWr_v0, formula_76_flat, formula_76_batch, g620_counters_dependencies + 132, 4},
+        {hwcpipe_counter::MaliSCBusOtherL2RdBt, 60, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusTexExtRdBt, 59, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusTexExtRdBy, MaliSCBusTexExtRdBy_v0, formula_43_flat, formula_43_batch, g620_counters_dependencies + 136, 1},
+        {hwcpipe_counter::MaliSCBusTexExtRdByPerRd, MaliSCBusTexExtRdByPerRd_v0, formula_78_flat, formula_78_batch, g620_counters_dependencies + 137, 2},
+        {hwcpipe_counter::MaliSCBusTexL2RdBt, 58, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusTexL2RdBy, MaliSCBusTexL2RdBy_v0, formula_43_flat, formula_43_batch, g620_counters_dependencies + 139, 1},
+        {hwcpipe_counter::MaliSCBusTexL2RdByPerRd, MaliSCBusTexL2RdByPerRd_v0, formula_78_flat, formula_78_batch, g620_counters_dependencies + 140, 2},
+        {hwcpipe_counter::MaliSCBusTileWrBPerPx, MaliSCBusTileWrBPerPx_v1, formula_79_flat, formula_79_batch, g620_counters_dependencies + 142, 2},
+        {hwcpipe_counter::MaliSCBusTileWrBt, 62, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusTileWrBy, MaliSCBusTileWrBy_v0, formula_43_flat, formula_43_batch, g620_counters_dependencies + 144, 1},
+        {hwcpipe_counter::MaliTexCPI, MaliTexCPI_v4, formula_81_flat, formula_81_batch, g620_counters_dependencies + 145, 11},
+        {hwcpipe_counter::MaliTexFiltIssueCy, 39, 0, block_type::core},
+        {hwcpipe_counter::MaliTexIssueCy, MaliTexIssueCy_v1, formula_83_flat, formula_83_batch, g620_counters_dependencies + 156, 9},
+        {hwcpipe_counter::MaliTexQuads, MaliTexQuads_v2, formula_85_flat, formula_85_batch, g620_counters_dependencies + 165, 2},
+        {hwcpipe_counter::MaliTexSample, MaliTexSample_v4, formula_87_flat, formula_87_batch, g620_counters_dependencies + 167, 2},
+        {hwcpipe_counter::MaliTexUtil, MaliTexUtil_v1, formula_88_flat, formula_88_batch, g620_counters_dependencies + 169, 10},
+        {hwcpipe_counter::MaliTilerActiveCy, 4, 0, block_type::tiler},
+        {hwcpipe_counter::MaliTilerPosCacheHit, 26, 0, block_type::tiler},
+        {hwcpipe_counter::MaliTilerPosShadFIFOFullCy, 24, 0, block_type::tiler},
+        {hwcpipe_counter::MaliTilerPosShadStallCy, 23, 0, block_type::tiler},
+        {hwcpipe_counter::MaliTilerRdBt, 17, 0, block_type::tiler},
+        {hwcpipe_counter::MaliTilerUtil, MaliTilerUtil_v0, formula_5_flat, formula_5_batch, g620_counters_dependencies + 179, 2},
+        {hwcpipe_counter::MaliTilerVarCacheHit, 34, 0, block_type::tiler},
+        {hwcpipe_counter::MaliTilerVarCacheHitRate, MaliTilerVarCacheHitRate_v0, formula_89_flat, formula_89_batch, g620_counters_dependencies + 181, 2},
+        {hwcpipe_counter::MaliTilerVarCacheMiss, 35, 0, block_type::tiler},
+        {hwcpipe_counter::MaliTilerVarShadStallCy, 38, 0, block_type::tiler},
+        {hwcpipe_counter::MaliVar16IssueCy, MaliVar16IssueCy_v2, formula_91_flat, formula_91_batch, g620_counters_dependencies + 183, 1},
+        {hwcpipe_counter::MaliVar16IssueSlot, 51, 0, block_type::core},
+        {hwcpipe_counter::MaliVar32IssueCy, MaliVar32IssueCy_v2, formula_91_flat, formula_91_batch, g620_counters_dependencies + 184, 1},
+        {hwcpipe_counter::MaliVar32IssueSlot, 50, 0, block_type::core},
+        {hwcpipe_counter::MaliVarInstr, 49, 0, block_type::core},
+        {hwcpipe_counter::MaliVarIssueCy, MaliVarIssueCy_v2, formula_93_flat, formula_93_batch, g620_counters_dependencies + 185, 2},
+        {hwcpipe_counter::MaliVarUtil, MaliVarUtil_v2, formula_95_flat, formula_95_batch, g620_counters_dependencies + 187, 3},
+        {hwcpipe_counter::MaliCoreAllRegsWarp, 17, 0, block_type::core},
+        {hwcpipe_counter::MaliCoreAllRegsWarpRate, MaliCoreAllRegsWarpRate_v0, formula_13_flat, formula_13_batch, g620_counters_dependencies + 190, 3},
+        {hwcpipe_counter::MaliCoreFullWarp, 21, 0, block_type::core},
+        {hwcpipe_counter::MaliCoreFullWarpRate, MaliCoreFullWarpRate_v0, formula_13_flat, formula_13_batch, g620_counters_dependencies + 193, 3},
+        {hwcpipe_counter::MaliEngArithInstr, MaliEngArithInstr_v0, formula_15_flat, formula_15_batch, g620_counters_dependencies + 196, 3},
+        {hwcpipe_counter::MaliEngCVTInstr, 28, 0, block_type::core},
+        {hwcpipe_counter::MaliEngCVTPipeUtil, MaliEngCVTPipeUtil_v0, formula_5_flat, formula_5_batch, g620_counters_dependencies + 199, 2},
+        {hwcpipe_counter::MaliEngFMAInstr, 27, 0, block_type::core},
+        {hwcpipe_counter::MaliEngFMAPipeUtil, MaliEngFMAPipeUtil_v1, formula_16_flat, formula_16_batch, g620_counters_dependencies + 201, 2},
+        {hwcpipe_counter::MaliEngICacheMiss, 32, 0, block_type::core},
+        {hwcpipe_counter::MaliEngSFUInstr, 29, 0, block_type::core},
+        {hwcpipe_counter::MaliEngSFUPipeUtil, MaliEngSFUPipeUtil_v0, formula_18_flat, formula_18_batch, g620_counters_dependencies + 203, 2},
+        {hwcpipe_counter::MaliEngSWBlendInstr, 34, 0, block_type::core},
+        {hwcpipe_counter::MaliEngSWBlendRate, MaliEngSWBlendRate_v1, formula_18_flat, formula_18_batch, g620_counters_dependencies + 205, 2},
+        {hwcpipe_counter::MaliFragRastPartQd, 10, 0, block_type::core},
+        {hwcpipe_counter::MaliFragRastPartQdRate, MaliFragRastPartQdRate_v0, formula_5_flat, formula_5_batch, g620_counters_dependencies + 207, 2},
+        {hwcpipe_counter::MaliTexDataFetchStallCy, 37, 0, block_type::core},
+        {hwcpipe_counter::MaliTexDescStallCy, 36, 0, block_type::core},
+        {hwcpipe_counter::MaliTexFiltStallCy, 38, 0, block_type::core},
+        {hwcpipe_counter::MaliTexInBt, 35, 0, block_type::core},
+        {hwcpipe_counter::MaliTexInBusUtil, MaliTexInBusUtil_v0, formula_5_flat, formula_5_batch, g620_counters_dependencies + 209, 2},
+        {hwcpipe_counter::MaliTexOutBt, 43, 0, block_type::core},
+        {hwcpipe_counter::MaliTexOutBusUtil, MaliTexOutBusUtil_v0, formula_5_flat, formula_5_batch, g620_counters_dependencies + 211, 2},
+        {hwcpipe_counter::MaliTexOutMsg, 42, 0, block_type::core},
+        {hwcpipe_counter::MaliAnyActiveCy, 53, 0, block_type::core},
+        {hwcpipe_counter::MaliAnyUtil, MaliAnyUtil_v0, formula_10_flat, formula_10_batch, g620_counters_dependencies + 213, 2},
+        {hwcpipe_counter::MaliCS0WaitStallCy, 51, 0, block_type::fe},
+        {hwcpipe_counter::MaliCS1WaitStallCy, 55, 0, block_type::fe},
+        {hwcpipe_counter::MaliCS2WaitStallCy, 59, 0, block_type::fe},
+        {hwcpipe_counter::MaliCS3WaitStallCy, 63, 0, block_type::fe},
+        {hwcpipe_counter::MaliCSFCEUActiveCy, 40, 0, block_type::fe},
+        {hwcpipe_counter::MaliCSFCEUUtil, MaliCSFCEUUtil_v0, formula_5_flat, formula_5_batch, g620_counters_dependencies + 215, 2},
+        {hwcpipe_counter::MaliCSFCS0ActiveCy, 48, 0, block_type::fe},
+        {hwcpipe_counter::MaliCSFCS1ActiveCy, 52, 0, block_type::fe},
+        {hwcpipe_counter::MaliCSFCS2ActiveCy, 56, 0, block_type::fe},
+        {hwcpipe_counter::MaliCSFCS3ActiveCy, 60, 0, block_type::fe},
+        {hwcpipe_counter::MaliCSFLSUActiveCy, 45, 0, block_type::fe},
+        {hwcpipe_counter::MaliCSFLSUUtil, MaliCSFLSUUtil_v0, formula_5_flat, formula_5_batch, g620_counters_dependencies + 217, 2},
+        {hwcpipe_counter::MaliCSFMCUActiveCy, 5, 0, block_type::fe},
+        {hwcpipe_counter::MaliCSFMCUUtil, MaliCSFMCUUtil_v0, formula_5_flat, formula_5_batch, g620_counters_dependencies + 219, 2},
+        {hwcpipe_counter::MaliCompQueueActiveCy, MaliCompQueueActiveCy_v0, formula_11_flat, formula_11_batch, g620_counters_dependencies + 221, 2},
+        {hwcpipe_counter::MaliCompQueueAssignStallCy, 30, 0, block_type::fe},
+        {hwcpipe_counter::MaliCompQueueDrainStallCy, 31, 0, block_type::fe},
+        {hwcpipe_counter::MaliCompQueueIRQActiveCy, 28, 0, block_type::fe},
+        {hwcpipe_counter::MaliCompQueueJob, 25, 0, block_type::fe},
+        {hwcpipe_counter::MaliCompQueueTask, 26, 0, block_type::fe},
+        {hwcpipe_counter::MaliCompQueueUtil, MaliCompQueueUtil_v0, formula_12_flat, formula_12_batch, g620_counters_dependencies + 223, 3},
+        {hwcpipe_counter::MaliCompQueuedCy, 24, 0, block_type::fe},
+        {hwcpipe_counter::MaliGPUAnyQueueActiveCy, 6, 0, block_type::fe},
+        {hwcpipe_counter::MaliGPUIRQ, 11, 0, block_type::fe},
+        {hwcpipe_counter::MaliL2CacheCleanUnique, 13, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheEvict, 12, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheFlushCy, 12, 0, block_type::fe},
+        {hwcpipe_counter::MaliTilerQueueDrainStallCy, 23, 0, block_type::fe},
+        {hwcpipe_counter::MaliCoreFragWarpOcc, MaliCoreFragWarpOcc_v0, formula_14_flat, formula_14_batch, g620_counters_dependencies + 226, 2},
+        {hwcpipe_counter::MaliEngNarrowInstr, 5, 0, block_type::core},
+        {hwcpipe_counter::MaliEngNarrowInstrRate, MaliEngNarrowInstrRate_v0, formula_17_flat, formula_17_batch, g620_counters_dependencies + 228, 4},
+        {hwcpipe_counter::MaliFragRastCoarseQd, 68, 0, block_type::core},
+        {hwcpipe_counter::MaliFragShadRate, MaliFragShadRate_v0, formula_5_flat, formula_5_batch, g620_counters_dependencies + 232, 2},
+        {hwcpipe_counter::MaliGeomFaceCullPrim, 12, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomFaceCullRate, MaliGeomFaceCullRate_v1, formula_57_flat, formula_57_batch, g620_counters_dependencies + 234, 5},
+        {hwcpipe_counter::MaliGeomPlaneCullPrim, 13, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomPlaneCullRate, MaliGeomPlaneCullRate_v1, formula_59_flat, formula_59_batch, g620_counters_dependencies + 239, 5},
+        {hwcpipe_counter::MaliRTUBox, 71, 0, block_type::core},
+        {hwcpipe_counter::MaliRTUBoxBin1, 76, 0, block_type::core},
+        {hwcpipe_counter::MaliRTUBoxBin13, 79, 0, block_type::core},
+        {hwcpipe_counter::MaliRTUBoxBin5, 77, 0, block_type::core},
+        {hwcpipe_counter::MaliRTUBoxBin9, 78, 0, block_type::core},
+        {hwcpipe_counter::MaliRTUBoxIssueCy, 85, 0, block_type::core},
+        {hwcpipe_counter::MaliRTUFirstHitTerm, 82, 0, block_type::core},
+        {hwcpipe_counter::MaliRTUIssueCy, MaliRTUIssueCy_v0, formula_73_flat, formula_73_batch, g620_counters_dependencies + 244, 2},
+        {hwcpipe_counter::MaliRTUMiss, 83, 0, block_type::core},
+        {hwcpipe_counter::MaliRTUNonOpaqueHit, 81, 0, block_type::core},
+        {hwcpipe_counter::MaliRTUOpaqueHit, 80, 0, block_type::core},
+        {hwcpipe_counter::MaliRTURay, 84, 0, block_type::core},
+        {hwcpipe_counter::MaliRTUTri, 70, 0, block_type::core},
+        {hwcpipe_counter::MaliRTUTriBin1, 72, 0, block_type::core},
+        {hwcpipe_counter::MaliRTUTriBin13, 75, 0, block_type::core},
+        {hwcpipe_counter::MaliRTUTriBin5, 73, 0, block_type::core},
+        {hwcpipe_counter::MaliRTUTriBin9, 74, 0, block_type::core},
+        {hwcpipe_counter::MaliRTUTriIssueCy, 86, 0, block_type::core},
+        {hwcpipe_counter::MaliRTUUtil, MaliRTUUtil_v0, formula_74_flat, formula_74_batch, g620_counters_dependencies + 246, 3},
+        {hwcpipe_counter::MaliBinningQueueActiveCy, MaliBinningQueueActiveCy_v0, formula_11_flat, formula_11_batch, g620_counters_dependencies + 249, 2},
+        {hwcpipe_counter::MaliBinningQueueAssignStallCy, 22, 0, block_type::fe},
+        {hwcpipe_counter::MaliBinningQueueIRQActiveCy, 20, 0, block_type::fe},
+        {hwcpipe_counter::MaliBinningQueueJob, 17, 0, block_type::fe},
+        {hwcpipe_counter::MaliBinningQueueTask, 18, 0, block_type::fe},
+        {hwcpipe_counter::MaliBinningQueueUtil, MaliBinningQueueUtil_v0, formula_12_flat, formula_12_batch, g620_counters_dependencies + 251, 3},
+        {hwcpipe_counter::MaliBinningQueuedCy, 16, 0, block_type::fe},
+        {hwcpipe_counter::MaliCompOrBinningActiveCy, 22, 0, block_type::core},
+        {hwcpipe_counter::MaliCompOrBinningUtil, MaliCompOrBinningUtil_v0, formula_5_flat, formula_5_batch, g620_counters_dependencies + 254, 2},
+        {hwcpipe_counter::MaliGeomScissorCullPrim, 70, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomScissorCullRate, MaliGeomScissorCullRate_v0, formula_65_flat, formula_65_batch, g620_counters_dependencies + 256, 5},
+        {hwcpipe_counter::MaliGeomVisibleDVSPrim, 71, 0, block_type::tiler},
+        {hwcpipe_counter::MaliMainActiveCy, 4, 0, block_type::core},
+        {hwcpipe_counter::MaliMainQueueActiveCy, MaliMainQueueActiveCy_v0, formula_11_flat, formula_11_batch, g620_counters_dependencies + 261, 2},
+        {hwcpipe_counter::MaliMainQueueAssignStallCy, 38, 0, block_type::fe},
+        {hwcpipe_counter::MaliMainQueueIRQActiveCy, 36, 0, block_type::fe},
+        {hwcpipe_counter::MaliMainQueueJob, 33, 0, block_type::fe},
+        {hwcpipe_counter::MaliMainQueueTask, 34, 0, block_type::fe},
+        {hwcpipe_counter::MaliMainQueueUtil, MaliMainQueueUtil_v0, formula_12_flat, formula_12_batch, g620_counters_dependencies + 263, 3},
+        {hwcpipe_counter::MaliMainQueuedCy, 32, 0, block_type::fe},
+        {hwcpipe_counter::MaliMainUtil, MaliMainUtil_v0, formula_5_flat, formula_5_batch, g620_counters_dependencies + 266, 2},
+        {hwcpipe_counter::MaliTexCacheComplexLoadCy, 93, 0, block_type::core},
+        {hwcpipe_counter::MaliTexCacheLookupCy, 92, 0, block_type::core},
+        {hwcpipe_counter::MaliTexCacheSimpleLoadCy, 88, 0, block_type::core},
+        {hwcpipe_counter::MaliTexClkActiveCy, 96, 0, block_type::core},
+        {hwcpipe_counter::MaliTexClkStarvedCy, 95, 0, block_type::core},
+        {hwcpipe_counter::MaliTexIndexCy, 94, 0, block_type::core},
+        {hwcpipe_counter::MaliTexL1CacheLoadCy, 87, 0, block_type::core},
+        {hwcpipe_counter::MaliTexL1CacheLookupCy, 90, 0, block_type::core},
+        {hwcpipe_counter::MaliTexL1CacheOutputCy, 89, 0, block_type::core},
+        {hwcpipe_counter::MaliTexOutSingleMsg, 91, 0, block_type::core},
+        {hwcpipe_counter::MaliTilerPrimAsPosShadStallCy, 64, 0, block_type::tiler},
+    };
+
+    constexpr hwcpipe_counter g625_counters_dependencies[] {
+        hwcpipe_counter::MaliEngFMAInstr, hwcpipe_counter::MaliEngCVTInstr, hwcpipe_counter::MaliEngSFUInstr, hwcpipe_counter::MaliEngSlot1IssueCy,
+        hwcpipe_counter::MaliEngFMAInstr, hwcpipe_counter::MaliEngCVTInstr, hwcpipe_counter::MaliEngSFUInstr, hwcpipe_counter::MaliEngSlot1IssueCy, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliCoreActiveCy, hwcpipe_counter::MaliAnyActiveCy,
+        hwcpipe_counter::MaliEngDivergedInstr, hwcpipe_counter::MaliEngFMAInstr, hwcpipe_counter::MaliEngCVTInstr, hwcpipe_counter::MaliEngSFUInstr,
+        hwcpipe_counter::MaliExtBusRdBt,
+        hwcpipe_counter::MaliExtBusRdBt, hwcpipe_counter::MaliExtBusRdLat0, hwcpipe_counter::MaliExtBusRdLat128, hwcpipe_counter::MaliExtBusRdLat192, hwcpipe_counter::MaliExtBusRdLat256, hwcpipe_counter::MaliExtBusRdLat320,
+        hwcpipe_counter::MaliExtBusRd, hwcpipe_counter::MaliExtBusRdOTQ1, hwcpipe_counter::MaliExtBusRdOTQ2, hwcpipe_counter::MaliExtBusRdOTQ3,
+        hwcpipe_counter::MaliExtBusRdStallCy, hwcpipe_counter::MaliGPUActiveCy,
+        hwcpipe_counter::MaliExtBusWrBt,
+        hwcpipe_counter::MaliExtBusWr, hwcpipe_counter::MaliExtBusWrOTQ1, hwcpipe_counter::MaliExtBusWrOTQ2, hwcpipe_counter::MaliExtBusWrOTQ3,
+        hwcpipe_counter::MaliExtBusWrStallCy, hwcpipe_counter::MaliGPUActiveCy,
+        hwcpipe_counter::MaliFragFPKActiveCy, hwcpipe_counter::MaliMainActiveCy,
+        hwcpipe_counter::MaliFragLZSKillQd, hwcpipe_counter::MaliFragWarp,
+        hwcpipe_counter::MaliFragLZSTestQd, hwcpipe_counter::MaliFragWarp,
+        hwcpipe_counter::MaliFragThread, hwcpipe_counter::MaliMainQueueTask,
+        hwcpipe_counter::MaliFragWarp,
+        hwcpipe_counter::MaliMainActiveCy, hwcpipe_counter::MaliFragWarp, hwcpipe_counter::MaliFragPrepassWarp,
+        hwcpipe_counter::MaliFragTileKill, hwcpipe_counter::MaliFragTile,
+        hwcpipe_counter::MaliGPUActiveCy, hwcpipe_counter::MaliMainQueueTask,
+        hwcpipe_counter::MaliGPUIRQActiveCy, hwcpipe_counter::MaliGPUActiveCy,
+        hwcpipe_counter::MaliMainQueueTask,
+        hwcpipe_counter::MaliGeomPosShadTask,
+        hwcpipe_counter::MaliGeomPosShadTask, hwcpipe_counter::MaliGeomFaceCullPrim, hwcpipe_counter::MaliGeomPlaneCullPrim, hwcpipe_counter::MaliGeomSampleCullPrim, hwcpipe_counter::MaliGeomScissorCullPrim, hwcpipe_counter::MaliGeomVisiblePrim,
+        hwcpipe_counter::MaliGeomSampleCullPrim, hwcpipe_counter::MaliGeomFaceCullPrim, hwcpipe_counter::MaliGeomPlaneCullPrim, hwcpipe_counter::MaliGeomScissorCullPrim, hwcpipe_counter::MaliGeomVisiblePrim,
+        hwcpipe_counter::MaliGeomFaceCullPrim, hwcpipe_counter::MaliGeomPlaneCullPrim, hwcpipe_counter::MaliGeomSampleCullPrim, hwcpipe_counter::MaliGeomScissorCullPrim,
+        hwcpipe_counter::MaliGeomFaceCullPrim, hwcpipe_counter::MaliGeomPlaneCullPrim, hwcpipe_counter::MaliGeomSampleCullPrim, hwcpipe_counter::MaliGeomScissorCullPrim, hwcpipe_counter::MaliGeomVisiblePrim,
+        hwcpipe_counter::MaliGeomVarShadTask,
+        hwcpipe_counter::MaliGeomVisiblePrim, hwcpipe_counter::MaliGeomFaceCullPrim, hwcpipe_counter::MaliGeomPlaneCullPrim, hwcpipe_counter::MaliGeomSampleCullPrim, hwcpipe_counter::MaliGeomScissorCullPrim,
+        hwcpipe_counter::MaliExtBusRd, hwcpipe_counter::MaliL2CacheRdLookup,
+        hwcpipe_counter::MaliExtBusWr, hwcpipe_counter::MaliL2CacheWrLookup,
+        hwcpipe_counter::MaliLSFullRd, hwcpipe_counter::MaliLSPartRd, hwcpipe_counter::MaliLSFullWr, hwcpipe_counter::MaliLSPartWr, hwcpipe_counter::MaliLSAtomic,
+        hwcpipe_counter::MaliLSFullRd, hwcpipe_counter::MaliLSPartRd,
+        hwcpipe_counter::MaliLSFullRd, hwcpipe_counter::MaliLSPartRd, hwcpipe_counter::MaliLSFullWr, hwcpipe_counter::MaliLSPartWr, hwcpipe_counter::MaliLSAtomic, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliLSFullWr, hwcpipe_counter::MaliLSPartWr,
+        hwcpipe_counter::MaliNonFragWarp,
+        hwcpipe_counter::MaliCompOrBinningActiveCy, hwcpipe_counter::MaliNonFragWarp,
+        hwcpipe_counter::MaliSCBusFFEExtRdBt,
+        hwcpipe_counter::MaliSCBusFFEL2RdBt,
+        hwcpipe_counter::MaliSCBusLSExtRdBt,
+        hwcpipe_counter::MaliSCBusLSExtRdBt, hwcpipe_counter::MaliLSFullRd, hwcpipe_counter::MaliLSPartRd,
+        hwcpipe_counter::MaliSCBusLSL2RdBt,
+        hwcpipe_counter::MaliSCBusLSL2RdBt, hwcpipe_counter::MaliLSFullRd, hwcpipe_counter::MaliLSPartRd,
+        hwcpipe_counter::MaliSCBusLSWBWrBt, hwcpipe_counter::MaliSCBusLSOtherWrBt,
+        hwcpipe_counter::MaliSCBusLSWBWrBt, hwcpipe_counter::MaliSCBusLSOtherWrBt,
+        hwcpipe_counter::MaliSCBusLSWBWrBt, hwcpipe_counter::MaliSCBusLSOtherWrBt, hwcpipe_counter::MaliLSFullWr, hwcpipe_counter::MaliLSPartWr,
+        hwcpipe_counter::MaliSCBusTexExtRdBt,
+        hwcpipe_counter::MaliSCBusTexExtRdBt, hwcpipe_counter::MaliTexFiltIssueCy,
+        hwcpipe_counter::MaliSCBusTexL2RdBt,
+        hwcpipe_counter::MaliSCBusTexL2RdBt, hwcpipe_counter::MaliTexFiltIssueCy,
+        hwcpipe_counter::MaliSCBusTileWrBt, hwcpipe_counter::MaliMainQueueTask,
+        hwcpipe_counter::MaliSCBusTileWrBt,
+        hwcpipe_counter::MaliTexFiltIssueCy, hwcpipe_counter::MaliTexCacheLookupCy, hwcpipe_counter::MaliTexCacheSimpleLoadCy, hwcpipe_counter::MaliTexCacheComplexLoadCy, hwcpipe_counter::MaliTexInBt, hwcpipe_counter::MaliTexOutBt, hwcpipe_counter::MaliTexL1CacheOutputCy, hwcpipe_counter::MaliTexL1CacheLookupCy, hwcpipe_counter::MaliTexIndexCy, hwcpipe_counter::MaliTexOutMsg, hwcpipe_counter::MaliTexOutSingleMsg,
+        hwcpipe_counter::MaliTexFiltIssueCy, hwcpipe_counter::MaliTexCacheLookupCy, hwcpipe_counter::MaliTexCacheSimpleLoadCy, hwcpipe_counter::MaliTexCacheComplexLoadCy, hwcpipe_counter::MaliTexInBt, hwcpipe_counter::MaliTexOutBt, hwcpipe_counter::MaliTexL1CacheOutputCy, hwcpipe_counter::MaliTexL1CacheLookupCy, hwcpipe_counter::MaliTexIndexCy,
+        hwcpipe_counter::MaliTexOutMsg, hwcpipe_counter::MaliTexOutSingleMsg,
+        hwcpipe_counter::MaliTexOutMsg, hwcpipe_counter::MaliTexOutSingleMsg,
+        hwcpipe_counter::MaliTexFiltIssueCy, hwcpipe_counter::MaliTexCacheLookupCy, hwcpipe_counter::MaliTexCacheSimpleLoadCy, hwcpipe_counter::MaliTexCacheComplexLoadCy, hwcpipe_counter::MaliTexInBt, hwcpipe_counter::MaliTexOutBt, hwcpipe_counter::MaliTexL1CacheOutputCy, hwcpipe_counter::MaliTexL1CacheLookupCy, hwcpipe_counter::MaliTexIndexCy, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliTilerActiveCy, hwcpipe_counter::MaliGPUActiveCy,
+        hwcpipe_counter::MaliVar16IssueSlot,
+        hwcpipe_counter::MaliVar32IssueSlot,
+        hwcpipe_counter::MaliVar32IssueSlot, hwcpipe_counter::MaliVar16IssueSlot,
+        hwcpipe_counter::MaliVar32IssueSlot, hwcpipe_counter::MaliVar16IssueSlot, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliCoreAllRegsWarp, hwcpipe_counter::MaliNonFragWarp, hwcpipe_counter::MaliFragWarp,
+        hwcpipe_counter::MaliCoreFullWarp, hwcpipe_counter::MaliNonFragWarp, hwcpipe_counter::MaliFragWarp,
+        hwcpipe_counter::MaliEngFMAInstr, hwcpipe_counter::MaliEngCVTInstr, hwcpipe_counter::MaliEngSFUInstr,
+        hwcpipe_counter::MaliEngCVTInstr, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliEngFMAInstr, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliEngSFUInstr, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliEngSWBlendInstr, hwcpipe_counter::MaliFragWarp,
+        hwcpipe_counter::MaliFragRastPartQd, hwcpipe_counter::MaliFragRastQd,
+        hwcpipe_counter::MaliTexInBt, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliTexOutBt, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliAnyActiveCy, hwcpipe_counter::MaliGPUActiveCy,
+        hwcpipe_counter::MaliCSFCEUActiveCy, hwcpipe_counter::MaliGPUActiveCy,
+        hwcpipe_counter::MaliCSFLSUActiveCy, hwcpipe_counter::MaliGPUActiveCy,
+        hwcpipe_counter::MaliCSFMCUActiveCy, hwcpipe_counter::MaliGPUActiveCy,
+        hwcpipe_counter::MaliCompQueuedCy, hwcpipe_counter::MaliCompQueueAssignStallCy,
+        hwcpipe_counter::MaliCompQueuedCy, hwcpipe_counter::MaliCompQueueAssignStallCy, hwcpipe_counter::MaliGPUActiveCy,
+        hwcpipe_counter::MaliFragThread, hwcpipe_counter::MaliFragWarp,
+        hwcpipe_counter::MaliEngNarrowInstr, hwcpipe_counter::MaliEngFMAInstr, hwcpipe_counter::MaliEngCVTInstr, hwcpipe_counter::MaliEngSFUInstr,
+        hwcpipe_counter::MaliFragRastCoarseQd, hwcpipe_counter::MaliFragRastQd,
+        hwcpipe_counter::MaliGeomFaceCullPrim, hwcpipe_counter::MaliGeomPlaneCullPrim, hwcpipe_counter::MaliGeomSampleCullPrim, hwcpipe_counter::MaliGeomScissorCullPrim, hwcpipe_counter::MaliGeomVisiblePrim,
+        hwcpipe_counter::MaliGeomPlaneCullPrim, hwcpipe_counter::MaliGeomFaceCullPrim, hwcpipe_counter::MaliGeomSampleCullPrim, hwcpipe_counter::MaliGeomScissorCullPrim, hwcpipe_counter::MaliGeomVisiblePrim,
+        hwcpipe_counter::MaliRTUBoxIssueCy, hwcpipe_counter::MaliRTUTriIssueCy,
+        hwcpipe_counter::MaliRTUBoxIssueCy, hwcpipe_counter::MaliRTUTriIssueCy, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliBinningQueuedCy, hwcpipe_counter::MaliBinningQueueAssignStallCy,
+        hwcpipe_counter::MaliBinningQueuedCy, hwcpipe_counter::MaliBinningQueueAssignStallCy, hwcpipe_counter::MaliGPUActiveCy,
+        hwcpipe_counter::MaliCompOrBinningActiveCy, hwcpipe_counter::MaliAnyActiveCy,
+        hwcpipe_counter::MaliGeomScissorCullPrim, hwcpipe_counter::MaliGeomFaceCullPrim, hwcpipe_counter::MaliGeomPlaneCullPrim, hwcpipe_counter::MaliGeomSampleCullPrim, hwcpipe_counter::MaliGeomVisiblePrim,
+        hwcpipe_counter::MaliMainQueuedCy, hwcpipe_counter::MaliMainQueueAssignStallCy,
+        hwcpipe_counter::MaliMainQueuedCy, hwcpipe_counter::MaliMainQueueAssignStallCy, hwcpipe_counter::MaliGPUActiveCy,
+        hwcpipe_counter::MaliMainActiveCy, hwcpipe_counter::MaliAnyActiveCy,
+        hwcpipe_counter::MaliEngAttrBackpressureCy, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliEngBlendBackpressureCy, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliEngLSBackpressureCy, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliEngFMAInstr, hwcpipe_counter::MaliEngCVTInstr, hwcpipe_counter::MaliEngSFUInstr, hwcpipe_counter::MaliEngSlot1IssueCy,
+        hwcpipe_counter::MaliEngTexBackpressureCy, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliEngVarBackpressureCy, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliEngZSBackpressureCy, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliFragPrim, hwcpipe_counter::MaliFragPrepassCullPrim, hwcpipe_counter::MaliFragPrepassPrim,
+        hwcpipe_counter::MaliFragMainPassStallCy, hwcpipe_counter::MaliMainActiveCy,
+        hwcpipe_counter::MaliFragWarp, hwcpipe_counter::MaliFragPrepassWarp,
+        hwcpipe_counter::MaliFragPrepassCullPrim, hwcpipe_counter::MaliFragPrim, hwcpipe_counter::MaliFragPrepassPrim,
+        hwcpipe_counter::MaliFragPrepassKillQd, hwcpipe_counter::MaliFragPrepassTestQd,
+        hwcpipe_counter::MaliFragPrepassPrim, hwcpipe_counter::MaliFragPrim, hwcpipe_counter::MaliFragPrepassCullPrim,
+        hwcpipe_counter::MaliFragPrepassSkippedPrim, hwcpipe_counter::MaliFragPrim, hwcpipe_counter::MaliFragPrepassCullPrim, hwcpipe_counter::MaliFragPrepassPrim,
+        hwcpipe_counter::MaliFragPrepassWarp,
+        hwcpipe_counter::MaliFragPrepassWarp, hwcpipe_counter::MaliFragWarp,
+    };
+
+    constexpr counter_record g625_counters[] {
+        {hwcpipe_counter::MaliALUIssueCy, MaliALUIssueCy_v4, formula_4_flat, formula_4_batch, g625_counters_dependencies + 0, 4},
+        {hwcpipe_counter::MaliALUUtil, MaliALUUtil_v4, formula_9_flat, formula_9_batch, g625_counters_dependencies + 4, 5},
+        {hwcpipe_counter::MaliAttrInstr, 52, 0, block_type::core},
+        {hwcpipe_counter::MaliCoreActiveCy, 26, 0, block_type::core},
+        {hwcpipe_counter::MaliCoreUtil, MaliCoreUtil_v1, formula_5_flat, formula_5_batch, g625_counters_dependencies + 9, 2},
+        {hwcpipe_counter::MaliEngDivergedInstr, 31, 0, block_type::core},
+        {hwcpipe_counter::MaliEngDivergedInstrRate, MaliEngDivergedInstrRate_v1, formula_17_flat, formula_17_batch, g625_counters_dependencies + 11, 4},
+        {hwcpipe_counter::MaliEngStarveCy, 33, 0, block_type::core},
+        {hwcpipe_counter::MaliExtBusRd, 29, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdBt, 32, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdBy, MaliExtBusRdBy_v0, formula_21_flat, formula_21_batch, g625_counters_dependencies + 15, 1},
+        {hwcpipe_counter::MaliExtBusRdLat0, 37, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdLat128, 38, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdLat192, 39, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdLat256, 40, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdLat320, 41, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdLat384, MaliExtBusRdLat384_v0, formula_22_flat, formula_22_batch, g625_counters_dependencies + 16, 6},
+        {hwcpipe_counter::MaliExtBusRdNoSnoop, 30, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdOTQ1, 34, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdOTQ2, 35, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdOTQ3, 36, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdOTQ4, MaliExtBusRdOTQ4_v0, formula_23_flat, formula_23_batch, g625_counters_dependencies + 22, 4},
+        {hwcpipe_counter::MaliExtBusRdStallCy, 33, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdStallRate, MaliExtBusRdStallRate_v0, formula_24_flat, formula_24_batch, g625_counters_dependencies + 26, 2},
+        {hwcpipe_counter::MaliExtBusRdUnique, 31, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWr, 42, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrBt, 47, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrBy, MaliExtBusWrBy_v0, formula_21_flat, formula_21_batch, g625_counters_dependencies + 28, 1},
+        {hwcpipe_counter::MaliExtBusWrNoSnoopFull, 43, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrNoSnoopPart, 44, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrOTQ1, 49, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrOTQ2, 50, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrOTQ3, 51, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrOTQ4, MaliExtBusWrOTQ4_v0, formula_23_flat, formula_23_batch, g625_counters_dependencies + 29, 4},
+        {hwcpipe_counter::MaliExtBusWrSnoopFull, 45, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrSnoopPart, 46, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrStallCy, 48, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrStallRate, MaliExtBusWrStallRate_v0, formula_24_flat, formula_24_batch, g625_counters_dependencies + 33, 2},
+        {hwcpipe_counter::MaliFragEZSKillQd, 14, 0, block_type::core},
+        {hwcpipe_counter::MaliFragEZSTestQd, 12, 0, block_type::core},
+        {hwcpipe_counter::MaliFragEZSUpdateQd, 13, 0, block_type::core},
+        {hwcpipe_counter::MaliFragFPKActiveCy, 7, 0, block_type::core},
+        {hwcpipe_counter::MaliFragFPKBUtil, MaliFragFPKBUtil_v1, formula_5_flat, formula_5_batch, g625_counters_dependencies + 35, 2},
+        {hwcpipe_counter::MaliFragLZSKillQd, 16, 0, block_type::core},
+        {hwcpipe_counter::MaliFragLZSKillRate, MaliFragLZSKillRate_v1, formula_32_flat, formula_32_batch, g625_counters_dependencies + 37, 2},
+        {hwcpipe_counter::MaliFragLZSTestQd, 15, 0, block_type::core},
+        {hwcpipe_counter::MaliFragLZSTestRate, MaliFragLZSTestRate_v1, formula_32_flat, formula_32_batch, g625_counters_dependencies + 39, 2},
+        {hwcpipe_counter::MaliFragOpaqueQd, 20, 0, block_type::core},
+        {hwcpipe_counter::MaliFragOverdraw, MaliFragOverdraw_v4, formula_39_flat, formula_39_batch, g625_counters_dependencies + 41, 2},
+        {hwcpipe_counter::MaliFragRastPrim, 6, 0, block_type::core},
+        {hwcpipe_counter::MaliFragRastQd, 11, 0, block_type::core},
+        {hwcpipe_counter::MaliFragShadedQd, MaliFragShadedQd_v2, formula_46_flat, formula_46_batch, g625_counters_dependencies + 43, 1},
+        {hwcpipe_counter::MaliFragThread, 69, 2, block_type::core},
+        {hwcpipe_counter::MaliFragThroughputCy, MaliFragThroughputCy_v5, formula_53_flat, formula_53_batch, g625_counters_dependencies + 44, 3},
+        {hwcpipe_counter::MaliFragTile, 18, 0, block_type::core},
+        {hwcpipe_counter::MaliFragTileKill, 19, 0, block_type::core},
+        {hwcpipe_counter::MaliFragTileKillRate, MaliFragTileKillRate_v1, formula_32_flat, formula_32_batch, g625_counters_dependencies + 47, 2},
+        {hwcpipe_counter::MaliFragWarp, 9, 0, block_type::core},
+        {hwcpipe_counter::MaliGPUActiveCy, 4, 0, block_type::fe},
+        {hwcpipe_counter::MaliGPUCyPerPix, MaliGPUCyPerPix_v2, formula_39_flat, formula_39_batch, g625_counters_dependencies + 49, 2},
+        {hwcpipe_counter::MaliGPUIRQActiveCy, 10, 0, block_type::fe},
+        {hwcpipe_counter::MaliGPUIRQUtil, MaliGPUIRQUtil_v0, formula_5_flat, formula_5_batch, g625_counters_dependencies + 51, 2},
+        {hwcpipe_counter::MaliGPUPix, MaliGPUPix_v1, formula_55_flat, formula_55_batch, g625_counters_dependencies + 53, 1},
+        {hwcpipe_counter::MaliGeomBackFacePrim, 10, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomFrontFacePrim, 9, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomLinePrim, 7, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomPointPrim, 8, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomPosShadTask, 21, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomPosShadThread, MaliGeomPosShadThread_v1, formula_43_flat, formula_43_batch, g625_counters_dependencies + 54, 1},
+        {hwcpipe_counter::MaliGeomPosShadThreadPerPrim, MaliGeomPosShadThreadPerPrim_v3, formula_62_flat, formula_62_batch, g625_counters_dependencies + 55, 6},
+        {hwcpipe_counter::MaliGeomSampleCullPrim, 14, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomSampleCullRate, MaliGeomSampleCullRate_v2, formula_64_flat, formula_64_batch, g625_counters_dependencies + 61, 5},
+        {hwcpipe_counter::MaliGeomTotalCullPrim, MaliGeomTotalCullPrim_v2, formula_66_flat, formula_66_batch, g625_counters_dependencies + 66, 4},
+        {hwcpipe_counter::MaliGeomTotalPrim, MaliGeomTotalPrim_v2, formula_67_flat, formula_67_batch, g625_counters_dependencies + 70, 5},
+        {hwcpipe_counter::MaliGeomTrianglePrim, 6, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomVarShadTask, 36, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomVarShadThread, MaliGeomVarShadThread_v1, formula_43_flat, formula_43_batch, g625_counters_dependencies + 75, 1},
+        {hwcpipe_counter::MaliGeomVisiblePrim, 11, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomVisibleRate, MaliGeomVisibleRate_v2, formula_70_flat, formula_70_batch, g625_counters_dependencies + 76, 5},
+        {hwcpipe_counter::MaliL2CacheFlush, 13, 0, block_type::fe},
+        {hwcpipe_counter::MaliL2CacheIncSnp, 52, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheIncSnpStallCy, 53, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheL1Rd, 22, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheL1RdStallCy, 23, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheL1Wr, 24, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheLookup, 25, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheRd, 16, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheRdLookup, 26, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheRdMissRate, MaliL2CacheRdMissRate_v0, formula_5_flat, formula_5_batch, g625_counters_dependencies + 81, 2},
+        {hwcpipe_counter::MaliL2CacheRdStallCy, 17, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheSnp, 20, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheSnpLookup, 28, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheSnpStallCy, 21, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheWr, 18, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheWrLookup, 27, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheWrMissRate, MaliL2CacheWrMissRate_v0, formula_5_flat, formula_5_batch, g625_counters_dependencies + 83, 2},
+        {hwcpipe_counter::MaliL2CacheWrStallCy, 19, 0, block_type::memory},
+        {hwcpipe_counter::MaliLSAtomic, 48, 0, block_type::core},
+        {hwcpipe_counter::MaliLSFullRd, 44, 0, block_type::core},
+        {hwcpipe_counter::MaliLSFullWr, 46, 0, block_type::core},
+        {hwcpipe_counter::MaliLSIssueCy, MaliLSIssueCy_v0, formula_67_flat, formula_67_batch, g625_counters_dependencies + 85, 5},
+        {hwcpipe_counter::MaliLSPartRd, 45, 0, block_type::core},
+        {hwcpipe_counter::MaliLSPartWr, 47, 0, block_type::core},
+        {hwcpipe_counter::MaliLSRdCy, MaliLSRdCy_v0, formula_71_flat, formula_71_batch, g625_counters_dependencies + 90, 2},
+        {hwcpipe_counter::MaliLSUtil, MaliLSUtil_v0, formula_72_flat, formula_72_batch, g625_counters_dependencies + 92, 6},
+        {hwcpipe_counter::MaliLSWrCy, MaliLSWrCy_v0, formula_71_flat, formula_71_batch, g625_counters_dependencies + 98, 2},
+        {hwcpipe_counter::MaliMMUL2Hit, 8, 0, block_type::memory},
+        {hwcpipe_counter::MaliMMUL2Rd, 6, 0, block_type::memory},
+        {hwcpipe_counter::MaliMMUL3Hit, 7, 0, block_type::memory},
+        {hwcpipe_counter::MaliMMUL3Rd, 5, 0, block_type::memory},
+        {hwcpipe_counter::MaliMMULookup, 4, 0, block_type::memory},
+        {hwcpipe_counter::MaliNonFragTask, 23, 0, block_type::core},
+        {hwcpipe_counter::MaliNonFragThread, MaliNonFragThread_v2, formula_43_flat, formula_43_batch, g625_counters_dependencies + 100, 1},
+        {hwcpipe_counter::MaliNonFragThroughputCy, MaliNonFragThroughputCy_v3, formula_51_flat, formula_51_batch, g625_counters_dependencies + 101, 2},
+        {hwcpipe_counter::MaliNonFragWarp, 24, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusFFEExtRdBt, 55, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusFFEExtRdBy, MaliSCBusFFEExtRdBy_v0, formula_43_flat, formula_43_batch, g625_counters_dependencies + 103, 1},
+        {hwcpipe_counter::MaliSCBusFFEL2RdBt, 54, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusFFEL2RdBy, MaliSCBusFFEL2RdBy_v0, formula_43_flat, formula_43_batch, g625_counters_dependencies + 104, 1},
+        {hwcpipe_counter::MaliSCBusLSExtRdBt, 57, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusLSExtRdBy, MaliSCBusLSExtRdBy_v0, formula_43_flat, formula_43_batch, g625_counters_dependencies + 105, 1},
+        {hwcpipe_counter::MaliSCBusLSExtRdByPerRd, MaliSCBusLSExtRdByPerRd_v0, formula_75_flat, formula_75_batch, g625_counters_dependencies + 106, 3},
+        {hwcpipe_counter::MaliSCBusLSL2RdBt, 56, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusLSL2RdBy, MaliSCBusLSL2RdBy_v0, formula_43_flat, formula_43_batch, g625_counters_dependencies + 109, 1},
+        {hwcpipe_counter::MaliSCBusLSL2RdByPerRd, MaliSCBusLSL2RdByPerRd_v0, formula_75_flat, formula_75_batch, g625_counters_dependencies + 110, 3},
+        {hwcpipe_counter::MaliSCBusLSOtherWrBt, 61, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusLSWBWrBt, 63, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusLSWrBt, MaliSCBusLSWrBt_v0, formula_71_flat, formula_71_batch, g625_counters_dependencies + 113, 2},
+        {hwcpipe_counter::MaliSCBusLSWrBy, MaliSCBusLSWrBy_v0, formula_77_flat, formula_77_batch, g625_counters_dependencies + 115, 2},
+        {hwcpipe_counter::MaliSCBusLSWrByPerWr, MaliSCBusLSWrByPerWr_v0, formula_76_flat, formula_76_batch, g625_counters_dependencies + 117, 4},
+        {hwcpipe_counter::MaliSCBusOtherL2RdBt, 60, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusTexExtRdBt, 59, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusTexExtRdBy, MaliSCBusTexExtRdBy_v0, formula_43_flat, formula_43_batch, g625_counters_dependencies + 121, 1},
+        {hwcpipe_counter::MaliSCBusTexExtRdByPerRd, MaliSCBusTexExtRdByPerRd_v0, formula_78_flat, formula_78_batch, g625_counters_dependencies + 122, 2},
+        {hwcpipe_counter::MaliSCBusTexL2RdBt, 58, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusTexL2RdBy, MaliSCBusTexL2RdBy_v0, formula_43_flat, formula_43_batch, g625_counters_dependencies + 124, 1},
+        {hwcpipe_counter::MaliSCBusTexL2RdByPerRd, MaliSCBusTexL2RdByPerRd_v0, formula_78_flat, formula_78_batch, g625_counters_dependencies + 125, 2},
+        {hwcpipe_counter::MaliSCBusTileWrBPerPx, MaliSCBusTileWrBPerPx_v1, formula_79_flat, formula_79_batch, g625_counters_dependencies + 127, 2},
+        {hwcpipe_counter::MaliSCBusTileWrBt, 62, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusTileWrBy, MaliSCBusTileWrBy_v0, formula_43_flat, formula_43_batch, g625_counters_dependencies + 129, 1},
+        {hwcpipe_counter::MaliTexCPI, MaliTexCPI_v4, formula_81_flat, formula_81_batch, g625_counters_dependencies + 130, 11},
+        {hwcpipe_counter::MaliTexFiltIssueCy, 39, 0, block_type::core},
+        {hwcpipe_counter::MaliTexIssueCy, MaliTexIssueCy_v1, formula_83_flat, formula_83_batch, g625_counters_dependencies + 141, 9},
+        {hwcpipe_counter::MaliTexQuads, MaliTexQuads_v2, formula_85_flat, formula_85_batch, g625_counters_dependencies + 150, 2},
+        {hwcpipe_counter::MaliTexSample, MaliTexSample_v4, formula_87_flat, formula_87_batch, g625_counters_dependencies + 152, 2},
+        {hwcpipe_counter::MaliTexUtil, MaliTexUtil_v1, formula_88_flat, formula_88_batch, g625_counters_dependencies + 154, 10},
+        {hwcpipe_counter::MaliTilerActiveCy, 4, 0, block_type::tiler},
+        {hwcpipe_counter::MaliTilerPosCacheHit, 26, 4, block_type::tiler},
+        {hwcpipe_counter::MaliTilerPosShadFIFOFullCy, 24, 0, block_type::tiler},
+        {hwcpipe_counter::MaliTilerPosShadStallCy, 23, 0, block_type::tiler},
+        {hwcpipe_counter::MaliTilerRdBt, 17, 0, block_type::tiler},
+        {hwcpipe_counter::MaliTilerUtil, MaliTilerUtil_v0, formula_5_flat, formula_5_batch, g625_counters_dependencies + 164, 2},
+        {hwcpipe_counter::MaliTilerVarCacheHit, 34, 4, block_type::tiler},
+        {hwcpipe_counter::MaliTilerVarShadStallCy, 38, 0, block_type::tiler},
+        {hwcpipe_counter::MaliVar16IssueCy, MaliVar16IssueCy_v2, formula_91_flat, formula_91_batch, g625_counters_dependencies + 166, 1},
+        {hwcpipe_counter::MaliVar16IssueSlot, 51, 0, block_type::core},
+        {hwcpipe_counter::MaliVar32IssueCy, MaliVar32IssueCy_v2, formula_91_flat, formula_91_batch, g625_counters_dependencies + 167, 1},
+        {hwcpipe_counter::MaliVar32IssueSlot, 50, 0, block_type::core},
+        {hwcpipe_counter::MaliVarInstr, 49, 0, block_type::core},
+        {hwcpipe_counter::MaliVarIssueCy, MaliVarIssueCy_v2, formula_93_flat, formula_93_batch, g625_counters_dependencies + 168, 2},
+        {hwcpipe_counter::MaliVarUtil, MaliVarUtil_v2, formula_95_flat, formula_95_batch, g625_counters_dependencies + 170, 3},
+        {hwcpipe_counter::MaliCoreAllRegsWarp, 17, 0, block_type::core},
+        {hwcpipe_counter::MaliCoreAllRegsWarpRate, MaliCoreAllRegsWarpRate_v0, formula_13_flat, formula_13_batch, g625_counters_dependencies + 173, 3},
+        {hwcpipe_counter::MaliCoreFullWarp, 21, 0, block_type::core},
+        {hwcpipe_counter::MaliCoreFullWarpRate, MaliCoreFullWarpRate_v0, formula_13_flat, formula_13_batch, g625_counters_dependencies + 176, 3},
+        {hwcpipe_counter::MaliEngArithInstr, MaliEngArithInstr_v0, formula_15_flat, formula_15_batch, g625_counters_dependencies + 179, 3},
+        {hwcpipe_counter::MaliEngCVTInstr, 28, 0, block_type::core},
+        {hwcpipe_counter::MaliEngCVTPipeUtil, MaliEngCVTPipeUtil_v1, formula_16_flat, formula_16_batch, g625_counters_dependencies + 182, 2},
+        {hwcpipe_counter::MaliEngFMAInstr, 27, 0, block_type::core},
+        {hwcpipe_counter::MaliEngFMAPipeUtil, MaliEngFMAPipeUtil_v1, formula_16_flat, formula_16_batch, g625_counters_dependencies + 184, 2},
+        {hwcpipe_counter::MaliEngICacheMiss, 32, 0, block_type::core},
+        {hwcpipe_counter::MaliEngSFUInstr, 29, 0, block_type::core},
+        {hwcpipe_counter::MaliEngSFUPipeUtil, MaliEngSFUPipeUtil_v0, formula_18_flat, formula_18_batch, g625_counters_dependencies + 186, 2},
+        {hwcpipe_counter::MaliEngSWBlendInstr, 34, 0, block_type::core},
+        {hwcpipe_counter::MaliEngSWBlendRate, MaliEngSWBlendRate_v1, formula_18_flat, formula_18_batch, g625_counters_dependencies + 188, 2},
+        {hwcpipe_counter::MaliFragRastPartQd, 10, 0, block_type::core},
+        {hwcpipe_counter::MaliFragRastPartQdRate, MaliFragRastPartQdRate_v0, formula_5_flat, formula_5_batch, g625_counters_dependencies + 190, 2},
+        {hwcpipe_counter::MaliTexDataFetchStallCy, 37, 0, block_type::core},
+        {hwcpipe_counter::MaliTexDescStallCy, 36, 0, block_type::core},
+        {hwcpipe_counter::MaliTexFiltStallCy, 38, 0, block_type::core},
+        {hwcpipe_counter::MaliTexInBt, 35, 0, block_type::core},
+        {hwcpipe_counter::MaliTexInBusUtil, MaliTexInBusUtil_v0, formula_5_flat, formula_5_batch, g625_counters_dependencies + 192, 2},
+        {hwcpipe_counter::MaliTexOutBt, 43, 0, block_type::core},
+        {hwcpipe_counter::MaliTexOutBusUtil, MaliTexOutBusUtil_v0, formula_5_flat, formula_5_batch, g625_counters_dependencies + 194, 2},
+        {hwcpipe_counter::MaliTexOutMsg, 42, 0, block_type::core},
+        {hwcpipe_counter::MaliAnyActiveCy, 53, 0, block_type::core},
+        {hwcpipe_counter::MaliAnyUtil, MaliAnyUtil_v0, formula_10_flat, formula_10_batch, g625_counters_dependencies + 196, 2},
+        {hwcpipe_counter::MaliCS0WaitStallCy, 84, 0, block_type::fe},
+        {hwcpipe_counter::MaliCS1WaitStallCy, 90, 0, block_type::fe},
+        {hwcpipe_counter::MaliCS2WaitStallCy, 96, 0, block_type::fe},
+        {hwcpipe_counter::MaliCS3WaitStallCy, 102, 0, block_type::fe},
+        {hwcpipe_counter::MaliCSFCEUActiveCy, 16, 0, block_type::fe},
+        {hwcpipe_counter::MaliCSFCEUUtil, MaliCSFCEUUtil_v0, formula_5_flat, formula_5_batch, g625_counters_dependencies + 198, 2},
+        {hwcpipe_counter::MaliCSFCS0ActiveCy, 80, 0, block_type::fe},
+        {hwcpipe_counter::MaliCSFCS1ActiveCy, 86, 0, block_type::fe},
+        {hwcpipe_counter::MaliCSFCS2ActiveCy, 92, 0, block_type::fe},
+        {hwcpipe_counter::MaliCSFCS3ActiveCy, 98, 0, block_type::fe},
+        {hwcpipe_counter::MaliCSFLSUActiveCy, 21, 0, block_type::fe},
+        {hwcpipe_counter::MaliCSFLSUUtil, MaliCSFLSUUtil_v0, formula_5_flat, formula_5_batch, g625_counters_dependencies + 200, 2},
+        {hwcpipe_counter::MaliCSFMCUActiveCy, 5, 0, block_type::fe},
+        {hwcpipe_counter::MaliCSFMCUUtil, MaliCSFMCUUtil_v0, formula_5_flat, formula_5_batch, g625_counters_dependencies + 202, 2},
+        {hwcpipe_counter::MaliCompQueueActiveCy, MaliCompQueueActiveCy_v0, formula_11_flat, formula_11_batch, g625_counters_dependencies + 204, 2},
+        {hwcpipe_counter::MaliCompQueueAssignStallCy, 38, 0, block_type::fe},
+        {hwcpipe_counter::MaliCompQueueDrainStallCy, 39, 0, block_type::fe},
+        {hwcpipe_counter::MaliCompQueueIRQActiveCy, 36, 0, block_type::fe},
+        {hwcpipe_counter::MaliCompQueueJob, 33, 0, block_type::fe},
+        {hwcpipe_counter::MaliCompQueueTask, 34, 0, block_type::fe},
+        {hwcpipe_counter::MaliCompQueueUtil, MaliCompQueueUtil_v0, formula_12_flat, formula_12_batch, g625_counters_dependencies + 206, 3},
+        {hwcpipe_counter::MaliCompQueuedCy, 32, 0, block_type::fe},
+        {hwcpipe_counter::MaliGPUAnyQueueActiveCy, 6, 0, block_type::fe},
+        {hwcpipe_counter::MaliGPUIRQ, 11, 0, block_type::fe},
+        {hwcpipe_counter::MaliL2CacheCleanUnique, 13, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheEvict, 12, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheFlushCy, 12, 0, block_type::fe},
+        {hwcpipe_counter::MaliTilerQueueDrainStallCy, 71, 0, block_type::fe},
+        {hwcpipe_counter::MaliCoreFragWarpOcc, MaliCoreFragWarpOcc_v0, formula_14_flat, formula_14_batch, g625_counters_dependencies + 209, 2},
+        {hwcpipe_counter::MaliEngNarrowInstr, 5, 0, block_type::core},
+        {hwcpipe_counter::MaliEngNarrowInstrRate, MaliEngNarrowInstrRate_v0, formula_17_flat, formula_17_batch, g625_counters_dependencies + 211, 4},
+        {hwcpipe_counter::MaliFragRastCoarseQd, 68, 0, block_type::core},
+        {hwcpipe_counter::MaliFragShadRate, MaliFragShadRate_v0, formula_5_flat, formula_5_batch, g625_counters_dependencies + 215, 2},
+        {hwcpipe_counter::MaliGeomFaceCullPrim, 12, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomFaceCullRate, MaliGeomFaceCullRate_v1, formula_57_flat, formula_57_batch, g625_counters_dependencies + 217, 5},
+        {hwcpipe_counter::MaliGeomPlaneCullPrim, 13, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomPlaneCullRate, MaliGeomPlaneCullRate_v1, formula_59_flat, formula_59_batch, g625_counters_dependencies + 222, 5},
+        {hwcpipe_counter::MaliRTUBox, 71, 0, block_type::core},
+        {hwcpipe_counter::MaliRTUBoxBin1, 76, 0, block_type::core},
+        {hwcpipe_counter::MaliRTUBoxBin13, 79, 0, block_type::core},
+        {hwcpipe_counter::MaliRTUBoxBin5, 77, 0, block_type::core},
+        {hwcpipe_counter::MaliRTUBoxBin9, 78, 0, block_type::core},
+        {hwcpipe_counter::MaliRTUBoxIssueCy, 85, 0, block_type::core},
+        {hwcpipe_counter::MaliRTUFirstHitTerm, 82, 0, block_type::core},
+        {hwcpipe_counter::MaliRTUIssueCy, MaliRTUIssueCy_v0, formula_73_flat, formula_73_batch, g625_counters_dependencies + 227, 2},
+        {hwcpipe_counter::MaliRTUMiss, 83, 0, block_type::core},
+        {hwcpipe_counter::MaliRTUNonOpaqueHit, 81, 0, block_type::core},
+        {hwcpipe_counter::MaliRTUOpaqueHit, 80, 0, block_type::core},
+        {hwcpipe_counter::MaliRTURay, 84, 0, block_type::core},
+        {hwcpipe_counter::MaliRTUTri, 70, 0, block_type::core},
+        {hwcpipe_counter::MaliRTUTriBin1, 72, 0, block_type::core},
+        {hwcpipe_counter::MaliRTUTriBin13, 75, 0, block_type::core},
+        {hwcpipe_counter::MaliRTUTriBin5, 73, 0, block_type::core},
+        {hwcpipe_counter::MaliRTUTriBin9, 74, 0, block_type::core},
+        {hwcpipe_counter::MaliRTUTriIssueCy, 86, 0, block_type::core},
+        {hwcpipe_counter::MaliRTUUtil, MaliRTUUtil_v0, formula_74_flat, formula_74_batch, g625_counters_dependencies + 229, 3},
+        {hwcpipe_counter::MaliBinningQueueActiveCy, MaliBinningQueueActiveCy_v0, formula_11_flat, formula_11_batch, g625_counters_dependencies + 232, 2},
+        {hwcpipe_counter::MaliBinningQueueAssignStallCy, 70, 0, block_type::fe},
+        {hwcpipe_counter::MaliBinningQueueIRQActiveCy, 68, 0, block_type::fe},
+        {hwcpipe_counter::MaliBinningQueueJob, 65, 0, block_type::fe},
+        {hwcpipe_counter::MaliBinningQueueTask, 66, 0, block_type::fe},
+        {hwcpipe_counter::MaliBinningQueueUtil, MaliBinningQueueUtil_v0, formula_12_flat, formula_12_batch, g625_counters_dependencies + 234, 3},
+        {hwcpipe_counter::MaliBinningQueuedCy, 64, 0, block_type::fe},
+        {hwcpipe_counter::MaliCompOrBinningActiveCy, 22, 0, block_type::core},
+        {hwcpipe_counter::MaliCompOrBinningUtil, MaliCompOrBinningUtil_v0, formula_5_flat, formula_5_batch, g625_counters_dependencies + 237, 2},
+        {hwcpipe_counter::MaliGeomScissorCullPrim, 70, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomScissorCullRate, MaliGeomScissorCullRate_v0, formula_65_flat, formula_65_batch, g625_counters_dependencies + 239, 5},
+        {hwcpipe_counter::MaliGeomVisibleDVSPrim, 71, 0, block_type::tiler},
+        {hwcpipe_counter::MaliMainActiveCy, 4, 0, block_type::core},
+        {hwcpipe_counter::MaliMainQueueActiveCy, MaliMainQueueActiveCy_v0, formula_11_flat, formula_11_batch, g625_counters_dependencies + 244, 2},
+        {hwcpipe_counter::MaliMainQueueAssignStallCy, 54, 0, block_type::fe},
+        {hwcpipe_counter::MaliMainQueueIRQActiveCy, 52, 0, block_type::fe},
+        {hwcpipe_counter::MaliMainQueueJob, 49, 0, block_type::fe},
+        {hwcpipe_counter::MaliMainQueueTask, 50, 0, block_type::fe},
+        {hwcpipe_counter::MaliMainQueueUtil, MaliMainQueueUtil_v0, formula_12_flat, formula_12_batch, g625_counters_dependencies + 246, 3},
+        {hwcpipe_counter::MaliMainQueuedCy, 48, 0, block_type::fe},
+        {hwcpipe_counter::MaliMainUtil, MaliMainUtil_v0, formula_5_flat, formula_5_batch, g625_counters_dependencies + 249, 2},
+        {hwcpipe_counter::MaliTexCacheComplexLoadCy, 93, 0, block_type::core},
+        {hwcpipe_counter::MaliTexCacheLookupCy, 92, 0, block_type::core},
+        {hwcpipe_counter::MaliTexCacheSimpleLoadCy, 88, 0, block_type::core},
+        {hwcpipe_counter::MaliTexClkActiveCy, 96, 0, block_type::core},
+        {hwcpipe_counter::MaliTexClkStarvedCy, 95, 0, block_type::core},
+        {hwcpipe_counter::MaliTexIndexCy, 94, 0, block_type::core},
+        {hwcpipe_counter::MaliTexL1CacheLoadCy, 87, 0, block_type::core},
+        {hwcpipe_counter::MaliTexL1CacheLookupCy, 90, 0, block_type::core},
+        {hwcpipe_counter::MaliTexL1CacheOutputCy, 89, 0, block_type::core},
+        {hwcpipe_counter::MaliTexOutSingleMsg, 91, 0, block_type::core},
+        {hwcpipe_counter::MaliTilerPrimAsPosShadStallCy, 64, 0, block_type::tiler},
+        {hwcpipe_counter::MaliCS4WaitStallCy, 108, 0, block_type::fe},
+        {hwcpipe_counter::MaliCS5WaitStallCy, 114, 0, block_type::fe},
+        {hwcpipe_counter::MaliCSDoorbellIRQCy, 14, 0, block_type::fe},
+        {hwcpipe_counter::MaliCSFCS4ActiveCy, 104, 0, block_type::fe},
+        {hwcpipe_counter::MaliCSFCS5ActiveCy, 110, 0, block_type::fe},
+        {hwcpipe_counter::MaliDefVertWarp, 106, 0, block_type::core},
+        {hwcpipe_counter::MaliEngAttrBackpressureCy, 117, 0, block_type::core},
+        {hwcpipe_counter::MaliEngAttrBackpressureRate, MaliEngAttrBackpressureRate_v0, formula_5_flat, formula_5_batch, g625_counters_dependencies + 251, 2},
+        {hwcpipe_counter::MaliEngBlendBackpressureCy, 114, 0, block_type::core},
+        {hwcpipe_counter::MaliEngBlendBackpressureRate, MaliEngBlendBackpressureRate_v0, formula_5_flat, formula_5_batch, g625_counters_dependencies + 253, 2},
+        {hwcpipe_counter::MaliEngLSBackpressureCy, 116, 0, block_type::core},
+        {hwcpipe_counter::MaliEngLSBackpressureRate, MaliEngLSBackpressureRate_v0, formula_5_flat, formula_5_batch, g625_counters_dependencies + 255, 2},
+        {hwcpipe_counter::MaliEngSlot0IssueCy, MaliEngSlot0IssueCy_v0, formula_20_flat, formula_20_batch, g625_counters_dependencies + 257, 4},
+        {hwcpipe_counter::MaliEngSlot1IssueCy, 118, 0, block_type::core},
+        {hwcpipe_counter::MaliEngSlotAnyIssueCy, 119, 0, block_type::core},
+        {hwcpipe_counter::MaliEngTexBackpressureCy, 112, 0, block_type::core},
+        {hwcpipe_counter::MaliEngTexBackpressureRate, MaliEngTexBackpressureRate_v0, formula_5_flat, formula_5_batch, g625_counters_dependencies + 261, 2},
+        {hwcpipe_counter::MaliEngVarBackpressureCy, 113, 0, block_type::core},
+        {hwcpipe_counter::MaliEngVarBackpressureRate, MaliEngVarBackpressureRate_v0, formula_5_flat, formula_5_batch, g625_counters_dependencies + 263, 2},
+        {hwcpipe_counter::MaliEngZSBackpressureCy, 115, 0, block_type::core},
+        {hwcpipe_counter::MaliEngZSBackpressureRate, MaliEngZSBackpressureRate_v0, formula_5_flat, formula_5_batch, g625_counters_dependencies + 265, 2},
+        {hwcpipe_counter::MaliFragInputPrim, MaliFragInputPrim_v0, formula_31_flat, formula_31_batch, g625_counters_dependencies + 267, 3},
+        {hwcpipe_counter::MaliFragMainPassStallCy, 105, 0, block_type::core},
+        {hwcpipe_counter::MaliFragMainPassStallRate, MaliFragMainPassStallRate_v0, formula_5_flat, formula_5_batch, g625_counters_dependencies + 270, 2},
+        {hwcpipe_counter::MaliFragMainThread, MaliFragMainThread_v0, formula_33_flat, formula_33_batch, g625_counters_dependencies + 272, 2},
+        {hwcpipe_counter::MaliFragPrepassCullPrim, 98, 0, block_type::core},
+        {hwcpipe_counter::MaliFragPrepassCullPrimRate, MaliFragPrepassCullPrimRate_v0, formula_40_flat, formula_40_batch, g625_counters_dependencies + 274, 3},
+        {hwcpipe_counter::MaliFragPrepassEZSUpdateQd, 101, 0, block_type::core},
+        {hwcpipe_counter::MaliFragPrepassKillQd, 103, 0, block_type::core},
+        {hwcpipe_counter::MaliFragPrepassKillRate, MaliFragPrepassKillRate_v0, formula_5_flat, formula_5_batch, g625_counters_dependencies + 277, 2},
+        {hwcpipe_counter::MaliFragPrepassPrim, 99, 0, block_type::core},
+        {hwcpipe_counter::MaliFragPrepassPrimRate, MaliFragPrepassPrimRate_v0, formula_41_flat, formula_41_batch, g625_counters_dependencies + 279, 3},
+        {hwcpipe_counter::MaliFragPrepassSkipPrimRate, MaliFragPrepassSkipPrimRate_v0, formula_42_flat, formula_42_batch, g625_counters_dependencies + 282, 4},
+        {hwcpipe_counter::MaliFragPrepassSkippedPrim, 100, 0, block_type::core},
+        {hwcpipe_counter::MaliFragPrepassTestQd, 102, 0, block_type::core},
+        {hwcpipe_counter::MaliFragPrepassThread, MaliFragPrepassThread_v0, formula_43_flat, formula_43_batch, g625_counters_dependencies + 286, 1},
+        {hwcpipe_counter::MaliFragPrepassWarp, 104, 0, block_type::core},
+        {hwcpipe_counter::MaliFragPrepassWarpRate, MaliFragPrepassWarpRate_v0, formula_44_flat, formula_44_batch, g625_counters_dependencies + 287, 2},
+        {hwcpipe_counter::MaliFragPrim, 97, 0, block_type::core},
+        {hwcpipe_counter::MaliGeomPosShadPartTask, 22, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomVarShadPartTask, 37, 0, block_type::tiler},
+    };
+
+    constexpr hwcpipe_counter g1_pro_counters_dependencies[] {
+        hwcpipe_counter::MaliEngFMAInstr, hwcpipe_counter::MaliEngCVTInstr, hwcpipe_counter::MaliEngSFUInstr, hwcpipe_counter::MaliEngSlot1IssueCy,
+        hwcpipe_counter::MaliEngFMAInstr, hwcpipe_counter::MaliEngCVTInstr, hwcpipe_counter::MaliEngSFUInstr, hwcpipe_counter::MaliEngSlot1IssueCy, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliCoreActiveCy, hwcpipe_counter::MaliAnyActiveCy,
+        hwcpipe_counter::MaliEngDivergedInstr, hwcpipe_counter::MaliEngFMAInstr, hwcpipe_counter::MaliEngCVTInstr, hwcpipe_counter::MaliEngSFUInstr,
+        hwcpipe_counter::MaliExtBusRdBt,
+        hwcpipe_counter::MaliExtBusRdBt, hwcpipe_counter::MaliExtBusRdLat0, hwcpipe_counter::MaliExtBusRdLat128, hwcpipe_counter::MaliExtBusRdLat192, hwcpipe_counter::MaliExtBusRdLat256, hwcpipe_counter::MaliExtBusRdLat320,
+        hwcpipe_counter::MaliExtBusRd, hwcpipe_counter::MaliExtBusRdOTQ1, hwcpipe_counter::MaliExtBusRdOTQ2, hwcpipe_counter::MaliExtBusRdOTQ3,
+        hwcpipe_counter::MaliExtBusRdStallCy, hwcpipe_counter::MaliGPUActiveCy,
+        hwcpipe_counter::MaliExtBusWrBt,
+        hwcpipe_counter::MaliExtBusWr, hwcpipe_counter::MaliExtBusWrOTQ1, hwcpipe_counter::MaliExtBusWrOTQ2, hwcpipe_counter::MaliExtBusWrOTQ3,
+        hwcpipe_counter::MaliExtBusWrStallCy, hwcpipe_counter::MaliGPUActiveCy,
+        hwcpipe_counter::MaliFragFPKActiveCy, hwcpipe_counter::MaliMainActiveCy,
+        hwcpipe_counter::MaliFragLZSKillQd, hwcpipe_counter::MaliFragWarp,
+        hwcpipe_counter::MaliFragLZSTestQd, hwcpipe_counter::MaliFragWarp,
+        hwcpipe_counter::MaliFragThread, hwcpipe_counter::MaliMainQueueTask,
+        hwcpipe_counter::MaliFragWarp,
+        hwcpipe_counter::MaliMainActiveCy, hwcpipe_counter::MaliFragWarp, hwcpipe_counter::MaliFragPrepassWarp,
+        hwcpipe_counter::MaliFragTileKill, hwcpipe_counter::MaliFragTile,
+        hwcpipe_counter::MaliGPUActiveCy, hwcpipe_counter::MaliMainQueueTask,
+        hwcpipe_counter::MaliGPUIRQActiveCy, hwcpipe_counter::MaliGPUActiveCy,
+        hwcpipe_counter::MaliMainQueueTask,
+        hwcpipe_counter::MaliGeomPosShadTask,
+        hwcpipe_counter::MaliGeomPosShadTask, hwcpipe_counter::MaliGeomFaceCullPrim, hwcpipe_counter::MaliGeomPlaneCullPrim, hwcpipe_counter::MaliGeomSampleCullPrim, hwcpipe_counter::MaliGeomScissorCullPrim, hwcpipe_counter::MaliGeomVisiblePrim,
+        hwcpipe_counter::MaliGeomSampleCullPrim, hwcpipe_counter::MaliGeomFaceCullPrim, hwcpipe_counter::MaliGeomPlaneCullPrim, hwcpipe_counter::MaliGeomScissorCullPrim, hwcpipe_counter::MaliGeomVisiblePrim,
+        hwcpipe_counter::MaliGeomFaceCullPrim, hwcpipe_counter::MaliGeomPlaneCullPrim, hwcpipe_counter::MaliGeomSampleCullPrim, hwcpipe_counter::MaliGeomScissorCullPrim,
+        hwcpipe_counter::MaliGeomFaceCullPrim, hwcpipe_counter::MaliGeomPlaneCullPrim, hwcpipe_counter::MaliGeomSampleCullPrim, hwcpipe_counter::MaliGeomScissorCullPrim, hwcpipe_counter::MaliGeomVisiblePrim,
+        hwcpipe_counter::MaliGeomVarShadTask,
+        hwcpipe_counter::MaliGeomVisiblePrim, hwcpipe_counter::MaliGeomFaceCullPrim, hwcpipe_counter::MaliGeomPlaneCullPrim, hwcpipe_counter::MaliGeomSampleCullPrim, hwcpipe_counter::MaliGeomScissorCullPrim,
+        hwcpipe_counter::MaliExtBusRd, hwcpipe_counter::MaliL2CacheRdLookup,
+        hwcpipe_counter::MaliExtBusWr, hwcpipe_counter::MaliL2CacheWrLookup,
+        hwcpipe_counter::MaliLSFullRd, hwcpipe_counter::MaliLSPartRd, hwcpipe_counter::MaliLSFullWr, hwcpipe_counter::MaliLSPartWr, hwcpipe_counter::MaliLSAtomic,
+        hwcpipe_counter::MaliLSFullRd, hwcpipe_counter::MaliLSPartRd,
+        hwcpipe_counter::MaliLSFullRd, hwcpipe_counter::MaliLSPartRd, hwcpipe_counter::MaliLSFullWr, hwcpipe_counter::MaliLSPartWr, hwcpipe_counter::MaliLSAtomic, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliLSFullWr, hwcpipe_counter::MaliLSPartWr,
+        hwcpipe_counter::MaliNonFragWarp,
+        hwcpipe_counter::MaliCompOrBinningActiveCy, hwcpipe_counter::MaliNonFragWarp,
+        hwcpipe_counter::MaliSCBusFFEExtRdBt,
+        hwcpipe_counter::MaliSCBusFFEL2RdBt,
+        hwcpipe_counter::MaliSCBusLSExtRdBt,
+        hwcpipe_counter::MaliSCBusLSExtRdBt, hwcpipe_counter::MaliLSFullRd, hwcpipe_counter::MaliLSPartRd,
+        hwcpipe_counter::MaliSCBusLSL2RdBt,
+        hwcpipe_counter::MaliSCBusLSL2RdBt, hwcpipe_counter::MaliLSFullRd, hwcpipe_counter::MaliLSPartRd,
+        hwcpipe_counter::MaliSCBusLSWrBt,
+        hwcpipe_counter::MaliSCBusLSWrBt, hwcpipe_counter::MaliLSFullWr, hwcpipe_counter::MaliLSPartWr,
+        hwcpipe_counter::MaliSCBusTexExtRdBt,
+        hwcpipe_counter::MaliSCBusTexExtRdBt, hwcpipe_counter::MaliTexFiltIssueCy,
+        hwcpipe_counter::MaliSCBusTexL2RdBt,
+        hwcpipe_counter::MaliSCBusTexL2RdBt, hwcpipe_counter::MaliTexFiltIssueCy,
+        hwcpipe_counter::MaliSCBusTileWrBt, hwcpipe_counter::MaliMainQueueTask,
+        hwcpipe_counter::MaliSCBusTileWrBt,
+        hwcpipe_counter::MaliTexFiltIssueCy, hwcpipe_counter::MaliTexCacheLookupCy, hwcpipe_counter::MaliTexCacheSimpleLoadCy, hwcpipe_counter::MaliTexCacheComplexLoadCy, hwcpipe_counter::MaliTexInBt, hwcpipe_counter::MaliTexOutBt, hwcpipe_counter::MaliTexL1CacheOutputCy, hwcpipe_counter::MaliTexL1CacheLookupCy, hwcpipe_counter::MaliTexIndexCy, hwcpipe_counter::MaliTexOutMsg, hwcpipe_counter::MaliTexOutSingleMsg,
+        hwcpipe_counter::MaliTexFiltIssueCy, hwcpipe_counter::MaliTexCacheLookupCy, hwcpipe_counter::MaliTexCacheSimpleLoadCy, hwcpipe_counter::MaliTexCacheComplexLoadCy, hwcpipe_counter::MaliTexInBt, hwcpipe_counter::MaliTexOutBt, hwcpipe_counter::MaliTexL1CacheOutputCy, hwcpipe_counter::MaliTexL1CacheLookupCy, hwcpipe_counter::MaliTexIndexCy,
+        hwcpipe_counter::MaliTexOutMsg, hwcpipe_counter::MaliTexOutSingleMsg,
+        hwcpipe_counter::MaliTexOutMsg, hwcpipe_counter::MaliTexOutSingleMsg,
+        hwcpipe_counter::MaliTexFiltIssueCy, hwcpipe_counter::MaliTexCacheLookupCy, hwcpipe_counter::MaliTexCacheSimpleLoadCy, hwcpipe_counter::MaliTexCacheComplexLoadCy, hwcpipe_counter::MaliTexInBt, hwcpipe_counter::MaliTexOutBt, hwcpipe_counter::MaliTexL1CacheOutputCy, hwcpipe_counter::MaliTexL1CacheLookupCy, hwcpipe_counter::MaliTexIndexCy, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliTilerActiveCy, hwcpipe_counter::MaliGPUActiveCy,
+        hwcpipe_counter::MaliVar16IssueSlot,
+        hwcpipe_counter::MaliVar32IssueSlot,
+        hwcpipe_counter::MaliVar32IssueSlot, hwcpipe_counter::MaliVar16IssueSlot,
+        hwcpipe_counter::MaliVar32IssueSlot, hwcpipe_counter::MaliVar16IssueSlot, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliCoreAllRegsWarp, hwcpipe_counter::MaliNonFragWarp, hwcpipe_counter::MaliFragWarp,
+        hwcpipe_counter::MaliCoreFullWarp, hwcpipe_counter::MaliNonFragWarp, hwcpipe_counter::MaliFragWarp,
+        hwcpipe_counter::MaliSCBusOtherWrBt,
+        hwcpipe_counter::MaliEngFMAInstr, hwcpipe_counter::MaliEngCVTInstr, hwcpipe_counter::MaliEngSFUInstr,
+        hwcpipe_counter::MaliEngCVTInstr, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliEngFMAInstr, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliEngSFUInstr, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliEngSWBlendInstr, hwcpipe_counter::MaliFragWarp,
+        hwcpipe_counter::MaliFragRastPartQd, hwcpipe_counter::MaliFragRastQd,
+        hwcpipe_counter::MaliTexInBt, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliTexOutBt, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliAnyActiveCy, hwcpipe_counter::MaliGPUActiveCy,
+        hwcpipe_counter::MaliCSFCEUActiveCy, hwcpipe_counter::MaliGPUActiveCy,
+        hwcpipe_counter::MaliCSFLSUActiveCy, hwcpipe_counter::MaliGPUActiveCy,
+        hwcpipe_counter::MaliCSFMCUActiveCy, hwcpipe_counter::MaliGPUActiveCy,
+        hwcpipe_counter::MaliCompQueuedCy, hwcpipe_counter::MaliCompQueueAssignStallCy,
+        hwcpipe_counter::MaliCompQueuedCy, hwcpipe_counter::MaliCompQueueAssignStallCy, hwcpipe_counter::MaliGPUActiveCy,
+        hwcpipe_counter::MaliFragThread, hwcpipe_counter::MaliFragWarp,
+        hwcpipe_counter::MaliEngNarrowInstr, hwcpipe_counter::MaliEngFMAInstr, hwcpipe_counter::MaliEngCVTInstr, hwcpipe_counter::MaliEngSFUInstr,
+        hwcpipe_counter::MaliFragRastCoarseQd, hwcpipe_counter::MaliFragRastQd,
+        hwcpipe_counter::MaliGeomFaceCullPrim, hwcpipe_counter::MaliGeomPlaneCullPrim, hwcpipe_counter::MaliGeomSampleCullPrim, hwcpipe_counter::MaliGeomScissorCullPrim, hwcpipe_counter::MaliGeomVisiblePrim,
+        hwcpipe_counter::MaliGeomPlaneCullPrim, hwcpipe_counter::MaliGeomFaceCullPrim, hwcpipe_counter::MaliGeomSampleCullPrim, hwcpipe_counter::MaliGeomScissorCullPrim, hwcpipe_counter::MaliGeomVisiblePrim,
+        hwcpipe_counter::MaliRTUBoxIssueCy, hwcpipe_counter::MaliRTUTriIssueCy,
+        hwcpipe_counter::MaliRTUBoxIssueCy, hwcpipe_counter::MaliRTUTriIssueCy, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliBinningQueuedCy, hwcpipe_counter::MaliBinningQueueAssignStallCy,
+        hwcpipe_counter::MaliBinningQueuedCy, hwcpipe_counter::MaliBinningQueueAssignStallCy, hwcpipe_counter::MaliGPUActiveCy,
+        hwcpipe_counter::MaliCompOrBinningActiveCy, hwcpipe_counter::MaliAnyActiveCy,
+        hwcpipe_counter::MaliGeomScissorCullPrim, hwcpipe_counter::MaliGeomFaceCullPrim, hwcpipe_counter::MaliGeomPlaneCullPrim, hwcpipe_counter::MaliGeomSampleCullPrim, hwcpipe_counter::MaliGeomVisiblePrim,
+        hwcpipe_counter::MaliMainQueuedCy, hwcpipe_counter::MaliMainQueueAssignStallCy,
+        hwcpipe_counter::MaliMainQueuedCy, hwcpipe_counter::MaliMainQueueAssignStallCy, hwcpipe_counter::MaliGPUActiveCy,
+        hwcpipe_counter::MaliMainActiveCy, hwcpipe_counter::MaliAnyActiveCy,
+        hwcpipe_counter::MaliEngAttrBackpressureCy, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliEngBlendBackpressureCy, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliEngLSBackpressureCy, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliEngFMAInstr, hwcpipe_counter::MaliEngCVTInstr, hwcpipe_counter::MaliEngSFUInstr, hwcpipe_counter::MaliEngSlot1IssueCy,
+        hwcpipe_counter::MaliEngTexBackpressureCy, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliEngVarBackpressureCy, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliEngZSBackpressureCy, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliFragPrim, hwcpipe_counter::MaliFragPrepassCullPrim, hwcpipe_counter::MaliFragPrepassPrim,
+        hwcpipe_counter::MaliFragMainPassStallCy, hwcpipe_counter::MaliMainActiveCy,
+        hwcpipe_counter::MaliFragWarp, hwcpipe_counter::MaliFragPrepassWarp,
+        hwcpipe_counter::MaliFragPrepassCullPrim, hwcpipe_counter::MaliFragPrim, hwcpipe_counter::MaliFragPrepassPrim,
+        hwcpipe_counter::MaliFragPrepassKillQd, hwcpipe_counter::MaliFragPrepassTestQd,
+        hwcpipe_counter::MaliFragPrepassPrim, hwcpipe_counter::MaliFragPrim, hwcpipe_counter::MaliFragPrepassCullPrim,
+        hwcpipe_counter::MaliFragPrepassSkippedPrim, hwcpipe_counter::MaliFragPrim, hwcpipe_counter::MaliFragPrepassCullPrim, hwcpipe_counter::MaliFragPrepassPrim,
+        hwcpipe_counter::MaliFragPrepassWarp,
+        hwcpipe_counter::MaliFragPrepassWarp, hwcpipe_counter::MaliFragWarp,
+        hwcpipe_counter::MaliAttrIssueCy, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliBlendIssueCy, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliEngRTUBackpressureCy, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliSCBusRTUExtRdBt,
+        hwcpipe_counter::MaliSCBusRTUL2RdBt,
+    };
+
+    constexpr counter_record g1_pro_counters[] {
+        {hwcpipe_counter::MaliALUIssueCy, MaliALUIssueCy_v4, formula_4_flat, formula_4_batch, g1_pro_counters_dependencies + 0, 4},
+        {hwcpipe_counter::MaliALUUtil, MaliALUUtil_v4, formula_9_flat, formula_9_batch, g1_pro_counters_dependencies + 4, 5},
+        {hwcpipe_counter::MaliAttrInstr, 52, 0, block_type::core},
+        {hwcpipe_counter::MaliCoreActiveCy, 26, 0, block_type::core},
+        {hwcpipe_counter::MaliCoreUtil, MaliCoreUtil_v1, formula_5_flat, formula_5_batch, g1_pro_counters_dependencies + 9, 2},
+        {hwcpipe_counter::MaliEngDivergedInstr, 31, 0, block_type::core},
+        {hwcpipe_counter::MaliEngDivergedInstrRate, MaliEngDivergedInstrRate_v1, formula_17_flat, formula_17_batch, g1_pro_counters_dependencies + 11, 4},
+        {hwcpipe_counter::MaliEngStarveCy, 33, 0, block_type::core},
+        {hwcpipe_counter::MaliExtBusRd, 29, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdBt, 32, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdBy, MaliExtBusRdBy_v0, formula_21_flat, formula_21_batch, g1_pro_counters_dependencies + 15, 1},
+        {hwcpipe_counter::MaliExtBusRdLat0, 37, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdLat128, 38, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdLat192, 39, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdLat256, 40, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdLat320, 41, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdLat384, MaliExtBusRdLat384_v0, formula_22_flat, formula_22_batch, g1_pro_counters_dependencies + 16, 6},
+        {hwcpipe_counter::MaliExtBusRdNoSnoop, 30, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdOTQ1, 34, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdOTQ2, 35, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdOTQ3, 36, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdOTQ4, MaliExtBusRdOTQ4_v0, formula_23_flat, formula_23_batch, g1_pro_counters_dependencies + 22, 4},
+        {hwcpipe_counter::MaliExtBusRdStallCy, 33, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdStallRate, MaliExtBusRdStallRate_v0, formula_24_flat, formula_24_batch, g1_pro_counters_dependencies + 26, 2},
+        {hwcpipe_counter::MaliExtBusRdUnique, 31, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWr, 42, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrBt, 47, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrBy, MaliExtBusWrBy_v0, formula_21_flat, formula_21_batch, g1_pro_counters_dependencies + 28, 1},
+        {hwcpipe_counter::MaliExtBusWrNoSnoopFull, 43, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrNoSnoopPart, 44, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrOTQ1, 49, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrOTQ2, 50, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrOTQ3, 51, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrOTQ4, MaliExtBusWrOTQ4_v0, formula_23_flat, formula_23_batch, g1_pro_counters_dependencies + 29, 4},
+        {hwcpipe_counter::MaliExtBusWrSnoopFull, 45, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrSnoopPart, 46, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrStallCy, 48, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrStallRate, MaliExtBusWrStallRate_v0, formula_24_flat, formula_24_batch, g1_pro_counters_dependencies + 33, 2},
+        {hwcpipe_counter::MaliFragEZSKillQd, 14, 0, block_type::core},
+        {hwcpipe_counter::MaliFragEZSTestQd, 12, 0, block_type::core},
+        {hwcpipe_counter::MaliFragEZSUpdateQd, 13, 0, block_type::core},
+        {hwcpipe_counter::MaliFragFPKActiveCy, 7, 0, block_type::core},
+        {hwcpipe_counter::MaliFragFPKBUtil, MaliFragFPKBUtil_v1, formula_5_flat, formula_5_batch, g1_pro_counters_dependencies + 35, 2},
+        {hwcpipe_counter::MaliFragLZSKillQd, 16, 0, block_type::core},
+        {hwcpipe_counter::MaliFragLZSKillRate, MaliFragLZSKillRate_v1, formula_32_flat, formula_32_batch, g1_pro_counters_dependencies + 37, 2},
+        {hwcpipe_counter::MaliFragLZSTestQd, 15, 0, block_type::core},
+        {hwcpipe_counter::MaliFragLZSTestRate, MaliFragLZSTestRate_v1, formula_32_flat, formula_32_batch, g1_pro_counters_dependencies + 39, 2},
+        {hwcpipe_counter::MaliFragOpaqueQd, 20, 0, block_type::core},
+        {hwcpipe_counter::MaliFragOverdraw, MaliFragOverdraw_v4, formula_39_flat, formula_39_batch, g1_pro_counters_dependencies + 41, 2},
+        {hwcpipe_counter::MaliFragRastPrim, 6, 0, block_type::core},
+        {hwcpipe_counter::MaliFragRastQd, 11, 0, block_type::core},
+        {hwcpipe_counter::MaliFragShadedQd, MaliFragShadedQd_v2, formula_46_flat, formula_46_batch, g1_pro_counters_dependencies + 43, 1},
+        {hwcpipe_counter::MaliFragThread, 69, 2, block_type::core},
+        {hwcpipe_counter::MaliFragThroughputCy, MaliFragThroughputCy_v5, formula_53_flat, formula_53_batch, g1_pro_counters_dependencies + 44, 3},
+        {hwcpipe_counter::MaliFragTile, 18, 0, block_type::core},
+        {hwcpipe_counter::MaliFragTileKill, 19, 0, block_type::core},
+        {hwcpipe_counter::MaliFragTileKillRate, MaliFragTileKillRate_v1, formula_32_flat, formula_32_batch, g1_pro_counters_dependencies + 47, 2},
+        {hwcpipe_counter::MaliFragWarp, 9, 0, block_type::core},
+        {hwcpipe_counter::MaliGPUActiveCy, 4, 0, block_type::fe},
+        {hwcpipe_counter::MaliGPUCyPerPix, MaliGPUCyPerPix_v2, formula_39_flat, formula_39_batch, g1_pro_counters_dependencies + 49, 2},
+        {hwcpipe_counter::MaliGPUIRQActiveCy, 10, 0, block_type::fe},
+        {hwcpipe_counter::MaliGPUIRQUtil, MaliGPUIRQUtil_v0, formula_5_flat, formula_5_batch, g1_pro_counters_dependencies + 51, 2},
+        {hwcpipe_counter::MaliGPUPix, MaliGPUPix_v1, formula_55_flat, formula_55_batch, g1_pro_counters_dependencies + 53, 1},
+        {hwcpipe_counter::MaliGeomBackFacePrim, 10, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomFrontFacePrim, 9, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomLinePrim, 7, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomPointPrim, 8, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomPosShadTask, 21, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomPosShadThread, MaliGeomPosShadThread_v1, formula_43_flat, formula_43_batch, g1_pro_counters_dependencies + 54, 1},
+        {hwcpipe_counter::MaliGeomPosShadThreadPerPrim, MaliGeomPosShadThreadPerPrim_v3, formula_62_flat, formula_62_batch, g1_pro_counters_dependencies + 55, 6},
+        {hwcpipe_counter::MaliGeomSampleCullPrim, 14, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomSampleCullRate, MaliGeomSampleCullRate_v2, formula_64_flat, formula_64_batch, g1_pro_counters_dependencies + 61, 5},
+        {hwcpipe_counter::MaliGeomTotalCullPrim, MaliGeomTotalCullPrim_v2, formula_66_flat, formula_66_batch, g1_pro_counters_dependencies + 66, 4},
+        {hwcpipe_counter::MaliGeomTotalPrim, MaliGeomTotalPrim_v2, formula_67_flat, formula_67_batch, g1_pro_counters_dependencies + 70, 5},
+        {hwcpipe_counter::MaliGeomTrianglePrim, 6, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomVarShadTask, 36, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomVarShadThread, MaliGeomVarShadThread_v1, formula_43_flat, formula_43_batch, g1_pro_counters_dependencies + 75, 1},
+        {hwcpipe_counter::MaliGeomVisiblePrim, 11, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomVisibleRate, MaliGeomVisibleRate_v2, formula_70_flat, formula_70_batch, g1_pro_counters_dependencies + 76, 5},
+        {hwcpipe_counter::MaliL2CacheFlush, 13, 0, block_type::fe},
+        {hwcpipe_counter::MaliL2CacheL1Rd, 22, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheL1RdStallCy, 23, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheL1Wr, 24, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheLookup, 25, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheRd, 16, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheRdLookup, 26, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheRdMissRate, MaliL2CacheRdMissRate_v0, formula_5_flat, formula_5_batch, g1_pro_counters_dependencies + 81, 2},
+        {hwcpipe_counter::MaliL2CacheRdStallCy, 17, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheSnp, 20, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheSnpStallCy, 21, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheWr, 18, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheWrLookup, 27, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheWrMissRate, MaliL2CacheWrMissRate_v0, formula_5_flat, formula_5_batch, g1_pro_counters_dependencies + 83, 2},
+        {hwcpipe_counter::MaliL2CacheWrStallCy, 19, 0, block_type::memory},
+        {hwcpipe_counter::MaliLSAtomic, 48, 0, block_type::core},
+        {hwcpipe_counter::MaliLSFullRd, 44, 0, block_type::core},
+        {hwcpipe_counter::MaliLSFullWr, 46, 0, block_type::core},
+        {hwcpipe_counter::MaliLSIssueCy, MaliLSIssueCy_v0, formula_67_flat, formula_67_batch, g1_pro_counters_dependencies + 85, 5},
+        {hwcpipe_counter::MaliLSPartRd, 45, 0, block_type::core},
+        {hwcpipe_counter::MaliLSPartWr, 47, 0, block_type::core},
+        {hwcpipe_counter::MaliLSRdCy, MaliLSRdCy_v0, formula_71_flat, formula_71_batch, g1_pro_counters_dependencies + 90, 2},
+        {hwcpipe_counter::MaliLSUtil, MaliLSUtil_v0, formula_72_flat, formula_72_batch, g1_pro_counters_dependencies + 92, 6},
+        {hwcpipe_counter::MaliLSWrCy, MaliLSWrCy_v0, formula_71_flat, formula_71_batch, g1_pro_counters_dependencies + 98, 2},
+        {hwcpipe_counter::MaliMMUL2Hit, 8, 0, block_type::memory},
+        {hwcpipe_counter::MaliMMUL2Rd, 6, 0, block_type::memory},
+        {hwcpipe_counter::MaliMMUL3Hit, 7, 0, block_type::memory},
+        {hwcpipe_counter::MaliMMUL3Rd, 5, 0, block_type::memory},
+        {hwcpipe_counter::MaliMMULookup, 4, 0, block_type::memory},
+        {hwcpipe_counter::MaliNonFragTask, 23, 0, block_type::core},
+        {hwcpipe_counter::MaliNonFragThread, MaliNonFragThread_v2, formula_43_flat, formula_43_batch, g1_pro_counters_dependencies + 100, 1},
+        {hwcpipe_counter::MaliNonFragThroughputCy, MaliNonFragThroughputCy_v3, formula_51_flat, formula_51_batch, g1_pro_counters_dependencies + 101, 2},
+        {hwcpipe_counter::MaliNonFragWarp, 24, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusFFEExtRdBt, 55, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusFFEExtRdBy, MaliSCBusFFEExtRdBy_v0, formula_43_flat, formula_43_batch, g1_pro_counters_dependencies + 103, 1},
+        {hwcpipe_counter::MaliSCBusFFEL2RdBt, 54, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusFFEL2RdBy, MaliSCBusFFEL2RdBy_v0, formula_43_flat, formula_43_batch, g1_pro_counters_dependencies + 104, 1},
+        {hwcpipe_counter::MaliSCBusLSExtRdBt, 57, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusLSExtRdBy, MaliSCBusLSExtRdBy_v0, formula_43_flat, formula_43_batch, g1_pro_counters_dependencies + 105, 1},
+        {hwcpipe_counter::MaliSCBusLSExtRdByPerRd, MaliSCBusLSExtRdByPerRd_v0, formula_75_flat, formula_75_batch, g1_pro_counters_dependencies + 106, 3},
+        {hwcpipe_counter::MaliSCBusLSL2RdBt, 56, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusLSL2RdBy, MaliSCBusLSL2RdBy_v0, formula_43_flat, formula_43_batch, g1_pro_counters_dependencies + 109, 1},
+        {hwcpipe_counter::MaliSCBusLSL2RdByPerRd, MaliSCBusLSL2RdByPerRd_v0, formula_75_flat, formula_75_batch, g1_pro_counters_dependencies + 110, 3},
+        {hwcpipe_counter::MaliSCBusLSWrBt, 61, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusLSWrBy, MaliSCBusLSWrBy_v1, formula_43_flat, formula_43_batch, g1_pro_counters_dependencies + 113, 1},
+        {hwcpipe_counter::MaliSCBusLSWrByPerWr, MaliSCBusLSWrByPerWr_v1, formula_75_flat, formula_75_batch, g1_pro_counters_dependencies + 114, 3},
+        {hwcpipe_counter::MaliSCBusOtherL2RdBt, 60, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusTexExtRdBt, 59, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusTexExtRdBy, MaliSCBusTexExtRdBy_v0, formula_43_flat, formula_43_batch, g1_pro_counters_dependencies + 117, 1},
+        {hwcpipe_counter::MaliSCBusTexExtRdByPerRd, MaliSCBusTexExtRdByPerRd_v0, formula_78_flat, formula_78_batch, g1_pro_counters_dependencies + 118, 2},
+        {hwcpipe_counter::MaliSCBusTexL2RdBt, 58, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusTexL2RdBy, MaliSCBusTexL2RdBy_v0, formula_43_flat, formula_43_batch, g1_pro_counters_dependencies + 120, 1},
+        {hwcpipe_counter::MaliSCBusTexL2RdByPerRd, MaliSCBusTexL2RdByPerRd_v0, formula_78_flat, formula_78_batch, g1_pro_counters_dependencies + 121, 2},
+        {hwcpipe_counter::MaliSCBusTileWrBPerPx, MaliSCBusTileWrBPerPx_v1, formula_79_flat, formula_79_batch, g1_pro_counters_dependencies + 123, 2},
+        {hwcpipe_counter::MaliSCBusTileWrBt, 62, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusTileWrBy, MaliSCBusTileWrBy_v0, formula_43_flat, formula_43_batch, g1_pro_counters_dependencies + 125, 1},
+        {hwcpipe_counter::MaliTexCPI, MaliTexCPI_v4, formula_81_flat, formula_81_batch, g1_pro_counters_dependencies + 126, 11},
+        {hwcpipe_counter::MaliTexFiltIssueCy, 39, 0, block_type::core},
+        {hwcpipe_counter::MaliTexIssueCy, MaliTexIssueCy_v1, formula_83_flat, formula_83_batch, g1_pro_counters_dependencies + 137, 9},
+        {hwcpipe_counter::MaliTexQuads, MaliTexQuads_v2, formula_85_flat, formula_85_batch, g1_pro_counters_dependencies + 146, 2},
+        {hwcpipe_counter::MaliTexSample, MaliTexSample_v4, formula_87_flat, formula_87_batch, g1_pro_counters_dependencies + 148, 2},
+        {hwcpipe_counter::MaliTexUtil, MaliTexUtil_v1, formula_88_flat, formula_88_batch, g1_pro_counters_dependencies + 150, 10},
+        {hwcpipe_counter::MaliTilerActiveCy, 4, 0, block_type::tiler},
+        {hwcpipe_counter::MaliTilerPosCacheHit, 26, 4, block_type::tiler},
+        {hwcpipe_counter::MaliTilerPosShadFIFOFullCy, 24, 0, block_type::tiler},
+        {hwcpipe_counter::MaliTilerPosShadStallCy, 23, 0, block_type::tiler},
+        {hwcpipe_counter::MaliTilerRdBt, 17, 0, block_type::tiler},
+        {hwcpipe_counter::MaliTilerUtil, MaliTilerUtil_v0, formula_5_flat, formula_5_batch, g1_pro_counters_dependencies + 160, 2},
+        {hwcpipe_counter::MaliTilerVarCacheHit, 34, 4, block_type::tiler},
+        {hwcpipe_counter::MaliTilerVarShadStallCy, 38, 0, block_type::tiler},
+        {hwcpipe_counter::MaliVar16IssueCy, MaliVar16IssueCy_v2, formula_91_flat, formula_91_batch, g1_pro_counters_dependencies + 162, 1},
+        {hwcpipe_counter::MaliVar16IssueSlot, 51, 0, block_type::core},
+        {hwcpipe_counter::MaliVar32IssueCy, MaliVar32IssueCy_v2, formula_91_flat, formula_91_batch, g1_pro_counters_dependencies + 163, 1},
+        {hwcpipe_counter::MaliVar32IssueSlot, 50, 0, block_type::core},
+        {hwcpipe_counter::MaliVarInstr, 49, 0, block_type::core},
+        {hwcpipe_counter::MaliVarIssueCy, MaliVarIssueCy_v2, formula_93_flat, formula_93_batch, g1_pro_counters_dependencies + 164, 2},
+        {hwcpipe_counter::MaliVarUtil, MaliVarUtil_v2, formula_95_flat, formula_95_batch, g1_pro_counters_dependencies + 166, 3},
+        {hwcpipe_counter::MaliCoreAllRegsWarp, 17, 0, block_type::core},
+        {hwcpipe_counter::MaliCoreAllRegsWarpRate, MaliCoreAllRegsWarpRate_v0, formula_13_flat, formula_13_batch, g1_pro_counters_dependencies + 169, 3},
+        {hwcpipe_counter::MaliCoreFullWarp, 21, 0, block_type::core},
+        {hwcpipe_counter::MaliCoreFullWarpRate, MaliCoreFullWarpRate_v0, formula_13_flat, formula_13_batch, g1_pro_counters_dependencies + 172, 3},
+        {hwcpipe_counter::MaliSCBusOtherWrBt, 63, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusOtherWrBy, MaliSCBusOtherWrBy_v0, formula_43_flat, formula_43_batch, g1_pro_counters_dependencies + 175, 1},
+        {hwcpipe_counter::MaliEngArithInstr, MaliEngArithInstr_v0, formula_15_flat, formula_15_batch, g1_pro_counters_dependencies + 176, 3},
+        {hwcpipe_counter::MaliEngCVTInstr, 28, 0, block_type::core},
+        {hwcpipe_counter::MaliEngCVTPipeUtil, MaliEngCVTPipeUtil_v1, formula_16_flat, formula_16_batch, g1_pro_counters_dependencies + 179, 2},
+        {hwcpipe_counter::MaliEngFMAInstr, 27, 0, block_type::core},
+        {hwcpipe_counter::MaliEngFMAPipeUtil, MaliEngFMAPipeUtil_v1, formula_16_flat, formula_16_batch, g1_pro_counters_dependencies + 181, 2},
+        {hwcpipe_counter::MaliEngSFUInstr, 29, 0, block_type::core},
+        {hwcpipe_counter::MaliEngSFUPipeUtil, MaliEngSFUPipeUtil_v0, formula_18_flat, formula_18_batch, g1_pro_counters_dependencies + 183, 2},
+        {hwcpipe_counter::MaliEngSWBlendInstr, 34, 0, block_type::core},
+        {hwcpipe_counter::MaliEngSWBlendRate, MaliEngSWBlendRate_v1, formula_18_flat, formula_18_batch, g1_pro_counters_dependencies + 185, 2},
+        {hwcpipe_counter::MaliFragRastPartQd, 10, 0, block_type::core},
+        {hwcpipe_counter::MaliFragRastPartQdRate, MaliFragRastPartQdRate_v0, formula_5_flat, formula_5_batch, g1_pro_counters_dependencies + 187, 2},
+        {hwcpipe_counter::MaliTexDataFetchStallCy, 37, 0, block_type::core},
+        {hwcpipe_counter::MaliTexDescStallCy, 36, 0, block_type::core},
+        {hwcpipe_counter::MaliTexFiltStallCy, 38, 0, block_type::core},
+        {hwcpipe_counter::MaliTexInBt, 35, 0, block_type::core},
+        {hwcpipe_counter::MaliTexInBusUtil, MaliTexInBusUtil_v0, formula_5_flat, formula_5_batch, g1_pro_counters_dependencies + 189, 2},
+        {hwcpipe_counter::MaliTexOutBt, 43, 0, block_type::core},
+        {hwcpipe_counter::MaliTexOutBusUtil, MaliTexOutBusUtil_v0, formula_5_flat, formula_5_batch, g1_pro_counters_dependencies + 191, 2},
+        {hwcpipe_counter::MaliTexOutMsg, 42, 0, block_type::core},
+        {hwcpipe_counter::MaliAnyActiveCy, 53, 0, block_type::core},
+        {hwcpipe_counter::MaliAnyUtil, MaliAnyUtil_v0, formula_10_flat, formula_10_batch, g1_pro_counters_dependencies + 193, 2},
+        {hwcpipe_counter::MaliCS0WaitStallCy, 84, 0, block_type::fe},
+        {hwcpipe_counter::MaliCS1WaitStallCy, 90, 0, block_type::fe},
+        {hwcpipe_counter::MaliCS2WaitStallCy, 96, 0, block_type::fe},
+        {hwcpipe_counter::MaliCS3WaitStallCy, 102, 0, block_type::fe},
+        {hwcpipe_counter::MaliCSFCEUActiveCy, 16, 0, block_type::fe},
+        {hwcpipe_counter::MaliCSFCEUUtil, MaliCSFCEUUtil_v0, formula_5_flat, formula_5_batch, g1_pro_counters_dependencies + 195, 2},
+        {hwcpipe_counter::MaliCSFCS0ActiveCy, 80, 0, block_type::fe},
+        {hwcpipe_counter::MaliCSFCS1ActiveCy, 86, 0, block_type::fe},
+        {hwcpipe_counter::MaliCSFCS2ActiveCy, 92, 0, block_type::fe},
+        {hwcpipe_counter::MaliCSFCS3ActiveCy, 98, 0, block_type::fe},
+        {hwcpipe_counter::MaliCSFLSUActiveCy, 21, 0, block_type::fe},
+        {hwcpipe_counter::MaliCSFLSUUtil, MaliCSFLSUUtil_v0, formula_5_flat, formula_5_batch, g1_pro_counters_dependencies + 197, 2},
+        {hwcpipe_counter::MaliCSFMCUActiveCy, 5, 0, block_type::fe},
+        {hwcpipe_counter::MaliCSFMCUUtil, MaliCSFMCUUtil_v0, formula_5_flat, formula_5_batch, g1_pro_counters_dependencies + 199, 2},
+        {hwcpipe_counter::MaliCompQueueActiveCy, MaliCompQueueActiveCy_v0, formula_11_flat, formula_11_batch, g1_pro_counters_dependencies + 201, 2},
+        {hwcpipe_counter::MaliCompQueueAssignStallCy, 38, 0, block_type::fe},
+        {hwcpipe_counter::MaliCompQueueDrainStallCy, 39, 0, block_type::fe},
+        {hwcpipe_counter::MaliCompQueueIRQActiveCy, 36, 0, block_type::fe},
+        {hwcpipe_counter::MaliCompQueueJob, 33, 0, block_type::fe},
+        {hwcpipe_counter::MaliCompQueueTask, 34, 0, block_type::fe},
+        {hwcpipe_counter::MaliCompQueueUtil, MaliCompQueueUtil_v0, formula_12_flat, formula_12_batch, g1_pro_counters_dependencies + 203, 3},
+        {hwcpipe_counter::MaliCompQueuedCy, 32, 0, block_type::fe},
+        {hwcpipe_counter::MaliGPUAnyQueueActiveCy, 6, 0, block_type::fe},
+        {hwcpipe_counter::MaliGPUIRQ, 11, 0, block_type::fe},
+        {hwcpipe_counter::MaliL2CacheCleanUnique, 13, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheEvict, 12, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheFlushCy, 12, 0, block_type::fe},
+        {hwcpipe_counter::MaliTilerQueueDrainStallCy, 71, 0, block_type::fe},
+        {hwcpipe_counter::MaliCoreFragWarpOcc, MaliCoreFragWarpOcc_v0, formula_14_flat, formula_14_batch, g1_pro_counters_dependencies + 206, 2},
+        {hwcpipe_counter::MaliEngNarrowInstr, 5, 0, block_type::core},
+        {hwcpipe_counter::MaliEngNarrowInstrRate, MaliEngNarrowInstrRate_v0, formula_17_flat, formula_17_batch, g1_pro_counters_dependencies + 208, 4},
+        {hwcpipe_counter::MaliFragRastCoarseQd, 68, 0, block_type::core},
+        {hwcpipe_counter::MaliFragShadRate, MaliFragShadRate_v0, formula_5_flat, formula_5_batch, g1_pro_counters_dependencies + 212, 2},
+        {hwcpipe_counter::MaliGeomFaceCullPrim, 12, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomFaceCullRate, MaliGeomFaceCullRate_v1, formula_57_flat, formula_57_batch, g1_pro_counters_dependencies + 214, 5},
+        {hwcpipe_counter::MaliGeomPlaneCullPrim, 13, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomPlaneCullRate, MaliGeomPlaneCullRate_v1, formula_59_flat, formula_59_batch, g1_pro_counters_dependencies + 219, 5},
+        {hwcpipe_counter::MaliRTUBoxIssueCy, 78, 0, block_type::core},
+        {hwcpipe_counter::MaliRTUFirstHitTerm, 82, 0, block_type::core},
+        {hwcpipe_counter::MaliRTUIssueCy, MaliRTUIssueCy_v0, formula_73_flat, formula_73_batch, g1_pro_counters_dependencies + 224, 2},
+        {hwcpipe_counter::MaliRTUMiss, 83, 0, block_type::core},
+        {hwcpipe_counter::MaliRTUNonOpaqueHit, 81, 0, block_type::core},
+        {hwcpipe_counter::MaliRTUOpaqueHit, 80, 0, block_type::core},
+        {hwcpipe_counter::MaliRTURay, 84, 0, block_type::core},
+        {hwcpipe_counter::MaliRTUTriIssueCy, 79, 0, block_type::core},
+        {hwcpipe_counter::MaliRTUUtil, MaliRTUUtil_v0, formula_74_flat, formula_74_batch, g1_pro_counters_dependencies + 226, 3},
+        {hwcpipe_counter::MaliBinningQueueActiveCy, MaliBinningQueueActiveCy_v0, formula_11_flat, formula_11_batch, g1_pro_counters_dependencies + 229, 2},
+        {hwcpipe_counter::MaliBinningQueueAssignStallCy, 70, 0, block_type::fe},
+        {hwcpipe_counter::MaliBinningQueueIRQActiveCy, 68, 0, block_type::fe},
+        {hwcpipe_counter::MaliBinningQueueJob, 65, 0, block_type::fe},
+        {hwcpipe_counter::MaliBinningQueueTask, 66, 0, block_type::fe},
+        {hwcpipe_counter::MaliBinningQueueUtil, MaliBinningQueueUtil_v0, formula_12_flat, formula_12_batch, g1_pro_counters_dependencies + 231, 3},
+        {hwcpipe_counter::MaliBinningQueuedCy, 64, 0, block_type::fe},
+        {hwcpipe_counter::MaliCompOrBinningActiveCy, 22, 0, block_type::core},
+        {hwcpipe_counter::MaliCompOrBinningUtil, MaliCompOrBinningUtil_v0, formula_5_flat, formula_5_batch, g1_pro_counters_dependencies + 234, 2},
+        {hwcpipe_counter::MaliGeomScissorCullPrim, 70, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomScissorCullRate, MaliGeomScissorCullRate_v0, formula_65_flat, formula_65_batch, g1_pro_counters_dependencies + 236, 5},
+        {hwcpipe_counter::MaliGeomVisibleDVSPrim, 71, 0, block_type::tiler},
+        {hwcpipe_counter::MaliMainActiveCy, 4, 0, block_type::core},
+        {hwcpipe_counter::MaliMainQueueActiveCy, MaliMainQueueActiveCy_v0, formula_11_flat, formula_11_batch, g1_pro_counters_dependencies + 241, 2},
+        {hwcpipe_counter::MaliMainQueueAssignStallCy, 54, 0, block_type::fe},
+        {hwcpipe_counter::MaliMainQueueIRQActiveCy, 52, 0, block_type::fe},
+        {hwcpipe_counter::MaliMainQueueJob, 49, 0, block_type::fe},
+        {hwcpipe_counter::MaliMainQueueTask, 50, 0, block_type::fe},
+        {hwcpipe_counter::MaliMainQueueUtil, MaliMainQueueUtil_v0, formula_12_flat, formula_12_batch, g1_pro_counters_dependencies + 243, 3},
+        {hwcpipe_counter::MaliMainQueuedCy, 48, 0, block_type::fe},
+        {hwcpipe_counter::MaliMainUtil, MaliMainUtil_v0, formula_5_flat, formula_5_batch, g1_pro_counters_dependencies + 246, 2},
+        {hwcpipe_counter::MaliTexCacheComplexLoadCy, 93, 0, block_type::core},
+        {hwcpipe_counter::MaliTexCacheLookupCy, 92, 0, block_type::core},
+        {hwcpipe_counter::MaliTexCacheSimpleLoadCy, 88, 0, block_type::core},
+        {hwcpipe_counter::MaliTexClkActiveCy, 96, 0, block_type::core},
+        {hwcpipe_counter::MaliTexClkStarvedCy, 95, 0, block_type::core},
+        {hwcpipe_counter::MaliTexIndexCy, 94, 0, block_type::core},
+        {hwcpipe_counter::MaliTexL1CacheLoadCy, 87, 0, block_type::core},
+        {hwcpipe_counter::MaliTexL1CacheLookupCy, 90, 0, block_type::core},
+        {hwcpipe_counter::MaliTexL1CacheOutputCy, 89, 0, block_type::core},
+        {hwcpipe_counter::MaliTexOutSingleMsg, 91, 0, block_type::core},
+        {hwcpipe_counter::MaliTilerPrimAsPosShadStallCy, 64, 0, block_type::tiler},
+        {hwcpipe_counter::MaliCS4WaitStallCy, 108, 0, block_type::fe},
+        {hwcpipe_counter::MaliCS5WaitStallCy, 114, 0, block_type::fe},
+        {hwcpipe_counter::MaliCSDoorbellIRQCy, 14, 0, block_type::fe},
+        {hwcpipe_counter::MaliCSFCS4ActiveCy, 104, 0, block_type::fe},
+        {hwcpipe_counter::MaliCSFCS5ActiveCy, 110, 0, block_type::fe},
+        {hwcpipe_counter::MaliDefVertWarp, 106, 0, block_type::core},
+        {hwcpipe_counter::MaliEngAttrBackpressureCy, 117, 0, block_type::core},
+        {hwcpipe_counter::MaliEngAttrBackpressureRate, MaliEngAttrBackpressureRate_v0, formula_5_flat, formula_5_batch, g1_pro_counters_dependencies + 248, 2},
+        {hwcpipe_counter::MaliEngBlendBackpressureCy, 114, 0, block_type::core},
+        {hwcpipe_counter::MaliEngBlendBackpressureRate, MaliEngBlendBackpressureRate_v0, formula_5_flat, formula_5_batch, g1_pro_counters_dependencies + 250, 2},
+        {hwcpipe_counter::MaliEngLSBackpressureCy, 116, 0, block_type::core},
+        {hwcpipe_counter::MaliEngLSBackpressureRate, MaliEngLSBackpressureRate_v0, formula_5_flat, formula_5_batch, g1_pro_counters_dependencies + 252, 2},
+        {hwcpipe_counter::MaliEngSlot0IssueCy, MaliEngSlot0IssueCy_v0, formula_20_flat, formula_20_batch, g1_pro_counters_dependencies + 254, 4},
+        {hwcpipe_counter::MaliEngSlot1IssueCy, 118, 0, block_type::core},
+        {hwcpipe_counter::MaliEngSlotAnyIssueCy, 119, 0, block_type::core},
+        {hwcpipe_counter::MaliEngTexBackpressureCy, 112, 0, block_type::core},
+        {hwcpipe_counter::MaliEngTexBackpressureRate, MaliEngTexBackpressureRate_v0, formula_5_flat, formula_5_batch, g1_pro_counters_dependencies + 258, 2},
+        {hwcpipe_counter::MaliEngVarBackpressureCy, 113, 0, block_type::core},
+        {hwcpipe_counter::MaliEngVarBackpressureRate, MaliEngVarBackpressureRate_v0, formula_5_flat, formula_5_batch, g1_pro_counters_dependencies + 260, 2},
+        {hwcpipe_counter::MaliEngZSBackpressureCy, 115, 0, block_type::core},
+        {hwcpipe_counter::MaliEngZSBackpressureRate, MaliEngZSBackpressureRate_v0, formula_5_flat, formula_5_batch, g1_pro_counters_dependencies + 262, 2},
+        {hwcpipe_counter::MaliFragInputPrim, MaliFragInputPrim_v0, formula_31_flat, formula_31_batch, g1_pro_counters_dependencies + 264, 3},
+        {hwcpipe_counter::MaliFragMainPassStallCy, 105, 0, block_type::core},
+        {hwcpipe_counter::MaliFragMainPassStallRate, MaliFragMainPassStallRate_v0, formula_5_flat, formula_5_batch, g1_pro_counters_dependencies + 267, 2},
+        {hwcpipe_counter::MaliFragMainThread, MaliFragMainThread_v0, formula_33_flat, formula_33_batch, g1_pro_counters_dependencies + 269, 2},
+        {hwcpipe_counter::MaliFragPrepassCullPrim, 98, 0, block_type::core},
+        {hwcpipe_counter::MaliFragPrepassCullPrimRate, MaliFragPrepassCullPrimRate_v0, formula_40_flat, formula_40_batch, g1_pro_counters_dependencies + 271, 3},
+        {hwcpipe_counter::MaliFragPrepassEZSUpdateQd, 101, 0, block_type::core},
+        {hwcpipe_counter::MaliFragPrepassKillQd, 103, 0, block_type::core},
+        {hwcpipe_counter::MaliFragPrepassKillRate, MaliFragPrepassKillRate_v0, formula_5_flat, formula_5_batch, g1_pro_counters_dependencies + 274, 2},
+        {hwcpipe_counter::MaliFragPrepassPrim, 99, 0, block_type::core},
+        {hwcpipe_counter::MaliFragPrepassPrimRate, MaliFragPrepassPrimRate_v0, formula_41_flat, formula_41_batch, g1_pro_counters_dependencies + 276, 3},
+        {hwcpipe_counter::MaliFragPrepassSkipPrimRate, MaliFragPrepassSkipPrimRate_v0, formula_42_flat, formula_42_batch, g1_pro_counters_dependencies + 279, 4},
+        {hwcpipe_counter::MaliFragPrepassSkippedPrim, 100, 0, block_type::core},
+        {hwcpipe_counter::MaliFragPrepassTestQd, 102, 0, block_type::core},
+        {hwcpipe_counter::MaliFragPrepassThread, MaliFragPrepassThread_v0, formula_43_flat, formula_43_batch, g1_pro_counters_dependencies + 283, 1},
+        {hwcpipe_counter::MaliFragPrepassWarp, 104, 0, block_type::core},
+        {hwcpipe_counter::MaliFragPrepassWarpRate, MaliFragPrepassWarpRate_v0, formula_44_flat, formula_44_batch, g1_pro_counters_dependencies + 284, 2},
+        {hwcpipe_counter::MaliFragPrim, 97, 0, block_type::core},
+        {hwcpipe_counter::MaliGeomPosShadPartTask, 22, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomVarShadPartTask, 37, 0, block_type::tiler},
+        {hwcpipe_counter::MaliAttrIssueCy, 108, 0, block_type::core},
+        {hwcpipe_counter::MaliAttrUtil, MaliAttrUtil_v0, formula_5_flat, formula_5_batch, g1_pro_counters_dependencies + 286, 2},
+        {hwcpipe_counter::MaliBlendIssueCy, 107, 0, block_type::core},
+        {hwcpipe_counter::MaliBlendUtil, MaliBlendUtil_v0, formula_5_flat, formula_5_batch, g1_pro_counters_dependencies + 288, 2},
+        {hwcpipe_counter::MaliEngRTUBackpressureCy, 109, 0, block_type::core},
+        {hwcpipe_counter::MaliEngRTUBackpressureRate, MaliEngRTUBackpressureRate_v0, formula_5_flat, formula_5_batch, g1_pro_counters_dependencies + 290, 2},
+        {hwcpipe_counter::MaliEngStarveICacheCy, 32, 0, block_type::core},
+        {hwcpipe_counter::MaliRTUActiveCy, 122, 0, block_type::core},
+        {hwcpipe_counter::MaliRTUBLASCull, 127, 0, block_type::core},
+        {hwcpipe_counter::MaliRTUBLASIssue, 125, 0, block_type::core},
+        {hwcpipe_counter::MaliRTUBoxIssue, 85, 0, block_type::core},
+        {hwcpipe_counter::MaliRTUCacheHit, 110, 0, block_type::core},
+        {hwcpipe_counter::MaliRTUCacheMiss, 111, 0, block_type::core},
+        {hwcpipe_counter::MaliRTUNewTraceInstr, 120, 0, block_type::core},
+        {hwcpipe_counter::MaliRTUPrimCull, 126, 0, block_type::core},
+        {hwcpipe_counter::MaliRTUResumeTraceInstr, 121, 0, block_type::core},
+        {hwcpipe_counter::MaliRTUResumeTraceRays, 123, 0, block_type::core},
+        {hwcpipe_counter::MaliRTUStackOverflows, 77, 0, block_type::core},
+        {hwcpipe_counter::MaliRTUTLASBoxIssue, 124, 0, block_type::core},
+        {hwcpipe_counter::MaliRTUTriCull, 86, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusRTUExtRdBt, 41, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusRTUExtRdBy, MaliSCBusRTUExtRdBy_v0, formula_43_flat, formula_43_batch, g1_pro_counters_dependencies + 292, 1},
+        {hwcpipe_counter::MaliSCBusRTUL2RdBt, 40, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusRTUL2RdBy, MaliSCBusRTUL2RdBy_v0, formula_43_flat, formula_43_batch, g1_pro_counters_dependencies + 293, 1},
+    };
+
+} // namespace
+
+    constexpr std::array<gpu_counter_table, 7> fifthgen_gpu_counters {
+        gpu_counter_table {device::product_id::g620, g620_counters},
+        gpu_counter_table {device::product_id::g720, g620_counters},
+        gpu_counter_table {device::product_id::g625, g625_counters},
+        gpu_counter_table {device::product_id::g725, g625_counters},
+        gpu_counter_table {device::product_id::g1_pro, g1_pro_counters},
+        gpu_counter_table {device::product_id::g1_premium, g1_pro_counters},
+        gpu_counter_table {device::product_id::g1_ultra, g1_pro_counters},
+    };
+
+} // namespace database
+} // namespace hwcpipe
@@ -0,0 +1,1158 @@
+/*
+ * Copyright (c) 2023-2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hwcpipe/all_gpu_counters.hpp"
+#include "hwcpipe/derived_functions.hpp"
+
+namespace hwcpipe {
+namespace database {
+
+    using hwcpipe::detail::counter_record;
+    using hwcpipe::device::hwcnt::block_type;
+
+namespace {
+
+    // Counter tables shared by all of the products with identical counters.
+
+    constexpr hwcpipe_counter g57_counters_dependencies[] {
+        hwcpipe_counter::MaliEngFMAInstr, hwcpipe_counter::MaliEngCVTInstr, hwcpipe_counter::MaliEngSFUInstr,
+        hwcpipe_counter::MaliEngFMAInstr, hwcpipe_counter::MaliEngCVTInstr, hwcpipe_counter::MaliEngSFUInstr, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliCoreActiveCy, hwcpipe_counter::MaliGPUActiveCy,
+        hwcpipe_counter::MaliEngDivergedInstr, hwcpipe_counter::MaliEngFMAInstr, hwcpipe_counter::MaliEngCVTInstr, hwcpipe_counter::MaliEngSFUInstr,
+        hwcpipe_counter::MaliExtBusRdBt,
+        hwcpipe_counter::MaliExtBusRdBt, hwcpipe_counter::MaliExtBusRdLat0, hwcpipe_counter::MaliExtBusRdLat128, hwcpipe_counter::MaliExtBusRdLat192, hwcpipe_counter::MaliExtBusRdLat256, hwcpipe_counter::MaliExtBusRdLat320,
+        hwcpipe_counter::MaliExtBusRd, hwcpipe_counter::MaliExtBusRdOTQ1, hwcpipe_counter::MaliExtBusRdOTQ2, hwcpipe_counter::MaliExtBusRdOTQ3,
+        hwcpipe_counter::MaliExtBusRdStallCy, hwcpipe_counter::MaliGPUActiveCy,
+        hwcpipe_counter::MaliExtBusWrBt,
+        hwcpipe_counter::MaliExtBusWr, hwcpipe_counter::MaliExtBusWrOTQ1, hwcpipe_counter::MaliExtBusWrOTQ2, hwcpipe_counter::MaliExtBusWrOTQ3,
+        hwcpipe_counter::MaliExtBusWrStallCy, hwcpipe_counter::MaliGPUActiveCy,
+        hwcpipe_counter::MaliFragEZSKillQd, hwcpipe_counter::MaliFragRastQd,
+        hwcpipe_counter::MaliFragEZSTestQd, hwcpipe_counter::MaliFragRastQd,
+        hwcpipe_counter::MaliFragEZSUpdateQd, hwcpipe_counter::MaliFragRastQd,
+        hwcpipe_counter::MaliFragFPKActiveCy, hwcpipe_counter::MaliFragActiveCy,
+        hwcpipe_counter::MaliFragRastQd, hwcpipe_counter::MaliFragEZSKillQd, hwcpipe_counter::MaliFragWarp,
+        hwcpipe_counter::MaliFragRastQd, hwcpipe_counter::MaliFragEZSKillQd, hwcpipe_counter::MaliFragWarp,
+        hwcpipe_counter::MaliFragLZSKillQd, hwcpipe_counter::MaliFragRastQd,
+        hwcpipe_counter::MaliFragLZSTestQd, hwcpipe_counter::MaliFragRastQd,
+        hwcpipe_counter::MaliFragOpaqueQd, hwcpipe_counter::MaliFragRastQd, hwcpipe_counter::MaliFragEZSKillQd,
+        hwcpipe_counter::MaliFragWarp, hwcpipe_counter::MaliFragQueueTask,
+        hwcpipe_counter::MaliFragQueueActiveCy, hwcpipe_counter::MaliGPUActiveCy,
+        hwcpipe_counter::MaliFragWarp,
+        hwcpipe_counter::MaliFragWarp,
+        hwcpipe_counter::MaliFragActiveCy, hwcpipe_counter::MaliFragWarp,
+        hwcpipe_counter::MaliFragTileKill, hwcpipe_counter::MaliFragTile,
+        hwcpipe_counter::MaliFragRastQd, hwcpipe_counter::MaliFragEZSKillQd, hwcpipe_counter::MaliFragOpaqueQd,
+        hwcpipe_counter::MaliFragActiveCy, hwcpipe_counter::MaliGPUActiveCy,
+        hwcpipe_counter::MaliGPUActiveCy, hwcpipe_counter::MaliFragQueueTask,
+        hwcpipe_counter::MaliGPUIRQActiveCy, hwcpipe_counter::MaliGPUActiveCy,
+        hwcpipe_counter::MaliFragQueueTask,
+        hwcpipe_counter::MaliGeomFaceXYPlaneCullPrim, hwcpipe_counter::MaliGeomZPlaneCullPrim, hwcpipe_counter::MaliGeomSampleCullPrim, hwcpipe_counter::MaliGeomVisiblePrim,
+        hwcpipe_counter::MaliGeomPosShadTask,
+        hwcpipe_counter::MaliGeomPosShadTask, hwcpipe_counter::MaliGeomFaceXYPlaneCullPrim, hwcpipe_counter::MaliGeomZPlaneCullPrim, hwcpipe_counter::MaliGeomSampleCullPrim, hwcpipe_counter::MaliGeomVisiblePrim,
+        hwcpipe_counter::MaliGeomSampleCullPrim, hwcpipe_counter::MaliGeomFaceXYPlaneCullPrim, hwcpipe_counter::MaliGeomZPlaneCullPrim, hwcpipe_counter::MaliGeomVisiblePrim,
+        hwcpipe_counter::MaliGeomFaceXYPlaneCullPrim, hwcpipe_counter::MaliGeomZPlaneCullPrim, hwcpipe_counter::MaliGeomSampleCullPrim,
+        hwcpipe_counter::MaliGeomFaceXYPlaneCullPrim, hwcpipe_counter::MaliGeomZPlaneCullPrim, hwcpipe_counter::MaliGeomSampleCullPrim, hwcpipe_counter::MaliGeomVisiblePrim,
+        hwcpipe_counter::MaliGeomVarShadTask,
+        hwcpipe_counter::MaliGeomVarShadTask, hwcpipe_counter::MaliGeomVisiblePrim,
+        hwcpipe_counter::MaliGeomVisiblePrim, hwcpipe_counter::MaliGeomFaceXYPlaneCullPrim, hwcpipe_counter::MaliGeomZPlaneCullPrim, hwcpipe_counter::MaliGeomSampleCullPrim,
+        hwcpipe_counter::MaliGeomZPlaneCullPrim, hwcpipe_counter::MaliGeomFaceXYPlaneCullPrim, hwcpipe_counter::MaliGeomSampleCullPrim, hwcpipe_counter::MaliGeomVisiblePrim,
+        hwcpipe_counter::MaliExtBusRd, hwcpipe_counter::MaliL2CacheRdLookup,
+        hwcpipe_counter::MaliExtBusWr, hwcpipe_counter::MaliL2CacheWrLookup,
+        hwcpipe_counter::MaliLSFullRd, hwcpipe_counter::MaliLSPartRd, hwcpipe_counter::MaliLSFullWr, hwcpipe_counter::MaliLSPartWr, hwcpipe_counter::MaliLSAtomic,
+        hwcpipe_counter::MaliLSFullRd, hwcpipe_counter::MaliLSPartRd,
+        hwcpipe_counter::MaliLSFullRd, hwcpipe_counter::MaliLSPartRd, hwcpipe_counter::MaliLSFullWr, hwcpipe_counter::MaliLSPartWr, hwcpipe_counter::MaliLSAtomic, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliLSFullWr, hwcpipe_counter::MaliLSPartWr,
+        hwcpipe_counter::MaliNonFragQueueActiveCy, hwcpipe_counter::MaliGPUActiveCy,
+        hwcpipe_counter::MaliNonFragWarp,
+        hwcpipe_counter::MaliNonFragActiveCy, hwcpipe_counter::MaliNonFragWarp,
+        hwcpipe_counter::MaliNonFragActiveCy, hwcpipe_counter::MaliGPUActiveCy,
+        hwcpipe_counter::MaliSCBusFFEExtRdBt,
+        hwcpipe_counter::MaliSCBusFFEL2RdBt,
+        hwcpipe_counter::MaliSCBusLSExtRdBt,
+        hwcpipe_counter::MaliSCBusLSExtRdBt, hwcpipe_counter::MaliLSFullRd, hwcpipe_counter::MaliLSPartRd,
+        hwcpipe_counter::MaliSCBusLSL2RdBt,
+        hwcpipe_counter::MaliSCBusLSL2RdBt, hwcpipe_counter::MaliLSFullRd, hwcpipe_counter::MaliLSPartRd,
+        hwcpipe_counter::MaliSCBusLSWBWrBt, hwcpipe_counter::MaliSCBusLSOtherWrBt,
+        hwcpipe_counter::MaliSCBusLSWBWrBt, hwcpipe_counter::MaliSCBusLSOtherWrBt,
+        hwcpipe_counter::MaliSCBusLSWBWrBt, hwcpipe_counter::MaliSCBusLSOtherWrBt, hwcpipe_counter::MaliLSFullWr, hwcpipe_counter::MaliLSPartWr,
+        hwcpipe_counter::MaliSCBusTexExtRdBt,
+        hwcpipe_counter::MaliSCBusTexExtRdBt, hwcpipe_counter::MaliTexFiltIssueCy,
+        hwcpipe_counter::MaliSCBusTexL2RdBt,
+        hwcpipe_counter::MaliSCBusTexL2RdBt, hwcpipe_counter::MaliTexFiltIssueCy,
+        hwcpipe_counter::MaliSCBusTileWrBt, hwcpipe_counter::MaliFragQueueTask,
+        hwcpipe_counter::MaliSCBusTileWrBt,
+        hwcpipe_counter::MaliTexFiltIssueCy, hwcpipe_counter::MaliTexOutMsg,
+        hwcpipe_counter::MaliTexFiltIssueCy,
+        hwcpipe_counter::MaliTexOutMsg,
+        hwcpipe_counter::MaliTexOutMsg,
+        hwcpipe_counter::MaliTexFiltIssueCy, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliTilerPosCacheHit, hwcpipe_counter::MaliTilerPosCacheMiss,
+        hwcpipe_counter::MaliTilerActiveCy, hwcpipe_counter::MaliGPUActiveCy,
+        hwcpipe_counter::MaliTilerVarCacheHit, hwcpipe_counter::MaliTilerVarCacheMiss,
+        hwcpipe_counter::MaliVar16IssueSlot,
+        hwcpipe_counter::MaliVar32IssueSlot,
+        hwcpipe_counter::MaliVar32IssueSlot, hwcpipe_counter::MaliVar16IssueSlot,
+        hwcpipe_counter::MaliVar32IssueSlot, hwcpipe_counter::MaliVar16IssueSlot, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliCoreAllRegsWarp, hwcpipe_counter::MaliNonFragWarp, hwcpipe_counter::MaliFragWarp,
+        hwcpipe_counter::MaliCoreFullWarp, hwcpipe_counter::MaliNonFragWarp, hwcpipe_counter::MaliFragWarp,
+        hwcpipe_counter::MaliEngFMAInstr, hwcpipe_counter::MaliEngCVTInstr, hwcpipe_counter::MaliEngSFUInstr,
+        hwcpipe_counter::MaliEngCVTInstr, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliEngFMAInstr, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliEngSFUInstr, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliEngSWBlendInstr, hwcpipe_counter::MaliFragWarp,
+        hwcpipe_counter::MaliFragRastPartQd, hwcpipe_counter::MaliFragRastQd,
+        hwcpipe_counter::MaliTexFullBiFiltCy, hwcpipe_counter::MaliTexFullTriFiltCy, hwcpipe_counter::MaliTexFiltIssueCy,
+        hwcpipe_counter::MaliTexInBt, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliTexOutBt, hwcpipe_counter::MaliCoreActiveCy,
+    };
+
+    constexpr counter_record g57_counters[] {
+        {hwcpipe_counter::MaliALUIssueCy, MaliALUIssueCy_v1, formula_1_flat, formula_1_batch, g57_counters_dependencies + 0, 3},
+        {hwcpipe_counter::MaliALUUtil, MaliALUUtil_v1, formula_6_flat, formula_6_batch, g57_counters_dependencies + 3, 4},
+        {hwcpipe_counter::MaliAttrInstr, 52, 0, block_type::core},
+        {hwcpipe_counter::MaliCoreActiveCy, 26, 0, block_type::core},
+        {hwcpipe_counter::MaliCoreUtil, MaliCoreUtil_v0, formula_10_flat, formula_10_batch, g57_counters_dependencies + 7, 2},
+        {hwcpipe_counter::MaliEngDivergedInstr, 31, 0, block_type::core},
+        {hwcpipe_counter::MaliEngDivergedInstrRate, MaliEngDivergedInstrRate_v1, formula_17_flat, formula_17_batch, g57_counters_dependencies + 9, 4},
+        {hwcpipe_counter::MaliEngStarveCy, 33, 0, block_type::core},
+        {hwcpipe_counter::MaliExtBusRd, 29, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdBt, 32, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdBy, MaliExtBusRdBy_v0, formula_21_flat, formula_21_batch, g57_counters_dependencies + 13, 1},
+        {hwcpipe_counter::MaliExtBusRdLat0, 37, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdLat128, 38, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdLat192, 39, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdLat256, 40, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdLat320, 41, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdLat384, MaliExtBusRdLat384_v0, formula_22_flat, formula_22_batch, g57_counters_dependencies + 14, 6},
+        {hwcpipe_counter::MaliExtBusRdNoSnoop, 30, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdOTQ1, 34, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdOTQ2, 35, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdOTQ3, 36, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdOTQ4, MaliExtBusRdOTQ4_v0, formula_23_flat, formula_23_batch, g57_counters_dependencies + 20, 4},
+        {hwcpipe_counter::MaliExtBusRdStallCy, 33, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdStallRate, MaliExtBusRdStallRate_v0, formula_24_flat, formula_24_batch, g57_counters_dependencies + 24, 2},
+        {hwcpipe_counter::MaliExtBusRdUnique, 31, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWr, 42, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrBt, 47, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrBy, MaliExtBusWrBy_v0, formula_21_flat, formula_21_batch, g57_counters_dependencies + 26, 1},
+        {hwcpipe_counter::MaliExtBusWrNoSnoopFull, 43, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrNoSnoopPart, 44, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrOTQ1, 49, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrOTQ2, 50, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrOTQ3, 51, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrOTQ4, MaliExtBusWrOTQ4_v0, formula_23_flat, formula_23_batch, g57_counters_dependencies + 27, 4},
+        {hwcpipe_counter::MaliExtBusWrSnoopFull, 45, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrSnoopPart, 46, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrStallCy, 48, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrStallRate, MaliExtBusWrStallRate_v0, formula_24_flat, formula_24_batch, g57_counters_dependencies + 31, 2},
+        {hwcpipe_counter::MaliFragActiveCy, 4, 0, block_type::core},
+        {hwcpipe_counter::MaliFragEZSKillQd, 14, 0, block_type::core},
+        {hwcpipe_counter::MaliFragEZSKillRate, MaliFragEZSKillRate_v0, formula_5_flat, formula_5_batch, g57_counters_dependencies + 33, 2},
+        {hwcpipe_counter::MaliFragEZSTestQd, 12, 0, block_type::core},
+        {hwcpipe_counter::MaliFragEZSTestRate, MaliFragEZSTestRate_v0, formula_5_flat, formula_5_batch, g57_counters_dependencies + 35, 2},
+        {hwcpipe_counter::MaliFragEZSUpdateQd, 13, 0, block_type::core},
+        {hwcpipe_counter::MaliFragEZSUpdateRate, MaliFragEZSUpdateRate_v0, formula_5_flat, formula_5_batch, g57_counters_dependencies + 37, 2},
+        {hwcpipe_counter::MaliFragFPKActiveCy, 7, 0, block_type::core},
+        {hwcpipe_counter::MaliFragFPKBUtil, MaliFragFPKBUtil_v0, formula_5_flat, formula_5_batch, g57_counters_dependencies + 39, 2},
+        {hwcpipe_counter::MaliFragFPKKillQd, MaliFragFPKKillQd_v2, formula_27_flat, formula_27_batch, g57_counters_dependencies + 41, 3},
+        {hwcpipe_counter::MaliFragFPKKillRate, MaliFragFPKKillRate_v2, formula_30_flat, formula_30_batch, g57_counters_dependencies + 44, 3},
+        {hwcpipe_counter::MaliFragLZSKillQd, 16, 0, block_type::core},
+        {hwcpipe_counter::MaliFragLZSKillRate, MaliFragLZSKillRate_v0, formula_5_flat, formula_5_batch, g57_counters_dependencies + 47, 2},
+        {hwcpipe_counter::MaliFragLZSTestQd, 15, 0, block_type::core},
+        {hwcpipe_counter::MaliFragLZSTestRate, MaliFragLZSTestRate_v0, formula_5_flat, formula_5_batch, g57_counters_dependencies + 49, 2},
+        {hwcpipe_counter::MaliFragOpaqueQd, 20, 0, block_type::core},
+        {hwcpipe_counter::MaliFragOpaqueQdRate, MaliFragOpaqueQdRate_v0, formula_34_flat, formula_34_batch, g57_counters_dependencies + 51, 3},
+        {hwcpipe_counter::MaliFragOverdraw, MaliFragOverdraw_v2, formula_37_flat, formula_37_batch, g57_counters_dependencies + 54, 2},
+        {hwcpipe_counter::MaliFragQueueActiveCy, 10, 0, block_type::fe},
+        {hwcpipe_counter::MaliFragQueueJob, 8, 0, block_type::fe},
+        {hwcpipe_counter::MaliFragQueueTask, 9, 0, block_type::fe},
+        {hwcpipe_counter::MaliFragQueueUtil, MaliFragQueueUtil_v0, formula_5_flat, formula_5_batch, g57_counters_dependencies + 56, 2},
+        {hwcpipe_counter::MaliFragQueueWaitDepCy, 14, 0, block_type::fe},
+        {hwcpipe_counter::MaliFragQueueWaitFinishCy, 15, 0, block_type::fe},
+        {hwcpipe_counter::MaliFragQueueWaitFlushCy, 11, 0, block_type::fe},
+        {hwcpipe_counter::MaliFragQueueWaitIssueCy, 13, 0, block_type::fe},
+        {hwcpipe_counter::MaliFragQueueWaitRdCy, 12, 0, block_type::fe},
+        {hwcpipe_counter::MaliFragRastPrim, 6, 0, block_type::core},
+        {hwcpipe_counter::MaliFragRastQd, 11, 0, block_type::core},
+        {hwcpipe_counter::MaliFragRdPrim, 5, 0, block_type::core},
+        {hwcpipe_counter::MaliFragShadedQd, MaliFragShadedQd_v2, formula_46_flat, formula_46_batch, g57_counters_dependencies + 58, 1},
+        {hwcpipe_counter::MaliFragThread, MaliFragThread_v2, formula_43_flat, formula_43_batch, g57_counters_dependencies + 59, 1},
+        {hwcpipe_counter::MaliFragThroughputCy, MaliFragThroughputCy_v2, formula_51_flat, formula_51_batch, g57_counters_dependencies + 60, 2},
+        {hwcpipe_counter::MaliFragTile, 18, 0, block_type::core},
+        {hwcpipe_counter::MaliFragTileKill, 19, 0, block_type::core},
+        {hwcpipe_counter::MaliFragTileKillRate, MaliFragTileKillRate_v0, formula_5_flat, formula_5_batch, g57_counters_dependencies + 62, 2},
+        {hwcpipe_counter::MaliFragTransparentQd, MaliFragTransparentQd_v0, formula_25_flat, formula_25_batch, g57_counters_dependencies + 64, 3},
+        {hwcpipe_counter::MaliFragUtil, MaliFragUtil_v0, formula_10_flat, formula_10_batch, g57_counters_dependencies + 67, 2},
+        {hwcpipe_counter::MaliFragWarp, 9, 0, block_type::core},
+        {hwcpipe_counter::MaliGPUActiveCy, 6, 0, block_type::fe},
+        {hwcpipe_counter::MaliGPUCyPerPix, MaliGPUCyPerPix_v0, formula_38_flat, formula_38_batch, g57_counters_dependencies + 69, 2},
+        {hwcpipe_counter::MaliGPUIRQActiveCy, 7, 0, block_type::fe},
+        {hwcpipe_counter::MaliGPUIRQUtil, MaliGPUIRQUtil_v0, formula_5_flat, formula_5_batch, g57_counters_dependencies + 71, 2},
+        {hwcpipe_counter::MaliGPUPix, MaliGPUPix_v0, formula_54_flat, formula_54_batch, g57_counters_dependencies + 73, 1},
+        {hwcpipe_counter::MaliGeomBackFacePrim, 10, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomFaceXYPlaneCullPrim, 12, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomFaceXYPlaneCullRate, MaliGeomFaceXYPlaneCullRate_v0, formula_56_flat, formula_56_batch, g57_counters_dependencies + 74, 4},
+        {hwcpipe_counter::MaliGeomFrontFacePrim, 9, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomLinePrim, 7, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomPointPrim, 8, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomPosShadTask, 21, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomPosShadThread, MaliGeomPosShadThread_v0, formula_47_flat, formula_47_batch, g57_counters_dependencies + 78, 1},
+        {hwcpipe_counter::MaliGeomPosShadThreadPerPrim, MaliGeomPosShadThreadPerPrim_v0, formula_60_flat, formula_60_batch, g57_counters_dependencies + 79, 5},
+        {hwcpipe_counter::MaliGeomSampleCullPrim, 14, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomSampleCullRate, MaliGeomSampleCullRate_v0, formula_63_flat, formula_63_batch, g57_counters_dependencies + 84, 4},
+        {hwcpipe_counter::MaliGeomTotalCullPrim, MaliGeomTotalCullPrim_v0, formula_15_flat, formula_15_batch, g57_counters_dependencies + 88, 3},
+        {hwcpipe_counter::MaliGeomTotalPrim, MaliGeomTotalPrim_v0, formula_66_flat, formula_66_batch, g57_counters_dependencies + 91, 4},
+        {hwcpipe_counter::MaliGeomTrianglePrim, 6, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomVarShadTask, 37, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomVarShadThread, MaliGeomVarShadThread_v0, formula_47_flat, formula_47_batch, g57_counters_dependencies + 95, 1},
+        {hwcpipe_counter::MaliGeomVarShadThreadPerPrim, MaliGeomVarShadThreadPerPrim_v0, formula_68_flat, formula_68_batch, g57_counters_dependencies + 96, 2},
+        {hwcpipe_counter::MaliGeomVisiblePrim, 11, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomVisibleRate, MaliGeomVisibleRate_v0, formula_69_flat, formula_69_batch, g57_counters_dependencies + 98, 4},
+        {hwcpipe_counter::MaliGeomZPlaneCullPrim, 13, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomZPlaneCullRate, MaliGeomZPlaneCullRate_v0, formula_58_flat, formula_58_batch, g57_counters_dependencies + 102, 4},
+        {hwcpipe_counter::MaliL2CacheFlush, 63, 0, block_type::fe},
+        {hwcpipe_counter::MaliL2CacheIncSnp, 52, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheIncSnpStallCy, 53, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheL1Rd, 22, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheL1RdStallCy, 23, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheL1Wr, 24, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheLookup, 25, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheRd, 16, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheRdLookup, 26, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheRdMissRate, MaliL2CacheRdMissRate_v0, formula_5_flat, formula_5_batch, g57_counters_dependencies + 106, 2},
+        {hwcpipe_counter::MaliL2CacheRdStallCy, 17, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheSnp, 20, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheSnpLookup, 28, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheSnpStallCy, 21, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheWr, 18, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheWrLookup, 27, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheWrMissRate, MaliL2CacheWrMissRate_v0, formula_5_flat, formula_5_batch, g57_counters_dependencies + 108, 2},
+        {hwcpipe_counter::MaliL2CacheWrStallCy, 19, 0, block_type::memory},
+        {hwcpipe_counter::MaliLSAtomic, 48, 0, block_type::core},
+        {hwcpipe_counter::MaliLSFullRd, 44, 0, block_type::core},
+        {hwcpipe_counter::MaliLSFullWr, 46, 0, block_type::core},
+        {hwcpipe_counter::MaliLSIssueCy, MaliLSIssueCy_v0, formula_67_flat, formula_67_batch, g57_counters_dependencies + 110, 5},
+        {hwcpipe_counter::MaliLSPartRd, 45, 0, block_type::core},
+        {hwcpipe_counter::MaliLSPartWr, 47, 0, block_type::core},
+        {hwcpipe_counter::MaliLSRdCy, MaliLSRdCy_v0, formula_71_flat, formula_71_batch, g57_counters_dependencies + 115, 2},
+        {hwcpipe_counter::MaliLSUtil, MaliLSUtil_v0, formula_72_flat, formula_72_batch, g57_counters_dependencies + 117, 6},
+        {hwcpipe_counter::MaliLSWrCy, MaliLSWrCy_v0, formula_71_flat, formula_71_batch, g57_counters_dependencies + 123, 2},
+        {hwcpipe_counter::MaliMMUL2Hit, 8, 0, block_type::memory},
+        {hwcpipe_counter::MaliMMUL2Rd, 6, 0, block_type::memory},
+        {hwcpipe_counter::MaliMMUL3Hit, 7, 0, block_type::memory},
+        {hwcpipe_counter::MaliMMUL3Rd, 5, 0, block_type::memory},
+        {hwcpipe_counter::MaliMMULookup, 4, 0, block_type::memory},
+        {hwcpipe_counter::MaliMMUS2L2Hit, 13, 0, block_type::memory},
+        {hwcpipe_counter::MaliMMUS2L2Rd, 11, 0, block_type::memory},
+        {hwcpipe_counter::MaliMMUS2L3Hit, 12, 0, block_type::memory},
+        {hwcpipe_counter::MaliMMUS2L3Rd, 10, 0, block_type::memory},
+        {hwcpipe_counter::MaliMMUS2Lookup, 9, 0, block_type::memory},
+        {hwcpipe_counter::MaliNonFragActiveCy, 22, 0, block_type::core},
+        {hwcpipe_counter::MaliNonFragQueueActiveCy, 18, 0, block_type::fe},
+        {hwcpipe_counter::MaliNonFragQueueJob, 16, 0, block_type::fe},
+        {hwcpipe_counter::MaliNonFragQueueTask, 17, 0, block_type::fe},
+        {hwcpipe_counter::MaliNonFragQueueUtil, MaliNonFragQueueUtil_v0, formula_5_flat, formula_5_batch, g57_counters_dependencies + 125, 2},
+        {hwcpipe_counter::MaliNonFragQueueWaitDepCy, 22, 0, block_type::fe},
+        {hwcpipe_counter::MaliNonFragQueueWaitFinishCy, 23, 0, block_type::fe},
+        {hwcpipe_counter::MaliNonFragQueueWaitFlushCy, 19, 0, block_type::fe},
+        {hwcpipe_counter::MaliNonFragQueueWaitIssueCy, 21, 0, block_type::fe},
+        {hwcpipe_counter::MaliNonFragQueueWaitRdCy, 20, 0, block_type::fe},
+        {hwcpipe_counter::MaliNonFragTask, 23, 0, block_type::core},
+        {hwcpipe_counter::MaliNonFragThread, MaliNonFragThread_v2, formula_43_flat, formula_43_batch, g57_counters_dependencies + 127, 1},
+        {hwcpipe_counter::MaliNonFragThroughputCy, MaliNonFragThroughputCy_v2, formula_51_flat, formula_51_batch, g57_counters_dependencies + 128, 2},
+        {hwcpipe_counter::MaliNonFragUtil, MaliNonFragUtil_v0, formula_10_flat, formula_10_batch, g57_counters_dependencies + 130, 2},
+        {hwcpipe_counter::MaliNonFragWarp, 24, 0, block_type::core},
+        {hwcpipe_counter::MaliResQueueActiveCy, 26, 0, block_type::fe},
+        {hwcpipe_counter::MaliResQueueJob, 24, 0, block_type::fe},
+        {hwcpipe_counter::MaliResQueueTask, 25, 0, block_type::fe},
+        {hwcpipe_counter::MaliResQueueWaitDepCy, 30, 0, block_type::fe},
+        {hwcpipe_counter::MaliResQueueWaitFinishCy, 31, 0, block_type::fe},
+        {hwcpipe_counter::MaliResQueueWaitFlushCy, 27, 0, block_type::fe},
+        {hwcpipe_counter::MaliResQueueWaitIssueCy, 29, 0, block_type::fe},
+        {hwcpipe_counter::MaliResQueueWaitRdCy, 28, 0, block_type::fe},
+        {hwcpipe_counter::MaliSCBusFFEExtRdBt, 55, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusFFEExtRdBy, MaliSCBusFFEExtRdBy_v0, formula_43_flat, formula_43_batch, g57_counters_dependencies + 132, 1},
+        {hwcpipe_counter::MaliSCBusFFEL2RdBt, 54, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusFFEL2RdBy, MaliSCBusFFEL2RdBy_v0, formula_43_flat, formula_43_batch, g57_counters_dependencies + 133, 1},
+        {hwcpipe_counter::MaliSCBusLSExtRdBt, 57, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusLSExtRdBy, MaliSCBusLSExtRdBy_v0, formula_43_flat, formula_43_batch, g57_counters_dependencies + 134, 1},
+        {hwcpipe_counter::MaliSCBusLSExtRdByPerRd, MaliSCBusLSExtRdByPerRd_v0, formula_75_flat, formula_75_batch, g57_counters_dependencies + 135, 3},
+        {hwcpipe_counter::MaliSCBusLSL2RdBt, 56, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusLSL2RdBy, MaliSCBusLSL2RdBy_v0, formula_43_flat, formula_43_batch, g57_counters_dependencies + 138, 1},
+        {hwcpipe_counter::MaliSCBusLSL2RdByPerRd, MaliSCBusLSL2RdByPerRd_v0, formula_75_flat, formula_75_batch, g57_counters_dependencies + 139, 3},
+        {hwcpipe_counter::MaliSCBusLSOtherWrBt, 61, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusLSWBWrBt, 63, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusLSWrBt, MaliSCBusLSWrBt_v0, formula_71_flat, formula_71_batch, g57_counters_dependencies + 142, 2},
+        {hwcpipe_counter::MaliSCBusLSWrBy, MaliSCBusLSWrBy_v0, formula_77_flat, formula_77_batch, g57_counters_dependencies + 144, 2},
+        {hwcpipe_counter::MaliSCBusLSWrByPerWr, MaliSCBusLSWrByPerWr_v0, formula_76_flat, formula_76_batch, g57_counters_dependencies + 146, 4},
+        {hwcpipe_counter::MaliSCBusOtherL2RdBt, 60, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusTexExtRdBt, 59, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusTexExtRdBy, MaliSCBusTexExtRdBy_v0, formula_43_flat, formula_43_batch, g57_counters_dependencies + 150, 1},
+        {hwcpipe_counter::MaliSCBusTexExtRdByPerRd, MaliSCBusTexExtRdByPerRd_v0, formula_78_flat, formula_78_batch, g57_counters_dependencies + 151, 2},
+        {hwcpipe_counter::MaliSCBusTexL2RdBt, 58, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusTexL2RdBy, MaliSCBusTexL2RdBy_v0, formula_43_flat, formula_43_batch, g57_counters_dependencies + 153, 1},
+        {hwcpipe_counter::MaliSCBusTexL2RdByPerRd, MaliSCBusTexL2RdByPerRd_v0, formula_78_flat, formula_78_batch, g57_counters_dependencies + 154, 2},
+        {hwcpipe_counter::MaliSCBusTileWrBPerPx, MaliSCBusTileWrBPerPx_v0, formula_37_flat, formula_37_batch, g57_counters_dependencies + 156, 2},
+        {hwcpipe_counter::MaliSCBusTileWrBt, 62, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusTileWrBy, MaliSCBusTileWrBy_v0, formula_43_flat, formula_43_batch, g57_counters_dependencies + 158, 1},
+        {hwcpipe_counter::MaliTexCPI, MaliTexCPI_v2, formula_49_flat, formula_49_batch, g57_counters_dependencies + 159, 2},
+        {hwcpipe_counter::MaliTexFiltIssueCy, 39, 0, block_type::core},
+        {hwcpipe_counter::MaliTexIssueCy, MaliTexIssueCy_v0, formula_0_flat, formula_0_batch, g57_counters_dependencies + 161, 1},
+        {hwcpipe_counter::MaliTexQuads, MaliTexQuads_v0, formula_0_flat, formula_0_batch, g57_counters_dependencies + 162, 1},
+        {hwcpipe_counter::MaliTexSample, MaliTexSample_v2, formula_47_flat, formula_47_batch, g57_counters_dependencies + 163, 1},
+        {hwcpipe_counter::MaliTexUtil, MaliTexUtil_v0, formula_5_flat, formula_5_batch, g57_counters_dependencies + 164, 2},
+        {hwcpipe_counter::MaliTilerActiveCy, 4, 0, block_type::tiler},
+        {hwcpipe_counter::MaliTilerPosCacheHit, 26, 0, block_type::tiler},
+        {hwcpipe_counter::MaliTilerPosCacheHitRate, MaliTilerPosCacheHitRate_v0, formula_89_flat, formula_89_batch, g57_counters_dependencies + 166, 2},
+        {hwcpipe_counter::MaliTilerPosCacheMiss, 27, 0, block_type::tiler},
+        {hwcpipe_counter::MaliTilerPosShadFIFOFullCy, 24, 0, block_type::tiler},
+        {hwcpipe_counter::MaliTilerPosShadStallCy, 23, 0, block_type::tiler},
+        {hwcpipe_counter::MaliTilerRdBt, 17, 0, block_type::tiler},
+        {hwcpipe_counter::MaliTilerUtil, MaliTilerUtil_v0, formula_5_flat, formula_5_batch, g57_counters_dependencies + 168, 2},
+        {hwcpipe_counter::MaliTilerVarCacheHit, 34, 0, block_type::tiler},
+        {hwcpipe_counter::MaliTilerVarCacheHitRate, MaliTilerVarCacheHitRate_v0, formula_89_flat, formula_89_batch, g57_counters_dependencies + 170, 2},
+        {hwcpipe_counter::MaliTilerVarCacheMiss, 35, 0, block_type::tiler},
+        {hwcpipe_counter::MaliTilerVarShadStallCy, 38, 0, block_type::tiler},
+        {hwcpipe_counter::MaliVar16IssueCy, MaliVar16IssueCy_v0, formula_0_flat, formula_0_batch, g57_counters_dependencies + 172, 1},
+        {hwcpipe_counter::MaliVar16IssueSlot, 51, 0, block_type::core},
+        {hwcpipe_counter::MaliVar32IssueCy, MaliVar32IssueCy_v0, formula_0_flat, formula_0_batch, g57_counters_dependencies + 173, 1},
+        {hwcpipe_counter::MaliVar32IssueSlot, 50, 0, block_type::core},
+        {hwcpipe_counter::MaliVarInstr, 49, 0, block_type::core},
+        {hwcpipe_counter::MaliVarIssueCy, MaliVarIssueCy_v0, formula_71_flat, formula_71_batch, g57_counters_dependencies + 174, 2},
+        {hwcpipe_counter::MaliVarUtil, MaliVarUtil_v0, formula_82_flat, formula_82_batch, g57_counters_dependencies + 176, 3},
+        {hwcpipe_counter::MaliCoreAllRegsWarp, 17, 0, block_type::core},
+        {hwcpipe_counter::MaliCoreAllRegsWarpRate, MaliCoreAllRegsWarpRate_v0, formula_13_flat, formula_13_batch, g57_counters_dependencies + 179, 3},
+        {hwcpipe_counter::MaliCoreFullWarp, 21, 0, block_type::core},
+        {hwcpipe_counter::MaliCoreFullWarpRate, MaliCoreFullWarpRate_v0, formula_13_flat, formula_13_batch, g57_counters_dependencies + 182, 3},
+        {hwcpipe_counter::MaliEngArithInstr, MaliEngArithInstr_v0, formula_15_flat, formula_15_batch, g57_counters_dependencies + 185, 3},
+        {hwcpipe_counter::MaliEngCVTInstr, 28, 0, block_type::core},
+        {hwcpipe_counter::MaliEngCVTPipeUtil, MaliEngCVTPipeUtil_v0, formula_5_flat, formula_5_batch, g57_counters_dependencies + 188, 2},
+        {hwcpipe_counter::MaliEngFMAInstr, 27, 0, block_type::core},
+        {hwcpipe_counter::MaliEngFMAPipeUtil, MaliEngFMAPipeUtil_v0, formula_5_flat, formula_5_batch, g57_counters_dependencies + 190, 2},
+        {hwcpipe_counter::MaliEngICacheMiss, 32, 0, block_type::core},
+        {hwcpipe_counter::MaliEngSFUInstr, 29, 0, block_type::core},
+        {hwcpipe_counter::MaliEngSFUPipeUtil, MaliEngSFUPipeUtil_v0, formula_18_flat, formula_18_batch, g57_counters_dependencies + 192, 2},
+        {hwcpipe_counter::MaliEngSWBlendInstr, 34, 0, block_type::core},
+        {hwcpipe_counter::MaliEngSWBlendRate, MaliEngSWBlendRate_v0, formula_19_flat, formula_19_batch, g57_counters_dependencies + 194, 2},
+        {hwcpipe_counter::MaliFragRastPartQd, 10, 0, block_type::core},
+        {hwcpipe_counter::MaliFragRastPartQdRate, MaliFragRastPartQdRate_v0, formula_5_flat, formula_5_batch, g57_counters_dependencies + 196, 2},
+        {hwcpipe_counter::MaliTexDataFetchStallCy, 37, 0, block_type::core},
+        {hwcpipe_counter::MaliTexDescStallCy, 36, 0, block_type::core},
+        {hwcpipe_counter::MaliTexFiltFullRate, MaliTexFiltFullRate_v0, formula_82_flat, formula_82_batch, g57_counters_dependencies + 198, 3},
+        {hwcpipe_counter::MaliTexFiltStallCy, 38, 0, block_type::core},
+        {hwcpipe_counter::MaliTexFullBiFiltCy, 40, 0, block_type::core},
+        {hwcpipe_counter::MaliTexFullTriFiltCy, 41, 0, block_type::core},
+        {hwcpipe_counter::MaliTexInBt, 35, 0, block_type::core},
+        {hwcpipe_counter::MaliTexInBusUtil, MaliTexInBusUtil_v0, formula_5_flat, formula_5_batch, g57_counters_dependencies + 201, 2},
+        {hwcpipe_counter::MaliTexOutBt, 43, 0, block_type::core},
+        {hwcpipe_counter::MaliTexOutBusUtil, MaliTexOutBusUtil_v0, formula_5_flat, formula_5_batch, g57_counters_dependencies + 203, 2},
+        {hwcpipe_counter::MaliTexOutMsg, 42, 0, block_type::core},
+    };
+
+    constexpr hwcpipe_counter g310_counters_dependencies[] {
+        hwcpipe_counter::MaliEngFMAInstr, hwcpipe_counter::MaliEngCVTInstr, hwcpipe_counter::MaliEngSFUInstr,
+        hwcpipe_counter::MaliEngFMAInstr, hwcpipe_counter::MaliEngCVTInstr, hwcpipe_counter::MaliEngSFUInstr, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliCoreActiveCy, hwcpipe_counter::MaliAnyActiveCy,
+        hwcpipe_counter::MaliEngDivergedInstr, hwcpipe_counter::MaliEngFMAInstr, hwcpipe_counter::MaliEngCVTInstr, hwcpipe_counter::MaliEngSFUInstr,
+        hwcpipe_counter::MaliExtBusRdBt,
+        hwcpipe_counter::MaliExtBusRdBt, hwcpipe_counter::MaliExtBusRdLat0, hwcpipe_counter::MaliExtBusRdLat128, hwcpipe_counter::MaliExtBusRdLat192, hwcpipe_counter::MaliExtBusRdLat256, hwcpipe_counter::MaliExtBusRdLat320,
+        hwcpipe_counter::MaliExtBusRd, hwcpipe_counter::MaliExtBusRdOTQ1, hwcpipe_counter::MaliExtBusRdOTQ2, hwcpipe_counter::MaliExtBusRdOTQ3,
+        hwcpipe_counter::MaliExtBusRdStallCy, hwcpipe_counter::MaliGPUActiveCy,
+        hwcpipe_counter::MaliExtBusWrBt,
+        hwcpipe_counter::MaliExtBusWr, hwcpipe_counter::MaliExtBusWrOTQ1, hwcpipe_counter::MaliExtBusWrOTQ2, hwcpipe_counter::MaliExtBusWrOTQ3,
+        hwcpipe_counter::MaliExtBusWrStallCy, hwcpipe_counter::MaliGPUActiveCy,
+        hwcpipe_counter::MaliFragEZSKillQd, hwcpipe_counter::MaliFragRastQd,
+        hwcpipe_counter::MaliFragEZSTestQd, hwcpipe_counter::MaliFragRastQd,
+        hwcpipe_counter::MaliFragEZSUpdateQd, hwcpipe_counter::MaliFragRastQd,
+        hwcpipe_counter::MaliFragFPKActiveCy, hwcpipe_counter::MaliFragActiveCy,
+        hwcpipe_counter::MaliFragRastQd, hwcpipe_counter::MaliFragEZSKillQd, hwcpipe_counter::MaliFragWarp,
+        hwcpipe_counter::MaliFragRastQd, hwcpipe_counter::MaliFragEZSKillQd, hwcpipe_counter::MaliFragWarp,
+        hwcpipe_counter::MaliFragLZSKillQd, hwcpipe_counter::MaliFragRastQd,
+        hwcpipe_counter::MaliFragLZSTestQd, hwcpipe_counter::MaliFragRastQd,
+        hwcpipe_counter::MaliFragOpaqueQd, hwcpipe_counter::MaliFragRastQd, hwcpipe_counter::MaliFragEZSKillQd,
+        hwcpipe_counter::MaliFragWarp, hwcpipe_counter::MaliFragQueueTask,
+        hwcpipe_counter::MaliFragQueuedCy, hwcpipe_counter::MaliFragQueueAssignStallCy,
+        hwcpipe_counter::MaliFragQueuedCy, hwcpipe_counter::MaliFragQueueAssignStallCy, hwcpipe_counter::MaliGPUActiveCy,
+        hwcpipe_counter::MaliFragWarp,
+        hwcpipe_counter::MaliFragWarp,
+        hwcpipe_counter::MaliFragActiveCy, hwcpipe_counter::MaliFragWarp,
+        hwcpipe_counter::MaliFragTileKill, hwcpipe_counter::MaliFragTile,
+        hwcpipe_counter::MaliFragRastQd, hwcpipe_counter::MaliFragEZSKillQd, hwcpipe_counter::MaliFragOpaqueQd,
+        hwcpipe_counter::MaliFragActiveCy, hwcpipe_counter::MaliAnyActiveCy,
+        hwcpipe_counter::MaliGPUActiveCy, hwcpipe_counter::MaliFragQueueTask,
+        hwcpipe_counter::MaliGPUIRQActiveCy, hwcpipe_counter::MaliGPUActiveCy,
+        hwcpipe_counter::MaliFragQueueTask,
+        hwcpipe_counter::MaliGeomFaceXYPlaneCullPrim, hwcpipe_counter::MaliGeomZPlaneCullPrim, hwcpipe_counter::MaliGeomSampleCullPrim, hwcpipe_counter::MaliGeomVisiblePrim,
+        hwcpipe_counter::MaliGeomPosShadTask,
+        hwcpipe_counter::MaliGeomPosShadTask, hwcpipe_counter::MaliGeomFaceXYPlaneCullPrim, hwcpipe_counter::MaliGeomZPlaneCullPrim, hwcpipe_counter::MaliGeomSampleCullPrim, hwcpipe_counter::MaliGeomVisiblePrim,
+        hwcpipe_counter::MaliGeomSampleCullPrim, hwcpipe_counter::MaliGeomFaceXYPlaneCullPrim, hwcpipe_counter::MaliGeomZPlaneCullPrim, hwcpipe_counter::MaliGeomVisiblePrim,
+        hwcpipe_counter::MaliGeomFaceXYPlaneCullPrim, hwcpipe_counter::MaliGeomZPlaneCullPrim, hwcpipe_counter::MaliGeomSampleCullPrim,
+        hwcpipe_counter::MaliGeomFaceXYPlaneCullPrim, hwcpipe_counter::MaliGeomZPlaneCullPrim, hwcpipe_counter::MaliGeomSampleCullPrim, hwcpipe_counter::MaliGeomVisiblePrim,
+        hwcpipe_counter::MaliGeomVarShadTask,
+        hwcpipe_counter::MaliGeomVarShadTask, hwcpipe_counter::MaliGeomVisiblePrim,
+        hwcpipe_counter::MaliGeomVisiblePrim, hwcpipe_counter::MaliGeomFaceXYPlaneCullPrim, hwcpipe_counter::MaliGeomZPlaneCullPrim, hwcpipe_counter::MaliGeomSampleCullPrim,
+        hwcpipe_counter::MaliGeomZPlaneCullPrim, hwcpipe_counter::MaliGeomFaceXYPlaneCullPrim, hwcpipe_counter::MaliGeomSampleCullPrim, hwcpipe_counter::MaliGeomVisiblePrim,
+        hwcpipe_counter::MaliExtBusRd, hwcpipe_counter::MaliL2CacheRdLookup,
+        hwcpipe_counter::MaliExtBusWr, hwcpipe_counter::MaliL2CacheWrLookup,
+        hwcpipe_counter::MaliLSFullRd, hwcpipe_counter::MaliLSPartRd, hwcpipe_counter::MaliLSFullWr, hwcpipe_counter::MaliLSPartWr, hwcpipe_counter::MaliLSAtomic,
+        hwcpipe_counter::MaliLSFullRd, hwcpipe_counter::MaliLSPartRd,
+        hwcpipe_counter::MaliLSFullRd, hwcpipe_counter::MaliLSPartRd, hwcpipe_counter::MaliLSFullWr, hwcpipe_counter::MaliLSPartWr, hwcpipe_counter::MaliLSAtomic, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliLSFullWr, hwcpipe_counter::MaliLSPartWr,
+        hwcpipe_counter::MaliNonFragWarp,
+        hwcpipe_counter::MaliNonFragActiveCy, hwcpipe_counter::MaliNonFragWarp,
+        hwcpipe_counter::MaliNonFragActiveCy, hwcpipe_counter::MaliAnyActiveCy,
+        hwcpipe_counter::MaliSCBusFFEExtRdBt,
+        hwcpipe_counter::MaliSCBusFFEL2RdBt,
+        hwcpipe_counter::MaliSCBusLSExtRdBt,
+        hwcpipe_counter::MaliSCBusLSExtRdBt, hwcpipe_counter::MaliLSFullRd, hwcpipe_counter::MaliLSPartRd,
+        hwcpipe_counter::MaliSCBusLSL2RdBt,
+        hwcpipe_counter::MaliSCBusLSL2RdBt, hwcpipe_counter::MaliLSFullRd, hwcpipe_counter::MaliLSPartRd,
+        hwcpipe_counter::MaliSCBusLSWBWrBt, hwcpipe_counter::MaliSCBusLSOtherWrBt,
+        hwcpipe_counter::MaliSCBusLSWBWrBt, hwcpipe_counter::MaliSCBusLSOtherWrBt,
+        hwcpipe_counter::MaliSCBusLSWBWrBt, hwcpipe_counter::MaliSCBusLSOtherWrBt, hwcpipe_counter::MaliLSFullWr, hwcpipe_counter::MaliLSPartWr,
+        hwcpipe_counter::MaliSCBusTexExtRdBt,
+        hwcpipe_counter::MaliSCBusTexExtRdBt, hwcpipe_counter::MaliTexFiltIssueCy,
+        hwcpipe_counter::MaliSCBusTexL2RdBt,
+        hwcpipe_counter::MaliSCBusTexL2RdBt, hwcpipe_counter::MaliTexFiltIssueCy,
+        hwcpipe_counter::MaliSCBusTileWrBt, hwcpipe_counter::MaliFragQueueTask,
+        hwcpipe_counter::MaliSCBusTileWrBt,
+        hwcpipe_counter::MaliTexFiltIssueCy, hwcpipe_counter::MaliTexOutMsg,
+        hwcpipe_counter::MaliTexFiltIssueCy,
+        hwcpipe_counter::MaliTexOutMsg,
+        hwcpipe_counter::MaliTexOutMsg,
+        hwcpipe_counter::MaliTexFiltIssueCy, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliTilerPosCacheHit, hwcpipe_counter::MaliTilerPosCacheMiss,
+        hwcpipe_counter::MaliTilerActiveCy, hwcpipe_counter::MaliGPUActiveCy,
+        hwcpipe_counter::MaliTilerVarCacheHit, hwcpipe_counter::MaliTilerVarCacheMiss,
+        hwcpipe_counter::MaliVar16IssueSlot,
+        hwcpipe_counter::MaliVar32IssueSlot,
+        hwcpipe_counter::MaliVar32IssueSlot, hwcpipe_counter::MaliVar16IssueSlot,
+        hwcpipe_counter::MaliVar32IssueSlot, hwcpipe_counter::MaliVar16IssueSlot, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliCoreAllRegsWarp, hwcpipe_counter::MaliNonFragWarp, hwcpipe_counter::MaliFragWarp,
+        hwcpipe_counter::MaliCoreFullWarp, hwcpipe_counter::MaliNonFragWarp, hwcpipe_counter::MaliFragWarp,
+        hwcpipe_counter::MaliEngFMAInstr, hwcpipe_counter::MaliEngCVTInstr, hwcpipe_counter::MaliEngSFUInstr,
+        hwcpipe_counter::MaliEngCVTInstr, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliEngFMAInstr, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliEngSFUInstr, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliEngSWBlendInstr, hwcpipe_counter::MaliFragWarp,
+        hwcpipe_counter::MaliFragRastPartQd, hwcpipe_counter::MaliFragRastQd,
+        hwcpipe_counter::MaliTexFullBiFiltCy, hwcpipe_counter::MaliTexFullTriFiltCy, hwcpipe_counter::MaliTexFiltIssueCy,
+        hwcpipe_counter::MaliTexInBt, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliTexOutBt, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliAnyActiveCy, hwcpipe_counter::MaliGPUActiveCy,
+        hwcpipe_counter::MaliCSFCEUActiveCy, hwcpipe_counter::MaliGPUActiveCy,
+        hwcpipe_counter::MaliCSFLSUActiveCy, hwcpipe_counter::MaliGPUActiveCy,
+        hwcpipe_counter::MaliCSFMCUActiveCy, hwcpipe_counter::MaliGPUActiveCy,
+        hwcpipe_counter::MaliCompQueuedCy, hwcpipe_counter::MaliCompQueueAssignStallCy,
+        hwcpipe_counter::MaliCompQueuedCy, hwcpipe_counter::MaliCompQueueAssignStallCy, hwcpipe_counter::MaliGPUActiveCy,
+        hwcpipe_counter::MaliVertQueuedCy, hwcpipe_counter::MaliVertQueueAssignStallCy,
+        hwcpipe_counter::MaliVertQueuedCy, hwcpipe_counter::MaliVertQueueAssignStallCy, hwcpipe_counter::MaliGPUActiveCy,
+    };
+
+    constexpr counter_record g310_counters[] {
+        {hwcpipe_counter::MaliALUIssueCy, MaliALUIssueCy_v2, formula_2_flat, formula_2_batch, g310_counters_dependencies + 0, 3},
+        {hwcpipe_counter::MaliALUUtil, MaliALUUtil_v2, formula_7_flat, formula_7_batch, g310_counters_dependencies + 3, 4},
+        {hwcpipe_counter::MaliAttrInstr, 52, 0, block_type::core},
+        {hwcpipe_counter::MaliCoreActiveCy, 26, 0, block_type::core},
+        {hwcpipe_counter::MaliCoreUtil, MaliCoreUtil_v1, formula_5_flat, formula_5_batch, g310_counters_dependencies + 7, 2},
+        {hwcpipe_counter::MaliEngDivergedInstr, 31, 0, block_type::core},
+        {hwcpipe_counter::MaliEngDivergedInstrRate, MaliEngDivergedInstrRate_v1, formula_17_flat, formula_17_batch, g310_counters_dependencies + 9, 4},
+        {hwcpipe_counter::MaliEngStarveCy, 33, 0, block_type::core},
+        {hwcpipe_counter::MaliExtBusRd, 29, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdBt, 32, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdBy, MaliExtBusRdBy_v0, formula_21_flat, formula_21_batch, g310_counters_dependencies + 13, 1},
+        {hwcpipe_counter::MaliExtBusRdLat0, 37, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdLat128, 38, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdLat192, 39, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdLat256, 40, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdLat320, 41, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdLat384, MaliExtBusRdLat384_v0, formula_22_flat, formula_22_batch, g310_counters_dependencies + 14, 6},
+        {hwcpipe_counter::MaliExtBusRdNoSnoop, 30, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdOTQ1, 34, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdOTQ2, 35, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdOTQ3, 36, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdOTQ4, MaliExtBusRdOTQ4_v0, formula_23_flat, formula_23_batch, g310_counters_dependencies + 20, 4},
+        {hwcpipe_counter::MaliExtBusRdStallCy, 33, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdStallRate, MaliExtBusRdStallRate_v0, formula_24_flat, formula_24_batch, g310_counters_dependencies + 24, 2},
+        {hwcpipe_counter::MaliExtBusRdUnique, 31, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWr, 42, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrBt, 47, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrBy, MaliExtBusWrBy_v0, formula_21_flat, formula_21_batch, g310_counters_dependencies + 26, 1},
+        {hwcpipe_counter::MaliExtBusWrNoSnoopFull, 43, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrNoSnoopPart, 44, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrOTQ1, 49, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrOTQ2, 50, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrOTQ3, 51, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrOTQ4, MaliExtBusWrOTQ4_v0, formula_23_flat, formula_23_batch, g310_counters_dependencies + 27, 4},
+        {hwcpipe_counter::MaliExtBusWrSnoopFull, 45, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrSnoopPart, 46, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrStallCy, 48, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrStallRate, MaliExtBusWrStallRate_v0, formula_24_flat, formula_24_batch, g310_counters_dependencies + 31, 2},
+        {hwcpipe_counter::MaliFragActiveCy, 4, 0, block_type::core},
+        {hwcpipe_counter::MaliFragEZSKillQd, 14, 0, block_type::core},
+        {hwcpipe_counter::MaliFragEZSKillRate, MaliFragEZSKillRate_v0, formula_5_flat, formula_5_batch, g310_counters_dependencies + 33, 2},
+        {hwcpipe_counter::MaliFragEZSTestQd, 12, 0, block_type::core},
+        {hwcpipe_counter::MaliFragEZSTestRate, MaliFragEZSTestRate_v0, formula_5_flat, formula_5_batch, g310_counters_dependencies + 35, 2},
+        {hwcpipe_counter::MaliFragEZSUpdateQd, 13, 0, block_type::core},
+        {hwcpipe_counter::MaliFragEZSUpdateRate, MaliFragEZSUpdateRate_v0, formula_5_flat, formula_5_batch, g310_counters_dependencies + 37, 2},
+        {hwcpipe_counter::MaliFragFPKActiveCy, 7, 0, block_type::core},
+        {hwcpipe_counter::MaliFragFPKBUtil, MaliFragFPKBUtil_v0, formula_5_flat, formula_5_batch, g310_counters_dependencies + 39, 2},
+        {hwcpipe_counter::MaliFragFPKKillQd, MaliFragFPKKillQd_v2, formula_27_flat, formula_27_batch, g310_counters_dependencies + 41, 3},
+        {hwcpipe_counter::MaliFragFPKKillRate, MaliFragFPKKillRate_v2, formula_30_flat, formula_30_batch, g310_counters_dependencies + 44, 3},
+        {hwcpipe_counter::MaliFragLZSKillQd, 16, 0, block_type::core},
+        {hwcpipe_counter::MaliFragLZSKillRate, MaliFragLZSKillRate_v0, formula_5_flat, formula_5_batch, g310_counters_dependencies + 47, 2},
+        {hwcpipe_counter::MaliFragLZSTestQd, 15, 0, block_type::core},
+        {hwcpipe_counter::MaliFragLZSTestRate, MaliFragLZSTestRate_v0, formula_5_flat, formula_5_batch, g310_counters_dependencies + 49, 2},
+        {hwcpipe_counter::MaliFragOpaqueQd, 20, 0, block_type::core},
+        {hwcpipe_counter::MaliFragOpaqueQdRate, MaliFragOpaqueQdRate_v0, formula_34_flat, formula_34_batch, g310_counters_dependencies + 51, 3},
+        {hwcpipe_counter::MaliFragOverdraw, MaliFragOverdraw_v2, formula_37_flat, formula_37_batch, g310_counters_dependencies + 54, 2},
+        {hwcpipe_counter::MaliFragQueueActiveCy, MaliFragQueueActiveCy_v0, formula_11_flat, formula_11_batch, g310_counters_dependencies + 56, 2},
+        {hwcpipe_counter::MaliFragQueueJob, 33, 0, block_type::fe},
+        {hwcpipe_counter::MaliFragQueueTask, 34, 0, block_type::fe},
+        {hwcpipe_counter::MaliFragQueueUtil, MaliFragQueueUtil_v1, formula_12_flat, formula_12_batch, g310_counters_dependencies + 58, 3},
+        {hwcpipe_counter::MaliFragRastPrim, 6, 0, block_type::core},
+        {hwcpipe_counter::MaliFragRastQd, 11, 0, block_type::core},
+        {hwcpipe_counter::MaliFragRdPrim, 5, 0, block_type::core},
+        {hwcpipe_counter::MaliFragShadedQd, MaliFragShadedQd_v2, formula_46_flat, formula_46_batch, g310_counters_dependencies + 61, 1},
+        {hwcpipe_counter::MaliFragThread, MaliFragThread_v2, formula_43_flat, formula_43_batch, g310_counters_dependencies + 62, 1},
+        {hwcpipe_counter::MaliFragThroughputCy, MaliFragThroughputCy_v2, formula_51_flat, formula_51_batch, g310_counters_dependencies + 63, 2},
+        {hwcpipe_counter::MaliFragTile, 18, 0, block_type::core},
+        {hwcpipe_counter::MaliFragTileKill, 19, 0, block_type::core},
+        {hwcpipe_counter::MaliFragTileKillRate, MaliFragTileKillRate_v1, formula_32_flat, formula_32_batch, g310_counters_dependencies + 65, 2},
+        {hwcpipe_counter::MaliFragTransparentQd, MaliFragTransparentQd_v0, formula_25_flat, formula_25_batch, g310_counters_dependencies + 67, 3},
+        {hwcpipe_counter::MaliFragUtil, MaliFragUtil_v1, formula_5_flat, formula_5_batch, g310_counters_dependencies + 70, 2},
+        {hwcpipe_counter::MaliFragWarp, 9, 0, block_type::core},
+        {hwcpipe_counter::MaliGPUActiveCy, 4, 0, block_type::fe},
+        {hwcpipe_counter::MaliGPUCyPerPix, MaliGPUCyPerPix_v0, formula_38_flat, formula_38_batch, g310_counters_dependencies + 72, 2},
+        {hwcpipe_counter::MaliGPUIRQActiveCy, 10, 0, block_type::fe},
+        {hwcpipe_counter::MaliGPUIRQUtil, MaliGPUIRQUtil_v0, formula_5_flat, formula_5_batch, g310_counters_dependencies + 74, 2},
+        {hwcpipe_counter::MaliGPUPix, MaliGPUPix_v0, formula_54_flat, formula_54_batch, g310_counters_dependencies + 76, 1},
+        {hwcpipe_counter::MaliGeomBackFacePrim, 10, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomFaceXYPlaneCullPrim, 12, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomFaceXYPlaneCullRate, MaliGeomFaceXYPlaneCullRate_v0, formula_56_flat, formula_56_batch, g310_counters_dependencies + 77, 4},
+        {hwcpipe_counter::MaliGeomFrontFacePrim, 9, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomLinePrim, 7, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomPointPrim, 8, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomPosShadTask, 21, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomPosShadThread, MaliGeomPosShadThread_v0, formula_47_flat, formula_47_batch, g310_counters_dependencies + 81, 1},
+        {hwcpipe_counter::MaliGeomPosShadThreadPerPrim, MaliGeomPosShadThreadPerPrim_v0, formula_60_flat, formula_60_batch, g310_counters_dependencies + 82, 5},
+        {hwcpipe_counter::MaliGeomSampleCullPrim, 14, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomSampleCullRate, MaliGeomSampleCullRate_v0, formula_63_flat, formula_63_batch, g310_counters_dependencies + 87, 4},
+        {hwcpipe_counter::MaliGeomTotalCullPrim, MaliGeomTotalCullPrim_v0, formula_15_flat, formula_15_batch, g310_counters_dependencies + 91, 3},
+        {hwcpipe_counter::MaliGeomTotalPrim, MaliGeomTotalPrim_v0, formula_66_flat, formula_66_batch, g310_counters_dependencies + 94, 4},
+        {hwcpipe_counter::MaliGeomTrianglePrim, 6, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomVarShadTask, 37, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomVarShadThread, MaliGeomVarShadThread_v0, formula_47_flat, formula_47_batch, g310_counters_dependencies + 98, 1},
+        {hwcpipe_counter::MaliGeomVarShadThreadPerPrim, MaliGeomVarShadThreadPerPrim_v0, formula_68_flat, formula_68_batch, g310_counters_dependencies + 99, 2},
+        {hwcpipe_counter::MaliGeomVisiblePrim, 11, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomVisibleRate, MaliGeomVisibleRate_v0, formula_69_flat, formula_69_batch, g310_counters_dependencies + 101, 4},
+        {hwcpipe_counter::MaliGeomZPlaneCullPrim, 13, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomZPlaneCullRate, MaliGeomZPlaneCullRate_v0, formula_58_flat, formula_58_batch, g310_counters_dependencies + 105, 4},
+        {hwcpipe_counter::MaliL2CacheFlush, 13, 0, block_type::fe},
+        {hwcpipe_counter::MaliL2CacheIncSnp, 52, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheIncSnpStallCy, 53, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheL1Rd, 22, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheL1RdStallCy, 23, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheL1Wr, 24, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheLookup, 25, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheRd, 16, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheRdLookup, 26, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheRdMissRate, MaliL2CacheRdMissRate_v0, formula_5_flat, formula_5_batch, g310_counters_dependencies + 109, 2},
+        {hwcpipe_counter::MaliL2CacheRdStallCy, 17, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheSnp, 20, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheSnpLookup, 28, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheSnpStallCy, 21, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheWr, 18, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheWrLookup, 27, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheWrMissRate, MaliL2CacheWrMissRate_v0, formula_5_flat, formula_5_batch, g310_counters_dependencies + 111, 2},
+        {hwcpipe_counter::MaliL2CacheWrStallCy, 19, 0, block_type::memory},
+        {hwcpipe_counter::MaliLSAtomic, 48, 0, block_type::core},
+        {hwcpipe_counter::MaliLSFullRd, 44, 0, block_type::core},
+        {hwcpipe_counter::MaliLSFullWr, 46, 0, block_type::core},
+        {hwcpipe_counter::MaliLSIssueCy, MaliLSIssueCy_v0, formula_67_flat, formula_67_batch, g310_counters_dependencies + 113, 5},
+        {hwcpipe_counter::MaliLSPartRd, 45, 0, block_type::core},
+        {hwcpipe_counter::MaliLSPartWr, 47, 0, block_type::core},
+        {hwcpipe_counter::MaliLSRdCy, MaliLSRdCy_v0, formula_71_flat, formula_71_batch, g310_counters_dependencies + 118, 2},
+        {hwcpipe_counter::MaliLSUtil, MaliLSUtil_v0, formula_72_flat, formula_72_batch, g310_counters_dependencies + 120, 6},
+        {hwcpipe_counter::MaliLSWrCy, MaliLSWrCy_v0, formula_71_flat, formula_71_batch, g310_counters_dependencies + 126, 2},
+        {hwcpipe_counter::MaliMMUL2Hit, 8, 0, block_type::memory},
+        {hwcpipe_counter::MaliMMUL2Rd, 6, 0, block_type::memory},
+        {hwcpipe_counter::MaliMMUL3Hit, 7, 0, block_type::memory},
+        {hwcpipe_counter::MaliMMUL3Rd, 5, 0, block_type::memory},
+        {hwcpipe_counter::MaliMMULookup, 4, 0, block_type::memory},
+        {hwcpipe_counter::MaliNonFragActiveCy, 22, 0, block_type::core},
+        {hwcpipe_counter::MaliNonFragTask, 23, 0, block_type::core},
+        {hwcpipe_counter::MaliNonFragThread, MaliNonFragThread_v2, formula_43_flat, formula_43_batch, g310_counters_dependencies + 128, 1},
+        {hwcpipe_counter::MaliNonFragThroughputCy, MaliNonFragThroughputCy_v2, formula_51_flat, formula_51_batch, g310_counters_dependencies + 129, 2},
+        {hwcpipe_counter::MaliNonFragUtil, MaliNonFragUtil_v1, formula_5_flat, formula_5_batch, g310_counters_dependencies + 131, 2},
+        {hwcpipe_counter::MaliNonFragWarp, 24, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusFFEExtRdBt, 55, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusFFEExtRdBy, MaliSCBusFFEExtRdBy_v0, formula_43_flat, formula_43_batch, g310_counters_dependencies + 133, 1},
+        {hwcpipe_counter::MaliSCBusFFEL2RdBt, 54, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusFFEL2RdBy, MaliSCBusFFEL2RdBy_v0, formula_43_flat, formula_43_batch, g310_counters_dependencies + 134, 1},
+        {hwcpipe_counter::MaliSCBusLSExtRdBt, 57, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusLSExtRdBy, MaliSCBusLSExtRdBy_v0, formula_43_flat, formula_43_batch, g310_counters_dependencies + 135, 1},
+        {hwcpipe_counter::MaliSCBusLSExtRdByPerRd, MaliSCBusLSExtRdByPerRd_v0, formula_75_flat, formula_75_batch, g310_counters_dependencies + 136, 3},
+        {hwcpipe_counter::MaliSCBusLSL2RdBt, 56, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusLSL2RdBy, MaliSCBusLSL2RdBy_v0, formula_43_flat, formula_43_batch, g310_counters_dependencies + 139, 1},
+        {hwcpipe_counter::MaliSCBusLSL2RdByPerRd, MaliSCBusLSL2RdByPerRd_v0, formula_75_flat, formula_75_batch, g310_counters_dependencies + 140, 3},
+        {hwcpipe_counter::MaliSCBusLSOtherWrBt, 61, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusLSWBWrBt, 63, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusLSWrBt, MaliSCBusLSWrBt_v0, formula_71_flat, formula_71_batch, g310_counters_dependencies + 143, 2},
+        {hwcpipe_counter::MaliSCBusLSWrBy, MaliSCBusLSWrBy_v0, formula_77_flat, formula_77_batch, g310_counters_dependencies + 145, 2},
+        {hwcpipe_counter::MaliSCBusLSWrByPerWr, MaliSCBusLSWrByPerWr_v0, formula_76_flat, formula_76_batch, g310_counters_dependencies + 147, 4},
+        {hwcpipe_counter::MaliSCBusOtherL2RdBt, 60, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusTexExtRdBt, 59, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusTexExtRdBy, MaliSCBusTexExtRdBy_v0, formula_43_flat, formula_43_batch, g310_counters_dependencies + 151, 1},
+        {hwcpipe_counter::MaliSCBusTexExtRdByPerRd, MaliSCBusTexExtRdByPerRd_v0, formula_78_flat, formula_78_batch, g310_counters_dependencies + 152, 2},
+        {hwcpipe_counter::MaliSCBusTexL2RdBt, 58, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusTexL2RdBy, MaliSCBusTexL2RdBy_v0, formula_43_flat, formula_43_batch, g310_counters_dependencies + 154, 1},
+        {hwcpipe_counter::MaliSCBusTexL2RdByPerRd, MaliSCBusTexL2RdByPerRd_v0, formula_78_flat, formula_78_batch, g310_counters_dependencies + 155, 2},
+        {hwcpipe_counter::MaliSCBusTileWrBPerPx, MaliSCBusTileWrBPerPx_v0, formula_37_flat, formula_37_batch, g310_counters_dependencies + 157, 2},
+        {hwcpipe_counter::MaliSCBusTileWrBt, 62, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusTileWrBy, MaliSCBusTileWrBy_v0, formula_43_flat, formula_43_batch, g310_counters_dependencies + 159, 1},
+        {hwcpipe_counter::MaliTexCPI, MaliTexCPI_v3, formula_80_flat, formula_80_batch, g310_counters_dependencies + 160, 2},
+        {hwcpipe_counter::MaliTexFiltIssueCy, 39, 0, block_type::core},
+        {hwcpipe_counter::MaliTexIssueCy, MaliTexIssueCy_v0, formula_0_flat, formula_0_batch, g310_counters_dependencies + 162, 1},
+        {hwcpipe_counter::MaliTexQuads, MaliTexQuads_v1, formula_84_flat, formula_84_batch, g310_counters_dependencies + 163, 1},
+        {hwcpipe_counter::MaliTexSample, MaliTexSample_v3, formula_86_flat, formula_86_batch, g310_counters_dependencies + 164, 1},
+        {hwcpipe_counter::MaliTexUtil, MaliTexUtil_v0, formula_5_flat, formula_5_batch, g310_counters_dependencies + 165, 2},
+        {hwcpipe_counter::MaliTilerActiveCy, 4, 0, block_type::tiler},
+        {hwcpipe_counter::MaliTilerPosCacheHit, 26, 0, block_type::tiler},
+        {hwcpipe_counter::MaliTilerPosCacheHitRate, MaliTilerPosCacheHitRate_v0, formula_89_flat, formula_89_batch, g310_counters_dependencies + 167, 2},
+        {hwcpipe_counter::MaliTilerPosCacheMiss, 27, 0, block_type::tiler},
+        {hwcpipe_counter::MaliTilerPosShadFIFOFullCy, 24, 0, block_type::tiler},
+        {hwcpipe_counter::MaliTilerPosShadStallCy, 23, 0, block_type::tiler},
+        {hwcpipe_counter::MaliTilerRdBt, 17, 0, block_type::tiler},
+        {hwcpipe_counter::MaliTilerUtil, MaliTilerUtil_v0, formula_5_flat, formula_5_batch, g310_counters_dependencies + 169, 2},
+        {hwcpipe_counter::MaliTilerVarCacheHit, 34, 0, block_type::tiler},
+        {hwcpipe_counter::MaliTilerVarCacheHitRate, MaliTilerVarCacheHitRate_v0, formula_89_flat, formula_89_batch, g310_counters_dependencies + 171, 2},
+        {hwcpipe_counter::MaliTilerVarCacheMiss, 35, 0, block_type::tiler},
+        {hwcpipe_counter::MaliTilerVarShadStallCy, 38, 0, block_type::tiler},
+        {hwcpipe_counter::MaliVar16IssueCy, MaliVar16IssueCy_v1, formula_90_flat, formula_90_batch, g310_counters_dependencies + 173, 1},
+        {hwcpipe_counter::MaliVar16IssueSlot, 51, 0, block_type::core},
+        {hwcpipe_counter::MaliVar32IssueCy, MaliVar32IssueCy_v1, formula_90_flat, formula_90_batch, g310_counters_dependencies + 174, 1},
+        {hwcpipe_counter::MaliVar32IssueSlot, 50, 0, block_type::core},
+        {hwcpipe_counter::MaliVarInstr, 49, 0, block_type::core},
+        {hwcpipe_counter::MaliVarIssueCy, MaliVarIssueCy_v1, formula_92_flat, formula_92_batch, g310_counters_dependencies + 175, 2},
+        {hwcpipe_counter::MaliVarUtil, MaliVarUtil_v1, formula_94_flat, formula_94_batch, g310_counters_dependencies + 177, 3},
+        {hwcpipe_counter::MaliCoreAllRegsWarp, 17, 0, block_type::core},
+        {hwcpipe_counter::MaliCoreAllRegsWarpRate, MaliCoreAllRegsWarpRate_v0, formula_13_flat, formula_13_batch, g310_counters_dependencies + 180, 3},
+        {hwcpipe_counter::MaliCoreFullWarp, 21, 0, block_type::core},
+        {hwcpipe_counter::MaliCoreFullWarpRate, MaliCoreFullWarpRate_v0, formula_13_flat, formula_13_batch, g310_counters_dependencies + 183, 3},
+        {hwcpipe_counter::MaliEngArithInstr, MaliEngArithInstr_v0, formula_15_flat, formula_15_batch, g310_counters_dependencies + 186, 3},
+        {hwcpipe_counter::MaliEngCVTInstr, 28, 0, block_type::core},
+        {hwcpipe_counter::MaliEngCVTPipeUtil, MaliEngCVTPipeUtil_v0, formula_5_flat, formula_5_batch, g310_counters_dependencies + 189, 2},
+        {hwcpipe_counter::MaliEngFMAInstr, 27, 0, block_type::core},
+        {hwcpipe_counter::MaliEngFMAPipeUtil, MaliEngFMAPipeUtil_v0, formula_5_flat, formula_5_batch, g310_counters_dependencies + 191, 2},
+        {hwcpipe_counter::MaliEngICacheMiss, 32, 0, block_type::core},
+        {hwcpipe_counter::MaliEngSFUInstr, 29, 0, block_type::core},
+        {hwcpipe_counter::MaliEngSFUPipeUtil, MaliEngSFUPipeUtil_v0, formula_18_flat, formula_18_batch, g310_counters_dependencies + 193, 2},
+        {hwcpipe_counter::MaliEngSWBlendInstr, 34, 0, block_type::core},
+        {hwcpipe_counter::MaliEngSWBlendRate, MaliEngSWBlendRate_v1, formula_18_flat, formula_18_batch, g310_counters_dependencies + 195, 2},
+        {hwcpipe_counter::MaliFragRastPartQd, 10, 0, block_type::core},
+        {hwcpipe_counter::MaliFragRastPartQdRate, MaliFragRastPartQdRate_v0, formula_5_flat, formula_5_batch, g310_counters_dependencies + 197, 2},
+        {hwcpipe_counter::MaliTexDataFetchStallCy, 37, 0, block_type::core},
+        {hwcpipe_counter::MaliTexDescStallCy, 36, 0, block_type::core},
+        {hwcpipe_counter::MaliTexFiltFullRate, MaliTexFiltFullRate_v0, formula_82_flat, formula_82_batch, g310_counters_dependencies + 199, 3},
+        {hwcpipe_counter::MaliTexFiltStallCy, 38, 0, block_type::core},
+        {hwcpipe_counter::MaliTexFullBiFiltCy, 40, 0, block_type::core},
+        {hwcpipe_counter::MaliTexFullTriFiltCy, 41, 0, block_type::core},
+        {hwcpipe_counter::MaliTexInBt, 35, 0, block_type::core},
+        {hwcpipe_counter::MaliTexInBusUtil, MaliTexInBusUtil_v0, formula_5_flat, formula_5_batch, g310_counters_dependencies + 202, 2},
+        {hwcpipe_counter::MaliTexOutBt, 43, 0, block_type::core},
+        {hwcpipe_counter::MaliTexOutBusUtil, MaliTexOutBusUtil_v0, formula_5_flat, formula_5_batch, g310_counters_dependencies + 204, 2},
+        {hwcpipe_counter::MaliTexOutMsg, 42, 0, block_type::core},
+        {hwcpipe_counter::MaliAnyActiveCy, 53, 0, block_type::core},
+        {hwcpipe_counter::MaliAnyUtil, MaliAnyUtil_v0, formula_10_flat, formula_10_batch, g310_counters_dependencies + 206, 2},
+        {hwcpipe_counter::MaliCS0WaitStallCy, 51, 0, block_type::fe},
+        {hwcpipe_counter::MaliCS1WaitStallCy, 55, 0, block_type::fe},
+        {hwcpipe_counter::MaliCS2WaitStallCy, 59, 0, block_type::fe},
+        {hwcpipe_counter::MaliCS3WaitStallCy, 63, 0, block_type::fe},
+        {hwcpipe_counter::MaliCSFCEUActiveCy, 40, 0, block_type::fe},
+        {hwcpipe_counter::MaliCSFCEUUtil, MaliCSFCEUUtil_v0, formula_5_flat, formula_5_batch, g310_counters_dependencies + 208, 2},
+        {hwcpipe_counter::MaliCSFCS0ActiveCy, 48, 0, block_type::fe},
+        {hwcpipe_counter::MaliCSFCS1ActiveCy, 52, 0, block_type::fe},
+        {hwcpipe_counter::MaliCSFCS2ActiveCy, 56, 0, block_type::fe},
+        {hwcpipe_counter::MaliCSFCS3ActiveCy, 60, 0, block_type::fe},
+        {hwcpipe_counter::MaliCSFLSUActiveCy, 45, 0, block_type::fe},
+        {hwcpipe_counter::MaliCSFLSUUtil, MaliCSFLSUUtil_v0, formula_5_flat, formula_5_batch, g310_counters_dependencies + 210, 2},
+        {hwcpipe_counter::MaliCSFMCUActiveCy, 5, 0, block_type::fe},
+        {hwcpipe_counter::MaliCSFMCUUtil, MaliCSFMCUUtil_v0, formula_5_flat, formula_5_batch, g310_counters_dependencies + 212, 2},
+        {hwcpipe_counter::MaliCompQueueActiveCy, MaliCompQueueActiveCy_v0, formula_11_flat, formula_11_batch, g310_counters_dependencies + 214, 2},
+        {hwcpipe_counter::MaliCompQueueAssignStallCy, 30, 0, block_type::fe},
+        {hwcpipe_counter::MaliCompQueueDrainStallCy, 31, 0, block_type::fe},
+        {hwcpipe_counter::MaliCompQueueIRQActiveCy, 28, 0, block_type::fe},
+        {hwcpipe_counter::MaliCompQueueJob, 25, 0, block_type::fe},
+        {hwcpipe_counter::MaliCompQueueTask, 26, 0, block_type::fe},
+        {hwcpipe_counter::MaliCompQueueUtil, MaliCompQueueUtil_v0, formula_12_flat, formula_12_batch, g310_counters_dependencies + 216, 3},
+        {hwcpipe_counter::MaliCompQueuedCy, 24, 0, block_type::fe},
+        {hwcpipe_counter::MaliFragQueueAssignStallCy, 38, 0, block_type::fe},
+        {hwcpipe_counter::MaliFragQueueIRQActiveCy, 36, 0, block_type::fe},
+        {hwcpipe_counter::MaliFragQueuedCy, 32, 0, block_type::fe},
+        {hwcpipe_counter::MaliGPUAnyQueueActiveCy, 6, 0, block_type::fe},
+        {hwcpipe_counter::MaliGPUIRQ, 11, 0, block_type::fe},
+        {hwcpipe_counter::MaliL2CacheCleanUnique, 13, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheEvict, 12, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheFlushCy, 12, 0, block_type::fe},
+        {hwcpipe_counter::MaliTilerQueueDrainStallCy, 23, 0, block_type::fe},
+        {hwcpipe_counter::MaliVertQueueActiveCy, MaliVertQueueActiveCy_v0, formula_11_flat, formula_11_batch, g310_counters_dependencies + 219, 2},
+        {hwcpipe_counter::MaliVertQueueAssignStallCy, 22, 0, block_type::fe},
+        {hwcpipe_counter::MaliVertQueueIRQActiveCy, 20, 0, block_type::fe},
+        {hwcpipe_counter::MaliVertQueueJob, 17, 0, block_type::fe},
+        {hwcpipe_counter::MaliVertQueueTask, 18, 0, block_type::fe},
+        {hwcpipe_counter::MaliVertQueueUtil, MaliVertQueueUtil_v0, formula_12_flat, formula_12_batch, g310_counters_dependencies + 221, 3},
+        {hwcpipe_counter::MaliVertQueuedCy, 16, 0, block_type::fe},
+    };
+
+    constexpr hwcpipe_counter g615_counters_dependencies[] {
+        hwcpipe_counter::MaliEngCVTInstr, hwcpipe_counter::MaliEngSFUInstr, hwcpipe_counter::MaliEngFMAInstr,
+        hwcpipe_counter::MaliEngCVTInstr, hwcpipe_counter::MaliEngSFUInstr, hwcpipe_counter::MaliEngFMAInstr, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliCoreActiveCy, hwcpipe_counter::MaliAnyActiveCy,
+        hwcpipe_counter::MaliEngDivergedInstr, hwcpipe_counter::MaliEngFMAInstr, hwcpipe_counter::MaliEngCVTInstr, hwcpipe_counter::MaliEngSFUInstr,
+        hwcpipe_counter::MaliExtBusRdBt,
+        hwcpipe_counter::MaliExtBusRdBt, hwcpipe_counter::MaliExtBusRdLat0, hwcpipe_counter::MaliExtBusRdLat128, hwcpipe_counter::MaliExtBusRdLat192, hwcpipe_counter::MaliExtBusRdLat256, hwcpipe_counter::MaliExtBusRdLat320,
+        hwcpipe_counter::MaliExtBusRd, hwcpipe_counter::MaliExtBusRdOTQ1, hwcpipe_counter::MaliExtBusRdOTQ2, hwcpipe_counter::MaliExtBusRdOTQ3,
+        hwcpipe_counter::MaliExtBusRdStallCy, hwcpipe_counter::MaliGPUAnyQueueActiveCy,
+        hwcpipe_counter::MaliExtBusWrBt,
+        hwcpipe_counter::MaliExtBusWr, hwcpipe_counter::MaliExtBusWrOTQ1, hwcpipe_counter::MaliExtBusWrOTQ2, hwcpipe_counter::MaliExtBusWrOTQ3,
+        hwcpipe_counter::MaliExtBusWrStallCy, hwcpipe_counter::MaliGPUAnyQueueActiveCy,
+        hwcpipe_counter::MaliFragEZSKillQd, hwcpipe_counter::MaliFragRastQd,
+        hwcpipe_counter::MaliFragEZSTestQd, hwcpipe_counter::MaliFragRastQd,
+        hwcpipe_counter::MaliFragEZSUpdateQd, hwcpipe_counter::MaliFragRastQd,
+        hwcpipe_counter::MaliFragFPKActiveCy, hwcpipe_counter::MaliFragActiveCy,
+        hwcpipe_counter::MaliFragRastQd, hwcpipe_counter::MaliFragEZSKillQd, hwcpipe_counter::MaliFragWarp,
+        hwcpipe_counter::MaliFragRastQd, hwcpipe_counter::MaliFragEZSKillQd, hwcpipe_counter::MaliFragWarp,
+        hwcpipe_counter::MaliFragLZSKillQd, hwcpipe_counter::MaliFragRastQd,
+        hwcpipe_counter::MaliFragLZSTestQd, hwcpipe_counter::MaliFragRastQd,
+        hwcpipe_counter::MaliFragOpaqueQd, hwcpipe_counter::MaliFragRastQd, hwcpipe_counter::MaliFragEZSKillQd,
+        hwcpipe_counter::MaliFragThread, hwcpipe_counter::MaliFragQueueTask,
+        hwcpipe_counter::MaliFragQueuedCy, hwcpipe_counter::MaliFragQueueAssignStallCy,
+        hwcpipe_counter::MaliFragQueuedCy, hwcpipe_counter::MaliFragQueueAssignStallCy, hwcpipe_counter::MaliGPUAnyQueueActiveCy,
+        hwcpipe_counter::MaliFragWarp,
+        hwcpipe_counter::MaliFragActiveCy, hwcpipe_counter::MaliFragThread,
+        hwcpipe_counter::MaliFragTileKill, hwcpipe_counter::MaliFragTile,
+        hwcpipe_counter::MaliFragRastQd, hwcpipe_counter::MaliFragEZSKillQd, hwcpipe_counter::MaliFragOpaqueQd,
+        hwcpipe_counter::MaliFragActiveCy, hwcpipe_counter::MaliAnyActiveCy,
+        hwcpipe_counter::MaliGPUAnyQueueActiveCy,
+        hwcpipe_counter::MaliGPUAnyQueueActiveCy, hwcpipe_counter::MaliFragQueueTask,
+        hwcpipe_counter::MaliGPUIRQActiveCy, hwcpipe_counter::MaliGPUAnyQueueActiveCy,
+        hwcpipe_counter::MaliFragQueueTask,
+        hwcpipe_counter::MaliGeomPosShadTask,
+        hwcpipe_counter::MaliGeomPosShadTask, hwcpipe_counter::MaliGeomFaceCullPrim, hwcpipe_counter::MaliGeomPlaneCullPrim, hwcpipe_counter::MaliGeomSampleCullPrim, hwcpipe_counter::MaliGeomVisiblePrim,
+        hwcpipe_counter::MaliGeomSampleCullPrim, hwcpipe_counter::MaliGeomFaceCullPrim, hwcpipe_counter::MaliGeomPlaneCullPrim, hwcpipe_counter::MaliGeomVisiblePrim,
+        hwcpipe_counter::MaliGeomFaceCullPrim, hwcpipe_counter::MaliGeomPlaneCullPrim, hwcpipe_counter::MaliGeomSampleCullPrim,
+        hwcpipe_counter::MaliGeomFaceCullPrim, hwcpipe_counter::MaliGeomPlaneCullPrim, hwcpipe_counter::MaliGeomSampleCullPrim, hwcpipe_counter::MaliGeomVisiblePrim,
+        hwcpipe_counter::MaliGeomVarShadTask,
+        hwcpipe_counter::MaliGeomVarShadTask, hwcpipe_counter::MaliGeomVisiblePrim,
+        hwcpipe_counter::MaliGeomVisiblePrim, hwcpipe_counter::MaliGeomFaceCullPrim, hwcpipe_counter::MaliGeomPlaneCullPrim, hwcpipe_counter::MaliGeomSampleCullPrim,
+        hwcpipe_counter::MaliExtBusRd, hwcpipe_counter::MaliL2CacheRdLookup,
+        hwcpipe_counter::MaliExtBusWr, hwcpipe_counter::MaliL2CacheWrLookup,
+        hwcpipe_counter::MaliLSFullRd, hwcpipe_counter::MaliLSPartRd, hwcpipe_counter::MaliLSFullWr, hwcpipe_counter::MaliLSPartWr, hwcpipe_counter::MaliLSAtomic,
+        hwcpipe_counter::MaliLSFullRd, hwcpipe_counter::MaliLSPartRd,
+        hwcpipe_counter::MaliLSFullRd, hwcpipe_counter::MaliLSPartRd, hwcpipe_counter::MaliLSFullWr, hwcpipe_counter::MaliLSPartWr, hwcpipe_counter::MaliLSAtomic, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliLSFullWr, hwcpipe_counter::MaliLSPartWr,
+        hwcpipe_counter::MaliNonFragWarp,
+        hwcpipe_counter::MaliNonFragActiveCy, hwcpipe_counter::MaliNonFragWarp,
+        hwcpipe_counter::MaliNonFragActiveCy, hwcpipe_counter::MaliAnyActiveCy,
+        hwcpipe_counter::MaliSCBusFFEExtRdBt,
+        hwcpipe_counter::MaliSCBusFFEL2RdBt,
+        hwcpipe_counter::MaliSCBusLSExtRdBt,
+        hwcpipe_counter::MaliSCBusLSExtRdBt, hwcpipe_counter::MaliLSFullRd, hwcpipe_counter::MaliLSPartRd,
+        hwcpipe_counter::MaliSCBusLSL2RdBt,
+        hwcpipe_counter::MaliSCBusLSL2RdBt, hwcpipe_counter::MaliLSFullRd, hwcpipe_counter::MaliLSPartRd,
+        hwcpipe_counter::MaliSCBusLSWBWrBt, hwcpipe_counter::MaliSCBusLSOtherWrBt,
+        hwcpipe_counter::MaliSCBusLSWBWrBt, hwcpipe_counter::MaliSCBusLSOtherWrBt,
+        hwcpipe_counter::MaliSCBusLSWBWrBt, hwcpipe_counter::MaliSCBusLSOtherWrBt, hwcpipe_counter::MaliLSFullWr, hwcpipe_counter::MaliLSPartWr,
+        hwcpipe_counter::MaliSCBusTexExtRdBt,
+        hwcpipe_counter::MaliSCBusTexExtRdBt, hwcpipe_counter::MaliTexFiltIssueCy,
+        hwcpipe_counter::MaliSCBusTexL2RdBt,
+        hwcpipe_counter::MaliSCBusTexL2RdBt, hwcpipe_counter::MaliTexFiltIssueCy,
+        hwcpipe_counter::MaliSCBusTileWrBt, hwcpipe_counter::MaliFragQueueTask,
+        hwcpipe_counter::MaliSCBusTileWrBt,
+        hwcpipe_counter::MaliTexFiltIssueCy, hwcpipe_counter::MaliTexOutMsg,
+        hwcpipe_counter::MaliTexFiltIssueCy,
+        hwcpipe_counter::MaliTexOutMsg,
+        hwcpipe_counter::MaliTexOutMsg,
+        hwcpipe_counter::MaliTexFiltIssueCy, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliTilerActiveCy, hwcpipe_counter::MaliGPUAnyQueueActiveCy,
+        hwcpipe_counter::MaliTilerVarCacheHit, hwcpipe_counter::MaliTilerVarCacheMiss,
+        hwcpipe_counter::MaliVar16IssueSlot,
+        hwcpipe_counter::MaliVar32IssueSlot,
+        hwcpipe_counter::MaliVar32IssueSlot, hwcpipe_counter::MaliVar16IssueSlot,
+        hwcpipe_counter::MaliVar32IssueSlot, hwcpipe_counter::MaliVar16IssueSlot, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliCoreAllRegsWarp, hwcpipe_counter::MaliNonFragWarp, hwcpipe_counter::MaliFragWarp,
+        hwcpipe_counter::MaliCoreFullWarp, hwcpipe_counter::MaliNonFragWarp, hwcpipe_counter::MaliFragWarp,
+        hwcpipe_counter::MaliEngFMAInstr, hwcpipe_counter::MaliEngCVTInstr, hwcpipe_counter::MaliEngSFUInstr,
+        hwcpipe_counter::MaliEngCVTInstr, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliEngFMAInstr, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliEngSFUInstr, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliEngSWBlendInstr, hwcpipe_counter::MaliFragWarp,
+        hwcpipe_counter::MaliFragRastPartQd, hwcpipe_counter::MaliFragRastQd,
+        hwcpipe_counter::MaliTexFullBiFiltCy, hwcpipe_counter::MaliTexFullTriFiltCy, hwcpipe_counter::MaliTexFiltIssueCy,
+        hwcpipe_counter::MaliTexInBt, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliTexOutBt, hwcpipe_counter::MaliCoreActiveCy,
+        hwcpipe_counter::MaliAnyActiveCy, hwcpipe_counter::MaliGPUAnyQueueActiveCy,
+        hwcpipe_counter::MaliCSFCEUActiveCy, hwcpipe_counter::MaliGPUAnyQueueActiveCy,
+        hwcpipe_counter::MaliCSFLSUActiveCy, hwcpipe_counter::MaliGPUAnyQueueActiveCy,
+        hwcpipe_counter::MaliCSFMCUActiveCy, hwcpipe_counter::MaliGPUAnyQueueActiveCy,
+        hwcpipe_counter::MaliCompQueuedCy, hwcpipe_counter::MaliCompQueueAssignStallCy,
+        hwcpipe_counter::MaliCompQueuedCy, hwcpipe_counter::MaliCompQueueAssignStallCy, hwcpipe_counter::MaliGPUAnyQueueActiveCy,
+        hwcpipe_counter::MaliVertQueuedCy, hwcpipe_counter::MaliVertQueueAssignStallCy,
+        hwcpipe_counter::MaliVertQueuedCy, hwcpipe_counter::MaliVertQueueAssignStallCy, hwcpipe_counter::MaliGPUAnyQueueActiveCy,
+        hwcpipe_counter::MaliFragThread, hwcpipe_counter::MaliFragWarp,
+        hwcpipe_counter::MaliEngNarrowInstr, hwcpipe_counter::MaliEngFMAInstr, hwcpipe_counter::MaliEngCVTInstr, hwcpipe_counter::MaliEngSFUInstr,
+        hwcpipe_counter::MaliFragRastCoarseQd, hwcpipe_counter::MaliFragRastQd,
+        hwcpipe_counter::MaliGeomFaceCullPrim, hwcpipe_counter::MaliGeomPlaneCullPrim, hwcpipe_counter::MaliGeomSampleCullPrim, hwcpipe_counter::MaliGeomVisiblePrim,
+        hwcpipe_counter::MaliGeomPlaneCullPrim, hwcpipe_counter::MaliGeomFaceCullPrim, hwcpipe_counter::MaliGeomSampleCullPrim, hwcpipe_counter::MaliGeomVisiblePrim,
+        hwcpipe_counter::MaliRTUBoxIssueCy, hwcpipe_counter::MaliRTUTriIssueCy,
+        hwcpipe_counter::MaliRTUBoxIssueCy, hwcpipe_counter::MaliRTUTriIssueCy, hwcpipe_counter::MaliCoreActiveCy,
+    };
+
+    constexpr counter_record g615_counters[] {
+        {hwcpipe_counter::MaliALUIssueCy, MaliALUIssueCy_v3, formula_3_flat, formula_3_batch, g615_counters_dependencies + 0, 3},
+        {hwcpipe_counter::MaliALUUtil, MaliALUUtil_v3, formula_8_flat, formula_8_batch, g615_counters_dependencies + 3, 4},
+        {hwcpipe_counter::MaliAttrInstr, 52, 0, block_type::core},
+        {hwcpipe_counter::MaliCoreActiveCy, 26, 0, block_type::core},
+        {hwcpipe_counter::MaliCoreUtil, MaliCoreUtil_v1, formula_5_flat, formula_5_batch, g615_counters_dependencies + 7, 2},
+        {hwcpipe_counter::MaliEngDivergedInstr, 31, 0, block_type::core},
+        {hwcpipe_counter::MaliEngDivergedInstrRate, MaliEngDivergedInstrRate_v1, formula_17_flat, formula_17_batch, g615_counters_dependencies + 9, 4},
+        {hwcpipe_counter::MaliEngStarveCy, 33, 0, block_type::core},
+        {hwcpipe_counter::MaliExtBusRd, 29, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdBt, 32, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdBy, MaliExtBusRdBy_v0, formula_21_flat, formula_21_batch, g615_counters_dependencies + 13, 1},
+        {hwcpipe_counter::MaliExtBusRdLat0, 37, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdLat128, 38, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdLat192, 39, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdLat256, 40, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdLat320, 41, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdLat384, MaliExtBusRdLat384_v0, formula_22_flat, formula_22_batch, g615_counters_dependencies + 14, 6},
+        {hwcpipe_counter::MaliExtBusRdNoSnoop, 30, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdOTQ1, 34, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdOTQ2, 35, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdOTQ3, 36, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdOTQ4, MaliExtBusRdOTQ4_v0, formula_23_flat, formula_23_batch, g615_counters_dependencies + 20, 4},
+        {hwcpipe_counter::MaliExtBusRdStallCy, 33, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusRdStallRate, MaliExtBusRdStallRate_v1, formula_24_flat, formula_24_batch, g615_counters_dependencies + 24, 2},
+        {hwcpipe_counter::MaliExtBusRdUnique, 31, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWr, 42, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrBt, 47, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrBy, MaliExtBusWrBy_v0, formula_21_flat, formula_21_batch, g615_counters_dependencies + 26, 1},
+        {hwcpipe_counter::MaliExtBusWrNoSnoopFull, 43, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrNoSnoopPart, 44, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrOTQ1, 49, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrOTQ2, 50, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrOTQ3, 51, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrOTQ4, MaliExtBusWrOTQ4_v0, formula_23_flat, formula_23_batch, g615_counters_dependencies + 27, 4},
+        {hwcpipe_counter::MaliExtBusWrSnoopFull, 45, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrSnoopPart, 46, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrStallCy, 48, 0, block_type::memory},
+        {hwcpipe_counter::MaliExtBusWrStallRate, MaliExtBusWrStallRate_v1, formula_24_flat, formula_24_batch, g615_counters_dependencies + 31, 2},
+        {hwcpipe_counter::MaliFragActiveCy, 4, 0, block_type::core},
+        {hwcpipe_counter::MaliFragEZSKillQd, 14, 0, block_type::core},
+        {hwcpipe_counter::MaliFragEZSKillRate, MaliFragEZSKillRate_v0, formula_5_flat, formula_5_batch, g615_counters_dependencies + 33, 2},
+        {hwcpipe_counter::MaliFragEZSTestQd, 12, 0, block_type::core},
+        {hwcpipe_counter::MaliFragEZSTestRate, MaliFragEZSTestRate_v0, formula_5_flat, formula_5_batch, g615_counters_dependencies + 35, 2},
+        {hwcpipe_counter::MaliFragEZSUpdateQd, 13, 0, block_type::core},
+        {hwcpipe_counter::MaliFragEZSUpdateRate, MaliFragEZSUpdateRate_v0, formula_5_flat, formula_5_batch, g615_counters_dependencies + 37, 2},
+        {hwcpipe_counter::MaliFragFPKActiveCy, 7, 0, block_type::core},
+        {hwcpipe_counter::MaliFragFPKBUtil, MaliFragFPKBUtil_v0, formula_5_flat, formula_5_batch, g615_counters_dependencies + 39, 2},
+        {hwcpipe_counter::MaliFragFPKKillQd, MaliFragFPKKillQd_v2, formula_27_flat, formula_27_batch, g615_counters_dependencies + 41, 3},
+        {hwcpipe_counter::MaliFragFPKKillRate, MaliFragFPKKillRate_v2, formula_30_flat, formula_30_batch, g615_counters_dependencies + 44, 3},
+        {hwcpipe_counter::MaliFragLZSKillQd, 16, 0, block_type::core},
+        {hwcpipe_counter::MaliFragLZSKillRate, MaliFragLZSKillRate_v0, formula_5_flat, formula_5_batch, g615_counters_dependencies + 47, 2},
+        {hwcpipe_counter::MaliFragLZSTestQd, 15, 0, block_type::core},
+        {hwcpipe_counter::MaliFragLZSTestRate, MaliFragLZSTestRate_v0, formula_5_flat, formula_5_batch, g615_counters_dependencies + 49, 2},
+        {hwcpipe_counter::MaliFragOpaqueQd, 20, 0, block_type::core},
+        {hwcpipe_counter::MaliFragOpaqueQdRate, MaliFragOpaqueQdRate_v0, formula_34_flat, formula_34_batch, g615_counters_dependencies + 51, 3},
+        {hwcpipe_counter::MaliFragOverdraw, MaliFragOverdraw_v3, formula_38_flat, formula_38_batch, g615_counters_dependencies + 54, 2},
+        {hwcpipe_counter::MaliFragQueueActiveCy, MaliFragQueueActiveCy_v0, formula_11_flat, formula_11_batch, g615_counters_dependencies + 56, 2},
+        {hwcpipe_counter::MaliFragQueueJob, 33, 0, block_type::fe},
+        {hwcpipe_counter::MaliFragQueueTask, 34, 0, block_type::fe},
+        {hwcpipe_counter::MaliFragQueueUtil, MaliFragQueueUtil_v2, formula_12_flat, formula_12_batch, g615_counters_dependencies + 58, 3},
+        {hwcpipe_counter::MaliFragRastPrim, 6, 0, block_type::core},
+        {hwcpipe_counter::MaliFragRastQd, 11, 0, block_type::core},
+        {hwcpipe_counter::MaliFragShadedQd, MaliFragShadedQd_v2, formula_46_flat, formula_46_batch, g615_counters_dependencies + 61, 1},
+        {hwcpipe_counter::MaliFragThread, 69, 2, block_type::core},
+        {hwcpipe_counter::MaliFragThroughputCy, MaliFragThroughputCy_v3, formula_52_flat, formula_52_batch, g615_counters_dependencies + 62, 2},
+        {hwcpipe_counter::MaliFragTile, 18, 0, block_type::core},
+        {hwcpipe_counter::MaliFragTileKill, 19, 0, block_type::core},
+        {hwcpipe_counter::MaliFragTileKillRate, MaliFragTileKillRate_v1, formula_32_flat, formula_32_batch, g615_counters_dependencies + 64, 2},
+        {hwcpipe_counter::MaliFragTransparentQd, MaliFragTransparentQd_v0, formula_25_flat, formula_25_batch, g615_counters_dependencies + 66, 3},
+        {hwcpipe_counter::MaliFragUtil, MaliFragUtil_v1, formula_5_flat, formula_5_batch, g615_counters_dependencies + 69, 2},
+        {hwcpipe_counter::MaliFragWarp, 9, 0, block_type::core},
+        {hwcpipe_counter::MaliGPUActiveCy, MaliGPUActiveCy_v0, formula_0_flat, formula_0_batch, g615_counters_dependencies + 71, 1},
+        {hwcpipe_counter::MaliGPUCyPerPix, MaliGPUCyPerPix_v1, formula_38_flat, formula_38_batch, g615_counters_dependencies + 72, 2},
+        {hwcpipe_counter::MaliGPUIRQActiveCy, 10, 0, block_type::fe},
+        {hwcpipe_counter::MaliGPUIRQUtil, MaliGPUIRQUtil_v1, formula_5_flat, formula_5_batch, g615_counters_dependencies + 74, 2},
+        {hwcpipe_counter::MaliGPUPix, MaliGPUPix_v0, formula_54_flat, formula_54_batch, g615_counters_dependencies + 76, 1},
+        {hwcpipe_counter::MaliGeomBackFacePrim, 10, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomFrontFacePrim, 9, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomLinePrim, 7, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomPointPrim, 8, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomPosShadTask, 21, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomPosShadThread, MaliGeomPosShadThread_v0, formula_47_flat, formula_47_batch, g615_counters_dependencies + 77, 1},
+        {hwcpipe_counter::MaliGeomPosShadThreadPerPrim, MaliGeomPosShadThreadPerPrim_v1, formula_60_flat, formula_60_batch, g615_counters_dependencies + 78, 5},
+        {hwcpipe_counter::MaliGeomSampleCullPrim, 14, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomSampleCullRate, MaliGeomSampleCullRate_v1, formula_63_flat, formula_63_batch, g615_counters_dependencies + 83, 4},
+        {hwcpipe_counter::MaliGeomTotalCullPrim, MaliGeomTotalCullPrim_v1, formula_15_flat, formula_15_batch, g615_counters_dependencies + 87, 3},
+        {hwcpipe_counter::MaliGeomTotalPrim, MaliGeomTotalPrim_v1, formula_66_flat, formula_66_batch, g615_counters_dependencies + 90, 4},
+        {hwcpipe_counter::MaliGeomTrianglePrim, 6, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomVarShadTask, 37, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomVarShadThread, MaliGeomVarShadThread_v0, formula_47_flat, formula_47_batch, g615_counters_dependencies + 94, 1},
+        {hwcpipe_counter::MaliGeomVarShadThreadPerPrim, MaliGeomVarShadThreadPerPrim_v0, formula_68_flat, formula_68_batch, g615_counters_dependencies + 95, 2},
+        {hwcpipe_counter::MaliGeomVisiblePrim, 11, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomVisibleRate, MaliGeomVisibleRate_v1, formula_69_flat, formula_69_batch, g615_counters_dependencies + 97, 4},
+        {hwcpipe_counter::MaliL2CacheFlush, 13, 0, block_type::fe},
+        {hwcpipe_counter::MaliL2CacheIncSnp, 52, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheIncSnpStallCy, 53, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheL1Rd, 22, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheL1RdStallCy, 23, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheL1Wr, 24, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheLookup, 25, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheRd, 16, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheRdLookup, 26, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheRdMissRate, MaliL2CacheRdMissRate_v0, formula_5_flat, formula_5_batch, g615_counters_dependencies + 101, 2},
+        {hwcpipe_counter::MaliL2CacheRdStallCy, 17, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheSnp, 20, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheSnpLookup, 28, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheSnpStallCy, 21, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheWr, 18, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheWrLookup, 27, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheWrMissRate, MaliL2CacheWrMissRate_v0, formula_5_flat, formula_5_batch, g615_counters_dependencies + 103, 2},
+        {hwcpipe_counter::MaliL2CacheWrStallCy, 19, 0, block_type::memory},
+        {hwcpipe_counter::MaliLSAtomic, 48, 0, block_type::core},
+        {hwcpipe_counter::MaliLSFullRd, 44, 0, block_type::core},
+        {hwcpipe_counter::MaliLSFullWr, 46, 0, block_type::core},
+        {hwcpipe_counter::MaliLSIssueCy, MaliLSIssueCy_v0, formula_67_flat, formula_67_batch, g615_counters_dependencies + 105, 5},
+        {hwcpipe_counter::MaliLSPartRd, 45, 0, block_type::core},
+        {hwcpipe_counter::MaliLSPartWr, 47, 0, block_type::core},
+        {hwcpipe_counter::MaliLSRdCy, MaliLSRdCy_v0, formula_71_flat, formula_71_batch, g615_counters_dependencies + 110, 2},
+        {hwcpipe_counter::MaliLSUtil, MaliLSUtil_v0, formula_72_flat, formula_72_batch, g615_counters_dependencies + 112, 6},
+        {hwcpipe_counter::MaliLSWrCy, MaliLSWrCy_v0, formula_71_flat, formula_71_batch, g615_counters_dependencies + 118, 2},
+        {hwcpipe_counter::MaliMMUL2Hit, 8, 0, block_type::memory},
+        {hwcpipe_counter::MaliMMUL2Rd, 6, 0, block_type::memory},
+        {hwcpipe_counter::MaliMMUL3Hit, 7, 0, block_type::memory},
+        {hwcpipe_counter::MaliMMUL3Rd, 5, 0, block_type::memory},
+        {hwcpipe_counter::MaliMMULookup, 4, 0, block_type::memory},
+        {hwcpipe_counter::MaliNonFragActiveCy, 22, 0, block_type::core},
+        {hwcpipe_counter::MaliNonFragTask, 23, 0, block_type::core},
+        {hwcpipe_counter::MaliNonFragThread, MaliNonFragThread_v2, formula_43_flat, formula_43_batch, g615_counters_dependencies + 120, 1},
+        {hwcpipe_counter::MaliNonFragThroughputCy, MaliNonFragThroughputCy_v2, formula_51_flat, formula_51_batch, g615_counters_dependencies + 121, 2},
+        {hwcpipe_counter::MaliNonFragUtil, MaliNonFragUtil_v1, formula_5_flat, formula_5_batch, g615_counters_dependencies + 123, 2},
+        {hwcpipe_counter::MaliNonFragWarp, 24, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusFFEExtRdBt, 55, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusFFEExtRdBy, MaliSCBusFFEExtRdBy_v0, formula_43_flat, formula_43_batch, g615_counters_dependencies + 125, 1},
+        {hwcpipe_counter::MaliSCBusFFEL2RdBt, 54, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusFFEL2RdBy, MaliSCBusFFEL2RdBy_v0, formula_43_flat, formula_43_batch, g615_counters_dependencies + 126, 1},
+        {hwcpipe_counter::MaliSCBusLSExtRdBt, 57, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusLSExtRdBy, MaliSCBusLSExtRdBy_v0, formula_43_flat, formula_43_batch, g615_counters_dependencies + 127, 1},
+        {hwcpipe_counter::MaliSCBusLSExtRdByPerRd, MaliSCBusLSExtRdByPerRd_v0, formula_75_flat, formula_75_batch, g615_counters_dependencies + 128, 3},
+        {hwcpipe_counter::MaliSCBusLSL2RdBt, 56, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusLSL2RdBy, MaliSCBusLSL2RdBy_v0, formula_43_flat, formula_43_batch, g615_counters_dependencies + 131, 1},
+        {hwcpipe_counter::MaliSCBusLSL2RdByPerRd, MaliSCBusLSL2RdByPerRd_v0, formula_75_flat, formula_75_batch, g615_counters_dependencies + 132, 3},
+        {hwcpipe_counter::MaliSCBusLSOtherWrBt, 61, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusLSWBWrBt, 63, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusLSWrBt, MaliSCBusLSWrBt_v0, formula_71_flat, formula_71_batch, g615_counters_dependencies + 135, 2},
+        {hwcpipe_counter::MaliSCBusLSWrBy, MaliSCBusLSWrBy_v0, formula_77_flat, formula_77_batch, g615_counters_dependencies + 137, 2},
+        {hwcpipe_counter::MaliSCBusLSWrByPerWr, MaliSCBusLSWrByPerWr_v0, formula_76_flat, formula_76_batch, g615_counters_dependencies + 139, 4},
+        {hwcpipe_counter::MaliSCBusOtherL2RdBt, 60, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusTexExtRdBt, 59, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusTexExtRdBy, MaliSCBusTexExtRdBy_v0, formula_43_flat, formula_43_batch, g615_counters_dependencies + 143, 1},
+        {hwcpipe_counter::MaliSCBusTexExtRdByPerRd, MaliSCBusTexExtRdByPerRd_v0, formula_78_flat, formula_78_batch, g615_counters_dependencies + 144, 2},
+        {hwcpipe_counter::MaliSCBusTexL2RdBt, 58, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusTexL2RdBy, MaliSCBusTexL2RdBy_v0, formula_43_flat, formula_43_batch, g615_counters_dependencies + 146, 1},
+        {hwcpipe_counter::MaliSCBusTexL2RdByPerRd, MaliSCBusTexL2RdByPerRd_v0, formula_78_flat, formula_78_batch, g615_counters_dependencies + 147, 2},
+        {hwcpipe_counter::MaliSCBusTileWrBPerPx, MaliSCBusTileWrBPerPx_v0, formula_37_flat, formula_37_batch, g615_counters_dependencies + 149, 2},
+        {hwcpipe_counter::MaliSCBusTileWrBt, 62, 0, block_type::core},
+        {hwcpipe_counter::MaliSCBusTileWrBy, MaliSCBusTileWrBy_v0, formula_43_flat, formula_43_batch, g615_counters_dependencies + 151, 1},
+        {hwcpipe_counter::MaliTexCPI, MaliTexCPI_v3, formula_80_flat, formula_80_batch, g615_counters_dependencies + 152, 2},
+        {hwcpipe_counter::MaliTexFiltIssueCy, 39, 0, block_type::core},
+        {hwcpipe_counter::MaliTexIssueCy, MaliTexIssueCy_v0, formula_0_flat, formula_0_batch, g615_counters_dependencies + 154, 1},
+        {hwcpipe_counter::MaliTexQuads, MaliTexQuads_v1, formula_84_flat, formula_84_batch, g615_counters_dependencies + 155, 1},
+        {hwcpipe_counter::MaliTexSample, MaliTexSample_v3, formula_86_flat, formula_86_batch, g615_counters_dependencies + 156, 1},
+        {hwcpipe_counter::MaliTexUtil, MaliTexUtil_v0, formula_5_flat, formula_5_batch, g615_counters_dependencies + 157, 2},
+        {hwcpipe_counter::MaliTilerActiveCy, 4, 0, block_type::tiler},
+        {hwcpipe_counter::MaliTilerPosCacheHit, 26, 0, block_type::tiler},
+        {hwcpipe_counter::MaliTilerPosShadFIFOFullCy, 24, 0, block_type::tiler},
+        {hwcpipe_counter::MaliTilerPosShadStallCy, 23, 0, block_type::tiler},
+        {hwcpipe_counter::MaliTilerRdBt, 17, 0, block_type::tiler},
+        {hwcpipe_counter::MaliTilerUtil, MaliTilerUtil_v1, formula_5_flat, formula_5_batch, g615_counters_dependencies + 159, 2},
+        {hwcpipe_counter::MaliTilerVarCacheHit, 34, 0, block_type::tiler},
+        {hwcpipe_counter::MaliTilerVarCacheHitRate, MaliTilerVarCacheHitRate_v0, formula_89_flat, formula_89_batch, g615_counters_dependencies + 161, 2},
+        {hwcpipe_counter::MaliTilerVarCacheMiss, 35, 0, block_type::tiler},
+        {hwcpipe_counter::MaliTilerVarShadStallCy, 38, 0, block_type::tiler},
+        {hwcpipe_counter::MaliVar16IssueCy, MaliVar16IssueCy_v2, formula_91_flat, formula_91_batch, g615_counters_dependencies + 163, 1},
+        {hwcpipe_counter::MaliVar16IssueSlot, 51, 0, block_type::core},
+        {hwcpipe_counter::MaliVar32IssueCy, MaliVar32IssueCy_v2, formula_91_flat, formula_91_batch, g615_counters_dependencies + 164, 1},
+        {hwcpipe_counter::MaliVar32IssueSlot, 50, 0, block_type::core},
+        {hwcpipe_counter::MaliVarInstr, 49, 0, block_type::core},
+        {hwcpipe_counter::MaliVarIssueCy, MaliVarIssueCy_v2, formula_93_flat, formula_93_batch, g615_counters_dependencies + 165, 2},
+        {hwcpipe_counter::MaliVarUtil, MaliVarUtil_v2, formula_95_flat, formula_95_batch, g615_counters_dependencies + 167, 3},
+        {hwcpipe_counter::MaliCoreAllRegsWarp, 17, 0, block_type::core},
+        {hwcpipe_counter::MaliCoreAllRegsWarpRate, MaliCoreAllRegsWarpRate_v0, formula_13_flat, formula_13_batch, g615_counters_dependencies + 170, 3},
+        {hwcpipe_counter::MaliCoreFullWarp, 21, 0, block_type::core},
+        {hwcpipe_counter::MaliCoreFullWarpRate, MaliCoreFullWarpRate_v0, formula_13_flat, formula_13_batch, g615_counters_dependencies + 173, 3},
+        {hwcpipe_counter::MaliEngArithInstr, MaliEngArithInstr_v0, formula_15_flat, formula_15_batch, g615_counters_dependencies + 176, 3},
+        {hwcpipe_counter::MaliEngCVTInstr, 28, 0, block_type::core},
+        {hwcpipe_counter::MaliEngCVTPipeUtil, MaliEngCVTPipeUtil_v0, formula_5_flat, formula_5_batch, g615_counters_dependencies + 179, 2},
+        {hwcpipe_counter::MaliEngFMAInstr, 27, 0, block_type::core},
+        {hwcpipe_counter::MaliEngFMAPipeUtil, MaliEngFMAPipeUtil_v1, formula_16_flat, formula_16_batch, g615_counters_dependencies + 181, 2},
+        {hwcpipe_counter::MaliEngICacheMiss, 32, 0, block_type::core},
+        {hwcpipe_counter::MaliEngSFUInstr, 29, 0, block_type::core},
+        {hwcpipe_counter::MaliEngSFUPipeUtil, MaliEngSFUPipeUtil_v0, formula_18_flat, formula_18_batch, g615_counters_dependencies + 183, 2},
+        {hwcpipe_counter::MaliEngSWBlendInstr, 34, 0, block_type::core},
+        {hwcpipe_counter::MaliEngSWBlendRate, MaliEngSWBlendRate_v1, formula_18_flat, formula_18_batch, g615_counters_dependencies + 185, 2},
+        {hwcpipe_counter::MaliFragRastPartQd, 10, 0, block_type::core},
+        {hwcpipe_counter::MaliFragRastPartQdRate, MaliFragRastPartQdRate_v0, formula_5_flat, formula_5_batch, g615_counters_dependencies + 187, 2},
+        {hwcpipe_counter::MaliTexDataFetchStallCy, 37, 0, block_type::core},
+        {hwcpipe_counter::MaliTexDescStallCy, 36, 0, block_type::core},
+        {hwcpipe_counter::MaliTexFiltFullRate, MaliTexFiltFullRate_v0, formula_82_flat, formula_82_batch, g615_counters_dependencies + 189, 3},
+        {hwcpipe_counter::MaliTexFiltStallCy, 38, 0, block_type::core},
+        {hwcpipe_counter::MaliTexFullBiFiltCy, 40, 0, block_type::core},
+        {hwcpipe_counter::MaliTexFullTriFiltCy, 41, 0, block_type::core},
+        {hwcpipe_counter::MaliTexInBt, 35, 0, block_type::core},
+        {hwcpipe_counter::MaliTexInBusUtil, MaliTexInBusUtil_v0, formula_5_flat, formula_5_batch, g615_counters_dependencies + 192, 2},
+        {hwcpipe_counter::MaliTexOutBt, 43, 0, block_type::core},
+        {hwcpipe_counter::MaliTexOutBusUtil, MaliTexOutBusUtil_v0, formula_5_flat, formula_5_batch, g615_counters_dependencies + 194, 2},
+        {hwcpipe_counter::MaliTexOutMsg, 42, 0, block_type::core},
+        {hwcpipe_counter::MaliAnyActiveCy, 53, 0, block_type::core},
+        {hwcpipe_counter::MaliAnyUtil, MaliAnyUtil_v1, formula_10_flat, formula_10_batch, g615_counters_dependencies + 196, 2},
+        {hwcpipe_counter::MaliCS0WaitStallCy, 51, 0, block_type::fe},
+        {hwcpipe_counter::MaliCS1WaitStallCy, 55, 0, block_type::fe},
+        {hwcpipe_counter::MaliCS2WaitStallCy, 59, 0, block_type::fe},
+        {hwcpipe_counter::MaliCS3WaitStallCy, 63, 0, block_type::fe},
+        {hwcpipe_counter::MaliCSFCEUActiveCy, 40, 0, block_type::fe},
+        {hwcpipe_counter::MaliCSFCEUUtil, MaliCSFCEUUtil_v1, formula_5_flat, formula_5_batch, g615_counters_dependencies + 198, 2},
+        {hwcpipe_counter::MaliCSFCS0ActiveCy, 48, 0, block_type::fe},
+        {hwcpipe_counter::MaliCSFCS1ActiveCy, 52, 0, block_type::fe},
+        {hwcpipe_counter::MaliCSFCS2ActiveCy, 56, 0, block_type::fe},
+        {hwcpipe_counter::MaliCSFCS3ActiveCy, 60, 0, block_type::fe},
+        {hwcpipe_counter::MaliCSFLSUActiveCy, 45, 0, block_type::fe},
+        {hwcpipe_counter::MaliCSFLSUUtil, MaliCSFLSUUtil_v1, formula_5_flat, formula_5_batch, g615_counters_dependencies + 200, 2},
+        {hwcpipe_counter::MaliCSFMCUActiveCy, 5, 0, block_type::fe},
+        {hwcpipe_counter::MaliCSFMCUUtil, MaliCSFMCUUtil_v1, formula_5_flat, formula_5_batch, g615_counters_dependencies + 202, 2},
+        {hwcpipe_counter::MaliCompQueueActiveCy, MaliCompQueueActiveCy_v0, formula_11_flat, formula_11_batch, g615_counters_dependencies + 204, 2},
+        {hwcpipe_counter::MaliCompQueueAssignStallCy, 30, 0, block_type::fe},
+        {hwcpipe_counter::MaliCompQueueDrainStallCy, 31, 0, block_type::fe},
+        {hwcpipe_counter::MaliCompQueueIRQActiveCy, 28, 0, block_type::fe},
+        {hwcpipe_counter::MaliCompQueueJob, 25, 0, block_type::fe},
+        {hwcpipe_counter::MaliCompQueueTask, 26, 0, block_type::fe},
+        {hwcpipe_counter::MaliCompQueueUtil, MaliCompQueueUtil_v1, formula_12_flat, formula_12_batch, g615_counters_dependencies + 206, 3},
+        {hwcpipe_counter::MaliCompQueuedCy, 24, 0, block_type::fe},
+        {hwcpipe_counter::MaliFragQueueAssignStallCy, 38, 0, block_type::fe},
+        {hwcpipe_counter::MaliFragQueueIRQActiveCy, 36, 0, block_type::fe},
+        {hwcpipe_counter::MaliFragQueuedCy, 32, 0, block_type::fe},
+        {hwcpipe_counter::MaliGPUAnyQueueActiveCy, 6, 0, block_type::fe},
+        {hwcpipe_counter::MaliGPUIRQ, 11, 0, block_type::fe},
+        {hwcpipe_counter::MaliL2CacheCleanUnique, 13, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheEvict, 12, 0, block_type::memory},
+        {hwcpipe_counter::MaliL2CacheFlushCy, 12, 0, block_type::fe},
+        {hwcpipe_counter::MaliTilerQueueDrainStallCy, 23, 0, block_type::fe},
+        {hwcpipe_counter::MaliVertQueueActiveCy, MaliVertQueueActiveCy_v0, formula_11_flat, formula_11_batch, g615_counters_dependencies + 209, 2},
+        {hwcpipe_counter::MaliVertQueueAssignStallCy, 22, 0, block_type::fe},
+        {hwcpipe_counter::MaliVertQueueIRQActiveCy, 20, 0, block_type::fe},
+        {hwcpipe_counter::MaliVertQueueJob, 17, 0, block_type::fe},
+        {hwcpipe_counter::MaliVertQueueTask, 18, 0, block_type::fe},
+        {hwcpipe_counter::MaliVertQueueUtil, MaliVertQueueUtil_v1, formula_12_flat, formula_12_batch, g615_counters_dependencies + 211, 3},
+        {hwcpipe_counter::MaliVertQueuedCy, 16, 0, block_type::fe},
+        {hwcpipe_counter::MaliCoreFragWarpOcc, MaliCoreFragWarpOcc_v0, formula_14_flat, formula_14_batch, g615_counters_dependencies + 214, 2},
+        {hwcpipe_counter::MaliEngNarrowInstr, 5, 0, block_type::core},
+        {hwcpipe_counter::MaliEngNarrowInstrRate, MaliEngNarrowInstrRate_v0, formula_17_flat, formula_17_batch, g615_counters_dependencies + 216, 4},
+        {hwcpipe_counter::MaliFragRastCoarseQd, 68, 0, block_type::core},
+        {hwcpipe_counter::MaliFragShadRate, MaliFragShadRate_v0, formula_5_flat, formula_5_batch, g615_counters_dependencies + 220, 2},
+        {hwcpipe_counter::MaliGPUActiveRawCy, 4, 0, block_type::fe},
+        {hwcpipe_counter::MaliGeomFaceCullPrim, 12, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomFaceCullRate, MaliGeomFaceCullRate_v0, formula_56_flat, formula_56_batch, g615_counters_dependencies + 222, 4},
+        {hwcpipe_counter::MaliGeomPlaneCullPrim, 13, 0, block_type::tiler},
+        {hwcpipe_counter::MaliGeomPlaneCullRate, MaliGeomPlaneCullRate_v0, formula_58_flat, formula_58_batch, g615_counters_dependencies + 226, 4},
+        {hwcpipe_counter::MaliRTUBox, 71, 0, block_type::core},
+        {hwcpipe_counter::MaliRTUBoxBin1, 76, 0, block_type::core},
+        {hwcpipe_counter::MaliRTUBoxBin13, 79, 0, block_type::core},
+        {hwcpipe_counter::MaliRTUBoxBin5, 77, 0, block_type::core},
+        {hwcpipe_counter::MaliRTUBoxBin9, 78, 0, block_type::core},
+        {hwcpipe_counter::MaliRTUBoxIssueCy, 85, 0, block_type::core},
+        {hwcpipe_counter::MaliRTUFirstHitTerm, 82, 0, block_type::core},
+        {hwcpipe_counter::MaliRTUIssueCy, MaliRTUIssueCy_v0, formula_73_flat, formula_73_batch, g615_counters_dependencies + 230, 2},
+        {hwcpipe_counter::MaliRTUMiss, 83, 0, block_type::core},
+        {hwcpipe_counter::MaliRTUNonOpaqueHit, 81, 0, block_type::core},
+        {hwcpipe_counter::MaliRTUOpaqueHit, 80, 0, block_type::core},
+        {hwcpipe_counter::MaliRTURay, 84, 0, block_type::core},
+        {hwcpipe_counter::MaliRTUTri, 70, 0, block_type::core},
+        {hwcpipe_counter::MaliRTUTriBin1, 72, 0, block_type::core},
+        {hwcpipe_counter::MaliRTUTriBin13, 75, 0, block_type::core},
+        {hwcpipe_counter::MaliRTUTriBin5, 73, 0, block_type::core},
+        {hwcpipe_counter::MaliRTUTriBin9, 74, 0, block_type::core},
+        {hwcpipe_counter::MaliRTUTriIssueCy, 86, 0, block_type::core},
+        {hwcpipe_counter::MaliRTUUtil, MaliRTUUtil_v0, formula_74_flat, formula_74_batch, g615_counters_dependencies + 232, 3},
+    };
+
+    // Per-product counters that are added to, or replace, those of a shared table.
+
+    constexpr hwcpipe_counter g68_overrides_dependencies[] {
+        hwcpipe_counter::MaliCoreActiveCy, hwcpipe_counter::MaliAnyActiveCy,
+        hwcpipe_counter::MaliFragActiveCy, hwcpipe_counter::MaliAnyActiveCy,
+        hwcpipe_counter::MaliNonFragActiveCy, hwcpipe_counter::MaliAnyActiveCy,
+        hwcpipe_counter::MaliAnyActiveCy, hwcpipe_counter::MaliGPUActiveCy,
+    };
+
+    constexpr counter_record g68_overrides[] {
+        {hwcpipe_counter::MaliCoreUtil, MaliCoreUtil_v1, formula_5_flat, formula_5_batch, g68_overrides_dependencies + 0, 2},
+        {hwcpipe_counter::MaliFragUtil, MaliFragUtil_v1, formula_5_flat, formula_5_batch, g68_overrides_dependencies + 2, 2},
+        {hwcpipe_counter::MaliNonFragUtil, MaliNonFragUtil_v1, formula_5_flat, formula_5_batch, g68_overrides_dependencies + 4, 2},
+        {hwcpipe_counter::MaliAnyActiveCy, 53, 0, block_type::core},
+        {hwcpipe_counter::MaliAnyUtil, MaliAnyUtil_v0, formula_10_flat, formula_10_batch, g68_overrides_dependencies + 6, 2},
+    };
+
+    constexpr hwcpipe_counter g78_overrides_dependencies[] {
+        hwcpipe_counter::MaliCoreActiveCy, hwcpipe_counter::MaliAnyActiveCy,
+        hwcpipe_counter::MaliFragActiveCy, hwcpipe_counter::MaliAnyActiveCy,
+        hwcpipe_counter::MaliNonFragActiveCy, hwcpipe_counter::MaliAnyActiveCy,
+        hwcpipe_counter::MaliAnyActiveCy, hwcpipe_counter::MaliGPUActiveCy,
+    };
+
+    constexpr counter_record g78_overrides[] {
+        {hwcpipe_counter::MaliCoreUtil, MaliCoreUtil_v1, formula_5_flat, formula_5_batch, g78_overrides_dependencies + 0, 2},
+        {hwcpipe_counter::MaliFragUtil, MaliFragUtil_v1, formula_5_flat, formula_5_batch, g78_overrides_dependencies + 2, 2},
+        {hwcpipe_counter::MaliNonFragUtil, MaliNonFragUtil_v1, formula_5_flat, formula_5_batch, g78_overrides_dependencies + 4, 2},
+        {hwcpipe_counter::MaliAnyActiveCy, 53, 0, block_type::core},
+        {hwcpipe_counter::MaliAnyUtil, MaliAnyUtil_v0, formula_10_flat, formula_10_batch, g78_overrides_dependencies + 6, 2},
+    };
+
+    constexpr hwcpipe_counter g78ae_overrides_dependencies[] {
+        hwcpipe_counter::MaliCoreActiveCy, hwcpipe_counter::MaliAnyActiveCy,
+        hwcpipe_counter::MaliFragActiveCy, hwcpipe_counter::MaliAnyActiveCy,
+        hwcpipe_counter::MaliNonFragActiveCy, hwcpipe_counter::MaliAnyActiveCy,
+        hwcpipe_counter::MaliAnyActiveCy, hwcpipe_counter::MaliGPUActiveCy,
+    };
+
+    constexpr counter_record g78ae_overrides[] {
+        {hwcpipe_counter::MaliCoreUtil, MaliCoreUtil_v1, formula_5_flat, formula_5_batch, g78ae_overrides_dependencies + 0, 2},
+        {hwcpipe_counter::MaliFragUtil, MaliFragUtil_v1, formula_5_flat, formula_5_batch, g78ae_overrides_dependencies + 2, 2},
+        {hwcpipe_counter::MaliNonFragUtil, MaliNonFragUtil_v1, formula_5_flat, formula_5_batch, g78ae_overrides_dependencies + 4, 2},
+        {hwcpipe_counter::MaliAnyActiveCy, 53, 0, block_type::core},
+        {hwcpipe_counter::MaliAnyUtil, MaliAnyUtil_v0, formula_10_flat, formula_10_batch, g78ae_overrides_dependencies + 6, 2},
+    };
+
+} // namespace
+
+    constexpr std::array<gpu_counter_table, 12> valhall_gpu_counters {
+        gpu_counter_table {device::product_id::g57, g57_counters},
+        gpu_counter_table {device::product_id::g57_2, g57_counters},
+        gpu_counter_table {device::product_id::g77, g57_counters},
+        gpu_counter_table {device::product_id::g68, g57_counters, g68_overrides},
+        gpu_counter_table {device::product_id::g78, g57_counters, g78_overrides},
+        gpu_counter_table {device::product_id::g78ae, g57_counters, g78ae_overrides},
+        gpu_counter_table {device::product_id::g310, g310_counters},
+        gpu_counter_table {device::product_id::g510, g310_counters},
+        gpu_counter_table {device::product_id::g610, g310_counters},
+        gpu_counter_table {device::product_id::g710, g310_counters},
+        gpu_counter_table {device::product_id::g615, g615_counters},
+        gpu_counter_table {device::product_id::g715, g615_counters},
+    };
+
+} // namespace database
+} // namespace hwcpipe
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <hwcpipe/atrace_sink.hpp>
+#include <hwcpipe/counter_database.hpp>
+#include <hwcpipe/detail/decimal_format.hpp>
+#include <hwcpipe/error.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <string>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace hwcpipe {
+
+namespace {
+
+// the longest formatted value, INT64_MIN
+constexpr size_t max_value_size = detail::max_integer_size;
+
+} // namespace
+
+atrace_sink::atrace_sink(int fd, const hwcpipe_counter *counters, size_t num_counters,
+                         const atrace_sink_config &config)
+    : fd_(fd)
+    , max_write_size_(std::max<size_t>(config.max_write_size, 1))
+    , staging_(num_counters) {
+    if (config.columns != nullptr) {
+        for (size_t i = 0; i != config.num_columns; ++i) {
+            if (config.columns[i] < num_counters) {
+                columns_.push_back(config.columns[i]);
+            }
+        }
+    } else {
+        for (size_t i = 0; i != num_counters; ++i) {
+            columns_.push_back(i);
+        }
+    }
+
+    const std::string pid = std::to_string(config.pid != 0 ? config.pid : static_cast<int>(::getpid()));
+    const counter_database database{};
+    size_t max_size = 0;
+    for (const auto index : columns_) {
+        std::string prefix = "C|" + pid + "|" + config.name_prefix;
+        counter_metadata metadata{};
+        if (database.describe_counter(counters[index], metadata)) {
+            prefix += std::to_string(static_cast<int>(counters[index]));
+        } else {
+            prefix += metadata.name;
+        }
+        prefix += '|';
+
+        prefix_offsets_.push_back(prefixes_.size());
+        prefixes_.insert(prefixes_.end(), prefix.begin(), prefix.end());
+        max_size += prefix.size() + max_value_size + 1;
+    }
+    prefix_offsets_.push_back(prefixes_.size());
+    buffer_.resize(max_size);
+    values_.resize(columns_.size());
+}
+
+int atrace_sink::open_trace_marker(std::error_code &ec) {
+    static const char *const paths[] = {"/sys/kernel/tracing/trace_marker",
+                                        "/sys/kernel/debug/tracing/trace_marker"};
+    for (const char *path : paths) {
+        const int fd = ::open(path, O_WRONLY | O_CLOEXEC);
+        if (fd >= 0) {
+            ec = {};
+            return fd;
+        }
+    }
+    ec = make_error_code(errc::trace_marker_unavailable);
+    return -1;
+}
+
+std::error_code atrace_sink::write_events() {
+    char *const begin = buffer_.data();
+    char *out = begin;
+    for (size_t i = 0; i != columns_.size(); ++i) {
+        const char *prefix = prefixes_.data() + prefix_offsets_[i];
+        const size_t prefix_size = prefix_offsets_[i + 1] - prefix_offsets_[i];
+
+        // an event never straddles two writes
+        const size_t size = static_cast<size_t>(out - begin);
+        if (size != 0 && size + prefix_size + max_value_size + 1 > max_write_size_) {
+            auto ec = write(begin, size);
+            if (ec) {
+                return ec;
+            }
+            out = begin;
+        }
+
+        out = std::copy(prefix, prefix + prefix_size, out);
+        out = detail::format_integer(values_[i], out);
+        *out++ = '\n';
+    }
+
+    auto ec = out != begin ? write(begin, static_cast<size_t>(out - begin)) : std::error_code{};
+    if (ec) {
+        return ec;
+    }
+    ++stats_.samples;
+    stats_.events += columns_.size();
+    return {};
+}
+
+std::error_code atrace_sink::write(const char *data, size_t size) {
+    // the trace marker takes a write whole or not at all, a partial write
+    // only happens on other files
+    while (size != 0) {
+        const ssize_t written = ::write(fd_, data, size);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return make_error_code(errc::trace_marker_unavailable);
+        }
+        ++stats_.writes;
+        stats_.bytes += static_cast<uint64_t>(written);
+        data += written;
+        size -= static_cast<size_t>(written);
+    }
+    return {};
+}
+
+} // namespace hwcpipe
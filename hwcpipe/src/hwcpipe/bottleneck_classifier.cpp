@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <hwcpipe/bottleneck_classifier.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace hwcpipe {
+
+namespace {
+
+/** The counters of each input, by preference. */
+const std::array<std::array<hwcpipe_counter, 2>, num_bottleneck_inputs> input_counters{{
+    {{MaliFragQueueUtil, MaliMainQueueUtil}},
+    {{MaliNonFragQueueUtil, MaliBinningQueueUtil}},
+    {{MaliTilerUtil, MaliTilerUtil}},
+    {{MaliExtBusRdStallRate, MaliExtBusRdStallRate}},
+    {{MaliCoreUtil, MaliCoreUtil}},
+}};
+
+size_t index(bottleneck_input input) { return static_cast<size_t>(input); }
+
+} // namespace
+
+const char *get_bottleneck_name(bottleneck kind) {
+    switch (kind) {
+    case bottleneck::unknown:
+        return "unknown";
+    case bottleneck::cpu:
+        return "cpu";
+    case bottleneck::fragment:
+        return "fragment";
+    case bottleneck::vertex_tiler:
+        return "vertex_tiler";
+    case bottleneck::memory:
+        return "memory";
+    default:
+        return "unknown";
+    }
+}
+
+bottleneck_classifier::bottleneck_classifier(const hwcpipe_counter *available, size_t num_available,
+                                             const bottleneck_classifier_config &config)
+    : config_(config) {
+    const hwcpipe_counter *available_end = available + num_available;
+    for (size_t input = 0; input != num_bottleneck_inputs; ++input) {
+        columns_[input] = no_column;
+        for (hwcpipe_counter counter : input_counters[input]) {
+            if (std::find(available, available_end, counter) != available_end) {
+                columns_[input] = counters_.size();
+                counters_.push_back(counter);
+                break;
+            }
+        }
+    }
+
+    for (auto &summary : summaries_) {
+        summary.mean.fill(std::numeric_limits<double>::quiet_NaN());
+    }
+    runs_.resize(std::max<size_t>(config_.max_runs, 1));
+    staging_.resize(counters_.size());
+}
+
+bool bottleneck_classifier::push(uint64_t timestamp_ns_begin, uint64_t timestamp_ns_end, const double *values) {
+    if (window_size_ == 0) {
+        window_begin_ = timestamp_ns_begin;
+    }
+    window_end_ = timestamp_ns_end;
+
+    // a sample without a duration still counts
+    const double weight =
+        timestamp_ns_end > timestamp_ns_begin ? static_cast<double>(timestamp_ns_end - timestamp_ns_begin) : 1.0;
+    for (size_t input = 0; input != num_bottleneck_inputs; ++input) {
+        if (columns_[input] == no_column) {
+            continue;
+        }
+        const double value = values[columns_[input]];
+        if (std::isnan(value)) {
+            continue;
+        }
+        weighted_sums_[input] += value * weight;
+        weights_[input] += weight;
+    }
+
+    if (++window_size_ < std::max<size_t>(config_.window_samples, 1)) {
+        return false;
+    }
+    end_window();
+    return true;
+}
+
+bottleneck bottleneck_classifier::classify(const std::array<double, num_bottleneck_inputs> &mean) const {
+    const double fragment = mean[index(bottleneck_input::fragment_queue)];
+    const double non_fragment = mean[index(bottleneck_input::non_fragment_queue)];
+    if (std::isnan(fragment) && std::isnan(non_fragment)) {
+        return bottleneck::unknown;
+    }
+
+    // std::fmax() ignores a missing queue
+    const double busiest_queue = std::fmax(fragment, non_fragment);
+    if (busiest_queue < config_.gpu_busy_threshold) {
+        return bottleneck::cpu;
+    }
+
+    const double stall = mean[index(bottleneck_input::bus_read_stall)];
+    if (!std::isnan(stall) && stall >= config_.bus_stall_threshold) {
+        return bottleneck::memory;
+    }
+
+    const double geometry = std::fmax(non_fragment, mean[index(bottleneck_input::tiler)]);
+    if (std::isnan(geometry) || (!std::isnan(fragment) && fragment >= geometry)) {
+        return bottleneck::fragment;
+    }
+    return bottleneck::vertex_tiler;
+}
+
+void bottleneck_classifier::end_window() {
+    std::array<double, num_bottleneck_inputs> mean{};
+    for (size_t input = 0; input != num_bottleneck_inputs; ++input) {
+        mean[input] =
+            weights_[input] > 0.0 ? weighted_sums_[input] / weights_[input] : std::numeric_limits<double>::quiet_NaN();
+    }
+    const bottleneck kind = classify(mean);
+    last_ = kind;
+
+    // update the running means of the summary
+    const auto kind_index = static_cast<size_t>(kind);
+    auto &summary = summaries_[kind_index];
+    ++summary.windows;
+    summary.time_ns += window_end_ > window_begin_ ? window_end_ - window_begin_ : 0;
+    for (size_t input = 0; input != num_bottleneck_inputs; ++input) {
+        if (weights_[input] <= 0.0) {
+            continue;
+        }
+        double &total_weight = summary_weights_[kind_index][input];
+        total_weight += weights_[input];
+        if (std::isnan(summary.mean[input])) {
+            summary.mean[input] = mean[input];
+        } else {
+            summary.mean[input] += (mean[input] - summary.mean[input]) * (weights_[input] / total_weight);
+        }
+    }
+
+    if (current_.windows != 0 && current_.kind != kind) {
+        finish_run();
+    }
+    if (current_.windows == 0) {
+        current_.timestamp_ns_begin = window_begin_;
+        current_.kind = kind;
+    }
+    current_.timestamp_ns_end = window_end_;
+    ++current_.windows;
+
+    window_size_ = 0;
+    weighted_sums_.fill(0.0);
+    weights_.fill(0.0);
+}
+
+void bottleneck_classifier::finish_run() {
+    if (current_.windows == 0) {
+        return;
+    }
+    if (num_runs_ == runs_.size()) {
+        runs_head_ = (runs_head_ + 1) % runs_.size();
+        --num_runs_;
+        ++dropped_runs_;
+    }
+    runs_[(runs_head_ + num_runs_) % runs_.size()] = current_;
+    ++num_runs_;
+    current_ = bottleneck_run{};
+}
+
+size_t bottleneck_classifier::take_runs(bottleneck_run *runs, size_t max_runs) {
+    const size_t count = std::min(max_runs, num_runs_);
+    for (size_t i = 0; i != count; ++i) {
+        runs[i] = runs_[runs_head_];
+        runs_head_ = (runs_head_ + 1) % runs_.size();
+    }
+    num_runs_ -= count;
+    return count;
+}
+
+} // namespace hwcpipe
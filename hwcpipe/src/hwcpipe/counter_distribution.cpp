@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <hwcpipe/counter_distribution.hpp>
+
+#include <algorithm>
+#include <limits>
+
+namespace hwcpipe {
+
+namespace {
+
+/** The counters of a distribution: the total, then every bucket but the derived last one. */
+struct distribution_counters {
+    hwcpipe_counter total;
+    std::array<hwcpipe_counter, max_distribution_buckets - 1> buckets;
+    size_t num_buckets;
+};
+
+const std::array<distribution_counters, num_distributions> all_counters{{
+    {MaliExtBusRdBt,
+     {{MaliExtBusRdLat0, MaliExtBusRdLat128, MaliExtBusRdLat192, MaliExtBusRdLat256, MaliExtBusRdLat320}},
+     6},
+    {MaliExtBusRd, {{MaliExtBusRdOTQ1, MaliExtBusRdOTQ2, MaliExtBusRdOTQ3}}, 4},
+    {MaliExtBusWr, {{MaliExtBusWrOTQ1, MaliExtBusWrOTQ2, MaliExtBusWrOTQ3}}, 4},
+}};
+
+const double latency_edges[] = {0, 128, 192, 256, 320, 384, 448};
+const double occupancy_edges[] = {0, 25, 50, 75, 100};
+const std::array<const double *, num_distributions> all_edges{{latency_edges, occupancy_edges, occupancy_edges}};
+
+/** Interpolates the value below which @p quantile of a distribution lies. */
+double percentile(const counter_distribution &distribution, double quantile) {
+    double cumulative = 0;
+    for (size_t i = 0; i != distribution.num_buckets; ++i) {
+        const double fraction = distribution.fractions[i];
+        if (fraction > 0 && cumulative + fraction >= quantile) {
+            const double lower = distribution.edges[i];
+            const double upper = distribution.edges[i + 1];
+            return lower + (upper - lower) * std::max(quantile - cumulative, 0.0) / fraction;
+        }
+        cumulative += fraction;
+    }
+    return distribution.edges[distribution.num_buckets];
+}
+
+} // namespace
+
+std::vector<hwcpipe_counter> get_distribution_counters(distribution_kind kind) {
+    const auto &counters = all_counters[static_cast<size_t>(kind)];
+    std::vector<hwcpipe_counter> result{counters.total};
+    result.insert(result.end(), counters.buckets.begin(), counters.buckets.begin() + counters.num_buckets - 1);
+    return result;
+}
+
+counter_distributions::counter_distributions(const hwcpipe_counter *available, size_t num_available) {
+    const hwcpipe_counter *available_end = available + num_available;
+    const auto has = [&](hwcpipe_counter counter) {
+        return std::find(available, available_end, counter) != available_end;
+    };
+
+    for (size_t kind = 0; kind != num_distributions; ++kind) {
+        const auto &counters = all_counters[kind];
+        const auto *buckets_end = counters.buckets.begin() + counters.num_buckets - 1;
+        auto &distribution = distributions_[kind];
+        distribution.p50 = distribution.p90 = distribution.p99 = std::numeric_limits<double>::quiet_NaN();
+        if (!has(counters.total) || !std::all_of(counters.buckets.begin(), buckets_end, has)) {
+            continue;
+        }
+
+        distribution.num_buckets = counters.num_buckets;
+        distribution.edges = all_edges[kind];
+        columns_[kind] = counters_.size();
+        counters_.push_back(counters.total);
+        counters_.insert(counters_.end(), counters.buckets.begin(), buckets_end);
+    }
+    staging_.resize(counters_.size());
+}
+
+void counter_distributions::update(const uint64_t *values) {
+    constexpr double nan = std::numeric_limits<double>::quiet_NaN();
+    for (size_t kind = 0; kind != num_distributions; ++kind) {
+        auto &distribution = distributions_[kind];
+        if (distribution.num_buckets == 0) {
+            continue;
+        }
+
+        // the last bucket is what the total leaves to it, which may be less
+        // than zero when the counters are sampled at slightly different times
+        const uint64_t total = values[columns_[kind]];
+        const uint64_t *buckets = values + columns_[kind] + 1;
+        const size_t last = distribution.num_buckets - 1;
+        uint64_t counted = 0;
+        for (size_t i = 0; i != last; ++i) {
+            counted += buckets[i];
+        }
+        const uint64_t last_bucket = total > counted ? total - counted : 0;
+        distribution.total = counted + last_bucket;
+
+        if (distribution.total == 0) {
+            distribution.fractions.fill(0);
+            distribution.p50 = distribution.p90 = distribution.p99 = nan;
+            continue;
+        }
+        const double scale = 1.0 / static_cast<double>(distribution.total);
+        for (size_t i = 0; i != last; ++i) {
+            distribution.fractions[i] = static_cast<double>(buckets[i]) * scale;
+        }
+        distribution.fractions[last] = static_cast<double>(last_bucket) * scale;
+
+        distribution.p50 = percentile(distribution, 0.5);
+        distribution.p90 = percentile(distribution, 0.9);
+        distribution.p99 = percentile(distribution, 0.99);
+    }
+}
+
+} // namespace hwcpipe
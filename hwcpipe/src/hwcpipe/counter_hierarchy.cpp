@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <hwcpipe/counter_hierarchy.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+
+namespace hwcpipe {
+
+counter_tree_view::counter_tree_view(const hwcpipe_counter *available, size_t num_available)
+    : hierarchy_(get_counter_hierarchy()) {
+    const hwcpipe_counter *available_end = available + num_available;
+    group_counters_.reserve(hierarchy_.num_groups + 1);
+    for (size_t group = 0; group != hierarchy_.num_groups; ++group) {
+        group_counters_.push_back(counters_.size());
+        const auto &info = hierarchy_.groups[group];
+        const hwcpipe_counter *begin = hierarchy_.counters + info.first_counter;
+        std::copy_if(begin, begin + info.num_counters, std::back_inserter(counters_), [&](hwcpipe_counter counter) {
+            return std::find(available, available_end, counter) != available_end;
+        });
+    }
+    group_counters_.push_back(counters_.size());
+
+    sections_expanded_.resize(hierarchy_.num_sections);
+    groups_expanded_.resize(hierarchy_.num_groups);
+    // every counter may be visible at once, so that the changes don't allocate
+    visible_.reserve(counters_.size());
+    next_.reserve(counters_.size());
+    values_.reserve(counters_.size());
+}
+
+void counter_tree_view::set_section_expanded(size_t section, bool expanded) {
+    if (is_section_expanded(section) != expanded) {
+        sections_expanded_[section] = expanded ? 1 : 0;
+        refresh();
+    }
+}
+
+void counter_tree_view::set_group_expanded(size_t group, bool expanded) {
+    if (is_group_expanded(group) != expanded) {
+        groups_expanded_[group] = expanded ? 1 : 0;
+        refresh();
+    }
+}
+
+void counter_tree_view::set_all_expanded(bool expanded) {
+    std::fill(sections_expanded_.begin(), sections_expanded_.end(), expanded ? 1 : 0);
+    std::fill(groups_expanded_.begin(), groups_expanded_.end(), expanded ? 1 : 0);
+    refresh();
+}
+
+void counter_tree_view::refresh() {
+    next_.clear();
+    for (size_t group = 0; group != hierarchy_.num_groups; ++group) {
+        if (is_group_expanded(group) && is_section_expanded(hierarchy_.groups[group].section)) {
+            next_.insert(next_.end(), counters_.begin() + static_cast<std::ptrdiff_t>(group_counters_[group]),
+                         counters_.begin() + static_cast<std::ptrdiff_t>(group_counters_[group + 1]));
+        }
+    }
+    // collapsing an empty group, or a group of a collapsed section, changes nothing
+    if (next_ == visible_) {
+        return;
+    }
+
+    visible_.swap(next_);
+    values_.assign(visible_.size(), 0);
+    ++version_;
+    if (handler_ != nullptr) {
+        handler_(handler_data_, version_);
+    }
+}
+
+} // namespace hwcpipe
@@ -0,0 +1,586 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+// Generated by specification/lgcpy_export_hwcpipe_hierarchy.py, do not edit.
+
+#include "hwcpipe/counter_hierarchy.hpp"
+
+namespace hwcpipe {
+
+namespace {
+
+constexpr counter_section sections[] = {
+    {"GPU Front-end", 0, 14},
+    {"External Memory System", 14, 8},
+    {"Graphics Geometry Workload", 22, 6},
+    {"Graphics Fragment Workload", 28, 2},
+    {"Workload Cost", 30, 1},
+    {"Shader Core Front-end", 31, 4},
+    {"Shader Core Fragment Front-end", 35, 9},
+    {"Shader Core Programmable Core", 44, 4},
+    {"Shader Core Workload", 48, 3},
+    {"Shader Core Arithmetic Unit", 51, 5},
+    {"Shader Core Load/store Unit", 56, 1},
+    {"Shader Core Varying Unit", 57, 2},
+    {"Shader Core Texture Unit", 59, 10},
+    {"Shader Core Ray Tracing Unit", 69, 9},
+    {"Shader Core Other Units", 78, 3},
+    {"Shader Core Memory Access", 81, 9},
+    {"Tiling", 90, 6},
+    {"Internal Memory System", 96, 6},
+};
+
+constexpr counter_group groups[] = {
+    {"GPU Cycles", 0, 0, 12},
+    {"GPU Queued Cycles", 0, 12, 5},
+    {"GPU Wait Cycles", 0, 17, 22},
+    {"GPU Jobs", 0, 39, 7},
+    {"GPU Tasks", 0, 46, 7},
+    {"GPU Utilization", 0, 53, 8},
+    {"GPU Messages", 0, 61, 1},
+    {"GPU Cache Flushes", 0, 62, 1},
+    {"GPU Cache Flush Cycles", 0, 63, 1},
+    {"CSF Cycles", 0, 64, 3},
+    {"CSF Utilization", 0, 67, 3},
+    {"CSF Interrupt Cycles", 0, 70, 6},
+    {"CSF Stream Cycles", 0, 76, 6},
+    {"CSF Stream Stall Cycles", 0, 82, 6},
+    {"External Bus Accesses", 1, 88, 9},
+    {"External Bus Beats", 1, 97, 2},
+    {"External Bus Bytes", 1, 99, 2},
+    {"External Bus Stall Cycles", 1, 101, 3},
+    {"External Bus Stall Rate", 1, 104, 2},
+    {"External Bus Read Latency", 1, 106, 6},
+    {"External Bus Outstanding Reads", 1, 112, 4},
+    {"External Bus Outstanding Writes", 1, 116, 4},
+    {"Input Primitives", 2, 120, 4},
+    {"Visible Primitives", 2, 124, 2},
+    {"Primitive Culling", 2, 126, 8},
+    {"Primitive Culling Rate", 2, 134, 7},
+    {"Geometry Threads", 2, 141, 2},
+    {"Geometry Efficiency", 2, 143, 2},
+    {"Output pixels", 3, 145, 1},
+    {"Overdraw", 3, 146, 1},
+    {"Average Workload Cost", 4, 147, 3},
+    {"Shader Core Cycles", 5, 150, 7},
+    {"Shader Core Utilization", 5, 157, 6},
+    {"Shader Clock Ratio", 5, 163, 1},
+    {"Shader Core Tasks", 5, 164, 1},
+    {"Fragment Tiles", 6, 165, 2},
+    {"Fragment Primitives", 6, 167, 7},
+    {"Fragment Prepass Properties", 6, 174, 6},
+    {"Fragment Quads", 6, 180, 4},
+    {"Fragment ZS Quads", 6, 184, 9},
+    {"ZS Unit Test Rate", 6, 193, 7},
+    {"Fragment FPK HSR Quads", 6, 200, 2},
+    {"Fragment Shading Rate", 6, 202, 1},
+    {"Fragment Workload Properties", 6, 203, 3},
+    {"Shader Core Unit Utilization", 7, 206, 7},
+    {"Shader Core Backpressure Cycles", 7, 213, 7},
+    {"Shader Core Backpressure Rate", 7, 220, 7},
+    {"Shader Core Stall Cycles", 7, 227, 3},
+    {"Shader Warps", 8, 230, 7},
+    {"Shader Threads", 8, 237, 4},
+    {"Shader Workload Properties", 8, 241, 6},
+    {"ALU Cycles", 9, 247, 1},
+    {"Instruction Cache", 9, 248, 1},
+    {"ALU Instructions", 9, 249, 8},
+    {"ALU Utilization", 9, 257, 3},
+    {"ALU Issues", 9, 260, 3},
+    {"Load/Store Unit Cycles", 10, 263, 8},
+    {"Varying Unit Requests", 11, 271, 3},
+    {"Varying Unit Cycles", 11, 274, 3},
+    {"Texture Unit Requests", 12, 277, 6},
+    {"Texture Unit Quads", 12, 283, 7},
+    {"Texture Unit Cycles", 12, 290, 6},
+    {"Texture Unit Stall Cycles", 12, 296, 7},
+    {"Texture Unit Usage Rate", 12, 303, 6},
+    {"Texture Unit CPI", 12, 309, 1},
+    {"Texture Unit Utilization", 12, 310, 3},
+    {"Texture Unit Cache Cycles", 12, 313, 7},
+    {"Texture Unit Cache", 12, 320, 2},
+    {"Texture Unit Bus", 12, 322, 2},
+    {"Ray Tracing Unit Cycles", 13, 324, 4},
+    {"Ray Tracing Unit Rays", 13, 328, 5},
+    {"Ray Tracing Unit Triangle Tests", 13, 333, 4},
+    {"Ray Tracing Unit Box Tests", 13, 337, 4},
+    {"Ray Tracing Unit Workload", 13, 341, 3},
+    {"Ray Tracing Unit Instance Workload", 13, 344, 2},
+    {"Ray Tracing Unit Box Workload", 13, 346, 3},
+    {"Ray Tracing Unit Triangle Workload", 13, 349, 4},
+    {"Ray Tracing Unit Cache", 13, 353, 2},
+    {"Attribute Unit Cycles", 14, 355, 1},
+    {"Attribute Unit Requests", 14, 356, 1},
+    {"Blend Unit Cycles", 14, 357, 1},
+    {"Shader Core L2 Reads", 15, 358, 5},
+    {"Shader Core External Reads", 15, 363, 4},
+    {"Shader Core L2 Writes", 15, 367, 5},
+    {"Shader Core L2 Read Bytes", 15, 372, 3},
+    {"Shader Core External Read Bytes", 15, 375, 4},
+    {"Shader Core L2 Write Bytes", 15, 379, 3},
+    {"Load/Store Unit Bytes/Cycle", 15, 382, 3},
+    {"Texture Unit Bytes/Cycle", 15, 385, 2},
+    {"Tile Unit Bytes/Pixel", 15, 387, 1},
+    {"Tiler Stall Cycles", 16, 388, 4},
+    {"Tiler Vertex Cache", 16, 392, 4},
+    {"Tiler L2 Accesses", 16, 396, 2},
+    {"Tiler Shading Requests", 16, 398, 4},
+    {"Vertex Cache Hit Rate", 16, 402, 2},
+    {"Tiler Workload Properties", 16, 404, 1},
+    {"L2 Cache Requests", 17, 405, 7},
+    {"L2 Cache Lookups", 17, 412, 4},
+    {"L2 Cache Stall Cycles", 17, 416, 4},
+    {"L2 Cache Miss Rate", 17, 420, 2},
+    {"Stage 1 MMU Translations", 17, 422, 5},
+    {"Stage 2 MMU Translations", 17, 427, 5},
+};
+
+constexpr hwcpipe_counter counters[] = {
+    hwcpipe_counter::MaliGPUActiveCy,
+    hwcpipe_counter::MaliGPUActiveRawCy,
+    hwcpipe_counter::MaliGPUAnyQueueActiveCy,
+    hwcpipe_counter::MaliCompQueueActiveCy,
+    hwcpipe_counter::MaliNonFragQueueActiveCy,
+    hwcpipe_counter::MaliVertQueueActiveCy,
+    hwcpipe_counter::MaliFragQueueActiveCy,
+    hwcpipe_counter::MaliBinningQueueActiveCy,
+    hwcpipe_counter::MaliMainQueueActiveCy,
+    hwcpipe_counter::MaliResQueueActiveCy,
+    hwcpipe_counter::MaliTilerActiveCy,
+    hwcpipe_counter::MaliGPUIRQActiveCy,
+    hwcpipe_counter::MaliCompQueuedCy,
+    hwcpipe_counter::MaliVertQueuedCy,
+    hwcpipe_counter::MaliFragQueuedCy,
+    hwcpipe_counter::MaliBinningQueuedCy,
+    hwcpipe_counter::MaliMainQueuedCy,
+    hwcpipe_counter::MaliCompQueueDrainStallCy,
+    hwcpipe_counter::MaliCompQueueAssignStallCy,
+    hwcpipe_counter::MaliNonFragQueueWaitFlushCy,
+    hwcpipe_counter::MaliNonFragQueueWaitRdCy,
+    hwcpipe_counter::MaliNonFragQueueWaitDepCy,
+    hwcpipe_counter::MaliNonFragQueueWaitFinishCy,
+    hwcpipe_counter::MaliNonFragQueueWaitIssueCy,
+    hwcpipe_counter::MaliTilerQueueDrainStallCy,
+    hwcpipe_counter::MaliVertQueueAssignStallCy,
+    hwcpipe_counter::MaliBinningQueueAssignStallCy,
+    hwcpipe_counter::MaliFragQueueWaitFlushCy,
+    hwcpipe_counter::MaliFragQueueWaitRdCy,
+    hwcpipe_counter::MaliFragQueueAssignStallCy,
+    hwcpipe_counter::MaliFragQueueWaitDepCy,
+    hwcpipe_counter::MaliFragQueueWaitFinishCy,
+    hwcpipe_counter::MaliFragQueueWaitIssueCy,
+    hwcpipe_counter::MaliMainQueueAssignStallCy,
+    hwcpipe_counter::MaliResQueueWaitFlushCy,
+    hwcpipe_counter::MaliResQueueWaitRdCy,
+    hwcpipe_counter::MaliResQueueWaitDepCy,
+    hwcpipe_counter::MaliResQueueWaitFinishCy,
+    hwcpipe_counter::MaliResQueueWaitIssueCy,
+    hwcpipe_counter::MaliCompQueueJob,
+    hwcpipe_counter::MaliNonFragQueueJob,
+    hwcpipe_counter::MaliVertQueueJob,
+    hwcpipe_counter::MaliFragQueueJob,
+    hwcpipe_counter::MaliBinningQueueJob,
+    hwcpipe_counter::MaliMainQueueJob,
+    hwcpipe_counter::MaliResQueueJob,
+    hwcpipe_counter::MaliCompQueueTask,
+    hwcpipe_counter::MaliNonFragQueueTask,
+    hwcpipe_counter::MaliVertQueueTask,
+    hwcpipe_counter::MaliFragQueueTask,
+    hwcpipe_counter::MaliBinningQueueTask,
+    hwcpipe_counter::MaliMainQueueTask,
+    hwcpipe_counter::MaliResQueueTask,
+    hwcpipe_counter::MaliCompQueueUtil,
+    hwcpipe_counter::MaliNonFragQueueUtil,
+    hwcpipe_counter::MaliVertQueueUtil,
+    hwcpipe_counter::MaliFragQueueUtil,
+    hwcpipe_counter::MaliBinningQueueUtil,
+    hwcpipe_counter::MaliMainQueueUtil,
+    hwcpipe_counter::MaliTilerUtil,
+    hwcpipe_counter::MaliGPUIRQUtil,
+    hwcpipe_counter::MaliGPUIRQ,
+    hwcpipe_counter::MaliL2CacheFlush,
+    hwcpipe_counter::MaliL2CacheFlushCy,
+    hwcpipe_counter::MaliCSFCEUActiveCy,
+    hwcpipe_counter::MaliCSFLSUActiveCy,
+    hwcpipe_counter::MaliCSFMCUActiveCy,
+    hwcpipe_counter::MaliCSFCEUUtil,
+    hwcpipe_counter::MaliCSFLSUUtil,
+    hwcpipe_counter::MaliCSFMCUUtil,
+    hwcpipe_counter::MaliCSDoorbellIRQCy,
+    hwcpipe_counter::MaliCompQueueIRQActiveCy,
+    hwcpipe_counter::MaliVertQueueIRQActiveCy,
+    hwcpipe_counter::MaliFragQueueIRQActiveCy,
+    hwcpipe_counter::MaliBinningQueueIRQActiveCy,
+    hwcpipe_counter::MaliMainQueueIRQActiveCy,
+    hwcpipe_counter::MaliCSFCS0ActiveCy,
+    hwcpipe_counter::MaliCSFCS1ActiveCy,
+    hwcpipe_counter::MaliCSFCS2ActiveCy,
+    hwcpipe_counter::MaliCSFCS3ActiveCy,
+    hwcpipe_counter::MaliCSFCS4ActiveCy,
+    hwcpipe_counter::MaliCSFCS5ActiveCy,
+    hwcpipe_counter::MaliCS0WaitStallCy,
+    hwcpipe_counter::MaliCS1WaitStallCy,
+    hwcpipe_counter::MaliCS2WaitStallCy,
+    hwcpipe_counter::MaliCS3WaitStallCy,
+    hwcpipe_counter::MaliCS4WaitStallCy,
+    hwcpipe_counter::MaliCS5WaitStallCy,
+    hwcpipe_counter::MaliExtBusRd,
+    hwcpipe_counter::MaliExtBusWr,
+    hwcpipe_counter::MaliExtBusRdNoSnoop,
+    hwcpipe_counter::MaliExtBusRdUnique,
+    hwcpipe_counter::MaliL2CacheIncSnp,
+    hwcpipe_counter::MaliExtBusWrNoSnoopFull,
+    hwcpipe_counter::MaliExtBusWrNoSnoopPart,
+    hwcpipe_counter::MaliExtBusWrSnoopFull,
+    hwcpipe_counter::MaliExtBusWrSnoopPart,
+    hwcpipe_counter::MaliExtBusRdBt,
+    hwcpipe_counter::MaliExtBusWrBt,
+    hwcpipe_counter::MaliExtBusRdBy,
+    hwcpipe_counter::MaliExtBusWrBy,
+    hwcpipe_counter::MaliExtBusRdStallCy,
+    hwcpipe_counter::MaliExtBusWrStallCy,
+    hwcpipe_counter::MaliL2CacheIncSnpStallCy,
+    hwcpipe_counter::MaliExtBusRdStallRate,
+    hwcpipe_counter::MaliExtBusWrStallRate,
+    hwcpipe_counter::MaliExtBusRdLat0,
+    hwcpipe_counter::MaliExtBusRdLat128,
+    hwcpipe_counter::MaliExtBusRdLat192,
+    hwcpipe_counter::MaliExtBusRdLat256,
+    hwcpipe_counter::MaliExtBusRdLat320,
+    hwcpipe_counter::MaliExtBusRdLat384,
+    hwcpipe_counter::MaliExtBusRdOTQ1,
+    hwcpipe_counter::MaliExtBusRdOTQ2,
+    hwcpipe_counter::MaliExtBusRdOTQ3,
+    hwcpipe_counter::MaliExtBusRdOTQ4,
+    hwcpipe_counter::MaliExtBusWrOTQ1,
+    hwcpipe_counter::MaliExtBusWrOTQ2,
+    hwcpipe_counter::MaliExtBusWrOTQ3,
+    hwcpipe_counter::MaliExtBusWrOTQ4,
+    hwcpipe_counter::MaliGeomTotalPrim,
+    hwcpipe_counter::MaliGeomTrianglePrim,
+    hwcpipe_counter::MaliGeomLinePrim,
+    hwcpipe_counter::MaliGeomPointPrim,
+    hwcpipe_counter::MaliGeomFrontFacePrim,
+    hwcpipe_counter::MaliGeomBackFacePrim,
+    hwcpipe_counter::MaliGeomVisiblePrim,
+    hwcpipe_counter::MaliGeomTotalCullPrim,
+    hwcpipe_counter::MaliGeomFaceXYPlaneCullPrim,
+    hwcpipe_counter::MaliGeomZPlaneCullPrim,
+    hwcpipe_counter::MaliGeomFaceCullPrim,
+    hwcpipe_counter::MaliGeomPlaneCullPrim,
+    hwcpipe_counter::MaliGeomScissorCullPrim,
+    hwcpipe_counter::MaliGeomSampleCullPrim,
+    hwcpipe_counter::MaliGeomVisibleRate,
+    hwcpipe_counter::MaliGeomFaceXYPlaneCullRate,
+    hwcpipe_counter::MaliGeomZPlaneCullRate,
+    hwcpipe_counter::MaliGeomFaceCullRate,
+    hwcpipe_counter::MaliGeomPlaneCullRate,
+    hwcpipe_counter::MaliGeomScissorCullRate,
+    hwcpipe_counter::MaliGeomSampleCullRate,
+    hwcpipe_counter::MaliGeomPosShadThread,
+    hwcpipe_counter::MaliGeomVarShadThread,
+    hwcpipe_counter::MaliGeomPosShadThreadPerPrim,
+    hwcpipe_counter::MaliGeomVarShadThreadPerPrim,
+    hwcpipe_counter::MaliGPUPix,
+    hwcpipe_counter::MaliFragOverdraw,
+    hwcpipe_counter::MaliGPUCyPerPix,
+    hwcpipe_counter::MaliNonFragThroughputCy,
+    hwcpipe_counter::MaliFragThroughputCy,
+    hwcpipe_counter::MaliAnyActiveCy,
+    hwcpipe_counter::MaliCompOrBinningActiveCy,
+    hwcpipe_counter::MaliNonFragActiveCy,
+    hwcpipe_counter::MaliFragActiveCy,
+    hwcpipe_counter::MaliMainActiveCy,
+    hwcpipe_counter::MaliFragFPKActiveCy,
+    hwcpipe_counter::MaliCoreActiveCy,
+    hwcpipe_counter::MaliCompOrBinningUtil,
+    hwcpipe_counter::MaliNonFragUtil,
+    hwcpipe_counter::MaliFragUtil,
+    hwcpipe_counter::MaliMainUtil,
+    hwcpipe_counter::MaliFragFPKBUtil,
+    hwcpipe_counter::MaliCoreUtil,
+    hwcpipe_counter::MaliAnyUtil,
+    hwcpipe_counter::MaliNonFragTask,
+    hwcpipe_counter::MaliFragTile,
+    hwcpipe_counter::MaliFragTileKill,
+    hwcpipe_counter::MaliFragInputPrim,
+    hwcpipe_counter::MaliFragPrim,
+    hwcpipe_counter::MaliFragRdPrim,
+    hwcpipe_counter::MaliFragPrepassPrim,
+    hwcpipe_counter::MaliFragPrepassCullPrim,
+    hwcpipe_counter::MaliFragPrepassSkippedPrim,
+    hwcpipe_counter::MaliFragRastPrim,
+    hwcpipe_counter::MaliFragPrepassPrimRate,
+    hwcpipe_counter::MaliFragPrepassWarpRate,
+    hwcpipe_counter::MaliFragPrepassCullPrimRate,
+    hwcpipe_counter::MaliFragPrepassSkipPrimRate,
+    hwcpipe_counter::MaliFragPrepassKillRate,
+    hwcpipe_counter::MaliFragMainPassStallRate,
+    hwcpipe_counter::MaliFragRastQd,
+    hwcpipe_counter::MaliFragRastPartQd,
+    hwcpipe_counter::MaliFragRastCoarseQd,
+    hwcpipe_counter::MaliFragShadedQd,
+    hwcpipe_counter::MaliFragPrepassTestQd,
+    hwcpipe_counter::MaliFragPrepassKillQd,
+    hwcpipe_counter::MaliFragPrepassEZSUpdateQd,
+    hwcpipe_counter::MaliFragEZSTestQd,
+    hwcpipe_counter::MaliFragEZSKillQd,
+    hwcpipe_counter::MaliFragEZSUpdateQd,
+    hwcpipe_counter::MaliFragFPKKillQd,
+    hwcpipe_counter::MaliFragLZSKillQd,
+    hwcpipe_counter::MaliFragLZSTestQd,
+    hwcpipe_counter::MaliFragEZSKillRate,
+    hwcpipe_counter::MaliFragEZSTestRate,
+    hwcpipe_counter::MaliFragEZSUpdateRate,
+    hwcpipe_counter::MaliFragOpaqueQdRate,
+    hwcpipe_counter::MaliFragFPKKillRate,
+    hwcpipe_counter::MaliFragLZSKillRate,
+    hwcpipe_counter::MaliFragLZSTestRate,
+    hwcpipe_counter::MaliFragTransparentQd,
+    hwcpipe_counter::MaliFragOpaqueQd,
+    hwcpipe_counter::MaliFragShadRate,
+    hwcpipe_counter::MaliFragRastPartQdRate,
+    hwcpipe_counter::MaliFragPartWarpRate,
+    hwcpipe_counter::MaliFragTileKillRate,
+    hwcpipe_counter::MaliALUUtil,
+    hwcpipe_counter::MaliLSUtil,
+    hwcpipe_counter::MaliVarUtil,
+    hwcpipe_counter::MaliTexUtil,
+    hwcpipe_counter::MaliRTUUtil,
+    hwcpipe_counter::MaliAttrUtil,
+    hwcpipe_counter::MaliBlendUtil,
+    hwcpipe_counter::MaliEngLSBackpressureCy,
+    hwcpipe_counter::MaliEngVarBackpressureCy,
+    hwcpipe_counter::MaliEngTexBackpressureCy,
+    hwcpipe_counter::MaliEngRTUBackpressureCy,
+    hwcpipe_counter::MaliEngAttrBackpressureCy,
+    hwcpipe_counter::MaliEngZSBackpressureCy,
+    hwcpipe_counter::MaliEngBlendBackpressureCy,
+    hwcpipe_counter::MaliEngLSBackpressureRate,
+    hwcpipe_counter::MaliEngVarBackpressureRate,
+    hwcpipe_counter::MaliEngTexBackpressureRate,
+    hwcpipe_counter::MaliEngRTUBackpressureRate,
+    hwcpipe_counter::MaliEngAttrBackpressureRate,
+    hwcpipe_counter::MaliEngZSBackpressureRate,
+    hwcpipe_counter::MaliEngBlendBackpressureRate,
+    hwcpipe_counter::MaliFragMainPassStallCy,
+    hwcpipe_counter::MaliEngStarveCy,
+    hwcpipe_counter::MaliEngStarveICacheCy,
+    hwcpipe_counter::MaliNonFragWarp,
+    hwcpipe_counter::MaliDefVertWarp,
+    hwcpipe_counter::MaliFragWarp,
+    hwcpipe_counter::MaliFragPrepassWarp,
+    hwcpipe_counter::MaliCoreFullWarp,
+    hwcpipe_counter::MaliFragPartWarp,
+    hwcpipe_counter::MaliCoreAllRegsWarp,
+    hwcpipe_counter::MaliNonFragThread,
+    hwcpipe_counter::MaliFragThread,
+    hwcpipe_counter::MaliFragPrepassThread,
+    hwcpipe_counter::MaliFragMainThread,
+    hwcpipe_counter::MaliCoreFragWarpOcc,
+    hwcpipe_counter::MaliCoreFullWarpRate,
+    hwcpipe_counter::MaliCoreAllRegsWarpRate,
+    hwcpipe_counter::MaliEngDivergedInstrRate,
+    hwcpipe_counter::MaliEngNarrowInstrRate,
+    hwcpipe_counter::MaliEngSWBlendRate,
+    hwcpipe_counter::MaliALUIssueCy,
+    hwcpipe_counter::MaliEngICacheMiss,
+    hwcpipe_counter::MaliEngInstr,
+    hwcpipe_counter::MaliEngArithInstr,
+    hwcpipe_counter::MaliEngFMAInstr,
+    hwcpipe_counter::MaliEngCVTInstr,
+    hwcpipe_counter::MaliEngSFUInstr,
+    hwcpipe_counter::MaliEngDivergedInstr,
+    hwcpipe_counter::MaliEngNarrowInstr,
+    hwcpipe_counter::MaliEngSWBlendInstr,
+    hwcpipe_counter::MaliEngFMAPipeUtil,
+    hwcpipe_counter::MaliEngCVTPipeUtil,
+    hwcpipe_counter::MaliEngSFUPipeUtil,
+    hwcpipe_counter::MaliEngSlotAnyIssueCy,
+    hwcpipe_counter::MaliEngSlot0IssueCy,
+    hwcpipe_counter::MaliEngSlot1IssueCy,
+    hwcpipe_counter::MaliLSIssueCy,
+    hwcpipe_counter::MaliLSRdCy,
+    hwcpipe_counter::MaliLSFullRd,
+    hwcpipe_counter::MaliLSPartRd,
+    hwcpipe_counter::MaliLSWrCy,
+    hwcpipe_counter::MaliLSFullWr,
+    hwcpipe_counter::MaliLSPartWr,
+    hwcpipe_counter::MaliLSAtomic,
+    hwcpipe_counter::MaliVarInstr,
+    hwcpipe_counter::MaliVar16IssueSlot,
+    hwcpipe_counter::MaliVar32IssueSlot,
+    hwcpipe_counter::MaliVarIssueCy,
+    hwcpipe_counter::MaliVar16IssueCy,
+    hwcpipe_counter::MaliVar32IssueCy,
+    hwcpipe_counter::MaliTexInstr,
+    hwcpipe_counter::MaliTexSample,
+    hwcpipe_counter::MaliTex3DInstr,
+    hwcpipe_counter::MaliTexCompressInstr,
+    hwcpipe_counter::MaliTexMipInstr,
+    hwcpipe_counter::MaliTexTriInstr,
+    hwcpipe_counter::MaliTexQuads,
+    hwcpipe_counter::MaliTexQuadPass,
+    hwcpipe_counter::MaliTexQuadPassDescMiss,
+    hwcpipe_counter::MaliTexQuadPassMip,
+    hwcpipe_counter::MaliTexOutMsg,
+    hwcpipe_counter::MaliTexOutSingleMsg,
+    hwcpipe_counter::MaliTexQuadPassTri,
+    hwcpipe_counter::MaliTexClkActiveCy,
+    hwcpipe_counter::MaliTexIssueCy,
+    hwcpipe_counter::MaliTexIndexCy,
+    hwcpipe_counter::MaliTexFiltIssueCy,
+    hwcpipe_counter::MaliTexFullBiFiltCy,
+    hwcpipe_counter::MaliTexFullTriFiltCy,
+    hwcpipe_counter::MaliTexClkStarvedCy,
+    hwcpipe_counter::MaliTexCoordStallCy,
+    hwcpipe_counter::MaliTexDescStallCy,
+    hwcpipe_counter::MaliTexDataFetchStallCy,
+    hwcpipe_counter::MaliTexFiltStallCy,
+    hwcpipe_counter::MaliTexDataStallCy,
+    hwcpipe_counter::MaliTexPartDataStallCy,
+    hwcpipe_counter::MaliTexFiltFullRate,
+    hwcpipe_counter::MaliTex3DInstrRate,
+    hwcpipe_counter::MaliTexCacheCompressFetchRate,
+    hwcpipe_counter::MaliTexCompressInstrRate,
+    hwcpipe_counter::MaliTexMipInstrRate,
+    hwcpipe_counter::MaliTexTriInstrRate,
+    hwcpipe_counter::MaliTexCPI,
+    hwcpipe_counter::MaliTexCacheUtil,
+    hwcpipe_counter::MaliTexInBusUtil,
+    hwcpipe_counter::MaliTexOutBusUtil,
+    hwcpipe_counter::MaliTexCacheLookup,
+    hwcpipe_counter::MaliTexCacheLookupCy,
+    hwcpipe_counter::MaliTexL1CacheLoadCy,
+    hwcpipe_counter::MaliTexL1CacheLookupCy,
+    hwcpipe_counter::MaliTexL1CacheOutputCy,
+    hwcpipe_counter::MaliTexCacheSimpleLoadCy,
+    hwcpipe_counter::MaliTexCacheComplexLoadCy,
+    hwcpipe_counter::MaliTexCacheFetch,
+    hwcpipe_counter::MaliTexCacheCompressFetch,
+    hwcpipe_counter::MaliTexInBt,
+    hwcpipe_counter::MaliTexOutBt,
+    hwcpipe_counter::MaliRTUActiveCy,
+    hwcpipe_counter::MaliRTUIssueCy,
+    hwcpipe_counter::MaliRTUBoxIssueCy,
+    hwcpipe_counter::MaliRTUTriIssueCy,
+    hwcpipe_counter::MaliRTURay,
+    hwcpipe_counter::MaliRTUResumeTraceRays,
+    hwcpipe_counter::MaliRTUFirstHitTerm,
+    hwcpipe_counter::MaliRTUStackOverflows,
+    hwcpipe_counter::MaliRTUMiss,
+    hwcpipe_counter::MaliRTUTriBin1,
+    hwcpipe_counter::MaliRTUTriBin5,
+    hwcpipe_counter::MaliRTUTriBin9,
+    hwcpipe_counter::MaliRTUTriBin13,
+    hwcpipe_counter::MaliRTUBoxBin1,
+    hwcpipe_counter::MaliRTUBoxBin5,
+    hwcpipe_counter::MaliRTUBoxBin9,
+    hwcpipe_counter::MaliRTUBoxBin13,
+    hwcpipe_counter::MaliRTUNewTraceInstr,
+    hwcpipe_counter::MaliRTUResumeTraceInstr,
+    hwcpipe_counter::MaliRTUPrimCull,
+    hwcpipe_counter::MaliRTUBLASIssue,
+    hwcpipe_counter::MaliRTUBLASCull,
+    hwcpipe_counter::MaliRTUBox,
+    hwcpipe_counter::MaliRTUBoxIssue,
+    hwcpipe_counter::MaliRTUTLASBoxIssue,
+    hwcpipe_counter::MaliRTUTriCull,
+    hwcpipe_counter::MaliRTUOpaqueHit,
+    hwcpipe_counter::MaliRTUNonOpaqueHit,
+    hwcpipe_counter::MaliRTUTri,
+    hwcpipe_counter::MaliRTUCacheHit,
+    hwcpipe_counter::MaliRTUCacheMiss,
+    hwcpipe_counter::MaliAttrIssueCy,
+    hwcpipe_counter::MaliAttrInstr,
+    hwcpipe_counter::MaliBlendIssueCy,
+    hwcpipe_counter::MaliSCBusFFEL2RdBt,
+    hwcpipe_counter::MaliSCBusLSL2RdBt,
+    hwcpipe_counter::MaliSCBusTexL2RdBt,
+    hwcpipe_counter::MaliSCBusRTUL2RdBt,
+    hwcpipe_counter::MaliSCBusOtherL2RdBt,
+    hwcpipe_counter::MaliSCBusFFEExtRdBt,
+    hwcpipe_counter::MaliSCBusLSExtRdBt,
+    hwcpipe_counter::MaliSCBusTexExtRdBt,
+    hwcpipe_counter::MaliSCBusRTUExtRdBt,
+    hwcpipe_counter::MaliSCBusLSWrBt,
+    hwcpipe_counter::MaliSCBusLSWBWrBt,
+    hwcpipe_counter::MaliSCBusLSOtherWrBt,
+    hwcpipe_counter::MaliSCBusTileWrBt,
+    hwcpipe_counter::MaliSCBusOtherWrBt,
+    hwcpipe_counter::MaliSCBusFFEL2RdBy,
+    hwcpipe_counter::MaliSCBusLSL2RdBy,
+    hwcpipe_counter::MaliSCBusTexL2RdBy,
+    hwcpipe_counter::MaliSCBusFFEExtRdBy,
+    hwcpipe_counter::MaliSCBusLSExtRdBy,
+    hwcpipe_counter::MaliSCBusTexExtRdBy,
+    hwcpipe_counter::MaliSCBusRTUExtRdBy,
+    hwcpipe_counter::MaliSCBusLSWrBy,
+    hwcpipe_counter::MaliSCBusTileWrBy,
+    hwcpipe_counter::MaliSCBusOtherWrBy,
+    hwcpipe_counter::MaliSCBusLSL2RdByPerRd,
+    hwcpipe_counter::MaliSCBusLSWrByPerWr,
+    hwcpipe_counter::MaliSCBusLSExtRdByPerRd,
+    hwcpipe_counter::MaliSCBusTexL2RdByPerRd,
+    hwcpipe_counter::MaliSCBusTexExtRdByPerRd,
+    hwcpipe_counter::MaliSCBusTileWrBPerPx,
+    hwcpipe_counter::MaliTilerPosShadFIFOFullCy,
+    hwcpipe_counter::MaliTilerPosShadStallCy,
+    hwcpipe_counter::MaliTilerPrimAsPosShadStallCy,
+    hwcpipe_counter::MaliTilerVarShadStallCy,
+    hwcpipe_counter::MaliTilerPosCacheHit,
+    hwcpipe_counter::MaliTilerPosCacheMiss,
+    hwcpipe_counter::MaliTilerVarCacheHit,
+    hwcpipe_counter::MaliTilerVarCacheMiss,
+    hwcpipe_counter::MaliTilerRdBt,
+    hwcpipe_counter::MaliTilerWrBt,
+    hwcpipe_counter::MaliGeomPosShadTask,
+    hwcpipe_counter::MaliGeomVarShadTask,
+    hwcpipe_counter::MaliGeomPosShadPartTask,
+    hwcpipe_counter::MaliGeomVarShadPartTask,
+    hwcpipe_counter::MaliTilerPosCacheHitRate,
+    hwcpipe_counter::MaliTilerVarCacheHitRate,
+    hwcpipe_counter::MaliGeomVisibleDVSPrim,
+    hwcpipe_counter::MaliL2CacheRd,
+    hwcpipe_counter::MaliL2CacheWr,
+    hwcpipe_counter::MaliL2CacheSnp,
+    hwcpipe_counter::MaliL2CacheCleanUnique,
+    hwcpipe_counter::MaliL2CacheEvict,
+    hwcpipe_counter::MaliL2CacheL1Rd,
+    hwcpipe_counter::MaliL2CacheL1Wr,
+    hwcpipe_counter::MaliL2CacheLookup,
+    hwcpipe_counter::MaliL2CacheRdLookup,
+    hwcpipe_counter::MaliL2CacheWrLookup,
+    hwcpipe_counter::MaliL2CacheSnpLookup,
+    hwcpipe_counter::MaliL2CacheRdStallCy,
+    hwcpipe_counter::MaliL2CacheWrStallCy,
+    hwcpipe_counter::MaliL2CacheSnpStallCy,
+    hwcpipe_counter::MaliL2CacheL1RdStallCy,
+    hwcpipe_counter::MaliL2CacheRdMissRate,
+    hwcpipe_counter::MaliL2CacheWrMissRate,
+    hwcpipe_counter::MaliMMULookup,
+    hwcpipe_counter::MaliMMUL2Rd,
+    hwcpipe_counter::MaliMMUL2Hit,
+    hwcpipe_counter::MaliMMUL3Rd,
+    hwcpipe_counter::MaliMMUL3Hit,
+    hwcpipe_counter::MaliMMUS2Lookup,
+    hwcpipe_counter::MaliMMUS2L2Rd,
+    hwcpipe_counter::MaliMMUS2L2Hit,
+    hwcpipe_counter::MaliMMUS2L3Rd,
+    hwcpipe_counter::MaliMMUS2L3Hit,
+};
+
+} // namespace
+
+const counter_hierarchy &get_counter_hierarchy() {
+    static const counter_hierarchy hierarchy{
+        sections, sizeof(sections) / sizeof(sections[0]),
+        groups,   sizeof(groups) / sizeof(groups[0]),
+        counters, sizeof(counters) / sizeof(counters[0])};
+    return hierarchy;
+}
+
+} // namespace hwcpipe
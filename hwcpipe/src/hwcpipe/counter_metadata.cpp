@@ -8,443 +8,1411 @@
 
 namespace hwcpipe {
 namespace database {
+namespace {
 
-    constexpr std::array<counter_metadata, 433> all_counter_metadata {
-        counter_metadata {"Arithmetic unit issue cycles", "cycles"},
-        counter_metadata {"Arithmetic unit utilization", "percent"},
-        counter_metadata {"Attribute instructions", "instructions"},
-        counter_metadata {"Execution core active cycles", "cycles"},
-        counter_metadata {"Execution core utilization", "percent"},
-        counter_metadata {"Diverged instructions", "instructions"},
-        counter_metadata {"Warp divergence percentage", "percent"},
-        counter_metadata {"Arithmetic instruction issue cycles", "instructions"},
-        counter_metadata {"Execution engine starvation cycles", "cycles"},
-        counter_metadata {"Output external read transactions", "transactions"},
-        counter_metadata {"Output external read beats", "beats"},
-        counter_metadata {"Output external read bytes", "bytes"},
-        counter_metadata {"Output external read latency 0-127 cycles", "beats"},
-        counter_metadata {"Output external read latency 128-191 cycles", "beats"},
-        counter_metadata {"Output external read latency 192-255 cycles", "beats"},
-        counter_metadata {"Output external read latency 256-319 cycles", "beats"},
-        counter_metadata {"Output external read latency 320-383 cycles", "beats"},
-        counter_metadata {"Output external read latency 384+ cycles", "beats"},
-        counter_metadata {"Output external ReadNoSnoop transactions", "transactions"},
-        counter_metadata {"Output external outstanding reads 0-25%", "transactions"},
-        counter_metadata {"Output external outstanding reads 25-50%", "transactions"},
-        counter_metadata {"Output external outstanding reads 50-75%", "transactions"},
-        counter_metadata {"Output external outstanding reads 75-100%", "transactions"},
-        counter_metadata {"Output external read stall cycles", "cycles"},
-        counter_metadata {"Output external read stall percentage", "percent"},
-        counter_metadata {"Output external ReadUnique transactions", "transactions"},
-        counter_metadata {"Output external write transactions", "transactions"},
-        counter_metadata {"Output external write beats", "beats"},
-        counter_metadata {"Output external write bytes", "bytes"},
-        counter_metadata {"Output external WriteNoSnoopFull transactions", "transactions"},
-        counter_metadata {"Output external WriteNoSnoopPartial transactions", "transactions"},
-        counter_metadata {"Output external outstanding writes 0-25%", "transactions"},
-        counter_metadata {"Output external outstanding writes 25-50%", "transactions"},
-        counter_metadata {"Output external outstanding writes 50-75%", "transactions"},
-        counter_metadata {"Output external outstanding writes 75-100%", "transactions"},
-        counter_metadata {"Output external WriteSnoopFull transactions", "transactions"},
-        counter_metadata {"Output external WriteSnoopPartial transactions", "transactions"},
-        counter_metadata {"Output external write stall cycles", "cycles"},
-        counter_metadata {"Output external write stall percentage", "percent"},
-        counter_metadata {"Fragment active cycles", "cycles"},
-        counter_metadata {"Early ZS killed quads", "quads"},
-        counter_metadata {"Early ZS killed quad percentage", "percent"},
-        counter_metadata {"Early ZS tested quads", "quads"},
-        counter_metadata {"Early ZS tested quad percentage", "percent"},
-        counter_metadata {"Early ZS updated quads", "quads"},
-        counter_metadata {"Early ZS updated quad percentage", "percent"},
-        counter_metadata {"Fragment pre-pipe buffer active cycles", "cycles"},
-        counter_metadata {"Fragment pre-pipe buffer utilization", "percent"},
-        counter_metadata {"FPK HSR killed quads", "quads"},
-        counter_metadata {"FPK HSR killed quad percentage", "percent"},
-        counter_metadata {"Late ZS killed quads", "quads"},
-        counter_metadata {"Late ZS killed quad percentage", "percent"},
-        counter_metadata {"Late ZS tested quads", "quads"},
-        counter_metadata {"Late ZS tested quad percentage", "percent"},
-        counter_metadata {"Occluding quads", "quads"},
-        counter_metadata {"Occluding quad percentage", "percent"},
-        counter_metadata {"Fragments per pixel", "threads"},
-        counter_metadata {"Partial fragment warps", "warps"},
-        counter_metadata {"Partial coverage percentage", "percent"},
-        counter_metadata {"Fragment queue active cycles", "cycles"},
-        counter_metadata {"Fragment jobs", "jobs"},
-        counter_metadata {"Fragment tasks", "tasks"},
-        counter_metadata {"Fragment queue utilization", "percent"},
-        counter_metadata {"Fragment queue job dependency wait cycles", "cycles"},
-        counter_metadata {"Fragment queue job finish wait cycles", "cycles"},
-        counter_metadata {"Fragment queue cache flush wait cycles", "cycles"},
-        counter_metadata {"Fragment queue job issue wait cycles", "cycles"},
-        counter_metadata {"Fragment queue job descriptor read wait cycles", "cycles"},
-        counter_metadata {"Rasterized primitives", "primitives"},
-        counter_metadata {"Rasterized fine quads", "quads"},
-        counter_metadata {"Fragment primitives loaded", "primitives"},
-        counter_metadata {"Shaded coarse quads", "quads"},
-        counter_metadata {"Fragment threads", "threads"},
-        counter_metadata {"Average cycles per fragment thread", "cycles"},
-        counter_metadata {"Tiles", "tiles"},
-        counter_metadata {"Killed unchanged tiles", "tiles"},
-        counter_metadata {"Unchanged tile kill percentage", "percent"},
-        counter_metadata {"Non-occluding quads", "quads"},
-        counter_metadata {"Fragment utilization", "percent"},
-        counter_metadata {"Fragment warps", "warps"},
-        counter_metadata {"GPU active cycles", "cycles"},
-        counter_metadata {"Average cycles per pixel", "cycles"},
-        counter_metadata {"GPU interrupt pending cycles", "cycles"},
-        counter_metadata {"Interrupt pending utilization", "percent"},
-        counter_metadata {"Pixels", "pixels"},
-        counter_metadata {"Visible back-facing primitives", "primitives"},
-        counter_metadata {"Facing or XY plane test culled primitives", "primitives"},
-        counter_metadata {"Facing or XY plane test cull percentage", "percent"},
-        counter_metadata {"Visible front-facing primitives", "primitives"},
-        counter_metadata {"Line primitives", "primitives"},
-        counter_metadata {"Point primitives", "primitives"},
-        counter_metadata {"Tiler position shading requests", "requests"},
-        counter_metadata {"Position shader thread invocations", "threads"},
-        counter_metadata {"Position threads per input primitive", "threads"},
-        counter_metadata {"Sample test culled primitives", "primitives"},
-        counter_metadata {"Sample test cull percentage", "percent"},
-        counter_metadata {"Culled primitives", "primitives"},
-        counter_metadata {"Total input primitives", "primitives"},
-        counter_metadata {"Triangle primitives", "primitives"},
-        counter_metadata {"Tiler varying shading requests", "requests"},
-        counter_metadata {"Varying shader thread invocations", "threads"},
-        counter_metadata {"Varying threads per input primitive", "threads"},
-        counter_metadata {"Visible primitives", "primitives"},
-        counter_metadata {"Visible primitive percentage", "percent"},
-        counter_metadata {"Z plane culled primitives", "primitives"},
-        counter_metadata {"Z plane test cull percentage", "percent"},
-        counter_metadata {"L2 cache flush requests", "requests"},
-        counter_metadata {"Input external snoop transactions", "transactions"},
-        counter_metadata {"Input external snoop stall cycles", "cycles"},
-        counter_metadata {"Output internal read requests", "requests"},
-        counter_metadata {"Output internal read stall cycles", "cycles"},
-        counter_metadata {"Output internal write requests", "requests"},
-        counter_metadata {"Any lookup requests", "requests"},
-        counter_metadata {"Input internal read requests", "requests"},
-        counter_metadata {"Read lookup requests", "requests"},
-        counter_metadata {"L2 cache read miss percentage", "percent"},
-        counter_metadata {"Input internal read stall cycles", "cycles"},
-        counter_metadata {"Input internal snoop requests", "requests"},
-        counter_metadata {"Input external snoop lookup requests", "requests"},
-        counter_metadata {"Input internal snoop stall cycles", "cycles"},
-        counter_metadata {"Input internal write requests", "requests"},
-        counter_metadata {"Write lookup requests", "requests"},
-        counter_metadata {"L2 cache write miss percentage", "percent"},
-        counter_metadata {"Input internal write stall cycles", "cycles"},
-        counter_metadata {"Load/store unit atomic issues", "cycles"},
-        counter_metadata {"Load/store unit full read issues", "cycles"},
-        counter_metadata {"Load/store unit full write issues", "cycles"},
-        counter_metadata {"Load/store unit issue cycles", "cycles"},
-        counter_metadata {"Load/store unit partial read issues", "cycles"},
-        counter_metadata {"Load/store unit partial write issues", "cycles"},
-        counter_metadata {"Load/store unit read issues", "cycles"},
-        counter_metadata {"Load/store unit utilization", "percent"},
-        counter_metadata {"Load/store unit write issues", "cycles"},
-        counter_metadata {"MMU L2 lookup TLB hits", "requests"},
-        counter_metadata {"MMU L2 table read requests", "requests"},
-        counter_metadata {"MMU L3 lookup TLB hits", "requests"},
-        counter_metadata {"MMU L3 table read requests", "requests"},
-        counter_metadata {"MMU lookup requests", "requests"},
-        counter_metadata {"MMU stage 2 L2 lookup TLB hits", "requests"},
-        counter_metadata {"MMU stage 2 L2 lookup requests", "requests"},
-        counter_metadata {"MMU stage 2 L3 lookup TLB hits", "requests"},
-        counter_metadata {"MMU stage 2 L3 lookup requests", "requests"},
-        counter_metadata {"MMU stage 2 lookup requests", "requests"},
-        counter_metadata {"Non-fragment active cycles", "cycles"},
-        counter_metadata {"Non-fragment queue active cycles", "cycles"},
-        counter_metadata {"Non-fragment jobs", "jobs"},
-        counter_metadata {"Non-fragment tasks", "tasks"},
-        counter_metadata {"Non-fragment queue utilization", "percent"},
-        counter_metadata {"Non-fragment queue job dependency wait cycles", "cycles"},
-        counter_metadata {"Non-fragment queue job finish wait cycles", "cycles"},
-        counter_metadata {"Non-fragment queue cache flush wait cycles", "cycles"},
-        counter_metadata {"Non-fragment queue job issue wait cycles", "cycles"},
-        counter_metadata {"Non-fragment queue job descriptor read wait cycles", "cycles"},
-        counter_metadata {"Non-fragment core tasks", "tasks"},
-        counter_metadata {"Non-fragment threads", "threads"},
-        counter_metadata {"Average cycles per non-fragment thread", "cycles"},
-        counter_metadata {"Non-fragment utilization", "percent"},
-        counter_metadata {"Non-fragment warps", "warps"},
-        counter_metadata {"Reserved active cycles", "cycles"},
-        counter_metadata {"Reserved queue jobs", "jobs"},
-        counter_metadata {"Reserved queue tasks", "tasks"},
-        counter_metadata {"Reserved queue job dependency wait cycles", "cycles"},
-        counter_metadata {"Reserved queue job finish wait cycles", "cycles"},
-        counter_metadata {"Reserved queue cache flush wait cycles", "cycles"},
-        counter_metadata {"Reserved queue job issue wait cycles", "cycles"},
-        counter_metadata {"Reserved queue job descriptor read wait cycles", "cycles"},
-        counter_metadata {"Fragment front-end read beats from external memory", "beats"},
-        counter_metadata {"Fragment front-end read bytes from external memory", "bytes"},
-        counter_metadata {"Fragment front-end read beats from L2 cache", "beats"},
-        counter_metadata {"Fragment front-end read bytes from L2 cache", "bytes"},
-        counter_metadata {"Load/store unit read beats from external memory", "beats"},
-        counter_metadata {"Load/store unit read bytes from external memory", "bytes"},
-        counter_metadata {"Load/store unit bytes read from external memory per access cycle", "bytes"},
-        counter_metadata {"Load/store unit read beats from L2 cache", "beats"},
-        counter_metadata {"Load/store unit read bytes from L2 cache", "bytes"},
-        counter_metadata {"Load/store unit bytes read from L2 per access cycle", "bytes"},
-        counter_metadata {"Load/store unit other write beats to L2 memory system", "beats"},
-        counter_metadata {"Load/store unit write-back write beats to L2 memory system", "beats"},
-        counter_metadata {"Load/store unit write beats to L2 memory system", "beats"},
-        counter_metadata {"Load/store unit write bytes to L2 memory system", "bytes"},
-        counter_metadata {"Load/store unit bytes written to L2 per access cycle", "bytes"},
-        counter_metadata {"Miscellaneous read beats from L2 cache", "beats"},
-        counter_metadata {"Texture unit read beats from external memory", "beats"},
-        counter_metadata {"Texture unit read bytes from external memory", "bytes"},
-        counter_metadata {"Texture unit bytes read from external memory per texture cycle", "bytes"},
-        counter_metadata {"Texture unit read beats from L2 cache", "beats"},
-        counter_metadata {"Texture unit read bytes from L2 cache", "bytes"},
-        counter_metadata {"Texture unit bytes read from L2 per texture cycle", "bytes"},
-        counter_metadata {"Tile unit bytes written to L2 per pixel", "bytes"},
-        counter_metadata {"Tile unit write beats to L2 memory system", "beats"},
-        counter_metadata {"Tile unit write bytes to L2 memory system", "bytes"},
-        counter_metadata {"Texture filtering cycles per instruction", "cycles"},
-        counter_metadata {"Compressed texture line fetch requests", "issues"},
-        counter_metadata {"Texture data fetches from compressed lines", "percent"},
-        counter_metadata {"Texture line fetch requests", "issues"},
-        counter_metadata {"Texture cache lookup requests", "requests"},
-        counter_metadata {"Texture unit cache utilization", "percent"},
-        counter_metadata {"Texture filtering cycles", "cycles"},
-        counter_metadata {"Texture unit issue cycles", "cycles"},
-        counter_metadata {"Texture accesses using mipmapping percentage", "percent"},
-        counter_metadata {"Texture quad issues", "issues"},
-        counter_metadata {"Texture quad descriptor misses", "requests"},
-        counter_metadata {"Mipmapped texture quad issues", "issues"},
-        counter_metadata {"Trilinear filtered texture quad issues", "issues"},
-        counter_metadata {"Texture quads", "quads"},
-        counter_metadata {"Texture samples", "requests"},
-        counter_metadata {"Texture accesses using trilinear filter percentage", "percent"},
-        counter_metadata {"Texture unit utilization", "percent"},
-        counter_metadata {"Tiler active cycles", "cycles"},
-        counter_metadata {"Position cache hit requests", "requests"},
-        counter_metadata {"Position cache hit percentage", "percent"},
-        counter_metadata {"Position cache miss requests", "requests"},
-        counter_metadata {"Tiler position FIFO full cycles", "cycles"},
-        counter_metadata {"Tiler position shading stall cycles", "cycles"},
-        counter_metadata {"Output internal read beats", "beats"},
-        counter_metadata {"Tiler utilization", "percent"},
-        counter_metadata {"Varying cache hits", "requests"},
-        counter_metadata {"Varying cache hit percentage", "percent"},
-        counter_metadata {"Varying cache misses", "requests"},
-        counter_metadata {"Tiler varying shading stall cycles", "cycles"},
-        counter_metadata {"Internal write beats", "beats"},
-        counter_metadata {"16-bit interpolation issue cycles", "cycles"},
-        counter_metadata {"16-bit interpolation slots", "issues"},
-        counter_metadata {"32-bit interpolation issue cycles", "cycles"},
-        counter_metadata {"32-bit interpolation slots", "issues"},
-        counter_metadata {"Varying unit instructions", "requests"},
-        counter_metadata {"Varying unit issue cycles", "cycles"},
-        counter_metadata {"Varying unit utilization", "percent"},
-        counter_metadata {"Warps using more than 32 registers", "warps"},
-        counter_metadata {"All registers warp percentage", "percent"},
-        counter_metadata {"Full warps", "warps"},
-        counter_metadata {"Full warp percentage", "percent"},
-        counter_metadata {"Miscellaneous write beats to L2 memory system", "beats"},
-        counter_metadata {"Other unit write bytes to L2 memory system", "bytes"},
-        counter_metadata {"3D texture instructions", "requests"},
-        counter_metadata {"Texture samples using 3D texture percentage", "percent"},
-        counter_metadata {"Compressed texture instructions", "requests"},
-        counter_metadata {"Texture samples using compressed texture percentage", "percent"},
-        counter_metadata {"Texture filtering coordinate stall cycles", "cycles"},
-        counter_metadata {"Texture line fill stall cycles", "cycles"},
-        counter_metadata {"Texture instructions", "requests"},
-        counter_metadata {"Mipmapped texture instructions", "requests"},
-        counter_metadata {"Texture filtering partial data stall cycles", "cycles"},
-        counter_metadata {"Trilinear filtered texture instructions", "requests"},
-        counter_metadata {"Arithmetic instruction issue cycles", "instructions"},
-        counter_metadata {"Arithmetic CVT pipe instructions", "instructions"},
-        counter_metadata {"CVT pipe utilization", "percent"},
-        counter_metadata {"Arithmetic FMA pipe instructions", "instructions"},
-        counter_metadata {"FMA pipe utilization", "percent"},
-        counter_metadata {"Instruction cache misses", "requests"},
-        counter_metadata {"Arithmetic SFU pipe instructions", "instructions"},
-        counter_metadata {"SFU pipe utilization", "percent"},
-        counter_metadata {"Blend shader instructions", "instructions"},
-        counter_metadata {"Shader blend percentage", "percent"},
-        counter_metadata {"Partial rasterized fine quads", "quads"},
-        counter_metadata {"Partial coverage percentage", "percent"},
-        counter_metadata {"Texture fetch stall cycles", "cycles"},
-        counter_metadata {"Texture descriptor stall cycles", "cycles"},
-        counter_metadata {"Texture full speed filtering percentage", "percent"},
-        counter_metadata {"Texture filtering stall cycles", "cycles"},
-        counter_metadata {"Texture filtering cycles using full bilinear", "cycles"},
-        counter_metadata {"Texture filtering cycles using full trilinear", "cycles"},
-        counter_metadata {"Texture message read beats", "beats"},
-        counter_metadata {"Texture input bus utilization", "percent"},
-        counter_metadata {"Texture message write beats", "beats"},
-        counter_metadata {"Texture output bus utilization", "percent"},
-        counter_metadata {"Texture messages", "issues"},
-        counter_metadata {"Any workload active cycles", "cycles"},
-        counter_metadata {"Shader core clock ratio", "percent"},
-        counter_metadata {"Command stream 0 wait stall cycles", "cycles"},
-        counter_metadata {"Command stream 1 wait stall cycles", "cycles"},
-        counter_metadata {"Command stream 2 wait stall cycles", "cycles"},
-        counter_metadata {"Command stream 3 wait stall cycles", "cycles"},
-        counter_metadata {"Command execution unit active cycles", "cycles"},
-        counter_metadata {"Command execution unit utilization", "percent"},
-        counter_metadata {"Command stream 0 active cycles", "cycles"},
-        counter_metadata {"Command stream 1 active cycles", "cycles"},
-        counter_metadata {"Command stream 2 active cycles", "cycles"},
-        counter_metadata {"Command stream 3 active cycles", "cycles"},
-        counter_metadata {"Command load/store unit active cycles", "cycles"},
-        counter_metadata {"Command load/store unit utilization", "percent"},
-        counter_metadata {"MCU active cycles", "cycles"},
-        counter_metadata {"Microcontroller utilization", "percent"},
-        counter_metadata {"Compute queue active cycles", "cycles"},
-        counter_metadata {"Compute queue endpoint stall cycles", "cycles"},
-        counter_metadata {"Compute queue endpoint drain stall cycles", "cycles"},
-        counter_metadata {"Compute queue interrupt pending cycles", "cycles"},
-        counter_metadata {"Compute jobs", "jobs"},
-        counter_metadata {"Compute tasks", "tasks"},
-        counter_metadata {"Compute queue utilization", "percent"},
-        counter_metadata {"Compute work queued cycles", "cycles"},
-        counter_metadata {"Fragment queue endpoint stall cycles", "cycles"},
-        counter_metadata {"Fragment queue interrupt pending cycles", "cycles"},
-        counter_metadata {"Fragment work queued cycles", "cycles"},
-        counter_metadata {"Any queue active cycles", "cycles"},
-        counter_metadata {"GPU interrupts", "interrupts"},
-        counter_metadata {"Input internal clean unique requests", "requests"},
-        counter_metadata {"Input internal evict requests", "requests"},
-        counter_metadata {"L2 cache flush cycles", "cycles"},
-        counter_metadata {"Vertex queue endpoint drain stall cycles", "cycles"},
-        counter_metadata {"Vertex queue active cycles", "cycles"},
-        counter_metadata {"Vertex queue endpoint stall cycles", "cycles"},
-        counter_metadata {"Vertex queue interrupt pending cycles", "cycles"},
-        counter_metadata {"Vertex jobs", "jobs"},
-        counter_metadata {"Vertex tasks", "tasks"},
-        counter_metadata {"Vertex queue utilization", "percent"},
-        counter_metadata {"Vertex work queued cycles", "cycles"},
-        counter_metadata {"Fragment warp occupancy", "percent"},
-        counter_metadata {"Narrow arithmetic instructions", "instructions"},
-        counter_metadata {"Narrow arithmetic percentage", "percent"},
-        counter_metadata {"Rasterized coarse quads", "quads"},
-        counter_metadata {"Fragment shading rate", "percent"},
-        counter_metadata {"GPU active raw cycles", "cycles"},
-        counter_metadata {"Facing test culled primitives", "primitives"},
-        counter_metadata {"Facing plane test cull percentage", "percent"},
-        counter_metadata {"Frustum test culled primitives", "primitives"},
-        counter_metadata {"Frustum test cull percentage", "percent"},
-        counter_metadata {"Ray tracing box tests", "boxes"},
-        counter_metadata {"Ray tracing box nodes with 1-4 rays", "nodes"},
-        counter_metadata {"Ray tracing box nodes with 13-16 rays", "nodes"},
-        counter_metadata {"Ray tracing box nodes with 5-8 rays", "nodes"},
-        counter_metadata {"Ray tracing box nodes with 9-12 rays", "nodes"},
-        counter_metadata {"Ray tracing box tester issue cycles", "cycles"},
-        counter_metadata {"Ray tracing first hit terminations", "rays"},
-        counter_metadata {"Ray tracing unit issue cycles", "cycles"},
-        counter_metadata {"Ray tracing triangle test misses", "rays"},
-        counter_metadata {"Ray tracing non-opaque triangle hits", "tests"},
-        counter_metadata {"Ray tracing opaque triangle hits", "tests"},
-        counter_metadata {"Ray tracing started rays", "rays"},
-        counter_metadata {"Ray tracing triangle nodes tested", "nodes"},
-        counter_metadata {"Ray tracing triangle nodes with 1-4 rays", "nodes"},
-        counter_metadata {"Ray tracing triangle nodes with 13-16 rays", "nodes"},
-        counter_metadata {"Ray tracing triangle nodes with 5-8 rays", "nodes"},
-        counter_metadata {"Ray tracing triangle nodes with 9-12 rays", "nodes"},
-        counter_metadata {"Ray tracing triangle tester issue cycles", "cycles"},
-        counter_metadata {"Ray tracing unit utilization", "percent"},
-        counter_metadata {"Binning phase queue active cycles", "cycles"},
-        counter_metadata {"Binning phase queue endpoint stall cycles", "cycles"},
-        counter_metadata {"Binning phase queue interrupt pending cycles", "cycles"},
-        counter_metadata {"Binning phase jobs", "jobs"},
-        counter_metadata {"Binning phase tasks", "tasks"},
-        counter_metadata {"Binning phase queue utilization", "percent"},
-        counter_metadata {"Binning phase work queued cycles", "cycles"},
-        counter_metadata {"Compute or binning phase active cycles", "cycles"},
-        counter_metadata {"Compute or binning phase utilization", "percent"},
-        counter_metadata {"Scissor test culled primitives", "primitives"},
-        counter_metadata {"Scissor test cull percentage", "percent"},
-        counter_metadata {"Visible primitives using DVS", "primitives"},
-        counter_metadata {"Main phase active cycles", "cycles"},
-        counter_metadata {"Main phase queue active cycles", "cycles"},
-        counter_metadata {"Main phase queue endpoint stall cycles", "cycles"},
-        counter_metadata {"Main phase queue interrupt pending cycles", "cycles"},
-        counter_metadata {"Main phase jobs", "jobs"},
-        counter_metadata {"Main phase tasks", "tasks"},
-        counter_metadata {"Main phase queue utilization", "percent"},
-        counter_metadata {"Main phase work queued cycles", "cycles"},
-        counter_metadata {"Main phase utilization", "percent"},
-        counter_metadata {"Complex texture load cycles", "cycles"},
-        counter_metadata {"Texture cache lookup cycles", "cycles"},
-        counter_metadata {"Simple texture load cycles", "cycles"},
-        counter_metadata {"Texture unit clock active cycles", "cycles"},
-        counter_metadata {"Texture causing starvation cycles", "cycles"},
-        counter_metadata {"Texture index calculation cycles", "cycles"},
-        counter_metadata {"L1 texture cache load cycles", "cycles"},
-        counter_metadata {"L1 texture cache lookup cycles", "cycles"},
-        counter_metadata {"L1 texture cache output cycles", "cycles"},
-        counter_metadata {"Texture messages with single quad", "issues"},
-        counter_metadata {"Primitive assembly position shading stall cycles", "cycles"},
-        counter_metadata {"Command stream 4 wait stall cycles", "cycles"},
-        counter_metadata {"Command stream 5 wait stall cycles", "cycles"},
-        counter_metadata {"Command stream doorbell interrupt pending cycles", "cycles"},
-        counter_metadata {"Command stream 4 active cycles", "cycles"},
-        counter_metadata {"Command stream 5 active cycles", "cycles"},
-        counter_metadata {"Deferred vertex warps", "warps"},
-        counter_metadata {"Attribute unit backpressure cycles", "cycles"},
-        counter_metadata {"Attribute unit backpressure percentage", "percent"},
-        counter_metadata {"Blend unit backpressure cycles", "cycles"},
-        counter_metadata {"Blend unit backpressure percentage", "percent"},
-        counter_metadata {"Load/store unit backpressure cycles", "cycles"},
-        counter_metadata {"Load/store unit backpressure percentage", "percent"},
-        counter_metadata {"Slot 0 arithmetic issue cycles", "cycles"},
-        counter_metadata {"Slot 1 arithmetic issue cycles", "cycles"},
-        counter_metadata {"Any slot arithmetic issue cycles", "cycles"},
-        counter_metadata {"Texture unit backpressure cycles", "cycles"},
-        counter_metadata {"Texture unit backpressure percentage", "percent"},
-        counter_metadata {"Varying unit backpressure cycles", "cycles"},
-        counter_metadata {"Varying unit backpressure percentage", "percent"},
-        counter_metadata {"ZS unit backpressure cycles", "cycles"},
-        counter_metadata {"ZS unit backpressure percentage", "percent"},
-        counter_metadata {"Input fragment primitives", "primitives"},
-        counter_metadata {"Fragment main pass stall cycles", "cycles"},
-        counter_metadata {"Fragment main pass stall percentage", "percent"},
-        counter_metadata {"Fragment main pass threads", "threads"},
-        counter_metadata {"Fragment prepass culled primitives", "primitives"},
-        counter_metadata {"Fragment prepass primitive culling percentage", "percent"},
-        counter_metadata {"Fragment prepass early ZS updated quads", "quads"},
-        counter_metadata {"Fragment prepass killed quads", "quads"},
-        counter_metadata {"Fragment prepass killed quad percentage", "percent"},
-        counter_metadata {"Loaded fragment prepass primitives", "primitives"},
-        counter_metadata {"Fragment prepass primitive percentage", "percent"},
-        counter_metadata {"Fragment prepass skipped primitive percentage", "percent"},
-        counter_metadata {"Fragment prepass skipped primitives", "primitives"},
-        counter_metadata {"Fragment prepass tested quads", "quads"},
-        counter_metadata {"Fragment prepass threads", "threads"},
-        counter_metadata {"Fragment prepass warps", "warps"},
-        counter_metadata {"Fragment prepass warp percentage", "percent"},
-        counter_metadata {"Loaded fragment primitives", "primitives"},
-        counter_metadata {"Partial tiler position shading requests", "requests"},
-        counter_metadata {"Partial tiler varying shading requests", "requests"},
-        counter_metadata {"Attribute unit issue cycles", "cycles"},
-        counter_metadata {"Attribute unit utilization", "percent"},
-        counter_metadata {"Blend unit issue cycles", "cycles"},
-        counter_metadata {"Blend unit utilization", "percent"},
-        counter_metadata {"Ray tracing unit backpressure cycles", "cycles"},
-        counter_metadata {"Ray tracing unit backpressure percentage", "percent"},
-        counter_metadata {"Processing unit I-cache starvation cycles", "cycles"},
-        counter_metadata {"Ray tracing unit active cycles", "cycles"},
-        counter_metadata {"Ray tracing culled BLAS instances", "issues"},
-        counter_metadata {"Ray tracing BLAS instances", "issues"},
-        counter_metadata {"Ray tracing box tests", "issues"},
-        counter_metadata {"Ray tracing unit cache hit", "requests"},
-        counter_metadata {"Ray tracing unit cache miss", "requests"},
-        counter_metadata {"Ray tracing new trace messages", "requests"},
-        counter_metadata {"Ray tracing culled primitives", "issues"},
-        counter_metadata {"Ray tracing resume trace messages", "requests"},
-        counter_metadata {"Ray tracing resumed rays", "rays"},
-        counter_metadata {"Ray tracing deep traversals", "rays"},
-        counter_metadata {"Ray tracing TLAS box tests", "issues"},
-        counter_metadata {"Ray tracing triangle primitive tests", "issues"},
-        counter_metadata {"Ray tracing unit read beats from external memory", "beats"},
-        counter_metadata {"Ray tracing unit read bytes from external memory", "bytes"},
-        counter_metadata {"Ray tracing unit read beats from L2 cache", "beats"},
-        counter_metadata {"Ray tracing unit read bytes from L2 cache", "bytes"}
+    /** The names, identifiers and units of the counters, null terminated and packed. */
+    constexpr char string_pool[] =
+        "Arithmetic unit issue cycles\0"
+        "Arithmetic unit utilization\0"
+        "Attribute instructions\0"
+        "Execution core active cycles\0"
+        "Execution core utilization\0"
+        "Diverged instructions\0"
+        "Warp divergence percentage\0"
+        "Arithmetic instruction issue cycles\0"
+        "Execution engine starvation cycles\0"
+        "Output external read transactions\0"
+        "Output external read beats\0"
+        "Output external read bytes\0"
+        "Output external read latency 0-127 cycles\0"
+        "Output external read latency 128-191 cycles\0"
+        "Output external read latency 192-255 cycles\0"
+        "Output external read latency 256-319 cycles\0"
+        "Output external read latency 320-383 cycles\0"
+        "Output external read latency 384+ cycles\0"
+        "Output external ReadNoSnoop transactions\0"
+        "Output external outstanding reads 0-25%\0"
+        "Output external outstanding reads 25-50%\0"
+        "Output external outstanding reads 50-75%\0"
+        "Output external outstanding reads 75-100%\0"
+        "Output external read stall cycles\0"
+        "Output external read stall percentage\0"
+        "Output external ReadUnique transactions\0"
+        "Output external write transactions\0"
+        "Output external write beats\0"
+        "Output external write bytes\0"
+        "Output external WriteNoSnoopFull transactions\0"
+        "Output external WriteNoSnoopPartial transactions\0"
+        "Output external outstanding writes 0-25%\0"
+        "Output external outstanding writes 25-50%\0"
+        "Output external outstanding writes 50-75%\0"
+        "Output external outstanding writes 75-100%\0"
+        "Output external WriteSnoopFull transactions\0"
+        "Output external WriteSnoopPartial transactions\0"
+        "Output external write stall cycles\0"
+        "Output external write stall percentage\0"
+        "Fragment active cycles\0"
+        "Early ZS killed quads\0"
+        "Early ZS killed quad percentage\0"
+        "Early ZS tested quads\0"
+        "Early ZS tested quad percentage\0"
+        "Early ZS updated quads\0"
+        "Early ZS updated quad percentage\0"
+        "Fragment pre-pipe buffer active cycles\0"
+        "Fragment pre-pipe buffer utilization\0"
+        "FPK HSR killed quads\0"
+        "FPK HSR killed quad percentage\0"
+        "Late ZS killed quads\0"
+        "Late ZS killed quad percentage\0"
+        "Late ZS tested quads\0"
+        "Late ZS tested quad percentage\0"
+        "Occluding quads\0"
+        "Occluding quad percentage\0"
+        "Fragments per pixel\0"
+        "Partial fragment warps\0"
+        "Partial coverage percentage\0"
+        "Fragment queue active cycles\0"
+        "Fragment jobs\0"
+        "Fragment tasks\0"
+        "Fragment queue utilization\0"
+        "Fragment queue job dependency wait cycles\0"
+        "Fragment queue job finish wait cycles\0"
+        "Fragment queue cache flush wait cycles\0"
+        "Fragment queue job issue wait cycles\0"
+        "Fragment queue job descriptor read wait cycles\0"
+        "Rasterized primitives\0"
+        "Rasterized fine quads\0"
+        "Fragment primitives loaded\0"
+        "Shaded coarse quads\0"
+        "Fragment threads\0"
+        "Average cycles per fragment thread\0"
+        "Tiles\0"
+        "Killed unchanged tiles\0"
+        "Unchanged tile kill percentage\0"
+        "Non-occluding quads\0"
+        "Fragment utilization\0"
+        "Fragment warps\0"
+        "GPU active cycles\0"
+        "Average cycles per pixel\0"
+        "GPU interrupt pending cycles\0"
+        "Interrupt pending utilization\0"
+        "Pixels\0"
+        "Visible back-facing primitives\0"
+        "Facing or XY plane test culled primitives\0"
+        "Facing or XY plane test cull percentage\0"
+        "Visible front-facing primitives\0"
+        "Line primitives\0"
+        "Point primitives\0"
+        "Tiler position shading requests\0"
+        "Position shader thread invocations\0"
+        "Position threads per input primitive\0"
+        "Sample test culled primitives\0"
+        "Sample test cull percentage\0"
+        "Culled primitives\0"
+        "Total input primitives\0"
+        "Triangle primitives\0"
+        "Tiler varying shading requests\0"
+        "Varying shader thread invocations\0"
+        "Varying threads per input primitive\0"
+        "Visible primitives\0"
+        "Visible primitive percentage\0"
+        "Z plane culled primitives\0"
+        "Z plane test cull percentage\0"
+        "L2 cache flush requests\0"
+        "Input external snoop transactions\0"
+        "Input external snoop stall cycles\0"
+        "Output internal read requests\0"
+        "Output internal read stall cycles\0"
+        "Output internal write requests\0"
+        "Any lookup requests\0"
+        "Input internal read requests\0"
+        "Read lookup requests\0"
+        "L2 cache read miss percentage\0"
+        "Input internal read stall cycles\0"
+        "Input internal snoop requests\0"
+        "Input external snoop lookup requests\0"
+        "Input internal snoop stall cycles\0"
+        "Input internal write requests\0"
+        "Write lookup requests\0"
+        "L2 cache write miss percentage\0"
+        "Input internal write stall cycles\0"
+        "Load/store unit atomic issues\0"
+        "Load/store unit full read issues\0"
+        "Load/store unit full write issues\0"
+        "Load/store unit issue cycles\0"
+        "Load/store unit partial read issues\0"
+        "Load/store unit partial write issues\0"
+        "Load/store unit read issues\0"
+        "Load/store unit utilization\0"
+        "Load/store unit write issues\0"
+        "MMU L2 lookup TLB hits\0"
+        "MMU L2 table read requests\0"
+        "MMU L3 lookup TLB hits\0"
+        "MMU L3 table read requests\0"
+        "MMU lookup requests\0"
+        "MMU stage 2 L2 lookup TLB hits\0"
+        "MMU stage 2 L2 lookup requests\0"
+        "MMU stage 2 L3 lookup TLB hits\0"
+        "MMU stage 2 L3 lookup requests\0"
+        "MMU stage 2 lookup requests\0"
+        "Non-fragment active cycles\0"
+        "Non-fragment queue active cycles\0"
+        "Non-fragment jobs\0"
+        "Non-fragment tasks\0"
+        "Non-fragment queue utilization\0"
+        "Non-fragment queue job dependency wait cycles\0"
+        "Non-fragment queue job finish wait cycles\0"
+        "Non-fragment queue cache flush wait cycles\0"
+        "Non-fragment queue job issue wait cycles\0"
+        "Non-fragment queue job descriptor read wait cycles\0"
+        "Non-fragment core tasks\0"
+        "Non-fragment threads\0"
+        "Average cycles per non-fragment thread\0"
+        "Non-fragment utilization\0"
+        "Non-fragment warps\0"
+        "Reserved active cycles\0"
+        "Reserved queue jobs\0"
+        "Reserved queue tasks\0"
+        "Reserved queue job dependency wait cycles\0"
+        "Reserved queue job finish wait cycles\0"
+        "Reserved queue cache flush wait cycles\0"
+        "Reserved queue job issue wait cycles\0"
+        "Reserved queue job descriptor read wait cycles\0"
+        "Fragment front-end read beats from external memory\0"
+        "Fragment front-end read bytes from external memory\0"
+        "Fragment front-end read beats from L2 cache\0"
+        "Fragment front-end read bytes from L2 cache\0"
+        "Load/store unit read beats from external memory\0"
+        "Load/store unit read bytes from external memory\0"
+        "Load/store unit bytes read from external memory per access cycle\0"
+        "Load/store unit read beats from L2 cache\0"
+        "Load/store unit read bytes from L2 cache\0"
+        "Load/store unit bytes read from L2 per access cycle\0"
+        "Load/store unit other write beats to L2 memory system\0"
+        "Load/store unit write-back write beats to L2 memory system\0"
+        "Load/store unit write beats to L2 memory system\0"
+        "Load/store unit write bytes to L2 memory system\0"
+        "Load/store unit bytes written to L2 per access cycle\0"
+        "Miscellaneous read beats from L2 cache\0"
+        "Texture unit read beats from external memory\0"
+        "Texture unit read bytes from external memory\0"
+        "Texture unit bytes read from external memory per texture cycle\0"
+        "Texture unit read beats from L2 cache\0"
+        "Texture unit read bytes from L2 cache\0"
+        "Texture unit bytes read from L2 per texture cycle\0"
+        "Tile unit bytes written to L2 per pixel\0"
+        "Tile unit write beats to L2 memory system\0"
+        "Tile unit write bytes to L2 memory system\0"
+        "Texture filtering cycles per instruction\0"
+        "Compressed texture line fetch requests\0"
+        "Texture data fetches from compressed lines\0"
+        "Texture line fetch requests\0"
+        "Texture cache lookup requests\0"
+        "Texture unit cache utilization\0"
+        "Texture filtering cycles\0"
+        "Texture unit issue cycles\0"
+        "Texture accesses using mipmapping percentage\0"
+        "Texture quad issues\0"
+        "Texture quad descriptor misses\0"
+        "Mipmapped texture quad issues\0"
+        "Trilinear filtered texture quad issues\0"
+        "Texture quads\0"
+        "Texture samples\0"
+        "Texture accesses using trilinear filter percentage\0"
+        "Texture unit utilization\0"
+        "Tiler active cycles\0"
+        "Position cache hit requests\0"
+        "Position cache hit percentage\0"
+        "Position cache miss requests\0"
+        "Tiler position FIFO full cycles\0"
+        "Tiler position shading stall cycles\0"
+        "Output internal read beats\0"
+        "Tiler utilization\0"
+        "Varying cache hits\0"
+        "Varying cache hit percentage\0"
+        "Varying cache misses\0"
+        "Tiler varying shading stall cycles\0"
+        "Internal write beats\0"
+        "16-bit interpolation issue cycles\0"
+        "16-bit interpolation slots\0"
+        "32-bit interpolation issue cycles\0"
+        "32-bit interpolation slots\0"
+        "Varying unit instructions\0"
+        "Varying unit issue cycles\0"
+        "Varying unit utilization\0"
+        "Warps using more than 32 registers\0"
+        "All registers warp percentage\0"
+        "Full warps\0"
+        "Full warp percentage\0"
+        "Miscellaneous write beats to L2 memory system\0"
+        "Other unit write bytes to L2 memory system\0"
+        "3D texture instructions\0"
+        "Texture samples using 3D texture percentage\0"
+        "Compressed texture instructions\0"
+        "Texture samples using compressed texture percentage\0"
+        "Texture filtering coordinate stall cycles\0"
+        "Texture line fill stall cycles\0"
+        "Texture instructions\0"
+        "Mipmapped texture instructions\0"
+        "Texture filtering partial data stall cycles\0"
+        "Trilinear filtered texture instructions\0"
+        "Arithmetic CVT pipe instructions\0"
+        "CVT pipe utilization\0"
+        "Arithmetic FMA pipe instructions\0"
+        "FMA pipe utilization\0"
+        "Instruction cache misses\0"
+        "Arithmetic SFU pipe instructions\0"
+        "SFU pipe utilization\0"
+        "Blend shader instructions\0"
+        "Shader blend percentage\0"
+        "Partial rasterized fine quads\0"
+        "Texture fetch stall cycles\0"
+        "Texture descriptor stall cycles\0"
+        "Texture full speed filtering percentage\0"
+        "Texture filtering stall cycles\0"
+        "Texture filtering cycles using full bilinear\0"
+        "Texture filtering cycles using full trilinear\0"
+        "Texture message read beats\0"
+        "Texture input bus utilization\0"
+        "Texture message write beats\0"
+        "Texture output bus utilization\0"
+        "Texture messages\0"
+        "Any workload active cycles\0"
+        "Shader core clock ratio\0"
+        "Command stream 0 wait stall cycles\0"
+        "Command stream 1 wait stall cycles\0"
+        "Command stream 2 wait stall cycles\0"
+        "Command stream 3 wait stall cycles\0"
+        "Command execution unit active cycles\0"
+        "Command execution unit utilization\0"
+        "Command stream 0 active cycles\0"
+        "Command stream 1 active cycles\0"
+        "Command stream 2 active cycles\0"
+        "Command stream 3 active cycles\0"
+        "Command load/store unit active cycles\0"
+        "Command load/store unit utilization\0"
+        "MCU active cycles\0"
+        "Microcontroller utilization\0"
+        "Compute queue active cycles\0"
+        "Compute queue endpoint stall cycles\0"
+        "Compute queue endpoint drain stall cycles\0"
+        "Compute queue interrupt pending cycles\0"
+        "Compute jobs\0"
+        "Compute tasks\0"
+        "Compute queue utilization\0"
+        "Compute work queued cycles\0"
+        "Fragment queue endpoint stall cycles\0"
+        "Fragment queue interrupt pending cycles\0"
+        "Fragment work queued cycles\0"
+        "Any queue active cycles\0"
+        "GPU interrupts\0"
+        "Input internal clean unique requests\0"
+        "Input internal evict requests\0"
+        "L2 cache flush cycles\0"
+        "Vertex queue endpoint drain stall cycles\0"
+        "Vertex queue active cycles\0"
+        "Vertex queue endpoint stall cycles\0"
+        "Vertex queue interrupt pending cycles\0"
+        "Vertex jobs\0"
+        "Vertex tasks\0"
+        "Vertex queue utilization\0"
+        "Vertex work queued cycles\0"
+        "Fragment warp occupancy\0"
+        "Narrow arithmetic instructions\0"
+        "Narrow arithmetic percentage\0"
+        "Rasterized coarse quads\0"
+        "Fragment shading rate\0"
+        "GPU active raw cycles\0"
+        "Facing test culled primitives\0"
+        "Facing plane test cull percentage\0"
+        "Frustum test culled primitives\0"
+        "Frustum test cull percentage\0"
+        "Ray tracing box tests\0"
+        "Ray tracing box nodes with 1-4 rays\0"
+        "Ray tracing box nodes with 13-16 rays\0"
+        "Ray tracing box nodes with 5-8 rays\0"
+        "Ray tracing box nodes with 9-12 rays\0"
+        "Ray tracing box tester issue cycles\0"
+        "Ray tracing first hit terminations\0"
+        "Ray tracing unit issue cycles\0"
+        "Ray tracing triangle test misses\0"
+        "Ray tracing non-opaque triangle hits\0"
+        "Ray tracing opaque triangle hits\0"
+        "Ray tracing started rays\0"
+        "Ray tracing triangle nodes tested\0"
+        "Ray tracing triangle nodes with 1-4 rays\0"
+        "Ray tracing triangle nodes with 13-16 rays\0"
+        "Ray tracing triangle nodes with 5-8 rays\0"
+        "Ray tracing triangle nodes with 9-12 rays\0"
+        "Ray tracing triangle tester issue cycles\0"
+        "Ray tracing unit utilization\0"
+        "Binning phase queue active cycles\0"
+        "Binning phase queue endpoint stall cycles\0"
+        "Binning phase queue interrupt pending cycles\0"
+        "Binning phase jobs\0"
+        "Binning phase tasks\0"
+        "Binning phase queue utilization\0"
+        "Binning phase work queued cycles\0"
+        "Compute or binning phase active cycles\0"
+        "Compute or binning phase utilization\0"
+        "Scissor test culled primitives\0"
+        "Scissor test cull percentage\0"
+        "Visible primitives using DVS\0"
+        "Main phase active cycles\0"
+        "Main phase queue active cycles\0"
+        "Main phase queue endpoint stall cycles\0"
+        "Main phase queue interrupt pending cycles\0"
+        "Main phase jobs\0"
+        "Main phase tasks\0"
+        "Main phase queue utilization\0"
+        "Main phase work queued cycles\0"
+        "Main phase utilization\0"
+        "Complex texture load cycles\0"
+        "Texture cache lookup cycles\0"
+        "Simple texture load cycles\0"
+        "Texture unit clock active cycles\0"
+        "Texture causing starvation cycles\0"
+        "Texture index calculation cycles\0"
+        "L1 texture cache load cycles\0"
+        "L1 texture cache lookup cycles\0"
+        "L1 texture cache output cycles\0"
+        "Texture messages with single quad\0"
+        "Primitive assembly position shading stall cycles\0"
+        "Command stream 4 wait stall cycles\0"
+        "Command stream 5 wait stall cycles\0"
+        "Command stream doorbell interrupt pending cycles\0"
+        "Command stream 4 active cycles\0"
+        "Command stream 5 active cycles\0"
+        "Deferred vertex warps\0"
+        "Attribute unit backpressure cycles\0"
+        "Attribute unit backpressure percentage\0"
+        "Blend unit backpressure cycles\0"
+        "Blend unit backpressure percentage\0"
+        "Load/store unit backpressure cycles\0"
+        "Load/store unit backpressure percentage\0"
+        "Slot 0 arithmetic issue cycles\0"
+        "Slot 1 arithmetic issue cycles\0"
+        "Any slot arithmetic issue cycles\0"
+        "Texture unit backpressure cycles\0"
+        "Texture unit backpressure percentage\0"
+        "Varying unit backpressure cycles\0"
+        "Varying unit backpressure percentage\0"
+        "ZS unit backpressure cycles\0"
+        "ZS unit backpressure percentage\0"
+        "Input fragment primitives\0"
+        "Fragment main pass stall cycles\0"
+        "Fragment main pass stall percentage\0"
+        "Fragment main pass threads\0"
+        "Fragment prepass culled primitives\0"
+        "Fragment prepass primitive culling percentage\0"
+        "Fragment prepass early ZS updated quads\0"
+        "Fragment prepass killed quads\0"
+        "Fragment prepass killed quad percentage\0"
+        "Loaded fragment prepass primitives\0"
+        "Fragment prepass primitive percentage\0"
+        "Fragment prepass skipped primitive percentage\0"
+        "Fragment prepass skipped primitives\0"
+        "Fragment prepass tested quads\0"
+        "Fragment prepass threads\0"
+        "Fragment prepass warps\0"
+        "Fragment prepass warp percentage\0"
+        "Loaded fragment primitives\0"
+        "Partial tiler position shading requests\0"
+        "Partial tiler varying shading requests\0"
+        "Attribute unit issue cycles\0"
+        "Attribute unit utilization\0"
+        "Blend unit issue cycles\0"
+        "Blend unit utilization\0"
+        "Ray tracing unit backpressure cycles\0"
+        "Ray tracing unit backpressure percentage\0"
+        "Processing unit I-cache starvation cycles\0"
+        "Ray tracing unit active cycles\0"
+        "Ray tracing culled BLAS instances\0"
+        "Ray tracing BLAS instances\0"
+        "Ray tracing unit cache hit\0"
+        "Ray tracing unit cache miss\0"
+        "Ray tracing new trace messages\0"
+        "Ray tracing culled primitives\0"
+        "Ray tracing resume trace messages\0"
+        "Ray tracing resumed rays\0"
+        "Ray tracing deep traversals\0"
+        "Ray tracing TLAS box tests\0"
+        "Ray tracing triangle primitive tests\0"
+        "Ray tracing unit read beats from external memory\0"
+        "Ray tracing unit read bytes from external memory\0"
+        "Ray tracing unit read beats from L2 cache\0"
+        "Ray tracing unit read bytes from L2 cache\0"
+        "MaliALUIssueCy\0"
+        "MaliALUUtil\0"
+        "MaliAttrInstr\0"
+        "MaliCoreActiveCy\0"
+        "MaliCoreUtil\0"
+        "MaliEngDivergedInstr\0"
+        "MaliEngDivergedInstrRate\0"
+        "MaliEngInstr\0"
+        "MaliEngStarveCy\0"
+        "MaliExtBusRd\0"
+        "MaliExtBusRdBt\0"
+        "MaliExtBusRdBy\0"
+        "MaliExtBusRdLat0\0"
+        "MaliExtBusRdLat128\0"
+        "MaliExtBusRdLat192\0"
+        "MaliExtBusRdLat256\0"
+        "MaliExtBusRdLat320\0"
+        "MaliExtBusRdLat384\0"
+        "MaliExtBusRdNoSnoop\0"
+        "MaliExtBusRdOTQ1\0"
+        "MaliExtBusRdOTQ2\0"
+        "MaliExtBusRdOTQ3\0"
+        "MaliExtBusRdOTQ4\0"
+        "MaliExtBusRdStallCy\0"
+        "MaliExtBusRdStallRate\0"
+        "MaliExtBusRdUnique\0"
+        "MaliExtBusWr\0"
+        "MaliExtBusWrBt\0"
+        "MaliExtBusWrBy\0"
+        "MaliExtBusWrNoSnoopFull\0"
+        "MaliExtBusWrNoSnoopPart\0"
+        "MaliExtBusWrOTQ1\0"
+        "MaliExtBusWrOTQ2\0"
+        "MaliExtBusWrOTQ3\0"
+        "MaliExtBusWrOTQ4\0"
+        "MaliExtBusWrSnoopFull\0"
+        "MaliExtBusWrSnoopPart\0"
+        "MaliExtBusWrStallCy\0"
+        "MaliExtBusWrStallRate\0"
+        "MaliFragActiveCy\0"
+        "MaliFragEZSKillQd\0"
+        "MaliFragEZSKillRate\0"
+        "MaliFragEZSTestQd\0"
+        "MaliFragEZSTestRate\0"
+        "MaliFragEZSUpdateQd\0"
+        "MaliFragEZSUpdateRate\0"
+        "MaliFragFPKActiveCy\0"
+        "MaliFragFPKBUtil\0"
+        "MaliFragFPKKillQd\0"
+        "MaliFragFPKKillRate\0"
+        "MaliFragLZSKillQd\0"
+        "MaliFragLZSKillRate\0"
+        "MaliFragLZSTestQd\0"
+        "MaliFragLZSTestRate\0"
+        "MaliFragOpaqueQd\0"
+        "MaliFragOpaqueQdRate\0"
+        "MaliFragOverdraw\0"
+        "MaliFragPartWarp\0"
+        "MaliFragPartWarpRate\0"
+        "MaliFragQueueActiveCy\0"
+        "MaliFragQueueJob\0"
+        "MaliFragQueueTask\0"
+        "MaliFragQueueUtil\0"
+        "MaliFragQueueWaitDepCy\0"
+        "MaliFragQueueWaitFinishCy\0"
+        "MaliFragQueueWaitFlushCy\0"
+        "MaliFragQueueWaitIssueCy\0"
+        "MaliFragQueueWaitRdCy\0"
+        "MaliFragRastPrim\0"
+        "MaliFragRastQd\0"
+        "MaliFragRdPrim\0"
+        "MaliFragShadedQd\0"
+        "MaliFragThread\0"
+        "MaliFragThroughputCy\0"
+        "MaliFragTile\0"
+        "MaliFragTileKill\0"
+        "MaliFragTileKillRate\0"
+        "MaliFragTransparentQd\0"
+        "MaliFragUtil\0"
+        "MaliFragWarp\0"
+        "MaliGPUActiveCy\0"
+        "MaliGPUCyPerPix\0"
+        "MaliGPUIRQActiveCy\0"
+        "MaliGPUIRQUtil\0"
+        "MaliGPUPix\0"
+        "MaliGeomBackFacePrim\0"
+        "MaliGeomFaceXYPlaneCullPrim\0"
+        "MaliGeomFaceXYPlaneCullRate\0"
+        "MaliGeomFrontFacePrim\0"
+        "MaliGeomLinePrim\0"
+        "MaliGeomPointPrim\0"
+        "MaliGeomPosShadTask\0"
+        "MaliGeomPosShadThread\0"
+        "MaliGeomPosShadThreadPerPrim\0"
+        "MaliGeomSampleCullPrim\0"
+        "MaliGeomSampleCullRate\0"
+        "MaliGeomTotalCullPrim\0"
+        "MaliGeomTotalPrim\0"
+        "MaliGeomTrianglePrim\0"
+        "MaliGeomVarShadTask\0"
+        "MaliGeomVarShadThread\0"
+        "MaliGeomVarShadThreadPerPrim\0"
+        "MaliGeomVisiblePrim\0"
+        "MaliGeomVisibleRate\0"
+        "MaliGeomZPlaneCullPrim\0"
+        "MaliGeomZPlaneCullRate\0"
+        "MaliL2CacheFlush\0"
+        "MaliL2CacheIncSnp\0"
+        "MaliL2CacheIncSnpStallCy\0"
+        "MaliL2CacheL1Rd\0"
+        "MaliL2CacheL1RdStallCy\0"
+        "MaliL2CacheL1Wr\0"
+        "MaliL2CacheLookup\0"
+        "MaliL2CacheRd\0"
+        "MaliL2CacheRdLookup\0"
+        "MaliL2CacheRdMissRate\0"
+        "MaliL2CacheRdStallCy\0"
+        "MaliL2CacheSnp\0"
+        "MaliL2CacheSnpLookup\0"
+        "MaliL2CacheSnpStallCy\0"
+        "MaliL2CacheWr\0"
+        "MaliL2CacheWrLookup\0"
+        "MaliL2CacheWrMissRate\0"
+        "MaliL2CacheWrStallCy\0"
+        "MaliLSAtomic\0"
+        "MaliLSFullRd\0"
+        "MaliLSFullWr\0"
+        "MaliLSIssueCy\0"
+        "MaliLSPartRd\0"
+        "MaliLSPartWr\0"
+        "MaliLSRdCy\0"
+        "MaliLSUtil\0"
+        "MaliLSWrCy\0"
+        "MaliMMUL2Hit\0"
+        "MaliMMUL2Rd\0"
+        "MaliMMUL3Hit\0"
+        "MaliMMUL3Rd\0"
+        "MaliMMULookup\0"
+        "MaliMMUS2L2Hit\0"
+        "MaliMMUS2L2Rd\0"
+        "MaliMMUS2L3Hit\0"
+        "MaliMMUS2L3Rd\0"
+        "MaliMMUS2Lookup\0"
+        "MaliNonFragActiveCy\0"
+        "MaliNonFragQueueActiveCy\0"
+        "MaliNonFragQueueJob\0"
+        "MaliNonFragQueueTask\0"
+        "MaliNonFragQueueUtil\0"
+        "MaliNonFragQueueWaitDepCy\0"
+        "MaliNonFragQueueWaitFinishCy\0"
+        "MaliNonFragQueueWaitFlushCy\0"
+        "MaliNonFragQueueWaitIssueCy\0"
+        "MaliNonFragQueueWaitRdCy\0"
+        "MaliNonFragTask\0"
+        "MaliNonFragThread\0"
+        "MaliNonFragThroughputCy\0"
+        "MaliNonFragUtil\0"
+        "MaliNonFragWarp\0"
+        "MaliResQueueActiveCy\0"
+        "MaliResQueueJob\0"
+        "MaliResQueueTask\0"
+        "MaliResQueueWaitDepCy\0"
+        "MaliResQueueWaitFinishCy\0"
+        "MaliResQueueWaitFlushCy\0"
+        "MaliResQueueWaitIssueCy\0"
+        "MaliResQueueWaitRdCy\0"
+        "MaliSCBusFFEExtRdBt\0"
+        "MaliSCBusFFEExtRdBy\0"
+        "MaliSCBusFFEL2RdBt\0"
+        "MaliSCBusFFEL2RdBy\0"
+        "MaliSCBusLSExtRdBt\0"
+        "MaliSCBusLSExtRdBy\0"
+        "MaliSCBusLSExtRdByPerRd\0"
+        "MaliSCBusLSL2RdBt\0"
+        "MaliSCBusLSL2RdBy\0"
+        "MaliSCBusLSL2RdByPerRd\0"
+        "MaliSCBusLSOtherWrBt\0"
+        "MaliSCBusLSWBWrBt\0"
+        "MaliSCBusLSWrBt\0"
+        "MaliSCBusLSWrBy\0"
+        "MaliSCBusLSWrByPerWr\0"
+        "MaliSCBusOtherL2RdBt\0"
+        "MaliSCBusTexExtRdBt\0"
+        "MaliSCBusTexExtRdBy\0"
+        "MaliSCBusTexExtRdByPerRd\0"
+        "MaliSCBusTexL2RdBt\0"
+        "MaliSCBusTexL2RdBy\0"
+        "MaliSCBusTexL2RdByPerRd\0"
+        "MaliSCBusTileWrBPerPx\0"
+        "MaliSCBusTileWrBt\0"
+        "MaliSCBusTileWrBy\0"
+        "MaliTexCPI\0"
+        "MaliTexCacheCompressFetch\0"
+        "MaliTexCacheCompressFetchRate\0"
+        "MaliTexCacheFetch\0"
+        "MaliTexCacheLookup\0"
+        "MaliTexCacheUtil\0"
+        "MaliTexFiltIssueCy\0"
+        "MaliTexIssueCy\0"
+        "MaliTexMipInstrRate\0"
+        "MaliTexQuadPass\0"
+        "MaliTexQuadPassDescMiss\0"
+        "MaliTexQuadPassMip\0"
+        "MaliTexQuadPassTri\0"
+        "MaliTexQuads\0"
+        "MaliTexSample\0"
+        "MaliTexTriInstrRate\0"
+        "MaliTexUtil\0"
+        "MaliTilerActiveCy\0"
+        "MaliTilerPosCacheHit\0"
+        "MaliTilerPosCacheHitRate\0"
+        "MaliTilerPosCacheMiss\0"
+        "MaliTilerPosShadFIFOFullCy\0"
+        "MaliTilerPosShadStallCy\0"
+        "MaliTilerRdBt\0"
+        "MaliTilerUtil\0"
+        "MaliTilerVarCacheHit\0"
+        "MaliTilerVarCacheHitRate\0"
+        "MaliTilerVarCacheMiss\0"
+        "MaliTilerVarShadStallCy\0"
+        "MaliTilerWrBt\0"
+        "MaliVar16IssueCy\0"
+        "MaliVar16IssueSlot\0"
+        "MaliVar32IssueCy\0"
+        "MaliVar32IssueSlot\0"
+        "MaliVarInstr\0"
+        "MaliVarIssueCy\0"
+        "MaliVarUtil\0"
+        "MaliCoreAllRegsWarp\0"
+        "MaliCoreAllRegsWarpRate\0"
+        "MaliCoreFullWarp\0"
+        "MaliCoreFullWarpRate\0"
+        "MaliSCBusOtherWrBt\0"
+        "MaliSCBusOtherWrBy\0"
+        "MaliTex3DInstr\0"
+        "MaliTex3DInstrRate\0"
+        "MaliTexCompressInstr\0"
+        "MaliTexCompressInstrRate\0"
+        "MaliTexCoordStallCy\0"
+        "MaliTexDataStallCy\0"
+        "MaliTexInstr\0"
+        "MaliTexMipInstr\0"
+        "MaliTexPartDataStallCy\0"
+        "MaliTexTriInstr\0"
+        "MaliEngArithInstr\0"
+        "MaliEngCVTInstr\0"
+        "MaliEngCVTPipeUtil\0"
+        "MaliEngFMAInstr\0"
+        "MaliEngFMAPipeUtil\0"
+        "MaliEngICacheMiss\0"
+        "MaliEngSFUInstr\0"
+        "MaliEngSFUPipeUtil\0"
+        "MaliEngSWBlendInstr\0"
+        "MaliEngSWBlendRate\0"
+        "MaliFragRastPartQd\0"
+        "MaliFragRastPartQdRate\0"
+        "MaliTexDataFetchStallCy\0"
+        "MaliTexDescStallCy\0"
+        "MaliTexFiltFullRate\0"
+        "MaliTexFiltStallCy\0"
+        "MaliTexFullBiFiltCy\0"
+        "MaliTexFullTriFiltCy\0"
+        "MaliTexInBt\0"
+        "MaliTexInBusUtil\0"
+        "MaliTexOutBt\0"
+        "MaliTexOutBusUtil\0"
+        "MaliTexOutMsg\0"
+        "MaliAnyActiveCy\0"
+        "MaliAnyUtil\0"
+        "MaliCS0WaitStallCy\0"
+        "MaliCS1WaitStallCy\0"
+        "MaliCS2WaitStallCy\0"
+        "MaliCS3WaitStallCy\0"
+        "MaliCSFCEUActiveCy\0"
+        "MaliCSFCEUUtil\0"
+        "MaliCSFCS0ActiveCy\0"
+        "MaliCSFCS1ActiveCy\0"
+        "MaliCSFCS2ActiveCy\0"
+        "MaliCSFCS3ActiveCy\0"
+        "MaliCSFLSUActiveCy\0"
+        "MaliCSFLSUUtil\0"
+        "MaliCSFMCUActiveCy\0"
+        "MaliCSFMCUUtil\0"
+        "MaliCompQueueActiveCy\0"
+        "MaliCompQueueAssignStallCy\0"
+        "MaliCompQueueDrainStallCy\0"
+        "MaliCompQueueIRQActiveCy\0"
+        "MaliCompQueueJob\0"
+        "MaliCompQueueTask\0"
+        "MaliCompQueueUtil\0"
+        "MaliCompQueuedCy\0"
+        "MaliFragQueueAssignStallCy\0"
+        "MaliFragQueueIRQActiveCy\0"
+        "MaliFragQueuedCy\0"
+        "MaliGPUAnyQueueActiveCy\0"
+        "MaliGPUIRQ\0"
+        "MaliL2CacheCleanUnique\0"
+        "MaliL2CacheEvict\0"
+        "MaliL2CacheFlushCy\0"
+        "MaliTilerQueueDrainStallCy\0"
+        "MaliVertQueueActiveCy\0"
+        "MaliVertQueueAssignStallCy\0"
+        "MaliVertQueueIRQActiveCy\0"
+        "MaliVertQueueJob\0"
+        "MaliVertQueueTask\0"
+        "MaliVertQueueUtil\0"
+        "MaliVertQueuedCy\0"
+        "MaliCoreFragWarpOcc\0"
+        "MaliEngNarrowInstr\0"
+        "MaliEngNarrowInstrRate\0"
+        "MaliFragRastCoarseQd\0"
+        "MaliFragShadRate\0"
+        "MaliGPUActiveRawCy\0"
+        "MaliGeomFaceCullPrim\0"
+        "MaliGeomFaceCullRate\0"
+        "MaliGeomPlaneCullPrim\0"
+        "MaliGeomPlaneCullRate\0"
+        "MaliRTUBox\0"
+        "MaliRTUBoxBin1\0"
+        "MaliRTUBoxBin13\0"
+        "MaliRTUBoxBin5\0"
+        "MaliRTUBoxBin9\0"
+        "MaliRTUBoxIssueCy\0"
+        "MaliRTUFirstHitTerm\0"
+        "MaliRTUIssueCy\0"
+        "MaliRTUMiss\0"
+        "MaliRTUNonOpaqueHit\0"
+        "MaliRTUOpaqueHit\0"
+        "MaliRTURay\0"
+        "MaliRTUTri\0"
+        "MaliRTUTriBin1\0"
+        "MaliRTUTriBin13\0"
+        "MaliRTUTriBin5\0"
+        "MaliRTUTriBin9\0"
+        "MaliRTUTriIssueCy\0"
+        "MaliRTUUtil\0"
+        "MaliBinningQueueActiveCy\0"
+        "MaliBinningQueueAssignStallCy\0"
+        "MaliBinningQueueIRQActiveCy\0"
+        "MaliBinningQueueJob\0"
+        "MaliBinningQueueTask\0"
+        "MaliBinningQueueUtil\0"
+        "MaliBinningQueuedCy\0"
+        "MaliCompOrBinningActiveCy\0"
+        "MaliCompOrBinningUtil\0"
+        "MaliGeomScissorCullPrim\0"
+        "MaliGeomScissorCullRate\0"
+        "MaliGeomVisibleDVSPrim\0"
+        "MaliMainActiveCy\0"
+        "MaliMainQueueActiveCy\0"
+        "MaliMainQueueAssignStallCy\0"
+        "MaliMainQueueIRQActiveCy\0"
+        "MaliMainQueueJob\0"
+        "MaliMainQueueTask\0"
+        "MaliMainQueueUtil\0"
+        "MaliMainQueuedCy\0"
+        "MaliMainUtil\0"
+        "MaliTexCacheComplexLoadCy\0"
+        "MaliTexCacheLookupCy\0"
+        "MaliTexCacheSimpleLoadCy\0"
+        "MaliTexClkActiveCy\0"
+        "MaliTexClkStarvedCy\0"
+        "MaliTexIndexCy\0"
+        "MaliTexL1CacheLoadCy\0"
+        "MaliTexL1CacheLookupCy\0"
+        "MaliTexL1CacheOutputCy\0"
+        "MaliTexOutSingleMsg\0"
+        "MaliTilerPrimAsPosShadStallCy\0"
+        "MaliCS4WaitStallCy\0"
+        "MaliCS5WaitStallCy\0"
+        "MaliCSDoorbellIRQCy\0"
+        "MaliCSFCS4ActiveCy\0"
+        "MaliCSFCS5ActiveCy\0"
+        "MaliDefVertWarp\0"
+        "MaliEngAttrBackpressureCy\0"
+        "MaliEngAttrBackpressureRate\0"
+        "MaliEngBlendBackpressureCy\0"
+        "MaliEngBlendBackpressureRate\0"
+        "MaliEngLSBackpressureCy\0"
+        "MaliEngLSBackpressureRate\0"
+        "MaliEngSlot0IssueCy\0"
+        "MaliEngSlot1IssueCy\0"
+        "MaliEngSlotAnyIssueCy\0"
+        "MaliEngTexBackpressureCy\0"
+        "MaliEngTexBackpressureRate\0"
+        "MaliEngVarBackpressureCy\0"
+        "MaliEngVarBackpressureRate\0"
+        "MaliEngZSBackpressureCy\0"
+        "MaliEngZSBackpressureRate\0"
+        "MaliFragInputPrim\0"
+        "MaliFragMainPassStallCy\0"
+        "MaliFragMainPassStallRate\0"
+        "MaliFragMainThread\0"
+        "MaliFragPrepassCullPrim\0"
+        "MaliFragPrepassCullPrimRate\0"
+        "MaliFragPrepassEZSUpdateQd\0"
+        "MaliFragPrepassKillQd\0"
+        "MaliFragPrepassKillRate\0"
+        "MaliFragPrepassPrim\0"
+        "MaliFragPrepassPrimRate\0"
+        "MaliFragPrepassSkipPrimRate\0"
+        "MaliFragPrepassSkippedPrim\0"
+        "MaliFragPrepassTestQd\0"
+        "MaliFragPrepassThread\0"
+        "MaliFragPrepassWarp\0"
+        "MaliFragPrepassWarpRate\0"
+        "MaliFragPrim\0"
+        "MaliGeomPosShadPartTask\0"
+        "MaliGeomVarShadPartTask\0"
+        "MaliAttrIssueCy\0"
+        "MaliAttrUtil\0"
+        "MaliBlendIssueCy\0"
+        "MaliBlendUtil\0"
+        "MaliEngRTUBackpressureCy\0"
+        "MaliEngRTUBackpressureRate\0"
+        "MaliEngStarveICacheCy\0"
+        "MaliRTUActiveCy\0"
+        "MaliRTUBLASCull\0"
+        "MaliRTUBLASIssue\0"
+        "MaliRTUBoxIssue\0"
+        "MaliRTUCacheHit\0"
+        "MaliRTUCacheMiss\0"
+        "MaliRTUNewTraceInstr\0"
+        "MaliRTUPrimCull\0"
+        "MaliRTUResumeTraceInstr\0"
+        "MaliRTUResumeTraceRays\0"
+        "MaliRTUStackOverflows\0"
+        "MaliRTUTLASBoxIssue\0"
+        "MaliRTUTriCull\0"
+        "MaliSCBusRTUExtRdBt\0"
+        "MaliSCBusRTUExtRdBy\0"
+        "MaliSCBusRTUL2RdBt\0"
+        "MaliSCBusRTUL2RdBy\0"
+        "beats\0"
+        "boxes\0"
+        "bytes\0"
+        "cycles\0"
+        "instructions\0"
+        "interrupts\0"
+        "issues\0"
+        "jobs\0"
+        "nodes\0"
+        "percent\0"
+        "pixels\0"
+        "primitives\0"
+        "quads\0"
+        "rays\0"
+        "requests\0"
+        "tasks\0"
+        "tests\0"
+        "threads\0"
+        "tiles\0"
+        "transactions\0"
+        "warps\0";
+
+    static_assert(sizeof(string_pool) <= UINT16_MAX, "The string pool must be addressable with 16-bit offsets");
+
+    /** The offset of each units string in the string pool. */
+    constexpr std::array<uint16_t, 21> units_offsets {
+        22203, // beats
+        22209, // boxes
+        22215, // bytes
+        22221, // cycles
+        22228, // instructions
+        22241, // interrupts
+        22252, // issues
+        22259, // jobs
+        22264, // nodes
+        22270, // percent
+        22278, // pixels
+        22285, // primitives
+        22296, // quads
+        22302, // rays
+        22307, // requests
+        22316, // tasks
+        22322, // tests
+        22328, // threads
+        22336, // tiles
+        22342, // transactions
+        22355, // warps
+    };
+
+    /** The offsets of the name and identifier of a counter in the string pool, and the index of its units. */
+    struct packed_counter_metadata {
+        uint16_t name;
+        uint16_t identifier;
+        uint8_t units;
+    };
+
+    constexpr std::array<packed_counter_metadata, 433> all_counter_metadata {
+        packed_counter_metadata {0, 13794, 3},
+        packed_counter_metadata {29, 13809, 9},
+        packed_counter_metadata {57, 13821, 4},
+        packed_counter_metadata {80, 13835, 3},
+        packed_counter_metadata {109, 13852, 9},
+        packed_counter_metadata {136, 13865, 4},
+        packed_counter_metadata {158, 13886, 9},
+        packed_counter_metadata {185, 13911, 4},
+        packed_counter_metadata {221, 13924, 3},
+        packed_counter_metadata {256, 13940, 19},
+        packed_counter_metadata {290, 13953, 0},
+        packed_counter_metadata {317, 13968, 2},
+        packed_counter_metadata {344, 13983, 0},
+        packed_counter_metadata {386, 14000, 0},
+        packed_counter_metadata {430, 14019, 0},
+        packed_counter_metadata {474, 14038, 0},
+        packed_counter_metadata {518, 14057, 0},
+        packed_counter_metadata {562, 14076, 0},
+        packed_counter_metadata {603, 14095, 19},
+        packed_counter_metadata {644, 14115, 19},
+        packed_counter_metadata {684, 14132, 19},
+        packed_counter_metadata {725, 14149, 19},
+        packed_counter_metadata {766, 14166, 19},
+        packed_counter_metadata {808, 14183, 3},
+        packed_counter_metadata {842, 14203, 9},
+        packed_counter_metadata {880, 14225, 19},
+        packed_counter_metadata {920, 14244, 19},
+        packed_counter_metadata {955, 14257, 0},
+        packed_counter_metadata {983, 14272, 2},
+        packed_counter_metadata {1011, 14287, 19},
+        packed_counter_metadata {1057, 14311, 19},
+        packed_counter_metadata {1106, 14335, 19},
+        packed_counter_metadata {1147, 14352, 19},
+        packed_counter_metadata {1189, 14369, 19},
+        packed_counter_metadata {1231, 14386, 19},
+        packed_counter_metadata {1274, 14403, 19},
+        packed_counter_metadata {1318, 14425, 19},
+        packed_counter_metadata {1365, 14447, 3},
+        packed_counter_metadata {1400, 14467, 9},
+        packed_counter_metadata {1439, 14489, 3},
+        packed_counter_metadata {1462, 14506, 12},
+        packed_counter_metadata {1484, 14524, 9},
+        packed_counter_metadata {1516, 14544, 12},
+        packed_counter_metadata {1538, 14562, 9},
+        packed_counter_metadata {1570, 14582, 12},
+        packed_counter_metadata {1593, 14602, 9},
+        packed_counter_metadata {1626, 14624, 3},
+        packed_counter_metadata {1665, 14644, 9},
+        packed_counter_metadata {1702, 14661, 12},
+        packed_counter_metadata {1723, 14679, 9},
+        packed_counter_metadata {1754, 14699, 12},
+        packed_counter_metadata {1775, 14717, 9},
+        packed_counter_metadata {1806, 14737, 12},
+        packed_counter_metadata {1827, 14755, 9},
+        packed_counter_metadata {1858, 14775, 12},
+        packed_counter_metadata {1874, 14792, 9},
+        packed_counter_metadata {1900, 14813, 17},
+        packed_counter_metadata {1920, 14830, 20},
+        packed_counter_metadata {1943, 14847, 9},
+        packed_counter_metadata {1971, 14868, 3},
+        packed_counter_metadata {2000, 14890, 7},
+        packed_counter_metadata {2014, 14907, 15},
+        packed_counter_metadata {2029, 14925, 9},
+        packed_counter_metadata {2056, 14943, 3},
+        packed_counter_metadata {2098, 14966, 3},
+        packed_counter_metadata {2136, 14992, 3},
+        packed_counter_metadata {2175, 15017, 3},
+        packed_counter_metadata {2212, 15042, 3},
+        packed_counter_metadata {2259, 15064, 11},
+        packed_counter_metadata {2281, 15081, 12},
+        packed_counter_metadata {2303, 15096, 11},
+        packed_counter_metadata {2330, 15111, 12},
+        packed_counter_metadata {2350, 15128, 17},
+        packed_counter_metadata {2367, 15143, 3},
+        packed_counter_metadata {2402, 15164, 18},
+        packed_counter_metadata {2408, 15177, 18},
+        packed_counter_metadata {2431, 15194, 9},
+        packed_counter_metadata {2462, 15215, 12},
+        packed_counter_metadata {2482, 15237, 9},
+        packed_counter_metadata {2503, 15250, 20},
+        packed_counter_metadata {2518, 15263, 3},
+        packed_counter_metadata {2536, 15279, 3},
+        packed_counter_metadata {2561, 15295, 3},
+        packed_counter_metadata {2590, 15314, 9},
+        packed_counter_metadata {2620, 15329, 10},
+        packed_counter_metadata {2627, 15340, 11},
+        packed_counter_metadata {2658, 15361, 11},
+        packed_counter_metadata {2700, 15389, 9},
+        packed_counter_metadata {2740, 15417, 11},
+        packed_counter_metadata {2772, 15439, 11},
+        packed_counter_metadata {2788, 15456, 11},
+        packed_counter_metadata {2805, 15474, 14},
+        packed_counter_metadata {2837, 15494, 17},
+        packed_counter_metadata {2872, 15516, 17},
+        packed_counter_metadata {2909, 15545, 11},
+        packed_counter_metadata {2939, 15568, 9},
+        packed_counter_metadata {2967, 15591, 11},
+        packed_counter_metadata {2985, 15613, 11},
+        packed_counter_metadata {3008, 15631, 11},
+        packed_counter_metadata {3028, 15652, 14},
+        packed_counter_metadata {3059, 15672, 17},
+        packed_counter_metadata {3093, 15694, 17},
+        packed_counter_metadata {3129, 15723, 11},
+        packed_counter_metadata {3148, 15743, 9},
+        packed_counter_metadata {3177, 15763, 11},
+        packed_counter_metadata {3203, 15786, 9},
+        packed_counter_metadata {3232, 15809, 14},
+        packed_counter_metadata {3256, 15826, 19},
+        packed_counter_metadata {3290, 15844, 3},
+        packed_counter_metadata {3324, 15869, 14},
+        packed_counter_metadata {3354, 15885, 3},
+        packed_counter_metadata {3388, 15908, 14},
+        packed_counter_metadata {3419, 15924, 14},
+        packed_counter_metadata {3439, 15942, 14},
+        packed_counter_metadata {3468, 15956, 14},
+        packed_counter_metadata {3489, 15976, 9},
+        packed_counter_metadata {3519, 15998, 3},
+        packed_counter_metadata {3552, 16019, 14},
+        packed_counter_metadata {3582, 16034, 14},
+        packed_counter_metadata {3619, 16055, 3},
+        packed_counter_metadata {3653, 16077, 14},
+        packed_counter_metadata {3683, 16091, 14},
+        packed_counter_metadata {3705, 16111, 9},
+        packed_counter_metadata {3736, 16133, 3},
+        packed_counter_metadata {3770, 16154, 3},
+        packed_counter_metadata {3800, 16167, 3},
+        packed_counter_metadata {3833, 16180, 3},
+        packed_counter_metadata {3867, 16193, 3},
+        packed_counter_metadata {3896, 16207, 3},
+        packed_counter_metadata {3932, 16220, 3},
+        packed_counter_metadata {3969, 16233, 3},
+        packed_counter_metadata {3997, 16244, 9},
+        packed_counter_metadata {4025, 16255, 3},
+        packed_counter_metadata {4054, 16266, 14},
+        packed_counter_metadata {4077, 16279, 14},
+        packed_counter_metadata {4104, 16291, 14},
+        packed_counter_metadata {4127, 16304, 14},
+        packed_counter_metadata {4154, 16316, 14},
+        packed_counter_metadata {4174, 16330, 14},
+        packed_counter_metadata {4205, 16345, 14},
+        packed_counter_metadata {4236, 16359, 14},
+        packed_counter_metadata {4267, 16374, 14},
+        packed_counter_metadata {4298, 16388, 14},
+        packed_counter_metadata {4326, 16404, 3},
+        packed_counter_metadata {4353, 16424, 3},
+        packed_counter_metadata {4386, 16449, 7},
+        packed_counter_metadata {4404, 16469, 15},
+        packed_counter_metadata {4423, 16490, 9},
+        packed_counter_metadata {4454, 16511, 3},
+        packed_counter_metadata {4500, 16537, 3},
+        packed_counter_metadata {4542, 16566, 3},
+        packed_counter_metadata {4585, 16594, 3},
+        packed_counter_metadata {4626, 16622, 3},
+        packed_counter_metadata {4677, 16647, 15},
+        packed_counter_metadata {4701, 16663, 17},
+        packed_counter_metadata {4722, 16681, 3},
+        packed_counter_metadata {4761, 16705, 9},
+        packed_counter_metadata {4786, 16721, 20},
+        packed_counter_metadata {4805, 16737, 3},
+        packed_counter_metadata {4828, 16758, 7},
+        packed_counter_metadata {4848, 16774, 15},
+        packed_counter_metadata {4869, 16791, 3},
+        packed_counter_metadata {4911, 16813, 3},
+        packed_counter_metadata {4949, 16838, 3},
+        packed_counter_metadata {4988, 16862, 3},
+        packed_counter_metadata {5025, 16886, 3},
+        packed_counter_metadata {5072, 16907, 0},
+        packed_counter_metadata {5123, 16927, 2},
+        packed_counter_metadata {5174, 16947, 0},
+        packed_counter_metadata {5218, 16966, 2},
+        packed_counter_metadata {5262, 16985, 0},
+        packed_counter_metadata {5310, 17004, 2},
+        packed_counter_metadata {5358, 17023, 2},
+        packed_counter_metadata {5423, 17047, 0},
+        packed_counter_metadata {5464, 17065, 2},
+        packed_counter_metadata {5505, 17083, 2},
+        packed_counter_metadata {5557, 17106, 0},
+        packed_counter_metadata {5611, 17127, 0},
+        packed_counter_metadata {5670, 17145, 0},
+        packed_counter_metadata {5718, 17161, 2},
+        packed_counter_metadata {5766, 17177, 2},
+        packed_counter_metadata {5819, 17198, 0},
+        packed_counter_metadata {5858, 17219, 0},
+        packed_counter_metadata {5903, 17239, 2},
+        packed_counter_metadata {5948, 17259, 2},
+        packed_counter_metadata {6011, 17284, 0},
+        packed_counter_metadata {6049, 17303, 2},
+        packed_counter_metadata {6087, 17322, 2},
+        packed_counter_metadata {6137, 17346, 2},
+        packed_counter_metadata {6177, 17368, 0},
+        packed_counter_metadata {6219, 17386, 2},
+        packed_counter_metadata {6261, 17404, 3},
+        packed_counter_metadata {6302, 17415, 6},
+        packed_counter_metadata {6341, 17441, 9},
+        packed_counter_metadata {6384, 17471, 6},
+        packed_counter_metadata {6412, 17489, 14},
+        packed_counter_metadata {6442, 17508, 9},
+        packed_counter_metadata {6473, 17525, 3},
+        packed_counter_metadata {6498, 17544, 3},
+        packed_counter_metadata {6524, 17559, 9},
+        packed_counter_metadata {6569, 17579, 6},
+        packed_counter_metadata {6589, 17595, 14},
+        packed_counter_metadata {6620, 17619, 6},
+        packed_counter_metadata {6650, 17638, 6},
+        packed_counter_metadata {6689, 17657, 12},
+        packed_counter_metadata {6703, 17670, 14},
+        packed_counter_metadata {6719, 17684, 9},
+        packed_counter_metadata {6770, 17704, 9},
+        packed_counter_metadata {6795, 17716, 3},
+        packed_counter_metadata {6815, 17734, 14},
+        packed_counter_metadata {6843, 17755, 9},
+        packed_counter_metadata {6873, 17780, 14},
+        packed_counter_metadata {6902, 17802, 3},
+        packed_counter_metadata {6934, 17829, 3},
+        packed_counter_metadata {6970, 17853, 0},
+        packed_counter_metadata {6997, 17867, 9},
+        packed_counter_metadata {7015, 17881, 14},
+        packed_counter_metadata {7034, 17902, 9},
+        packed_counter_metadata {7063, 17927, 14},
+        packed_counter_metadata {7084, 17949, 3},
+        packed_counter_metadata {7119, 17973, 0},
+        packed_counter_metadata {7140, 17987, 3},
+        packed_counter_metadata {7174, 18004, 6},
+        packed_counter_metadata {7201, 18023, 3},
+        packed_counter_metadata {7235, 18040, 6},
+        packed_counter_metadata {7262, 18059, 14},
+        packed_counter_metadata {7288, 18072, 3},
+        packed_counter_metadata {7314, 18087, 9},
+        packed_counter_metadata {7339, 18099, 20},
+        packed_counter_metadata {7374, 18119, 9},
+        packed_counter_metadata {7404, 18143, 20},
+        packed_counter_metadata {7415, 18160, 9},
+        packed_counter_metadata {7436, 18181, 0},
+        packed_counter_metadata {7482, 18200, 2},
+        packed_counter_metadata {7525, 18219, 14},
+        packed_counter_metadata {7549, 18234, 9},
+        packed_counter_metadata {7593, 18253, 14},
+        packed_counter_metadata {7625, 18274, 9},
+        packed_counter_metadata {7677, 18299, 3},
+        packed_counter_metadata {7719, 18319, 3},
+        packed_counter_metadata {7750, 18338, 14},
+        packed_counter_metadata {7771, 18351, 14},
+        packed_counter_metadata {7802, 18367, 3},
+        packed_counter_metadata {7846, 18390, 14},
+        packed_counter_metadata {185, 18406, 4},
+        packed_counter_metadata {7886, 18424, 4},
+        packed_counter_metadata {7919, 18440, 9},
+        packed_counter_metadata {7940, 18459, 4},
+        packed_counter_metadata {7973, 18475, 9},
+        packed_counter_metadata {7994, 18494, 14},
+        packed_counter_metadata {8019, 18512, 4},
+        packed_counter_metadata {8052, 18528, 9},
+        packed_counter_metadata {8073, 18547, 4},
+        packed_counter_metadata {8099, 18567, 9},
+        packed_counter_metadata {8123, 18586, 12},
+        packed_counter_metadata {1943, 18605, 9},
+        packed_counter_metadata {8153, 18628, 3},
+        packed_counter_metadata {8180, 18652, 3},
+        packed_counter_metadata {8212, 18671, 9},
+        packed_counter_metadata {8252, 18691, 3},
+        packed_counter_metadata {8283, 18710, 3},
+        packed_counter_metadata {8328, 18730, 3},
+        packed_counter_metadata {8374, 18751, 0},
+        packed_counter_metadata {8401, 18763, 9},
+        packed_counter_metadata {8431, 18780, 0},
+        packed_counter_metadata {8459, 18793, 9},
+        packed_counter_metadata {8490, 18811, 6},
+        packed_counter_metadata {8507, 18825, 3},
+        packed_counter_metadata {8534, 18841, 9},
+        packed_counter_metadata {8558, 18853, 3},
+        packed_counter_metadata {8593, 18872, 3},
+        packed_counter_metadata {8628, 18891, 3},
+        packed_counter_metadata {8663, 18910, 3},
+        packed_counter_metadata {8698, 18929, 3},
+        packed_counter_metadata {8735, 18948, 9},
+        packed_counter_metadata {8770, 18963, 3},
+        packed_counter_metadata {8801, 18982, 3},
+        packed_counter_metadata {8832, 19001, 3},
+        packed_counter_metadata {8863, 19020, 3},
+        packed_counter_metadata {8894, 19039, 3},
+        packed_counter_metadata {8932, 19058, 9},
+        packed_counter_metadata {8968, 19073, 3},
+        packed_counter_metadata {8986, 19092, 9},
+        packed_counter_metadata {9014, 19107, 3},
+        packed_counter_metadata {9042, 19129, 3},
+        packed_counter_metadata {9078, 19156, 3},
+        packed_counter_metadata {9120, 19182, 3},
+        packed_counter_metadata {9159, 19207, 7},
+        packed_counter_metadata {9172, 19224, 15},
+        packed_counter_metadata {9186, 19242, 9},
+        packed_counter_metadata {9212, 19260, 3},
+        packed_counter_metadata {9239, 19277, 3},
+        packed_counter_metadata {9276, 19304, 3},
+        packed_counter_metadata {9316, 19329, 3},
+        packed_counter_metadata {9344, 19346, 3},
+        packed_counter_metadata {9368, 19370, 5},
+        packed_counter_metadata {9383, 19381, 14},
+        packed_counter_metadata {9420, 19404, 14},
+        packed_counter_metadata {9450, 19421, 3},
+        packed_counter_metadata {9472, 19440, 3},
+        packed_counter_metadata {9513, 19467, 3},
+        packed_counter_metadata {9540, 19489, 3},
+        packed_counter_metadata {9575, 19516, 3},
+        packed_counter_metadata {9613, 19541, 7},
+        packed_counter_metadata {9625, 19558, 15},
+        packed_counter_metadata {9638, 19576, 9},
+        packed_counter_metadata {9663, 19594, 3},
+        packed_counter_metadata {9689, 19611, 9},
+        packed_counter_metadata {9713, 19631, 4},
+        packed_counter_metadata {9744, 19650, 9},
+        packed_counter_metadata {9773, 19673, 12},
+        packed_counter_metadata {9797, 19694, 9},
+        packed_counter_metadata {9819, 19711, 3},
+        packed_counter_metadata {9841, 19730, 11},
+        packed_counter_metadata {9871, 19751, 9},
+        packed_counter_metadata {9905, 19772, 11},
+        packed_counter_metadata {9936, 19794, 9},
+        packed_counter_metadata {9965, 19816, 1},
+        packed_counter_metadata {9987, 19827, 8},
+        packed_counter_metadata {10023, 19842, 8},
+        packed_counter_metadata {10061, 19858, 8},
+        packed_counter_metadata {10097, 19873, 8},
+        packed_counter_metadata {10134, 19888, 3},
+        packed_counter_metadata {10170, 19906, 13},
+        packed_counter_metadata {10205, 19926, 3},
+        packed_counter_metadata {10235, 19941, 13},
+        packed_counter_metadata {10268, 19953, 16},
+        packed_counter_metadata {10305, 19973, 16},
+        packed_counter_metadata {10338, 19990, 13},
+        packed_counter_metadata {10363, 20001, 8},
+        packed_counter_metadata {10397, 20012, 8},
+        packed_counter_metadata {10438, 20027, 8},
+        packed_counter_metadata {10481, 20043, 8},
+        packed_counter_metadata {10522, 20058, 8},
+        packed_counter_metadata {10564, 20073, 3},
+        packed_counter_metadata {10605, 20091, 9},
+        packed_counter_metadata {10634, 20103, 3},
+        packed_counter_metadata {10668, 20128, 3},
+        packed_counter_metadata {10710, 20158, 3},
+        packed_counter_metadata {10755, 20186, 7},
+        packed_counter_metadata {10774, 20206, 15},
+        packed_counter_metadata {10794, 20227, 9},
+        packed_counter_metadata {10826, 20248, 3},
+        packed_counter_metadata {10859, 20268, 3},
+        packed_counter_metadata {10898, 20294, 9},
+        packed_counter_metadata {10935, 20316, 11},
+        packed_counter_metadata {10966, 20340, 9},
+        packed_counter_metadata {10995, 20364, 11},
+        packed_counter_metadata {11024, 20387, 3},
+        packed_counter_metadata {11049, 20404, 3},
+        packed_counter_metadata {11080, 20426, 3},
+        packed_counter_metadata {11119, 20453, 3},
+        packed_counter_metadata {11161, 20478, 7},
+        packed_counter_metadata {11177, 20495, 15},
+        packed_counter_metadata {11194, 20513, 9},
+        packed_counter_metadata {11223, 20531, 3},
+        packed_counter_metadata {11253, 20548, 9},
+        packed_counter_metadata {11276, 20561, 3},
+        packed_counter_metadata {11304, 20587, 3},
+        packed_counter_metadata {11332, 20608, 3},
+        packed_counter_metadata {11359, 20633, 3},
+        packed_counter_metadata {11392, 20652, 3},
+        packed_counter_metadata {11426, 20672, 3},
+        packed_counter_metadata {11459, 20687, 3},
+        packed_counter_metadata {11488, 20708, 3},
+        packed_counter_metadata {11519, 20731, 3},
+        packed_counter_metadata {11550, 20754, 6},
+        packed_counter_metadata {11584, 20774, 3},
+        packed_counter_metadata {11633, 20804, 3},
+        packed_counter_metadata {11668, 20823, 3},
+        packed_counter_metadata {11703, 20842, 3},
+        packed_counter_metadata {11752, 20862, 3},
+        packed_counter_metadata {11783, 20881, 3},
+        packed_counter_metadata {11814, 20900, 20},
+        packed_counter_metadata {11836, 20916, 3},
+        packed_counter_metadata {11871, 20942, 9},
+        packed_counter_metadata {11910, 20970, 3},
+        packed_counter_metadata {11941, 20997, 9},
+        packed_counter_metadata {11976, 21026, 3},
+        packed_counter_metadata {12012, 21050, 9},
+        packed_counter_metadata {12052, 21076, 3},
+        packed_counter_metadata {12083, 21096, 3},
+        packed_counter_metadata {12114, 21116, 3},
+        packed_counter_metadata {12147, 21138, 3},
+        packed_counter_metadata {12180, 21163, 9},
+        packed_counter_metadata {12217, 21190, 3},
+        packed_counter_metadata {12250, 21215, 9},
+        packed_counter_metadata {12287, 21242, 3},
+        packed_counter_metadata {12315, 21266, 9},
+        packed_counter_metadata {12347, 21292, 11},
+        packed_counter_metadata {12373, 21310, 3},
+        packed_counter_metadata {12405, 21334, 9},
+        packed_counter_metadata {12441, 21360, 17},
+        packed_counter_metadata {12468, 21379, 11},
+        packed_counter_metadata {12503, 21403, 9},
+        packed_counter_metadata {12549, 21431, 12},
+        packed_counter_metadata {12589, 21458, 12},
+        packed_counter_metadata {12619, 21480, 9},
+        packed_counter_metadata {12659, 21504, 11},
+        packed_counter_metadata {12694, 21524, 9},
+        packed_counter_metadata {12732, 21548, 9},
+        packed_counter_metadata {12778, 21576, 11},
+        packed_counter_metadata {12814, 21603, 12},
+        packed_counter_metadata {12844, 21625, 17},
+        packed_counter_metadata {12869, 21647, 20},
+        packed_counter_metadata {12892, 21667, 9},
+        packed_counter_metadata {12925, 21691, 11},
+        packed_counter_metadata {12952, 21704, 14},
+        packed_counter_metadata {12992, 21728, 14},
+        packed_counter_metadata {13031, 21752, 3},
+        packed_counter_metadata {13059, 21768, 9},
+        packed_counter_metadata {13086, 21781, 3},
+        packed_counter_metadata {13110, 21798, 9},
+        packed_counter_metadata {13133, 21812, 3},
+        packed_counter_metadata {13170, 21837, 9},
+        packed_counter_metadata {13211, 21864, 3},
+        packed_counter_metadata {13253, 21886, 3},
+        packed_counter_metadata {13284, 21902, 6},
+        packed_counter_metadata {13318, 21918, 6},
+        packed_counter_metadata {9965, 21935, 6},
+        packed_counter_metadata {13345, 21951, 14},
+        packed_counter_metadata {13372, 21967, 14},
+        packed_counter_metadata {13400, 21984, 14},
+        packed_counter_metadata {13431, 22005, 6},
+        packed_counter_metadata {13461, 22021, 14},
+        packed_counter_metadata {13495, 22045, 13},
+        packed_counter_metadata {13520, 22068, 13},
+        packed_counter_metadata {13548, 22090, 6},
+        packed_counter_metadata {13575, 22110, 6},
+        packed_counter_metadata {13612, 22125, 0},
+        packed_counter_metadata {13661, 22145, 2},
+        packed_counter_metadata {13710, 22165, 0},
+        packed_counter_metadata {13752, 22184, 2},
+    };
+
+} // namespace
+
+const char *get_counter_name(size_t index) { return string_pool + all_counter_metadata[index].name; }
+
+const char *get_counter_units(size_t index) {
+    return string_pool + units_offsets[all_counter_metadata[index].units];
+}
+
+const char *get_counter_identifier(size_t index) { return string_pool + all_counter_metadata[index].identifier; }
+
+size_t get_metadata_size() {
+    return sizeof(string_pool) + sizeof(units_offsets) + sizeof(all_counter_metadata) +
+           sizeof(all_counter_identifiers_sorted);
+}
+
+    /** The index of each identifier, in the byte order of the identifiers. */
+    constexpr std::array<uint16_t, 433> all_counter_identifiers_sorted {
+        0, 1, 267, 268, 2, 409, 410, 336, 337, 338, 339, 340, 341, 342, 411, 412,
+        269, 270, 271, 272, 368, 369, 370, 273, 274, 275, 276, 277, 278, 371, 372, 279,
+        280, 281, 282, 343, 344, 283, 284, 285, 286, 287, 288, 289, 290, 3, 228, 229,
+        307, 230, 231, 4, 373, 244, 374, 375, 376, 377, 245, 246, 5, 6, 247, 248,
+        249, 7, 378, 379, 308, 309, 413, 414, 250, 251, 252, 253, 380, 381, 382, 8,
+        415, 383, 384, 385, 386, 387, 388, 9, 10, 11, 12, 13, 14, 15, 16, 17,
+        18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33,
+        34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49,
+        389, 50, 51, 52, 53, 390, 391, 392, 54, 55, 56, 57, 58, 393, 394, 395,
+        396, 397, 398, 399, 400, 401, 402, 403, 404, 405, 406, 59, 291, 292, 60, 61,
+        62, 63, 64, 65, 66, 67, 293, 310, 254, 255, 68, 69, 70, 311, 71, 72,
+        73, 74, 75, 76, 77, 78, 79, 80, 312, 294, 81, 295, 82, 83, 84, 85,
+        313, 314, 86, 87, 88, 89, 315, 316, 90, 407, 91, 92, 93, 94, 95, 345,
+        346, 96, 97, 98, 408, 99, 100, 101, 347, 102, 103, 104, 105, 296, 297, 106,
+        298, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121,
+        122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137,
+        138, 139, 140, 141, 142, 348, 349, 350, 351, 352, 353, 354, 355, 356, 143, 144,
+        145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 416, 417, 418,
+        317, 318, 319, 320, 321, 419, 322, 420, 421, 323, 324, 325, 422, 326, 327, 423,
+        328, 424, 425, 426, 427, 329, 330, 331, 332, 333, 428, 334, 335, 158, 159, 160,
+        161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176,
+        177, 178, 179, 180, 181, 232, 233, 429, 430, 431, 432, 182, 183, 184, 185, 186,
+        187, 188, 189, 190, 234, 235, 191, 357, 192, 193, 194, 195, 358, 359, 196, 360,
+        361, 236, 237, 238, 256, 239, 257, 258, 197, 259, 260, 261, 262, 263, 362, 240,
+        198, 363, 364, 365, 241, 199, 264, 265, 266, 366, 242, 200, 201, 202, 203, 204,
+        205, 243, 206, 207, 208, 209, 210, 211, 212, 213, 367, 299, 214, 215, 216, 217,
+        218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 300, 301, 302, 303, 304, 305,
+        306
     };
 
 } // namespace database
 } // namespace hwcpipe
-
@@ -6,14 +6,36 @@
 
 #pragma once
 
-#include "hwcpipe/detail/internal_types.hpp"
-
 #include <array>
+#include <cstddef>
+#include <cstdint>
 
 namespace hwcpipe {
 namespace database {
 
-extern const std::array<counter_metadata, 433> all_counter_metadata;
+/** The number of counters in the database. */
+constexpr size_t num_counters = 433;
+
+/*
+ * The strings of the counters are packed in a string pool, and addressed with
+ * 16-bit offsets, so that the tables need no relocations. The units strings are
+ * interned. The strings are null terminated.
+ */
+
+/** @return The name of a counter, e.g. "GPU active cycles". */
+const char *get_counter_name(size_t index);
+
+/** @return The units of a counter, e.g. "cycles". */
+const char *get_counter_units(size_t index);
+
+/** @return The identifier of a counter, as spelled in hwcpipe_counter.h. */
+const char *get_counter_identifier(size_t index);
+
+/** @return The size in bytes of the string pool and metadata tables. */
+size_t get_metadata_size();
+
+/** The index of each identifier, in the byte order of the identifiers, for binary searches. */
+extern const std::array<uint16_t, 433> all_counter_identifiers_sorted;
 
 } // namespace database
 
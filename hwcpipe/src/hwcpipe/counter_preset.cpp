@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <hwcpipe/counter_preset.hpp>
+#include <hwcpipe/detail/counter_database.hpp>
+
+#include <memory>
+#include <mutex>
+#include <set>
+#include <system_error>
+
+namespace hwcpipe {
+namespace detail {
+
+namespace {
+
+/** The configuration of a preset for a GPU, once resolved. */
+struct preset_cache_entry {
+    counter_preset preset;
+    device::product_id pid;
+    std::unique_ptr<const preset_config> config;
+};
+
+/**
+ * Resolves the configuration of a preset for a GPU. The counters that the GPU
+ * doesn't support are left out, and the dependencies of the expressions are
+ * added as sampler_config::add_counter() does.
+ */
+std::unique_ptr<const preset_config> resolve(counter_preset preset, device::product_id pid) {
+    auto result = std::make_unique<preset_config>();
+
+    counter_database db{};
+    std::set<hwcpipe_counter> added{};
+    std::vector<hwcpipe_counter> pending{};
+
+    const auto counters = get_preset_counters(preset);
+    pending.assign(counters.data, counters.data + counters.size);
+
+    while (!pending.empty()) {
+        const auto counter = pending.back();
+        pending.pop_back();
+
+        if (!added.insert(counter).second) {
+            continue;
+        }
+
+        std::error_code ec;
+        auto definition = db.get_counter_def(pid, counter, ec);
+        if (ec) {
+            continue;
+        }
+
+        switch (definition.tag) {
+        case counter_definition::type::hardware: {
+            const auto &address = definition.get_address();
+            result->enable_maps[static_cast<size_t>(address.block_type)][address.offset] = true;
+            break;
+        }
+        case counter_definition::type::expression: {
+            const auto &dependencies = definition.get_expression().dependencies;
+            pending.insert(pending.end(), dependencies.begin(), dependencies.end());
+            break;
+        }
+        case counter_definition::type::invalid:
+        default:
+            continue;
+        }
+
+        result->counters.emplace_back(counter, std::move(definition));
+    }
+
+    return result;
+}
+
+} // namespace
+
+const preset_config &get_preset_config(counter_preset preset, device::product_id pid) {
+    static std::mutex lock{};
+    static std::vector<preset_cache_entry> cache{};
+
+    std::lock_guard<std::mutex> guard(lock);
+
+    for (const auto &entry : cache) {
+        if (entry.preset == preset && entry.pid == pid) {
+            return *entry.config;
+        }
+    }
+
+    cache.push_back({preset, pid, resolve(preset, pid)});
+    return *cache.back().config;
+}
+
+} // namespace detail
+} // namespace hwcpipe
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+// Generated by specification/lgcpy_export_hwcpipe_presets.py, do not edit.
+
+#include "hwcpipe/counter_preset.hpp"
+
+namespace hwcpipe {
+namespace detail {
+
+namespace {
+
+constexpr hwcpipe_counter frame_overview_counters[] = {
+    hwcpipe_counter::MaliGPUActiveCy,
+    hwcpipe_counter::MaliGPUActiveRawCy,
+    hwcpipe_counter::MaliGPUAnyQueueActiveCy,
+    hwcpipe_counter::MaliCompQueueActiveCy,
+    hwcpipe_counter::MaliNonFragQueueActiveCy,
+    hwcpipe_counter::MaliVertQueueActiveCy,
+    hwcpipe_counter::MaliFragQueueActiveCy,
+    hwcpipe_counter::MaliBinningQueueActiveCy,
+    hwcpipe_counter::MaliMainQueueActiveCy,
+    hwcpipe_counter::MaliResQueueActiveCy,
+    hwcpipe_counter::MaliTilerActiveCy,
+    hwcpipe_counter::MaliGPUIRQActiveCy,
+    hwcpipe_counter::MaliCompQueueUtil,
+    hwcpipe_counter::MaliNonFragQueueUtil,
+    hwcpipe_counter::MaliVertQueueUtil,
+    hwcpipe_counter::MaliFragQueueUtil,
+    hwcpipe_counter::MaliBinningQueueUtil,
+    hwcpipe_counter::MaliMainQueueUtil,
+    hwcpipe_counter::MaliTilerUtil,
+    hwcpipe_counter::MaliGPUIRQUtil,
+    hwcpipe_counter::MaliCompOrBinningUtil,
+    hwcpipe_counter::MaliNonFragUtil,
+    hwcpipe_counter::MaliFragUtil,
+    hwcpipe_counter::MaliMainUtil,
+    hwcpipe_counter::MaliFragFPKBUtil,
+    hwcpipe_counter::MaliCoreUtil,
+};
+
+constexpr hwcpipe_counter memory_bandwidth_counters[] = {
+    hwcpipe_counter::MaliExtBusRd,
+    hwcpipe_counter::MaliExtBusWr,
+    hwcpipe_counter::MaliExtBusRdNoSnoop,
+    hwcpipe_counter::MaliExtBusRdUnique,
+    hwcpipe_counter::MaliL2CacheIncSnp,
+    hwcpipe_counter::MaliExtBusWrNoSnoopFull,
+    hwcpipe_counter::MaliExtBusWrNoSnoopPart,
+    hwcpipe_counter::MaliExtBusWrSnoopFull,
+    hwcpipe_counter::MaliExtBusWrSnoopPart,
+    hwcpipe_counter::MaliExtBusRdBy,
+    hwcpipe_counter::MaliExtBusWrBy,
+    hwcpipe_counter::MaliExtBusRdStallRate,
+    hwcpipe_counter::MaliExtBusWrStallRate,
+    hwcpipe_counter::MaliL2CacheRd,
+    hwcpipe_counter::MaliL2CacheWr,
+    hwcpipe_counter::MaliL2CacheSnp,
+    hwcpipe_counter::MaliL2CacheCleanUnique,
+    hwcpipe_counter::MaliL2CacheEvict,
+    hwcpipe_counter::MaliL2CacheL1Rd,
+    hwcpipe_counter::MaliL2CacheL1Wr,
+    hwcpipe_counter::MaliL2CacheRdMissRate,
+    hwcpipe_counter::MaliL2CacheWrMissRate,
+    hwcpipe_counter::MaliSCBusFFEL2RdBy,
+    hwcpipe_counter::MaliSCBusLSL2RdBy,
+    hwcpipe_counter::MaliSCBusTexL2RdBy,
+    hwcpipe_counter::MaliSCBusLSWrBy,
+    hwcpipe_counter::MaliSCBusTileWrBy,
+    hwcpipe_counter::MaliSCBusOtherWrBy,
+    hwcpipe_counter::MaliSCBusFFEExtRdBy,
+    hwcpipe_counter::MaliSCBusLSExtRdBy,
+    hwcpipe_counter::MaliSCBusTexExtRdBy,
+    hwcpipe_counter::MaliSCBusRTUExtRdBy,
+};
+
+constexpr hwcpipe_counter shader_alu_counters[] = {
+    hwcpipe_counter::MaliALUUtil,
+    hwcpipe_counter::MaliLSUtil,
+    hwcpipe_counter::MaliVarUtil,
+    hwcpipe_counter::MaliTexUtil,
+    hwcpipe_counter::MaliRTUUtil,
+    hwcpipe_counter::MaliAttrUtil,
+    hwcpipe_counter::MaliBlendUtil,
+    hwcpipe_counter::MaliALUIssueCy,
+    hwcpipe_counter::MaliEngInstr,
+    hwcpipe_counter::MaliEngArithInstr,
+    hwcpipe_counter::MaliEngFMAInstr,
+    hwcpipe_counter::MaliEngCVTInstr,
+    hwcpipe_counter::MaliEngSFUInstr,
+    hwcpipe_counter::MaliEngDivergedInstr,
+    hwcpipe_counter::MaliEngNarrowInstr,
+    hwcpipe_counter::MaliEngSWBlendInstr,
+    hwcpipe_counter::MaliEngFMAPipeUtil,
+    hwcpipe_counter::MaliEngCVTPipeUtil,
+    hwcpipe_counter::MaliEngSFUPipeUtil,
+    hwcpipe_counter::MaliEngSlotAnyIssueCy,
+    hwcpipe_counter::MaliEngSlot0IssueCy,
+    hwcpipe_counter::MaliEngSlot1IssueCy,
+};
+
+constexpr hwcpipe_counter bottleneck_counters[] = {
+    hwcpipe_counter::MaliCompQueueUtil,
+    hwcpipe_counter::MaliNonFragQueueUtil,
+    hwcpipe_counter::MaliVertQueueUtil,
+    hwcpipe_counter::MaliFragQueueUtil,
+    hwcpipe_counter::MaliBinningQueueUtil,
+    hwcpipe_counter::MaliMainQueueUtil,
+    hwcpipe_counter::MaliTilerUtil,
+    hwcpipe_counter::MaliGPUIRQUtil,
+    hwcpipe_counter::MaliCompOrBinningUtil,
+    hwcpipe_counter::MaliNonFragUtil,
+    hwcpipe_counter::MaliFragUtil,
+    hwcpipe_counter::MaliMainUtil,
+    hwcpipe_counter::MaliFragFPKBUtil,
+    hwcpipe_counter::MaliCoreUtil,
+    hwcpipe_counter::MaliExtBusRdStallRate,
+    hwcpipe_counter::MaliExtBusWrStallRate,
+};
+
+} // namespace
+
+counter_span get_preset_counters(counter_preset preset) {
+    switch (preset) {
+    case counter_preset::frame_overview:
+        return {frame_overview_counters, sizeof(frame_overview_counters) / sizeof(frame_overview_counters[0])};
+    case counter_preset::memory_bandwidth:
+        return {memory_bandwidth_counters, sizeof(memory_bandwidth_counters) / sizeof(memory_bandwidth_counters[0])};
+    case counter_preset::shader_alu:
+        return {shader_alu_counters, sizeof(shader_alu_counters) / sizeof(shader_alu_counters[0])};
+    case counter_preset::bottleneck:
+        return {bottleneck_counters, sizeof(bottleneck_counters) / sizeof(bottleneck_counters[0])};
+    default:
+        return {nullptr, 0};
+    }
+}
+
+} // namespace detail
+} // namespace hwcpipe
@@ -0,0 +1,247 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <hwcpipe/counter_statistics.hpp>
+#include <hwcpipe/detail/column_codec.hpp>
+#include <hwcpipe/error.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+
+namespace hwcpipe {
+
+constexpr double quantile_sketch::min_value;
+constexpr double quantile_sketch::max_value;
+constexpr double counter_statistics::default_relative_accuracy;
+
+namespace {
+template <typename value_t>
+void append(std::vector<uint8_t> &output, const value_t &value) {
+    const size_t offset = output.size();
+    output.resize(offset + sizeof(value));
+    std::memcpy(output.data() + offset, &value, sizeof(value));
+}
+
+template <typename value_t>
+bool read(const uint8_t *&input, const uint8_t *end, value_t &value) {
+    if (static_cast<size_t>(end - input) < sizeof(value)) {
+        return false;
+    }
+    std::memcpy(&value, input, sizeof(value));
+    input += sizeof(value);
+    return true;
+}
+
+/** Appends the range of buckets that hold values, as a column. */
+void write_store(std::vector<uint8_t> &output, const std::vector<uint64_t> &buckets) {
+    summary_layout::store_header header{};
+    const auto first = std::find_if(buckets.begin(), buckets.end(), [](uint64_t count) { return count != 0; });
+    if (first == buckets.end()) {
+        append(output, header);
+        return;
+    }
+    const auto last = std::find_if(buckets.rbegin(), buckets.rend(), [](uint64_t count) { return count != 0; });
+    const auto num_buckets = static_cast<size_t>(last.base() - first);
+
+    const size_t offset = output.size();
+    output.resize(offset + sizeof(header) + detail::column_codec::max_encoded_size(num_buckets));
+    const size_t encoded_size =
+        detail::column_codec::encode(&*first, num_buckets, output.data() + offset + sizeof(header));
+
+    header.first_bucket = static_cast<uint32_t>(first - buckets.begin());
+    header.num_buckets = static_cast<uint32_t>(num_buckets);
+    header.encoded_size = static_cast<uint32_t>(encoded_size);
+    std::memcpy(output.data() + offset, &header, sizeof(header));
+    output.resize(offset + sizeof(header) + encoded_size);
+}
+
+/** Reads a store written by write_store(). */
+bool read_store(const uint8_t *&input, const uint8_t *end, std::vector<uint64_t> &buckets) {
+    summary_layout::store_header header{};
+    if (!read(input, end, header)) {
+        return false;
+    }
+    if (header.num_buckets == 0) {
+        return true;
+    }
+    if (size_t{header.first_bucket} + header.num_buckets > buckets.size() ||
+        static_cast<size_t>(end - input) < header.encoded_size) {
+        return false;
+    }
+    const uint8_t *column_end = input + header.encoded_size;
+    if (detail::column_codec::decode(input, column_end, header.num_buckets, buckets.data() + header.first_bucket) ==
+        nullptr) {
+        return false;
+    }
+    input = column_end;
+    return true;
+}
+} // namespace
+
+quantile_sketch::quantile_sketch(double relative_accuracy)
+    : relative_accuracy_(relative_accuracy)
+    , gamma_((1 + relative_accuracy) / (1 - relative_accuracy))
+    , multiplier_(1 / std::log(gamma_))
+    , min_key_(std::ceil(std::log(min_value) * multiplier_)) {
+    const double max_key = std::ceil(std::log(max_value) * multiplier_);
+    const auto num_buckets = static_cast<size_t>(max_key - min_key_) + 1;
+    positive_.resize(num_buckets);
+    negative_.resize(num_buckets);
+}
+
+double quantile_sketch::quantile(double q) const {
+    if (count_ == 0) {
+        return 0;
+    }
+    const double rank = std::min(std::max(q, 0.0), 1.0) * static_cast<double>(count_ - 1);
+
+    // the negative values come first, largest magnitude first
+    uint64_t seen = 0;
+    for (size_t i = negative_.size(); i-- != 0;) {
+        seen += negative_[i];
+        if (static_cast<double>(seen) > rank) {
+            return -bucket_value(i);
+        }
+    }
+    seen += zero_count_;
+    if (static_cast<double>(seen) > rank) {
+        return 0;
+    }
+    for (size_t i = 0; i != positive_.size(); ++i) {
+        seen += positive_[i];
+        if (static_cast<double>(seen) > rank) {
+            return bucket_value(i);
+        }
+    }
+    return bucket_value(positive_.size() - 1);
+}
+
+std::error_code quantile_sketch::merge(const quantile_sketch &other) {
+    if (other.relative_accuracy_ != relative_accuracy_) {
+        return make_error_code(errc::statistics_mismatch);
+    }
+    count_ += other.count_;
+    zero_count_ += other.zero_count_;
+    for (size_t i = 0; i != positive_.size(); ++i) {
+        positive_[i] += other.positive_[i];
+        negative_[i] += other.negative_[i];
+    }
+    return {};
+}
+
+void quantile_sketch::clear() {
+    count_ = 0;
+    zero_count_ = 0;
+    std::fill(positive_.begin(), positive_.end(), 0);
+    std::fill(negative_.begin(), negative_.end(), 0);
+}
+
+double quantile_sketch::bucket_value(size_t index) const {
+    // the value whose relative error to both bounds of the bucket is the
+    // relative accuracy
+    return 2 * std::pow(gamma_, static_cast<double>(index) + min_key_) / (gamma_ + 1);
+}
+
+counter_statistics::counter_statistics(const hwcpipe_counter *counters, size_t count, double relative_accuracy)
+    : relative_accuracy_(relative_accuracy)
+    , counters_(counters, counters + count)
+    , stats_(count)
+    , sketches_(count, quantile_sketch(relative_accuracy))
+    , staging_(count) {}
+
+std::error_code counter_statistics::merge(const counter_statistics &other) {
+    if (other.relative_accuracy_ != relative_accuracy_ || other.counters_ != counters_) {
+        return make_error_code(errc::statistics_mismatch);
+    }
+    for (size_t i = 0; i != counters_.size(); ++i) {
+        stats_[i].merge(other.stats_[i]);
+        const auto ec = sketches_[i].merge(other.sketches_[i]);
+        static_cast<void>(ec);
+    }
+    return {};
+}
+
+void counter_statistics::clear() {
+    std::fill(stats_.begin(), stats_.end(), running_stats{});
+    for (auto &sketch : sketches_) {
+        sketch.clear();
+    }
+}
+
+void counter_statistics::serialize(std::vector<uint8_t> &output) const {
+    output.clear();
+
+    summary_layout::summary_header header{};
+    header.magic = summary_layout::magic;
+    header.version_major = summary_layout::version_major;
+    header.version_minor = summary_layout::version_minor;
+    header.num_counters = static_cast<uint32_t>(counters_.size());
+    header.relative_accuracy = relative_accuracy_;
+    append(output, header);
+
+    for (size_t i = 0; i != counters_.size(); ++i) {
+        const auto &stats = stats_[i];
+        const auto &sketch = sketches_[i];
+        summary_layout::counter_entry entry{};
+        entry.counter = static_cast<uint32_t>(counters_[i]);
+        entry.count = stats.count;
+        entry.mean = stats.mean;
+        entry.m2 = stats.m2;
+        entry.min = stats.min;
+        entry.max = stats.max;
+        entry.zero_count = sketch.zero_count_;
+        append(output, entry);
+        write_store(output, sketch.positive_);
+        write_store(output, sketch.negative_);
+    }
+}
+
+counter_statistics counter_statistics::deserialize(const void *data, size_t size, std::error_code &ec) {
+    ec = make_error_code(errc::invalid_statistics_layout);
+    counter_statistics result(nullptr, 0);
+
+    const auto *input = static_cast<const uint8_t *>(data);
+    const uint8_t *end = input + size;
+    summary_layout::summary_header header{};
+    if (data == nullptr || !read(input, end, header) || header.magic != summary_layout::magic ||
+        header.version_major != summary_layout::version_major || !(header.relative_accuracy > 0) ||
+        !(header.relative_accuracy < 1)) {
+        return result;
+    }
+
+    // every counter takes at least an entry and two empty stores
+    constexpr size_t min_counter_size =
+        sizeof(summary_layout::counter_entry) + 2 * sizeof(summary_layout::store_header);
+    if (static_cast<size_t>(end - input) / min_counter_size < header.num_counters) {
+        return result;
+    }
+
+    std::vector<hwcpipe_counter> counters(header.num_counters);
+    counter_statistics stats(counters.data(), counters.size(), header.relative_accuracy);
+    for (size_t i = 0; i != header.num_counters; ++i) {
+        summary_layout::counter_entry entry{};
+        auto &sketch = stats.sketches_[i];
+        if (!read(input, end, entry) || !read_store(input, end, sketch.positive_) ||
+            !read_store(input, end, sketch.negative_)) {
+            return result;
+        }
+
+        stats.counters_[i] = static_cast<hwcpipe_counter>(entry.counter);
+        stats.stats_[i] = {entry.count, entry.mean, entry.m2, entry.min, entry.max};
+        sketch.zero_count_ = entry.zero_count;
+        sketch.count_ = entry.zero_count;
+        for (size_t k = 0; k != sketch.positive_.size(); ++k) {
+            sketch.count_ += sketch.positive_[k] + sketch.negative_[k];
+        }
+    }
+
+    ec = {};
+    return stats;
+}
+
+} // namespace hwcpipe
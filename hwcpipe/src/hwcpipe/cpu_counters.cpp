@@ -0,0 +1,353 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <hwcpipe/cpu_counters.hpp>
+#include <hwcpipe/error.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdlib>
+#include <fstream>
+#include <utility>
+
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(__aarch64__)
+#define HWCPIPE_CPU_COUNTERS_RDPMC 1
+#endif
+
+namespace hwcpipe {
+
+namespace {
+
+constexpr size_t max_cpus = 64;
+
+uint64_t event_config(cpu_event event) {
+    switch (event) {
+    case cpu_event::cycles:
+        return PERF_COUNT_HW_CPU_CYCLES;
+    case cpu_event::instructions:
+        return PERF_COUNT_HW_INSTRUCTIONS;
+    case cpu_event::cache_references:
+        return PERF_COUNT_HW_CACHE_REFERENCES;
+    case cpu_event::cache_misses:
+        return PERF_COUNT_HW_CACHE_MISSES;
+    case cpu_event::branch_instructions:
+        return PERF_COUNT_HW_BRANCH_INSTRUCTIONS;
+    case cpu_event::branch_misses:
+        return PERF_COUNT_HW_BRANCH_MISSES;
+    default:
+        return PERF_COUNT_HW_CPU_CYCLES;
+    }
+}
+
+int perf_event_open(perf_event_attr &attr, pid_t pid, int cpu, int group_fd) {
+    return static_cast<int>(::syscall(SYS_perf_event_open, &attr, pid, cpu, group_fd, PERF_FLAG_FD_CLOEXEC));
+}
+
+bool read_line(const std::string &path, std::string &line) {
+    std::ifstream file(path);
+    return file && std::getline(file, line);
+}
+
+#if defined(HWCPIPE_CPU_COUNTERS_RDPMC)
+/** Reads hardware counter @p index of the CPU the thread runs on. */
+uint64_t read_pmc(uint32_t index) {
+#if defined(__aarch64__)
+    uint64_t value{};
+    if (index == 31) {
+        // the cycle counter
+        asm volatile("mrs %0, pmccntr_el0" : "=r"(value));
+    } else {
+        asm volatile("msr pmselr_el0, %0" : : "r"(static_cast<uint64_t>(index)));
+        asm volatile("isb" : : : "memory");
+        asm volatile("mrs %0, pmxevcntr_el0" : "=r"(value));
+    }
+    return value;
+#else
+    return __builtin_ia32_rdpmc(static_cast<int>(index));
+#endif
+}
+#endif
+
+} // namespace
+
+namespace detail {
+
+uint64_t parse_cpu_list(const std::string &list) {
+    uint64_t mask{};
+    const char *position = list.c_str();
+    while (*position != '\0') {
+        char *end{};
+        const unsigned long first = std::strtoul(position, &end, 10);
+        if (end == position) {
+            // a separator
+            ++position;
+            continue;
+        }
+        unsigned long last = first;
+        position = end;
+        if (*position == '-') {
+            last = std::strtoul(position + 1, &end, 10);
+            position = end;
+        }
+        for (unsigned long cpu = first; cpu <= last && cpu < max_cpus; ++cpu) {
+            mask |= uint64_t{1} << cpu;
+        }
+    }
+    return mask;
+}
+
+} // namespace detail
+
+std::vector<uint64_t> find_cpu_clusters(const std::string &cpu_dir) {
+    // the key of each cluster and its CPUs
+    std::vector<std::pair<std::string, uint64_t>> clusters{};
+
+    for (size_t cpu = 0; cpu != max_cpus; ++cpu) {
+        const std::string path = cpu_dir + "/cpu" + std::to_string(cpu);
+        if (::access(path.c_str(), F_OK) != 0) {
+            continue;
+        }
+
+        std::string key{};
+        std::string line{};
+        if (read_line(path + "/cpufreq/related_cpus", line)) {
+            key = "related:" + std::to_string(detail::parse_cpu_list(line));
+        } else if (read_line(path + "/cpu_capacity", line)) {
+            key = "capacity:" + line;
+        }
+
+        auto found = std::find_if(clusters.begin(), clusters.end(),
+                                  [&key](const std::pair<std::string, uint64_t> &cluster) {
+                                      return cluster.first == key;
+                                  });
+        if (found == clusters.end()) {
+            clusters.emplace_back(key, 0);
+            found = clusters.end() - 1;
+        }
+        found->second |= uint64_t{1} << cpu;
+    }
+
+    std::vector<uint64_t> result{};
+    for (const auto &cluster : clusters) {
+        result.push_back(cluster.second);
+    }
+    return result;
+}
+
+cpu_counters::cpu_counters(const cpu_event *events, size_t count, cpu_counter_scope scope)
+    : events_(events, events + count)
+    , owner_(std::this_thread::get_id())
+    , page_size_(static_cast<size_t>(::sysconf(_SC_PAGESIZE)))
+    , read_buffer_(3 + count) {
+    if (count == 0) {
+        ec_ = make_error_code(errc::cpu_counters_unavailable);
+        return;
+    }
+
+    if (scope == cpu_counter_scope::calling_thread) {
+        clusters_.push_back(0);
+        ec_ = open_group(-1, 0, true);
+        return;
+    }
+
+    clusters_ = find_cpu_clusters();
+    for (size_t cluster = 0; cluster != clusters_.size(); ++cluster) {
+        for (size_t cpu = 0; cpu != max_cpus; ++cpu) {
+            if ((clusters_[cluster] & (uint64_t{1} << cpu)) == 0) {
+                continue;
+            }
+            auto ec = open_group(static_cast<int>(cpu), cluster, false);
+            // offline CPUs are not counted
+            if (ec && errno != ENODEV) {
+                ec_ = ec;
+                return;
+            }
+        }
+    }
+    if (groups_.empty()) {
+        ec_ = make_error_code(errc::cpu_counters_unavailable);
+    }
+}
+
+cpu_counters::~cpu_counters() {
+    for (auto &events : groups_) {
+        for (auto *page : events.pages) {
+            ::munmap(page, page_size_);
+        }
+        // the members first
+        for (auto fd = events.fds.rbegin(); fd != events.fds.rend(); ++fd) {
+            ::close(*fd);
+        }
+    }
+}
+
+std::error_code cpu_counters::open_group(int cpu, size_t cluster, bool map) {
+    group events{cluster, {}, {}};
+
+    const auto fail = [this, &events]() {
+        const int saved_errno = errno;
+        for (auto *page : events.pages) {
+            ::munmap(page, page_size_);
+        }
+        for (const auto fd : events.fds) {
+            ::close(fd);
+        }
+        errno = saved_errno;
+        return make_error_code(errc::cpu_counters_unavailable);
+    };
+
+    for (const auto event : events_) {
+        perf_event_attr attr{};
+        attr.size = sizeof(attr);
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = event_config(event);
+        attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+        // the group is enabled once complete
+        attr.disabled = events.fds.empty() ? 1 : 0;
+        // counting the calling thread doesn't need privileges if the kernel is excluded
+        attr.exclude_kernel = map ? 1 : 0;
+        attr.exclude_hv = 1;
+#if defined(__aarch64__)
+        // asks for user space access to the counter, see the rdpmc format of the arm_pmuv3 driver
+        if (map) {
+            attr.config1 = 1U << 1U;
+        }
+#endif
+
+        const int group_fd = events.fds.empty() ? -1 : events.fds.front();
+        const int fd = perf_event_open(attr, map ? 0 : -1, cpu, group_fd);
+        if (fd < 0) {
+            return fail();
+        }
+        events.fds.push_back(fd);
+
+        if (map) {
+            void *page = ::mmap(nullptr, page_size_, PROT_READ, MAP_SHARED, fd, 0);
+            // without a mapping, the group is read with read()
+            if (page != MAP_FAILED) {
+                events.pages.push_back(page);
+            }
+        }
+    }
+    if (events.pages.size() != events.fds.size()) {
+        for (auto *page : events.pages) {
+            ::munmap(page, page_size_);
+        }
+        events.pages.clear();
+    }
+
+    if (::ioctl(events.fds.front(), PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP) != 0) {
+        return fail();
+    }
+
+    groups_.push_back(std::move(events));
+    return {};
+}
+
+bool cpu_counters::uses_rdpmc() const {
+#if defined(HWCPIPE_CPU_COUNTERS_RDPMC)
+    if (ec_ || groups_.size() != 1 || groups_.front().pages.empty() || std::this_thread::get_id() != owner_) {
+        return false;
+    }
+    const auto *page = static_cast<const volatile perf_event_mmap_page *>(groups_.front().pages.front());
+    return page->cap_user_rdpmc != 0;
+#else
+    return false;
+#endif
+}
+
+std::error_code cpu_counters::read(uint64_t *values) {
+    if (ec_) {
+        return ec_;
+    }
+
+    std::fill(values, values + size(), 0);
+    for (const auto &events : groups_) {
+        uint64_t *cluster_values = values + events.cluster * events_.size();
+        if (read_user(events, cluster_values)) {
+            continue;
+        }
+        // only the calling thread group is mapped, and read_user() may have added some of its values
+        if (!events.pages.empty()) {
+            std::fill(cluster_values, cluster_values + events_.size(), 0);
+        }
+        if (!read_group(events, cluster_values)) {
+            return make_error_code(errc::cpu_counters_unavailable);
+        }
+    }
+    return {};
+}
+
+bool cpu_counters::read_user(const group &events, uint64_t *values) const {
+#if defined(HWCPIPE_CPU_COUNTERS_RDPMC)
+    if (events.pages.empty() || std::this_thread::get_id() != owner_) {
+        return false;
+    }
+
+    for (size_t i = 0; i != events.pages.size(); ++i) {
+        const auto *page = static_cast<const volatile perf_event_mmap_page *>(events.pages[i]);
+        uint32_t sequence{};
+        int64_t count{};
+        // the kernel updates the page when the event is scheduled, and bumps the lock around the update
+        do {
+            sequence = page->lock;
+            std::atomic_signal_fence(std::memory_order_seq_cst);
+
+            const uint32_t index = page->index;
+            const uint16_t width = page->pmc_width;
+            if (page->cap_user_rdpmc == 0 || index == 0 || width == 0 || width > 64) {
+                return false;
+            }
+
+            // the counter is width bits wide and sign extended
+            const unsigned shift = 64U - width;
+            const auto pmc = static_cast<int64_t>(read_pmc(index - 1) << shift) >> shift;
+            count = page->offset + pmc;
+
+            std::atomic_signal_fence(std::memory_order_seq_cst);
+        } while (page->lock != sequence);
+
+        values[i] += static_cast<uint64_t>(count);
+    }
+    return true;
+#else
+    static_cast<void>(events);
+    static_cast<void>(values);
+    return false;
+#endif
+}
+
+bool cpu_counters::read_group(const group &events, uint64_t *values) {
+    // the number of values, the enabled and running times, then the values
+    const auto size = static_cast<ssize_t>(read_buffer_.size() * sizeof(uint64_t));
+    if (::read(events.fds.front(), read_buffer_.data(), static_cast<size_t>(size)) != size ||
+        read_buffer_[0] != events_.size()) {
+        return false;
+    }
+
+    const uint64_t enabled = read_buffer_[1];
+    const uint64_t running = read_buffer_[2];
+    for (size_t i = 0; i != events_.size(); ++i) {
+        uint64_t value = read_buffer_[3 + i];
+        // the PMU was shared with other events, the count is extrapolated
+        if (running != enabled) {
+            value = running == 0 ? 0
+                                 : static_cast<uint64_t>(static_cast<double>(value) * static_cast<double>(enabled) /
+                                                         static_cast<double>(running));
+        }
+        values[i] += value;
+    }
+    return true;
+}
+
+} // namespace hwcpipe
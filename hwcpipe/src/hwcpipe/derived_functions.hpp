@@ -12,6 +12,7 @@ namespace hwcpipe {
 namespace database {
 
     using context = hwcpipe::detail::expression::context;
+    using device_constants = hwcpipe::detail::expression::device_constants;
 
     double MaliALUIssueCy_v0(const context &ctx);
     double MaliALUIssueCy_v1(const context &ctx);
@@ -252,6 +253,200 @@ namespace database {
     double MaliSCBusRTUExtRdBy_v0(const context &ctx);
     double MaliSCBusRTUL2RdBy_v0(const context &ctx);
 
+    double formula_0_flat(const double *inputs, const device_constants &constants);
+    double formula_1_flat(const double *inputs, const device_constants &constants);
+    double formula_2_flat(const double *inputs, const device_constants &constants);
+    double formula_3_flat(const double *inputs, const device_constants &constants);
+    double formula_4_flat(const double *inputs, const device_constants &constants);
+    double formula_5_flat(const double *inputs, const device_constants &constants);
+    double formula_6_flat(const double *inputs, const device_constants &constants);
+    double formula_7_flat(const double *inputs, const device_constants &constants);
+    double formula_8_flat(const double *inputs, const device_constants &constants);
+    double formula_9_flat(const double *inputs, const device_constants &constants);
+    double formula_10_flat(const double *inputs, const device_constants &constants);
+    double formula_11_flat(const double *inputs, const device_constants &constants);
+    double formula_12_flat(const double *inputs, const device_constants &constants);
+    double formula_13_flat(const double *inputs, const device_constants &constants);
+    double formula_14_flat(const double *inputs, const device_constants &constants);
+    double formula_15_flat(const double *inputs, const device_constants &constants);
+    double formula_16_flat(const double *inputs, const device_constants &constants);
+    double formula_17_flat(const double *inputs, const device_constants &constants);
+    double formula_18_flat(const double *inputs, const device_constants &constants);
+    double formula_19_flat(const double *inputs, const device_constants &constants);
+    double formula_20_flat(const double *inputs, const device_constants &constants);
+    double formula_21_flat(const double *inputs, const device_constants &constants);
+    double formula_22_flat(const double *inputs, const device_constants &constants);
+    double formula_23_flat(const double *inputs, const device_constants &constants);
+    double formula_24_flat(const double *inputs, const device_constants &constants);
+    double formula_25_flat(const double *inputs, const device_constants &constants);
+    double formula_26_flat(const double *inputs, const device_constants &constants);
+    double formula_27_flat(const double *inputs, const device_constants &constants);
+    double formula_28_flat(const double *inputs, const device_constants &constants);
+    double formula_29_flat(const double *inputs, const device_constants &constants);
+    double formula_30_flat(const double *inputs, const device_constants &constants);
+    double formula_31_flat(const double *inputs, const device_constants &constants);
+    double formula_32_flat(const double *inputs, const device_constants &constants);
+    double formula_33_flat(const double *inputs, const device_constants &constants);
+    double formula_34_flat(const double *inputs, const device_constants &constants);
+    double formula_35_flat(const double *inputs, const device_constants &constants);
+    double formula_36_flat(const double *inputs, const device_constants &constants);
+    double formula_37_flat(const double *inputs, const device_constants &constants);
+    double formula_38_flat(const double *inputs, const device_constants &constants);
+    double formula_39_flat(const double *inputs, const device_constants &constants);
+    double formula_40_flat(const double *inputs, const device_constants &constants);
+    double formula_41_flat(const double *inputs, const device_constants &constants);
+    double formula_42_flat(const double *inputs, const device_constants &constants);
+    double formula_43_flat(const double *inputs, const device_constants &constants);
+    double formula_44_flat(const double *inputs, const device_constants &constants);
+    double formula_45_flat(const double *inputs, const device_constants &constants);
+    double formula_46_flat(const double *inputs, const device_constants &constants);
+    double formula_47_flat(const double *inputs, const device_constants &constants);
+    double formula_48_flat(const double *inputs, const device_constants &constants);
+    double formula_49_flat(const double *inputs, const device_constants &constants);
+    double formula_50_flat(const double *inputs, const device_constants &constants);
+    double formula_51_flat(const double *inputs, const device_constants &constants);
+    double formula_52_flat(const double *inputs, const device_constants &constants);
+    double formula_53_flat(const double *inputs, const device_constants &constants);
+    double formula_54_flat(const double *inputs, const device_constants &constants);
+    double formula_55_flat(const double *inputs, const device_constants &constants);
+    double formula_56_flat(const double *inputs, const device_constants &constants);
+    double formula_57_flat(const double *inputs, const device_constants &constants);
+    double formula_58_flat(const double *inputs, const device_constants &constants);
+    double formula_59_flat(const double *inputs, const device_constants &constants);
+    double formula_60_flat(const double *inputs, const device_constants &constants);
+    double formula_61_flat(const double *inputs, const device_constants &constants);
+    double formula_62_flat(const double *inputs, const device_constants &constants);
+    double formula_63_flat(const double *inputs, const device_constants &constants);
+    double formula_64_flat(const double *inputs, const device_constants &constants);
+    double formula_65_flat(const double *inputs, const device_constants &constants);
+    double formula_66_flat(const double *inputs, const device_constants &constants);
+    double formula_67_flat(const double *inputs, const device_constants &constants);
+    double formula_68_flat(const double *inputs, const device_constants &constants);
+    double formula_69_flat(const double *inputs, const device_constants &constants);
+    double formula_70_flat(const double *inputs, const device_constants &constants);
+    double formula_71_flat(const double *inputs, const device_constants &constants);
+    double formula_72_flat(const double *inputs, const device_constants &constants);
+    double formula_73_flat(const double *inputs, const device_constants &constants);
+    double formula_74_flat(const double *inputs, const device_constants &constants);
+    double formula_75_flat(const double *inputs, const device_constants &constants);
+    double formula_76_flat(const double *inputs, const device_constants &constants);
+    double formula_77_flat(const double *inputs, const device_constants &constants);
+    double formula_78_flat(const double *inputs, const device_constants &constants);
+    double formula_79_flat(const double *inputs, const device_constants &constants);
+    double formula_80_flat(const double *inputs, const device_constants &constants);
+    double formula_81_flat(const double *inputs, const device_constants &constants);
+    double formula_82_flat(const double *inputs, const device_constants &constants);
+    double formula_83_flat(const double *inputs, const device_constants &constants);
+    double formula_84_flat(const double *inputs, const device_constants &constants);
+    double formula_85_flat(const double *inputs, const device_constants &constants);
+    double formula_86_flat(const double *inputs, const device_constants &constants);
+    double formula_87_flat(const double *inputs, const device_constants &constants);
+    double formula_88_flat(const double *inputs, const device_constants &constants);
+    double formula_89_flat(const double *inputs, const device_constants &constants);
+    double formula_90_flat(const double *inputs, const device_constants &constants);
+    double formula_91_flat(const double *inputs, const device_constants &constants);
+    double formula_92_flat(const double *inputs, const device_constants &constants);
+    double formula_93_flat(const double *inputs, const device_constants &constants);
+    double formula_94_flat(const double *inputs, const device_constants &constants);
+    double formula_95_flat(const double *inputs, const device_constants &constants);
+
+    void formula_0_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_1_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_2_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_3_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_4_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_5_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_6_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_7_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_8_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_9_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_10_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_11_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_12_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_13_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_14_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_15_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_16_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_17_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_18_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_19_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_20_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_21_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_22_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_23_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_24_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_25_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_26_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_27_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_28_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_29_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_30_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_31_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_32_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_33_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_34_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_35_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_36_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_37_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_38_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_39_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_40_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_41_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_42_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_43_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_44_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_45_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_46_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_47_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_48_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_49_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_50_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_51_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_52_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_53_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_54_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_55_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_56_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_57_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_58_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_59_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_60_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_61_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_62_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_63_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_64_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_65_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_66_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_67_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_68_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_69_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_70_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_71_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_72_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_73_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_74_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_75_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_76_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_77_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_78_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_79_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_80_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_81_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_82_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_83_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_84_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_85_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_86_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_87_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_88_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_89_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_90_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_91_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_92_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_93_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_94_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+    void formula_95_batch(const double *const *inputs, size_t count, const device_constants &constants, double *results);
+
 
 } // namespace database
 
@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2023-2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <algorithm>
+
+#include "hwcpipe/derived_functions.hpp"
+
+namespace hwcpipe {
+namespace database {
+
+    using hwcpipe_double = detail::hwcpipe_double;
+
+    double MaliALUIssueCy_v0(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliEngInstr);    hwcpipe_double result = v0;    return result;}
+    double MaliALUUtil_v0(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliEngInstr);    hwcpipe_double v1 = ctx.get_counter_value(MaliCoreActiveCy);    hwcpipe_double result = (v0 / v1) * 100;    return result;}
+    double MaliEngDivergedInstrRate_v0(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliEngDivergedInstr);    hwcpipe_double v1 = ctx.get_counter_value(MaliEngInstr);    hwcpipe_double result = (v0 / v1) * 100;    return result;}
+    double MaliFragFPKKillQd_v0(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliFragRastQd);    hwcpipe_double v1 = ctx.get_counter_value(MaliFragEZSKillQd);    hwcpipe_double v2 = ctx.get_counter_value(MaliFragWarp);    hwcpipe_double result = v0 - v1 - v2;    return result;}
+    double MaliFragFPKKillQd_v1(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliFragRastQd);    hwcpipe_double v1 = ctx.get_counter_value(MaliFragEZSKillQd);    hwcpipe_double v2 = ctx.get_counter_value(MaliFragWarp);    hwcpipe_double result = v0 - v1 - ((v2 * 8) / 4);    return result;}
+    double MaliFragFPKKillRate_v0(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliFragRastQd);    hwcpipe_double v1 = ctx.get_counter_value(MaliFragEZSKillQd);    hwcpipe_double v2 = ctx.get_counter_value(MaliFragWarp);    hwcpipe_double result = ((v0 - v1 - v2) / v0) * 100;    return result;}
+    double MaliFragFPKKillRate_v1(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliFragRastQd);    hwcpipe_double v1 = ctx.get_counter_value(MaliFragEZSKillQd);    hwcpipe_double v2 = ctx.get_counter_value(MaliFragWarp);    hwcpipe_double result = ((v0 - v1 - ((v2 * 8) / 4)) / v0) * 100;    return result;}
+    double MaliFragOverdraw_v0(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliFragWarp);    hwcpipe_double v1 = ctx.get_counter_value(MaliFragQueueTask);    hwcpipe_double result = (v0 * 4) / (v1 * 32 * 32);    return result;}
+    double MaliFragOverdraw_v1(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliFragWarp);    hwcpipe_double v1 = ctx.get_counter_value(MaliFragQueueTask);    hwcpipe_double result = (v0 * 8) / (v1 * 32 * 32);    return result;}
+    double MaliFragPartWarpRate_v0(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliFragPartWarp);    hwcpipe_double v1 = ctx.get_counter_value(MaliFragWarp);    hwcpipe_double result = (v0 / v1) * 100;    return result;}
+    double MaliFragShadedQd_v0(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliFragWarp);    hwcpipe_double result = v0;    return result;}
+    double MaliFragShadedQd_v1(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliFragWarp);    hwcpipe_double result = (v0 * 8) / 4;    return result;}
+    double MaliFragThread_v0(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliFragWarp);    hwcpipe_double result = v0 * 4;    return result;}
+    double MaliFragThread_v1(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliFragWarp);    hwcpipe_double result = v0 * 8;    return result;}
+    double MaliFragThroughputCy_v0(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliFragActiveCy);    hwcpipe_double v1 = ctx.get_counter_value(MaliFragWarp);    hwcpipe_double result = v0 / (v1 * 4);    return result;}
+    double MaliFragThroughputCy_v1(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliFragActiveCy);    hwcpipe_double v1 = ctx.get_counter_value(MaliFragWarp);    hwcpipe_double result = v0 / (v1 * 8);    return result;}
+    double MaliNonFragThread_v0(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliNonFragWarp);    hwcpipe_double result = v0 * 4;    return result;}
+    double MaliNonFragThread_v1(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliNonFragWarp);    hwcpipe_double result = v0 * 8;    return result;}
+    double MaliNonFragThroughputCy_v0(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliNonFragActiveCy);    hwcpipe_double v1 = ctx.get_counter_value(MaliNonFragWarp);    hwcpipe_double result = v0 / (v1 * 4);    return result;}
+    double MaliNonFragThroughputCy_v1(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliNonFragActiveCy);    hwcpipe_double v1 = ctx.get_counter_value(MaliNonFragWarp);    hwcpipe_double result = v0 / (v1 * 8);    return result;}
+    double MaliTexCPI_v0(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliTexFiltIssueCy);    hwcpipe_double v1 = ctx.get_counter_value(MaliTexQuads);    hwcpipe_double result = v0 / (v1 * 4);    return result;}
+    double MaliTexCPI_v1(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliTexFiltIssueCy);    hwcpipe_double v1 = ctx.get_counter_value(MaliTexInstr);    hwcpipe_double result = v0 / v1;    return result;}
+    double MaliTexCacheCompressFetchRate_v0(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliTexCacheCompressFetch);    hwcpipe_double v1 = ctx.get_counter_value(MaliTexCacheFetch);    hwcpipe_double result = (v0 / v1) * 100;    return result;}
+    double MaliTexCacheUtil_v0(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliTexCacheLookup);    hwcpipe_double v1 = ctx.get_counter_value(MaliCoreActiveCy);    hwcpipe_double result = (v0 / v1) * 100;    return result;}
+    double MaliTexMipInstrRate_v0(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliTexQuadPassMip);    hwcpipe_double v1 = ctx.get_counter_value(MaliTexQuadPass);    hwcpipe_double result = (v0 / v1) * 100;    return result;}
+    double MaliTexMipInstrRate_v1(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliTexMipInstr);    hwcpipe_double v1 = ctx.get_counter_value(MaliTexInstr);    hwcpipe_double result = (v0 / v1) * 100;    return result;}
+    double MaliTexSample_v0(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliTexQuads);    hwcpipe_double result = v0 * 4;    return result;}
+    double MaliTexSample_v1(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliTexInstr);    hwcpipe_double result = v0;    return result;}
+    double MaliTexTriInstrRate_v0(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliTexQuadPassTri);    hwcpipe_double v1 = ctx.get_counter_value(MaliTexQuads);    hwcpipe_double result = (v0 / v1) * 100;    return result;}
+    double MaliTexTriInstrRate_v1(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliTexTriInstr);    hwcpipe_double v1 = ctx.get_counter_value(MaliTexInstr);    hwcpipe_double result = (v0 / v1) * 100;    return result;}
+    double MaliTex3DInstrRate_v0(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliTex3DInstr);    hwcpipe_double v1 = ctx.get_counter_value(MaliTexInstr);    hwcpipe_double result = (v0 / v1) * 100;    return result;}
+    double MaliTexCompressInstrRate_v0(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliTexCompressInstr);    hwcpipe_double v1 = ctx.get_counter_value(MaliTexInstr);    hwcpipe_double result = (v0 / v1) * 100;    return result;}
+
+
+} // namespace database
+
+} // namespace hwcpipe
\ No newline at end of file
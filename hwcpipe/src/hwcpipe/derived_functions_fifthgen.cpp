@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2023-2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <algorithm>
+
+#include "hwcpipe/derived_functions.hpp"
+
+namespace hwcpipe {
+namespace database {
+
+    using hwcpipe_double = detail::hwcpipe_double;
+
+    double MaliALUIssueCy_v4(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliEngFMAInstr);    hwcpipe_double v1 = ctx.get_counter_value(MaliEngCVTInstr);    hwcpipe_double v2 = ctx.get_counter_value(MaliEngSFUInstr);    hwcpipe_double v3 = ctx.get_counter_value(MaliEngSlot1IssueCy);    hwcpipe_double result = std::max<hwcpipe_double>({(v0 + v1 + v2) - v3, v3, v2 * 4});    return result;}
+    double MaliALUUtil_v4(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliEngFMAInstr);    hwcpipe_double v1 = ctx.get_counter_value(MaliEngCVTInstr);    hwcpipe_double v2 = ctx.get_counter_value(MaliEngSFUInstr);    hwcpipe_double v3 = ctx.get_counter_value(MaliEngSlot1IssueCy);    hwcpipe_double v4 = ctx.get_counter_value(MaliCoreActiveCy);    hwcpipe_double result = (std::max<hwcpipe_double>({(v0 + v1 + v2) - v3, v3, v2 * 4}) / v4) * 100;    return result;}
+    double MaliFragFPKBUtil_v1(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliFragFPKActiveCy);    hwcpipe_double v1 = ctx.get_counter_value(MaliMainActiveCy);    hwcpipe_double result = (v0 / v1) * 100;    return result;}
+    double MaliFragLZSKillRate_v1(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliFragLZSKillQd);    hwcpipe_double v1 = ctx.get_counter_value(MaliFragWarp);    hwcpipe_double result = (v0 / (4 * v1)) * 100;    return result;}
+    double MaliFragLZSTestRate_v1(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliFragLZSTestQd);    hwcpipe_double v1 = ctx.get_counter_value(MaliFragWarp);    hwcpipe_double result = (v0 / (4 * v1)) * 100;    return result;}
+    double MaliFragOverdraw_v4(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliFragThread);    hwcpipe_double v1 = ctx.get_counter_value(MaliMainQueueTask);    hwcpipe_double result = v0 / (v1 * 64 * 64);    return result;}
+    double MaliFragThroughputCy_v4(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliMainActiveCy);    hwcpipe_double v1 = ctx.get_counter_value(MaliFragThread);    hwcpipe_double result = v0 / v1;    return result;}
+    double MaliFragThroughputCy_v5(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliMainActiveCy);    hwcpipe_double v1 = ctx.get_counter_value(MaliFragWarp);    hwcpipe_double v2 = ctx.get_counter_value(MaliFragPrepassWarp);    hwcpipe_double result = v0 / ((v1 - v2) * 16);    return result;}
+    double MaliGPUCyPerPix_v2(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliGPUActiveCy);    hwcpipe_double v1 = ctx.get_counter_value(MaliMainQueueTask);    hwcpipe_double result = v0 / (v1 * 64 * 64);    return result;}
+    double MaliGPUPix_v1(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliMainQueueTask);    hwcpipe_double result = v0 * 64 * 64;    return result;}
+    double MaliGeomPosShadThread_v1(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliGeomPosShadTask);    hwcpipe_double result = v0 * 16;    return result;}
+    double MaliGeomPosShadThreadPerPrim_v2(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliGeomPosShadTask);    hwcpipe_double v1 = ctx.get_counter_value(MaliGeomFaceCullPrim);    hwcpipe_double v2 = ctx.get_counter_value(MaliGeomPlaneCullPrim);    hwcpipe_double v3 = ctx.get_counter_value(MaliGeomSampleCullPrim);    hwcpipe_double v4 = ctx.get_counter_value(MaliGeomScissorCullPrim);    hwcpipe_double v5 = ctx.get_counter_value(MaliGeomVisiblePrim);    hwcpipe_double result = (v0 * 4) / (v1 + v2 + v3 + v4 + v5);    return result;}
+    double MaliGeomPosShadThreadPerPrim_v3(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliGeomPosShadTask);    hwcpipe_double v1 = ctx.get_counter_value(MaliGeomFaceCullPrim);    hwcpipe_double v2 = ctx.get_counter_value(MaliGeomPlaneCullPrim);    hwcpipe_double v3 = ctx.get_counter_value(MaliGeomSampleCullPrim);    hwcpipe_double v4 = ctx.get_counter_value(MaliGeomScissorCullPrim);    hwcpipe_double v5 = ctx.get_counter_value(MaliGeomVisiblePrim);    hwcpipe_double result = (v0 * 16) / (v1 + v2 + v3 + v4 + v5);    return result;}
+    double MaliGeomSampleCullRate_v2(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliGeomSampleCullPrim);    hwcpipe_double v1 = ctx.get_counter_value(MaliGeomFaceCullPrim);    hwcpipe_double v2 = ctx.get_counter_value(MaliGeomPlaneCullPrim);    hwcpipe_double v3 = ctx.get_counter_value(MaliGeomScissorCullPrim);    hwcpipe_double v4 = ctx.get_counter_value(MaliGeomVisiblePrim);    hwcpipe_double result = (v0 / ((v1 + v2 + v0 + v3 + v4) - v2 - v3 - v1)) * 100;    return result;}
+    double MaliGeomTotalCullPrim_v2(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliGeomFaceCullPrim);    hwcpipe_double v1 = ctx.get_counter_value(MaliGeomPlaneCullPrim);    hwcpipe_double v2 = ctx.get_counter_value(MaliGeomSampleCullPrim);    hwcpipe_double v3 = ctx.get_counter_value(MaliGeomScissorCullPrim);    hwcpipe_double result = v0 + v1 + v2 + v3;    return result;}
+    double MaliGeomTotalPrim_v2(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliGeomFaceCullPrim);    hwcpipe_double v1 = ctx.get_counter_value(MaliGeomPlaneCullPrim);    hwcpipe_double v2 = ctx.get_counter_value(MaliGeomSampleCullPrim);    hwcpipe_double v3 = ctx.get_counter_value(MaliGeomScissorCullPrim);    hwcpipe_double v4 = ctx.get_counter_value(MaliGeomVisiblePrim);    hwcpipe_double result = v0 + v1 + v2 + v3 + v4;    return result;}
+    double MaliGeomVarShadThread_v1(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliGeomVarShadTask);    hwcpipe_double result = v0 * 16;    return result;}
+    double MaliGeomVisibleRate_v2(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliGeomVisiblePrim);    hwcpipe_double v1 = ctx.get_counter_value(MaliGeomFaceCullPrim);    hwcpipe_double v2 = ctx.get_counter_value(MaliGeomPlaneCullPrim);    hwcpipe_double v3 = ctx.get_counter_value(MaliGeomSampleCullPrim);    hwcpipe_double v4 = ctx.get_counter_value(MaliGeomScissorCullPrim);    hwcpipe_double result = (v0 / (v1 + v2 + v3 + v4 + v0)) * 100;    return result;}
+    double MaliNonFragThroughputCy_v3(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliCompOrBinningActiveCy);    hwcpipe_double v1 = ctx.get_counter_value(MaliNonFragWarp);    hwcpipe_double result = v0 / (v1 * 16);    return result;}
+    double MaliSCBusTileWrBPerPx_v1(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliSCBusTileWrBt);    hwcpipe_double v1 = ctx.get_counter_value(MaliMainQueueTask);    hwcpipe_double result = (v0 * 16) / (v1 * 64 * 64);    return result;}
+    double MaliTexCPI_v4(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliTexFiltIssueCy);    hwcpipe_double v1 = ctx.get_counter_value(MaliTexCacheLookupCy);    hwcpipe_double v2 = ctx.get_counter_value(MaliTexCacheSimpleLoadCy);    hwcpipe_double v3 = ctx.get_counter_value(MaliTexCacheComplexLoadCy);    hwcpipe_double v4 = ctx.get_counter_value(MaliTexInBt);    hwcpipe_double v5 = ctx.get_counter_value(MaliTexOutBt);    hwcpipe_double v6 = ctx.get_counter_value(MaliTexL1CacheOutputCy);    hwcpipe_double v7 = ctx.get_counter_value(MaliTexL1CacheLookupCy);    hwcpipe_double v8 = ctx.get_counter_value(MaliTexIndexCy);    hwcpipe_double v9 = ctx.get_counter_value(MaliTexOutMsg);    hwcpipe_double v10 = ctx.get_counter_value(MaliTexOutSingleMsg);    hwcpipe_double result = std::max<hwcpipe_double>({v0, v1, v2, v3, v4, v5, v6, v7, v8}) / (((v9 * 2) - v10) * 4);    return result;}
+    double MaliTexIssueCy_v1(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliTexFiltIssueCy);    hwcpipe_double v1 = ctx.get_counter_value(MaliTexCacheLookupCy);    hwcpipe_double v2 = ctx.get_counter_value(MaliTexCacheSimpleLoadCy);    hwcpipe_double v3 = ctx.get_counter_value(MaliTexCacheComplexLoadCy);    hwcpipe_double v4 = ctx.get_counter_value(MaliTexInBt);    hwcpipe_double v5 = ctx.get_counter_value(MaliTexOutBt);    hwcpipe_double v6 = ctx.get_counter_value(MaliTexL1CacheOutputCy);    hwcpipe_double v7 = ctx.get_counter_value(MaliTexL1CacheLookupCy);    hwcpipe_double v8 = ctx.get_counter_value(MaliTexIndexCy);    hwcpipe_double result = std::max<hwcpipe_double>({v0, v1, v2, v3, v4, v5, v6, v7, v8});    return result;}
+    double MaliTexSample_v4(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliTexOutMsg);    hwcpipe_double v1 = ctx.get_counter_value(MaliTexOutSingleMsg);    hwcpipe_double result = ((v0 * 2) - v1) * 4;    return result;}
+    double MaliTexUtil_v1(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliTexFiltIssueCy);    hwcpipe_double v1 = ctx.get_counter_value(MaliTexCacheLookupCy);    hwcpipe_double v2 = ctx.get_counter_value(MaliTexCacheSimpleLoadCy);    hwcpipe_double v3 = ctx.get_counter_value(MaliTexCacheComplexLoadCy);    hwcpipe_double v4 = ctx.get_counter_value(MaliTexInBt);    hwcpipe_double v5 = ctx.get_counter_value(MaliTexOutBt);    hwcpipe_double v6 = ctx.get_counter_value(MaliTexL1CacheOutputCy);    hwcpipe_double v7 = ctx.get_counter_value(MaliTexL1CacheLookupCy);    hwcpipe_double v8 = ctx.get_counter_value(MaliTexIndexCy);    hwcpipe_double v9 = ctx.get_counter_value(MaliCoreActiveCy);    hwcpipe_double result = (std::max<hwcpipe_double>({v0, v1, v2, v3, v4, v5, v6, v7, v8}) / v9) * 100;    return result;}
+    double MaliEngCVTPipeUtil_v1(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliEngCVTInstr);    hwcpipe_double v1 = ctx.get_counter_value(MaliCoreActiveCy);    hwcpipe_double result = (v0 / (2 * v1)) * 100;    return result;}
+    double MaliTexQuads_v2(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliTexOutMsg);    hwcpipe_double v1 = ctx.get_counter_value(MaliTexOutSingleMsg);    hwcpipe_double result = (v0 * 2) - v1;    return result;}
+    double MaliGeomFaceCullRate_v1(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliGeomFaceCullPrim);    hwcpipe_double v1 = ctx.get_counter_value(MaliGeomPlaneCullPrim);    hwcpipe_double v2 = ctx.get_counter_value(MaliGeomSampleCullPrim);    hwcpipe_double v3 = ctx.get_counter_value(MaliGeomScissorCullPrim);    hwcpipe_double v4 = ctx.get_counter_value(MaliGeomVisiblePrim);    hwcpipe_double result = (v0 / ((v0 + v1 + v2 + v3 + v4) - v1 - v3)) * 100;    return result;}
+    double MaliGeomPlaneCullRate_v1(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliGeomPlaneCullPrim);    hwcpipe_double v1 = ctx.get_counter_value(MaliGeomFaceCullPrim);    hwcpipe_double v2 = ctx.get_counter_value(MaliGeomSampleCullPrim);    hwcpipe_double v3 = ctx.get_counter_value(MaliGeomScissorCullPrim);    hwcpipe_double v4 = ctx.get_counter_value(MaliGeomVisiblePrim);    hwcpipe_double result = (v0 / (v1 + v0 + v2 + v3 + v4)) * 100;    return result;}
+    double MaliBinningQueueActiveCy_v0(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliBinningQueuedCy);    hwcpipe_double v1 = ctx.get_counter_value(MaliBinningQueueAssignStallCy);    hwcpipe_double result = v0 - v1;    return result;}
+    double MaliBinningQueueUtil_v0(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliBinningQueuedCy);    hwcpipe_double v1 = ctx.get_counter_value(MaliBinningQueueAssignStallCy);    hwcpipe_double v2 = ctx.get_counter_value(MaliGPUActiveCy);    hwcpipe_double result = ((v0 - v1) / v2) * 100;    return result;}
+    double MaliCompOrBinningUtil_v0(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliCompOrBinningActiveCy);    hwcpipe_double v1 = ctx.get_counter_value(MaliAnyActiveCy);    hwcpipe_double result = (v0 / v1) * 100;    return result;}
+    double MaliGeomScissorCullRate_v0(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliGeomScissorCullPrim);    hwcpipe_double v1 = ctx.get_counter_value(MaliGeomFaceCullPrim);    hwcpipe_double v2 = ctx.get_counter_value(MaliGeomPlaneCullPrim);    hwcpipe_double v3 = ctx.get_counter_value(MaliGeomSampleCullPrim);    hwcpipe_double v4 = ctx.get_counter_value(MaliGeomVisiblePrim);    hwcpipe_double result = (v0 / ((v1 + v2 + v3 + v0 + v4) - v2)) * 100;    return result;}
+    double MaliMainQueueActiveCy_v0(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliMainQueuedCy);    hwcpipe_double v1 = ctx.get_counter_value(MaliMainQueueAssignStallCy);    hwcpipe_double result = v0 - v1;    return result;}
+    double MaliMainQueueUtil_v0(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliMainQueuedCy);    hwcpipe_double v1 = ctx.get_counter_value(MaliMainQueueAssignStallCy);    hwcpipe_double v2 = ctx.get_counter_value(MaliGPUActiveCy);    hwcpipe_double result = ((v0 - v1) / v2) * 100;    return result;}
+    double MaliMainUtil_v0(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliMainActiveCy);    hwcpipe_double v1 = ctx.get_counter_value(MaliAnyActiveCy);    hwcpipe_double result = (v0 / v1) * 100;    return result;}
+    double MaliEngAttrBackpressureRate_v0(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliEngAttrBackpressureCy);    hwcpipe_double v1 = ctx.get_counter_value(MaliCoreActiveCy);    hwcpipe_double result = (v0 / v1) * 100;    return result;}
+    double MaliEngBlendBackpressureRate_v0(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliEngBlendBackpressureCy);    hwcpipe_double v1 = ctx.get_counter_value(MaliCoreActiveCy);    hwcpipe_double result = (v0 / v1) * 100;    return result;}
+    double MaliEngLSBackpressureRate_v0(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliEngLSBackpressureCy);    hwcpipe_double v1 = ctx.get_counter_value(MaliCoreActiveCy);    hwcpipe_double result = (v0 / v1) * 100;    return result;}
+    double MaliEngSlot0IssueCy_v0(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliEngFMAInstr);    hwcpipe_double v1 = ctx.get_counter_value(MaliEngCVTInstr);    hwcpipe_double v2 = ctx.get_counter_value(MaliEngSFUInstr);    hwcpipe_double v3 = ctx.get_counter_value(MaliEngSlot1IssueCy);    hwcpipe_double result = (v0 + v1 + v2) - v3;    return result;}
+    double MaliEngTexBackpressureRate_v0(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliEngTexBackpressureCy);    hwcpipe_double v1 = ctx.get_counter_value(MaliCoreActiveCy);    hwcpipe_double result = (v0 / v1) * 100;    return result;}
+    double MaliEngVarBackpressureRate_v0(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliEngVarBackpressureCy);    hwcpipe_double v1 = ctx.get_counter_value(MaliCoreActiveCy);    hwcpipe_double result = (v0 / v1) * 100;    return result;}
+    double MaliEngZSBackpressureRate_v0(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliEngZSBackpressureCy);    hwcpipe_double v1 = ctx.get_counter_value(MaliCoreActiveCy);    hwcpipe_double result = (v0 / v1) * 100;    return result;}
+    double MaliFragInputPrim_v0(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliFragPrim);    hwcpipe_double v1 = ctx.get_counter_value(MaliFragPrepassCullPrim);    hwcpipe_double v2 = ctx.get_counter_value(MaliFragPrepassPrim);    hwcpipe_double result = (v0 + v1) - v2;    return result;}
+    double MaliFragMainPassStallRate_v0(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliFragMainPassStallCy);    hwcpipe_double v1 = ctx.get_counter_value(MaliMainActiveCy);    hwcpipe_double result = (v0 / v1) * 100;    return result;}
+    double MaliFragMainThread_v0(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliFragWarp);    hwcpipe_double v1 = ctx.get_counter_value(MaliFragPrepassWarp);    hwcpipe_double result = (v0 - v1) * 16;    return result;}
+    double MaliFragPrepassCullPrimRate_v0(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliFragPrepassCullPrim);    hwcpipe_double v1 = ctx.get_counter_value(MaliFragPrim);    hwcpipe_double v2 = ctx.get_counter_value(MaliFragPrepassPrim);    hwcpipe_double result = (v0 / ((v1 + v0) - v2)) * 100;    return result;}
+    double MaliFragPrepassKillRate_v0(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliFragPrepassKillQd);    hwcpipe_double v1 = ctx.get_counter_value(MaliFragPrepassTestQd);    hwcpipe_double result = (v0 / v1) * 100;    return result;}
+    double MaliFragPrepassPrimRate_v0(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliFragPrepassPrim);    hwcpipe_double v1 = ctx.get_counter_value(MaliFragPrim);    hwcpipe_double v2 = ctx.get_counter_value(MaliFragPrepassCullPrim);    hwcpipe_double result = (v0 / ((v1 + v2) - v0)) * 100;    return result;}
+    double MaliFragPrepassSkipPrimRate_v0(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliFragPrepassSkippedPrim);    hwcpipe_double v1 = ctx.get_counter_value(MaliFragPrim);    hwcpipe_double v2 = ctx.get_counter_value(MaliFragPrepassCullPrim);    hwcpipe_double v3 = ctx.get_counter_value(MaliFragPrepassPrim);    hwcpipe_double result = (v0 / ((v1 + v2) - v3)) * 100;    return result;}
+    double MaliFragPrepassThread_v0(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliFragPrepassWarp);    hwcpipe_double result = v0 * 16;    return result;}
+    double MaliFragPrepassWarpRate_v0(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliFragPrepassWarp);    hwcpipe_double v1 = ctx.get_counter_value(MaliFragWarp);    hwcpipe_double result = (v0 / (v1 - v0)) * 100;    return result;}
+    double MaliAttrUtil_v0(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliAttrIssueCy);    hwcpipe_double v1 = ctx.get_counter_value(MaliCoreActiveCy);    hwcpipe_double result = (v0 / v1) * 100;    return result;}
+    double MaliBlendUtil_v0(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliBlendIssueCy);    hwcpipe_double v1 = ctx.get_counter_value(MaliCoreActiveCy);    hwcpipe_double result = (v0 / v1) * 100;    return result;}
+    double MaliEngRTUBackpressureRate_v0(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliEngRTUBackpressureCy);    hwcpipe_double v1 = ctx.get_counter_value(MaliCoreActiveCy);    hwcpipe_double result = (v0 / v1) * 100;    return result;}
+    double MaliSCBusRTUExtRdBy_v0(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliSCBusRTUExtRdBt);    hwcpipe_double result = v0 * 16;    return result;}
+    double MaliSCBusRTUL2RdBy_v0(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliSCBusRTUL2RdBt);    hwcpipe_double result = v0 * 16;    return result;}
+
+
+} // namespace database
+
+} // namespace hwcpipe
\ No newline at end of file
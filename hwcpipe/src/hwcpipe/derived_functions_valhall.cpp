@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2023-2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <algorithm>
+
+#include "hwcpipe/derived_functions.hpp"
+
+namespace hwcpipe {
+namespace database {
+
+    using hwcpipe_double = detail::hwcpipe_double;
+
+    double MaliALUIssueCy_v1(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliEngFMAInstr);    hwcpipe_double v1 = ctx.get_counter_value(MaliEngCVTInstr);    hwcpipe_double v2 = ctx.get_counter_value(MaliEngSFUInstr);    hwcpipe_double result = std::max<hwcpipe_double>({v0, v1, v2 * 4});    return result;}
+    double MaliALUIssueCy_v2(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliEngFMAInstr);    hwcpipe_double v1 = ctx.get_counter_value(MaliEngCVTInstr);    hwcpipe_double v2 = ctx.get_counter_value(MaliEngSFUInstr);    hwcpipe_double result = std::max<hwcpipe_double>({v0 + v1 + v2, v2 * 4});    return result;}
+    double MaliALUUtil_v1(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliEngFMAInstr);    hwcpipe_double v1 = ctx.get_counter_value(MaliEngCVTInstr);    hwcpipe_double v2 = ctx.get_counter_value(MaliEngSFUInstr);    hwcpipe_double v3 = ctx.get_counter_value(MaliCoreActiveCy);    hwcpipe_double result = (std::max<hwcpipe_double>({v0, v1, v2 * 4}) / v3) * 100;    return result;}
+    double MaliALUUtil_v2(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliEngFMAInstr);    hwcpipe_double v1 = ctx.get_counter_value(MaliEngCVTInstr);    hwcpipe_double v2 = ctx.get_counter_value(MaliEngSFUInstr);    hwcpipe_double v3 = ctx.get_counter_value(MaliCoreActiveCy);    hwcpipe_double result = (std::max<hwcpipe_double>({v0 + v1 + v2, v2 * 4}) / v3) * 100;    return result;}
+    double MaliExtBusRdStallRate_v1(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliExtBusRdStallCy);    hwcpipe_double v1 = ctx.get_counter_value(MaliGPUAnyQueueActiveCy);    hwcpipe_double result = (v0 / ctx.get_mali_config_l2_cache_count() / v1) * 100;    return result;}
+    double MaliExtBusWrStallRate_v1(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliExtBusWrStallCy);    hwcpipe_double v1 = ctx.get_counter_value(MaliGPUAnyQueueActiveCy);    hwcpipe_double result = (v0 / ctx.get_mali_config_l2_cache_count() / v1) * 100;    return result;}
+    double MaliFragOverdraw_v2(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliFragWarp);    hwcpipe_double v1 = ctx.get_counter_value(MaliFragQueueTask);    hwcpipe_double result = (v0 * 16) / (v1 * 32 * 32);    return result;}
+    double MaliFragOverdraw_v3(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliFragThread);    hwcpipe_double v1 = ctx.get_counter_value(MaliFragQueueTask);    hwcpipe_double result = v0 / (v1 * 32 * 32);    return result;}
+    double MaliFragQueueUtil_v1(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliFragQueuedCy);    hwcpipe_double v1 = ctx.get_counter_value(MaliFragQueueAssignStallCy);    hwcpipe_double v2 = ctx.get_counter_value(MaliGPUActiveCy);    hwcpipe_double result = ((v0 - v1) / v2) * 100;    return result;}
+    double MaliFragQueueUtil_v2(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliFragQueuedCy);    hwcpipe_double v1 = ctx.get_counter_value(MaliFragQueueAssignStallCy);    hwcpipe_double v2 = ctx.get_counter_value(MaliGPUAnyQueueActiveCy);    hwcpipe_double result = ((v0 - v1) / v2) * 100;    return result;}
+    double MaliFragThread_v2(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliFragWarp);    hwcpipe_double result = v0 * 16;    return result;}
+    double MaliFragThroughputCy_v2(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliFragActiveCy);    hwcpipe_double v1 = ctx.get_counter_value(MaliFragWarp);    hwcpipe_double result = v0 / (v1 * 16);    return result;}
+    double MaliFragThroughputCy_v3(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliFragActiveCy);    hwcpipe_double v1 = ctx.get_counter_value(MaliFragThread);    hwcpipe_double result = v0 / v1;    return result;}
+    double MaliFragUtil_v1(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliFragActiveCy);    hwcpipe_double v1 = ctx.get_counter_value(MaliAnyActiveCy);    hwcpipe_double result = (v0 / v1) * 100;    return result;}
+    double MaliGPUCyPerPix_v1(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliGPUAnyQueueActiveCy);    hwcpipe_double v1 = ctx.get_counter_value(MaliFragQueueTask);    hwcpipe_double result = v0 / (v1 * 32 * 32);    return result;}
+    double MaliGPUIRQUtil_v1(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliGPUIRQActiveCy);    hwcpipe_double v1 = ctx.get_counter_value(MaliGPUAnyQueueActiveCy);    hwcpipe_double result = (v0 / v1) * 100;    return result;}
+    double MaliGeomPosShadThreadPerPrim_v1(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliGeomPosShadTask);    hwcpipe_double v1 = ctx.get_counter_value(MaliGeomFaceCullPrim);    hwcpipe_double v2 = ctx.get_counter_value(MaliGeomPlaneCullPrim);    hwcpipe_double v3 = ctx.get_counter_value(MaliGeomSampleCullPrim);    hwcpipe_double v4 = ctx.get_counter_value(MaliGeomVisiblePrim);    hwcpipe_double result = (v0 * 4) / (v1 + v2 + v3 + v4);    return result;}
+    double MaliGeomSampleCullRate_v1(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliGeomSampleCullPrim);    hwcpipe_double v1 = ctx.get_counter_value(MaliGeomFaceCullPrim);    hwcpipe_double v2 = ctx.get_counter_value(MaliGeomPlaneCullPrim);    hwcpipe_double v3 = ctx.get_counter_value(MaliGeomVisiblePrim);    hwcpipe_double result = (v0 / ((v1 + v2 + v0 + v3) - v1 - v2)) * 100;    return result;}
+    double MaliGeomTotalCullPrim_v1(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliGeomFaceCullPrim);    hwcpipe_double v1 = ctx.get_counter_value(MaliGeomPlaneCullPrim);    hwcpipe_double v2 = ctx.get_counter_value(MaliGeomSampleCullPrim);    hwcpipe_double result = v0 + v1 + v2;    return result;}
+    double MaliGeomTotalPrim_v1(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliGeomFaceCullPrim);    hwcpipe_double v1 = ctx.get_counter_value(MaliGeomPlaneCullPrim);    hwcpipe_double v2 = ctx.get_counter_value(MaliGeomSampleCullPrim);    hwcpipe_double v3 = ctx.get_counter_value(MaliGeomVisiblePrim);    hwcpipe_double result = v0 + v1 + v2 + v3;    return result;}
+    double MaliGeomVisibleRate_v1(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliGeomVisiblePrim);    hwcpipe_double v1 = ctx.get_counter_value(MaliGeomFaceCullPrim);    hwcpipe_double v2 = ctx.get_counter_value(MaliGeomPlaneCullPrim);    hwcpipe_double v3 = ctx.get_counter_value(MaliGeomSampleCullPrim);    hwcpipe_double result = (v0 / (v1 + v2 + v3 + v0)) * 100;    return result;}
+    double MaliNonFragThroughputCy_v2(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliNonFragActiveCy);    hwcpipe_double v1 = ctx.get_counter_value(MaliNonFragWarp);    hwcpipe_double result = v0 / (v1 * 16);    return result;}
+    double MaliNonFragUtil_v1(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliNonFragActiveCy);    hwcpipe_double v1 = ctx.get_counter_value(MaliAnyActiveCy);    hwcpipe_double result = (v0 / v1) * 100;    return result;}
+    double MaliTexCPI_v2(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliTexFiltIssueCy);    hwcpipe_double v1 = ctx.get_counter_value(MaliTexOutMsg);    hwcpipe_double result = v0 / (v1 * 4);    return result;}
+    double MaliTexCPI_v3(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliTexFiltIssueCy);    hwcpipe_double v1 = ctx.get_counter_value(MaliTexOutMsg);    hwcpipe_double result = v0 / (v1 * 2 * 4);    return result;}
+    double MaliTexSample_v2(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliTexOutMsg);    hwcpipe_double result = v0 * 4;    return result;}
+    double MaliTexSample_v3(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliTexOutMsg);    hwcpipe_double result = v0 * 2 * 4;    return result;}
+    double MaliTilerUtil_v1(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliTilerActiveCy);    hwcpipe_double v1 = ctx.get_counter_value(MaliGPUAnyQueueActiveCy);    hwcpipe_double result = (v0 / v1) * 100;    return result;}
+    double MaliVar16IssueCy_v1(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliVar16IssueSlot);    hwcpipe_double result = v0 / 2;    return result;}
+    double MaliVar32IssueCy_v1(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliVar32IssueSlot);    hwcpipe_double result = v0 / 2;    return result;}
+    double MaliVarIssueCy_v1(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliVar32IssueSlot);    hwcpipe_double v1 = ctx.get_counter_value(MaliVar16IssueSlot);    hwcpipe_double result = (v0 / 2) + (v1 / 2);    return result;}
+    double MaliVarUtil_v1(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliVar32IssueSlot);    hwcpipe_double v1 = ctx.get_counter_value(MaliVar16IssueSlot);    hwcpipe_double v2 = ctx.get_counter_value(MaliCoreActiveCy);    hwcpipe_double result = (((v0 / 2) + (v1 / 2)) / v2) * 100;    return result;}
+    double MaliEngFMAPipeUtil_v0(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliEngFMAInstr);    hwcpipe_double v1 = ctx.get_counter_value(MaliCoreActiveCy);    hwcpipe_double result = (v0 / v1) * 100;    return result;}
+    double MaliEngSWBlendRate_v0(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliEngSWBlendInstr);    hwcpipe_double v1 = ctx.get_counter_value(MaliFragWarp);    hwcpipe_double result = ((v0 * 2) / v1) * 100;    return result;}
+    double MaliTexFiltFullRate_v0(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliTexFullBiFiltCy);    hwcpipe_double v1 = ctx.get_counter_value(MaliTexFullTriFiltCy);    hwcpipe_double v2 = ctx.get_counter_value(MaliTexFiltIssueCy);    hwcpipe_double result = ((v0 + v1) / v2) * 100;    return result;}
+    double MaliTexQuads_v0(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliTexOutMsg);    hwcpipe_double result = v0;    return result;}
+    double MaliTexQuads_v1(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliTexOutMsg);    hwcpipe_double result = v0 * 2;    return result;}
+    double MaliAnyUtil_v1(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliAnyActiveCy);    hwcpipe_double v1 = ctx.get_counter_value(MaliGPUAnyQueueActiveCy);    hwcpipe_double result = (v0 / ctx.get_mali_config_shader_core_count() / v1) * 100;    return result;}
+    double MaliCSFCEUUtil_v1(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliCSFCEUActiveCy);    hwcpipe_double v1 = ctx.get_counter_value(MaliGPUAnyQueueActiveCy);    hwcpipe_double result = (v0 / v1) * 100;    return result;}
+    double MaliCSFLSUUtil_v1(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliCSFLSUActiveCy);    hwcpipe_double v1 = ctx.get_counter_value(MaliGPUAnyQueueActiveCy);    hwcpipe_double result = (v0 / v1) * 100;    return result;}
+    double MaliCSFMCUUtil_v1(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliCSFMCUActiveCy);    hwcpipe_double v1 = ctx.get_counter_value(MaliGPUAnyQueueActiveCy);    hwcpipe_double result = (v0 / v1) * 100;    return result;}
+    double MaliCompQueueUtil_v1(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliCompQueuedCy);    hwcpipe_double v1 = ctx.get_counter_value(MaliCompQueueAssignStallCy);    hwcpipe_double v2 = ctx.get_counter_value(MaliGPUAnyQueueActiveCy);    hwcpipe_double result = ((v0 - v1) / v2) * 100;    return result;}
+    double MaliFragQueueActiveCy_v0(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliFragQueuedCy);    hwcpipe_double v1 = ctx.get_counter_value(MaliFragQueueAssignStallCy);    hwcpipe_double result = v0 - v1;    return result;}
+    double MaliVertQueueActiveCy_v0(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliVertQueuedCy);    hwcpipe_double v1 = ctx.get_counter_value(MaliVertQueueAssignStallCy);    hwcpipe_double result = v0 - v1;    return result;}
+    double MaliVertQueueUtil_v0(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliVertQueuedCy);    hwcpipe_double v1 = ctx.get_counter_value(MaliVertQueueAssignStallCy);    hwcpipe_double v2 = ctx.get_counter_value(MaliGPUActiveCy);    hwcpipe_double result = ((v0 - v1) / v2) * 100;    return result;}
+    double MaliVertQueueUtil_v1(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliVertQueuedCy);    hwcpipe_double v1 = ctx.get_counter_value(MaliVertQueueAssignStallCy);    hwcpipe_double v2 = ctx.get_counter_value(MaliGPUAnyQueueActiveCy);    hwcpipe_double result = ((v0 - v1) / v2) * 100;    return result;}
+    double MaliGPUActiveCy_v0(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliGPUAnyQueueActiveCy);    hwcpipe_double result = v0;    return result;}
+    double MaliGeomFaceCullRate_v0(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliGeomFaceCullPrim);    hwcpipe_double v1 = ctx.get_counter_value(MaliGeomPlaneCullPrim);    hwcpipe_double v2 = ctx.get_counter_value(MaliGeomSampleCullPrim);    hwcpipe_double v3 = ctx.get_counter_value(MaliGeomVisiblePrim);    hwcpipe_double result = (v0 / (v0 + v1 + v2 + v3)) * 100;    return result;}
+    double MaliGeomPlaneCullRate_v0(const context &ctx) {    hwcpipe_double v0 = ctx.get_counter_value(MaliGeomPlaneCullPrim);    hwcpipe_double v1 = ctx.get_counter_value(MaliGeomFaceCullPrim);    hwcpipe_double v2 = ctx.get_counter_value(MaliGeomSampleCullPrim);    hwcpipe_double v3 = ctx.get_counter_value(MaliGeomVisiblePrim);    hwcpipe_double result = (v0 / ((v1 + v0 + v2 + v3) - v1)) * 100;    return result;}
+
+
+} // namespace database
+
+} // namespace hwcpipe
\ No newline at end of file
@@ -0,0 +1,414 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <hwcpipe/detail/async_file_writer.hpp>
+#include <hwcpipe/error.hpp>
+
+#include <algorithm>
+#include <cerrno>
+
+#include <sys/mman.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#include <sys/syscall.h>
+#if defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter) && defined(__NR_io_uring_register)
+#define HWCP_HAS_IO_URING 1
+#endif
+#endif
+#endif
+
+namespace hwcpipe {
+namespace detail {
+
+namespace {
+/** Writes all of @p size bytes at @p offset, returning false on error. */
+bool pwrite_all(int fd, const char *data, size_t size, uint64_t offset) {
+    while (size != 0) {
+        const auto written = ::pwrite(fd, data, size, static_cast<off_t>(offset));
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        if (written == 0) {
+            return false;
+        }
+        data += written;
+        size -= static_cast<size_t>(written);
+        offset += static_cast<uint64_t>(written);
+    }
+    return true;
+}
+} // namespace
+
+#if defined(HWCP_HAS_IO_URING)
+
+/**
+ * The rings of an io_uring, driven with raw system calls so that liburing is
+ * not needed. The writer is the only producer of submissions and the only
+ * consumer of completions, so the ring indices it owns are read plainly and
+ * the ones the kernel owns are read and written with acquire and release.
+ */
+struct async_file_writer::ring {
+    int fd{-1};
+    bool fixed_buffers{};
+
+    void *sq_map{MAP_FAILED};
+    size_t sq_map_size{};
+    void *cq_map{MAP_FAILED};
+    size_t cq_map_size{};
+    io_uring_sqe *sqes{static_cast<io_uring_sqe *>(MAP_FAILED)};
+    size_t sqes_size{};
+
+    unsigned *sq_tail{};
+    unsigned sq_mask{};
+    unsigned *sq_array{};
+    unsigned *cq_head{};
+    unsigned *cq_tail{};
+    unsigned cq_mask{};
+    io_uring_cqe *cqes{};
+
+    io_uring_enter_function enter_function{};
+    // the submissions queued that the kernel didn't consume yet
+    unsigned unsubmitted{};
+    bool failed{};
+
+    ~ring() {
+        if (sqes != MAP_FAILED) {
+            ::munmap(sqes, sqes_size);
+        }
+        if (cq_map != MAP_FAILED && cq_map != sq_map) {
+            ::munmap(cq_map, cq_map_size);
+        }
+        if (sq_map != MAP_FAILED) {
+            ::munmap(sq_map, sq_map_size);
+        }
+        if (fd >= 0) {
+            ::close(fd);
+        }
+    }
+
+    bool setup(unsigned entries) {
+        io_uring_params params{};
+        fd = static_cast<int>(::syscall(__NR_io_uring_setup, entries, &params));
+        if (fd < 0) {
+            return false;
+        }
+
+        sq_map_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        cq_map_size = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        const bool single_map = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (single_map) {
+            sq_map_size = std::max(sq_map_size, cq_map_size);
+        }
+
+        sq_map = ::mmap(nullptr, sq_map_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd,
+                        IORING_OFF_SQ_RING);
+        if (sq_map == MAP_FAILED) {
+            return false;
+        }
+        cq_map = single_map ? sq_map
+                            : ::mmap(nullptr, cq_map_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd,
+                                     IORING_OFF_CQ_RING);
+        if (cq_map == MAP_FAILED) {
+            return false;
+        }
+        sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+        sqes = static_cast<io_uring_sqe *>(
+            ::mmap(nullptr, sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES));
+        if (sqes == MAP_FAILED) {
+            return false;
+        }
+
+        auto *sq = static_cast<char *>(sq_map);
+        auto *cq = static_cast<char *>(cq_map);
+        sq_tail = reinterpret_cast<unsigned *>(sq + params.sq_off.tail);
+        sq_mask = *reinterpret_cast<unsigned *>(sq + params.sq_off.ring_mask);
+        sq_array = reinterpret_cast<unsigned *>(sq + params.sq_off.array);
+        cq_head = reinterpret_cast<unsigned *>(cq + params.cq_off.head);
+        cq_tail = reinterpret_cast<unsigned *>(cq + params.cq_off.tail);
+        cq_mask = *reinterpret_cast<unsigned *>(cq + params.cq_off.ring_mask);
+        cqes = reinterpret_cast<io_uring_cqe *>(cq + params.cq_off.cqes);
+        return true;
+    }
+
+    /** Registers the buffers, which fails e.g. if they exceed RLIMIT_MEMLOCK. */
+    void register_buffers(const std::vector<iovec> &buffers) {
+        fixed_buffers = ::syscall(__NR_io_uring_register, fd, IORING_REGISTER_BUFFERS, buffers.data(),
+                                  static_cast<unsigned>(buffers.size())) == 0;
+    }
+
+    /**
+     * Submits the queued writes, and waits for @p min_complete completions.
+     * EAGAIN and EBUSY are transient, the kernel is short of resources, so
+     * the call is retried.
+     *
+     * @return False if the ring failed.
+     */
+    bool enter(unsigned min_complete, unsigned flags) {
+        for (;;) {
+            const long result = enter_function(fd, unsubmitted, min_complete, flags);
+            if (result >= 0) {
+                unsubmitted -= std::min(unsubmitted, static_cast<unsigned>(result));
+                return true;
+            }
+            if (errno == EAGAIN || errno == EBUSY) {
+                std::this_thread::yield();
+            } else if (errno != EINTR) {
+                failed = true;
+                return false;
+            }
+        }
+    }
+
+    /**
+     * Queues a write and tells the kernel about it. A write the kernel
+     * doesn't consume yet stays queued, and is submitted by the next enter.
+     *
+     * @return False if the ring failed.
+     */
+    bool submit(int file, const char *data, size_t size, uint64_t offset, size_t buffer) {
+        const unsigned tail = *sq_tail;
+        const unsigned index = tail & sq_mask;
+        io_uring_sqe &sqe = sqes[index];
+        sqe = io_uring_sqe{};
+        sqe.opcode = fixed_buffers ? IORING_OP_WRITE_FIXED : IORING_OP_WRITE;
+        sqe.fd = file;
+        sqe.off = offset;
+        sqe.addr = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(data));
+        sqe.len = static_cast<uint32_t>(size);
+        sqe.buf_index = static_cast<uint16_t>(fixed_buffers ? buffer : 0);
+        sqe.user_data = buffer;
+        sq_array[index] = index;
+        __atomic_store_n(sq_tail, tail + 1, __ATOMIC_RELEASE);
+        ++unsubmitted;
+
+        return enter(0, 0);
+    }
+
+    /** Waits until at least one completion is posted, or the ring fails. */
+    void wait() {
+        while (*cq_head == __atomic_load_n(cq_tail, __ATOMIC_ACQUIRE)) {
+            if (!enter(1, IORING_ENTER_GETEVENTS)) {
+                return;
+            }
+        }
+    }
+
+    static long enter_system_call(int ring_fd, unsigned to_submit, unsigned min_complete, unsigned flags) {
+        return ::syscall(__NR_io_uring_enter, ring_fd, to_submit, min_complete, flags, nullptr, 0U);
+    }
+};
+
+bool async_file_writer::start_io_uring(io_uring_enter_function enter) {
+    ring_ = new ring();
+    ring_->enter_function = enter != nullptr ? enter : &ring::enter_system_call;
+    if (!ring_->setup(static_cast<unsigned>(num_buffers_))) {
+        delete ring_;
+        ring_ = nullptr;
+        return false;
+    }
+
+    std::vector<iovec> buffers(num_buffers_);
+    for (size_t i = 0; i != num_buffers_; ++i) {
+        buffers[i] = {buffer_data(i), stride_};
+    }
+    ring_->register_buffers(buffers);
+    backend_ = backend::io_uring;
+    return true;
+}
+
+void async_file_writer::reap_ring() {
+    // the completions already posted by a failed ring are still reaped
+    if (!ring_->failed) {
+        ring_->wait();
+    }
+
+    unsigned head = *ring_->cq_head;
+    const unsigned tail = __atomic_load_n(ring_->cq_tail, __ATOMIC_ACQUIRE);
+    for (; head != tail; ++head) {
+        const io_uring_cqe &cqe = ring_->cqes[head & ring_->cq_mask];
+        complete(writes_[static_cast<size_t>(cqe.user_data)], cqe.res);
+    }
+    __atomic_store_n(ring_->cq_head, head, __ATOMIC_RELEASE);
+
+    if (ring_->failed) {
+        fail_ring();
+    }
+}
+
+void async_file_writer::delete_ring() { delete ring_; }
+
+#else
+
+struct async_file_writer::ring {};
+
+bool async_file_writer::start_io_uring(io_uring_enter_function) { return false; }
+
+void async_file_writer::reap_ring() {}
+
+void async_file_writer::delete_ring() {}
+
+#endif
+
+async_file_writer::async_file_writer(int fd, size_t buffer_size, size_t num_buffers, bool allow_io_uring,
+                                     io_uring_enter_function enter)
+    : fd_(fd)
+    , buffer_size_(buffer_size)
+    , num_buffers_(std::max<size_t>(num_buffers, 1)) {
+    // page aligned buffers can be registered, and written with O_DIRECT
+    const auto page_size = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+    stride_ = std::max<size_t>((buffer_size_ + page_size - 1) / page_size * page_size, page_size);
+    pool_size_ = stride_ * num_buffers_;
+    void *pool = ::mmap(nullptr, pool_size_, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (pool == MAP_FAILED) {
+        ec_ = make_error_code(errc::trace_write_failed);
+        return;
+    }
+    pool_ = static_cast<char *>(pool);
+
+    writes_.resize(num_buffers_);
+    for (size_t i = num_buffers_; i != 0; --i) {
+        free_buffers_.push_back(i - 1);
+    }
+
+    if (!allow_io_uring || !start_io_uring(enter)) {
+        start_thread();
+    }
+}
+
+async_file_writer::~async_file_writer() {
+    // errors can't be reported from here, drain() first to check them
+    ec_ = drain();
+
+    if (thread_.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        queued_.notify_one();
+        thread_.join();
+    }
+    delete_ring();
+    // the buffers of the writes a failed io_uring didn't complete are leaked, the kernel may still read them
+    if (pool_ != nullptr && in_flight_ == 0) {
+        ::munmap(pool_, pool_size_);
+    }
+}
+
+std::error_code async_file_writer::acquire(char *&buffer) {
+    buffer = nullptr;
+    while (!ec_ && free_buffers_.empty()) {
+        wait_for_completion();
+    }
+    if (ec_) {
+        return ec_;
+    }
+
+    buffer = buffer_data(free_buffers_.back());
+    free_buffers_.pop_back();
+    return {};
+}
+
+std::error_code async_file_writer::submit(char *buffer, size_t size, uint64_t offset) {
+    if (ec_) {
+        return ec_;
+    }
+
+    const pending_write write{static_cast<size_t>(buffer - pool_) / stride_, std::min(size, buffer_size_), offset};
+    writes_[write.buffer] = write;
+    ++in_flight_;
+
+    if (backend_ == backend::io_uring) {
+#if defined(HWCP_HAS_IO_URING)
+        if (!ring_->submit(fd_, buffer, write.size, offset, write.buffer)) {
+            fail_ring();
+        }
+#endif
+        return ec_;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        queue_.push_back(write);
+    }
+    queued_.notify_one();
+    return {};
+}
+
+std::error_code async_file_writer::drain() {
+    // the buffers of failed writes are still waited for, the kernel may be reading them
+    while (in_flight_ != 0 && !ring_failed_) {
+        wait_for_completion();
+    }
+    return ec_;
+}
+
+void async_file_writer::fail_ring() {
+    // the writes in flight keep their buffers, the kernel may complete them at any time
+    ec_ = make_error_code(errc::trace_write_failed);
+    ring_failed_ = true;
+}
+
+void async_file_writer::wait_for_completion() {
+    if (backend_ == backend::io_uring) {
+        reap_ring();
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    completed_.wait(lock, [this] { return !completed_buffers_.empty(); });
+    free_buffers_.insert(free_buffers_.end(), completed_buffers_.begin(), completed_buffers_.end());
+    in_flight_ -= completed_buffers_.size();
+    completed_buffers_.clear();
+    if (failed_) {
+        ec_ = make_error_code(errc::trace_write_failed);
+    }
+}
+
+void async_file_writer::complete(const pending_write &write, int64_t result) {
+    // short or failed writes, e.g. of an opcode the kernel doesn't know, are finished synchronously
+    const size_t written = result < 0 ? 0 : std::min(static_cast<size_t>(result), write.size);
+    if (written != write.size &&
+        !pwrite_all(fd_, buffer_data(write.buffer) + written, write.size - written, write.offset + written)) {
+        ec_ = make_error_code(errc::trace_write_failed);
+    }
+    free_buffers_.push_back(write.buffer);
+    --in_flight_;
+}
+
+void async_file_writer::start_thread() {
+    backend_ = backend::thread;
+    thread_ = std::thread([this] { run_thread(); });
+}
+
+void async_file_writer::run_thread() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (;;) {
+        queued_.wait(lock, [this] { return stop_ || !queue_.empty(); });
+        if (queue_.empty()) {
+            return;
+        }
+
+        const pending_write write = queue_.front();
+        queue_.pop_front();
+        lock.unlock();
+        const bool written = pwrite_all(fd_, buffer_data(write.buffer), write.size, write.offset);
+        lock.lock();
+
+        failed_ = failed_ || !written;
+        completed_buffers_.push_back(write.buffer);
+        completed_.notify_one();
+    }
+}
+
+} // namespace detail
+} // namespace hwcpipe
@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <hwcpipe/detail/column_codec.hpp>
+
+namespace hwcpipe {
+namespace detail {
+namespace column_codec {
+
+namespace {
+size_t varint_size(uint64_t value) {
+    size_t size = 1;
+    while (value >= 0x80U) {
+        value >>= 7U;
+        ++size;
+    }
+    return size;
+}
+
+uint8_t *write_varint(uint64_t value, uint8_t *output) {
+    while (value >= 0x80U) {
+        *output++ = static_cast<uint8_t>(value | 0x80U);
+        value >>= 7U;
+    }
+    *output++ = static_cast<uint8_t>(value);
+    return output;
+}
+
+const uint8_t *read_varint(const uint8_t *input, const uint8_t *end, uint64_t &value) {
+    value = 0;
+    for (unsigned shift = 0; shift < 64; shift += 7) {
+        if (input == end) {
+            return nullptr;
+        }
+        const uint8_t byte = *input++;
+        value |= static_cast<uint64_t>(byte & 0x7FU) << shift;
+        if ((byte & 0x80U) == 0) {
+            return input;
+        }
+    }
+    return nullptr;
+}
+
+unsigned bit_width(uint64_t value) {
+    unsigned width = 0;
+    while (value != 0) {
+        value >>= 1U;
+        ++width;
+    }
+    return width;
+}
+
+uint64_t low_bits(uint64_t value, unsigned count) { return count == 64 ? value : value & ((uint64_t{1} << count) - 1); }
+
+/** Writes values of a fixed bit width, least significant bit first. */
+class bit_writer {
+  public:
+    explicit bit_writer(uint8_t *output)
+        : output_(output) {}
+
+    void put(uint64_t value, unsigned width) {
+        while (width != 0) {
+            const unsigned take = width < 64 - bits_ ? width : 64 - bits_;
+            accumulator_ |= low_bits(value, take) << bits_;
+            bits_ += take;
+            width -= take;
+            value = take == 64 ? 0 : value >> take;
+            if (bits_ == 64) {
+                emit(8);
+            }
+        }
+    }
+
+    uint8_t *finish() {
+        emit((bits_ + 7) / 8);
+        return output_;
+    }
+
+  private:
+    void emit(unsigned num_bytes) {
+        for (unsigned i = 0; i != num_bytes; ++i) {
+            *output_++ = static_cast<uint8_t>(accumulator_ >> (i * 8));
+        }
+        accumulator_ = 0;
+        bits_ = 0;
+    }
+
+    uint8_t *output_;
+    uint64_t accumulator_{};
+    unsigned bits_{};
+};
+
+/** Reads values written by bit_writer. */
+class bit_reader {
+  public:
+    explicit bit_reader(const uint8_t *input)
+        : input_(input) {}
+
+    uint64_t get(unsigned width) {
+        uint64_t value = 0;
+        unsigned filled = 0;
+        while (filled != width) {
+            if (bits_ == 0) {
+                accumulator_ = *input_++;
+                bits_ = 8;
+            }
+            const unsigned take = width - filled < bits_ ? width - filled : bits_;
+            value |= low_bits(accumulator_, take) << filled;
+            accumulator_ >>= take;
+            bits_ -= take;
+            filled += take;
+        }
+        return value;
+    }
+
+  private:
+    const uint8_t *input_;
+    uint64_t accumulator_{};
+    unsigned bits_{};
+};
+} // namespace
+
+size_t encode(const uint64_t *values, size_t count, uint8_t *output) {
+    uint64_t max_delta = 0;
+    size_t varint_bytes = 0;
+    for (size_t i = 1; i < count; ++i) {
+        const auto delta = zigzag_encode(values[i] - values[i - 1]);
+        max_delta |= delta;
+        varint_bytes += varint_size(delta);
+    }
+
+    const unsigned width = bit_width(max_delta);
+    const size_t packed_bytes = 1 + ((count - 1) * width + 7) / 8;
+
+    uint8_t *begin = output;
+    if (packed_bytes < varint_bytes) {
+        *output++ = mode_packed;
+        output = write_varint(values[0], output);
+        *output++ = static_cast<uint8_t>(width);
+
+        bit_writer writer(output);
+        for (size_t i = 1; i < count; ++i) {
+            writer.put(zigzag_encode(values[i] - values[i - 1]), width);
+        }
+        output = writer.finish();
+    } else {
+        *output++ = mode_varint;
+        output = write_varint(values[0], output);
+        for (size_t i = 1; i < count; ++i) {
+            output = write_varint(zigzag_encode(values[i] - values[i - 1]), output);
+        }
+    }
+    return static_cast<size_t>(output - begin);
+}
+
+const uint8_t *decode(const uint8_t *input, const uint8_t *end, size_t count, uint64_t *values) {
+    if (input == end || count == 0) {
+        return nullptr;
+    }
+
+    const uint8_t mode = *input++;
+    input = read_varint(input, end, values[0]);
+    if (input == nullptr) {
+        return nullptr;
+    }
+
+    switch (mode) {
+    case mode_varint:
+        for (size_t i = 1; i < count; ++i) {
+            uint64_t delta{};
+            input = read_varint(input, end, delta);
+            if (input == nullptr) {
+                return nullptr;
+            }
+            values[i] = values[i - 1] + zigzag_decode(delta);
+        }
+        return input;
+    case mode_packed: {
+        if (input == end) {
+            return nullptr;
+        }
+        const unsigned width = *input++;
+        const size_t num_bytes = ((count - 1) * width + 7) / 8;
+        if (width > 64 || static_cast<size_t>(end - input) < num_bytes) {
+            return nullptr;
+        }
+
+        bit_reader reader(input);
+        for (size_t i = 1; i < count; ++i) {
+            values[i] = values[i - 1] + zigzag_decode(reader.get(width));
+        }
+        return input + num_bytes;
+    }
+    default:
+        return nullptr;
+    }
+}
+
+} // namespace column_codec
+} // namespace detail
+} // namespace hwcpipe
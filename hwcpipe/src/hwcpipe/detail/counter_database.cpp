@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023-2024 Arm Limited.
+ * Copyright (c) 2023-2025 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  */
@@ -10,55 +10,247 @@
 #include "hwcpipe/detail/counter_database.hpp"
 #include "hwcpipe/error.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <vector>
+
 namespace hwcpipe {
 namespace detail {
+namespace {
+/** The database shards that were selected at build time. */
+constexpr database::gpu_family_counters all_gpu_families[] = {
+#if HWCPIPE_DATABASE_BIFROST
+    database::bifrost_gpu_counters,
+#endif
+#if HWCPIPE_DATABASE_VALHALL
+    database::valhall_gpu_counters,
+#endif
+#if HWCPIPE_DATABASE_FIFTHGEN
+    database::fifthgen_gpu_counters,
+#endif
+};
 
-bool counter_database::is_gpu_known(device::product_id id) const {
+/** The blob the databases look products up in first, see counter_database::use_blob(). */
+std::atomic<const database_blob *> blob_in_use{nullptr};
+} // namespace
+
+void counter_database::resolve(device::product_id id) const {
     namespace db = hwcpipe::database;
 
-    auto it = db::all_gpu_counters.find(id);
-    return it != db::all_gpu_counters.end();
+    const auto *source = blob_in_use.load(std::memory_order_acquire);
+    if (cached_ && cached_id_ == id && cached_source_ == source) {
+        return;
+    }
+
+    cached_ = true;
+    cached_id_ = id;
+    cached_source_ = source;
+    cached_table_ = nullptr;
+    cached_blob_ = nullptr;
+    cached_blob_begin_ = nullptr;
+    cached_blob_end_ = nullptr;
+
+    if (source != nullptr && source->find_product(id, cached_blob_begin_, cached_blob_end_)) {
+        cached_blob_ = source;
+        return;
+    }
+
+    for (const auto &family : all_gpu_families) {
+        auto it = std::find_if(family.begin, family.end,
+                               [id](const db::gpu_counter_table &table) { return table.id == id; });
+        if (it != family.end) {
+            cached_table_ = &it->counters;
+            break;
+        }
+    }
+}
+
+const counter_table *counter_database::find_gpu(device::product_id id) const {
+    resolve(id);
+    return cached_table_;
+}
+
+const database_blob *counter_database::find_blob_gpu(device::product_id id) const {
+    resolve(id);
+    return cached_blob_;
+}
+
+void counter_database::use_blob(const database_blob *blob) {
+    blob_in_use.store(blob != nullptr && *blob ? blob : nullptr, std::memory_order_release);
+}
+
+std::error_code counter_database::load_blob(const std::string &path) {
+    // kept until the process exits, as the counter definitions of the configurations point into them
+    static std::mutex mutex{};
+    static std::vector<std::unique_ptr<database_blob_file>> files{};
+
+    std::unique_ptr<database_blob_file> file(new database_blob_file(path));
+    if (!*file) {
+        return file->get_error();
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    files.push_back(std::move(file));
+    use_blob(&files.back()->get_blob());
+    return {};
+}
+
+size_t counter_database::get_memory_footprint() {
+    size_t result = database::get_metadata_size();
+
+    // products of a family share their records, which are only counted once
+    std::vector<const detail::counter_record *> counted;
+    const auto add_records = [&](const detail::counter_record *begin, const detail::counter_record *end) {
+        if (begin == nullptr || std::find(counted.begin(), counted.end(), begin) != counted.end()) {
+            return;
+        }
+        counted.push_back(begin);
+        result += static_cast<size_t>(end - begin) * sizeof(detail::counter_record);
+    };
+
+    for (const auto &family : all_gpu_families) {
+        result += static_cast<size_t>(family.end - family.begin) * sizeof(database::gpu_counter_table);
+        for (const auto *table = family.begin; table != family.end; ++table) {
+            add_records(table->counters.shared_begin, table->counters.shared_end);
+            add_records(table->counters.overrides_begin, table->counters.overrides_end);
+        }
+    }
+    return result;
+}
+
+bool counter_database::is_gpu_known(device::product_id id) const {
+    return find_blob_gpu(id) != nullptr || find_gpu(id) != nullptr;
 }
 
 gpu_counter_view<counter_database> counter_database::get_counters_for_gpu(device::product_id id) const {
-    namespace db = hwcpipe::database;
+    if (find_blob_gpu(id) != nullptr) {
+        return {*this, cached_blob_begin_, cached_blob_end_};
+    }
 
-    auto it = db::all_gpu_counters.find(id);
-    if (it == db::all_gpu_counters.end()) {
-        return {*this, {}, {}};
+    const auto *table = find_gpu(id);
+    if (table == nullptr) {
+        return {*this, {}};
     }
 
-    const auto &counters_map = it->second;
-    return {*this, counters_map.cbegin(), counters_map.cend()};
+    return {*this, *table};
 }
 
 std::error_code counter_database::describe_counter(hwcpipe_counter counter, counter_metadata &metadata) const {
     namespace db = hwcpipe::database;
-    if (static_cast<size_t>(counter) >= db::all_counter_metadata.size()) {
+    const auto index = static_cast<size_t>(counter);
+    if (index >= db::num_counters) {
         return hwcpipe::make_error_code(hwcpipe::errc::unknown_counter);
     }
 
-    metadata = db::all_counter_metadata[static_cast<size_t>(counter)];
+    metadata = {db::get_counter_name(index), db::get_counter_units(index)};
     return {};
 }
 
+std::error_code counter_database::find_counter(const char *name, size_t length, hwcpipe_counter &counter) const {
+    namespace db = hwcpipe::database;
+
+    // compares an identifier with the name, as std::strcmp would if the name was null terminated
+    const auto compare = [name, length](const char *identifier) {
+        const int result = std::strncmp(identifier, name, length);
+        if (result != 0) {
+            return result;
+        }
+        return identifier[length] == '\0' ? 0 : 1;
+    };
+
+    const auto &sorted = db::all_counter_identifiers_sorted;
+    const auto it = std::lower_bound(sorted.begin(), sorted.end(), 0, [&](uint16_t index, int) {
+        return compare(db::get_counter_identifier(index)) < 0;
+    });
+    if (it == sorted.end() || compare(db::get_counter_identifier(*it)) != 0) {
+        return hwcpipe::make_error_code(hwcpipe::errc::unknown_counter);
+    }
+
+    counter = static_cast<hwcpipe_counter>(*it);
+    return {};
+}
+
+uint64_t counter_database::get_checksum(device::product_id id) const {
+    // FNV-1a of the fields of the records, the evaluators are addresses that change with every load
+    uint64_t hash = 0xCBF29CE484222325ULL;
+    const auto mix = [&hash](uint64_t value) {
+        hash = (hash ^ value) * 0x100000001B3ULL;
+    };
+
+    if (const auto *blob = find_blob_gpu(id)) {
+        // the bytecode is hashed in place of the evaluators
+        for (const auto *record = cached_blob_begin_; record != cached_blob_end_; ++record) {
+            mix(record->counter);
+            mix(record->tag);
+            mix(record->offset);
+            mix(record->shift);
+            mix(record->block_type);
+            for (const auto dependency : blob->get_dependencies(*record)) {
+                mix(static_cast<uint64_t>(dependency));
+            }
+            if (record->tag == static_cast<uint8_t>(counter_definition::type::expression)) {
+                const auto code = blob->get_counter_def(*record).get_expression().code;
+                for (uint32_t i = 0; i != code.size; ++i) {
+                    mix(static_cast<uint64_t>(code.code[i].op));
+                    mix(code.code[i].operand);
+                    if (code.code[i].op == expression::opcode::literal) {
+                        uint64_t bits{};
+                        std::memcpy(&bits, &code.literals[code.code[i].operand], sizeof(bits));
+                        mix(bits);
+                    }
+                }
+            }
+        }
+        return hash;
+    }
+
+    const auto *table = find_gpu(id);
+    if (table == nullptr) {
+        return 0;
+    }
+
+    for (const auto counter : get_counters_for_gpu(id)) {
+        const auto *record = table->find(counter);
+        mix(static_cast<uint64_t>(record->counter));
+        mix(static_cast<uint64_t>(record->tag));
+        mix(record->offset);
+        mix(record->shift);
+        mix(static_cast<uint64_t>(record->block_type));
+        for (uint8_t i = 0; i != record->num_dependencies; ++i) {
+            mix(static_cast<uint64_t>(record->dependencies[i]));
+        }
+    }
+    return hash;
+}
+
 counter_definition counter_database::get_counter_def(device::product_id id, hwcpipe_counter counter,
                                                      std::error_code &ec) {
-    namespace db = hwcpipe::database;
+    if (const auto *blob = find_blob_gpu(id)) {
+        const auto *record = database_blob::find_record(cached_blob_begin_, cached_blob_end_, counter);
+        if (record == nullptr) {
+            ec = make_error_code(errc::invalid_counter_for_device);
+            return {};
+        }
+        return blob->get_counter_def(*record);
+    }
 
-    auto it = db::all_gpu_counters.find(id);
-    if (it == db::all_gpu_counters.end()) {
+    const auto *table = find_gpu(id);
+    if (table == nullptr) {
         ec = make_error_code(hwcpipe::errc::invalid_device);
         return {};
     }
 
-    auto counter_address_it = it->second.find(counter);
-    if (counter_address_it == it->second.end()) {
+    const auto *record = table->find(counter);
+    if (record == nullptr) {
         ec = make_error_code(errc::invalid_counter_for_device);
         return {};
     }
 
-    return counter_address_it->second;
+    return record->to_definition();
 }
 
 } // namespace detail
@@ -0,0 +1,438 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <hwcpipe/detail/counter_database.hpp>
+#include <hwcpipe/detail/custom_expression.hpp>
+#include <hwcpipe/error.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+
+namespace hwcpipe {
+namespace detail {
+namespace expression {
+
+namespace {
+/** The device constants that expressions may name, in device_constants order. */
+constexpr const char *config_identifiers[] = {
+    "MaliConfigExtBusByteSize",
+    "MaliConfigShaderCoreCount",
+    "MaliConfigL2CacheCount",
+};
+
+/** The deepest nesting of parentheses and calls the parser accepts. */
+constexpr size_t max_nesting_depth = 64;
+
+double config_value(const device_constants &constants, uint32_t index) {
+    switch (index) {
+    case 0:
+        return constants.ext_bus_byte_size;
+    case 1:
+        return constants.shader_core_count;
+    case 2:
+    default:
+        return constants.l2_cache_count;
+    }
+}
+} // namespace
+
+/**
+ * Recursive descent parser for the expression grammar:
+ *
+ *     sum     := product (('+' | '-') product)*
+ *     product := unary (('*' | '/') unary)*
+ *     unary   := '-' unary | atom
+ *     atom    := NUMBER | NAME | ('min' | 'max') '(' sum (',' sum)+ ')' | '(' sum ')'
+ */
+class expression_parser {
+  public:
+    using kind = custom_expression::kind;
+    using node = custom_expression::node;
+
+    expression_parser(const std::string &source, custom_expression &expression)
+        : cursor_(source.c_str())
+        , expression_(expression) {}
+
+    std::error_code parse() {
+        uint32_t root{};
+        auto ec = parse_sum(root);
+        if (ec) {
+            return ec;
+        }
+        skip_whitespace();
+        if (*cursor_ != '\0') {
+            return make_error_code(errc::invalid_expression);
+        }
+        if (stack_need(root) > program::max_stack_depth) {
+            return make_error_code(errc::invalid_expression);
+        }
+        return {};
+    }
+
+  private:
+    std::error_code parse_sum(uint32_t &result) {
+        auto ec = parse_product(result);
+        while (!ec) {
+            skip_whitespace();
+            if (*cursor_ != '+' && *cursor_ != '-') {
+                break;
+            }
+            const auto type = *cursor_++ == '+' ? kind::add : kind::sub;
+            uint32_t rhs{};
+            ec = parse_product(rhs);
+            if (!ec) {
+                result = add_operation(type, {result, rhs});
+            }
+        }
+        return ec;
+    }
+
+    std::error_code parse_product(uint32_t &result) {
+        auto ec = parse_unary(result);
+        while (!ec) {
+            skip_whitespace();
+            if (*cursor_ != '*' && *cursor_ != '/') {
+                break;
+            }
+            const auto type = *cursor_++ == '*' ? kind::mul : kind::div;
+            uint32_t rhs{};
+            ec = parse_unary(rhs);
+            if (!ec) {
+                result = add_operation(type, {result, rhs});
+            }
+        }
+        return ec;
+    }
+
+    std::error_code parse_unary(uint32_t &result) {
+        skip_whitespace();
+        if (*cursor_ != '-') {
+            return parse_atom(result);
+        }
+        ++cursor_;
+
+        nesting_guard guard(depth_);
+        if (depth_ > max_nesting_depth) {
+            return make_error_code(errc::invalid_expression);
+        }
+        uint32_t operand{};
+        auto ec = parse_unary(operand);
+        if (!ec) {
+            result = add_operation(kind::neg, {operand});
+        }
+        return ec;
+    }
+
+    std::error_code parse_atom(uint32_t &result) {
+        skip_whitespace();
+
+        if (std::isdigit(static_cast<unsigned char>(*cursor_)) || *cursor_ == '.') {
+            char *end{};
+            const double value = std::strtod(cursor_, &end);
+            if (end == cursor_) {
+                return make_error_code(errc::invalid_expression);
+            }
+            cursor_ = end;
+            result = add_leaf(kind::literal, value, 0);
+            return {};
+        }
+
+        if (*cursor_ == '(') {
+            ++cursor_;
+            nesting_guard guard(depth_);
+            if (depth_ > max_nesting_depth) {
+                return make_error_code(errc::invalid_expression);
+            }
+            auto ec = parse_sum(result);
+            if (!ec) {
+                ec = expect(')');
+            }
+            return ec;
+        }
+
+        const char *name = cursor_;
+        while (std::isalnum(static_cast<unsigned char>(*cursor_)) || *cursor_ == '_') {
+            ++cursor_;
+        }
+        const size_t length = static_cast<size_t>(cursor_ - name);
+        if (length == 0) {
+            return make_error_code(errc::invalid_expression);
+        }
+
+        if (is_name(name, length, "min") || is_name(name, length, "max")) {
+            return parse_call(name[1] == 'i' ? kind::min : kind::max, result);
+        }
+        return resolve_name(name, length, result);
+    }
+
+    std::error_code parse_call(kind type, uint32_t &result) {
+        auto ec = expect('(');
+        if (ec) {
+            return ec;
+        }
+
+        nesting_guard guard(depth_);
+        if (depth_ > max_nesting_depth) {
+            return make_error_code(errc::invalid_expression);
+        }
+
+        std::vector<uint32_t> arguments{};
+        for (;;) {
+            uint32_t argument{};
+            ec = parse_sum(argument);
+            if (ec) {
+                return ec;
+            }
+            arguments.push_back(argument);
+            skip_whitespace();
+            if (*cursor_ != ',') {
+                break;
+            }
+            ++cursor_;
+        }
+
+        ec = expect(')');
+        if (ec) {
+            return ec;
+        }
+        if (arguments.size() < 2) {
+            return make_error_code(errc::invalid_expression);
+        }
+        result = add_operation(type, arguments);
+        return {};
+    }
+
+    std::error_code resolve_name(const char *name, size_t length, uint32_t &result) {
+        for (uint32_t i = 0; i != sizeof(config_identifiers) / sizeof(config_identifiers[0]); ++i) {
+            if (is_name(name, length, config_identifiers[i])) {
+                result = add_leaf(kind::config, 0.0, i);
+                return {};
+            }
+        }
+
+        hwcpipe_counter counter{};
+        auto ec = counter_database{}.find_counter(name, length, counter);
+        if (ec) {
+            return ec;
+        }
+
+        auto &dependencies = expression_.dependencies_;
+        const auto dependency = std::find(dependencies.begin(), dependencies.end(), counter);
+        const auto input = static_cast<uint32_t>(dependency - dependencies.begin());
+        if (dependency == dependencies.end()) {
+            dependencies.push_back(counter);
+        }
+        result = add_leaf(kind::input, 0.0, input);
+        return {};
+    }
+
+    uint32_t add_leaf(kind type, double value, uint32_t index) {
+        expression_.nodes_.push_back({type, value, index, 0, 0});
+        return static_cast<uint32_t>(expression_.nodes_.size() - 1);
+    }
+
+    /**
+     * Appends an operation node. Operations whose operands are all literals
+     * are folded into a literal straight away.
+     */
+    uint32_t add_operation(kind type, const std::vector<uint32_t> &operands) {
+        auto &nodes = expression_.nodes_;
+        const bool constant = std::all_of(operands.begin(), operands.end(),
+                                          [&](uint32_t operand) { return nodes[operand].type == kind::literal; });
+        if (constant) {
+            std::vector<double> values{};
+            for (auto operand : operands) {
+                values.push_back(nodes[operand].value);
+            }
+            return add_leaf(kind::literal, custom_expression::apply(type, values.data(), values.size()), 0);
+        }
+
+        auto &children = expression_.children_;
+        const auto first_child = static_cast<uint32_t>(children.size());
+        children.insert(children.end(), operands.begin(), operands.end());
+        nodes.push_back({type, 0.0, 0, first_child, static_cast<uint32_t>(operands.size())});
+        return static_cast<uint32_t>(nodes.size() - 1);
+    }
+
+    /** @return The number of stack slots the postfix program of a node needs. */
+    size_t stack_need(uint32_t index) const {
+        const auto &node = expression_.nodes_[index];
+        size_t need = 1;
+        for (uint32_t i = 0; i != node.num_children; ++i) {
+            need = std::max(need, i + stack_need(expression_.children_[node.first_child + i]));
+        }
+        return need;
+    }
+
+    std::error_code expect(char c) {
+        skip_whitespace();
+        if (*cursor_ != c) {
+            return make_error_code(errc::invalid_expression);
+        }
+        ++cursor_;
+        return {};
+    }
+
+    void skip_whitespace() {
+        while (std::isspace(static_cast<unsigned char>(*cursor_))) {
+            ++cursor_;
+        }
+    }
+
+    static bool is_name(const char *name, size_t length, const char *identifier) {
+        return std::strncmp(name, identifier, length) == 0 && identifier[length] == '\0';
+    }
+
+    // tracks the nesting depth of the current parse call
+    struct nesting_guard {
+        explicit nesting_guard(size_t &depth)
+            : depth_(++depth) {}
+        ~nesting_guard() { --depth_; }
+        size_t &depth_;
+    };
+
+    const char *cursor_;
+    custom_expression &expression_;
+    size_t depth_{};
+};
+
+std::error_code custom_expression::compile(const std::string &source, custom_expression &expression) {
+    expression = custom_expression{};
+    auto ec = expression_parser(source, expression).parse();
+    if (ec) {
+        expression = custom_expression{};
+    }
+    return ec;
+}
+
+double custom_expression::apply(kind type, const double *values, size_t count) {
+    switch (type) {
+    case kind::add:
+        return hwcpipe_double(values[0]) + values[1];
+    case kind::sub:
+        return hwcpipe_double(values[0]) - values[1];
+    case kind::mul:
+        return hwcpipe_double(values[0]) * values[1];
+    case kind::div:
+        return hwcpipe_double(values[0]) / values[1];
+    case kind::neg:
+        return -values[0];
+    case kind::min:
+        return *std::min_element(values, values + count);
+    case kind::max:
+        return *std::max_element(values, values + count);
+    case kind::literal:
+    case kind::input:
+    case kind::config:
+    default:
+        return values[0];
+    }
+}
+
+program custom_expression::emit(const device_constants &constants) const {
+    program result{};
+    if (nodes_.empty()) {
+        return result;
+    }
+
+    // the nodes are in post-order, so the operands of a node are resolved
+    // before the node itself
+    std::vector<bool> constant(nodes_.size());
+    std::vector<double> values(nodes_.size());
+    for (size_t i = 0; i != nodes_.size(); ++i) {
+        const auto &node = nodes_[i];
+        switch (node.type) {
+        case kind::literal:
+            constant[i] = true;
+            values[i] = node.value;
+            break;
+        case kind::config:
+            constant[i] = true;
+            values[i] = config_value(constants, node.index);
+            break;
+        case kind::input:
+            constant[i] = false;
+            break;
+        case kind::add:
+        case kind::sub:
+        case kind::mul:
+        case kind::div:
+        case kind::neg:
+        case kind::min:
+        case kind::max:
+        default: {
+            const auto first = children_.begin() + node.first_child;
+            const auto last = first + node.num_children;
+            constant[i] = std::all_of(first, last, [&](uint32_t child) { return constant[child]; });
+            if (constant[i]) {
+                std::vector<double> operands{};
+                for (auto it = first; it != last; ++it) {
+                    operands.push_back(values[*it]);
+                }
+                values[i] = apply(node.type, operands.data(), operands.size());
+            }
+            break;
+        }
+        }
+    }
+
+    emit_node(static_cast<uint32_t>(nodes_.size() - 1), constant, values, result);
+    return result;
+}
+
+void custom_expression::emit_node(uint32_t index, const std::vector<bool> &constant, const std::vector<double> &values,
+                                  program &result) const {
+    using opcode = program::opcode;
+    const auto &node = nodes_[index];
+
+    if (constant[index]) {
+        result.code_.push_back({opcode::literal, static_cast<uint32_t>(result.literals_.size())});
+        result.literals_.push_back(values[index]);
+        return;
+    }
+
+    for (uint32_t i = 0; i != node.num_children; ++i) {
+        emit_node(children_[node.first_child + i], constant, values, result);
+    }
+
+    switch (node.type) {
+    case kind::input:
+        result.code_.push_back({opcode::input, node.index});
+        break;
+    case kind::add:
+        result.code_.push_back({opcode::add, 0});
+        break;
+    case kind::sub:
+        result.code_.push_back({opcode::sub, 0});
+        break;
+    case kind::mul:
+        result.code_.push_back({opcode::mul, 0});
+        break;
+    case kind::div:
+        result.code_.push_back({opcode::div, 0});
+        break;
+    case kind::neg:
+        result.code_.push_back({opcode::neg, 0});
+        break;
+    case kind::min:
+        result.code_.push_back({opcode::min, node.num_children});
+        break;
+    case kind::max:
+        result.code_.push_back({opcode::max, node.num_children});
+        break;
+    case kind::literal:
+    case kind::config:
+    default:
+        // constants are emitted as literals above
+        break;
+    }
+}
+
+} // namespace expression
+} // namespace detail
+} // namespace hwcpipe
@@ -0,0 +1,354 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hwcpipe/detail/database_blob.hpp"
+
+#include "hwcpipe/counter_metadata.hpp"
+#include "hwcpipe/error.hpp"
+
+#include <device/hwcnt/sampler/configuration.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace hwcpipe {
+namespace detail {
+
+namespace {
+namespace layout = database_blob_layout;
+
+/** Number of hwcpipe_counter values. */
+constexpr uint32_t num_hwcpipe_counters = static_cast<uint32_t>(database::num_counters);
+
+/** @return Whether the blob has @p count elements of @p element_size bytes at @p offset. */
+bool fits(size_t size, size_t offset, size_t count, size_t element_size) {
+    return offset <= size && count <= (size - offset) / element_size;
+}
+
+/** @return Whether a range of @p count elements from @p first lies in @p total elements. */
+bool in_range(uint32_t first, uint32_t count, uint32_t total) {
+    return first <= total && count <= total - first;
+}
+} // namespace
+
+uint32_t get_product_key(device::product_id id) {
+    switch (id) {
+    case device::product_id::g31:
+        return 0x7003;
+    case device::product_id::g51:
+        return 0x7000;
+    case device::product_id::g52:
+        return 0x7002;
+    case device::product_id::g71:
+        return 0x6000;
+    case device::product_id::g72:
+        return 0x6001;
+    case device::product_id::g76:
+        return 0x7001;
+    case device::product_id::g57:
+        return 0x9001;
+    case device::product_id::g57_2:
+        return 0x9003;
+    case device::product_id::g68:
+        return 0x9004;
+    case device::product_id::g77:
+        return 0x9000;
+    case device::product_id::g78:
+        return 0x9002;
+    case device::product_id::g78ae:
+        return 0x9005;
+    case device::product_id::g310:
+        return 0xa004;
+    case device::product_id::g510:
+        return 0xa003;
+    case device::product_id::g610:
+        return 0xa007;
+    case device::product_id::g615:
+        return 0xb003;
+    case device::product_id::g710:
+        return 0xa002;
+    case device::product_id::g715:
+        return 0xb002;
+    case device::product_id::g720:
+        return 0xc000;
+    case device::product_id::g620:
+        return 0xc001;
+    case device::product_id::g725:
+        return 0xd000;
+    case device::product_id::g625:
+        return 0xd001;
+    case device::product_id::g1_ultra:
+        return 0xe000;
+    case device::product_id::g1_premium:
+        return 0xe001;
+    case device::product_id::g1_pro:
+        return 0xe003;
+    case device::product_id::t60x:
+    case device::product_id::t62x:
+    case device::product_id::t720:
+    case device::product_id::t760:
+    case device::product_id::t820:
+    case device::product_id::t830:
+    case device::product_id::t860:
+    case device::product_id::t880:
+    default:
+        return 0;
+    }
+}
+
+database_blob::database_blob(const void *data, size_t size)
+    : ec_(make_error_code(errc::invalid_database_blob)) {
+    const auto *bytes = static_cast<const uint8_t *>(data);
+    if (bytes == nullptr || size < sizeof(layout::header) || reinterpret_cast<uintptr_t>(bytes) % 8 != 0) {
+        return;
+    }
+
+    layout::header header{};
+    std::memcpy(&header, bytes, sizeof(header));
+    if (header.magic != layout::magic || header.version_major != layout::version_major || header.size != size) {
+        return;
+    }
+
+    // the sections, in order
+    size_t offset = sizeof(layout::header);
+    if (!fits(size, offset, header.num_literals, sizeof(double))) {
+        return;
+    }
+    literals_ = reinterpret_cast<const double *>(bytes + offset);
+    offset += header.num_literals * sizeof(double);
+
+    if (!fits(size, offset, header.num_products, sizeof(layout::product_entry))) {
+        return;
+    }
+    products_ = reinterpret_cast<const layout::product_entry *>(bytes + offset);
+    offset += header.num_products * sizeof(layout::product_entry);
+
+    if (!fits(size, offset, header.num_records, sizeof(record_entry))) {
+        return;
+    }
+    records_ = reinterpret_cast<const record_entry *>(bytes + offset);
+    offset += header.num_records * sizeof(record_entry);
+
+    if (!fits(size, offset, header.num_instructions, sizeof(expression::instruction))) {
+        return;
+    }
+    instructions_ = reinterpret_cast<const expression::instruction *>(bytes + offset);
+    offset += header.num_instructions * sizeof(expression::instruction);
+
+    if (!fits(size, offset, header.num_dependencies, sizeof(hwcpipe_counter)) ||
+        offset + header.num_dependencies * sizeof(hwcpipe_counter) != size) {
+        return;
+    }
+    dependencies_ = reinterpret_cast<const hwcpipe_counter *>(bytes + offset);
+
+    for (uint32_t i = 0; i != header.num_dependencies; ++i) {
+        if (static_cast<uint32_t>(dependencies_[i]) >= num_hwcpipe_counters) {
+            return;
+        }
+    }
+
+    std::vector<uint8_t> marks{};
+    for (uint32_t p = 0; p != header.num_products; ++p) {
+        const auto &product = products_[p];
+        if ((p != 0 && products_[p - 1].product_key >= product.product_key) ||
+            !in_range(product.first_record, product.num_records, header.num_records)) {
+            return;
+        }
+
+        const auto *begin = records_ + product.first_record;
+        const auto *end = begin + product.num_records;
+        for (const auto *record = begin; record != end; ++record) {
+            if ((record != begin && record[-1].counter >= record->counter) ||
+                record->counter >= num_hwcpipe_counters) {
+                return;
+            }
+
+            switch (static_cast<counter_definition::type>(record->tag)) {
+            case counter_definition::type::hardware:
+                // the values are shifted as 32 bit integers, a wider shift is undefined
+                if (record->block_type > static_cast<uint8_t>(device::hwcnt::block_type::last) ||
+                    record->offset >= device::hwcnt::sampler::configuration::max_counters_per_block ||
+                    record->shift >= 32) {
+                    return;
+                }
+                break;
+            case counter_definition::type::expression:
+                if (!in_range(record->first_dependency, record->num_dependencies, header.num_dependencies) ||
+                    !in_range(record->first_instruction, record->num_instructions, header.num_instructions)) {
+                    return;
+                }
+                for (auto dependency : get_dependencies(*record)) {
+                    if (find_record(begin, end, dependency) == nullptr) {
+                        return;
+                    }
+                }
+                if (!validate_expression(*record, header.num_literals)) {
+                    return;
+                }
+                break;
+            case counter_definition::type::invalid:
+            default:
+                return;
+            }
+        }
+
+        // the expressions must not depend on themselves: depth first walk
+        // with 1 marking the records being visited and 2 the visited ones
+        marks.assign(product.num_records, 0);
+        const auto visit = [&](const record_entry &record, const auto &self) -> bool {
+            auto &mark = marks[static_cast<size_t>(&record - begin)];
+            if (mark != 0) {
+                return mark == 2;
+            }
+            mark = 1;
+            if (record.tag == static_cast<uint8_t>(counter_definition::type::expression)) {
+                for (auto dependency : get_dependencies(record)) {
+                    if (!self(*find_record(begin, end, dependency), self)) {
+                        return false;
+                    }
+                }
+            }
+            mark = 2;
+            return true;
+        };
+        for (const auto *record = begin; record != end; ++record) {
+            if (!visit(*record, visit)) {
+                return;
+            }
+        }
+    }
+
+    size_ = size;
+    num_products_ = header.num_products;
+    ec_ = {};
+}
+
+bool database_blob::validate_expression(const record_entry &record, uint32_t num_literals) const {
+    // the bytecode must keep its stack within bounds, and leave one value
+    size_t depth = 0;
+    const auto *code = instructions_ + record.first_instruction;
+    for (const auto *it = code; it != code + record.num_instructions; ++it) {
+        size_t pops = 0;
+        size_t pushes = 1;
+        switch (it->op) {
+        case expression::opcode::input:
+            if (it->operand >= record.num_dependencies) {
+                return false;
+            }
+            break;
+        case expression::opcode::literal:
+            if (it->operand >= num_literals) {
+                return false;
+            }
+            break;
+        case expression::opcode::constant:
+            if (it->operand >= expression::num_device_constants) {
+                return false;
+            }
+            break;
+        case expression::opcode::add:
+        case expression::opcode::sub:
+        case expression::opcode::mul:
+        case expression::opcode::div:
+            pops = 2;
+            break;
+        case expression::opcode::neg:
+            pops = 1;
+            break;
+        case expression::opcode::min:
+        case expression::opcode::max:
+            if (it->operand < 2) {
+                return false;
+            }
+            pops = it->operand;
+            break;
+        default:
+            return false;
+        }
+
+        if (depth < pops) {
+            return false;
+        }
+        depth = depth - pops + pushes;
+        if (depth > expression::max_stack_depth) {
+            return false;
+        }
+    }
+    return depth == 1;
+}
+
+bool database_blob::find_product(device::product_id id, const record_entry *&begin, const record_entry *&end) const {
+    const uint32_t key = get_product_key(id);
+    const auto *products_end = products_ + num_products_;
+    const auto *product =
+        std::lower_bound(products_, products_end, key, [](const layout::product_entry &lhs, uint32_t rhs) {
+            return lhs.product_key < rhs;
+        });
+    if (key == 0 || product == products_end || product->product_key != key) {
+        return false;
+    }
+
+    begin = records_ + product->first_record;
+    end = begin + product->num_records;
+    return true;
+}
+
+const database_blob::record_entry *database_blob::find_record(const record_entry *begin, const record_entry *end,
+                                                              hwcpipe_counter counter) {
+    const auto value = static_cast<uint32_t>(counter);
+    const auto *record =
+        std::lower_bound(begin, end, value, [](const record_entry &lhs, uint32_t rhs) { return lhs.counter < rhs; });
+    return record != end && record->counter == value ? record : nullptr;
+}
+
+counter_definition database_blob::get_counter_def(const record_entry &record) const {
+    if (record.tag == static_cast<uint8_t>(counter_definition::type::hardware)) {
+        return counter_definition(
+            block_offset{record.offset, record.shift, static_cast<device::hwcnt::block_type>(record.block_type)});
+    }
+
+    const expression::bytecode code{instructions_ + record.first_instruction, record.num_instructions, literals_};
+    return counter_definition(
+        expression::expression_definition{nullptr, get_dependencies(record), nullptr, nullptr, code});
+}
+
+database_blob_file::database_blob_file(const std::string &path) {
+    const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    struct stat status {};
+    if (fd < 0 || ::fstat(fd, &status) != 0 || status.st_size <= 0) {
+        ec_ = make_error_code(errc::database_blob_unavailable);
+        if (fd >= 0) {
+            ::close(fd);
+        }
+        return;
+    }
+
+    size_ = static_cast<size_t>(status.st_size);
+    data_ = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (data_ == MAP_FAILED) {
+        data_ = nullptr;
+        ec_ = make_error_code(errc::database_blob_unavailable);
+        return;
+    }
+
+    blob_ = database_blob(data_, size_);
+}
+
+database_blob_file::~database_blob_file() {
+    if (data_ != nullptr) {
+        ::munmap(data_, size_);
+    }
+}
+
+} // namespace detail
+} // namespace hwcpipe
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hwcpipe/detail/decimal_format.hpp"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+namespace hwcpipe {
+namespace detail {
+
+namespace {
+
+/** Integers up to 2^53 are exact doubles. */
+constexpr double max_exact_integer = 9007199254740992.0;
+
+/** Powers of ten with an exact double, up to the largest number of decimals. */
+constexpr uint64_t powers_of_ten[] = {1ULL,
+                                      10ULL,
+                                      100ULL,
+                                      1000ULL,
+                                      10000ULL,
+                                      100000ULL,
+                                      1000000ULL,
+                                      10000000ULL,
+                                      100000000ULL,
+                                      1000000000ULL,
+                                      10000000000ULL,
+                                      100000000000ULL,
+                                      1000000000000ULL,
+                                      10000000000000ULL,
+                                      100000000000000ULL,
+                                      1000000000000000ULL};
+
+constexpr int max_decimals = static_cast<int>(sizeof(powers_of_ten) / sizeof(powers_of_ten[0])) - 1;
+
+} // namespace
+
+char *format_double(double value, int decimals, char *out) {
+    const double magnitude = std::fabs(value);
+    if (magnitude < max_exact_integer && std::trunc(value) == value) {
+        return format_integer(static_cast<int64_t>(value), out);
+    }
+
+    if (decimals >= 0) {
+        const int digits = std::min(decimals, max_decimals);
+        const uint64_t scale = powers_of_ten[digits];
+        const double scaled = std::round(magnitude * static_cast<double>(scale));
+        if (scaled < max_exact_integer) {
+            const auto fixed = static_cast<uint64_t>(scaled);
+            if (value < 0 && fixed != 0) {
+                *out++ = '-';
+            }
+            out = format_unsigned(fixed / scale, out);
+            if (digits != 0) {
+                *out++ = '.';
+                char fraction[max_integer_size];
+                char *fraction_end = format_unsigned(fixed % scale, fraction);
+                const auto size = static_cast<int>(fraction_end - fraction);
+                out = std::fill_n(out, digits - size, '0');
+                out = std::copy(fraction, fraction_end, out);
+            }
+            return out;
+        }
+    }
+
+    // the fewest significant digits that parse back to the value: most
+    // values need 15 to 17
+    char text[max_double_size + 8];
+    int size = 0;
+    for (int precision = 15; precision != 17; ++precision) {
+        size = std::snprintf(text, sizeof(text), "%.*g", precision, value);
+        if (std::strtod(text, nullptr) == value) {
+            return std::copy(text, text + size, out);
+        }
+    }
+    size = std::snprintf(text, sizeof(text), "%.17g", value);
+    return std::copy(text, text + size, out);
+}
+
+} // namespace detail
+} // namespace hwcpipe
@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <hwcpipe/detail/gather_plan.hpp>
+#include <hwcpipe/detail/kernel_dispatch.hpp>
+
+#include <initializer_list>
+
+#if defined(__linux__) && (defined(__aarch64__) || defined(__arm__))
+#include <sys/auxv.h>
+#endif
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#include <immintrin.h>
+#define HWCPIPE_KERNEL_AVX2 1
+#endif
+
+namespace hwcpipe {
+namespace detail {
+
+namespace {
+
+// the bits of AT_HWCAP and AT_HWCAP2, for C libraries that don't define them
+#if defined(__aarch64__)
+#ifndef HWCAP_ASIMD
+#define HWCAP_ASIMD (1UL << 1U)
+#endif
+#ifndef HWCAP_ASIMDDP
+#define HWCAP_ASIMDDP (1UL << 20U)
+#endif
+#ifndef HWCAP2_SVE2
+#define HWCAP2_SVE2 (1UL << 1U)
+#endif
+#elif defined(__arm__)
+#ifndef HWCAP_NEON
+#define HWCAP_NEON (1UL << 12U)
+#endif
+#endif
+
+cpu_features detect_cpu_features() {
+    cpu_features result{};
+#if defined(__linux__) && defined(__aarch64__)
+    const unsigned long hwcap = getauxval(AT_HWCAP);
+    const unsigned long hwcap2 = getauxval(AT_HWCAP2);
+    result.neon = (hwcap & HWCAP_ASIMD) != 0;
+    result.dotprod = (hwcap & HWCAP_ASIMDDP) != 0;
+    result.sve2 = (hwcap2 & HWCAP2_SVE2) != 0;
+#elif defined(__linux__) && defined(__arm__)
+    result.neon = (getauxval(AT_HWCAP) & HWCAP_NEON) != 0;
+#elif defined(__aarch64__)
+    result.neon = true;
+#elif (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+    __builtin_cpu_init();
+    result.sse2 = __builtin_cpu_supports("sse2") != 0;
+    result.avx2 = __builtin_cpu_supports("avx2") != 0;
+#endif
+    return result;
+}
+
+void reduce_32_scalar(const uint32_t *src, size_t count, uint64_t *totals) {
+    for (size_t i = 0; i < count; ++i) {
+        totals[i] += src[i];
+    }
+}
+
+void reduce_64_scalar(const uint64_t *src, size_t count, uint64_t *totals) {
+    for (size_t i = 0; i < count; ++i) {
+        totals[i] += src[i];
+    }
+}
+
+// the kernels of gather_plan.hpp are built for the baseline of the target
+void reduce_32_baseline(const uint32_t *src, size_t count, uint64_t *totals) { reduce_block(src, count, totals); }
+
+void reduce_64_baseline(const uint64_t *src, size_t count, uint64_t *totals) { reduce_block(src, count, totals); }
+
+#if defined(HWCPIPE_KERNEL_AVX2)
+// NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+__attribute__((target("avx2"))) void reduce_32_avx2(const uint32_t *src, size_t count, uint64_t *totals) {
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const __m256i values = _mm256_cvtepu32_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i)));
+        auto *acc_ptr = reinterpret_cast<__m256i *>(totals + i);
+        _mm256_storeu_si256(acc_ptr, _mm256_add_epi64(_mm256_loadu_si256(acc_ptr), values));
+    }
+    for (; i < count; ++i) {
+        totals[i] += src[i];
+    }
+}
+
+__attribute__((target("avx2"))) void reduce_64_avx2(const uint64_t *src, size_t count, uint64_t *totals) {
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const __m256i values = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i));
+        auto *acc_ptr = reinterpret_cast<__m256i *>(totals + i);
+        _mm256_storeu_si256(acc_ptr, _mm256_add_epi64(_mm256_loadu_si256(acc_ptr), values));
+    }
+    for (; i < count; ++i) {
+        totals[i] += src[i];
+    }
+}
+// NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+#endif
+
+constexpr decode_kernels scalar_kernels{kernel_isa::scalar, "scalar", reduce_32_scalar, reduce_64_scalar};
+#if defined(HWCPIPE_GATHER_NEON)
+constexpr decode_kernels neon_kernels{kernel_isa::neon, "neon", reduce_32_baseline, reduce_64_baseline};
+#elif defined(HWCPIPE_GATHER_SSE2)
+constexpr decode_kernels sse2_kernels{kernel_isa::sse2, "sse2", reduce_32_baseline, reduce_64_baseline};
+#endif
+#if defined(HWCPIPE_KERNEL_AVX2)
+constexpr decode_kernels avx2_kernels{kernel_isa::avx2, "avx2", reduce_32_avx2, reduce_64_avx2};
+#endif
+
+} // namespace
+
+const cpu_features &get_cpu_features() {
+    static const cpu_features features = detect_cpu_features();
+    return features;
+}
+
+const decode_kernels *find_decode_kernels(kernel_isa isa) {
+    const auto &features = get_cpu_features();
+    switch (isa) {
+    case kernel_isa::scalar:
+        return &scalar_kernels;
+    case kernel_isa::neon:
+#if defined(HWCPIPE_GATHER_NEON)
+        // the baseline of aarch64 has Advanced SIMD
+        return &neon_kernels;
+#else
+        return nullptr;
+#endif
+    case kernel_isa::sse2:
+#if defined(HWCPIPE_GATHER_SSE2)
+        // the baseline was built with SSE2
+        return &sse2_kernels;
+#else
+        return nullptr;
+#endif
+    case kernel_isa::avx2:
+#if defined(HWCPIPE_KERNEL_AVX2)
+        return features.avx2 ? &avx2_kernels : nullptr;
+#else
+        static_cast<void>(features);
+        return nullptr;
+#endif
+    default:
+        return nullptr;
+    }
+}
+
+const decode_kernels &select_decode_kernels() {
+    static const decode_kernels *const selected = [] {
+        // from the fastest
+        for (const auto isa : {kernel_isa::avx2, kernel_isa::sse2, kernel_isa::neon}) {
+            if (const auto *kernels = find_decode_kernels(isa)) {
+                return kernels;
+            }
+        }
+        return &scalar_kernels;
+    }();
+    return *selected;
+}
+
+} // namespace detail
+} // namespace hwcpipe
@@ -0,0 +1,216 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hwcpipe/counter_metadata.hpp"
+
+#include <hwcpipe/error.hpp>
+#include <hwcpipe/flight_recorder.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace hwcpipe {
+
+namespace {
+/** Sections of the file start on a cache line. */
+constexpr size_t section_alignment = 64;
+
+constexpr size_t align_up(size_t value, size_t alignment) { return (value + alignment - 1) / alignment * alignment; }
+} // namespace
+
+flight_recorder::flight_recorder(const std::string &path, const hwcpipe_counter *counters, size_t count,
+                                 size_t capacity)
+    : capacity_(capacity)
+    , staging_(count) {
+    using flight_layout::file_header;
+    using flight_layout::record_header;
+
+    for (size_t i = 0; i != count; ++i) {
+        if (static_cast<size_t>(counters[i]) >= database::num_counters) {
+            ec_ = make_error_code(errc::unknown_counter);
+            return;
+        }
+    }
+    if (capacity == 0) {
+        ec_ = make_error_code(errc::trace_write_failed);
+        return;
+    }
+
+    const size_t counters_offset = align_up(sizeof(file_header), section_alignment);
+    const size_t records_offset = align_up(counters_offset + count * sizeof(uint32_t), section_alignment);
+    record_size_ = sizeof(record_header) + count * sizeof(uint64_t);
+    size_ = records_offset + capacity * record_size_;
+
+    // the blocks are allocated up front, so that a full disk can't fault a record
+    const int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0 || ::posix_fallocate(fd, 0, static_cast<off_t>(size_)) != 0) {
+        ec_ = make_error_code(errc::trace_write_failed);
+        if (fd >= 0) {
+            ::close(fd);
+        }
+        return;
+    }
+
+    mapping_ = ::mmap(nullptr, size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, 0);
+    ::close(fd);
+    if (mapping_ == MAP_FAILED) {
+        mapping_ = nullptr;
+        ec_ = make_error_code(errc::trace_write_failed);
+        return;
+    }
+
+    auto *base = static_cast<char *>(mapping_);
+    file_header header{};
+    header.magic = flight_layout::magic;
+    header.version_major = flight_layout::version_major;
+    header.version_minor = flight_layout::version_minor;
+    header.header_size = sizeof(file_header);
+    header.num_counters = static_cast<uint32_t>(count);
+    header.counters_offset = static_cast<uint32_t>(counters_offset);
+    header.records_offset = static_cast<uint32_t>(records_offset);
+    header.record_size = static_cast<uint32_t>(record_size_);
+    header.capacity = static_cast<uint32_t>(capacity);
+    header.file_size = size_;
+    std::memcpy(base, &header, sizeof(header));
+
+    for (size_t i = 0; i != count; ++i) {
+        const auto counter = static_cast<uint32_t>(counters[i]);
+        std::memcpy(base + counters_offset + i * sizeof(counter), &counter, sizeof(counter));
+    }
+    records_ = base + records_offset;
+}
+
+flight_recorder::~flight_recorder() {
+    if (mapping_ != nullptr) {
+        ::munmap(mapping_, size_);
+    }
+}
+
+void flight_recorder::record(uint64_t timestamp, const double *values) {
+    if (ec_) {
+        return;
+    }
+
+    const uint64_t sequence = ++sequence_;
+    char *slot = records_ + static_cast<size_t>((sequence - 1) % capacity_) * record_size_;
+    char *slot_values = slot + sizeof(flight_layout::record_header);
+    std::memcpy(slot_values, values, staging_.size() * sizeof(double));
+
+    flight_layout::record_header header{};
+    header.sequence = sequence;
+    header.timestamp = timestamp;
+    header.checksum =
+        flight_layout::checksum(sequence, timestamp, reinterpret_cast<const uint64_t *>(slot_values), staging_.size());
+
+    // a crash can happen between any two stores, the checksum must be stored last
+    std::memcpy(slot, &header, offsetof(flight_layout::record_header, checksum));
+    std::atomic_signal_fence(std::memory_order_release);
+    std::memcpy(slot + offsetof(flight_layout::record_header, checksum), &header.checksum, sizeof(header.checksum));
+}
+
+std::error_code flight_recorder::sync() {
+    if (ec_) {
+        return ec_;
+    }
+    if (::msync(mapping_, size_, MS_SYNC) != 0) {
+        return make_error_code(errc::trace_write_failed);
+    }
+    return {};
+}
+
+flight_record_reader::flight_record_reader(const void *data, size_t size) {
+    using flight_layout::file_header;
+    using flight_layout::record_header;
+
+    ec_ = make_error_code(errc::invalid_trace_layout);
+    if (data == nullptr || size < sizeof(file_header)) {
+        return;
+    }
+
+    const auto *base = static_cast<const char *>(data);
+    file_header header{};
+    std::memcpy(&header, base, sizeof(header));
+    const size_t counters_end = size_t{header.counters_offset} + size_t{header.num_counters} * sizeof(uint32_t);
+    if (header.magic != flight_layout::magic || header.version_major != flight_layout::version_major ||
+        header.header_size < sizeof(file_header) || header.counters_offset < header.header_size ||
+        header.records_offset < counters_end || header.records_offset % sizeof(uint64_t) != 0 ||
+        header.record_size < sizeof(record_header) + size_t{header.num_counters} * sizeof(uint64_t) ||
+        header.record_size % sizeof(uint64_t) != 0 || header.capacity == 0 ||
+        header.records_offset + uint64_t{header.capacity} * header.record_size > size) {
+        return;
+    }
+
+    counters_ = base + header.counters_offset;
+    num_counters_ = header.num_counters;
+    records_ = base + header.records_offset;
+    record_size_ = header.record_size;
+    capacity_ = header.capacity;
+
+    // the valid records, by sequence
+    std::vector<std::pair<uint64_t, size_t>> valid{};
+    std::vector<uint64_t> values(num_counters_);
+    for (size_t slot = 0; slot != capacity_; ++slot) {
+        const char *record = records_ + slot * record_size_;
+        record_header record_info{};
+        std::memcpy(&record_info, record, sizeof(record_info));
+        if (record_info.sequence == 0 || (record_info.sequence - 1) % capacity_ != slot) {
+            continue;
+        }
+        std::memcpy(values.data(), record + sizeof(record_header), values.size() * sizeof(uint64_t));
+        if (flight_layout::checksum(record_info.sequence, record_info.timestamp, values.data(), values.size()) ==
+            record_info.checksum) {
+            valid.emplace_back(record_info.sequence, slot);
+        }
+    }
+    std::sort(valid.begin(), valid.end());
+
+    // the run of consecutive sequences that ends at the newest record
+    size_t first = valid.size();
+    while (first != 0 && (first == valid.size() || valid[first - 1].first + 1 == valid[first].first)) {
+        --first;
+    }
+    for (size_t i = first; i != valid.size(); ++i) {
+        slots_.push_back(valid[i].second);
+    }
+    ec_ = {};
+}
+
+flight_record_file::flight_record_file(const std::string &path) {
+    const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    struct stat status {};
+    if (fd < 0 || ::fstat(fd, &status) != 0 || status.st_size <= 0) {
+        ec_ = make_error_code(errc::trace_read_failed);
+        if (fd >= 0) {
+            ::close(fd);
+        }
+        return;
+    }
+
+    size_ = static_cast<size_t>(status.st_size);
+    data_ = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (data_ == MAP_FAILED) {
+        data_ = nullptr;
+        ec_ = make_error_code(errc::trace_read_failed);
+        return;
+    }
+
+    reader_ = flight_record_reader(data_, size_);
+}
+
+flight_record_file::~flight_record_file() {
+    if (data_ != nullptr) {
+        ::munmap(data_, size_);
+    }
+}
+
+} // namespace hwcpipe
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <hwcpipe/gpu.hpp>
+
+#include <string>
+
+#include <unistd.h>
+
+namespace hwcpipe {
+namespace detail {
+
+constexpr int gpu_registry::max_device_number;
+
+namespace {
+#if defined(HWCPIPE_SYSCALL_LIBMALI)
+// the device is reached through libmali, it may not have a device node
+const gpu_registry::candidate_function device_node_exists{};
+#else
+bool device_node_exists(int device_number) {
+    const std::string path = "/dev/mali" + std::to_string(device_number);
+    return ::access(path.c_str(), F_OK) == 0;
+}
+#endif
+} // namespace
+
+gpu_registry &gpu_registry::get() {
+    static gpu_registry registry([](int device_number) { return gpu(device_number); }, device_node_exists);
+    return registry;
+}
+
+int gpu_registry::next_candidate(int device_number) {
+    std::lock_guard<std::mutex> guard(lock_);
+
+    for (; device_number < max_device_number; ++device_number) {
+        auto &slot = entries_[static_cast<size_t>(device_number)];
+        if (!slot.checked) {
+            slot.candidate = is_candidate_ ? is_candidate_(device_number) : get_gpu_locked(device_number)->valid();
+            slot.checked = true;
+        }
+        if (slot.candidate) {
+            break;
+        }
+    }
+    return device_number;
+}
+
+std::shared_ptr<const gpu> gpu_registry::get_gpu(int device_number) {
+    std::lock_guard<std::mutex> guard(lock_);
+    return get_gpu_locked(device_number);
+}
+
+std::shared_ptr<const gpu> gpu_registry::get_gpu_locked(int device_number) {
+    if (device_number < 0 || device_number >= max_device_number) {
+        return std::make_shared<const gpu>();
+    }
+
+    auto &slot = entries_[static_cast<size_t>(device_number)];
+    if (!slot.probed) {
+        slot.probed = std::make_shared<const gpu>(probe_(device_number));
+    }
+    return slot.probed;
+}
+
+void gpu_registry::refresh() {
+    std::lock_guard<std::mutex> guard(lock_);
+    entries_ = {};
+}
+
+} // namespace detail
+} // namespace hwcpipe
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <hwcpipe/error.hpp>
+#include <hwcpipe/gpu_frequency.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace hwcpipe {
+
+namespace {
+int open_file(const std::string &path) { return path.empty() ? -1 : ::open(path.c_str(), O_RDONLY | O_CLOEXEC); }
+
+void close_file(int fd) {
+    if (fd >= 0) {
+        ::close(fd);
+    }
+}
+} // namespace
+
+std::string find_gpu_devfreq(const std::string &devfreq_dir) {
+    DIR *dir = ::opendir(devfreq_dir.c_str());
+    if (dir == nullptr) {
+        return {};
+    }
+
+    std::vector<std::string> names{};
+    while (const dirent *entry = ::readdir(dir)) {
+        std::string name = entry->d_name;
+        std::string lower = name;
+        std::transform(lower.begin(), lower.end(), lower.begin(),
+                       [](char c) { return static_cast<char>(std::tolower(static_cast<unsigned char>(c))); });
+        if (lower.find("mali") != std::string::npos || lower.find("gpu") != std::string::npos) {
+            names.push_back(std::move(name));
+        }
+    }
+    ::closedir(dir);
+
+    // the directory order is arbitrary
+    if (names.empty()) {
+        return {};
+    }
+    return devfreq_dir + "/" + *std::min_element(names.begin(), names.end());
+}
+
+gpu_frequency::gpu_frequency(const gpu_frequency_config &config)
+    : tolerance_(config.tolerance) {
+    const std::string devfreq = config.devfreq_path.empty() ? find_gpu_devfreq() : config.devfreq_path;
+    freq_fd_ = devfreq.empty() ? -1 : open_file(devfreq + "/cur_freq");
+    if (freq_fd_ < 0) {
+        ec_ = make_error_code(errc::frequency_unavailable);
+        return;
+    }
+
+    power_fd_ = open_file(config.power_path);
+    thermal_fd_ = open_file(config.thermal_path);
+    if ((!config.power_path.empty() && power_fd_ < 0) || (!config.thermal_path.empty() && thermal_fd_ < 0)) {
+        ec_ = make_error_code(errc::frequency_unavailable);
+    }
+}
+
+gpu_frequency::~gpu_frequency() {
+    close_file(freq_fd_);
+    close_file(power_fd_);
+    close_file(thermal_fd_);
+}
+
+bool gpu_frequency::read_value(int fd, int64_t &value) {
+    // sysfs regenerates the attribute on every read at offset zero
+    char buffer[32];
+    const ssize_t size = ::pread(fd, buffer, sizeof(buffer) - 1, 0);
+    if (size <= 0) {
+        return false;
+    }
+    buffer[size] = '\0';
+
+    char *end{};
+    value = std::strtoll(buffer, &end, 10);
+    return end != buffer;
+}
+
+std::error_code gpu_frequency::update(const sample_interval &interval, bool has_gpu_cycle) {
+    if (ec_) {
+        return ec_;
+    }
+
+    reading_.timestamp_ns_begin = interval.timestamp_ns_begin;
+    reading_.timestamp_ns_end = interval.timestamp_ns_end;
+    // a GPU that was off for the whole sample counted no cycles
+    reading_.estimated_hz = has_gpu_cycle && interval.gpu_cycles != 0 ? interval.gpu_frequency() : 0.0;
+    reading_.devfreq_read = false;
+
+    const auto agrees = [this]() {
+        const auto devfreq_hz = static_cast<double>(reading_.devfreq_hz);
+        return reading_.estimated_hz != 0.0 &&
+               std::fabs(reading_.estimated_hz - devfreq_hz) <= tolerance_ * devfreq_hz;
+    };
+
+    if (num_devfreq_reads_ == 0 || !agrees()) {
+        int64_t value{};
+        if (!read_value(freq_fd_, value) || value < 0) {
+            return make_error_code(errc::frequency_unavailable);
+        }
+        reading_.devfreq_hz = static_cast<uint64_t>(value);
+        reading_.devfreq_read = true;
+        ++num_devfreq_reads_;
+    }
+    reading_.frequency_hz = agrees() ? reading_.estimated_hz : static_cast<double>(reading_.devfreq_hz);
+
+    if (power_fd_ >= 0 && !read_value(power_fd_, reading_.power)) {
+        return make_error_code(errc::frequency_unavailable);
+    }
+    if (thermal_fd_ >= 0 && !read_value(thermal_fd_, reading_.temperature)) {
+        return make_error_code(errc::frequency_unavailable);
+    }
+    return {};
+}
+
+} // namespace hwcpipe
@@ -0,0 +1,324 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <hwcpipe/error.hpp>
+#include <hwcpipe/gpu_simulator.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <ctime>
+#include <mutex>
+
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+
+namespace hwcpipe {
+
+namespace {
+// the simulators that samplers can select, by device number
+std::mutex &registry_mutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+std::vector<gpu_simulator *> &registry() {
+    static std::vector<gpu_simulator *> simulators;
+    return simulators;
+}
+
+constexpr uint64_t ns_per_second = 1000000000;
+
+/** @return The number of 64-bit words of each block of @p extents. */
+size_t block_words(const device::hwcnt::block_extents &extents) {
+    const size_t value_size =
+        extents.values_type() == device::hwcnt::sample_values_type::uint64 ? sizeof(uint64_t) : sizeof(uint32_t);
+    return (extents.counters_per_block() * value_size + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+}
+} // namespace
+
+gpu_simulator::gpu_simulator(const gpu_simulator_config &config, int device_number)
+    : config_(config)
+    , device_number_(device_number) {
+    if (config_.sample_rate_hz == 0 || config_.counters_per_block == 0 || config_.num_shader_cores == 0) {
+        ec_ = make_error_code(errc::invalid_device);
+        return;
+    }
+    period_ns_ = std::max<uint64_t>(ns_per_second / config_.sample_rate_hz, 1);
+
+    constants_.gpu_id = config_.gpu_id;
+    constants_.axi_bus_width = 128;
+    constants_.num_shader_cores = config_.num_shader_cores;
+    constants_.shader_core_mask =
+        config_.num_shader_cores >= 64 ? ~uint64_t{0} : (uint64_t{1} << config_.num_shader_cores) - 1;
+    constants_.num_l2_slices = config_.num_l2_slices;
+    constants_.l2_slice_size = 512 * 1024;
+    constants_.num_exec_engines = 2;
+    constants_.tile_size = 16;
+    constants_.warp_width = 16;
+
+    device::hwcnt::block_extents::num_blocks_of_type_type num_blocks_of_type{};
+    num_blocks_of_type[static_cast<size_t>(device::hwcnt::block_type::fe)] = 1;
+    num_blocks_of_type[static_cast<size_t>(device::hwcnt::block_type::tiler)] = 1;
+    num_blocks_of_type[static_cast<size_t>(device::hwcnt::block_type::memory)] = config_.num_l2_slices;
+    num_blocks_of_type[static_cast<size_t>(device::hwcnt::block_type::core)] = config_.num_shader_cores;
+    block_extents_ = device::hwcnt::block_extents(num_blocks_of_type, config_.counters_per_block,
+                                                  config_.values_64bit ? device::hwcnt::sample_values_type::uint64
+                                                                       : device::hwcnt::sample_values_type::uint32);
+
+    std::lock_guard<std::mutex> lock(registry_mutex());
+    auto &simulators = registry();
+    const auto registered = std::find_if(simulators.begin(), simulators.end(), [device_number](const gpu_simulator *sim) {
+        return sim->device_number_ == device_number;
+    });
+    if (registered != simulators.end()) {
+        ec_ = make_error_code(errc::invalid_device);
+        return;
+    }
+    simulators.push_back(this);
+}
+
+gpu_simulator::~gpu_simulator() {
+    std::lock_guard<std::mutex> lock(registry_mutex());
+    auto &simulators = registry();
+    simulators.erase(std::remove(simulators.begin(), simulators.end(), this), simulators.end());
+}
+
+std::error_code gpu_simulator::get_product_id(device::product_id &pid) const {
+    if (ec_) {
+        return ec_;
+    }
+
+    const auto result = device::product_id_from_raw_gpu_id(constants_.gpu_id);
+    if (result.first) {
+        return result.first;
+    }
+    pid = result.second;
+    return {};
+}
+
+gpu_simulator *gpu_simulator::find(int device_number) {
+    std::lock_guard<std::mutex> lock(registry_mutex());
+    for (auto *simulator : registry()) {
+        if (simulator->device_number_ == device_number) {
+            return simulator;
+        }
+    }
+    return nullptr;
+}
+
+void gpu_simulator::produce(device::hwcnt::sample_metadata &metadata, uint64_t *values, uint64_t periods,
+                            uint64_t now_ns) {
+    // a lost sample leaves a gap in the sample numbers and the time stamps
+    ++num_samples_;
+    if (config_.drop_interval != 0 && num_samples_ % config_.drop_interval == 0) {
+        ++num_samples_;
+        ++sample_nr_;
+        timestamp_ns_ += period_ns_;
+    }
+    if (config_.stretch_interval != 0 && num_samples_ % config_.stretch_interval == 0) {
+        ++periods;
+    }
+
+    metadata = {};
+    metadata.flags.stretched = periods > 1 ? 1 : 0;
+    metadata.sample_nr = sample_nr_++;
+    if (now_ns != 0) {
+        metadata.timestamp_ns_begin = timestamp_ns_ != 0 ? timestamp_ns_ : now_ns - periods * period_ns_;
+        metadata.timestamp_ns_end = now_ns;
+    } else {
+        metadata.timestamp_ns_begin = timestamp_ns_;
+        metadata.timestamp_ns_end = timestamp_ns_ + periods * period_ns_;
+    }
+    timestamp_ns_ = metadata.timestamp_ns_end;
+
+    const uint64_t duration_ns = metadata.timestamp_ns_end - metadata.timestamp_ns_begin;
+    metadata.gpu_cycle = duration_ns * config_.gpu_frequency_hz / ns_per_second;
+    metadata.sc_cycle = metadata.gpu_cycle;
+
+    // each counter of each block counts at its own rate
+    const size_t words = block_words(block_extents_);
+    const size_t num_counters = block_extents_.counters_per_block();
+    for (size_t block = 0; block != block_extents_.num_blocks(); ++block) {
+        uint64_t *block_values = values + block * words;
+        const uint64_t rate = (block + 1) * periods;
+        if (config_.values_64bit) {
+            for (size_t offset = 0; offset != num_counters; ++offset) {
+                block_values[offset] = (offset + 1) * rate;
+            }
+        } else {
+            auto *narrow = reinterpret_cast<uint32_t *>(block_values);
+            for (size_t offset = 0; offset != num_counters; ++offset) {
+                narrow[offset] = static_cast<uint32_t>((offset + 1) * rate);
+            }
+        }
+    }
+}
+
+namespace detail {
+namespace simulator {
+
+namespace {
+
+/**
+ * @return An eventfd counting the ready samples, or a timerfd for paced
+ * periodic samples.
+ */
+int make_fd(const gpu_simulator &simulator, bool periodic) {
+    if (periodic && simulator.get_config().paced) {
+        return timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC | TFD_NONBLOCK);
+    }
+    return eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK | EFD_SEMAPHORE);
+}
+
+device::hwcnt::features make_features(uint32_t buffer_count) {
+    device::hwcnt::features features{};
+    features.has_gpu_cycle = true;
+    features.has_sc_cycle = true;
+    features.has_stretched_flag = true;
+    features.overflow_behavior_defined = true;
+    features.buffer_count = buffer_count != 0 ? buffer_count : 32;
+    return features;
+}
+
+std::error_code last_error() { return {errno, std::generic_category()}; }
+
+} // namespace
+
+reader::reader(gpu_simulator &simulator, bool periodic, uint32_t buffer_count)
+    : device::hwcnt::reader(make_fd(simulator, periodic), make_features(buffer_count), simulator.get_block_extents())
+    , simulator_(simulator)
+    , periodic_(periodic)
+    , paced_(periodic && simulator.get_config().paced) {
+    const auto &extents = simulator_.get_block_extents();
+    const size_t words = block_words(extents);
+    values_.resize(extents.num_blocks() * words);
+
+    for (size_t type = 0; type != device::hwcnt::block_extents::num_block_types; ++type) {
+        const auto block_type = static_cast<device::hwcnt::block_type>(type);
+        for (uint8_t index = 0; index != extents.num_blocks_of_type(block_type); ++index) {
+            device::hwcnt::block_metadata block{};
+            block.type = block_type;
+            block.index = index;
+            block.state.on = 1;
+            block.state.available = 1;
+            block.state.normal = 1;
+            block.values = values_.data() + blocks_.size() * words;
+            blocks_.push_back(block);
+        }
+    }
+}
+
+reader::~reader() {
+    if (fd_ >= 0) {
+        close(fd_);
+    }
+}
+
+std::error_code reader::request(uint64_t user_data) {
+    user_data_ = user_data;
+    const uint64_t one = 1;
+    if (write(fd_, &one, sizeof(one)) != sizeof(one)) {
+        return last_error();
+    }
+    return {};
+}
+
+std::error_code reader::start() {
+    running_ = true;
+    if (!paced_) {
+        return request(0);
+    }
+
+    const auto period_ns = simulator_.get_period_ns();
+    itimerspec spec{};
+    spec.it_interval.tv_sec = static_cast<time_t>(period_ns / ns_per_second);
+    spec.it_interval.tv_nsec = static_cast<long>(period_ns % ns_per_second);
+    spec.it_value = spec.it_interval;
+    if (timerfd_settime(fd_, 0, &spec, nullptr) != 0) {
+        return last_error();
+    }
+    return {};
+}
+
+std::error_code reader::stop() {
+    running_ = false;
+    if (paced_) {
+        const itimerspec spec{};
+        if (timerfd_settime(fd_, 0, &spec, nullptr) != 0) {
+            return last_error();
+        }
+    }
+    return discard();
+}
+
+std::error_code reader::get_sample(device::hwcnt::sample_metadata &sm, device::hwcnt::sample_handle &) {
+    if (taken_) {
+        return std::make_error_code(std::errc::device_or_resource_busy);
+    }
+
+    // wait for the sample like the kernel reader
+    pollfd pfd{fd_, POLLIN, 0};
+    while (poll(&pfd, 1, -1) < 0) {
+        if (errno != EINTR) {
+            return last_error();
+        }
+    }
+    uint64_t count{};
+    if (read(fd_, &count, sizeof(count)) != sizeof(count)) {
+        return last_error();
+    }
+
+    uint64_t now_ns{};
+    if (paced_) {
+        timespec now{};
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        now_ns = static_cast<uint64_t>(now.tv_sec) * ns_per_second + static_cast<uint64_t>(now.tv_nsec);
+    }
+    // the periods that a paced reader missed stretch its sample
+    simulator_.produce(sm, values_.data(), paced_ ? count : 1, now_ns);
+    sm.user_data = periodic_ ? 0 : user_data_;
+    taken_ = true;
+    return {};
+}
+
+bool reader::next(device::hwcnt::sample_handle, device::hwcnt::block_metadata &bm,
+                  device::hwcnt::block_handle &block_hndl) const {
+    auto &index = block_hndl.get<size_t>();
+    if (index == blocks_.size()) {
+        return false;
+    }
+    bm = blocks_[index++];
+    return true;
+}
+
+size_t reader::get_blocks(device::hwcnt::sample_handle, device::hwcnt::block_metadata *blocks,
+                          size_t capacity) const {
+    const size_t count = std::min(capacity, blocks_.size());
+    std::copy(blocks_.begin(), blocks_.begin() + static_cast<std::ptrdiff_t>(count), blocks);
+    return count;
+}
+
+std::error_code reader::put_sample(device::hwcnt::sample_handle) {
+    taken_ = false;
+    // the next unpaced periodic sample is ready at once
+    if (periodic_ && !paced_ && running_) {
+        return request(0);
+    }
+    return {};
+}
+
+std::error_code reader::discard() {
+    uint64_t count{};
+    while (read(fd_, &count, sizeof(count)) == sizeof(count)) {
+    }
+    return {};
+}
+
+} // namespace simulator
+} // namespace detail
+} // namespace hwcpipe
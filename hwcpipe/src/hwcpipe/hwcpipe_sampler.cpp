@@ -0,0 +1,322 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hwcpipe/hwcpipe_sampler.h"
+
+#include "hwcpipe/error.hpp"
+#include "hwcpipe/gpu.hpp"
+#include "hwcpipe/gpu_simulator.hpp"
+#include "hwcpipe/sampler.hpp"
+
+#include <memory>
+#include <new>
+#include <string>
+#include <system_error>
+#include <vector>
+
+namespace {
+
+/** The calls of the C interface on a hwcpipe::sampler, whatever its backend policy. */
+class any_sampler {
+  public:
+    virtual ~any_sampler() = default;
+
+    virtual bool valid() const = 0;
+    virtual std::error_code reconfigure(const hwcpipe::sampler_config &config) = 0;
+    virtual std::error_code start_sampling(uint64_t user_data) = 0;
+    virtual std::error_code stop_sampling(uint64_t user_data) = 0;
+    virtual std::error_code sample_now(uint64_t user_data) = 0;
+    virtual hwcpipe::read_list make_read_list(const hwcpipe_counter *counters, size_t count,
+                                              std::error_code &ec) const = 0;
+    virtual std::error_code get_counter_values(const hwcpipe::read_list &list, double *values,
+                                               size_t count) const = 0;
+    virtual hwcpipe::sample_interval get_sample_interval() const = 0;
+    virtual uint64_t get_sample_user_data() const = 0;
+};
+
+template <typename backend_policy_t>
+class policy_sampler : public any_sampler {
+  public:
+    explicit policy_sampler(const hwcpipe::sampler_config &config)
+        : sampler_(config) {}
+
+    bool valid() const override { return static_cast<bool>(sampler_); }
+    std::error_code reconfigure(const hwcpipe::sampler_config &config) override {
+        return sampler_.reconfigure(config);
+    }
+    std::error_code start_sampling(uint64_t user_data) override { return sampler_.start_sampling(user_data); }
+    std::error_code stop_sampling(uint64_t user_data) override { return sampler_.stop_sampling(user_data); }
+    std::error_code sample_now(uint64_t user_data) override { return sampler_.sample_now(user_data); }
+    hwcpipe::read_list make_read_list(const hwcpipe_counter *counters, size_t count,
+                                      std::error_code &ec) const override {
+        return sampler_.make_read_list(counters, count, ec);
+    }
+    std::error_code get_counter_values(const hwcpipe::read_list &list, double *values, size_t count) const override {
+        return sampler_.get_counter_values(list, values, count);
+    }
+    hwcpipe::sample_interval get_sample_interval() const override { return sampler_.get_sample_interval(); }
+    uint64_t get_sample_user_data() const override { return sampler_.get_sample_user_data(); }
+
+  private:
+    hwcpipe::sampler<backend_policy_t> sampler_;
+};
+
+/** The first device number of the simulated GPUs, far above the numbers of the Mali devices. */
+constexpr int first_simulated_device = 0x10000;
+
+/** The number of simulated GPUs that can exist at once. */
+constexpr int max_simulated_devices = 256;
+
+/** @return A simulated GPU registered under a free device number, or nullptr if there is none. */
+std::unique_ptr<hwcpipe::gpu_simulator> make_simulator(uint32_t num_shader_cores) {
+    if (num_shader_cores == 0 || num_shader_cores > 255) {
+        return nullptr;
+    }
+    hwcpipe::gpu_simulator_config config{};
+    config.num_shader_cores = static_cast<uint8_t>(num_shader_cores);
+    for (int device_number = first_simulated_device;
+         device_number != first_simulated_device + max_simulated_devices; ++device_number) {
+        std::unique_ptr<hwcpipe::gpu_simulator> simulator(new (std::nothrow)
+                                                              hwcpipe::gpu_simulator(config, device_number));
+        if (!simulator || *simulator) {
+            return simulator;
+        }
+    }
+    return nullptr;
+}
+
+/** @return The sampler config of a simulated GPU, or of no GPU if it couldn't be simulated. */
+hwcpipe::sampler_config make_simulated_config(const hwcpipe::gpu_simulator *simulator) {
+    hwcpipe::device::product_id pid{};
+    if (simulator == nullptr || simulator->get_product_id(pid)) {
+        return hwcpipe::sampler_config(hwcpipe::device::product_id{}, first_simulated_device);
+    }
+    return hwcpipe::sampler_config(pid, simulator->get_device_number());
+}
+
+/** The status of the C interface of each error of a sampler, the other errors are HWCPIPE_SAMPLER_ERROR_OTHER. */
+const struct {
+    hwcpipe::errc error;
+    hwcpipe_sampler_status status;
+} status_of_error[] = {
+    {hwcpipe::errc::invalid_device, HWCPIPE_SAMPLER_ERROR_DEVICE},
+    {hwcpipe::errc::backend_creation_failed, HWCPIPE_SAMPLER_ERROR_DEVICE},
+    {hwcpipe::errc::unknown_counter, HWCPIPE_SAMPLER_ERROR_COUNTER},
+    {hwcpipe::errc::invalid_counter_for_device, HWCPIPE_SAMPLER_ERROR_COUNTER},
+    {hwcpipe::errc::sampler_config_invalid, HWCPIPE_SAMPLER_ERROR_CONFIG},
+    {hwcpipe::errc::sampling_already_started, HWCPIPE_SAMPLER_ERROR_STARTED},
+    {hwcpipe::errc::sampling_not_started, HWCPIPE_SAMPLER_ERROR_NOT_STARTED},
+    {hwcpipe::errc::invalid_read_list, HWCPIPE_SAMPLER_ERROR_BUFFER},
+    {hwcpipe::errc::backend_sampler_failure, HWCPIPE_SAMPLER_ERROR_SAMPLE},
+    {hwcpipe::errc::sample_collection_failure, HWCPIPE_SAMPLER_ERROR_SAMPLE},
+    {hwcpipe::errc::accumulation_start_failed, HWCPIPE_SAMPLER_ERROR_SAMPLE},
+    {hwcpipe::errc::accumulation_stop_failed, HWCPIPE_SAMPLER_ERROR_SAMPLE},
+    {hwcpipe::errc::sample_not_ready, HWCPIPE_SAMPLER_ERROR_SAMPLE},
+};
+
+/**
+ * @return The status of the C interface of an error. The values of the
+ * error categories overlap, so they can't be returned as they are.
+ */
+hwcpipe_sampler_status to_status(const std::error_code &ec) {
+    if (!ec) {
+        return HWCPIPE_SAMPLER_SUCCESS;
+    }
+    if (ec.category() != hwcpipe::error_category()) {
+        return HWCPIPE_SAMPLER_ERROR_SYSTEM;
+    }
+    for (const auto &entry : status_of_error) {
+        if (ec.value() == static_cast<int>(entry.error)) {
+            return entry.status;
+        }
+    }
+    return HWCPIPE_SAMPLER_ERROR_OTHER;
+}
+
+} // namespace
+
+struct hwcpipe_sampler {
+    explicit hwcpipe_sampler(int device_number)
+        : config(hwcpipe::gpu(device_number)) {}
+
+    explicit hwcpipe_sampler(std::unique_ptr<hwcpipe::gpu_simulator> gpu_simulator)
+        : simulator(std::move(gpu_simulator))
+        , config(make_simulated_config(simulator.get())) {}
+
+    /** Records the error of a call, and returns its status. */
+    int set_error(const std::error_code &ec) {
+        error = ec;
+        return to_status(ec);
+    }
+
+    /** @return A sampler of the GPU, simulated or not. */
+    any_sampler *make_sampler() const {
+        if (simulator) {
+            return new (std::nothrow) policy_sampler<hwcpipe::gpu_simulator_policy>(config);
+        }
+        return new (std::nothrow) policy_sampler<hwcpipe::detail::hwcpipe_backend_policy>(config);
+    }
+
+    // the simulated GPU, if any, which outlives the sampler
+    std::unique_ptr<hwcpipe::gpu_simulator> simulator{};
+    hwcpipe::sampler_config config;
+    std::vector<hwcpipe_counter> counters{};
+    // created on the first start, and reconfigured when the counters change
+    std::unique_ptr<any_sampler> sampler{};
+    hwcpipe::read_list list{};
+    bool configured{};
+    bool sampling{};
+    std::error_code error{};
+    std::string message{};
+};
+
+namespace {
+
+void get_info(const any_sampler &sampler, hwcpipe_sample_info *info) {
+    if (info == nullptr) {
+        return;
+    }
+    const auto interval = sampler.get_sample_interval();
+    info->timestamp_ns_begin = interval.timestamp_ns_begin;
+    info->timestamp_ns_end = interval.timestamp_ns_end;
+    info->gpu_cycles = interval.gpu_cycles;
+    info->sc_cycles = interval.sc_cycles;
+    info->user_data = sampler.get_sample_user_data();
+}
+
+/** Sets up the device session for the current counters. */
+std::error_code configure(hwcpipe_sampler &s) {
+    if (!s.sampler || !s.sampler->valid()) {
+        s.sampler.reset(s.make_sampler());
+        if (!s.sampler) {
+            return std::make_error_code(std::errc::not_enough_memory);
+        }
+    } else {
+        auto ec = s.sampler->reconfigure(s.config);
+        if (ec) {
+            return ec;
+        }
+    }
+    if (!s.sampler->valid()) {
+        // the sampler reports its construction error
+        return s.sampler->start_sampling(0);
+    }
+
+    std::error_code ec;
+    s.list = s.sampler->make_read_list(s.counters.data(), s.counters.size(), ec);
+    if (ec) {
+        return ec;
+    }
+    s.configured = true;
+    return {};
+}
+
+} // namespace
+
+extern "C" {
+
+hwcpipe_sampler *hwcpipe_sampler_create(int device_number) {
+    return new (std::nothrow) hwcpipe_sampler(device_number);
+}
+
+hwcpipe_sampler *hwcpipe_sampler_create_simulated(uint32_t num_shader_cores) {
+    return new (std::nothrow) hwcpipe_sampler(make_simulator(num_shader_cores));
+}
+
+void hwcpipe_sampler_destroy(hwcpipe_sampler *sampler) {
+    if (sampler != nullptr && sampler->sampling) {
+        auto ec = sampler->sampler->stop_sampling(0);
+        static_cast<void>(ec);
+    }
+    delete sampler;
+}
+
+int hwcpipe_sampler_add_counters(hwcpipe_sampler *sampler, const hwcpipe_counter *counters, size_t count) {
+    if (sampler->sampling) {
+        return sampler->set_error(hwcpipe::make_error_code(hwcpipe::errc::sampling_already_started));
+    }
+
+    auto config = sampler->config;
+    for (size_t i = 0; i != count; ++i) {
+        auto ec = config.add_counter(counters[i]);
+        if (ec) {
+            return sampler->set_error(ec);
+        }
+    }
+
+    sampler->config = config;
+    sampler->counters.insert(sampler->counters.end(), counters, counters + count);
+    sampler->configured = false;
+    return sampler->set_error({});
+}
+
+int hwcpipe_sampler_set_period(hwcpipe_sampler *sampler, uint64_t period_ns) {
+    if (sampler->config.get_sampling_period() != period_ns) {
+        sampler->config.set_sampling_period(period_ns);
+        sampler->configured = false;
+    }
+    return sampler->set_error({});
+}
+
+size_t hwcpipe_sampler_num_counters(const hwcpipe_sampler *sampler) { return sampler->counters.size(); }
+
+int hwcpipe_sampler_start(hwcpipe_sampler *sampler, uint64_t user_data) {
+    if (sampler->sampling) {
+        return sampler->set_error(hwcpipe::make_error_code(hwcpipe::errc::sampling_already_started));
+    }
+    if (!sampler->configured) {
+        auto ec = configure(*sampler);
+        if (ec) {
+            return sampler->set_error(ec);
+        }
+    }
+
+    auto ec = sampler->sampler->start_sampling(user_data);
+    sampler->sampling = !ec;
+    return sampler->set_error(ec);
+}
+
+int hwcpipe_sampler_stop(hwcpipe_sampler *sampler, uint64_t user_data) {
+    if (!sampler->sampling) {
+        return sampler->set_error(hwcpipe::make_error_code(hwcpipe::errc::sampling_not_started));
+    }
+
+    auto ec = sampler->sampler->stop_sampling(user_data);
+    sampler->sampling = false;
+    return sampler->set_error(ec);
+}
+
+int hwcpipe_sampler_sample(hwcpipe_sampler *sampler, uint64_t user_data, double *values, size_t count,
+                           hwcpipe_sample_info *info) {
+    if (!sampler->sampling) {
+        return sampler->set_error(hwcpipe::make_error_code(hwcpipe::errc::sampling_not_started));
+    }
+
+    auto ec = sampler->sampler->sample_now(user_data);
+    if (ec) {
+        return sampler->set_error(ec);
+    }
+    return hwcpipe_sampler_read(sampler, values, count, info);
+}
+
+int hwcpipe_sampler_read(hwcpipe_sampler *sampler, double *values, size_t count, hwcpipe_sample_info *info) {
+    if (!sampler->configured || !sampler->sampler->valid()) {
+        return sampler->set_error(hwcpipe::make_error_code(hwcpipe::errc::sampling_not_started));
+    }
+
+    auto ec = sampler->sampler->get_counter_values(sampler->list, values, count);
+    if (!ec) {
+        get_info(*sampler->sampler, info);
+    }
+    return sampler->set_error(ec);
+}
+
+const char *hwcpipe_sampler_error_message(hwcpipe_sampler *sampler) {
+    sampler->message = sampler->error ? sampler->error.message() : std::string{};
+    return sampler->message.c_str();
+}
+
+} // extern "C"
@@ -0,0 +1,286 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <hwcpipe/counter_database.hpp>
+#include <hwcpipe/error.hpp>
+#include <hwcpipe/metrics_endpoint.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+namespace hwcpipe {
+
+namespace {
+
+// wide enough for any double printed with %.17g, e.g. -1.2345678901234567e-308
+constexpr size_t slot_width = 24;
+
+constexpr size_t max_request_size = 4096;
+
+constexpr char method_not_allowed[] = "HTTP/1.1 405 Method Not Allowed\r\n"
+                                      "Allow: GET\r\n"
+                                      "Content-Length: 0\r\n"
+                                      "Connection: close\r\n"
+                                      "\r\n";
+
+/** Turns a counter name into a metric name: lower case, with runs of other characters replaced by '_'. */
+std::string metric_name(const std::string &prefix, const std::string &name) {
+    std::string result = prefix;
+    for (const char c : name) {
+        const auto byte = static_cast<unsigned char>(c);
+        if (std::isalnum(byte)) {
+            result += static_cast<char>(std::tolower(byte));
+        } else if (!result.empty() && result.back() != '_') {
+            result += '_';
+        }
+    }
+    while (!result.empty() && result.back() == '_') {
+        result.pop_back();
+    }
+    if (result.empty() || std::isdigit(static_cast<unsigned char>(result.front()))) {
+        result.insert(result.begin(), '_');
+    }
+    return result;
+}
+
+/** Writes @p value right-aligned in a slot of slot_width characters. */
+void format_value(double value, char *slot) {
+    char text[32];
+    int size = 0;
+    if (std::isnan(value)) {
+        size = std::snprintf(text, sizeof(text), "NaN");
+    } else if (std::isinf(value)) {
+        size = std::snprintf(text, sizeof(text), value > 0 ? "+Inf" : "-Inf");
+    } else {
+        size = std::snprintf(text, sizeof(text), "%.17g", value);
+    }
+    const auto length = std::min(static_cast<size_t>(size), slot_width);
+    std::memset(slot, ' ', slot_width - length);
+    std::memcpy(slot + slot_width - length, text, length);
+}
+
+/** @return True if @p a and @p b have the same bits, so that NaNs compare equal. */
+bool same_value(double a, double b) { return std::memcmp(&a, &b, sizeof(double)) == 0; }
+
+} // namespace
+
+metrics_endpoint::metrics_endpoint(const hwcpipe_counter *counters, size_t num_counters,
+                                   const metrics_endpoint_config &config)
+    : receive_timeout_ms_(config.receive_timeout_ms)
+    , staging_(num_counters)
+    , request_(max_request_size) {
+    // a counter listed twice is exposed once, a scraper rejects a repeated series
+    std::vector<size_t> candidates;
+    if (config.columns != nullptr) {
+        candidates.assign(config.columns, config.columns + config.num_columns);
+    } else {
+        for (size_t i = 0; i != num_counters; ++i) {
+            candidates.push_back(i);
+        }
+    }
+    std::vector<size_t> unique_columns;
+    for (const auto index : candidates) {
+        if (index < num_counters && std::none_of(unique_columns.begin(), unique_columns.end(), [&](size_t column) {
+                return counters[column] == counters[index];
+            })) {
+            unique_columns.push_back(index);
+        }
+    }
+
+    const counter_database database{};
+    std::vector<std::string> names;
+    std::vector<std::string> helps;
+    for (const auto index : unique_columns) {
+        counter_metadata metadata{};
+        std::string counter_name;
+        if (database.describe_counter(counters[index], metadata)) {
+            counter_name = std::to_string(static_cast<int>(counters[index]));
+            helps.push_back("Counter " + counter_name);
+        } else {
+            counter_name = metadata.name;
+            helps.push_back(counter_name + " (" + metadata.units + ")");
+        }
+        names.push_back(metric_name(config.metric_prefix, counter_name));
+    }
+
+    // counters whose names fold to the same metric share one family, told apart by a counter label
+    std::string body;
+    std::vector<bool> rendered(unique_columns.size());
+    for (size_t i = 0; i != unique_columns.size(); ++i) {
+        if (rendered[i]) {
+            continue;
+        }
+        const bool shared = std::count(names.begin() + static_cast<ptrdiff_t>(i), names.end(), names[i]) > 1;
+        body += "# HELP " + names[i] + " " + helps[i] + "\n";
+        body += "# TYPE " + names[i] + " gauge\n";
+        for (size_t j = i; j != unique_columns.size(); ++j) {
+            if (rendered[j] || names[j] != names[i]) {
+                continue;
+            }
+            rendered[j] = true;
+            columns_.push_back(unique_columns[j]);
+
+            std::string labels = config.labels;
+            if (shared) {
+                labels += std::string(labels.empty() ? "" : ",") + "counter=\"" +
+                          std::to_string(static_cast<int>(counters[unique_columns[j]])) + "\"";
+            }
+            body += names[j] + (labels.empty() ? std::string{} : "{" + labels + "}") + " ";
+            slots_.push_back(body.size());
+            body.append(slot_width, ' ');
+            body += '\n';
+        }
+    }
+
+    const std::string header = "HTTP/1.1 200 OK\r\n"
+                               "Content-Type: text/plain; version=0.0.4; charset=utf-8\r\n"
+                               "Content-Length: " +
+                               std::to_string(body.size()) +
+                               "\r\n"
+                               "Connection: close\r\n"
+                               "\r\n";
+    response_.reserve(header.size() + body.size());
+    response_.insert(response_.end(), header.begin(), header.end());
+    response_.insert(response_.end(), body.begin(), body.end());
+
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    latest_.assign(columns_.size(), nan);
+    exposed_.assign(columns_.size(), nan);
+    scrape_values_.assign(columns_.size(), nan);
+    for (auto &slot : slots_) {
+        slot += header.size();
+        format_value(nan, response_.data() + slot);
+    }
+}
+
+int metrics_endpoint::open_listener(uint16_t port, std::error_code &ec, const char *address) {
+    ec = make_error_code(errc::metrics_listen_failed);
+    sockaddr_in socket_address{};
+    socket_address.sin_family = AF_INET;
+    socket_address.sin_port = htons(port);
+    if (address == nullptr || ::inet_pton(AF_INET, address, &socket_address.sin_addr) != 1) {
+        return -1;
+    }
+
+    const int fd = ::socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd < 0) {
+        return -1;
+    }
+
+    const int reuse = 1;
+    ::setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+    if (::bind(fd, reinterpret_cast<const sockaddr *>(&socket_address), sizeof(socket_address)) != 0 ||
+        ::listen(fd, 16) != 0) {
+        ::close(fd);
+        return -1;
+    }
+    ec = {};
+    return fd;
+}
+
+std::error_code metrics_endpoint::serve(int client_fd) {
+    // read up to the end of the headers, the request has no body
+    size_t size = 0;
+    while (size != request_.size()) {
+        const ssize_t received = ::recv(client_fd, request_.data() + size, request_.size() - size, 0);
+        if (received < 0 && errno == EINTR) {
+            continue;
+        }
+        if (received <= 0) {
+            break;
+        }
+        size += static_cast<size_t>(received);
+        static const char end_of_headers[] = "\r\n\r\n";
+        if (std::search(request_.begin(), request_.begin() + static_cast<ptrdiff_t>(size), end_of_headers,
+                        end_of_headers + 4) != request_.begin() + static_cast<ptrdiff_t>(size)) {
+            break;
+        }
+    }
+
+    const bool get = size >= 4 && std::memcmp(request_.data(), "GET ", 4) == 0;
+    if (!get) {
+        auto ec = size != 0 ? send(client_fd, method_not_allowed, sizeof(method_not_allowed) - 1)
+                            : make_error_code(errc::network_send_failed);
+        std::lock_guard<std::mutex> lock(mutex_);
+        ++stats_.failed;
+        return ec;
+    }
+
+    update_response();
+    auto ec = send(client_fd, response_.data(), response_.size());
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++(ec ? stats_.failed : stats_.scrapes);
+    return ec;
+}
+
+std::error_code metrics_endpoint::accept_and_serve(int listen_fd) {
+    int client_fd = -1;
+    do {
+        client_fd = ::accept4(listen_fd, nullptr, nullptr, SOCK_CLOEXEC);
+    } while (client_fd < 0 && errno == EINTR);
+    if (client_fd < 0) {
+        return make_error_code(errc::metrics_accept_failed);
+    }
+
+    if (receive_timeout_ms_ != 0) {
+        timeval timeout{};
+        timeout.tv_sec = static_cast<time_t>(receive_timeout_ms_ / 1000);
+        timeout.tv_usec = static_cast<suseconds_t>(receive_timeout_ms_ % 1000) * 1000;
+        ::setsockopt(client_fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    }
+
+    auto ec = serve(client_fd);
+    ::close(client_fd);
+    return ec;
+}
+
+void metrics_endpoint::update_response() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::copy(latest_.begin(), latest_.end(), scrape_values_.begin());
+    }
+    for (size_t i = 0; i != columns_.size(); ++i) {
+        if (!same_value(scrape_values_[i], exposed_[i])) {
+            exposed_[i] = scrape_values_[i];
+            format_value(exposed_[i], response_.data() + slots_[i]);
+        }
+    }
+}
+
+std::error_code metrics_endpoint::send(int client_fd, const char *data, size_t size) {
+    while (size != 0) {
+        const ssize_t sent = ::send(client_fd, data, size, MSG_NOSIGNAL);
+        if (sent < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return make_error_code(errc::network_send_failed);
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stats_.bytes += static_cast<uint64_t>(sent);
+        }
+        data += sent;
+        size -= static_cast<size_t>(sent);
+    }
+    return {};
+}
+
+} // namespace hwcpipe
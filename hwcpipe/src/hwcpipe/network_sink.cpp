@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <hwcpipe/detail/column_codec.hpp>
+#include <hwcpipe/error.hpp>
+#include <hwcpipe/network_sink.hpp>
+
+#include <algorithm>
+#include <cerrno>
+
+#include <sys/socket.h>
+
+namespace hwcpipe {
+
+network_sink::network_sink(int socket_fd, const hwcpipe_counter *counters, size_t num_counters,
+                           const network_sink_config &config)
+    : socket_fd_(socket_fd)
+    , batch_size_(std::max<size_t>(config.batch_size, 1))
+    , flush_interval_ns_(config.flush_interval_ns)
+    , staging_(num_counters)
+    , changes_only_(config.changes_only)
+    , keyframe_interval_(config.keyframe_interval) {
+    if (config.columns != nullptr) {
+        for (size_t i = 0; i != config.num_columns; ++i) {
+            if (config.columns[i] < num_counters) {
+                columns_.push_back(config.columns[i]);
+            }
+        }
+    } else {
+        for (size_t i = 0; i != num_counters; ++i) {
+            columns_.push_back(i);
+        }
+    }
+
+    for (const auto index : columns_) {
+        schema_.push_back(static_cast<uint32_t>(counters[index]));
+    }
+
+    const size_t num_all_columns = num_time_columns + columns_.size();
+    values_.resize(num_all_columns * batch_size_);
+    encoded_.resize(num_all_columns * detail::column_codec::max_encoded_size(batch_size_));
+    // the header, the columns and, for frame_changes, the presence bitmaps
+    buffers_.resize(2 + num_all_columns);
+
+    if (changes_only_) {
+        if (config.change_thresholds != nullptr && config.columns == nullptr) {
+            thresholds_.assign(config.change_thresholds, config.change_thresholds + num_counters);
+        } else if (config.change_thresholds != nullptr) {
+            // the thresholds follow the requested columns, some of which may have been dropped
+            for (size_t i = 0; i != config.num_columns; ++i) {
+                if (config.columns[i] < num_counters) {
+                    thresholds_.push_back(config.change_thresholds[i]);
+                }
+            }
+        } else {
+            thresholds_.assign(columns_.size(), config.change_threshold);
+        }
+        last_sent_.resize(columns_.size());
+        presence_.resize(batch_size_ * bitmap_size());
+        changed_.resize(batch_size_);
+    }
+}
+
+void network_sink::mark_changes(size_t row) {
+    uint8_t *presence = presence_.data() + row * bitmap_size();
+    std::fill(presence, presence + bitmap_size(), 0);
+    for (size_t i = 0; i != columns_.size(); ++i) {
+        const uint64_t value = column(num_time_columns + i)[row];
+        const uint64_t difference = value > last_sent_[i] ? value - last_sent_[i] : last_sent_[i] - value;
+        if (keyframe_ || difference > thresholds_[i]) {
+            presence[i / 8] = static_cast<uint8_t>(presence[i / 8] | (1U << (i % 8)));
+            last_sent_[i] = value;
+        }
+    }
+}
+
+size_t network_sink::encode_changes(size_t count, size_t &payload_size) {
+    const size_t slot_size = detail::column_codec::max_encoded_size(batch_size_);
+    size_t num_buffers = 1;
+    for (size_t i = 0; i != num_time_columns; ++i) {
+        uint8_t *slot = encoded_.data() + i * slot_size;
+        const size_t size = detail::column_codec::encode(column(i), count, slot);
+        buffers_[num_buffers++] = {slot, size};
+        payload_size += size;
+    }
+
+    const size_t bitmaps_size = count * bitmap_size();
+    buffers_[num_buffers++] = {presence_.data(), bitmaps_size};
+    payload_size += bitmaps_size;
+
+    // each column packs its changed values only, and is left out if none changed
+    for (size_t i = 0; i != columns_.size(); ++i) {
+        const uint64_t *values = column(num_time_columns + i);
+        size_t num_changed = 0;
+        for (size_t row = 0; row != count; ++row) {
+            if ((presence_[row * bitmap_size() + i / 8] & (1U << (i % 8))) != 0) {
+                changed_[num_changed++] = values[row];
+            }
+        }
+        stats_.values_skipped += count - num_changed;
+        if (num_changed == 0) {
+            continue;
+        }
+        uint8_t *slot = encoded_.data() + (num_time_columns + i) * slot_size;
+        const size_t size = detail::column_codec::encode(changed_.data(), num_changed, slot);
+        buffers_[num_buffers++] = {slot, size};
+        payload_size += size;
+    }
+    return num_buffers;
+}
+
+std::error_code network_sink::flush() {
+    if (num_buffered_ == 0) {
+        return {};
+    }
+
+    const size_t count = num_buffered_;
+    num_buffered_ = 0;
+
+    if (!schema_sent_) {
+        header_ = {stream_protocol::magic, stream_protocol::frame_schema, static_cast<uint16_t>(columns_.size()), 0,
+                   static_cast<uint32_t>(schema_.size() * sizeof(uint32_t))};
+        iovec schema[2] = {{&header_, sizeof(header_)}, {schema_.data(), header_.payload_size}};
+        auto ec = send(schema, 2);
+        if (ec) {
+            return ec;
+        }
+        schema_sent_ = true;
+    }
+
+    size_t payload_size = 0;
+    size_t num_buffers = 0;
+    if (keyframe_) {
+        // each column is encoded in its own slot, and sent from there
+        const size_t slot_size = detail::column_codec::max_encoded_size(batch_size_);
+        num_buffers = 1 + num_time_columns + columns_.size();
+        for (size_t i = 0; i + 1 != num_buffers; ++i) {
+            uint8_t *slot = encoded_.data() + i * slot_size;
+            const size_t size = detail::column_codec::encode(column(i), count, slot);
+            buffers_[1 + i] = {slot, size};
+            payload_size += size;
+        }
+        frames_since_keyframe_ = 0;
+    } else {
+        num_buffers = encode_changes(count, payload_size);
+        ++frames_since_keyframe_;
+    }
+
+    const uint16_t kind = keyframe_ ? stream_protocol::frame_samples : stream_protocol::frame_changes;
+    header_ = {stream_protocol::magic, kind, static_cast<uint16_t>(columns_.size()), static_cast<uint32_t>(count),
+               static_cast<uint32_t>(payload_size)};
+    buffers_[0] = {&header_, sizeof(header_)};
+
+    auto ec = send(buffers_.data(), num_buffers);
+    if (ec) {
+        return ec;
+    }
+    ++stats_.frames;
+    if (keyframe_) {
+        ++stats_.keyframes;
+    }
+    stats_.samples += count;
+    return {};
+}
+
+std::error_code network_sink::send(iovec *buffers, size_t count) {
+    while (count != 0) {
+        msghdr header{};
+        header.msg_iov = buffers;
+        header.msg_iovlen = count;
+
+        const ssize_t sent = ::sendmsg(socket_fd_, &header, MSG_NOSIGNAL);
+        if (sent < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return make_error_code(errc::network_send_failed);
+        }
+        stats_.bytes += static_cast<uint64_t>(sent);
+
+        // skip the buffers that were sent, and the sent part of the next one
+        auto remaining = static_cast<size_t>(sent);
+        while (count != 0 && remaining >= buffers->iov_len) {
+            remaining -= buffers->iov_len;
+            ++buffers;
+            --count;
+        }
+        if (count != 0) {
+            buffers->iov_base = static_cast<uint8_t *>(buffers->iov_base) + remaining;
+            buffers->iov_len -= remaining;
+        }
+    }
+    return {};
+}
+
+} // namespace hwcpipe
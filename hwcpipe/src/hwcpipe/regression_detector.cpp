@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <hwcpipe/error.hpp>
+#include <hwcpipe/regression_detector.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+namespace hwcpipe {
+
+namespace {
+
+constexpr size_t no_tag = std::numeric_limits<size_t>::max();
+
+/** @return Whether a change of the mean regresses in @p direction. */
+bool regresses(regression_direction direction, double change) {
+    switch (direction) {
+    case regression_direction::increase:
+        return change > 0;
+    case regression_direction::decrease:
+        return change < 0;
+    case regression_direction::both:
+    default:
+        return change != 0;
+    }
+}
+
+} // namespace
+
+regression_detector::regression_detector(const hwcpipe_counter *counters, size_t count,
+                                         const regression_detector_config &config)
+    : config_(config)
+    , counters_(counters, counters + count)
+    , directions_(count, config.direction)
+    , any_tag_(no_tag)
+    , staging_(count) {}
+
+std::error_code regression_detector::add_baseline(const counter_statistics &baseline, uint64_t tag, bool any_tag) {
+    tag_state state{tag, std::vector<counter_state>(counters_.size())};
+    bool any_tested = false;
+    for (size_t i = 0; i != counters_.size(); ++i) {
+        auto &counter = state.counters[i];
+        counter = {};
+        for (size_t j = 0; j != baseline.size(); ++j) {
+            const auto &stats = baseline.get_stats(j);
+            if (baseline.get_counter(j) != counters_[i] || stats.count == 0) {
+                continue;
+            }
+            const double sample_variance = stats.count > 1 ? stats.m2 / static_cast<double>(stats.count - 1) : 0;
+            counter.tested = true;
+            counter.baseline_mean = stats.mean;
+            counter.baseline_error = sample_variance / static_cast<double>(stats.count);
+            counter.baseline_scale = std::max({std::sqrt(sample_variance), std::fabs(stats.mean) * config_.min_effect,
+                                               std::numeric_limits<double>::min()});
+            any_tested = true;
+            break;
+        }
+    }
+    if (!any_tested) {
+        return make_error_code(errc::statistics_mismatch);
+    }
+
+    auto existing = std::find_if(tags_.begin(), tags_.end(), [&](const tag_state &other) { return other.tag == tag; });
+    if (existing == tags_.end()) {
+        tags_.push_back(std::move(state));
+        existing = tags_.end() - 1;
+    } else {
+        *existing = std::move(state);
+    }
+    if (any_tag) {
+        any_tag_ = static_cast<size_t>(existing - tags_.begin());
+    }
+
+    // at most one finding per counter of a tag
+    findings_.reserve(tags_.size() * counters_.size());
+    reset();
+    return {};
+}
+
+bool regression_detector::push(uint64_t tag, const double *values) {
+    auto state = std::find_if(tags_.begin(), tags_.end(), [&](const tag_state &other) { return other.tag == tag; });
+    if (state == tags_.end()) {
+        if (any_tag_ == no_tag) {
+            ++unmatched_;
+            return false;
+        }
+        state = tags_.begin() + static_cast<std::ptrdiff_t>(any_tag_);
+    }
+
+    bool flagged = false;
+    for (size_t i = 0; i != counters_.size(); ++i) {
+        auto &counter = state->counters[i];
+        if (counter.tested && test(state->tag, i, counter, values[i])) {
+            flagged = true;
+        }
+    }
+    return flagged;
+}
+
+bool regression_detector::test(uint64_t tag, size_t index, counter_state &state, double value) {
+    state.run.add(value);
+    const double standardized = (value - state.baseline_mean) / state.baseline_scale;
+    state.cusum_increase = std::max(0.0, state.cusum_increase + standardized - config_.cusum_slack);
+    state.cusum_decrease = std::max(0.0, state.cusum_decrease - standardized - config_.cusum_slack);
+    if (state.flagged) {
+        return false;
+    }
+
+    // Welch's t-test, of a shift of the mean by at least min_effect
+    const auto direction = directions_[index];
+    const uint64_t count = state.run.count;
+    const double change = state.run.mean - state.baseline_mean;
+    double statistic = 0;
+    regression_test kind = regression_test::welch;
+    if (count >= config_.min_samples && count > 1 && regresses(direction, change) &&
+        std::fabs(change) >= std::fabs(state.baseline_mean) * config_.min_effect) {
+        const double run_error = state.run.m2 / static_cast<double>(count - 1) / static_cast<double>(count);
+        const double error = std::sqrt(run_error + state.baseline_error);
+        statistic = error > 0 ? std::fabs(change) / error : std::numeric_limits<double>::infinity();
+    }
+
+    // the CUSUM, of a recent shift of the values
+    if (statistic < config_.t_threshold) {
+        kind = regression_test::cusum;
+        statistic = 0;
+        if (regresses(direction, 1.0)) {
+            statistic = state.cusum_increase;
+        }
+        if (regresses(direction, -1.0)) {
+            statistic = std::max(statistic, state.cusum_decrease);
+        }
+        if (config_.cusum_threshold <= 0 || statistic < config_.cusum_threshold) {
+            return false;
+        }
+    }
+
+    state.flagged = true;
+    findings_.push_back({tag, counters_[index], kind, count, state.baseline_mean, state.run.mean, statistic});
+    return true;
+}
+
+const running_stats *regression_detector::get_run_stats(uint64_t tag, size_t index) const {
+    const auto state =
+        std::find_if(tags_.begin(), tags_.end(), [&](const tag_state &other) { return other.tag == tag; });
+    return state == tags_.end() ? nullptr : &state->counters[index].run;
+}
+
+void regression_detector::reset() {
+    for (auto &tag : tags_) {
+        for (auto &counter : tag.counters) {
+            counter.flagged = false;
+            counter.run = {};
+            counter.cusum_increase = 0;
+            counter.cusum_decrease = 0;
+        }
+    }
+    findings_.clear();
+    unmatched_ = 0;
+}
+
+} // namespace hwcpipe
@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <hwcpipe/error.hpp>
+#include <hwcpipe/runtime_pm.hpp>
+
+#include <cstring>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace hwcpipe {
+
+std::string runtime_pm_status_path(int device_number) {
+    return "/sys/class/misc/mali" + std::to_string(device_number) + "/device/power/runtime_status";
+}
+
+runtime_pm_probe::runtime_pm_probe(const std::string &path)
+    : fd_(::open(path.c_str(), O_RDONLY | O_CLOEXEC)) {
+    if (fd_ < 0) {
+        ec_ = make_error_code(errc::runtime_pm_unavailable);
+    }
+}
+
+runtime_pm_probe::~runtime_pm_probe() {
+    if (fd_ >= 0) {
+        ::close(fd_);
+    }
+}
+
+bool runtime_pm_probe::is_suspended() const {
+    // sysfs regenerates the attribute on every read at offset zero. The
+    // states are "active", "resuming", "suspended", "suspending" and
+    // "unsupported".
+    char buffer[16];
+    const ssize_t size = fd_ >= 0 ? ::pread(fd_, buffer, sizeof(buffer), 0) : -1;
+    static const char suspend[] = "suspend";
+    return size >= static_cast<ssize_t>(sizeof(suspend) - 1) && std::memcmp(buffer, suspend, sizeof(suspend) - 1) == 0;
+}
+
+} // namespace hwcpipe
@@ -0,0 +1,278 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <hwcpipe/error.hpp>
+#include <hwcpipe/sample_daemon.hpp>
+
+#include <cerrno>
+#include <cstring>
+#include <vector>
+
+#include <poll.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace hwcpipe {
+
+namespace {
+/** Fills a socket address, or returns false if the path doesn't fit. */
+bool make_address(const std::string &path, sockaddr_un &address) {
+    std::memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    if (path.empty() || path.size() >= sizeof(address.sun_path)) {
+        return false;
+    }
+    std::memcpy(address.sun_path, path.data(), path.size());
+    return true;
+}
+
+bool send_segment(int connection, int segment_fd, size_t segment_size) {
+    daemon_protocol::segment_message message{daemon_protocol::magic, static_cast<uint32_t>(segment_size)};
+    iovec payload{&message, sizeof(message)};
+
+    alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int))]{};
+    msghdr header{};
+    header.msg_iov = &payload;
+    header.msg_iovlen = 1;
+    header.msg_control = control;
+    header.msg_controllen = sizeof(control);
+
+    cmsghdr *control_header = CMSG_FIRSTHDR(&header);
+    control_header->cmsg_level = SOL_SOCKET;
+    control_header->cmsg_type = SCM_RIGHTS;
+    control_header->cmsg_len = CMSG_LEN(sizeof(int));
+    std::memcpy(CMSG_DATA(control_header), &segment_fd, sizeof(int));
+
+    ssize_t sent{};
+    do {
+        sent = ::sendmsg(connection, &header, MSG_NOSIGNAL);
+    } while (sent < 0 && errno == EINTR);
+    return sent == static_cast<ssize_t>(sizeof(message));
+}
+
+/** Receives the segment descriptor, or returns -1. */
+int receive_segment(int connection, size_t &segment_size) {
+    daemon_protocol::segment_message message{};
+    iovec payload{&message, sizeof(message)};
+
+    alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int))]{};
+    msghdr header{};
+    header.msg_iov = &payload;
+    header.msg_iovlen = 1;
+    header.msg_control = control;
+    header.msg_controllen = sizeof(control);
+
+    ssize_t received{};
+    do {
+        received = ::recvmsg(connection, &header, MSG_CMSG_CLOEXEC);
+    } while (received < 0 && errno == EINTR);
+
+    const cmsghdr *control_header = CMSG_FIRSTHDR(&header);
+    if (control_header == nullptr || control_header->cmsg_level != SOL_SOCKET ||
+        control_header->cmsg_type != SCM_RIGHTS || control_header->cmsg_len != CMSG_LEN(sizeof(int))) {
+        return -1;
+    }
+
+    int fd{-1};
+    std::memcpy(&fd, CMSG_DATA(control_header), sizeof(int));
+    if (received != static_cast<ssize_t>(sizeof(message)) || message.magic != daemon_protocol::magic) {
+        ::close(fd);
+        return -1;
+    }
+
+    segment_size = message.segment_size;
+    return fd;
+}
+
+/**
+ * Removes the socket file that a previous server left behind at @p path.
+ *
+ * @return False if another kind of file is at @p path, which is left alone.
+ */
+bool remove_stale_socket(const std::string &path) {
+    struct stat status {};
+    if (::lstat(path.c_str(), &status) != 0) {
+        return errno == ENOENT;
+    }
+    if (!S_ISSOCK(status.st_mode)) {
+        return false;
+    }
+    return ::unlink(path.c_str()) == 0 || errno == ENOENT;
+}
+} // namespace
+
+segment_server::segment_server(const std::string &socket_path, int segment_fd, size_t segment_size)
+    : ec_(make_error_code(errc::daemon_connection_failed))
+    , segment_fd_(segment_fd)
+    , segment_size_(segment_size) {
+    sockaddr_un address{};
+    if (segment_fd < 0 || !make_address(socket_path, address)) {
+        return;
+    }
+
+    if (!remove_stale_socket(socket_path)) {
+        return;
+    }
+
+    socket_ = ::socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (socket_ < 0) {
+        return;
+    }
+
+    if (::bind(socket_, reinterpret_cast<const sockaddr *>(&address), sizeof(address)) != 0) {
+        ::close(socket_);
+        socket_ = -1;
+        return;
+    }
+    path_ = socket_path;
+
+    if (::listen(socket_, SOMAXCONN) != 0) {
+        return;
+    }
+    ec_ = {};
+}
+
+segment_server::~segment_server() {
+    for (const int connection : connections_) {
+        ::close(connection);
+    }
+    if (socket_ >= 0) {
+        ::close(socket_);
+    }
+    if (!path_.empty()) {
+        ::unlink(path_.c_str());
+    }
+}
+
+size_t segment_server::serve_pending(int timeout_ms) {
+    if (ec_) {
+        return 0;
+    }
+
+    std::vector<pollfd> fds{{socket_, POLLIN, 0}};
+    for (const int connection : connections_) {
+        fds.push_back({connection, POLLIN, 0});
+    }
+    if (::poll(fds.data(), static_cast<nfds_t>(fds.size()), timeout_ms) > 0) {
+        // the clients never send anything, so a readable connection was closed by its client
+        size_t kept = 0;
+        for (size_t i = 0; i != connections_.size(); ++i) {
+            char byte{};
+            if (fds[i + 1].revents != 0 && ::recv(connections_[i], &byte, 1, MSG_DONTWAIT) <= 0) {
+                ::close(connections_[i]);
+            } else {
+                connections_[kept++] = connections_[i];
+            }
+        }
+        connections_.resize(kept);
+    }
+
+    size_t num_served = 0;
+    for (;;) {
+        const int connection = ::accept4(socket_, nullptr, nullptr, SOCK_CLOEXEC);
+        if (connection < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            // EAGAIN: nobody else is waiting
+            return num_served;
+        }
+
+        if (send_segment(connection, segment_fd_, segment_size_)) {
+            ++num_served;
+            connections_.push_back(connection);
+        } else {
+            ::close(connection);
+        }
+    }
+}
+
+daemon_client::daemon_client(const std::string &socket_path)
+    : ec_(make_error_code(errc::daemon_connection_failed)) {
+    sockaddr_un address{};
+    if (!make_address(socket_path, address)) {
+        return;
+    }
+
+    const int connection = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (connection < 0) {
+        return;
+    }
+
+    int fd{-1};
+    if (::connect(connection, reinterpret_cast<const sockaddr *>(&address), sizeof(address)) == 0) {
+        fd = receive_segment(connection, segment_size_);
+    }
+    if (fd < 0) {
+        ::close(connection);
+        return;
+    }
+    // the open connection subscribes the client to the daemon
+    connection_ = connection;
+
+    segment_ = ::mmap(nullptr, segment_size_, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (segment_ == MAP_FAILED) {
+        segment_ = nullptr;
+        return;
+    }
+
+    reader_ = shared_sample_reader(segment_, segment_size_);
+    ec_ = reader_.get_error();
+    values_.resize(reader_.size());
+    scratch_.resize(reader_.size());
+}
+
+daemon_client::~daemon_client() {
+    if (segment_ != nullptr) {
+        ::munmap(segment_, segment_size_);
+    }
+    if (connection_ >= 0) {
+        ::close(connection_);
+    }
+}
+
+std::error_code daemon_client::sample_now() {
+    if (ec_) {
+        return make_error_code(errc::sample_collection_failure);
+    }
+
+    if (reader_.sample_count() == sample_number_) {
+        return make_error_code(errc::sample_not_ready);
+    }
+
+    uint64_t timestamp{};
+    uint64_t sample_number{};
+    if (!reader_.try_read(scratch_.data(), timestamp, sample_number)) {
+        return make_error_code(errc::sample_not_ready);
+    }
+
+    // a failed read may leave a torn sample in scratch_, so the values are
+    // only replaced once it succeeded
+    values_.swap(scratch_);
+    timestamp_ = timestamp;
+    sample_number_ = sample_number;
+    return {};
+}
+
+std::error_code daemon_client::get_counter_value(hwcpipe_counter counter, counter_sample &sample) const {
+    if (sample_number_ == 0) {
+        return make_error_code(errc::sample_collection_failure);
+    }
+
+    for (size_t i = 0; i != values_.size(); ++i) {
+        if (get_counter(i) == counter) {
+            sample = counter_sample(counter, timestamp_, values_[i]);
+            return {};
+        }
+    }
+    return make_error_code(errc::unknown_counter);
+}
+
+} // namespace hwcpipe
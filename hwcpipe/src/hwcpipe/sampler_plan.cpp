@@ -0,0 +1,350 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hwcpipe/error.hpp"
+#include "hwcpipe/sampler.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+namespace hwcpipe {
+
+namespace {
+/*
+ * The layout of a plan: a header, then the payload, all little endian as
+ * the hosts that run the library.
+ *
+ * header:   magic, version, product ID, database checksum, payload checksum
+ * payload:  counters, enable maps, block counters, multi-rate plan, settings
+ */
+constexpr uint32_t plan_magic = 0x50535748;
+constexpr uint16_t plan_version = 5;
+constexpr size_t plan_header_size = 4 + 2 + 2 + 4 + 8 + 8;
+constexpr size_t enable_map_bytes = sampler_config::backend_cfg_type::max_counters_per_block / 8;
+
+uint64_t payload_checksum(const uint8_t *begin, const uint8_t *end) {
+    uint64_t hash = 0xCBF29CE484222325ULL;
+    for (const auto *it = begin; it != end; ++it) {
+        hash = (hash ^ *it) * 0x100000001B3ULL;
+    }
+    return hash;
+}
+
+/** Appends plain values to a plan. */
+class plan_writer {
+  public:
+    explicit plan_writer(std::vector<uint8_t> &plan)
+        : plan_(plan) {}
+
+    template <typename value_t>
+    void write(value_t value) {
+        static_assert(std::is_trivially_copyable<value_t>::value, "plan values must be plain");
+        const auto *bytes = reinterpret_cast<const uint8_t *>(&value);
+        plan_.insert(plan_.end(), bytes, bytes + sizeof(value));
+    }
+
+    template <typename enum_t>
+    void write_enum(enum_t value) {
+        write(static_cast<uint8_t>(value));
+    }
+
+    void write(bool value) { write(static_cast<uint8_t>(value ? 1 : 0)); }
+
+  private:
+    std::vector<uint8_t> &plan_;
+};
+
+/** Reads plain values from a plan, failing once past its end. */
+class plan_reader {
+  public:
+    plan_reader(const uint8_t *data, size_t size)
+        : data_(data)
+        , size_(size) {}
+
+    template <typename value_t>
+    HWCP_NODISCARD bool read(value_t &value) {
+        if (size_ - offset_ < sizeof(value)) {
+            return false;
+        }
+        std::memcpy(&value, data_ + offset_, sizeof(value));
+        offset_ += sizeof(value);
+        return true;
+    }
+
+    /** Reads an enumerator, which must not be above @p last. */
+    template <typename enum_t>
+    HWCP_NODISCARD bool read_enum(enum_t &value, enum_t last) {
+        uint8_t raw{};
+        if (!read(raw) || raw > static_cast<uint8_t>(last)) {
+            return false;
+        }
+        value = static_cast<enum_t>(raw);
+        return true;
+    }
+
+    HWCP_NODISCARD bool read_bool(bool &value) {
+        uint8_t raw{};
+        if (!read(raw) || raw > 1) {
+            return false;
+        }
+        value = raw != 0;
+        return true;
+    }
+
+    HWCP_NODISCARD bool at_end() const { return offset_ == size_; }
+
+  private:
+    const uint8_t *data_;
+    size_t size_;
+    size_t offset_{};
+};
+
+constexpr auto last_block_type =
+    static_cast<device::hwcnt::block_type>(device::hwcnt::block_extents::num_block_types - 1);
+} // namespace
+
+std::error_code sampler_config::save_plan(std::vector<uint8_t> &plan) const {
+    if (!custom_counters_.empty()) {
+        return make_error_code(errc::sampler_config_invalid);
+    }
+
+    plan.clear();
+    plan.resize(plan_header_size);
+    plan_writer writer(plan);
+
+    writer.write(static_cast<uint32_t>(counters_.size()));
+    for (const auto &registered : counters_) {
+        writer.write(static_cast<uint16_t>(registered.counter));
+        writer.write_enum(registered.definition.tag);
+        if (registered.definition.tag == detail::counter_definition::type::hardware) {
+            const auto &address = registered.definition.get_address();
+            writer.write_enum(address.block_type);
+            writer.write(static_cast<uint16_t>(address.offset));
+            writer.write(static_cast<uint8_t>(address.shift));
+        }
+    }
+
+    for (const auto &block : backend_config_) {
+        for (size_t byte = 0; byte != enable_map_bytes; ++byte) {
+            uint8_t bits{};
+            for (size_t bit = 0; bit != 8; ++bit) {
+                bits = static_cast<uint8_t>(bits | (block.enable_map[byte * 8 + bit] ? 1U << bit : 0U));
+            }
+            writer.write(bits);
+        }
+    }
+
+    writer.write(static_cast<uint32_t>(block_counters_.size()));
+    for (const auto &counter : block_counters_) {
+        writer.write_enum(counter.type);
+        writer.write(counter.offset);
+    }
+
+    writer.write(static_cast<uint32_t>(fast_counters_.size()));
+    for (auto counter : fast_counters_) {
+        writer.write(static_cast<uint16_t>(counter));
+    }
+    writer.write(slow_period_);
+
+    writer.write_enum(expression_evaluation_);
+    writer.write(sampling_period_ns_);
+    writer.write(per_instance_values_);
+    writer.write(coalesced_samples_);
+    writer.write(core_subsampling_);
+    writer.write(idle_skip_);
+    writer.write(armed_sessions_);
+    writer.write(saturation_check_);
+    writer.write(lazy_decode_);
+    writer.write(has_trigger_);
+    writer.write(static_cast<uint16_t>(trigger_.counter));
+    writer.write_enum(trigger_.condition);
+    writer.write(trigger_.threshold);
+    writer.write_enum(drop_policy_);
+    writer.write(session_recovery_);
+    writer.write(power_aware_);
+    writer.write(max_skipped_dumps_);
+    writer.write(buffer_count_);
+    writer.write_enum(clock_domain_);
+    writer.write(clock_calibration_interval_ns_);
+    writer.write(thread_config_.cpu_mask);
+    writer.write_enum(thread_config_.policy);
+    writer.write(thread_config_.priority);
+
+    const uint64_t checksum = payload_checksum(plan.data() + plan_header_size, plan.data() + plan.size());
+    std::vector<uint8_t> header{};
+    plan_writer header_writer(header);
+    header_writer.write(plan_magic);
+    header_writer.write(plan_version);
+    header_writer.write(static_cast<uint16_t>(0));
+    header_writer.write(static_cast<uint32_t>(pid_));
+    header_writer.write(db_.get_checksum(pid_));
+    header_writer.write(checksum);
+    std::copy(header.begin(), header.end(), plan.begin());
+    return {};
+}
+
+std::error_code sampler_config::load_plan(const void *data, size_t size) {
+    const auto invalid = make_error_code(errc::invalid_sampler_plan);
+    const auto *bytes = static_cast<const uint8_t *>(data);
+    if (bytes == nullptr || size < plan_header_size) {
+        return invalid;
+    }
+
+    plan_reader reader(bytes, size);
+    uint32_t magic{};
+    uint16_t version{};
+    uint16_t reserved{};
+    uint32_t pid{};
+    uint64_t db_checksum{};
+    uint64_t checksum{};
+    if (!reader.read(magic) || !reader.read(version) || !reader.read(reserved) || !reader.read(pid) ||
+        !reader.read(db_checksum) || !reader.read(checksum)) {
+        return invalid;
+    }
+    if (magic != plan_magic || version != plan_version || pid != static_cast<uint32_t>(pid_) ||
+        db_checksum != db_.get_checksum(pid_) || checksum != payload_checksum(bytes + plan_header_size, bytes + size)) {
+        return invalid;
+    }
+
+    // the plan is decoded into a copy, so that a plan rejected halfway leaves the configuration as is
+    registered_counter_set counters{};
+    uint32_t num_counters{};
+    if (!reader.read(num_counters) || num_counters > size) {
+        return invalid;
+    }
+    counters.reserve(num_counters);
+    for (uint32_t i = 0; i != num_counters; ++i) {
+        uint16_t counter{};
+        auto tag = detail::counter_definition::type::invalid;
+        if (!reader.read(counter) || !reader.read_enum(tag, detail::counter_definition::type::expression)) {
+            return invalid;
+        }
+
+        switch (tag) {
+        case detail::counter_definition::type::hardware: {
+            auto type = block_type::fe;
+            uint16_t offset{};
+            uint8_t shift{};
+            if (!reader.read_enum(type, last_block_type) || !reader.read(offset) || !reader.read(shift) ||
+                offset >= backend_cfg_type::max_counters_per_block) {
+                return invalid;
+            }
+            counters.emplace(static_cast<hwcpipe_counter>(counter),
+                             detail::counter_definition(detail::block_offset{offset, shift, type}));
+            break;
+        }
+        case detail::counter_definition::type::expression: {
+            // the evaluators are addresses in this process, looked up rather than saved
+            std::error_code ec;
+            const auto definition = db_.get_counter_def(pid_, static_cast<hwcpipe_counter>(counter), ec);
+            if (ec || definition.tag != detail::counter_definition::type::expression) {
+                return invalid;
+            }
+            counters.emplace(static_cast<hwcpipe_counter>(counter), definition);
+            break;
+        }
+        case detail::counter_definition::type::invalid:
+        default:
+            return invalid;
+        }
+    }
+
+    auto backend_config = backend_config_;
+    for (auto &block : backend_config) {
+        block.enable_map.reset();
+        for (size_t byte = 0; byte != enable_map_bytes; ++byte) {
+            uint8_t bits{};
+            if (!reader.read(bits)) {
+                return invalid;
+            }
+            for (size_t bit = 0; bit != 8; ++bit) {
+                block.enable_map[byte * 8 + bit] = ((bits >> bit) & 1U) != 0;
+            }
+        }
+    }
+
+    std::vector<block_counter> block_counters{};
+    uint32_t num_block_counters{};
+    if (!reader.read(num_block_counters) || num_block_counters > size) {
+        return invalid;
+    }
+    block_counters.resize(num_block_counters);
+    for (auto &counter : block_counters) {
+        if (!reader.read_enum(counter.type, last_block_type) || !reader.read(counter.offset) ||
+            counter.offset >= backend_cfg_type::max_counters_per_block) {
+            return invalid;
+        }
+    }
+
+    std::vector<hwcpipe_counter> fast_counters{};
+    uint32_t num_fast_counters{};
+    if (!reader.read(num_fast_counters) || num_fast_counters > size) {
+        return invalid;
+    }
+    fast_counters.reserve(num_fast_counters);
+    for (uint32_t i = 0; i != num_fast_counters; ++i) {
+        uint16_t counter{};
+        if (!reader.read(counter) || counters.find(static_cast<hwcpipe_counter>(counter)) == counters.end()) {
+            return invalid;
+        }
+        fast_counters.push_back(static_cast<hwcpipe_counter>(counter));
+    }
+
+    sampler_config loaded(pid_, device_number_);
+    if (!reader.read(loaded.slow_period_) || loaded.slow_period_ == 0) {
+        return invalid;
+    }
+    uint16_t trigger_counter{};
+    if (!reader.read_enum(loaded.expression_evaluation_, expression_evaluation::eager) ||
+        !reader.read(loaded.sampling_period_ns_) || !reader.read_bool(loaded.per_instance_values_) ||
+        !reader.read(loaded.coalesced_samples_) || !reader.read(loaded.core_subsampling_) ||
+        !reader.read_bool(loaded.idle_skip_) || !reader.read_bool(loaded.armed_sessions_) ||
+        !reader.read_bool(loaded.saturation_check_) || !reader.read_bool(loaded.lazy_decode_) ||
+        !reader.read_bool(loaded.has_trigger_) || !reader.read(trigger_counter) ||
+        !reader.read_enum(loaded.trigger_.condition, trigger_condition::below) ||
+        !reader.read(loaded.trigger_.threshold) || !reader.read_enum(loaded.drop_policy_, drop_policy::salvage) ||
+        !reader.read(loaded.session_recovery_) || !reader.read_bool(loaded.power_aware_) ||
+        !reader.read(loaded.max_skipped_dumps_) || !reader.read(loaded.buffer_count_) ||
+        !reader.read_enum(loaded.clock_domain_, clock_domain::realtime) ||
+        !reader.read(loaded.clock_calibration_interval_ns_) || !reader.read(loaded.thread_config_.cpu_mask) ||
+        !reader.read_enum(loaded.thread_config_.policy, device::hwcnt::sampler::sched_class::round_robin) ||
+        !reader.read(loaded.thread_config_.priority) || !reader.at_end() || loaded.coalesced_samples_ == 0) {
+        return invalid;
+    }
+    loaded.trigger_.counter = static_cast<hwcpipe_counter>(trigger_counter);
+
+    counters_ = std::move(counters);
+    custom_counters_.clear();
+    block_counters_ = std::move(block_counters);
+    backend_config_ = backend_config;
+    fast_counters_ = std::move(fast_counters);
+    slow_period_ = loaded.slow_period_;
+    expression_evaluation_ = loaded.expression_evaluation_;
+    sampling_period_ns_ = loaded.sampling_period_ns_;
+    per_instance_values_ = loaded.per_instance_values_;
+    coalesced_samples_ = loaded.coalesced_samples_;
+    core_subsampling_ = loaded.core_subsampling_;
+    idle_skip_ = loaded.idle_skip_;
+    armed_sessions_ = loaded.armed_sessions_;
+    saturation_check_ = loaded.saturation_check_;
+    lazy_decode_ = loaded.lazy_decode_;
+    has_trigger_ = loaded.has_trigger_;
+    trigger_ = loaded.trigger_;
+    drop_policy_ = loaded.drop_policy_;
+    session_recovery_ = loaded.session_recovery_;
+    power_aware_ = loaded.power_aware_;
+    max_skipped_dumps_ = loaded.max_skipped_dumps_;
+    buffer_count_ = loaded.buffer_count_;
+    clock_domain_ = loaded.clock_domain_;
+    clock_calibration_interval_ns_ = loaded.clock_calibration_interval_ns_;
+    thread_config_ = loaded.thread_config_;
+    return {};
+}
+
+} // namespace hwcpipe
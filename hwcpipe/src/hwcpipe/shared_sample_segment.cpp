@@ -0,0 +1,290 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hwcpipe/counter_metadata.hpp"
+
+#include <hwcpipe/error.hpp>
+#include <hwcpipe/shared_sample_segment.hpp>
+
+#include <cstring>
+#include <new>
+
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace hwcpipe {
+
+namespace {
+/** Sections of the segment start on a cache line. */
+constexpr size_t section_alignment = 64;
+
+/** MFD_CLOEXEC from linux/memfd.h, which older C libraries don't expose. */
+constexpr unsigned int memfd_cloexec = 0x0001U;
+
+constexpr size_t align_up(size_t value, size_t alignment) { return (value + alignment - 1) / alignment * alignment; }
+
+int create_memfd() {
+#if defined(SYS_memfd_create)
+    return static_cast<int>(::syscall(SYS_memfd_create, "hwcpipe-samples", memfd_cloexec));
+#else
+    return -1;
+#endif
+}
+
+void copy_string(char *destination, size_t size, const char *source) {
+    std::strncpy(destination, source, size - 1);
+    destination[size - 1] = '\0';
+}
+
+uint64_t to_bits(double value) {
+    uint64_t bits{};
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+double from_bits(uint64_t bits) {
+    double value{};
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+shared_layout::ring_slot_header *slot_header(char *slot) {
+    return reinterpret_cast<shared_layout::ring_slot_header *>(slot);
+}
+
+const shared_layout::ring_slot_header *slot_header(const char *slot) {
+    return reinterpret_cast<const shared_layout::ring_slot_header *>(slot);
+}
+
+std::atomic<uint64_t> *slot_values(char *slot) {
+    return reinterpret_cast<std::atomic<uint64_t> *>(slot + sizeof(shared_layout::ring_slot_header));
+}
+
+const std::atomic<uint64_t> *slot_values(const char *slot) {
+    return reinterpret_cast<const std::atomic<uint64_t> *>(slot + sizeof(shared_layout::ring_slot_header));
+}
+} // namespace
+
+shared_sample_exporter::shared_sample_exporter(const hwcpipe_counter *counters, size_t count, size_t history)
+    : staging_(count) {
+    namespace db = hwcpipe::database;
+    using shared_layout::counter_entry;
+    using shared_layout::ring_slot_header;
+    using shared_layout::segment_header;
+
+    for (size_t i = 0; i != count; ++i) {
+        if (static_cast<size_t>(counters[i]) >= db::num_counters) {
+            ec_ = make_error_code(errc::unknown_counter);
+            return;
+        }
+    }
+
+    const size_t entries_offset = align_up(sizeof(segment_header), section_alignment);
+    const size_t values_offset = align_up(entries_offset + count * sizeof(counter_entry), section_alignment);
+    const size_t ring_offset = align_up(values_offset + count * sizeof(uint64_t), section_alignment);
+    const size_t ring_slot_size = sizeof(ring_slot_header) + count * sizeof(uint64_t);
+    size_ = history == 0 ? values_offset + count * sizeof(uint64_t) : ring_offset + history * ring_slot_size;
+
+    fd_ = create_memfd();
+    if (fd_ < 0 || ::ftruncate(fd_, static_cast<off_t>(size_)) != 0) {
+        ec_ = make_error_code(errc::segment_creation_failed);
+        return;
+    }
+
+    segment_ = ::mmap(nullptr, size_, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+    if (segment_ == MAP_FAILED) {
+        segment_ = nullptr;
+        ec_ = make_error_code(errc::segment_creation_failed);
+        return;
+    }
+
+    auto *base = static_cast<char *>(segment_);
+    header_ = new (base) segment_header();
+    header_->magic = shared_layout::magic;
+    header_->version_major = shared_layout::version_major;
+    header_->version_minor = shared_layout::version_minor;
+    header_->header_size = sizeof(segment_header);
+    header_->entry_size = sizeof(counter_entry);
+    header_->num_counters = static_cast<uint32_t>(count);
+    header_->entries_offset = static_cast<uint32_t>(entries_offset);
+    header_->values_offset = static_cast<uint32_t>(values_offset);
+    header_->segment_size = static_cast<uint32_t>(size_);
+    if (history != 0) {
+        header_->ring_offset = static_cast<uint32_t>(ring_offset);
+        header_->ring_capacity = static_cast<uint32_t>(history);
+        header_->ring_slot_size = static_cast<uint32_t>(ring_slot_size);
+    }
+
+    for (size_t i = 0; i != count; ++i) {
+        const auto index = static_cast<size_t>(counters[i]);
+        auto *entry = new (base + entries_offset + i * sizeof(counter_entry)) counter_entry();
+        entry->counter = static_cast<uint32_t>(counters[i]);
+        copy_string(entry->identifier, sizeof(entry->identifier), db::get_counter_identifier(index));
+        copy_string(entry->name, sizeof(entry->name), db::get_counter_name(index));
+        copy_string(entry->units, sizeof(entry->units), db::get_counter_units(index));
+    }
+
+    values_ = reinterpret_cast<std::atomic<uint64_t> *>(base + values_offset);
+    for (size_t i = 0; i != count; ++i) {
+        new (values_ + i) std::atomic<uint64_t>(0);
+    }
+
+    if (history != 0) {
+        ring_ = base + ring_offset;
+        ring_capacity_ = history;
+        ring_slot_size_ = ring_slot_size;
+        for (size_t slot = 0; slot != history; ++slot) {
+            char *address = ring_ + slot * ring_slot_size;
+            new (address) ring_slot_header();
+            for (size_t i = 0; i != count; ++i) {
+                new (slot_values(address) + i) std::atomic<uint64_t>(0);
+            }
+        }
+    }
+}
+
+shared_sample_exporter::~shared_sample_exporter() {
+    if (segment_ != nullptr) {
+        ::munmap(segment_, size_);
+    }
+    if (fd_ >= 0) {
+        ::close(fd_);
+    }
+}
+
+void shared_sample_exporter::publish(uint64_t timestamp, const double *values) {
+    if (ec_) {
+        return;
+    }
+
+    const auto sequence = header_->sequence.load(std::memory_order_relaxed);
+    header_->sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    header_->timestamp.store(timestamp, std::memory_order_relaxed);
+    for (size_t i = 0; i != staging_.size(); ++i) {
+        values_[i].store(to_bits(values[i]), std::memory_order_relaxed);
+    }
+    const auto sample_number = header_->sample_count.load(std::memory_order_relaxed) + 1;
+
+    if (ring_ != nullptr) {
+        char *slot = ring_ + static_cast<size_t>((sample_number - 1) % ring_capacity_) * ring_slot_size_;
+        auto *slot_header_ptr = slot_header(slot);
+        const auto slot_sequence = slot_header_ptr->sequence.load(std::memory_order_relaxed);
+        slot_header_ptr->sequence.store(slot_sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        slot_header_ptr->timestamp.store(timestamp, std::memory_order_relaxed);
+        slot_header_ptr->sample_number.store(sample_number, std::memory_order_relaxed);
+        auto *ring_values = slot_values(slot);
+        for (size_t i = 0; i != staging_.size(); ++i) {
+            ring_values[i].store(to_bits(values[i]), std::memory_order_relaxed);
+        }
+
+        slot_header_ptr->sequence.store(slot_sequence + 2, std::memory_order_release);
+    }
+
+    header_->sample_count.store(sample_number, std::memory_order_relaxed);
+    header_->sequence.store(sequence + 2, std::memory_order_release);
+}
+
+shared_sample_reader::shared_sample_reader(const void *segment, size_t size) {
+    using shared_layout::counter_entry;
+    using shared_layout::ring_slot_header;
+    using shared_layout::segment_header;
+
+    ec_ = make_error_code(errc::invalid_segment_layout);
+    if (segment == nullptr || size < shared_layout::base_header_size) {
+        return;
+    }
+
+    const auto *base = static_cast<const char *>(segment);
+    const auto *header = reinterpret_cast<const segment_header *>(base);
+    if (header->magic != shared_layout::magic || header->version_major != shared_layout::version_major ||
+        header->header_size < shared_layout::base_header_size || header->entry_size < sizeof(counter_entry) ||
+        header->segment_size > size) {
+        return;
+    }
+
+    const size_t num_counters = header->num_counters;
+    const size_t entries_end = size_t{header->entries_offset} + num_counters * header->entry_size;
+    const size_t values_end = size_t{header->values_offset} + num_counters * sizeof(uint64_t);
+    if (header->entries_offset < header->header_size || entries_end > header->segment_size ||
+        header->values_offset % alignof(std::atomic<uint64_t>) != 0 || values_end > header->segment_size) {
+        return;
+    }
+
+    // version 1.0 headers end before the ring fields
+    const bool has_ring = header->header_size >= sizeof(segment_header) && header->ring_capacity != 0;
+    if (has_ring) {
+        const size_t ring_end = size_t{header->ring_offset} + size_t{header->ring_capacity} * header->ring_slot_size;
+        if (header->ring_offset < header->header_size ||
+            header->ring_offset % alignof(std::atomic<uint64_t>) != 0 ||
+            header->ring_slot_size < sizeof(ring_slot_header) + num_counters * sizeof(uint64_t) ||
+            header->ring_slot_size % alignof(std::atomic<uint64_t>) != 0 || ring_end > header->segment_size) {
+            return;
+        }
+        ring_ = base + header->ring_offset;
+        ring_capacity_ = header->ring_capacity;
+        ring_slot_size_ = header->ring_slot_size;
+    }
+
+    header_ = header;
+    entries_ = base + header->entries_offset;
+    entry_size_ = header->entry_size;
+    values_ = reinterpret_cast<const std::atomic<uint64_t> *>(base + header->values_offset);
+    num_counters_ = num_counters;
+    ec_ = {};
+}
+
+bool shared_sample_reader::try_read(double *values, uint64_t &timestamp, uint64_t &sample_count) const {
+    if (ec_) {
+        return false;
+    }
+
+    const auto begin = header_->sequence.load(std::memory_order_acquire);
+    if ((begin & 1U) != 0) {
+        return false;
+    }
+
+    timestamp = header_->timestamp.load(std::memory_order_relaxed);
+    sample_count = header_->sample_count.load(std::memory_order_relaxed);
+    for (size_t i = 0; i != num_counters_; ++i) {
+        values[i] = from_bits(values_[i].load(std::memory_order_relaxed));
+    }
+
+    std::atomic_thread_fence(std::memory_order_acquire);
+    const auto end = header_->sequence.load(std::memory_order_relaxed);
+    return begin == end && sample_count != 0;
+}
+
+bool shared_sample_reader::try_read_sample(uint64_t sample_number, double *values, uint64_t &timestamp) const {
+    if (ec_ || ring_ == nullptr || sample_number == 0) {
+        return false;
+    }
+
+    const char *slot = ring_ + static_cast<size_t>((sample_number - 1) % ring_capacity_) * ring_slot_size_;
+    const auto *header = slot_header(slot);
+
+    const auto begin = header->sequence.load(std::memory_order_acquire);
+    if ((begin & 1U) != 0) {
+        return false;
+    }
+
+    const auto number = header->sample_number.load(std::memory_order_relaxed);
+    timestamp = header->timestamp.load(std::memory_order_relaxed);
+    const auto *ring_values = slot_values(slot);
+    for (size_t i = 0; i != num_counters_; ++i) {
+        values[i] = from_bits(ring_values[i].load(std::memory_order_relaxed));
+    }
+
+    std::atomic_thread_fence(std::memory_order_acquire);
+    const auto end = header->sequence.load(std::memory_order_relaxed);
+    return begin == end && number == sample_number;
+}
+
+} // namespace hwcpipe
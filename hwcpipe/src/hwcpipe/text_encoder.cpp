@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <hwcpipe/counter_database.hpp>
+#include <hwcpipe/detail/decimal_format.hpp>
+#include <hwcpipe/text_encoder.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <string>
+
+namespace hwcpipe {
+
+namespace {
+
+/** @return @p name as a JSON string, with its quotes. */
+std::string json_string(const std::string &name) {
+    std::string result = "\"";
+    for (const char c : name) {
+        if (c == '"' || c == '\\') {
+            result += '\\';
+            result += c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            char escape[8];
+            std::snprintf(escape, sizeof(escape), "\\u%04x", static_cast<unsigned>(c));
+            result += escape;
+        } else {
+            result += c;
+        }
+    }
+    return result + '"';
+}
+
+/** @return @p name as a CSV field, quoted when it holds a separator. */
+std::string csv_field(const std::string &name) {
+    if (name.find_first_of(",\"\r\n") == std::string::npos) {
+        return name;
+    }
+    std::string result = "\"";
+    for (const char c : name) {
+        if (c == '"') {
+            result += '"';
+        }
+        result += c;
+    }
+    return result + '"';
+}
+
+} // namespace
+
+text_encoder::text_encoder(const hwcpipe_counter *counters, size_t num_counters, const text_encoder_config &config)
+    : format_(config.format)
+    , timestamp_(config.timestamp)
+    , decimals_(config.decimals)
+    , staging_(num_counters) {
+    if (config.columns != nullptr) {
+        for (size_t i = 0; i != config.num_columns; ++i) {
+            if (config.columns[i] < num_counters) {
+                columns_.push_back(config.columns[i]);
+            }
+        }
+    } else {
+        for (size_t i = 0; i != num_counters; ++i) {
+            columns_.push_back(i);
+        }
+    }
+
+    const bool csv = format_ == text_format::csv;
+    if (csv && timestamp_) {
+        header_ = "timestamp";
+    }
+    // '{', the timestamp, '}' and the line feed
+    max_line_size_ = 3 + (timestamp_ ? 12 + detail::max_integer_size : 0);
+
+    const counter_database database{};
+    for (const auto index : columns_) {
+        std::string name{};
+        counter_metadata metadata{};
+        if (database.describe_counter(counters[index], metadata)) {
+            name = std::to_string(static_cast<int>(counters[index]));
+        } else {
+            name = metadata.name;
+        }
+
+        const bool first = key_offsets_.empty() && !timestamp_;
+        std::string key = first ? "" : ",";
+        if (csv) {
+            header_ += key + csv_field(name);
+        } else {
+            key += json_string(name) + ':';
+        }
+
+        key_offsets_.push_back(keys_.size());
+        keys_.insert(keys_.end(), key.begin(), key.end());
+        max_line_size_ += key.size() + detail::max_double_size;
+    }
+    key_offsets_.push_back(keys_.size());
+    if (csv) {
+        header_ += '\n';
+    }
+}
+
+char *text_encoder::begin_line(uint64_t timestamp_ns) {
+    // grow geometrically, so that a reused buffer stops growing
+    if (buffer_.size() - size_ < max_line_size_) {
+        buffer_.resize(std::max(buffer_.size() * 2, size_ + max_line_size_));
+    }
+
+    char *out = buffer_.data() + size_;
+    if (format_ == text_format::json_lines) {
+        *out++ = '{';
+        if (timestamp_) {
+            static const char key[] = "\"timestamp\":";
+            out = std::copy(key, key + sizeof(key) - 1, out);
+        }
+    }
+    if (timestamp_) {
+        out = detail::format_unsigned(timestamp_ns, out);
+    }
+    return out;
+}
+
+char *text_encoder::append_value(uint64_t value, char *out) const { return detail::format_unsigned(value, out); }
+
+char *text_encoder::append_value(double value, char *out) const {
+    if (!std::isfinite(value)) {
+        if (format_ == text_format::json_lines) {
+            static const char null[] = "null";
+            out = std::copy(null, null + sizeof(null) - 1, out);
+        }
+        return out;
+    }
+    return detail::format_double(value, decimals_, out);
+}
+
+void text_encoder::end_line(char *out) {
+    if (format_ == text_format::json_lines) {
+        *out++ = '}';
+    }
+    *out++ = '\n';
+    size_ = static_cast<size_t>(out - buffer_.data());
+}
+
+} // namespace hwcpipe
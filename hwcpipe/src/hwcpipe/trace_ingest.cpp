@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <hwcpipe/column_evaluator.hpp>
+#include <hwcpipe/trace_ingest.hpp>
+#include <hwcpipe/trace_recorder.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <tuple>
+#include <utility>
+
+namespace hwcpipe {
+
+namespace {
+// the slot of a hardware counter that the trace didn't record
+constexpr size_t no_slot = std::numeric_limits<size_t>::max();
+
+// a counter of the schema that a trace provides
+struct mapped_counter {
+    size_t schema_index;
+    column_evaluator evaluator;
+    // the slot of each input of the evaluator
+    std::vector<size_t> input_slots;
+};
+} // namespace
+
+// the buckets and scratch of one thread
+struct trace_ingest::worker_state {
+    std::map<uint64_t, std::vector<trace_aggregate>> buckets;
+    std::vector<uint64_t> keys;
+    std::vector<double> slot_values;
+    std::vector<double> results;
+    std::vector<const double *> columns;
+};
+
+trace_ingest::trace_ingest(std::vector<hwcpipe_counter> schema, const trace_ingest_config &config)
+    : schema_(std::move(schema))
+    , config_(config)
+    , pool_(config.num_threads) {
+    config_.bucket_ns = std::max<uint64_t>(config_.bucket_ns, 1);
+    config_.chunk_records = std::max<size_t>(config_.chunk_records, 1);
+}
+
+std::error_code trace_ingest::ingest(const std::vector<std::string> &paths) {
+    const size_t first_result = results_.size();
+    results_.resize(first_result + paths.size());
+
+    std::vector<worker_state> workers(pool_.num_threads());
+    pool_.run(paths.size(), [&](size_t worker, size_t file) {
+        ingest_file(paths[file], workers[worker], results_[first_result + file]);
+    });
+
+    // merge the buckets of the threads with the buckets of earlier calls
+    std::map<uint64_t, std::vector<trace_aggregate>> merged;
+    for (size_t i = 0; i != bucket_keys_.size(); ++i) {
+        const auto *bucket = get_bucket(i);
+        merged.emplace(bucket_keys_[i], std::vector<trace_aggregate>(bucket, bucket + schema_.size()));
+    }
+    for (auto &worker : workers) {
+        for (auto &bucket : worker.buckets) {
+            auto inserted = merged.emplace(bucket.first, std::vector<trace_aggregate>());
+            if (inserted.second) {
+                inserted.first->second = std::move(bucket.second);
+                continue;
+            }
+            for (size_t k = 0; k != schema_.size(); ++k) {
+                inserted.first->second[k].merge(bucket.second[k]);
+            }
+        }
+    }
+
+    bucket_keys_.clear();
+    aggregates_.clear();
+    for (const auto &bucket : merged) {
+        bucket_keys_.push_back(bucket.first);
+        aggregates_.insert(aggregates_.end(), bucket.second.begin(), bucket.second.end());
+    }
+
+    for (size_t i = first_result; i != results_.size(); ++i) {
+        if (results_[i].ec) {
+            return results_[i].ec;
+        }
+    }
+    return {};
+}
+
+void trace_ingest::clear() {
+    results_.clear();
+    bucket_keys_.clear();
+    aggregates_.clear();
+}
+
+void trace_ingest::ingest_file(const std::string &path, worker_state &worker, trace_ingest_result &result) const {
+    const trace_file file(path);
+    result.ec = file.get_error();
+    if (result.ec) {
+        return;
+    }
+
+    const auto &reader = file.get_reader();
+    const auto &constants = reader.header().constants;
+    std::tie(result.ec, result.pid) = device::product_id_from_raw_gpu_id(constants.gpu_id);
+    if (result.ec) {
+        return;
+    }
+
+    // a slot is a hardware counter summed over the columns of its block instances
+    std::vector<hwcpipe_counter> slot_counters;
+    std::vector<std::vector<size_t>> slot_columns;
+    const auto find_slot = [&](hwcpipe_counter counter) {
+        const auto found = std::find(slot_counters.begin(), slot_counters.end(), counter);
+        if (found != slot_counters.end()) {
+            return static_cast<size_t>(found - slot_counters.begin());
+        }
+        std::vector<size_t> columns;
+        for (size_t i = 0; i != reader.num_columns(); ++i) {
+            if (reader.get_column(i).counter == static_cast<uint32_t>(counter)) {
+                columns.push_back(i);
+            }
+        }
+        if (columns.empty()) {
+            return no_slot;
+        }
+        slot_counters.push_back(counter);
+        slot_columns.push_back(std::move(columns));
+        return slot_counters.size() - 1;
+    };
+
+    std::vector<mapped_counter> counters;
+    for (size_t k = 0; k != schema_.size(); ++k) {
+        column_evaluator evaluator(result.pid, constants, schema_[k]);
+        if (!evaluator) {
+            continue;
+        }
+        std::vector<size_t> input_slots;
+        for (const auto input : evaluator.get_inputs()) {
+            const size_t slot = find_slot(input);
+            if (slot == no_slot) {
+                break;
+            }
+            input_slots.push_back(slot);
+        }
+        if (input_slots.size() != evaluator.get_inputs().size()) {
+            continue;
+        }
+        counters.push_back({k, std::move(evaluator), std::move(input_slots)});
+    }
+    result.num_counters = counters.size();
+
+    const size_t num_records = reader.num_records();
+    if (num_records == 0) {
+        return;
+    }
+    const uint64_t origin =
+        config_.alignment == trace_alignment::trace_start ? reader.get_record(0).timestamp_ns_begin : 0;
+
+    const size_t chunk_records = config_.chunk_records;
+    worker.keys.resize(chunk_records);
+    worker.slot_values.resize(slot_counters.size() * chunk_records);
+    worker.results.resize(chunk_records);
+
+    for (size_t first = 0; first < num_records; first += chunk_records) {
+        const size_t last = std::min(first + chunk_records, num_records);
+
+        // decode the chunk into one column per slot
+        size_t count = 0;
+        for (size_t i = first; i != last; ++i) {
+            const auto record = reader.get_record(i);
+            if ((record.flags & trace_layout::flag_error) != 0) {
+                continue;
+            }
+            const uint64_t timestamp = record.timestamp_ns_begin;
+            worker.keys[count] = timestamp > origin ? (timestamp - origin) / config_.bucket_ns : 0;
+            for (size_t s = 0; s != slot_counters.size(); ++s) {
+                uint64_t value = 0;
+                for (const size_t column : slot_columns[s]) {
+                    value += reader.get_value(i, column);
+                }
+                worker.slot_values[s * chunk_records + count] = static_cast<double>(value);
+            }
+            ++count;
+        }
+        result.num_records += count;
+
+        for (auto &counter : counters) {
+            worker.columns.clear();
+            for (const size_t slot : counter.input_slots) {
+                worker.columns.push_back(worker.slot_values.data() + slot * chunk_records);
+            }
+            const auto ec = counter.evaluator.evaluate(worker.columns.data(), worker.columns.size(), count,
+                                                       worker.results.data());
+            if (ec) {
+                result.ec = ec;
+                return;
+            }
+
+            // records are in time order, so a bucket is looked up once per run of records
+            auto bucket = worker.buckets.end();
+            for (size_t j = 0; j != count; ++j) {
+                if (bucket == worker.buckets.end() || bucket->first != worker.keys[j]) {
+                    bucket = worker.buckets.emplace(worker.keys[j], std::vector<trace_aggregate>(schema_.size()))
+                                 .first;
+                }
+                bucket->second[counter.schema_index].add(worker.results[j]);
+            }
+        }
+    }
+}
+
+} // namespace hwcpipe
@@ -0,0 +1,589 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <hwcpipe/detail/async_file_writer.hpp>
+#include <hwcpipe/detail/column_codec.hpp>
+#include <hwcpipe/error.hpp>
+#include <hwcpipe/trace_recorder.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace hwcpipe {
+
+namespace {
+/** Sections of the file start on a cache line. */
+constexpr size_t section_alignment = 64;
+
+constexpr size_t align_up(size_t value, size_t alignment) { return (value + alignment - 1) / alignment * alignment; }
+} // namespace
+
+constexpr size_t trace_recorder::default_batch_size;
+constexpr size_t trace_recorder::async_write_depth;
+
+trace_recorder::trace_recorder(const std::string &path, const sampler_config &config,
+                               const device::constants &constants, const num_blocks_of_type_type &num_blocks_of_type,
+                               uint16_t counters_per_block, uint32_t value_size, size_t batch_size,
+                               trace_encoding encoding, trace_write_mode write_mode)
+    : value_size_(value_size)
+    , batch_size_(std::max<size_t>(batch_size, 1))
+    , encoding_(encoding) {
+    using trace_layout::column;
+    using trace_layout::file_header;
+
+    // hardware counters in block type, then offset order
+    std::vector<const sampler_config::registered_counter *> hardware{};
+    for (const auto &counter : config.get_valid_counters()) {
+        if (counter.definition.tag == detail::counter_definition::type::hardware) {
+            hardware.push_back(&counter);
+        }
+    }
+    std::sort(hardware.begin(), hardware.end(), [](const auto *lhs, const auto *rhs) {
+        const auto &lhs_address = lhs->definition.get_address();
+        const auto &rhs_address = rhs->definition.get_address();
+        if (lhs_address.block_type != rhs_address.block_type) {
+            return lhs_address.block_type < rhs_address.block_type;
+        }
+        return lhs_address.offset < rhs_address.offset;
+    });
+
+    // one column per counter and instance of its block type
+    auto next = hardware.begin();
+    for (size_t type = 0; type != block_columns_.size(); ++type) {
+        auto &columns = block_columns_[type];
+        columns.first_column = columns_.size();
+        columns.first_offset = offsets_.size();
+        columns.num_blocks = num_blocks_of_type[type];
+
+        const auto begin = next;
+        while (next != hardware.end() && static_cast<size_t>((*next)->definition.get_address().block_type) == type) {
+            offsets_.push_back((*next)->definition.get_address().offset);
+            ++next;
+        }
+        columns.num_offsets = static_cast<size_t>(next - begin);
+
+        for (size_t index = 0; index != columns.num_blocks; ++index) {
+            for (auto it = begin; it != next; ++it) {
+                const auto &address = (*it)->definition.get_address();
+                column entry{};
+                entry.counter = static_cast<uint32_t>((*it)->counter);
+                entry.block_type = static_cast<uint8_t>(type);
+                entry.block_index = static_cast<uint8_t>(index);
+                entry.offset = static_cast<uint16_t>(address.offset);
+                entry.shift = address.shift;
+                columns_.push_back(entry);
+            }
+        }
+    }
+
+    const size_t columns_offset = align_up(sizeof(file_header), section_alignment);
+    const size_t records_offset = align_up(columns_offset + columns_.size() * sizeof(column), section_alignment);
+    record_size_ = align_up(sizeof(trace_layout::record_header) + columns_.size() * value_size_, sizeof(uint64_t));
+
+    // the header and columns are staged in the record buffer, which is large
+    // enough for both at the usual batch sizes
+    buffer_.resize(std::max(batch_size_ * record_size_, records_offset));
+
+    file_header header{};
+    header.magic = trace_layout::magic;
+    const bool raw = encoding == trace_encoding::raw;
+    header.version_major = raw ? trace_layout::version_major : trace_layout::chunked_version_major;
+    header.version_minor = raw ? trace_layout::version_minor : trace_layout::chunked_version_minor;
+    header.header_size = sizeof(file_header);
+    header.column_size = sizeof(column);
+    header.num_columns = static_cast<uint32_t>(columns_.size());
+    header.columns_offset = static_cast<uint32_t>(columns_offset);
+    header.records_offset = static_cast<uint32_t>(records_offset);
+    header.record_size = static_cast<uint32_t>(record_size_);
+    header.value_size = value_size_;
+    header.counters_per_block = counters_per_block;
+    std::copy(num_blocks_of_type.begin(), num_blocks_of_type.end(), header.num_blocks_of_type);
+    header.encoding = static_cast<uint32_t>(encoding);
+    header.constants = constants;
+    const auto &thread = config.get_thread_config();
+    header.cpu_mask = thread.cpu_mask;
+    header.sched_class = static_cast<uint32_t>(thread.policy);
+    header.sched_priority = thread.priority;
+
+    std::memcpy(buffer_.data(), &header, sizeof(header));
+    if (!columns_.empty()) {
+        std::memcpy(buffer_.data() + columns_offset, columns_.data(), columns_.size() * sizeof(column));
+    }
+
+    fd_ = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd_ < 0) {
+        ec_ = make_error_code(errc::trace_write_failed);
+        return;
+    }
+
+    ec_ = write_all(buffer_.data(), records_offset);
+    buffer_.resize(batch_size_ * record_size_);
+    staging_ = buffer_.data();
+
+    size_t batch_bytes = buffer_.size();
+    if (encoding == trace_encoding::delta) {
+        const size_t num_fields = trace_layout::num_header_fields + columns_.size();
+        column_.resize(batch_size_);
+        batch_bytes =
+            sizeof(trace_layout::chunk_header) + num_fields * detail::column_codec::max_encoded_size(batch_size_);
+    }
+
+    if (ec_ || write_mode == trace_write_mode::blocking) {
+        encoded_.resize(raw ? 0 : batch_bytes);
+        return;
+    }
+
+    // chunks are encoded into the buffers of the writer, raw records are staged in them
+    writer_.reset(new detail::async_file_writer(fd_, batch_bytes, async_write_depth));
+    ec_ = writer_->get_error();
+    if (!ec_ && raw) {
+        std::vector<char>().swap(buffer_);
+        ec_ = writer_->acquire(staging_);
+    }
+}
+
+trace_recorder::~trace_recorder() {
+    // errors can't be reported from here, close() first to check them
+    ec_ = close();
+}
+
+std::error_code trace_recorder::close() {
+    if (fd_ < 0) {
+        return ec_;
+    }
+
+    ec_ = flush();
+    if (writer_) {
+        // the index follows the chunks, and the buffers must outlive their writes
+        const auto ec = writer_->drain();
+        ec_ = ec_ ? ec_ : ec;
+        writer_.reset();
+    }
+    if (!ec_ && encoding_ == trace_encoding::delta) {
+        ec_ = write_index();
+    }
+    ::close(fd_);
+    fd_ = -1;
+    return ec_;
+}
+
+std::error_code trace_recorder::write_index() {
+    const trace_layout::index_trailer trailer{trace_layout::index_magic, static_cast<uint32_t>(index_.size()),
+                                              file_size_};
+
+    const trace_layout::chunk_header header{0, static_cast<uint32_t>(index_.size() * sizeof(index_.front()))};
+    auto ec = write_all(reinterpret_cast<const char *>(&header), sizeof(header));
+    if (!ec && !index_.empty()) {
+        ec = write_all(reinterpret_cast<const char *>(index_.data()), header.payload_size);
+    }
+    if (!ec) {
+        ec = write_all(reinterpret_cast<const char *>(&trailer), sizeof(trailer));
+    }
+    return ec;
+}
+
+std::error_code trace_recorder::flush() {
+    if (ec_) {
+        return ec_;
+    }
+
+    if (num_buffered_ == 0) {
+        return {};
+    }
+
+    if (encoding_ == trace_encoding::delta) {
+        trace_layout::record_header first{};
+        std::memcpy(&first, buffer_.data(), sizeof(first));
+        index_.push_back({first.timestamp_ns_begin, first.sample_nr, num_records_ - num_buffered_, file_size_});
+    }
+
+    if (writer_) {
+        ec_ = submit_batch();
+    } else if (encoding_ == trace_encoding::delta) {
+        ec_ = write_all(reinterpret_cast<const char *>(encoded_.data()), encode_chunk(encoded_.data()));
+    } else {
+        ec_ = write_all(buffer_.data(), num_buffered_ * record_size_);
+    }
+    num_buffered_ = 0;
+    return ec_;
+}
+
+std::error_code trace_recorder::submit_batch() {
+    char *batch = staging_;
+    size_t size = num_buffered_ * record_size_;
+    if (encoding_ == trace_encoding::delta) {
+        const auto ec = writer_->acquire(batch);
+        if (ec) {
+            return ec;
+        }
+        size = encode_chunk(reinterpret_cast<uint8_t *>(batch));
+    }
+
+    auto ec = writer_->submit(batch, size, file_size_);
+    file_size_ += size;
+
+    // the next raw records are staged in a free buffer
+    if (!ec && encoding_ == trace_encoding::raw) {
+        ec = writer_->acquire(staging_);
+    }
+    return ec;
+}
+
+size_t trace_recorder::encode_chunk(uint8_t *chunk) {
+    namespace codec = detail::column_codec;
+    using trace_layout::record_header;
+
+    uint8_t *output = chunk + sizeof(trace_layout::chunk_header);
+
+    // the record header fields, then the values, one column at a time
+    const size_t header_offsets[trace_layout::num_header_fields] = {
+        offsetof(record_header, sample_nr), offsetof(record_header, timestamp_ns_begin),
+        offsetof(record_header, timestamp_ns_end), offsetof(record_header, gpu_cycle),
+        offsetof(record_header, sc_cycle), offsetof(record_header, flags),
+    };
+    for (size_t field = 0; field != trace_layout::num_header_fields; ++field) {
+        const size_t size = field + 1 == trace_layout::num_header_fields ? sizeof(uint32_t) : sizeof(uint64_t);
+        for (size_t i = 0; i != num_buffered_; ++i) {
+            uint64_t value{};
+            std::memcpy(&value, buffer_.data() + i * record_size_ + header_offsets[field], size);
+            column_[i] = value;
+        }
+        output += codec::encode(column_.data(), num_buffered_, output);
+    }
+
+    for (size_t column = 0; column != columns_.size(); ++column) {
+        const size_t offset = sizeof(record_header) + column * value_size_;
+        for (size_t i = 0; i != num_buffered_; ++i) {
+            uint64_t value{};
+            std::memcpy(&value, buffer_.data() + i * record_size_ + offset, value_size_);
+            column_[i] = value;
+        }
+        output += codec::encode(column_.data(), num_buffered_, output);
+    }
+
+    const size_t size = static_cast<size_t>(output - chunk);
+    trace_layout::chunk_header header{};
+    header.num_records = static_cast<uint32_t>(num_buffered_);
+    header.payload_size = static_cast<uint32_t>(size - sizeof(header));
+    std::memcpy(chunk, &header, sizeof(header));
+    return size;
+}
+
+std::error_code trace_recorder::write_all(const char *data, size_t size) {
+    while (size != 0) {
+        // positioned, so that synchronous writes don't depend on the background ones
+        const auto written = ::pwrite(fd_, data, size, static_cast<off_t>(file_size_));
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return make_error_code(errc::trace_write_failed);
+        }
+        data += written;
+        size -= static_cast<size_t>(written);
+        file_size_ += static_cast<uint64_t>(written);
+    }
+    return {};
+}
+
+trace_reader::trace_reader(const void *data, size_t size) {
+    using trace_layout::column;
+    using trace_layout::file_header;
+    using trace_layout::record_header;
+
+    ec_ = make_error_code(errc::invalid_trace_layout);
+    if (data == nullptr || size < trace_layout::base_header_size) {
+        return;
+    }
+
+    // headers of older files are shorter, their missing fields read as zero
+    const auto *base = static_cast<const char *>(data);
+    file_header header{};
+    std::memcpy(&header, base, trace_layout::base_header_size);
+    if (header.header_size > trace_layout::base_header_size) {
+        std::memcpy(&header, base, std::min<size_t>({header.header_size, sizeof(header), size}));
+    }
+
+    const bool chunked = header.version_major == trace_layout::chunked_version_major &&
+                         header.encoding == static_cast<uint32_t>(trace_encoding::delta);
+    if (header.magic != trace_layout::magic || (header.version_major != trace_layout::version_major && !chunked) ||
+        header.header_size < trace_layout::base_header_size || header.column_size < sizeof(column) ||
+        (header.value_size != 4 && header.value_size != 8)) {
+        return;
+    }
+
+    const size_t columns_end = size_t{header.columns_offset} + size_t{header.num_columns} * header.column_size;
+    if (header.columns_offset < header.header_size || header.records_offset < columns_end ||
+        header.records_offset > size ||
+        header.record_size < sizeof(record_header) + size_t{header.num_columns} * header.value_size) {
+        return;
+    }
+
+    base_ = base;
+    size_ = size;
+    header_ = header;
+    columns_ = base + header.columns_offset;
+    records_ = base + header.records_offset;
+
+    if (!chunked) {
+        num_records_ = (size - header.records_offset) / header.record_size;
+        ec_ = {};
+        return;
+    }
+
+    encoding_ = trace_encoding::delta;
+    if (!read_index(size)) {
+        find_chunks(size);
+    }
+    ec_ = {};
+}
+
+bool trace_reader::read_index(size_t size) {
+    using trace_layout::chunk_header;
+    using trace_layout::index_entry;
+    using trace_layout::index_trailer;
+
+    if (size - header_.records_offset < sizeof(chunk_header) + sizeof(index_trailer)) {
+        return false;
+    }
+
+    index_trailer trailer{};
+    std::memcpy(&trailer, base_ + size - sizeof(trailer), sizeof(trailer));
+    const size_t index_size = size_t{trailer.num_entries} * sizeof(index_entry);
+    if (trailer.magic != trace_layout::index_magic || trailer.index_offset < header_.records_offset ||
+        trailer.index_offset + sizeof(chunk_header) + index_size + sizeof(trailer) != size) {
+        return false;
+    }
+
+    chunk_header index_header{};
+    std::memcpy(&index_header, base_ + trailer.index_offset, sizeof(index_header));
+    if (index_header.num_records != 0 || index_header.payload_size != index_size) {
+        return false;
+    }
+
+    // the entries must describe increasing chunks before the index
+    const char *entries = base_ + trailer.index_offset + sizeof(chunk_header);
+    uint64_t previous_offset = 0;
+    uint64_t previous_record = 0;
+    chunks_.resize(trailer.num_entries);
+    for (size_t i = 0; i != trailer.num_entries; ++i) {
+        index_entry entry{};
+        std::memcpy(&entry, entries + i * sizeof(entry), sizeof(entry));
+        if (entry.offset < header_.records_offset || entry.offset + sizeof(chunk_header) > trailer.index_offset ||
+            (i == 0 && entry.first_record != 0) ||
+            (i != 0 && (entry.offset <= previous_offset || entry.first_record <= previous_record))) {
+            chunks_.clear();
+            return false;
+        }
+        chunks_[i] = {static_cast<size_t>(entry.first_record), static_cast<size_t>(entry.offset)};
+        previous_offset = entry.offset;
+        previous_record = entry.first_record;
+    }
+
+    // the record count is given by the last chunk, which ends at the index
+    if (!chunks_.empty()) {
+        chunk_header last{};
+        std::memcpy(&last, base_ + chunks_.back().offset, sizeof(last));
+        if (chunks_.back().offset + sizeof(last) + last.payload_size != trailer.index_offset) {
+            chunks_.clear();
+            return false;
+        }
+        num_records_ = chunks_.back().first_record + last.num_records;
+    }
+
+    index_ = entries;
+    num_index_entries_ = trailer.num_entries;
+    decoded_.resize((trace_layout::num_header_fields + header_.num_columns) * max_chunk_records());
+    return true;
+}
+
+void trace_reader::find_chunks(size_t size) {
+    using trace_layout::chunk_header;
+
+    size_t offset = header_.records_offset;
+    while (size - offset >= sizeof(chunk_header)) {
+        chunk_header chunk_info{};
+        std::memcpy(&chunk_info, base_ + offset, sizeof(chunk_info));
+        if (size - offset - sizeof(chunk_info) < chunk_info.payload_size || chunk_info.num_records == 0) {
+            break;
+        }
+
+        chunks_.push_back({num_records_, offset});
+        num_records_ += chunk_info.num_records;
+        offset += sizeof(chunk_info) + chunk_info.payload_size;
+    }
+
+    decoded_.resize((trace_layout::num_header_fields + header_.num_columns) * max_chunk_records());
+}
+
+size_t trace_reader::max_chunk_records() const {
+    size_t result = 0;
+    for (size_t i = 0; i != chunks_.size(); ++i) {
+        const size_t end = i + 1 == chunks_.size() ? num_records_ : chunks_[i + 1].first_record;
+        result = std::max(result, end - chunks_[i].first_record);
+    }
+    return result;
+}
+
+size_t trace_reader::load_chunk(size_t index) const {
+    using trace_layout::chunk_header;
+
+    // chunks are searched from the cached one, as records are usually read in order
+    if (!cache_valid_ || index < chunks_[cached_chunk_].first_record ||
+        index - chunks_[cached_chunk_].first_record >= cached_records_) {
+        const auto next = std::upper_bound(chunks_.begin(), chunks_.end(), index,
+                                           [](size_t record, const chunk &c) { return record < c.first_record; });
+        const auto position = static_cast<size_t>(next - chunks_.begin()) - 1;
+        const auto &chunk = chunks_[position];
+        const size_t num_records =
+            (next == chunks_.end() ? num_records_ : next->first_record) - chunk.first_record;
+
+        // the index gives the chunk boundaries, the chunk header must agree
+        chunk_header chunk_info{};
+        std::memcpy(&chunk_info, base_ + chunk.offset, sizeof(chunk_info));
+        const auto *input = reinterpret_cast<const uint8_t *>(base_ + chunk.offset + sizeof(chunk_info));
+        const uint8_t *end = input + std::min<size_t>(chunk_info.payload_size, size_ - chunk.offset - sizeof(chunk_info));
+        if (chunk_info.num_records != num_records) {
+            input = nullptr;
+        }
+
+        const size_t num_fields = trace_layout::num_header_fields + header_.num_columns;
+        for (size_t field = 0; field != num_fields && input != nullptr; ++field) {
+            input = detail::column_codec::decode(input, end, num_records, decoded_.data() + field * num_records);
+        }
+        if (input == nullptr) {
+            std::fill(decoded_.begin(), decoded_.end(), 0);
+        }
+
+        cached_chunk_ = position;
+        cached_records_ = num_records;
+        cache_valid_ = true;
+    }
+
+    return index - chunks_[cached_chunk_].first_record;
+}
+
+trace_layout::record_header trace_reader::get_record(size_t index) const {
+    trace_layout::record_header header{};
+    if (encoding_ == trace_encoding::raw) {
+        std::memcpy(&header, records_ + index * header_.record_size, sizeof(header));
+        return header;
+    }
+
+    const size_t row = load_chunk(index);
+    const size_t stride = cached_records_;
+    header.sample_nr = decoded_[0 * stride + row];
+    header.timestamp_ns_begin = decoded_[1 * stride + row];
+    header.timestamp_ns_end = decoded_[2 * stride + row];
+    header.gpu_cycle = decoded_[3 * stride + row];
+    header.sc_cycle = decoded_[4 * stride + row];
+    header.flags = static_cast<uint32_t>(decoded_[5 * stride + row]);
+    return header;
+}
+
+size_t trace_reader::lower_bound(size_t first, size_t last, uint64_t timestamp_ns) const {
+    while (first != last) {
+        const size_t middle = first + (last - first) / 2;
+        if (get_record(middle).timestamp_ns_begin < timestamp_ns) {
+            first = middle + 1;
+        } else {
+            last = middle;
+        }
+    }
+    return first;
+}
+
+size_t trace_reader::find_record(uint64_t timestamp_ns) const {
+    if (ec_) {
+        return 0;
+    }
+    if (index_ == nullptr || num_index_entries_ == 0) {
+        return lower_bound(0, num_records_, timestamp_ns);
+    }
+
+    // the last chunk that starts before the timestamp holds the record, or
+    // the record is the first one of the next chunk
+    size_t first = 0;
+    size_t last = num_index_entries_;
+    while (first != last) {
+        const size_t middle = first + (last - first) / 2;
+        trace_layout::index_entry entry{};
+        std::memcpy(&entry, index_ + middle * sizeof(entry), sizeof(entry));
+        if (entry.timestamp_ns_begin < timestamp_ns) {
+            first = middle + 1;
+        } else {
+            last = middle;
+        }
+    }
+    if (first == 0) {
+        return 0;
+    }
+
+    const size_t begin = chunks_[first - 1].first_record;
+    const size_t end = first == chunks_.size() ? num_records_ : chunks_[first].first_record;
+    return lower_bound(begin, end, timestamp_ns);
+}
+
+uint64_t trace_reader::get_raw_value(size_t index, size_t column) const {
+    if (encoding_ == trace_encoding::delta) {
+        const size_t row = load_chunk(index);
+        return decoded_[(trace_layout::num_header_fields + column) * cached_records_ + row];
+    }
+
+    const char *value = records_ + index * header_.record_size + sizeof(trace_layout::record_header) +
+                        column * header_.value_size;
+    uint64_t raw{};
+    std::memcpy(&raw, value, header_.value_size);
+    return raw;
+}
+
+uint64_t trace_reader::get_value(size_t index, size_t column) const {
+    const uint64_t raw = get_raw_value(index, column);
+    const auto shift = get_column(column).shift;
+
+    if (header_.value_size == sizeof(uint64_t)) {
+        return raw << shift;
+    }
+    return static_cast<uint32_t>(raw << shift);
+}
+
+trace_file::trace_file(const std::string &path) {
+    const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    struct stat status {};
+    if (fd < 0 || ::fstat(fd, &status) != 0 || status.st_size <= 0) {
+        ec_ = make_error_code(errc::trace_read_failed);
+        if (fd >= 0) {
+            ::close(fd);
+        }
+        return;
+    }
+
+    size_ = static_cast<size_t>(status.st_size);
+    data_ = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (data_ == MAP_FAILED) {
+        data_ = nullptr;
+        ec_ = make_error_code(errc::trace_read_failed);
+        return;
+    }
+
+    reader_ = trace_reader(data_, size_);
+}
+
+trace_file::~trace_file() {
+    if (data_ != nullptr) {
+        ::munmap(data_, size_);
+    }
+}
+
+} // namespace hwcpipe
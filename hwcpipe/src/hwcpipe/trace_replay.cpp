@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <hwcpipe/error.hpp>
+#include <hwcpipe/trace_replay.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+
+namespace hwcpipe {
+
+namespace {
+// the replays that samplers can select, by device number
+std::mutex &registry_mutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+std::vector<trace_replay *> &registry() {
+    static std::vector<trace_replay *> replays;
+    return replays;
+}
+} // namespace
+
+trace_replay::trace_replay(const trace_reader &reader, int device_number)
+    : ec_(reader.get_error())
+    , reader_(reader)
+    , device_number_(device_number) {
+    if (ec_) {
+        return;
+    }
+
+    const auto &header = reader_.header();
+    device::hwcnt::block_extents::num_blocks_of_type_type num_blocks_of_type{};
+    std::copy(std::begin(header.num_blocks_of_type), std::end(header.num_blocks_of_type), num_blocks_of_type.begin());
+    block_extents_ = device::hwcnt::block_extents(num_blocks_of_type, header.counters_per_block,
+                                                  header.value_size == sizeof(uint64_t)
+                                                      ? device::hwcnt::sample_values_type::uint64
+                                                      : device::hwcnt::sample_values_type::uint32);
+
+    for (size_t i = 0; i != reader_.num_columns(); ++i) {
+        const auto &column = reader_.get_column(i);
+        if (column.block_type < recorded_.size() && column.offset < recorded_[column.block_type].size()) {
+            recorded_[column.block_type][column.offset] = true;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(registry_mutex());
+    auto &replays = registry();
+    const auto registered = std::find_if(replays.begin(), replays.end(), [device_number](const trace_replay *replay) {
+        return replay->device_number_ == device_number;
+    });
+    if (registered != replays.end()) {
+        ec_ = make_error_code(errc::trace_replay_in_use);
+        return;
+    }
+    replays.push_back(this);
+}
+
+trace_replay::~trace_replay() {
+    std::lock_guard<std::mutex> lock(registry_mutex());
+    auto &replays = registry();
+    replays.erase(std::remove(replays.begin(), replays.end(), this), replays.end());
+}
+
+std::error_code trace_replay::get_product_id(device::product_id &pid) const {
+    if (ec_) {
+        return ec_;
+    }
+
+    const auto result = device::product_id_from_raw_gpu_id(get_constants().gpu_id);
+    if (result.first) {
+        return result.first;
+    }
+    pid = result.second;
+    return {};
+}
+
+trace_replay *trace_replay::find(int device_number) {
+    std::lock_guard<std::mutex> lock(registry_mutex());
+    for (auto *replay : registry()) {
+        if (replay->device_number_ == device_number) {
+            return replay;
+        }
+    }
+    return nullptr;
+}
+
+namespace detail {
+namespace replay {
+
+reader::reader(trace_replay &replay, bool periodic)
+    : replay_(replay)
+    , periodic_(periodic) {
+    const auto &extents = replay_.get_block_extents();
+    const auto &trace = replay_.get_reader();
+    value_size_ = trace.header().value_size;
+
+    // every block of the GPU, each padded to whole 64-bit words
+    const size_t block_words = (extents.counters_per_block() * value_size_ + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+    values_.resize(extents.num_blocks() * block_words);
+
+    std::array<size_t, device::hwcnt::block_extents::num_block_types> first_block{};
+    for (size_t type = 0; type != device::hwcnt::block_extents::num_block_types; ++type) {
+        first_block[type] = blocks_.size();
+        const auto block_type = static_cast<device::hwcnt::block_type>(type);
+        for (uint8_t index = 0; index != extents.num_blocks_of_type(block_type); ++index) {
+            device::hwcnt::block_metadata block{};
+            block.type = block_type;
+            block.index = index;
+            block.values = values_.data() + blocks_.size() * block_words;
+            blocks_.push_back(block);
+        }
+    }
+
+    for (size_t i = 0; i != trace.num_columns(); ++i) {
+        const auto &column = trace.get_column(i);
+        if (column.block_type >= first_block.size() || column.offset >= extents.counters_per_block() ||
+            column.block_index >= extents.num_blocks_of_type(static_cast<device::hwcnt::block_type>(column.block_type))) {
+            continue;
+        }
+        const size_t block = first_block[column.block_type] + column.block_index;
+        destinations_.push_back({i, block * block_words * sizeof(uint64_t) + column.offset * value_size_});
+    }
+}
+
+std::error_code reader::get_sample(device::hwcnt::sample_metadata &metadata) {
+    if (!pending_ || replay_.at_end()) {
+        return make_error_code(std::errc::no_message_available);
+    }
+
+    const auto &trace = replay_.get_reader();
+    const size_t index = replay_.position();
+    const auto record = trace.get_record(index);
+    metadata = {};
+    metadata.flags.stretched = (record.flags & trace_layout::flag_stretched) != 0 ? 1 : 0;
+    metadata.flags.error = (record.flags & trace_layout::flag_error) != 0 ? 1 : 0;
+    metadata.sample_nr = record.sample_nr;
+    metadata.timestamp_ns_begin = record.timestamp_ns_begin;
+    metadata.timestamp_ns_end = record.timestamp_ns_end;
+    metadata.gpu_cycle = record.gpu_cycle;
+    metadata.sc_cycle = record.sc_cycle;
+
+    auto *values = reinterpret_cast<char *>(values_.data());
+    for (const auto &destination : destinations_) {
+        const uint64_t value = trace.get_raw_value(index, destination.column);
+        if (value_size_ == sizeof(uint64_t)) {
+            std::memcpy(values + destination.offset, &value, sizeof(value));
+        } else {
+            const auto narrow = static_cast<uint32_t>(value);
+            std::memcpy(values + destination.offset, &narrow, sizeof(narrow));
+        }
+    }
+    return {};
+}
+
+void reader::put_sample() {
+    replay_.advance();
+    if (!periodic_) {
+        pending_ = false;
+    }
+}
+
+bool is_recorded(const trace_replay &replay, const device::hwcnt::sampler::configuration *config,
+                 size_t config_len) {
+    if (!replay) {
+        return false;
+    }
+
+    const auto &extents = replay.get_block_extents();
+    for (size_t i = 0; i != config_len; ++i) {
+        const auto &block = config[i];
+        if (static_cast<size_t>(block.type) >= device::hwcnt::block_extents::num_block_types) {
+            return false;
+        }
+        // a GPU without the block type doesn't sample it
+        if (extents.num_blocks_of_type(block.type) == 0) {
+            continue;
+        }
+        if ((block.enable_map & ~replay.get_recorded_counters(block.type)).any()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace replay
+} // namespace detail
+} // namespace hwcpipe
@@ -0,0 +1,304 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/**
+ * @file
+ *
+ * Python bindings of the sampler, the GPU enumeration, the trace reader and
+ * the column evaluator. Sample values, per instance values and the columns
+ * of raw traces are returned as NumPy arrays that view the memory of the
+ * C++ objects, which they keep alive. The views are refreshed in place by
+ * the next sample, call copy() to keep a value.
+ */
+
+#include <hwcpipe/column_evaluator.hpp>
+#include <hwcpipe/counter_database.hpp>
+#include <hwcpipe/error.hpp>
+#include <hwcpipe/gpu.hpp>
+#include <hwcpipe/hwcpipe_counter.h>
+#include <hwcpipe/sampler.hpp>
+#include <hwcpipe/trace_recorder.hpp>
+
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace py = pybind11;
+
+using record_header = hwcpipe::trace_layout::record_header;
+
+namespace {
+
+/** Raises the error as a RuntimeError. */
+void check(const std::error_code &ec) {
+    if (ec) {
+        throw std::runtime_error(ec.message());
+    }
+}
+
+/** @return The counter of an identifier, e.g. "MaliGPUActiveCy". */
+hwcpipe_counter find_counter(const std::string &name) {
+    hwcpipe::counter_database database{};
+    hwcpipe_counter counter{};
+    check(database.find_counter(name.c_str(), counter));
+    return counter;
+}
+
+/**
+ * @return A read-only array of @p count values, @p stride bytes apart, that
+ * views memory owned by @p owner.
+ */
+template <typename value_t>
+py::array_t<value_t> view(const void *data, size_t count, size_t stride, py::handle owner) {
+    py::array_t<value_t> array({static_cast<py::ssize_t>(count)}, {static_cast<py::ssize_t>(stride)},
+                               static_cast<const value_t *>(data), owner);
+    array.attr("flags").attr("writeable") = false;
+    return array;
+}
+
+/** A manual or periodic sampler, and the values of its last sample. */
+class python_sampler {
+  public:
+    python_sampler(int device_number, const std::vector<std::string> &counters, uint64_t period_ns,
+                   bool per_instance_values)
+        : config_(hwcpipe::gpu(device_number)) {
+        for (const auto &name : counters) {
+            counters_.push_back(find_counter(name));
+            check(config_.add_counter(counters_.back()));
+        }
+        config_.set_sampling_period(period_ns);
+        config_.set_per_instance_values(per_instance_values);
+
+        sampler_.reset(new hwcpipe::sampler<>(config_));
+        if (!*sampler_) {
+            check(hwcpipe::make_error_code(hwcpipe::errc::backend_creation_failed));
+        }
+
+        std::error_code ec;
+        list_ = sampler_->make_read_list(counters_.data(), counters_.size(), ec);
+        check(ec);
+        values_.resize(counters_.size());
+    }
+
+    void start(uint64_t user_data) { check(sampler_->start_sampling(user_data)); }
+
+    void stop(uint64_t user_data) { check(sampler_->stop_sampling(user_data)); }
+
+    /** Takes a sample, and reads its values into the buffer viewed by values(). */
+    void sample_now(uint64_t user_data) {
+        check(sampler_->sample_now(user_data));
+        check(sampler_->get_counter_values(list_, values_.data(), values_.size()));
+    }
+
+    const std::vector<double> &values() const { return values_; }
+
+    const hwcpipe::sampler<> &get() const { return *sampler_; }
+
+    /** @return The instance values of a counter, valid until the next sample. */
+    std::pair<const uint64_t *, size_t> instance_values(const std::string &name) const {
+        const uint64_t *values{};
+        size_t num_instances{};
+        check(sampler_->get_counter_instance_values(find_counter(name), values, num_instances));
+        return {values, num_instances};
+    }
+
+  private:
+    hwcpipe::sampler_config config_;
+    std::vector<hwcpipe_counter> counters_{};
+    std::unique_ptr<hwcpipe::sampler<>> sampler_{};
+    hwcpipe::read_list list_{};
+    std::vector<double> values_{};
+};
+
+/** A mapped trace file. */
+class python_trace {
+  public:
+    explicit python_trace(const std::string &path)
+        : file_(path) {
+        check(file_.get_error());
+    }
+
+    const hwcpipe::trace_reader &reader() const { return file_.get_reader(); }
+
+  private:
+    hwcpipe::trace_file file_;
+};
+
+/**
+ * @return The record header field at @p offset of every record of a trace,
+ * in place for raw traces, decoded otherwise.
+ */
+py::array_t<uint64_t> record_field(py::object self, size_t offset) {
+    const auto &reader = self.cast<const python_trace &>().reader();
+    const char *records = reader.get_raw_records();
+    if (records != nullptr) {
+        return view<uint64_t>(records + offset, reader.num_records(), reader.header().record_size, self);
+    }
+
+    py::array_t<uint64_t> result(static_cast<py::ssize_t>(reader.num_records()));
+    auto out = result.mutable_unchecked<1>();
+    for (size_t i = 0; i != reader.num_records(); ++i) {
+        const auto record = reader.get_record(i);
+        uint64_t value{};
+        std::memcpy(&value, reinterpret_cast<const char *>(&record) + offset, sizeof(value));
+        out(static_cast<py::ssize_t>(i)) = value;
+    }
+    return result;
+}
+
+} // namespace
+
+PYBIND11_MODULE(pyhwcpipe, module) {
+    module.doc() = "Mali GPU hardware counters";
+
+    py::class_<hwcpipe::gpu>(module, "Gpu")
+        .def_property_readonly("device_number", &hwcpipe::gpu::get_device_number)
+        .def_property_readonly("product_id",
+                               [](const hwcpipe::gpu &gpu) { return static_cast<uint32_t>(gpu.get_product_id()); })
+        .def_property_readonly("num_shader_cores", &hwcpipe::gpu::num_shader_cores)
+        .def_property_readonly("num_execution_engines", &hwcpipe::gpu::num_execution_engines)
+        .def_property_readonly("bus_width", &hwcpipe::gpu::bus_width)
+        .def_property_readonly("valid", &hwcpipe::gpu::valid);
+
+    module.def(
+        "find_gpus",
+        []() {
+            std::vector<hwcpipe::gpu> gpus;
+            for (const auto &gpu : hwcpipe::find_gpus()) {
+                if (gpu) {
+                    gpus.push_back(gpu);
+                }
+            }
+            return gpus;
+        },
+        "Returns the GPUs that could be probed.");
+
+    py::class_<python_sampler>(module, "Sampler")
+        .def(py::init<int, const std::vector<std::string> &, uint64_t, bool>(), py::arg("device_number"),
+             py::arg("counters"), py::arg("period_ns") = 0, py::arg("per_instance_values") = false)
+        .def("start", &python_sampler::start, py::arg("user_data") = 0)
+        .def("stop", &python_sampler::stop, py::arg("user_data") = 0)
+        .def("sample_now", &python_sampler::sample_now, py::arg("user_data") = 0)
+        .def_property_readonly(
+            "values",
+            [](py::object self) {
+                const auto &values = self.cast<const python_sampler &>().values();
+                return view<double>(values.data(), values.size(), sizeof(double), self);
+            },
+            "The values of the last sample, in counter order, refreshed in place by sample_now().")
+        .def(
+            "instance_values",
+            [](py::object self, const std::string &counter) {
+                const auto values = self.cast<const python_sampler &>().instance_values(counter);
+                return view<uint64_t>(values.first, values.second, sizeof(uint64_t), self);
+            },
+            py::arg("counter"), "The values of a counter per block instance, e.g. per shader core.")
+        .def_property_readonly("timestamp_ns_begin",
+                               [](const python_sampler &s) { return s.get().get_sample_interval().timestamp_ns_begin; })
+        .def_property_readonly("timestamp_ns_end",
+                               [](const python_sampler &s) { return s.get().get_sample_interval().timestamp_ns_end; })
+        .def_property_readonly("gpu_cycles",
+                               [](const python_sampler &s) { return s.get().get_sample_interval().gpu_cycles; })
+        .def_property_readonly("user_data", [](const python_sampler &s) { return s.get().get_sample_user_data(); });
+
+    py::class_<python_trace>(module, "TraceFile")
+        .def(py::init<const std::string &>(), py::arg("path"))
+        .def_property_readonly("num_records", [](const python_trace &t) { return t.reader().num_records(); })
+        .def_property_readonly("num_columns", [](const python_trace &t) { return t.reader().num_columns(); })
+        .def_property_readonly("raw", [](const python_trace &t) { return t.reader().get_raw_records() != nullptr; })
+        .def(
+            "column_counter",
+            [](const python_trace &t, size_t column) { return t.reader().get_column(column).counter; },
+            py::arg("column"))
+        .def(
+            "column",
+            [](py::object self, size_t column) -> py::array {
+                const auto &reader = self.cast<const python_trace &>().reader();
+                if (column >= reader.num_columns()) {
+                    throw py::index_error("column out of range");
+                }
+
+                // raw columns without a shift are read in place
+                const auto &header = reader.header();
+                const char *records = reader.get_raw_records();
+                if (records != nullptr && reader.get_column(column).shift == 0) {
+                    const char *first = records + sizeof(record_header) +
+                                        column * header.value_size;
+                    if (header.value_size == sizeof(uint32_t)) {
+                        return view<uint32_t>(first, reader.num_records(), header.record_size, self);
+                    }
+                    return view<uint64_t>(first, reader.num_records(), header.record_size, self);
+                }
+
+                py::array_t<uint64_t> result(static_cast<py::ssize_t>(reader.num_records()));
+                auto out = result.mutable_unchecked<1>();
+                for (size_t i = 0; i != reader.num_records(); ++i) {
+                    out(static_cast<py::ssize_t>(i)) = reader.get_value(i, column);
+                }
+                return std::move(result);
+            },
+            py::arg("column"), "The values of a column, in place for raw traces.")
+        .def_property_readonly("timestamp_ns_begin",
+                               [](py::object self) {
+                                   return record_field(self, offsetof(record_header, timestamp_ns_begin));
+                               })
+        .def_property_readonly("timestamp_ns_end",
+                               [](py::object self) {
+                                   return record_field(self, offsetof(record_header, timestamp_ns_end));
+                               })
+        .def_property_readonly("gpu_cycles",
+                               [](py::object self) { return record_field(self, offsetof(record_header, gpu_cycle)); });
+
+    py::class_<hwcpipe::column_evaluator>(module, "ColumnEvaluator")
+        .def(py::init([](int device_number, const std::string &counter) {
+                 std::unique_ptr<hwcpipe::column_evaluator> evaluator(
+                     new hwcpipe::column_evaluator(hwcpipe::gpu(device_number), find_counter(counter)));
+                 if (!*evaluator) {
+                     throw std::runtime_error("The counter can't be evaluated on this GPU");
+                 }
+                 return evaluator;
+             }),
+             py::arg("device_number"), py::arg("counter"))
+        .def_property_readonly(
+            "inputs",
+            [](const hwcpipe::column_evaluator &evaluator) {
+                std::vector<uint32_t> inputs;
+                for (const auto input : evaluator.get_inputs()) {
+                    inputs.push_back(static_cast<uint32_t>(input));
+                }
+                return inputs;
+            },
+            "The hardware counters of the columns given to evaluate(), in order.")
+        .def(
+            "evaluate",
+            [](hwcpipe::column_evaluator &evaluator,
+               const std::vector<py::array_t<double, py::array::c_style | py::array::forcecast>> &columns) {
+                // contiguous float64 columns are read in place
+                const size_t count = columns.empty() ? 0 : static_cast<size_t>(columns[0].size());
+                std::vector<const double *> inputs;
+                for (const auto &column : columns) {
+                    if (static_cast<size_t>(column.size()) != count) {
+                        throw std::invalid_argument("The columns must have the same length");
+                    }
+                    inputs.push_back(column.data());
+                }
+
+                py::array_t<double> results(static_cast<py::ssize_t>(count));
+                check(evaluator.evaluate(inputs.data(), inputs.size(), count, results.mutable_data()));
+                return results;
+            },
+            py::arg("columns"), "Evaluates the counter over whole columns of samples at once.");
+}
@@ -0,0 +1,544 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2025 Arm Limited.
+#
+# SPDX-License-Identifier: MIT
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to
+# deal in the Software without restriction, including without limitation the
+# rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+# sell copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+# FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+# IN THE SOFTWARE.
+#
+'''
+This file is an exporter for the HWCPipe counter database blob, a binary file
+that hwcpipe::detail::counter_database can map at runtime instead of using the
+tables compiled into the library. The layout is described in
+hwcpipe/include/hwcpipe/detail/database_blob.hpp.
+
+Each product of the product info list gets the counters of its database key
+that HWCPipe exposes. Hardware counters are resolved in the hardware layout,
+and expressions are compiled to the postfix bytecode of the custom
+expressions. The counters of an equation that HWCPipe doesn't expose, such as
+MaliConfigCoreCount, are inlined.
+
+The exporter only needs the Python standard library, so it can run without
+the lgcpy dependencies.
+'''
+
+import argparse
+import pathlib
+import re
+import struct
+import sys
+import xml.etree.ElementTree as ET
+
+# The layout version, see database_blob_layout
+MAGIC = 0x44435748
+VERSION_MAJOR = 1
+VERSION_MINOR = 0
+
+# counter_definition::type
+TAG_HARDWARE = 1
+TAG_EXPRESSION = 2
+
+# device::hwcnt::block_type of each hardware layout block
+BLOCK_TYPES = {
+    'GPU Front-end': 0,
+    'Tiler': 1,
+    'Memory System': 2,
+    'Shader Core': 3,
+}
+
+# expression::opcode
+OP_INPUT = 0
+OP_LITERAL = 1
+OPERATORS = {'+': 2, '-': 3, '*': 4, '/': 5}
+OP_NEG = 6
+FUNCTIONS = {'min': 7, 'max': 8}
+OP_CONSTANT = 9
+
+# expression::device_constant
+CONSTANTS = {
+    'MALI_CONFIG_EXT_BUS_BYTE_SIZE': 0,
+    'MALI_CONFIG_SHADER_CORE_COUNT': 1,
+    'MALI_CONFIG_L2_CACHE_COUNT': 2,
+}
+
+# expression::max_stack_depth
+MAX_STACK_DEPTH = 32
+
+TOKEN = re.compile(r'\s*(?:(\d+(?:\.\d*)?(?:[eE][+-]?\d+)?)|(\w+)|(.))')
+
+
+class Unsupported(Exception):
+    '''
+    An equation that can't be exported, e.g. one that needs the sample
+    duration.
+    '''
+
+
+def tokenize(equation: str) -> list[str]:
+    '''
+    Split an equation into tokens.
+
+    Args:
+        equation: The equation.
+
+    Returns:
+        The tokens.
+    '''
+    tokens = []
+    for match in TOKEN.finditer(equation.strip()):
+        token = next(x for x in match.groups() if x is not None)
+        if not token.isspace():
+            tokens.append(token)
+    return tokens
+
+
+class Compiler:
+    '''
+    A recursive descent compiler of the equation grammar of
+    lgcpy/equationgrammar.lark to postfix bytecode.
+    '''
+
+    def __init__(self, resolve):
+        '''
+        Create a compiler.
+
+        Args:
+            resolve: Called with a counter name, returns the tokens of the
+                equation to inline, or None if the counter is an input.
+        '''
+        self.resolve = resolve
+        self.code = []
+        self.inputs = []
+        self.literals = []
+        self.tokens = []
+        self.position = 0
+
+    def compile(self, tokens: list[str]) -> None:
+        '''
+        Compile the tokens of an equation, appending to the bytecode.
+
+        Args:
+            tokens: The tokens.
+        '''
+        saved = (self.tokens, self.position)
+        self.tokens, self.position = tokens, 0
+        self.operation()
+        if self.position != len(self.tokens):
+            raise ValueError(f'Unexpected token "{self.peek()}"')
+        self.tokens, self.position = saved
+
+    def peek(self) -> str:
+        '''
+        Returns:
+            The next token, or an empty string at the end.
+        '''
+        if self.position < len(self.tokens):
+            return self.tokens[self.position]
+        return ''
+
+    def take(self, expected: str = None) -> str:
+        '''
+        Consume the next token.
+
+        Args:
+            expected: The token that must come next, if any.
+
+        Returns:
+            The token.
+        '''
+        token = self.peek()
+        if expected is not None and token != expected:
+            raise ValueError(f'Expected "{expected}", got "{token}"')
+        self.position += 1
+        return token
+
+    def operation(self) -> None:
+        '''
+        Compile an add rule.
+        '''
+        self.product()
+        while self.peek() in ('+', '-'):
+            operator = self.take()
+            self.product()
+            self.code.append((OPERATORS[operator], 0))
+
+    def product(self) -> None:
+        '''
+        Compile a mul rule.
+        '''
+        self.atom()
+        while self.peek() in ('*', '/'):
+            operator = self.take()
+            self.atom()
+            self.code.append((OPERATORS[operator], 0))
+
+    def atom(self) -> None:
+        '''
+        Compile an atom rule.
+        '''
+        token = self.take()
+        if token == '-':
+            self.atom()
+            self.code.append((OP_NEG, 0))
+        elif token == '(':
+            self.operation()
+            self.take(')')
+        elif token in FUNCTIONS:
+            self.take('(')
+            self.operation()
+            count = 1
+            while self.peek() == ',':
+                self.take()
+                self.operation()
+                count += 1
+            self.take(')')
+            self.code.append((FUNCTIONS[token], count))
+        elif token and token[0].isdigit():
+            self.literal(float(token))
+        elif token in CONSTANTS:
+            self.code.append((OP_CONSTANT, CONSTANTS[token]))
+        elif token.startswith('MALI_CONFIG_'):
+            raise Unsupported(token)
+        elif re.fullmatch(r'\w+', token):
+            self.name(token)
+        else:
+            raise ValueError(f'Unexpected token "{token}"')
+
+    def literal(self, value: float) -> None:
+        '''
+        Compile a literal, sharing the literal table of the blob.
+
+        Args:
+            value: The literal.
+        '''
+        if value not in self.literals:
+            self.literals.append(value)
+        self.code.append((OP_LITERAL, self.literals.index(value)))
+
+    def name(self, name: str) -> None:
+        '''
+        Compile a counter, as an input or inlined.
+
+        Args:
+            name: The counter name.
+        '''
+        tokens = self.resolve(name)
+        if tokens is not None:
+            self.take_inlined(tokens)
+            return
+        if name not in self.inputs:
+            self.inputs.append(name)
+        self.code.append((OP_INPUT, self.inputs.index(name)))
+
+    def take_inlined(self, tokens: list[str]) -> None:
+        '''
+        Compile an inlined equation in parentheses.
+
+        Args:
+            tokens: The tokens of the equation.
+        '''
+        self.compile(['('] + tokens + [')'])
+
+
+def max_depth(code: list[tuple[int, int]]) -> int:
+    '''
+    Args:
+        code: The bytecode.
+
+    Returns:
+        The stack depth the bytecode needs.
+    '''
+    depth = 0
+    result = 0
+    for op, operand in code:
+        if op in (OP_INPUT, OP_LITERAL, OP_CONSTANT):
+            depth += 1
+        elif op == OP_NEG:
+            pass
+        elif op in FUNCTIONS.values():
+            depth -= operand - 1
+        else:
+            depth -= 1
+        result = max(result, depth)
+    return result
+
+
+def load_hwcpipe_counters(header: pathlib.Path) -> dict[str, int]:
+    '''
+    Load the counters that HWCPipe exposes.
+
+    Args:
+        header: The hwcpipe_counter.h header.
+
+    Returns:
+        The hwcpipe_counter value of each counter name.
+    '''
+    text = header.read_text(encoding='utf-8')
+    names = re.findall(r'^\s+(Mali\w+),?\s*$', text, re.MULTILINE)
+    return {name: index for index, name in enumerate(names)}
+
+
+def load_products(database: pathlib.Path) -> list[tuple[int, str]]:
+    '''
+    Load the products.
+
+    Args:
+        database: The database directory.
+
+    Returns:
+        The Id and database key of each product.
+    '''
+    root = ET.parse(database / 'Mali-ProductInfo.xml').getroot()
+    products = []
+    for info in root.iter('ProductInfo'):
+        key = info.findtext('DatabaseKey').strip()
+        for product_id in info.iter('Id'):
+            products.append((int(product_id.text.strip(), 16), key))
+    return sorted(products)
+
+
+def load_layout(database: pathlib.Path, key: str) -> dict[str, tuple]:
+    '''
+    Load the hardware layout of a database key.
+
+    Args:
+        database: The database directory.
+        key: The database key.
+
+    Returns:
+        The block type, index and shift of each source counter name.
+    '''
+    path = database / 'hardwarelayout' / f'{key}.xml'
+    if not path.exists():
+        return {}
+
+    layout = {}
+    root = ET.parse(path).getroot()
+    for block in root.iter('CounterBlock'):
+        block_type = BLOCK_TYPES[block.get('type')]
+        for counter in block.iter('Counter'):
+            layout[counter.get('name')] = (
+                block_type, int(counter.get('index')),
+                int(counter.get('shift', '0')))
+    return layout
+
+
+def load_counters(database: pathlib.Path) -> dict[str, dict[str, tuple]]:
+    '''
+    Load the counters of each database key.
+
+    Args:
+        database: The database directory.
+
+    Returns:
+        The source names and the equation of each counter, by database key
+        and machine name.
+    '''
+    counters = {}
+    for path in sorted((database / 'counterinfo').glob('*.xml')):
+        root = ET.parse(path).getroot()
+        for info in root.iter('CounterInfo'):
+            name = info.findtext('MachineName').strip()
+            sources = [x.strip() for x in (info.findtext('SourceName'),
+                                           info.findtext('SourceAlias'))
+                       if x]
+            equation = (info.findtext('Equation') or '').strip()
+            for gpu in info.iter('GPU'):
+                counters.setdefault(gpu.text.strip(), {})[name] = \
+                    (sources, equation)
+    return counters
+
+
+def build_product(counters: dict[str, tuple],
+                  layout: dict[str, tuple],
+                  known: dict[str, int],
+                  literals: list[float]) -> list[tuple]:
+    '''
+    Build the records of a database key.
+
+    Args:
+        counters: The counters of the database key.
+        layout: The hardware layout of the database key.
+        known: The counters that HWCPipe exposes.
+        literals: The literal table, extended with the new literals.
+
+    Returns:
+        The records, sorted by counter, as (counter, hardware address) or
+        (counter, dependency names, bytecode) tuples.
+    '''
+    def resolve(name):
+        if name in known:
+            return None
+        if name not in counters or not counters[name][1]:
+            raise Unsupported(name)
+        return tokenize(counters[name][1])
+
+    hardware = {}
+    expressions = {}
+    for name, (sources, equation) in counters.items():
+        if name not in known:
+            continue
+        address = next((layout[x] for x in sources if x in layout), None)
+        if address is not None:
+            hardware[name] = address
+            continue
+        if not equation:
+            continue
+        compiler = Compiler(resolve)
+        compiler.literals = literals
+        try:
+            compiler.compile(tokenize(equation))
+        except Unsupported:
+            continue
+        if max_depth(compiler.code) > MAX_STACK_DEPTH:
+            continue
+        expressions[name] = (compiler.inputs, compiler.code)
+
+    # drop the expressions whose dependencies the GPU doesn't have
+    changed = True
+    while changed:
+        changed = False
+        for name, (inputs, _) in list(expressions.items()):
+            if any(x not in hardware and x not in expressions
+                   for x in inputs):
+                del expressions[name]
+                changed = True
+
+    records = [(known[x], y) for x, y in hardware.items()]
+    records += [(known[x], [known[y] for y in inputs], code)
+                for x, (inputs, code) in expressions.items()]
+    return sorted(records, key=lambda x: x[0])
+
+
+def generate(products: list[tuple[int, list[tuple]]],
+             literals: list[float]) -> bytes:
+    '''
+    Generate the blob.
+
+    Args:
+        products: The Id and records of each product, sorted by Id.
+        literals: The literal table.
+
+    Returns:
+        The blob.
+    '''
+    product_entries = bytearray()
+    record_entries = bytearray()
+    instructions = bytearray()
+    dependencies = bytearray()
+
+    num_records = 0
+    num_instructions = 0
+    num_dependencies = 0
+    shared = {}
+    for product_id, records in products:
+        # products with the same database key share their records
+        key = id(records)
+        if key not in shared:
+            shared[key] = num_records
+            for record in records:
+                if len(record) == 2:
+                    block_type, index, shift = record[1]
+                    record_entries += struct.pack(
+                        '<IBBHBBHIII', record[0], TAG_HARDWARE, shift, index,
+                        block_type, 0, 0, 0, 0, 0)
+                else:
+                    _, inputs, code = record
+                    record_entries += struct.pack(
+                        '<IBBHBBHIII', record[0], TAG_EXPRESSION, 0, 0, 0,
+                        len(inputs), len(code), num_dependencies,
+                        num_instructions, 0)
+                    for counter in inputs:
+                        dependencies += struct.pack('<i', counter)
+                    for op, operand in code:
+                        instructions += struct.pack('<BxxxI', op, operand)
+                    num_dependencies += len(inputs)
+                    num_instructions += len(code)
+            num_records += len(records)
+        product_entries += struct.pack('<IIII', product_id, shared[key],
+                                       len(records), 0)
+
+    literal_table = b''.join(struct.pack('<d', x) for x in literals)
+    size = (32 + len(literal_table) + len(product_entries) +
+            len(record_entries) + len(instructions) + len(dependencies))
+    header = struct.pack('<IHHIIIIII', MAGIC, VERSION_MAJOR, VERSION_MINOR,
+                         size, len(products), num_records, num_instructions,
+                         len(literals), num_dependencies)
+    return (header + literal_table + bytes(product_entries) +
+            bytes(record_entries) + bytes(instructions) + bytes(dependencies))
+
+
+def parse_cli() -> argparse.Namespace:
+    '''
+    Parse the command line.
+
+    Returns:
+        The parsed arguments.
+    '''
+    root = pathlib.Path(__file__).parent
+
+    parser = argparse.ArgumentParser()
+    parser.add_argument(
+        '--database', type=pathlib.Path, default=root / 'database',
+        help='the specification database directory')
+    parser.add_argument(
+        '--header', type=pathlib.Path,
+        default=root.parent / 'hwcpipe' / 'include' / 'hwcpipe' /
+        'hwcpipe_counter.h',
+        help='the hwcpipe_counter.h header')
+    parser.add_argument(
+        '--output', type=pathlib.Path, default='hwcpipe_counters.hwcdb',
+        help='the blob to generate')
+
+    return parser.parse_args()
+
+
+def main() -> int:
+    '''
+    The main function.
+
+    Returns:
+        The application exit code.
+    '''
+    args = parse_cli()
+
+    known = load_hwcpipe_counters(args.header)
+    counters = load_counters(args.database)
+
+    literals = []
+    by_key = {}
+    products = []
+    for product_id, key in load_products(args.database):
+        if key not in by_key:
+            try:
+                by_key[key] = build_product(
+                    counters.get(key, {}), load_layout(args.database, key),
+                    known, literals)
+            except ValueError as error:
+                print(f'ERROR: {key}: {error}')
+                return 1
+        if by_key[key]:
+            products.append((product_id, by_key[key]))
+
+    args.output.write_bytes(generate(products, literals))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
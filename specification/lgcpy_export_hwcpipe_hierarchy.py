@@ -0,0 +1,184 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2025 Arm Limited.
+#
+# SPDX-License-Identifier: MIT
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to
+# deal in the Software without restriction, including without limitation the
+# rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+# sell copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+# FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+# IN THE SOFTWARE.
+#
+'''
+This file is an exporter for the HWCPipe counter hierarchy. The hierarchy is
+the semantic layout of the specification: sections of semantic groups, each a
+list of counters. It is exported as flat tables of the sections, groups and
+counters that HWCPipe exposes, in layout order.
+
+The exporter only needs the Python standard library and PyYAML, so it can run
+without the lgcpy dependencies.
+'''
+
+import argparse
+import pathlib
+import sys
+
+import yaml
+
+from lgcpy_export_hwcpipe_presets import (
+    get_preset_counters, load_counters, load_hwcpipe_counters, load_layout)
+
+HEADER = '''/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+// Generated by specification/lgcpy_export_hwcpipe_hierarchy.py, do not edit.
+
+#include "hwcpipe/counter_hierarchy.hpp"
+
+namespace hwcpipe {
+
+namespace {
+'''
+
+FOOTER = '''} // namespace hwcpipe
+'''
+
+
+def load_sections(database: pathlib.Path) -> list[tuple[str, list[str]]]:
+    '''
+    Load the sections of the semantic layout.
+
+    Args:
+        database: The database directory.
+
+    Returns:
+        The name and the group names of each section, in layout order.
+    '''
+    with open(database / 'Mali-SemanticLayout.yaml', encoding='utf-8') as handle:
+        layout = yaml.safe_load(handle)
+
+    sections = []
+    for section in layout:
+        for name, groups in section.items():
+            sections.append((name, [list(x.keys())[0] for x in groups]))
+    return sections
+
+
+def generate(hierarchy: list[tuple[str, list[tuple[str, list[str]]]]]) -> str:
+    '''
+    Generate the hierarchy tables.
+
+    Args:
+        hierarchy: The groups of each section, and the counters of each group.
+
+    Returns:
+        The C++ source.
+    '''
+    sections = []
+    groups = []
+    counters = []
+    for section, section_groups in hierarchy:
+        sections.append(f'    {{"{section}", {len(groups)}, '
+                        f'{len(section_groups)}}},')
+        for group, group_counters in section_groups:
+            groups.append(f'    {{"{group}", {len(sections) - 1}, '
+                          f'{len(counters)}, {len(group_counters)}}},')
+            counters.extend(f'    hwcpipe_counter::{x},'
+                            for x in group_counters)
+
+    lines = [HEADER]
+    lines.append('constexpr counter_section sections[] = {')
+    lines.extend(sections)
+    lines.append('};\n')
+    lines.append('constexpr counter_group groups[] = {')
+    lines.extend(groups)
+    lines.append('};\n')
+    lines.append('constexpr hwcpipe_counter counters[] = {')
+    lines.extend(counters)
+    lines.append('};\n')
+    lines.append('} // namespace\n')
+
+    lines.append('const counter_hierarchy &get_counter_hierarchy() {')
+    lines.append('    static const counter_hierarchy hierarchy{')
+    lines.append('        sections, sizeof(sections) / sizeof(sections[0]),')
+    lines.append('        groups,   sizeof(groups) / sizeof(groups[0]),')
+    lines.append('        counters, sizeof(counters) / sizeof(counters[0])};')
+    lines.append('    return hierarchy;')
+    lines.append('}\n')
+    lines.append(FOOTER)
+    return '\n'.join(lines)
+
+
+def parse_cli() -> argparse.Namespace:
+    '''
+    Parse the command line.
+
+    Returns:
+        The parsed arguments.
+    '''
+    root = pathlib.Path(__file__).parent
+
+    parser = argparse.ArgumentParser()
+    parser.add_argument(
+        '--database', type=pathlib.Path, default=root / 'database',
+        help='the specification database directory')
+    parser.add_argument(
+        '--header', type=pathlib.Path,
+        default=root.parent / 'hwcpipe' / 'include' / 'hwcpipe' /
+        'hwcpipe_counter.h',
+        help='the hwcpipe_counter.h header')
+    parser.add_argument(
+        '--output', type=pathlib.Path,
+        default=root.parent / 'hwcpipe' / 'src' / 'hwcpipe' /
+        'counter_hierarchy_tables.cpp',
+        help='the source file to generate')
+
+    return parser.parse_args()
+
+
+def main() -> int:
+    '''
+    The main function.
+
+    Returns:
+        The application exit code.
+    '''
+    args = parse_cli()
+
+    layout = load_layout(args.database)
+    counters = load_counters(args.database)
+    known = load_hwcpipe_counters(args.header)
+
+    # the groups and sections without any HWCPipe counter are left out
+    hierarchy = []
+    for section, group_names in load_sections(args.database):
+        groups = []
+        for group in group_names:
+            members = get_preset_counters([group], layout, counters, known)
+            if members:
+                groups.append((group, members))
+        if groups:
+            hierarchy.append((section, groups))
+
+    args.output.write_text(generate(hierarchy), encoding='utf-8')
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
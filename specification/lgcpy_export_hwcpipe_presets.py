@@ -0,0 +1,288 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2025 Arm Limited.
+#
+# SPDX-License-Identifier: MIT
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to
+# deal in the Software without restriction, including without limitation the
+# rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+# sell copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+# FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+# IN THE SOFTWARE.
+#
+'''
+This file is an exporter for the HWCPipe counter presets. A preset is a named
+list of semantic counter groups, and it is exported as the list of counters of
+these groups, in the order of the semantic layout.
+
+The exporter only needs the Python standard library and PyYAML, so it can run
+without the lgcpy dependencies.
+'''
+
+import argparse
+import pathlib
+import re
+import sys
+import xml.etree.ElementTree as ET
+
+import yaml
+
+# Presets, as lists of semantic group names
+PRESETS = {
+    'frame_overview': [
+        'GPU Cycles',
+        'GPU Utilization',
+        'Shader Core Utilization',
+        'External Bus Bandwidth',
+    ],
+    'memory_bandwidth': [
+        'External Bus Accesses',
+        'External Bus Bytes',
+        'External Bus Bandwidth',
+        'External Bus Stall Rate',
+        'L2 Cache Requests',
+        'L2 Cache Miss Rate',
+        'Shader Core L2 Read Bytes',
+        'Shader Core L2 Write Bytes',
+        'Shader Core External Read Bytes',
+    ],
+    'shader_alu': [
+        'Shader Core Unit Utilization',
+        'ALU Cycles',
+        'ALU Instructions',
+        'ALU Utilization',
+        'ALU Issues',
+    ],
+    'bottleneck': [
+        'GPU Utilization',
+        'Shader Core Utilization',
+        'External Bus Stall Rate',
+    ],
+}
+
+HEADER = '''/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+// Generated by specification/lgcpy_export_hwcpipe_presets.py, do not edit.
+
+#include "hwcpipe/counter_preset.hpp"
+
+namespace hwcpipe {
+namespace detail {
+
+namespace {
+'''
+
+FOOTER = '''} // namespace detail
+} // namespace hwcpipe
+'''
+
+
+def load_group_names(database: pathlib.Path) -> list[str]:
+    '''
+    Load the semantic group names.
+
+    Args:
+        database: The database directory.
+
+    Returns:
+        The group names.
+    '''
+    root = ET.parse(database / 'Mali-SemanticGroupInfo.xml').getroot()
+    return [x.text.strip() for x in root.iter('GroupName')]
+
+
+def load_layout(database: pathlib.Path) -> dict[str, list[str]]:
+    '''
+    Load the semantic layout.
+
+    Args:
+        database: The database directory.
+
+    Returns:
+        The counter human names of each group, in layout order.
+    '''
+    with open(database / 'Mali-SemanticLayout.yaml', encoding='utf-8') as handle:
+        sections = yaml.safe_load(handle)
+
+    layout = {}
+    for section in sections:
+        for groups in section.values():
+            for group in groups:
+                for name, series in group.items():
+                    layout[name] = series or []
+    return layout
+
+
+def load_counters(database: pathlib.Path) -> list[tuple[str, str, str]]:
+    '''
+    Load the counters that belong to a semantic group.
+
+    Args:
+        database: The database directory.
+
+    Returns:
+        The group name, group human name and machine name of each counter.
+    '''
+    counters = []
+    for path in sorted((database / 'counterinfo').glob('*.xml')):
+        root = ET.parse(path).getroot()
+        for info in root.iter('CounterInfo'):
+            group = info.findtext('GroupName')
+            if not group:
+                continue
+            counters.append((group.strip(),
+                             (info.findtext('GroupHumanName') or '').strip(),
+                             info.findtext('MachineName').strip()))
+    return counters
+
+
+def load_hwcpipe_counters(header: pathlib.Path) -> set[str]:
+    '''
+    Load the counters that HWCPipe exposes.
+
+    Args:
+        header: The hwcpipe_counter.h header.
+
+    Returns:
+        The counter names.
+    '''
+    text = header.read_text(encoding='utf-8')
+    return set(re.findall(r'^\s+(Mali\w+),', text, re.MULTILINE))
+
+
+def get_preset_counters(groups: list[str],
+                        layout: dict[str, list[str]],
+                        counters: list[tuple[str, str, str]],
+                        known: set[str]) -> list[str]:
+    '''
+    Get the counters of a preset.
+
+    Args:
+        groups: The semantic groups of the preset.
+        layout: The semantic layout.
+        counters: The counters of the database.
+        known: The counters that HWCPipe exposes.
+
+    Returns:
+        The machine names of the counters, in layout order.
+    '''
+    result = []
+    for group in groups:
+        order = layout.get(group, [])
+
+        def position(counter, order=order):
+            name = counter[1]
+            return order.index(name) if name in order else len(order)
+
+        members = [x for x in counters if x[0] == group]
+        for counter in sorted(members, key=position):
+            if counter[2] in known and counter[2] not in result:
+                result.append(counter[2])
+    return result
+
+
+def generate(presets: dict[str, list[str]]) -> str:
+    '''
+    Generate the preset tables.
+
+    Args:
+        presets: The counters of each preset.
+
+    Returns:
+        The C++ source.
+    '''
+    lines = [HEADER]
+    for name, counters in presets.items():
+        lines.append(f'constexpr hwcpipe_counter {name}_counters[] = {{')
+        for counter in counters:
+            lines.append(f'    hwcpipe_counter::{counter},')
+        lines.append('};\n')
+    lines.append('} // namespace\n')
+
+    lines.append('counter_span get_preset_counters(counter_preset preset) {')
+    lines.append('    switch (preset) {')
+    for name in presets:
+        lines.append(f'    case counter_preset::{name}:')
+        lines.append(f'        return {{{name}_counters, '
+                     f'sizeof({name}_counters) / sizeof({name}_counters[0])}};')
+    lines.append('    default:')
+    lines.append('        return {nullptr, 0};')
+    lines.append('    }')
+    lines.append('}\n')
+    lines.append(FOOTER)
+    return '\n'.join(lines)
+
+
+def parse_cli() -> argparse.Namespace:
+    '''
+    Parse the command line.
+
+    Returns:
+        The parsed arguments.
+    '''
+    root = pathlib.Path(__file__).parent
+
+    parser = argparse.ArgumentParser()
+    parser.add_argument(
+        '--database', type=pathlib.Path, default=root / 'database',
+        help='the specification database directory')
+    parser.add_argument(
+        '--header', type=pathlib.Path,
+        default=root.parent / 'hwcpipe' / 'include' / 'hwcpipe' /
+        'hwcpipe_counter.h',
+        help='the hwcpipe_counter.h header')
+    parser.add_argument(
+        '--output', type=pathlib.Path,
+        default=root.parent / 'hwcpipe' / 'src' / 'hwcpipe' /
+        'counter_preset_tables.cpp',
+        help='the source file to generate')
+
+    return parser.parse_args()
+
+
+def main() -> int:
+    '''
+    The main function.
+
+    Returns:
+        The application exit code.
+    '''
+    args = parse_cli()
+
+    group_names = load_group_names(args.database)
+    for groups in PRESETS.values():
+        for group in groups:
+            if group not in group_names:
+                print(f'ERROR: Unknown semantic group "{group}"')
+                return 1
+
+    layout = load_layout(args.database)
+    counters = load_counters(args.database)
+    known = load_hwcpipe_counters(args.header)
+
+    presets = {}
+    for name, groups in PRESETS.items():
+        presets[name] = get_preset_counters(groups, layout, counters, known)
+
+    args.output.write_text(generate(presets), encoding='utf-8')
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
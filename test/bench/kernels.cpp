@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <catch2/catch.hpp>
+
+#include <hwcpipe/detail/kernel_dispatch.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace hwcpipe {
+
+namespace {
+/** The values of a 32 core GPU, 64 counters per block. */
+constexpr size_t bench_values = 32 * 64;
+} // namespace
+
+TEST_CASE("bench__decode_kernels") {
+    const auto &features = detail::get_cpu_features();
+    WARN("selected " << detail::select_decode_kernels().name << " kernels, cpu: neon " << features.neon
+                     << ", dotprod " << features.dotprod << ", sve2 " << features.sve2 << ", sse2 "
+                     << features.sse2 << ", avx2 " << features.avx2);
+
+    std::vector<uint32_t> values_32(bench_values, 0x12345678U);
+    std::vector<uint64_t> values_64(bench_values, 0x123456789ULL);
+    std::vector<uint64_t> totals(bench_values);
+
+    // every variant the CPU supports, to compare them on the same machine
+    for (size_t i = 0; i != detail::num_kernel_isas; ++i) {
+        const auto *kernels = detail::find_decode_kernels(static_cast<detail::kernel_isa>(i));
+        if (kernels == nullptr) {
+            continue;
+        }
+        const std::string name = kernels->name;
+
+        BENCHMARK("reduce 32bit " + name) {
+            kernels->reduce(values_32.data(), values_32.size(), totals.data());
+            return totals[0];
+        };
+        BENCHMARK("reduce 64bit " + name) {
+            kernels->reduce(values_64.data(), values_64.size(), totals.data());
+            return totals[0];
+        };
+    }
+}
+
+} // namespace hwcpipe
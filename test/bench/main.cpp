@@ -0,0 +1,7 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch.hpp>
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hwcpipe/hwcpipe_counter.h"
+
+#include <catch2/catch.hpp>
+
+#include <hwcpipe/arrow_exporter.hpp>
+#include <hwcpipe/detail/counter_database.hpp>
+#include <hwcpipe/gpu_simulator.hpp>
+#include <hwcpipe/perfetto_writer.hpp>
+#include <hwcpipe/sample_history.hpp>
+#include <hwcpipe/sampler.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <system_error>
+#include <vector>
+
+namespace hwcpipe {
+
+namespace {
+
+using simulated_sampler = sampler<gpu_simulator_policy>;
+
+/*
+ * Memory budgets, in bytes. They are about twice the footprint measured when
+ * they were set, so that a change that doubles the memory of a component fails
+ * the benchmark. Raise a budget deliberately, with the footprint the change
+ * measured, rather than to make a failure go away.
+ */
+constexpr size_t database_budget = 320 * 1024;
+constexpr size_t config_budget = 40 * 1024;
+constexpr size_t sampler_budget = 96 * 1024;
+constexpr size_t history_budget = 3 * 1024 * 1024;
+constexpr size_t exporter_budget = 4 * 1024 * 1024;
+
+} // namespace
+
+TEST_CASE("bench__memory_footprint") {
+    gpu_simulator_config sim_config{};
+    sim_config.num_shader_cores = static_cast<uint8_t>(GENERATE(4, 32));
+    gpu_simulator simulator(sim_config);
+    REQUIRE(simulator);
+
+    device::product_id pid{};
+    REQUIRE(!simulator.get_product_id(pid));
+    sampler_config config(pid, simulator.get_device_number());
+    detail::counter_database db{};
+    std::vector<hwcpipe_counter> hardware;
+    std::vector<hwcpipe_counter> derived;
+    for (const auto counter : db.get_counters_for_gpu(pid)) {
+        if (config.add_counter(counter)) {
+            continue;
+        }
+        std::error_code ec;
+        const auto tag = db.get_counter_def(pid, counter, ec).tag;
+        (tag == detail::counter_definition::type::hardware ? hardware : derived).push_back(counter);
+    }
+    config.set_expression_evaluation(sampler_config::expression_evaluation::eager);
+
+    simulated_sampler test_sampler(config);
+    REQUIRE(test_sampler);
+    const auto footprint = test_sampler.get_memory_footprint();
+
+    // a second of samples at 1 kHz, and a batch of as many
+    sample_history history(1000, hardware.size());
+    arrow_exporter exporter(hardware.data(), hardware.size(), derived.data(), derived.size(), 1000);
+    std::vector<hwcpipe_counter> all_counters(hardware);
+    all_counters.insert(all_counters.end(), derived.begin(), derived.end());
+    perfetto_writer writer(all_counters.data(), all_counters.size(), perfetto_writer_config{});
+
+    const size_t database = detail::counter_database::get_memory_footprint();
+    WARN(+sim_config.num_shader_cores << " cores, " << hardware.size() << " hardware and " << derived.size()
+                                      << " derived counters: database " << database << " B, config "
+                                      << config.get_memory_footprint() << " B, sampler " << footprint.object
+                                      << " + " << footprint.sample_buffers << " buffers + " << footprint.index_maps
+                                      << " maps + " << footprint.kernel_mapping << " mapped B, history "
+                                      << history.get_memory_footprint() << " B, arrow "
+                                      << exporter.get_memory_footprint() << " B, perfetto "
+                                      << writer.get_memory_footprint() << " B");
+
+    CHECK(database <= database_budget);
+    CHECK(config.get_memory_footprint() <= config_budget);
+    CHECK(footprint.total() <= sampler_budget);
+    CHECK(history.get_memory_footprint() <= history_budget);
+    CHECK(exporter.get_memory_footprint() + writer.get_memory_footprint() <= exporter_budget);
+}
+
+} // namespace hwcpipe
@@ -0,0 +1,253 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "device/product_id.hpp"
+#include "hwcpipe/hwcpipe_counter.h"
+#include "hwcpipe/mock/backend_manual_sampler.hpp"
+#include "hwcpipe/mock/backend_periodic_sampler.hpp"
+#include "hwcpipe/mock/backend_sample.hpp"
+#include "hwcpipe/mock/handle.hpp"
+#include "hwcpipe/mock/instance.hpp"
+#include "hwcpipe/mock/mock_helper.h"
+
+#include <catch2/catch.hpp>
+
+#include <device/hwcnt/sampler/mapped_memory.hpp>
+#include <device/syscall/iface.hpp>
+#include <hwcpipe/detail/counter_database.hpp>
+#include <hwcpipe/sampler.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <unistd.h>
+
+namespace hwcpipe {
+
+namespace {
+using namespace hwcpipe::mock;
+
+constexpr device::product_id bench_gpu = device::product_id::g31;
+
+/**
+ * Sample that hands out blocks prepared up front, so that the benchmarks
+ * measure the sampler rather than the copies made by the shared mock.
+ */
+class bench_sample {
+  public:
+    bench_sample(reader_mock &reader, std::error_code &ec) {
+        if (!reader.is_valid()) {
+            ec = std::make_error_code(std::errc::invalid_argument);
+        }
+    }
+
+    sample_metadata get_metadata() const { return {}; }
+    const std::vector<block_metadata> &blocks() const { return sample_blocks; }
+
+    static std::vector<block_metadata> sample_blocks;
+};
+std::vector<block_metadata> bench_sample::sample_blocks{};
+
+struct bench_mock_policy {
+    using handle_type = hwcpipe::mock::handle_mock;
+    using instance_type = hwcpipe::mock::instance_mock;
+    using sampler_type = hwcpipe::mock::backend_manual_sampler_mock;
+    using periodic_sampler_type = hwcpipe::mock::backend_periodic_sampler_mock;
+    using sample_type = bench_sample;
+};
+
+using sampler_t = hwcpipe::sampler<bench_mock_policy>;
+
+/**
+ * Block values of a mocked GPU: one front-end, tiler and memory block, and
+ * @p num_cores shader core blocks, in 32- or 64-bit format.
+ */
+class mock_gpu {
+  public:
+    mock_gpu(size_t num_cores, bool values_64bit) {
+        block_extents_mock::num_blocks() = static_cast<uint8_t>(num_cores);
+        block_extents_mock::values_type_default_return_value =
+            values_64bit ? sample_values_type::uint64 : sample_values_type::uint32;
+
+        const size_t value_size = values_64bit ? sizeof(uint64_t) : sizeof(uint32_t);
+        const size_t block_size = block_extents_mock::num_counters_per_block() * value_size / sizeof(uint64_t);
+        values_.resize((3 + num_cores) * block_size);
+        for (size_t i = 0; i != values_.size(); ++i) {
+            values_[i] = i;
+        }
+
+        auto &blocks = bench_sample::sample_blocks;
+        blocks.clear();
+        const uint64_t *values = values_.data();
+        for (const auto type : {hwcnt::block_type::fe, hwcnt::block_type::tiler, hwcnt::block_type::memory}) {
+            blocks.push_back({type, values});
+            values += block_size;
+        }
+        for (size_t core = 0; core != num_cores; ++core) {
+            blocks.push_back({hwcnt::block_type::core, values, static_cast<uint8_t>(core)});
+            values += block_size;
+        }
+    }
+
+    ~mock_gpu() { bench_sample::sample_blocks.clear(); }
+
+    mock_gpu(const mock_gpu &) = delete;
+    mock_gpu &operator=(const mock_gpu &) = delete;
+
+  private:
+    // restores the extents changed by the constructor
+    const block_extents_guard extents_guard_;
+    std::vector<uint64_t> values_;
+};
+
+/** @return A config with every counter of the benchmarked GPU. */
+sampler_config make_full_config() {
+    sampler_config config(bench_gpu, 0);
+    for (const auto counter : detail::counter_database{}.get_counters_for_gpu(bench_gpu)) {
+        // some counters can't be sampled on their own, they are simply skipped
+        const auto ec = config.add_counter(counter);
+        static_cast<void>(ec);
+    }
+    return config;
+}
+
+} // namespace
+
+TEST_CASE("bench__sampler_config") {
+    BENCHMARK("add_counter") {
+        sampler_config config(bench_gpu, 0);
+        return config.add_counter(hwcpipe_counter::MaliFragActiveCy);
+    };
+
+    BENCHMARK("add_counter all") { return make_full_config().get_valid_counters().size(); };
+
+    const auto config = make_full_config();
+    BENCHMARK("build_backend_config_list") { return config.build_backend_config_list(); };
+}
+
+TEST_CASE("bench__sampler_construction") {
+    const mock_gpu gpu(4, false);
+
+    sampler_config single(bench_gpu, 0);
+    REQUIRE(!single.add_counter(hwcpipe_counter::MaliGPUActiveCy));
+    BENCHMARK("sampler single counter") { return static_cast<bool>(sampler_t(single)); };
+
+    const auto full = make_full_config();
+    BENCHMARK("sampler all counters") { return static_cast<bool>(sampler_t(full)); };
+}
+
+TEST_CASE("bench__sample_now") {
+    const bool values_64bit = GENERATE(false, true);
+    const size_t num_cores = GENERATE(1, 4, 16, 32);
+    const mock_gpu gpu(num_cores, values_64bit);
+
+    const std::string format = values_64bit ? "64bit" : "32bit";
+    const std::string suffix = " " + format + " " + std::to_string(num_cores) + " cores";
+
+    auto config = make_full_config();
+    config.set_per_instance_values(GENERATE(false, true));
+    const std::string mode = config.get_per_instance_values() ? " per instance" : "";
+
+    sampler_t test_sampler(config);
+    REQUIRE(test_sampler);
+    REQUIRE(!test_sampler.start_sampling());
+
+    BENCHMARK("sample_now" + mode + suffix) { return test_sampler.sample_now(); };
+
+    REQUIRE(!test_sampler.stop_sampling());
+}
+
+TEST_CASE("bench__get_counter_value") {
+    const mock_gpu gpu(4, false);
+
+    sampler_config config(bench_gpu, 0);
+    // MaliTilerUtil is derived from MaliTilerActiveCy and MaliGPUActiveCy
+    REQUIRE(!config.add_counter(hwcpipe_counter::MaliGPUActiveCy));
+    REQUIRE(!config.add_counter(hwcpipe_counter::MaliTilerUtil));
+    config.set_expression_evaluation(
+        GENERATE(sampler_config::expression_evaluation::lazy, sampler_config::expression_evaluation::eager));
+    const std::string mode =
+        config.get_expression_evaluation() == sampler_config::expression_evaluation::lazy ? " lazy" : " eager";
+
+    sampler_t test_sampler(config);
+    REQUIRE(test_sampler);
+    REQUIRE(!test_sampler.start_sampling());
+    REQUIRE(!test_sampler.sample_now());
+
+    counter_sample sample{};
+    BENCHMARK("get_counter_value hardware" + mode) {
+        return test_sampler.get_counter_value(hwcpipe_counter::MaliGPUActiveCy, sample);
+    };
+    BENCHMARK("get_counter_value derived" + mode) {
+        return test_sampler.get_counter_value(hwcpipe_counter::MaliTilerUtil, sample);
+    };
+
+    REQUIRE(!test_sampler.stop_sampling());
+}
+
+TEST_CASE("bench__counter_database") {
+    detail::counter_database db{};
+    std::error_code ec;
+
+    BENCHMARK("get_counter_def") { return db.get_counter_def(bench_gpu, hwcpipe_counter::MaliFragActiveCy, ec); };
+
+    // alternating between GPUs defeats the memoized table of the last GPU
+    BENCHMARK("get_counter_def other gpu") {
+        const auto other = db.get_counter_def(device::product_id::g710, hwcpipe_counter::MaliFragActiveCy, ec);
+        static_cast<void>(other);
+        return db.get_counter_def(bench_gpu, hwcpipe_counter::MaliFragActiveCy, ec);
+    };
+}
+
+TEST_CASE("bench__mapped_memory_first_read") {
+    using memory_type = device::hwcnt::sampler::mapped_memory<device::syscall::iface>;
+    constexpr size_t buffer_size = 16 * 1024;
+    constexpr size_t buffer_count = 32;
+    constexpr size_t num_runs = 128;
+
+    // a file backed private mapping takes page faults on first read, as the
+    // dump buffers of the kernel driver do
+    std::FILE *file = std::tmpfile();
+    REQUIRE(file != nullptr);
+    const int fd = fileno(file);
+    REQUIRE(::ftruncate(fd, static_cast<off_t>(buffer_size * buffer_count)) == 0);
+
+    const bool prefault = GENERATE(false, true);
+    std::vector<uint64_t> latencies_ns;
+    latencies_ns.reserve(num_runs);
+    uint64_t sum = 0;
+
+    for (size_t run = 0; run != num_runs; ++run) {
+        std::error_code ec;
+        const memory_type memory{fd, buffer_size * buffer_count, ec, device::syscall::iface{}, prefault};
+        REQUIRE(!ec);
+
+        // read the first buffer, as the first sample after start does
+        const auto begin = std::chrono::steady_clock::now();
+        const auto *values = static_cast<const uint64_t *>(memory.data());
+        for (size_t i = 0; i != buffer_size / sizeof(uint64_t); ++i) {
+            sum += values[i];
+        }
+        const auto elapsed = std::chrono::steady_clock::now() - begin;
+        latencies_ns.push_back(
+            static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+    }
+    std::fclose(file);
+    REQUIRE(sum == 0);
+
+    std::sort(latencies_ns.begin(), latencies_ns.end());
+    const auto percentile = [&](size_t p) { return latencies_ns[(latencies_ns.size() - 1) * p / 100]; };
+    WARN("first read" << (prefault ? " prefaulted" : "") << ": p50 " << percentile(50) << " ns, p99 "
+                      << percentile(99) << " ns");
+}
+
+} // namespace hwcpipe
@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hwcpipe/hwcpipe_counter.h"
+
+#include <catch2/catch.hpp>
+
+#include <hwcpipe/detail/counter_database.hpp>
+#include <hwcpipe/gpu_simulator.hpp>
+#include <hwcpipe/sampler.hpp>
+#include <hwcpipe/submit_sampler.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <ctime>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace hwcpipe {
+
+namespace {
+
+using simulated_sampler = sampler<gpu_simulator_policy>;
+
+/** @return A config with every counter of the simulated GPU. */
+sampler_config make_full_config(const gpu_simulator &simulator, uint64_t period_ns) {
+    device::product_id pid{};
+    REQUIRE(!simulator.get_product_id(pid));
+    sampler_config config(pid, simulator.get_device_number());
+    for (const auto counter : detail::counter_database{}.get_counters_for_gpu(pid)) {
+        // some counters can't be sampled on their own, they are simply skipped
+        const auto ec = config.add_counter(counter);
+        static_cast<void>(ec);
+    }
+    config.set_sampling_period(period_ns);
+    config.set_expression_evaluation(sampler_config::expression_evaluation::eager);
+    return config;
+}
+
+/** @return The CPU time of the calling thread, in nanoseconds. */
+uint64_t thread_cpu_time_ns() {
+    timespec now{};
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now);
+    return static_cast<uint64_t>(now.tv_sec) * 1000000000 + static_cast<uint64_t>(now.tv_nsec);
+}
+
+} // namespace
+
+TEST_CASE("bench__simulated_sample_now") {
+    gpu_simulator_config sim_config{};
+    sim_config.values_64bit = GENERATE(false, true);
+    sim_config.num_shader_cores = static_cast<uint8_t>(GENERATE(4, 8, 16, 32));
+    gpu_simulator simulator(sim_config);
+    REQUIRE(simulator);
+
+    const std::string suffix = std::string(sim_config.values_64bit ? " 64bit " : " 32bit ") +
+                               std::to_string(sim_config.num_shader_cores) + " cores";
+
+    const auto config = make_full_config(simulator, simulator.get_period_ns());
+    simulated_sampler test_sampler(config);
+    REQUIRE(test_sampler);
+    REQUIRE(!test_sampler.start_sampling());
+
+    std::vector<hwcpipe_counter> counters;
+    for (const auto &counter : config.get_valid_counters()) {
+        counters.push_back(counter.counter);
+    }
+    std::error_code ec;
+    const auto list = test_sampler.make_read_list(counters.data(), counters.size(), ec);
+    REQUIRE(!ec);
+    std::vector<double> values(counters.size());
+
+    BENCHMARK("simulated sample_now" + suffix) { return test_sampler.sample_now(); };
+
+    BENCHMARK("simulated sample_now and read all" + suffix) {
+        const auto sample_ec = test_sampler.sample_now();
+        static_cast<void>(sample_ec);
+        return test_sampler.get_counter_values(list, values.data(), values.size());
+    };
+
+    REQUIRE(!test_sampler.stop_sampling());
+}
+
+TEST_CASE("bench__simulated_paced_load") {
+    gpu_simulator_config sim_config{};
+    sim_config.paced = true;
+    sim_config.sample_rate_hz = static_cast<uint64_t>(GENERATE(100, 1000, 20000));
+    sim_config.num_shader_cores = static_cast<uint8_t>(GENERATE(4, 32));
+    gpu_simulator simulator(sim_config);
+    REQUIRE(simulator);
+
+    auto config = make_full_config(simulator, simulator.get_period_ns());
+    config.set_drop_policy(sampler_config::drop_policy::widen);
+    simulated_sampler test_sampler(config);
+    REQUIRE(test_sampler);
+    REQUIRE(!test_sampler.start_sampling());
+
+    // a tenth of a second of samples, and the CPU time it took to read them
+    const uint64_t num_samples = sim_config.sample_rate_hz / 10;
+    const uint64_t begin = thread_cpu_time_ns();
+    for (uint64_t i = 0; i != num_samples; ++i) {
+        REQUIRE(!test_sampler.sample_now());
+    }
+    const uint64_t cpu_ns = thread_cpu_time_ns() - begin;
+    REQUIRE(!test_sampler.stop_sampling());
+
+    WARN(sim_config.sample_rate_hz << " Hz " << +sim_config.num_shader_cores << " cores: "
+                                   << cpu_ns / num_samples << " CPU ns per sample, "
+                                   << test_sampler.get_stats().samples_stretched << " stretched");
+}
+
+TEST_CASE("bench__submit_sampler_frame") {
+    gpu_simulator simulator(gpu_simulator_config{});
+    REQUIRE(simulator);
+
+    // a manual sampler, as used by the Vulkan layer and the GLES interposer
+    simulated_sampler test_sampler(make_full_config(simulator, 0));
+    REQUIRE(test_sampler);
+    REQUIRE(!test_sampler.start_sampling());
+
+    submit_sampler<simulated_sampler> submits(test_sampler, submit_sampler_config{});
+    std::atomic<bool> running{true};
+    std::thread collector([&] {
+        while (running.load(std::memory_order_relaxed)) {
+            const auto ec = submits.collect_for(1000000);
+            static_cast<void>(ec);
+        }
+    });
+
+    // the cost added to each frame of the application, while the collector samples
+    BENCHMARK("submit_sampler on_present") { return submits.on_present(0); };
+    BENCHMARK("submit_sampler on_submit") { return submits.on_submit(0); };
+
+    running.store(false, std::memory_order_relaxed);
+    collector.join();
+    REQUIRE(!test_sampler.stop_sampling());
+
+    const auto stats = submits.get_stats();
+    WARN(stats.samples << " frames sampled, " << stats.dropped << " dropped as the collector fell behind");
+}
+
+} // namespace hwcpipe
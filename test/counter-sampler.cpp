@@ -14,6 +14,7 @@
 #include "hwcpipe/gpu.hpp"
 #include "hwcpipe/hwcpipe_counter.h"
 #include "hwcpipe/mock/backend_manual_sampler.hpp"
+#include "hwcpipe/mock/backend_periodic_sampler.hpp"
 #include "hwcpipe/mock/backend_sample.hpp"
 #include "hwcpipe/mock/handle.hpp"
 #include "hwcpipe/mock/instance.hpp"
@@ -22,11 +23,20 @@
 
 #include <catch2/catch.hpp>
 
+#include <hwcpipe/async_sampler.hpp>
+#include <hwcpipe/group_sampler.hpp>
 #include <hwcpipe/sampler.hpp>
+#include <hwcpipe/shared_session.hpp>
+#include <hwcpipe/static_sampler.hpp>
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <ios>
+#include <limits>
 #include <memory>
 #include <system_error>
 
@@ -38,6 +48,7 @@ struct hwcpipe_sampler_mock_policy {
     using handle_type = hwcpipe::mock::handle_mock;
     using instance_type = hwcpipe::mock::instance_mock;
     using sampler_type = hwcpipe::mock::backend_manual_sampler_mock;
+    using periodic_sampler_type = hwcpipe::mock::backend_periodic_sampler_mock;
     using sample_type = hwcpipe::mock::backend_sample_mock;
 };
 
@@ -183,8 +194,12 @@ TEST_CASE("SamplerReportsCorrectErrorCode__WhenSartSamplingIsCalled") {
     }
 
     SECTION("Starting sampler can't create backend instance") {
+        // test_sampler holds device 0 open, a sampler of it would share its instance
+        sampler_config other_config(device::product_id::g31, 1);
+        REQUIRE(!other_config.add_counter(hwcpipe_counter::MaliGPUActiveCy));
+
         mock::instance_mock::return_valid_instance = false;
-        test_sampler = sampler_t(config);
+        test_sampler = sampler_t(other_config);
 
         auto ec = test_sampler.start_sampling();
         REQUIRE(ec == hwcpipe::make_error_code(hwcpipe::errc::backend_creation_failed));
@@ -199,6 +214,159 @@ TEST_CASE("SamplerReportsCorrectErrorCode__WhenSartSamplingIsCalled") {
     }
 }
 
+TEST_CASE("counter_sampler__ExternalHandle") {
+    sampler_config config(device::product_id::g31, 0);
+    auto ec = config.add_counter(hwcpipe_counter::MaliGPUActiveCy);
+    REQUIRE(!ec);
+
+    handle_mock handle;
+
+    SECTION("The sampler uses the handle it was given") {
+        // the handle is not created, so a failing create would not be noticed
+        handle_mock::return_valid_instance = false;
+        sampler_t test_sampler(config, handle);
+        handle_mock::return_valid_instance = true;
+        REQUIRE(test_sampler);
+
+        ec = test_sampler.start_sampling();
+        REQUIRE(!ec);
+    }
+
+    SECTION("Instance creation failures are reported") {
+        instance_mock::return_valid_instance = false;
+        sampler_t test_sampler(config, handle);
+        REQUIRE(!test_sampler);
+        REQUIRE(test_sampler.start_sampling() == make_error_code(errc::backend_creation_failed));
+    }
+}
+
+TEST_CASE("counter_sampler__SharedDevice") {
+    sampler_config config(device::product_id::g31, 0);
+    REQUIRE(!config.add_counter(hwcpipe_counter::MaliGPUActiveCy));
+
+    const auto num_created = instance_mock::num_created;
+
+    SECTION("Samplers of a device number share its instance") {
+        sampler_t first(config);
+        REQUIRE(first);
+
+        // a new instance would not be valid
+        instance_mock::return_valid_instance = false;
+        sampler_t second(config);
+        instance_mock::return_valid_instance = true;
+        REQUIRE(second);
+        REQUIRE(instance_mock::num_created == num_created + 1);
+
+        REQUIRE(!second.start_sampling());
+        REQUIRE(!second.stop_sampling());
+    }
+
+    SECTION("The device is opened again once its samplers are destroyed") {
+        { sampler_t first(config); }
+        sampler_t second(config);
+        REQUIRE(second);
+        REQUIRE(instance_mock::num_created == num_created + 2);
+    }
+
+    SECTION("Samplers of other device numbers open their own device") {
+        sampler_config other_config(device::product_id::g31, 1);
+        REQUIRE(!other_config.add_counter(hwcpipe_counter::MaliGPUActiveCy));
+
+        sampler_t first(config);
+        sampler_t second(other_config);
+        REQUIRE(first);
+        REQUIRE(second);
+        REQUIRE(instance_mock::num_created == num_created + 2);
+    }
+}
+
+TEST_CASE("counter_sampler__Reconfigure") {
+    sampler_config config(device::product_id::g31, 0);
+    REQUIRE(!config.add_counter(hwcpipe_counter::MaliGPUActiveCy));
+
+    sampler_config tiler_config(device::product_id::g31, 0);
+    REQUIRE(!tiler_config.add_counter(hwcpipe_counter::MaliTilerPosCacheHit));
+
+    sampler_t test_sampler(config);
+    REQUIRE(test_sampler);
+    const auto num_constructed = backend_manual_sampler_mock::num_constructed;
+
+    SECTION("The instance is kept, and the backend set up again for new enable maps") {
+        // a new instance would not be valid
+        instance_mock::return_valid_instance = false;
+        REQUIRE(!test_sampler.reconfigure(tiler_config));
+        instance_mock::return_valid_instance = true;
+
+        REQUIRE(test_sampler);
+        REQUIRE(backend_manual_sampler_mock::num_constructed == num_constructed + 1);
+
+        REQUIRE(!test_sampler.start_sampling());
+        REQUIRE(!test_sampler.sample_now());
+        REQUIRE(!test_sampler.stop_sampling());
+
+        counter_sample sample{};
+        REQUIRE(!test_sampler.get_counter_value(hwcpipe_counter::MaliTilerPosCacheHit, sample));
+        REQUIRE(test_sampler.get_counter_value(hwcpipe_counter::MaliGPUActiveCy, sample));
+    }
+
+    SECTION("The backend is kept when the enable maps don't change") {
+        sampler_config eager_config{config};
+        eager_config.set_expression_evaluation(sampler_config::expression_evaluation::eager);
+
+        REQUIRE(!test_sampler.reconfigure(eager_config));
+        REQUIRE(test_sampler);
+        REQUIRE(backend_manual_sampler_mock::num_constructed == num_constructed);
+
+        REQUIRE(!test_sampler.start_sampling());
+        REQUIRE(!test_sampler.sample_now());
+        REQUIRE(!test_sampler.stop_sampling());
+    }
+
+    SECTION("The read lists built before are rejected") {
+        std::error_code ec;
+        const hwcpipe_counter counters[] = {hwcpipe_counter::MaliGPUActiveCy};
+        const auto old_list = test_sampler.make_read_list(counters, 1, ec);
+        REQUIRE(!ec);
+
+        sampler_config wide_config{tiler_config};
+        REQUIRE(!wide_config.add_counter(hwcpipe_counter::MaliGPUActiveCy));
+        REQUIRE(!test_sampler.reconfigure(wide_config));
+        REQUIRE(!test_sampler.start_sampling());
+        REQUIRE(!test_sampler.sample_now());
+        REQUIRE(!test_sampler.stop_sampling());
+
+        double value{};
+        REQUIRE(test_sampler.get_counter_values(old_list, &value, 1) == make_error_code(errc::invalid_read_list));
+        const auto list = test_sampler.make_read_list(counters, 1, ec);
+        REQUIRE(!ec);
+        REQUIRE(!test_sampler.get_counter_values(list, &value, 1));
+
+        // nor can a list be read from another sampler
+        sampler_t other_sampler(config);
+        REQUIRE(other_sampler);
+        REQUIRE(!other_sampler.start_sampling());
+        REQUIRE(!other_sampler.sample_now());
+        REQUIRE(other_sampler.get_counter_values(list, &value, 1) == make_error_code(errc::invalid_read_list));
+        REQUIRE(!other_sampler.stop_sampling());
+    }
+
+    SECTION("The sampler can't be reconfigured while sampling") {
+        REQUIRE(!test_sampler.start_sampling());
+        REQUIRE(test_sampler.reconfigure(tiler_config) == make_error_code(errc::sampling_already_started));
+        REQUIRE(!test_sampler.stop_sampling());
+    }
+
+    SECTION("An invalid configuration invalidates the sampler") {
+        sampler_config empty_config(device::product_id::g31, 0);
+        REQUIRE(test_sampler.reconfigure(empty_config) == make_error_code(errc::sampler_config_invalid));
+        REQUIRE(!test_sampler);
+
+        // the instance is still there, so a valid configuration can be applied
+        REQUIRE(!test_sampler.reconfigure(config));
+        REQUIRE(test_sampler);
+    }
+}
+
 TEST_CASE("SamplerReportsCorrectErrorCode__WhenSampleNowIsCalled") {
     sampler_config config{device::product_id::g31, 0};
     auto ec = config.add_counter(MaliGPUActiveCy);
@@ -294,222 +462,1813 @@ TEST_CASE("SamplerReportsCorrectErrorCode__WhenSampleNowIsCalled") {
     }
 }
 
-TEST_CASE("SamplerReportsCorrectErrorCode__WhenStopSamplingIsCalled") {
-    sampler_config config(device::product_id::g31, 0);
-    auto ec = config.add_counter(hwcpipe_counter::MaliGPUActiveCy);
-    REQUIRE(!ec);
+TEST_CASE("SamplerReportsCorrectErrorCode__WhenSampleIsCollectedAsynchronously") {
+    sampler_config config{device::product_id::g31, 0};
+    REQUIRE(!config.add_counter(MaliGPUActiveCy));
 
     sampler_t test_sampler(config);
     REQUIRE(test_sampler);
 
-    SECTION("Stop Sampling is called without sampling started") {
-        auto ec = test_sampler.stop_sampling();
-        REQUIRE(ec == make_error_code(errc::sampling_not_started));
-    }
-
-    SECTION("Stop Sampling is called after sampling started") {
-        auto ec = test_sampler.start_sampling();
-        REQUIRE(!ec);
+    std::vector<block_metadata> blocks_list(1);
+    std::vector<uint32_t> values_fe(10, 0);
+    values_fe[6] = 0xFEFE;
+    blocks_list[0] = {hwcnt::block_type::fe, values_fe.data()};
 
-        ec = test_sampler.stop_sampling();
-        REQUIRE(!ec);
+    SECTION("Request and collect without start sampling") {
+        REQUIRE(test_sampler.request_sample_async() == make_error_code(errc::sampling_not_started));
+        REQUIRE(test_sampler.try_collect() == make_error_code(errc::sampling_not_started));
     }
 
-    SECTION("Stop Sampling is called twice after sampling started") {
-        auto ec = test_sampler.start_sampling();
-        REQUIRE(!ec);
-
-        ec = test_sampler.stop_sampling();
-        REQUIRE(!ec);
-
-        ec = test_sampler.stop_sampling();
-        REQUIRE(ec == make_error_code(errc::sampling_not_started));
+    SECTION("Request fails in the backend") {
+        REQUIRE(!test_sampler.start_sampling());
+        EXPECT_CALL(backend_manual_sampler_mock, request_sample_async,
+                    std::make_error_code(std::errc::invalid_argument));
+        REQUIRE(test_sampler.request_sample_async() == make_error_code(errc::sample_collection_failure));
     }
 
-    SECTION("Stop Sampling can't stop backend accumulation") {
-        auto ec = test_sampler.start_sampling();
-        REQUIRE(!ec);
-
-        EXPECT_CALL(backend_manual_sampler_mock, accumulation_stop, //
-                    std::make_error_code(std::errc::invalid_argument));
+    SECTION("Asynchronous request does not issue a synchronous one") {
+        REQUIRE(!test_sampler.start_sampling());
+        EXPECT_CALL(backend_manual_sampler_mock, request_sample, std::make_error_code(std::errc::invalid_argument));
+        REQUIRE(!test_sampler.request_sample_async());
+        EXPECT_CALL(backend_manual_sampler_mock, request_sample, std::error_code{});
+    }
 
-        ec = test_sampler.stop_sampling();
-        REQUIRE(ec == make_error_code(errc::accumulation_stop_failed));
+    SECTION("Readiness check fails in the backend") {
+        REQUIRE(!test_sampler.start_sampling());
+        REQUIRE(!test_sampler.request_sample_async());
+        EXPECT_CALL(reader_mock, ready_error, std::make_error_code(std::errc::invalid_argument));
+        REQUIRE(test_sampler.try_collect() == make_error_code(errc::sample_collection_failure));
     }
 
-    SECTION("Sample now is called after sampling stop") {
-        auto ec = test_sampler.start_sampling();
-        REQUIRE(!ec);
+    SECTION("Collect before the sample is ready") {
+        REQUIRE(!test_sampler.start_sampling());
+        REQUIRE(!test_sampler.request_sample_async());
 
-        ec = test_sampler.stop_sampling();
-        REQUIRE(!ec);
+        EXPECT_CALL(reader_mock, ready, false);
+        REQUIRE(test_sampler.try_collect() == make_error_code(errc::sample_not_ready));
 
-        ec = test_sampler.sample_now();
-        REQUIRE(ec == make_error_code(errc::sampling_not_started));
+        hwcpipe::counter_sample sample{};
+        REQUIRE(test_sampler.get_counter_value(MaliGPUActiveCy, sample) ==
+                make_error_code(errc::sample_collection_failure));
+
+        EXPECT_CALL(backend_sample_mock, blocks, blocks_list);
+        REQUIRE(!test_sampler.try_collect());
+        REQUIRE(!test_sampler.get_counter_value(MaliGPUActiveCy, sample));
+        REQUIRE(sample.value.uint64 == 0xFEFE);
     }
 }
 
-TEST_CASE("SamplerReportsCorrectErrorCode__WhenGetCounterValueIsCalled") {
-    using counter_offset_pair = std::pair<hwcpipe_counter, uint32_t>;
-
-    counter_offset_pair c1_fe = {MaliGPUActiveCy, 6};
-    counter_offset_pair c2_core = {MaliFragActiveCy, 4};
+TEST_CASE("AsyncSamplerCompletes__WhenTheReaderIsReadable") {
+    sampler_config config{device::product_id::g31, 0};
+    REQUIRE(!config.add_counter(MaliGPUActiveCy));
 
-    std::vector<block_metadata> blocks_list(3);
+    std::vector<block_metadata> blocks_list(1);
     std::vector<uint32_t> values_fe(10, 0);
-    std::vector<uint32_t> values_core0(10, 0);
-    std::vector<uint32_t> values_core1(10, 0);
+    values_fe[6] = 0xFEFE;
+    blocks_list[0] = {hwcnt::block_type::fe, values_fe.data()};
 
-    values_fe[c1_fe.second] = 0xFEFE;
-    values_core0[c2_core.second] = 0xC0C0;
-    values_core1[c2_core.second] = 0x0C0C;
+    sampler_t test_sampler(config);
+    REQUIRE(test_sampler);
+    REQUIRE(test_sampler.get_fd() == reader_mock::fd);
+    REQUIRE(!test_sampler.start_sampling());
+
+    // a reactor that runs the callbacks when the test says the reader is readable
+    std::vector<std::function<void()>> waits{};
+    hwcpipe::async_sampler<sampler_t> async(test_sampler, [&](int fd, std::function<void()> on_readable) {
+        REQUIRE(fd == reader_mock::fd);
+        waits.push_back(std::move(on_readable));
+    });
+    const auto run_waits = [&] {
+        auto ready = std::move(waits);
+        waits.clear();
+        for (auto &on_readable : ready) {
+            on_readable();
+        }
+    };
 
-    sampler_config config(device::product_id::g31, 0);
-    auto ec = config.add_counter(c1_fe.first);
-    REQUIRE(!ec);
-    ec = config.add_counter(c2_core.first);
-    REQUIRE(!ec);
+    std::vector<std::error_code> completions{};
+    const auto handler = [&](std::error_code ec) { completions.push_back(ec); };
 
-    sampler_t test_sampler(config);
-    ec = test_sampler.start_sampling();
-    REQUIRE(!ec);
+    SECTION("The sample is collected once it is ready") {
+        REQUIRE(!async.async_sample(7, handler));
+        REQUIRE(backend_manual_sampler_mock::request_sample_async_last_arg == 7);
+        REQUIRE(async.pending());
+        REQUIRE(waits.size() == 1);
 
-    SECTION("Reading registered counters") {
-        blocks_list[0] = {hwcnt::block_type::fe, values_fe.data()};
-        blocks_list[1] = {hwcnt::block_type::core, values_core0.data()};
-        blocks_list[2] = {hwcnt::block_type::core, values_core1.data()};
+        // a spurious wake-up waits again
+        EXPECT_CALL(reader_mock, ready, false);
+        run_waits();
+        REQUIRE(completions.empty());
+        REQUIRE(waits.size() == 1);
 
         EXPECT_CALL(backend_sample_mock, blocks, blocks_list);
-
-        ec = test_sampler.sample_now();
-        REQUIRE(!ec);
+        run_waits();
+        REQUIRE(completions.size() == 1);
+        REQUIRE(!completions[0]);
+        REQUIRE(!async.pending());
 
         hwcpipe::counter_sample sample{};
-        ec = test_sampler.get_counter_value(c1_fe.first, sample);
-        REQUIRE(!ec);
+        REQUIRE(!test_sampler.get_counter_value(MaliGPUActiveCy, sample));
         REQUIRE(sample.value.uint64 == 0xFEFE);
-        REQUIRE(sample.type == counter_sample::type::uint64);
+    }
 
-        ec = test_sampler.get_counter_value(c2_core.first, sample);
-        REQUIRE(!ec);
-        // Sum of values from Core[0] and Core[1]
-        REQUIRE(sample.value.uint64 == 0xCCCC);
-        REQUIRE(sample.type == counter_sample::type::uint64);
+    SECTION("One operation is pending at a time") {
+        REQUIRE(!async.async_collect(handler));
+        REQUIRE(async.async_sample(0, handler) == std::make_error_code(std::errc::operation_in_progress));
 
-        for (const auto &sample : test_sampler.sample_view()) {
-            if (sample.counter == c1_fe.first) {
-                REQUIRE(sample.value.uint64 == 0xFEFE);
-                REQUIRE(sample.type == counter_sample::type::uint64);
-            } else if (sample.counter == c2_core.first) {
-                REQUIRE(sample.value.uint64 == 0xCCCC);
-                REQUIRE(sample.type == counter_sample::type::uint64);
-            } else {
-                FAIL("Unexpected counter value");
-            }
-        }
+        async.cancel();
+        REQUIRE(completions.size() == 1);
+        REQUIRE(completions[0] == std::make_error_code(std::errc::operation_canceled));
+
+        // the reactor's callback of the cancelled operation does nothing
+        EXPECT_CALL(reader_mock, ready, false);
+        run_waits();
+        REQUIRE(completions.size() == 1);
+        REQUIRE(waits.empty());
+        EXPECT_CALL(reader_mock, ready, true);
     }
 
-    SECTION("Sample and read value two consequent times") {
-        blocks_list[0] = {hwcnt::block_type::fe, values_fe.data()};
-        blocks_list[1] = {hwcnt::block_type::core, values_core0.data()};
-        blocks_list[2] = {hwcnt::block_type::core, values_core1.data()};
+    SECTION("A failed request doesn't start an operation") {
+        EXPECT_CALL(backend_manual_sampler_mock, request_sample_async,
+                    std::make_error_code(std::errc::invalid_argument));
+        REQUIRE(async.async_sample(0, handler) == make_error_code(errc::sample_collection_failure));
+        REQUIRE(!async.pending());
+        REQUIRE(waits.empty());
+    }
 
-        // First Sample
-        EXPECT_CALL(backend_sample_mock, blocks, blocks_list);
-        ec = test_sampler.sample_now();
-        REQUIRE(!ec);
+    REQUIRE(!test_sampler.stop_sampling());
+}
 
-        hwcpipe::counter_sample sample{};
-        ec = test_sampler.get_counter_value(c1_fe.first, sample);
-        REQUIRE(!ec);
-        REQUIRE(sample.value.uint64 == 0xFEFE);
-        REQUIRE(sample.type == counter_sample::type::uint64);
+TEST_CASE("SamplerReportsItsMemoryFootprint__WhenConfigured") {
+    sampler_config small{device::product_id::g31, 0};
+    REQUIRE(!small.add_counter(MaliGPUActiveCy));
+    sampler_config large{device::product_id::g31, 0};
+    for (const auto counter : {MaliGPUActiveCy, MaliTilerActiveCy, MaliFragActiveCy, MaliTilerUtil}) {
+        REQUIRE(!large.add_counter(counter));
+    }
+    REQUIRE(large.get_memory_footprint() >= sizeof(sampler_config));
+
+    mock::reader_mock::features.mapped_size = 4096;
+    sampler_t small_sampler(small);
+    sampler_t large_sampler(large);
+    mock::reader_mock::features.mapped_size = 0;
+    REQUIRE(small_sampler);
+    REQUIRE(large_sampler);
+
+    const auto footprint = large_sampler.get_memory_footprint();
+    REQUIRE(footprint.object == sizeof(sampler_t));
+    REQUIRE(footprint.kernel_mapping == 4096);
+    REQUIRE(footprint.sample_buffers >= 4 * sizeof(uint64_t));
+    REQUIRE(footprint.index_maps > 0);
+    REQUIRE(footprint.total() ==
+            footprint.object + footprint.sample_buffers + footprint.index_maps + footprint.kernel_mapping);
+    REQUIRE(footprint.sample_buffers > small_sampler.get_memory_footprint().sample_buffers);
+
+    // the database tables hold at least the records of one product
+    REQUIRE(detail::counter_database::get_memory_footprint() > 100 * sizeof(detail::counter_record));
+}
 
-        ec = test_sampler.get_counter_value(c2_core.first, sample);
-        REQUIRE(!ec);
-        // Sum of values from Core[0] and Core[1]
-        REQUIRE(sample.value.uint64 == 0xCCCC);
-        REQUIRE(sample.type == counter_sample::type::uint64);
+TEST_CASE("SamplerBoundsTheWait__WhenSampledWithATimeout") {
+    sampler_config config{device::product_id::g31, 0};
+    REQUIRE(!config.add_counter(MaliGPUActiveCy));
 
-        // Second Sample
-        EXPECT_CALL(backend_sample_mock, blocks, blocks_list);
-        ec = test_sampler.sample_now();
-        REQUIRE(!ec);
+    sampler_t test_sampler(config);
+    REQUIRE(test_sampler);
 
-        ec = test_sampler.get_counter_value(c1_fe.first, sample);
-        REQUIRE(!ec);
-        REQUIRE(sample.value.uint64 == 0xFEFE);
-        REQUIRE(sample.type == counter_sample::type::uint64);
+    std::vector<block_metadata> blocks_list(1);
+    std::vector<uint32_t> values_fe(10, 0);
+    values_fe[6] = 0xFEFE;
+    blocks_list[0] = {hwcnt::block_type::fe, values_fe.data()};
 
-        ec = test_sampler.get_counter_value(c2_core.first, sample);
-        REQUIRE(!ec);
-        // Sum of values from Core[0] and Core[1]
-        REQUIRE(sample.value.uint64 == 0xCCCC);
-        REQUIRE(sample.type == counter_sample::type::uint64);
-    }
+    REQUIRE(test_sampler.sample_now_for(1000000) == make_error_code(errc::sampling_not_started));
+    REQUIRE(!test_sampler.start_sampling());
 
-    SECTION("Reading unregistered counters") {
-        blocks_list[0] = {hwcnt::block_type::fe, values_fe.data()};
-        blocks_list[1] = {hwcnt::block_type::core, values_core0.data()};
-        blocks_list[2] = {hwcnt::block_type::core, values_core1.data()};
+    SECTION("The sample is ready in time") {
         EXPECT_CALL(backend_sample_mock, blocks, blocks_list);
-
-        ec = test_sampler.sample_now();
-        REQUIRE(!ec);
+        REQUIRE(!test_sampler.sample_now_for(1000000));
+        REQUIRE(reader_mock::last_timeout_ns == 1000000);
 
         hwcpipe::counter_sample sample{};
-        ec = test_sampler.get_counter_value(hwcpipe_counter::MaliTilerActiveCy, sample);
-        REQUIRE(ec == make_error_code(errc::unknown_counter));
+        REQUIRE(!test_sampler.get_counter_value(MaliGPUActiveCy, sample));
+        REQUIRE(sample.value.uint64 == 0xFEFE);
     }
-}
 
-TEST_CASE("SamplerReadsCorrectValues__WhenValuesTypeIsUint64") {
-    using counter_offset_pair = std::pair<hwcpipe_counter, uint32_t>;
+    SECTION("A late sample is collected by the next call") {
+        EXPECT_CALL(reader_mock, ready, false);
+        REQUIRE(test_sampler.sample_now_for(1000000) == make_error_code(errc::sample_not_ready));
 
-    counter_offset_pair c1_fe = {MaliGPUActiveCy, 6};
-    counter_offset_pair c2_core = {MaliFragActiveCy, 4};
+        hwcpipe::counter_sample sample{};
+        REQUIRE(test_sampler.get_counter_value(MaliGPUActiveCy, sample) ==
+                make_error_code(errc::sample_collection_failure));
 
-    std::vector<block_metadata> blocks_list(3);
-    std::vector<uint64_t> values_fe(10, 0);
-    std::vector<uint64_t> values_core0(10, 0);
-    std::vector<uint64_t> values_core1(10, 0);
+        // the sample is still pending, so it is not requested again
+        EXPECT_CALL(backend_sample_mock, blocks, blocks_list);
+        REQUIRE(!test_sampler.sample_now_until(std::chrono::steady_clock::now()));
+        REQUIRE(reader_mock::last_timeout_ns == 0);
+        REQUIRE(test_sampler.get_stats().request.count == 1);
+        REQUIRE(!test_sampler.get_counter_value(MaliGPUActiveCy, sample));
+        REQUIRE(sample.value.uint64 == 0xFEFE);
+    }
 
-    values_fe[c1_fe.second] = 0xFEFE0000UL;
-    values_core0[c2_core.second] = 0xC0C00000UL;
-    values_core1[c2_core.second] = 0x0C0C0000UL;
+    SECTION("Readiness check fails in the backend") {
+        EXPECT_CALL(reader_mock, ready_error, std::make_error_code(std::errc::invalid_argument));
+        REQUIRE(test_sampler.sample_now_for(1000000) == make_error_code(errc::sample_collection_failure));
+    }
 
-    sampler_config config(device::product_id::g31, 0);
-    auto ec = config.add_counter(c1_fe.first);
-    REQUIRE(!ec);
-    ec = config.add_counter(c2_core.first);
-    REQUIRE(!ec);
+    REQUIRE(!test_sampler.stop_sampling());
+}
 
-    SECTION("Reading registered counters") {
-        blocks_list[0] = {hwcnt::block_type::fe, values_fe.data()};
-        blocks_list[1] = {hwcnt::block_type::core, values_core0.data()};
-        blocks_list[2] = {hwcnt::block_type::core, values_core1.data()};
+TEST_CASE("SamplerCollectsStatistics__WhenSamplesAreTaken") {
+    sampler_config config{device::product_id::g31, 0};
+    REQUIRE(!config.add_counter(MaliGPUActiveCy));
+    REQUIRE(!config.add_counter(MaliTilerUtil));
 
-        EXPECT_CALL(backend_sample_mock, blocks, blocks_list);
-        EXPECT_CALL(block_extents_mock, values_type, sample_values_type::uint64);
+    sampler_t test_sampler(config);
+    REQUIRE(test_sampler);
 
-        sampler_t test_sampler(config);
-        ec = test_sampler.start_sampling();
-        REQUIRE(!ec);
+    auto stats = test_sampler.get_stats();
+    REQUIRE(stats.samples_taken == 0);
+    REQUIRE(stats.request.count == 0);
 
-        auto ec = test_sampler.sample_now();
-        REQUIRE(!ec);
+    REQUIRE(!test_sampler.start_sampling());
 
-        hwcpipe::counter_sample sample{};
-        ec = test_sampler.get_counter_value(c1_fe.first, sample);
+    const auto take_sample = [&](uint64_t sample_nr, bool stretched, bool error) {
+        sample_metadata metadata{};
+        metadata.sample_nr = sample_nr;
+        metadata.flags.stretched = stretched ? 1 : 0;
+        metadata.flags.error = error ? 1 : 0;
+        EXPECT_CALL(backend_sample_mock, get_metadata, metadata);
+        return test_sampler.sample_now();
+    };
+
+    REQUIRE(!take_sample(1, false, false));
+    REQUIRE(take_sample(2, true, false) == make_error_code(errc::sample_collection_failure));
+    // samples 3 and 4 were dropped
+    REQUIRE(take_sample(5, false, true) == make_error_code(errc::sample_collection_failure));
+    REQUIRE(!take_sample(6, false, false));
+
+    stats = test_sampler.get_stats();
+    REQUIRE(stats.samples_taken == 2);
+    REQUIRE(stats.samples_stretched == 1);
+    REQUIRE(stats.samples_errored == 1);
+    REQUIRE(stats.samples_dropped == 2);
+    REQUIRE(stats.request.count == 4);
+    REQUIRE(stats.collect.count == 4);
+    REQUIRE(stats.evaluation.count == 2);
+    REQUIRE(stats.collect.max_ns <= stats.collect.total_ns);
+
+    SECTION("Sample numbers restart with a new session") {
+        REQUIRE(!test_sampler.stop_sampling());
+        REQUIRE(!test_sampler.start_sampling());
+        REQUIRE(!take_sample(1, false, false));
+        REQUIRE(test_sampler.get_stats().samples_dropped == 2);
+    }
+
+    SECTION("Statistics are reset") {
+        test_sampler.reset_stats();
+        stats = test_sampler.get_stats();
+        REQUIRE(stats.samples_taken == 0);
+        REQUIRE(stats.samples_dropped == 0);
+        REQUIRE(stats.collect.count == 0);
+        REQUIRE(stats.collect.max_ns == 0);
+    }
+
+    REQUIRE(!test_sampler.stop_sampling());
+}
+
+TEST_CASE("SamplerHandlesDroppedSamples__WhenSamplingIsPeriodic") {
+    sampler_config config{device::product_id::g31, 0};
+    config.set_sampling_period(1000000);
+    REQUIRE(!config.add_counter(MaliGPUActiveCy));
+
+    std::vector<drop_event> events{};
+    config.set_drop_handler(
+        [](void *user_data, const drop_event &event) {
+            static_cast<std::vector<drop_event> *>(user_data)->push_back(event);
+        },
+        &events);
+
+    const auto policy = GENERATE(sampler_config::drop_policy::reject, sampler_config::drop_policy::widen,
+                                 sampler_config::drop_policy::salvage);
+    config.set_drop_policy(policy);
+    const bool widen = policy != sampler_config::drop_policy::reject;
+
+    sampler_t test_sampler(config);
+    REQUIRE(test_sampler);
+    REQUIRE(!test_sampler.start_sampling());
+
+    const auto take_sample = [&](uint64_t sample_nr, bool stretched) {
+        sample_metadata metadata{};
+        metadata.sample_nr = sample_nr;
+        metadata.flags.stretched = stretched ? 1 : 0;
+        EXPECT_CALL(backend_sample_mock, get_metadata, metadata);
+        return test_sampler.sample_now();
+    };
+
+    REQUIRE(!take_sample(1, false));
+    REQUIRE(!take_sample(2, false));
+    REQUIRE(events.empty());
+
+    // samples 3 to 5 were dropped, the kernel stretched sample 6 to cover them
+    const auto ec = take_sample(6, true);
+    if (widen) {
+        REQUIRE(!ec);
+        REQUIRE(test_sampler.get_sample_flags().stretched);
+    } else {
+        REQUIRE(ec == make_error_code(errc::sample_collection_failure));
+    }
+
+    REQUIRE(events.size() == 1);
+    REQUIRE(events[0].sample_nr == 6);
+    REQUIRE(events[0].dropped == 3);
+    REQUIRE(events[0].stretched);
+    REQUIRE(events[0].widened == widen);
+    REQUIRE(test_sampler.get_dropped_samples() == 3);
+
+    // samples 7 and 8 were lost
+    REQUIRE(!take_sample(9, false));
+    REQUIRE(events.size() == 2);
+    REQUIRE(events[1].dropped == 2);
+    REQUIRE(!events[1].stretched);
+    REQUIRE(test_sampler.get_dropped_samples() == 5);
+
+    const auto stats = test_sampler.get_stats();
+    REQUIRE(stats.samples_dropped == 5);
+    REQUIRE(stats.samples_stretched == 1);
+    REQUIRE(stats.samples_taken == (widen ? 4 : 3));
+
+    // drops are counted per session
+    REQUIRE(!test_sampler.stop_sampling());
+    REQUIRE(!test_sampler.start_sampling());
+    REQUIRE(test_sampler.get_dropped_samples() == 0);
+    REQUIRE(!take_sample(1, false));
+    REQUIRE(test_sampler.get_dropped_samples() == 0);
+    REQUIRE(test_sampler.get_stats().samples_dropped == 5);
+    REQUIRE(!test_sampler.stop_sampling());
+}
+
+TEST_CASE("SamplerRecoversTheSession__WhenTheBackendFails") {
+    sampler_config config{device::product_id::g31, 0};
+    REQUIRE(!config.add_counter(MaliGPUActiveCy));
+
+    std::vector<drop_event> events{};
+    config.set_drop_handler(
+        [](void *user_data, const drop_event &event) {
+            static_cast<std::vector<drop_event> *>(user_data)->push_back(event);
+        },
+        &events);
+
+    const auto take_sample = [](sampler_t &test_sampler, uint64_t sample_nr) {
+        sample_metadata metadata{};
+        metadata.sample_nr = sample_nr;
+        EXPECT_CALL(backend_sample_mock, get_metadata, metadata);
+        return test_sampler.sample_now();
+    };
+
+    SECTION("Without recovery the error is returned") {
+        sampler_t test_sampler(config);
+        REQUIRE(test_sampler);
+        const auto num_constructed = backend_manual_sampler_mock::num_constructed;
+        REQUIRE(!test_sampler.start_sampling());
+
+        EXPECT_CALL(backend_manual_sampler_mock, request_sample, std::make_error_code(std::errc::io_error));
+        REQUIRE(test_sampler.sample_now() == make_error_code(errc::sample_collection_failure));
+        REQUIRE(backend_manual_sampler_mock::num_constructed == num_constructed);
+        REQUIRE(test_sampler.get_stats().recovery.count == 0);
+        REQUIRE(!test_sampler.stop_sampling());
+    }
+
+    SECTION("The session is set up again on the same instance, and the gap is marked") {
+        config.set_session_recovery(2);
+        sampler_t test_sampler(config);
+        REQUIRE(test_sampler);
+        const auto num_constructed = backend_manual_sampler_mock::num_constructed;
+        const auto num_instances = instance_mock::num_created;
+        REQUIRE(!test_sampler.start_sampling());
+        REQUIRE(!take_sample(test_sampler, 1));
+        REQUIRE(!test_sampler.is_after_recovery());
+
+        EXPECT_CALL(backend_manual_sampler_mock, request_sample, std::make_error_code(std::errc::io_error));
+        REQUIRE(!take_sample(test_sampler, 1));
+        REQUIRE(backend_manual_sampler_mock::num_constructed == num_constructed + 1);
+        REQUIRE(instance_mock::num_created == num_instances);
+        REQUIRE(test_sampler.is_after_recovery());
+        REQUIRE(test_sampler.get_stats().recovery.count == 1);
+        REQUIRE(test_sampler.get_dropped_samples() == 0);
+
+        REQUIRE(events.size() == 1);
+        REQUIRE(events[0].sample_nr == 1);
+        REQUIRE(events[0].recovered);
+        REQUIRE(events[0].dropped == 0);
+
+        REQUIRE(!take_sample(test_sampler, 2));
+        REQUIRE(!test_sampler.is_after_recovery());
+        REQUIRE(events.size() == 1);
+        REQUIRE(!test_sampler.stop_sampling());
+    }
+
+    SECTION("A session that can't be set up again invalidates the sampler") {
+        config.set_session_recovery(1);
+        sampler_t test_sampler(config);
+        REQUIRE(test_sampler);
+        REQUIRE(!test_sampler.start_sampling());
+
+        EXPECT_CALL(backend_manual_sampler_mock, request_sample, std::make_error_code(std::errc::io_error));
+        EXPECT_CALL(backend_manual_sampler_mock, valid, false);
+        REQUIRE(test_sampler.sample_now() == make_error_code(errc::sample_collection_failure));
+        REQUIRE(!test_sampler);
+        REQUIRE(test_sampler.get_stats().recovery.count == 1);
+
+        // a later recovery succeeds, and sampling can be started again
+        REQUIRE(!test_sampler.recover_session());
+        REQUIRE(test_sampler);
+        REQUIRE(!test_sampler.start_sampling());
+        REQUIRE(!take_sample(test_sampler, 1));
+        REQUIRE(!test_sampler.is_after_recovery());
+        REQUIRE(!test_sampler.stop_sampling());
+    }
+
+    SECTION("A periodic session is started again") {
+        config.set_sampling_period(1000000);
+        config.set_session_recovery(1);
+        sampler_t test_sampler(config);
+        REQUIRE(test_sampler);
+        REQUIRE(!test_sampler.start_sampling());
+
+        EXPECT_CALL(reader_mock, ready_error, std::make_error_code(std::errc::io_error));
+        REQUIRE(test_sampler.collect_for(0) == make_error_code(errc::sample_not_ready));
+        REQUIRE(backend_periodic_sampler_mock::sampling_start_last_arg == 0);
+        REQUIRE(test_sampler.get_stats().recovery.count == 1);
+
+        REQUIRE(!test_sampler.collect_for(0));
+        REQUIRE(test_sampler.is_after_recovery());
+        REQUIRE(!test_sampler.stop_sampling());
+    }
+}
+
+TEST_CASE("SamplerMergesConsecutiveSamples__WhenSamplesAreCoalesced") {
+    sampler_config config{device::product_id::g31, 0};
+    REQUIRE(config.get_coalesced_samples() == 1);
+    config.set_coalesced_samples(3);
+    REQUIRE(config.get_coalesced_samples() == 3);
+    REQUIRE(!config.add_counter(MaliGPUActiveCy));
+
+    std::vector<block_metadata> blocks_list(1);
+    std::vector<uint32_t> values_fe(7, 0);
+    blocks_list[0] = {hwcnt::block_type::fe, values_fe.data()};
+
+    SECTION("Per instance values can't be merged") {
+        config.set_per_instance_values(true);
+        sampler_t test_sampler(config);
+        REQUIRE(!test_sampler);
+    }
+
+    SECTION("A merged sample spans its window") {
+        sampler_t test_sampler(config);
+        REQUIRE(test_sampler);
+        REQUIRE(!test_sampler.start_sampling());
+
+        hwcpipe::counter_sample sample{};
+        for (uint64_t i = 0; i != 3; ++i) {
+            sample_metadata metadata{};
+            metadata.sample_nr = i + 1;
+            metadata.timestamp_ns_begin = i * 100;
+            metadata.timestamp_ns_end = i * 100 + 100;
+            values_fe[6] = static_cast<uint32_t>(10 + i);
+            EXPECT_CALL(backend_sample_mock, get_metadata, metadata);
+            EXPECT_CALL(backend_sample_mock, blocks, blocks_list);
+            if (i != 2) {
+                REQUIRE(test_sampler.try_collect() == make_error_code(errc::sample_not_ready));
+                REQUIRE(test_sampler.get_counter_value(MaliGPUActiveCy, sample) ==
+                        make_error_code(errc::sample_collection_failure));
+            } else {
+                REQUIRE(!test_sampler.try_collect());
+            }
+        }
+
+        REQUIRE(!test_sampler.get_counter_value(MaliGPUActiveCy, sample));
+        REQUIRE(sample.value.uint64 == 10 + 11 + 12);
+        REQUIRE(test_sampler.get_sample_timestamp() == 0);
+        REQUIRE(test_sampler.get_sample_timestamp_end() == 300);
+        REQUIRE(test_sampler.get_stats().samples_taken == 3);
+        REQUIRE(test_sampler.get_stats().evaluation.count == 1);
+
+        // sample_now() takes a whole window, here with two empty samples
+        EXPECT_CALL(backend_sample_mock, blocks, blocks_list);
+        REQUIRE(!test_sampler.sample_now());
+        REQUIRE(!test_sampler.get_counter_value(MaliGPUActiveCy, sample));
+        REQUIRE(sample.value.uint64 == 12);
+        REQUIRE(test_sampler.get_stats().samples_taken == 6);
+
+        // an errored sample restarts the window
+        sample_metadata metadata{};
+        metadata.flags.error = 1;
+        EXPECT_CALL(backend_sample_mock, blocks, blocks_list);
+        REQUIRE(test_sampler.try_collect() == make_error_code(errc::sample_not_ready));
+        EXPECT_CALL(backend_sample_mock, get_metadata, metadata);
+        REQUIRE(test_sampler.try_collect() == make_error_code(errc::sample_collection_failure));
+        REQUIRE(test_sampler.try_collect() == make_error_code(errc::sample_not_ready));
+        REQUIRE(test_sampler.try_collect() == make_error_code(errc::sample_not_ready));
+        REQUIRE(!test_sampler.try_collect());
+        REQUIRE(!test_sampler.get_counter_value(MaliGPUActiveCy, sample));
+        REQUIRE(sample.value.uint64 == 0);
+
+        REQUIRE(!test_sampler.stop_sampling());
+    }
+}
+
+TEST_CASE("SamplerReadsTheFullSetAtTheSlowRate__WhenAMultiRatePlanIsSet") {
+    sampler_config config{device::product_id::g31, 0};
+    REQUIRE(config.get_slow_period() == 1);
+    REQUIRE(!config.add_counter(MaliFragQueueUtil));
+    REQUIRE(!config.add_counter(MaliFragActiveCy));
+    REQUIRE(!config.set_multi_rate({MaliGPUActiveCy, MaliExtBusRdBt}, 3));
+    REQUIRE(config.get_slow_period() == 3);
+    REQUIRE(config.get_fast_counters().size() == 2);
+
+    std::vector<uint32_t> values_fe(64, 0);
+    std::vector<uint32_t> values_memory(64, 0);
+    std::vector<uint32_t> values_core0(64, 0);
+    std::vector<uint32_t> values_core1(64, 0);
+    values_fe[6] = 100;   // MaliGPUActiveCy
+    values_fe[10] = 50;   // MaliFragQueueActiveCy
+    values_core0[4] = 10; // MaliFragActiveCy
+    values_core1[4] = 20;
+    const std::vector<block_metadata> blocks_list{
+        {hwcnt::block_type::fe, values_fe.data()},
+        {hwcnt::block_type::memory, values_memory.data()},
+        {hwcnt::block_type::core, values_core0.data(), 0},
+        {hwcnt::block_type::core, values_core1.data(), 1},
+    };
+
+    SECTION("Per instance values can't be combined with a multi-rate plan") {
+        config.set_per_instance_values(true);
+        sampler_t test_sampler(config);
+        REQUIRE(!test_sampler);
+    }
+
+    SECTION("The full set is summed over each window") {
+        sampler_t test_sampler(config);
+        REQUIRE(test_sampler);
+        REQUIRE(!test_sampler.start_sampling());
+
+        hwcpipe::counter_sample sample{};
+        const auto collect = [&](uint64_t i) {
+            sample_metadata metadata{};
+            metadata.sample_nr = i + 1;
+            values_memory[32] = static_cast<uint32_t>(i); // MaliExtBusRdBt
+            EXPECT_CALL(backend_sample_mock, get_metadata, metadata);
+            EXPECT_CALL(backend_sample_mock, blocks, blocks_list);
+            REQUIRE(!test_sampler.try_collect());
+
+            // the fast counters are read on every sample
+            REQUIRE(!test_sampler.get_counter_value(MaliGPUActiveCy, sample));
+            REQUIRE(sample.value.uint64 == 100);
+            REQUIRE(!test_sampler.get_counter_value(MaliExtBusRdBt, sample));
+            REQUIRE(sample.value.uint64 == i);
+        };
+
+        collect(0);
+        collect(1);
+        REQUIRE(!test_sampler.is_full_sample());
+        REQUIRE(!test_sampler.get_counter_value(MaliFragActiveCy, sample));
+        REQUIRE(sample.value.uint64 == 0);
+
+        collect(2);
+        REQUIRE(test_sampler.is_full_sample());
+        REQUIRE(!test_sampler.get_counter_value(MaliFragActiveCy, sample));
+        REQUIRE(sample.value.uint64 == 3 * (10 + 20));
+        // the expression reads the cycles of the window, not of the last sample
+        REQUIRE(!test_sampler.get_counter_value(MaliFragQueueUtil, sample));
+        REQUIRE(sample.value.float64 == Approx(50.0));
+        REQUIRE(test_sampler.get_stats().evaluation.count == 3);
+
+        // the full set keeps the values of its last window
+        values_core1[4] = 0;
+        collect(3);
+        REQUIRE(!test_sampler.is_full_sample());
+        REQUIRE(!test_sampler.get_counter_value(MaliFragActiveCy, sample));
+        REQUIRE(sample.value.uint64 == 90);
+
+        // a dropped sample restarts the window
+        sample_metadata metadata{};
+        metadata.flags.error = 1;
+        EXPECT_CALL(backend_sample_mock, get_metadata, metadata);
+        REQUIRE(test_sampler.try_collect() == make_error_code(errc::sample_collection_failure));
+        collect(5);
+        collect(6);
+        REQUIRE(!test_sampler.is_full_sample());
+        collect(7);
+        REQUIRE(test_sampler.is_full_sample());
+        REQUIRE(!test_sampler.get_counter_value(MaliFragActiveCy, sample));
+        REQUIRE(sample.value.uint64 == 30);
+
+        REQUIRE(!test_sampler.stop_sampling());
+    }
+}
+
+TEST_CASE("SamplerReportsTheSampleInterval__WhenTheBackendCountsCycles") {
+    sampler_config config{device::product_id::g31, 0};
+    REQUIRE(!config.add_counter(MaliGPUActiveCy));
+
+    std::vector<block_metadata> blocks_list(1);
+    std::vector<uint32_t> values_fe(7, 0);
+    blocks_list[0] = {hwcnt::block_type::fe, values_fe.data()};
+
+    const auto default_features = mock::reader_mock::features;
+    const bool has_cycles = GENERATE(false, true);
+    mock::reader_mock::features.has_gpu_cycle = has_cycles;
+    mock::reader_mock::features.has_sc_cycle = has_cycles;
+
+    const auto coalesced = GENERATE(size_t{1}, size_t{2});
+    config.set_coalesced_samples(coalesced);
+
+    sampler_t test_sampler(config);
+    REQUIRE(test_sampler);
+    REQUIRE(test_sampler.get_features().has_gpu_cycle == has_cycles);
+    REQUIRE(!test_sampler.start_sampling());
+
+    for (uint64_t i = 0; i != 2; ++i) {
+        sample_metadata metadata{};
+        metadata.sample_nr = i + 1;
+        metadata.timestamp_ns_begin = i * 1000;
+        metadata.timestamp_ns_end = i * 1000 + 1000;
+        metadata.gpu_cycle = 500 + i;
+        metadata.sc_cycle = 400 + i;
+        EXPECT_CALL(backend_sample_mock, get_metadata, metadata);
+        EXPECT_CALL(backend_sample_mock, blocks, blocks_list);
+        auto ec = test_sampler.try_collect();
+        REQUIRE((ec == make_error_code(errc::sample_not_ready)) == (coalesced == 2 && i == 0));
+    }
+
+    const auto interval = test_sampler.get_sample_interval();
+    REQUIRE(interval.timestamp_ns_begin == test_sampler.get_sample_timestamp());
+    REQUIRE(interval.timestamp_ns_end == test_sampler.get_sample_timestamp_end());
+    if (coalesced == 1) {
+        REQUIRE(interval.duration_ns() == 1000);
+        REQUIRE(interval.gpu_cycles == (has_cycles ? 501 : 0));
+        REQUIRE(interval.sc_cycles == (has_cycles ? 401 : 0));
+    } else {
+        REQUIRE(interval.duration_ns() == 2000);
+        REQUIRE(interval.gpu_cycles == (has_cycles ? 1001 : 0));
+        REQUIRE(interval.sc_cycles == (has_cycles ? 801 : 0));
+    }
+    REQUIRE(interval.gpu_frequency() ==
+            Approx(has_cycles ? static_cast<double>(interval.gpu_cycles) * 1e9 / interval.duration_ns() : 0.0));
+
+    REQUIRE(!test_sampler.stop_sampling());
+    mock::reader_mock::features = default_features;
+}
+
+TEST_CASE("SamplerConvertsSampleTimestamps__WhenAClockDomainIsSelected") {
+    sampler_config config{device::product_id::g31, 0};
+    REQUIRE(!config.add_counter(MaliGPUActiveCy));
+    config.set_clock_domain(clock_domain::monotonic);
+    REQUIRE(config.get_clock_domain() == clock_domain::monotonic);
+
+    std::vector<block_metadata> blocks_list(1);
+    std::vector<uint32_t> values_fe(7, 0);
+    blocks_list[0] = {hwcnt::block_type::fe, values_fe.data()};
+
+    sampler_t test_sampler(config);
+    REQUIRE(test_sampler);
+    REQUIRE(!test_sampler.start_sampling());
+
+    const uint64_t raw_ns = clock_correlator::read_clock(CLOCK_MONOTONIC_RAW);
+    sample_metadata metadata{};
+    metadata.sample_nr = 1;
+    metadata.timestamp_ns_begin = raw_ns - 1000000;
+    metadata.timestamp_ns_end = raw_ns;
+    EXPECT_CALL(backend_sample_mock, get_metadata, metadata);
+    EXPECT_CALL(backend_sample_mock, blocks, blocks_list);
+    REQUIRE(!test_sampler.try_collect());
+
+    const auto &correlator = test_sampler.get_clock_correlator();
+    REQUIRE(correlator.calibrated());
+    REQUIRE(test_sampler.get_sample_timestamp() == correlator.convert(metadata.timestamp_ns_begin));
+    REQUIRE(test_sampler.get_sample_timestamp_end() == correlator.convert(metadata.timestamp_ns_end));
+    REQUIRE(test_sampler.get_sample_interval().duration_ns() == 1000000);
+    REQUIRE(!test_sampler.stop_sampling());
+}
+
+TEST_CASE("SamplerTagsSamples__WhenUserDataIsGiven") {
+    sampler_config config{device::product_id::g31, 0};
+    REQUIRE(!config.add_counter(MaliGPUActiveCy));
+
+    std::vector<block_metadata> blocks_list(1);
+    std::vector<uint32_t> values_fe(7, 0);
+    blocks_list[0] = {hwcnt::block_type::fe, values_fe.data()};
+
+    SECTION("Manual samples") {
+        sampler_t test_sampler(config);
+        REQUIRE(test_sampler);
+        REQUIRE(!test_sampler.start_sampling());
+        REQUIRE(test_sampler.get_sample_user_data() == 0);
+
+        sample_metadata metadata{};
+        metadata.user_data = 42;
+        EXPECT_CALL(backend_sample_mock, get_metadata, metadata);
+        EXPECT_CALL(backend_sample_mock, blocks, blocks_list);
+        REQUIRE(!test_sampler.sample_now(42));
+        REQUIRE(backend_manual_sampler_mock::request_sample_last_arg == 42);
+        REQUIRE(test_sampler.get_sample_user_data() == 42);
+
+        REQUIRE(!test_sampler.request_sample_async(43));
+        REQUIRE(backend_manual_sampler_mock::request_sample_async_last_arg == 43);
+
+        REQUIRE(!test_sampler.stop_sampling(44));
+        REQUIRE(backend_manual_sampler_mock::accumulation_stop_last_arg == 44);
+    }
+
+    SECTION("Periodic samples") {
+        config.set_sampling_period(1000000);
+        sampler_t test_sampler(config);
+        REQUIRE(test_sampler);
+        REQUIRE(!test_sampler.start_sampling(7));
+        REQUIRE(backend_periodic_sampler_mock::sampling_start_last_arg == 7);
+        REQUIRE(!test_sampler.stop_sampling(8));
+        REQUIRE(backend_periodic_sampler_mock::sampling_stop_last_arg == 8);
+    }
+}
+
+TEST_CASE("SamplerSkipsIdleSamples__WhenIdleSkipIsEnabled") {
+    sampler_config config{device::product_id::g31, 0};
+    config.set_expression_evaluation(sampler_config::expression_evaluation::eager);
+    REQUIRE(!config.get_idle_skip());
+    REQUIRE(!config.set_idle_skip(true));
+    REQUIRE(config.get_idle_skip());
+    REQUIRE(!config.add_counter(MaliTilerUtil));
+
+    // the gating counter is added to the config
+    REQUIRE(config.get_valid_counters().size() == 3);
+
+    std::vector<block_metadata> blocks_list(2);
+    std::vector<uint32_t> values_fe(7);
+    std::vector<uint32_t> values_tiler(5);
+    values_tiler[4] = 4; // MaliTilerActiveCy
+    blocks_list[0] = {hwcnt::block_type::fe, values_fe.data()};
+    blocks_list[1] = {hwcnt::block_type::tiler, values_tiler.data()};
+
+    sampler_t test_sampler(config);
+    REQUIRE(test_sampler);
+    REQUIRE(!test_sampler.start_sampling());
+    REQUIRE(!test_sampler.is_idle());
+    REQUIRE(test_sampler.get_idle_span().num_samples == 0);
+
+    hwcpipe::counter_sample sample{};
+    auto collect = [&](uint64_t i, uint32_t active_cycles) {
+        sample_metadata metadata{};
+        metadata.sample_nr = i + 1;
+        metadata.timestamp_ns_begin = i * 100;
+        metadata.timestamp_ns_end = i * 100 + 100;
+        values_fe[6] = active_cycles; // MaliGPUActiveCy
+        EXPECT_CALL(backend_sample_mock, get_metadata, metadata);
+        EXPECT_CALL(backend_sample_mock, blocks, blocks_list);
+        REQUIRE(!test_sampler.try_collect());
+    };
+
+    collect(0, 2);
+    REQUIRE(!test_sampler.is_idle());
+    REQUIRE(!test_sampler.get_counter_value(MaliTilerUtil, sample));
+    REQUIRE(sample.value.float64 == (4.0 / 2.0) * 100.0);
+
+    // the idle samples aren't decoded: the tiler block is ignored
+    for (uint64_t i = 1; i != 4; ++i) {
+        collect(i, 0);
+    }
+    REQUIRE(test_sampler.is_idle());
+    REQUIRE(test_sampler.get_idle_span().num_samples == 3);
+    REQUIRE(test_sampler.get_idle_span().timestamp_ns_begin == 100);
+    REQUIRE(test_sampler.get_idle_span().timestamp_ns_end == 400);
+    REQUIRE(test_sampler.get_sample_timestamp() == 300);
+    REQUIRE(!test_sampler.get_counter_value(MaliTilerActiveCy, sample));
+    REQUIRE(sample.value.uint64 == 0);
+
+    // the expressions are evaluated for the first idle sample only
+    const auto stats = test_sampler.get_stats();
+    REQUIRE(stats.samples_taken == 4);
+    REQUIRE(stats.samples_idle == 3);
+    REQUIRE(stats.evaluation.count == 2);
+
+    // an active sample ends the span
+    collect(4, 2);
+    REQUIRE(!test_sampler.is_idle());
+    REQUIRE(test_sampler.get_idle_span().num_samples == 3);
+    REQUIRE(!test_sampler.get_counter_value(MaliTilerActiveCy, sample));
+    REQUIRE(sample.value.uint64 == 4);
+
+    collect(5, 0);
+    REQUIRE(test_sampler.get_idle_span().num_samples == 1);
+    REQUIRE(test_sampler.get_idle_span().timestamp_ns_begin == 500);
+    REQUIRE(!test_sampler.stop_sampling());
+}
+
+TEST_CASE("SamplerSkipsInactiveBlocks__WhenTheBackendReportsBlockStates") {
+    sampler_config config{device::product_id::g31, 0};
+    REQUIRE(!config.add_counter(MaliGPUActiveCy));
+    REQUIRE(!config.add_counter(MaliFragActiveCy));
+
+    std::vector<uint32_t> values_fe(10, 0);
+    std::vector<uint32_t> values_core0(10, 0);
+    std::vector<uint32_t> values_core1(10, 0);
+    std::vector<uint32_t> values_core2(10, 0);
+    values_fe[6] = 100;   // MaliGPUActiveCy
+    values_core0[4] = 10; // MaliFragActiveCy
+    values_core1[4] = 20;
+    values_core2[4] = 40;
+
+    // core 1 was powered off and core 2 in protected mode for the whole sample
+    hwcnt::block_state active{};
+    active.on = 1;
+    active.available = 1;
+    active.normal = 1;
+    hwcnt::block_state powered_off = active;
+    powered_off.on = 0;
+    powered_off.off = 1;
+    hwcnt::block_state protected_mode = active;
+    protected_mode.normal = 0;
+    protected_mode.protected_mode = 1;
+
+    const std::vector<block_metadata> blocks_list{
+        {hwcnt::block_type::fe, values_fe.data(), 0, active},
+        {hwcnt::block_type::core, values_core0.data(), 0, active},
+        {hwcnt::block_type::core, values_core1.data(), 1, powered_off},
+        {hwcnt::block_type::core, values_core2.data(), 2, protected_mode},
+    };
+
+    const auto default_features = mock::reader_mock::features;
+    const bool has_states = GENERATE(false, true);
+    mock::reader_mock::features.has_power_states = has_states;
+    mock::reader_mock::features.has_vm_states = has_states;
+    mock::reader_mock::features.has_protection_states = has_states;
+
+    sampler_t test_sampler(config);
+    REQUIRE(test_sampler);
+    REQUIRE(!test_sampler.start_sampling());
+    REQUIRE(test_sampler.get_active_instances(hwcnt::block_type::core) == 0);
+
+    EXPECT_CALL(backend_sample_mock, blocks, blocks_list);
+    REQUIRE(!test_sampler.sample_now());
+
+    hwcpipe::counter_sample sample{};
+    REQUIRE(!test_sampler.get_counter_value(MaliFragActiveCy, sample));
+    REQUIRE(test_sampler.get_active_instances(hwcnt::block_type::fe) == 1);
+    REQUIRE(test_sampler.get_active_instances(hwcnt::block_type::tiler) == 0);
+    if (has_states) {
+        // the blocks that hold no data are neither decoded nor counted
+        REQUIRE(sample.value.uint64 == 10);
+        REQUIRE(test_sampler.get_active_instances(hwcnt::block_type::core) == 1);
+    } else {
+        REQUIRE(sample.value.uint64 == 70);
+        REQUIRE(test_sampler.get_active_instances(hwcnt::block_type::core) == 3);
+    }
+
+    REQUIRE(!test_sampler.stop_sampling());
+    mock::reader_mock::features = default_features;
+}
+
+TEST_CASE("SamplerSalvagesErroneousSamples__WhenTheBackendReportsBlockStates") {
+    sampler_config config{device::product_id::g31, 0};
+    REQUIRE(!config.add_counter(MaliGPUActiveCy));
+    REQUIRE(!config.add_counter(MaliFragActiveCy));
+    config.set_drop_policy(sampler_config::drop_policy::salvage);
+
+    std::vector<uint32_t> values_fe(10, 0);
+    std::vector<uint32_t> values_core0(10, 0);
+    std::vector<uint32_t> values_core1(10, 0);
+    values_fe[6] = 100;   // MaliGPUActiveCy
+    values_core0[4] = 10; // MaliFragActiveCy
+    values_core1[4] = 20;
+
+    // core 1 was powered off for part of the sample
+    hwcnt::block_state active{};
+    active.on = 1;
+    active.available = 1;
+    active.normal = 1;
+    hwcnt::block_state power_cycled = active;
+    power_cycled.off = 1;
+
+    const std::vector<block_metadata> blocks_list{
+        {hwcnt::block_type::fe, values_fe.data(), 0, active},
+        {hwcnt::block_type::core, values_core0.data(), 0, active},
+        {hwcnt::block_type::core, values_core1.data(), 1, power_cycled},
+    };
+
+    const auto default_features = mock::reader_mock::features;
+    const bool has_states = GENERATE(false, true);
+    mock::reader_mock::features.has_power_states = has_states;
+    mock::reader_mock::features.has_vm_states = has_states;
+    mock::reader_mock::features.has_protection_states = has_states;
+
+    sampler_t test_sampler(config);
+    REQUIRE(test_sampler);
+    REQUIRE(!test_sampler.start_sampling());
+
+    sample_metadata metadata{};
+    metadata.sample_nr = 1;
+    metadata.flags.error = 1;
+    EXPECT_CALL(backend_sample_mock, get_metadata, metadata);
+    EXPECT_CALL(backend_sample_mock, blocks, blocks_list);
+    const auto ec = test_sampler.sample_now();
+    REQUIRE(test_sampler.get_stats().samples_errored == 1);
+
+    hwcpipe::counter_sample sample{};
+    if (has_states) {
+        // only the blocks valid for the whole sample are decoded
+        REQUIRE(!ec);
+        REQUIRE(test_sampler.get_sample_flags().error);
+        REQUIRE(!test_sampler.get_counter_value(MaliFragActiveCy, sample));
+        REQUIRE(sample.value.uint64 == 10);
+        REQUIRE(test_sampler.get_active_instances(hwcnt::block_type::core) == 1);
+    } else {
+        REQUIRE(ec == make_error_code(errc::sample_collection_failure));
+    }
+
+    // the next sample is decoded whole
+    metadata.sample_nr = 2;
+    metadata.flags.error = 0;
+    EXPECT_CALL(backend_sample_mock, get_metadata, metadata);
+    EXPECT_CALL(backend_sample_mock, blocks, blocks_list);
+    REQUIRE(!test_sampler.sample_now());
+    REQUIRE(!test_sampler.get_sample_flags().error);
+    REQUIRE(!test_sampler.get_counter_value(MaliFragActiveCy, sample));
+    REQUIRE(sample.value.uint64 == 30);
+
+    REQUIRE(!test_sampler.stop_sampling());
+    mock::reader_mock::features = default_features;
+}
+
+TEST_CASE("SamplerSkipsManualDumps__WhenTheGpuIsPoweredDown") {
+    sampler_config config{device::product_id::g31, 0};
+    REQUIRE(!config.add_counter(MaliGPUActiveCy));
+    config.set_power_aware(true, 2);
+
+    std::vector<uint32_t> values_fe(10, 0);
+    values_fe[6] = 100; // MaliGPUActiveCy
+
+    hwcnt::block_state powered_off{};
+    powered_off.off = 1;
+    powered_off.available = 1;
+    powered_off.normal = 1;
+    const std::vector<block_metadata> blocks_list{
+        {hwcnt::block_type::fe, values_fe.data(), 0, powered_off},
+    };
+
+    const auto default_features = mock::reader_mock::features;
+    mock::reader_mock::features.has_power_states = true;
+
+    sample_metadata metadata{};
+    metadata.sample_nr = 1;
+    metadata.timestamp_ns_begin = 1000;
+    metadata.timestamp_ns_end = 2000;
+    hwcpipe::counter_sample sample{};
+
+    SECTION("From the block states") {
+        sampler_t test_sampler(config);
+        REQUIRE(test_sampler);
+        REQUIRE(!test_sampler.start_sampling());
+
+        // the first sample is always dumped
+        EXPECT_CALL(backend_sample_mock, get_metadata, metadata);
+        EXPECT_CALL(backend_sample_mock, blocks, blocks_list);
+        REQUIRE(!test_sampler.sample_now(1));
+        REQUIRE(backend_manual_sampler_mock::request_sample_last_arg == 1);
+
+        // the GPU was powered off for all of it, so the next ones are not
+        REQUIRE(!test_sampler.sample_now(2));
+        REQUIRE(!test_sampler.sample_now(3));
+        REQUIRE(backend_manual_sampler_mock::request_sample_last_arg == 1);
+        REQUIRE(test_sampler.get_stats().dumps_avoided == 2);
+        REQUIRE(test_sampler.get_sample_user_data() == 3);
+        REQUIRE(!test_sampler.get_counter_value(MaliGPUActiveCy, sample));
+        REQUIRE(sample.value.uint64 == 0);
+
+        // after max_skipped_dumps dumps in a row the counters are dumped
+        EXPECT_CALL(backend_sample_mock, get_metadata, metadata);
+        EXPECT_CALL(backend_sample_mock, blocks, blocks_list);
+        REQUIRE(!test_sampler.sample_now(4));
+        REQUIRE(backend_manual_sampler_mock::request_sample_last_arg == 4);
+        REQUIRE(test_sampler.get_stats().dumps_avoided == 2);
+        REQUIRE(!test_sampler.stop_sampling());
+    }
+
+    SECTION("From a power probe") {
+        bool suspended = false;
+        config.set_power_probe([](void *user_data) { return *static_cast<bool *>(user_data); }, &suspended);
+        sampler_t test_sampler(config);
+        REQUIRE(test_sampler);
+        REQUIRE(!test_sampler.start_sampling());
+
+        EXPECT_CALL(backend_sample_mock, get_metadata, metadata);
+        EXPECT_CALL(backend_sample_mock, blocks, blocks_list);
+        REQUIRE(!test_sampler.sample_now(1));
+
+        // the probe overrides the block states
+        EXPECT_CALL(backend_sample_mock, get_metadata, metadata);
+        EXPECT_CALL(backend_sample_mock, blocks, blocks_list);
+        REQUIRE(!test_sampler.sample_now(2));
+        REQUIRE(backend_manual_sampler_mock::request_sample_last_arg == 2);
+
+        suspended = true;
+        REQUIRE(!test_sampler.sample_now(3));
+        REQUIRE(backend_manual_sampler_mock::request_sample_last_arg == 2);
+        REQUIRE(test_sampler.get_stats().dumps_avoided == 1);
+        REQUIRE(!test_sampler.stop_sampling());
+    }
+
+    mock::reader_mock::features = default_features;
+}
+
+TEST_CASE("SamplerReadsRawBlockCounters__WhenTheyAreRequested") {
+    sampler_config config{device::product_id::g31, 0};
+    REQUIRE(!config.add_counter(MaliGPUActiveCy));
+    REQUIRE(config.add_block_counter(hwcnt::block_type::csg, 128) ==
+            make_error_code(errc::invalid_counter_for_device));
+    REQUIRE(!config.add_block_counter(hwcnt::block_type::csg, 3));
+    REQUIRE(!config.add_block_counter(hwcnt::block_type::csg, 5));
+    REQUIRE(!config.add_block_counter(hwcnt::block_type::firmware, 1));
+    REQUIRE(!config.add_block_counter(hwcnt::block_type::csg, 3));
+    REQUIRE(config.get_block_counters().size() == 3);
+
+    SECTION("Per CSG values") {
+        std::vector<uint32_t> values_fe(10, 0);
+        std::vector<uint32_t> values_csg0(10, 0);
+        std::vector<uint32_t> values_csg2(10, 0);
+        std::vector<uint32_t> values_fw(10, 0);
+        values_fe[6] = 100; // MaliGPUActiveCy
+        values_csg0[3] = 30;
+        values_csg0[5] = 50;
+        values_csg2[3] = 32;
+        values_fw[1] = 7;
+
+        const std::vector<block_metadata> blocks_list{
+            {hwcnt::block_type::fe, values_fe.data(), 0},
+            {hwcnt::block_type::csg, values_csg0.data(), 0},
+            {hwcnt::block_type::csg, values_csg2.data(), 2},
+            {hwcnt::block_type::firmware, values_fw.data(), 0},
+        };
+
+        sampler_t test_sampler(config);
+        REQUIRE(test_sampler);
+        REQUIRE(!test_sampler.start_sampling());
+
+        const uint64_t *values{};
+        size_t num_instances{};
+        REQUIRE(test_sampler.get_block_counter_values(hwcnt::block_type::csg, 3, values, num_instances) ==
+                make_error_code(errc::sample_collection_failure));
+
+        EXPECT_CALL(backend_sample_mock, blocks, blocks_list);
+        REQUIRE(!test_sampler.sample_now());
+
+        REQUIRE(!test_sampler.get_block_counter_values(hwcnt::block_type::csg, 3, values, num_instances));
+        REQUIRE(num_instances == block_extents_mock::num_blocks());
+        REQUIRE(values[0] == 30);
+        REQUIRE(values[1] == 0);
+        REQUIRE(values[2] == 32);
+
+        REQUIRE(!test_sampler.get_block_counter_values(hwcnt::block_type::csg, 5, values, num_instances));
+        REQUIRE(values[0] == 50);
+        REQUIRE(!test_sampler.get_block_counter_values(hwcnt::block_type::firmware, 1, values, num_instances));
+        REQUIRE(values[0] == 7);
+        REQUIRE(test_sampler.get_block_counter_values(hwcnt::block_type::csg, 4, values, num_instances) ==
+                make_error_code(errc::unknown_counter));
+
+        // the decoded counters are unchanged
+        hwcpipe::counter_sample sample{};
+        REQUIRE(!test_sampler.get_counter_value(MaliGPUActiveCy, sample));
+        REQUIRE(sample.value.uint64 == 100);
+        REQUIRE(test_sampler.get_active_instances(hwcnt::block_type::csg) == 2);
+        REQUIRE(!test_sampler.stop_sampling());
+    }
+
+    SECTION("Offset out of the blocks of the GPU") {
+        REQUIRE(!config.add_block_counter(hwcnt::block_type::csg, block_extents_mock::num_counters_per_block()));
+        sampler_t test_sampler(config);
+        REQUIRE(!test_sampler);
+    }
+}
+
+TEST_CASE("SamplerDecodesBlockTypes__WhenTheirCountersAreFirstRead") {
+    sampler_config config{device::product_id::g31, 0};
+    REQUIRE(!config.get_lazy_decode());
+    config.set_lazy_decode(true);
+    REQUIRE(config.get_lazy_decode());
+    REQUIRE(!config.add_counter(MaliGPUActiveCy));
+    REQUIRE(!config.add_counter(MaliTilerUtil));
+
+    SECTION("Incompatible with per instance values") {
+        config.set_per_instance_values(true);
+        sampler_t test_sampler(config);
+        REQUIRE(!test_sampler);
+    }
+
+    SECTION("Read values") {
+        // the blocks are copied whole
+        std::vector<block_metadata> blocks_list(2);
+        std::vector<uint32_t> values_tiler(block_extents_mock::num_counters_per_block());
+        std::vector<uint32_t> values_fe(block_extents_mock::num_counters_per_block());
+        blocks_list[0] = {hwcnt::block_type::fe, values_fe.data()};
+        blocks_list[1] = {hwcnt::block_type::tiler, values_tiler.data()};
+
+        sampler_t test_sampler(config);
+        REQUIRE(test_sampler);
+        REQUIRE(!test_sampler.start_sampling());
+        const auto list = [&] {
+            std::error_code ec;
+            const hwcpipe_counter counters[] = {MaliGPUActiveCy};
+            auto result = test_sampler.make_read_list(counters, 1, ec);
+            REQUIRE(!ec);
+            return result;
+        }();
+
+        for (uint32_t i = 1; i != 3; ++i) {
+            values_tiler[4] = 4 * i; // MaliTilerActiveCy
+            values_fe[6] = 8 * i;    // MaliGPUActiveCy
+            EXPECT_CALL(backend_sample_mock, blocks, blocks_list);
+            REQUIRE(!test_sampler.sample_now());
+            REQUIRE(test_sampler.get_stats().lazy_decodes == 2 * (i - 1));
+
+            // the kernel sample was released, the copies are read
+            values_tiler[4] = 0;
+            values_fe[6] = 0;
+
+            double value{};
+            REQUIRE(!test_sampler.get_counter_values(list, &value, 1));
+            REQUIRE(value == 8.0 * i);
+            REQUIRE(test_sampler.get_stats().lazy_decodes == 2 * i - 1);
+            REQUIRE(!test_sampler.get_counter_values(list, &value, 1));
+            REQUIRE(test_sampler.get_stats().lazy_decodes == 2 * i - 1);
+
+            // the expression reads the tiler block, which is decoded then
+            counter_sample sample{};
+            REQUIRE(!test_sampler.get_counter_value(MaliTilerUtil, sample));
+            REQUIRE(sample.value.float64 == (4.0 / 8.0) * 100.0);
+            REQUIRE(test_sampler.get_stats().lazy_decodes == 2 * i);
+        }
+        REQUIRE(!test_sampler.stop_sampling());
+    }
+}
+
+TEST_CASE("SamplerDetectsSaturatedCounters__WhenSaturationCheckIsEnabled") {
+    sampler_config config{device::product_id::g31, 0};
+    REQUIRE(!config.get_saturation_check());
+    config.set_saturation_check(true);
+    REQUIRE(config.get_saturation_check());
+    REQUIRE(!config.add_counter(MaliGPUActiveCy));
+
+    std::vector<block_metadata> blocks_list(1);
+    std::vector<uint32_t> values_fe(7);
+    // not gathered, so never reported
+    values_fe[0] = UINT32_MAX;
+    blocks_list[0] = {hwcnt::block_type::fe, values_fe.data()};
+
+    sampler_t test_sampler(config);
+    REQUIRE(test_sampler);
+    REQUIRE(!test_sampler.start_sampling());
+    REQUIRE(test_sampler.get_max_sampling_period() == 0);
+
+    auto collect = [&](uint64_t i, uint32_t active_cycles) {
+        sample_metadata metadata{};
+        metadata.sample_nr = i + 1;
+        metadata.timestamp_ns_begin = i * 1000;
+        metadata.timestamp_ns_end = i * 1000 + 1000;
+        values_fe[6] = active_cycles; // MaliGPUActiveCy
+        EXPECT_CALL(backend_sample_mock, get_metadata, metadata);
+        EXPECT_CALL(backend_sample_mock, blocks, blocks_list);
+        REQUIRE(!test_sampler.try_collect());
+    };
+
+    // 2^16 cycles per microsecond would saturate after 2^16 microseconds
+    collect(0, 1U << 16U);
+    REQUIRE(!test_sampler.is_saturated());
+    REQUIRE(test_sampler.get_max_sampling_period() == 65535999);
+
+    // the fastest rate is kept
+    collect(1, 1U << 8U);
+    REQUIRE(test_sampler.get_max_sampling_period() == 65535999);
+
+    collect(2, UINT32_MAX);
+    REQUIRE(test_sampler.is_saturated());
+    REQUIRE(test_sampler.get_max_sampling_period() == 1000);
+    REQUIRE(test_sampler.get_stats().samples_saturated == 1);
+
+    collect(3, 1);
+    REQUIRE(!test_sampler.is_saturated());
+    REQUIRE(!test_sampler.stop_sampling());
+
+    // a new session starts over
+    REQUIRE(!test_sampler.start_sampling());
+    REQUIRE(test_sampler.get_max_sampling_period() == 0);
+    REQUIRE(!test_sampler.stop_sampling());
+}
+
+TEST_CASE("SamplerPassesRawBlocks__WhenSampledRaw") {
+    sampler_config config{device::product_id::g31, 0};
+    REQUIRE(!config.add_counter(MaliGPUActiveCy));
+
+    std::vector<block_metadata> blocks_list(2);
+    std::vector<uint32_t> values_fe(7);
+    std::vector<uint32_t> values_tiler(5);
+    values_fe[6] = 0xFEFE; // MaliGPUActiveCy
+    blocks_list[0] = {hwcnt::block_type::fe, values_fe.data()};
+    blocks_list[1] = {hwcnt::block_type::tiler, values_tiler.data()};
+
+    sampler_t test_sampler(config);
+    REQUIRE(test_sampler);
+    REQUIRE(!test_sampler.start_sampling());
+
+    EXPECT_CALL(backend_sample_mock, blocks, blocks_list);
+    REQUIRE(!test_sampler.sample_now());
+
+    // the raw blocks are the kernel's, and the sample buffer is unchanged
+    values_fe[6] = 1;
+    std::vector<const void *> values{};
+    EXPECT_CALL(backend_sample_mock, blocks, blocks_list);
+    REQUIRE(!test_sampler.sample_raw([&](const sample_metadata &, const std::vector<block_metadata> &blocks) {
+        for (const auto &block : blocks) {
+            values.push_back(block.values);
+        }
+    }));
+    REQUIRE(values == std::vector<const void *>{values_fe.data(), values_tiler.data()});
+
+    hwcpipe::counter_sample sample{};
+    REQUIRE(!test_sampler.get_counter_value(MaliGPUActiveCy, sample));
+    REQUIRE(sample.value.uint64 == 0xFEFE);
+    REQUIRE(test_sampler.get_stats().samples_taken == 1);
+
+    // erroneous samples aren't passed to the callback
+    sample_metadata metadata{};
+    metadata.flags.error = 1;
+    EXPECT_CALL(backend_sample_mock, get_metadata, metadata);
+    bool called = false;
+    REQUIRE(test_sampler.sample_raw([&](const sample_metadata &, const std::vector<block_metadata> &) {
+        called = true;
+    }) == make_error_code(errc::sample_collection_failure));
+    REQUIRE(!called);
+    REQUIRE(!test_sampler.stop_sampling());
+
+    REQUIRE(test_sampler.sample_raw([](const sample_metadata &, const std::vector<block_metadata> &) {}) ==
+            make_error_code(errc::sampling_not_started));
+}
+
+TEST_CASE("SamplerConfigBufferCount__WhenSet__IsKept") {
+    sampler_config config{device::product_id::g31, 0};
+    REQUIRE(config.get_buffer_count() == 0);
+    config.set_buffer_count(64);
+    REQUIRE(config.get_buffer_count() == 64);
+    REQUIRE(!config.add_counter(MaliGPUActiveCy));
+
+    sampler_t test_sampler(config);
+    REQUIRE(test_sampler);
+
+    // the mocked reader reports no features
+    REQUIRE(test_sampler.get_features().buffer_count == 0);
+    REQUIRE(test_sampler.get_features().overflow_behavior_defined);
+}
+
+TEST_CASE("SamplerRecommendsBuffering__FromTheObservedBacklog") {
+    sampler_config config{device::product_id::g31, 0};
+    config.set_sampling_period(1000000);
+    REQUIRE(!config.add_counter(MaliGPUActiveCy));
+
+    sampler_t test_sampler(config);
+    REQUIRE(test_sampler);
+    REQUIRE(!test_sampler.start_sampling());
+
+    // nothing observed, keep the backend default
+    REQUIRE(test_sampler.recommend_buffering().buffer_count == 0);
+    REQUIRE(test_sampler.recommend_buffering().batch_size == 1);
+
+    const auto take_sample = [&](uint64_t sample_nr, uint32_t backlog) {
+        sample_metadata metadata{};
+        metadata.sample_nr = sample_nr;
+        metadata.backlog = backlog;
+        EXPECT_CALL(backend_sample_mock, get_metadata, metadata);
+        return test_sampler.sample_now();
+    };
+
+    REQUIRE(!take_sample(1, 1));
+    REQUIRE(!take_sample(2, 5));
+    REQUIRE(!take_sample(3, 2));
+    REQUIRE(test_sampler.get_max_backlog() == 5);
+    REQUIRE(test_sampler.get_stats().max_backlog == 5);
+
+    // a free buffer on top of the backlog, rounded up to a power of two
+    auto buffering = test_sampler.recommend_buffering();
+    REQUIRE(buffering.buffer_count == 8);
+    REQUIRE(buffering.batch_size == 5);
+
+    // the backlog was capped by the buffer when samples were dropped
+    REQUIRE(!take_sample(10, 8));
+    buffering = test_sampler.recommend_buffering();
+    REQUIRE(buffering.buffer_count == 16);
+    REQUIRE(buffering.batch_size == 8);
+
+    // the backlog is tracked per session
+    REQUIRE(!test_sampler.stop_sampling());
+    REQUIRE(!test_sampler.start_sampling());
+    REQUIRE(test_sampler.get_max_backlog() == 0);
+    REQUIRE(test_sampler.get_stats().max_backlog == 8);
+    REQUIRE(!test_sampler.stop_sampling());
+}
+
+TEST_CASE("SamplerReportsCorrectErrorCode__WhenStopSamplingIsCalled") {
+    sampler_config config(device::product_id::g31, 0);
+    auto ec = config.add_counter(hwcpipe_counter::MaliGPUActiveCy);
+    REQUIRE(!ec);
+
+    sampler_t test_sampler(config);
+    REQUIRE(test_sampler);
+
+    SECTION("Stop Sampling is called without sampling started") {
+        auto ec = test_sampler.stop_sampling();
+        REQUIRE(ec == make_error_code(errc::sampling_not_started));
+    }
+
+    SECTION("Stop Sampling is called after sampling started") {
+        auto ec = test_sampler.start_sampling();
+        REQUIRE(!ec);
+
+        ec = test_sampler.stop_sampling();
+        REQUIRE(!ec);
+    }
+
+    SECTION("Stop Sampling is called twice after sampling started") {
+        auto ec = test_sampler.start_sampling();
+        REQUIRE(!ec);
+
+        ec = test_sampler.stop_sampling();
+        REQUIRE(!ec);
+
+        ec = test_sampler.stop_sampling();
+        REQUIRE(ec == make_error_code(errc::sampling_not_started));
+    }
+
+    SECTION("Stop Sampling can't stop backend accumulation") {
+        auto ec = test_sampler.start_sampling();
+        REQUIRE(!ec);
+
+        EXPECT_CALL(backend_manual_sampler_mock, accumulation_stop, //
+                    std::make_error_code(std::errc::invalid_argument));
+
+        ec = test_sampler.stop_sampling();
+        REQUIRE(ec == make_error_code(errc::accumulation_stop_failed));
+    }
+
+    SECTION("Sample now is called after sampling stop") {
+        auto ec = test_sampler.start_sampling();
+        REQUIRE(!ec);
+
+        ec = test_sampler.stop_sampling();
+        REQUIRE(!ec);
+
+        ec = test_sampler.sample_now();
+        REQUIRE(ec == make_error_code(errc::sampling_not_started));
+    }
+}
+
+TEST_CASE("SamplerReportsCorrectErrorCode__WhenGetCounterValueIsCalled") {
+    using counter_offset_pair = std::pair<hwcpipe_counter, uint32_t>;
+
+    counter_offset_pair c1_fe = {MaliGPUActiveCy, 6};
+    counter_offset_pair c2_core = {MaliFragActiveCy, 4};
+
+    std::vector<block_metadata> blocks_list(3);
+    std::vector<uint32_t> values_fe(10, 0);
+    std::vector<uint32_t> values_core0(10, 0);
+    std::vector<uint32_t> values_core1(10, 0);
+
+    values_fe[c1_fe.second] = 0xFEFE;
+    values_core0[c2_core.second] = 0xC0C0;
+    values_core1[c2_core.second] = 0x0C0C;
+
+    sampler_config config(device::product_id::g31, 0);
+    auto ec = config.add_counter(c1_fe.first);
+    REQUIRE(!ec);
+    ec = config.add_counter(c2_core.first);
+    REQUIRE(!ec);
+
+    sampler_t test_sampler(config);
+    ec = test_sampler.start_sampling();
+    REQUIRE(!ec);
+
+    SECTION("Reading registered counters") {
+        blocks_list[0] = {hwcnt::block_type::fe, values_fe.data()};
+        blocks_list[1] = {hwcnt::block_type::core, values_core0.data()};
+        blocks_list[2] = {hwcnt::block_type::core, values_core1.data()};
+
+        EXPECT_CALL(backend_sample_mock, blocks, blocks_list);
+
+        ec = test_sampler.sample_now();
+        REQUIRE(!ec);
+
+        hwcpipe::counter_sample sample{};
+        ec = test_sampler.get_counter_value(c1_fe.first, sample);
+        REQUIRE(!ec);
+        REQUIRE(sample.value.uint64 == 0xFEFE);
+        REQUIRE(sample.type == counter_sample::type::uint64);
+
+        ec = test_sampler.get_counter_value(c2_core.first, sample);
+        REQUIRE(!ec);
+        // Sum of values from Core[0] and Core[1]
+        REQUIRE(sample.value.uint64 == 0xCCCC);
+        REQUIRE(sample.type == counter_sample::type::uint64);
+
+        for (const auto &sample : test_sampler.sample_view()) {
+            if (sample.counter == c1_fe.first) {
+                REQUIRE(sample.value.uint64 == 0xFEFE);
+                REQUIRE(sample.type == counter_sample::type::uint64);
+            } else if (sample.counter == c2_core.first) {
+                REQUIRE(sample.value.uint64 == 0xCCCC);
+                REQUIRE(sample.type == counter_sample::type::uint64);
+            } else {
+                FAIL("Unexpected counter value");
+            }
+        }
+    }
+
+    SECTION("Sample and read value two consequent times") {
+        blocks_list[0] = {hwcnt::block_type::fe, values_fe.data()};
+        blocks_list[1] = {hwcnt::block_type::core, values_core0.data()};
+        blocks_list[2] = {hwcnt::block_type::core, values_core1.data()};
+
+        // First Sample
+        EXPECT_CALL(backend_sample_mock, blocks, blocks_list);
+        ec = test_sampler.sample_now();
+        REQUIRE(!ec);
+
+        hwcpipe::counter_sample sample{};
+        ec = test_sampler.get_counter_value(c1_fe.first, sample);
+        REQUIRE(!ec);
+        REQUIRE(sample.value.uint64 == 0xFEFE);
+        REQUIRE(sample.type == counter_sample::type::uint64);
+
+        ec = test_sampler.get_counter_value(c2_core.first, sample);
+        REQUIRE(!ec);
+        // Sum of values from Core[0] and Core[1]
+        REQUIRE(sample.value.uint64 == 0xCCCC);
+        REQUIRE(sample.type == counter_sample::type::uint64);
+
+        // Second Sample
+        EXPECT_CALL(backend_sample_mock, blocks, blocks_list);
+        ec = test_sampler.sample_now();
+        REQUIRE(!ec);
+
+        ec = test_sampler.get_counter_value(c1_fe.first, sample);
+        REQUIRE(!ec);
+        REQUIRE(sample.value.uint64 == 0xFEFE);
+        REQUIRE(sample.type == counter_sample::type::uint64);
+
+        ec = test_sampler.get_counter_value(c2_core.first, sample);
+        REQUIRE(!ec);
+        // Sum of values from Core[0] and Core[1]
+        REQUIRE(sample.value.uint64 == 0xCCCC);
+        REQUIRE(sample.type == counter_sample::type::uint64);
+    }
+
+    SECTION("Reading unregistered counters") {
+        blocks_list[0] = {hwcnt::block_type::fe, values_fe.data()};
+        blocks_list[1] = {hwcnt::block_type::core, values_core0.data()};
+        blocks_list[2] = {hwcnt::block_type::core, values_core1.data()};
+        EXPECT_CALL(backend_sample_mock, blocks, blocks_list);
+
+        ec = test_sampler.sample_now();
+        REQUIRE(!ec);
+
+        hwcpipe::counter_sample sample{};
+        ec = test_sampler.get_counter_value(hwcpipe_counter::MaliTilerActiveCy, sample);
+        REQUIRE(ec == make_error_code(errc::unknown_counter));
+
+        // a counter whose enum value lies between the registered counters
+        ec = test_sampler.get_counter_value(hwcpipe_counter::MaliFragEZSKillQd, sample);
+        REQUIRE(ec == make_error_code(errc::unknown_counter));
+
+        // a counter whose enum value is below the registered counters
+        ec = test_sampler.get_counter_value(hwcpipe_counter::MaliALUIssueCy, sample);
+        REQUIRE(ec == make_error_code(errc::unknown_counter));
+    }
+}
+
+TEST_CASE("SamplerReadsCorrectValues__WhenValuesTypeIsUint64") {
+    using counter_offset_pair = std::pair<hwcpipe_counter, uint32_t>;
+
+    counter_offset_pair c1_fe = {MaliGPUActiveCy, 6};
+    counter_offset_pair c2_core = {MaliFragActiveCy, 4};
+
+    std::vector<block_metadata> blocks_list(3);
+    std::vector<uint64_t> values_fe(10, 0);
+    std::vector<uint64_t> values_core0(10, 0);
+    std::vector<uint64_t> values_core1(10, 0);
+
+    values_fe[c1_fe.second] = 0xFEFE0000UL;
+    values_core0[c2_core.second] = 0xC0C00000UL;
+    values_core1[c2_core.second] = 0x0C0C0000UL;
+
+    sampler_config config(device::product_id::g31, 0);
+    auto ec = config.add_counter(c1_fe.first);
+    REQUIRE(!ec);
+    ec = config.add_counter(c2_core.first);
+    REQUIRE(!ec);
+
+    SECTION("Reading registered counters") {
+        blocks_list[0] = {hwcnt::block_type::fe, values_fe.data()};
+        blocks_list[1] = {hwcnt::block_type::core, values_core0.data()};
+        blocks_list[2] = {hwcnt::block_type::core, values_core1.data()};
+
+        EXPECT_CALL(backend_sample_mock, blocks, blocks_list);
+        EXPECT_CALL(block_extents_mock, values_type, sample_values_type::uint64);
+
+        sampler_t test_sampler(config);
+        ec = test_sampler.start_sampling();
+        REQUIRE(!ec);
+
+        auto ec = test_sampler.sample_now();
+        REQUIRE(!ec);
+
+        hwcpipe::counter_sample sample{};
+        ec = test_sampler.get_counter_value(c1_fe.first, sample);
         REQUIRE(!ec);
         REQUIRE(sample.value.uint64 == 0xFEFE0000UL);
         REQUIRE(sample.type == counter_sample::type::uint64);
 
-        ec = test_sampler.get_counter_value(c2_core.first, sample);
-        REQUIRE(!ec);
-        // Sum of values from Core[0] and Core[1]
-        REQUIRE(sample.value.uint64 == 0xCCCC0000UL);
-        REQUIRE(sample.type == counter_sample::type::uint64);
+        ec = test_sampler.get_counter_value(c2_core.first, sample);
+        REQUIRE(!ec);
+        // Sum of values from Core[0] and Core[1]
+        REQUIRE(sample.value.uint64 == 0xCCCC0000UL);
+        REQUIRE(sample.type == counter_sample::type::uint64);
+    }
+}
+
+TEST_CASE("SamplerReadsCorrectValues__WhenPerInstanceValuesAreEnabled") {
+    using counter_offset_pair = std::pair<hwcpipe_counter, uint32_t>;
+
+    counter_offset_pair c1_fe = {MaliGPUActiveCy, 6};
+    counter_offset_pair c2_core = {MaliFragActiveCy, 4};
+
+    std::vector<block_metadata> blocks_list(3);
+    std::vector<uint32_t> values_fe(10, 0);
+    std::vector<uint32_t> values_core0(10, 0);
+    std::vector<uint32_t> values_core2(10, 0);
+
+    values_fe[c1_fe.second] = 0xFEFE;
+    values_core0[c2_core.second] = 0xC0C0;
+    values_core2[c2_core.second] = 0x0C0C;
+
+    blocks_list[0] = {hwcnt::block_type::fe, values_fe.data(), 0};
+    blocks_list[1] = {hwcnt::block_type::core, values_core0.data(), 0};
+    blocks_list[2] = {hwcnt::block_type::core, values_core2.data(), 2};
+
+    sampler_config config(device::product_id::g31, 0);
+    REQUIRE(!config.add_counter(c1_fe.first));
+    REQUIRE(!config.add_counter(c2_core.first));
+    REQUIRE(!config.add_counter(MaliTilerUtil));
+
+    const uint64_t *values{};
+    size_t num_instances{};
+
+    SECTION("Per instance values disabled") {
+        REQUIRE(!config.get_per_instance_values());
+        sampler_t test_sampler(config);
+        REQUIRE(!test_sampler.start_sampling());
+        EXPECT_CALL(backend_sample_mock, blocks, blocks_list);
+        REQUIRE(!test_sampler.sample_now());
+
+        REQUIRE(test_sampler.get_counter_instance_values(c2_core.first, values, num_instances) ==
+                make_error_code(errc::instance_values_unavailable));
+    }
+
+    SECTION("Per instance values enabled") {
+        config.set_per_instance_values(true);
+        sampler_t test_sampler(config);
+        REQUIRE(!test_sampler.start_sampling());
+        EXPECT_CALL(backend_sample_mock, blocks, blocks_list);
+        REQUIRE(!test_sampler.sample_now());
+
+        REQUIRE(!test_sampler.get_counter_instance_values(c2_core.first, values, num_instances));
+        REQUIRE(num_instances == block_extents_mock::num_blocks());
+        REQUIRE(values[0] == 0xC0C0);
+        REQUIRE(values[1] == 0);
+        REQUIRE(values[2] == 0x0C0C);
+        REQUIRE(values[3] == 0);
+
+        REQUIRE(!test_sampler.get_counter_instance_values(c1_fe.first, values, num_instances));
+        REQUIRE(values[0] == 0xFEFE);
+
+        // the summed view is a reduction over the instances
+        hwcpipe::counter_sample sample{};
+        REQUIRE(!test_sampler.get_counter_value(c2_core.first, sample));
+        REQUIRE(sample.value.uint64 == 0xCCCC);
+        REQUIRE(!test_sampler.get_counter_value(c1_fe.first, sample));
+        REQUIRE(sample.value.uint64 == 0xFEFE);
+
+        REQUIRE(test_sampler.get_counter_instance_values(MaliTilerUtil, values, num_instances) ==
+                make_error_code(errc::instance_values_unavailable));
+        REQUIRE(test_sampler.get_counter_instance_values(MaliFragEZSKillQd, values, num_instances) ==
+                make_error_code(errc::unknown_counter));
+    }
+}
+
+TEST_CASE("SamplerExtrapolatesCoreCounters__WhenCoresAreSubsampled") {
+    using counter_offset_pair = std::pair<hwcpipe_counter, uint32_t>;
+
+    counter_offset_pair c1_fe = {MaliGPUActiveCy, 6};
+    counter_offset_pair c2_core = {MaliFragActiveCy, 4};
+
+    std::vector<uint32_t> values_fe(10, 0);
+    values_fe[c1_fe.second] = 0xFEFE;
+    std::vector<std::vector<uint32_t>> values_cores(4, std::vector<uint32_t>(10, 0));
+    std::vector<block_metadata> blocks_list(5);
+    blocks_list[0] = {hwcnt::block_type::fe, values_fe.data(), 0};
+    for (uint8_t i = 0; i != values_cores.size(); ++i) {
+        values_cores[i][c2_core.second] = 10U * (i + 1U);
+        blocks_list[i + 1] = {hwcnt::block_type::core, values_cores[i].data(), i};
+    }
+
+    sampler_config config(device::product_id::g31, 0);
+    REQUIRE(!config.add_counter(c1_fe.first));
+    REQUIRE(!config.add_counter(c2_core.first));
+    REQUIRE(!config.add_counter(MaliTilerUtil));
+
+    hwcpipe::counter_sample sample{};
+    double error{};
+
+    SECTION("Two of four cores") {
+        config.set_core_subsampling(2);
+        sampler_t test_sampler(config);
+        REQUIRE(!test_sampler.start_sampling());
+
+        // the window rotates over the cores: 10 + 20, then 30 + 40, then 10 + 20
+        const uint64_t expected[] = {60, 140, 60};
+        for (const auto value : expected) {
+            EXPECT_CALL(backend_sample_mock, blocks, blocks_list);
+            REQUIRE(!test_sampler.sample_now());
+
+            REQUIRE(!test_sampler.get_counter_value(c2_core.first, sample));
+            REQUIRE(sample.value.uint64 == value);
+            // 4 * sqrt((1 - 2 / 4) * 50 / 2), the variance of either pair being 50
+            REQUIRE(!test_sampler.get_counter_error(c2_core.first, error));
+            REQUIRE(error == Approx(14.1421356));
+        }
+
+        REQUIRE(!test_sampler.get_counter_value(c1_fe.first, sample));
+        REQUIRE(sample.value.uint64 == 0xFEFE);
+        REQUIRE(!test_sampler.get_counter_error(c1_fe.first, error));
+        REQUIRE(error == 0.0);
+        REQUIRE(test_sampler.get_counter_error(MaliTilerUtil, error) ==
+                make_error_code(errc::error_estimate_unavailable));
+        REQUIRE(test_sampler.get_counter_error(MaliFragEZSKillQd, error) == make_error_code(errc::unknown_counter));
+    }
+
+    SECTION("All cores") {
+        config.set_core_subsampling(8);
+        sampler_t test_sampler(config);
+        REQUIRE(!test_sampler.start_sampling());
+        EXPECT_CALL(backend_sample_mock, blocks, blocks_list);
+        REQUIRE(!test_sampler.sample_now());
+
+        REQUIRE(!test_sampler.get_counter_value(c2_core.first, sample));
+        REQUIRE(sample.value.uint64 == 100);
+        REQUIRE(!test_sampler.get_counter_error(c2_core.first, error));
+        REQUIRE(error == 0.0);
+    }
+
+    SECTION("One core") {
+        config.set_core_subsampling(1);
+        sampler_t test_sampler(config);
+        REQUIRE(!test_sampler.start_sampling());
+        EXPECT_CALL(backend_sample_mock, blocks, blocks_list);
+        REQUIRE(!test_sampler.sample_now());
+
+        REQUIRE(!test_sampler.get_counter_value(c2_core.first, sample));
+        REQUIRE(sample.value.uint64 == 40);
+        REQUIRE(!test_sampler.get_counter_error(c2_core.first, error));
+        REQUIRE(std::isnan(error));
+    }
+
+    SECTION("Per instance values") {
+        config.set_core_subsampling(2);
+        config.set_per_instance_values(true);
+        sampler_t test_sampler(config);
+        REQUIRE_FALSE(test_sampler);
+        REQUIRE(test_sampler.start_sampling() == make_error_code(errc::sampler_config_invalid));
+    }
+}
+
+TEST_CASE("SamplerKeepsSessionAccumulating__WhenSessionsAreArmed") {
+    sampler_config config(device::product_id::g31, 0);
+    REQUIRE(!config.add_counter(hwcpipe_counter::MaliGPUActiveCy));
+    config.set_armed_sessions(true);
+
+    SECTION("Periodic samplers can't be armed") {
+        config.set_sampling_period(1000000);
+        sampler_t test_sampler(config);
+        REQUIRE_FALSE(test_sampler);
+    }
+
+    SECTION("Only the first start and no stop reach the kernel session") {
+        sampler_t test_sampler(config);
+        REQUIRE(test_sampler);
+        REQUIRE_FALSE(test_sampler.is_armed());
+
+        REQUIRE(!test_sampler.start_sampling());
+        REQUIRE(test_sampler.is_armed());
+        REQUIRE(!test_sampler.sample_now());
+
+        EXPECT_CALL(backend_manual_sampler_mock, accumulation_stop, std::make_error_code(std::errc::invalid_argument));
+        REQUIRE(!test_sampler.stop_sampling());
+        REQUIRE(test_sampler.is_armed());
+
+        EXPECT_CALL(backend_manual_sampler_mock, accumulation_start, std::make_error_code(std::errc::invalid_argument));
+        REQUIRE(!test_sampler.start_sampling());
+        REQUIRE(!test_sampler.stop_sampling());
+
+        // neither was called
+        REQUIRE(backend_manual_sampler_mock::accumulation_start_return_value);
+        REQUIRE(backend_manual_sampler_mock::accumulation_stop_return_value);
+        EXPECT_CALL(backend_manual_sampler_mock, accumulation_start, std::error_code{});
+        EXPECT_CALL(backend_manual_sampler_mock, accumulation_stop, std::error_code{});
+    }
+
+    SECTION("A failed baseline sample doesn't start sampling") {
+        sampler_t test_sampler(config);
+        REQUIRE(!test_sampler.start_sampling());
+        REQUIRE(!test_sampler.stop_sampling());
+
+        EXPECT_CALL(backend_manual_sampler_mock, request_sample, std::make_error_code(std::errc::invalid_argument));
+        REQUIRE(test_sampler.start_sampling() == make_error_code(errc::sample_collection_failure));
+        REQUIRE(test_sampler.sample_now() == make_error_code(errc::sampling_not_started));
+        REQUIRE(!test_sampler.start_sampling());
+    }
+
+    SECTION("Reconfiguring stops the armed session") {
+        sampler_t test_sampler(config);
+        REQUIRE(!test_sampler.start_sampling());
+        REQUIRE(!test_sampler.stop_sampling());
+
+        EXPECT_CALL(backend_manual_sampler_mock, accumulation_stop, std::make_error_code(std::errc::invalid_argument));
+        REQUIRE(test_sampler.reconfigure(config) == make_error_code(errc::accumulation_stop_failed));
+        REQUIRE(test_sampler.is_armed());
+
+        REQUIRE(!test_sampler.reconfigure(config));
+        REQUIRE_FALSE(test_sampler.is_armed());
+        REQUIRE(!test_sampler.start_sampling());
+        REQUIRE(test_sampler.is_armed());
+    }
+}
+
+TEST_CASE("SamplerReadsCorrectValues__WhenCoreBlocksAreReduced") {
+    // reading 4 counters out of a 16 counter block selects the block reduction
+    const block_extents_guard extents_guard;
+    block_extents_mock::num_counters_per_block() = 16;
+
+    const std::vector<std::pair<hwcpipe_counter, uint32_t>> core_counters{
+        {MaliFragActiveCy, 4},
+        {MaliFragRdPrim, 5},
+        {MaliFragRastPrim, 6},
+        {MaliFragFPKActiveCy, 7},
+    };
+
+    std::vector<uint32_t> values_core0(16, 0);
+    std::vector<uint32_t> values_core1(16, 0);
+    std::vector<uint64_t> values_core0_64(16, 0);
+    std::vector<uint64_t> values_core1_64(16, 0);
+    for (size_t i = 0; i != values_core0.size(); ++i) {
+        values_core0[i] = static_cast<uint32_t>(0xFFFFFF00 + i);
+        values_core1[i] = static_cast<uint32_t>(0x100 * i);
+        values_core0_64[i] = values_core0[i];
+        values_core1_64[i] = values_core1[i];
+    }
+
+    sampler_config config(device::product_id::g31, 0);
+    for (const auto &counter : core_counters) {
+        REQUIRE(!config.add_counter(counter.first));
+    }
+
+    std::vector<block_metadata> blocks_list(2);
+
+    SECTION("uint32") {
+        blocks_list[0] = {hwcnt::block_type::core, values_core0.data(), 0};
+        blocks_list[1] = {hwcnt::block_type::core, values_core1.data(), 1};
+    }
+
+    SECTION("uint64") {
+        EXPECT_CALL(block_extents_mock, values_type, sample_values_type::uint64);
+        blocks_list[0] = {hwcnt::block_type::core, values_core0_64.data(), 0};
+        blocks_list[1] = {hwcnt::block_type::core, values_core1_64.data(), 1};
+    }
+
+    sampler_t test_sampler(config);
+    REQUIRE(!test_sampler.start_sampling());
+    EXPECT_CALL(backend_sample_mock, blocks, blocks_list);
+    REQUIRE(!test_sampler.sample_now());
+
+    for (const auto &counter : core_counters) {
+        hwcpipe::counter_sample sample{};
+        REQUIRE(!test_sampler.get_counter_value(counter.first, sample));
+
+        // the sum is 64-bit wide and doesn't wrap at 32 bits
+        const uint64_t expected = uint64_t{values_core0[counter.second]} + values_core1[counter.second];
+        REQUIRE(sample.value.uint64 == expected);
     }
 }
 
@@ -581,6 +2340,710 @@ TEST_CASE("SamplerReadsCorrectValues__WhenSamplesAreExpressions") {
     }
 }
 
+TEST_CASE("SamplerReadsCorrectValues__WhenSamplingIsPeriodic") {
+    sampler_config config(device::product_id::g31, 0);
+    REQUIRE(config.get_sampling_period() == 0);
+    config.set_sampling_period(1000000);
+    REQUIRE(config.get_sampling_period() == 1000000);
+
+    std::vector<block_metadata> blocks_list(1);
+    std::vector<uint32_t> values_fe(7);
+    values_fe[6] = 0xFEFE; // MaliGPUActiveCy
+    blocks_list[0] = {hwcnt::block_type::fe, values_fe.data()};
+
+    REQUIRE(!config.add_counter(hwcpipe_counter::MaliGPUActiveCy));
+
+    SECTION("Periodic sampler can't be created") {
+        EXPECT_CALL(backend_periodic_sampler_mock, valid, false);
+        sampler_t test_sampler(config);
+        REQUIRE(!test_sampler);
+    }
+
+    SECTION("Periodic sampler can't start sampling") {
+        sampler_t test_sampler(config);
+        REQUIRE(test_sampler);
+        EXPECT_CALL(backend_periodic_sampler_mock, sampling_start, std::make_error_code(std::errc::invalid_argument));
+        REQUIRE(test_sampler.start_sampling() == make_error_code(errc::accumulation_start_failed));
+    }
+
+    SECTION("Sampling thread can't be configured") {
+        // no system has a CPU 63 that the test may run on
+        config.set_thread_config({uint64_t{1} << 63U, device::hwcnt::sampler::sched_class::inherit, 0});
+        REQUIRE(config.get_thread_config().cpu_mask == uint64_t{1} << 63U);
+        sampler_t test_sampler(config);
+        REQUIRE(test_sampler);
+        REQUIRE(test_sampler.start_sampling() == make_error_code(errc::thread_config_failed));
+    }
+
+    SECTION("Periodic samples are collected without a request") {
+        sampler_t test_sampler(config);
+        REQUIRE(test_sampler);
+        REQUIRE(!test_sampler.start_sampling());
+
+        // a manual request would fail the sample
+        EXPECT_CALL(backend_manual_sampler_mock, request_sample, std::make_error_code(std::errc::invalid_argument));
+        EXPECT_CALL(backend_sample_mock, blocks, blocks_list);
+        REQUIRE(!test_sampler.sample_now());
+        EXPECT_CALL(backend_manual_sampler_mock, request_sample, std::error_code{});
+
+        hwcpipe::counter_sample sample{};
+        REQUIRE(!test_sampler.get_counter_value(hwcpipe_counter::MaliGPUActiveCy, sample));
+        REQUIRE(sample.value.uint64 == 0xFEFE);
+
+        EXPECT_CALL(backend_periodic_sampler_mock, sampling_stop, std::make_error_code(std::errc::invalid_argument));
+        REQUIRE(test_sampler.stop_sampling() == make_error_code(errc::accumulation_stop_failed));
+    }
+}
+
+TEST_CASE("SamplerReadsCorrectValues__WhenExpressionsAreEvaluatedEagerly") {
+    sampler_config config(device::product_id::g31, 0);
+    REQUIRE(config.get_expression_evaluation() == sampler_config::expression_evaluation::lazy);
+    config.set_expression_evaluation(sampler_config::expression_evaluation::eager);
+
+    std::vector<block_metadata> blocks_list(2);
+    std::vector<uint32_t> values_tiler(5);
+    std::vector<uint32_t> values_fe(7);
+    values_tiler[4] = 4; // MaliTilerActiveCy
+    values_fe[6] = 2;    // MaliGPUActiveCy
+
+    blocks_list[0] = {hwcnt::block_type::fe, values_fe.data()};
+    blocks_list[1] = {hwcnt::block_type::tiler, values_tiler.data()};
+    EXPECT_CALL(backend_sample_mock, blocks, blocks_list);
+
+    REQUIRE(!config.add_counter(hwcpipe_counter::MaliTilerUtil));
+
+    sampler_t test_sampler = sampler_t(config);
+    REQUIRE(!test_sampler.start_sampling());
+    REQUIRE(!test_sampler.sample_now());
+
+    hwcpipe::counter_sample sample{};
+    REQUIRE(!test_sampler.get_counter_value(hwcpipe_counter::MaliTilerUtil, sample));
+    REQUIRE(sample.value.float64 == (4.0 / 2.0) * 100.0);
+    REQUIRE(sample.type == counter_sample::type::float64);
+
+    // the cached value is refreshed by the next sample
+    values_tiler[4] = 1;
+    EXPECT_CALL(backend_sample_mock, blocks, blocks_list);
+    REQUIRE(!test_sampler.sample_now());
+    REQUIRE(!test_sampler.stop_sampling());
+
+    std::error_code ec;
+    const hwcpipe_counter counters[] = {hwcpipe_counter::MaliTilerUtil};
+    auto list = test_sampler.make_read_list(counters, 1, ec);
+    REQUIRE(!ec);
+
+    double value{};
+    REQUIRE(!test_sampler.get_counter_values(list, &value, 1));
+    REQUIRE(value == (1.0 / 2.0) * 100.0);
+}
+
+TEST_CASE("SamplerReadsCorrectValues__WhenSampleViewIncludesExpressions") {
+    sampler_config config(device::product_id::g31, 0);
+    auto mode = GENERATE(sampler_config::expression_evaluation::lazy, sampler_config::expression_evaluation::eager);
+    config.set_expression_evaluation(mode);
+
+    std::vector<block_metadata> blocks_list(2);
+    std::vector<uint32_t> values_tiler(5);
+    std::vector<uint32_t> values_fe(7);
+    values_tiler[4] = 4; // MaliTilerActiveCy
+    values_fe[6] = 2;    // MaliGPUActiveCy
+
+    blocks_list[0] = {hwcnt::block_type::fe, values_fe.data()};
+    blocks_list[1] = {hwcnt::block_type::tiler, values_tiler.data()};
+
+    REQUIRE(!config.add_counter(hwcpipe_counter::MaliTilerUtil));
+
+    sampler_t test_sampler = sampler_t(config);
+    REQUIRE(!test_sampler.start_sampling());
+    REQUIRE(test_sampler.sample_view().size() == 0);
+
+    EXPECT_CALL(backend_sample_mock, blocks, blocks_list);
+    REQUIRE(!test_sampler.sample_now());
+
+    // every configured counter, in counter order
+    std::vector<hwcpipe_counter> counters{};
+    for (const auto &sample : test_sampler.sample_view()) {
+        counters.push_back(sample.counter);
+        if (sample.counter == hwcpipe_counter::MaliTilerUtil) {
+            REQUIRE(sample.type == counter_sample::type::float64);
+            REQUIRE(sample.value.float64 == (4.0 / 2.0) * 100.0);
+        } else if (sample.counter == hwcpipe_counter::MaliTilerActiveCy) {
+            REQUIRE(sample.type == counter_sample::type::uint64);
+            REQUIRE(sample.value.uint64 == 4);
+        } else if (sample.counter == hwcpipe_counter::MaliGPUActiveCy) {
+            REQUIRE(sample.type == counter_sample::type::uint64);
+            REQUIRE(sample.value.uint64 == 2);
+        } else {
+            FAIL("Unexpected counter value");
+        }
+    }
+    REQUIRE(counters.size() == 3);
+    REQUIRE(std::is_sorted(counters.begin(), counters.end()));
+
+    // the records are refreshed by the next sample
+    values_tiler[4] = 1;
+    EXPECT_CALL(backend_sample_mock, blocks, blocks_list);
+    REQUIRE(!test_sampler.sample_now());
+    REQUIRE(!test_sampler.stop_sampling());
+
+    for (const auto &sample : test_sampler.sample_view()) {
+        if (sample.counter == hwcpipe_counter::MaliTilerUtil) {
+            REQUIRE(sample.value.float64 == (1.0 / 2.0) * 100.0);
+        }
+    }
+}
+
+TEST_CASE("SamplerReadsCorrectValues__WhenCustomCountersAreAdded") {
+    sampler_config config(device::product_id::g31, 0);
+
+    std::vector<block_metadata> blocks_list(2);
+    std::vector<uint32_t> values_tiler(5);
+    std::vector<uint32_t> values_fe(7);
+    values_tiler[4] = 4; // MaliTilerActiveCy
+    values_fe[6] = 2;    // MaliGPUActiveCy
+
+    blocks_list[0] = {hwcnt::block_type::fe, values_fe.data()};
+    blocks_list[1] = {hwcnt::block_type::tiler, values_tiler.data()};
+
+    size_t id{};
+    SECTION("Invalid expression") {
+        REQUIRE(config.add_custom_counter("MaliTilerActiveCy +", id) == make_error_code(errc::invalid_expression));
+        REQUIRE(config.get_custom_counters().empty());
+        REQUIRE(config.get_valid_counters().empty());
+    }
+
+    SECTION("Counter not supported by the GPU") {
+        REQUIRE(config.add_custom_counter("MaliRTUBox * 2", id) ==
+                make_error_code(errc::invalid_counter_for_device));
+    }
+
+    auto mode = GENERATE(sampler_config::expression_evaluation::lazy, sampler_config::expression_evaluation::eager);
+    config.set_expression_evaluation(mode);
+
+    SECTION("Read custom counters") {
+        size_t ratio{};
+        size_t percent{};
+        REQUIRE(!config.add_custom_counter("max(MaliTilerActiveCy - MaliGPUActiveCy, 0) * MaliConfigShaderCoreCount",
+                                           ratio));
+        // reads a built-in expression: (MaliTilerActiveCy / MaliGPUActiveCy) * 100
+        REQUIRE(!config.add_custom_counter("MaliTilerUtil / 2", percent));
+        REQUIRE(ratio == 0);
+        REQUIRE(percent == 1);
+        REQUIRE(config.get_valid_counters().size() == 3);
+
+        device::constants constants{};
+        constants.num_shader_cores = 4;
+        EXPECT_CALL(instance_mock, get_constants, constants);
+
+        sampler_t test_sampler = sampler_t(config);
+        double value{};
+        REQUIRE(test_sampler.get_custom_counter_value(ratio, value) == make_error_code(errc::sample_collection_failure));
+
+        EXPECT_CALL(backend_sample_mock, blocks, blocks_list);
+        REQUIRE(!test_sampler.start_sampling());
+        REQUIRE(!test_sampler.sample_now());
+        REQUIRE(!test_sampler.stop_sampling());
+
+        REQUIRE(!test_sampler.get_custom_counter_value(ratio, value));
+        REQUIRE(value == 2.0 * 4.0);
+        REQUIRE(!test_sampler.get_custom_counter_value(percent, value));
+        REQUIRE(value == 100.0);
+        REQUIRE(test_sampler.get_custom_counter_value(2, value) == make_error_code(errc::unknown_counter));
+    }
+}
+
+TEST_CASE("SamplerReadsCorrectValues__WhenEagerExpressionsMatchLazyExpressions") {
+    const auto build_config = [](sampler_config::expression_evaluation mode) {
+        sampler_config config(device::product_id::g31, 0);
+        config.set_expression_evaluation(mode);
+
+        detail::counter_database db{};
+        for (auto counter : db.get_counters_for_gpu(device::product_id::g31)) {
+            REQUIRE(!config.add_counter(counter));
+        }
+        return config;
+    };
+
+    std::vector<uint32_t> values(64);
+    for (size_t i = 0; i != values.size(); ++i) {
+        values[i] = static_cast<uint32_t>(3 * i + 1);
+    }
+
+    const std::vector<block_metadata> blocks_list{
+        {hwcnt::block_type::fe, values.data()},
+        {hwcnt::block_type::tiler, values.data()},
+        {hwcnt::block_type::memory, values.data()},
+        {hwcnt::block_type::core, values.data()},
+    };
+
+    sampler_t lazy_sampler(build_config(sampler_config::expression_evaluation::lazy));
+    sampler_t eager_sampler(build_config(sampler_config::expression_evaluation::eager));
+
+    for (auto *test_sampler : {&lazy_sampler, &eager_sampler}) {
+        EXPECT_CALL(backend_sample_mock, blocks, blocks_list);
+        REQUIRE(!test_sampler->start_sampling());
+        REQUIRE(!test_sampler->sample_now());
+        REQUIRE(!test_sampler->stop_sampling());
+    }
+
+    detail::counter_database db{};
+    for (auto counter : db.get_counters_for_gpu(device::product_id::g31)) {
+        counter_sample lazy{};
+        counter_sample eager{};
+        REQUIRE(!lazy_sampler.get_counter_value(counter, lazy));
+        REQUIRE(!eager_sampler.get_counter_value(counter, eager));
+        REQUIRE(lazy.type == eager.type);
+        if (lazy.type == counter_sample::type::float64) {
+            REQUIRE(lazy.value.float64 == eager.value.float64);
+        } else {
+            REQUIRE(lazy.value.uint64 == eager.value.uint64);
+        }
+    }
+}
+
+TEST_CASE("SamplerReadsCorrectValues__WhenReadListIsUsed") {
+    sampler_config config(device::product_id::g31, 0);
+
+    std::vector<block_metadata> blocks_list(2);
+    std::vector<uint32_t> values_tiler(5);
+    std::vector<uint32_t> values_fe(7);
+    values_tiler[4] = 4; // MaliTilerActiveCy
+    values_fe[6] = 2;    // MaliGPUActiveCy
+
+    blocks_list[0] = {hwcnt::block_type::fe, values_fe.data()};
+    blocks_list[1] = {hwcnt::block_type::tiler, values_tiler.data()};
+    EXPECT_CALL(backend_sample_mock, blocks, blocks_list);
+
+    REQUIRE(!config.add_counter(hwcpipe_counter::MaliTilerUtil));
+
+    sampler_t test_sampler = sampler_t(config);
+
+    const std::vector<hwcpipe_counter> counters{
+        hwcpipe_counter::MaliTilerUtil,
+        hwcpipe_counter::MaliGPUActiveCy,
+        hwcpipe_counter::MaliTilerActiveCy,
+    };
+
+    std::error_code ec;
+    auto list = test_sampler.make_read_list(counters.data(), counters.size(), ec);
+    REQUIRE(!ec);
+    REQUIRE(list.size() == counters.size());
+
+    SECTION("Read list without a sample") {
+        std::vector<double> values(counters.size());
+        ec = test_sampler.get_counter_values(list, values.data(), values.size());
+        REQUIRE(ec == make_error_code(errc::sample_collection_failure));
+    }
+
+    SECTION("Read list with unregistered counter") {
+        const hwcpipe_counter unregistered[] = {hwcpipe_counter::MaliGPUActiveCy, hwcpipe_counter::MaliFragActiveCy};
+        auto bad_list = test_sampler.make_read_list(unregistered, 2, ec);
+        REQUIRE(ec == make_error_code(errc::unknown_counter));
+        REQUIRE(bad_list.empty());
+    }
+
+    SECTION("Read list values") {
+        REQUIRE(!test_sampler.start_sampling());
+        REQUIRE(!test_sampler.sample_now());
+        REQUIRE(!test_sampler.stop_sampling());
+
+        std::vector<double> values(counters.size());
+        ec = test_sampler.get_counter_values(list, values.data(), values.size());
+        REQUIRE(!ec);
+        REQUIRE(values[0] == (4.0 / 2.0) * 100.0);
+        REQUIRE(values[1] == 2.0);
+        REQUIRE(values[2] == 4.0);
+
+        std::vector<uint64_t> int_values(counters.size());
+        ec = test_sampler.get_counter_values(list, int_values.data(), int_values.size());
+        REQUIRE(!ec);
+        REQUIRE(int_values[0] == 200);
+        REQUIRE(int_values[1] == 2);
+        REQUIRE(int_values[2] == 4);
+
+        ec = test_sampler.get_counter_values(list, int_values.data(), int_values.size() - 1);
+        REQUIRE(ec == make_error_code(errc::invalid_read_list));
+    }
+}
+
+TEST_CASE("SamplerChecksTheTrigger__WhenATriggerIsSet") {
+    sampler_config config(device::product_id::g31, 0);
+    REQUIRE(config.get_trigger() == nullptr);
+    REQUIRE(config.set_trigger({hwcpipe_counter::MaliRTURay, trigger_condition::above, 0}) ==
+            make_error_code(errc::invalid_counter_for_device));
+    REQUIRE(config.get_trigger() == nullptr);
+
+    const auto evaluation = GENERATE(sampler_config::expression_evaluation::lazy,
+                                     sampler_config::expression_evaluation::eager);
+    config.set_expression_evaluation(evaluation);
+    REQUIRE(!config.set_trigger({hwcpipe_counter::MaliTilerUtil, trigger_condition::above, 50.0}));
+    REQUIRE(config.get_trigger()->counter == hwcpipe_counter::MaliTilerUtil);
+    REQUIRE(config.get_valid_counters().count(hwcpipe_counter::MaliTilerUtil) == 1);
+
+    std::vector<block_metadata> blocks_list(2);
+    std::vector<uint32_t> values_tiler(5);
+    std::vector<uint32_t> values_fe(7);
+    values_fe[6] = 100; // MaliGPUActiveCy
+    blocks_list[0] = {hwcnt::block_type::fe, values_fe.data()};
+    blocks_list[1] = {hwcnt::block_type::tiler, values_tiler.data()};
+
+    sampler_t test_sampler = sampler_t(config);
+    REQUIRE(test_sampler);
+    REQUIRE(!test_sampler.start_sampling());
+    REQUIRE(!test_sampler.is_triggered());
+
+    for (uint32_t tiler_active : {10U, 60U, 40U}) {
+        values_tiler[4] = tiler_active; // MaliTilerActiveCy
+        EXPECT_CALL(backend_sample_mock, blocks, blocks_list);
+        REQUIRE(!test_sampler.sample_now());
+        REQUIRE(test_sampler.is_triggered() == (tiler_active > 50));
+    }
+    REQUIRE(!test_sampler.stop_sampling());
+}
+
+TEST_CASE("SamplerReadsCorrectValues__WhenReadListIsNormalized") {
+    sampler_config config(device::product_id::g31, 0);
+    REQUIRE(!config.add_counter(hwcpipe_counter::MaliTilerUtil));
+
+    std::vector<block_metadata> blocks_list(2);
+    std::vector<uint32_t> values_tiler(5);
+    std::vector<uint32_t> values_fe(7);
+    values_tiler[4] = 400; // MaliTilerActiveCy
+    values_fe[6] = 800;    // MaliGPUActiveCy
+    blocks_list[0] = {hwcnt::block_type::fe, values_fe.data()};
+    blocks_list[1] = {hwcnt::block_type::tiler, values_tiler.data()};
+
+    const auto default_features = mock::reader_mock::features;
+    const bool has_cycles = GENERATE(false, true);
+    mock::reader_mock::features.has_gpu_cycle = has_cycles;
+
+    sampler_t test_sampler = sampler_t(config);
+
+    const std::vector<read_request> requests{
+        {hwcpipe_counter::MaliTilerActiveCy, counter_normalization::none},
+        {hwcpipe_counter::MaliTilerActiveCy, counter_normalization::per_second},
+        {hwcpipe_counter::MaliTilerActiveCy, counter_normalization::per_cycle},
+        {hwcpipe_counter::MaliTilerUtil, counter_normalization::none},
+    };
+
+    std::error_code ec;
+    auto list = test_sampler.make_read_list(requests.data(), requests.size(), ec);
+    REQUIRE(!ec);
+    REQUIRE(list.size() == requests.size());
+
+    SECTION("Normalized values") {
+        sample_metadata metadata{};
+        metadata.timestamp_ns_begin = 1000;
+        metadata.timestamp_ns_end = 3000;
+        metadata.gpu_cycle = 1600;
+        EXPECT_CALL(backend_sample_mock, get_metadata, metadata);
+        EXPECT_CALL(backend_sample_mock, blocks, blocks_list);
+        REQUIRE(!test_sampler.start_sampling());
+        REQUIRE(!test_sampler.sample_now());
+        REQUIRE(!test_sampler.stop_sampling());
+
+        const double cycles = has_cycles ? 1600.0 : 800.0;
+
+        std::vector<double> values(requests.size());
+        ec = test_sampler.get_counter_values(list, values.data(), values.size());
+        REQUIRE(!ec);
+        REQUIRE(values[0] == 400.0);
+        REQUIRE(values[1] == Approx(400.0 * 1e9 / 2000.0));
+        REQUIRE(values[2] == Approx(400.0 / cycles));
+        REQUIRE(values[3] == Approx(400.0 / 800.0 * 100.0));
+
+        std::vector<uint64_t> int_values(requests.size());
+        ec = test_sampler.get_counter_values(list, int_values.data(), int_values.size());
+        REQUIRE(!ec);
+        REQUIRE(int_values[0] == 400);
+        REQUIRE(int_values[1] == 200000000);
+        REQUIRE(int_values[2] == 0);
+    }
+
+    SECTION("Normalized values of an empty interval") {
+        EXPECT_CALL(backend_sample_mock, blocks, blocks_list);
+        REQUIRE(!test_sampler.start_sampling());
+        REQUIRE(!test_sampler.sample_now());
+        REQUIRE(!test_sampler.stop_sampling());
+
+        std::vector<double> values(requests.size());
+        ec = test_sampler.get_counter_values(list, values.data(), values.size());
+        REQUIRE(!ec);
+        REQUIRE(values[0] == 400.0);
+        REQUIRE(values[1] == 0.0);
+        REQUIRE(values[2] == (has_cycles ? 0.0 : 0.5));
+    }
+
+    SECTION("Per cycle values need the cycles counter") {
+        sampler_config tiler_config(device::product_id::g31, 0);
+        REQUIRE(!tiler_config.add_counter(hwcpipe_counter::MaliTilerActiveCy));
+        sampler_t tiler_sampler = sampler_t(tiler_config);
+
+        const read_request per_cycle[] = {{hwcpipe_counter::MaliTilerActiveCy, counter_normalization::per_cycle}};
+        auto tiler_list = tiler_sampler.make_read_list(per_cycle, 1, ec);
+        REQUIRE((ec == make_error_code(errc::unknown_counter)) == !has_cycles);
+        REQUIRE(tiler_list.empty() == !has_cycles);
+    }
+
+    mock::reader_mock::features = default_features;
+}
+
+TEST_CASE("StaticSamplerReadsCorrectValues__WhenCounterListIsFixed") {
+    using static_sampler_t = basic_static_sampler<hwcpipe_sampler_mock_policy, hwcpipe_counter::MaliTilerUtil,
+                                                  hwcpipe_counter::MaliGPUActiveCy>;
+    static_assert(static_sampler_t::size() == 2, "");
+    static_assert(static_sampler_t::index_of<hwcpipe_counter::MaliTilerUtil>() == 0, "");
+    static_assert(static_sampler_t::index_of<hwcpipe_counter::MaliGPUActiveCy>() == 1, "");
+
+    SECTION("Counter not supported by the GPU") {
+        basic_static_sampler<hwcpipe_sampler_mock_policy, hwcpipe_counter::MaliRTUUtil> test_sampler(
+            sampler_config(device::product_id::g31, 0));
+        REQUIRE(!test_sampler);
+        REQUIRE(test_sampler.start_sampling() == make_error_code(errc::invalid_counter_for_device));
+    }
+
+    SECTION("Read values") {
+        std::vector<block_metadata> blocks_list(2);
+        std::vector<uint32_t> values_tiler(5);
+        std::vector<uint32_t> values_fe(7);
+        values_tiler[4] = 4; // MaliTilerActiveCy
+        values_fe[6] = 2;    // MaliGPUActiveCy
+
+        blocks_list[0] = {hwcnt::block_type::fe, values_fe.data()};
+        blocks_list[1] = {hwcnt::block_type::tiler, values_tiler.data()};
+        EXPECT_CALL(backend_sample_mock, blocks, blocks_list);
+
+        static_sampler_t test_sampler(sampler_config(device::product_id::g31, 0));
+        REQUIRE(test_sampler);
+
+        static_sampler_t::values_type values{};
+        REQUIRE(test_sampler.get_values(values) == make_error_code(errc::sample_collection_failure));
+
+        REQUIRE(!test_sampler.start_sampling());
+        REQUIRE(!test_sampler.sample_now());
+        REQUIRE(!test_sampler.stop_sampling());
+
+        REQUIRE(!test_sampler.get_values(values));
+        REQUIRE(values[static_sampler_t::index_of<hwcpipe_counter::MaliTilerUtil>()] == (4.0 / 2.0) * 100.0);
+        REQUIRE(values[static_sampler_t::index_of<hwcpipe_counter::MaliGPUActiveCy>()] == 2.0);
+    }
+}
+
+TEST_CASE("SharedSessionReadsCorrectValues__WhenClientsHaveDifferentCounters") {
+    using session_t = basic_shared_session<hwcpipe_sampler_mock_policy>;
+    session_t session(device::product_id::g31, 0);
+
+    std::vector<block_metadata> blocks_list(2);
+    std::vector<uint32_t> values_tiler(5);
+    std::vector<uint32_t> values_fe(7);
+    values_tiler[4] = 4; // MaliTilerActiveCy
+    values_fe[6] = 2;    // MaliGPUActiveCy
+
+    blocks_list[0] = {hwcnt::block_type::fe, values_fe.data()};
+    blocks_list[1] = {hwcnt::block_type::tiler, values_tiler.data()};
+
+    std::error_code ec;
+    SECTION("Invalid clients") {
+        sampler_config empty(device::product_id::g31, 0);
+        REQUIRE(session.add_client(empty, ec) == nullptr);
+        REQUIRE(ec == make_error_code(errc::sampler_config_invalid));
+
+        sampler_config other_gpu(device::product_id::g51, 0);
+        REQUIRE(!other_gpu.add_counter(MaliGPUActiveCy));
+        REQUIRE(session.add_client(other_gpu, ec) == nullptr);
+        REQUIRE(ec == make_error_code(errc::invalid_device));
+
+        REQUIRE(session.start_sampling() == make_error_code(errc::sampler_config_invalid));
+    }
+
+    SECTION("Clients accumulate their own periods") {
+        sampler_config gpu_config(device::product_id::g31, 0);
+        REQUIRE(!gpu_config.add_counter(MaliGPUActiveCy));
+        sampler_config tiler_config(device::product_id::g31, 0);
+        REQUIRE(!tiler_config.add_counter(MaliTilerUtil));
+
+        auto *gpu_client = session.add_client(gpu_config, ec);
+        REQUIRE(gpu_client != nullptr);
+        auto *tiler_client = session.add_client(tiler_config, ec);
+        REQUIRE(tiler_client != nullptr);
+        REQUIRE(session.num_clients() == 2);
+
+        // one session, with the union of the clients' counters
+        REQUIRE(!session.start_sampling());
+        REQUIRE(session.add_client(gpu_config, ec) == nullptr);
+        REQUIRE(ec == make_error_code(errc::sampling_already_started));
+
+        counter_sample sample{};
+        REQUIRE(tiler_client->collect() == make_error_code(errc::sample_not_ready));
+        REQUIRE(tiler_client->get_counter_value(MaliTilerUtil, sample) ==
+                make_error_code(errc::sample_collection_failure));
+
+        EXPECT_CALL(backend_sample_mock, blocks, blocks_list);
+        REQUIRE(!session.sample_now());
+        REQUIRE(!gpu_client->collect());
+        REQUIRE(!gpu_client->get_counter_value(MaliGPUActiveCy, sample));
+        REQUIRE(sample.value.uint64 == 2);
+
+        values_fe[6] = 8;
+        EXPECT_CALL(backend_sample_mock, blocks, blocks_list);
+        REQUIRE(!session.sample_now());
+        REQUIRE(!gpu_client->collect());
+        REQUIRE(!gpu_client->get_counter_value(MaliGPUActiveCy, sample));
+        REQUIRE(sample.value.uint64 == 8);
+        REQUIRE(gpu_client->get_counter_value(MaliTilerUtil, sample) == make_error_code(errc::unknown_counter));
+
+        // the tiler client sees both samples: (4 + 4) / (2 + 8) * 100
+        REQUIRE(tiler_client->num_pending_samples() == 2);
+        REQUIRE(!tiler_client->collect());
+        REQUIRE(!tiler_client->get_counter_value(MaliTilerUtil, sample));
+        REQUIRE(sample.type == counter_sample::type::float64);
+        REQUIRE(sample.value.float64 == (8.0 / 10.0) * 100.0);
+        REQUIRE(!tiler_client->get_counter_value(MaliTilerActiveCy, sample));
+        REQUIRE(sample.value.uint64 == 8);
+
+        REQUIRE(!session.stop_sampling());
+    }
+}
+
+TEST_CASE("SharedSessionCoalescesRequests__WhenTheyArriveWithinTheWindow") {
+    using session_t = basic_shared_session<hwcpipe_sampler_mock_policy>;
+    shared_session_config session_config{};
+    session_config.coalesce_window_ns = 1000;
+    session_t session(device::product_id::g31, 0, session_config);
+
+    std::vector<block_metadata> blocks_list(1);
+    std::vector<uint32_t> values_fe(7);
+    values_fe[6] = 2; // MaliGPUActiveCy
+    blocks_list[0] = {hwcnt::block_type::fe, values_fe.data()};
+
+    std::error_code ec;
+    sampler_config config(device::product_id::g31, 0);
+    REQUIRE(!config.add_counter(MaliGPUActiveCy));
+    auto *scope_client = session.add_client(config, ec);
+    auto *frame_client = session.add_client(config, ec);
+    REQUIRE(frame_client != nullptr);
+
+    REQUIRE(session.request_sample(scope_client, 1, 0) == make_error_code(errc::sampling_not_started));
+    REQUIRE(!session.start_sampling());
+
+    // the counts collected by each client add up to what the GPU counted
+    counter_sample sample{};
+    uint64_t scope_total = 0;
+    uint64_t frame_total = 0;
+    const auto collect = [&](session_client *client, uint64_t &total) {
+        REQUIRE(!client->collect());
+        REQUIRE(!client->get_counter_value(MaliGPUActiveCy, sample));
+        total += sample.value.uint64;
+        return sample.value.uint64;
+    };
+
+    // both requests are served by the first dump
+    EXPECT_CALL(backend_sample_mock, blocks, blocks_list);
+    REQUIRE(!session.request_sample(scope_client, 1, 5000));
+    REQUIRE(collect(scope_client, scope_total) == 2);
+    REQUIRE(!session.request_sample(frame_client, 2, 5500));
+    REQUIRE(!session.request_sample(scope_client, 3, 5900));
+    REQUIRE(session.get_stats().num_dumps == 1);
+    REQUIRE(session.get_stats().num_coalesced == 2);
+
+    REQUIRE(collect(frame_client, frame_total) == 2);
+    REQUIRE(frame_client->get_sample_user_data() == 2);
+
+    // the scope client collected that dump already, and gets an empty period
+    REQUIRE(collect(scope_client, scope_total) == 0);
+    REQUIRE(scope_client->get_sample_user_data() == 3);
+    REQUIRE(scope_client->collect() == make_error_code(errc::sample_not_ready));
+
+    // a request after the window dumps again
+    values_fe[6] = 8;
+    EXPECT_CALL(backend_sample_mock, blocks, blocks_list);
+    REQUIRE(!session.request_sample(frame_client, 4, 6000));
+    REQUIRE(session.get_stats().num_dumps == 2);
+    REQUIRE(session.get_stats().num_requests == 4);
+    REQUIRE(collect(frame_client, frame_total) == 8);
+    REQUIRE(frame_client->get_sample_user_data() == 4);
+    REQUIRE(collect(scope_client, scope_total) == 8);
+    REQUIRE(scope_client->get_sample_user_data() == 0);
+
+    REQUIRE(scope_total == 10);
+    REQUIRE(frame_total == 10);
+
+    REQUIRE(!session.stop_sampling());
+}
+
+TEST_CASE("GroupSamplerAlignsDevices__WhenSampledTogether") {
+    using group_t = basic_group_sampler<hwcpipe_sampler_mock_policy>;
+    group_t group;
+
+    std::error_code ec;
+    sampler_config config0(device::product_id::g31, 0);
+    REQUIRE(!config0.add_counter(MaliGPUActiveCy));
+    sampler_config config1(device::product_id::g31, 1);
+    REQUIRE(!config1.add_counter(MaliGPUActiveCy));
+
+    REQUIRE(group.start_sampling() == make_error_code(errc::sampler_config_invalid));
+    REQUIRE(group.add_device(config0, ec) != nullptr);
+    REQUIRE(group.add_device(config0, ec) == nullptr);
+    REQUIRE(ec == make_error_code(errc::invalid_device));
+    REQUIRE(group.add_device(config1, ec) != nullptr);
+    REQUIRE(group.num_devices() == 2);
+
+    REQUIRE(group.sample_now_for(1000000) == make_error_code(errc::sampling_not_started));
+    REQUIRE(!group.start_sampling());
+    REQUIRE(group.add_device(config1, ec) == nullptr);
+    REQUIRE(ec == make_error_code(errc::sampling_already_started));
+
+    SECTION("Every device is sampled") {
+        // only the first device gets these timestamps, the second one gets zeroes
+        sample_metadata metadata{};
+        metadata.timestamp_ns_begin = 100;
+        metadata.timestamp_ns_end = 200;
+        EXPECT_CALL(backend_sample_mock, get_metadata, metadata);
+        REQUIRE(!group.sample_now_for(1000000));
+
+        const auto &record = group.get_record();
+        REQUIRE(record.devices.size() == 2);
+        REQUIRE(record.devices[0].device_number == 0);
+        REQUIRE(record.devices[0].timestamp_ns_begin == 100);
+        REQUIRE(record.devices[0].timestamp_ns_end == 200);
+        REQUIRE(record.devices[1].device_number == 1);
+        REQUIRE(record.devices[1].timestamp_ns_end == 0);
+        REQUIRE(record.skew_ns == 200);
+        REQUIRE(group.get_sampler(0).get_sample_timestamp_end() == 200);
+        REQUIRE(group.get_sampler(1).get_stats().request.count == 1);
+    }
+
+    SECTION("A late device is not requested again") {
+        EXPECT_CALL(reader_mock, ready, false);
+        REQUIRE(group.sample_now_for(1000000) == make_error_code(errc::sample_not_ready));
+
+        REQUIRE(!group.sample_now_for(1000000));
+        REQUIRE(group.get_sampler(0).get_stats().request.count == 1);
+        REQUIRE(group.get_sampler(1).get_stats().request.count == 2);
+    }
+
+    SECTION("A request fails") {
+        EXPECT_CALL(backend_manual_sampler_mock, request_sample_async, std::make_error_code(std::errc::io_error));
+        REQUIRE(group.sample_now_for(1000000) == make_error_code(errc::sample_collection_failure));
+    }
+
+    REQUIRE(!group.stop_sampling());
+    REQUIRE(group.stop_sampling() == make_error_code(errc::sampling_not_started));
+}
+
+TEST_CASE("IntegerCounterValuesAreClamped__WhenTheDoubleIsOutOfRange") {
+    CHECK(detail::to_counter_value<uint64_t>(41.9) == 41);
+    CHECK(detail::to_counter_value<uint64_t>(-1.5) == 0);
+    CHECK(detail::to_counter_value<uint64_t>(std::nan("")) == 0);
+    CHECK(detail::to_counter_value<uint64_t>(-std::numeric_limits<double>::infinity()) == 0);
+    CHECK(detail::to_counter_value<uint64_t>(18446744073709551616.0) == std::numeric_limits<uint64_t>::max());
+    CHECK(detail::to_counter_value<uint64_t>(std::numeric_limits<double>::infinity()) ==
+          std::numeric_limits<uint64_t>::max());
+    // the largest double below 2^64 fits
+    CHECK(detail::to_counter_value<uint64_t>(18446744073709549568.0) == 18446744073709549568ULL);
+    CHECK(std::isnan(detail::to_counter_value<double>(std::nan(""))));
+}
+
 TEST_CASE("ExpressionCounterGivenToSamplerConfig__CounterDependenciesAreSet") {
     std::error_code ec;
     sampler_config config{device::product_id::g31, 0};
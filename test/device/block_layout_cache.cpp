@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <catch2/catch.hpp>
+
+#include <device/hwcnt/block_metadata.hpp>
+#include <device/hwcnt/sampler/kinstr_prfcnt/block_layout_cache.hpp>
+#include <device/ioctl/kinstr_prfcnt/types.hpp>
+#include <device/ioctl/strided_array_iterator.hpp>
+#include <device/shader_core_bitset.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace hwcpipe {
+namespace device {
+namespace hwcnt {
+namespace sampler {
+namespace kinstr_prfcnt {
+
+namespace {
+
+using metadata_item = ioctl::kinstr_prfcnt::metadata_item;
+using iterator_type = ioctl::strided_array_iterator<const metadata_item>;
+
+/** Metadata items of a sample with a front end block and shader cores 0 and 2. */
+std::vector<metadata_item> make_items(uint32_t values_offset) {
+    std::vector<metadata_item> items(6);
+    items[0].hdr.type = metadata_item::item_type::sample;
+    items[1].hdr.type = metadata_item::item_type::clock;
+
+    const ioctl::kinstr_prfcnt::block_type types[] = {ioctl::kinstr_prfcnt::block_type::fe,
+                                                      ioctl::kinstr_prfcnt::block_type::shader_core,
+                                                      ioctl::kinstr_prfcnt::block_type::shader_core};
+    const uint8_t indices[] = {0, 0, 2};
+    for (size_t i = 0; i != 3; ++i) {
+        auto &item = items[i + 2];
+        item.hdr.type = metadata_item::item_type::block;
+        item.u.block_md.type = types[i];
+        item.u.block_md.block_idx = indices[i];
+        item.u.block_md.set = ioctl::kinstr_prfcnt::prfcnt_set::primary;
+        item.u.block_md.block_state = metadata_item::block_metadata::block_state_type::on;
+        item.u.block_md.values_offset = values_offset + static_cast<uint32_t>(i) * 256;
+    }
+    return items;
+}
+
+/** Counters buffer mapping that the values offsets point into. */
+const std::vector<uint8_t> mapping(0x3000);
+
+/** Decodes the blocks of a sample. */
+std::vector<block_metadata> decode(const block_layout_cache &cache, const std::vector<metadata_item> &items,
+                                   const block_index_remap *remap) {
+    std::vector<block_metadata> result;
+    iterator_type it{items.data(), sizeof(metadata_item)};
+
+    block_metadata block{};
+    while (cache.parse_block_item(block, it, static_cast<size_t>(&*it - items.data()), mapping.data(), remap))
+        result.push_back(block);
+    return result;
+}
+
+} // namespace
+
+TEST_CASE("block_layout_cache__ReusesTheLayout") {
+    const block_index_remap remap{shader_core_bitset{0x5}};
+    block_layout_cache cache;
+    const auto first = make_items(0x1000);
+    iterator_type begin{first.data(), sizeof(metadata_item)};
+    iterator_type end = begin + first.size();
+
+    REQUIRE(cache.empty());
+    REQUIRE(!cache.matches(begin, end));
+
+    cache.assign(begin, end, &remap);
+    REQUIRE(!cache.empty());
+    REQUIRE(cache.matches(begin, end));
+
+    SECTION("Later samples are decoded from the cached layout") {
+        auto next = make_items(0x2000);
+        next[3].u.block_md.block_state = metadata_item::block_metadata::block_state_type::off;
+        iterator_type next_begin{next.data(), sizeof(metadata_item)};
+        REQUIRE(cache.matches(next_begin, next_begin + next.size()));
+
+        const auto blocks = decode(cache, next, &remap);
+        REQUIRE(blocks.size() == 3);
+        REQUIRE(blocks[0].type == block_type::fe);
+        REQUIRE(blocks[0].values == mapping.data() + 0x2000);
+        REQUIRE(blocks[1].type == block_type::core);
+        REQUIRE(blocks[1].state.off);
+        // the shader core indices are remapped to be contiguous
+        REQUIRE(blocks[2].index == 1);
+        REQUIRE(blocks[2].values == mapping.data() + 0x2200);
+    }
+
+    SECTION("Samples with another layout are parsed") {
+        auto other = make_items(0x2000);
+        other[4].u.block_md.block_idx = 3;
+        iterator_type other_begin{other.data(), sizeof(metadata_item)};
+        REQUIRE(!cache.matches(other_begin, other_begin + other.size()));
+        REQUIRE(!cache.matches(begin, end - 1));
+
+        const auto blocks = decode(cache, other, nullptr);
+        REQUIRE(blocks.size() == 3);
+        REQUIRE(blocks[1].index == 0);
+        // the mismatching block is parsed without the cached remap
+        REQUIRE(blocks[2].index == 3);
+        REQUIRE(blocks[2].values == mapping.data() + 0x2200);
+
+        cache.clear();
+        REQUIRE(cache.empty());
+    }
+}
+
+} // namespace kinstr_prfcnt
+} // namespace sampler
+} // namespace hwcnt
+} // namespace device
+} // namespace hwcpipe
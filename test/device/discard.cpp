@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <catch2/catch.hpp>
+
+#include <device/hwcnt/sampler/discard_impl.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <system_error>
+#include <utility>
+
+#include <poll.h>
+
+namespace hwcpipe {
+namespace device {
+namespace hwcnt {
+namespace sampler {
+
+namespace {
+
+/** Ring buffer of samples, identified by their end timestamps. */
+struct fake_ring {
+    std::deque<uint64_t> samples{};
+    unsigned num_polls{};
+    unsigned num_discards{};
+};
+
+class fake_syscall_iface {
+  public:
+    explicit fake_syscall_iface(fake_ring &ring)
+        : ring_(&ring) {}
+
+    std::pair<std::error_code, int> poll(struct pollfd *, nfds_t, int) {
+        ++ring_->num_polls;
+        return {std::error_code{}, ring_->samples.empty() ? 0 : 1};
+    }
+
+  private:
+    fake_ring *ring_;
+};
+
+struct fake_timestamp_iface {
+    uint64_t clock_gettime() const { return now; }
+
+    uint64_t now;
+};
+
+class fake_backend {
+  public:
+    explicit fake_backend(fake_ring &ring)
+        : ring_(&ring) {}
+
+    int get_fd() const { return 42; }
+
+    std::error_code discard_ready_sample(uint64_t &timestamp_ns_end) {
+        if (ring_->samples.empty())
+            return std::make_error_code(std::errc::resource_unavailable_try_again);
+
+        ++ring_->num_discards;
+        timestamp_ns_end = ring_->samples.front();
+        ring_->samples.pop_front();
+        return {};
+    }
+
+  private:
+    fake_ring *ring_;
+};
+
+} // namespace
+
+TEST_CASE("device__hwcnt__sampler__discard_impl") {
+    fake_ring ring{};
+    fake_backend backend{ring};
+
+    SECTION("empty ring buffer") {
+        REQUIRE(!discard_impl(backend, fake_syscall_iface{ring}, fake_timestamp_iface{100}));
+        CHECK(ring.num_polls == 1);
+        CHECK(ring.num_discards == 0);
+    }
+
+    SECTION("stale samples are drained with two polls") {
+        ring.samples = {10, 20, 30, 40, 50};
+
+        REQUIRE(!discard_impl(backend, fake_syscall_iface{ring}, fake_timestamp_iface{100}));
+        CHECK(ring.samples.empty());
+        CHECK(ring.num_polls == 2);
+        CHECK(ring.num_discards == 5);
+    }
+
+    SECTION("samples newer than the call stop the discard") {
+        ring.samples = {10, 20, 100, 110};
+
+        REQUIRE(!discard_impl(backend, fake_syscall_iface{ring}, fake_timestamp_iface{100}));
+        CHECK(ring.samples == std::deque<uint64_t>{110});
+        CHECK(ring.num_polls == 1);
+        CHECK(ring.num_discards == 3);
+    }
+}
+
+TEST_CASE("device__hwcnt__sampler__discard_impl__error") {
+    fake_ring ring{};
+    ring.samples = {10};
+
+    /** Back-end failing to take a sample that is ready. */
+    struct failing_backend : fake_backend {
+        using fake_backend::fake_backend;
+
+        std::error_code discard_ready_sample(uint64_t &) { return std::make_error_code(std::errc::io_error); }
+    } backend{ring};
+
+    CHECK(discard_impl(backend, fake_syscall_iface{ring}, fake_timestamp_iface{100}) ==
+          std::make_error_code(std::errc::io_error));
+    CHECK(ring.num_polls == 2);
+}
+
+} // namespace sampler
+} // namespace hwcnt
+} // namespace device
+} // namespace hwcpipe
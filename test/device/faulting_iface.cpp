@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <catch2/catch.hpp>
+
+#include <device/hwcnt/sampler/poll.hpp>
+#include <device/syscall/faulting_iface.hpp>
+
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include <poll.h>
+#include <sys/mman.h>
+
+namespace hwcpipe {
+namespace device {
+namespace syscall {
+
+namespace {
+
+constexpr int device_fd = 10;
+constexpr unsigned long sample_command = 0x5a;
+constexpr unsigned long other_command = 0x5b;
+
+/** Syscall interface of a kernel without samples, that counts the calls. */
+class idle_kernel_iface {
+  public:
+    idle_kernel_iface() = default;
+    explicit idle_kernel_iface(unsigned &num_calls)
+        : num_calls_(&num_calls) {}
+
+    std::pair<std::error_code, int> open(const char *, int) { return {count(), device_fd}; }
+    std::pair<std::error_code, bool> is_char_device(int) { return {count(), true}; }
+    std::error_code close(int) { return count(); }
+
+    std::pair<std::error_code, void *> mmap(void *, size_t, int, int, int, off_t) { return {count(), &memory_}; }
+    std::error_code munmap(void *, size_t) { return count(); }
+
+    std::pair<std::error_code, int> ioctl(int, unsigned long, int) { return {count(), 0}; }
+
+    /** No sample is ever ready, the poll times out. */
+    std::pair<std::error_code, int> poll(struct pollfd *fds, nfds_t, int) {
+        fds[0].revents = 0;
+        return {count(), 0};
+    }
+
+  private:
+    std::error_code count() {
+        if (num_calls_ != nullptr)
+            ++*num_calls_;
+        return {};
+    }
+
+    unsigned *num_calls_{};
+    uint64_t memory_{};
+};
+
+using test_iface = faulting_iface<idle_kernel_iface>;
+
+std::error_code make_errno(int error) { return {error, std::generic_category()}; }
+
+} // namespace
+
+TEST_CASE("device::syscall::faulting_iface__Forward") {
+    unsigned num_calls{};
+    fault_injector injector{};
+
+    SECTION("Without injector") {
+        const test_iface iface{};
+        CHECK(iface.ioctl(device_fd, sample_command, 0).second == 0);
+    }
+
+    SECTION("Without faults") {
+        const test_iface iface{injector, idle_kernel_iface{num_calls}};
+        CHECK(iface.open("/dev/mali0", 0).second == device_fd);
+        CHECK(iface.mmap(nullptr, 4096, PROT_READ, MAP_PRIVATE, device_fd, 0).second != MAP_FAILED);
+        CHECK(!iface.ioctl(device_fd, sample_command, 0).first);
+        CHECK(!hwcnt::sampler::check_ready_read(device_fd, iface).second);
+        CHECK(!iface.munmap(nullptr, 4096));
+        CHECK(!iface.close(device_fd));
+        CHECK(num_calls == 6);
+
+        // only the ioctl, poll and mmap calls are seen by the injector
+        const auto stats = injector.read();
+        CHECK(stats.num_calls == 3);
+        CHECK(stats.num_delays == 0);
+        CHECK(stats.ioctl_errors == 0);
+    }
+}
+
+TEST_CASE("device::syscall::faulting_iface__Errors") {
+    unsigned num_calls{};
+    fault_injector injector{};
+    const test_iface iface{injector, idle_kernel_iface{num_calls}};
+
+    SECTION("Every call") {
+        fault_profile failing{};
+        failing.error_rate = 1.0;
+        failing.error = ENODEV;
+        injector.set_profiles(failing, failing, failing);
+
+        CHECK(iface.ioctl(device_fd, sample_command, 0) == std::make_pair(make_errno(ENODEV), -1));
+        CHECK(iface.mmap(nullptr, 4096, PROT_READ, MAP_PRIVATE, device_fd, 0).second == MAP_FAILED);
+        CHECK(hwcnt::sampler::wait_for_sample(device_fd, iface) == make_errno(ENODEV));
+
+        // the failed calls are not made
+        CHECK(num_calls == 0);
+        const auto stats = injector.read();
+        CHECK(stats.ioctl_errors == 1);
+        CHECK(stats.poll_errors == 1);
+        CHECK(stats.mmap_errors == 1);
+    }
+
+    SECTION("One command") {
+        fault_profile failing{};
+        failing.error_rate = 1.0;
+        failing.command = sample_command;
+        injector.set_profiles(failing, {}, {});
+
+        CHECK(iface.ioctl(device_fd, sample_command, 0).first == make_errno(EIO));
+        CHECK(!iface.ioctl(device_fd, other_command, 0).first);
+        CHECK(num_calls == 1);
+    }
+
+    SECTION("Error rate") {
+        static constexpr size_t num_ioctls = 1000;
+
+        fault_profile flaky{};
+        flaky.error_rate = 0.25;
+        injector.set_profiles(flaky, {}, {});
+
+        std::vector<bool> failed;
+        for (size_t i = 0; i != num_ioctls; ++i)
+            failed.push_back(!!iface.ioctl(device_fd, sample_command, 0).first);
+
+        const auto num_errors = injector.read().ioctl_errors;
+        CHECK(num_errors > num_ioctls / 8);
+        CHECK(num_errors < num_ioctls / 2);
+
+        // the same seed fails the same calls
+        fault_injector repeated{};
+        repeated.set_profiles(flaky, {}, {});
+        const test_iface repeated_iface{repeated};
+        for (size_t i = 0; i != num_ioctls; ++i)
+            REQUIRE(!!repeated_iface.ioctl(device_fd, sample_command, 0).first == failed[i]);
+    }
+}
+
+TEST_CASE("device::syscall::faulting_iface__Delays") {
+    static constexpr size_t num_calls = 100;
+
+    fault_injector injector{42};
+    const test_iface iface{injector};
+    fault_profile slow{};
+
+    SECTION("Fixed") {
+        slow.delay = delay_distribution::fixed;
+        slow.delay_ns = 2000000;
+        injector.set_profiles({}, slow, {});
+
+        const auto begin = std::chrono::steady_clock::now();
+        CHECK(!hwcnt::sampler::check_ready_read(device_fd, iface).second);
+        CHECK(std::chrono::steady_clock::now() - begin >= std::chrono::nanoseconds(slow.delay_ns));
+
+        const auto stats = injector.read();
+        CHECK(stats.num_delays == 1);
+        CHECK(stats.total_delay_ns == slow.delay_ns);
+    }
+
+    SECTION("Uniform") {
+        slow.delay = delay_distribution::uniform;
+        slow.delay_ns = 1000;
+        slow.max_delay_ns = 3000;
+        injector.set_profiles(slow, {}, {});
+
+        for (size_t i = 0; i != num_calls; ++i)
+            CHECK(!iface.ioctl(device_fd, sample_command, 0).first);
+
+        const auto stats = injector.read();
+        CHECK(stats.num_delays == num_calls);
+        CHECK(stats.total_delay_ns > num_calls * slow.delay_ns);
+        CHECK(stats.total_delay_ns < num_calls * slow.max_delay_ns);
+    }
+
+    SECTION("Exponential capped") {
+        slow.delay = delay_distribution::exponential;
+        slow.delay_ns = 1000;
+        slow.max_delay_ns = 1500;
+        injector.set_profiles({}, {}, slow);
+
+        for (size_t i = 0; i != num_calls; ++i)
+            CHECK(iface.mmap(nullptr, 4096, PROT_READ, MAP_PRIVATE, device_fd, 0).second != MAP_FAILED);
+
+        const auto stats = injector.read();
+        CHECK(stats.total_delay_ns <= num_calls * slow.max_delay_ns);
+        CHECK(stats.total_delay_ns > num_calls * slow.delay_ns / 2);
+    }
+}
+
+TEST_CASE("device::syscall::faulting_iface__BufferFull") {
+    static constexpr uint64_t normal_calls = 4;
+    static constexpr uint64_t full_calls = 6;
+
+    fault_injector injector{};
+    injector.set_script(fault_injector::buffer_full_script(normal_calls, full_calls, sample_command));
+    const test_iface iface{injector};
+
+    // each round waits for a sample, then gets it
+    const auto round = [&iface]() {
+        const auto ready = hwcnt::sampler::wait_ready_read(device_fd, 1000000, iface);
+        const auto ec = iface.ioctl(device_fd, sample_command, 0).first;
+        return std::make_pair(ready.second, ec);
+    };
+
+    for (uint64_t i = 0; i != normal_calls / 2; ++i)
+        CHECK(round() == std::make_pair(false, std::error_code{}));
+
+    // the kernel keeps reporting a sample, and has no buffer for it
+    for (uint64_t i = 0; i != full_calls / 2; ++i)
+        CHECK(round() == std::make_pair(true, make_errno(EBUSY)));
+
+    CHECK(round() == std::make_pair(false, std::error_code{}));
+
+    const auto stats = injector.read();
+    CHECK(stats.forced_ready == full_calls / 2);
+    CHECK(stats.ioctl_errors == full_calls / 2);
+    CHECK(stats.num_calls == normal_calls + full_calls + 2);
+
+    SECTION("Restart the script") {
+        injector.set_script(fault_injector::buffer_full_script(0, 2, sample_command));
+        CHECK(round() == std::make_pair(true, make_errno(EBUSY)));
+        CHECK(round() == std::make_pair(false, std::error_code{}));
+    }
+}
+
+} // namespace syscall
+} // namespace device
+} // namespace hwcpipe
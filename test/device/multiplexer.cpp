@@ -0,0 +1,368 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <catch2/catch.hpp>
+
+#include <device/hwcnt/block_extents.hpp>
+#include <device/hwcnt/reader.hpp>
+#include <device/hwcnt/sample.hpp>
+#include <device/hwcnt/sampler/detail/backend.hpp>
+#include <device/hwcnt/sampler/manual.hpp>
+#include <device/hwcnt/sampler/multiplexer.hpp>
+
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <initializer_list>
+#include <memory>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace hwcpipe {
+namespace device {
+namespace hwcnt {
+namespace sampler {
+
+namespace {
+
+constexpr uint16_t counters_per_block = 64;
+
+/** One front-end block and two shader core blocks. */
+const block_extents extents{{1, 0, 0, 2, 0, 0}, counters_per_block, sample_values_type::uint64};
+
+/** Fake GPU, whose counters count at a constant rate. */
+struct fake_gpu {
+    /** Configurations of the sessions opened. */
+    std::vector<std::vector<configuration>> sessions;
+    /** Duration of the windows sampled, in turn. */
+    std::vector<uint64_t> windows_ns;
+    /** Number of windows sampled. */
+    size_t num_windows{};
+    /** Number of sessions open. */
+    int num_open{};
+
+    /** @return Value of a counter of a block over a window. */
+    static uint64_t value(size_t counter, uint64_t window_ns) { return (counter + 1) * window_ns / 1000; }
+};
+
+/** Reader of the samples of a fake session. */
+class fake_reader : public reader {
+  public:
+    fake_reader(fake_gpu &gpu, std::vector<configuration> config)
+        : reader(-1, {}, extents)
+        , gpu_(gpu)
+        , config_(std::move(config)) {}
+
+    /** Take a sample of the next window. */
+    void take_sample(uint64_t user_data) {
+        const uint64_t window_ns = gpu_.windows_ns[gpu_.num_windows++ % gpu_.windows_ns.size()];
+
+        sample s{};
+        s.sm.user_data = user_data;
+        s.sm.timestamp_ns_begin = now_ns_;
+        now_ns_ += window_ns;
+        s.sm.timestamp_ns_end = now_ns_;
+
+        for (const auto &config : config_) {
+            for (uint8_t index = 0; index != extents.num_blocks_of_type(config.type); ++index) {
+                block b{};
+                b.type = config.type;
+                b.index = index;
+                b.set = config.set;
+                for (size_t i = 0; i != counters_per_block; ++i)
+                    b.values[i] = config.enable_map[i] ? fake_gpu::value(i, window_ns) : 0;
+                s.blocks.push_back(b);
+            }
+        }
+
+        samples_.push_back(std::move(s));
+    }
+
+    std::error_code get_sample(sample_metadata &sm, sample_handle &sample_hndl) override {
+        if (samples_.empty())
+            return std::make_error_code(std::errc::resource_unavailable_try_again);
+
+        sm = samples_.front().sm;
+        sample_hndl.get<const void *>() = &samples_.front();
+        return {};
+    }
+
+    bool next(sample_handle sample_hndl, block_metadata &bm, block_handle &block_hndl) const override {
+        const auto &s = *static_cast<const sample *>(sample_hndl.get<const void *>());
+        auto &index = block_hndl.get<size_t>();
+
+        if (index == s.blocks.size())
+            return false;
+
+        const auto &b = s.blocks[index++];
+        bm.type = b.type;
+        bm.index = b.index;
+        bm.set = b.set;
+        bm.state = {};
+        bm.values = b.values.data();
+        return true;
+    }
+
+    std::error_code put_sample(sample_handle) override {
+        samples_.pop_front();
+        return {};
+    }
+
+    std::error_code discard() override {
+        samples_.clear();
+        return {};
+    }
+
+  private:
+    struct block {
+        block_type type;
+        uint8_t index;
+        prfcnt_set set;
+        std::array<uint64_t, counters_per_block> values;
+    };
+
+    struct sample {
+        sample_metadata sm;
+        std::vector<block> blocks;
+    };
+
+    fake_gpu &gpu_;
+    std::vector<configuration> config_;
+    std::deque<sample> samples_;
+    uint64_t now_ns_{};
+};
+
+/** Manual back-end of a fake session. */
+class fake_backend : public detail::backend {
+  public:
+    fake_backend(fake_gpu &gpu, std::vector<configuration> config)
+        : gpu_(gpu)
+        , reader_(gpu, std::move(config)) {
+        ++gpu_.num_open;
+    }
+
+    ~fake_backend() override { --gpu_.num_open; }
+
+    std::error_code start(uint64_t) override { return {}; }
+    std::error_code stop(uint64_t user_data) override {
+        reader_.take_sample(user_data);
+        return {};
+    }
+    std::error_code request_sample(uint64_t user_data) override {
+        reader_.take_sample(user_data);
+        return {};
+    }
+    reader &get_reader() override { return reader_; }
+
+  private:
+    fake_gpu &gpu_;
+    fake_reader reader_;
+};
+
+std::error_code fake_factory(void *user_data, const configuration *config, size_t config_len, manual &sampler) {
+    auto &gpu = *static_cast<fake_gpu *>(user_data);
+
+    // a device has a single session at a time
+    REQUIRE(gpu.num_open == 0);
+
+    gpu.sessions.emplace_back(config, config + config_len);
+    sampler = manual{std::make_unique<fake_backend>(gpu, gpu.sessions.back())};
+    return {};
+}
+
+configuration::enable_map_type counters(std::initializer_list<size_t> lst) {
+    configuration::enable_map_type result{};
+    for (const auto counter : lst)
+        result[counter] = true;
+    return result;
+}
+
+} // namespace
+
+TEST_CASE("multiplexer__Plan") {
+    std::vector<multiplexer::pass_type> passes{};
+
+    SECTION("A single set within the limits is one pass") {
+        const std::vector<configuration> config{
+            {block_type::fe, prfcnt_set::primary, counters({4, 5})},
+            {block_type::core, prfcnt_set::primary, counters({6})},
+        };
+
+        REQUIRE(!multiplexer::plan(config.data(), config.size(), 128, passes));
+        REQUIRE(passes.size() == 1);
+        REQUIRE(passes[0].size() == 2);
+    }
+
+    SECTION("Sets are split into passes") {
+        const std::vector<configuration> config{
+            {block_type::core, prfcnt_set::secondary, counters({6})},
+            {block_type::fe, prfcnt_set::primary, counters({4})},
+            {block_type::core, prfcnt_set::primary, counters({7})},
+        };
+
+        REQUIRE(!multiplexer::plan(config.data(), config.size(), 128, passes));
+        REQUIRE(passes.size() == 2);
+        REQUIRE(passes[0].size() == 2);
+        REQUIRE(passes[0][0].set == prfcnt_set::primary);
+        REQUIRE(passes[1].size() == 1);
+        REQUIRE(passes[1][0].set == prfcnt_set::secondary);
+        REQUIRE(passes[1][0].enable_map == counters({6}));
+    }
+
+    SECTION("Blocks are split by the counters limit") {
+        const std::vector<configuration> config{
+            {block_type::fe, prfcnt_set::primary, counters({4})},
+            {block_type::core, prfcnt_set::primary, counters({4, 5, 6})},
+            {block_type::core, prfcnt_set::primary, counters({7, 8})},
+        };
+
+        REQUIRE(!multiplexer::plan(config.data(), config.size(), 2, passes));
+        REQUIRE(passes.size() == 3);
+        REQUIRE(passes[0].size() == 2);
+        REQUIRE(passes[0][1].enable_map == counters({4, 5}));
+        REQUIRE(passes[1].size() == 1);
+        REQUIRE(passes[1][0].enable_map == counters({6, 7}));
+        REQUIRE(passes[2][0].enable_map == counters({8}));
+    }
+
+    SECTION("Nothing enabled is no pass") {
+        const std::vector<configuration> config{{block_type::fe, prfcnt_set::primary, {}}};
+
+        REQUIRE(!multiplexer::plan(config.data(), config.size(), 128, passes));
+        REQUIRE(passes.empty());
+    }
+
+    SECTION("A zero limit is invalid") {
+        REQUIRE(multiplexer::plan(nullptr, 0, 0, passes) == std::errc::invalid_argument);
+    }
+}
+
+TEST_CASE("multiplexer__RotatesPasses") {
+    fake_gpu gpu{};
+    const std::vector<configuration> config{
+        {block_type::fe, prfcnt_set::primary, counters({4})},
+        {block_type::core, prfcnt_set::secondary, counters({6})},
+    };
+
+    multiplexer mux{fake_factory, &gpu, config.data(), config.size()};
+    REQUIRE(mux);
+    REQUIRE(mux.num_passes() == 2);
+
+    // the primary pass counts 1us windows, the secondary pass 3us windows
+    gpu.windows_ns = {1000, 3000};
+
+    REQUIRE(!mux.start());
+    for (int i = 0; i != 3; ++i) {
+        REQUIRE(mux.get_current_pass() == 0);
+        REQUIRE(!mux.rotate());
+        REQUIRE(mux.get_current_pass() == 1);
+        REQUIRE(!mux.rotate());
+    }
+    REQUIRE(!mux.stop());
+    REQUIRE(gpu.num_open == 0);
+
+    // the last window is counted by the primary pass
+    REQUIRE(gpu.sessions.size() == 7);
+    REQUIRE(gpu.num_windows == 7);
+
+    multiplexer::estimate estimate{};
+    REQUIRE(!mux.get_estimate(block_type::fe, prfcnt_set::primary, 4, estimate));
+    REQUIRE(estimate.enabled_ns == 4 * 1000 + 3 * 3000);
+    REQUIRE(estimate.counted_ns == 4 * 1000);
+    REQUIRE(estimate.raw == 4 * fake_gpu::value(4, 1000));
+    REQUIRE(estimate.scaled == Approx(static_cast<double>(fake_gpu::value(4, estimate.enabled_ns))));
+
+    // two shader cores
+    REQUIRE(!mux.get_estimate(block_type::core, prfcnt_set::secondary, 6, estimate));
+    REQUIRE(estimate.counted_ns == 3 * 3000);
+    REQUIRE(estimate.raw == 2 * 3 * fake_gpu::value(6, 3000));
+    REQUIRE(estimate.scaled == Approx(2.0 * static_cast<double>(fake_gpu::value(6, estimate.enabled_ns))));
+
+    REQUIRE(mux.get_estimate(block_type::core, prfcnt_set::primary, 6, estimate) == std::errc::invalid_argument);
+
+    SECTION("Starting again clears the estimates") {
+        REQUIRE(!mux.start());
+        REQUIRE(!mux.stop());
+        REQUIRE(!mux.get_estimate(block_type::core, prfcnt_set::secondary, 6, estimate));
+        REQUIRE(estimate.counted_ns == 0);
+        REQUIRE(estimate.scaled == 0.0);
+    }
+}
+
+TEST_CASE("multiplexer__SinglePassKeepsItsSession") {
+    fake_gpu gpu{};
+    gpu.windows_ns = {2000};
+    const std::vector<configuration> config{{block_type::core, prfcnt_set::primary, counters({6})}};
+
+    multiplexer mux{fake_factory, &gpu, config.data(), config.size()};
+    REQUIRE(mux.num_passes() == 1);
+
+    REQUIRE(!mux.start());
+    REQUIRE(!mux.rotate());
+    REQUIRE(!mux.rotate());
+    REQUIRE(!mux.stop());
+    REQUIRE(gpu.sessions.size() == 1);
+
+    multiplexer::estimate estimate{};
+    REQUIRE(!mux.get_estimate(block_type::core, prfcnt_set::primary, 6, estimate));
+    REQUIRE(estimate.counted_ns == estimate.enabled_ns);
+    REQUIRE(estimate.scaled == Approx(static_cast<double>(estimate.raw)));
+
+    REQUIRE(mux.rotate() == std::errc::invalid_argument);
+}
+
+TEST_CASE("multiplexer__PauseKeepsTheSession") {
+    fake_gpu gpu{};
+    const std::vector<configuration> config{
+        {block_type::fe, prfcnt_set::primary, counters({4})},
+        {block_type::core, prfcnt_set::secondary, counters({6})},
+    };
+
+    multiplexer mux{fake_factory, &gpu, config.data(), config.size()};
+    gpu.windows_ns = {1000};
+
+    REQUIRE(mux.pause() == std::errc::invalid_argument);
+    REQUIRE(!mux.start());
+    REQUIRE(!mux.rotate());
+    REQUIRE(!mux.pause());
+    REQUIRE(mux.is_paused());
+    REQUIRE(mux.pause() == std::errc::invalid_argument);
+    REQUIRE(mux.rotate() == std::errc::invalid_argument);
+
+    // the session of the secondary pass stays open, and its window was collected
+    REQUIRE(gpu.num_open == 1);
+    REQUIRE(gpu.num_windows == 2);
+
+    REQUIRE(!mux.resume());
+    REQUIRE(!mux.is_paused());
+    REQUIRE(mux.resume() == std::errc::invalid_argument);
+    REQUIRE(gpu.sessions.size() == 2);
+    REQUIRE(mux.get_current_pass() == 1);
+
+    SECTION("Estimates are kept across the pause") {
+        REQUIRE(!mux.stop());
+        REQUIRE(gpu.num_windows == 3);
+
+        multiplexer::estimate estimate{};
+        REQUIRE(!mux.get_estimate(block_type::core, prfcnt_set::secondary, 6, estimate));
+        REQUIRE(estimate.counted_ns == 2 * 1000);
+        REQUIRE(estimate.enabled_ns == 3 * 1000);
+    }
+
+    SECTION("Stopping a paused multiplexer closes its session") {
+        REQUIRE(!mux.pause());
+        REQUIRE(!mux.stop());
+        REQUIRE(gpu.num_open == 0);
+        REQUIRE(gpu.num_windows == 3);
+        REQUIRE(!mux.is_paused());
+    }
+}
+
+} // namespace sampler
+} // namespace hwcnt
+} // namespace device
+} // namespace hwcpipe
@@ -0,0 +1,397 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <catch2/catch.hpp>
+
+#include <device/hwcnt/backend_type.hpp>
+#include <device/hwcnt/block_extents.hpp>
+#include <device/hwcnt/sample.hpp>
+#include <device/hwcnt/sampler/configuration.hpp>
+#include <device/hwcnt/sampler/panthor/backend.hpp>
+#include <device/hwcnt/sampler/panthor/setup.hpp>
+#include <device/ioctl/panthor/commands.hpp>
+#include <device/ioctl/panthor/types.hpp>
+#include <device/kbase_version.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include <poll.h>
+#include <sys/types.h>
+
+namespace hwcpipe {
+namespace device {
+namespace hwcnt {
+namespace sampler {
+namespace panthor {
+
+namespace {
+
+namespace pioctl = ioctl::panthor;
+
+/** @return Untyped ioctl argument pointer. */
+void *to_ptr(const ioctl::pointer64<void> &ptr) { return reinterpret_cast<void *>(ptr.as_uint64()); }
+
+/** Panthor kernel driver model, with a firmware, a cshw, a tiler, a memsys and two shader core blocks. */
+struct fake_kernel {
+    enum : int {
+        device_fd = 3,
+        event_fd = 42,
+        session = 7,
+    };
+
+    fake_kernel() {
+        info.counters_per_block = 64;
+        info.sample_header_size = sizeof(pioctl::perf_sample_header);
+        info.block_header_size = sizeof(pioctl::perf_block_header);
+        info.supported_clocks = static_cast<uint64_t>(pioctl::perf_info::clock_type::toplevel);
+        info.fw_blocks = 1;
+        info.cshw_blocks = 1;
+        info.tiler_blocks = 1;
+        info.memsys_blocks = 1;
+        info.shader_blocks = 2;
+    }
+
+    /** Write a sample in the ring buffer and signal the eventfd. */
+    void take_sample(uint64_t user_data) {
+        const size_t sample_size = ring.size() / sample_slots;
+        auto *sample = ring.data() + (control.insert_idx % sample_slots) * sample_size;
+
+        pioctl::perf_sample_header header{};
+        header.timestamp_start_ns = timestamp_ns;
+        timestamp_ns += 1000;
+        header.timestamp_end_ns = timestamp_ns;
+        header.user_data = user_data;
+        header.toplevel_clock_cycles = 500;
+        std::memcpy(sample, &header, sizeof(header));
+
+        const size_t block_size = info.block_header_size + info.counters_per_block * sizeof(uint64_t);
+        for (size_t i = 0; i != 6; ++i) {
+            pioctl::perf_block_header block{};
+            block.block_states = static_cast<uint8_t>(pioctl::perf_block_header::block_state::on);
+            std::memcpy(sample + info.sample_header_size + i * block_size, &block, sizeof(block));
+        }
+
+        ++control.insert_idx;
+        ++event_count;
+    }
+
+    pioctl::perf_info info{};
+    pioctl::perf_ringbuf_control control{};
+    std::vector<uint8_t> ring;
+    uint32_t sample_slots{};
+    uint64_t timestamp_ns{1000};
+    uint64_t event_count{};
+    pioctl::perf_cmd_setup setup{};
+    std::vector<pioctl::perf_control::command> commands;
+    std::vector<uint32_t> closed_handles;
+    unsigned num_polls{};
+};
+
+/** Syscall iface that forwards the calls to a fake_kernel. */
+class fake_iface {
+  public:
+    fake_iface() = default;
+
+    explicit fake_iface(fake_kernel *kernel)
+        : kernel_(kernel) {}
+
+    template <typename arg_t>
+    std::pair<std::error_code, int> ioctl(int fd, pioctl::command::command_type command, arg_t *arg) {
+        REQUIRE(fd == fake_kernel::device_fd);
+
+        switch (command) {
+        case pioctl::command::dev_query: {
+            auto &query = *reinterpret_cast<pioctl::dev_query *>(arg);
+            REQUIRE(query.type == pioctl::dev_query::query_type::perf_info);
+            REQUIRE(query.size == sizeof(pioctl::perf_info));
+            std::memcpy(to_ptr(query.pointer), &kernel_->info, sizeof(kernel_->info));
+            return {};
+        }
+        case pioctl::command::bo_create:
+            reinterpret_cast<pioctl::bo_create *>(arg)->handle = ++num_bos_;
+            return {};
+        case pioctl::command::bo_mmap_offset: {
+            auto &mmap_offset = *reinterpret_cast<pioctl::bo_mmap_offset *>(arg);
+            mmap_offset.offset = static_cast<uint64_t>(mmap_offset.handle) << 12;
+            return {};
+        }
+        case pioctl::command::gem_close:
+            kernel_->closed_handles.push_back(reinterpret_cast<pioctl::gem_close *>(arg)->handle);
+            return {};
+        case pioctl::command::perf_control:
+            return perf_control(*reinterpret_cast<pioctl::perf_control *>(arg));
+        case pioctl::command::drm_version:
+        default:
+            break;
+        }
+
+        return {std::make_error_code(std::errc::invalid_argument), -1};
+    }
+
+    std::pair<std::error_code, void *> mmap(void *, size_t len, int, int flags, int, off_t offset) {
+        REQUIRE(flags == MAP_SHARED);
+
+        // the ring buffer is created first
+        if (offset == (1 << 12)) {
+            kernel_->ring.resize(len);
+            return {std::error_code{}, kernel_->ring.data()};
+        }
+
+        REQUIRE(len == sizeof(kernel_->control));
+        return {std::error_code{}, &kernel_->control};
+    }
+
+    std::error_code munmap(void *, size_t) { return {}; }
+
+    std::error_code close(int fd) {
+        REQUIRE(fd == fake_kernel::event_fd);
+        return {};
+    }
+
+    std::pair<std::error_code, int> eventfd(unsigned int, int) { return {std::error_code{}, fake_kernel::event_fd}; }
+
+    std::pair<std::error_code, ssize_t> read(int fd, void *buf, size_t count) {
+        REQUIRE(fd == fake_kernel::event_fd);
+        REQUIRE(count == sizeof(uint64_t));
+
+        if (kernel_->event_count == 0)
+            return {std::make_error_code(std::errc::resource_unavailable_try_again), -1};
+
+        std::memcpy(buf, &kernel_->event_count, sizeof(uint64_t));
+        kernel_->event_count = 0;
+        return {std::error_code{}, sizeof(uint64_t)};
+    }
+
+    std::pair<std::error_code, ssize_t> write(int fd, const void *buf, size_t count) {
+        REQUIRE(fd == fake_kernel::event_fd);
+
+        uint64_t value{};
+        std::memcpy(&value, buf, sizeof(value));
+        kernel_->event_count += value;
+        return {std::error_code{}, static_cast<ssize_t>(count)};
+    }
+
+    std::pair<std::error_code, int> poll(struct pollfd *fds, nfds_t, int) {
+        REQUIRE(fds[0].fd == fake_kernel::event_fd);
+        ++kernel_->num_polls;
+
+        // the manual samples are taken before they are waited for
+        return {std::error_code{}, kernel_->event_count != 0 ? 1 : 0};
+    }
+
+  private:
+    std::pair<std::error_code, int> perf_control(const pioctl::perf_control &control) {
+        kernel_->commands.push_back(control.cmd);
+
+        if (control.cmd == pioctl::perf_control::command::setup) {
+            REQUIRE(control.size == sizeof(pioctl::perf_cmd_setup));
+            std::memcpy(&kernel_->setup, to_ptr(control.pointer), sizeof(kernel_->setup));
+            kernel_->sample_slots = kernel_->setup.sample_slots;
+            return {std::error_code{}, static_cast<int>(fake_kernel::session)};
+        }
+
+        REQUIRE(control.handle == static_cast<uint32_t>(fake_kernel::session));
+
+        uint64_t user_data{};
+        if (control.size == sizeof(user_data))
+            std::memcpy(&user_data, to_ptr(control.pointer), sizeof(user_data));
+
+        if (control.cmd == pioctl::perf_control::command::sample ||
+            control.cmd == pioctl::perf_control::command::stop)
+            kernel_->take_sample(user_data);
+
+        return {};
+    }
+
+    fake_kernel *kernel_{};
+    uint32_t num_bos_{};
+};
+
+/** Instance of the fake kernel device. */
+struct fake_instance {
+    explicit fake_instance(const pioctl::perf_info &info)
+        : extents(construct_block_extents(info)) {}
+
+    block_extents get_hwcnt_block_extents() const { return extents; }
+    int fd() const { return fake_kernel::device_fd; }
+
+    block_extents extents;
+};
+
+using backend_impl_type = backend<fake_iface>;
+
+std::vector<configuration> make_config() {
+    return {
+        {block_type::fe, prfcnt_set::primary, 0b1},
+        {block_type::core, prfcnt_set::primary, 0b110},
+    };
+}
+
+} // namespace
+
+TEST_CASE("panthor_backend__Setup") {
+    fake_kernel kernel;
+    fake_iface iface{&kernel};
+    const fake_instance instance{kernel.info};
+    auto config = make_config();
+
+    SECTION("Creates the session") {
+        auto result = setup(instance, 0, config.data(), config.data() + config.size(), 10, iface);
+        REQUIRE(!result.first);
+
+        auto &args = result.second;
+        REQUIRE(args.session == static_cast<uint32_t>(fake_kernel::session));
+        REQUIRE(args.sample_slots == 16);
+        REQUIRE(args.base_args.features_v.buffer_count == 16);
+        REQUIRE(args.base_args.features_v.has_gpu_cycle);
+        REQUIRE(!args.base_args.features_v.has_sc_cycle);
+        REQUIRE(args.base_args.extents.num_blocks() == 3);
+
+        REQUIRE(kernel.setup.fd == static_cast<uint32_t>(fake_kernel::event_fd));
+        REQUIRE(kernel.setup.sample_slots == 16);
+        REQUIRE(kernel.setup.ringbuf_handle == 1);
+        REQUIRE(kernel.setup.control_handle == 2);
+        REQUIRE(kernel.setup.cshw_enable_mask[0] == 0b1);
+        REQUIRE(kernel.setup.shader_enable_mask[0] == 0b110);
+        REQUIRE(kernel.setup.tiler_enable_mask[0] == 0);
+        REQUIRE(kernel.ring.size() == args.sample_layout_v.sample_size() * 16);
+    }
+
+    SECTION("Periodic sampling is not supported") {
+        auto result = setup(instance, 1000000, config.data(), config.data() + config.size(), 0, iface);
+        REQUIRE(result.first == std::errc::not_supported);
+        REQUIRE(kernel.commands.empty());
+    }
+
+    SECTION("Blocks must use the same set") {
+        config[1].set = prfcnt_set::secondary;
+        auto result = setup(instance, 0, config.data(), config.data() + config.size(), 0, iface);
+        REQUIRE(result.first == std::errc::invalid_argument);
+        REQUIRE(kernel.commands.empty());
+    }
+}
+
+TEST_CASE("panthor_backend__ReadsSamplesInPlace") {
+    fake_kernel kernel;
+    fake_iface iface{&kernel};
+    const fake_instance instance{kernel.info};
+    const auto config = make_config();
+
+    auto result = setup(instance, 0, config.data(), config.data() + config.size(), 4, iface);
+    REQUIRE(!result.first);
+
+    {
+        backend_impl_type backend{std::move(result.second), iface};
+        // the ring buffer and its control page
+        REQUIRE(backend.get_features().mapped_size == kernel.ring.size() + sizeof(kernel.control));
+
+        REQUIRE(!backend.start(1));
+        REQUIRE(!backend.request_sample(2));
+        REQUIRE(!backend.request_sample(3));
+
+        sample_metadata sm{};
+        sample_handle sh{};
+
+        REQUIRE(!backend.get_sample(sm, sh));
+        REQUIRE(sm.user_data == 2);
+        REQUIRE(sm.sample_nr == 0);
+        REQUIRE(sm.timestamp_ns_begin == 1000);
+        REQUIRE(sm.timestamp_ns_end == 2000);
+        REQUIRE(sm.gpu_cycle == 500);
+        REQUIRE(sm.sc_cycle == 500);
+
+        SECTION("Only the configured blocks are decoded") {
+            const size_t block_size = sizeof(pioctl::perf_block_header) + 64 * sizeof(uint64_t);
+            const uint8_t *sample = kernel.ring.data();
+
+            block_metadata bm{};
+            block_handle bh{};
+            REQUIRE(backend.next(sh, bm, bh));
+            REQUIRE(bm.type == block_type::fe);
+            REQUIRE(bm.state.on);
+            REQUIRE(bm.values == sample + sizeof(pioctl::perf_sample_header) + block_size +
+                                     sizeof(pioctl::perf_block_header));
+
+            REQUIRE(backend.next(sh, bm, bh));
+            REQUIRE(bm.type == block_type::core);
+            REQUIRE(bm.index == 0);
+            REQUIRE(backend.next(sh, bm, bh));
+            REQUIRE(bm.type == block_type::core);
+            REQUIRE(bm.index == 1);
+            REQUIRE(bm.values == sample + sizeof(pioctl::perf_sample_header) + 5 * block_size +
+                                     sizeof(pioctl::perf_block_header));
+            REQUIRE(!backend.next(sh, bm, bh));
+
+            std::array<block_metadata, 8> blocks{};
+            REQUIRE(backend.get_blocks(sh, blocks.data(), blocks.size()) == 3);
+            REQUIRE(blocks[2].values == bm.values);
+        }
+
+        SECTION("Samples left in the ring buffer are read without polling") {
+            REQUIRE(backend.get_ready_sample(sm, sh) == std::errc::device_or_resource_busy);
+            REQUIRE(!backend.put_sample(sh));
+            REQUIRE(kernel.control.extract_idx == 1);
+
+            // the eventfd is signaled again, as a sample is still waiting
+            REQUIRE(kernel.event_count != 0);
+
+            const unsigned num_polls = kernel.num_polls;
+            REQUIRE(!backend.get_sample(sm, sh));
+            REQUIRE(kernel.num_polls == num_polls);
+            REQUIRE(sm.user_data == 3);
+            REQUIRE(sm.sample_nr == 1);
+            REQUIRE(!backend.put_sample(sh));
+            REQUIRE(kernel.event_count == 0);
+
+            REQUIRE(backend.get_ready_sample(sm, sh) == std::errc::resource_unavailable_try_again);
+        }
+
+        SECTION("Discard drops the samples waiting") {
+            REQUIRE(!backend.put_sample(sh));
+            REQUIRE(!backend.discard());
+            REQUIRE(kernel.control.extract_idx == 2);
+            REQUIRE(backend.get_ready_sample(sm, sh) == std::errc::resource_unavailable_try_again);
+
+            // the samples are numbered by their ring buffer index, the discarded one included
+            REQUIRE(!backend.request_sample(5));
+            REQUIRE(!backend.get_sample(sm, sh));
+            REQUIRE(sm.user_data == 5);
+            REQUIRE(sm.sample_nr == 2);
+            REQUIRE(!backend.put_sample(sh));
+        }
+
+        REQUIRE(!backend.stop(4));
+    }
+
+    // the session is torn down, and the buffer objects closed
+    REQUIRE(kernel.commands.back() == pioctl::perf_control::command::teardown);
+    REQUIRE(kernel.closed_handles == std::vector<uint32_t>{2, 1});
+}
+
+TEST_CASE("panthor_backend__BackendType") {
+    const kbase_version version{1, 3, ioctl_iface_type::panthor};
+
+    const auto available = backend_type_discover(version, product_id::g610);
+    REQUIRE(available.count() == 1);
+    REQUIRE(available.test(static_cast<size_t>(backend_type::panthor)));
+
+    const auto parsed = backend_type_from_str("panthor");
+    REQUIRE(!parsed.first);
+    REQUIRE(parsed.second == backend_type::panthor);
+    REQUIRE(std::strcmp(backend_type_to_str(backend_type::panthor), "panthor") == 0);
+}
+
+} // namespace panthor
+} // namespace sampler
+} // namespace hwcnt
+} // namespace device
+} // namespace hwcpipe
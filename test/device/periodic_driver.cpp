@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <catch2/catch.hpp>
+
+#include <device/hwcnt/reader.hpp>
+#include <device/hwcnt/sampler/detail/backend.hpp>
+#include <device/hwcnt/sampler/manual.hpp>
+#include <device/hwcnt/sampler/periodic_driver.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace hwcpipe {
+namespace device {
+namespace hwcnt {
+namespace sampler {
+
+namespace {
+
+/** Reader without samples. */
+class null_reader : public reader {
+  public:
+    null_reader()
+        : reader(-1, {}, {}) {}
+
+    std::error_code get_sample(sample_metadata &, sample_handle &) override {
+        return std::make_error_code(std::errc::resource_unavailable_try_again);
+    }
+    bool next(sample_handle, block_metadata &, block_handle &) const override { return false; }
+    std::error_code put_sample(sample_handle) override { return {}; }
+    std::error_code discard() override { return {}; }
+};
+
+/** Manual backend that records the user data of the sample requests. */
+class recording_backend : public detail::backend {
+  public:
+    explicit recording_backend(std::vector<uint64_t> &requests)
+        : requests_(requests) {}
+
+    std::error_code start(uint64_t) override { return {}; }
+    std::error_code stop(uint64_t) override { return {}; }
+    std::error_code request_sample(uint64_t user_data) override {
+        requests_.push_back(user_data);
+        return {};
+    }
+    reader &get_reader() override { return reader_; }
+
+  private:
+    std::vector<uint64_t> &requests_;
+    null_reader reader_;
+};
+
+/** @return The time elapsed since @p begin in nanoseconds. */
+uint64_t elapsed_ns(std::chrono::steady_clock::time_point begin) {
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin).count());
+}
+
+} // namespace
+
+TEST_CASE("PeriodicDriver__WhenStarted__RequestsOneSamplePerPeriod") {
+    constexpr uint64_t period_ns = 2000000;
+
+    std::vector<uint64_t> requests{};
+    manual m{std::make_unique<recording_backend>(requests)};
+
+    periodic_driver driver{m, period_ns};
+    REQUIRE(driver);
+    REQUIRE(driver.get_fd() >= 0);
+    REQUIRE(driver.get_period() == period_ns);
+    const auto begin = std::chrono::steady_clock::now();
+    REQUIRE(!driver.start());
+
+    // a loaded machine may miss deadlines at any tick, so only the bounds that hold whatever the scheduling
+    // are checked: a tick comes after its deadline, and the missed deadlines are counted in the tick numbers
+    periodic_driver::tick_info tick{};
+    std::vector<uint64_t> ticks{};
+    for (uint64_t i = 0; i < 3; ++i) {
+        REQUIRE(!driver.wait_and_request(tick));
+        REQUIRE(tick.tick == (ticks.empty() ? 0 : ticks.back() + 1) + tick.missed);
+        REQUIRE((tick.tick + 1) * period_ns <= elapsed_ns(begin));
+        ticks.push_back(tick.tick);
+    }
+    REQUIRE(requests == ticks);
+
+    // miss a few deadlines, one sample is requested for all of them
+    std::this_thread::sleep_for(std::chrono::nanoseconds(period_ns * 3 + period_ns / 2));
+    REQUIRE(!driver.wait_and_request(tick));
+    REQUIRE(tick.missed >= 2);
+    REQUIRE(tick.tick == ticks.back() + 1 + tick.missed);
+    REQUIRE(requests.size() == 4);
+    REQUIRE(requests.back() == tick.tick);
+
+    // the schedule doesn't drift after the missed deadlines, the deadlines stay on the grid of the first one
+    const uint64_t last_tick = tick.tick;
+    REQUIRE(!driver.wait_and_request(tick));
+    REQUIRE(tick.tick == last_tick + 1 + tick.missed);
+    REQUIRE((tick.tick + 1) * period_ns <= elapsed_ns(begin));
+    REQUIRE((tick.tick + 1) * period_ns + tick.lateness_ns <= elapsed_ns(begin));
+
+    REQUIRE(!driver.stop());
+}
+
+TEST_CASE("PeriodicDriver__WhenPeriodIsChanged__KeepsTheTickNumbers") {
+    constexpr uint64_t period_ns = 2000000;
+
+    std::vector<uint64_t> requests{};
+    manual m{std::make_unique<recording_backend>(requests)};
+
+    periodic_driver driver{m, period_ns};
+    REQUIRE(driver);
+    REQUIRE(driver.set_period(0) == std::errc::invalid_argument);
+    REQUIRE(!driver.set_period(period_ns * 2));
+    REQUIRE(driver.get_period() == period_ns * 2);
+    const auto begin = std::chrono::steady_clock::now();
+    REQUIRE(!driver.start());
+
+    periodic_driver::tick_info tick{};
+    REQUIRE(!driver.wait_and_request(tick));
+    const uint64_t first_tick = tick.tick;
+    REQUIRE(first_tick == tick.missed);
+    REQUIRE((first_tick + 1) * period_ns * 2 <= elapsed_ns(begin));
+
+    // only bounds that hold on a loaded machine are checked, see RequestsOneSamplePerPeriod
+    REQUIRE(!driver.set_period(period_ns));
+    REQUIRE(driver.get_period() == period_ns);
+    std::vector<uint64_t> ticks{first_tick};
+    for (uint64_t i = 1; i < 4; ++i) {
+        REQUIRE(!driver.wait_and_request(tick));
+        REQUIRE(tick.tick == ticks.back() + 1 + tick.missed);
+        // the new period starts at the last deadline of the old one
+        const uint64_t deadline_ns = (first_tick + 1) * period_ns * 2 + (tick.tick - first_tick) * period_ns;
+        REQUIRE(deadline_ns + tick.lateness_ns <= elapsed_ns(begin));
+        ticks.push_back(tick.tick);
+    }
+    REQUIRE(requests == ticks);
+
+    REQUIRE(!driver.stop());
+}
+
+TEST_CASE("PeriodicDriver__WhenPeriodIsZero__IsInvalid") {
+    std::vector<uint64_t> requests{};
+    manual m{std::make_unique<recording_backend>(requests)};
+
+    periodic_driver driver{m, 0};
+    REQUIRE(!driver);
+}
+
+} // namespace sampler
+} // namespace hwcnt
+} // namespace device
+} // namespace hwcpipe
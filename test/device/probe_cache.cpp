@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <catch2/catch.hpp>
+
+#include <device/probe_cache.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+namespace hwcpipe {
+namespace device {
+
+namespace {
+
+probe_cache_entry make_entry() {
+    probe_cache_entry entry{};
+    entry.version = kbase_version(11, 40, ioctl_iface_type::csf);
+    entry.consts.gpu_id = 0xa8670000;
+    entry.consts.num_shader_cores = 4;
+    entry.consts.shader_core_mask = 0xf;
+    entry.consts.num_l2_slices = 2;
+    entry.selected_backend_type = hwcnt::backend_type::kinstr_prfcnt;
+    entry.backend_type = hwcnt::backend_type::kinstr_prfcnt_wa;
+    entry.block_extents = hwcnt::block_extents({{1, 1, 2, 4}}, 64, hwcnt::sample_values_type::uint64);
+    entry.clock_extents = hwcnt::clock_extents(true, false);
+    entry.enum_info.num_values = 64;
+    entry.enum_info.num_blocks_of_type = {{1, 1, 2, 4}};
+    entry.enum_info.has_cycles_top = true;
+    return entry;
+}
+
+/** Overwrites a byte of the entry body in the cache file. */
+void corrupt(const std::string &path, size_t offset, uint8_t value) {
+    std::FILE *file = std::fopen(path.c_str(), "r+b");
+    REQUIRE(file != nullptr);
+    /* The entry follows the file header: magic, version and entry size. */
+    REQUIRE(std::fseek(file, static_cast<long>(3 * sizeof(uint32_t) + offset), SEEK_SET) == 0);
+    REQUIRE(std::fputc(value, file) == value);
+    std::fclose(file);
+}
+
+} // namespace
+
+TEST_CASE("probe_cache__StoresAndValidatesEntries") {
+    const std::string path = "probe_cache_test.bin";
+    std::remove(path.c_str());
+
+    const probe_cache cache{path.c_str()};
+    const auto stored = make_entry();
+    probe_cache_entry loaded{};
+
+    REQUIRE(cache.enabled());
+    REQUIRE(!cache.load(loaded));
+    REQUIRE(cache.store(stored));
+    REQUIRE(cache.load(loaded));
+
+    SECTION("The entry of the live driver is restored") {
+        REQUIRE(loaded.matches(stored.version, stored.consts, stored.selected_backend_type));
+        REQUIRE(loaded.valid());
+        REQUIRE(loaded.backend_type == hwcnt::backend_type::kinstr_prfcnt_wa);
+        REQUIRE(loaded.block_extents.num_blocks() == 8);
+        REQUIRE(loaded.block_extents.values_type() == hwcnt::sample_values_type::uint64);
+        REQUIRE(loaded.clock_extents.has_gpu_cycle());
+        REQUIRE(!loaded.clock_extents.has_sc_cycle());
+        REQUIRE(loaded.enum_info.num_values == 64);
+    }
+
+    SECTION("Another driver, GPU or back-end selection is not matched") {
+        auto consts = stored.consts;
+        consts.shader_core_mask = 0x7;
+
+        REQUIRE(!loaded.matches(kbase_version(11, 41, ioctl_iface_type::csf), stored.consts,
+                                stored.selected_backend_type));
+        REQUIRE(!loaded.matches(stored.version, consts, stored.selected_backend_type));
+        REQUIRE(!loaded.matches(stored.version, stored.consts, hwcnt::backend_type::vinstr));
+    }
+
+    SECTION("Corrupted entry bodies are not valid") {
+        const auto offset = GENERATE(offsetof(probe_cache_entry, backend_type),
+                                     offsetof(probe_cache_entry, block_extents),
+                                     offsetof(probe_cache_entry, clock_extents),
+                                     offsetof(probe_cache_entry, enum_info));
+        corrupt(path, offset, 0xff);
+
+        REQUIRE(cache.load(loaded));
+        REQUIRE(loaded.matches(stored.version, stored.consts, stored.selected_backend_type));
+        REQUIRE(!loaded.valid());
+    }
+
+    SECTION("Extents beyond the GPU constants are not valid") {
+        auto entry = stored;
+        entry.block_extents = hwcnt::block_extents({{1, 1, 2, 8}}, 64, hwcnt::sample_values_type::uint64);
+        entry.enum_info.num_blocks_of_type = {{1, 1, 2, 8}};
+        REQUIRE(!entry.valid());
+
+        entry = stored;
+        entry.enum_info.num_values = 32;
+        REQUIRE(!entry.valid());
+    }
+
+    SECTION("Files of another format are not loaded") {
+        std::FILE *file = std::fopen(path.c_str(), "wb");
+        REQUIRE(file != nullptr);
+        REQUIRE(std::fputs("not a probe cache", file) >= 0);
+        std::fclose(file);
+
+        REQUIRE(!cache.load(loaded));
+    }
+
+    std::remove(path.c_str());
+}
+
+TEST_CASE("probe_cache__IsDisabledWithoutPath") {
+    const probe_cache cache{nullptr};
+    probe_cache_entry entry{};
+
+    REQUIRE(!cache.enabled());
+    REQUIRE(!cache.load(entry));
+    REQUIRE(!cache.store(make_entry()));
+}
+
+} // namespace device
+} // namespace hwcpipe
@@ -0,0 +1,319 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <catch2/catch.hpp>
+
+#include <device/hwcnt/reader.hpp>
+#include <device/hwcnt/sample.hpp>
+#include <device/hwcnt/sampler/coalescing_collector.hpp>
+#include <device/hwcnt/sampler/event_loop.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <system_error>
+#include <vector>
+
+#include <unistd.h>
+
+namespace hwcpipe {
+namespace device {
+namespace hwcnt {
+
+namespace {
+
+/** Reader of a ring buffer holding `ready` samples, that counts the waits. */
+class fake_reader : public reader {
+  public:
+    explicit fake_reader(size_t ready, int fd = -1)
+        : reader(fd, {}, {})
+        , ready_(ready) {}
+
+    std::error_code get_sample(sample_metadata &sm, sample_handle &sample_hndl) override {
+        ++num_waits;
+        return get_ready_sample(sm, sample_hndl);
+    }
+
+    std::error_code get_ready_sample(sample_metadata &sm, sample_handle &sample_hndl) override {
+        if (ready_ == 0)
+            return std::make_error_code(std::errc::resource_unavailable_try_again);
+        if (taken_)
+            return std::make_error_code(std::errc::device_or_resource_busy);
+
+        --ready_;
+        taken_ = true;
+        sm.sample_nr = sample_nr_++;
+        sample_hndl.get<uint64_t>() = sm.sample_nr;
+        return {};
+    }
+
+    bool next(sample_handle, block_metadata &bm, block_handle &block_hndl) const override {
+        auto &index = block_hndl.get<size_t>();
+        if (index == num_blocks)
+            return false;
+
+        bm.type = block_type::core;
+        bm.index = static_cast<uint8_t>(index++);
+        return true;
+    }
+
+    std::error_code put_sample(sample_handle) override {
+        taken_ = false;
+        ++num_puts;
+        return put_error;
+    }
+
+    std::error_code discard() override { return {}; }
+
+    size_t num_blocks{};
+    unsigned num_waits{};
+    unsigned num_puts{};
+    std::error_code put_error{};
+
+  private:
+    size_t ready_;
+    bool taken_{};
+    uint64_t sample_nr_{};
+};
+
+void collect(void *user_data, const sample_metadata &sm, sample_handle sample_hndl) {
+    REQUIRE(sample_hndl.get<uint64_t>() == sm.sample_nr);
+    static_cast<std::vector<uint64_t> *>(user_data)->push_back(sm.sample_nr);
+}
+
+/** Pipe whose read end stands for a file descriptor the kernel signals. */
+struct fake_pipe {
+    fake_pipe() { REQUIRE(::pipe(fds) == 0); }
+    ~fake_pipe() {
+        ::close(fds[0]);
+        ::close(fds[1]);
+    }
+
+    void signal() {
+        const char byte{};
+        REQUIRE(::write(fds[1], &byte, 1) == 1);
+    }
+
+    int fds[2]{};
+};
+
+void consume(void *user_data, int fd) {
+    char byte{};
+    REQUIRE(::read(fd, &byte, 1) == 1);
+    ++*static_cast<unsigned *>(user_data);
+}
+
+} // namespace
+
+TEST_CASE("ReaderReadSamples__WhenSamplesAreReady__WaitsOnce") {
+    fake_reader r{5};
+    std::vector<uint64_t> sample_nrs{};
+    size_t count{};
+
+    const auto ec = r.read_samples(32, count, collect, &sample_nrs);
+    REQUIRE(!ec);
+    REQUIRE(count == 5);
+    REQUIRE(sample_nrs == std::vector<uint64_t>{0, 1, 2, 3, 4});
+    REQUIRE(r.num_waits == 1);
+    REQUIRE(r.num_puts == 5);
+}
+
+TEST_CASE("ReaderReadSamples__WhenMoreSamplesAreReady__StopsAtMaxCount") {
+    fake_reader r{5};
+    std::vector<uint64_t> sample_nrs{};
+    size_t count{};
+
+    REQUIRE(!r.read_samples(3, count, collect, &sample_nrs));
+    REQUIRE(count == 3);
+    REQUIRE(!r.read_samples(3, count, collect, &sample_nrs));
+    REQUIRE(count == 2);
+    REQUIRE(sample_nrs.size() == 5);
+    REQUIRE(r.num_waits == 2);
+}
+
+TEST_CASE("ReaderReadSamples__WhenNoSampleIsRead__ReturnsTheError") {
+    fake_reader r{0};
+    std::vector<uint64_t> sample_nrs{};
+    size_t count{};
+
+    REQUIRE(r.read_samples(32, count, collect, &sample_nrs));
+    REQUIRE(count == 0);
+    REQUIRE(sample_nrs.empty());
+}
+
+TEST_CASE("ReaderReadSamples__WhenPutFails__ReturnsTheError") {
+    fake_reader r{5};
+    r.put_error = std::make_error_code(std::errc::io_error);
+    std::vector<uint64_t> sample_nrs{};
+    size_t count{};
+
+    REQUIRE(r.read_samples(32, count, collect, &sample_nrs) == std::errc::io_error);
+    REQUIRE(count == 1);
+}
+
+TEST_CASE("ReaderGetSampleFor__WhenNoSampleIsReady__TimesOut") {
+    int fds[2]{};
+    REQUIRE(::pipe(fds) == 0);
+
+    fake_reader r{1, fds[0]};
+    sample_metadata sm{};
+    sample_handle sample_hndl{};
+
+    REQUIRE(r.get_sample_for(sm, sample_hndl, 1000000) == std::errc::timed_out);
+
+    {
+        std::error_code ec;
+        sample s{r, 1000000, ec};
+        REQUIRE(ec == std::errc::timed_out);
+        REQUIRE(!s);
+    }
+
+    // the kernel signals a sample
+    const char byte{};
+    REQUIRE(::write(fds[1], &byte, 1) == 1);
+
+    {
+        std::error_code ec;
+        {
+            sample s{r, 1000000, ec};
+            REQUIRE(!ec);
+            REQUIRE(s.get_metadata().sample_nr == 0);
+        }
+        REQUIRE(!ec);
+    }
+    REQUIRE(r.num_waits == 0);
+    REQUIRE(r.num_puts == 1);
+
+    ::close(fds[0]);
+    ::close(fds[1]);
+}
+
+TEST_CASE("ReaderGetBlocks__WhenNotOverridden__IteratesTheBlocks") {
+    fake_reader r{1};
+    r.num_blocks = 3;
+    std::error_code ec;
+    {
+        sample s{r, ec};
+        REQUIRE(!ec);
+
+        block_metadata blocks[4]{};
+        REQUIRE(s.get_blocks(blocks, 4) == 3);
+        REQUIRE(blocks[2].type == block_type::core);
+        REQUIRE(blocks[2].index == 2);
+
+        // the blocks that don't fit are left out
+        REQUIRE(s.get_blocks(blocks, 2) == 2);
+    }
+    REQUIRE(!ec);
+}
+
+TEST_CASE("CoalescingCollector__WhenCollecting__WakesUpOncePerInterval") {
+    using clock = std::chrono::steady_clock;
+    constexpr uint64_t interval_ns = 20000000;
+
+    fake_reader r{5};
+    const auto begin = clock::now();
+    sampler::coalescing_collector collector{r, interval_ns};
+    REQUIRE(collector.get_wakeup_interval() == interval_ns);
+
+    std::vector<uint64_t> sample_nrs{};
+    size_t count{};
+    REQUIRE(!collector.collect(32, count, collect, &sample_nrs));
+
+    const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - begin);
+    // the collector sleeps on the raw monotonic clock, which may drift a little from steady_clock
+    REQUIRE(static_cast<uint64_t>(elapsed.count()) >= interval_ns / 10 * 9);
+    REQUIRE(count == 5);
+    REQUIRE(r.num_waits == 1);
+}
+
+TEST_CASE("CoalescingCollector__WhenIntervalIsZero__DoesNotSleep") {
+    fake_reader r{2};
+    sampler::coalescing_collector collector{r, 0};
+
+    std::vector<uint64_t> sample_nrs{};
+    size_t count{};
+    REQUIRE(!collector.collect(32, count, collect, &sample_nrs));
+    REQUIRE(count == 2);
+}
+
+TEST_CASE("EventLoop__WhenSourcesAreReady__DispatchesThem") {
+    fake_pipe p0;
+    fake_pipe p1;
+    fake_pipe app;
+    fake_reader r0{3, p0.fds[0]};
+    fake_reader r1{2, p1.fds[0]};
+
+    sampler::event_loop loop;
+    REQUIRE(loop);
+
+    std::vector<uint64_t> samples0{};
+    std::vector<uint64_t> samples1{};
+    unsigned num_app_events{};
+    REQUIRE(!loop.add_reader(r0, collect, &samples0, 32));
+    REQUIRE(!loop.add_reader(r1, collect, &samples1));
+    REQUIRE(!loop.add_fd(app.fds[0], consume, &num_app_events));
+    REQUIRE(loop.add_fd(-1, consume, &num_app_events) == std::errc::bad_file_descriptor);
+
+    size_t count{};
+    REQUIRE(!loop.run_once(0, count));
+    REQUIRE(count == 0);
+
+    p0.signal();
+    app.signal();
+    REQUIRE(!loop.run_once(sampler::event_loop::wait_forever, count));
+    REQUIRE(count == 2);
+    REQUIRE(samples0 == std::vector<uint64_t>{0, 1, 2});
+    REQUIRE(samples1.empty());
+    REQUIRE(num_app_events == 1);
+
+    // r0 has no sample left, the kernel would not signal it anymore
+    unsigned num_drained{};
+    consume(&num_drained, p0.fds[0]);
+
+    // one sample per wake-up
+    p1.signal();
+    REQUIRE(!loop.run_once(1000000, count));
+    REQUIRE(!loop.run_once(1000000, count));
+    REQUIRE(samples1 == std::vector<uint64_t>{0, 1});
+
+    // the pipe of r1 is still readable, but it has no sample left
+    REQUIRE(loop.run_once(1000000, count) == std::errc::resource_unavailable_try_again);
+    REQUIRE(count == 1);
+}
+
+TEST_CASE("EventLoop__WhenSourceIsRemoved__DoesNotDispatchIt") {
+    fake_pipe p0;
+    fake_pipe app;
+    fake_reader r0{1, p0.fds[0]};
+
+    sampler::event_loop loop;
+    std::vector<uint64_t> samples0{};
+    unsigned num_app_events{};
+    REQUIRE(!loop.add_reader(r0, collect, &samples0));
+    REQUIRE(!loop.add_fd(app.fds[0], consume, &num_app_events));
+
+    REQUIRE(!loop.remove(r0.get_fd()));
+    REQUIRE(loop.remove(r0.get_fd()) == std::errc::invalid_argument);
+
+    p0.signal();
+    app.signal();
+    size_t count{};
+    REQUIRE(!loop.run_once(1000000, count));
+    REQUIRE(count == 1);
+    REQUIRE(samples0.empty());
+    REQUIRE(num_app_events == 1);
+
+    // the slot of the removed reader is reused
+    REQUIRE(!loop.add_reader(r0, collect, &samples0));
+    REQUIRE(!loop.run_once(1000000, count));
+    REQUIRE(count == 1);
+    REQUIRE(samples0 == std::vector<uint64_t>{0});
+}
+
+} // namespace hwcnt
+} // namespace device
+} // namespace hwcpipe
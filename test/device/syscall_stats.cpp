@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <catch2/catch.hpp>
+
+#include <device/detail/is_empty_class.hpp>
+#include <device/syscall/iface.hpp>
+#include <device/syscall/instrumenting_iface.hpp>
+#include <device/syscall_stats.hpp>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <system_error>
+#include <utility>
+
+#include <poll.h>
+#include <sys/mman.h>
+
+namespace hwcpipe {
+namespace device {
+namespace syscall {
+
+namespace {
+
+constexpr int device_fd = 10;
+constexpr unsigned long failing_command = 0xdead;
+
+/** Syscall interface that counts the calls, and fails the failing_command ioctls. */
+class counting_iface {
+  public:
+    counting_iface() = default;
+    explicit counting_iface(unsigned &num_calls)
+        : num_calls_(&num_calls) {}
+
+    std::pair<std::error_code, int> open(const char *, int) { return {count(), device_fd}; }
+    std::pair<std::error_code, bool> is_char_device(int) { return {count(), true}; }
+    std::error_code close(int) { return count(); }
+
+    std::pair<std::error_code, void *> mmap(void *, size_t, int, int, int, off_t) {
+        return {std::make_error_code(std::errc::no_such_device), MAP_FAILED};
+    }
+    std::error_code munmap(void *, size_t) { return count(); }
+
+    std::pair<std::error_code, int> ioctl(int, unsigned long command, int) {
+        if (command == failing_command)
+            return {std::make_error_code(std::errc::invalid_argument), -1};
+        return {count(), 0};
+    }
+
+    std::pair<std::error_code, int> poll(struct pollfd *, nfds_t, int) { return {count(), 1}; }
+
+  private:
+    std::error_code count() {
+        if (num_calls_ != nullptr)
+            ++*num_calls_;
+        return {};
+    }
+
+    unsigned *num_calls_{};
+};
+
+const syscall_ioctl_stats *find_ioctl(const syscall_stats &stats, uint64_t command) {
+    for (size_t i = 0; i < stats.num_ioctls; ++i) {
+        if (stats.ioctls[i].command == command)
+            return &stats.ioctls[i];
+    }
+    return nullptr;
+}
+
+} // namespace
+
+TEST_CASE("device::syscall::instrumenting_iface") {
+    static_assert(device::detail::is_empty_class<instrumenting_iface<direct_iface>>::value,
+                  "instrumenting_iface must be empty when the wrapped interface is.");
+
+    auto &collector = stats_collector::global();
+    collector.reset();
+
+    unsigned num_calls{};
+    const instrumenting_iface<counting_iface> iface{counting_iface{num_calls}};
+
+    SECTION("forwarded calls") {
+        int fd{};
+        std::error_code ec;
+        std::tie(ec, fd) = iface.open("/dev/mali0", 0);
+        CHECK(!ec);
+        CHECK(fd == device_fd);
+        CHECK(!iface.is_char_device(fd).first);
+        CHECK(!iface.close(fd));
+        CHECK(num_calls == 3);
+
+        // open, is_char_device and close are not counted
+        const auto stats = collector.read();
+        CHECK(stats.num_ioctls == 0);
+        CHECK(stats.poll.count == 0);
+        CHECK(stats.mmap.count == 0);
+        CHECK(stats.munmap.count == 0);
+    }
+
+    SECTION("ioctl per command") {
+        CHECK(!iface.ioctl(device_fd, 1UL, 0).first);
+        CHECK(!iface.ioctl(device_fd, 2UL, 0).first);
+        CHECK(!iface.ioctl(device_fd, 1UL, 0).first);
+        CHECK(iface.ioctl(device_fd, failing_command, 0).first);
+
+        const auto stats = collector.read();
+        REQUIRE(stats.num_ioctls == 3);
+
+        // commands are listed in the order they were first called
+        CHECK(stats.ioctls[0].command == 1);
+        CHECK(stats.ioctls[1].command == 2);
+        CHECK(stats.ioctls[2].command == failing_command);
+
+        CHECK(find_ioctl(stats, 1)->stats.count == 2);
+        CHECK(find_ioctl(stats, 1)->stats.errors == 0);
+        CHECK(find_ioctl(stats, 2)->stats.count == 1);
+        CHECK(find_ioctl(stats, failing_command)->stats.count == 1);
+        CHECK(find_ioctl(stats, failing_command)->stats.errors == 1);
+
+        const auto &ioctl_1 = find_ioctl(stats, 1)->stats;
+        CHECK(ioctl_1.max_ns <= ioctl_1.total_ns);
+        CHECK(stats.other_ioctls.count == 0);
+    }
+
+    SECTION("too many ioctl commands") {
+        for (uint64_t command = 1; command <= max_syscall_ioctl_commands + 2; ++command)
+            CHECK(!iface.ioctl(device_fd, static_cast<unsigned long>(command), 0).first);
+
+        const auto stats = collector.read();
+        CHECK(stats.num_ioctls == max_syscall_ioctl_commands);
+        CHECK(stats.other_ioctls.count == 2);
+    }
+
+    SECTION("poll, mmap and munmap") {
+        struct pollfd fds {};
+        CHECK(iface.poll(&fds, 1, 0).second == 1);
+        CHECK(iface.poll(&fds, 1, 0).second == 1);
+        CHECK(iface.mmap(nullptr, 4096, PROT_READ, MAP_PRIVATE, device_fd, 0).first);
+        CHECK(!iface.munmap(nullptr, 4096));
+
+        const auto stats = collector.read();
+        CHECK(stats.poll.count == 2);
+        CHECK(stats.poll.errors == 0);
+        CHECK(stats.mmap.count == 1);
+        CHECK(stats.mmap.errors == 1);
+        CHECK(stats.munmap.count == 1);
+        CHECK(stats.num_ioctls == 0);
+    }
+
+    SECTION("reset") {
+        CHECK(!iface.ioctl(device_fd, 1UL, 0).first);
+        collector.reset();
+
+        const auto stats = collector.read();
+        CHECK(stats.num_ioctls == 0);
+        CHECK(stats.other_ioctls.count == 0);
+    }
+
+    collector.reset();
+}
+
+TEST_CASE("device::get_syscall_stats") {
+    reset_syscall_stats();
+
+    const auto stats = get_syscall_stats();
+#if defined(HWCPIPE_SYSCALL_STATS)
+    CHECK(stats.enabled);
+#else
+    CHECK(!stats.enabled);
+#endif
+    CHECK(stats.num_ioctls == 0);
+    CHECK(stats.poll.count == 0);
+}
+
+} // namespace syscall
+} // namespace device
+} // namespace hwcpipe
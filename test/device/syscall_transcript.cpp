@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <catch2/catch.hpp>
+
+#include <device/ioctl/kbase/commands.hpp>
+#include <device/ioctl/kbase/types.hpp>
+#include <device/ioctl/kinstr_prfcnt/commands.hpp>
+#include <device/ioctl/kinstr_prfcnt/types.hpp>
+#include <device/ioctl/vinstr/commands.hpp>
+#include <device/syscall/record.hpp>
+#include <device/syscall/replay.hpp>
+#include <device/syscall/transcript.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <system_error>
+#include <tuple>
+#include <vector>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace hwcpipe {
+namespace device {
+namespace syscall {
+
+namespace {
+namespace kbase = ioctl::kbase;
+namespace kinstr_prfcnt = ioctl::kinstr_prfcnt;
+
+constexpr int device_fd = 10;
+constexpr size_t buffer_size = 1024;
+constexpr size_t sample_size = 256;
+constexpr size_t num_props = 16;
+
+/** A fake kernel, which writes each sample to a ring of four buffers. */
+struct fake_kernel {
+    std::vector<uint64_t> memory = std::vector<uint64_t>(buffer_size / sizeof(uint64_t));
+    uint64_t sequence{};
+    uint64_t num_requests{};
+};
+
+/** Syscall interface of a fake_kernel. */
+class fake_kernel_iface {
+  public:
+    fake_kernel_iface() = default;
+    explicit fake_kernel_iface(fake_kernel &kernel)
+        : kernel_(&kernel) {}
+
+    std::pair<std::error_code, int> open(const char *, int) { return {std::error_code{}, device_fd}; }
+    std::pair<std::error_code, bool> is_char_device(int) { return {std::error_code{}, true}; }
+    std::error_code close(int) { return {}; }
+
+    std::pair<std::error_code, void *> mmap(void *, size_t len, int, int, int, off_t) {
+        if (len != buffer_size)
+            return {std::make_error_code(std::errc::invalid_argument), MAP_FAILED};
+        return {std::error_code{}, kernel_->memory.data()};
+    }
+    std::error_code munmap(void *, size_t) { return {}; }
+
+    std::pair<std::error_code, int> ioctl(int, kbase::command::command_type, kbase::get_gpuprops *props) {
+        if (!props->buffer)
+            return {std::error_code{}, static_cast<int>(num_props)};
+        for (uint32_t i = 0; i != props->size; ++i)
+            props->buffer.get()[i] = static_cast<uint8_t>(i * 3);
+        return {std::error_code{}, 0};
+    }
+
+    std::pair<std::error_code, int> ioctl(int, kinstr_prfcnt::command::command_type command,
+                                          kinstr_prfcnt::sample_access *access) {
+        if (command == kinstr_prfcnt::command::put_sample)
+            return {std::error_code{}, 0};
+        if (kernel_->num_requests++ == 3)
+            return {std::make_error_code(std::errc::resource_unavailable_try_again), -1};
+
+        access->sequence = kernel_->sequence++;
+        auto *sample = reinterpret_cast<uint32_t *>(reinterpret_cast<uint8_t *>(kernel_->memory.data()) +
+                                                    (access->sequence % 4) * sample_size);
+        for (size_t i = 0; i != sample_size / sizeof(uint32_t); ++i)
+            sample[i] = static_cast<uint32_t>(access->sequence * 1000 + i);
+        return {std::error_code{}, 0};
+    }
+
+    std::pair<std::error_code, int> ioctl(int, ioctl::vinstr::command::command_type, int) {
+        return {std::error_code{}, 0};
+    }
+
+    std::pair<std::error_code, int> poll(struct pollfd *fds, nfds_t, int) {
+        fds[0].revents = POLLIN;
+        return {std::error_code{}, 1};
+    }
+
+  private:
+    fake_kernel *kernel_{};
+};
+
+/** What a session observed. */
+struct observation {
+    std::vector<std::error_code> errors;
+    std::vector<uint8_t> props;
+    std::vector<uint64_t> sums;
+
+    bool operator==(const observation &other) const {
+        return errors == other.errors && props == other.props && sums == other.sums;
+    }
+};
+
+/** A sampling session, in the way the backends drive the kernel. */
+template <typename syscall_iface_t>
+observation run_session(syscall_iface_t iface, size_t num_samples) {
+    observation result{};
+    std::error_code ec;
+    int fd{};
+    bool is_char{};
+
+    std::tie(ec, fd) = iface.open("/dev/mali0", O_RDONLY);
+    result.errors.push_back(ec);
+    std::tie(ec, is_char) = iface.is_char_device(fd);
+    result.errors.push_back(ec);
+
+    kbase::get_gpuprops props{};
+    int size{};
+    std::tie(ec, size) = iface.ioctl(fd, kbase::command::get_gpuprops, &props);
+    result.errors.push_back(ec);
+    result.props.resize(static_cast<size_t>(size));
+    props.buffer = result.props.data();
+    props.size = static_cast<uint32_t>(size);
+    std::tie(ec, std::ignore) = iface.ioctl(fd, kbase::command::get_gpuprops, &props);
+    result.errors.push_back(ec);
+
+    void *memory{};
+    std::tie(ec, memory) = iface.mmap(nullptr, buffer_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    result.errors.push_back(ec);
+
+    for (size_t i = 0; i != num_samples; ++i) {
+        pollfd fds{};
+        fds.fd = fd;
+        fds.events = POLLIN;
+        std::tie(ec, std::ignore) = iface.poll(&fds, 1, -1);
+        result.errors.push_back(ec);
+
+        std::tie(ec, std::ignore) = iface.ioctl(fd, ioctl::vinstr::command::dump, 0);
+        result.errors.push_back(ec);
+
+        kinstr_prfcnt::sample_access access{};
+        std::tie(ec, std::ignore) = iface.ioctl(fd, kinstr_prfcnt::command::get_sample, &access);
+        result.errors.push_back(ec);
+        if (ec)
+            continue;
+
+        const auto *sample = reinterpret_cast<const uint32_t *>(static_cast<const uint8_t *>(memory) +
+                                                                (access.sequence % 4) * sample_size);
+        uint64_t sum = 0;
+        for (size_t j = 0; j != sample_size / sizeof(uint32_t); ++j)
+            sum += sample[j];
+        result.sums.push_back(sum);
+
+        std::tie(ec, std::ignore) = iface.ioctl(fd, kinstr_prfcnt::command::put_sample, &access);
+        result.errors.push_back(ec);
+    }
+
+    result.errors.push_back(iface.munmap(memory, buffer_size));
+    result.errors.push_back(iface.close(fd));
+    return result;
+}
+} // namespace
+
+TEST_CASE("syscall_transcript__RecordAndReplay") {
+    static constexpr size_t num_samples = 5;
+
+    fake_kernel kernel{};
+    transcript recorded{};
+    recorder rec{recorded};
+    const auto expected = run_session(recording_iface<fake_kernel_iface>{rec, fake_kernel_iface{kernel}}, num_samples);
+
+    // the kernel failed the fourth sample
+    REQUIRE(expected.sums.size() == num_samples - 1);
+    REQUIRE(expected.props.size() == num_props);
+    REQUIRE(expected.props[5] == 15);
+
+    // only the sample buffers that were written are recorded
+    size_t patched = 0;
+    for (const auto &event : recorded.events) {
+        for (const auto &patch : event.patches)
+            patched += patch.data.size();
+    }
+    REQUIRE(patched == (num_samples - 1) * sample_size);
+
+    SECTION("Replay") {
+        player play{recorded};
+        REQUIRE(run_session(replaying_iface{play}, num_samples) == expected);
+        REQUIRE(play.at_end());
+        REQUIRE(!play.diverged());
+    }
+
+    SECTION("Replay a saved transcript") {
+        const std::string path = "/tmp/hwcpipe-" + std::to_string(::getpid()) + "-session.hwcs";
+        REQUIRE(!recorded.save(path));
+
+        std::error_code ec;
+        transcript loaded{};
+        std::tie(ec, loaded) = transcript::load(path);
+        std::remove(path.c_str());
+        REQUIRE(!ec);
+        REQUIRE(loaded.events.size() == recorded.events.size());
+
+        player play{loaded};
+        REQUIRE(run_session(replaying_iface{play}, num_samples) == expected);
+    }
+
+    SECTION("Divergence") {
+        player play{recorded};
+        const auto observed = run_session(replaying_iface{play}, num_samples + 1);
+        REQUIRE(play.diverged());
+        REQUIRE(observed.errors.back() == std::make_error_code(std::errc::protocol_error));
+    }
+
+    SECTION("Malformed file") {
+        const std::string path = "/tmp/hwcpipe-" + std::to_string(::getpid()) + "-truncated.hwcs";
+        REQUIRE(!recorded.save(path));
+        REQUIRE(::truncate(path.c_str(), 40) == 0);
+
+        const auto loaded = transcript::load(path);
+        std::remove(path.c_str());
+        REQUIRE(loaded.first == std::make_error_code(std::errc::invalid_argument));
+    }
+}
+
+} // namespace syscall
+} // namespace device
+} // namespace hwcpipe
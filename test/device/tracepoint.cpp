@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <catch2/catch.hpp>
+
+#include <device/detail/is_empty_class.hpp>
+#include <device/hwcnt/sample.hpp>
+#include <device/tracepoint.hpp>
+
+#include <cstdint>
+
+namespace hwcpipe {
+namespace device {
+
+#if !defined(HWCPIPE_TRACEPOINTS)
+static_assert(detail::is_empty_class<tracepoint_timer>::value, "tracepoint_timer must be empty without tracepoints.");
+static_assert(detail::is_empty_class<tracepoint_sample>::value, "tracepoint_sample must be empty without tracepoints.");
+#endif
+
+TEST_CASE("device::tracepoint") {
+    hwcnt::sample_metadata sm{};
+    sm.sample_nr = 42;
+    sm.user_data = 7;
+
+    tracepoint_sample last_sample{};
+    last_sample.assign(sm);
+
+    const tracepoint_timer timer{};
+    uint64_t num_evaluations = 0;
+    const auto evaluate = [&num_evaluations]() { return ++num_evaluations; };
+    HWCPIPE_TRACEPOINT(test, last_sample.sample_nr(), last_sample.user_data(), evaluate());
+
+    if (tracepoints_enabled) {
+        CHECK(last_sample.sample_nr() == 42);
+        CHECK(last_sample.user_data() == 7);
+        CHECK(num_evaluations == 1);
+    } else {
+        CHECK(last_sample.sample_nr() == 0);
+        CHECK(timer.elapsed_ns() == 0);
+        CHECK(num_evaluations == 0);
+    }
+}
+
+} // namespace device
+} // namespace hwcpipe
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hwcpipe/hwcpipe_counter.h"
+
+#include <catch2/catch.hpp>
+
+#include <frame_session.hpp>
+#include <hwcpipe/gpu_simulator.hpp>
+#include <hwcpipe/sampler.hpp>
+#include <hwcpipe/trace_recorder.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+namespace hwcpipe {
+
+namespace {
+
+using simulated_session = interposer::frame_session<gpu_simulator_policy>;
+
+std::vector<char> read_file(const std::string &path) {
+    std::ifstream file(path, std::ios::binary);
+    return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+}
+
+/** Waits for the collector to take @p num_samples samples. */
+bool wait_for_samples(const simulated_session &session, uint64_t num_samples) {
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (session.get_stats().samples < num_samples) {
+        if (std::chrono::steady_clock::now() >= deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+}
+
+} // namespace
+
+TEST_CASE("FrameSession___OnSwap___RecordsTheTaggedFrames") {
+    gpu_simulator simulator(gpu_simulator_config{}, 11);
+    REQUIRE(simulator);
+
+    device::product_id pid{};
+    REQUIRE(!simulator.get_product_id(pid));
+    sampler_config config(pid, simulator.get_device_number());
+    REQUIRE(!config.add_counter(MaliGPUActiveCy));
+    REQUIRE(!config.add_counter(MaliFragActiveCy));
+
+    const std::string path = "/tmp/hwcpipe-" + std::to_string(::getpid()) + "-frame-session.hwct";
+    const std::string tags_path = path + ".tags";
+    {
+        simulated_session session(config, {MaliGPUActiveCy, MaliFragActiveCy});
+        REQUIRE(session.start(path.c_str(), nullptr));
+
+        for (uint64_t frame = 0; frame != 3; ++frame) {
+            session.on_swap();
+            REQUIRE(wait_for_samples(session, frame + 1));
+        }
+        session.stop();
+
+        // the swaps after the stop are dropped
+        session.on_swap();
+        CHECK(session.get_stats().presents == 3);
+    }
+
+    std::ifstream tags(tags_path);
+    std::vector<uint32_t> frames{};
+    unsigned long long timestamp{};
+    unsigned long long last_timestamp{};
+    uint32_t frame{};
+    while (tags >> timestamp >> frame) {
+        CHECK(timestamp > last_timestamp);
+        last_timestamp = timestamp;
+        frames.push_back(frame);
+    }
+    CHECK(frames == std::vector<uint32_t>{0, 1, 2});
+
+    const auto contents = read_file(path);
+    const trace_reader reader(contents.data(), contents.size());
+    REQUIRE(reader);
+    CHECK(reader.num_records() == 3);
+
+    std::remove(path.c_str());
+    std::remove(tags_path.c_str());
+}
+
+} // namespace hwcpipe
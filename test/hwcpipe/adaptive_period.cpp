@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hwcpipe/adaptive_period.hpp"
+#include "hwcpipe/error.hpp"
+#include "hwcpipe/sampler.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <system_error>
+
+namespace hwcpipe {
+
+namespace {
+
+constexpr uint64_t min_period_ns = 1000000;
+constexpr uint64_t max_period_ns = 16000000;
+
+/** Sampler stand-in for adaptive_period::update(sampler, list). */
+struct sampler_stub {
+    std::error_code get_counter_values(int list, double *values, size_t count) const {
+        if (list < 0 || count < 1) {
+            return make_error_code(errc::invalid_read_list);
+        }
+        values[0] = value;
+        return {};
+    }
+    sample_interval get_sample_interval() const { return {1000, 1000 + duration_ns, 0, 0}; }
+
+    double value{};
+    uint64_t duration_ns{};
+};
+
+} // namespace
+
+TEST_CASE("AdaptivePeriod___Update___SamplesFastDuringBursts") {
+    adaptive_period controller({min_period_ns, max_period_ns}, 1);
+    REQUIRE(controller.get_period() == min_period_ns);
+
+    // samples a counter that counts @p rate events per millisecond over the current period
+    const auto update = [&controller](double rate) {
+        const auto period = controller.get_period();
+        const double value = rate * static_cast<double>(period) / 1e6;
+        return controller.update(period, 0, &value);
+    };
+
+    // idle
+    for (uint64_t expected : {2000000, 4000000, 8000000, 16000000, 16000000}) {
+        REQUIRE(update(0) == expected);
+        REQUIRE(!controller.in_burst());
+    }
+
+    // a burst samples at the shortest period, until the moving average
+    // catches up with the new rate
+    REQUIRE(update(1000) == min_period_ns);
+    REQUIRE(controller.in_burst());
+    REQUIRE(update(1000) == min_period_ns);
+    REQUIRE(update(1000) == min_period_ns);
+
+    // steady rates, whatever the period, slow the sampling down again
+    for (uint64_t expected : {2000000, 4000000, 8000000, 16000000}) {
+        REQUIRE(update(1000) == expected);
+        REQUIRE(!controller.in_burst());
+    }
+
+    // going idle changes the rates, but doesn't speed the sampling up
+    REQUIRE(update(0) == max_period_ns);
+    REQUIRE(controller.in_burst());
+
+    // the GPU cycles are tracked as well
+    const double value = 0;
+    REQUIRE(controller.update(max_period_ns, 1000000, &value) == min_period_ns);
+
+    // empty samples are ignored
+    REQUIRE(controller.update(0, 0, &value) == min_period_ns);
+}
+
+TEST_CASE("AdaptivePeriod___UpdateSampler___ReadsTheSampleInterval") {
+    adaptive_period controller({min_period_ns, max_period_ns}, 1);
+    sampler_stub sampler{};
+    sampler.duration_ns = min_period_ns;
+
+    REQUIRE(!controller.update(sampler, 0));
+    REQUIRE(controller.get_period() == 2000000);
+
+    sampler.value = 100;
+    REQUIRE(!controller.update(sampler, 0));
+    REQUIRE(controller.get_period() == min_period_ns);
+
+    REQUIRE(controller.update(sampler, -1) == make_error_code(errc::invalid_read_list));
+}
+
+} // namespace hwcpipe
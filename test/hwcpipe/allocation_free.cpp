@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "device/constants.hpp"
+#include "hwcpipe/hwcpipe_counter.h"
+#include "mock/backend_manual_sampler.hpp"
+#include "mock/backend_periodic_sampler.hpp"
+#include "mock/backend_sample.hpp"
+#include "mock/handle.hpp"
+#include "mock/instance.hpp"
+#include "mock/mock_helper.h"
+
+#include <catch2/catch.hpp>
+
+#include <hwcpipe/sampler.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <system_error>
+
+namespace {
+// debug allocation trap: counts the allocations made while it is armed
+std::atomic<bool> trap_armed{false};
+std::atomic<size_t> trapped_allocations{0};
+
+void *allocate(size_t size) {
+    if (trap_armed.load(std::memory_order_relaxed)) {
+        trapped_allocations.fetch_add(1, std::memory_order_relaxed);
+    }
+    void *ptr = std::malloc(size == 0 ? 1 : size);
+    if (ptr == nullptr) {
+        std::abort();
+    }
+    return ptr;
+}
+} // namespace
+
+void *operator new(size_t size) { return allocate(size); }
+void *operator new[](size_t size) { return allocate(size); }
+void *operator new(size_t size, const std::nothrow_t &) noexcept { return allocate(size); }
+void *operator new[](size_t size, const std::nothrow_t &) noexcept { return allocate(size); }
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+void operator delete[](void *ptr) noexcept { std::free(ptr); }
+void operator delete(void *ptr, size_t) noexcept { std::free(ptr); }
+void operator delete[](void *ptr, size_t) noexcept { std::free(ptr); }
+
+namespace hwcpipe {
+
+namespace {
+using namespace hwcpipe::mock;
+
+/** Arms the allocation trap for the lifetime of the object. */
+class allocation_trap {
+  public:
+    allocation_trap() {
+        trapped_allocations = 0;
+        trap_armed = true;
+    }
+    ~allocation_trap() { trap_armed = false; }
+
+    size_t disarm() {
+        trap_armed = false;
+        return trapped_allocations;
+    }
+};
+
+/**
+ * Sample that hands out the blocks from a fixed array. The shared mock returns
+ * them in a std::vector, which would allocate on every sample.
+ */
+class fixed_sample_mock {
+  public:
+    struct block_range {
+        const block_metadata *begin() const { return fixed_blocks.data(); }
+        const block_metadata *end() const { return fixed_blocks.data() + fixed_blocks.size(); }
+    };
+
+    fixed_sample_mock(reader_mock &reader, std::error_code &ec) {
+        if (!reader.is_valid()) {
+            ec = std::make_error_code(std::errc::invalid_argument);
+        }
+    }
+
+    sample_metadata get_metadata() const { return {}; }
+    block_range blocks() const { return {}; }
+
+    static std::array<block_metadata, 3> fixed_blocks;
+};
+
+std::array<uint32_t, 8> values_fe{};
+std::array<uint32_t, 8> values_tiler{};
+std::array<uint32_t, 64> values_core{};
+std::array<block_metadata, 3> fixed_sample_mock::fixed_blocks{{
+    {device::hwcnt::block_type::fe, values_fe.data()},
+    {device::hwcnt::block_type::tiler, values_tiler.data()},
+    {device::hwcnt::block_type::core, values_core.data()},
+}};
+
+struct allocation_free_mock_policy {
+    using handle_type = hwcpipe::mock::handle_mock;
+    using instance_type = hwcpipe::mock::instance_mock;
+    using sampler_type = hwcpipe::mock::backend_manual_sampler_mock;
+    using periodic_sampler_type = hwcpipe::mock::backend_periodic_sampler_mock;
+    using sample_type = fixed_sample_mock;
+};
+
+using sampler_t = hwcpipe::sampler<allocation_free_mock_policy>;
+} // namespace
+
+TEST_CASE("SamplerSteadyState__AfterStartSampling__DoesNotAllocate") {
+    values_fe[6] = 2;    // MaliGPUActiveCy
+    values_tiler[4] = 4; // MaliTilerActiveCy
+
+    sampler_config config(device::product_id::g31, 0);
+    config.set_expression_evaluation(
+        GENERATE(sampler_config::expression_evaluation::lazy, sampler_config::expression_evaluation::eager));
+    config.set_per_instance_values(GENERATE(false, true));
+
+    REQUIRE(!config.add_counter(hwcpipe_counter::MaliTilerUtil));
+    REQUIRE(!config.add_counter(hwcpipe_counter::MaliFragActiveCy));
+    size_t custom{};
+    REQUIRE(!config.add_custom_counter("max(MaliTilerActiveCy - MaliGPUActiveCy, 0) / MaliTilerUtil", custom));
+
+    sampler_t test_sampler(config);
+    REQUIRE(test_sampler);
+
+    const hwcpipe_counter counters[] = {MaliTilerUtil, MaliGPUActiveCy, MaliFragActiveCy};
+    std::error_code ec;
+    const auto list = test_sampler.make_read_list(counters, 3, ec);
+    REQUIRE(!ec);
+
+    REQUIRE(!test_sampler.start_sampling());
+
+    size_t allocations{};
+    bool ok = true;
+    {
+        allocation_trap trap{};
+        for (int i = 0; i != 16; ++i) {
+            ok = ok && !test_sampler.sample_now();
+            ok = ok && !test_sampler.request_sample_async() && !test_sampler.try_collect();
+
+            counter_sample sample{};
+            ok = ok && !test_sampler.get_counter_value(MaliTilerUtil, sample);
+            ok = ok && !test_sampler.get_counter_value(MaliGPUActiveCy, sample);
+
+            double values[3]{};
+            ok = ok && !test_sampler.get_counter_values(list, values, 3);
+
+            double value{};
+            ok = ok && !test_sampler.get_custom_counter_value(custom, value);
+
+            for (const auto &record : test_sampler.sample_view()) {
+                ok = ok && record.timestamp == 0;
+            }
+        }
+        allocations = trap.disarm();
+    }
+
+    REQUIRE(ok);
+    REQUIRE(allocations == 0);
+    REQUIRE(!test_sampler.stop_sampling());
+}
+
+} // namespace hwcpipe
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hwcpipe/arrow_exporter.hpp"
+#include "hwcpipe/counter_database.hpp"
+#include "hwcpipe/error.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <system_error>
+
+namespace hwcpipe {
+
+namespace {
+
+const hwcpipe_counter hardware[] = {MaliGPUActiveCy, MaliFragActiveCy};
+const hwcpipe_counter derived[] = {MaliGPUIRQUtil};
+
+/** Sampler stand-in for arrow_exporter::push(sampler, hardware_list, derived_list). */
+struct sampler_stub {
+    std::error_code get_counter_values(int list, uint64_t *values, size_t count) const {
+        for (size_t i = 0; i != count; ++i) {
+            values[i] = static_cast<uint64_t>(list) * 10 + i;
+        }
+        return {};
+    }
+    std::error_code get_counter_values(int list, double *values, size_t count) const {
+        if (list < 0) {
+            return make_error_code(errc::invalid_read_list);
+        }
+        for (size_t i = 0; i != count; ++i) {
+            values[i] = 0.5 + static_cast<double>(i);
+        }
+        return {};
+    }
+    sample_interval get_sample_interval() const { return {100, 200, 1000, 900}; }
+    uint64_t get_sample_user_data() const { return 42; }
+};
+
+/** @return The value of a row of a uint64 column of a batch. */
+uint64_t uint_value(const ArrowArray &batch, size_t column, size_t row) {
+    return static_cast<const uint64_t *>(batch.children[column]->buffers[1])[row];
+}
+
+/** Pushes @p remaining samples, two at a time. */
+std::error_code push_samples(void *user_data, arrow_exporter &exporter, bool &end) {
+    auto &remaining = *static_cast<int *>(user_data);
+    if (remaining < 0) {
+        return make_error_code(errc::sample_collection_failure);
+    }
+    for (int i = 0; i != 2 && remaining != 0; ++i, --remaining) {
+        const uint64_t hardware_values[] = {static_cast<uint64_t>(remaining), 0};
+        const double derived_values[] = {0.0};
+        exporter.push({0, 1, 0, 0}, 0, hardware_values, derived_values);
+    }
+    end = remaining == 0;
+    return {};
+}
+
+} // namespace
+
+TEST_CASE("ArrowExporter___ExportSchema___NamesTheColumns") {
+    arrow_exporter exporter(hardware, 2, derived, 1, 16);
+    REQUIRE(exporter.num_columns() == 8);
+
+    ArrowSchema schema{};
+    REQUIRE(!exporter.export_schema(&schema));
+    CHECK(std::string(schema.format) == "+s");
+    REQUIRE(schema.n_children == 8);
+
+    CHECK(std::string(schema.children[0]->name) == "timestamp_ns_begin");
+    CHECK(std::string(schema.children[4]->name) == "user_data");
+    counter_database database{};
+    counter_metadata metadata{};
+    REQUIRE(!database.describe_counter(MaliGPUActiveCy, metadata));
+    CHECK(std::string(schema.children[5]->name) == metadata.name);
+    CHECK(std::string(schema.children[5]->format) == "L");
+    REQUIRE(!database.describe_counter(MaliGPUIRQUtil, metadata));
+    CHECK(std::string(schema.children[7]->name) == metadata.name);
+    CHECK(std::string(schema.children[7]->format) == "g");
+
+    schema.release(&schema);
+    CHECK(schema.release == nullptr);
+}
+
+TEST_CASE("ArrowExporter___ExportBatch___MovesTheColumns") {
+    arrow_exporter exporter(hardware, 2, derived, 1, 2);
+    sampler_stub sampler;
+    REQUIRE(!exporter.push(sampler, 1, 0));
+    REQUIRE(!exporter.push(sampler, 2, 0));
+    CHECK(exporter.push(sampler, 0, -1) == make_error_code(errc::invalid_read_list));
+    REQUIRE(exporter.full());
+
+    ArrowArray batch{};
+    exporter.export_batch(&batch);
+    CHECK(exporter.rows() == 0);
+    REQUIRE(batch.length == 2);
+    REQUIRE(batch.n_children == 8);
+    CHECK(batch.buffers[0] == nullptr);
+
+    CHECK(uint_value(batch, 0, 1) == 100);
+    CHECK(uint_value(batch, 1, 1) == 200);
+    CHECK(uint_value(batch, 2, 1) == 1000);
+    CHECK(uint_value(batch, 3, 1) == 900);
+    CHECK(uint_value(batch, 4, 1) == 42);
+    CHECK(uint_value(batch, 5, 0) == 10);
+    CHECK(uint_value(batch, 6, 1) == 21);
+    CHECK(static_cast<const double *>(batch.children[7]->buffers[1])[1] == 0.5);
+
+    // a column moved out of the batch outlives it
+    ArrowArray column = *batch.children[5];
+    batch.children[5]->release = nullptr;
+    batch.release(&batch);
+    CHECK(batch.release == nullptr);
+    CHECK(static_cast<const uint64_t *>(column.buffers[1])[1] == 20);
+    column.release(&column);
+}
+
+TEST_CASE("ArrowExporter___ExportStream___BuildsBatchesOnDemand") {
+    arrow_exporter exporter(hardware, 2, derived, 1, 4);
+    int remaining = 5;
+    ArrowArrayStream stream{};
+    exporter.export_stream(&push_samples, &remaining, &stream);
+
+    ArrowSchema schema{};
+    REQUIRE(stream.get_schema(&stream, &schema) == 0);
+    CHECK(schema.n_children == 8);
+    schema.release(&schema);
+
+    ArrowArray batch{};
+    REQUIRE(stream.get_next(&stream, &batch) == 0);
+    CHECK(batch.length == 4);
+    CHECK(uint_value(batch, 5, 0) == 5);
+    batch.release(&batch);
+
+    REQUIRE(stream.get_next(&stream, &batch) == 0);
+    CHECK(batch.length == 1);
+    CHECK(uint_value(batch, 5, 0) == 1);
+    batch.release(&batch);
+
+    REQUIRE(stream.get_next(&stream, &batch) == 0);
+    CHECK(batch.release == nullptr);
+    CHECK(stream.get_last_error(&stream) == nullptr);
+
+    stream.release(&stream);
+    CHECK(stream.release == nullptr);
+}
+
+TEST_CASE("ArrowExporter___ExportStream___ReportsSourceErrors") {
+    arrow_exporter exporter(hardware, 2, derived, 1, 4);
+    int remaining = -1;
+    ArrowArrayStream stream{};
+    exporter.export_stream(&push_samples, &remaining, &stream);
+
+    ArrowArray batch{};
+    CHECK(stream.get_next(&stream, &batch) == EIO);
+    CHECK(stream.get_last_error(&stream) != nullptr);
+    stream.release(&stream);
+}
+
+} // namespace hwcpipe
@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hwcpipe/atrace_sink.hpp"
+#include "hwcpipe/counter_database.hpp"
+#include "hwcpipe/error.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace hwcpipe {
+
+namespace {
+
+/** A connected pair of packet sockets, which keep the writes apart, closed on destruction. */
+struct packet_pair {
+    packet_pair() { REQUIRE(::socketpair(AF_UNIX, SOCK_SEQPACKET, 0, fds) == 0); }
+    ~packet_pair() {
+        for (int fd : fds) {
+            if (fd >= 0) {
+                ::close(fd);
+            }
+        }
+    }
+
+    /** Reads the next write from the receiving end. */
+    std::string receive() {
+        char buffer[4096];
+        const ssize_t received = ::read(fds[1], buffer, sizeof(buffer));
+        REQUIRE(received > 0);
+        return std::string(buffer, static_cast<size_t>(received));
+    }
+
+    int fds[2]{-1, -1};
+};
+
+std::string counter_name(hwcpipe_counter counter) {
+    counter_metadata metadata{};
+    REQUIRE(!counter_database{}.describe_counter(counter, metadata));
+    return metadata.name;
+}
+
+} // namespace
+
+TEST_CASE("atrace_sink__FormatsEvents") {
+    packet_pair pair;
+    const hwcpipe_counter counters[] = {MaliGPUActiveCy, MaliFragActiveCy};
+    const auto gpu = counter_name(MaliGPUActiveCy);
+    const auto frag = counter_name(MaliFragActiveCy);
+
+    atrace_sink_config config{};
+    config.pid = 42;
+    config.name_prefix = "GPU ";
+    atrace_sink sink(pair.fds[0], counters, 2, config);
+    REQUIRE(sink.values_per_sample() == 2);
+    REQUIRE(sink.num_columns() == 2);
+
+    SECTION("integers") {
+        const uint64_t values[] = {0, 1234567890123ULL};
+        REQUIRE(!sink.push(values));
+        REQUIRE(pair.receive() == "C|42|GPU " + gpu + "|0\nC|42|GPU " + frag + "|1234567890123\n");
+
+        const uint64_t large[] = {UINT64_MAX, 99};
+        REQUIRE(!sink.push(large));
+        REQUIRE(pair.receive() == "C|42|GPU " + gpu + "|9223372036854775807\nC|42|GPU " + frag + "|99\n");
+
+        const auto &stats = sink.get_stats();
+        REQUIRE(stats.samples == 2);
+        REQUIRE(stats.events == 4);
+        REQUIRE(stats.writes == 2);
+    }
+    SECTION("doubles") {
+        const double values[] = {-2.5, 10.4};
+        REQUIRE(!sink.push(values));
+        REQUIRE(pair.receive() == "C|42|GPU " + gpu + "|-3\nC|42|GPU " + frag + "|10\n");
+
+        const double extremes[] = {-1e300, 1e300};
+        REQUIRE(!sink.push(extremes));
+        REQUIRE(pair.receive() ==
+                "C|42|GPU " + gpu + "|-9223372036854775808\nC|42|GPU " + frag + "|9223372036854775807\n");
+    }
+}
+
+TEST_CASE("atrace_sink__Columns") {
+    packet_pair pair;
+    const hwcpipe_counter counters[] = {MaliGPUActiveCy, MaliFragActiveCy};
+    const size_t columns[] = {1, 7};
+
+    atrace_sink_config config{};
+    config.pid = 7;
+    config.columns = columns;
+    config.num_columns = 2;
+    atrace_sink sink(pair.fds[0], counters, 2, config);
+    REQUIRE(sink.num_columns() == 1);
+
+    const uint64_t values[] = {5, 6};
+    REQUIRE(!sink.push(values));
+    REQUIRE(pair.receive() == "C|7|" + counter_name(MaliFragActiveCy) + "|6\n");
+}
+
+TEST_CASE("atrace_sink__SplitsLargeSamples") {
+    packet_pair pair;
+    std::vector<hwcpipe_counter> counters(8, MaliGPUActiveCy);
+    const auto event = "C|1|" + counter_name(MaliGPUActiveCy) + "|";
+
+    atrace_sink_config config{};
+    config.pid = 1;
+    // room for three events with the longest values
+    config.max_write_size = 3 * (event.size() + 21);
+    atrace_sink sink(pair.fds[0], counters.data(), counters.size(), config);
+
+    std::vector<uint64_t> values(counters.size(), UINT64_MAX);
+    REQUIRE(!sink.push(values.data()));
+
+    size_t events = 0;
+    for (uint64_t i = 0; i != sink.get_stats().writes; ++i) {
+        const auto write = pair.receive();
+        REQUIRE(write.size() <= config.max_write_size);
+        REQUIRE(write.back() == '\n');
+        for (size_t at = 0; at != write.size(); at += event.size() + 20) {
+            REQUIRE(write.compare(at, event.size() + 20, event + "9223372036854775807\n") == 0);
+            ++events;
+        }
+    }
+    REQUIRE(sink.get_stats().writes == 3);
+    REQUIRE(events == counters.size());
+    REQUIRE(sink.get_stats().bytes == counters.size() * (event.size() + 20));
+}
+
+TEST_CASE("atrace_sink__WriteError") {
+    const hwcpipe_counter counters[] = {MaliGPUActiveCy};
+    atrace_sink sink(-1, counters, 1, atrace_sink_config{});
+    const uint64_t values[] = {1};
+    REQUIRE(sink.push(values) == make_error_code(errc::trace_marker_unavailable));
+    REQUIRE(sink.get_stats().samples == 0);
+}
+
+} // namespace hwcpipe
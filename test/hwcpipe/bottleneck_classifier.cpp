@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "device/product_id.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <hwcpipe/bottleneck_classifier.hpp>
+#include <hwcpipe/counter_preset.hpp>
+#include <hwcpipe/hwcpipe_counter.h>
+#include <hwcpipe/sampler.hpp>
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace hwcpipe {
+
+namespace {
+const hwcpipe_counter all_inputs[] = {MaliFragQueueUtil, MaliNonFragQueueUtil, MaliTilerUtil, MaliExtBusRdStallRate,
+                                      MaliCoreUtil};
+
+/** @return The values of a sample, in the order of a classifier built from all_inputs. */
+std::vector<double> sample(double fragment, double non_fragment, double tiler, double stall, double core) {
+    return {fragment, non_fragment, tiler, stall, core};
+}
+} // namespace
+
+TEST_CASE("bottleneck_classifier__Classify") {
+    bottleneck_classifier classifier(all_inputs, 5);
+    REQUIRE(classifier.num_counters() == 5);
+    REQUIRE(classifier.last() == bottleneck::unknown);
+
+    const auto classify = [&](const std::vector<double> &values) {
+        REQUIRE(classifier.push(0, 1000, values.data()));
+        return classifier.last();
+    };
+
+    CHECK(classify(sample(30, 40, 20, 50, 30)) == bottleneck::cpu);
+    CHECK(classify(sample(95, 40, 20, 15, 90)) == bottleneck::memory);
+    CHECK(classify(sample(95, 40, 20, 2, 90)) == bottleneck::fragment);
+    CHECK(classify(sample(85, 90, 20, 2, 60)) == bottleneck::vertex_tiler);
+    CHECK(classify(sample(85, 60, 92, 2, 60)) == bottleneck::vertex_tiler);
+
+    CHECK(std::string(get_bottleneck_name(bottleneck::vertex_tiler)) == "vertex_tiler");
+}
+
+TEST_CASE("bottleneck_classifier__Windows") {
+    bottleneck_classifier_config config{};
+    config.window_samples = 2;
+    bottleneck_classifier classifier(all_inputs, 5, config);
+
+    // the window mean is weighted by the sample durations: (100 * 3 + 50 * 1) / 4 = 87.5
+    auto busy = sample(100, 10, 10, 0, 90);
+    auto idle = sample(50, 10, 10, 0, 40);
+    REQUIRE_FALSE(classifier.push(0, 3000, busy.data()));
+    REQUIRE(classifier.push(3000, 4000, idle.data()));
+    REQUIRE(classifier.last() == bottleneck::fragment);
+
+    const auto &summary = classifier.get_summary(bottleneck::fragment);
+    CHECK(summary.windows == 1);
+    CHECK(summary.time_ns == 4000);
+    CHECK(summary.mean[static_cast<size_t>(bottleneck_input::fragment_queue)] == Approx(87.5));
+    CHECK(summary.mean[static_cast<size_t>(bottleneck_input::core)] == Approx(77.5));
+    CHECK(std::isnan(classifier.get_summary(bottleneck::cpu).mean[0]));
+
+    // a NaN value is left out of the mean
+    auto missing = sample(std::numeric_limits<double>::quiet_NaN(), 10, 10, 0, 40);
+    REQUIRE_FALSE(classifier.push(4000, 5000, missing.data()));
+    REQUIRE(classifier.push(5000, 6000, idle.data()));
+    REQUIRE(classifier.last() == bottleneck::cpu);
+    CHECK(classifier.get_summary(bottleneck::cpu).mean[0] == Approx(50.0));
+}
+
+TEST_CASE("bottleneck_classifier__Runs") {
+    bottleneck_classifier_config config{};
+    config.max_runs = 2;
+    bottleneck_classifier classifier(all_inputs, 5, config);
+
+    const auto fragment = sample(95, 10, 10, 0, 90);
+    const auto cpu = sample(10, 10, 10, 0, 10);
+    uint64_t time = 0;
+    const auto push = [&](const std::vector<double> &values, size_t count) {
+        for (size_t i = 0; i != count; ++i, time += 100) {
+            REQUIRE(classifier.push(time, time + 100, values.data()));
+        }
+    };
+
+    push(fragment, 3);
+    push(cpu, 2);
+    REQUIRE(classifier.num_runs() == 1);
+    push(fragment, 1);
+
+    bottleneck_run runs[4]{};
+    REQUIRE(classifier.take_runs(runs, 4) == 2);
+    CHECK(runs[0].kind == bottleneck::fragment);
+    CHECK(runs[0].windows == 3);
+    CHECK(runs[0].timestamp_ns_begin == 0);
+    CHECK(runs[0].timestamp_ns_end == 300);
+    CHECK(runs[1].kind == bottleneck::cpu);
+    CHECK(runs[1].windows == 2);
+    CHECK(runs[1].timestamp_ns_end == 500);
+
+    // the last run is only returned once finished, and the oldest runs are dropped
+    REQUIRE(classifier.num_runs() == 0);
+    push(cpu, 1);
+    push(fragment, 1);
+    classifier.finish_run();
+    REQUIRE(classifier.num_runs() == 2);
+    CHECK(classifier.num_dropped_runs() == 1);
+    REQUIRE(classifier.take_runs(runs, 4) == 2);
+    CHECK(runs[0].kind == bottleneck::cpu);
+    CHECK(runs[1].kind == bottleneck::fragment);
+    CHECK(runs[1].timestamp_ns_end == time);
+}
+
+TEST_CASE("bottleneck_classifier__MissingInputs") {
+    SECTION("Fifth generation queues") {
+        sampler_config config{device::product_id::g720, 0};
+        config.add_preset(counter_preset::bottleneck);
+        bottleneck_classifier classifier(config);
+
+        REQUIRE(classifier.has_input(bottleneck_input::fragment_queue));
+        REQUIRE(classifier.has_input(bottleneck_input::non_fragment_queue));
+        const std::vector<hwcpipe_counter> counters(classifier.get_counters(),
+                                                    classifier.get_counters() + classifier.num_counters());
+        CHECK(counters[0] == MaliMainQueueUtil);
+        CHECK(counters[1] == MaliBinningQueueUtil);
+    }
+    SECTION("No stall rate") {
+        const hwcpipe_counter counters[] = {MaliFragQueueUtil, MaliNonFragQueueUtil};
+        bottleneck_classifier classifier(counters, 2);
+        REQUIRE_FALSE(classifier.has_input(bottleneck_input::bus_read_stall));
+
+        const double values[] = {95, 10};
+        REQUIRE(classifier.push(0, 100, values));
+        CHECK(classifier.last() == bottleneck::fragment);
+    }
+    SECTION("No queues") {
+        const hwcpipe_counter counters[] = {MaliCoreUtil};
+        bottleneck_classifier classifier(counters, 1);
+
+        const double values[] = {95};
+        REQUIRE(classifier.push(0, 100, values));
+        CHECK(classifier.last() == bottleneck::unknown);
+        CHECK(classifier.get_summary(bottleneck::unknown).windows == 1);
+    }
+}
+
+} // namespace hwcpipe
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hwcpipe/clock_correlator.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <ctime>
+
+namespace hwcpipe {
+
+namespace {
+
+/** A raw clock that ticks on every reading, and a target clock that drifts from it. */
+struct fake_clocks {
+    static uint64_t raw_ns;
+    static int64_t offset_ns;
+    static double rate;
+    static int num_reads;
+
+    static uint64_t read(clockid_t clock) {
+        ++num_reads;
+        raw_ns += 10;
+        if (clock == CLOCK_MONOTONIC_RAW) {
+            return raw_ns;
+        }
+        return static_cast<uint64_t>(static_cast<double>(raw_ns) * rate) + static_cast<uint64_t>(offset_ns);
+    }
+
+    static void reset(int64_t offset, double drift) {
+        raw_ns = 1000000000;
+        offset_ns = offset;
+        rate = drift;
+        num_reads = 0;
+    }
+};
+
+uint64_t fake_clocks::raw_ns{};
+int64_t fake_clocks::offset_ns{};
+double fake_clocks::rate{1.0};
+int fake_clocks::num_reads{};
+
+} // namespace
+
+TEST_CASE("clock_correlator__Convert") {
+    constexpr uint64_t interval_ns = 1000000;
+
+    SECTION("Timestamps are offset to the target clock") {
+        fake_clocks::reset(5000000, 1.0);
+        clock_correlator correlator(clock_domain::boottime, interval_ns, &fake_clocks::read);
+        REQUIRE(!correlator.calibrated());
+        REQUIRE(correlator.convert(42) == 42);
+
+        correlator.update(fake_clocks::raw_ns);
+        REQUIRE(correlator.calibrated());
+        REQUIRE(correlator.offset_ns() == 5000000);
+        REQUIRE(correlator.uncertainty_ns() == 10);
+        REQUIRE(correlator.convert(2000000000) == 2005000000);
+        REQUIRE(correlator.convert(500000000) == 505000000);
+    }
+
+    SECTION("Calibrations are only made once per interval") {
+        fake_clocks::reset(0, 1.0);
+        clock_correlator correlator(clock_domain::monotonic, interval_ns, &fake_clocks::read);
+        correlator.update(fake_clocks::raw_ns);
+        REQUIRE(fake_clocks::num_reads == 3 * clock_correlator::num_readings);
+
+        correlator.update(fake_clocks::raw_ns + interval_ns / 2);
+        REQUIRE(correlator.num_calibrations() == 1);
+
+        correlator.update(fake_clocks::raw_ns + interval_ns);
+        REQUIRE(correlator.num_calibrations() == 2);
+    }
+
+    SECTION("The drift of the target clock is measured between calibrations") {
+        fake_clocks::reset(0, 1.0001);
+        clock_correlator correlator(clock_domain::realtime, interval_ns, &fake_clocks::read);
+        correlator.calibrate();
+        REQUIRE(correlator.drift_ppm() == 0.0);
+
+        fake_clocks::raw_ns += interval_ns;
+        correlator.calibrate();
+        REQUIRE(correlator.drift_ppm() == Approx(100.0).margin(0.5));
+
+        const uint64_t now = fake_clocks::raw_ns + 10 * interval_ns;
+        const auto expected = static_cast<double>(now) * 1.0001;
+        REQUIRE(static_cast<double>(correlator.convert(now)) == Approx(expected).margin(100.0));
+    }
+
+    SECTION("The sample domain converts nothing") {
+        fake_clocks::reset(5000000, 1.0);
+        clock_correlator correlator(clock_domain::sample, interval_ns, &fake_clocks::read);
+        correlator.update(fake_clocks::raw_ns);
+        REQUIRE(!correlator.calibrated());
+        REQUIRE(fake_clocks::num_reads == 0);
+        REQUIRE(correlator.convert(42) == 42);
+    }
+}
+
+TEST_CASE("clock_correlator__SystemClocks") {
+    clock_correlator correlator(clock_domain::monotonic);
+    const uint64_t raw_ns = clock_correlator::read_clock(CLOCK_MONOTONIC_RAW);
+    correlator.update(raw_ns);
+
+    const uint64_t monotonic_ns = clock_correlator::read_clock(CLOCK_MONOTONIC);
+    const auto converted_ns = correlator.convert(clock_correlator::read_clock(CLOCK_MONOTONIC_RAW));
+    // within a millisecond of a reading of the target clock
+    REQUIRE(static_cast<double>(converted_ns) == Approx(static_cast<double>(monotonic_ns)).margin(1e6));
+}
+
+} // namespace hwcpipe
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "device/product_id.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <hwcpipe/counter_distribution.hpp>
+#include <hwcpipe/hwcpipe_counter.h>
+#include <hwcpipe/sampler.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace hwcpipe {
+
+namespace {
+/** @return The counters of every distribution, in the order a counter_distributions takes them. */
+std::vector<hwcpipe_counter> all_counters() {
+    std::vector<hwcpipe_counter> counters{};
+    for (auto kind : {distribution_kind::read_latency, distribution_kind::read_occupancy,
+                      distribution_kind::write_occupancy}) {
+        const auto distribution = get_distribution_counters(kind);
+        counters.insert(counters.end(), distribution.begin(), distribution.end());
+    }
+    return counters;
+}
+} // namespace
+
+TEST_CASE("counter_distributions__Update") {
+    const auto counters = all_counters();
+    REQUIRE(counters.size() == 6 + 4 + 4);
+    counter_distributions distributions(counters.data(), counters.size());
+    REQUIRE(distributions.num_counters() == counters.size());
+    REQUIRE(distributions.get_counters()[0] == MaliExtBusRdBt);
+
+    // 1000 read beats: 500 below 128 cycles, 400 of 128-191, and 100 left to
+    // the 384+ bucket. Reads spread over the quartiles, writes all below 25%.
+    const uint64_t values[] = {1000, 500, 400, 0, 0, 0, 40, 10, 10, 10, 8, 8, 0, 0};
+    distributions.update(values);
+
+    const auto &latency = distributions.get(distribution_kind::read_latency);
+    REQUIRE(latency.num_buckets == 6);
+    CHECK(latency.total == 1000);
+    CHECK(latency.fractions[0] == Approx(0.5));
+    CHECK(latency.fractions[1] == Approx(0.4));
+    CHECK(latency.fractions[5] == Approx(0.1));
+    CHECK(latency.edges[1] == 128);
+    // the median is the top of the first bucket, and the 90th percentile the
+    // top of the second
+    CHECK(latency.p50 == Approx(128));
+    CHECK(latency.p90 == Approx(192));
+    CHECK(latency.p99 == Approx(384 + 64 * 0.9));
+
+    const auto &reads = distributions.get(distribution_kind::read_occupancy);
+    CHECK(reads.total == 40);
+    CHECK(reads.fractions[0] == Approx(0.25));
+    CHECK(reads.fractions[3] == Approx(0.25));
+    CHECK(reads.p50 == Approx(50));
+
+    const auto &writes = distributions.get(distribution_kind::write_occupancy);
+    CHECK(writes.total == 8);
+    CHECK(writes.fractions[0] == Approx(1.0));
+    CHECK(writes.p99 == Approx(24.75));
+
+    SECTION("Buckets that exceed the total leave the last one empty") {
+        const uint64_t skewed[] = {100, 60, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+        distributions.update(skewed);
+        CHECK(latency.total == 110);
+        CHECK(latency.fractions[5] == 0);
+        CHECK(std::isnan(reads.p50));
+        CHECK(reads.fractions[0] == 0);
+    }
+}
+
+TEST_CASE("counter_distributions__MissingCounters") {
+    const hwcpipe_counter counters[] = {MaliExtBusRd, MaliExtBusRdOTQ1, MaliExtBusRdOTQ2, MaliExtBusRdOTQ3,
+                                        MaliExtBusRdBt, MaliExtBusRdLat0};
+    counter_distributions distributions(counters, 6);
+    CHECK(!distributions.has_distribution(distribution_kind::read_latency));
+    CHECK(distributions.has_distribution(distribution_kind::read_occupancy));
+    CHECK(!distributions.has_distribution(distribution_kind::write_occupancy));
+    REQUIRE(distributions.num_counters() == 4);
+    CHECK(distributions.get_counters()[0] == MaliExtBusRd);
+
+    const uint64_t values[] = {4, 1, 1, 1};
+    distributions.update(values);
+    CHECK(distributions.get(distribution_kind::read_occupancy).fractions[3] == Approx(0.25));
+    CHECK(std::isnan(distributions.get(distribution_kind::read_latency).p50));
+}
+
+TEST_CASE("counter_distributions__FromSamplerConfig") {
+    sampler_config config{device::product_id::g720, 0};
+    for (auto counter : get_distribution_counters(distribution_kind::read_latency)) {
+        REQUIRE(!config.add_counter(counter));
+    }
+    counter_distributions distributions(config);
+    CHECK(distributions.has_distribution(distribution_kind::read_latency));
+    CHECK(!distributions.has_distribution(distribution_kind::read_occupancy));
+    CHECK(distributions.num_counters() == 6);
+}
+
+} // namespace hwcpipe
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023-2024 Arm Limited.
+ * Copyright (c) 2023-2025 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  */
@@ -11,6 +11,7 @@
 #include <hwcpipe/detail/assert.hpp>
 #include <hwcpipe/detail/counter_database.hpp>
 
+#include <algorithm>
 #include <cassert>
 #include <cstring>
 #include <iostream>
@@ -82,6 +83,42 @@ TEST_CASE("FindCountersForGPUProduct___FindsGPUCounters___AssertsCorrectGPUCount
     }
 }
 
+TEST_CASE("FindCountersForGPUProduct___ProductOverridesSharedTable___EachCounterYieldedOnceWithOverriddenAddress") {
+    // Mali-G51 shares the Mali-G31 table, with a different address for some counters
+    detail::counter_database db{};
+    std::error_code ec;
+
+    auto g31_def = db.get_counter_def(device::product_id::g31, hwcpipe_counter::MaliSCBusLSWBWrBt, ec);
+    REQUIRE(!ec);
+    auto g51_def = db.get_counter_def(device::product_id::g51, hwcpipe_counter::MaliSCBusLSWBWrBt, ec);
+    REQUIRE(!ec);
+    REQUIRE(g31_def.get_address().offset == 61);
+    REQUIRE(g51_def.get_address().offset == 63);
+
+    auto counters_iterable = db.get_counters_for_gpu(device::product_id::g51);
+    std::vector<hwcpipe_counter> gpu_counters(counters_iterable.begin(), counters_iterable.end());
+    REQUIRE(gpu_counters.size() == 228);
+    REQUIRE(std::is_sorted(gpu_counters.begin(), gpu_counters.end()));
+    REQUIRE(std::adjacent_find(gpu_counters.begin(), gpu_counters.end()) == gpu_counters.end());
+}
+
+TEST_CASE("FindCountersForGPUProduct___IteratorExposesTheCounterType___MatchesTheCounterDefinition") {
+    detail::counter_database db{};
+    std::error_code ec;
+
+    auto counters_iterable = db.get_counters_for_gpu(device::product_id::g715);
+    size_t num_expressions = 0;
+    for (auto it = counters_iterable.begin(); it != counters_iterable.end(); ++it) {
+        const auto definition = db.get_counter_def(device::product_id::g715, *it, ec);
+        REQUIRE(!ec);
+        REQUIRE(it.get_type() == definition.tag);
+        num_expressions += it.get_type() == detail::counter_definition::type::expression ? 1 : 0;
+    }
+
+    REQUIRE(num_expressions != 0);
+    REQUIRE(counters_iterable.end().get_type() == detail::counter_definition::type::invalid);
+}
+
 TEST_CASE("FindCountersForGPUProduct___DoesNotFindGPU___AssertsErrorCodeIsCorrectlyAssigned") {
     const device::product_id useless_pid{};
     auto counters_iterable = detail::counter_database().get_counters_for_gpu(useless_pid);
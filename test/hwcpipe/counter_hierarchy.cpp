@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "device/product_id.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <hwcpipe/counter_hierarchy.hpp>
+#include <hwcpipe/error.hpp>
+#include <hwcpipe/hwcpipe_counter.h>
+#include <hwcpipe/sampler.hpp>
+
+#include <cstring>
+#include <vector>
+
+namespace hwcpipe {
+
+namespace {
+
+/** @return The index of a group of the hierarchy, or num_groups. */
+size_t find_group(const counter_hierarchy &hierarchy, const char *name) {
+    size_t group = 0;
+    while (group != hierarchy.num_groups && std::strcmp(hierarchy.groups[group].name, name) != 0) {
+        ++group;
+    }
+    return group;
+}
+
+/** Sampler stand-in for counter_tree_view::update(). */
+struct sampler_stub {
+    read_list make_read_list(const hwcpipe_counter *, size_t count, std::error_code &ec) const {
+        ++lists;
+        last_count = count;
+        if (fail) {
+            ec = make_error_code(errc::unknown_counter);
+        }
+        return {};
+    }
+    std::error_code get_counter_values(const read_list &, double *values, size_t count) const {
+        for (size_t i = 0; i != count; ++i) {
+            values[i] = static_cast<double>(i + 1);
+        }
+        return {};
+    }
+    mutable size_t lists{};
+    mutable size_t last_count{};
+    bool fail{};
+};
+
+void count_changes(void *user_data, uint64_t version) { *static_cast<uint64_t *>(user_data) = version; }
+
+} // namespace
+
+TEST_CASE("counter_hierarchy__Tables") {
+    const auto &hierarchy = get_counter_hierarchy();
+    REQUIRE(hierarchy.num_sections != 0);
+    CHECK(std::strcmp(hierarchy.sections[0].name, "GPU Front-end") == 0);
+
+    // the sections partition the groups, and the groups the counters
+    size_t next_group = 0;
+    size_t next_counter = 0;
+    for (size_t section = 0; section != hierarchy.num_sections; ++section) {
+        const auto &info = hierarchy.sections[section];
+        REQUIRE(info.first_group == next_group);
+        REQUIRE(info.num_groups != 0);
+        for (size_t group = info.first_group; group != info.first_group + info.num_groups; ++group) {
+            REQUIRE(hierarchy.groups[group].section == section);
+            REQUIRE(hierarchy.groups[group].first_counter == next_counter);
+            REQUIRE(hierarchy.groups[group].num_counters != 0);
+            next_counter += hierarchy.groups[group].num_counters;
+        }
+        next_group += info.num_groups;
+    }
+    CHECK(next_group == hierarchy.num_groups);
+    CHECK(next_counter == hierarchy.num_counters);
+
+    const size_t cycles = find_group(hierarchy, "GPU Cycles");
+    REQUIRE(cycles != hierarchy.num_groups);
+    CHECK(hierarchy.counters[hierarchy.groups[cycles].first_counter] == MaliGPUActiveCy);
+}
+
+TEST_CASE("counter_tree_view__Visibility") {
+    const auto &hierarchy = get_counter_hierarchy();
+    const size_t cycles = find_group(hierarchy, "GPU Cycles");
+    const size_t bandwidth = find_group(hierarchy, "External Bus Bytes");
+    REQUIRE(bandwidth != hierarchy.num_groups);
+
+    const hwcpipe_counter available[] = {MaliGPUActiveCy, MaliFragQueueActiveCy, MaliExtBusRdBy};
+    counter_tree_view view(available, 3);
+    CHECK(view.num_available(cycles) == 2);
+    CHECK(view.num_visible() == 0);
+
+    uint64_t notified = 0;
+    view.set_change_handler(count_changes, &notified);
+
+    SECTION("A group is visible when its section is expanded too") {
+        view.set_group_expanded(cycles, true);
+        CHECK(view.num_visible() == 0);
+        CHECK(view.version() == 0);
+
+        view.set_section_expanded(hierarchy.groups[cycles].section, true);
+        REQUIRE(view.num_visible() == 2);
+        CHECK(view.get_visible_counters()[0] == MaliGPUActiveCy);
+        CHECK(view.get_visible_counters()[1] == MaliFragQueueActiveCy);
+        CHECK(view.version() == 1);
+        CHECK(notified == 1);
+
+        // collapsing the section keeps the state of the group
+        view.set_section_expanded(hierarchy.groups[cycles].section, false);
+        CHECK(view.num_visible() == 0);
+        CHECK(view.is_group_expanded(cycles));
+        CHECK(notified == 2);
+    }
+    SECTION("Nodes without counters of the GPU don't change the view") {
+        view.set_all_expanded(true);
+        CHECK(view.num_visible() >= 3);
+        const uint64_t version = view.version();
+        for (size_t group = 0; group != hierarchy.num_groups; ++group) {
+            if (view.num_available(group) == 0) {
+                view.set_group_expanded(group, false);
+            }
+        }
+        CHECK(view.version() == version);
+        view.set_group_expanded(bandwidth, false);
+        CHECK(view.version() == version + 1);
+    }
+}
+
+TEST_CASE("counter_tree_view__Update") {
+    const auto &hierarchy = get_counter_hierarchy();
+    const size_t cycles = find_group(hierarchy, "GPU Cycles");
+    const hwcpipe_counter available[] = {MaliGPUActiveCy, MaliFragQueueActiveCy};
+    counter_tree_view view(available, 2);
+    view.set_section_expanded(hierarchy.groups[cycles].section, true);
+    view.set_group_expanded(cycles, true);
+
+    sampler_stub sampler{};
+    REQUIRE(!view.update(sampler));
+    REQUIRE(!view.update(sampler));
+    CHECK(sampler.lists == 1);
+    CHECK(sampler.last_count == 2);
+    CHECK(view.get_values()[1] == 2.0);
+
+    // the read list is rebuilt after a change
+    view.set_group_expanded(cycles, false);
+    sampler.fail = true;
+    CHECK(view.update(sampler) == make_error_code(errc::unknown_counter));
+    sampler.fail = false;
+    REQUIRE(!view.update(sampler));
+    CHECK(sampler.lists == 3);
+    CHECK(sampler.last_count == 0);
+}
+
+TEST_CASE("counter_tree_view__FromSamplerConfig") {
+    sampler_config config{device::product_id::g720, 0};
+    const auto &hierarchy = get_counter_hierarchy();
+    for (size_t i = 0; i != hierarchy.num_counters; ++i) {
+        // counters the GPU doesn't have are rejected
+        std::error_code ec = config.add_counter(hierarchy.counters[i]);
+        (void)ec;
+    }
+    counter_tree_view view(config);
+    view.set_all_expanded(true);
+    CHECK(view.num_visible() > 100);
+}
+
+} // namespace hwcpipe
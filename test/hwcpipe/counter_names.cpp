@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "device/product_id.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <hwcpipe/counter_database.hpp>
+#include <hwcpipe/error.hpp>
+#include <hwcpipe/hwcpipe_counter.h>
+#include <hwcpipe/sampler.hpp>
+
+#include <system_error>
+
+namespace hwcpipe {
+
+TEST_CASE("CounterNames___FindCounter___FindsTheIdentifiers") {
+    struct {
+        const char *name;
+        hwcpipe_counter counter;
+    } const identifiers[] = {
+        // the first and last identifiers in byte order
+        {"MaliALUIssueCy", MaliALUIssueCy},
+        {"MaliVertQueuedCy", MaliVertQueuedCy},
+        {"MaliGPUActiveCy", MaliGPUActiveCy},
+        // identifiers that are prefixes of others
+        {"MaliExtBusRd", MaliExtBusRd},
+        {"MaliExtBusRdBy", MaliExtBusRdBy},
+        {"MaliExtBusRdLat128", MaliExtBusRdLat128},
+        {"MaliEngDivergedInstr", MaliEngDivergedInstr},
+        {"MaliEngDivergedInstrRate", MaliEngDivergedInstrRate},
+    };
+
+    counter_database db{};
+    for (const auto &identifier : identifiers) {
+        hwcpipe_counter counter{};
+        REQUIRE(!db.find_counter(identifier.name, counter));
+        CHECK(counter == identifier.counter);
+    }
+}
+
+TEST_CASE("CounterNames___FindCounter___RejectsUnknownIdentifiers") {
+    const char *name = GENERATE("", "Mali", "MaliExtBusR", "MaliExtBusRdX", "maliGPUActiveCy", "MaliZZZ", "AAA");
+
+    counter_database db{};
+    hwcpipe_counter counter{MaliGPUActiveCy};
+    CHECK(db.find_counter(name, counter) == make_error_code(errc::unknown_counter));
+    CHECK(counter == MaliGPUActiveCy);
+}
+
+TEST_CASE("CounterNames___AddCounters___MatchesAddingTheCounters") {
+    sampler_config config{device::product_id::g610, 0};
+    REQUIRE(!config.add_counters({"MaliGPUActiveCy", "MaliFragQueueUtil", "MaliExtBusRdBy"}));
+
+    sampler_config expected{device::product_id::g610, 0};
+    REQUIRE(!expected.add_counter(MaliGPUActiveCy));
+    REQUIRE(!expected.add_counter(MaliFragQueueUtil));
+    REQUIRE(!expected.add_counter(MaliExtBusRdBy));
+
+    CHECK(config.get_valid_counters() == expected.get_valid_counters());
+}
+
+TEST_CASE("CounterNames___AddCounters___StopsAtTheFirstError") {
+    sampler_config config{device::product_id::g610, 0};
+
+    const char *names[] = {"MaliGPUActiveCy", "MaliNotACounter", "MaliFragActiveCy"};
+    CHECK(config.add_counters(names, 3) == make_error_code(errc::unknown_counter));
+    CHECK(config.get_valid_counters().size() == 1);
+
+    sampler_config other{device::product_id::g31, 0};
+    CHECK(other.add_counters({"MaliRTUTri"}) == make_error_code(errc::invalid_counter_for_device));
+}
+
+} // namespace hwcpipe
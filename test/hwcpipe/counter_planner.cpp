@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "device/product_id.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <hwcpipe/counter_planner.hpp>
+#include <hwcpipe/detail/counter_database.hpp>
+#include <hwcpipe/error.hpp>
+#include <hwcpipe/hwcpipe_counter.h>
+
+#include <set>
+#include <system_error>
+
+namespace hwcpipe {
+
+namespace {
+constexpr auto pid = device::product_id::g610;
+
+/** @return The hardware counters that an expression counter reads. */
+std::set<hwcpipe_counter> dependencies_of(hwcpipe_counter counter) {
+    detail::counter_database db{};
+    std::error_code ec;
+    const auto definition = db.get_counter_def(pid, counter, ec);
+    REQUIRE(!ec);
+
+    const auto &dependencies = definition.get_expression().dependencies;
+    return {dependencies.begin(), dependencies.end()};
+}
+} // namespace
+
+TEST_CASE("CounterPlanner___AddCounter___ResolvesTheHardwareCounters") {
+    counter_planner planner{pid};
+
+    REQUIRE(!planner.add_counter(MaliFragQueueUtil));
+    REQUIRE(!planner.add_counter(MaliGPUActiveCy));
+
+    // MaliFragQueueUtil already reads MaliGPUActiveCy
+    CHECK(planner.get_hardware_counters() == dependencies_of(MaliFragQueueUtil));
+    CHECK(planner.get_hardware_counters().count(MaliGPUActiveCy) == 1);
+    CHECK(planner.get_num_passes() == 1);
+
+    const auto configs = planner.build_sampler_configs(0);
+    REQUIRE(configs.size() == 1);
+    CHECK(configs[0].get_valid_counters().count(MaliFragQueueUtil) == 1);
+    CHECK(configs[0].get_valid_counters().count(MaliGPUActiveCy) == 1);
+}
+
+TEST_CASE("CounterPlanner___AddCounter___PacksCountersIntoPasses") {
+    // one counter per block and pass
+    counter_planner planner{pid, 1};
+
+    REQUIRE(!planner.add_counter(MaliGPUActiveCy));
+    REQUIRE(!planner.add_counter(MaliFragActiveCy));
+    CHECK(planner.get_num_passes() == 1);
+
+    // same block as MaliGPUActiveCy
+    REQUIRE(!planner.add_counter(MaliGPUIRQActiveCy));
+    CHECK(planner.get_num_passes() == 2);
+
+    // fits in the second pass
+    REQUIRE(!planner.add_counter(MaliNonFragActiveCy));
+    CHECK(planner.get_num_passes() == 2);
+    CHECK(planner.get_pass_counters(1) == std::set<hwcpipe_counter>{MaliGPUIRQActiveCy, MaliNonFragActiveCy});
+
+    const auto configs = planner.build_sampler_configs(1);
+    REQUIRE(configs.size() == 2);
+    CHECK(configs[1].get_device_number() == 1);
+    for (const auto &config : configs) {
+        for (const auto &block : config.build_backend_config_list()) {
+            CHECK(block.enable_map.count() == 1);
+        }
+    }
+}
+
+TEST_CASE("CounterPlanner___AddCounter___RejectsCountersThatDontFitAPass") {
+    counter_planner planner{pid, dependencies_of(MaliFragQueueUtil).size() - 1};
+
+    CHECK(planner.add_counter(MaliFragQueueUtil) == make_error_code(errc::counter_budget_exceeded));
+    CHECK(planner.get_num_passes() == 0);
+    CHECK(planner.get_hardware_counters().empty());
+}
+
+TEST_CASE("CounterPlanner___AddCounter___RejectsCountersOfOtherGpus") {
+    counter_planner planner{device::product_id::g31};
+
+    CHECK(planner.add_counter(MaliRTUTri) == make_error_code(errc::invalid_counter_for_device));
+    CHECK(planner.get_num_passes() == 0);
+}
+
+} // namespace hwcpipe
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "device/product_id.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <hwcpipe/counter_preset.hpp>
+#include <hwcpipe/hwcpipe_counter.h>
+#include <hwcpipe/sampler.hpp>
+
+#include <algorithm>
+#include <system_error>
+
+namespace hwcpipe {
+
+namespace {
+/** @return A config with the counters of a preset that the GPU supports, added one by one. */
+sampler_config add_one_by_one(counter_preset preset, device::product_id pid) {
+    sampler_config config{pid, 0};
+
+    const auto counters = detail::get_preset_counters(preset);
+    for (size_t i = 0; i != counters.size; ++i) {
+        auto ec = config.add_counter(counters.data[i]);
+        if (ec) {
+            REQUIRE(ec == make_error_code(errc::invalid_counter_for_device));
+        }
+    }
+
+    return config;
+}
+} // namespace
+
+TEST_CASE("CounterPreset___GetPresetCounters___ListsTheSemanticGroups") {
+    for (auto preset : {counter_preset::frame_overview, counter_preset::memory_bandwidth, counter_preset::shader_alu,
+                        counter_preset::bottleneck}) {
+        CHECK(detail::get_preset_counters(preset).size != 0);
+    }
+
+    const auto counters = detail::get_preset_counters(counter_preset::frame_overview);
+    CHECK(counters.data[0] == MaliGPUActiveCy);
+}
+
+TEST_CASE("CounterPreset___AddPreset___MatchesAddingTheCounters") {
+    const auto preset = GENERATE(counter_preset::frame_overview, counter_preset::memory_bandwidth,
+                                 counter_preset::shader_alu, counter_preset::bottleneck);
+    const auto pid = GENERATE(device::product_id::g31, device::product_id::g78, device::product_id::g715);
+
+    sampler_config config{pid, 0};
+    config.add_preset(preset);
+
+    const auto expected = add_one_by_one(preset, pid);
+    CHECK(!config.get_valid_counters().empty());
+    CHECK(config.get_valid_counters() == expected.get_valid_counters());
+
+    const auto config_list = config.build_backend_config_list();
+    const auto expected_list = expected.build_backend_config_list();
+    REQUIRE(config_list.size() == expected_list.size());
+    for (const auto &block : config_list) {
+        const auto it = std::find_if(expected_list.begin(), expected_list.end(),
+                                     [&](const sampler_config::backend_cfg_type &cfg) { return cfg.type == block.type; });
+        REQUIRE(it != expected_list.end());
+        CHECK(it->enable_map == block.enable_map);
+    }
+}
+
+TEST_CASE("CounterPreset___GetPresetConfig___IsResolvedOnce") {
+    const auto &first = detail::get_preset_config(counter_preset::shader_alu, device::product_id::g610);
+    const auto &second = detail::get_preset_config(counter_preset::shader_alu, device::product_id::g610);
+    CHECK(&first == &second);
+
+    const auto &other = detail::get_preset_config(counter_preset::shader_alu, device::product_id::g710);
+    CHECK(&first != &other);
+}
+
+TEST_CASE("CounterPreset___AddPreset___MergesWithOtherCounters") {
+    sampler_config config{device::product_id::g610, 0};
+    REQUIRE(!config.add_counter(MaliFragActiveCy));
+    config.add_preset(counter_preset::memory_bandwidth);
+
+    CHECK(config.get_valid_counters().count(MaliFragActiveCy) == 1);
+    CHECK(config.get_valid_counters().count(MaliExtBusRdBy) == 1);
+}
+
+} // namespace hwcpipe
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hwcpipe/counter_smoother.hpp"
+#include "hwcpipe/error.hpp"
+#include "hwcpipe/sampler.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <system_error>
+
+namespace hwcpipe {
+
+namespace {
+
+/** Sampler stand-in for counter_smoother::update(sampler, list). */
+struct sampler_stub {
+    std::error_code get_counter_values(int list, double *values, size_t count) const {
+        if (count < 2) {
+            return make_error_code(errc::invalid_read_list);
+        }
+        values[0] = static_cast<double>(list);
+        values[1] = static_cast<double>(list) * 2;
+        return {};
+    }
+    sample_interval get_sample_interval() const { return {1000, 2000, 0, 0}; }
+};
+
+} // namespace
+
+TEST_CASE("counter_smoother__Update") {
+    counter_smoother smoother(2, 1000);
+    REQUIRE(smoother.size() == 2);
+    REQUIRE(!smoother.primed());
+
+    const double first[2] = {10.0, 100.0};
+    smoother.update(0, 500, first);
+    REQUIRE(smoother.primed());
+
+    SECTION("The first sample sets the averages") {
+        REQUIRE(smoother.value(0) == 10.0);
+        REQUIRE(smoother.value(1) == 100.0);
+    }
+
+    SECTION("A sample moves the averages by its weight") {
+        const double next[2] = {20.0, 0.0};
+        smoother.update(0, 1000, next);
+
+        const double weight = 1.0 - std::exp(-1.0);
+        REQUIRE(smoother.values()[0] == Approx(10.0 + weight * 10.0));
+        REQUIRE(smoother.values()[1] == Approx(100.0 - weight * 100.0));
+    }
+
+    SECTION("Uneven intervals give the same averages") {
+        counter_smoother split(2, 1000);
+        split.update(0, 500, first);
+
+        // one sample of 1000 ns, or two of 500 ns with the same values
+        const double next[2] = {20.0, 0.0};
+        smoother.update(0, 1000, next);
+        split.update(0, 500, next);
+        split.update(0, 500, next);
+        REQUIRE(split.value(0) == Approx(smoother.value(0)));
+        REQUIRE(split.value(1) == Approx(smoother.value(1)));
+    }
+
+    SECTION("Per counter time constants") {
+        smoother.set_time_constant(1, 0);
+        REQUIRE(smoother.time_constant(0) == 1000);
+        REQUIRE(smoother.time_constant(1) == 0);
+
+        const double next[2] = {20.0, 5.0};
+        smoother.update(0, 1000, next);
+        REQUIRE(smoother.value(0) < 20.0);
+        REQUIRE(smoother.value(1) == 5.0);
+    }
+
+    SECTION("Empty samples are ignored") {
+        const double next[2] = {20.0, 0.0};
+        smoother.update(0, 0, next);
+        REQUIRE(smoother.value(0) == 10.0);
+    }
+
+    SECTION("Reset") {
+        smoother.reset();
+        REQUIRE(!smoother.primed());
+
+        const double next[2] = {20.0, 0.0};
+        smoother.update(0, 1000, next);
+        REQUIRE(smoother.value(0) == 20.0);
+    }
+}
+
+TEST_CASE("counter_smoother__UpdateFromSampler") {
+    counter_smoother smoother(2, 1000);
+    const sampler_stub sampler{};
+
+    REQUIRE(!smoother.update(sampler, 3));
+    REQUIRE(smoother.value(0) == 3.0);
+    REQUIRE(smoother.value(1) == 6.0);
+
+    REQUIRE(!smoother.update(sampler, 4));
+    REQUIRE(smoother.value(0) == Approx(3.0 + (1.0 - std::exp(-1.0))));
+
+    counter_smoother narrow(1, 1000);
+    REQUIRE(narrow.update(sampler, 3) == make_error_code(errc::invalid_read_list));
+    REQUIRE(!narrow.primed());
+}
+
+} // namespace hwcpipe
@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hwcpipe/counter_statistics.hpp"
+#include "hwcpipe/error.hpp"
+#include "hwcpipe/hwcpipe_counter.h"
+
+#include <catch2/catch.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <system_error>
+#include <vector>
+
+namespace hwcpipe {
+
+namespace {
+
+const hwcpipe_counter counters[] = {MaliGPUActiveCy, MaliFragQueueUtil};
+
+/** Sampler stand-in for counter_statistics::push(sampler, list). */
+struct sampler_stub {
+    std::error_code get_counter_values(int list, double *values, size_t count) const {
+        if (count < 2) {
+            return make_error_code(errc::invalid_read_list);
+        }
+        values[0] = list;
+        values[1] = -list;
+        return {};
+    }
+};
+
+/** Adds the samples @p first to @p last, whose values are their number and its tenth. */
+void add_range(counter_statistics &stats, int first, int last) {
+    for (int i = first; i != last; ++i) {
+        const double values[2] = {static_cast<double>(i), i / 10.0};
+        stats.add(values);
+    }
+}
+
+} // namespace
+
+TEST_CASE("running_stats__Welford") {
+    running_stats stats{};
+    REQUIRE(stats.variance() == 0);
+    for (int i = 1; i <= 5; ++i) {
+        stats.add(i);
+    }
+    REQUIRE(stats.count == 5);
+    REQUIRE(stats.mean == Approx(3));
+    REQUIRE(stats.variance() == Approx(2));
+    REQUIRE(stats.min == 1);
+    REQUIRE(stats.max == 5);
+
+    running_stats low{};
+    running_stats high{};
+    for (int i = 1; i <= 5; ++i) {
+        (i < 3 ? low : high).add(i);
+    }
+    low.merge(high);
+    low.merge(running_stats{});
+    REQUIRE(low.count == 5);
+    REQUIRE(low.mean == Approx(3));
+    REQUIRE(low.variance() == Approx(2));
+    REQUIRE(low.min == 1);
+    REQUIRE(low.max == 5);
+}
+
+TEST_CASE("quantile_sketch__RelativeAccuracy") {
+    quantile_sketch sketch(0.01);
+    REQUIRE(sketch.quantile(0.5) == 0);
+
+    SECTION("Quantiles are within the relative accuracy") {
+        for (int i = 1; i <= 10000; ++i) {
+            sketch.add(i);
+        }
+        REQUIRE(sketch.count() == 10000);
+        REQUIRE(sketch.quantile(0) == Approx(1).epsilon(0.01));
+        REQUIRE(sketch.quantile(0.5) == Approx(5000).epsilon(0.01));
+        REQUIRE(sketch.quantile(0.99) == Approx(9900).epsilon(0.01));
+        REQUIRE(sketch.quantile(1) == Approx(10000).epsilon(0.01));
+    }
+
+    SECTION("Negative values and zeros are ordered") {
+        sketch.add(-100);
+        sketch.add(0);
+        sketch.add(1e-9);
+        sketch.add(100);
+        REQUIRE(sketch.quantile(0) == Approx(-100).epsilon(0.01));
+        REQUIRE(sketch.quantile(0.4) == 0);
+        REQUIRE(sketch.quantile(1) == Approx(100).epsilon(0.01));
+    }
+
+    SECTION("Merged sketches add their values") {
+        quantile_sketch other(0.01);
+        for (int i = 1; i <= 100; ++i) {
+            (i % 2 == 0 ? sketch : other).add(i);
+        }
+        REQUIRE(!sketch.merge(other));
+        REQUIRE(sketch.count() == 100);
+        REQUIRE(sketch.quantile(0.5) == Approx(50).epsilon(0.02));
+
+        const quantile_sketch coarse(0.05);
+        REQUIRE(sketch.merge(coarse) == make_error_code(errc::statistics_mismatch));
+
+        sketch.clear();
+        REQUIRE(sketch.count() == 0);
+    }
+}
+
+TEST_CASE("counter_statistics__Summaries") {
+    counter_statistics stats(counters, 2);
+    REQUIRE(stats.size() == 2);
+    REQUIRE(stats.get_counter(1) == MaliFragQueueUtil);
+    add_range(stats, 1, 1001);
+    REQUIRE(stats.get_stats(0).count == 1000);
+    REQUIRE(stats.get_stats(0).mean == Approx(500.5));
+    REQUIRE(stats.get_stats(1).max == Approx(100));
+    REQUIRE(stats.get_sketch(0).quantile(0.9) == Approx(900).epsilon(0.02));
+
+    SECTION("Summaries round trip") {
+        std::vector<uint8_t> summary;
+        stats.serialize(summary);
+        // a few bytes per bucket rather than per sample
+        REQUIRE(summary.size() < 1000 * sizeof(double));
+
+        std::error_code ec;
+        const auto copy = counter_statistics::deserialize(summary.data(), summary.size(), ec);
+        REQUIRE(!ec);
+        REQUIRE(copy.size() == 2);
+        REQUIRE(copy.get_counter(0) == MaliGPUActiveCy);
+        REQUIRE(copy.get_stats(0).count == 1000);
+        REQUIRE(copy.get_stats(0).variance() == stats.get_stats(0).variance());
+        REQUIRE(copy.get_sketch(1).count() == 1000);
+        for (const double q : {0.0, 0.25, 0.5, 0.99, 1.0}) {
+            REQUIRE(copy.get_sketch(0).quantile(q) == stats.get_sketch(0).quantile(q));
+            REQUIRE(copy.get_sketch(1).quantile(q) == stats.get_sketch(1).quantile(q));
+        }
+    }
+
+    SECTION("Malformed summaries are rejected") {
+        std::vector<uint8_t> summary;
+        stats.serialize(summary);
+        std::error_code ec;
+
+        const auto truncated = counter_statistics::deserialize(summary.data(), summary.size() - 1, ec);
+        REQUIRE(ec == make_error_code(errc::invalid_statistics_layout));
+        REQUIRE(truncated.size() == 0);
+
+        summary[0] = 0;
+        const auto bad_magic = counter_statistics::deserialize(summary.data(), summary.size(), ec);
+        REQUIRE(ec == make_error_code(errc::invalid_statistics_layout));
+    }
+
+    SECTION("Summaries merge") {
+        counter_statistics other(counters, 2);
+        add_range(other, 1001, 2001);
+        REQUIRE(!stats.merge(other));
+        REQUIRE(stats.get_stats(0).count == 2000);
+        REQUIRE(stats.get_stats(0).mean == Approx(1000.5));
+        REQUIRE(stats.get_stats(0).max == 2000);
+        REQUIRE(stats.get_sketch(0).quantile(0.5) == Approx(1000).epsilon(0.02));
+
+        const counter_statistics fewer(counters, 1);
+        REQUIRE(stats.merge(fewer) == make_error_code(errc::statistics_mismatch));
+        const counter_statistics finer(counters, 2, 0.01);
+        REQUIRE(stats.merge(finer) == make_error_code(errc::statistics_mismatch));
+
+        stats.clear();
+        REQUIRE(stats.get_stats(0).count == 0);
+        REQUIRE(stats.get_sketch(0).count() == 0);
+    }
+
+    SECTION("Samplers push their last sample") {
+        counter_statistics pushed(counters, 2);
+        REQUIRE(!pushed.push(sampler_stub{}, 7));
+        REQUIRE(pushed.get_stats(1).min == -7);
+
+        counter_statistics narrow(counters, 1);
+        REQUIRE(narrow.push(sampler_stub{}, 7) == make_error_code(errc::invalid_read_list));
+    }
+}
+
+} // namespace hwcpipe
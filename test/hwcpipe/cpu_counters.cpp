@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hwcpipe/hwcpipe_counter.h"
+
+#include <catch2/catch.hpp>
+
+#include <hwcpipe/combined_sampler.hpp>
+#include <hwcpipe/cpu_counters.hpp>
+#include <hwcpipe/error.hpp>
+#include <hwcpipe/gpu_simulator.hpp>
+#include <hwcpipe/sampler.hpp>
+#include <hwcpipe/timeline_summary.hpp>
+
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <sys/stat.h>
+
+namespace hwcpipe {
+
+namespace {
+
+/** A fake sysfs CPU directory, removed on destruction. */
+class fake_cpu_dir {
+  public:
+    fake_cpu_dir() {
+        char path[] = "/tmp/hwcpipe-cpus-XXXXXX";
+        REQUIRE(::mkdtemp(path) != nullptr);
+        path_ = path;
+    }
+
+    ~fake_cpu_dir() {
+        const std::string command = "rm -rf " + path_;
+        static_cast<void>(std::system(command.c_str()));
+    }
+
+    const std::string &path() const { return path_; }
+
+    /** Adds a CPU, with an optional file and its contents. */
+    void add_cpu(int cpu, const std::string &file = {}, const std::string &contents = {}) {
+        const std::string cpu_path = path_ + "/cpu" + std::to_string(cpu);
+        ::mkdir(cpu_path.c_str(), 0755);
+        ::mkdir((cpu_path + "/cpufreq").c_str(), 0755);
+        if (!file.empty()) {
+            std::ofstream(cpu_path + "/" + file) << contents << "\n";
+        }
+    }
+
+  private:
+    std::string path_;
+};
+
+const cpu_event events[] = {cpu_event::cycles, cpu_event::instructions};
+
+/** Spins for a while, so that the counters move. */
+uint64_t spin() {
+    volatile uint64_t sum = 0;
+    for (uint64_t i = 0; i != 100000; ++i) {
+        sum = sum + i;
+    }
+    return sum;
+}
+
+} // namespace
+
+TEST_CASE("CpuCounters___ParseCpuList___AcceptsRangesAndLists") {
+    CHECK(detail::parse_cpu_list("0-3") == 0xF);
+    CHECK(detail::parse_cpu_list("0-3,6\n") == 0x4F);
+    CHECK(detail::parse_cpu_list("4 5 6 7") == 0xF0);
+    CHECK(detail::parse_cpu_list("62-70") == 0xC000000000000000ULL);
+    CHECK(detail::parse_cpu_list("") == 0);
+}
+
+TEST_CASE("CpuCounters___FindClusters___GroupsTheCpus") {
+    fake_cpu_dir dir;
+
+    SECTION("By frequency domain") {
+        for (int cpu = 0; cpu != 4; ++cpu) {
+            dir.add_cpu(cpu, "cpufreq/related_cpus", "0 1 2 3");
+        }
+        for (int cpu = 4; cpu != 7; ++cpu) {
+            dir.add_cpu(cpu, "cpufreq/related_cpus", "4-6");
+        }
+        dir.add_cpu(7, "cpufreq/related_cpus", "7");
+        CHECK(find_cpu_clusters(dir.path()) == std::vector<uint64_t>{0x0F, 0x70, 0x80});
+    }
+
+    SECTION("By capacity") {
+        dir.add_cpu(0, "cpu_capacity", "512");
+        dir.add_cpu(1, "cpu_capacity", "1024");
+        dir.add_cpu(2, "cpu_capacity", "512");
+        CHECK(find_cpu_clusters(dir.path()) == std::vector<uint64_t>{0x5, 0x2});
+    }
+
+    SECTION("In one cluster") {
+        dir.add_cpu(0);
+        dir.add_cpu(1);
+        CHECK(find_cpu_clusters(dir.path()) == std::vector<uint64_t>{0x3});
+    }
+}
+
+TEST_CASE("CpuCounters___Read___CountsTheCallingThread") {
+    cpu_counters counters(events, 2);
+    CHECK(counters.num_events() == 2);
+    CHECK(counters.num_clusters() == 1);
+    CHECK(counters.size() == 2);
+
+    std::vector<uint64_t> values(counters.size());
+    if (!counters) {
+        // no PMU, e.g. in a virtual machine, or perf_event is not allowed
+        CHECK(counters.get_error() == make_error_code(errc::cpu_counters_unavailable));
+        CHECK(counters.read(values.data()) == make_error_code(errc::cpu_counters_unavailable));
+        CHECK(!counters.uses_rdpmc());
+        return;
+    }
+
+    REQUIRE(!counters.read(values.data()));
+    static_cast<void>(spin());
+    std::vector<uint64_t> later(counters.size());
+    REQUIRE(!counters.read(later.data()));
+    CHECK(later[1] > values[1]);
+}
+
+TEST_CASE("CpuCounters___Construct___RejectsNoEvents") {
+    cpu_counters counters(nullptr, 0);
+    CHECK(counters.get_error() == make_error_code(errc::cpu_counters_unavailable));
+}
+
+TEST_CASE("CombinedSampler___SampleNow___AppendsTheCpuValues") {
+    cpu_counters cpu(events, 2);
+    if (!cpu) {
+        return;
+    }
+
+    gpu_simulator_config sim_config{};
+    sim_config.sample_rate_hz = 10000;
+    gpu_simulator simulator(sim_config);
+    REQUIRE(simulator);
+    device::product_id pid{};
+    REQUIRE(!simulator.get_product_id(pid));
+    sampler_config config(pid, simulator.get_device_number());
+    REQUIRE(!config.add_counter(MaliGPUActiveCy));
+
+    sampler<gpu_simulator_policy> gpu(config);
+    REQUIRE(gpu);
+    basic_combined_sampler<gpu_simulator_policy> combined(gpu, cpu);
+
+    std::error_code ec;
+    const hwcpipe_counter counters[] = {MaliGPUActiveCy};
+    const auto list = gpu.make_read_list(counters, 1, ec);
+    REQUIRE(!ec);
+    REQUIRE(combined.values_per_sample(list) == 3);
+
+    REQUIRE(!combined.start_sampling());
+    static_cast<void>(spin());
+    REQUIRE(!combined.sample_now_for(1000000000));
+    CHECK(combined.get_sample_timestamp_end() == gpu.get_sample_timestamp_end());
+    CHECK(combined.get_cpu_timestamp() != 0);
+
+    std::vector<double> values(3);
+    REQUIRE(!combined.get_counter_values(list, values.data(), values.size()));
+    CHECK(values[0] != 0);
+    CHECK(values[2] == static_cast<double>(combined.get_cpu_values()[1]));
+    CHECK(values[2] > 0);
+    CHECK(combined.get_counter_values(list, values.data(), 2) == make_error_code(errc::invalid_read_list));
+
+    // the combined values go to the sinks that take a sampler
+    timeline_summary summary(combined.values_per_sample(list), 16, 2);
+    REQUIRE(!summary.push(combined, list));
+
+    REQUIRE(!combined.stop_sampling());
+}
+
+} // namespace hwcpipe
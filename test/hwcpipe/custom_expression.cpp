@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <catch2/catch.hpp>
+
+#include <hwcpipe/detail/custom_expression.hpp>
+#include <hwcpipe/detail/internal_types.hpp>
+#include <hwcpipe/error.hpp>
+#include <hwcpipe/hwcpipe_counter.h>
+
+#include <string>
+#include <system_error>
+#include <vector>
+
+namespace hwcpipe {
+namespace detail {
+namespace expression {
+
+namespace {
+const device_constants test_constants{16.0, 4.0, 2.0, 25.0, 50.0};
+
+double evaluate(const std::string &source, const std::vector<double> &inputs) {
+    custom_expression expression{};
+    auto ec = custom_expression::compile(source, expression);
+    REQUIRE(!ec);
+    REQUIRE(expression.get_dependencies().size() == inputs.size());
+    return expression.emit(test_constants).evaluate(inputs.data());
+}
+} // namespace
+
+TEST_CASE("CustomExpression___Compile___ResolvesCounterDependencies") {
+    custom_expression expression{};
+    auto ec = custom_expression::compile("MaliFragActiveCy / MaliGPUActiveCy + MaliFragActiveCy", expression);
+    REQUIRE(!ec);
+
+    const std::vector<hwcpipe_counter> expected{MaliFragActiveCy, MaliGPUActiveCy};
+    CHECK(expression.get_dependencies() == expected);
+}
+
+TEST_CASE("CustomExpression___Evaluate___FollowsOperatorPrecedence") {
+    CHECK(evaluate("1 + 2 * 3", {}) == 7.0);
+    CHECK(evaluate("(1 + 2) * 3", {}) == 9.0);
+    CHECK(evaluate("8 - 4 - 2", {}) == 2.0);
+    CHECK(evaluate("8 / 4 / 2", {}) == 1.0);
+    CHECK(evaluate("-2 * -3", {}) == 6.0);
+    CHECK(evaluate("1.5e1", {}) == 15.0);
+    CHECK(evaluate("MaliGPUActiveCy - MaliFragActiveCy * 2", {10.0, 3.0}) == 4.0);
+}
+
+TEST_CASE("CustomExpression___Evaluate___MinAndMaxAreVariadic") {
+    CHECK(evaluate("min(MaliGPUActiveCy, 3, MaliFragActiveCy)", {5.0, 4.0}) == 3.0);
+    CHECK(evaluate("max(MaliGPUActiveCy, 3, MaliFragActiveCy)", {5.0, 4.0}) == 5.0);
+    CHECK(evaluate("max(min(MaliGPUActiveCy, 2), 1) * 10", {5.0}) == 20.0);
+}
+
+TEST_CASE("CustomExpression___Evaluate___ZeroDividedByZeroIsZero") {
+    CHECK(evaluate("MaliFragActiveCy / MaliGPUActiveCy * 100", {0.0, 0.0}) == 0.0);
+}
+
+TEST_CASE("CustomExpression___Emit___FoldsLiteralsAndDeviceConstants") {
+    custom_expression expression{};
+
+    SECTION("Literals") {
+        REQUIRE(!custom_expression::compile("(1 + 2) * 3 / 9", expression));
+        const auto program = expression.emit(test_constants);
+        REQUIRE(program.get_code().size() == 1);
+        CHECK(program.get_code()[0].op == program::opcode::literal);
+        CHECK(program.evaluate(nullptr) == 1.0);
+    }
+
+    SECTION("Device constants") {
+        REQUIRE(!custom_expression::compile(
+            "MaliGPUActiveCy / (MaliConfigShaderCoreCount * MaliConfigL2CacheCount) + MaliConfigExtBusByteSize",
+            expression));
+        const auto program = expression.emit(test_constants);
+
+        // input, literal, div, literal, add
+        CHECK(program.get_code().size() == 5);
+        const double inputs[] = {80.0};
+        CHECK(program.evaluate(inputs) == 26.0);
+    }
+}
+
+TEST_CASE("CustomExpression___Compile___RejectsInvalidExpressions") {
+    custom_expression expression{};
+
+    auto source = GENERATE(as<std::string>(), "", "1 +", "(1 + 2", "1 2", "min(1)", "max()", "* 2", "1 $ 2",
+                           "MaliGPUActiveCy(1, 2)");
+    CAPTURE(source);
+
+    auto ec = custom_expression::compile(source, expression);
+    CHECK(ec == make_error_code(errc::invalid_expression));
+    CHECK(expression.get_dependencies().empty());
+}
+
+TEST_CASE("CustomExpression___Compile___RejectsUnknownCounters") {
+    custom_expression expression{};
+    auto ec = custom_expression::compile("MaliGPUActiveCy / MaliNotACounter", expression);
+    CHECK(ec == make_error_code(errc::unknown_counter));
+}
+
+TEST_CASE("CustomExpression___Compile___RejectsDeepExpressions") {
+    custom_expression expression{};
+
+    SECTION("Nesting") {
+        const std::string source = std::string(100, '(') + "1" + std::string(100, ')');
+        CHECK(custom_expression::compile(source, expression) == make_error_code(errc::invalid_expression));
+    }
+
+    SECTION("Stack depth") {
+        std::string source = "MaliGPUActiveCy";
+        for (size_t i = 0; i != program::max_stack_depth; ++i) {
+            source = "MaliGPUActiveCy - (" + source + ")";
+        }
+        CHECK(custom_expression::compile(source, expression) == make_error_code(errc::invalid_expression));
+    }
+}
+
+} // namespace expression
+} // namespace detail
+} // namespace hwcpipe
@@ -0,0 +1,370 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hwcpipe/hwcpipe_counter.h"
+
+#include <catch2/catch.hpp>
+
+#include <hwcpipe/detail/counter_database.hpp>
+#include <hwcpipe/detail/database_blob.hpp>
+#include <hwcpipe/error.hpp>
+#include <hwcpipe/gpu_simulator.hpp>
+#include <hwcpipe/sampler.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace hwcpipe {
+
+namespace {
+
+namespace layout = detail::database_blob_layout;
+using detail::expression::instruction;
+using detail::expression::opcode;
+
+/** A counter of a test blob. */
+struct test_record {
+    hwcpipe_counter counter;
+    detail::counter_definition::type tag;
+    detail::block_offset address;
+    std::vector<hwcpipe_counter> dependencies;
+    std::vector<instruction> code;
+};
+
+test_record hardware(hwcpipe_counter counter, detail::block_offset address) {
+    return {counter, detail::counter_definition::type::hardware, address, {}, {}};
+}
+
+test_record expression(hwcpipe_counter counter, std::vector<hwcpipe_counter> dependencies,
+                       std::vector<instruction> code) {
+    return {counter, detail::counter_definition::type::expression, {}, std::move(dependencies), std::move(code)};
+}
+
+/** Appends the bytes of @p value to @p bytes. */
+template <typename value_t>
+void append(std::vector<uint8_t> &bytes, const value_t &value) {
+    const auto *first = reinterpret_cast<const uint8_t *>(&value);
+    bytes.insert(bytes.end(), first, first + sizeof(value));
+}
+
+/** Writes a blob with the layout of the exporter script, in 8 byte words so that it's aligned. */
+std::vector<uint64_t> write_blob(const std::vector<std::pair<uint32_t, std::vector<test_record>>> &products,
+                                 const std::vector<double> &literals) {
+    std::vector<layout::product_entry> product_entries{};
+    std::vector<layout::record_entry> records{};
+    std::vector<instruction> instructions{};
+    std::vector<int32_t> dependencies{};
+    for (const auto &product : products) {
+        product_entries.push_back({product.first, static_cast<uint32_t>(records.size()),
+                                   static_cast<uint32_t>(product.second.size()), 0});
+        for (const auto &record : product.second) {
+            layout::record_entry entry{};
+            entry.counter = static_cast<uint32_t>(record.counter);
+            entry.tag = static_cast<uint8_t>(record.tag);
+            entry.offset = static_cast<uint16_t>(record.address.offset);
+            entry.shift = static_cast<uint8_t>(record.address.shift);
+            entry.block_type = static_cast<uint8_t>(record.address.block_type);
+            entry.num_dependencies = static_cast<uint8_t>(record.dependencies.size());
+            entry.num_instructions = static_cast<uint16_t>(record.code.size());
+            entry.first_dependency = static_cast<uint32_t>(dependencies.size());
+            entry.first_instruction = static_cast<uint32_t>(instructions.size());
+            records.push_back(entry);
+            for (auto dependency : record.dependencies) {
+                dependencies.push_back(static_cast<int32_t>(dependency));
+            }
+            instructions.insert(instructions.end(), record.code.begin(), record.code.end());
+        }
+    }
+
+    layout::header header{layout::magic,
+                          layout::version_major,
+                          layout::version_minor,
+                          0,
+                          static_cast<uint32_t>(product_entries.size()),
+                          static_cast<uint32_t>(records.size()),
+                          static_cast<uint32_t>(instructions.size()),
+                          static_cast<uint32_t>(literals.size()),
+                          static_cast<uint32_t>(dependencies.size())};
+    std::vector<uint8_t> bytes{};
+    append(bytes, header);
+    for (const auto &value : literals) {
+        append(bytes, value);
+    }
+    for (const auto &value : product_entries) {
+        append(bytes, value);
+    }
+    for (const auto &value : records) {
+        append(bytes, value);
+    }
+    for (const auto &value : instructions) {
+        append(bytes, value);
+    }
+    for (const auto &value : dependencies) {
+        append(bytes, value);
+    }
+
+    const auto size = static_cast<uint32_t>(bytes.size());
+    std::memcpy(bytes.data() + offsetof(layout::header, size), &size, sizeof(size));
+
+    std::vector<uint64_t> words((bytes.size() + 7) / 8);
+    std::memcpy(words.data(), bytes.data(), bytes.size());
+    return words;
+}
+
+detail::database_blob read_blob(const std::vector<uint64_t> &words, size_t size) {
+    return {words.data(), size};
+}
+
+size_t blob_size(const std::vector<uint64_t> &words) {
+    uint32_t size{};
+    std::memcpy(&size, reinterpret_cast<const uint8_t *>(words.data()) + offsetof(layout::header, size), sizeof(size));
+    return size;
+}
+
+detail::block_offset compiled_address(device::product_id pid, hwcpipe_counter counter) {
+    std::error_code ec{};
+    const auto definition = detail::counter_database{}.get_counter_def(pid, counter, ec);
+    REQUIRE(!ec);
+    return definition.get_address();
+}
+
+/**
+ * The records of a product with two hardware counters and two expressions:
+ *  - MaliFragUtil = min(100, MaliFragActiveCy * 100 / (MaliGPUActiveCy * MALI_CONFIG_SHADER_CORE_COUNT)),
+ *  - MaliCoreUtil = 100 - MaliFragUtil.
+ */
+std::vector<test_record> utilisation_records(device::product_id pid) {
+    return {
+        hardware(MaliFragActiveCy, compiled_address(pid, MaliFragActiveCy)),
+        expression(MaliFragUtil, {MaliFragActiveCy, MaliGPUActiveCy},
+                   {{opcode::literal, 0},
+                    {opcode::input, 0},
+                    {opcode::literal, 0},
+                    {opcode::mul, 0},
+                    {opcode::input, 1},
+                    {opcode::constant, static_cast<uint32_t>(detail::expression::device_constant::shader_core_count)},
+                    {opcode::mul, 0},
+                    {opcode::div, 0},
+                    {opcode::min, 2}}),
+        hardware(MaliGPUActiveCy, compiled_address(pid, MaliGPUActiveCy)),
+        expression(MaliCoreUtil, {MaliFragUtil}, {{opcode::literal, 0}, {opcode::input, 0}, {opcode::sub, 0}}),
+    };
+}
+
+/** The records of utilisation_records(), sorted by counter as a blob needs them. */
+std::vector<test_record> sorted(std::vector<test_record> records) {
+    std::sort(records.begin(), records.end(),
+              [](const test_record &lhs, const test_record &rhs) { return lhs.counter < rhs.counter; });
+    return records;
+}
+
+constexpr auto pid = device::product_id::g710;
+
+} // namespace
+
+TEST_CASE("DatabaseBlob___Construct___ValidatesTheBlob") {
+    const uint32_t key = detail::get_product_key(pid);
+    REQUIRE(key == 0xa002);
+    const auto records = sorted(utilisation_records(pid));
+    const auto words = write_blob({{key, records}}, {100.0});
+
+    SECTION("Valid") {
+        const auto blob = read_blob(words, blob_size(words));
+        REQUIRE(blob);
+        CHECK(blob.num_products() == 1);
+        CHECK(blob.size() == blob_size(words));
+    }
+    SECTION("Truncated") {
+        const auto blob = read_blob(words, blob_size(words) - 4);
+        CHECK(blob.get_error() == make_error_code(errc::invalid_database_blob));
+    }
+    SECTION("Other major version") {
+        auto other = words;
+        uint16_t version = layout::version_major + 1;
+        std::memcpy(reinterpret_cast<uint8_t *>(other.data()) + offsetof(layout::header, version_major), &version,
+                    sizeof(version));
+        CHECK(!read_blob(other, blob_size(other)));
+    }
+    SECTION("Unsorted records") {
+        const auto unsorted = write_blob({{key, utilisation_records(pid)}}, {100.0});
+        CHECK(!read_blob(unsorted, blob_size(unsorted)));
+    }
+    SECTION("Shift out of range") {
+        auto broken = records;
+        for (auto &record : broken) {
+            if (record.tag == detail::counter_definition::type::hardware) {
+                record.address.shift = 32;
+            }
+        }
+        const auto shifted = write_blob({{key, broken}}, {100.0});
+        const auto blob = read_blob(shifted, blob_size(shifted));
+        CHECK(blob.get_error() == make_error_code(errc::invalid_database_blob));
+    }
+    SECTION("Missing literal") {
+        const auto no_literals = write_blob({{key, records}}, {});
+        CHECK(!read_blob(no_literals, blob_size(no_literals)));
+    }
+    SECTION("Unbalanced bytecode") {
+        auto broken = records;
+        for (auto &record : broken) {
+            if (record.counter == MaliCoreUtil) {
+                record.code.pop_back();
+            }
+        }
+        const auto unbalanced = write_blob({{key, broken}}, {100.0});
+        CHECK(!read_blob(unbalanced, blob_size(unbalanced)));
+    }
+    SECTION("Missing dependency") {
+        auto broken = records;
+        broken.erase(std::find_if(broken.begin(), broken.end(),
+                                  [](const test_record &record) { return record.counter == MaliGPUActiveCy; }));
+        const auto missing = write_blob({{key, broken}}, {100.0});
+        CHECK(!read_blob(missing, blob_size(missing)));
+    }
+    SECTION("Cyclic dependencies") {
+        auto broken = records;
+        for (auto &record : broken) {
+            if (record.counter == MaliFragUtil) {
+                record.dependencies[1] = MaliCoreUtil;
+            }
+        }
+        const auto cyclic = write_blob({{key, broken}}, {100.0});
+        CHECK(!read_blob(cyclic, blob_size(cyclic)));
+    }
+}
+
+TEST_CASE("DatabaseBlob___GetCounterDef___ReadsInPlace") {
+    const auto words = write_blob({{detail::get_product_key(pid), sorted(utilisation_records(pid))}}, {100.0});
+    const auto blob = read_blob(words, blob_size(words));
+    REQUIRE(blob);
+
+    const layout::record_entry *begin{};
+    const layout::record_entry *end{};
+    REQUIRE(!blob.find_product(device::product_id::g76, begin, end));
+    REQUIRE(blob.find_product(pid, begin, end));
+    REQUIRE(end - begin == 4);
+    CHECK(detail::database_blob::find_record(begin, end, MaliGPUIRQActiveCy) == nullptr);
+
+    const auto *active = detail::database_blob::find_record(begin, end, MaliGPUActiveCy);
+    REQUIRE(active != nullptr);
+    const auto address = blob.get_counter_def(*active).get_address();
+    CHECK(address.offset == compiled_address(pid, MaliGPUActiveCy).offset);
+    CHECK(address.block_type == compiled_address(pid, MaliGPUActiveCy).block_type);
+
+    const auto *util = detail::database_blob::find_record(begin, end, MaliFragUtil);
+    REQUIRE(util != nullptr);
+    const auto definition = blob.get_counter_def(*util);
+    REQUIRE(definition.tag == detail::counter_definition::type::expression);
+    const auto &expression = definition.get_expression();
+    CHECK(expression.eval == nullptr);
+    REQUIRE(expression.dependencies.size() == 2);
+    CHECK(*expression.dependencies.begin() == MaliFragActiveCy);
+
+    // the bytecode points into the blob, and reads the device constants
+    CHECK(reinterpret_cast<const void *>(expression.code.code) >= static_cast<const void *>(words.data()));
+    detail::expression::device_constants constants{};
+    constants.shader_core_count = 4;
+    const double busy[] = {300, 100};
+    CHECK(detail::expression::evaluate(expression.code, busy, constants) == Approx(75.0));
+    const double saturated[] = {800, 100};
+    CHECK(detail::expression::evaluate(expression.code, saturated, constants) == Approx(100.0));
+    const double idle[] = {0, 0};
+    CHECK(detail::expression::evaluate(expression.code, idle, constants) == 0.0);
+}
+
+TEST_CASE("DatabaseBlob___UseBlob___OverridesTheProductsOfTheBlob") {
+    const auto words = write_blob({{detail::get_product_key(pid), sorted(utilisation_records(pid))}}, {100.0});
+    const auto blob = read_blob(words, blob_size(words));
+    REQUIRE(blob);
+
+    detail::counter_database db{};
+    const auto compiled_checksum = db.get_checksum(pid);
+    const auto other_checksum = db.get_checksum(device::product_id::g76);
+
+    detail::counter_database::use_blob(&blob);
+    std::vector<hwcpipe_counter> counters{};
+    for (auto counter : db.get_counters_for_gpu(pid)) {
+        counters.push_back(counter);
+    }
+    CHECK(counters == std::vector<hwcpipe_counter>{MaliCoreUtil, MaliFragActiveCy, MaliFragUtil, MaliGPUActiveCy});
+    CHECK(db.is_gpu_known(pid));
+    CHECK(db.get_checksum(pid) != compiled_checksum);
+
+    // the other products are still read from the compiled tables
+    CHECK(db.get_checksum(device::product_id::g76) == other_checksum);
+
+    std::error_code ec{};
+    const auto missing = db.get_counter_def(pid, MaliGPUIRQActiveCy, ec);
+    static_cast<void>(missing);
+    CHECK(ec == make_error_code(errc::invalid_counter_for_device));
+
+    detail::counter_database::use_blob(nullptr);
+    CHECK(db.get_checksum(pid) == compiled_checksum);
+}
+
+TEST_CASE("DatabaseBlob___LoadBlob___MapsTheFile") {
+    CHECK(detail::counter_database::load_blob("/nonexistent/counters.hwcdb") ==
+          make_error_code(errc::database_blob_unavailable));
+
+    const auto words = write_blob({{detail::get_product_key(pid), sorted(utilisation_records(pid))}}, {100.0});
+    const std::string path = "database_blob_test.hwcdb";
+    auto *file = std::fopen(path.c_str(), "wb");
+    REQUIRE(file != nullptr);
+    REQUIRE(std::fwrite(words.data(), 1, blob_size(words), file) == blob_size(words));
+    REQUIRE(std::fclose(file) == 0);
+
+    REQUIRE(!detail::counter_database::load_blob(path));
+    sampler_config config(pid, 0);
+    CHECK(!config.add_counter(MaliCoreUtil));
+    CHECK(config.add_counter(MaliGPUIRQActiveCy) == make_error_code(errc::invalid_counter_for_device));
+
+    detail::counter_database::use_blob(nullptr);
+    std::remove(path.c_str());
+}
+
+TEST_CASE("DatabaseBlob___Sampler___EvaluatesTheBytecode") {
+    gpu_simulator simulator(gpu_simulator_config{});
+    REQUIRE(simulator);
+    device::product_id sim_pid{};
+    REQUIRE(!simulator.get_product_id(sim_pid));
+
+    const auto words =
+        write_blob({{detail::get_product_key(sim_pid), sorted(utilisation_records(sim_pid))}}, {100.0});
+    const auto blob = read_blob(words, blob_size(words));
+    REQUIRE(blob);
+    detail::counter_database::use_blob(&blob);
+
+    sampler_config config(sim_pid, simulator.get_device_number());
+    REQUIRE(!config.add_counter(MaliCoreUtil));
+    detail::counter_database::use_blob(nullptr);
+
+    // the configuration copied the definitions, which still point into the blob
+    sampler<gpu_simulator_policy> sampler(config);
+    REQUIRE(sampler);
+    REQUIRE(!sampler.start_sampling());
+    REQUIRE(!sampler.sample_now());
+
+    counter_sample frag{};
+    counter_sample active{};
+    counter_sample core{};
+    REQUIRE(!sampler.get_counter_value(MaliFragActiveCy, frag));
+    REQUIRE(!sampler.get_counter_value(MaliGPUActiveCy, active));
+    REQUIRE(!sampler.get_counter_value(MaliCoreUtil, core));
+    REQUIRE(active.value.uint64 != 0);
+
+    const double cores = gpu_simulator_config{}.num_shader_cores;
+    const double util = std::min(100.0, static_cast<double>(frag.value.uint64) * 100.0 /
+                                            (static_cast<double>(active.value.uint64) * cores));
+    CHECK(core.value.float64 == Approx(100.0 - util));
+    REQUIRE(!sampler.stop_sampling());
+}
+
+} // namespace hwcpipe
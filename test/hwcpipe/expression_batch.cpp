@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "device/product_id.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <hwcpipe/column_evaluator.hpp>
+#include <hwcpipe/detail/counter_database.hpp>
+#include <hwcpipe/detail/internal_types.hpp>
+#include <hwcpipe/hwcpipe_counter.h>
+
+#include <cmath>
+#include <cstddef>
+#include <system_error>
+#include <vector>
+
+namespace hwcpipe {
+namespace detail {
+
+TEST_CASE("BatchEvaluator___EvaluatesEveryLane___MatchesFlatEvaluator") {
+    constexpr size_t num_lanes = 7;
+    const expression::device_constants constants{16.0, 4.0, 1048576.0, 25.0, 100.0 / 1048576.0};
+
+    auto pid = GENERATE(device::product_id::g31, device::product_id::g710, device::product_id::g725);
+
+    counter_database db{};
+    for (auto counter : db.get_counters_for_gpu(pid)) {
+        std::error_code ec;
+        auto definition = db.get_counter_def(pid, counter, ec);
+        REQUIRE(!ec);
+        if (definition.tag != counter_definition::type::expression) {
+            continue;
+        }
+
+        const auto &expression = definition.get_expression();
+        REQUIRE(expression.flat_eval != nullptr);
+        REQUIRE(expression.batch_eval != nullptr);
+
+        // operand-major inputs. Lane 0 is all zeros to exercise the 0 / 0 rule.
+        const auto num_inputs = expression.dependencies.size();
+        std::vector<std::vector<double>> columns(num_inputs, std::vector<double>(num_lanes));
+        std::vector<const double *> inputs(num_inputs);
+        for (size_t k = 0; k != num_inputs; ++k) {
+            for (size_t lane = 1; lane != num_lanes; ++lane) {
+                columns[k][lane] = static_cast<double>((lane * 7 + k * 13) % 11);
+            }
+            inputs[k] = columns[k].data();
+        }
+
+        std::vector<double> results(num_lanes);
+        expression.batch_eval(inputs.data(), num_lanes, constants, results.data());
+
+        std::vector<double> lane_inputs(num_inputs);
+        for (size_t lane = 0; lane != num_lanes; ++lane) {
+            for (size_t k = 0; k != num_inputs; ++k) {
+                lane_inputs[k] = columns[k][lane];
+            }
+            const double expected = expression.flat_eval(lane_inputs.data(), constants);
+
+            INFO("counter " << static_cast<int>(counter) << " lane " << lane);
+            if (std::isnan(expected)) {
+                REQUIRE(std::isnan(results[lane]));
+            } else {
+                REQUIRE(results[lane] == expected);
+            }
+        }
+    }
+}
+
+namespace {
+// a context whose counters have arbitrary, distinct values
+class counter_context : public expression::context {
+  public:
+    HWCP_NODISCARD double get_counter_value(hwcpipe_counter counter) const override { return value_of(counter); }
+    HWCP_NODISCARD double get_mali_config_ext_bus_byte_size() const override { return 16.0; }
+    HWCP_NODISCARD double get_mali_config_shader_core_count() const override { return 4.0; }
+    HWCP_NODISCARD double get_mali_config_l2_cache_count() const override { return 1048576.0; }
+
+    static double value_of(hwcpipe_counter counter) {
+        return static_cast<double>(static_cast<size_t>(counter) % 97 + 1);
+    }
+};
+} // namespace
+
+TEST_CASE("FlatEvaluator___EvaluatesEveryCounter___MatchesContextEvaluator") {
+    // the shared formula kernels read their operands in the order of the
+    // dependency tables, which must match the per counter evaluators
+    const expression::device_constants constants{16.0, 4.0, 1048576.0, 25.0, 100.0 / 1048576.0};
+    const counter_context context{};
+
+    auto pid = GENERATE(device::product_id::g31, device::product_id::g52, device::product_id::g78,
+                        device::product_id::g710, device::product_id::g725);
+
+    counter_database db{};
+    for (auto counter : db.get_counters_for_gpu(pid)) {
+        std::error_code ec;
+        auto definition = db.get_counter_def(pid, counter, ec);
+        REQUIRE(!ec);
+        if (definition.tag != counter_definition::type::expression) {
+            continue;
+        }
+
+        const auto &expression = definition.get_expression();
+        std::vector<double> inputs{};
+        for (auto dependency : expression.dependencies) {
+            inputs.push_back(counter_context::value_of(dependency));
+        }
+
+        const double expected = expression.eval(context);
+        const double result = expression.flat_eval(inputs.data(), constants);
+        INFO("counter " << static_cast<int>(counter));
+        if (std::isfinite(expected)) {
+            REQUIRE(result == Approx(expected));
+        } else {
+            REQUIRE(!std::isfinite(result));
+        }
+    }
+}
+
+} // namespace detail
+
+TEST_CASE("ColumnEvaluator___EvaluatesCounterOverSampleHistory") {
+    device::constants constants{};
+    constants.num_shader_cores = 4;
+
+    SECTION("Expression counter") {
+        // MaliTilerUtil = MaliTilerActiveCy / MaliGPUActiveCy * 100
+        column_evaluator evaluator(device::product_id::g31, constants, hwcpipe_counter::MaliTilerUtil);
+        REQUIRE(evaluator);
+
+        const auto &inputs = evaluator.get_inputs();
+        REQUIRE(inputs.size() == 2);
+
+        const std::vector<double> tiler_active{0.0, 1.0, 2.0, 3.0};
+        const std::vector<double> gpu_active{0.0, 4.0, 4.0, 4.0};
+        std::vector<const double *> columns;
+        for (auto input : inputs) {
+            REQUIRE((input == hwcpipe_counter::MaliTilerActiveCy || input == hwcpipe_counter::MaliGPUActiveCy));
+            columns.push_back(input == hwcpipe_counter::MaliTilerActiveCy ? tiler_active.data() : gpu_active.data());
+        }
+
+        std::vector<double> results(tiler_active.size());
+        REQUIRE(!evaluator.evaluate(columns.data(), columns.size(), results.size(), results.data()));
+        REQUIRE(results == std::vector<double>{0.0, 25.0, 50.0, 75.0});
+
+        REQUIRE(evaluator.evaluate(columns.data(), 1, results.size(), results.data()) ==
+                make_error_code(errc::invalid_read_list));
+    }
+
+    SECTION("Hardware counter") {
+        column_evaluator evaluator(device::product_id::g31, constants, hwcpipe_counter::MaliGPUActiveCy);
+        REQUIRE(evaluator);
+        REQUIRE(evaluator.get_inputs() == std::vector<hwcpipe_counter>{hwcpipe_counter::MaliGPUActiveCy});
+
+        const std::vector<double> gpu_active{1.0, 2.0};
+        const double *columns[] = {gpu_active.data()};
+        std::vector<double> results(gpu_active.size());
+        REQUIRE(!evaluator.evaluate(columns, 1, results.size(), results.data()));
+        REQUIRE(results == gpu_active);
+    }
+
+    SECTION("Counter not supported by the GPU") {
+        column_evaluator evaluator(device::product_id::g31, constants, hwcpipe_counter::MaliRTUUtil);
+        REQUIRE(!evaluator);
+        double result{};
+        REQUIRE(evaluator.evaluate(nullptr, 0, 1, &result) == make_error_code(errc::invalid_counter_for_device));
+    }
+}
+
+} // namespace hwcpipe
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <catch2/catch.hpp>
+
+#include <hwcpipe/detail/flat_set.hpp>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace hwcpipe {
+namespace detail {
+
+namespace {
+using set_type = flat_set<int, 4>;
+
+std::vector<int> values_of(const set_type &set) { return {set.begin(), set.end()}; }
+} // namespace
+
+TEST_CASE("FlatSet___Insert___KeepsTheValuesSortedAndUnique") {
+    set_type set{};
+    for (int value : {5, 1, 3, 1, 9, 7, 3, 0}) {
+        set.insert(value);
+    }
+
+    CHECK(values_of(set) == std::vector<int>{0, 1, 3, 5, 7, 9});
+    CHECK(set.count(3) == 1);
+    CHECK(set.count(4) == 0);
+    CHECK(set.find(9) == set.end() - 1);
+    CHECK(*set.rbegin() == 9);
+
+    const auto result = set.emplace(5);
+    CHECK(!result.second);
+    CHECK(*result.first == 5);
+    CHECK(set.size() == 6);
+}
+
+TEST_CASE("FlatSet___CopyAndMove___PreserveTheValues") {
+    // one set that fits the inline storage, and one that spilled to the heap
+    const auto count = GENERATE(3, 10);
+
+    set_type set{};
+    for (int i = count; i != 0; --i) {
+        set.insert(i);
+    }
+    const auto expected = values_of(set);
+
+    set_type copy{set};
+    CHECK(copy == set);
+
+    set_type moved{std::move(copy)};
+    CHECK(values_of(moved) == expected);
+    CHECK(copy.empty());
+
+    set_type assigned{};
+    assigned.insert(42);
+    assigned = moved;
+    CHECK(values_of(assigned) == expected);
+
+    assigned = std::move(moved);
+    CHECK(values_of(assigned) == expected);
+
+    assigned.insert(0);
+    CHECK(assigned != set);
+}
+
+} // namespace detail
+} // namespace hwcpipe
@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hwcpipe/hwcpipe_counter.h"
+
+#include <catch2/catch.hpp>
+
+#include <hwcpipe/error.hpp>
+#include <hwcpipe/flight_recorder.hpp>
+
+#include <csignal>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace hwcpipe {
+
+namespace {
+const hwcpipe_counter counters[] = {MaliGPUActiveCy, MaliFragActiveCy};
+
+std::string temporary_path(const char *name) {
+    return "/tmp/hwcpipe-" + std::to_string(::getpid()) + "-" + name + ".hwfr";
+}
+
+std::vector<char> read_file(const std::string &path) {
+    std::ifstream file(path, std::ios::binary);
+    return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+}
+
+/** Removes a file when the test ends. */
+class file_remover {
+  public:
+    explicit file_remover(std::string path)
+        : path_(std::move(path)) {}
+    ~file_remover() { std::remove(path_.c_str()); }
+
+  private:
+    std::string path_;
+};
+
+/** Records samples @p first to @p last, whose values are derived from their number. */
+void record_samples(flight_recorder &recorder, uint64_t first, uint64_t last) {
+    for (uint64_t i = first; i <= last; ++i) {
+        const double values[] = {static_cast<double>(i) * 10, static_cast<double>(i) + 0.5};
+        recorder.record(i * 1000, values);
+    }
+}
+
+/** Checks that @p reader recovered samples @p first to @p last. */
+void check_samples(const flight_record_reader &reader, uint64_t first, uint64_t last) {
+    REQUIRE(reader.num_records() == last - first + 1);
+    for (size_t i = 0; i != reader.num_records(); ++i) {
+        const uint64_t sample = first + i;
+        REQUIRE(reader.get_record(i).sequence == sample);
+        REQUIRE(reader.get_record(i).timestamp == sample * 1000);
+        REQUIRE(reader.get_value(i, 0) == static_cast<double>(sample) * 10);
+        REQUIRE(reader.get_value(i, 1) == static_cast<double>(sample) + 0.5);
+    }
+}
+} // namespace
+
+TEST_CASE("flight_recorder__KeepsTheLastSamples") {
+    const auto path = temporary_path("flight");
+    file_remover remover(path);
+
+    flight_recorder recorder(path, counters, 2, 8);
+    REQUIRE(recorder);
+    REQUIRE(recorder.size() == 2);
+    REQUIRE(recorder.capacity() == 8);
+
+    SECTION("Before the file wraps") {
+        record_samples(recorder, 1, 5);
+        const auto contents = read_file(path);
+        const flight_record_reader reader(contents.data(), contents.size());
+        REQUIRE(reader);
+        REQUIRE(reader.num_counters() == 2);
+        REQUIRE(reader.get_counter(1) == MaliFragActiveCy);
+        REQUIRE(reader.capacity() == 8);
+        check_samples(reader, 1, 5);
+    }
+
+    SECTION("After the file wraps") {
+        record_samples(recorder, 1, 21);
+        REQUIRE(recorder.num_records() == 21);
+        REQUIRE(!recorder.sync());
+
+        const flight_record_file file(path);
+        REQUIRE(file);
+        check_samples(file.get_reader(), 14, 21);
+    }
+
+    SECTION("Torn records end the tail") {
+        record_samples(recorder, 1, 21);
+        auto contents = read_file(path);
+        flight_layout::file_header header{};
+        std::memcpy(&header, contents.data(), sizeof(header));
+        const auto value_of = [&](uint64_t sample) {
+            const size_t slot = static_cast<size_t>((sample - 1) % header.capacity);
+            return contents.data() + header.records_offset + slot * header.record_size +
+                   sizeof(flight_layout::record_header);
+        };
+
+        // a sample that was being written when the process died
+        value_of(21)[0] ^= 1;
+        check_samples(flight_record_reader(contents.data(), contents.size()), 14, 20);
+
+        // an older corrupted sample cuts the run short
+        value_of(17)[3] ^= 1;
+        check_samples(flight_record_reader(contents.data(), contents.size()), 18, 20);
+    }
+}
+
+TEST_CASE("flight_recorder__SurvivesACrash") {
+    const auto path = temporary_path("flight-crash");
+    file_remover remover(path);
+
+    const pid_t child = ::fork();
+    REQUIRE(child >= 0);
+    if (child == 0) {
+        flight_recorder recorder(path, counters, 2, 16);
+        record_samples(recorder, 1, 40);
+        // nothing is flushed, unmapped or closed
+        ::raise(SIGKILL);
+    }
+
+    int status = 0;
+    REQUIRE(::waitpid(child, &status, 0) == child);
+    REQUIRE(WIFSIGNALED(status));
+
+    const flight_record_file file(path);
+    REQUIRE(file);
+    check_samples(file.get_reader(), 25, 40);
+}
+
+TEST_CASE("flight_recorder__Errors") {
+    SECTION("Unwritable path") {
+        flight_recorder recorder("/nonexistent/directory/gpu.hwfr", counters, 2, 8);
+        REQUIRE(recorder.get_error() == make_error_code(errc::trace_write_failed));
+        REQUIRE(recorder.sync() == make_error_code(errc::trace_write_failed));
+    }
+
+    SECTION("Unknown counter") {
+        const auto unknown = static_cast<hwcpipe_counter>(0xFFFFFF);
+        flight_recorder recorder(temporary_path("unknown"), &unknown, 1, 8);
+        REQUIRE(recorder.get_error() == make_error_code(errc::unknown_counter));
+    }
+
+    SECTION("Missing file") {
+        const flight_record_file file("/nonexistent/directory/gpu.hwfr");
+        REQUIRE(file.get_error() == make_error_code(errc::trace_read_failed));
+    }
+
+    SECTION("Invalid layout") {
+        const auto path = temporary_path("flight-layout");
+        file_remover remover(path);
+        { flight_recorder recorder(path, counters, 2, 8); }
+
+        auto contents = read_file(path);
+        REQUIRE(flight_record_reader(contents.data(), contents.size()));
+        REQUIRE(flight_record_reader(contents.data(), contents.size()).num_records() == 0);
+        REQUIRE(!flight_record_reader(contents.data(), contents.size() - 1));
+
+        contents[0] = 0;
+        REQUIRE(flight_record_reader(contents.data(), contents.size()).get_error() ==
+                make_error_code(errc::invalid_trace_layout));
+    }
+}
+
+} // namespace hwcpipe
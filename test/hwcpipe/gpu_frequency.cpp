@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <catch2/catch.hpp>
+
+#include <hwcpipe/error.hpp>
+#include <hwcpipe/gpu_frequency.hpp>
+
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+
+#include <sys/stat.h>
+
+namespace hwcpipe {
+
+namespace {
+
+/** A fake devfreq class directory, removed on destruction. */
+class fake_devfreq {
+  public:
+    fake_devfreq() {
+        char path[] = "/tmp/hwcpipe-devfreq-XXXXXX";
+        REQUIRE(::mkdtemp(path) != nullptr);
+        path_ = path;
+        ::mkdir((path_ + "/dmc").c_str(), 0755);
+        ::mkdir(device_path().c_str(), 0755);
+        set_frequency(800000000);
+        write("temp", "45000");
+    }
+
+    ~fake_devfreq() {
+        const std::string command = "rm -rf " + path_;
+        static_cast<void>(std::system(command.c_str()));
+    }
+
+    const std::string &path() const { return path_; }
+
+    std::string device_path() const { return path_ + "/13000000.mali"; }
+
+    /** Overwrites cur_freq in place, so that the open file sees it. */
+    void set_frequency(uint64_t hz) { write("13000000.mali/cur_freq", std::to_string(hz)); }
+
+    void write(const std::string &file, const std::string &contents) {
+        std::ofstream(path_ + "/" + file, std::ios::in | std::ios::out | std::ios::trunc) << contents << "\n";
+    }
+
+  private:
+    std::string path_;
+};
+
+/** A sample of 1 ms with @p gpu_cycles. */
+sample_interval make_interval(uint64_t gpu_cycles) { return {1000000, 2000000, gpu_cycles, 0}; }
+
+} // namespace
+
+TEST_CASE("GpuFrequency___FindDevfreq___FindsTheGpu") {
+    fake_devfreq devfreq;
+    CHECK(find_gpu_devfreq(devfreq.path()) == devfreq.device_path());
+    CHECK(find_gpu_devfreq(devfreq.path() + "/missing").empty());
+}
+
+TEST_CASE("GpuFrequency___Construct___NeedsCurFreq") {
+    gpu_frequency_config config{};
+    config.devfreq_path = "/nonexistent";
+    CHECK(gpu_frequency(config).get_error() == make_error_code(errc::frequency_unavailable));
+
+    fake_devfreq devfreq;
+    config.devfreq_path = devfreq.device_path();
+    config.thermal_path = devfreq.path() + "/missing";
+    CHECK(gpu_frequency(config).get_error() == make_error_code(errc::frequency_unavailable));
+}
+
+TEST_CASE("GpuFrequency___Update___ReadsDevfreqOnlyWhenNeeded") {
+    fake_devfreq devfreq;
+    gpu_frequency_config config{};
+    config.devfreq_path = devfreq.device_path();
+    config.thermal_path = devfreq.path() + "/temp";
+    gpu_frequency frequency(config);
+    REQUIRE(frequency);
+
+    // the first sample reads devfreq
+    REQUIRE(!frequency.update(make_interval(800000), true));
+    CHECK(frequency.num_devfreq_reads() == 1);
+    CHECK(frequency.get_reading().devfreq_read);
+    CHECK(frequency.get_reading().devfreq_hz == 800000000);
+    CHECK(frequency.get_reading().frequency_hz == Approx(800000000.0));
+    CHECK(frequency.get_reading().temperature == 45000);
+    CHECK(frequency.get_reading().timestamp_ns_end == 2000000);
+
+    // an estimate that agrees is used as is
+    REQUIRE(!frequency.update(make_interval(790000), true));
+    CHECK(frequency.num_devfreq_reads() == 1);
+    CHECK(!frequency.get_reading().devfreq_read);
+    CHECK(frequency.get_reading().frequency_hz == Approx(790000000.0));
+
+    SECTION("A frequency change is read from devfreq") {
+        devfreq.set_frequency(400000000);
+        REQUIRE(!frequency.update(make_interval(400000), true));
+        CHECK(frequency.num_devfreq_reads() == 2);
+        CHECK(frequency.get_reading().devfreq_hz == 400000000);
+        CHECK(frequency.get_reading().frequency_hz == Approx(400000000.0));
+    }
+
+    SECTION("An estimate that still disagrees reports devfreq") {
+        REQUIRE(!frequency.update(make_interval(200000), true));
+        CHECK(frequency.num_devfreq_reads() == 2);
+        CHECK(frequency.get_reading().estimated_hz == Approx(200000000.0));
+        CHECK(frequency.get_reading().frequency_hz == Approx(800000000.0));
+    }
+
+    SECTION("Without GPU cycles, devfreq is read every sample") {
+        REQUIRE(!frequency.update(make_interval(0), true));
+        REQUIRE(!frequency.update(make_interval(800000), false));
+        CHECK(frequency.num_devfreq_reads() == 3);
+        CHECK(frequency.get_reading().estimated_hz == 0.0);
+        CHECK(frequency.get_reading().frequency_hz == Approx(800000000.0));
+    }
+}
+
+} // namespace hwcpipe
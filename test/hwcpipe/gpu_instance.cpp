@@ -13,6 +13,7 @@
 
 #include <sstream>
 #include <system_error>
+#include <vector>
 
 namespace hwcpipe {
 
@@ -51,6 +52,63 @@ TEST_CASE("gpu_frontend") {
     }
 }
 
+TEST_CASE("find_gpus__ProbesLazilyAndCaches") {
+    std::vector<int> probed;
+    int num_checks = 0;
+    // there are no devices in the test environment, the gpus are invalid
+    const auto probe = [&](int device_number) {
+        probed.push_back(device_number);
+        return gpu(device_number);
+    };
+    const auto is_candidate = [&](int device_number) {
+        ++num_checks;
+        return device_number == 0 || device_number == 2;
+    };
+    detail::gpu_registry registry(probe, is_candidate);
+
+    size_t num_found = 0;
+    for (auto it = find_gpus(registry).begin(); it != find_gpus(registry).end(); ++it) {
+        ++num_found;
+    }
+    REQUIRE(num_found == 2);
+    REQUIRE(probed.empty());
+    const int checks_after_scan = num_checks;
+
+    SECTION("Devices are probed when dereferenced, once per process") {
+        std::vector<int> found;
+        for (const auto &device : find_gpus(registry)) {
+            found.push_back(device.get_device_number());
+        }
+        for (const auto &device : find_gpus(registry)) {
+            REQUIRE(!device.valid());
+        }
+        REQUIRE(found == std::vector<int>{0, 2});
+        REQUIRE(probed == std::vector<int>{0, 2});
+        REQUIRE(num_checks == checks_after_scan);
+    }
+
+    SECTION("Refresh searches and probes again") {
+        static_cast<void>(*find_gpus(registry).begin());
+        registry.refresh();
+
+        auto it = find_gpus(registry).begin();
+        REQUIRE(it->get_device_number() == 0);
+        REQUIRE(num_checks == checks_after_scan + 1);
+        REQUIRE(probed == std::vector<int>{0, 0});
+    }
+}
+
+TEST_CASE("find_gpus__ProbesCandidates__WhenDeviceNodesAreNotChecked") {
+    std::vector<int> probed;
+    detail::gpu_registry registry([&](int device_number) {
+        probed.push_back(device_number);
+        return gpu(device_number);
+    });
+
+    REQUIRE(find_gpus(registry).begin() == find_gpus(registry).end());
+    REQUIRE(probed.size() == detail::gpu_registry::max_device_number);
+}
+
 /*
 TEST_CASE("gpu_instance") {
     using gpu_instance = detail::gpu_instance_impl<mock_handle_factory, mock_instance_factory>;
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hwcpipe/hwcpipe_counter.h"
+
+#include <catch2/catch.hpp>
+
+#include <hwcpipe/error.hpp>
+#include <hwcpipe/gpu_simulator.hpp>
+#include <hwcpipe/sampler.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <system_error>
+
+namespace hwcpipe {
+
+namespace {
+
+using simulated_sampler = sampler<gpu_simulator_policy>;
+
+/** @return A config of the simulated GPU with a hardware and a shader core counter. */
+sampler_config make_config(const gpu_simulator &simulator, uint64_t period_ns) {
+    device::product_id pid{};
+    REQUIRE(!simulator.get_product_id(pid));
+    sampler_config config(pid, simulator.get_device_number());
+    REQUIRE(!config.add_counter(MaliGPUActiveCy));
+    REQUIRE(!config.add_counter(MaliFragActiveCy));
+    config.set_sampling_period(period_ns);
+    return config;
+}
+
+uint64_t value_of(const simulated_sampler &sampler, hwcpipe_counter counter) {
+    counter_sample sample{};
+    REQUIRE(!sampler.get_counter_value(counter, sample));
+    return sample.value.uint64;
+}
+
+} // namespace
+
+TEST_CASE("GpuSimulator___Construct___RegistersOncePerDevice") {
+    gpu_simulator first(gpu_simulator_config{}, 7);
+    REQUIRE(first);
+    CHECK(gpu_simulator::find(7) == &first);
+
+    gpu_simulator second(gpu_simulator_config{}, 7);
+    CHECK(second.get_error() == make_error_code(errc::invalid_device));
+    CHECK(gpu_simulator::find(7) == &first);
+
+    gpu_simulator_config no_cores{};
+    no_cores.num_shader_cores = 0;
+    CHECK(!gpu_simulator(no_cores, 8));
+}
+
+TEST_CASE("GpuSimulator___SampleNow___ReadsBlocksThroughTheReader") {
+    gpu_simulator_config sim_config{};
+    sim_config.num_shader_cores = GENERATE(4, 32);
+    sim_config.values_64bit = GENERATE(false, true);
+    sim_config.sample_rate_hz = 10000;
+    gpu_simulator simulator(sim_config);
+    REQUIRE(simulator);
+    CHECK(simulator.get_period_ns() == 100000);
+
+    auto config = make_config(simulator, 0);
+    config.set_per_instance_values(true);
+    simulated_sampler sampler(config);
+    REQUIRE(sampler);
+    REQUIRE(!sampler.start_sampling());
+
+    REQUIRE(!sampler.sample_now(42));
+    const auto interval = sampler.get_sample_interval();
+    CHECK(interval.duration_ns() == 100000);
+    CHECK(interval.gpu_cycles == 80000);
+    CHECK(sampler.get_sample_user_data() == 42);
+    CHECK(value_of(sampler, MaliGPUActiveCy) != 0);
+
+    const uint64_t *values{};
+    size_t num_instances{};
+    REQUIRE(!sampler.get_counter_instance_values(MaliFragActiveCy, values, num_instances));
+    REQUIRE(num_instances == sim_config.num_shader_cores);
+    // each shader core counts at its own rate
+    CHECK(values[1] > values[0]);
+
+    REQUIRE(!sampler.stop_sampling());
+}
+
+TEST_CASE("GpuSimulator___PeriodicSampling___LosesAndStretchesSamples") {
+    gpu_simulator_config sim_config{};
+    sim_config.drop_interval = 3;
+    sim_config.stretch_interval = 5;
+    gpu_simulator simulator(sim_config);
+    REQUIRE(simulator);
+
+    auto config = make_config(simulator, simulator.get_period_ns());
+    config.set_drop_policy(sampler_config::drop_policy::widen);
+    simulated_sampler sampler(config);
+    REQUIRE(sampler);
+    REQUIRE(!sampler.start_sampling());
+
+    // samples 3 and 6 are lost, sample 5 spans two periods
+    REQUIRE(!sampler.sample_now());
+    const uint64_t single = value_of(sampler, MaliGPUActiveCy);
+    REQUIRE(!sampler.sample_now());
+    REQUIRE(!sampler.sample_now());
+    CHECK(sampler.get_sample_interval().timestamp_ns_begin == 3 * simulator.get_period_ns());
+    REQUIRE(!sampler.sample_now());
+    CHECK(value_of(sampler, MaliGPUActiveCy) == 2 * single);
+    CHECK(sampler.get_dropped_samples() != 0);
+
+    REQUIRE(!sampler.stop_sampling());
+}
+
+TEST_CASE("GpuSimulator___PacedSampling___WaitsForThePeriod") {
+    gpu_simulator_config sim_config{};
+    // a period long enough for a loaded machine, whose missed periods are widened into the next sample
+    sim_config.sample_rate_hz = 100;
+    sim_config.paced = true;
+    gpu_simulator simulator(sim_config);
+    REQUIRE(simulator);
+
+    auto config = make_config(simulator, simulator.get_period_ns());
+    config.set_drop_policy(sampler_config::drop_policy::widen);
+    simulated_sampler sampler(config);
+    REQUIRE(sampler);
+    REQUIRE(!sampler.start_sampling());
+
+    // only the ordering is checked, as a late reader stretches its sample over several periods
+    REQUIRE(!sampler.sample_now());
+    const auto first = sampler.get_sample_interval();
+    REQUIRE(!sampler.sample_now());
+    const auto second = sampler.get_sample_interval();
+    CHECK(first.timestamp_ns_end > first.timestamp_ns_begin);
+    CHECK(second.timestamp_ns_begin == first.timestamp_ns_end);
+    CHECK(second.timestamp_ns_end > second.timestamp_ns_begin);
+
+    REQUIRE(!sampler.stop_sampling());
+}
+
+} // namespace hwcpipe
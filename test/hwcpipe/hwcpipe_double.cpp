@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Arm Limited.
+ * Copyright (c) 2023-2025 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  */
@@ -31,6 +31,23 @@ TEST_CASE("Test hwcpipe_double zero division") {
         REQUIRE(std::isinf(result));
     }
 
+    SECTION("test -0/0 division") {
+        detail::hwcpipe_double a{-0.0};
+        detail::hwcpipe_double b{0.0};
+
+        double result = a / b;
+
+        REQUIRE(result == 0.0);
+    }
+
+    SECTION("test 0/0 integer division") {
+        detail::hwcpipe_double a{0.0};
+
+        double result = a / 0;
+
+        REQUIRE(result == 0.0);
+    }
+
     SECTION("test 0/>0 division") {
         detail::hwcpipe_double a{0.0};
         detail::hwcpipe_double b{99.99};
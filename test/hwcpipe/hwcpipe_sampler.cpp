@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hwcpipe/error.hpp"
+#include "hwcpipe/hwcpipe_sampler.h"
+
+#include <catch2/catch.hpp>
+
+#include <string>
+
+namespace hwcpipe {
+
+namespace {
+
+// no GPU has this device number
+constexpr int missing_device = 1000;
+
+} // namespace
+
+TEST_CASE("HwcpipeSampler___Create___MissingDeviceFailsOnUse") {
+    hwcpipe_sampler *sampler = hwcpipe_sampler_create(missing_device);
+    REQUIRE(sampler != nullptr);
+    CHECK(std::string(hwcpipe_sampler_error_message(sampler)).empty());
+
+    const hwcpipe_counter counters[] = {MaliGPUActiveCy};
+    CHECK(hwcpipe_sampler_add_counters(sampler, counters, 1) != HWCPIPE_SAMPLER_SUCCESS);
+    CHECK(hwcpipe_sampler_num_counters(sampler) == 0);
+    CHECK(!std::string(hwcpipe_sampler_error_message(sampler)).empty());
+
+    CHECK(hwcpipe_sampler_start(sampler, 0) != 0);
+    CHECK(!std::string(hwcpipe_sampler_error_message(sampler)).empty());
+    hwcpipe_sampler_destroy(sampler);
+}
+
+TEST_CASE("HwcpipeSampler___Sample___FailsWhenNotStarted") {
+    hwcpipe_sampler *sampler = hwcpipe_sampler_create(missing_device);
+    REQUIRE(sampler != nullptr);
+
+    double values[1]{};
+    hwcpipe_sample_info info{};
+    CHECK(hwcpipe_sampler_sample(sampler, 0, values, 1, &info) == HWCPIPE_SAMPLER_ERROR_NOT_STARTED);
+    CHECK(hwcpipe_sampler_read(sampler, values, 1, nullptr) == HWCPIPE_SAMPLER_ERROR_NOT_STARTED);
+    CHECK(hwcpipe_sampler_stop(sampler, 0) == HWCPIPE_SAMPLER_ERROR_NOT_STARTED);
+    CHECK(std::string(hwcpipe_sampler_error_message(sampler)) ==
+          make_error_code(errc::sampling_not_started).message());
+
+    CHECK(hwcpipe_sampler_set_period(sampler, 1000000) == 0);
+    CHECK(std::string(hwcpipe_sampler_error_message(sampler)).empty());
+    hwcpipe_sampler_destroy(sampler);
+}
+
+TEST_CASE("HwcpipeSampler___Sample___ReadsTheSimulatedGpu") {
+    hwcpipe_sampler *sampler = hwcpipe_sampler_create_simulated(4);
+    REQUIRE(sampler != nullptr);
+
+    const hwcpipe_counter unknown[] = {static_cast<hwcpipe_counter>(0x7fffffff)};
+    CHECK(hwcpipe_sampler_add_counters(sampler, unknown, 1) == HWCPIPE_SAMPLER_ERROR_COUNTER);
+
+    const hwcpipe_counter counters[] = {MaliGPUActiveCy, MaliFragActiveCy};
+    REQUIRE(hwcpipe_sampler_add_counters(sampler, counters, 2) == HWCPIPE_SAMPLER_SUCCESS);
+    REQUIRE(hwcpipe_sampler_num_counters(sampler) == 2);
+
+    double values[2]{};
+    REQUIRE(hwcpipe_sampler_read(sampler, values, 2, nullptr) == HWCPIPE_SAMPLER_ERROR_NOT_STARTED);
+    REQUIRE(hwcpipe_sampler_start(sampler, 1) == HWCPIPE_SAMPLER_SUCCESS);
+    CHECK(hwcpipe_sampler_start(sampler, 1) == HWCPIPE_SAMPLER_ERROR_STARTED);
+    CHECK(hwcpipe_sampler_add_counters(sampler, counters, 1) == HWCPIPE_SAMPLER_ERROR_STARTED);
+
+    hwcpipe_sample_info first{};
+    REQUIRE(hwcpipe_sampler_sample(sampler, 2, values, 2, &first) == HWCPIPE_SAMPLER_SUCCESS);
+    CHECK(values[0] > 0);
+    CHECK(values[1] > 0);
+    CHECK(first.user_data == 2);
+    CHECK(first.timestamp_ns_end > first.timestamp_ns_begin);
+
+    hwcpipe_sample_info second{};
+    REQUIRE(hwcpipe_sampler_sample(sampler, 3, values, 2, &second) == HWCPIPE_SAMPLER_SUCCESS);
+    CHECK(second.user_data == 3);
+    CHECK(second.timestamp_ns_begin == first.timestamp_ns_end);
+
+    // the values of the last sample are read again
+    double again[2]{};
+    REQUIRE(hwcpipe_sampler_read(sampler, again, 2, nullptr) == HWCPIPE_SAMPLER_SUCCESS);
+    CHECK(again[0] == values[0]);
+    CHECK(again[1] == values[1]);
+    CHECK(hwcpipe_sampler_read(sampler, again, 1, nullptr) == HWCPIPE_SAMPLER_ERROR_BUFFER);
+    CHECK(std::string(hwcpipe_sampler_error_message(sampler)) == make_error_code(errc::invalid_read_list).message());
+
+    REQUIRE(hwcpipe_sampler_stop(sampler, 4) == HWCPIPE_SAMPLER_SUCCESS);
+    hwcpipe_sampler_destroy(sampler);
+}
+
+TEST_CASE("HwcpipeSampler___CreateSimulated___InvalidGpuFailsOnUse") {
+    hwcpipe_sampler *sampler = hwcpipe_sampler_create_simulated(0);
+    REQUIRE(sampler != nullptr);
+
+    const hwcpipe_counter counters[] = {MaliGPUActiveCy};
+    CHECK(hwcpipe_sampler_add_counters(sampler, counters, 1) != HWCPIPE_SAMPLER_SUCCESS);
+    CHECK(hwcpipe_sampler_start(sampler, 0) != HWCPIPE_SAMPLER_SUCCESS);
+    hwcpipe_sampler_destroy(sampler);
+}
+
+TEST_CASE("HwcpipeSampler___Destroy___AcceptsNull") { hwcpipe_sampler_destroy(nullptr); }
+
+} // namespace hwcpipe
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <catch2/catch.hpp>
+
+#include <hwcpipe/detail/kernel_dispatch.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace hwcpipe {
+namespace detail {
+
+TEST_CASE("kernel_dispatch__SelectedKernelsAreSupported") {
+    const auto &selected = select_decode_kernels();
+    REQUIRE(find_decode_kernels(selected.isa) == &selected);
+    REQUIRE(find_decode_kernels(kernel_isa::scalar) != nullptr);
+
+    const auto &features = get_cpu_features();
+    if (find_decode_kernels(kernel_isa::avx2) != nullptr) {
+        REQUIRE(features.avx2);
+        REQUIRE(selected.isa == kernel_isa::avx2);
+    }
+}
+
+TEST_CASE("kernel_dispatch__EveryVariant___MatchesScalar") {
+    const auto &scalar = *find_decode_kernels(kernel_isa::scalar);
+
+    // odd sizes exercise the scalar tails of the vector loops
+    const size_t count = GENERATE(0, 1, 3, 4, 7, 64, 67);
+    std::vector<uint32_t> values_32(count);
+    std::vector<uint64_t> values_64(count);
+    for (size_t i = 0; i != count; ++i) {
+        values_32[i] = static_cast<uint32_t>(0xFFFFFFF0U + i);
+        values_64[i] = (uint64_t{1} << 40U) + i;
+    }
+
+    for (size_t i = 0; i != num_kernel_isas; ++i) {
+        const auto *kernels = find_decode_kernels(static_cast<kernel_isa>(i));
+        if (kernels == nullptr) {
+            continue;
+        }
+        INFO(kernels->name << " kernels, " << count << " values");
+
+        std::vector<uint64_t> expected(count, 5);
+        std::vector<uint64_t> actual(count, 5);
+        scalar.reduce(values_32.data(), count, expected.data());
+        kernels->reduce(values_32.data(), count, actual.data());
+        REQUIRE(actual == expected);
+
+        scalar.reduce(values_64.data(), count, expected.data());
+        kernels->reduce(values_64.data(), count, actual.data());
+        REQUIRE(actual == expected);
+    }
+}
+
+} // namespace detail
+} // namespace hwcpipe
@@ -0,0 +1,244 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hwcpipe/counter_database.hpp"
+#include "hwcpipe/error.hpp"
+#include "hwcpipe/metrics_endpoint.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace hwcpipe {
+
+namespace {
+
+constexpr char scrape[] = "GET /metrics HTTP/1.1\r\nHost: device\r\nAccept: text/plain\r\n\r\n";
+
+/** A connected pair of stream sockets, closed on destruction. */
+struct socket_pair {
+    socket_pair() { REQUIRE(::socketpair(AF_UNIX, SOCK_STREAM, 0, fds) == 0); }
+    ~socket_pair() {
+        for (int fd : fds) {
+            if (fd >= 0) {
+                ::close(fd);
+            }
+        }
+    }
+
+    void request(const char *text) { REQUIRE(::write(fds[1], text, std::strlen(text)) == std::strlen(text)); }
+
+    /** Reads the response, up to the end of the connection or @p size bytes. */
+    std::string response(size_t size) {
+        std::string result(size, '\0');
+        size_t received = 0;
+        while (received != size) {
+            const ssize_t count = ::read(fds[1], &result[received], size - received);
+            REQUIRE(count > 0);
+            received += static_cast<size_t>(count);
+        }
+        return result;
+    }
+
+    int fds[2]{-1, -1};
+};
+
+/** @return The value of the metric @p name in the body of @p response. */
+std::string value_of(const std::string &response, const std::string &name) {
+    const auto line = response.find("\n" + name + " ");
+    REQUIRE(line != std::string::npos);
+    const auto begin = response.find_first_not_of(' ', line + name.size() + 2);
+    return response.substr(begin, response.find('\n', begin) - begin);
+}
+
+} // namespace
+
+TEST_CASE("metrics_endpoint__Scrape") {
+    socket_pair pair;
+    const hwcpipe_counter counters[] = {MaliGPUActiveCy, MaliFragActiveCy};
+    counter_metadata metadata{};
+    REQUIRE(!counter_database{}.describe_counter(MaliGPUActiveCy, metadata));
+
+    metrics_endpoint endpoint(counters, 2, metrics_endpoint_config{});
+    REQUIRE(endpoint.num_columns() == 2);
+    const size_t size = endpoint.response_size();
+
+    pair.request(scrape);
+    REQUIRE(!endpoint.serve(pair.fds[0]));
+    auto response = pair.response(size);
+    REQUIRE(response.compare(0, 17, "HTTP/1.1 200 OK\r\n") == 0);
+
+    const auto body = response.find("\r\n\r\n") + 4;
+    REQUIRE(response.find("Content-Length: " + std::to_string(size - body) + "\r\n") != std::string::npos);
+    REQUIRE(response.find(std::string("# HELP hwcpipe_gpu_active_cycles ") + metadata.name) != std::string::npos);
+    REQUIRE(response.find("# TYPE hwcpipe_gpu_active_cycles gauge\n") != std::string::npos);
+    REQUIRE(value_of(response, "hwcpipe_gpu_active_cycles") == "NaN");
+
+    const uint64_t values[] = {123456789012345ULL, 7};
+    endpoint.push(values);
+    pair.request(scrape);
+    REQUIRE(!endpoint.serve(pair.fds[0]));
+    response = pair.response(size);
+    REQUIRE(value_of(response, "hwcpipe_gpu_active_cycles") == "123456789012345");
+
+    const double derived[] = {0.25, -1e300};
+    endpoint.push(derived);
+    pair.request(scrape);
+    REQUIRE(!endpoint.serve(pair.fds[0]));
+    response = pair.response(size);
+    REQUIRE(value_of(response, "hwcpipe_gpu_active_cycles") == "0.25");
+    REQUIRE(endpoint.response_size() == size);
+
+    const auto stats = endpoint.get_stats();
+    REQUIRE(stats.samples == 2);
+    REQUIRE(stats.scrapes == 3);
+    REQUIRE(stats.bytes == 3 * size);
+}
+
+TEST_CASE("metrics_endpoint__LabelsAndColumns") {
+    socket_pair pair;
+    const hwcpipe_counter counters[] = {MaliGPUActiveCy, MaliFragActiveCy};
+    const size_t columns[] = {0};
+
+    metrics_endpoint_config config{};
+    config.metric_prefix = "mali_";
+    config.labels = "gpu=\"0\"";
+    config.columns = columns;
+    config.num_columns = 1;
+    metrics_endpoint endpoint(counters, 2, config);
+    REQUIRE(endpoint.num_columns() == 1);
+
+    const uint64_t values[] = {42, 43};
+    endpoint.push(values);
+    pair.request(scrape);
+    REQUIRE(!endpoint.serve(pair.fds[0]));
+    const auto response = pair.response(endpoint.response_size());
+    REQUIRE(value_of(response, "mali_gpu_active_cycles{gpu=\"0\"}") == "42");
+    REQUIRE(response.find("hwcpipe_") == std::string::npos);
+}
+
+TEST_CASE("metrics_endpoint__DuplicateNames") {
+    socket_pair pair;
+
+    SECTION("A counter listed twice is exposed once") {
+        const hwcpipe_counter counters[] = {MaliGPUActiveCy, MaliFragActiveCy, MaliGPUActiveCy};
+        const size_t columns[] = {0, 1, 0, 2};
+        metrics_endpoint_config config{};
+        config.columns = columns;
+        config.num_columns = 4;
+        metrics_endpoint endpoint(counters, 3, config);
+        REQUIRE(endpoint.num_columns() == 2);
+
+        const uint64_t values[] = {42, 43, 44};
+        endpoint.push(values);
+        pair.request(scrape);
+        REQUIRE(!endpoint.serve(pair.fds[0]));
+        const auto response = pair.response(endpoint.response_size());
+        REQUIRE(value_of(response, "hwcpipe_gpu_active_cycles") == "42");
+        const std::string type = "# TYPE hwcpipe_gpu_active_cycles";
+        REQUIRE(response.find(type) == response.rfind(type));
+    }
+
+    SECTION("Counters with the same metric name share a family") {
+        // two counters of the database have the same name
+        counter_metadata first{};
+        counter_metadata second{};
+        REQUIRE(!counter_database{}.describe_counter(MaliEngInstr, first));
+        REQUIRE(!counter_database{}.describe_counter(MaliEngArithInstr, second));
+        REQUIRE(std::string(first.name) == second.name);
+
+        const hwcpipe_counter counters[] = {MaliEngInstr, MaliGPUActiveCy, MaliEngArithInstr};
+        metrics_endpoint_config config{};
+        config.labels = "gpu=\"0\"";
+        metrics_endpoint endpoint(counters, 3, config);
+        REQUIRE(endpoint.num_columns() == 3);
+
+        const uint64_t values[] = {1, 2, 3};
+        endpoint.push(values);
+        pair.request(scrape);
+        REQUIRE(!endpoint.serve(pair.fds[0]));
+        const auto response = pair.response(endpoint.response_size());
+
+        const std::string name = "hwcpipe_arithmetic_instruction_issue_cycles";
+        const auto type = response.find("# TYPE " + name + " gauge\n");
+        REQUIRE(type != std::string::npos);
+        REQUIRE(response.find("# TYPE " + name, type + 1) == std::string::npos);
+        const auto first_label = "{gpu=\"0\",counter=\"" + std::to_string(static_cast<int>(MaliEngInstr)) + "\"}";
+        const auto second_label =
+            "{gpu=\"0\",counter=\"" + std::to_string(static_cast<int>(MaliEngArithInstr)) + "\"}";
+        REQUIRE(value_of(response, name + first_label) == "1");
+        REQUIRE(value_of(response, name + second_label) == "3");
+        REQUIRE(value_of(response, "hwcpipe_gpu_active_cycles{gpu=\"0\"}") == "2");
+
+        // the samples of a family follow its TYPE line
+        REQUIRE(response.find(name + second_label) < response.find("# TYPE hwcpipe_gpu_active_cycles"));
+    }
+}
+
+TEST_CASE("metrics_endpoint__RejectsOtherMethods") {
+    socket_pair pair;
+    const hwcpipe_counter counters[] = {MaliGPUActiveCy};
+    metrics_endpoint endpoint(counters, 1, metrics_endpoint_config{});
+
+    pair.request("POST /metrics HTTP/1.1\r\n\r\n");
+    REQUIRE(!endpoint.serve(pair.fds[0]));
+    REQUIRE(pair.response(32).compare(0, 32, "HTTP/1.1 405 Method Not Allowed\r") == 0);
+    REQUIRE(endpoint.get_stats().failed == 1);
+    REQUIRE(endpoint.get_stats().scrapes == 0);
+}
+
+TEST_CASE("metrics_endpoint__Listener") {
+    std::error_code ec;
+    const int listen_fd = metrics_endpoint::open_listener(0, ec);
+    REQUIRE(!ec);
+    REQUIRE(listen_fd >= 0);
+
+    sockaddr_in address{};
+    socklen_t length = sizeof(address);
+    REQUIRE(::getsockname(listen_fd, reinterpret_cast<sockaddr *>(&address), &length) == 0);
+    // only the loopback interface by default
+    REQUIRE(address.sin_addr.s_addr == htonl(INADDR_LOOPBACK));
+
+    // the connection waits in the backlog until it is accepted
+    const int client_fd = ::socket(AF_INET, SOCK_STREAM, 0);
+    REQUIRE(::connect(client_fd, reinterpret_cast<const sockaddr *>(&address), sizeof(address)) == 0);
+    REQUIRE(::write(client_fd, scrape, sizeof(scrape) - 1) == sizeof(scrape) - 1);
+
+    const hwcpipe_counter counters[] = {MaliGPUActiveCy};
+    metrics_endpoint endpoint(counters, 1, metrics_endpoint_config{});
+    REQUIRE(!endpoint.accept_and_serve(listen_fd));
+
+    std::string response;
+    char buffer[512];
+    ssize_t count = 0;
+    while ((count = ::read(client_fd, buffer, sizeof(buffer))) > 0) {
+        response.append(buffer, static_cast<size_t>(count));
+    }
+    REQUIRE(response.size() == endpoint.response_size());
+
+    ::close(client_fd);
+    ::close(listen_fd);
+}
+
+TEST_CASE("metrics_endpoint__ListenerErrors") {
+    std::error_code ec;
+    REQUIRE(metrics_endpoint::open_listener(0, ec, "localhost") == -1);
+    REQUIRE(ec == make_error_code(errc::metrics_listen_failed));
+
+    const hwcpipe_counter counters[] = {MaliGPUActiveCy};
+    metrics_endpoint endpoint(counters, 1, metrics_endpoint_config{});
+    REQUIRE(endpoint.accept_and_serve(-1) == make_error_code(errc::metrics_accept_failed));
+    REQUIRE(endpoint.get_stats().failed == 0);
+}
+
+} // namespace hwcpipe
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023-2024 Arm Limited.
+ * Copyright (c) 2023-2025 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  */
@@ -9,6 +9,7 @@
 #include "instance.hpp"
 #include "mock_helper.h"
 
+#include <device/hwcnt/features.hpp>
 #include <device/hwcnt/sampler/configuration.hpp>
 
 #include <memory>
@@ -20,23 +21,60 @@ namespace mock {
 class reader_mock {
   public:
     MOCK(bool, is_valid, ());
+    MOCK(bool, ready, ());
+    MOCK(std::error_code, ready_error, ());
+
+    std::error_code is_sample_ready(bool &is_ready) {
+        is_ready = ready();
+        return ready_error();
+    }
+
+    std::error_code is_sample_ready(bool &is_ready, uint64_t timeout_ns) {
+        last_timeout_ns = timeout_ns;
+        return is_sample_ready(is_ready);
+    }
+
+    device::hwcnt::features get_features() const { return features; }
+
+    int get_fd() const { return fd; }
+
+    static uint64_t last_timeout_ns;
+    /** The file descriptor of every reader. */
+    static int fd;
+    /** The features reported by every reader, restored by the tests that change them. */
+    static device::hwcnt::features features;
 };
 MOCK_DEFAULT_RET(bool, reader_mock, is_valid, true);
+MOCK_DEFAULT_RET(bool, reader_mock, ready, true);
+MOCK_DEFAULT_RET(std::error_code, reader_mock, ready_error, std::error_code{});
+uint64_t reader_mock::last_timeout_ns{};
+int reader_mock::fd{42};
+device::hwcnt::features reader_mock::features = [] {
+    device::hwcnt::features result{};
+    result.overflow_behavior_defined = true;
+    return result;
+}();
 
 class backend_manual_sampler_mock {
   public:
     backend_manual_sampler_mock(const instance_mock &inst,                                    //
                                 const hwcpipe::device::hwcnt::sampler::configuration *config, //
-                                size_t config_len) {}
+                                size_t config_len, uint32_t buffer_count = 0) {
+        ++num_constructed;
+    }
     MOCK(std::error_code, accumulation_start, ())
-    MOCK(std::error_code, accumulation_stop, (uint64_t user_data));
-    MOCK(std::error_code, request_sample, (uint64_t user_data));
+    MOCK_RECORD_ARG(std::error_code, accumulation_stop, uint64_t);
+    MOCK_RECORD_ARG(std::error_code, request_sample, uint64_t);
+    MOCK_RECORD_ARG(std::error_code, request_sample_async, uint64_t);
     MOCK(bool, valid, ());
 
     operator bool() { return valid(); }
 
     reader_mock &get_reader() { return reader_; }
 
+    /** The number of backend samplers created. */
+    static size_t num_constructed;
+
   private:
     reader_mock reader_;
 };
@@ -44,7 +82,12 @@ class backend_manual_sampler_mock {
 MOCK_DEFAULT_RET(std::error_code, backend_manual_sampler_mock, accumulation_start, std::error_code{});
 MOCK_DEFAULT_RET(std::error_code, backend_manual_sampler_mock, accumulation_stop, std::error_code{});
 MOCK_DEFAULT_RET(std::error_code, backend_manual_sampler_mock, request_sample, std::error_code{});
+MOCK_DEFAULT_RET(std::error_code, backend_manual_sampler_mock, request_sample_async, std::error_code{});
 MOCK_DEFAULT_RET(bool, backend_manual_sampler_mock, valid, true);
+MOCK_LAST_ARG(uint64_t, backend_manual_sampler_mock, accumulation_stop);
+MOCK_LAST_ARG(uint64_t, backend_manual_sampler_mock, request_sample);
+MOCK_LAST_ARG(uint64_t, backend_manual_sampler_mock, request_sample_async);
+size_t backend_manual_sampler_mock::num_constructed{};
 
 } // namespace mock
 } // namespace hwcpipe
@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include "backend_manual_sampler.hpp"
+#include "instance.hpp"
+#include "mock_helper.h"
+
+#include <device/hwcnt/sampler/configuration.hpp>
+
+#include <cstdint>
+#include <system_error>
+
+namespace hwcpipe {
+namespace mock {
+
+class backend_periodic_sampler_mock {
+  public:
+    backend_periodic_sampler_mock(const instance_mock &inst,                                    //
+                                  uint64_t period_ns,                                           //
+                                  const hwcpipe::device::hwcnt::sampler::configuration *config, //
+                                  size_t config_len, uint32_t buffer_count = 0) {}
+    MOCK_RECORD_ARG(std::error_code, sampling_start, uint64_t);
+    MOCK_RECORD_ARG(std::error_code, sampling_stop, uint64_t);
+    MOCK(bool, valid, ());
+
+    operator bool() { return valid(); }
+
+    reader_mock &get_reader() { return reader_; }
+
+  private:
+    reader_mock reader_;
+};
+
+MOCK_DEFAULT_RET(std::error_code, backend_periodic_sampler_mock, sampling_start, std::error_code{});
+MOCK_DEFAULT_RET(std::error_code, backend_periodic_sampler_mock, sampling_stop, std::error_code{});
+MOCK_DEFAULT_RET(bool, backend_periodic_sampler_mock, valid, true);
+MOCK_LAST_ARG(uint64_t, backend_periodic_sampler_mock, sampling_start);
+MOCK_LAST_ARG(uint64_t, backend_periodic_sampler_mock, sampling_stop);
+
+} // namespace mock
+} // namespace hwcpipe
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023-2024 Arm Limited.
+ * Copyright (c) 2023-2025 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  */
@@ -24,6 +24,8 @@ namespace hwcnt = device::hwcnt;
 struct block_metadata {
     hwcnt::block_type type;
     const void *values;
+    uint8_t index{};
+    hwcnt::block_state state{};
 };
 
 struct sample_flags {
@@ -39,6 +41,7 @@ struct sample_metadata {
     uint64_t timestamp_ns_end;
     uint64_t gpu_cycle;
     uint64_t sc_cycle;
+    uint32_t backlog;
 };
 
 class backend_sample_mock {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Arm Limited.
+ * Copyright (c) 2023-2025 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  */
@@ -22,21 +22,62 @@ using sample_values_type = device::hwcnt::sample_values_type;
 
 class block_extents_mock {
   public:
-    MOCK(sample_values_type, values_type, ());
+    MOCK(sample_values_type, values_type, () const);
+
+    /** @return The number of blocks of every type, a function-local static as the header may be included twice. */
+    static uint8_t &num_blocks() {
+        static uint8_t value = 4;
+        return value;
+    }
+    uint8_t num_blocks_of_type(device::hwcnt::block_type type) const { return num_blocks(); }
+
+    /** @return The number of counters of every block. */
+    static uint16_t &num_counters_per_block() {
+        static uint16_t value = 64;
+        return value;
+    }
+    uint16_t counters_per_block() const { return num_counters_per_block(); }
 };
 MOCK_DEFAULT_RET(sample_values_type, block_extents_mock, values_type, sample_values_type::uint32);
 
+/**
+ * Restores the block extents of the mock when it goes out of scope, so that a
+ * test that changes them and fails doesn't leak its extents to the next ones.
+ */
+class block_extents_guard {
+  public:
+    block_extents_guard() = default;
+
+    ~block_extents_guard() {
+        block_extents_mock::num_blocks() = num_blocks_;
+        block_extents_mock::num_counters_per_block() = num_counters_per_block_;
+        block_extents_mock::values_type_default_return_value = values_type_default_;
+        block_extents_mock::values_type_return_value = values_type_;
+    }
+
+    block_extents_guard(const block_extents_guard &) = delete;
+    block_extents_guard &operator=(const block_extents_guard &) = delete;
+
+  private:
+    uint8_t num_blocks_{block_extents_mock::num_blocks()};
+    uint16_t num_counters_per_block_{block_extents_mock::num_counters_per_block()};
+    sample_values_type values_type_default_{block_extents_mock::values_type_default_return_value};
+    sample_values_type values_type_{block_extents_mock::values_type_return_value};
+};
+
 class instance_mock {
   public:
     using instance_ptr = std::unique_ptr<instance_mock>;
 
     static bool return_valid_instance;
+    static size_t num_created;
 
     static instance_ptr create(handle_mock &hndl) {
         if (!return_valid_instance) {
             return_valid_instance = true;
             return nullptr;
         }
+        ++num_created;
         return std::make_unique<instance_mock>();
     }
 
@@ -47,6 +88,7 @@ class instance_mock {
 };
 
 bool instance_mock::return_valid_instance = true;
+size_t instance_mock::num_created = 0;
 
 MOCK_DEFAULT_RET(block_extents_mock, instance_mock, get_hwcnt_block_extents, {});
 MOCK_DEFAULT_RET(device::constants, instance_mock, get_constants, {});
@@ -27,6 +27,35 @@
         return ret_value;                                                                                              \
     }
 
+/**
+ * Same as MOCK(), for a function taking a single argument. The last argument
+ * is kept in FUNC_NAME##_last_arg, which must be defined with
+ * MOCK_LAST_ARG().
+ *
+ * @param RETURN_TYPE return type of mock function.
+ * @param FUNC_NAME function name.
+ * @param ARG_TYPE type of the argument.
+ */
+#define MOCK_RECORD_ARG(RETURN_TYPE, FUNC_NAME, ARG_TYPE)                                                              \
+    static ARG_TYPE FUNC_NAME##_last_arg;                                                                              \
+    static RETURN_TYPE FUNC_NAME##_default_return_value;                                                               \
+    static RETURN_TYPE FUNC_NAME##_return_value;                                                                       \
+    RETURN_TYPE FUNC_NAME(ARG_TYPE arg) {                                                                              \
+        FUNC_NAME##_last_arg = arg;                                                                                    \
+        RETURN_TYPE ret_value = FUNC_NAME##_return_value;                                                              \
+        FUNC_NAME##_return_value = FUNC_NAME##_default_return_value;                                                   \
+        return ret_value;                                                                                              \
+    }
+
+/**
+ * @param ARG_TYPE type of the argument of the mocked function.
+ * @param CLASS_NAME Name of the class containing the mocked function.
+ * @param FUNC_NAME function name.
+ * @note this funciton must be called in a file scope but not in a
+ *       class scope.
+ */
+#define MOCK_LAST_ARG(ARG_TYPE, CLASS_NAME, FUNC_NAME) ARG_TYPE CLASS_NAME::FUNC_NAME##_last_arg{}
+
 /**
  * @param RETURN_TYPE return type of mock function.
  * @param CLASS_NAME Name of the class containing the mocked function.
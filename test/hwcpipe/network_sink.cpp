@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hwcpipe/detail/column_codec.hpp"
+#include "hwcpipe/error.hpp"
+#include "hwcpipe/network_sink.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace hwcpipe {
+
+namespace {
+
+/** A connected pair of stream sockets, closed on destruction. */
+struct socket_pair {
+    socket_pair() { REQUIRE(::socketpair(AF_UNIX, SOCK_STREAM, 0, fds) == 0); }
+    ~socket_pair() {
+        for (int fd : fds) {
+            if (fd >= 0) {
+                ::close(fd);
+            }
+        }
+    }
+
+    /** Reads a frame from the receiving end. */
+    stream_protocol::frame_header receive(std::vector<uint8_t> &payload) {
+        stream_protocol::frame_header header{};
+        read(&header, sizeof(header));
+        REQUIRE(header.magic == stream_protocol::magic);
+        payload.resize(header.payload_size);
+        read(payload.data(), payload.size());
+        return header;
+    }
+
+    void read(void *data, size_t size) {
+        auto *bytes = static_cast<uint8_t *>(data);
+        while (size != 0) {
+            const ssize_t received = ::read(fds[1], bytes, size);
+            REQUIRE(received > 0);
+            bytes += received;
+            size -= static_cast<size_t>(received);
+        }
+    }
+
+    int fds[2]{-1, -1};
+};
+
+/** Decodes the columns of a frame of samples. */
+std::vector<std::vector<uint64_t>> decode(const stream_protocol::frame_header &header,
+                                          const std::vector<uint8_t> &payload) {
+    std::vector<std::vector<uint64_t>> columns(2 + header.num_columns, std::vector<uint64_t>(header.num_records));
+    const uint8_t *input = payload.data();
+    for (auto &column : columns) {
+        input = detail::column_codec::decode(input, payload.data() + payload.size(), column.size(), column.data());
+        REQUIRE(input != nullptr);
+    }
+    CHECK(input == payload.data() + payload.size());
+    return columns;
+}
+
+const hwcpipe_counter counters[] = {MaliGPUActiveCy, MaliFragActiveCy, MaliExtBusRdBy};
+
+} // namespace
+
+TEST_CASE("NetworkSink___Push___SendsFullFramesOfTheSelectedColumns") {
+    socket_pair sockets;
+    const size_t columns[] = {2, 0};
+    network_sink_config config{};
+    config.batch_size = 3;
+    config.flush_interval_ns = 0;
+    config.columns = columns;
+    config.num_columns = 2;
+    network_sink sink(sockets.fds[0], counters, 3, config);
+    REQUIRE(sink.num_columns() == 2);
+
+    for (uint64_t i = 0; i != 4; ++i) {
+        const uint64_t values[] = {i, 100, 1000 * i};
+        REQUIRE(!sink.push(i * 10, i * 10 + 10, values));
+    }
+    CHECK(sink.num_buffered() == 1);
+    CHECK(sink.get_stats().frames == 1);
+
+    std::vector<uint8_t> payload;
+    auto header = sockets.receive(payload);
+    REQUIRE(header.kind == stream_protocol::frame_schema);
+    REQUIRE(header.num_columns == 2);
+    std::vector<uint32_t> schema(2);
+    std::memcpy(schema.data(), payload.data(), payload.size());
+    CHECK(schema[0] == static_cast<uint32_t>(MaliExtBusRdBy));
+    CHECK(schema[1] == static_cast<uint32_t>(MaliGPUActiveCy));
+
+    header = sockets.receive(payload);
+    REQUIRE(header.kind == stream_protocol::frame_samples);
+    REQUIRE(header.num_records == 3);
+    auto frame = decode(header, payload);
+    CHECK(frame[0] == std::vector<uint64_t>{0, 10, 20});
+    CHECK(frame[1] == std::vector<uint64_t>{10, 20, 30});
+    CHECK(frame[2] == std::vector<uint64_t>{0, 1000, 2000});
+    CHECK(frame[3] == std::vector<uint64_t>{0, 1, 2});
+
+    REQUIRE(!sink.flush());
+    header = sockets.receive(payload);
+    REQUIRE(header.num_records == 1);
+    frame = decode(header, payload);
+    CHECK(frame[2] == std::vector<uint64_t>{3000});
+
+    CHECK(sink.get_stats().frames == 2);
+    CHECK(sink.get_stats().samples == 4);
+}
+
+TEST_CASE("NetworkSink___Push___FlushesAfterTheInterval") {
+    socket_pair sockets;
+    network_sink_config config{};
+    config.batch_size = 100;
+    config.flush_interval_ns = 25;
+    network_sink sink(sockets.fds[0], counters, 3, config);
+
+    const double values[] = {1.0, 2.0, 3.0};
+    REQUIRE(!sink.push(0, 10, values));
+    REQUIRE(!sink.push(10, 20, values));
+    CHECK(sink.num_buffered() == 2);
+    REQUIRE(!sink.push(20, 30, values));
+    CHECK(sink.num_buffered() == 0);
+
+    std::vector<uint8_t> payload;
+    sockets.receive(payload);
+    const auto header = sockets.receive(payload);
+    REQUIRE(header.num_records == 3);
+    CHECK(decode(header, payload)[4] == std::vector<uint64_t>{3, 3, 3});
+}
+
+TEST_CASE("NetworkSink___Push___SendsOnlyTheChangesBetweenKeyframes") {
+    socket_pair sockets;
+    const uint64_t thresholds[] = {0, 0, 10};
+    network_sink_config config{};
+    config.batch_size = 2;
+    config.flush_interval_ns = 0;
+    config.changes_only = true;
+    config.keyframe_interval = 3;
+    config.change_thresholds = thresholds;
+    network_sink sink(sockets.fds[0], counters, 3, config);
+
+    // column 0 changes every sample, column 1 stays at zero and column 2
+    // drifts by 6 per sample, so it is sent every other sample
+    for (uint64_t i = 0; i != 8; ++i) {
+        const uint64_t values[] = {i, 0, 100 + 6 * i};
+        REQUIRE(!sink.push(i * 10, i * 10 + 10, values));
+    }
+    CHECK(sink.get_stats().frames == 4);
+    CHECK(sink.get_stats().keyframes == 2);
+
+    std::vector<uint8_t> payload;
+    auto header = sockets.receive(payload);
+    REQUIRE(header.kind == stream_protocol::frame_schema);
+    header = sockets.receive(payload);
+    REQUIRE(header.kind == stream_protocol::frame_samples);
+    CHECK(decode(header, payload)[4] == std::vector<uint64_t>{100, 106});
+
+    // samples 2 and 3: the presence bitmaps, then the changed values
+    header = sockets.receive(payload);
+    REQUIRE(header.kind == stream_protocol::frame_changes);
+    REQUIRE(header.num_records == 2);
+    const uint8_t *input = payload.data();
+    const uint8_t *end = payload.data() + payload.size();
+    std::vector<uint64_t> timestamps(2);
+    input = detail::column_codec::decode(input, end, 2, timestamps.data());
+    input = detail::column_codec::decode(input, end, 2, timestamps.data());
+    REQUIRE(input != nullptr);
+    CHECK(timestamps == std::vector<uint64_t>{30, 40});
+    REQUIRE(end - input >= 2);
+    CHECK(input[0] == 0x1);
+    CHECK(input[1] == 0x5);
+    input += 2;
+    std::vector<uint64_t> changed(2);
+    input = detail::column_codec::decode(input, end, 2, changed.data());
+    REQUIRE(input != nullptr);
+    CHECK(changed == std::vector<uint64_t>{2, 3});
+    input = detail::column_codec::decode(input, end, 1, changed.data());
+    REQUIRE(input == end);
+    CHECK(changed[0] == 118);
+    CHECK(sink.get_stats().values_skipped == 6);
+
+    // every third frame is a keyframe again
+    header = sockets.receive(payload);
+    REQUIRE(header.kind == stream_protocol::frame_changes);
+    header = sockets.receive(payload);
+    REQUIRE(header.kind == stream_protocol::frame_samples);
+    CHECK(decode(header, payload)[2] == std::vector<uint64_t>{6, 7});
+}
+
+TEST_CASE("NetworkSink___Flush___FailsWhenThePeerIsGone") {
+    socket_pair sockets;
+    ::close(sockets.fds[1]);
+    sockets.fds[1] = -1;
+    network_sink sink(sockets.fds[0], counters, 3, {});
+
+    const uint64_t values[] = {1, 2, 3};
+    REQUIRE(!sink.push(0, 10, values));
+    CHECK(sink.flush() == make_error_code(errc::network_send_failed));
+    CHECK(sink.num_buffered() == 0);
+}
+
+} // namespace hwcpipe
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hwcpipe/hwcpipe_counter.h"
+
+#include <catch2/catch.hpp>
+
+#include <hwcpipe/error.hpp>
+#include <hwcpipe/gpu_simulator.hpp>
+#include <hwcpipe/on_demand_session.hpp>
+#include <hwcpipe/sampler.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <system_error>
+#include <thread>
+
+namespace hwcpipe {
+
+namespace {
+
+/** A session that counts its starts and stops, and takes a while to start. */
+struct fake_session {
+    int num_starts{};
+    int num_stops{};
+    bool started{true};
+    std::chrono::milliseconds start_time{0};
+    std::error_code start_error{};
+
+    std::error_code start_sampling() {
+        if (start_error) {
+            return start_error;
+        }
+        std::this_thread::sleep_for(start_time);
+        ++num_starts;
+        started = true;
+        return {};
+    }
+
+    std::error_code stop_sampling() {
+        ++num_stops;
+        started = false;
+        return {};
+    }
+};
+
+constexpr uint64_t ms = 1000000;
+
+} // namespace
+
+TEST_CASE("OnDemandSession___Update___PausesAfterTheLinger") {
+    fake_session session{};
+    on_demand_session<fake_session> on_demand(session, {10 * ms, 1000 * ms});
+
+    REQUIRE(!on_demand.update(1, 0));
+    CHECK(on_demand.is_running());
+
+    // the last consumer leaves
+    REQUIRE(!on_demand.update(0, 1 * ms));
+    REQUIRE(!on_demand.update(0, 5 * ms));
+    CHECK(on_demand.is_running());
+
+    SECTION("A consumer that comes back within the linger keeps the session") {
+        REQUIRE(!on_demand.update(1, 8 * ms));
+        REQUIRE(!on_demand.update(0, 12 * ms));
+        CHECK(on_demand.is_running());
+        CHECK(session.num_stops == 0);
+    }
+
+    SECTION("The session is paused, then resumed by a consumer") {
+        REQUIRE(!on_demand.update(0, 11 * ms));
+        CHECK(!on_demand.is_running());
+        CHECK(!session.started);
+        CHECK(on_demand.get_stats().num_pauses == 1);
+
+        REQUIRE(!on_demand.update(0, 100 * ms));
+        CHECK(session.num_stops == 1);
+
+        REQUIRE(!on_demand.update(2, 200 * ms));
+        CHECK(on_demand.is_running());
+        CHECK(session.started);
+        CHECK(on_demand.get_stats().num_resumes == 1);
+        CHECK(on_demand.get_stats().last_resume_latency_ns <= on_demand.get_stats().max_resume_latency_ns);
+        CHECK(on_demand.can_pause());
+    }
+}
+
+TEST_CASE("OnDemandSession___Update___BoundsTheResumeLatency") {
+    fake_session session{};
+    on_demand_session<fake_session> on_demand(session, {0, 1 * ms});
+
+    REQUIRE(!on_demand.update(0, 0));
+    REQUIRE(!on_demand.is_running());
+
+    SECTION("A failed resume keeps the session paused") {
+        session.start_error = make_error_code(errc::accumulation_start_failed);
+        CHECK(on_demand.update(1, 1) == make_error_code(errc::accumulation_start_failed));
+        CHECK(!on_demand.is_running());
+    }
+
+    SECTION("A slow resume disables the pauses") {
+        session.start_time = std::chrono::milliseconds(5);
+        REQUIRE(!on_demand.update(1, 1));
+        CHECK(on_demand.get_stats().last_resume_latency_ns >= 5 * ms);
+        CHECK(!on_demand.can_pause());
+
+        REQUIRE(!on_demand.update(0, 2));
+        REQUIRE(!on_demand.update(0, 1000 * ms));
+        CHECK(on_demand.is_running());
+        CHECK(session.num_stops == 1);
+    }
+}
+
+TEST_CASE("OnDemandSession___Update___ResumesASampler") {
+    gpu_simulator_config sim_config{};
+    sim_config.sample_rate_hz = 10000;
+    gpu_simulator simulator(sim_config);
+    REQUIRE(simulator);
+    device::product_id pid{};
+    REQUIRE(!simulator.get_product_id(pid));
+    sampler_config config(pid, simulator.get_device_number());
+    REQUIRE(!config.add_counter(MaliGPUActiveCy));
+
+    sampler<gpu_simulator_policy> sampler(config);
+    REQUIRE(sampler);
+    REQUIRE(!sampler.start_sampling());
+    REQUIRE(!sampler.sample_now());
+
+    on_demand_session<hwcpipe::sampler<gpu_simulator_policy>> on_demand(sampler, {0, 1000 * ms});
+    REQUIRE(!on_demand.update(0));
+    REQUIRE(!on_demand.is_running());
+    CHECK(sampler.sample_now() == make_error_code(errc::sampling_not_started));
+
+    REQUIRE(!on_demand.update(1));
+    REQUIRE(on_demand.is_running());
+    REQUIRE(!sampler.sample_now());
+    counter_sample sample{};
+    REQUIRE(!sampler.get_counter_value(MaliGPUActiveCy, sample));
+    CHECK(sample.value.uint64 != 0);
+    REQUIRE(!sampler.stop_sampling());
+}
+
+} // namespace hwcpipe
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "device/constants.hpp"
+#include "device/product_id.hpp"
+#include "hwcpipe/column_evaluator.hpp"
+#include "hwcpipe/error.hpp"
+#include "hwcpipe/hwcpipe_counter.h"
+#include "hwcpipe/parallel_evaluator.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace hwcpipe {
+
+namespace {
+
+/** The input columns of MaliTilerUtil, in the order of the evaluator. */
+struct tiler_util_columns {
+    explicit tiler_util_columns(const column_evaluator &evaluator, size_t count)
+        : tiler_active(count)
+        , gpu_active(count) {
+        for (size_t i = 0; i != count; ++i) {
+            tiler_active[i] = static_cast<double>(i % 7);
+            gpu_active[i] = static_cast<double>(8 + i % 5);
+        }
+        for (auto input : evaluator.get_inputs()) {
+            columns.push_back(input == hwcpipe_counter::MaliTilerActiveCy ? tiler_active.data() : gpu_active.data());
+        }
+    }
+
+    std::vector<double> tiler_active;
+    std::vector<double> gpu_active;
+    std::vector<const double *> columns{};
+};
+
+} // namespace
+
+TEST_CASE("ParallelColumnEvaluator__EvaluatesChunksInOrder") {
+    device::constants constants{};
+    constants.num_shader_cores = 4;
+    // MaliTilerUtil = MaliTilerActiveCy / MaliGPUActiveCy * 100
+    column_evaluator counter(device::product_id::g31, constants, hwcpipe_counter::MaliTilerUtil);
+    REQUIRE(counter);
+
+    constexpr size_t count = 1000;
+    const tiler_util_columns input(counter, count);
+
+    const size_t num_threads = GENERATE(size_t{1}, size_t{4});
+    parallel_column_evaluator evaluator(counter, num_threads, 64);
+    REQUIRE(evaluator);
+    REQUIRE(evaluator.num_threads() == num_threads);
+    REQUIRE(evaluator.get_inputs() == counter.get_inputs());
+
+    SECTION("Every sample is evaluated") {
+        std::vector<double> results(count);
+        REQUIRE(!evaluator.evaluate(input.columns.data(), input.columns.size(), count, results.data()));
+
+        std::vector<double> expected(count);
+        REQUIRE(!counter.evaluate(input.columns.data(), input.columns.size(), count, expected.data()));
+        REQUIRE(results == expected);
+    }
+
+    SECTION("Windows straddling chunks are stitched") {
+        // windows of 100 samples straddle most chunks of 64, windows of 10
+        // fit in them, and windows of 3 straddle a few
+        const size_t window = GENERATE(size_t{3}, size_t{10}, size_t{100}, size_t{1000});
+        const size_t num_windows = (count + window - 1) / window;
+        std::vector<double> results(num_windows);
+        REQUIRE(!evaluator.evaluate_windows(input.columns.data(), input.columns.size(), count, window,
+                                            results.data()));
+
+        for (size_t w = 0; w != num_windows; ++w) {
+            double tiler_active = 0;
+            double gpu_active = 0;
+            for (size_t i = w * window; i != std::min((w + 1) * window, count); ++i) {
+                tiler_active += input.tiler_active[i];
+                gpu_active += input.gpu_active[i];
+            }
+            INFO("window " << w);
+            REQUIRE(results[w] == Approx(tiler_active / gpu_active * 100));
+        }
+    }
+
+    SECTION("Invalid arguments") {
+        double result{};
+        REQUIRE(evaluator.evaluate(input.columns.data(), 1, 1, &result) == make_error_code(errc::invalid_read_list));
+        REQUIRE(evaluator.evaluate_windows(input.columns.data(), input.columns.size(), 1, 0, &result) ==
+                make_error_code(errc::invalid_read_list));
+        REQUIRE(!evaluator.evaluate(input.columns.data(), input.columns.size(), 0, &result));
+    }
+}
+
+TEST_CASE("ParallelColumnEvaluator__IsInvalid__WhenTheCounterIsNotSupported") {
+    device::constants constants{};
+    column_evaluator counter(device::product_id::g31, constants, hwcpipe_counter::MaliRTUUtil);
+    parallel_column_evaluator evaluator(counter, 2);
+    REQUIRE(!evaluator);
+    double result{};
+    REQUIRE(evaluator.evaluate(nullptr, 0, 1, &result) == make_error_code(errc::invalid_counter_for_device));
+}
+
+} // namespace hwcpipe
@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hwcpipe/counter_database.hpp"
+#include "hwcpipe/error.hpp"
+#include "hwcpipe/perfetto_writer.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <system_error>
+#include <vector>
+
+namespace hwcpipe {
+
+namespace {
+
+/** A decoded protobuf field. */
+struct field {
+    uint32_t number;
+    uint64_t value;
+    std::vector<uint8_t> bytes;
+
+    double as_double() const {
+        double result{};
+        std::memcpy(&result, &value, sizeof(result));
+        return result;
+    }
+    std::string as_string() const { return {bytes.begin(), bytes.end()}; }
+};
+
+uint64_t read_varint(const uint8_t *&data, const uint8_t *end) {
+    uint64_t value{};
+    for (uint32_t shift = 0; data != end; shift += 7) {
+        const uint8_t byte = *data++;
+        value |= static_cast<uint64_t>(byte & 0x7FU) << shift;
+        if ((byte & 0x80U) == 0) {
+            break;
+        }
+    }
+    return value;
+}
+
+/** Decodes the fields of a message. */
+std::vector<field> decode(const std::vector<uint8_t> &message) {
+    std::vector<field> fields;
+    const uint8_t *data = message.data();
+    const uint8_t *end = data + message.size();
+    while (data != end) {
+        const uint64_t tag = read_varint(data, end);
+        field current{static_cast<uint32_t>(tag >> 3U), 0, {}};
+        switch (tag & 7U) {
+        case 0:
+            current.value = read_varint(data, end);
+            break;
+        case 1:
+            for (size_t i = 0; i != 8; ++i) {
+                current.value |= static_cast<uint64_t>(data[i]) << (i * 8);
+            }
+            data += 8;
+            break;
+        case 2: {
+            const auto length = static_cast<size_t>(read_varint(data, end));
+            REQUIRE(length <= static_cast<size_t>(end - data));
+            current.bytes.assign(data, data + length);
+            data += length;
+            break;
+        }
+        default:
+            FAIL("unexpected wire type");
+        }
+        fields.push_back(current);
+    }
+    return fields;
+}
+
+/** @return The fields numbered @p number. */
+std::vector<field> find(const std::vector<field> &fields, uint32_t number) {
+    std::vector<field> result;
+    for (const auto &f : fields) {
+        if (f.number == number) {
+            result.push_back(f);
+        }
+    }
+    return result;
+}
+
+/** Collects the packets of a writer. */
+struct packet_sink {
+    void operator()(const uint8_t *data, size_t size) { packets.emplace_back(data, data + size); }
+
+    std::vector<std::vector<uint8_t>> packets;
+};
+
+/** Sampler stand-in for perfetto_writer::write_sample(sampler, list, sink). */
+struct sampler_stub {
+    std::error_code get_counter_values(int list, double *values, size_t count) const {
+        if (list < 0) {
+            return make_error_code(errc::invalid_read_list);
+        }
+        for (size_t i = 0; i != count; ++i) {
+            values[i] = static_cast<double>(i + 1);
+        }
+        return {};
+    }
+    uint64_t get_sample_timestamp() const { return 5000; }
+};
+
+const hwcpipe_counter counters[] = {MaliGPUActiveCy, MaliFragActiveCy};
+
+} // namespace
+
+TEST_CASE("PerfettoWriter___WriteDescriptors___NamesTheCounterTracks") {
+    perfetto_writer writer(counters, 2, {});
+    packet_sink sink;
+    REQUIRE(!writer.write_descriptors(sink));
+    REQUIRE(sink.packets.size() == 3);
+
+    const perfetto_writer_config config{};
+    const auto parent = decode(find(decode(sink.packets[0]), 60).at(0).bytes);
+    CHECK(find(parent, 1).at(0).value == config.uuid_base);
+    CHECK(find(parent, 2).at(0).as_string() == "Mali GPU");
+    CHECK(find(parent, 8).empty());
+
+    counter_database database{};
+    for (size_t i = 0; i != 2; ++i) {
+        counter_metadata metadata{};
+        REQUIRE(!database.describe_counter(counters[i], metadata));
+
+        const auto packet = decode(sink.packets[i + 1]);
+        CHECK(find(packet, 8).empty());
+        const auto track = decode(find(packet, 60).at(0).bytes);
+        CHECK(find(track, 1).at(0).value == writer.track_uuid(i));
+        CHECK(find(track, 2).at(0).as_string() == metadata.name);
+        CHECK(find(track, 5).at(0).value == config.uuid_base);
+        const auto counter = decode(find(track, 8).at(0).bytes);
+        CHECK(find(counter, 6).at(0).as_string() == metadata.units);
+    }
+}
+
+TEST_CASE("PerfettoWriter___WriteValues___BatchesTheValuesOfASample") {
+    perfetto_writer_config config{};
+    config.clock_id = perfetto_clock::boottime;
+    config.clock_offset_ns = -1000;
+    perfetto_writer writer(counters, 2, config);
+
+    packet_sink sink;
+    const double values[] = {10.0, 2.5};
+    writer.write_values(3000, values, sink);
+    REQUIRE(sink.packets.size() == 1);
+
+    const auto packet = decode(sink.packets[0]);
+    CHECK(find(packet, 8).at(0).value == 2000);
+    CHECK(find(packet, 58).at(0).value == perfetto_clock::boottime);
+    CHECK(find(packet, 10).empty());
+
+    const auto event = decode(find(packet, 11).at(0).bytes);
+    CHECK(find(event, 9).at(0).value == 4);
+    CHECK(find(event, 11).at(0).value == writer.track_uuid(0));
+    CHECK(find(event, 44).at(0).as_double() == 10.0);
+    CHECK(find(event, 45).at(0).value == writer.track_uuid(1));
+    CHECK(find(event, 46).at(0).as_double() == 2.5);
+}
+
+TEST_CASE("PerfettoWriter___WriteSample___WritesAPacketPerValue") {
+    perfetto_writer_config config{};
+    config.batching = perfetto_batching::packet_per_value;
+    perfetto_writer writer(counters, 2, config);
+
+    packet_sink sink;
+    REQUIRE(!writer.write_sample(sampler_stub{}, 0, sink));
+    REQUIRE(sink.packets.size() == 2);
+    CHECK(writer.write_sample(sampler_stub{}, -1, sink) == make_error_code(errc::invalid_read_list));
+
+    for (size_t i = 0; i != 2; ++i) {
+        const auto packet = decode(sink.packets[i]);
+        CHECK(find(packet, 8).at(0).value == 5000);
+        const auto event = decode(find(packet, 11).at(0).bytes);
+        CHECK(find(event, 11).at(0).value == writer.track_uuid(i));
+        CHECK(find(event, 44).at(0).as_double() == static_cast<double>(i + 1));
+        CHECK(find(event, 45).empty());
+    }
+}
+
+TEST_CASE("PerfettoWriter___WriteSample___FramesPacketsAsATrace") {
+    perfetto_writer_config config{};
+    config.framed = true;
+    config.sequence_id = 7;
+    perfetto_writer writer(counters, 2, config);
+
+    std::vector<uint8_t> trace;
+    const auto append = [&trace](const uint8_t *data, size_t size) { trace.insert(trace.end(), data, data + size); };
+    REQUIRE(!writer.write_descriptors(append));
+    const double values[] = {1.0, 2.0};
+    writer.write_sample(stream_sample{100, 200, values, 2, 1}, append);
+
+    const auto packets = decode(trace);
+    REQUIRE(packets.size() == 4);
+    for (const auto &packet : packets) {
+        CHECK(packet.number == 1);
+        CHECK(find(decode(packet.bytes), 10).at(0).value == 7);
+    }
+    CHECK(find(decode(packets[3].bytes), 8).at(0).value == 100);
+}
+
+} // namespace hwcpipe
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hwcpipe/error.hpp"
+#include "hwcpipe/region_profiler.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <system_error>
+
+namespace hwcpipe {
+
+namespace {
+
+/**
+ * Sampler stand-in for region_profiler. Each request takes a sample whose
+ * value is the time elapsed since the previous one.
+ */
+struct sampler_stub {
+    std::error_code request_sample_async(uint64_t user_data) {
+        pending.push_back({user_data, now - last});
+        last = now;
+        return request_error;
+    }
+
+    std::error_code collect_for(uint64_t) {
+        if (pending.empty()) {
+            return make_error_code(errc::sample_not_ready);
+        }
+        current = pending.front();
+        pending.pop_front();
+        return {};
+    }
+
+    std::error_code get_counter_values(int, double *values, size_t count) const {
+        if (count < 1) {
+            return make_error_code(errc::invalid_read_list);
+        }
+        values[0] = current.value;
+        return {};
+    }
+
+    uint64_t get_sample_user_data() const { return current.user_data; }
+
+    struct sample {
+        uint64_t user_data;
+        double value;
+    };
+
+    double now{};
+    double last{};
+    std::deque<sample> pending{};
+    sample current{};
+    std::error_code request_error{};
+};
+
+using profiler_t = region_profiler<sampler_stub, int>;
+
+void collect_all(profiler_t &profiler) {
+    while (!profiler.collect_for(0)) {
+    }
+}
+
+} // namespace
+
+TEST_CASE("RegionProfiler___Scopes___AttributeTheCountersToTheRegions") {
+    sampler_stub sampler{};
+    const int list = 0;
+    profiler_t profiler(sampler, list, 1);
+    const auto frame = profiler.add_region("frame");
+    const auto pass = profiler.add_region("pass");
+    REQUIRE(profiler.num_regions() == 2);
+
+    sampler.now = 5; // unattributed
+    {
+        profiler_t::scope frame_scope(profiler, frame);
+        sampler.now = 15;
+        for (int i = 0; i != 2; ++i) {
+            profiler_t::scope pass_scope(profiler, pass);
+            sampler.now += 20;
+        }
+        sampler.now += 1;
+    }
+    REQUIRE(sampler.pending.size() == 6);
+
+    // nothing is attributed until the samples are collected
+    REQUIRE(profiler.get_region(frame).calls == 0);
+    collect_all(profiler);
+    REQUIRE(profiler.collect_for(0) == make_error_code(errc::sample_not_ready));
+
+    const auto frame_totals = profiler.get_region(frame);
+    CHECK(frame_totals.name == std::string("frame"));
+    CHECK(frame_totals.calls == 1);
+    CHECK(frame_totals.num_values == 1);
+    CHECK(frame_totals.inclusive[0] == 51);
+    CHECK(frame_totals.exclusive[0] == 11);
+
+    const auto pass_totals = profiler.get_region(pass);
+    CHECK(pass_totals.calls == 2);
+    CHECK(pass_totals.inclusive[0] == 40);
+    CHECK(pass_totals.exclusive[0] == 40);
+    CHECK(!profiler.get_error());
+}
+
+TEST_CASE("RegionProfiler___RecursiveScopes___CountTheOutermostScopeOnce") {
+    sampler_stub sampler{};
+    const int list = 0;
+    profiler_t profiler(sampler, list, 1);
+    const auto region = profiler.add_region("recursive");
+
+    {
+        profiler_t::scope outer(profiler, region);
+        sampler.now = 10;
+        {
+            profiler_t::scope inner(profiler, region);
+            sampler.now = 30;
+        }
+        sampler.now = 35;
+    }
+    collect_all(profiler);
+
+    const auto totals = profiler.get_region(region);
+    CHECK(totals.calls == 2);
+    CHECK(totals.inclusive[0] == 35);
+    CHECK(totals.exclusive[0] == 35);
+}
+
+TEST_CASE("RegionProfiler___FailedRequest___IsReported") {
+    sampler_stub sampler{};
+    const int list = 0;
+    profiler_t profiler(sampler, list, 1);
+    const auto region = profiler.add_region("region");
+
+    sampler.request_error = make_error_code(errc::sample_collection_failure);
+    { profiler_t::scope scope(profiler, region); }
+    CHECK(profiler.get_error() == make_error_code(errc::sample_collection_failure));
+}
+
+} // namespace hwcpipe
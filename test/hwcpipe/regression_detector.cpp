@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hwcpipe/counter_statistics.hpp"
+#include "hwcpipe/error.hpp"
+#include "hwcpipe/regression_detector.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace hwcpipe {
+
+namespace {
+
+const hwcpipe_counter counters[] = {MaliGPUActiveCy, MaliFragActiveCy};
+
+/** The value of sample @p i of a counter that averages @p mean, give or take 5%. */
+double value(double mean, uint64_t i) { return mean * (1.0 + 0.05 * static_cast<double>(i % 3) - 0.05); }
+
+/** A baseline of @p count samples around 1000 and 200. */
+counter_statistics make_baseline(size_t count) {
+    counter_statistics baseline(counters, 2);
+    for (uint64_t i = 0; i != count; ++i) {
+        const double values[] = {value(1000, i), value(200, i)};
+        baseline.add(values);
+    }
+    return baseline;
+}
+
+/** Pushes @p count samples of a run around @p first and @p second, and returns how many flagged a counter. */
+size_t run(regression_detector &detector, uint64_t tag, size_t count, double first, double second) {
+    size_t flagged = 0;
+    for (uint64_t i = 0; i != count; ++i) {
+        const double values[] = {value(first, i), value(second, i)};
+        if (detector.push(tag, values)) {
+            ++flagged;
+        }
+    }
+    return flagged;
+}
+
+} // namespace
+
+TEST_CASE("regression_detector__Push") {
+    regression_detector detector(counters, 2);
+    REQUIRE(!detector.add_baseline(make_baseline(300)));
+
+    SECTION("A run like the baseline doesn't regress") {
+        CHECK(run(detector, 0, 1000, 1000, 200) == 0);
+        CHECK(!detector.regressed());
+        const auto *stats = detector.get_run_stats(0, 0);
+        REQUIRE(stats != nullptr);
+        CHECK(stats->count == 1000);
+        CHECK(stats->mean == Approx(1000).epsilon(0.001));
+    }
+    SECTION("A slower run is flagged early") {
+        CHECK(run(detector, 0, 50, 1000, 240) == 1);
+        REQUIRE(detector.num_findings() == 1);
+        const auto &finding = detector.get_finding(0);
+        CHECK(finding.counter == MaliFragActiveCy);
+        CHECK(finding.tag == 0);
+        CHECK(finding.samples < 10);
+        CHECK(finding.baseline_mean == Approx(200));
+        CHECK(finding.mean > 200);
+    }
+    SECTION("Improvements and changes below the effect size aren't regressions") {
+        CHECK(run(detector, 0, 1000, 900, 202) == 0);
+    }
+    SECTION("Either direction can regress") {
+        detector.set_direction(0, regression_direction::decrease);
+        CHECK(run(detector, 0, 100, 900, 200) == 1);
+        CHECK(detector.get_finding(0).counter == MaliGPUActiveCy);
+    }
+    SECTION("A shift late in the run is caught by the CUSUM") {
+        CHECK(run(detector, 0, 2000, 1000, 200) == 0);
+        CHECK(run(detector, 0, 20, 1000, 230) == 1);
+        CHECK(detector.get_finding(0).test == regression_test::cusum);
+        CHECK(detector.get_finding(0).samples < 2010);
+    }
+    SECTION("reset() starts another run") {
+        CHECK(run(detector, 0, 50, 1300, 200) == 1);
+        detector.reset();
+        CHECK(!detector.regressed());
+        CHECK(detector.get_run_stats(0, 0)->count == 0);
+    }
+}
+
+TEST_CASE("regression_detector__WelchTest") {
+    regression_detector_config config{};
+    config.cusum_threshold = 0;
+    regression_detector detector(counters, 2, config);
+    REQUIRE(!detector.add_baseline(make_baseline(300)));
+
+    // the mean needs min_samples samples
+    CHECK(run(detector, 0, 29, 1100, 200) == 0);
+    CHECK(run(detector, 0, 1, 1100, 200) == 1);
+    CHECK(detector.get_finding(0).test == regression_test::welch);
+    CHECK(detector.get_finding(0).samples == 30);
+    CHECK(detector.get_finding(0).statistic >= config.t_threshold);
+}
+
+TEST_CASE("regression_detector__Tags") {
+    regression_detector detector(counters, 2);
+    REQUIRE(!detector.add_baseline(make_baseline(300), 1, false));
+    REQUIRE(!detector.add_baseline(make_baseline(300), 2, false));
+
+    CHECK(run(detector, 3, 10, 1000, 200) == 0);
+    CHECK(detector.num_unmatched() == 10);
+    CHECK(detector.get_run_stats(3, 0) == nullptr);
+
+    CHECK(run(detector, 1, 100, 1000, 200) == 0);
+    CHECK(run(detector, 2, 100, 1300, 200) == 1);
+    CHECK(detector.get_finding(0).tag == 2);
+
+    const hwcpipe_counter other[] = {MaliFragQueueUtil};
+    const counter_statistics unrelated(other, 1);
+    CHECK(detector.add_baseline(unrelated) == make_error_code(errc::statistics_mismatch));
+}
+
+} // namespace hwcpipe
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <catch2/catch.hpp>
+
+#include <hwcpipe/error.hpp>
+#include <hwcpipe/runtime_pm.hpp>
+
+#include <cstdlib>
+#include <fstream>
+#include <string>
+
+#include <unistd.h>
+
+namespace hwcpipe {
+
+namespace {
+
+/** A fake runtime_status file, removed on destruction. */
+class fake_runtime_status {
+  public:
+    fake_runtime_status() {
+        char path[] = "/tmp/hwcpipe-runtime-status-XXXXXX";
+        const int fd = ::mkstemp(path);
+        REQUIRE(fd >= 0);
+        ::close(fd);
+        path_ = path;
+        set_state("active");
+    }
+
+    ~fake_runtime_status() { ::unlink(path_.c_str()); }
+
+    const std::string &path() const { return path_; }
+
+    /** Overwrites the state in place, so that the open file sees it. */
+    void set_state(const std::string &state) {
+        std::ofstream(path_, std::ios::in | std::ios::out | std::ios::trunc) << state << "\n";
+    }
+
+  private:
+    std::string path_;
+};
+
+} // namespace
+
+TEST_CASE("RuntimePm___StatusPath___NamesTheGpu") {
+    CHECK(runtime_pm_status_path() == "/sys/class/misc/mali0/device/power/runtime_status");
+    CHECK(runtime_pm_status_path(2) == "/sys/class/misc/mali2/device/power/runtime_status");
+}
+
+TEST_CASE("RuntimePm___Construct___NeedsTheStatusFile") {
+    const runtime_pm_probe probe("/nonexistent");
+    CHECK(!probe);
+    CHECK(probe.get_error() == make_error_code(errc::runtime_pm_unavailable));
+    CHECK(!probe.is_suspended());
+}
+
+TEST_CASE("RuntimePm___IsSuspended___ReadsTheState") {
+    fake_runtime_status status;
+    runtime_pm_probe probe(status.path());
+    REQUIRE(probe);
+    CHECK(!probe.is_suspended());
+
+    status.set_state("suspended");
+    CHECK(probe.is_suspended());
+    CHECK(runtime_pm_probe::probe(&probe));
+
+    status.set_state("suspending");
+    CHECK(probe.is_suspended());
+
+    status.set_state("resuming");
+    CHECK(!probe.is_suspended());
+
+    status.set_state("unsupported");
+    CHECK(!runtime_pm_probe::probe(&probe));
+}
+
+} // namespace hwcpipe
@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hwcpipe/error.hpp"
+#include "hwcpipe/sample_history.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <system_error>
+
+namespace hwcpipe {
+
+namespace {
+
+/** Pushes samples @p first to @p last, of 100 ns each, whose values are their number. */
+void push_range(sample_history &history, uint64_t first, uint64_t last) {
+    for (uint64_t i = first; i != last; ++i) {
+        const uint64_t values[2] = {i, i * 10};
+        history.push(i * 100, i * 100 + 100, values);
+    }
+}
+
+/** Sampler stand-in for sample_history::push(sampler, list). */
+struct sampler_stub {
+    std::error_code get_counter_values(int list, uint64_t *values, size_t count) const {
+        if (count < 2) {
+            return make_error_code(errc::invalid_read_list);
+        }
+        values[0] = static_cast<uint64_t>(list);
+        values[1] = static_cast<uint64_t>(list) + 1;
+        return {};
+    }
+    uint64_t get_sample_timestamp() const { return 1000; }
+    uint64_t get_sample_timestamp_end() const { return 2000; }
+};
+
+} // namespace
+
+TEST_CASE("sample_history__WindowSums") {
+    sample_history history(8, 2);
+    REQUIRE(history.capacity() == 8);
+    REQUIRE(history.values_per_sample() == 2);
+    uint64_t sums[2] = {1, 1};
+
+    SECTION("Empty history has empty windows") {
+        REQUIRE(history.window_sums(0, ~uint64_t{0}, sums).num_samples == 0);
+        REQUIRE(sums[0] == 0);
+        REQUIRE(history.newest_timestamp() == 0);
+    }
+
+    SECTION("Windows sum the samples they contain") {
+        push_range(history, 0, 5);
+        REQUIRE(history.size() == 5);
+        REQUIRE(history.oldest_timestamp() == 0);
+        REQUIRE(history.newest_timestamp() == 500);
+
+        auto window = history.window_sums(0, 500, sums);
+        REQUIRE(window.num_samples == 5);
+        REQUIRE(sums[0] == 0 + 1 + 2 + 3 + 4);
+        REQUIRE(sums[1] == 100);
+
+        // samples that are partly outside the window are left out
+        window = history.window_sums(150, 450, sums);
+        REQUIRE(window.num_samples == 2);
+        REQUIRE(window.timestamp_ns_begin == 200);
+        REQUIRE(window.timestamp_ns_end == 400);
+        REQUIRE(sums[0] == 2 + 3);
+
+        window = history.last_sums(200, sums);
+        REQUIRE(window.num_samples == 2);
+        REQUIRE(sums[0] == 3 + 4);
+
+        REQUIRE(history.window_sums(120, 180, sums).num_samples == 0);
+        REQUIRE(sums[1] == 0);
+    }
+
+    SECTION("Full history discards the oldest samples") {
+        push_range(history, 0, 20);
+        REQUIRE(history.size() == 8);
+        REQUIRE(history.oldest_timestamp() == 1200);
+
+        const auto window = history.window_sums(0, 2000, sums);
+        REQUIRE(window.num_samples == 8);
+        REQUIRE(window.timestamp_ns_begin == 1200);
+        REQUIRE(sums[0] == 12 + 13 + 14 + 15 + 16 + 17 + 18 + 19);
+
+        REQUIRE(history.window_sums(1500, 1700, sums).num_samples == 2);
+        REQUIRE(sums[1] == 150 + 160);
+
+        history.clear();
+        REQUIRE(history.size() == 0);
+        push_range(history, 3, 4);
+        REQUIRE(history.window_sums(0, 2000, sums).num_samples == 1);
+        REQUIRE(sums[0] == 3);
+    }
+
+    SECTION("Prefix sums may wrap") {
+        const uint64_t big[2] = {~uint64_t{0} - 1, 0};
+        const uint64_t small[2] = {5, 0};
+        history.push(0, 100, big);
+        history.push(100, 200, small);
+        history.push(200, 300, small);
+        REQUIRE(history.window_sums(100, 300, sums).num_samples == 2);
+        REQUIRE(sums[0] == 10);
+    }
+
+    SECTION("Samplers push their last sample") {
+        REQUIRE(!history.push(sampler_stub{}, 7));
+        REQUIRE(history.window_sums(1000, 2000, sums).num_samples == 1);
+        REQUIRE(sums[1] == 8);
+
+        sample_history narrow(2, 1);
+        REQUIRE(narrow.push(sampler_stub{}, 7) == make_error_code(errc::invalid_read_list));
+        REQUIRE(narrow.size() == 0);
+    }
+}
+
+TEST_CASE("sample_history__CompactStorage") {
+    sample_history wide(200, 2);
+    sample_history compact(200, 2, history_storage::compact);
+    REQUIRE(compact.storage() == history_storage::compact);
+    uint64_t expected[2]{};
+    uint64_t sums[2]{};
+
+    SECTION("Windows match the wide storage after the ring wraps") {
+        push_range(wide, 0, 500);
+        push_range(compact, 0, 500);
+        REQUIRE(compact.get_memory_footprint() < wide.get_memory_footprint());
+
+        const uint64_t bounds[][2] = {{0, 50000}, {30000, 50000}, {31234, 31299}, {30000, 49900}, {44400, 44500}};
+        for (const auto &bound : bounds) {
+            const auto window = compact.window_sums(bound[0], bound[1], sums);
+            REQUIRE(window.num_samples == wide.window_sums(bound[0], bound[1], expected).num_samples);
+            REQUIRE(sums[0] == expected[0]);
+            REQUIRE(sums[1] == expected[1]);
+        }
+
+        REQUIRE(compact.get_sample(123, sums).timestamp_ns_begin == 42300);
+        REQUIRE(sums[1] == 4230);
+    }
+
+    SECTION("Deltas that don't fit in 32 bits are kept aside") {
+        const uint64_t small[2] = {5, 1};
+        const uint64_t big[2] = {uint64_t{1} << 40, UINT32_MAX};
+        for (uint64_t i = 0; i != 300; ++i) {
+            compact.push(i * 100, i * 100 + 100, i % 7 == 0 ? big : small);
+            wide.push(i * 100, i * 100 + 100, i % 7 == 0 ? big : small);
+        }
+        for (uint64_t begin = 10000; begin < 30000; begin += 1300) {
+            REQUIRE(compact.window_sums(begin, 30000, sums).num_samples ==
+                    wide.window_sums(begin, 30000, expected).num_samples);
+            REQUIRE(sums[0] == expected[0]);
+            REQUIRE(sums[1] == expected[1]);
+        }
+        REQUIRE(compact.get_sample(194, sums).timestamp_ns_begin == 29400);
+        REQUIRE(sums[0] == big[0]);
+        REQUIRE(sums[1] == big[1]);
+    }
+}
+
+} // namespace hwcpipe
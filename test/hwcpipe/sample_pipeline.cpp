@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hwcpipe/hwcpipe_counter.h"
+
+#include <catch2/catch.hpp>
+
+#include <hwcpipe/error.hpp>
+#include <hwcpipe/gpu_simulator.hpp>
+#include <hwcpipe/sample_pipeline.hpp>
+#include <hwcpipe/sampler.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace hwcpipe {
+
+namespace {
+
+using simulated_sampler = sampler<gpu_simulator_policy>;
+using simulated_pipeline = sample_pipeline<simulated_sampler>;
+
+const hwcpipe_counter counters[] = {MaliGPUActiveCy, MaliFragActiveCy};
+
+/** @return A config of the simulated GPU with a hardware and a shader core counter. */
+sampler_config make_config(const gpu_simulator &simulator) {
+    device::product_id pid{};
+    REQUIRE(!simulator.get_product_id(pid));
+    sampler_config config(pid, simulator.get_device_number());
+    REQUIRE(!config.add_counter(MaliGPUActiveCy));
+    REQUIRE(!config.add_counter(MaliFragActiveCy));
+    return config;
+}
+
+/** The samples received by the callback, on the delivery thread. */
+struct received_samples {
+    std::vector<uint64_t> timestamps{};
+    std::vector<double> values{};
+    std::atomic<bool> blocked{};
+};
+
+void receive(void *user_data, const stream_sample &sample) {
+    auto &received = *static_cast<received_samples *>(user_data);
+    while (received.blocked.load()) {
+        std::this_thread::yield();
+    }
+    received.timestamps.push_back(sample.timestamp_ns_begin);
+    received.values.insert(received.values.end(), sample.values, sample.values + sample.num_values);
+}
+
+} // namespace
+
+TEST_CASE("SamplePipeline___Collect___DeliversTheDecodedSamplesInOrder") {
+    gpu_simulator_config sim_config{};
+    sim_config.num_shader_cores = 8;
+    gpu_simulator simulator(sim_config, 0);
+    gpu_simulator reference_simulator(sim_config, 1);
+    REQUIRE(simulator);
+    REQUIRE(reference_simulator);
+
+    const auto config = make_config(simulator);
+    simulated_sampler source(config);
+    REQUIRE(source);
+    received_samples received{};
+    sample_pipeline_config pipeline_config{};
+    pipeline_config.num_decode_workers = 3;
+    pipeline_config.staging_depth = 4;
+    simulated_pipeline pipeline(source, config, counters, 2, pipeline_config, receive, &received);
+    REQUIRE(pipeline);
+    CHECK(pipeline.num_decode_workers() == 3);
+
+    constexpr size_t num_samples = 200;
+    REQUIRE(!source.start_sampling());
+    for (size_t i = 0; i != num_samples;) {
+        const auto ec = pipeline.collect(source, i);
+        if (ec == make_error_code(errc::sample_not_ready)) {
+            std::this_thread::yield();
+            continue;
+        }
+        REQUIRE(!ec);
+        ++i;
+    }
+    REQUIRE(!source.stop_sampling());
+    pipeline.close();
+    CHECK(pipeline.collect(source) == make_error_code(errc::stream_closed));
+
+    // the same samples decoded by a sampler of their own
+    simulated_sampler reference(make_config(reference_simulator));
+    REQUIRE(!reference.start_sampling());
+    REQUIRE(received.timestamps.size() == num_samples);
+    for (size_t i = 0; i != num_samples; ++i) {
+        REQUIRE(!reference.sample_now(i));
+        counter_sample sample{};
+        REQUIRE(!reference.get_counter_value(MaliFragActiveCy, sample));
+        CHECK(received.timestamps[i] == reference.get_sample_timestamp());
+        CHECK(received.values[2 * i + 1] == static_cast<double>(sample.value.uint64));
+    }
+
+    const auto stats = pipeline.get_stats();
+    CHECK(stats.collect.samples == num_samples);
+    CHECK(stats.decode.samples == num_samples);
+    CHECK(stats.deliver.samples == num_samples);
+    CHECK(stats.decode.busy.count == num_samples);
+    CHECK(stats.rejected == 0);
+}
+
+TEST_CASE("SamplePipeline___Collect___LeavesTheSampleInTheKernelWhenTheStagesAreFull") {
+    gpu_simulator simulator(gpu_simulator_config{});
+    REQUIRE(simulator);
+    const auto config = make_config(simulator);
+    simulated_sampler source(config);
+    REQUIRE(source);
+
+    received_samples received{};
+    received.blocked = true;
+    sample_pipeline_config pipeline_config{};
+    pipeline_config.num_decode_workers = 1;
+    pipeline_config.staging_depth = 1;
+    pipeline_config.output_depth = 1;
+    simulated_pipeline pipeline(source, config, counters, 2, pipeline_config, receive, &received);
+    REQUIRE(pipeline);
+    REQUIRE(!source.start_sampling());
+
+    // the callback, the output ring and the staging ring each hold a sample
+    size_t collected = 0;
+    std::error_code ec;
+    for (size_t attempt = 0; attempt != 1000 && !ec; ++attempt) {
+        ec = pipeline.collect(source);
+        if (!ec) {
+            ++collected;
+        }
+        std::this_thread::yield();
+    }
+    CHECK(ec == make_error_code(errc::sample_not_ready));
+    CHECK(collected <= 3);
+    CHECK(pipeline.get_stats().collect.stalls == 1);
+
+    received.blocked = false;
+    pipeline.close();
+    CHECK(received.timestamps.size() == collected);
+}
+
+TEST_CASE("SamplePipeline___Construct___DecodesMergedSamplesOnOneWorker") {
+    gpu_simulator simulator(gpu_simulator_config{});
+    REQUIRE(simulator);
+    auto config = make_config(simulator);
+    config.set_coalesced_samples(4);
+    simulated_sampler source(config);
+    REQUIRE(source);
+
+    received_samples received{};
+    sample_pipeline_config pipeline_config{};
+    pipeline_config.num_decode_workers = 4;
+    simulated_pipeline pipeline(source, config, counters, 2, pipeline_config, receive, &received);
+    REQUIRE(pipeline);
+    CHECK(pipeline.num_decode_workers() == 1);
+
+    REQUIRE(!source.start_sampling());
+    for (size_t i = 0; i != 8;) {
+        if (!pipeline.collect(source)) {
+            ++i;
+        }
+    }
+    pipeline.close();
+    CHECK(received.timestamps.size() == 2);
+    CHECK(pipeline.get_stats().decode.samples == 2);
+}
+
+} // namespace hwcpipe
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hwcpipe/sample_ring.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+
+namespace hwcpipe {
+
+TEST_CASE("sample_ring__SingleThread") {
+    sample_ring ring(4, 2);
+    REQUIRE(ring.capacity() == 4);
+    REQUIRE(ring.values_per_sample() == 2);
+
+    uint64_t timestamp{};
+
+    SECTION("Empty ring has nothing to read") { REQUIRE(ring.acquire_read(timestamp) == nullptr); }
+
+    SECTION("Samples are read in publish order") {
+        for (uint64_t i = 0; i != 3; ++i) {
+            double *values = ring.acquire_write();
+            REQUIRE(values != nullptr);
+            values[0] = static_cast<double>(i);
+            values[1] = static_cast<double>(i * 10);
+            ring.publish(i + 100);
+        }
+
+        for (uint64_t i = 0; i != 3; ++i) {
+            const double *values = ring.acquire_read(timestamp);
+            REQUIRE(values != nullptr);
+            REQUIRE(timestamp == i + 100);
+            REQUIRE(values[0] == static_cast<double>(i));
+            REQUIRE(values[1] == static_cast<double>(i * 10));
+            ring.release();
+        }
+
+        REQUIRE(ring.acquire_read(timestamp) == nullptr);
+    }
+
+    SECTION("Full ring rejects writes until a slot is released") {
+        for (uint64_t i = 0; i != ring.capacity(); ++i) {
+            REQUIRE(ring.acquire_write() != nullptr);
+            ring.publish(i);
+        }
+        REQUIRE(ring.acquire_write() == nullptr);
+
+        REQUIRE(ring.acquire_read(timestamp) != nullptr);
+        REQUIRE(timestamp == 0);
+        ring.release();
+
+        REQUIRE(ring.acquire_write() != nullptr);
+    }
+}
+
+TEST_CASE("sample_ring__ProducerConsumer") {
+    static constexpr uint64_t num_samples = 100000;
+    sample_ring ring(8, 4);
+
+    std::thread producer([&ring]() {
+        for (uint64_t i = 0; i != num_samples;) {
+            double *values = ring.acquire_write();
+            if (values == nullptr) {
+                std::this_thread::yield();
+                continue;
+            }
+            for (size_t v = 0; v != ring.values_per_sample(); ++v) {
+                values[v] = static_cast<double>(i + v);
+            }
+            ring.publish(i);
+            ++i;
+        }
+    });
+
+    bool in_order = true;
+    for (uint64_t i = 0; i != num_samples;) {
+        uint64_t timestamp{};
+        const double *values = ring.acquire_read(timestamp);
+        if (values == nullptr) {
+            std::this_thread::yield();
+            continue;
+        }
+        in_order = in_order && timestamp == i && values[0] == static_cast<double>(i) &&
+                   values[3] == static_cast<double>(i + 3);
+        ring.release();
+        ++i;
+    }
+
+    producer.join();
+    REQUIRE(in_order);
+}
+
+} // namespace hwcpipe
@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hwcpipe/error.hpp"
+#include "hwcpipe/sample_stream.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace hwcpipe {
+
+namespace {
+
+/** The samples received by a callback. */
+struct received {
+    std::vector<stream_sample> samples{};
+    std::vector<double> values{};
+};
+
+void record(void *user_data, const stream_sample &sample) {
+    auto &dst = *static_cast<received *>(user_data);
+    dst.samples.push_back(sample);
+    dst.values.insert(dst.values.end(), sample.values, sample.values + sample.num_values);
+}
+
+/** Pushes samples @p first to @p last, whose values are their number. */
+void push_range(sample_stream &stream, uint64_t first, uint64_t last) {
+    for (uint64_t i = first; i != last; ++i) {
+        const double values[2] = {static_cast<double>(i), static_cast<double>(i * 10)};
+        REQUIRE(!stream.push(i * 100, i * 100 + 99, values));
+    }
+}
+
+/** Sampler stand-in for sample_stream::push(sampler, list). */
+struct sampler_stub {
+    std::error_code get_counter_values(int list, double *values, size_t count) const {
+        if (count < 2) {
+            return make_error_code(errc::invalid_read_list);
+        }
+        values[0] = list;
+        values[1] = list + 1;
+        return {};
+    }
+    uint64_t get_sample_timestamp() const { return 1000; }
+    uint64_t get_sample_timestamp_end() const { return 2000; }
+};
+
+} // namespace
+
+TEST_CASE("sample_stream__Policies") {
+    received out{};
+
+    SECTION("Samples are delivered in push order") {
+        sample_stream stream(4, 2, backpressure_policy::drop_newest, record, &out);
+        REQUIRE(stream.depth() == 4);
+        REQUIRE(stream.values_per_sample() == 2);
+        push_range(stream, 0, 3);
+        REQUIRE(stream.size() == 3);
+
+        REQUIRE(stream.dispatch() == 3);
+        REQUIRE(stream.dispatch() == 0);
+        REQUIRE(out.samples.size() == 3);
+        for (size_t i = 0; i != 3; ++i) {
+            REQUIRE(out.samples[i].timestamp_ns_begin == i * 100);
+            REQUIRE(out.samples[i].timestamp_ns_end == i * 100 + 99);
+            REQUIRE(out.samples[i].num_samples == 1);
+            REQUIRE(out.values[i * 2] == static_cast<double>(i));
+        }
+    }
+
+    SECTION("Drop oldest keeps the latest samples") {
+        sample_stream stream(2, 2, backpressure_policy::drop_oldest, record, &out);
+        push_range(stream, 0, 5);
+        REQUIRE(stream.dispatch() == 2);
+        REQUIRE(out.samples[0].timestamp_ns_begin == 300);
+        REQUIRE(out.samples[1].timestamp_ns_begin == 400);
+
+        const auto stats = stream.get_stats();
+        REQUIRE(stats.pushed == 5);
+        REQUIRE(stats.dropped == 3);
+        REQUIRE(stats.delivered == 2);
+    }
+
+    SECTION("Drop newest keeps the earliest samples") {
+        sample_stream stream(2, 2, backpressure_policy::drop_newest, record, &out);
+        push_range(stream, 0, 5);
+        REQUIRE(stream.dispatch() == 2);
+        REQUIRE(out.samples[0].timestamp_ns_begin == 0);
+        REQUIRE(out.samples[1].timestamp_ns_begin == 100);
+        REQUIRE(stream.get_stats().dropped == 3);
+    }
+
+    SECTION("Coalesce sums the late samples into the newest one") {
+        sample_stream stream(2, 2, backpressure_policy::coalesce, record, &out);
+        push_range(stream, 0, 5);
+        REQUIRE(stream.dispatch() == 2);
+        REQUIRE(out.samples[0].num_samples == 1);
+        REQUIRE(out.samples[1].num_samples == 4);
+        REQUIRE(out.samples[1].timestamp_ns_begin == 100);
+        REQUIRE(out.samples[1].timestamp_ns_end == 499);
+        REQUIRE(out.values[2] == 1 + 2 + 3 + 4);
+        REQUIRE(out.values[3] == 10 + 20 + 30 + 40);
+        REQUIRE(stream.get_stats().coalesced == 3);
+        REQUIRE(stream.get_stats().dropped == 0);
+    }
+
+    SECTION("Samplers push their last sample") {
+        sample_stream stream(2, 2, backpressure_policy::drop_newest, record, &out);
+        REQUIRE(!stream.push(sampler_stub{}, 7));
+        REQUIRE(stream.dispatch() == 1);
+        REQUIRE(out.samples[0].timestamp_ns_begin == 1000);
+        REQUIRE(out.samples[0].timestamp_ns_end == 2000);
+        REQUIRE(out.values[1] == 8);
+
+        sample_stream narrow(2, 1, backpressure_policy::drop_newest, record, &out);
+        REQUIRE(narrow.push(sampler_stub{}, 7) == make_error_code(errc::invalid_read_list));
+    }
+
+    SECTION("Closed stream rejects samples") {
+        sample_stream stream(2, 2, backpressure_policy::drop_newest, record, &out);
+        push_range(stream, 0, 1);
+        stream.close();
+        const double values[2] = {};
+        REQUIRE(stream.push(0, 0, values) == make_error_code(errc::stream_closed));
+
+        // the queued samples are still delivered
+        stream.run();
+        REQUIRE(out.samples.size() == 1);
+    }
+}
+
+TEST_CASE("sample_stream__BlockWaitsForTheConsumer") {
+    constexpr uint64_t num_samples = 1000;
+    received out{};
+    sample_stream stream(4, 2, backpressure_policy::block, record, &out);
+
+    std::thread consumer([&stream] { stream.run(); });
+    push_range(stream, 0, num_samples);
+    stream.close();
+    consumer.join();
+
+    REQUIRE(out.samples.size() == num_samples);
+    for (uint64_t i = 0; i != num_samples; ++i) {
+        REQUIRE(out.samples[i].timestamp_ns_begin == i * 100);
+        REQUIRE(out.values[i * 2 + 1] == static_cast<double>(i * 10));
+    }
+
+    const auto stats = stream.get_stats();
+    REQUIRE(stats.pushed == num_samples);
+    REQUIRE(stats.delivered == num_samples);
+    REQUIRE(stats.dropped == 0);
+}
+
+TEST_CASE("sample_stream__CloseReleasesABlockedProducer") {
+    received out{};
+    sample_stream stream(1, 2, backpressure_policy::block, record, &out);
+    push_range(stream, 0, 1);
+
+    std::error_code ec{};
+    std::thread producer([&stream, &ec] {
+        const double values[2] = {};
+        ec = stream.push(0, 0, values);
+    });
+    stream.close();
+    producer.join();
+    REQUIRE(ec == make_error_code(errc::stream_closed));
+}
+
+} // namespace hwcpipe
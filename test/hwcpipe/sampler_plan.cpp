@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hwcpipe/hwcpipe_counter.h"
+
+#include <catch2/catch.hpp>
+
+#include <hwcpipe/detail/counter_database.hpp>
+#include <hwcpipe/error.hpp>
+#include <hwcpipe/gpu_simulator.hpp>
+#include <hwcpipe/sampler.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace hwcpipe {
+
+namespace {
+
+constexpr auto pid = device::product_id::g710;
+
+/** @return A config with hardware, expression and block counters, and settings away from their defaults. */
+sampler_config make_config(device::product_id id) {
+    sampler_config config(id, 0);
+    REQUIRE(!config.add_counter(MaliGPUActiveCy));
+    REQUIRE(!config.add_counter(MaliFragQueueUtil));
+    REQUIRE(!config.add_block_counter(device::hwcnt::block_type::memory, 5));
+    config.set_expression_evaluation(sampler_config::expression_evaluation::eager);
+    config.set_sampling_period(1000000);
+    config.set_coalesced_samples(4);
+    REQUIRE(!config.set_multi_rate({MaliGPUActiveCy}, 10));
+    config.set_drop_policy(sampler_config::drop_policy::widen);
+    config.set_buffer_count(16);
+    config.set_session_recovery(3);
+    config.set_power_aware(true, 5);
+    config.set_clock_domain(clock_domain::boottime, 5000000);
+    REQUIRE(!config.set_trigger({MaliGPUActiveCy, trigger_condition::above, 1000.0}));
+    config.set_thread_config({0x0F, device::hwcnt::sampler::sched_class::batch, 5});
+    return config;
+}
+
+bool same_backend_config(const sampler_config &lhs, const sampler_config &rhs) {
+    const auto lhs_list = lhs.build_backend_config_list();
+    const auto rhs_list = rhs.build_backend_config_list();
+    if (lhs_list.size() != rhs_list.size()) {
+        return false;
+    }
+    for (size_t i = 0; i != lhs_list.size(); ++i) {
+        if (lhs_list[i].type != rhs_list[i].type || lhs_list[i].enable_map != rhs_list[i].enable_map) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+TEST_CASE("SamplerPlan___Checksum___IdentifiesTheGpu") {
+    detail::counter_database db{};
+    CHECK(db.get_checksum(pid) != 0);
+    CHECK(db.get_checksum(pid) == db.get_checksum(pid));
+    CHECK(db.get_checksum(pid) != db.get_checksum(device::product_id::g76));
+    CHECK(db.get_checksum(device::product_id::t60x) == 0);
+}
+
+TEST_CASE("SamplerPlan___LoadPlan___RestoresTheConfig") {
+    const auto config = make_config(pid);
+    std::vector<uint8_t> plan{};
+    REQUIRE(!config.save_plan(plan));
+
+    sampler_config loaded(pid, 0);
+    REQUIRE(!loaded.load_plan(plan.data(), plan.size()));
+
+    CHECK(loaded.get_valid_counters() == config.get_valid_counters());
+    for (const auto &registered : config.get_valid_counters()) {
+        const auto found = loaded.get_valid_counters().find(registered);
+        REQUIRE(found != loaded.get_valid_counters().end());
+        REQUIRE(found->definition.tag == registered.definition.tag);
+        if (registered.definition.tag == detail::counter_definition::type::hardware) {
+            CHECK(found->definition.get_address().offset == registered.definition.get_address().offset);
+            CHECK(found->definition.get_address().shift == registered.definition.get_address().shift);
+            CHECK(found->definition.get_address().block_type == registered.definition.get_address().block_type);
+        } else {
+            CHECK(found->definition.get_expression().eval == registered.definition.get_expression().eval);
+        }
+    }
+    CHECK(same_backend_config(loaded, config));
+    REQUIRE(loaded.get_block_counters().size() == 1);
+    CHECK(loaded.get_block_counters()[0].offset == 5);
+
+    CHECK(loaded.get_expression_evaluation() == sampler_config::expression_evaluation::eager);
+    CHECK(loaded.get_sampling_period() == 1000000);
+    CHECK(loaded.get_coalesced_samples() == 4);
+    CHECK(loaded.get_fast_counters() == std::vector<hwcpipe_counter>{MaliGPUActiveCy});
+    CHECK(loaded.get_slow_period() == 10);
+    CHECK(loaded.get_drop_policy() == sampler_config::drop_policy::widen);
+    CHECK(loaded.get_session_recovery() == 3);
+    CHECK(loaded.get_power_aware());
+    CHECK(loaded.get_max_skipped_dumps() == 5);
+    CHECK(loaded.get_buffer_count() == 16);
+    CHECK(loaded.get_clock_domain() == clock_domain::boottime);
+    CHECK(loaded.get_clock_calibration_interval() == 5000000);
+    REQUIRE(loaded.get_trigger() != nullptr);
+    CHECK(loaded.get_trigger()->counter == MaliGPUActiveCy);
+    CHECK(loaded.get_trigger()->threshold == 1000.0);
+    CHECK(loaded.get_thread_config().cpu_mask == 0x0F);
+    CHECK(loaded.get_thread_config().policy == device::hwcnt::sampler::sched_class::batch);
+    CHECK(loaded.get_thread_config().priority == 5);
+
+    // saving the loaded config gives the same plan
+    std::vector<uint8_t> again{};
+    REQUIRE(!loaded.save_plan(again));
+    CHECK(again == plan);
+}
+
+TEST_CASE("SamplerPlan___LoadPlan___RejectsForeignPlans") {
+    const auto config = make_config(pid);
+    std::vector<uint8_t> plan{};
+    REQUIRE(!config.save_plan(plan));
+
+    sampler_config loaded(pid, 0);
+    REQUIRE(!loaded.add_counter(MaliTilerUtil));
+    const auto before = loaded.get_valid_counters();
+    const auto invalid = make_error_code(errc::invalid_sampler_plan);
+
+    SECTION("Corrupted") {
+        plan[plan.size() / 2] ^= 0x10;
+        CHECK(loaded.load_plan(plan.data(), plan.size()) == invalid);
+    }
+
+    SECTION("Truncated") {
+        CHECK(loaded.load_plan(plan.data(), plan.size() - 1) == invalid);
+        CHECK(loaded.load_plan(plan.data(), 3) == invalid);
+    }
+
+    SECTION("Another GPU") {
+        sampler_config other(device::product_id::g610, 0);
+        CHECK(other.load_plan(plan.data(), plan.size()) == invalid);
+        CHECK(other.get_valid_counters().size() == 0);
+    }
+
+    CHECK(loaded.get_valid_counters() == before);
+}
+
+TEST_CASE("SamplerPlan___SavePlan___RejectsCustomCounters") {
+    sampler_config config(pid, 0);
+    size_t id{};
+    REQUIRE(!config.add_custom_counter("MaliGPUActiveCy * 2", id));
+    std::vector<uint8_t> plan{};
+    CHECK(config.save_plan(plan) == make_error_code(errc::sampler_config_invalid));
+}
+
+TEST_CASE("SamplerPlan___LoadPlan___BuildsASampler") {
+    gpu_simulator_config sim_config{};
+    sim_config.sample_rate_hz = 10000;
+    gpu_simulator simulator(sim_config);
+    REQUIRE(simulator);
+    device::product_id sim_pid{};
+    REQUIRE(!simulator.get_product_id(sim_pid));
+
+    sampler_config config(sim_pid, simulator.get_device_number());
+    REQUIRE(!config.add_counter(MaliGPUActiveCy));
+    REQUIRE(!config.add_counter(MaliFragQueueUtil));
+    std::vector<uint8_t> plan{};
+    REQUIRE(!config.save_plan(plan));
+
+    sampler_config loaded(sim_pid, simulator.get_device_number());
+    REQUIRE(!loaded.load_plan(plan.data(), plan.size()));
+    sampler<gpu_simulator_policy> sampler(loaded);
+    REQUIRE(sampler);
+    REQUIRE(!sampler.start_sampling());
+    REQUIRE(!sampler.sample_now());
+
+    counter_sample sample{};
+    REQUIRE(!sampler.get_counter_value(MaliGPUActiveCy, sample));
+    CHECK(sample.value.uint64 != 0);
+    REQUIRE(!sampler.get_counter_value(MaliFragQueueUtil, sample));
+    REQUIRE(!sampler.stop_sampling());
+}
+
+} // namespace hwcpipe
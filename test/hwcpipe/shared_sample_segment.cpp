@@ -0,0 +1,329 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <catch2/catch.hpp>
+
+#include <hwcpipe/error.hpp>
+#include <hwcpipe/hwcpipe_counter.h>
+#include <hwcpipe/sample_daemon.hpp>
+#include <hwcpipe/shared_sample_segment.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace hwcpipe {
+
+namespace {
+/** A read-only mapping of a segment, as an external reader would create it. */
+class reader_mapping {
+  public:
+    reader_mapping(int fd, size_t size)
+        : size_(size)
+        , address_(::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0)) {}
+    ~reader_mapping() {
+        if (address_ != MAP_FAILED) {
+            ::munmap(address_, size_);
+        }
+    }
+
+    const void *get() const { return address_ == MAP_FAILED ? nullptr : address_; }
+
+  private:
+    size_t size_;
+    void *address_;
+};
+} // namespace
+
+TEST_CASE("SharedSampleSegment__SingleProcess") {
+    const hwcpipe_counter counters[] = {MaliGPUActiveCy, MaliFragActiveCy, MaliTilerUtil};
+    shared_sample_exporter exporter(counters, 3);
+    REQUIRE(exporter);
+    REQUIRE(exporter.get_fd() >= 0);
+    REQUIRE(exporter.size() == 3);
+
+    reader_mapping mapping(exporter.get_fd(), exporter.get_segment_size());
+    REQUIRE(mapping.get() != nullptr);
+
+    shared_sample_reader reader(mapping.get(), exporter.get_segment_size());
+    REQUIRE(reader);
+    REQUIRE(reader.size() == 3);
+
+    SECTION("Counters are described") {
+        REQUIRE(reader.entry(0).counter == MaliGPUActiveCy);
+        REQUIRE(std::string(reader.entry(0).identifier) == "MaliGPUActiveCy");
+        REQUIRE(std::string(reader.entry(2).identifier) == "MaliTilerUtil");
+        REQUIRE(std::string(reader.entry(2).units) == "percent");
+        REQUIRE(std::strlen(reader.entry(1).name) != 0);
+    }
+
+    SECTION("Samples are read after they are published") {
+        double values[3]{};
+        uint64_t timestamp{};
+        uint64_t sample_count{};
+        REQUIRE(!reader.try_read(values, timestamp, sample_count));
+
+        const double published[] = {10.0, 20.0, 50.0};
+        exporter.publish(1234, published);
+        REQUIRE(reader.try_read(values, timestamp, sample_count));
+        REQUIRE(timestamp == 1234);
+        REQUIRE(sample_count == 1);
+        REQUIRE(values[0] == 10.0);
+        REQUIRE(values[1] == 20.0);
+        REQUIRE(values[2] == 50.0);
+    }
+}
+
+TEST_CASE("SharedSampleSegment__InvalidLayout") {
+    const hwcpipe_counter counters[] = {MaliGPUActiveCy};
+    shared_sample_exporter exporter(counters, 1);
+    REQUIRE(exporter);
+
+    std::vector<char> copy(exporter.get_segment_size());
+    std::memcpy(copy.data(), exporter.get_segment(), copy.size());
+    auto *header = reinterpret_cast<shared_layout::segment_header *>(copy.data());
+
+    SECTION("Truncated mapping") {
+        shared_sample_reader reader(copy.data(), sizeof(shared_layout::segment_header) - 1);
+        REQUIRE(reader.get_error() == make_error_code(errc::invalid_segment_layout));
+    }
+
+    SECTION("Wrong magic") {
+        header->magic = 0;
+        REQUIRE(!shared_sample_reader(copy.data(), copy.size()));
+    }
+
+    SECTION("Newer major version") {
+        header->version_major = shared_layout::version_major + 1;
+        REQUIRE(!shared_sample_reader(copy.data(), copy.size()));
+    }
+
+    SECTION("Values outside of the segment") {
+        header->values_offset = header->segment_size;
+        REQUIRE(!shared_sample_reader(copy.data(), copy.size()));
+    }
+
+    SECTION("Unknown counter") {
+        const auto unknown = static_cast<hwcpipe_counter>(~0U >> 1);
+        shared_sample_exporter invalid(&unknown, 1);
+        REQUIRE(invalid.get_error() == make_error_code(errc::unknown_counter));
+    }
+}
+
+TEST_CASE("SharedSampleSegment__HistoryRing") {
+    const hwcpipe_counter counters[] = {MaliGPUActiveCy, MaliFragActiveCy};
+    shared_sample_exporter exporter(counters, 2, 4);
+    REQUIRE(exporter);
+
+    shared_sample_reader reader(exporter.get_segment(), exporter.get_segment_size());
+    REQUIRE(reader);
+    REQUIRE(reader.ring_capacity() == 4);
+
+    double values[2]{};
+    uint64_t timestamp{};
+    REQUIRE(!reader.try_read_sample(1, values, timestamp));
+
+    for (uint64_t i = 1; i <= 6; ++i) {
+        const double published[] = {static_cast<double>(i), static_cast<double>(i * 10)};
+        exporter.publish(i * 100, published);
+    }
+    REQUIRE(reader.sample_count() == 6);
+
+    SECTION("The last samples are kept") {
+        for (uint64_t i = 3; i <= 6; ++i) {
+            REQUIRE(reader.try_read_sample(i, values, timestamp));
+            REQUIRE(timestamp == i * 100);
+            REQUIRE(values[0] == static_cast<double>(i));
+            REQUIRE(values[1] == static_cast<double>(i * 10));
+        }
+    }
+
+    SECTION("Overwritten and future samples are not read") {
+        REQUIRE(!reader.try_read_sample(0, values, timestamp));
+        REQUIRE(!reader.try_read_sample(2, values, timestamp));
+        REQUIRE(!reader.try_read_sample(7, values, timestamp));
+    }
+
+    SECTION("Version 1.0 segments have no ring") {
+        std::vector<char> copy(exporter.get_segment_size());
+        std::memcpy(copy.data(), exporter.get_segment(), copy.size());
+        auto *header = reinterpret_cast<shared_layout::segment_header *>(copy.data());
+        header->version_minor = 0;
+        header->header_size = shared_layout::base_header_size;
+
+        shared_sample_reader old_reader(copy.data(), copy.size());
+        REQUIRE(old_reader);
+        REQUIRE(old_reader.ring_capacity() == 0);
+        REQUIRE(!old_reader.try_read_sample(6, values, timestamp));
+    }
+}
+
+TEST_CASE("SampleDaemon__ClientReceivesSegment") {
+    const hwcpipe_counter counters[] = {MaliGPUActiveCy, MaliTilerUtil};
+    shared_sample_exporter exporter(counters, 2, 8);
+    REQUIRE(exporter);
+
+    const std::string path = "/tmp/hwcpipe-test-" + std::to_string(::getpid()) + ".sock";
+    segment_server server(path, exporter.get_fd(), exporter.get_segment_size());
+    REQUIRE(server);
+
+    // the client blocks until the server accepts it
+    std::unique_ptr<daemon_client> client{};
+    std::thread connect([&]() { client.reset(new daemon_client(path)); });
+    size_t num_served = 0;
+    while (num_served == 0) {
+        num_served = server.serve_pending();
+        std::this_thread::yield();
+    }
+    connect.join();
+
+    REQUIRE(*client);
+    REQUIRE(client->size() == 2);
+    REQUIRE(client->get_counter(1) == MaliTilerUtil);
+
+    counter_sample sample{};
+    REQUIRE(client->get_counter_value(MaliGPUActiveCy, sample) == make_error_code(errc::sample_collection_failure));
+    REQUIRE(client->sample_now() == make_error_code(errc::sample_not_ready));
+
+    const double published[] = {1000.0, 25.0};
+    exporter.publish(42, published);
+
+    REQUIRE(!client->sample_now());
+    REQUIRE(client->get_sample_number() == 1);
+    REQUIRE(client->get_sample_timestamp() == 42);
+    REQUIRE(!client->get_counter_value(MaliTilerUtil, sample));
+    REQUIRE(sample.type == counter_sample::type::float64);
+    REQUIRE(sample.value.float64 == 25.0);
+    REQUIRE(client->get_counter_value(MaliFragActiveCy, sample) == make_error_code(errc::unknown_counter));
+
+    REQUIRE(client->sample_now() == make_error_code(errc::sample_not_ready));
+    REQUIRE(client->get_reader().ring_capacity() == 8);
+}
+
+TEST_CASE("SampleDaemon__CountsSubscribers") {
+    const hwcpipe_counter counters[] = {MaliGPUActiveCy};
+    shared_sample_exporter exporter(counters, 1, 8);
+    REQUIRE(exporter);
+
+    const std::string path = "/tmp/hwcpipe-test-subscribers-" + std::to_string(::getpid()) + ".sock";
+    segment_server server(path, exporter.get_fd(), exporter.get_segment_size());
+    REQUIRE(server);
+    REQUIRE(server.num_subscribers() == 0);
+
+    std::unique_ptr<daemon_client> client{};
+    std::thread connect([&]() { client.reset(new daemon_client(path)); });
+    size_t num_served = 0;
+    while (num_served == 0) {
+        num_served = server.serve_pending(10);
+    }
+    connect.join();
+    REQUIRE(*client);
+    REQUIRE(server.num_subscribers() == 1);
+
+    // the connection stays open while the client reads
+    REQUIRE(server.serve_pending() == 0);
+    REQUIRE(server.num_subscribers() == 1);
+
+    client.reset();
+    REQUIRE(server.serve_pending(1000) == 0);
+    REQUIRE(server.num_subscribers() == 0);
+}
+
+TEST_CASE("SampleDaemon__ReplacesOnlyStaleSockets") {
+    const hwcpipe_counter counters[] = {MaliGPUActiveCy};
+    shared_sample_exporter exporter(counters, 1, 8);
+    REQUIRE(exporter);
+
+    const std::string path = "/tmp/hwcpipe-test-stale-" + std::to_string(::getpid()) + ".sock";
+    {
+        // the socket file of a server that didn't clean up
+        segment_server stale(path, exporter.get_fd(), exporter.get_segment_size());
+        REQUIRE(stale);
+        REQUIRE(::link(path.c_str(), (path + ".old").c_str()) == 0);
+    }
+    REQUIRE(::rename((path + ".old").c_str(), path.c_str()) == 0);
+    {
+        segment_server server(path, exporter.get_fd(), exporter.get_segment_size());
+        REQUIRE(server);
+    }
+
+    // a regular file at the path is never deleted
+    std::FILE *file = std::fopen(path.c_str(), "w");
+    REQUIRE(file != nullptr);
+    std::fclose(file);
+    {
+        segment_server server(path, exporter.get_fd(), exporter.get_segment_size());
+        REQUIRE(!server);
+        REQUIRE(server.get_error() == make_error_code(errc::daemon_connection_failed));
+    }
+    REQUIRE(::access(path.c_str(), F_OK) == 0);
+    std::remove(path.c_str());
+}
+
+TEST_CASE("SampleDaemon__NoDaemon") {
+    daemon_client client("/tmp/hwcpipe-test-missing.sock");
+    REQUIRE(!client);
+    REQUIRE(client.get_error() == make_error_code(errc::daemon_connection_failed));
+    REQUIRE(client.sample_now() == make_error_code(errc::sample_collection_failure));
+}
+
+TEST_CASE("SharedSampleSegment__ConcurrentReader") {
+    static constexpr uint64_t num_samples = 100000;
+    static constexpr size_t num_counters = 8;
+
+    std::vector<hwcpipe_counter> counters(num_counters, MaliGPUActiveCy);
+    shared_sample_exporter exporter(counters.data(), counters.size());
+    REQUIRE(exporter);
+
+    reader_mapping mapping(exporter.get_fd(), exporter.get_segment_size());
+    shared_sample_reader reader(mapping.get(), exporter.get_segment_size());
+    REQUIRE(reader);
+
+    std::atomic<bool> done{false};
+    bool consistent = true;
+    std::thread consumer([&]() {
+        double values[num_counters]{};
+        uint64_t last_count = 0;
+        while (!done.load()) {
+            uint64_t timestamp{};
+            uint64_t sample_count{};
+            if (!reader.try_read(values, timestamp, sample_count)) {
+                continue;
+            }
+
+            // every value of a sample is its timestamp
+            bool ok = sample_count >= last_count && sample_count == timestamp + 1;
+            for (auto value : values) {
+                ok = ok && value == static_cast<double>(timestamp);
+            }
+            last_count = sample_count;
+            consistent = consistent && ok;
+        }
+    });
+
+    double values[num_counters]{};
+    for (uint64_t i = 0; i != num_samples; ++i) {
+        for (auto &value : values) {
+            value = static_cast<double>(i);
+        }
+        exporter.publish(i, values);
+    }
+
+    done = true;
+    consumer.join();
+    REQUIRE(consistent);
+}
+
+} // namespace hwcpipe
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hwcpipe/snapshot_buffer.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace hwcpipe {
+
+TEST_CASE("snapshot_buffer__SingleThread") {
+    snapshot_buffer buffer(3, 2);
+    REQUIRE(buffer.num_buffers() == 3);
+    REQUIRE(buffer.values_per_sample() == 2);
+
+    const auto publish = [&buffer](uint64_t timestamp, double value) {
+        double *values = buffer.acquire_write();
+        REQUIRE(values != nullptr);
+        values[0] = value;
+        values[1] = value * 10;
+        buffer.publish(timestamp);
+    };
+
+    SECTION("Empty buffer has no snapshot") { REQUIRE(!buffer.latest()); }
+
+    SECTION("Snapshot is the latest published sample") {
+        publish(100, 1.0);
+        publish(200, 2.0);
+
+        auto snapshot = buffer.latest();
+        REQUIRE(snapshot);
+        REQUIRE(snapshot.timestamp() == 200);
+        REQUIRE(snapshot.sequence() == 2);
+        REQUIRE(snapshot.size() == 2);
+        REQUIRE(snapshot.values()[0] == 2.0);
+        REQUIRE(snapshot.values()[1] == 20.0);
+    }
+
+    SECTION("Held snapshots are immutable") {
+        publish(100, 1.0);
+        auto first = buffer.latest();
+        auto copy = first;
+
+        for (uint64_t i = 0; i != 8; ++i) {
+            publish(200 + i, 2.0 + static_cast<double>(i));
+        }
+
+        REQUIRE(first.timestamp() == 100);
+        REQUIRE(copy.values()[0] == 1.0);
+        REQUIRE(buffer.latest().timestamp() == 207);
+    }
+
+    SECTION("Writes fail while every other buffer is held") {
+        publish(100, 1.0);
+        auto first = buffer.latest();
+        publish(200, 2.0);
+        auto second = buffer.latest();
+        publish(300, 3.0);
+
+        // one buffer is the latest sample, the other two are held
+        REQUIRE(buffer.acquire_write() == nullptr);
+
+        first = sample_snapshot{};
+        REQUIRE(buffer.acquire_write() != nullptr);
+    }
+}
+
+TEST_CASE("snapshot_buffer__ProducerConsumers") {
+    static constexpr uint64_t num_samples = 100000;
+    static constexpr size_t num_readers = 3;
+    static constexpr size_t values_per_sample = 16;
+    snapshot_buffer buffer(num_readers + 2, values_per_sample);
+
+    std::atomic<bool> done{false};
+    std::atomic<bool> consistent{true};
+
+    std::vector<std::thread> readers{};
+    for (size_t r = 0; r != num_readers; ++r) {
+        readers.emplace_back([&]() {
+            uint64_t last_sequence = 0;
+            while (!done.load()) {
+                auto snapshot = buffer.latest();
+                if (!snapshot) {
+                    continue;
+                }
+
+                // every value of a sample is its timestamp, and samples are
+                // never seen out of order
+                bool ok = snapshot.sequence() >= last_sequence;
+                for (size_t v = 0; v != snapshot.size(); ++v) {
+                    ok = ok && snapshot.values()[v] == static_cast<double>(snapshot.timestamp());
+                }
+                last_sequence = snapshot.sequence();
+                if (!ok) {
+                    consistent = false;
+                }
+            }
+        });
+    }
+
+    for (uint64_t i = 0; i != num_samples;) {
+        double *values = buffer.acquire_write();
+        if (values == nullptr) {
+            std::this_thread::yield();
+            continue;
+        }
+        for (size_t v = 0; v != values_per_sample; ++v) {
+            values[v] = static_cast<double>(i);
+        }
+        buffer.publish(i);
+        ++i;
+    }
+
+    done = true;
+    for (auto &reader : readers) {
+        reader.join();
+    }
+
+    REQUIRE(consistent);
+    REQUIRE(buffer.latest().timestamp() == num_samples - 1);
+}
+
+} // namespace hwcpipe
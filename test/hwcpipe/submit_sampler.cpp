@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hwcpipe/error.hpp"
+#include "hwcpipe/submit_sampler.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace hwcpipe {
+
+namespace {
+
+/** Sampler stand-in for submit_sampler. Each request takes a sample tagged with its user_data. */
+struct sampler_stub {
+    std::error_code request_sample_async(uint64_t user_data) {
+        ++requests;
+        pending.push_back(user_data);
+        return {};
+    }
+
+    std::error_code collect_for(uint64_t) {
+        if (not_ready != 0) {
+            --not_ready;
+            return make_error_code(errc::sample_not_ready);
+        }
+        if (pending.empty()) {
+            return make_error_code(errc::sample_not_ready);
+        }
+        user_data = pending.front();
+        pending.pop_front();
+        return {};
+    }
+
+    uint64_t get_sample_user_data() const { return user_data; }
+
+    std::deque<uint64_t> pending{};
+    uint64_t user_data{};
+    size_t requests{};
+    size_t not_ready{};
+};
+
+using submit_sampler_t = submit_sampler<sampler_stub>;
+
+submit_tag collect(submit_sampler_t &submits, sampler_stub &sampler) {
+    REQUIRE(!submits.collect_for(0));
+    return submit_tag::decode(sampler.get_sample_user_data());
+}
+
+} // namespace
+
+TEST_CASE("submit_sampler__TagsSubmitsAndPresents") {
+    sampler_stub sampler{};
+    submit_sampler_t submits(sampler, submit_sampler_config{});
+    REQUIRE(submits.num_channels() == 1);
+
+    REQUIRE(submits.on_submit(0));
+    REQUIRE(submits.on_submit(0));
+    REQUIRE(submits.on_present(0));
+    REQUIRE(submits.on_submit(0));
+
+    auto tag = collect(submits, sampler);
+    REQUIRE(tag.frame == 0);
+    REQUIRE(tag.submit == 0);
+    tag = collect(submits, sampler);
+    REQUIRE(tag.submit == 1);
+    tag = collect(submits, sampler);
+    REQUIRE(tag.frame == 0);
+    REQUIRE(tag.submit == present_submit);
+    tag = collect(submits, sampler);
+    REQUIRE(tag.frame == 1);
+    REQUIRE(tag.submit == 2);
+
+    REQUIRE(submits.collect_for(0) == make_error_code(errc::sample_not_ready));
+    REQUIRE(sampler.requests == 4);
+
+    const auto stats = submits.get_stats();
+    REQUIRE(stats.submits == 3);
+    REQUIRE(stats.presents == 1);
+    REQUIRE(stats.dropped == 0);
+    REQUIRE(stats.samples == 4);
+}
+
+TEST_CASE("submit_sampler__PendingSampleIsCollectedLater") {
+    sampler_stub sampler{};
+    submit_sampler_t submits(sampler, submit_sampler_config{});
+    REQUIRE(submits.on_submit(0));
+    REQUIRE(submits.on_submit(0));
+
+    sampler.not_ready = 1;
+    REQUIRE(submits.collect_for(0) == make_error_code(errc::sample_not_ready));
+    REQUIRE(sampler.requests == 1);
+
+    // the pending sample is collected before the next one is requested
+    REQUIRE(collect(submits, sampler).submit == 0);
+    REQUIRE(sampler.requests == 1);
+    REQUIRE(collect(submits, sampler).submit == 1);
+    REQUIRE(sampler.requests == 2);
+}
+
+TEST_CASE("submit_sampler__FullChannelDrops") {
+    sampler_stub sampler{};
+    submit_sampler_config config{};
+    config.num_channels = 2;
+    config.queue_depth = 3;
+    submit_sampler_t submits(sampler, config);
+
+    for (int i = 0; i != 4; ++i) {
+        REQUIRE(submits.on_submit(0));
+    }
+    REQUIRE(!submits.on_submit(0));
+    REQUIRE(!submits.on_present(0));
+    REQUIRE(submits.on_submit(1));
+    REQUIRE(submits.get_stats().dropped == 2);
+
+    // the channels are visited round-robin
+    REQUIRE(collect(submits, sampler).submit == 0);
+    REQUIRE(collect(submits, sampler).submit == 5);
+    REQUIRE(collect(submits, sampler).submit == 1);
+    REQUIRE(collect(submits, sampler).submit == 2);
+}
+
+TEST_CASE("submit_sampler__ConcurrentProducers") {
+    sampler_stub sampler{};
+    submit_sampler_config config{};
+    config.num_channels = 2;
+    config.queue_depth = 4;
+    config.poll_interval_ns = 1000;
+    submit_sampler_t submits(sampler, config);
+
+    constexpr size_t num_submits = 2000;
+    auto produce = [&](size_t channel) {
+        for (size_t i = 0; i != num_submits; ++i) {
+            while (!submits.on_submit(channel)) {
+                std::this_thread::yield();
+            }
+        }
+    };
+    std::thread first(produce, 0);
+    std::thread second(produce, 1);
+
+    std::vector<uint32_t> collected{};
+    while (collected.size() != 2 * num_submits) {
+        if (!submits.collect_for(1000000)) {
+            collected.push_back(submit_tag::decode(sampler.get_sample_user_data()).submit);
+        }
+    }
+    first.join();
+    second.join();
+
+    // each submit is collected once, a dropped one used up its number
+    std::sort(collected.begin(), collected.end());
+    REQUIRE(std::adjacent_find(collected.begin(), collected.end()) == collected.end());
+    const auto stats = submits.get_stats();
+    REQUIRE(stats.samples == 2 * num_submits);
+    REQUIRE(stats.submits == stats.samples + stats.dropped);
+    REQUIRE(collected.back() < stats.submits);
+}
+
+} // namespace hwcpipe
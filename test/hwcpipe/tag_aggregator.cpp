@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hwcpipe/error.hpp"
+#include "hwcpipe/sampler.hpp"
+#include "hwcpipe/tag_aggregator.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <system_error>
+#include <vector>
+
+namespace hwcpipe {
+
+namespace {
+
+/** Sampler stand-in for tag_aggregator::update(sampler, list). */
+struct sampler_stub {
+    std::error_code get_counter_values(int list, double *values, size_t count) const {
+        if (count < 2) {
+            return make_error_code(errc::invalid_read_list);
+        }
+        values[0] = static_cast<double>(list);
+        values[1] = static_cast<double>(list) * 2;
+        return {};
+    }
+    sample_interval get_sample_interval() const { return {1000, 2000, 0, 0}; }
+    uint64_t get_sample_user_data() const { return 7; }
+};
+
+/** Records the evicted tags and their first value. */
+struct eviction_log {
+    static void record(void *user_data, const tag_aggregator &aggregator, uint64_t tag) {
+        auto &log = *static_cast<eviction_log *>(user_data);
+        tag_summary summary{};
+        double value = 0;
+        REQUIRE(aggregator.get_summary(tag, summary, &value, 1));
+        log.tags.push_back(tag);
+        log.values.push_back(value);
+    }
+
+    std::vector<uint64_t> tags;
+    std::vector<double> values;
+};
+
+} // namespace
+
+TEST_CASE("tag_aggregator__Update") {
+    tag_aggregator frames(2, 4);
+    frames.set_aggregation(1, tag_aggregation::average);
+    REQUIRE(frames.size() == 2);
+    REQUIRE(frames.capacity() == 4);
+    REQUIRE(!frames.contains(1));
+
+    const double first[2] = {10.0, 0.5};
+    const double second[2] = {30.0, 1.0};
+    frames.update(1, 100, 200, first);
+    frames.update(1, 200, 500, second);
+    frames.update(2, 500, 600, first);
+
+    tag_summary summary{};
+    double values[2]{};
+    REQUIRE(frames.get_summary(1, summary, values, 2));
+    CHECK(summary.tag == 1);
+    CHECK(summary.num_samples == 2);
+    CHECK(summary.timestamp_ns_begin == 100);
+    CHECK(summary.timestamp_ns_end == 500);
+    CHECK(summary.duration_ns == 400);
+    CHECK(values[0] == 40.0);
+    CHECK(values[1] == Approx((0.5 * 100 + 1.0 * 300) / 400));
+
+    REQUIRE(frames.get_summary(2, summary, values, 1));
+    CHECK(summary.num_samples == 1);
+    CHECK(values[0] == 10.0);
+    CHECK(!frames.get_summary(3, summary, values, 2));
+    CHECK(frames.get_stats().samples == 3);
+}
+
+TEST_CASE("tag_aggregator__Eviction") {
+    tag_aggregator frames(1, 2);
+    eviction_log log{};
+    frames.set_eviction_handler(&eviction_log::record, &log);
+
+    const double one[1] = {1.0};
+    frames.update(10, 0, 1, one);
+    frames.update(11, 1, 2, one);
+    frames.update(11, 2, 3, one);
+
+    SECTION("A newer tag evicts the tag in its slot") {
+        frames.update(12, 3, 4, one);
+        CHECK(log.tags == std::vector<uint64_t>{10});
+        CHECK(log.values == std::vector<double>{1.0});
+        CHECK(!frames.contains(10));
+        CHECK(frames.contains(11));
+        CHECK(frames.contains(12));
+        CHECK(frames.get_stats().evictions == 1);
+
+        SECTION("An older tag is dropped") {
+            frames.update(10, 4, 5, one);
+            CHECK(!frames.contains(10));
+            CHECK(frames.contains(12));
+            CHECK(frames.get_stats().late_samples == 1);
+        }
+    }
+    SECTION("flush() evicts the oldest tags first") {
+        frames.flush();
+        CHECK(log.tags == std::vector<uint64_t>({10, 11}));
+        CHECK(log.values == std::vector<double>({1.0, 2.0}));
+        CHECK(!frames.contains(11));
+
+        frames.update(13, 5, 6, one);
+        tag_summary summary{};
+        double value = 0;
+        REQUIRE(frames.get_summary(13, summary, &value, 1));
+        CHECK(summary.num_samples == 1);
+        CHECK(value == 1.0);
+    }
+    SECTION("reset() forgets the tags without evicting them") {
+        frames.reset();
+        CHECK(!frames.contains(10));
+        CHECK(!frames.contains(11));
+        CHECK(log.tags.empty());
+    }
+}
+
+TEST_CASE("tag_aggregator__UpdateFromSampler") {
+    tag_aggregator frames(2, 8);
+    const sampler_stub sampler{};
+
+    REQUIRE(!frames.update(sampler, 3));
+
+    tag_summary summary{};
+    double values[2]{};
+    REQUIRE(frames.get_summary(7, summary, values, 2));
+    CHECK(summary.duration_ns == 1000);
+    CHECK(values[0] == 3.0);
+    CHECK(values[1] == 6.0);
+
+    tag_aggregator narrow(1, 8);
+    CHECK(narrow.update(sampler, 3) == make_error_code(errc::invalid_read_list));
+    CHECK(narrow.get_stats().samples == 0);
+}
+
+} // namespace hwcpipe
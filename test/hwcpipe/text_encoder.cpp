@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hwcpipe/counter_database.hpp"
+#include "hwcpipe/detail/decimal_format.hpp"
+#include "hwcpipe/text_encoder.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <string>
+
+namespace hwcpipe {
+
+namespace {
+
+std::string counter_name(hwcpipe_counter counter) {
+    counter_metadata metadata{};
+    REQUIRE(!counter_database{}.describe_counter(counter, metadata));
+    return metadata.name;
+}
+
+std::string contents(const text_encoder &encoder) { return std::string(encoder.data(), encoder.size()); }
+
+std::string format(double value, int decimals = -1) {
+    char text[detail::max_double_size];
+    return std::string(text, detail::format_double(value, decimals, text));
+}
+
+} // namespace
+
+TEST_CASE("text_encoder__FormatsCsv") {
+    const hwcpipe_counter counters[] = {MaliGPUActiveCy, MaliFragActiveCy};
+    const auto gpu = counter_name(MaliGPUActiveCy);
+    const auto frag = counter_name(MaliFragActiveCy);
+
+    text_encoder encoder(counters, 2, {});
+    CHECK(encoder.values_per_sample() == 2);
+    CHECK(encoder.num_columns() == 2);
+    CHECK(encoder.header() == "timestamp," + gpu + "," + frag + "\n");
+
+    const double first[] = {1000, 0.5};
+    const double second[] = {-3, std::numeric_limits<double>::quiet_NaN()};
+    encoder.encode(10, first);
+    encoder.encode(20, second);
+    CHECK(contents(encoder) == "10,1000,0.5\n20,-3,\n");
+}
+
+TEST_CASE("text_encoder__FormatsJsonLines") {
+    const hwcpipe_counter counters[] = {MaliGPUActiveCy, MaliFragActiveCy};
+    const auto gpu = counter_name(MaliGPUActiveCy);
+    const auto frag = counter_name(MaliFragActiveCy);
+
+    text_encoder_config config{};
+    config.format = text_format::json_lines;
+    text_encoder encoder(counters, 2, config);
+    CHECK(encoder.header().empty());
+
+    const uint64_t values[] = {std::numeric_limits<uint64_t>::max(), 7};
+    encoder.encode(uint64_t{42}, values);
+    CHECK(contents(encoder) ==
+          "{\"timestamp\":42,\"" + gpu + "\":18446744073709551615,\"" + frag + "\":7}\n");
+
+    encoder.clear();
+    const double doubles[] = {std::numeric_limits<double>::infinity(), 0.25};
+    encoder.encode(1, doubles);
+    CHECK(contents(encoder) == "{\"timestamp\":1,\"" + gpu + "\":null,\"" + frag + "\":0.25}\n");
+}
+
+TEST_CASE("text_encoder__SelectsColumns") {
+    const hwcpipe_counter counters[] = {MaliGPUActiveCy, MaliFragActiveCy};
+    const auto frag = counter_name(MaliFragActiveCy);
+    const size_t columns[] = {1, 5};
+
+    SECTION("csv") {
+        text_encoder_config config{};
+        config.columns = columns;
+        config.num_columns = 2;
+        config.timestamp = false;
+        text_encoder encoder(counters, 2, config);
+        CHECK(encoder.num_columns() == 1);
+        CHECK(encoder.header() == frag + "\n");
+
+        const double values[] = {1, 2};
+        encoder.encode(0, values);
+        CHECK(contents(encoder) == "2\n");
+    }
+    SECTION("json lines") {
+        text_encoder_config config{};
+        config.format = text_format::json_lines;
+        config.columns = columns;
+        config.num_columns = 2;
+        config.timestamp = false;
+        text_encoder encoder(counters, 2, config);
+
+        const double values[] = {1, 2};
+        encoder.encode(0, values);
+        CHECK(contents(encoder) == "{\"" + frag + "\":2}\n");
+    }
+}
+
+TEST_CASE("text_encoder__ReusesItsBuffer") {
+    const hwcpipe_counter counters[] = {MaliGPUActiveCy};
+    text_encoder encoder(counters, 1, {});
+    const double values[] = {-1.2345678901234567e-308};
+
+    for (int i = 0; i != 100; ++i) {
+        encoder.encode(std::numeric_limits<uint64_t>::max(), values);
+    }
+    const auto footprint = encoder.get_memory_footprint();
+    const auto size = encoder.size();
+    CHECK(size == 100 * contents(encoder).find('\n') + 100);
+
+    encoder.clear();
+    CHECK(encoder.size() == 0);
+    for (int i = 0; i != 100; ++i) {
+        encoder.encode(std::numeric_limits<uint64_t>::max(), values);
+    }
+    CHECK(encoder.size() == size);
+    CHECK(encoder.get_memory_footprint() == footprint);
+}
+
+TEST_CASE("format_double__RoundTrips") {
+    CHECK(format(0) == "0");
+    CHECK(format(-12) == "-12");
+    CHECK(format(0.1) == "0.1");
+    CHECK(format(1e300) == "1e+300");
+    CHECK(format(9007199254740992.0) == "9007199254740992");
+
+    const double values[] = {1.0 / 3, 0.1 + 0.2, -2.5e-7, 123456.789, 1.7976931348623157e308, 5e-324};
+    for (const double value : values) {
+        const auto text = format(value);
+        CAPTURE(text);
+        CHECK(text.size() <= detail::max_double_size);
+        CHECK(std::strtod(text.c_str(), nullptr) == value);
+    }
+}
+
+TEST_CASE("format_double__FormatsFixedDecimals") {
+    CHECK(format(1.0 / 3, 2) == "0.33");
+    CHECK(format(2.0 / 3, 0) == "1");
+    CHECK(format(-1.005, 3) == "-1.005");
+    CHECK(format(0.0625, 3) == "0.063");
+    CHECK(format(-0.0001, 2) == "0.00");
+    CHECK(format(12.5, 4) == "12.5000");
+    CHECK(format(7, 3) == "7");
+}
+
+} // namespace hwcpipe
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hwcpipe/error.hpp"
+#include "hwcpipe/tiered_history.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <system_error>
+
+namespace hwcpipe {
+
+namespace {
+
+/** 10 us, 100 us and 1 ms buckets, over samples of 1 us. */
+const history_tier tiers[] = {{10000, 50}, {100000, 20}, {1000000, 10}};
+
+/** Pushes samples @p first to @p last, of 1 us each, whose values are 1 and their number. */
+void push_range(tiered_history &history, uint64_t first, uint64_t last) {
+    for (uint64_t i = first; i != last; ++i) {
+        const uint64_t values[2] = {1, i};
+        history.push(i * 1000, i * 1000 + 1000, values);
+    }
+}
+
+/** The sum of the numbers of the samples @p first to @p last. */
+uint64_t sum_range(uint64_t first, uint64_t last) { return (first + last - 1) * (last - first) / 2; }
+
+/** Sampler stand-in for tiered_history::push(sampler, list). */
+struct sampler_stub {
+    std::error_code get_counter_values(int list, uint64_t *values, size_t count) const {
+        if (count < 2) {
+            return make_error_code(errc::invalid_read_list);
+        }
+        values[0] = static_cast<uint64_t>(list);
+        values[1] = static_cast<uint64_t>(list) + 1;
+        return {};
+    }
+    uint64_t get_sample_timestamp() const { return 1000; }
+    uint64_t get_sample_timestamp_end() const { return 2000; }
+};
+
+} // namespace
+
+TEST_CASE("tiered_history__WindowSums") {
+    tiered_history history(2, 100, tiers, 3);
+    REQUIRE(history.num_tiers() == 4);
+    REQUIRE(history.resolution_ns(0) == 0);
+    REQUIRE(history.resolution_ns(3) == 1000000);
+    uint64_t sums[2] = {1, 1};
+
+    SECTION("Empty history has empty windows") {
+        const auto window = history.window_sums(0, 1000000, sums);
+        CHECK(window.num_samples == 0);
+        CHECK(sums[0] == 0);
+        CHECK(history.oldest_timestamp() == 0);
+    }
+
+    push_range(history, 0, 3000);
+    CHECK(history.newest_timestamp() == 3000000);
+
+    SECTION("Closed buckets roll up into the tiers") {
+        CHECK(history.tier(0).size() == 100);
+        CHECK(history.tier(1).size() == 50);
+        CHECK(history.tier(2).size() == 20);
+        CHECK(history.tier(3).size() == 2);
+        CHECK(history.oldest_timestamp() == 0);
+
+        uint64_t values[2]{};
+        const auto bucket = history.tier(3).get_sample(1, values);
+        CHECK(bucket.timestamp_ns_begin == 1000000);
+        CHECK(bucket.timestamp_ns_end == 2000000);
+        CHECK(values[0] == 1000);
+        CHECK(values[1] == sum_range(1000, 2000));
+    }
+    SECTION("Recent windows are read at full resolution") {
+        const auto window = history.last_sums(50000, sums);
+        CHECK(window.num_samples == 50);
+        CHECK(sums[1] == sum_range(2950, 3000));
+    }
+    SECTION("Older windows are read from the finest tier that reaches them") {
+        // the 100 us tier reaches back to 0.9 ms, then the 10 us tier and
+        // the samples cover the time after its last bucket
+        const auto window = history.window_sums(1000000, 3000000, sums);
+        CHECK(window.num_samples == 19 + 9 + 10);
+        CHECK(window.timestamp_ns_begin == 1000000);
+        CHECK(window.timestamp_ns_end == 3000000);
+        CHECK(sums[0] == 2000);
+        CHECK(sums[1] == sum_range(1000, 3000));
+    }
+    SECTION("Windows before the finer tiers are read from the coarsest one") {
+        const auto window = history.window_sums(0, 3000000, sums);
+        CHECK(window.timestamp_ns_begin == 0);
+        CHECK(sums[0] == 3000);
+        CHECK(sums[1] == sum_range(0, 3000));
+    }
+    SECTION("Windows are aligned on the buckets of their tier") {
+        const auto window = history.window_sums(1250000, 2000000, sums);
+        CHECK(window.num_samples == 7);
+        CHECK(window.timestamp_ns_begin == 1300000);
+        CHECK(sums[1] == sum_range(1300, 2000));
+    }
+    SECTION("clear() removes the samples and the open buckets") {
+        history.clear();
+        CHECK(history.oldest_timestamp() == 0);
+        push_range(history, 5000, 5020);
+        const auto window = history.window_sums(0, 6000000, sums);
+        CHECK(window.num_samples == 20);
+        CHECK(sums[1] == sum_range(5000, 5020));
+        CHECK(history.tier(1).size() == 1);
+    }
+}
+
+TEST_CASE("tiered_history__BoundedMemory") {
+    tiered_history history(2, 100, tiers, 3, history_storage::compact);
+    push_range(history, 0, 3000);
+    const auto footprint = history.get_memory_footprint();
+
+    push_range(history, 3000, 30000);
+    CHECK(history.get_memory_footprint() == footprint);
+    CHECK(history.tier(3).size() == 10);
+
+    uint64_t sums[2]{};
+    const auto window = history.last_sums(5000000, sums);
+    CHECK(window.timestamp_ns_begin == 25000000);
+    CHECK(sums[0] == 5000);
+    CHECK(sums[1] == sum_range(25000, 30000));
+}
+
+TEST_CASE("tiered_history__PushFromSampler") {
+    tiered_history history(2, 8, tiers, 3);
+    const sampler_stub sampler{};
+    REQUIRE(!history.push(sampler, 5));
+
+    uint64_t sums[2]{};
+    const auto window = history.window_sums(0, 2000, sums);
+    CHECK(window.num_samples == 1);
+    CHECK(sums[0] == 5);
+    CHECK(sums[1] == 6);
+
+    tiered_history narrow(1, 8, tiers, 3);
+    CHECK(narrow.push(sampler, 5) == make_error_code(errc::invalid_read_list));
+}
+
+} // namespace hwcpipe
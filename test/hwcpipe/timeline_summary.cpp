@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hwcpipe/error.hpp"
+#include "hwcpipe/sample_history.hpp"
+#include "hwcpipe/timeline_summary.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <system_error>
+#include <vector>
+
+namespace hwcpipe {
+
+namespace {
+
+/** Pushes samples @p first to @p last, of 100 ns each, whose values are their number and its negation. */
+void push_range(timeline_summary &summary, uint64_t first, uint64_t last) {
+    for (uint64_t i = first; i != last; ++i) {
+        const double values[2] = {static_cast<double>(i), -static_cast<double>(i)};
+        summary.push(i * 100, i * 100 + 100, values);
+    }
+}
+
+/** Sampler stand-in for timeline_summary::push(sampler, list). */
+struct sampler_stub {
+    std::error_code get_counter_values(int list, double *values, size_t count) const {
+        if (count < 2) {
+            return make_error_code(errc::invalid_read_list);
+        }
+        values[0] = list;
+        values[1] = list + 0.5;
+        return {};
+    }
+    uint64_t get_sample_timestamp() const { return 1000; }
+    uint64_t get_sample_timestamp_end() const { return 2000; }
+};
+
+} // namespace
+
+TEST_CASE("timeline_summary__Decimate") {
+    timeline_summary summary(2, 64, 3, 10);
+    REQUIRE(summary.num_levels() == 3);
+    REQUIRE(summary.samples_per_bucket(2) == 100);
+    std::vector<timeline_bucket> pixels(10);
+
+    SECTION("Empty summary has empty buckets") {
+        summary.decimate(0, 1000, 0, pixels.data(), pixels.size());
+        for (const auto &pixel : pixels) {
+            REQUIRE(pixel.num_samples == 0);
+        }
+    }
+
+    SECTION("Each bucket holds the samples that start in it") {
+        push_range(summary, 0, 100);
+
+        // 100 samples in 10 pixels are read from the buckets of 10 samples
+        REQUIRE(summary.decimate(0, 10000, 0, pixels.data(), pixels.size()) == 1);
+        for (size_t i = 0; i != pixels.size(); ++i) {
+            REQUIRE(pixels[i].num_samples == 10);
+            REQUIRE(pixels[i].min == Approx(10.0 * i));
+            REQUIRE(pixels[i].max == Approx(10.0 * i + 9));
+            REQUIRE(pixels[i].mean == Approx(10.0 * i + 4.5));
+            REQUIRE(pixels[i].last == Approx(10.0 * i + 9));
+        }
+
+        summary.decimate(0, 10000, 1, pixels.data(), pixels.size());
+        REQUIRE(pixels[3].min == Approx(-39));
+        REQUIRE(pixels[3].max == Approx(-30));
+    }
+
+    SECTION("Zooming in reads the single samples") {
+        push_range(summary, 0, 100);
+
+        REQUIRE(summary.decimate(6000, 7000, 0, pixels.data(), pixels.size()) == 0);
+        for (size_t i = 0; i != pixels.size(); ++i) {
+            REQUIRE(pixels[i].num_samples == 1);
+            REQUIRE(pixels[i].min == Approx(60.0 + i));
+            REQUIRE(pixels[i].max == Approx(60.0 + i));
+        }
+
+        // level 0 only holds the last 64 samples
+        REQUIRE(summary.decimate(2000, 3000, 0, pixels.data(), pixels.size()) == 1);
+
+        // with more pixels than samples some are empty
+        std::vector<timeline_bucket> wide(20);
+        REQUIRE(summary.decimate(6000, 7000, 0, wide.data(), wide.size()) == 0);
+        REQUIRE(wide[0].num_samples == 1);
+        REQUIRE(wide[1].num_samples == 0);
+        REQUIRE(wide[2].last == Approx(61));
+    }
+
+    SECTION("Coarse levels reach further back than the fine ones") {
+        push_range(summary, 0, 1000);
+        REQUIRE(summary.num_buckets(0) == 64);
+        REQUIRE(summary.num_buckets(2) == 10);
+
+        // level 1 holds the last 640 samples only
+        REQUIRE(summary.decimate(0, 100000, 0, pixels.data(), pixels.size()) == 2);
+        uint64_t total = 0;
+        for (const auto &pixel : pixels) {
+            total += pixel.num_samples;
+        }
+        REQUIRE(total == 1000);
+        REQUIRE(pixels[0].min == Approx(0));
+        REQUIRE(pixels[9].max == Approx(999));
+    }
+
+    SECTION("Clear removes every sample") {
+        push_range(summary, 0, 100);
+        summary.clear();
+        REQUIRE(summary.num_buckets(0) == 0);
+        summary.decimate(0, 10000, 0, pixels.data(), pixels.size());
+        REQUIRE(pixels[0].num_samples == 0);
+    }
+}
+
+TEST_CASE("timeline_summary__Sources") {
+    timeline_summary summary(2, 16, 2, 4);
+    timeline_bucket pixel{};
+
+    SECTION("From a sampler") {
+        REQUIRE(!summary.push(sampler_stub{}, 3));
+        summary.decimate(0, 4000, 1, &pixel, 1);
+        REQUIRE(pixel.num_samples == 1);
+        REQUIRE(pixel.last == Approx(3.5));
+    }
+
+    SECTION("From a sample history") {
+        sample_history history(8, 2);
+        for (uint64_t i = 0; i != 4; ++i) {
+            const uint64_t values[2] = {i, i * 10};
+            history.push(i * 100, i * 100 + 100, values);
+        }
+        summary.push(history);
+
+        REQUIRE(summary.decimate(0, 400, 1, &pixel, 1) == 1);
+        REQUIRE(pixel.num_samples == 4);
+        REQUIRE(pixel.min == Approx(0));
+        REQUIRE(pixel.max == Approx(30));
+        REQUIRE(pixel.mean == Approx(15));
+    }
+}
+
+TEST_CASE("timeline_summary__CompactStorage") {
+    timeline_summary wide(2, 64, 3, 10);
+    timeline_summary compact(2, 64, 3, 10, history_storage::compact);
+    push_range(wide, 0, 1000);
+    push_range(compact, 0, 1000);
+    REQUIRE(compact.get_memory_footprint() < wide.get_memory_footprint());
+
+    std::vector<timeline_bucket> expected(10);
+    std::vector<timeline_bucket> pixels(10);
+    REQUIRE(compact.decimate(0, 100000, 1, pixels.data(), pixels.size()) ==
+            wide.decimate(0, 100000, 1, expected.data(), expected.size()));
+    for (size_t i = 0; i != pixels.size(); ++i) {
+        REQUIRE(pixels[i].num_samples == expected[i].num_samples);
+        REQUIRE(pixels[i].min == Approx(expected[i].min));
+        REQUIRE(pixels[i].max == Approx(expected[i].max));
+        REQUIRE(pixels[i].mean == Approx(expected[i].mean));
+        REQUIRE(pixels[i].last == Approx(expected[i].last));
+    }
+}
+
+} // namespace hwcpipe
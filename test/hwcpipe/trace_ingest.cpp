@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hwcpipe/hwcpipe_counter.h"
+#include "mock/backend_sample.hpp"
+#include "mock/handle.hpp"
+#include "mock/instance.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <hwcpipe/column_evaluator.hpp>
+#include <hwcpipe/error.hpp>
+#include <hwcpipe/sampler.hpp>
+#include <hwcpipe/trace_ingest.hpp>
+#include <hwcpipe/trace_recorder.hpp>
+
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <unistd.h>
+
+namespace hwcpipe {
+
+namespace {
+using namespace hwcpipe::mock;
+
+std::array<uint32_t, 64> values_fe{};
+std::array<uint32_t, 64> values_tiler{};
+
+/** Sample with a front end and a tiler block. */
+class ingest_sample_mock {
+  public:
+    const sample_metadata &get_metadata() const { return metadata; }
+    const std::array<block_metadata, 2> &blocks() const { return sample_blocks; }
+
+    sample_metadata metadata{};
+    std::array<block_metadata, 2> sample_blocks{{
+        {device::hwcnt::block_type::fe, values_fe.data(), 0},
+        {device::hwcnt::block_type::tiler, values_tiler.data(), 0},
+    }};
+};
+
+std::string temporary_path(const char *name) {
+    return "/tmp/hwcpipe-" + std::to_string(::getpid()) + "-" + name + ".hwct";
+}
+
+/** Removes a file when the test ends. */
+class file_remover {
+  public:
+    explicit file_remover(std::string path)
+        : path_(std::move(path)) {}
+    ~file_remover() { std::remove(path_.c_str()); }
+
+  private:
+    std::string path_;
+};
+
+/**
+ * Records a G31 trace of GPU and tiler active cycles, one sample per
+ * millisecond from @p start_ns. The sample @p error_sample is erroneous.
+ */
+void write_trace(const std::string &path, uint64_t start_ns, uint32_t gpu_active, uint32_t tiler_active,
+                 uint64_t num_samples, uint64_t error_sample) {
+    sampler_config config(device::product_id::g31, 0);
+    REQUIRE(!config.add_counter(MaliGPUActiveCy));
+    REQUIRE(!config.add_counter(MaliTilerActiveCy));
+
+    device::constants constants{};
+    constants.gpu_id = 0x70930000;
+    constants.num_shader_cores = 1;
+
+    trace_recorder recorder(path, config, constants, block_extents_mock{}, 4, trace_encoding::delta);
+    REQUIRE(recorder);
+
+    ingest_sample_mock sample;
+    for (uint64_t i = 0; i != num_samples; ++i) {
+        values_fe[6] = static_cast<uint32_t>(gpu_active + i);
+        values_tiler[4] = tiler_active;
+        sample.metadata = {};
+        sample.metadata.sample_nr = i;
+        sample.metadata.timestamp_ns_begin = start_ns + i * 1000000;
+        sample.metadata.timestamp_ns_end = start_ns + i * 1000000 + 999999;
+        sample.metadata.flags.error = i == error_sample ? 1 : 0;
+        REQUIRE(!recorder.record(sample));
+    }
+    REQUIRE(!recorder.close());
+}
+} // namespace
+
+TEST_CASE("trace_ingest__MergesTracesIntoTimeBuckets") {
+    const block_extents_guard extents_guard;
+    block_extents_mock::num_blocks() = 1;
+    const auto first_path = temporary_path("ingest-first");
+    const auto second_path = temporary_path("ingest-second");
+    file_remover first_remover(first_path);
+    file_remover second_remover(second_path);
+
+    // the second trace starts five seconds later, and its second sample is erroneous
+    write_trace(first_path, 0, 100, 50, 3, 3);
+    write_trace(second_path, 5000000000, 200, 150, 3, 1);
+
+    trace_ingest_config config;
+    config.bucket_ns = 1000000;
+    config.num_threads = 2;
+    config.chunk_records = 2;
+    trace_ingest ingest({MaliGPUActiveCy, MaliTilerUtil, MaliFragActiveCy}, config);
+
+    SECTION("aligned by their start") {
+        REQUIRE(!ingest.ingest({first_path, second_path}));
+
+        const auto &results = ingest.get_results();
+        REQUIRE(results.size() == 2);
+        REQUIRE(results[0].pid == device::product_id::g31);
+        REQUIRE(results[0].num_records == 3);
+        REQUIRE(results[1].num_records == 2);
+        // the fragment counter was not recorded
+        REQUIRE(results[0].num_counters == 2);
+
+        REQUIRE(ingest.num_buckets() == 3);
+        REQUIRE(ingest.bucket_timestamp(2) == 2000000);
+
+        const trace_aggregate *first = ingest.get_bucket(0);
+        REQUIRE(first[0].count == 2);
+        REQUIRE(first[0].sum == 300);
+        REQUIRE(first[0].min == 100);
+        REQUIRE(first[0].max == 200);
+        REQUIRE(first[0].mean() == 150);
+        REQUIRE(first[2].count == 0);
+
+        // the derived counter is evaluated as the counter database does
+        device::constants constants{};
+        constants.gpu_id = 0x70930000;
+        constants.num_shader_cores = 1;
+        column_evaluator utilization(device::product_id::g31, constants, MaliTilerUtil);
+        REQUIRE(utilization.get_inputs().size() == 2);
+        const double gpu[] = {100, 200};
+        const double tiler[] = {50, 150};
+        const double *columns[2];
+        for (size_t k = 0; k != 2; ++k) {
+            columns[k] = utilization.get_inputs()[k] == MaliGPUActiveCy ? gpu : tiler;
+        }
+        double expected[2];
+        REQUIRE(!utilization.evaluate(columns, 2, 2, expected));
+        REQUIRE(first[1].count == 2);
+        REQUIRE(first[1].sum == Approx(expected[0] + expected[1]));
+
+        // the erroneous sample of the second trace is skipped
+        const trace_aggregate *second = ingest.get_bucket(1);
+        REQUIRE(second[0].count == 1);
+        REQUIRE(second[0].sum == 101);
+    }
+
+    SECTION("by their timestamps") {
+        trace_ingest_config absolute = config;
+        absolute.alignment = trace_alignment::absolute;
+        trace_ingest by_time({MaliGPUActiveCy}, absolute);
+        REQUIRE(!by_time.ingest({first_path}));
+        REQUIRE(!by_time.ingest({second_path}));
+
+        REQUIRE(by_time.get_results().size() == 2);
+        REQUIRE(by_time.num_buckets() == 5);
+        REQUIRE(by_time.bucket_timestamp(3) == 5000000000);
+        REQUIRE(by_time.get_bucket(3)[0].sum == 200);
+        REQUIRE(by_time.get_bucket(4)[0].sum == 202);
+
+        by_time.clear();
+        REQUIRE(by_time.num_buckets() == 0);
+        REQUIRE(by_time.get_results().empty());
+    }
+
+    SECTION("with a missing file") {
+        const auto ec = ingest.ingest({first_path, temporary_path("ingest-missing")});
+        REQUIRE(ec == make_error_code(errc::trace_read_failed));
+        REQUIRE(!ingest.get_results()[0].ec);
+        REQUIRE(ingest.get_results()[1].ec == make_error_code(errc::trace_read_failed));
+        REQUIRE(ingest.num_buckets() == 3);
+        REQUIRE(ingest.get_bucket(0)[0].sum == 100);
+    }
+}
+
+} // namespace hwcpipe
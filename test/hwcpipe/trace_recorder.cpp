@@ -0,0 +1,663 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hwcpipe/hwcpipe_counter.h"
+#include "mock/backend_manual_sampler.hpp"
+#include "mock/backend_periodic_sampler.hpp"
+#include "mock/backend_sample.hpp"
+#include "mock/handle.hpp"
+#include "mock/instance.hpp"
+#include "mock/mock_helper.h"
+
+#include <catch2/catch.hpp>
+
+#include <hwcpipe/detail/async_file_writer.hpp>
+#include <hwcpipe/detail/column_codec.hpp>
+#include <hwcpipe/error.hpp>
+#include <hwcpipe/sampler.hpp>
+#include <hwcpipe/trace_recorder.hpp>
+
+#include <array>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace hwcpipe {
+
+namespace {
+using namespace hwcpipe::mock;
+
+std::array<uint32_t, 64> values_fe{};
+std::array<uint32_t, 64> values_tiler{};
+std::array<uint32_t, 64> values_core_0{};
+std::array<uint32_t, 64> values_core_1{};
+
+/** Sample with two shader cores, whose metadata can be set by the test. */
+class trace_sample_mock {
+  public:
+    trace_sample_mock(reader_mock &reader, std::error_code &ec) {
+        if (!reader.is_valid()) {
+            ec = std::make_error_code(std::errc::invalid_argument);
+        }
+    }
+
+    const sample_metadata &get_metadata() const { return metadata; }
+    const std::array<block_metadata, 4> &blocks() const { return sample_blocks; }
+
+    static sample_metadata metadata;
+    static std::array<block_metadata, 4> sample_blocks;
+};
+
+sample_metadata trace_sample_mock::metadata{};
+std::array<block_metadata, 4> trace_sample_mock::sample_blocks{{
+    {device::hwcnt::block_type::fe, values_fe.data(), 0},
+    {device::hwcnt::block_type::tiler, values_tiler.data(), 0},
+    {device::hwcnt::block_type::core, values_core_0.data(), 0},
+    {device::hwcnt::block_type::core, values_core_1.data(), 1},
+}};
+
+struct trace_mock_policy {
+    using handle_type = hwcpipe::mock::handle_mock;
+    using instance_type = hwcpipe::mock::instance_mock;
+    using sampler_type = hwcpipe::mock::backend_manual_sampler_mock;
+    using periodic_sampler_type = hwcpipe::mock::backend_periodic_sampler_mock;
+    using sample_type = trace_sample_mock;
+};
+
+using sampler_t = hwcpipe::sampler<trace_mock_policy>;
+
+std::string temporary_path(const char *name) {
+    return "/tmp/hwcpipe-" + std::to_string(::getpid()) + "-" + name + ".hwct";
+}
+
+std::vector<char> read_file(const std::string &path) {
+    std::ifstream file(path, std::ios::binary);
+    return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+}
+
+/** Removes a file when the test ends. */
+class file_remover {
+  public:
+    explicit file_remover(std::string path)
+        : path_(std::move(path)) {}
+    ~file_remover() { std::remove(path_.c_str()); }
+
+  private:
+    std::string path_;
+};
+
+/** Enters an io_uring, faulting the first calls. */
+struct io_uring_enter_faults {
+    /** Faults the next @p calls, or every call if negative. An @p error of zero submits nothing. */
+    static void set(int calls, int error) {
+        num_calls() = calls;
+        fault_error() = error;
+    }
+
+    static long enter(int ring_fd, unsigned to_submit, unsigned min_complete, unsigned flags) {
+        if (num_calls() != 0) {
+            if (num_calls() > 0) {
+                --num_calls();
+            }
+            if (fault_error() != 0) {
+                errno = fault_error();
+                return -1;
+            }
+            // the kernel is short of submission resources, and returns at once
+            to_submit = 0;
+            min_complete = 0;
+        }
+        return ::syscall(__NR_io_uring_enter, ring_fd, to_submit, min_complete, flags, nullptr, 0U);
+    }
+
+  private:
+    static int &num_calls() {
+        static int value{};
+        return value;
+    }
+    static int &fault_error() {
+        static int value{};
+        return value;
+    }
+};
+
+/** Writes five blocks of 100 bytes, last block first, and drains the writer. */
+void write_blocks(detail::async_file_writer &writer) {
+    for (size_t i = 0; i != 5; ++i) {
+        char *buffer = nullptr;
+        REQUIRE(!writer.acquire(buffer));
+        REQUIRE(buffer != nullptr);
+        std::memset(buffer, 'a' + static_cast<int>(i), 100);
+        REQUIRE(!writer.submit(buffer, 100, (4 - i) * 100));
+    }
+    REQUIRE(!writer.drain());
+}
+} // namespace
+
+TEST_CASE("trace_recorder__RecordsRawBlockValues") {
+    const auto path = temporary_path("raw");
+    file_remover remover(path);
+
+    const block_extents_guard extents_guard;
+    block_extents_mock::num_blocks() = 2;
+    device::constants constants{};
+    constants.gpu_id = 0x7093;
+    constants.num_shader_cores = 2;
+
+    sampler_config config(device::product_id::g31, 0);
+    REQUIRE(!config.add_counter(MaliGPUActiveCy));   // fe 6
+    REQUIRE(!config.add_counter(MaliTilerActiveCy)); // tiler 4
+    REQUIRE(!config.add_counter(MaliTilerUtil));     // expression, not recorded
+    config.set_thread_config({0x6, device::hwcnt::sampler::sched_class::fifo, 10});
+
+    const block_extents_mock extents{};
+    std::error_code ec;
+    {
+        trace_recorder recorder(path, config, constants, extents, 2);
+        REQUIRE(recorder);
+
+        // one column per counter and block instance
+        REQUIRE(recorder.num_columns() == 4);
+        REQUIRE(recorder.get_column(0).counter == MaliGPUActiveCy);
+        REQUIRE(recorder.get_column(1).block_index == 1);
+        REQUIRE(recorder.get_column(2).counter == MaliTilerActiveCy);
+        REQUIRE(recorder.get_column(2).offset == 4);
+
+        reader_mock reader{};
+        trace_sample_mock sample(reader, ec);
+        for (uint64_t i = 0; i != 3; ++i) {
+            values_fe[6] = static_cast<uint32_t>(100 + i);
+            values_tiler[4] = static_cast<uint32_t>(200 + i);
+            trace_sample_mock::metadata = {};
+            trace_sample_mock::metadata.sample_nr = i;
+            trace_sample_mock::metadata.timestamp_ns_begin = i * 1000;
+            trace_sample_mock::metadata.timestamp_ns_end = i * 1000 + 999;
+            trace_sample_mock::metadata.gpu_cycle = 50 + i;
+            trace_sample_mock::metadata.flags.stretched = i == 2 ? 1 : 0;
+            REQUIRE(!recorder.record(sample));
+        }
+        REQUIRE(recorder.num_records() == 3);
+
+        // the first batch is on disk, the third record is still buffered
+        const auto written = read_file(path);
+        const trace_reader partial(written.data(), written.size());
+        REQUIRE(partial);
+        REQUIRE(partial.num_records() == 2);
+    }
+
+    const auto contents = read_file(path);
+    const trace_reader reader(contents.data(), contents.size());
+    REQUIRE(reader);
+    REQUIRE(reader.header().constants.gpu_id == 0x7093);
+    REQUIRE(reader.header().value_size == 4);
+    REQUIRE(reader.header().counters_per_block == block_extents_mock::num_counters_per_block());
+    REQUIRE(reader.header().num_blocks_of_type[static_cast<size_t>(device::hwcnt::block_type::core)] == 2);
+    REQUIRE(reader.header().version_minor == trace_layout::version_minor);
+    REQUIRE(reader.header().cpu_mask == 0x6);
+    REQUIRE(reader.header().sched_class == static_cast<uint32_t>(device::hwcnt::sampler::sched_class::fifo));
+    REQUIRE(reader.header().sched_priority == 10);
+    REQUIRE(reader.num_columns() == 4);
+    REQUIRE(reader.num_records() == 3);
+
+    for (size_t i = 0; i != 3; ++i) {
+        const auto record = reader.get_record(i);
+        REQUIRE(record.sample_nr == i);
+        REQUIRE(record.timestamp_ns_begin == i * 1000);
+        REQUIRE(record.timestamp_ns_end == i * 1000 + 999);
+        REQUIRE(record.gpu_cycle == 50 + i);
+        REQUIRE(record.flags == (i == 2 ? trace_layout::flag_stretched : 0U));
+
+        REQUIRE(reader.get_value(i, 0) == 100 + i);
+        REQUIRE(reader.get_value(i, 2) == 200 + i);
+        // the sample has a single tiler and front end block
+        REQUIRE(reader.get_value(i, 1) == 0);
+        REQUIRE(reader.get_value(i, 3) == 0);
+
+        // the raw records are read in place
+        const char *record_data = reader.get_raw_records() + i * reader.header().record_size;
+        uint32_t value{};
+        std::memcpy(&value, record_data + sizeof(trace_layout::record_header) + 2 * sizeof(uint32_t), sizeof(value));
+        REQUIRE(value == 200 + i);
+    }
+}
+
+TEST_CASE("trace_recorder__SamplerFeedsRecorder") {
+    const auto path = temporary_path("sampler");
+    file_remover remover(path);
+
+    sampler_config config(device::product_id::g31, 0);
+    REQUIRE(!config.add_counter(MaliGPUActiveCy));
+
+    sampler_t sampler(config);
+    REQUIRE(sampler);
+    trace_recorder recorder(path, config, sampler.get_constants(), sampler.get_block_extents());
+    REQUIRE(recorder);
+    sampler.set_trace_recorder(&recorder);
+
+    REQUIRE(!sampler.start_sampling());
+    trace_sample_mock::metadata = {};
+    values_fe[6] = 7;
+    REQUIRE(!sampler.sample_now());
+
+    // flagged samples are recorded, but not decoded
+    trace_sample_mock::metadata.flags.error = 1;
+    REQUIRE(sampler.sample_now() == make_error_code(errc::sample_collection_failure));
+    REQUIRE(recorder.num_records() == 2);
+
+    sampler.set_trace_recorder<trace_recorder>(nullptr);
+    trace_sample_mock::metadata = {};
+    REQUIRE(!sampler.sample_now());
+    REQUIRE(recorder.num_records() == 2);
+    REQUIRE(!sampler.stop_sampling());
+
+    REQUIRE(!recorder.flush());
+    const auto contents = read_file(path);
+    const trace_reader reader(contents.data(), contents.size());
+    REQUIRE(reader.num_records() == 2);
+    REQUIRE(reader.get_value(0, 0) == 7);
+    REQUIRE(reader.get_record(1).flags == trace_layout::flag_error);
+}
+
+TEST_CASE("column_codec__RoundTrip") {
+    namespace codec = detail::column_codec;
+
+    const auto round_trip = [](const std::vector<uint64_t> &values) {
+        std::vector<uint8_t> encoded(codec::max_encoded_size(values.size()));
+        const size_t size = codec::encode(values.data(), values.size(), encoded.data());
+        REQUIRE(size <= encoded.size());
+
+        std::vector<uint64_t> decoded(values.size());
+        const uint8_t *end = encoded.data() + size;
+        REQUIRE(codec::decode(encoded.data(), end, values.size(), decoded.data()) == end);
+        REQUIRE(decoded == values);
+
+        // truncated columns are rejected
+        REQUIRE(codec::decode(encoded.data(), end - 1, values.size(), decoded.data()) == nullptr);
+        return size;
+    };
+
+    SECTION("Constant column is a few bytes") {
+        REQUIRE(round_trip(std::vector<uint64_t>(1000, 123456)) <= 5);
+    }
+
+    SECTION("Single value") { round_trip({~uint64_t{0}}); }
+
+    SECTION("Slowly changing values are packed") {
+        std::vector<uint64_t> values{};
+        for (uint64_t i = 0; i != 1000; ++i) {
+            values.push_back(1000000 + i * 3 - (i % 2));
+        }
+        REQUIRE(round_trip(values) < 1000);
+    }
+
+    SECTION("Decreasing and wrapping values") {
+        round_trip({0, ~uint64_t{0}, 5, 0xFFFFFFFFU, 0, uint64_t{1} << 63U, 7, 7, 6});
+    }
+
+    SECTION("Sparse bursts use varints") {
+        std::vector<uint64_t> values(1000, 0);
+        values[500] = uint64_t{1} << 40U;
+        REQUIRE(round_trip(values) < 1100);
+    }
+}
+
+TEST_CASE("trace_recorder__DeltaEncoding") {
+    const auto raw_path = temporary_path("raw-encoding");
+    const auto delta_path = temporary_path("delta-encoding");
+    file_remover raw_remover(raw_path);
+    file_remover delta_remover(delta_path);
+
+    const block_extents_guard extents_guard;
+    block_extents_mock::num_blocks() = 2;
+    sampler_config config(device::product_id::g31, 0);
+    REQUIRE(!config.add_counter(MaliGPUActiveCy));
+    REQUIRE(!config.add_counter(MaliTilerActiveCy));
+    REQUIRE(!config.add_counter(MaliFragActiveCy));
+
+    static constexpr uint64_t num_samples = 1000;
+    const block_extents_mock extents{};
+    {
+        trace_recorder raw(raw_path, config, device::constants{}, extents, 128);
+        trace_recorder delta(delta_path, config, device::constants{}, extents, 128, trace_encoding::delta);
+        REQUIRE(raw);
+        REQUIRE(delta);
+
+        std::error_code ec;
+        reader_mock reader{};
+        trace_sample_mock sample(reader, ec);
+        values_tiler[4] = 0; // an idle tiler
+        for (uint64_t i = 0; i != num_samples; ++i) {
+            values_fe[6] = static_cast<uint32_t>(1000000 + (i % 7));
+            trace_sample_mock::metadata = {};
+            trace_sample_mock::metadata.sample_nr = i;
+            trace_sample_mock::metadata.timestamp_ns_begin = i * 1000000;
+            trace_sample_mock::metadata.timestamp_ns_end = i * 1000000 + 999999;
+            trace_sample_mock::metadata.flags.error = i == 500 ? 1 : 0;
+            REQUIRE(!raw.record(sample));
+            REQUIRE(!delta.record(sample));
+        }
+    }
+
+    const auto raw_contents = read_file(raw_path);
+    const auto delta_contents = read_file(delta_path);
+    REQUIRE(delta_contents.size() * 4 < raw_contents.size());
+
+    const trace_reader raw(raw_contents.data(), raw_contents.size());
+    const trace_reader delta(delta_contents.data(), delta_contents.size());
+    REQUIRE(raw);
+    REQUIRE(delta);
+    REQUIRE(delta.header().version_major == trace_layout::chunked_version_major);
+    REQUIRE(delta.get_encoding() == trace_encoding::delta);
+    REQUIRE(delta.get_raw_records() == nullptr);
+    REQUIRE(delta.num_records() == num_samples);
+    REQUIRE(delta.num_columns() == raw.num_columns());
+
+    bool same = true;
+    for (size_t i = 0; i != num_samples; ++i) {
+        const auto raw_record = raw.get_record(i);
+        const auto delta_record = delta.get_record(i);
+        same = same && raw_record.sample_nr == delta_record.sample_nr &&
+               raw_record.timestamp_ns_begin == delta_record.timestamp_ns_begin &&
+               raw_record.timestamp_ns_end == delta_record.timestamp_ns_end && raw_record.flags == delta_record.flags;
+        for (size_t column = 0; column != raw.num_columns(); ++column) {
+            same = same && raw.get_value(i, column) == delta.get_value(i, column);
+        }
+    }
+    REQUIRE(same);
+
+    // random access moves the chunk cache back
+    REQUIRE(delta.get_record(3).sample_nr == 3);
+    REQUIRE(delta.get_record(500).flags == trace_layout::flag_error);
+
+    // the index seeks to the chunk of a timestamp
+    REQUIRE(delta.has_index());
+    REQUIRE(!raw.has_index());
+    for (const trace_reader *reader : {&raw, &delta}) {
+        REQUIRE(reader->find_record(0) == 0);
+        REQUIRE(reader->find_record(300 * 1000000) == 300);
+        REQUIRE(reader->find_record(300 * 1000000 + 1) == 301);
+        REQUIRE(reader->find_record(896 * 1000000) == 896);
+        REQUIRE(reader->find_record(999 * 1000000) == 999);
+        REQUIRE(reader->find_record(num_samples * 1000000) == num_samples);
+    }
+
+    // the file can be read through a mapping
+    const trace_file file(delta_path);
+    REQUIRE(file);
+    REQUIRE(!file.get_error());
+    REQUIRE(file.get_reader().has_index());
+    REQUIRE(file.get_reader().num_records() == num_samples);
+    REQUIRE(file.get_reader().get_record(file.get_reader().find_record(642 * 1000000)).sample_nr == 642);
+
+    // without the trailer the chunks are walked
+    const trace_reader no_trailer(delta_contents.data(), delta_contents.size() - 1);
+    REQUIRE(no_trailer);
+    REQUIRE(!no_trailer.has_index());
+    REQUIRE(no_trailer.num_records() == num_samples);
+    REQUIRE(no_trailer.find_record(642 * 1000000) == 642);
+
+    // a partial chunk at the end of the file is ignored
+    trace_layout::index_trailer trailer{};
+    std::memcpy(&trailer, delta_contents.data() + delta_contents.size() - sizeof(trailer), sizeof(trailer));
+    REQUIRE(trailer.magic == trace_layout::index_magic);
+    REQUIRE(trailer.num_entries == (num_samples + 127) / 128);
+    const trace_reader truncated(delta_contents.data(), trailer.index_offset - 1);
+    REQUIRE(truncated);
+    REQUIRE(truncated.num_records() < num_samples);
+    REQUIRE(truncated.num_records() % 128 == 0);
+}
+
+TEST_CASE("trace_recorder__Errors") {
+    sampler_config config(device::product_id::g31, 0);
+    REQUIRE(!config.add_counter(MaliGPUActiveCy));
+    const block_extents_mock extents{};
+
+    SECTION("Unwritable path") {
+        trace_recorder recorder("/nonexistent/directory/trace.hwct", config, device::constants{}, extents);
+        REQUIRE(recorder.get_error() == make_error_code(errc::trace_write_failed));
+
+        std::error_code ec;
+        reader_mock reader{};
+        trace_sample_mock sample(reader, ec);
+        REQUIRE(recorder.record(sample) == make_error_code(errc::trace_write_failed));
+    }
+
+    SECTION("Missing file") {
+        const trace_file file("/nonexistent/directory/trace.hwct");
+        REQUIRE(!file);
+        REQUIRE(file.get_error() == make_error_code(errc::trace_read_failed));
+    }
+
+    SECTION("Closed recorder") {
+        const auto path = temporary_path("closed");
+        file_remover remover(path);
+        trace_recorder recorder(path, config, device::constants{}, extents);
+        REQUIRE(!recorder.close());
+
+        std::error_code ec;
+        reader_mock reader{};
+        trace_sample_mock sample(reader, ec);
+        REQUIRE(recorder.record(sample) == make_error_code(errc::trace_write_failed));
+    }
+
+    SECTION("Invalid layout") {
+        const auto path = temporary_path("layout");
+        file_remover remover(path);
+        { trace_recorder recorder(path, config, device::constants{}, extents); }
+
+        auto contents = read_file(path);
+        REQUIRE(trace_reader(contents.data(), contents.size()));
+        REQUIRE(!trace_reader(contents.data(), sizeof(trace_layout::file_header) - 1));
+
+        // a version 1.0 header is shorter and has no thread configuration
+        auto *header = reinterpret_cast<trace_layout::file_header *>(contents.data());
+        header->header_size = trace_layout::base_header_size;
+        header->cpu_mask = 1;
+        const trace_reader legacy(contents.data(), contents.size());
+        REQUIRE(legacy);
+        REQUIRE(legacy.header().cpu_mask == 0);
+
+        header->header_size = trace_layout::base_header_size - 1;
+        REQUIRE(!trace_reader(contents.data(), contents.size()));
+
+        header->header_size = sizeof(trace_layout::file_header);
+        header->magic = 0;
+        REQUIRE(trace_reader(contents.data(), contents.size()).get_error() ==
+                make_error_code(errc::invalid_trace_layout));
+    }
+}
+
+TEST_CASE("trace_recorder__AsyncWrites") {
+    const auto encoding = GENERATE(trace_encoding::raw, trace_encoding::delta);
+    const auto blocking_path = temporary_path("blocking-writes");
+    const auto async_path = temporary_path("async-writes");
+    file_remover blocking_remover(blocking_path);
+    file_remover async_remover(async_path);
+
+    sampler_config config(device::product_id::g31, 0);
+    REQUIRE(!config.add_counter(MaliGPUActiveCy));
+    REQUIRE(!config.add_counter(MaliTilerActiveCy));
+
+    // more batches than buffers, so that buffers are recycled
+    static constexpr uint64_t num_samples = 1000;
+    const block_extents_mock extents{};
+    {
+        trace_recorder blocking(blocking_path, config, device::constants{}, extents, 16, encoding);
+        trace_recorder async(async_path, config, device::constants{}, extents, 16, encoding, trace_write_mode::async);
+        REQUIRE(blocking);
+        REQUIRE(async);
+
+        std::error_code ec;
+        reader_mock reader{};
+        trace_sample_mock sample(reader, ec);
+        bool recorded = true;
+        for (uint64_t i = 0; i != num_samples; ++i) {
+            values_fe[6] = static_cast<uint32_t>(1000 + i * 3);
+            values_tiler[4] = static_cast<uint32_t>(i % 5);
+            trace_sample_mock::metadata = {};
+            trace_sample_mock::metadata.sample_nr = i;
+            trace_sample_mock::metadata.timestamp_ns_begin = i * 100000;
+            trace_sample_mock::metadata.timestamp_ns_end = i * 100000 + 99999;
+            recorded = recorded && !blocking.record(sample) && !async.record(sample);
+        }
+        REQUIRE(recorded);
+        REQUIRE(!async.flush());
+        REQUIRE(!async.close());
+        REQUIRE(async.record(sample) == make_error_code(errc::trace_write_failed));
+    }
+
+    // the chunks land at the offsets they would have been written at
+    const auto blocking_contents = read_file(blocking_path);
+    const auto async_contents = read_file(async_path);
+    REQUIRE(blocking_contents == async_contents);
+
+    const trace_reader reader(async_contents.data(), async_contents.size());
+    REQUIRE(reader);
+    REQUIRE(reader.num_records() == num_samples);
+    REQUIRE(reader.get_value(num_samples - 1, 0) == 1000 + (num_samples - 1) * 3);
+}
+
+TEST_CASE("async_file_writer__WritesBuffers") {
+    const bool allow_io_uring = GENERATE(false, true);
+    const auto path = temporary_path("async-file-writer");
+    file_remover remover(path);
+
+    const int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    REQUIRE(fd >= 0);
+
+    SECTION("Buffers are recycled once written") {
+        {
+            detail::async_file_writer writer(fd, 100, 2, allow_io_uring);
+            REQUIRE(writer);
+            REQUIRE(writer.buffer_size() == 100);
+            REQUIRE(writer.num_buffers() == 2);
+            if (!allow_io_uring) {
+                REQUIRE(writer.get_backend() == detail::async_file_writer::backend::thread);
+            }
+
+            // last block first, so that the writes complete out of file order
+            for (size_t i = 0; i != 5; ++i) {
+                char *buffer = nullptr;
+                REQUIRE(!writer.acquire(buffer));
+                REQUIRE(buffer != nullptr);
+                std::memset(buffer, 'a' + static_cast<int>(i), 100);
+                REQUIRE(!writer.submit(buffer, 100, (4 - i) * 100));
+            }
+            REQUIRE(!writer.drain());
+        }
+
+        const auto contents = read_file(path);
+        REQUIRE(contents.size() == 500);
+        for (size_t i = 0; i != 5; ++i) {
+            REQUIRE(contents[i * 100] == 'a' + static_cast<int>(4 - i));
+            REQUIRE(contents[i * 100 + 99] == 'a' + static_cast<int>(4 - i));
+        }
+    }
+
+    SECTION("Write errors are reported") {
+        const int read_only = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        REQUIRE(read_only >= 0);
+        {
+            detail::async_file_writer writer(read_only, 100, 2, allow_io_uring);
+            char *buffer = nullptr;
+            REQUIRE(!writer.acquire(buffer));
+            // the write fails in the background
+            REQUIRE(!writer.submit(buffer, 100, 0));
+            REQUIRE(writer.drain() == make_error_code(errc::trace_write_failed));
+            REQUIRE(writer.acquire(buffer) == make_error_code(errc::trace_write_failed));
+        }
+        ::close(read_only);
+    }
+
+    ::close(fd);
+}
+
+TEST_CASE("async_file_writer__IoUringFaults") {
+    const auto path = temporary_path("async-file-writer-faults");
+    file_remover remover(path);
+
+    const int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    REQUIRE(fd >= 0);
+
+    SECTION("Transient errors are retried") {
+        const int error = GENERATE(EINTR, EAGAIN, EBUSY);
+        io_uring_enter_faults::set(3, error);
+        {
+            detail::async_file_writer writer(fd, 100, 2, true, &io_uring_enter_faults::enter);
+            if (writer.get_backend() != detail::async_file_writer::backend::io_uring) {
+                WARN("io_uring is not available");
+                ::close(fd);
+                return;
+            }
+            write_blocks(writer);
+        }
+
+        const auto contents = read_file(path);
+        REQUIRE(contents.size() == 500);
+        for (size_t i = 0; i != 5; ++i) {
+            REQUIRE(contents[i * 100] == 'a' + static_cast<int>(4 - i));
+        }
+    }
+
+    SECTION("Writes the kernel did not consume stay in flight") {
+        io_uring_enter_faults::set(3, 0);
+        {
+            detail::async_file_writer writer(fd, 100, 2, true, &io_uring_enter_faults::enter);
+            if (writer.get_backend() != detail::async_file_writer::backend::io_uring) {
+                WARN("io_uring is not available");
+                ::close(fd);
+                return;
+            }
+            // a recycled buffer would be overwritten before its write is submitted
+            write_blocks(writer);
+        }
+
+        const auto contents = read_file(path);
+        REQUIRE(contents.size() == 500);
+        for (size_t i = 0; i != 5; ++i) {
+            REQUIRE(contents[i * 100] == 'a' + static_cast<int>(4 - i));
+            REQUIRE(contents[i * 100 + 99] == 'a' + static_cast<int>(4 - i));
+        }
+    }
+
+    SECTION("A failed ring keeps the buffers in flight") {
+        io_uring_enter_faults::set(-1, EIO);
+        {
+            detail::async_file_writer writer(fd, 100, 2, true, &io_uring_enter_faults::enter);
+            if (writer.get_backend() != detail::async_file_writer::backend::io_uring) {
+                WARN("io_uring is not available");
+                ::close(fd);
+                return;
+            }
+            char *buffer = nullptr;
+            REQUIRE(!writer.acquire(buffer));
+            REQUIRE(writer.submit(buffer, 100, 0) == make_error_code(errc::trace_write_failed));
+
+            // the buffer is never handed out again, and drain() doesn't wait for a completion that can't come
+            char *next = nullptr;
+            REQUIRE(writer.acquire(next) == make_error_code(errc::trace_write_failed));
+            REQUIRE(next == nullptr);
+            REQUIRE(writer.drain() == make_error_code(errc::trace_write_failed));
+        }
+        REQUIRE(read_file(path).empty());
+    }
+
+    io_uring_enter_faults::set(0, 0);
+    ::close(fd);
+}
+
+} // namespace hwcpipe
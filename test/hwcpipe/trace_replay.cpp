@@ -0,0 +1,237 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hwcpipe/hwcpipe_counter.h"
+
+#include <catch2/catch.hpp>
+
+#include <hwcpipe/error.hpp>
+#include <hwcpipe/sampler.hpp>
+#include <hwcpipe/trace_recorder.hpp>
+#include <hwcpipe/trace_replay.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <unistd.h>
+
+namespace hwcpipe {
+
+namespace {
+namespace hwcnt = device::hwcnt;
+
+constexpr uint16_t counters_per_block = 64;
+
+// a G31 with two shader cores
+constexpr uint64_t g31_gpu_id = 0x70030000;
+
+/** A recorded sample: every value depends on its offset, block and sample number. */
+class replay_test_sample {
+  public:
+    replay_test_sample() {
+        for (size_t i = 0; i != blocks_.size(); ++i) {
+            blocks_[i].values = values_[i].data();
+        }
+    }
+
+    void set(uint64_t sample_nr) {
+        metadata_ = {};
+        metadata_.sample_nr = sample_nr;
+        metadata_.timestamp_ns_begin = sample_nr * 1000;
+        metadata_.timestamp_ns_end = sample_nr * 1000 + 999;
+        metadata_.flags.error = sample_nr == 5 ? 1 : 0;
+        for (size_t i = 0; i != blocks_.size(); ++i) {
+            for (size_t offset = 0; offset != counters_per_block; ++offset) {
+                values_[i][offset] = value(blocks_[i].index, offset, sample_nr);
+            }
+        }
+    }
+
+    static uint32_t value(size_t block_index, size_t offset, uint64_t sample_nr) {
+        return static_cast<uint32_t>((offset + 1) * (sample_nr + 1) + block_index * 1000);
+    }
+
+    const hwcnt::sample_metadata &get_metadata() const { return metadata_; }
+    const std::array<hwcnt::block_metadata, 4> &blocks() const { return blocks_; }
+
+  private:
+    hwcnt::sample_metadata metadata_{};
+    std::array<std::array<uint32_t, counters_per_block>, 4> values_{};
+    std::array<hwcnt::block_metadata, 4> blocks_{{
+        {hwcnt::block_type::fe, 0, hwcnt::prfcnt_set::primary, {}, nullptr},
+        {hwcnt::block_type::tiler, 0, hwcnt::prfcnt_set::primary, {}, nullptr},
+        {hwcnt::block_type::core, 0, hwcnt::prfcnt_set::primary, {}, nullptr},
+        {hwcnt::block_type::core, 1, hwcnt::prfcnt_set::primary, {}, nullptr},
+    }};
+};
+
+hwcnt::block_extents make_extents() {
+    hwcnt::block_extents::num_blocks_of_type_type num_blocks{};
+    num_blocks[static_cast<size_t>(hwcnt::block_type::fe)] = 1;
+    num_blocks[static_cast<size_t>(hwcnt::block_type::tiler)] = 1;
+    num_blocks[static_cast<size_t>(hwcnt::block_type::core)] = 2;
+    return {num_blocks, counters_per_block, hwcnt::sample_values_type::uint32};
+}
+
+/** Returns the offset of a recorded counter. */
+size_t recorded_offset(const trace_reader &reader, hwcpipe_counter counter) {
+    for (size_t i = 0; i != reader.num_columns(); ++i) {
+        if (reader.get_column(i).counter == static_cast<uint32_t>(counter)) {
+            return reader.get_column(i).offset;
+        }
+    }
+    FAIL("The counter was not recorded");
+    return 0;
+}
+
+/** Removes a file when the test ends. */
+class file_remover {
+  public:
+    explicit file_remover(std::string path)
+        : path_(std::move(path)) {}
+    ~file_remover() { std::remove(path_.c_str()); }
+
+  private:
+    std::string path_;
+};
+} // namespace
+
+TEST_CASE("trace_replay__SamplerDecodesRecordedTrace") {
+    const auto path = "/tmp/hwcpipe-" + std::to_string(::getpid()) + "-replay.hwct";
+    file_remover remover(path);
+
+    sampler_config recorded_config(device::product_id::g31, 0);
+    REQUIRE(!recorded_config.add_counter(MaliGPUActiveCy));
+    REQUIRE(!recorded_config.add_counter(MaliFragActiveCy));
+    REQUIRE(!recorded_config.add_counter(MaliTilerActiveCy));
+
+    static constexpr uint64_t num_samples = 20;
+    const auto encoding = GENERATE(trace_encoding::raw, trace_encoding::delta);
+    {
+        device::constants constants{};
+        constants.gpu_id = g31_gpu_id;
+        constants.num_shader_cores = 2;
+        trace_recorder recorder(path, recorded_config, constants, make_extents(), 8, encoding);
+        REQUIRE(recorder);
+
+        replay_test_sample sample;
+        for (uint64_t i = 0; i != num_samples; ++i) {
+            sample.set(i);
+            REQUIRE(!recorder.record(sample));
+        }
+        REQUIRE(!recorder.close());
+    }
+
+    const trace_file file(path);
+    REQUIRE(file);
+    trace_replay replay(file.get_reader(), 3);
+    REQUIRE(replay);
+
+    device::product_id pid{};
+    REQUIRE(!replay.get_product_id(pid));
+    REQUIRE(pid == device::product_id::g31);
+    REQUIRE(replay.get_constants().num_shader_cores == 2);
+    REQUIRE(replay.get_block_extents().num_blocks_of_type(hwcnt::block_type::core) == 2);
+
+    const auto gpu_offset = recorded_offset(file.get_reader(), MaliGPUActiveCy);
+    const auto frag_offset = recorded_offset(file.get_reader(), MaliFragActiveCy);
+
+    SECTION("Manual sampler") {
+        sampler_config config(pid, replay.get_device_number());
+        REQUIRE(!config.add_counter(MaliGPUActiveCy));
+        REQUIRE(!config.add_counter(MaliFragActiveCy));
+        size_t share{};
+        REQUIRE(!config.add_custom_counter("MaliFragActiveCy / MaliGPUActiveCy", share));
+
+        sampler<trace_replay_policy> sampler(config);
+        REQUIRE(sampler);
+        REQUIRE(sampler.try_collect() == make_error_code(errc::sampling_not_started));
+        REQUIRE(!sampler.start_sampling());
+
+        // nothing was requested yet
+        REQUIRE(sampler.try_collect() == make_error_code(errc::sample_not_ready));
+
+        for (uint64_t i = 0; i != num_samples; ++i) {
+            const auto ec = sampler.sample_now();
+            if (i == 5) {
+                // the sample was recorded with an error
+                REQUIRE(ec == make_error_code(errc::sample_collection_failure));
+                continue;
+            }
+            REQUIRE(!ec);
+            REQUIRE(sampler.get_sample_timestamp() == i * 1000);
+
+            counter_sample value;
+            REQUIRE(!sampler.get_counter_value(MaliGPUActiveCy, value));
+            REQUIRE(value.value.uint64 == replay_test_sample::value(0, gpu_offset, i));
+
+            // the shader cores are summed
+            const uint64_t frag =
+                replay_test_sample::value(0, frag_offset, i) + replay_test_sample::value(1, frag_offset, i);
+            REQUIRE(!sampler.get_counter_value(MaliFragActiveCy, value));
+            REQUIRE(value.value.uint64 == frag);
+
+            double custom{};
+            REQUIRE(!sampler.get_custom_counter_value(share, custom));
+            REQUIRE(custom == Approx(static_cast<double>(frag) / replay_test_sample::value(0, gpu_offset, i)));
+        }
+
+        REQUIRE(replay.at_end());
+        REQUIRE(sampler.sample_now() == make_error_code(errc::sample_collection_failure));
+
+        // seeking replays part of the trace again
+        replay.seek(12 * 1000 + 1);
+        REQUIRE(replay.position() == 13);
+        REQUIRE(!sampler.sample_now());
+        REQUIRE(sampler.get_sample_timestamp() == 13 * 1000);
+        REQUIRE(!sampler.stop_sampling());
+    }
+
+    SECTION("Periodic sampler") {
+        sampler_config config(pid, replay.get_device_number());
+        REQUIRE(!config.add_counter(MaliTilerActiveCy));
+        config.set_sampling_period(1000000);
+
+        sampler<trace_replay_policy> sampler(config);
+        REQUIRE(sampler);
+        REQUIRE(!sampler.start_sampling());
+
+        size_t collected = 0;
+        while (!replay.at_end()) {
+            if (!sampler.try_collect()) {
+                ++collected;
+            }
+        }
+        REQUIRE(collected == num_samples - 1);
+        REQUIRE(sampler.try_collect() == make_error_code(errc::sample_not_ready));
+        REQUIRE(!sampler.stop_sampling());
+    }
+
+    SECTION("Counters that were not recorded") {
+        sampler_config config(pid, replay.get_device_number());
+        REQUIRE(!config.add_counter(MaliCoreActiveCy));
+
+        sampler<trace_replay_policy> sampler(config);
+        REQUIRE(sampler.start_sampling() == make_error_code(errc::backend_sampler_failure));
+    }
+
+    SECTION("Device numbers") {
+        trace_replay duplicate(file.get_reader(), 3);
+        REQUIRE(duplicate.get_error() == make_error_code(errc::trace_replay_in_use));
+
+        sampler_config config(pid, 4);
+        REQUIRE(!config.add_counter(MaliGPUActiveCy));
+        sampler<trace_replay_policy> sampler(config);
+        REQUIRE(sampler.start_sampling() == make_error_code(errc::backend_creation_failed));
+    }
+}
+
+} // namespace hwcpipe
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hwcpipe/error.hpp"
+#include "hwcpipe/triggered_capture.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <system_error>
+#include <vector>
+
+namespace hwcpipe {
+
+namespace {
+
+/** Sink stand-in that keeps the begin timestamps and values of the samples. */
+struct sink_stub {
+    std::error_code push(uint64_t timestamp_ns_begin, uint64_t, const double *values) {
+        timestamps.push_back(timestamp_ns_begin);
+        this->values.push_back(values[0]);
+        return error;
+    }
+
+    std::vector<uint64_t> timestamps{};
+    std::vector<double> values{};
+    std::error_code error{};
+};
+
+/** Pushes a sample whose timestamp and value are @p i, and that fires the trigger if @p triggered. */
+std::error_code push(triggered_capture &capture, sink_stub &sink, uint64_t i, bool triggered = false) {
+    const double value = static_cast<double>(i);
+    return capture.push(i, i + 1, &value, triggered, sink);
+}
+
+/** Sampler stand-in for triggered_capture::push(sampler, list, sink). */
+struct sampler_stub {
+    std::error_code get_counter_values(int list, double *values, size_t count) const {
+        if (list < 0 || count < 1) {
+            return make_error_code(errc::invalid_read_list);
+        }
+        values[0] = list;
+        return {};
+    }
+    uint64_t get_sample_timestamp() const { return 1000; }
+    uint64_t get_sample_timestamp_end() const { return 2000; }
+    bool is_triggered() const { return triggered; }
+
+    bool triggered{};
+};
+
+} // namespace
+
+TEST_CASE("TriggeredCapture___Push___WritesTheWindowsAroundTheTrigger") {
+    triggered_capture capture(3, 2, 1);
+    sink_stub sink{};
+
+    for (uint64_t i = 0; i != 10; ++i) {
+        REQUIRE(!push(capture, sink, i));
+    }
+    REQUIRE(sink.timestamps.empty());
+    REQUIRE(!capture.is_capturing());
+
+    REQUIRE(!push(capture, sink, 10, true));
+    REQUIRE(capture.is_capturing());
+    REQUIRE(sink.timestamps == std::vector<uint64_t>{7, 8, 9, 10});
+
+    for (uint64_t i = 11; i != 20; ++i) {
+        REQUIRE(!push(capture, sink, i));
+    }
+    REQUIRE(!capture.is_capturing());
+    REQUIRE(sink.timestamps == std::vector<uint64_t>{7, 8, 9, 10, 11, 12});
+    REQUIRE(sink.values.back() == 12.0);
+
+    SECTION("A trigger during the capture extends it") {
+        sink = {};
+        REQUIRE(!push(capture, sink, 20, true));
+        REQUIRE(!push(capture, sink, 21, true));
+        REQUIRE(!push(capture, sink, 22));
+        REQUIRE(!push(capture, sink, 23));
+        REQUIRE(!push(capture, sink, 24));
+        REQUIRE(sink.timestamps == std::vector<uint64_t>{17, 18, 19, 20, 21, 22, 23});
+
+        const auto &stats = capture.get_stats();
+        CHECK(stats.pushed == 25);
+        CHECK(stats.triggers == 2);
+        CHECK(stats.flushed == 6 + 7);
+    }
+
+    SECTION("Sink errors are reported") {
+        sink.error = make_error_code(errc::stream_closed);
+        REQUIRE(push(capture, sink, 20, true) == make_error_code(errc::stream_closed));
+    }
+}
+
+TEST_CASE("TriggeredCapture___PushSampler___ReadsTheTriggerOfTheSampler") {
+    triggered_capture capture(1, 0, 1);
+    sink_stub sink{};
+    sampler_stub sampler{};
+
+    REQUIRE(!capture.push(sampler, 5, sink));
+    REQUIRE(sink.timestamps.empty());
+
+    sampler.triggered = true;
+    REQUIRE(!capture.push(sampler, 6, sink));
+    REQUIRE(sink.values == std::vector<double>{5.0, 6.0});
+    REQUIRE(!capture.is_capturing());
+
+    REQUIRE(capture.push(sampler, -1, sink) == make_error_code(errc::invalid_read_list));
+    REQUIRE(capture.get_stats().pushed == 2);
+}
+
+} // namespace hwcpipe
@@ -0,0 +1,531 @@
+/*
+ * Copyright (c) 2025 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/**
+ * @file
+ *
+ * A Vulkan layer that samples the Mali GPU counters at each vkQueueSubmit()
+ * and vkQueuePresentKHR() of an unmodified application, see
+ * hwcpipe::submit_sampler. The submitting threads only queue the tag of the
+ * sample, without a lock or a syscall; a collector thread per device takes
+ * the samples and writes them to a trace file with hwcpipe::trace_recorder.
+ * As the trace records have no user data, the frame and submit of each
+ * sample are written to a text file next to the trace, one
+ * "timestamp_ns_end frame submit" line per record, with "present" as the
+ * submit of the samples taken at a present.
+ *
+ * Environment variables:
+ *  - HWCPIPE_LAYER_TRACE: the trace file, "hwcpipe_layer.hwct" by default,
+ *    the tags being written to the same path with ".tags" appended.
+ *  - HWCPIPE_LAYER_DEVICE: the Mali device number, 0 by default.
+ *
+ * If the GPU can't be sampled, the layer only forwards the calls.
+ */
+
+#include <hwcpipe/counter_database.hpp>
+#include <hwcpipe/gpu.hpp>
+#include <hwcpipe/sampler.hpp>
+#include <hwcpipe/submit_sampler.hpp>
+#include <hwcpipe/trace_recorder.hpp>
+
+#include <vulkan/vk_layer.h>
+#include <vulkan/vulkan.h>
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+#define HWCPIPE_LAYER_EXPORT extern "C" __attribute__((visibility("default")))
+
+namespace {
+
+/** Time the collector waits for a sample before checking whether to stop, in nanoseconds. */
+constexpr uint64_t collect_timeout_ns = 10000000;
+
+/** Largest number of queues of all the devices at once. */
+constexpr size_t max_queues = 64;
+
+/** Samples the submits of a device, and records them on a collector thread. */
+class layer_session {
+  public:
+    /** @return A session sampling the GPU, or nullptr if it can't be sampled. */
+    static std::unique_ptr<layer_session> create(size_t num_channels) {
+        const char *device = std::getenv("HWCPIPE_LAYER_DEVICE");
+        const hwcpipe::gpu gpu(device != nullptr ? std::atoi(device) : 0);
+        if (!gpu) {
+            return nullptr;
+        }
+
+        hwcpipe::sampler_config config(gpu);
+        size_t num_counters = 0;
+        for (hwcpipe_counter counter : hwcpipe::counter_database{}.counters_for_gpu(gpu)) {
+            // counters the GPU doesn't have are skipped
+            if (!config.add_counter(counter)) {
+                ++num_counters;
+            }
+        }
+        if (num_counters == 0) {
+            return nullptr;
+        }
+
+        std::unique_ptr<layer_session> session(new layer_session(config, num_channels));
+        if (!session->start()) {
+            return nullptr;
+        }
+        return session;
+    }
+
+    ~layer_session() {
+        if (collector_.joinable()) {
+            stop_.store(true, std::memory_order_relaxed);
+            collector_.join();
+            // the layer has nowhere to report the errors
+            const auto stop_ec = sampler_.stop_sampling();
+            static_cast<void>(stop_ec);
+        }
+        sampler_.set_trace_recorder(static_cast<hwcpipe::trace_recorder *>(nullptr));
+        if (recorder_) {
+            const auto close_ec = recorder_->close();
+            static_cast<void>(close_ec);
+        }
+        if (tags_ != nullptr) {
+            std::fclose(tags_);
+        }
+    }
+
+    layer_session(const layer_session &) = delete;
+    layer_session &operator=(const layer_session &) = delete;
+
+    /** @return The submit sampler, whose producers never block. */
+    hwcpipe::submit_sampler<> &submits() { return submits_; }
+
+  private:
+    layer_session(const hwcpipe::sampler_config &config, size_t num_channels)
+        : config_(config)
+        , sampler_(config_)
+        , submits_(sampler_, make_config(num_channels)) {}
+
+    static hwcpipe::submit_sampler_config make_config(size_t num_channels) {
+        hwcpipe::submit_sampler_config config{};
+        config.num_channels = num_channels;
+        return config;
+    }
+
+    bool start() {
+        if (!sampler_) {
+            return false;
+        }
+
+        const char *trace = std::getenv("HWCPIPE_LAYER_TRACE");
+        const std::string path = trace != nullptr ? trace : "hwcpipe_layer.hwct";
+        recorder_.reset(new hwcpipe::trace_recorder(path, config_, sampler_.get_constants(),
+                                                    sampler_.get_block_extents()));
+        tags_ = std::fopen((path + ".tags").c_str(), "w");
+        if (!*recorder_ || tags_ == nullptr) {
+            return false;
+        }
+
+        sampler_.set_trace_recorder(recorder_.get());
+        if (sampler_.start_sampling()) {
+            return false;
+        }
+        collector_ = std::thread([this] { collect(); });
+        return true;
+    }
+
+    void collect() {
+        while (!stop_.load(std::memory_order_relaxed)) {
+            if (submits_.collect_for(collect_timeout_ns)) {
+                continue;
+            }
+            const auto tag = hwcpipe::submit_tag::decode(sampler_.get_sample_user_data());
+            const auto timestamp = static_cast<unsigned long long>(sampler_.get_sample_timestamp_end());
+            if (tag.submit == hwcpipe::present_submit) {
+                std::fprintf(tags_, "%llu %u present\n", timestamp, tag.frame);
+            } else {
+                std::fprintf(tags_, "%llu %u %u\n", timestamp, tag.frame, tag.submit);
+            }
+        }
+    }
+
+    const hwcpipe::sampler_config config_;
+    hwcpipe::sampler<> sampler_;
+    hwcpipe::submit_sampler<> submits_;
+    std::unique_ptr<hwcpipe::trace_recorder> recorder_{};
+    std::FILE *tags_{};
+    std::atomic<bool> stop_{false};
+    std::thread collector_{};
+};
+
+struct instance_data {
+    PFN_vkGetInstanceProcAddr get_instance_proc_addr;
+    PFN_vkDestroyInstance destroy_instance;
+};
+
+struct device_data {
+    PFN_vkGetDeviceProcAddr get_device_proc_addr;
+    PFN_vkDestroyDevice destroy_device;
+    PFN_vkGetDeviceQueue get_device_queue;
+    PFN_vkGetDeviceQueue2 get_device_queue2;
+    PFN_vkQueueSubmit queue_submit;
+    PFN_vkQueuePresentKHR queue_present;
+    // null if the GPU can't be sampled
+    std::unique_ptr<layer_session> session;
+    size_t num_channels;
+    size_t next_channel;
+};
+
+/**
+ * A queue of a device, and the channel of its submits. The entries are
+ * written under the global lock, when the application gets the queue, and
+ * read without a lock by the submits: the device and channel are published
+ * before the queue, and the queue is cleared before them.
+ */
+struct queue_entry {
+    std::atomic<VkQueue> queue;
+    std::atomic<device_data *> device;
+    std::atomic<size_t> channel;
+};
+
+/**
+ * A device of the dispatch table, that the submits to the queues without an
+ * entry look up without a lock. The nodes are written under the global lock.
+ * They are never freed but reused by the later devices, so that a lookup can
+ * walk the list while devices are created and destroyed.
+ */
+struct device_node {
+    std::atomic<void *> key;
+    std::atomic<device_data *> data;
+    device_node *next;
+};
+
+// guards the maps and the writes to the queue entries and device nodes
+std::mutex global_mutex;
+std::unordered_map<void *, instance_data> instances;
+std::unordered_map<void *, std::unique_ptr<device_data>> devices;
+queue_entry queues[max_queues];
+std::atomic<device_node *> device_nodes{nullptr};
+
+/** @return The key of the dispatch table of a dispatchable handle, shared by a device and its queues. */
+template <typename handle_t>
+void *dispatch_key(handle_t handle) {
+    return *reinterpret_cast<void **>(handle);
+}
+
+/** @return The data of the device of a queue, looked up without a lock. */
+const queue_entry *find_queue(VkQueue queue) {
+    for (const auto &entry : queues) {
+        if (entry.queue.load(std::memory_order_acquire) == queue) {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * @return The data of the device of a queue that has no entry, as there are
+ * at most max_queues of them, looked up without a lock. The queues share the
+ * dispatch key of their device.
+ */
+const device_data &find_device(VkQueue queue) {
+    void *const key = dispatch_key(queue);
+    // the device of a queue is in the table until it is destroyed
+    for (const device_node *node = device_nodes.load(std::memory_order_acquire);; node = node->next) {
+        if (node->key.load(std::memory_order_acquire) == key) {
+            return *node->data.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+/** Adds a device to the dispatch table, reusing the node of a destroyed device. Called under the global lock. */
+void publish_device(void *key, device_data *data) {
+    for (device_node *node = device_nodes.load(std::memory_order_relaxed); node != nullptr; node = node->next) {
+        if (node->key.load(std::memory_order_relaxed) == nullptr) {
+            node->data.store(data, std::memory_order_relaxed);
+            node->key.store(key, std::memory_order_release);
+            return;
+        }
+    }
+    auto *node = new device_node{};
+    node->data.store(data, std::memory_order_relaxed);
+    node->key.store(key, std::memory_order_relaxed);
+    node->next = device_nodes.load(std::memory_order_relaxed);
+    device_nodes.store(node, std::memory_order_release);
+}
+
+/** Removes a device from the dispatch table. Called under the global lock. */
+void retract_device(void *key) {
+    for (device_node *node = device_nodes.load(std::memory_order_relaxed); node != nullptr; node = node->next) {
+        if (node->key.load(std::memory_order_relaxed) == key) {
+            node->key.store(nullptr, std::memory_order_release);
+            node->data.store(nullptr, std::memory_order_relaxed);
+            return;
+        }
+    }
+}
+
+/** Gives a channel to a queue the first time the application gets it, if an entry is free. */
+void register_queue(VkDevice device, VkQueue queue) {
+    if (queue == VK_NULL_HANDLE) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(global_mutex);
+    if (find_queue(queue) != nullptr) {
+        return;
+    }
+    auto &data = *devices.at(dispatch_key(device));
+    for (auto &entry : queues) {
+        if (entry.queue.load(std::memory_order_relaxed) == VK_NULL_HANDLE) {
+            entry.device.store(&data, std::memory_order_relaxed);
+            // a channel per queue, as the submits of a queue are externally synchronized
+            entry.channel.store(data.next_channel++ % data.num_channels, std::memory_order_relaxed);
+            entry.queue.store(queue, std::memory_order_release);
+            return;
+        }
+    }
+}
+
+PFN_vkVoidFunction intercept_device_function(const char *name);
+
+VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo *create_info,
+                                              const VkAllocationCallbacks *allocator, VkInstance *instance) {
+    auto *link = static_cast<const VkLayerInstanceCreateInfo *>(create_info->pNext);
+    while (link != nullptr &&
+           (link->sType != VK_STRUCTURE_TYPE_LOADER_INSTANCE_CREATE_INFO || link->function != VK_LAYER_LINK_INFO)) {
+        link = static_cast<const VkLayerInstanceCreateInfo *>(link->pNext);
+    }
+    if (link == nullptr) {
+        return VK_ERROR_INITIALIZATION_FAILED;
+    }
+
+    const auto next_get_instance_proc_addr = link->u.pLayerInfo->pfnNextGetInstanceProcAddr;
+    // the next layer finds its own link
+    const_cast<VkLayerInstanceCreateInfo *>(link)->u.pLayerInfo = link->u.pLayerInfo->pNext;
+
+    const auto next_create_instance =
+        reinterpret_cast<PFN_vkCreateInstance>(next_get_instance_proc_addr(VK_NULL_HANDLE, "vkCreateInstance"));
+    const VkResult result = next_create_instance(create_info, allocator, instance);
+    if (result != VK_SUCCESS) {
+        return result;
+    }
+
+    instance_data data{};
+    data.get_instance_proc_addr = next_get_instance_proc_addr;
+    data.destroy_instance =
+        reinterpret_cast<PFN_vkDestroyInstance>(next_get_instance_proc_addr(*instance, "vkDestroyInstance"));
+
+    std::lock_guard<std::mutex> lock(global_mutex);
+    instances[dispatch_key(*instance)] = data;
+    return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL DestroyInstance(VkInstance instance, const VkAllocationCallbacks *allocator) {
+    PFN_vkDestroyInstance destroy_instance{};
+    {
+        std::lock_guard<std::mutex> lock(global_mutex);
+        const auto found = instances.find(dispatch_key(instance));
+        destroy_instance = found->second.destroy_instance;
+        instances.erase(found);
+    }
+    destroy_instance(instance, allocator);
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice physical_device, const VkDeviceCreateInfo *create_info,
+                                            const VkAllocationCallbacks *allocator, VkDevice *device) {
+    auto *link = static_cast<const VkLayerDeviceCreateInfo *>(create_info->pNext);
+    while (link != nullptr &&
+           (link->sType != VK_STRUCTURE_TYPE_LOADER_DEVICE_CREATE_INFO || link->function != VK_LAYER_LINK_INFO)) {
+        link = static_cast<const VkLayerDeviceCreateInfo *>(link->pNext);
+    }
+    if (link == nullptr) {
+        return VK_ERROR_INITIALIZATION_FAILED;
+    }
+
+    const auto next_get_instance_proc_addr = link->u.pLayerInfo->pfnNextGetInstanceProcAddr;
+    const auto next_get_device_proc_addr = link->u.pLayerInfo->pfnNextGetDeviceProcAddr;
+    const_cast<VkLayerDeviceCreateInfo *>(link)->u.pLayerInfo = link->u.pLayerInfo->pNext;
+
+    const auto next_create_device =
+        reinterpret_cast<PFN_vkCreateDevice>(next_get_instance_proc_addr(VK_NULL_HANDLE, "vkCreateDevice"));
+    const VkResult result = next_create_device(physical_device, create_info, allocator, device);
+    if (result != VK_SUCCESS) {
+        return result;
+    }
+
+    std::unique_ptr<device_data> data(new device_data{});
+    data->get_device_proc_addr = next_get_device_proc_addr;
+    data->destroy_device =
+        reinterpret_cast<PFN_vkDestroyDevice>(next_get_device_proc_addr(*device, "vkDestroyDevice"));
+    data->get_device_queue =
+        reinterpret_cast<PFN_vkGetDeviceQueue>(next_get_device_proc_addr(*device, "vkGetDeviceQueue"));
+    data->get_device_queue2 =
+        reinterpret_cast<PFN_vkGetDeviceQueue2>(next_get_device_proc_addr(*device, "vkGetDeviceQueue2"));
+    data->queue_submit = reinterpret_cast<PFN_vkQueueSubmit>(next_get_device_proc_addr(*device, "vkQueueSubmit"));
+    data->queue_present =
+        reinterpret_cast<PFN_vkQueuePresentKHR>(next_get_device_proc_addr(*device, "vkQueuePresentKHR"));
+
+    size_t num_queues = 0;
+    for (uint32_t i = 0; i != create_info->queueCreateInfoCount; ++i) {
+        num_queues += create_info->pQueueCreateInfos[i].queueCount;
+    }
+    data->num_channels = num_queues != 0 ? num_queues : 1;
+    data->session = layer_session::create(data->num_channels);
+
+    std::lock_guard<std::mutex> lock(global_mutex);
+    publish_device(dispatch_key(*device), data.get());
+    devices[dispatch_key(*device)] = std::move(data);
+    return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL DestroyDevice(VkDevice device, const VkAllocationCallbacks *allocator) {
+    std::unique_ptr<device_data> data;
+    {
+        std::lock_guard<std::mutex> lock(global_mutex);
+        const auto found = devices.find(dispatch_key(device));
+        data = std::move(found->second);
+        devices.erase(found);
+        retract_device(dispatch_key(device));
+        for (auto &entry : queues) {
+            if (entry.device.load(std::memory_order_relaxed) == data.get()) {
+                entry.queue.store(VK_NULL_HANDLE, std::memory_order_release);
+                entry.device.store(nullptr, std::memory_order_relaxed);
+            }
+        }
+    }
+    // stops the collector and closes the trace before the device goes away
+    data->session.reset();
+    data->destroy_device(device, allocator);
+}
+
+VKAPI_ATTR void VKAPI_CALL GetDeviceQueue(VkDevice device, uint32_t family, uint32_t index, VkQueue *queue) {
+    PFN_vkGetDeviceQueue get_device_queue{};
+    {
+        std::lock_guard<std::mutex> lock(global_mutex);
+        get_device_queue = devices.at(dispatch_key(device))->get_device_queue;
+    }
+    get_device_queue(device, family, index, queue);
+    register_queue(device, *queue);
+}
+
+VKAPI_ATTR void VKAPI_CALL GetDeviceQueue2(VkDevice device, const VkDeviceQueueInfo2 *info, VkQueue *queue) {
+    PFN_vkGetDeviceQueue2 get_device_queue2{};
+    {
+        std::lock_guard<std::mutex> lock(global_mutex);
+        get_device_queue2 = devices.at(dispatch_key(device))->get_device_queue2;
+    }
+    get_device_queue2(device, info, queue);
+    register_queue(device, *queue);
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL QueueSubmit(VkQueue queue, uint32_t count, const VkSubmitInfo *submits,
+                                           VkFence fence) {
+    // no lock on the submitting thread, the queue was registered when it was got
+    const queue_entry *entry = find_queue(queue);
+    if (entry == nullptr) {
+        // the queues without an entry aren't sampled
+        return find_device(queue).queue_submit(queue, count, submits, fence);
+    }
+    const device_data &device = *entry->device.load(std::memory_order_relaxed);
+    const VkResult result = device.queue_submit(queue, count, submits, fence);
+    if (result == VK_SUCCESS && device.session) {
+        device.session->submits().on_submit(entry->channel.load(std::memory_order_relaxed));
+    }
+    return result;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL QueuePresentKHR(VkQueue queue, const VkPresentInfoKHR *present_info) {
+    const queue_entry *entry = find_queue(queue);
+    if (entry == nullptr) {
+        return find_device(queue).queue_present(queue, present_info);
+    }
+    const device_data &device = *entry->device.load(std::memory_order_relaxed);
+    const VkResult result = device.queue_present(queue, present_info);
+    if ((result == VK_SUCCESS || result == VK_SUBOPTIMAL_KHR) && device.session) {
+        device.session->submits().on_present(entry->channel.load(std::memory_order_relaxed));
+    }
+    return result;
+}
+
+VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetDeviceProcAddr(VkDevice device, const char *name) {
+    PFN_vkVoidFunction next{};
+    {
+        std::lock_guard<std::mutex> lock(global_mutex);
+        next = devices.at(dispatch_key(device))->get_device_proc_addr(device, name);
+    }
+    // the wrappers call the next layer, which doesn't have the functions of
+    // the extensions and versions that aren't enabled, e.g. vkQueuePresentKHR
+    const PFN_vkVoidFunction function = intercept_device_function(name);
+    return function != nullptr && next != nullptr ? function : next;
+}
+
+VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetInstanceProcAddr(VkInstance instance, const char *name) {
+    if (std::strcmp(name, "vkGetInstanceProcAddr") == 0) {
+        return reinterpret_cast<PFN_vkVoidFunction>(&GetInstanceProcAddr);
+    }
+    if (std::strcmp(name, "vkCreateInstance") == 0) {
+        return reinterpret_cast<PFN_vkVoidFunction>(&CreateInstance);
+    }
+    if (std::strcmp(name, "vkDestroyInstance") == 0) {
+        return reinterpret_cast<PFN_vkVoidFunction>(&DestroyInstance);
+    }
+    if (std::strcmp(name, "vkCreateDevice") == 0) {
+        return reinterpret_cast<PFN_vkVoidFunction>(&CreateDevice);
+    }
+    if (instance == VK_NULL_HANDLE) {
+        return nullptr;
+    }
+
+    PFN_vkVoidFunction next{};
+    {
+        std::lock_guard<std::mutex> lock(global_mutex);
+        const auto found = instances.find(dispatch_key(instance));
+        next = found != instances.end() ? found->second.get_instance_proc_addr(instance, name) : nullptr;
+    }
+    const PFN_vkVoidFunction function = intercept_device_function(name);
+    return function != nullptr && next != nullptr ? function : next;
+}
+
+PFN_vkVoidFunction intercept_device_function(const char *name) {
+    if (std::strcmp(name, "vkGetDeviceProcAddr") == 0) {
+        return reinterpret_cast<PFN_vkVoidFunction>(&GetDeviceProcAddr);
+    }
+    if (std::strcmp(name, "vkDestroyDevice") == 0) {
+        return reinterpret_cast<PFN_vkVoidFunction>(&DestroyDevice);
+    }
+    if (std::strcmp(name, "vkGetDeviceQueue") == 0) {
+        return reinterpret_cast<PFN_vkVoidFunction>(&GetDeviceQueue);
+    }
+    if (std::strcmp(name, "vkGetDeviceQueue2") == 0) {
+        return reinterpret_cast<PFN_vkVoidFunction>(&GetDeviceQueue2);
+    }
+    if (std::strcmp(name, "vkQueueSubmit") == 0) {
+        return reinterpret_cast<PFN_vkVoidFunction>(&QueueSubmit);
+    }
+    if (std::strcmp(name, "vkQueuePresentKHR") == 0) {
+        return reinterpret_cast<PFN_vkVoidFunction>(&QueuePresentKHR);
+    }
+    return nullptr;
+}
+
+} // namespace
+
+HWCPIPE_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL
+vkNegotiateLoaderLayerInterfaceVersion(VkNegotiateLayerInterface *version) {
+    if (version->loaderLayerInterfaceVersion > 2) {
+        version->loaderLayerInterfaceVersion = 2;
+    }
+    version->pfnGetInstanceProcAddr = &GetInstanceProcAddr;
+    version->pfnGetDeviceProcAddr = &GetDeviceProcAddr;
+    version->pfnGetPhysicalDeviceProcAddr = nullptr;
+    return VK_SUCCESS;
+}